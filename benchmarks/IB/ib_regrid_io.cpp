@@ -0,0 +1,201 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LSiloDataWriter.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+#include "../benchmarks.h"
+
+// Benchmark of regridding (including the redistribution of Lagrangian data)
+// and of plot file output for a point-IB model of a circle (or sphere) on a
+// two-level hierarchy. Throughput is reported in Cartesian grid cells per
+// second for the regrid and VisIt (HDF5) output operations and in Lagrangian
+// nodes per second for the Silo output operation. The Silo timings include
+// waiting for the completion of asynchronous writes.
+
+namespace
+{
+int finest_ln;
+double radius;
+double node_spacing;
+
+// Place markers on a circle (or sphere) of radius `radius` centered in the unit
+// square (or cube) with a spacing of about `node_spacing`.
+void
+generate_structure(const unsigned int& /*strct_num*/,
+                   const int& ln,
+                   int& num_vertices,
+                   std::vector<IBTK::Point>& vertex_posn)
+{
+    if (ln != finest_ln)
+    {
+        num_vertices = 0;
+        vertex_posn.resize(num_vertices);
+        return;
+    }
+#if (NDIM == 2)
+    num_vertices = static_cast<int>(std::ceil(2.0 * M_PI * radius / node_spacing));
+    vertex_posn.resize(num_vertices);
+    for (int k = 0; k < num_vertices; ++k)
+    {
+        const double theta = 2.0 * M_PI * k / num_vertices;
+        vertex_posn[k](0) = 0.5 + radius * std::cos(theta);
+        vertex_posn[k](1) = 0.5 + radius * std::sin(theta);
+    }
+#endif
+#if (NDIM == 3)
+    // Use a Fibonacci lattice to get nearly uniformly spaced points.
+    num_vertices = static_cast<int>(std::ceil(4.0 * M_PI * radius * radius / (node_spacing * node_spacing)));
+    vertex_posn.resize(num_vertices);
+    const double golden_angle = M_PI * (3.0 - std::sqrt(5.0));
+    for (int k = 0; k < num_vertices; ++k)
+    {
+        const double z = 1.0 - 2.0 * (k + 0.5) / num_vertices;
+        const double r = std::sqrt(1.0 - z * z);
+        const double theta = golden_angle * k;
+        vertex_posn[k](0) = 0.5 + radius * r * std::cos(theta);
+        vertex_posn[k](1) = 0.5 + radius * r * std::sin(theta);
+        vertex_posn[k](2) = 0.5 + radius * z;
+    }
+#endif
+    return;
+} // generate_structure
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "ib_regrid_io.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        BenchmarkRecorder recorder("ib_regrid_io", argv[1], app_initializer->getComponentDatabase("Benchmark"));
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        finest_ln = input_db->getInteger("MAX_LEVELS") - 1;
+        radius = input_db->getDouble("R");
+        node_spacing = input_db->getDouble("DS");
+        Pointer<IBRedundantInitializer> ib_initializer = new IBRedundantInitializer(
+            "IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+        ib_initializer->setStructureNamesOnLevel(finest_ln, { "shell" });
+        ib_initializer->registerInitStructureFunction(generate_structure);
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+        Pointer<IBStandardForceGen> ib_force_fcn = new IBStandardForceGen();
+        ib_method_ops->registerIBLagrangianForceFunction(ib_force_fcn);
+
+        Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+
+        // Set up visualization plot file writers.
+        Pointer<VisItDataWriter<NDIM> > visit_data_writer = app_initializer->getVisItDataWriter();
+        Pointer<LSiloDataWriter> silo_data_writer = app_initializer->getLSiloDataWriter();
+        if (visit_data_writer) time_integrator->registerVisItDataWriter(visit_data_writer);
+        if (silo_data_writer)
+        {
+            ib_initializer->registerLSiloDataWriter(silo_data_writer);
+            ib_method_ops->registerLSiloDataWriter(silo_data_writer);
+        }
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        const double n_cells = count_cells(patch_hierarchy);
+        const double n_nodes = ib_method_ops->getLDataManager()->getNumberOfNodes(finest_ln);
+        recorder.run("regrid", n_cells, "cells", [&]() { time_integrator->regridHierarchy(); });
+
+        const double time = time_integrator->getIntegratorTime();
+        int output_num = 0;
+        if (visit_data_writer)
+        {
+            time_integrator->setupPlotData();
+            recorder.run("visit_output", n_cells, "cells", [&]() {
+                visit_data_writer->writePlotData(patch_hierarchy, output_num++, time);
+            });
+        }
+        if (silo_data_writer)
+        {
+            recorder.run("silo_output", n_nodes, "nodes", [&]() {
+                silo_data_writer->writePlotData(output_num++, time);
+                silo_data_writer->waitForPlotData();
+            });
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
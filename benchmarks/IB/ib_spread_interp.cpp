@@ -0,0 +1,152 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SideData.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LEInteractor.h>
+
+#include <random>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+#include "../benchmarks.h"
+
+// Benchmark of the point-IB regularized delta function kernels: each process
+// places points_per_cell random points in each cell of its patches and then
+// interpolates a side-centered velocity field to the points and spreads a force
+// from the points. Only the kernels are timed (i.e., ghost cell filling and the
+// accumulation of ghost cell values are not). Throughput is reported in points
+// per second.
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "ib_spread_interp.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        BenchmarkRecorder recorder("ib_spread_interp", argv[1], app_initializer->getComponentDatabase("Benchmark"));
+        const std::string kernel_fcn = input_db->getStringWithDefault("kernel_fcn", "IB_4");
+        const int points_per_cell = input_db->getIntegerWithDefault("points_per_cell", 1);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        const IntVector<NDIM> ghosts = LEInteractor::getMinimumGhostWidth(kernel_fcn);
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u");
+        Pointer<SideVariable<NDIM, double> > f_var = new SideVariable<NDIM, double>("f");
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, ghosts);
+        const int f_idx = var_db->registerVariableAndContext(f_var, ctx, ghosts);
+
+        // Initialize the (single level) patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        level->allocatePatchData(u_idx, 0.0);
+        level->allocatePatchData(f_idx, 0.0);
+
+        // Place random points in each local patch.
+        std::mt19937 generator(IBTK_MPI::getRank());
+        std::uniform_real_distribution<double> distribution(0.0, 1.0);
+        std::vector<std::vector<double> > X_data, U_data, F_data;
+        std::size_t n_local_points = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+            u_data->fillAll(1.0);
+            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+            const double* const x_lower = patch_geom->getXLower();
+            const double* const x_upper = patch_geom->getXUpper();
+            const int n_points = points_per_cell * patch->getBox().size();
+            std::vector<double> X(NDIM * n_points);
+            for (int k = 0; k < n_points; ++k)
+            {
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    X[NDIM * k + d] = x_lower[d] + (x_upper[d] - x_lower[d]) * distribution(generator);
+                }
+            }
+            X_data.push_back(X);
+            U_data.emplace_back(NDIM * n_points, 0.0);
+            F_data.emplace_back(NDIM * n_points, 1.0);
+            n_local_points += n_points;
+        }
+        const double n_points = IBTK_MPI::sumReduction(static_cast<double>(n_local_points));
+
+        recorder.run("interpolate", n_points, "points", [&]() {
+            int k = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++k)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+                LEInteractor::interpolate(
+                    U_data[k], NDIM, X_data[k], NDIM, u_data, patch, patch->getBox(), kernel_fcn);
+            }
+        });
+
+        recorder.run("spread", n_points, "points", [&]() {
+            int k = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++k)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<SideData<NDIM, double> > f_data = patch->getPatchData(f_idx);
+                LEInteractor::spread(f_data, F_data[k], NDIM, X_data[k], NDIM, patch, patch->getBox(), kernel_fcn);
+            }
+        });
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
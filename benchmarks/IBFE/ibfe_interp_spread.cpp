@@ -0,0 +1,173 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyGhostCellInterpolation.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <algorithm>
+#include <cmath>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+#include "../benchmarks.h"
+
+// Benchmark of the IBFE velocity interpolation and force spreading operations
+// for a disc (or sphere) discretized with elements of roughly the size of the
+// Cartesian grid cells. The timings include the L2 projection performed by
+// interpolateVelocity() and the ghost data accumulation performed by
+// spreadForce(). Throughput is reported in elements per second since the number
+// of quadrature points is determined internally by IBFEMethod.
+
+// Coordinate mapping function.
+void
+coordinate_mapping_function(libMesh::Point& X, const libMesh::Point& s, void* /*ctx*/)
+{
+    for (unsigned int d = 0; d < NDIM; ++d) X(d) = s(d) + 0.5;
+    return;
+} // coordinate_mapping_function
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    const LibMeshInit& init = ibtk_init.getLibMeshInit();
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "ibfe_interp_spread.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        BenchmarkRecorder recorder("ibfe_interp_spread", argv[1], app_initializer->getComponentDatabase("Benchmark"));
+
+        // Create a mesh of a disc (or sphere) whose elements are about MFAC
+        // times the size of the grid cells.
+        ReplicatedMesh mesh(init.comm(), NDIM);
+        const double dx = input_db->getDouble("DX");
+        const double ds = input_db->getDouble("MFAC") * dx;
+        const double R = input_db->getDouble("R");
+        const std::string elem_type = input_db->getString("ELEM_TYPE");
+        const int n_refinements = std::max(int(std::log2(R / ds)), 0);
+        MeshTools::Generation::build_sphere(mesh, R, n_refinements, Utility::string_to_enum<ElemType>(elem_type), 10);
+        mesh.prepare_for_use();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBFEMethod> ib_method_ops =
+            new IBFEMethod("IBFEMethod",
+                           app_initializer->getComponentDatabase("IBFEMethod"),
+                           &mesh,
+                           app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IBFE solver.
+        ib_method_ops->registerInitialCoordinateMappingFunction(coordinate_mapping_function);
+        ib_method_ops->initializeFEEquationSystems();
+        ib_method_ops->initializeFEData();
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // The stored velocity field does not contain ghost data, so we set up
+        // new velocity and force fields that do.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        const Pointer<SAMRAI::hier::Variable<NDIM> > u_var = time_integrator->getVelocityVariable();
+        const Pointer<VariableContext> ctx = var_db->getContext("benchmark");
+        const int n_ghosts = ib_method_ops->getMinimumGhostCellWidth().max();
+        const int u_ghost_idx = var_db->registerVariableAndContext(u_var, ctx, n_ghosts);
+        const int f_idx = var_db->registerClonedPatchDataIndex(u_var, u_ghost_idx);
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_ghost_idx);
+            level->allocatePatchData(f_idx);
+        }
+        muParserCartGridFunction u_init(
+            "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+        u_init.setDataOnPatchHierarchy(u_ghost_idx, u_var, patch_hierarchy, 0.0);
+
+        using InterpolationTransactionComponent = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
+        std::vector<InterpolationTransactionComponent> ghost_cell_components(1);
+        ghost_cell_components[0] = InterpolationTransactionComponent(u_ghost_idx,
+                                                                     "CONSERVATIVE_LINEAR_REFINE",
+                                                                     true,
+                                                                     "CONSERVATIVE_COARSEN",
+                                                                     "LINEAR",
+                                                                     false,
+                                                                     {}, // u_bc_coefs
+                                                                     nullptr);
+        HierarchyGhostCellInterpolation ghost_fill_op;
+        ghost_fill_op.initializeOperatorState(ghost_cell_components, patch_hierarchy);
+        ghost_fill_op.fillData(/*time*/ 0.0);
+
+        const double dt = time_integrator->getMaximumTimeStepSize();
+        const double current_time = time_integrator->getIntegratorTime();
+        time_integrator->preprocessIntegrateHierarchy(current_time, current_time + dt, 1);
+
+        const double n_elems = mesh.n_active_elem();
+        recorder.run("interpolate_velocity", n_elems, "elements", [&]() {
+            ib_method_ops->interpolateVelocity(u_ghost_idx, {}, {}, current_time);
+        });
+        recorder.run("spread_force", n_elems, "elements", [&]() {
+            ib_method_ops->spreadForce(f_idx, nullptr, {}, current_time + 0.5 * dt);
+        });
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -0,0 +1,173 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Collection of utility functions that are useful in benchmarks.
+
+#ifndef included_ibamr_benchmarks_h
+#define included_ibamr_benchmarks_h
+
+#include <ibamr/config.h>
+
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/config.h>
+
+#include <BoxArray.h>
+#include <PatchHierarchy.h>
+#include <PatchLevel.h>
+
+#include <tbox/Database.h>
+#include <tbox/PIO.h>
+#include <tbox/Pointer.h>
+#include <tbox/Utilities.h>
+
+#include <mpi.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Return the total number of cells on all levels of @p patch_hierarchy,
+// including those covered by finer levels.
+inline double
+count_cells(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > patch_hierarchy)
+{
+    double n_cells = 0.0;
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        const SAMRAI::hier::BoxArray<NDIM>& boxes = patch_hierarchy->getPatchLevel(ln)->getBoxes();
+        for (int i = 0; i < boxes.getNumberOfBoxes(); ++i) n_cells += boxes[i].size();
+    }
+    return n_cells;
+}
+
+/**
+ * Class that times operations and records the results in a standard,
+ * machine-readable format.
+ *
+ * Each operation is run num_warmup times without being timed and then
+ * num_repetitions times with timing. The time of a repetition is the time taken
+ * by the slowest process (i.e., the wall time of the collective operation). For
+ * each operation, rank 0 appends one JSON object (on a single line) to the
+ * output file:
+ *
+ * @code
+ * {"benchmark": "ib_spread_interp", "operation": "spread", "dim": 2,
+ *  "processes": 4, "threads": 1, "problem_size": 1048576, "units": "points",
+ *  "repetitions": 10, "time_min": 0.010, "time_mean": 0.011, "time_max": 0.012,
+ *  "throughput": 9.5e7, "version": "0.8.0", "input": "ib_spread_interp_2d.input"}
+ * @endcode
+ *
+ * where throughput is problem_size / time_mean in units per second. Strong and
+ * weak scaling data are obtained by running the same benchmark with different
+ * numbers of processes and problem sizes (see run_scaling.sh) and collecting
+ * the records from the output file.
+ *
+ * The parameters are read from the <code>Benchmark</code> database of the input
+ * file:
+ *
+ * @code
+ * Benchmark {
+ *    num_warmup      = 1                  // default is 1
+ *    num_repetitions = 10                 // default is 10
+ *    output_file     = "benchmarks.jsonl" // default is "benchmarks.jsonl"
+ * }
+ * @endcode
+ */
+class BenchmarkRecorder
+{
+public:
+    BenchmarkRecorder(std::string benchmark_name,
+                      std::string input_file_name,
+                      SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db)
+        : d_benchmark_name(std::move(benchmark_name)), d_input_file_name(std::move(input_file_name))
+    {
+        if (db)
+        {
+            d_num_warmup = db->getIntegerWithDefault("num_warmup", d_num_warmup);
+            d_num_repetitions = db->getIntegerWithDefault("num_repetitions", d_num_repetitions);
+            d_output_file_name = db->getStringWithDefault("output_file", d_output_file_name);
+        }
+        TBOX_ASSERT(d_num_warmup >= 0);
+        TBOX_ASSERT(d_num_repetitions > 0);
+    }
+
+    /**
+     * Run and time operation @p op, which processes @p problem_size items (in
+     * total, over all processes) measured in @p units.
+     */
+    template <typename Operation>
+    void run(const std::string& operation, const double problem_size, const std::string& units, Operation op)
+    {
+        for (int i = 0; i < d_num_warmup; ++i) op();
+
+        std::vector<double> times;
+        for (int i = 0; i < d_num_repetitions; ++i)
+        {
+            IBTK_MPI::barrier();
+            const double start_time = MPI_Wtime();
+            op();
+            const double elapsed_time = MPI_Wtime() - start_time;
+            times.push_back(IBTK_MPI::maxReduction(elapsed_time));
+        }
+        record(operation, problem_size, units, times);
+    }
+
+private:
+    void record(const std::string& operation,
+                const double problem_size,
+                const std::string& units,
+                const std::vector<double>& times) const
+    {
+        const double time_min = *std::min_element(times.begin(), times.end());
+        const double time_max = *std::max_element(times.begin(), times.end());
+        const double time_mean = std::accumulate(times.begin(), times.end(), 0.0) / times.size();
+        const double throughput = problem_size / time_mean;
+        int num_threads = 1;
+#ifdef _OPENMP
+        num_threads = omp_get_max_threads();
+#endif
+
+        SAMRAI::tbox::pout << std::setw(24) << std::left << d_benchmark_name + "::" + operation << " "
+                           << std::setw(12) << std::right << problem_size << " " << units << ": mean time "
+                           << std::scientific << std::setprecision(4) << time_mean << " s, throughput "
+                           << throughput << " " << units << "/s" << std::defaultfloat << std::endl;
+
+        if (IBTK_MPI::getRank() != 0) return;
+        std::ofstream out(d_output_file_name, std::ios_base::app);
+        out << std::setprecision(10);
+        out << "{\"benchmark\": \"" << d_benchmark_name << "\", \"operation\": \"" << operation
+            << "\", \"dim\": " << NDIM << ", \"processes\": " << IBTK_MPI::getNodes()
+            << ", \"threads\": " << num_threads << ", \"problem_size\": " << problem_size << ", \"units\": \""
+            << units << "\", \"repetitions\": " << times.size() << ", \"time_min\": " << time_min
+            << ", \"time_mean\": " << time_mean << ", \"time_max\": " << time_max
+            << ", \"throughput\": " << throughput << ", \"version\": \"" << IBTK_VERSION_MAJOR << "."
+            << IBTK_VERSION_MINOR << "." << IBTK_VERSION_SUBMINOR << "\", \"input\": \"" << d_input_file_name
+            << "\"}\n";
+    }
+
+    std::string d_benchmark_name;
+    std::string d_input_file_name;
+    int d_num_warmup = 1;
+    int d_num_repetitions = 10;
+    std::string d_output_file_name = "benchmarks.jsonl";
+};
+
+#endif // included_ibamr_benchmarks_h
@@ -0,0 +1,63 @@
+#!/bin/bash
+## ---------------------------------------------------------------------
+##
+## Copyright (c) 2026 - 2026 by the IBAMR developers
+## All rights reserved.
+##
+## This file is part of IBAMR.
+##
+## IBAMR is free software and is distributed under the 3-clause BSD
+## license. The full text of the license can be found in the file
+## COPYRIGHT at the top level directory of IBAMR.
+##
+## ---------------------------------------------------------------------
+
+# Run a benchmark with several numbers of processes to collect strong or weak
+# scaling data.
+#
+# usage: run_scaling.sh <strong|weak> <executable> <input file> <dim> <process counts...>
+#
+# For strong scaling the input file is used as is. For weak scaling the value of
+# N in the input file is treated as the number of cells per coordinate direction
+# for a single process and is multiplied by p^(1/dim) for p processes (so that
+# the number of cells per process stays roughly constant). Each run appends its
+# records to the output file set in the Benchmark database of the input file.
+#
+# The MPI launcher can be set with the MPIEXEC environment variable (the default
+# is mpirun).
+
+set -e
+
+if [ "$#" -lt 5 ]; then
+    echo "usage: $0 <strong|weak> <executable> <input file> <dim> <process counts...>"
+    exit 1
+fi
+
+MODE="$1"
+EXECUTABLE="$2"
+INPUT="$3"
+DIM="$4"
+shift 4
+MPIEXEC="${MPIEXEC:-mpirun}"
+
+if [ "$MODE" != "strong" ] && [ "$MODE" != "weak" ]; then
+    echo "unknown scaling mode $MODE: valid modes are strong and weak"
+    exit 1
+fi
+
+BASE_N=$(sed -n 's/^N *= *\([0-9]*\).*/\1/p' "$INPUT")
+if [ "$MODE" = "weak" ] && [ -z "$BASE_N" ]; then
+    echo "the input file $INPUT does not define N"
+    exit 1
+fi
+
+for NPROCS in "$@"; do
+    RUN_INPUT="$INPUT"
+    if [ "$MODE" = "weak" ]; then
+        N=$(awk -v n="$BASE_N" -v p="$NPROCS" -v d="$DIM" 'BEGIN { printf "%d", n * p^(1/d) + 0.5 }')
+        RUN_INPUT="$(basename "$INPUT" .input).weak.np$NPROCS.input"
+        sed "s/^N *= *[0-9]*/N = $N/" "$INPUT" > "$RUN_INPUT"
+    fi
+    echo "running $EXECUTABLE with $NPROCS processes ($MODE scaling, input $RUN_INPUT)"
+    $MPIEXEC -np "$NPROCS" "$EXECUTABLE" "$RUN_INPUT"
+done
@@ -40,6 +40,7 @@
 #include <ibtk/AppInitializer.h>
 #include <ibtk/IBTKInit.h>
 #include <ibtk/IBTK_MPI.h>
+#include <ibtk/VizOutputSchedule.h>
 #include <ibtk/libmesh_utilities.h>
 #include <ibtk/muParserCartGridFunction.h>
 #include <ibtk/muParserRobinBcCoefs.h>
@@ -131,7 +132,6 @@ main(int argc, char* argv[])
 
         // Get various standard options set in the input file.
         const bool dump_viz_data = app_initializer->dumpVizData();
-        const int viz_dump_interval = app_initializer->getVizDumpInterval();
         const bool uses_visit = dump_viz_data && app_initializer->getVisItDataWriter();
 #ifdef LIBMESH_HAVE_EXODUS_API
         const bool uses_exodus = dump_viz_data && !app_initializer->getExodusIIFilename().empty();
@@ -144,6 +144,7 @@ main(int argc, char* argv[])
         }
 #endif
         const string exodus_filename = app_initializer->getExodusIIFilename();
+        Pointer<VizOutputSchedule> viz_output_schedule = app_initializer->getVizOutputSchedule();
 
         const bool dump_restart_data = app_initializer->dumpRestartData();
         const int restart_dump_interval = app_initializer->getRestartDumpInterval();
@@ -331,6 +332,8 @@ main(int argc, char* argv[])
         {
             const bool from_restart = RestartManager::getManager()->isFromRestart();
             exodus_io->append(from_restart);
+            const std::vector<std::string>& exodus_variables = viz_output_schedule->getVariables("part_0");
+            if (!exodus_variables.empty()) exodus_io->set_output_variables(exodus_variables);
         }
 
         // Initialize hierarchy configuration and data on all patches.
@@ -387,16 +390,18 @@ main(int argc, char* argv[])
         if (dump_viz_data)
         {
             pout << "\n\nWriting visualization files...\n\n";
-            if (uses_visit)
+            if (uses_visit && viz_output_schedule->isEnabled("visit"))
             {
                 time_integrator->setupPlotData();
                 visit_data_writer->writePlotData(patch_hierarchy, iteration_num, loop_time);
             }
-            if (uses_exodus)
+            if (uses_exodus && viz_output_schedule->isEnabled("part_0"))
             {
                 if (ib_post_processor) ib_post_processor->postProcessData(loop_time);
-                exodus_io->write_timestep(
-                    exodus_filename, *equation_systems, iteration_num / viz_dump_interval + 1, loop_time);
+                exodus_io->write_timestep(exodus_filename,
+                                          *equation_systems,
+                                          viz_output_schedule->getOutputIndex("part_0", iteration_num),
+                                          loop_time);
             }
         }
 
@@ -435,19 +440,24 @@ main(int argc, char* argv[])
             // processing.
             iteration_num += 1;
             const bool last_step = !time_integrator->stepsRemaining();
-            if (dump_viz_data && (iteration_num % viz_dump_interval == 0 || last_step))
+            const bool write_visit = uses_visit && viz_output_schedule->isOutputStep("visit", iteration_num, last_step);
+            const bool write_exodus =
+                uses_exodus && viz_output_schedule->isOutputStep("part_0", iteration_num, last_step);
+            if (dump_viz_data && (write_visit || write_exodus))
             {
                 pout << "\nWriting visualization files...\n\n";
-                if (uses_visit)
+                if (write_visit)
                 {
                     time_integrator->setupPlotData();
                     visit_data_writer->writePlotData(patch_hierarchy, iteration_num, loop_time);
                 }
-                if (uses_exodus)
+                if (write_exodus)
                 {
                     if (ib_post_processor) ib_post_processor->postProcessData(loop_time);
-                    exodus_io->write_timestep(
-                        exodus_filename, *equation_systems, iteration_num / viz_dump_interval + 1, loop_time);
+                    exodus_io->write_timestep(exodus_filename,
+                                              *equation_systems,
+                                              viz_output_schedule->getOutputIndex("part_0", iteration_num),
+                                              loop_time);
                 }
             }
             if (dump_restart_data && (iteration_num % restart_dump_interval == 0 || last_step))
@@ -21,6 +21,7 @@
 #include <ibtk/config.h>
 
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/VizOutputSchedule.h"
 
 #include "VisItDataWriter.h"
 #include "tbox/Database.h"
@@ -150,6 +151,16 @@ public:
      */
     std::string getGMVFilename(const std::string& prefix = "") const;
 
+    /*!
+     * Return the object that determines the output intervals and variables of
+     * the individual visualization output streams.
+     *
+     * The schedule is read from the VizOutputSchedule database of the Main
+     * database.  Streams that are not configured there are written every
+     * getVizDumpInterval() time steps.
+     */
+    SAMRAI::tbox::Pointer<VizOutputSchedule> getVizOutputSchedule() const;
+
     /*!
      * Return a boolean value indicating whether to write restart data.
      */
@@ -236,6 +247,7 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::appu::VisItDataWriter<NDIM> > d_visit_data_writer;
     SAMRAI::tbox::Pointer<LSiloDataWriter> d_silo_data_writer;
     std::string d_exodus_filename = "output.ex2", d_gmv_filename = "output.gmv";
+    SAMRAI::tbox::Pointer<VizOutputSchedule> d_viz_output_schedule;
 
     /*!
      * Restart options.
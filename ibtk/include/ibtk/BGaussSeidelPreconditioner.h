@@ -24,6 +24,7 @@
 
 #include "tbox/ConstPointer.h"
 #include "tbox/Pointer.h"
+#include "tbox/Timer.h"
 
 #include <map>
 #include <string>
@@ -68,7 +69,12 @@ namespace IBTK
  * with the last vector component.  The algorithm can be symmetrized via the
  * setSymmetricPreconditioner() member function, and the order in which vector
  * components are visited can be reversed via the setReversedOrder() member
- * function.
+ * function.  Because the initial guess is zero, the off-diagonal operators are
+ * only applied to components that have already been updated during the sweep.
+ *
+ * The time spent in the preconditioner for component <TT>k</TT> is recorded by
+ * the timer
+ * <TT>IBTK::BGaussSeidelPreconditioner::solveSystem()[component_k]</TT>.
  *
  * \note Class BJacobiPreconditioner implements the additive (i.e., block
  * Jacobi) version of this algorithm.
@@ -298,6 +304,11 @@ private:
      */
     std::map<unsigned int, SAMRAI::tbox::Pointer<LinearSolver> > d_pc_map;
 
+    /*!
+     * Timers for the component preconditioners.
+     */
+    std::map<unsigned int, SAMRAI::tbox::Pointer<SAMRAI::tbox::Timer> > d_pc_timer_map;
+
     /*!
      * The component operators.
      */
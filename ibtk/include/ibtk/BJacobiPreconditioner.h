@@ -23,6 +23,7 @@
 #include "ibtk/LinearSolver.h"
 
 #include "tbox/Pointer.h"
+#include "tbox/Timer.h"
 
 #include <map>
 #include <string>
@@ -54,6 +55,11 @@ namespace IBTK
  * Note that the block Jacobi algorithm is not generally convergent, but can be
  * used as a preconditioner for a KrylovLinearSolver.
  *
+ * The component preconditioners are applied one after another, since each of
+ * them generally communicates over all processes.  The time spent in the
+ * preconditioner for component <TT>k</TT> is recorded by the timer
+ * <TT>IBTK::BJacobiPreconditioner::solveSystem()[component_k]</TT>.
+ *
  * \note Class BGaussSeidelPreconditioner implements the multiplicative (i.e.,
  * block Gauss-Seidel) version of this algorithm.
  *
@@ -252,6 +258,11 @@ private:
      * The component preconditioners.
      */
     std::map<unsigned int, SAMRAI::tbox::Pointer<LinearSolver> > d_pc_map;
+
+    /*!
+     * Timers for the component preconditioners.
+     */
+    std::map<unsigned int, SAMRAI::tbox::Pointer<SAMRAI::tbox::Timer> > d_pc_timer_map;
 };
 } // namespace IBTK
 
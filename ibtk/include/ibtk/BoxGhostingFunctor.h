@@ -0,0 +1,114 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_BoxGhostingFunctor
+#define included_IBTK_BoxGhostingFunctor
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "IntVector.h"
+#include "PatchHierarchy.h"
+
+#include <libmesh/ghosting_functor.h>
+#include <libmesh/id_types.h>
+#include <libmesh/mesh_base.h>
+
+#include <set>
+#include <vector>
+
+namespace libMesh
+{
+class MeshBase;
+class System;
+} // namespace libMesh
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+namespace IBTK
+{
+/*!
+ * @brief A libMesh ghosting functor that keeps, on each processor, copies of
+ * all elements of a distributed mesh that may intersect the locally owned
+ * Cartesian grid patches.
+ *
+ * IBAMR interpolates and spreads on the Cartesian grid patches of each
+ * processor, so each processor needs all elements that are near its patches,
+ * not just the elements it owns and their neighbors. This is automatic for a
+ * replicated mesh. For a libMesh::DistributedMesh this functor should be
+ * attached to the mesh with libMesh::MeshBase::add_ghosting_functor() so that
+ * libMesh::MeshBase::redistribute() sends these elements to each processor and
+ * libMesh::MeshBase::delete_remote_elements() does not delete them.
+ *
+ * Whether or not an element is needed is decided by reinit(), which should be
+ * called with the current patch hierarchy every time it is regridded and
+ * before the mesh is redistributed. An element is needed by a processor if
+ * the bounding box of its nodes (with respect to the current position of the
+ * mesh) intersects the bounding box of the patches of that processor grown by
+ * the given ghost width.
+ */
+class BoxGhostingFunctor : public libMesh::GhostingFunctor
+{
+public:
+    /*!
+     * Constructor.
+     *
+     * @param mesh the mesh to which this functor will be attached.
+     *
+     * @param position_system the libMesh::System object whose current
+     * solution is the position of the mesh.
+     */
+    BoxGhostingFunctor(const libMesh::MeshBase& mesh, const libMesh::System& position_system);
+
+    /*!
+     * Determine which local elements are needed by each processor and
+     * communicate this information.
+     *
+     * @param hierarchy the patch hierarchy whose locally owned patches (on
+     * all levels) determine which elements are needed.
+     *
+     * @param ghost_width the number of cells by which patches are grown.
+     */
+    void reinit(const SAMRAI::hier::PatchHierarchy<NDIM>& hierarchy, const SAMRAI::hier::IntVector<NDIM>& ghost_width);
+
+    /*!
+     * Add all elements needed by processor @p p that are stored on the current
+     * processor to @p coupled_elements. The range of elements is not used.
+     */
+    virtual void operator()(const libMesh::MeshBase::const_element_iterator& range_begin,
+                            const libMesh::MeshBase::const_element_iterator& range_end,
+                            libMesh::processor_id_type p,
+                            map_type& coupled_elements) override;
+
+private:
+    /// The mesh.
+    const libMesh::MeshBase& d_mesh;
+
+    /// The system whose current solution is the position of the mesh.
+    const libMesh::System& d_position_system;
+
+    /// IDs of the local elements needed by each other processor, as computed
+    /// by the last call to reinit().
+    std::vector<std::vector<libMesh::dof_id_type> > d_elem_ids_for_rank;
+
+    /// IDs of the elements (owned by any processor) needed by this
+    /// processor, as computed by the last call to reinit().
+    std::set<libMesh::dof_id_type> d_needed_elem_ids;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_BoxGhostingFunctor
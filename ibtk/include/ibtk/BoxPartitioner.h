@@ -51,6 +51,13 @@ namespace IBTK
  * be used to partition the libMesh Mesh object across the MPI network. Put
  * another way: this Partitioner uses Eulerian grid data to partition the
  * structural meshes.
+ *
+ * Both replicated and distributed meshes are supported. For a distributed
+ * mesh, each processor only assigns its own elements (using the partitioning
+ * boxes of all processors), and the elements are moved to their new
+ * processors when libMesh redistributes the mesh: i.e., distributed meshes
+ * should be partitioned with libMesh::Partitioner::partition() rather than
+ * libMesh::Partitioner::repartition().
  */
 class BoxPartitioner : public libMesh::Partitioner
 {
@@ -107,6 +114,10 @@ protected:
 
     /// Pointer, if relevant, to the libMesh mesh position system.
     const libMesh::System* const d_position_system = nullptr;
+
+private:
+    /// Assign the active local elements of a distributed mesh to processors.
+    void partitionDistributedMesh(libMesh::MeshBase& mesh);
 };
 } // namespace IBTK
 //////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,107 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_BoxTree
+#define included_IBTK_BoxTree
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include <ibtk/ibtk_utilities.h>
+
+#include <utility>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class BoxTree is a static, bulk-loaded R-tree over a collection of
+ * closed, axis-aligned <code>NDIM</code>-dimensional boxes.
+ *
+ * The tree is built once (by recursively splitting the boxes at the median
+ * of their centers along the longest extent of the centers) and supports
+ * queries for all boxes that intersect a given box in
+ * <code>O(log(n) + k)</code> time for well-distributed boxes, where
+ * <code>k</code> is the number of boxes that are found.
+ *
+ * This class is used, e.g., by FEDataManager to associate elements with
+ * patches without testing every element against every patch.
+ */
+class BoxTree
+{
+public:
+    /*!
+     * \brief Default constructor: an empty tree.
+     */
+    BoxTree() = default;
+
+    /*!
+     * \brief Constructor. Builds the tree for the boxes given as pairs of
+     * lower and upper corners. Boxes are identified by their index in @p
+     * boxes.
+     */
+    BoxTree(const EigenAlignedVector<std::pair<Point, Point> >& boxes);
+
+    /*!
+     * \brief Return the number of boxes stored in the tree.
+     */
+    int size() const;
+
+    /*!
+     * \brief Append the indices of all boxes that intersect the closed box
+     * [@p lower, @p upper] to @p box_ids. The indices are not sorted.
+     */
+    void query(const Point& lower, const Point& upper, std::vector<int>& box_ids) const;
+
+private:
+    /*!
+     * \brief Recursively build the subtree for the boxes with indices
+     * d_box_ids[begin], ..., d_box_ids[end - 1] and return the index of its
+     * root node.
+     */
+    int buildSubtree(int begin, int end);
+
+    /*!
+     * Maximum number of boxes stored in a leaf node.
+     */
+    static const int s_max_leaf_size = 4;
+
+    /*!
+     * Node data. Internal nodes have two children; the boxes of leaf nodes are
+     * d_box_ids[begin], ..., d_box_ids[end - 1].
+     */
+    struct Node
+    {
+        Point lower, upper;
+        int begin, end;
+        int left = -1, right = -1;
+    };
+    EigenAlignedVector<Node> d_nodes;
+
+    /*!
+     * Boxes and their indices, ordered so that the boxes of each node are
+     * stored contiguously.
+     */
+    EigenAlignedVector<std::pair<Point, Point> > d_boxes;
+    std::vector<int> d_box_ids;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_BoxTree
@@ -33,6 +33,7 @@
 #include "petscmat.h"
 #include "petscvec.h"
 
+#include <cstddef>
 #include <map>
 #include <string>
 #include <vector>
@@ -105,7 +106,18 @@ namespace IBTK
     num_pre_relax_steps = 0
     num_post_relax_steps = 2
  }
+ use_dense_patch_solver = FALSE               // whether to solve small patch problems directly
+ dense_patch_solver_max_size = 256            // largest patch (in cells) solved directly
  \endverbatim
+ *
+ * By default, the patch problems of the smoother are solved by one PETSc KSP
+ * per patch. When \p use_dense_patch_solver is set, the operators of patches
+ * with at most \p dense_patch_solver_max_size cells are instead inverted once
+ * when the operator state is initialized. The inverses of the patches of each
+ * level are stored in a single contiguous array and are applied to all data
+ * depths at once by a dense matrix-matrix product, which avoids the overhead of
+ * the PETSc objects for the many small patch problems of a typical hierarchy.
+ * Larger patches are still solved by PETSc.
 */
 class CCPoissonBoxRelaxationFACOperator : public PoissonFACPreconditionerStrategy
 {
@@ -283,6 +295,48 @@ private:
                                          SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                                          const SAMRAI::hier::IntVector<NDIM>& ghost_cell_width);
 
+    /*!
+     * \brief Dense form of the operator restricted to a single patch.
+     *
+     * The couplings of the patch cells to the ghost cells are kept in
+     * coordinate form so that the ghost cell values can be moved to the
+     * right-hand side of the patch problem.
+     */
+    struct DensePatchOperator
+    {
+        // Number of patch cells, or zero if the patch is solved by PETSc.
+        int num_cells = 0;
+
+        // Offset of the inverse of the patch operator in the level array.
+        std::size_t inv_offset = 0;
+
+        // Offsets of the patch cells in the ghost box of the patch.
+        std::vector<int> cell_offsets;
+
+        // Couplings of the patch cells to the ghost cells.
+        std::vector<int> bdry_rows, bdry_cols;
+        std::vector<double> bdry_vals;
+    };
+
+    /*!
+     * \brief Extract the dense form of the patch operator A and append its
+     * inverse to the inverses of the level.
+     */
+    static void buildDensePatchOperator(DensePatchOperator& dense_op,
+                                        std::vector<double>& level_inv,
+                                        const Mat& A,
+                                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                        const SAMRAI::hier::IntVector<NDIM>& ghost_cell_width);
+
+    /*!
+     * \brief Solve the patch problems for all data depths using the dense form
+     * of the patch operator.
+     */
+    static void applyDensePatchOperator(const DensePatchOperator& dense_op,
+                                        const double* inv,
+                                        SAMRAI::pdat::CellData<NDIM, double>& error_data,
+                                        const SAMRAI::pdat::CellData<NDIM, double>& residual_data);
+
     /*
      * Coarse level solvers and solver parameters.
      */
@@ -297,6 +351,14 @@ private:
     std::vector<std::vector<Mat> > d_patch_mat;
     std::vector<std::vector<KSP> > d_patch_ksp;
 
+    /*
+     * Dense patch operators and the contiguous arrays of their inverses.
+     */
+    bool d_use_dense_patch_solver = false;
+    int d_dense_patch_solver_max_size = 256;
+    std::vector<std::vector<DensePatchOperator> > d_dense_patch_ops;
+    std::vector<std::vector<double> > d_dense_patch_inv;
+
     /*
      * Patch overlap data.
      */
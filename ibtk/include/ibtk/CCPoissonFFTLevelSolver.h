@@ -0,0 +1,182 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_CCPoissonFFTLevelSolver
+#define included_IBTK_CCPoissonFFTLevelSolver
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "ibtk/LinearSolver.h"
+#include "ibtk/PoissonSolver.h"
+
+#include "Box.h"
+#include "IntVector.h"
+#include "PatchLevel.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+#include <string>
+#include <vector>
+
+namespace SAMRAI
+{
+namespace solv
+{
+template <int DIM, class TYPE>
+class SAMRAIVectorReal;
+} // namespace solv
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class CCPoissonFFTLevelSolver is a concrete LinearSolver for solving
+ * elliptic equations of the form \f$ \mbox{$L u$} = \mbox{$(C I + \nabla \cdot
+ * D \nabla) u$} = f \f$ on a \em single, uniform SAMRAI::hier::PatchLevel of a
+ * domain that is periodic in every direction using discrete Fourier
+ * transforms.
+ *
+ * The coefficients \f$C\f$ and \f$D\f$ must be constant, and the operator is
+ * the standard second-order accurate cell-centered discretization, which is
+ * diagonalized by the discrete Fourier transform.  The system is therefore
+ * solved exactly (up to roundoff error) by a single forward transform, a
+ * division by the symbol of the operator, and an inverse transform.  If the
+ * operator is singular (e.g., if \f$C = 0\f$), the component of the
+ * right-hand side in the nullspace is discarded and the solution has zero
+ * mean.
+ *
+ * The transforms are computed by FFTUtilities.  The right-hand side is gathered
+ * onto every process, so this solver is intended for levels that are small
+ * enough to be replicated, e.g., as the coarsest level solver of a FAC
+ * preconditioner or as a direct solver for moderately sized uniform grids.
+ *
+ * Sample parameters for initialization from database (and their default
+ * values): \verbatim
+ enable_logging = FALSE  // see setLoggingEnabled()
+ \endverbatim
+ */
+class CCPoissonFFTLevelSolver : public LinearSolver, public PoissonSolver
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    CCPoissonFFTLevelSolver(const std::string& object_name,
+                            SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                            const std::string& default_options_prefix);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~CCPoissonFFTLevelSolver();
+
+    /*!
+     * \brief Static function to construct a CCPoissonFFTLevelSolver.
+     */
+    static SAMRAI::tbox::Pointer<PoissonSolver> allocate_solver(const std::string& object_name,
+                                                                SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                                                                const std::string& default_options_prefix)
+    {
+        return new CCPoissonFFTLevelSolver(object_name, input_db, default_options_prefix);
+    } // allocate_solver
+
+    /*!
+     * \name Linear solver functionality.
+     */
+    //\{
+
+    /*!
+     * \brief Solve the linear system of equations \f$Ax=b\f$ for \f$x\f$.
+     *
+     * \note The solver need not be initialized prior to calling solveSystem();
+     * however, see initializeSolverState() and deallocateSolverState() for
+     * opportunities to save overhead when performing multiple consecutive
+     * solves.
+     *
+     * \return \p true
+     */
+    bool solveSystem(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                     SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b) override;
+
+    /*!
+     * \brief Compute hierarchy dependent data required for solving \f$Ax=b\f$.
+     *
+     * An unrecoverable error occurs if the vectors are not defined on a single
+     * uniform level of a periodic domain or if the problem coefficients are not
+     * constant.
+     */
+    void initializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                               const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b) override;
+
+    /*!
+     * \brief Remove all hierarchy dependent data allocated by
+     * initializeSolverState().
+     */
+    void deallocateSolverState() override;
+
+    //\}
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    CCPoissonFFTLevelSolver() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    CCPoissonFFTLevelSolver(const CCPoissonFFTLevelSolver& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    CCPoissonFFTLevelSolver& operator=(const CCPoissonFFTLevelSolver& that) = delete;
+
+    /*!
+     * \brief Associated patch level, its domain box, and the depth of the
+     * solution data.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > d_level;
+    SAMRAI::hier::Box<NDIM> d_domain_box;
+    SAMRAI::hier::IntVector<NDIM> d_num_cells;
+    unsigned int d_depth = 0;
+
+    /*!
+     * \brief Eigenvalues of the discrete Laplacian for each mode, ordered like
+     * the entries of the transformed data.
+     */
+    std::vector<double> d_laplace_symbol;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_CCPoissonFFTLevelSolver
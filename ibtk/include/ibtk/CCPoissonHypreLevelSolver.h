@@ -25,11 +25,13 @@
 #include "ibtk/ibtk_utilities.h"
 
 #include "Box.h"
+#include "BoxArray.h"
 #include "CoarseFineBoundary.h"
 #include "Index.h"
 #include "IntVector.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
@@ -112,6 +114,7 @@ namespace IBTK
  skip_relax = 1                 // see hypre User's Manual (only used by PFMG solver or
  preconditioner)
  two_norm = 1                   // see hypre User's Manual (only used by PCG solver)
+ reuse_solver_setup = TRUE      // see initializeSolverState()
  \endverbatim
  *
  * \em hypre is developed in the Center for Applied Scientific Computing (CASC)
@@ -225,6 +228,16 @@ public:
      * already initialized.  In this case, the solver state is first deallocated
      * and then reinitialized.
      *
+     * \note Unless the input parameter \c reuse_solver_setup is set to \c
+     * FALSE, deallocateSolverState() retains the hypre data structures, and
+     * they are reused by the next call to initializeSolverState() if the patch
+     * level and the structure of the discretization are unchanged.  In this
+     * case, the matrix coefficients are recomputed and compared to those of
+     * the retained matrix.  If the new matrix is a scalar multiple of the
+     * retained one (e.g., because only the time step size changed), the hypre
+     * solver setup is reused as is.  Otherwise, the matrix coefficients are
+     * updated in place and only the hypre solver is set up again.
+     *
      * \see deallocateSolverState
      */
     void initializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
@@ -276,8 +289,9 @@ private:
      * data structures.
      */
     void allocateHypreData();
-    void setMatrixCoefficients_aligned();
-    void setMatrixCoefficients_nonaligned();
+    void computeMatrixCoefficients_aligned(std::vector<std::vector<double> >& matrix_values);
+    void computeMatrixCoefficients_nonaligned(std::vector<std::vector<double> >& matrix_values);
+    void setMatrixCoefficients();
     void setupHypreSolver();
     bool solveSystem(int x_idx, int b_idx);
     void copyToHypre(const std::vector<HYPRE_StructVector>& vectors,
@@ -288,6 +302,7 @@ private:
                        const SAMRAI::hier::Box<NDIM>& box);
     void destroyHypreSolver();
     void deallocateHypreData();
+    void releaseHypreData();
 
     /*!
      * \brief Associated hierarchy.
@@ -296,10 +311,16 @@ private:
 
     /*!
      * \brief Associated patch level and C-F boundary (for level numbers > 0).
+     *
+     * The level is only retained while the solver is initialized.  The boxes
+     * of the level and their assignment to processors are kept with the
+     * retained hypre data structures to determine whether those can be reused.
      */
     int d_level_num = IBTK::invalid_level_number;
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > d_level;
     SAMRAI::tbox::Pointer<SAMRAI::hier::CoarseFineBoundary<NDIM> > d_cf_boundary;
+    SAMRAI::hier::BoxArray<NDIM> d_level_boxes;
+    SAMRAI::tbox::Array<int> d_level_mapping;
 
     /*!
      * \name Problem specification.
@@ -318,6 +339,15 @@ private:
     std::vector<HYPRE_StructSolver> d_solvers, d_preconds;
     std::vector<SAMRAI::hier::Index<NDIM> > d_stencil_offsets;
 
+    /*
+     * The matrix coefficients stored in the hypre matrices and the factor by
+     * which the current operator differs from them.
+     */
+    bool d_reuse_solver_setup = true;
+    bool d_hypre_data_allocated = false;
+    std::vector<std::vector<double> > d_matrix_values;
+    double d_matrix_scale = 1.0;
+
     std::string d_solver_type = "PFMG", d_precond_type = "none";
     int d_rel_change = 0;
     int d_num_pre_relax_steps = 1, d_num_post_relax_steps = 1;
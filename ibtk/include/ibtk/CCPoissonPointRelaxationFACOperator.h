@@ -89,6 +89,8 @@ namespace IBTK
  * values): \verbatim
 
  smoother_type = "PATCH_GAUSS_SEIDEL"         // see setSmootherType()
+ chebyshev_eigenvalue_ratio = 30.0            // see setSmootherType()
+ use_single_precision_smoother_data = FALSE   // see setSmootherType()
  prolongation_method = "LINEAR_REFINE"        // see setProlongationMethod()
  restriction_method = "CONSERVATIVE_COARSEN"  // see setRestrictionMethod()
  coarse_solver_type = "HYPRE_LEVEL_SOLVER"    // see setCoarseSolverType()
@@ -143,6 +145,28 @@ public:
      * - \c "PATCH_GAUSS_SEIDEL"
      * - \c "PROCESSOR_GAUSS_SEIDEL"
      * - \c "RED_BLACK_GAUSS_SEIDEL"
+     * - \c "CHEBYSHEV"
+     *
+     * The \c "CHEBYSHEV" smoother performs one step of a Chebyshev iteration
+     * for the Jacobi-scaled operator per sweep, so that each sweep requires
+     * only one ghost cell fill and one operator application. The iteration
+     * targets the eigenvalues in the interval [lambda_max/r, lambda_max], in
+     * which lambda_max is a Gershgorin bound that is computed for each level
+     * when the operator state is initialized and r is set by the input
+     * parameter \c chebyshev_eigenvalue_ratio. Variable coefficients are
+     * therefore evaluated at the time that the operator state is initialized.
+     *
+     * When the input parameter \c use_single_precision_smoother_data is set,
+     * the Chebyshev smoother keeps its search direction in single-precision
+     * data, which reduces the memory traffic of each sweep. The residual is
+     * read and the error is updated and stored in double precision. This
+     * setting has no effect on the Gauss-Seidel smoothers.
+     *
+     * \note The \c "PATCH_GAUSS_SEIDEL" and \c "RED_BLACK_GAUSS_SEIDEL"
+     * smoothers update all local patches of a level in a single pass. When
+     * IBAMR is compiled with OpenMP, the patches are smoothed concurrently.
+     * The \c "PROCESSOR_GAUSS_SEIDEL" smoother always visits the local patches
+     * one at a time.
      */
     void setSmootherType(const std::string& smoother_type) override;
 
@@ -261,6 +285,21 @@ private:
      */
     std::vector<std::vector<SAMRAI::hier::BoxList<NDIM> > > d_patch_bc_box_overlap;
     std::vector<std::vector<std::map<int, SAMRAI::hier::Box<NDIM> > > > d_patch_neighbor_overlap;
+
+    /*
+     * Chebyshev smoother parameters and the estimated largest eigenvalue of
+     * the Jacobi-scaled operator on each level.
+     */
+    double d_chebyshev_eigenvalue_ratio = 30.0;
+    std::vector<double> d_chebyshev_max_eigenvalue;
+
+    /*
+     * Single-precision search direction used by the Chebyshev smoother. The
+     * variable is only registered when single-precision smoother data are
+     * requested.
+     */
+    bool d_use_single_precision_smoother_data = false;
+    int d_float_direction_idx = IBTK::invalid_index;
 };
 } // namespace IBTK
 
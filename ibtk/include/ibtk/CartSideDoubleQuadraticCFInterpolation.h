@@ -32,7 +32,9 @@
 #include "SideVariable.h"
 #include "tbox/Pointer.h"
 
+#include <map>
 #include <set>
+#include <utility>
 #include <vector>
 
 namespace SAMRAI
@@ -242,6 +244,17 @@ private:
      */
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
     std::vector<SAMRAI::hier::CoarseFineBoundary<NDIM> > d_cf_boundary;
+
+    /*!
+     * The boundary fill boxes and location indices of the co-dimension 1
+     * coarse-fine boundary boxes of each local patch, indexed by level number
+     * and patch number.  These depend only on the grid configuration and are
+     * computed once in setPatchHierarchy() rather than each time ghost cells
+     * are filled.
+     */
+    std::vector<std::map<int, std::vector<std::pair<SAMRAI::hier::Box<NDIM>, unsigned int> > > >
+        d_cf_bdry_fill_boxes;
+
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, int> > d_sc_indicator_var =
         new SAMRAI::pdat::SideVariable<NDIM, int>("CartSideDoubleQuadraticCFInterpolation::sc_indicator_var");
     int d_sc_indicator_idx = IBTK::invalid_index;
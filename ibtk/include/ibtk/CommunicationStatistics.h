@@ -0,0 +1,271 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_CommunicationStatistics
+#define included_IBTK_CommunicationStatistics
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+#include "petscvec.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class CommunicationStatistics is a singleton class that tallies the
+ * number of messages and bytes communicated by each phase of a simulation and
+ * each pair of processes.
+ *
+ * Communication is attributed to the innermost phase that is active when it is
+ * recorded (see ScopedPhase), or to the phase <TT>unassigned</TT> if no phase
+ * is active.  The following code paths record their communication:
+ *
+ * - the IBTK_MPI wrappers: point-to-point sends and collective operations;
+ * - PersistentGhostFillSchedule and HierarchyGhostCellInterpolation (phase
+ *   <TT>ghost_fill</TT>);
+ * - the redistribution of Lagrangian data by LDataManager (phase
+ *   <TT>redistribution</TT>);
+ * - the ghost updates of FE vectors done by batch_vec_ghost_update_begin(),
+ *   FEVectorPipeline, and FEDataManager (phase <TT>fe_scatter</TT>).
+ *
+ * Messages sent inside of SAMRAI schedules and PETSc objects are only counted
+ * when the corresponding code path computes their sizes, i.e., the data moved
+ * by SAMRAI refine schedules is not included.
+ *
+ * Ghost updates of PETSc vectors are recorded by the process that owns the
+ * ghost entries as received (forward scatters) or sent (reverse scatters)
+ * data, since the sender of a forward scatter does not know the size of its
+ * messages.
+ *
+ * At the end of the run (i.e., when freeManager() is called by the
+ * ShutdownRegistry), a summary of the counters of each phase reduced over all
+ * processes is printed to plog and rank 0 writes the neighbor communication
+ * matrix to <TT>\<file_name\>.csv</TT> with one row
+ * <TT>phase,src,dst,messages,bytes,recorded_by</TT> for each pair of processes
+ * that communicated in a phase.
+ *
+ * Statistics are not recorded unless they are enabled via setOptions() (which
+ * AppInitializer calls if the input file contains a
+ * <TT>CommunicationStatistics</TT> database).
+ *
+ * Sample input:
+ * \verbatim
+ CommunicationStatistics {
+    enable    = TRUE             // default is TRUE
+    file_name = "comm_matrix"    // default is "communication"
+ }
+ \endverbatim
+ */
+class CommunicationStatistics
+{
+public:
+    /*!
+     * \brief Counters of the communication of a process in a phase.
+     */
+    struct Counters
+    {
+        double messages_sent = 0.0;
+        double bytes_sent = 0.0;
+        double messages_received = 0.0;
+        double bytes_received = 0.0;
+        double collectives = 0.0;
+        double collective_bytes = 0.0;
+    };
+
+    /*!
+     * \brief Class ScopedPhase attributes all communication that is recorded
+     * from its construction to its destruction to a phase.
+     */
+    class ScopedPhase
+    {
+    public:
+        explicit ScopedPhase(std::string phase_name);
+
+        ~ScopedPhase();
+
+    private:
+        ScopedPhase() = delete;
+        ScopedPhase(const ScopedPhase& from) = delete;
+        ScopedPhase& operator=(const ScopedPhase& that) = delete;
+
+        bool d_active;
+    };
+
+    /*!
+     * Return a pointer to the instance of the communication statistics
+     * manager.  Access to CommunicationStatistics objects is mediated by the
+     * getManager() function.
+     *
+     * \return A pointer to the manager instance.
+     */
+    static CommunicationStatistics* getManager();
+
+    /*!
+     * Write the statistics (if they are enabled) and deallocate the
+     * CommunicationStatistics instance.
+     *
+     * It is not necessary to call this function at program termination since it
+     * is automatically called by the ShutdownRegistry class.
+     *
+     * \note This function is collective when statistics are enabled.
+     */
+    static void freeManager();
+
+    /*!
+     * \brief Return whether statistics are recorded.
+     *
+     * This function does not create the manager instance, so it is cheap
+     * enough to guard the recording calls in frequently called functions.
+     */
+    static inline bool enabled()
+    {
+        return s_enabled;
+    } // enabled
+
+    /*!
+     * \brief Set the options from an input database.
+     */
+    void setOptions(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \brief Record that this process sent data to process dst_rank.
+     */
+    void recordSend(int dst_rank, double num_bytes, int num_messages = 1);
+
+    /*!
+     * \brief Record that this process received data from process src_rank.
+     *
+     * \note Use this function only when the sender cannot record the
+     * communication, since otherwise the data are counted twice.
+     */
+    void recordReceive(int src_rank, double num_bytes, int num_messages = 1);
+
+    /*!
+     * \brief Record a collective operation to which this process contributed
+     * num_bytes bytes.
+     */
+    void recordCollective(double num_bytes);
+
+    /*!
+     * \brief Record the communication of a ghost update (via
+     * VecGhostUpdateBegin()) of the ghosted PETSc vector vec.
+     */
+    void recordGhostUpdate(Vec vec, ScatterMode scatter_mode);
+
+    /*!
+     * \brief Return the names of the phases for which this process has
+     * recorded communication.
+     */
+    std::vector<std::string> getPhaseNames() const;
+
+    /*!
+     * \brief Return the counters of this process for a phase.
+     */
+    Counters getCounters(const std::string& phase_name) const;
+
+    /*!
+     * \brief Print the counters of each phase reduced over all processes to
+     * plog and write the neighbor communication matrix.
+     *
+     * \note This function is collective.
+     */
+    void writeStatistics();
+
+protected:
+    /*!
+     * \brief Constructor.
+     */
+    CommunicationStatistics() = default;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~CommunicationStatistics() = default;
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    CommunicationStatistics(const CommunicationStatistics& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    CommunicationStatistics& operator=(const CommunicationStatistics& that) = delete;
+
+    /*!
+     * \brief Return the name of the phase to which communication is currently
+     * attributed.
+     */
+    const std::string& getCurrentPhase() const;
+
+    /*!
+     * \brief Return the names of the phases recorded by any process.
+     *
+     * \note This function is collective.
+     */
+    std::vector<std::string> getGlobalPhaseNames() const;
+
+    /*!
+     * Static data members used to control access to and destruction of the
+     * manager instance.
+     */
+    static CommunicationStatistics* s_communication_statistics_instance;
+    static bool s_registered_callback;
+    static unsigned char s_shutdown_priority;
+    static bool s_enabled;
+
+    /*!
+     * Options.
+     */
+    std::string d_file_name = "communication";
+
+    /*!
+     * Stack of the active phases.
+     */
+    std::vector<std::string> d_phase_stack;
+
+    /*!
+     * Counters of each phase, and the numbers of messages and bytes sent to
+     * (or received from) each neighbor in each phase.
+     */
+    std::map<std::string, Counters> d_counters;
+    std::map<std::string, std::map<int, std::pair<double, double> > > d_sends, d_receives;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_CommunicationStatistics
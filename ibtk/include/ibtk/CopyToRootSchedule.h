@@ -20,6 +20,7 @@
 
 #include <ibtk/config.h>
 
+#include "Box.h"
 #include "IntVector.h"
 #include "PatchData.h"
 #include "PatchLevel.h"
@@ -65,6 +66,19 @@ public:
                        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
                        std::vector<int> src_patch_data_idxs);
 
+    /*!
+     * \brief Constructor.  Only the data in the root box (e.g., a slice of the
+     * computational domain used by a diagnostic) is communicated to the root
+     * process, and only processes that own patches that touch the root box send
+     * data.
+     *
+     * \note The unified patch data objects are allocated on the root box.
+     */
+    CopyToRootSchedule(int root_proc,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
+                       std::vector<int> src_patch_data_idxs,
+                       const SAMRAI::hier::Box<NDIM>& root_box);
+
     /*!
      * \brief Destructor
      */
@@ -115,6 +129,8 @@ private:
     const int d_root_proc;
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > d_patch_level;
     const std::vector<int> d_src_patch_data_idxs;
+    SAMRAI::hier::Box<NDIM> d_root_box;
+    const bool d_use_root_box = false;
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::hier::PatchData<NDIM> > > d_root_patch_data;
     SAMRAI::tbox::Schedule d_schedule;
 };
@@ -20,6 +20,7 @@
 
 #include <ibtk/config.h>
 
+#include "Box.h"
 #include "IntVector.h"
 #include "PatchData.h"
 #include "PatchLevel.h"
@@ -31,6 +32,11 @@
 
 namespace SAMRAI
 {
+namespace hier
+{
+template <int DIM>
+class BoxOverlap;
+} // namespace hier
 namespace tbox
 {
 class AbstractStream;
@@ -60,6 +66,18 @@ public:
                           int src_patch_data_idx,
                           SAMRAI::tbox::Pointer<SAMRAI::hier::PatchData<NDIM> > dst_patch_data);
 
+    /*!
+     * \brief Constructor.  Only the data in the destination box (e.g., a slice
+     * of the computational domain) is communicated, and only patches that
+     * overlap the destination box contribute to the message.
+     */
+    CopyToRootTransaction(int src_proc,
+                          int dst_proc,
+                          SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
+                          int src_patch_data_idx,
+                          SAMRAI::tbox::Pointer<SAMRAI::hier::PatchData<NDIM> > dst_patch_data,
+                          const SAMRAI::hier::Box<NDIM>& dst_box);
+
     /*!
      * \brief Destructor
      */
@@ -146,10 +164,18 @@ private:
      */
     CopyToRootTransaction& operator=(const CopyToRootTransaction& that) = delete;
 
+    /*!
+     * \brief Compute the overlap between the data on a source patch box and the
+     * destination box.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::BoxOverlap<NDIM> >
+    computeOverlap(const SAMRAI::hier::Box<NDIM>& src_box) const;
+
     const int d_src_proc, d_dst_proc;
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > d_patch_level;
     const int d_src_patch_data_idx;
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchData<NDIM> > d_dst_patch_data;
+    SAMRAI::hier::Box<NDIM> d_dst_box;
 };
 } // namespace IBTK
 
@@ -0,0 +1,202 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_EnsembleInit
+#define included_IBTK_EnsembleInit
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "ibtk/IBTKInit.h"
+
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+#include <mpi.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class EnsembleInit runs an ensemble of independent simulations (e.g.,
+ * the members of a parameter sweep) in a single MPI job.
+ *
+ * The constructor initializes MPI (when necessary), splits the world
+ * communicator into contiguous blocks of processes, one for each member of the
+ * ensemble, and creates an IBTKInit object on the communicator of the member
+ * to which the current process belongs. Consequently, PETSc, SAMRAI, and
+ * libMesh are started up once per job instead of once per simulation, and the
+ * remainder of the application code (i.e., setting up and running a
+ * HierarchyIntegrator) is unchanged: it only sees the processes of its own
+ * member. A typical main() function is
+ * \code
+ * IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+ * \endcode
+ * replaced by
+ * \code
+ * EnsembleInit ensemble_init(argc, argv, num_members);
+ * Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+ * // ... set up and run the simulation as usual ...
+ * const std::vector<std::string> results = ensemble_init.gatherMemberOutput(summary);
+ * \endcode
+ *
+ * Per-member input is given in the (optional) \p Ensemble database of the
+ * input file: the entries of the database <tt>member_<n></tt> replace the
+ * corresponding entries of the input database of member \p n, e.g.,
+ * \verbatim
+ Ensemble {
+    member_0 {
+       IBFEMethod { IB_kernel_fcn = "IB_4" }
+    }
+    member_1 {
+       IBFEMethod { IB_kernel_fcn = "BSPLINE_3" }
+       Main { log_file_name = "bspline.log" }
+    }
+ }
+ \endverbatim
+ * AppInitializer applies these overrides (see applyMemberOverrides()) and
+ * appends a member suffix to the names of the log file and of the output
+ * directories so that the members do not overwrite each other's output.
+ *
+ * Read-only input files that every member needs (e.g., structure or mesh
+ * files) may be read once per job with readSharedFile().
+ *
+ * \note Since the libraries use process-wide singletons, each process belongs
+ * to exactly one member and members cannot share distributed data structures
+ * such as meshes; only the contents of input files are shared.
+ */
+class EnsembleInit
+{
+public:
+    /*!
+     * Constructor. Splits \p world_communicator into \p num_members
+     * communicators and initializes the libraries on the communicator of the
+     * current process. Attempts to create a second EnsembleInit object will
+     * result in a run time error.
+     */
+    EnsembleInit(int argc,
+                 char** argv,
+                 int num_members,
+                 MPI_Comm world_communicator = MPI_COMM_WORLD,
+                 char* petsc_file = nullptr,
+                 char* petsc_help = nullptr);
+
+    /*!
+     * \brief Default constructor. This function is not implemented and should not be used.
+     */
+    EnsembleInit() = delete;
+
+    /*!
+     * \brief Copy constructor. This function is not implemented and should not be used.
+     */
+    EnsembleInit(const EnsembleInit& from) = delete;
+
+    /*!
+     * \brief Assignment operator. This function is not implemented and should not be used.
+     */
+    EnsembleInit& operator=(const EnsembleInit& that) = delete;
+
+    /*!
+     * Destructor. Closes the libraries, frees the member communicator, and
+     * finalizes MPI if it was initialized by the constructor.
+     */
+    ~EnsembleInit();
+
+    /*!
+     * Return a pointer to the EnsembleInit object, or nullptr if no ensemble
+     * is running.
+     */
+    static EnsembleInit* getInstance();
+
+    /*!
+     * Return the number of members of the ensemble.
+     */
+    int getNumberOfMembers() const;
+
+    /*!
+     * Return the member of the ensemble to which the current process belongs.
+     */
+    int getMemberNumber() const;
+
+    /*!
+     * Return the suffix <tt>member_<n></tt> used to distinguish the output
+     * of the current member.
+     */
+    std::string getMemberSuffix() const;
+
+    /*!
+     * Return the communicator shared by all members.
+     */
+    MPI_Comm getWorldCommunicator() const;
+
+    /*!
+     * Return the communicator of the current member.
+     */
+    MPI_Comm getMemberCommunicator() const;
+
+    /*!
+     * Return the library initialization object of the current member.
+     */
+    IBTKInit& getIBTKInit();
+
+    /*!
+     * Replace entries of \p input_db by the entries of the database
+     * <tt>Ensemble::member_<n></tt> of the current member (databases are
+     * merged recursively) and append the member suffix to the log file and
+     * output directory names specified in the \p Main database.
+     *
+     * \note This function is called by AppInitializer.
+     */
+    void applyMemberOverrides(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db) const;
+
+    /*!
+     * Read the file \p file_name on the first process of the world
+     * communicator and broadcast its contents to all processes, so that the
+     * file is read once per job instead of once per member.
+     *
+     * \note This is a collective operation on the world communicator.
+     */
+    std::string readSharedFile(const std::string& file_name) const;
+
+    /*!
+     * Collect the string \p output given by the first process of each member.
+     * The return value, which is available on every process, contains the
+     * output of each member.
+     *
+     * \note This is a collective operation on the world communicator.
+     */
+    std::vector<std::string> gatherMemberOutput(const std::string& output) const;
+
+private:
+    MPI_Comm d_world_communicator;
+    MPI_Comm d_member_communicator = MPI_COMM_NULL;
+    int d_num_members;
+    int d_member_number = 0;
+    bool d_finalize_mpi = false;
+    std::unique_ptr<IBTKInit> d_ibtk_init;
+
+    static EnsembleInit* s_instance;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_EnsembleInit
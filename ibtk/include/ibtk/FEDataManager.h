@@ -58,6 +58,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 
 namespace IBTK
 {
+class FECache;
 class FEDataManager;
 class FEProjector;
 class RobinPhysBdryPatchStrategy;
@@ -281,7 +282,10 @@ public:
      * }
      * @endcode
      * Any unspecified subdomain ids will be assigned to the finest patch level.
-     * Duplicated assignments are not permitted.
+     * Duplicated assignments are not permitted. If the database contains the
+     * key <code>adaptive_levels = TRUE</code> then the assigned levels are
+     * treated as the finest levels on which the subdomains may interact: see
+     * hasAdaptiveLevels().
      */
     SubdomainToPatchLevelTranslation(const int max_level_number,
                                      const std::set<libMesh::subdomain_id_type>& subdomain_ids,
@@ -311,10 +315,50 @@ public:
         }
         else
         {
-            return d_map.count(level_number) != 0;
+            // d_map is keyed by subdomain id, so check the levels:
+            for (const auto& id_level : d_map)
+            {
+                if (id_level.second == level_number) return true;
+            }
+            return false;
         }
     }
 
+    /*!
+     * Return whether or not subdomains may interact with levels coarser than
+     * the ones they were assigned to. In that case each subdomain interacts
+     * with the finest level (no finer than its assigned level) that covers
+     * all of its nodes, and the level is updated by
+     * FEDataManager::reinitElementMappings() whenever the patch hierarchy
+     * changes.
+     */
+    bool hasAdaptiveLevels() const
+    {
+        return d_adaptive_levels;
+    }
+
+    /*!
+     * Return the levels to which the subdomain ids were assigned when this
+     * object was created.
+     */
+    const std::map<libMesh::subdomain_id_type, int>& getAssignedLevels() const
+    {
+        return d_assigned_levels;
+    }
+
+    /*!
+     * Set the patch level on which a subdomain currently interacts. The level
+     * may not be finer than the one to which the subdomain was assigned.
+     */
+    void setLevel(const libMesh::subdomain_id_type id, const int level_number)
+    {
+#ifndef NDEBUG
+        TBOX_ASSERT(d_assigned_levels.count(id));
+        TBOX_ASSERT(0 <= level_number && level_number <= d_assigned_levels.at(id));
+#endif
+        get(id) = level_number;
+    }
+
 private:
     /*!
      * like operator[], but returns a mutable reference. Used to set up the object.
@@ -350,6 +394,16 @@ private:
      * The map used for everything else.
      */
     std::map<libMesh::subdomain_id_type, int> d_map;
+
+    /*!
+     * Whether or not subdomains may migrate to coarser levels.
+     */
+    bool d_adaptive_levels = false;
+
+    /*!
+     * The levels assigned to each subdomain id at construction.
+     */
+    std::map<libMesh::subdomain_id_type, int> d_assigned_levels;
 };
 
 /*!
@@ -375,6 +429,31 @@ private:
  * </ol>
  * The default value is <code>node_outside_error</code>.
  *
+ * <code>quadrature_key_update_tol</code>: when adaptive quadrature is used, the
+ * quadrature rule of each element is cached and is only recomputed when the
+ * number of quadrature points per edge implied by the element's deformed size
+ * leaves the range for which the cached rule was computed, widened by this
+ * relative tolerance. The default value, <code>0.0</code>, always uses the
+ * same rules as recomputing them from scratch. All rules are recomputed after
+ * the elements are reassociated with patches (e.g., after regridding).
+ *
+ * <code>use_threaded_interaction</code>: when IBAMR is compiled with OpenMP,
+ * distribute the patches among the available threads in the versions of
+ * spread() and interpWeighted() that do not use nodal quadrature. Each patch
+ * has its own Eulerian data, so spreading needs no synchronization; the
+ * right-hand sides computed by interpWeighted() are accumulated in a
+ * thread-local copy of each vector (which must then be ghosted) and summed at
+ * the end. The default value is <code>FALSE</code>.
+ *
+ * <code>sort_active_patch_elems_by_cell</code>: order the elements associated
+ * with each patch along a Z-order (Morton) curve through the cells containing
+ * the centers of their bounding boxes instead of by address. The order is
+ * computed each time the elements are reassociated with patches (e.g., after
+ * regridding) and improves the memory locality of spread() and interp(). This
+ * is the finite element counterpart of
+ * LDataManager::setSortLocalIndicesByCell(). The default value is
+ * <code>FALSE</code>.
+ *
  * <code>subdomain_ids_on_levels</code>: a database correlating libMesh subdomain
  * IDs to patch levels. A possible value for this is
  * @code
@@ -390,7 +469,17 @@ private:
  * 3, etc. All unspecified subdomain ids will be associated with the finest
  * patch level. All inputs in this database for levels finer than the finest
  * level are ignored (e.g., if the maximum patch level number is 4, then the
- * values given in the example for level 5 ultimately end up on level 4).
+ * values given in the example for level 5 ultimately end up on level 4). If the
+ * database also contains <code>adaptive_levels = TRUE</code> then the listed
+ * levels are the finest levels with which the subdomains may interact: each
+ * time the element mappings are reinitialized, every subdomain is moved to the
+ * finest level (no finer than its assigned level) whose patches contain all of
+ * its nodes. Subdomains hence migrate to coarser levels when the refinement
+ * around them is removed (e.g., if the structure moves out of the refined
+ * region between regrids) and back to finer levels when it is restored, instead
+ * of losing elements or failing the node_outside_patch_check. The quadrature
+ * rules used by a subdomain always correspond to the grid spacing of the level
+ * on which it currently interacts.
  * <em>This feature is experimental</em>: at the current time it is known that
  * it produces some artifacts at the coarse-fine interface, but that these
  * generally don't effect the overall solution quality.
@@ -731,6 +820,27 @@ public:
      */
     std::unique_ptr<libMesh::PetscVector<double> > buildIBGhostedVector(const std::string& system_name);
 
+    /*!
+     * \return A reference to an IB-ghosted copy, with up to date ghost values,
+     * of the vector @p vector_name of the specified system. @p vector_name is
+     * either <code>"solution"</code>, <code>"current_local_solution"</code>, or
+     * the name of a vector added to the system.
+     *
+     * Unlike buildIBGhostedVector(), the copies are owned by this class and are
+     * shared by all of its users: a copy is only updated (which requires a
+     * ghost exchange) when the PETSc object state of the underlying vector or
+     * of the copy itself has changed since the last update. Consumers that read
+     * the same vector (e.g., the current coordinates) during a time step
+     * therefore share one copy and one ghost exchange.
+     *
+     * @note The returned vector must not be modified. It is invalidated when
+     * the elements are reassociated with patches.
+     *
+     * @note This function is collective.
+     */
+    libMesh::PetscVector<double>& getSharedIBGhostedVector(const std::string& system_name,
+                                                           const std::string& vector_name);
+
     /*!
      * \return A pointer to the unghosted coordinates (nodal position) vector.
      */
@@ -924,6 +1034,54 @@ public:
                    bool close_F = true,
                    bool close_X = true);
 
+    /*!
+     * \brief Set up the right-hand sides of several L2 projection problems at
+     * once, where the Eulerian data given by each entry of @p f_data_idxs is
+     * projected onto the finite element space given by the corresponding entry
+     * of @p system_names, using the default interpolation spec.
+     *
+     * @see The multiple-system version of interpWeighted() that takes an
+     * InterpSpec.
+     */
+    void
+    interpWeighted(const std::vector<int>& f_data_idxs,
+                   const std::vector<libMesh::NumericVector<double>*>& F_vecs,
+                   libMesh::NumericVector<double>& X,
+                   const std::vector<std::string>& system_names,
+                   const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& f_refine_scheds =
+                       std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >(),
+                   double fill_data_time = 0.0,
+                   bool close_F = true,
+                   bool close_X = true);
+
+    /*!
+     * \brief Set up the right-hand sides of several L2 projection problems at
+     * once, where the Eulerian data given by each entry of @p f_data_idxs is
+     * projected onto the finite element space given by the corresponding entry
+     * of @p system_names.
+     *
+     * This is equivalent to calling the single-system version of
+     * interpWeighted() once for each system, except that the quadrature rules,
+     * quadrature point positions, shape function values, and Jacobians are
+     * computed once per element and shared by all of the systems.
+     *
+     * @note All of the systems must use the same finite element type, although
+     * they may have different numbers of variables. @p f_refine_scheds should
+     * contain the schedules needed to fill the ghost cells of all of the
+     * Eulerian data being interpolated.
+     */
+    void
+    interpWeighted(const std::vector<int>& f_data_idxs,
+                   const std::vector<libMesh::NumericVector<double>*>& F_vecs,
+                   libMesh::NumericVector<double>& X,
+                   const std::vector<std::string>& system_names,
+                   const InterpSpec& interp_spec,
+                   const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& f_refine_scheds =
+                       std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >(),
+                   double fill_data_time = 0.0,
+                   bool close_F = true,
+                   bool close_X = true);
+
     /*!
      * \brief Interpolate a value from the Cartesian grid to the FE mesh using
      * the default interpolation spec.
@@ -1189,7 +1347,12 @@ private:
      * calculations (where all three numbers will be the same).
      *
      * In this method, the determination as to whether an element is local or
-     * not is based on the position of the bounding box of the element.
+     * not is based on the position of the bounding box of the element. Each
+     * process sends the bounding boxes of the elements it owns only to the
+     * processes whose patches may intersect them, which then find the
+     * intersecting local patches with an R-tree (see IBTK::BoxTree).
+     *
+     * @note This function is collective.
      */
     void collectActivePatchElements(std::vector<std::vector<libMesh::Elem*> >& active_patch_elems,
                                     int level_number,
@@ -1203,6 +1366,12 @@ private:
     void collectActivePatchNodes(std::vector<std::vector<libMesh::Node*> >& active_patch_nodes,
                                  const std::vector<std::vector<libMesh::Elem*> >& active_patch_elems);
 
+    /*!
+     * Report the memory used by the vectors of the equation systems and by the
+     * cached ghosted vectors to MemoryStatistics.
+     */
+    void updateMemoryUsage();
+
     /*!
      * Store the association between subdomain ids and patch levels.
      */
@@ -1213,6 +1382,16 @@ private:
      */
     int getPatchLevel(const libMesh::Elem* elem) const;
 
+    /*!
+     * If the subdomain levels are adaptive, assign each subdomain to the
+     * finest patch level (no finer than its assigned level) whose boxes
+     * contain all of the subdomain's nodes that are inside the physical
+     * domain.
+     *
+     * \note This function is collective.
+     */
+    void updateAdaptiveSubdomainLevels();
+
     /*!
      * Collect all ghost DOF indices for the specified collection of elements.
      */
@@ -1225,6 +1404,97 @@ private:
      */
     void reinitializeIBGhostedDOFs(const std::string& system_name);
 
+    /*!
+     * Quadrature data for the active elements of a single patch: the
+     * quadrature keys of each element, the elements grouped by quadrature
+     * key, and the physical positions of all of the quadrature points (stored
+     * group by group), along with the data used to compute them.
+     */
+    struct PatchQuadratureData
+    {
+        /*!
+         * Indices (into elems) of the elements that use the same quadrature
+         * rule, which has n_qp points.
+         */
+        struct KeyGroup
+        {
+            quadrature_key_type key;
+            unsigned int n_qp = 0;
+            std::vector<unsigned int> elem_idxs;
+        };
+
+        std::vector<libMesh::Elem*> elems;
+        std::vector<double> X_node_values;
+        double patch_dx_min = 0.0;
+        libMesh::QuadratureType quad_type = libMesh::INVALID_Q_RULE;
+        libMesh::Order quad_order = libMesh::INVALID_ORDER;
+        bool use_adaptive_quadrature = false;
+        double point_density = 0.0;
+        bool allow_rules_with_negative_weights = false;
+
+        std::vector<quadrature_key_type> quad_keys;
+        std::vector<double> quad_key_n_points;
+        std::vector<KeyGroup> key_groups;
+        std::vector<double> X_qp;
+        unsigned int n_qp_patch = 0;
+    };
+
+    /*!
+     * Get the quadrature keys and physical quadrature point positions of the
+     * active elements on the specified patch.
+     *
+     * The result of the previous call for the same patch is reused, without
+     * recomputing any quadrature rules or positions, if the elements on the
+     * patch, the element nodal positions, the grid spacing, and the quadrature
+     * parameters are all unchanged. This is typically the case when
+     * interpolation and spreading are performed with the same structure
+     * configuration in the same timestep stage. If only the nodal positions
+     * have changed then the quadrature key of an element is only recomputed
+     * if the number of points per edge determined by its maximum edge length
+     * (see getQuadratureKey()) changes by more than the fraction
+     * d_quad_key_update_tol of its previous value.
+     */
+    const PatchQuadratureData& getPatchQuadratureData(int ln,
+                                                      int local_patch_num,
+                                                      double patch_dx_min,
+                                                      libMesh::QuadratureType quad_type,
+                                                      libMesh::Order quad_order,
+                                                      bool use_adaptive_quadrature,
+                                                      double point_density,
+                                                      bool allow_rules_with_negative_weights,
+                                                      const libMesh::PetscVector<double>& X_petsc_vec,
+                                                      const double* X_local_soln,
+                                                      FEData::SystemDofMapCache& X_dof_map_cache,
+                                                      FECache& X_fe_cache);
+
+    /*!
+     * DOF indices of the active nodes of a single patch for a single system:
+     * the DOF of variable i of the k-th node of the patch (in the order given
+     * by d_active_patch_node_map) is stored at index k * n_vars + i, both as a
+     * global index and as an index into the local form of an IB ghosted
+     * vector.
+     */
+    struct PatchNodalDOFData
+    {
+        bool initialized = false;
+        std::vector<libMesh::dof_id_type> dof_indices;
+        std::vector<libMesh::dof_id_type> local_dof_indices;
+    };
+
+    /*!
+     * Get the DOF indices of the active nodes of the specified patch, which
+     * are used by the nodal quadrature versions of spread() and interp().
+     *
+     * The indices are computed the first time that they are requested after
+     * the element mappings are reinitialized. @p vec must be an IB ghosted
+     * vector of the specified system; all such vectors share the same local
+     * layout.
+     */
+    const PatchNodalDOFData& getPatchNodalDOFData(int ln,
+                                                  int local_patch_num,
+                                                  const std::string& system_name,
+                                                  const libMesh::PetscVector<double>& vec);
+
     /*!
      * Read object state from the restart file and initialize class data
      * members.  The database from which the restart data is read is determined
@@ -1315,6 +1585,28 @@ private:
      */
     NodeOutsidePatchCheckType d_node_patch_check = NODE_OUTSIDE_ERROR;
 
+    /*!
+     * Relative change in the number of adaptive quadrature points per element
+     * edge that is tolerated before the quadrature key of an element is
+     * recomputed.
+     *
+     * @see getPatchQuadratureData()
+     */
+    double d_quad_key_update_tol = 0.0;
+
+    /*!
+     * Whether or not the patches are distributed among the available OpenMP
+     * threads in spread() and interpWeighted(). Has no effect if IBAMR is
+     * compiled without OpenMP.
+     */
+    bool d_use_threaded_interaction = false;
+
+    /*!
+     * Whether or not the active elements of each patch are ordered along a
+     * Z-order curve through the patch cells.
+     */
+    bool d_sort_active_patch_elems_by_cell = false;
+
     /*!
      * SAMRAI::hier::IntVector object which determines the required ghost cell
      * width of this class.
@@ -1341,6 +1633,22 @@ private:
     std::map<std::string, std::vector<unsigned int> > d_active_patch_ghost_dofs;
     std::vector<libMesh::Elem*> d_active_elems;
 
+    /*!
+     * Cached quadrature data for each local patch, indexed by level number and
+     * local patch number.
+     *
+     * @see getPatchQuadratureData()
+     */
+    std::vector<std::vector<PatchQuadratureData> > d_patch_quadrature_data;
+
+    /*!
+     * Cached nodal DOF indices for each system and each local patch, indexed
+     * by system name, level number, and local patch number.
+     *
+     * @see getPatchNodalDOFData()
+     */
+    std::map<std::string, std::vector<std::vector<PatchNodalDOFData> > > d_patch_nodal_dof_data;
+
     /*!
      * Ghost vectors for the various equation systems.
      */
@@ -1352,6 +1660,19 @@ private:
      * buildIBGhostedVector.
      */
     std::map<std::string, std::unique_ptr<libMesh::PetscVector<double> > > d_system_ib_ghost_vec;
+
+    /*!
+     * IB-ghosted copies shared via getSharedIBGhostedVector(), keyed by the
+     * system and vector names, along with the vector they were copied from
+     * and the PETSc object states of both vectors after the last update.
+     */
+    struct SharedIBGhostedVector
+    {
+        std::unique_ptr<libMesh::PetscVector<double> > vec;
+        Vec source_vec = nullptr;
+        PetscObjectState source_state = -1, state = -1;
+    };
+    std::map<std::pair<std::string, std::string>, SharedIBGhostedVector> d_shared_ib_ghost_vecs;
 };
 } // namespace IBTK
 
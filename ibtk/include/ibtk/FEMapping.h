@@ -21,6 +21,7 @@
 #include <ibtk/config.h>
 
 #include <ibtk/FECache.h>
+#include <ibtk/ReferenceElementData.h>
 #include <ibtk/ibtk_utilities.h>
 
 #include "tbox/Utilities.h"
@@ -42,6 +43,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <array>
 #include <iosfwd>
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -72,7 +74,7 @@ template <int dim, int spacedim = dim, int n_nodes = -1>
 class PointMap
 {
 public:
-    PointMap(const libMesh::ElemType elem_type, const std::vector<libMesh::Point>& q_points);
+    PointMap(const quadrature_key_type& quad_key, const libMesh::ElemType elem_type);
 
     /**
      * Calculate mapped quadrature points.
@@ -83,15 +85,11 @@ public:
 
 protected:
     /**
-     * Quadrature points on the reference element.
-     */
-    std::vector<libMesh::Point> d_reference_q_points;
-
-    /**
-     * Table containing the values of 1D shape functions (which, with a tensor
-     * product, define the mapping) at reference quadrature points.
+     * Shared table containing the quadrature points and the values of the
+     * shape functions (which define the mapping) at those points on the
+     * reference element.
      */
-    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> d_phi;
+    std::shared_ptr<const ReferenceElementData> d_reference_data;
 };
 
 /*!
@@ -185,15 +183,21 @@ struct QuadratureData
      */
     const key_type d_key;
 
+    /*!
+     * Shared reference element data from which the quadrature points and
+     * weights are taken.
+     */
+    const std::shared_ptr<const ReferenceElementData> d_reference_data;
+
     /*!
      * Quadrature points on the reference element.
      */
-    std::vector<libMesh::Point> d_points;
+    const std::vector<libMesh::Point>& d_points;
 
     /*!
      * Quadrature weights.
      */
-    std::vector<double> d_weights;
+    const std::vector<double>& d_weights;
 
     /*!
      * Get the size (the number of points) of the quadrature rule.
@@ -383,10 +387,10 @@ protected:
     const int d_n_nodes;
 
     /**
-     * Values of shape function gradients on the reference element at
-     * quadrature points.
+     * Shared table containing the values of shape function gradients on the
+     * reference element at quadrature points.
      */
-    boost::multi_array<std::array<double, dim>, 2> d_dphi;
+    std::shared_ptr<const ReferenceElementData> d_mapping_data;
 
     friend class Hex27Mapping;
 };
@@ -417,7 +421,9 @@ protected:
 };
 
 /*!
- * Specialization for QUAD4 elements with codimension zero.
+ * Specialization for QUAD4 elements with codimension zero. If the current
+ * element is a parallelogram then the mapping is affine and the contravariant
+ * and Jacobian are only computed once.
  */
 class Quad4Mapping : public FENodalMapping<2, 2, 4>
 {
@@ -435,6 +441,14 @@ public:
 
 protected:
     virtual void fillTransforms(const libMesh::Elem* elem) override;
+
+    virtual bool isAffine() const override;
+
+    /*!
+     * Whether or not the element passed to the last call to fillTransforms()
+     * is a parallelogram.
+     */
+    bool d_elem_is_affine = false;
 };
 
 /*!
@@ -476,6 +490,39 @@ protected:
     Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> d_dphi;
 };
 
+/*!
+ * Specialization for HEX8 elements. If the current element is a
+ * parallelepiped then the mapping is affine and the contravariant and Jacobian
+ * are only computed once.
+ */
+class Hex8Mapping : public FELagrangeMapping<3, 3, 8>
+{
+public:
+    /*!
+     * Key type. Completely describes (excepting p-refinement) a libMesh
+     * quadrature rule.
+     */
+    using key_type = quadrature_key_type;
+
+    /*!
+     * Constructor.
+     */
+    Hex8Mapping(const key_type quad_key, const FEUpdateFlags update_flags);
+
+protected:
+    virtual void fillTransforms(const libMesh::Elem* elem) override;
+
+    virtual bool isAffine() const override;
+
+    /*!
+     * Whether or not the element passed to the last call to fillTransforms()
+     * is a parallelepiped.
+     */
+    bool d_elem_is_affine = false;
+
+    friend class Hex27Mapping;
+};
+
 /*!
  * Specialization for TRI6 elements with codimension zero.
  */
@@ -592,7 +639,7 @@ protected:
     /*!
      * HEX8 mapping that is used whenever the given elem is trilinear.
      */
-    FELagrangeMapping<3, 3, 8> hex8_mapping;
+    Hex8Mapping hex8_mapping;
 
     /*!
      * Utility function that determines if the element is trilinear (i.e., all
@@ -601,10 +648,18 @@ protected:
     static bool elem_is_trilinear(const libMesh::Elem* elem);
 };
 
+// Specialization of build for curves in 2D
+template <>
+std::unique_ptr<FEMapping<1, 2> > FEMapping<1, 2>::build(const key_type key, const FEUpdateFlags update_flags);
+
 // Specialization of build for 2D
 template <>
 std::unique_ptr<FEMapping<2, 2> > FEMapping<2, 2>::build(const key_type key, const FEUpdateFlags update_flags);
 
+// Specialization of build for surfaces in 3D
+template <>
+std::unique_ptr<FEMapping<2, 3> > FEMapping<2, 3>::build(const key_type key, const FEUpdateFlags update_flags);
+
 // Specialization of build for 3D
 template <>
 std::unique_ptr<FEMapping<3, 3> > FEMapping<3, 3>::build(const key_type key, const FEUpdateFlags update_flags);
@@ -29,6 +29,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 namespace IBTK
 {
@@ -52,6 +53,14 @@ namespace IBTK
  *   vector pairs) but will decrease the number of solver iterations. The default
  *   value lowers the number of solver iterations to, typically, no more than two
  *   or three, so its usually the right value.</li>
+ *   <li>use_direct_solver: Whether or not to solve projections with the
+ *   consistent mass matrix with a sparse Cholesky factorization in place of
+ *   preconditioned MINRES. The factorization is computed the first time that
+ *   it is needed and is then reused for every subsequent projection, so this
+ *   is usually faster when the mesh does not change and many projections are
+ *   computed. In parallel the factorization is computed by MUMPS, so PETSc
+ *   must be configured with MUMPS to use this option. Defaults to
+ *   false.</li>
  * </ol>
  */
 class FEProjector
@@ -131,6 +140,23 @@ public:
                              double tol = 1.0e-6,
                              unsigned int max_its = 100);
 
+    /*!
+     * \brief Set each U to be the L2 projection of the corresponding F. This
+     * is equivalent to calling computeL2Projection() for each pair of vectors,
+     * but all right-hand sides are assembled before the first solve.
+     *
+     * \note Each component of a vector-valued system is stored in the same
+     * vector, and hence all of them are projected by one solve.
+     */
+    bool computeL2Projection(const std::vector<libMesh::PetscVector<double>*>& U_vecs,
+                             const std::vector<libMesh::PetscVector<double>*>& F_vecs,
+                             const std::string& system_name,
+                             bool consistent_mass_matrix = true,
+                             bool close_U = true,
+                             bool close_F = true,
+                             double tol = 1.0e-6,
+                             unsigned int max_its = 100);
+
     /*!
      * \brief Set U to be the L2 projection of F with a local projection
      * stabilization term.
@@ -205,6 +231,12 @@ private:
      * Number of vectors to use in the FischerGuess objects.
      */
     int d_num_fischer_vectors = 5;
+
+    /*!
+     * Whether or not to use a sparse Cholesky factorization of the consistent
+     * mass matrix.
+     */
+    bool d_use_direct_solver = false;
 };
 } // namespace IBTK
 
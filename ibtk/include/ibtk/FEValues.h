@@ -148,6 +148,116 @@ protected:
      * matches the current element type.
      */
     libMesh::ElemType d_last_elem_type = libMesh::ElemType::INVALID_ELEM;
+
+    template <int, int>
+    friend class FEValuesBatch;
+};
+
+/**
+ * Class like FEValues that computes the same quantities for a batch of up to
+ * batch_size elements of the same type at once.
+ *
+ * The mapped quantities are stored in a lane-interleaved layout in which the
+ * values for the elements of the batch are contiguous, so that loops over
+ * quadrature points and shape functions can be vectorized across elements
+ * instead of across the (possibly very few) quadrature points of a single
+ * element:
+ * \code
+ * // JxW at quadrature point q of the element in lane k:
+ * batch.getJxW()[q * batch_size + k];
+ * // component d of that quadrature point:
+ * batch.getQuadraturePoints()[(q * spacedim + d) * batch_size + k];
+ * // component d of the gradient of shape function i at that point:
+ * batch.getShapeGradients()[((i * n_qp + q) * spacedim + d) * batch_size + k];
+ * \endcode
+ * Shape values do not depend on the element, so they are stored once, in the
+ * same layout as FEValuesBase::getShapeValues().
+ *
+ * If the batch contains fewer than batch_size elements, the unused lanes are
+ * set to zero: loops may always run over all batch_size lanes.
+ */
+template <int dim, int spacedim = dim>
+class FEValuesBatch
+{
+public:
+    /**
+     * Number of elements in a batch, chosen so that one lane of doubles fills
+     * an AVX register.
+     */
+    static constexpr unsigned int batch_size = 4;
+
+    FEValuesBatch(libMesh::QBase* qrule, const libMesh::FEType fe_type, const FEUpdateFlags update_flags);
+
+    /**
+     * Recompute the values for elems[0], ..., elems[n_elems - 1], which must
+     * all have the same type. n_elems must be at least one and at most
+     * batch_size.
+     */
+    void reinit(const libMesh::Elem* const* elems, unsigned int n_elems);
+
+    inline unsigned int getNumberOfElements() const
+    {
+        return d_n_elems;
+    }
+
+    inline unsigned int getNumberOfQuadraturePoints() const
+    {
+        return d_n_qp;
+    }
+
+    inline unsigned int getNumberOfShapeFunctions() const
+    {
+        return d_n_shape_functions;
+    }
+
+    inline const std::vector<double>& getJxW() const
+    {
+        return d_JxW;
+    }
+
+    inline const std::vector<double>& getQuadraturePoints() const
+    {
+        return d_quadrature_points;
+    }
+
+    inline const std::vector<std::vector<double> >& getShapeValues() const
+    {
+        return d_shape_values;
+    }
+
+    inline const std::vector<double>& getShapeGradients() const
+    {
+        return d_shape_gradients;
+    }
+
+protected:
+    libMesh::QBase* d_qrule;
+
+    const libMesh::FEType d_fe_type;
+
+    /*
+     * Mappings, indexed by element type.
+     */
+    std::map<libMesh::ElemType, std::unique_ptr<FEMapping<dim, spacedim> > > d_mappings;
+
+    /*
+     * Reference values, indexed by element type.
+     */
+    std::map<libMesh::ElemType, typename FEValues<dim, spacedim>::ReferenceValues> d_reference_values;
+
+    FEUpdateFlags d_update_flags;
+
+    libMesh::ElemType d_last_elem_type = libMesh::ElemType::INVALID_ELEM;
+
+    unsigned int d_n_elems = 0, d_n_qp = 0, d_n_shape_functions = 0;
+
+    /*
+     * Lane-interleaved values. The covariant matrices are stored as
+     * d_covariants[((q * spacedim + d) * dim + k) * batch_size + lane].
+     */
+    std::vector<double> d_JxW, d_quadrature_points, d_covariants, d_shape_gradients;
+
+    std::vector<std::vector<double> > d_shape_values;
 };
 } // namespace IBTK
 
@@ -0,0 +1,160 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_FFTUtilities
+#define included_IBTK_FFTUtilities
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "Box.h"
+#include "IntVector.h"
+#include "PatchLevel.h"
+#include "tbox/Pointer.h"
+
+#include <complex>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class FFTUtilities provides discrete Fourier transforms and routines
+ * to copy cell- and side-centered data between a uniform, periodic patch level
+ * and arrays that span the entire level.
+ *
+ * The transforms are plain C++ implementations (radix-2 transforms for lengths
+ * that are powers of two and Bluestein's algorithm for all other lengths) and
+ * are intended for the moderately sized grids on which level solvers are
+ * used, e.g., the coarsest level of a FAC preconditioner.
+ *
+ * Arrays that span the level are indexed by the offset of each cell index in
+ * the domain box, i.e., with the first coordinate direction varying fastest.
+ * The side-centered value in direction \a axis that is stored with cell index
+ * \a i is the value on the lower face of that cell.  Since the domain is
+ * periodic, this identifies each face of the level exactly once.
+ */
+class FFTUtilities
+{
+public:
+    /*!
+     * \brief Compute the discrete Fourier transform of \a data in place.
+     *
+     * The forward transform computes \f$ \hat{x}_k = \sum_j x_j e^{-2 \pi i j
+     * k / n} \f$, and the inverse transform includes the factor \f$ 1/n \f$.
+     */
+    static void transform(std::vector<std::complex<double> >& data, bool inverse);
+
+    /*!
+     * \brief Compute the multidimensional discrete Fourier transform of \a
+     * data in place, where \a data is ordered with the first coordinate
+     * direction varying fastest and \a num_cells gives the number of entries
+     * in each coordinate direction.
+     */
+    static void transform(std::vector<std::complex<double> >& data,
+                          const SAMRAI::hier::IntVector<NDIM>& num_cells,
+                          bool inverse);
+
+    /*!
+     * \brief Copy component \a depth of the cell-centered data \a data_idx on
+     * \a level into \a values, which is resized to the size of \a domain_box.
+     *
+     * \note This function is collective.  All processes receive the values of
+     * the entire level.
+     */
+    static void gatherCellData(std::vector<double>& values,
+                               int data_idx,
+                               int depth,
+                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level,
+                               const SAMRAI::hier::Box<NDIM>& domain_box);
+
+    /*!
+     * \brief Set the interior values of component \a depth of the
+     * cell-centered data \a data_idx on \a level from \a values.
+     */
+    static void scatterCellData(int data_idx,
+                                int depth,
+                                SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level,
+                                const SAMRAI::hier::Box<NDIM>& domain_box,
+                                const std::vector<double>& values);
+
+    /*!
+     * \brief Copy the values in direction \a axis of the side-centered data \a
+     * data_idx on \a level into \a values, which is resized to the size of \a
+     * domain_box.
+     *
+     * \note This function is collective.  All processes receive the values of
+     * the entire level.
+     */
+    static void gatherSideData(std::vector<double>& values,
+                               int data_idx,
+                               int axis,
+                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level,
+                               const SAMRAI::hier::Box<NDIM>& domain_box);
+
+    /*!
+     * \brief Set the interior values in direction \a axis of the side-centered
+     * data \a data_idx on \a level from \a values, including the faces on the
+     * upper sides of the patches.
+     */
+    static void scatterSideData(int data_idx,
+                                int axis,
+                                SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level,
+                                const SAMRAI::hier::Box<NDIM>& domain_box,
+                                const std::vector<double>& values);
+
+    /*!
+     * \brief Return the domain box of \a level if \a level is uniform (i.e.,
+     * its patches cover the physical domain) and the domain is a single box
+     * that is periodic in every direction.  Otherwise, return an empty box.
+     */
+    static SAMRAI::hier::Box<NDIM>
+    getPeriodicDomainBox(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    FFTUtilities() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    FFTUtilities(const FFTUtilities& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    FFTUtilities& operator=(const FFTUtilities& that) = delete;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_FFTUtilities
@@ -21,6 +21,7 @@
 #include <ibtk/config.h>
 
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
+#include "ibtk/PersistentGhostFillSchedule.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "BoxGeometryFillPattern.h"
@@ -290,6 +291,23 @@ public:
      */
     void setHomogeneousBc(bool homogeneous_bc);
 
+    /*!
+     * \brief Specify whether to use persistent communication schedules.
+     *
+     * When enabled, ghost cell values on the coarsest level of the patch
+     * hierarchy are filled by a PersistentGhostFillSchedule instead of a
+     * SAMRAI::xfer::RefineSchedule.  That schedule sets up its message buffers
+     * and persistent MPI requests once and reuses them on each call to
+     * fillData(), which avoids repeatedly determining message sizes and
+     * allocating buffers when ghost cells are filled many times between
+     * regridding operations (e.g., within iterative solvers).  Finer levels,
+     * which require data from coarser levels, always use SAMRAI schedules.
+     *
+     * \note This setting takes effect the next time that the operator state
+     * is initialized.  By default, persistent schedules are not used.
+     */
+    void setUsePersistentSchedules(bool use_persistent_schedules);
+
     /*!
      * \brief Setup the hierarchy ghost cell interpolation operator to perform
      * the specified interpolation transactions on the specified patch
@@ -336,6 +354,37 @@ public:
      */
     void fillData(double fill_time);
 
+    /*!
+     * \brief Determine whether beginFillData() and endFillData() can overlap
+     * the communication of ghost cell values with other computations.
+     *
+     * This is the case when persistent communication schedules are used (see
+     * setUsePersistentSchedules()) and the operator acts on a patch hierarchy
+     * consisting of only level zero.
+     */
+    bool supportsSplitFillData() const;
+
+    /*!
+     * \brief Start filling coarse-fine boundary and physical boundary ghost
+     * cells on all levels of the patch hierarchy.
+     *
+     * Calling beginFillData() followed by endFillData() is equivalent to
+     * calling fillData().  When supportsSplitFillData() returns true,
+     * beginFillData() only starts communicating ghost cell values, so that
+     * computations that do not require ghost cell values may be performed
+     * before calling endFillData().  Upon return from beginFillData(), the
+     * patch interior values of the destination data have been set.
+     * Otherwise, beginFillData() fills all ghost cell values and endFillData()
+     * does nothing.
+     */
+    void beginFillData(double fill_time);
+
+    /*!
+     * \brief Finish filling ghost cell values that was started by
+     * beginFillData().
+     */
+    void endFillData(double fill_time);
+
 protected:
 private:
     /*!
@@ -358,6 +407,30 @@ private:
      */
     HierarchyGhostCellInterpolation& operator=(const HierarchyGhostCellInterpolation& that) = delete;
 
+    /*!
+     * \brief Compute normal extensions of ghost cell values at coarse-fine
+     * interfaces on the specified level.
+     */
+    void computeNormalExtensions(int ln);
+
+    /*!
+     * \brief Set Robin boundary conditions at physical boundaries.
+     */
+    void setPhysicalBoundaryConditions(double fill_time);
+
+    /*!
+     * \brief Rebuild the persistent communication schedule on the coarsest
+     * level of the patch hierarchy, if one is used.
+     */
+    void resetPersistentSchedule();
+
+    /*!
+     * \brief Determine whether the current persistent communication schedule
+     * can be used for the specified transaction components by resetting its
+     * patch data indices.
+     */
+    bool isPersistentScheduleCompatible(const std::vector<InterpolationTransactionComponent>& transaction_comps) const;
+
     // Boolean indicating whether the operator is initialized.
     bool d_is_initialized = false;
 
@@ -382,6 +455,15 @@ private:
     std::unique_ptr<SAMRAI::xfer::RefinePatchStrategy<NDIM> > d_refine_strategy;
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_refine_scheds;
 
+    // Boolean indicating whether to use a persistent communication schedule on
+    // the coarsest level of the patch hierarchy, and the cached schedule.
+    bool d_use_persistent_schedules = false;
+    std::unique_ptr<PersistentGhostFillSchedule> d_persistent_sched;
+
+    // Boolean indicating whether beginFillData() has been called without a
+    // matching call to endFillData().
+    bool d_fill_data_in_progress = false;
+
     // Cached coarse-fine boundary and physical boundary condition handlers.
     std::vector<SAMRAI::tbox::Pointer<CoarseFineBoundaryRefinePatchStrategy> > d_cf_bdry_ops;
     std::vector<SAMRAI::tbox::Pointer<CartExtrapPhysBdryOp> > d_extrap_bc_ops;
@@ -22,10 +22,13 @@
 
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/InSituAnalysisStrategy.h"
+#include "ibtk/TimeStepSizeController.h"
 #include "ibtk/ibtk_enums.h"
 
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
+#include "BoxArray.h"
 #include "CoarsenAlgorithm.h"
 #include "CoarsenPatchStrategy.h"
 #include "CoarsenSchedule.h"
@@ -34,6 +37,7 @@
 #include "IntVector.h"
 #include "LoadBalancer.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "RefineAlgorithm.h"
 #include "RefinePatchStrategy.h"
 #include "RefineSchedule.h"
@@ -52,6 +56,7 @@
 #include <ostream>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace SAMRAI
@@ -59,8 +64,15 @@ namespace SAMRAI
 namespace hier
 {
 template <int DIM>
+class Patch;
+template <int DIM>
 class Variable;
 } // namespace hier
+namespace pdat
+{
+template <int DIM, class TYPE>
+class CellData;
+} // namespace pdat
 namespace tbox
 {
 class Database;
@@ -162,6 +174,11 @@ public:
      * Subclasses can control the method used to determined the time step size
      * by overriding the protected virtual member function
      * getMaximumTimeStepSizeSpecialized().
+     *
+     * If the input database contains a TimeStepSizeController sub-database,
+     * the maximum time step size is scaled by the factor chosen by a
+     * TimeStepSizeController from the measured wall clock time of the time
+     * steps taken by advanceHierarchy().
      */
     double getMaximumTimeStepSize();
 
@@ -351,6 +368,16 @@ public:
      */
     int getWorkloadDataIndex() const;
 
+    /*!
+     * Print the amount of memory used by the locally allocated patch data of
+     * each variable and context registered with the integrator. For each
+     * patch data index, the total over all processors and the maximum on any
+     * single processor are printed.
+     *
+     * \note This function must be called on all processors.
+     */
+    void printPatchDataMemoryUsage(std::ostream& os) const;
+
     /*!
      * Register a VisIt data writer so the integrator can output data files that
      * may be postprocessed with the VisIt visualization tool.
@@ -500,6 +527,32 @@ public:
      */
     void registerApplyGradientDetectorCallback(ApplyGradientDetectorCallbackFcnPtr callback, void* ctx = nullptr);
 
+    /*!
+     * Callback function specification for tagging cells on a single patch in
+     * applyGradientDetector().
+     */
+    using ApplyGradientDetectorPatchCallbackFcnPtr =
+        void (*)(SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                 int level_number,
+                 double error_data_time,
+                 SAMRAI::pdat::CellData<NDIM, int>& tags_data,
+                 bool initial_time,
+                 void* ctx);
+
+    /*!
+     * Register a callback function that tags cells on a single patch.
+     *
+     * The patch callback functions registered with this integrator and with
+     * all of its descendants are applied in a single sweep over the patches of
+     * the level being tagged, together with resetting the tags.  This avoids
+     * separate passes over the patches of the level for each tagging
+     * criterion.  Patch callback functions may only set tags (i.e., they may
+     * not clear tags set by other criteria) and should not require any
+     * communication.
+     */
+    void registerApplyGradientDetectorPatchCallback(ApplyGradientDetectorPatchCallbackFcnPtr callback,
+                                                    void* ctx = nullptr);
+
     /*!
      * Callback function specification to enable further specialization of regridHierarchy().
      */
@@ -518,6 +571,28 @@ public:
      */
     void registerRegridHierarchyCallback(RegridHierarchyCallbackFcnPtr, void* ctx = nullptr);
 
+    /*!
+     * Register an analysis that is executed on the current data at the end of
+     * the time steps for which InSituAnalysisStrategy::isAnalysisStep() returns
+     * true.
+     *
+     * \note Analyses registered with child integrators are executed by the
+     * top-level integrator.
+     */
+    void registerInSituAnalysis(SAMRAI::tbox::Pointer<InSituAnalysisStrategy> analysis);
+
+    /*!
+     * Indicate that the current time step has failed, e.g., because a solver
+     * diverged.
+     *
+     * If rollback is enabled (i.e., if rollback_depth > 0 in the input database
+     * of the top-level integrator), the top-level integrator restores the state
+     * saved at the beginning of the step at the end of advanceHierarchy() and
+     * repeats the step with a smaller time step size.  Otherwise, the failure
+     * is ignored.
+     */
+    void indicateStepFailure(const std::string& reason);
+
     /*!
      * Perform data initialization after the entire hierarchy has been constructed.
      */
@@ -550,6 +625,13 @@ public:
     /*!
      * Reset cached hierarchy dependent data.
      *
+     * During regridding, levels that were not replaced by the gridding
+     * algorithm keep their communication schedules: the range of levels that
+     * are reset (including the range passed to
+     * resetHierarchyConfigurationSpecialized() and to any child integrators)
+     * starts at the coarsest level that was actually replaced.  If no level was
+     * replaced and the number of levels is unchanged, nothing is reset.
+     *
      * \note Subclasses should not override the implementation of this function
      * provided by class HierarchyIntegrator.  Instead, they should override the
      * protected virtual member function
@@ -626,6 +708,19 @@ public:
      */
     void allocatePatchData(int data_idx, double data_time, int coarsest_ln = -1, int finest_ln = -1) const;
 
+    /*!
+     * Allocate the patch data indices selected by \p data on \p level.
+     *
+     * If <code>use_level_arenas</code> is set in the input database, the data
+     * of each patch data index are allocated from a LevelArena, i.e., in one
+     * contiguous, aligned block of memory per level that is first touched by
+     * the threads that process the patches. Otherwise this function is
+     * equivalent to SAMRAI::hier::PatchLevel::allocatePatchData().
+     */
+    void allocateLevelPatchData(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level,
+                                const SAMRAI::hier::ComponentSelector& data,
+                                double data_time) const;
+
     /*!
      * Deallocate a patch data index over the specified range of patch level
      * numbers.
@@ -718,7 +813,8 @@ protected:
     /*!
      * Virtual method to compute an implementation-specific maximum stable time
      * step size. Implementations should ensure that the returned time step is
-     * consistent across all processors.
+     * consistent across all processors, which is most efficiently done by
+     * returning minReduceTimeStepSize() of the local time step size.
      *
      * A default implementation is provided that returns
      * min(dt_max,dt_growth_factor*dt_current).  The growth condition prevents
@@ -726,6 +822,17 @@ protected:
      */
     virtual double getMaximumTimeStepSizeSpecialized();
 
+    /*!
+     * Return the minimum of \p dt over all processes.
+     *
+     * When called while getMaximumTimeStepSize() is computing the time step
+     * size of this or a parent integrator, \p dt is returned unchanged and the
+     * reduction is instead done once by the outermost call to
+     * getMaximumTimeStepSize(). This avoids one global reduction per
+     * integrator (and per patch level) in each time step.
+     */
+    double minReduceTimeStepSize(double dt) const;
+
     /*!
      * Virtual method to perform implementation-specific data synchronization.
      *
@@ -828,6 +935,31 @@ protected:
      */
     virtual void putToDatabaseSpecialized(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
+    /*!
+     * Virtual method to save implementation-specific state that is not stored
+     * in the state variables (e.g., Lagrangian data) so that the time step can
+     * be rolled back.  The state is identified by the index slot.
+     *
+     * An empty default implementation is provided.
+     */
+    virtual void saveRollbackStateSpecialized(int slot);
+
+    /*!
+     * Virtual method to restore implementation-specific state saved by
+     * saveRollbackStateSpecialized().
+     *
+     * An empty default implementation is provided.
+     */
+    virtual void restoreRollbackStateSpecialized(int slot);
+
+    /*!
+     * Virtual method to free implementation-specific state saved by
+     * saveRollbackStateSpecialized().
+     *
+     * An empty default implementation is provided.
+     */
+    virtual void discardRollbackStateSpecialized(int slot);
+
     /*!
      * Virtual method to provide implementation-specific workload estimate
      * calculations. This method will be called on each registered child
@@ -1032,6 +1164,13 @@ protected:
      */
     bool d_hierarchy_is_initialized = false;
 
+    /*
+     * The patch levels of the hierarchy at the time of the most recent
+     * configuration change.  These are only stored during regridding and are
+     * used to detect which levels were replaced by the gridding algorithm.
+     */
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > > d_regrid_old_levels;
+
     /*
      * Collection of child integrator objects.
      */
@@ -1054,6 +1193,12 @@ protected:
     int d_integrator_step = 0, d_max_integrator_steps = std::numeric_limits<int>::max();
     std::deque<double> d_dt_previous;
 
+    /*
+     * Optional controller that scales the maximum time step size based on the
+     * measured cost of previous time steps.
+     */
+    std::unique_ptr<TimeStepSizeController> d_dt_controller;
+
     /*
      * The number of cycles of fixed-point iteration to use per timestep.
      */
@@ -1101,6 +1246,12 @@ protected:
      */
     bool d_enable_logging_solver_iterations = false;
 
+    /*
+     * Indicates whether the patch data allocated by the integrator are
+     * allocated from one LevelArena per level and patch data index.
+     */
+    bool d_use_level_arenas = false;
+
     /*
      * The type of extrapolation to use at physical boundaries when prolonging
      * data during regridding.
@@ -1163,9 +1314,41 @@ protected:
     std::vector<void*> d_postprocess_integrate_hierarchy_callback_ctxs;
     std::vector<ApplyGradientDetectorCallbackFcnPtr> d_apply_gradient_detector_callbacks;
     std::vector<void*> d_apply_gradient_detector_callback_ctxs;
+    std::vector<ApplyGradientDetectorPatchCallbackFcnPtr> d_apply_gradient_detector_patch_callbacks;
+    std::vector<void*> d_apply_gradient_detector_patch_callback_ctxs;
     std::vector<RegridHierarchyCallbackFcnPtr> d_regrid_hierarchy_callbacks;
     std::vector<void*> d_regrid_hierarchy_callback_ctxs;
 
+    /*!
+     * In-situ analyses.
+     */
+    std::vector<SAMRAI::tbox::Pointer<InSituAnalysisStrategy> > d_in_situ_analyses;
+
+    /*!
+     * Rollback options and data.  The top-level integrator keeps up to
+     * d_rollback_depth states, each of which is stored in one of
+     * d_rollback_depth slots.  For each slot, d_rollback_idxs contains pairs
+     * of the current and rollback patch data indices of the state variables of
+     * this integrator and all of its descendants.  The time, step number, and
+     * previous time step sizes of each integrator are saved in tree order.
+     */
+    int d_rollback_depth = 0, d_rollback_max_retries = 3;
+    double d_rollback_dt_factor = 0.5;
+    bool d_rollback_check_finite = true, d_rollback_on_step_failure = true;
+    bool d_step_failure_indicated = false;
+    std::string d_step_failure_reason;
+    int d_num_rollback_retries = 0;
+    double d_rollback_base_dt = 0.0;
+    struct RollbackState
+    {
+        int slot;
+        std::vector<double> integrator_times;
+        std::vector<int> integrator_steps;
+        std::vector<std::deque<double> > dt_previous;
+    };
+    std::deque<RollbackState> d_rollback_states;
+    std::vector<std::vector<std::pair<int, int> > > d_rollback_idxs;
+
 private:
     /*!
      * \brief Default constructor.
@@ -1174,6 +1357,14 @@ private:
      */
     HierarchyIntegrator();
 
+    /*!
+     * Collect the patch tagging callback functions (and their contexts) of this
+     * integrator and of all of its descendants.
+     */
+    void
+    getApplyGradientDetectorPatchCallbackFcns(std::vector<ApplyGradientDetectorPatchCallbackFcnPtr>& callbacks,
+                                              std::vector<void*>& ctxs) const;
+
     /*!
      * \brief Copy constructor.
      *
@@ -1205,6 +1396,94 @@ private:
      */
     void getFromRestart();
 
+    /*!
+     * Determine the patch data indices of the variables registered with the
+     * integrator and the number of bytes of locally allocated patch data for
+     * each index.
+     */
+    void getLocalPatchDataMemoryUsage(std::vector<int>& idxs, std::vector<double>& local_bytes) const;
+
+    /*!
+     * Report the memory used by the locally allocated patch data of this
+     * integrator and of all of its descendants to MemoryStatistics.
+     */
+    void updateMemoryUsage();
+
+    /*!
+     * Execute the in-situ analyses registered with this integrator and with all
+     * of its descendants.
+     */
+    void executeInSituAnalyses();
+
+    /*!
+     * Save the current data of the state variables and the implementation
+     * specific state of this integrator and of all of its descendants.
+     */
+    void saveRollbackState();
+
+    /*!
+     * Restore the most recently saved rollback state and remove it.
+     */
+    void restoreRollbackState();
+
+    /*!
+     * Remove the most recently saved rollback state without restoring it
+     * (newest = true) or remove the oldest rollback state (newest = false).
+     */
+    void discardRollbackState(bool newest);
+
+    /*!
+     * Remove all saved rollback states, e.g., because the hierarchy was
+     * regridded.
+     */
+    void clearRollbackStates();
+
+    /*!
+     * Return whether the time step has failed, i.e., whether a failure was
+     * indicated by this integrator or by any of its descendants or (if
+     * rollback_check_finite is enabled) whether the current data of any state
+     * variable is not finite.
+     *
+     * \note This function is collective.
+     */
+    bool stepFailed();
+
+    /*!
+     * Advance the hierarchy by a single time step of size dt, which is reduced
+     * if necessary so that the step does not extend past the end time, and
+     * return the wall-clock time spent on the step (excluding regridding).
+     */
+    double takeTimeStep(double& dt);
+
+    /*!
+     * Roll back the failed time step and return the reduced time step size
+     * with which it is to be repeated.
+     */
+    double rollBack();
+
+    /*!
+     * Return the string that identifies the configuration of the gridding
+     * algorithm for which the initial hierarchy cache is valid.  It consists of
+     * the user-provided key, the physical domain, the maximum number of levels,
+     * and the refinement ratios.
+     */
+    std::string getInitialHierarchyCacheKey() const;
+
+    /*!
+     * Read the box layout of the initial patch hierarchy from the cache file.
+     *
+     * \return Whether the cache file exists and matches the present
+     * configuration.
+     *
+     * \note This function is collective.
+     */
+    bool readInitialHierarchyCache();
+
+    /*!
+     * Write the box layout of the patch hierarchy to the cache file.
+     */
+    void writeInitialHierarchyCache() const;
+
     /*
      * Indicates whether we are currently regridding the hierarchy, or whether
      * the time step began by regridding the hierarchy.
@@ -1213,6 +1492,19 @@ private:
     bool d_at_regrid_time_step = false;  // true for the duration of a time step that included a regrid
                                          // operation
 
+    /*
+     * Cache of the box layout of the initial patch hierarchy.  When a cache
+     * file that matches the present configuration exists, the initial
+     * hierarchy is generated by tagging the cells covered by the cached boxes
+     * instead of applying the tagging criteria of the integrators, which may
+     * require expensive setup of, e.g., Lagrangian structures.  The cached
+     * boxes of each level are stored coarsened to the index space of the next
+     * coarser level.
+     */
+    std::string d_initial_hierarchy_cache_file_name, d_initial_hierarchy_cache_key;
+    std::vector<SAMRAI::hier::BoxArray<NDIM> > d_initial_hierarchy_cache_tag_boxes;
+    bool d_using_initial_hierarchy_cache = false;
+
     /*
      * Cached communications algorithms, strategies, and schedules.
      */
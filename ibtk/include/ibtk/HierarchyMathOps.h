@@ -25,6 +25,7 @@
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
 
+#include "BoxArray.h"
 #include "CartesianGridGeometry.h"
 #include "CellVariable.h"
 #include "CoarsenAlgorithm.h"
@@ -118,6 +119,11 @@ public:
      *
      * The specified levels must exist in the hierarchy or an assertion will
      * result.
+     *
+     * The cell, face, and side weights are only recomputed on levels whose
+     * configuration (i.e., the level itself, the boxes of the next finer
+     * level, and whether it is the coarsest or finest level of the range)
+     * has changed since they were last computed.
      */
     void resetLevels(int coarsest_ln, int finest_ln);
 
@@ -953,6 +959,35 @@ public:
                  int src2_idx = -1,
                  SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > src2_var = NULL);
 
+    /*!
+     * \brief Compute the Laplacian of a vector quantity plus the gradient of a
+     * scalar quantity using centered differences.
+     *
+     * Sets dst = C src1 + div D grad src1 + gamma grad src2.
+     *
+     * The result is the same as computing dst = gamma grad src2 with grad()
+     * (without synchronizing the coarse-fine interface) followed by a call to
+     * laplace() with dst as src2, but both operators are evaluated in a single
+     * pass over each patch.  The ghost cells of src2 must already be filled.
+     *
+     * \note The present implementation of this operator \em requires that
+     * damping factor C and diffusivity D be spatially constant and
+     * scalar-valued.
+     *
+     * \see setPatchHierarchy
+     * \see resetLevels
+     */
+    void laplace(int dst_idx,
+                 SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > dst_var,
+                 const SAMRAI::solv::PoissonSpecifications& poisson_spec,
+                 int src1_idx,
+                 SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > src1_var,
+                 SAMRAI::tbox::Pointer<HierarchyGhostCellInterpolation> src1_ghost_fill,
+                 double src1_ghost_fill_time,
+                 double gamma,
+                 int src2_idx,
+                 SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > src2_var);
+
     /*!
      * \brief Compute dst = alpha div coef1 ((grad src1) + (grad src1)^T) + beta coef2
      * src1 + gamma src2, the variable coefficient generalized Laplacian of
@@ -1386,6 +1421,22 @@ private:
      */
     HierarchyMathOps& operator=(const HierarchyMathOps& that) = delete;
 
+    /*!
+     * \brief Compute dst = C src1 + div D grad src1 + gamma src2 for
+     * side-centered data, or dst = C src1 + div D grad src1 + gamma grad
+     * grad_src if grad_src_idx refers to cell-centered data, and synchronize
+     * the result along the coarse-fine interface.
+     */
+    void laplaceSide(int dst_idx,
+                     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > dst_var,
+                     const SAMRAI::solv::PoissonSpecifications& poisson_spec,
+                     int src1_idx,
+                     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > src1_var,
+                     double gamma,
+                     int src2_idx,
+                     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > src2_var,
+                     int grad_src_idx);
+
     /*!
      * \brief Reset the coarsen operators.
      */
@@ -1466,6 +1517,18 @@ private:
     int d_wgt_cc_idx = IBTK::invalid_index, d_wgt_fc_idx = IBTK::invalid_index, d_wgt_sc_idx = IBTK::invalid_index;
     bool d_using_wgt_cc = false, d_using_wgt_fc = false, d_using_wgt_sc = false;
     double d_volume = 0.0;
+
+    // The weights on a level only depend on the boxes of the level and of the
+    // next finer level, so they are only recomputed when this configuration
+    // changes.
+    struct WeightLevelConfiguration
+    {
+        const SAMRAI::hier::PatchLevel<NDIM>* level = nullptr;
+        SAMRAI::hier::BoxArray<NDIM> boxes;
+        SAMRAI::hier::BoxArray<NDIM> finer_boxes;
+        bool is_coarsest = false, is_finest = false;
+    };
+    std::vector<WeightLevelConfiguration> d_wgt_level_configs;
 };
 } // namespace IBTK
 
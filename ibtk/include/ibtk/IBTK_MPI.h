@@ -140,6 +140,13 @@ struct IBTK_MPI
      */
     static int getNodes(IBTK_MPI::comm communicator = getCommunicator());
 
+    /**
+     * Return a new communicator that contains the processes of the given
+     * communicator that can share memory, i.e., that run on the same node.
+     * The returned communicator must be freed with MPI_Comm_free().
+     */
+    static IBTK_MPI::comm splitByNode(IBTK_MPI::comm communicator = getCommunicator());
+
     /**
      * Perform a global barrier across all processors.
      */
@@ -183,6 +190,31 @@ struct IBTK_MPI
     static void sumReduction(T* x, const int n = 1, IBTK_MPI::comm communicator = getCommunicator());
     //@}
 
+    //@{
+    /**
+     * Start a nonblocking min, max, or sum reduction on an array of type
+     * double, int, or float. The element-wise result is stored in the same
+     * array once the returned request has been completed with
+     * IBTK_MPI::wait(); the array must not be accessed before then.
+     *
+     * Work that does not depend on the result can be done between starting the
+     * reduction and waiting for it, so that the time spent by processes that
+     * reach the reduction early is not lost.
+     */
+    template <typename T>
+    static IBTK_MPI::request iminReduction(T* x, const int n = 1, IBTK_MPI::comm communicator = getCommunicator());
+    template <typename T>
+    static IBTK_MPI::request imaxReduction(T* x, const int n = 1, IBTK_MPI::comm communicator = getCommunicator());
+    template <typename T>
+    static IBTK_MPI::request isumReduction(T* x, const int n = 1, IBTK_MPI::comm communicator = getCommunicator());
+    //@}
+
+    /**
+     * Wait for the completion of a nonblocking operation. Requests equal to
+     * MPI_REQUEST_NULL are ignored.
+     */
+    static void wait(IBTK_MPI::request& request);
+
     /**
      * Perform an all-to-one sum reduction on an integer array.
      * The final result is only available on the root processor.
@@ -318,6 +350,9 @@ private:
     template <typename T>
     static void minMaxReduction(T* x, const int n, int* rank, MPI_Op op, IBTK_MPI::comm communicator);
 
+    template <typename T>
+    static IBTK_MPI::request iallReduce(T* x, const int n, MPI_Op op, IBTK_MPI::comm communicator);
+
     static IBTK_MPI::comm s_communicator;
 };
 
@@ -0,0 +1,127 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_InSituAnalysisStrategy
+#define included_IBTK_InSituAnalysisStrategy
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "PatchHierarchy.h"
+#include "tbox/DescribedClass.h"
+#include "tbox/Pointer.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class InSituAnalysisStrategy provides an interface for analyses that
+ * are executed while a simulation runs, e.g., to compute flow rates or to hand
+ * the solution to an in-situ visualization library, instead of writing the
+ * full solution to disk for post-processing.
+ *
+ * Analyses are registered with a HierarchyIntegrator (see
+ * HierarchyIntegrator::registerInSituAnalysis()).  At the end of each time
+ * step, the top-level integrator calls isAnalysisStep() for each analysis
+ * registered with it or with any of its child integrators, and calls
+ * executeAnalysis() if it returns true.  The analysis receives the patch
+ * hierarchy itself, so it can access the current patch data of the integrators
+ * in place (e.g., via HierarchyIntegrator::getCurrentContext()) without copying
+ * it.  Analyses of Lagrangian or finite element data should keep pointers to
+ * the corresponding data managers.
+ *
+ * By default, an analysis is executed every getInterval() time steps.
+ * Implementations can override isAnalysisStep() to trigger the analysis
+ * adaptively, e.g., when a quantity computed from the solution exceeds a
+ * threshold.
+ *
+ * \note Both isAnalysisStep() and executeAnalysis() are called on all
+ * processes, and isAnalysisStep() must return the same value on all processes.
+ */
+class InSituAnalysisStrategy : public virtual SAMRAI::tbox::DescribedClass
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    explicit InSituAnalysisStrategy(int interval = 1);
+
+    /*!
+     * \brief Destructor.
+     */
+    virtual ~InSituAnalysisStrategy() = default;
+
+    /*!
+     * \brief Set the number of time steps between successive executions of the
+     * analysis.  An interval of zero disables the default trigger.
+     */
+    void setInterval(int interval);
+
+    /*!
+     * \brief Return the number of time steps between successive executions of
+     * the analysis.
+     */
+    int getInterval() const;
+
+    /*!
+     * \brief Return whether the analysis is executed at the end of the time
+     * step iteration_num.
+     *
+     * The default implementation returns true every getInterval() time steps.
+     */
+    virtual bool isAnalysisStep(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                double data_time,
+                                int iteration_num);
+
+    /*!
+     * \brief Execute the analysis on the current data at time data_time.
+     */
+    virtual void executeAnalysis(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                 double data_time,
+                                 int iteration_num) = 0;
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    InSituAnalysisStrategy(const InSituAnalysisStrategy& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    InSituAnalysisStrategy& operator=(const InSituAnalysisStrategy& that) = delete;
+
+    /*!
+     * The number of time steps between successive executions of the analysis.
+     */
+    int d_interval;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_InSituAnalysisStrategy
@@ -37,6 +37,8 @@ namespace SAMRAI
 {
 namespace pdat
 {
+template <int DIM, class TYPE>
+class CellData;
 template <int DIM>
 class CellIndex;
 template <int DIM>
@@ -139,6 +141,54 @@ public:
                  const SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> >& grid_geom,
                  const SAMRAI::hier::IntVector<NDIM>& ratio);
 
+    /*!
+     * \brief Compute the cell indices of \p num_points locations stored
+     * contiguously in \p X (i.e., the coordinates of point k are X[NDIM*k],
+     * ..., X[NDIM*k+NDIM-1]) relative to \p x_lower and \p x_upper for the
+     * specified Cartesian grid spacings \p dx and box extents \p ilower and
+     * \p iupper, and store them in \p indices, which must have room for
+     * \p num_points entries.
+     *
+     * The computed indices are identical to those computed by getCellIndex(),
+     * but the loop over the points is vectorizable and the grid data are only
+     * read once, so this function should be preferred whenever the cell
+     * indices of many points are required.
+     */
+    static void getCellIndices(const double* X,
+                               int num_points,
+                               const double* x_lower,
+                               const double* x_upper,
+                               const double* dx,
+                               const SAMRAI::hier::Index<NDIM>& ilower,
+                               const SAMRAI::hier::Index<NDIM>& iupper,
+                               SAMRAI::hier::Index<NDIM>* indices);
+
+    /*!
+     * \brief Compute the cell indices of \p num_points locations stored
+     * contiguously in \p X relative to the extents of the supplied Cartesian
+     * grid patch geometry and patch box.
+     *
+     * \see getCellIndices()
+     */
+    static void getCellIndices(const double* X,
+                               int num_points,
+                               const SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianPatchGeometry<NDIM> >& patch_geom,
+                               const SAMRAI::hier::Box<NDIM>& patch_box,
+                               SAMRAI::hier::Index<NDIM>* indices);
+
+    /*!
+     * \brief Compute the cell indices of \p num_points locations stored
+     * contiguously in \p X relative to the corner of the computational domain
+     * specified by the grid geometry object.
+     *
+     * \see getCellIndices()
+     */
+    static void getCellIndices(const double* X,
+                               int num_points,
+                               const SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> >& grid_geom,
+                               const SAMRAI::hier::IntVector<NDIM>& ratio,
+                               SAMRAI::hier::Index<NDIM>* indices);
+
     /*!
      * \return The spatial coordinate of the given side center.
      *
@@ -215,6 +265,23 @@ public:
                                                            const SAMRAI::hier::IntVector<NDIM>& box_size,
                                                            const SAMRAI::hier::IntVector<NDIM>& overlap_size);
 
+    /*!
+     * \brief Compute the smallest box containing every cell of \em box at
+     * which the cell-centered data satisfies \f$ \phi \le \f$ \em threshold.
+     *
+     * This is useful for restricting loops over diffuse interface regions
+     * (e.g., Brinkman penalization zones) to the part of a patch where the
+     * level set is actually below the interface threshold. Only cells that
+     * lie in the ghost box of \em phi_data are examined.
+     *
+     * \return The bounding box of the sublevel set, or an empty box if no
+     * cell of \em box satisfies the threshold.
+     */
+    static SAMRAI::hier::Box<NDIM> getSublevelSetBoundingBox(const SAMRAI::pdat::CellData<NDIM, double>& phi_data,
+                                                             const SAMRAI::hier::Box<NDIM>& box,
+                                                             double threshold,
+                                                             int depth = 0);
+
 private:
     /*!
      * \brief Default constructor.
@@ -22,11 +22,14 @@
 
 #include "ibtk/LinearOperator.h"
 #include "ibtk/LinearSolver.h"
+#include "ibtk/SAMRAIFischerGuess.h"
 
 #include "IntVector.h"
 #include "SAMRAIVectorReal.h"
 #include "tbox/Pointer.h"
 
+#include <memory>
+
 namespace IBTK
 {
 class HierarchyMathOps;
@@ -110,6 +113,23 @@ public:
      */
     virtual SAMRAI::tbox::Pointer<LinearSolver> getPreconditioner() const;
 
+    /*!
+     * \brief Set the number of previous solution and RHS pairs that are used
+     * to compute an initial guess for the Krylov subspace method.
+     *
+     * When \a n_vectors is positive, the solver stores the solutions and the
+     * (boundary condition-modified) right-hand sides of its most recent solves
+     * and uses them to compute an initial guess for the next solve via class
+     * SAMRAIFischerGuess. This is useful when the same linear system is solved
+     * with slowly varying right-hand sides, e.g., at successive time steps.
+     * If a nonzero initial guess is used, the stored vectors are used to
+     * correct it. Stored vectors are discarded when the solver state is
+     * deallocated. Setting \a n_vectors to zero disables this feature.
+     *
+     * \note Implementations that do not support this feature ignore it.
+     */
+    virtual void setNumberOfFischerGuessVectors(int n_vectors);
+
     //\}
 
 protected:
@@ -118,6 +138,9 @@ protected:
     SAMRAI::tbox::Pointer<LinearSolver> d_pc_solver;
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_x, d_b;
 
+    // Previous solutions and right-hand sides used to compute initial guesses.
+    std::unique_ptr<SAMRAIFischerGuess> d_fischer_guess;
+
 private:
     /*!
      * \brief Copy constructor.
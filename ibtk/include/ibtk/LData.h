@@ -51,6 +51,9 @@ namespace IBTK
 class LData : public SAMRAI::tbox::Serializable
 {
 public:
+    class ReadAccess;
+    class WriteAccess;
+
     /*!
      * \brief Constructor.
      *
@@ -266,6 +269,141 @@ public:
      */
     void restoreArrays();
 
+    /*!
+     * \brief Class LData::ReadAccess provides read-only access to the ghosted
+     * local form of the data for the lifetime of the object.
+     *
+     * The array is obtained from PETSc with VecGetArrayRead() the first time it
+     * is needed and remains cached by the LData object until restoreArrays() is
+     * called, so that constructing a ReadAccess object is cheap and does not
+     * change the PETSc state of the vector. Values are indexed using the \em
+     * local PETSc indexing scheme.
+     *
+     * \note getVec() and restoreArrays() must not be called while ReadAccess
+     * or WriteAccess objects are outstanding.
+     */
+    class ReadAccess
+    {
+    public:
+        /*!
+         * \brief Constructor.
+         */
+        explicit ReadAccess(LData& data);
+
+        /*!
+         * \brief Destructor.
+         */
+        ~ReadAccess();
+
+        /*!
+         * \brief Copy constructor. This function is not implemented and should not be used.
+         */
+        ReadAccess(const ReadAccess& from) = delete;
+
+        /*!
+         * \brief Assignment operator. This function is not implemented and should not be used.
+         */
+        ReadAccess& operator=(const ReadAccess& that) = delete;
+
+        /*!
+         * \brief Return a pointer to the values of the local and ghost nodes.
+         */
+        const double* data() const;
+
+        /*!
+         * \brief Return the number of local nodes.
+         */
+        unsigned int getLocalNodeCount() const;
+
+        /*!
+         * \brief Return the number of ghost nodes.
+         */
+        unsigned int getGhostNodeCount() const;
+
+        /*!
+         * \brief Return the number of components per node.
+         */
+        unsigned int getDepth() const;
+
+        /*!
+         * \brief Return component \p d of the value of local or ghost node \p
+         * i.
+         */
+        const double& operator()(unsigned int i, unsigned int d = 0) const;
+
+    private:
+        LData& d_data;
+        const double* d_array;
+    };
+
+    /*!
+     * \brief Class LData::WriteAccess provides read-write access to the
+     * ghosted local form of the data for the lifetime of the object.
+     *
+     * WriteAccess objects may be nested with each other and with ReadAccess
+     * objects, in which case they share the same array. The array is returned
+     * to PETSc (which records that the vector has been modified) only when the
+     * last outstanding access is destroyed, so that a WriteAccess object that
+     * spans a loop over patches replaces one VecGetArray()/VecRestoreArray()
+     * pair per patch by a single one.
+     *
+     * \note A WriteAccess object must not be created while a ReadAccess object
+     * is outstanding, unless the writable array has already been obtained.
+     */
+    class WriteAccess
+    {
+    public:
+        /*!
+         * \brief Constructor.
+         */
+        explicit WriteAccess(LData& data);
+
+        /*!
+         * \brief Destructor.
+         */
+        ~WriteAccess();
+
+        /*!
+         * \brief Copy constructor. This function is not implemented and should not be used.
+         */
+        WriteAccess(const WriteAccess& from) = delete;
+
+        /*!
+         * \brief Assignment operator. This function is not implemented and should not be used.
+         */
+        WriteAccess& operator=(const WriteAccess& that) = delete;
+
+        /*!
+         * \brief Return a pointer to the values of the local and ghost nodes.
+         */
+        double* data() const;
+
+        /*!
+         * \brief Return the number of local nodes.
+         */
+        unsigned int getLocalNodeCount() const;
+
+        /*!
+         * \brief Return the number of ghost nodes.
+         */
+        unsigned int getGhostNodeCount() const;
+
+        /*!
+         * \brief Return the number of components per node.
+         */
+        unsigned int getDepth() const;
+
+        /*!
+         * \brief Return a reference to component \p d of the value of local or
+         * ghost node \p i.
+         */
+        double& operator()(unsigned int i, unsigned int d = 0) const;
+
+    private:
+        LData& d_data;
+        double* d_array;
+    };
+
     /*!
      * \brief Begin updating ghost values.
      */
@@ -281,6 +419,16 @@ public:
      */
     void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db) override;
 
+    /*!
+     * \brief Write out object state to the given database, optionally omitting
+     * the values of the vector.
+     *
+     * An LData object restored from a database without values is zero-initialized
+     * and its values must be restored separately (see
+     * LDataManager::readLDataFromRestartFile()).
+     */
+    void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db, bool put_values);
+
 private:
     /*!
      * \brief Default constructor.
@@ -310,6 +458,14 @@ private:
     void getArrayCommon();
     void getGhostedLocalFormArrayCommon();
 
+    /*
+     * Obtain and release the arrays used by ReadAccess and WriteAccess
+     * objects.
+     */
+    const double* acquireReadArray();
+    double* acquireWriteArray();
+    void releaseArray();
+
     /*
      * The name of the LData object.
      */
@@ -365,6 +521,16 @@ private:
     double* d_ghosted_local_array = nullptr;
     boost::multi_array_ref<double, 1> d_boost_ghosted_local_array{ nullptr, std::vector<int>{ 0 } };
     boost::multi_array_ref<double, 2> d_boost_vec_ghosted_local_array{ nullptr, std::vector<int>{ 0, 0 } };
+
+    /*
+     * The read-only array of the PETSc Vec object in local form used by
+     * ReadAccess objects, the number of outstanding ReadAccess and WriteAccess
+     * objects, and whether the writable array was obtained for a WriteAccess
+     * object (in which case it is restored when the last access is destroyed).
+     */
+    const double* d_ghosted_local_read_array = nullptr;
+    int d_num_accesses = 0;
+    bool d_restore_after_write_access = false;
 };
 } // namespace IBTK
 
@@ -20,6 +20,7 @@
 
 #include <ibtk/config.h>
 
+#include "ibtk/LEInteractor.h"
 #include "ibtk/LInitStrategy.h"
 #include "ibtk/LNodeSet.h"
 #include "ibtk/LNodeSetVariable.h"
@@ -48,6 +49,7 @@
 #include "petscao.h"
 #include "petscvec.h"
 
+#include <chrono>
 #include <map>
 #include <ostream>
 #include <string>
@@ -257,6 +259,92 @@ public:
 
     //\}
 
+    /*!
+     * \brief Set whether the cached local indices of each patch are sorted by
+     * cell index.
+     *
+     * When enabled, the nodes on each patch are ordered along a Z-order curve
+     * through the patch cells each time the cached indexing data are rebuilt
+     * (i.e., after regridding or redistributing data), which improves the
+     * memory locality of spreading and interpolation.  Disabled by default.
+     *
+     * \see LIndexSetData::cacheLocalIndices
+     */
+    void setSortLocalIndicesByCell(bool sort_local_indices_by_cell);
+
+    /*!
+     * \brief Set whether the local nodes of each level are stored in cell
+     * order.
+     *
+     * When enabled, the local PETSc indices of the nodes on each patch are
+     * assigned along a Z-order curve through the patch cells each time the node
+     * distribution is recomputed (i.e., after regridding or redistributing
+     * data), so that the LMesh and the PETSc vectors of all LData objects store
+     * nearby nodes in nearby memory.  Otherwise, the local ordering depends on
+     * the order in which nodes were received from other processes.  Disabled by
+     * default.
+     */
+    void setSortLocalNodesByCell(bool sort_local_nodes_by_cell);
+
+    /*!
+     * \brief Set whether the per-node workload weight beta_work used by
+     * addWorkloadEstimate() is calibrated from measured run times.
+     *
+     * When enabled, the time spent in the local spreading and interpolation
+     * kernels is accumulated between successive calls to
+     * addWorkloadEstimate().  At each call, the measured cost per node lambda
+     * and the remaining cost per cell epsilon (inferred from the elapsed wall
+     * time of the interval) are used to form the estimate lambda / epsilon,
+     * which is blended into beta_work with the specified relaxation factor in
+     * [0,1].  Disabled by default.
+     */
+    void setWorkloadCalibration(bool calibrate_workload, double relaxation = 0.5);
+
+    /*!
+     * \brief Set whether the values of the Lagrangian data are written to a
+     * shared restart file instead of to the per-process SAMRAI restart files.
+     *
+     * When enabled, putToDatabase() only stores the layout of the LData
+     * objects, and the values must be written by writeLDataToRestartFile() each
+     * time a restart file is written and read by readLDataFromRestartFile()
+     * after the manager has been restored from restart.  Disabled by default.
+     */
+    void setUseCollectiveRestart(bool use_collective_restart);
+
+    /*!
+     * \brief Set whether the stencils and kernel weights computed by interp()
+     * and spread() are cached and reused.
+     *
+     * When enabled, each level keeps an LEInteractor::WeightCache for each
+     * data centering, so that interpolating and spreading repeatedly at the
+     * same positions (e.g., at the midpoint positions in a single time step)
+     * only computes the kernel weights once. The caches are cleared whenever
+     * the Lagrangian data are redistributed. Disabled by default.
+     *
+     * \see LEInteractor::setWeightCache
+     */
+    void setUseWeightCache(bool use_weight_cache);
+
+    /*!
+     * \brief Write the values of all LData objects to a single file in the
+     * directory restart_dump_dirname.
+     *
+     * The values are written in the Lagrangian ordering with collective MPI-IO
+     * via the PETSc binary viewer, so the contents of the file do not depend on
+     * the number of processes or on the distribution of the nodes.
+     *
+     * \note This function is collective.
+     */
+    void writeLDataToRestartFile(const std::string& restart_dump_dirname, unsigned int time_step_number);
+
+    /*!
+     * \brief Read the values of all LData objects from a file written by
+     * writeLDataToRestartFile().
+     *
+     * \note This function is collective.
+     */
+    void readLDataFromRestartFile(const std::string& restart_read_dirname, unsigned int restore_number);
+
     /*!
      * \brief Return the ghost cell width associated with the interaction
      * scheme.
@@ -775,6 +863,10 @@ public:
      * \brief Inactivate the Lagrangian structures with the specified ID
      * numbers.
      *
+     * The nodes of inactivated structures are skipped by interp() and
+     * spread(); the corresponding components of the interpolated and spread
+     * quantities are zero.
+     *
      * \note This method is collective (i.e., must be called by all MPI
      * processes); however, each MPI process may provide a different collection
      * of structures to inactivate.
@@ -878,7 +970,11 @@ public:
      *
      *    workload(i) = 1 + beta_work*node_count(i)
      *
-     * in which alpha and beta are parameters that each default to the value 1.
+     * in which beta_work defaults to the value 1.  If workload calibration is
+     * enabled, beta_work is first updated from the timings collected since the
+     * previous call.
+     *
+     * \see setWorkloadCalibration
      */
     void addWorkloadEstimate(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                              const int workload_data_idx,
@@ -1037,6 +1133,12 @@ private:
      */
     void scatterData(Vec& lagrangian_vec, Vec& petsc_vec, int level_number, ScatterMode mode) const;
 
+    /*!
+     * \brief Report the memory used by the managed LData objects to
+     * MemoryStatistics.
+     */
+    void updateMemoryUsage();
+
     /*!
      * \brief Begin the process of refilling nonlocal Lagrangian quantities over
      * the specified range of levels in the patch hierarchy.
@@ -1055,6 +1157,13 @@ private:
      */
     void endNonlocalDataFill(int coarsest_ln = -1, int finest_ln = -1);
 
+    /*!
+     * Exclude the nodes of the inactivated structures on the specified level
+     * from the lists of active nodes of each LNodeSetData object, so that they
+     * are skipped by interp() and spread().
+     */
+    void resetInactiveNodeIndices(int level_number);
+
     /*!
      * Determines the global Lagrangian and PETSc indices of the local and
      * nonlocal nodes associated with the processor as well as the local PETSc
@@ -1092,6 +1201,12 @@ private:
      */
     static void computeNodeOffsets(unsigned int& num_nodes, unsigned int& node_offset, unsigned int num_local_nodes);
 
+    /*!
+     * Update d_beta_work from the Lagrangian kernel time and elapsed wall time
+     * measured since the previous call.
+     */
+    void calibrateWorkloadWeight(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
+
     /*!
      * Read object state from the restart file and initialize class data
      * members.  The database from which the restart data is read is determined
@@ -1107,6 +1222,11 @@ private:
      */
     void getFromRestart();
 
+    /*!
+     * Return the name of the file written by writeLDataToRestartFile().
+     */
+    std::string getLDataRestartFileName(const std::string& restart_dirname, unsigned int time_step_number) const;
+
     /*!
      * Static data members used to control access to and destruction of
      * singleton data manager instance.
@@ -1193,12 +1313,54 @@ private:
     const std::string d_default_interp_kernel_fcn;
     const std::string d_default_spread_kernel_fcn;
 
+    /*
+     * The types of the default kernel functions, which are looked up once so
+     * that the kernel names need not be parsed on every interaction.
+     */
+    const KernelFunctionType d_default_interp_kernel_fcn_type;
+    const KernelFunctionType d_default_spread_kernel_fcn_type;
+
     /*
      * Whether to emit an error message if IB points "escape" from the computational
      * domain.
      */
     bool d_error_if_points_leave_domain;
 
+    /*
+     * Whether to sort the cached local indices of each patch by cell index.
+     */
+    bool d_sort_local_indices_by_cell = false;
+
+    /*
+     * Whether to assign the local PETSc indices of the nodes on each patch in
+     * cell order.
+     */
+    bool d_sort_local_nodes_by_cell = false;
+
+    /*
+     * Whether the values of the Lagrangian data are written to a shared restart
+     * file.
+     */
+    bool d_use_collective_restart = false;
+
+    /*
+     * Whether to cache the kernel weights used by interp() and spread(), and
+     * the caches, indexed by level number and data centering.
+     */
+    bool d_use_weight_cache = false;
+    std::map<std::pair<int, int>, LEInteractor::WeightCache> d_weight_caches;
+
+    /*
+     * Data used to calibrate d_beta_work from measured timings: the time spent
+     * in the local Lagrangian-Eulerian interaction kernels and the start of the
+     * current measurement interval.
+     */
+    bool d_calibrate_workload = false;
+    double d_workload_relaxation = 0.5;
+    double d_lag_work_time = 0.0;
+    bool d_workload_interval_started = false;
+    std::chrono::steady_clock::time_point d_workload_interval_start;
+
     /*
      * SAMRAI::hier::IntVector object that determines the ghost cell width of
      * the LNodeData SAMRAI::hier::PatchData objects.
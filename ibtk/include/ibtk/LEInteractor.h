@@ -20,12 +20,17 @@
 
 #include <ibtk/config.h>
 
+#include "ibtk/ibtk_enums.h"
+
 #include "Box.h"
 #include "IntVector.h"
 #include "tbox/Pointer.h"
 
 #include <iosfwd>
+#include <map>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 namespace boost
@@ -88,6 +93,25 @@ public:
 
     /*!
      * \brief Set configuration options from a user-supplied database.
+     *
+     * The following keys are read:
+     *
+     * - <code>use_colored_spreading</code>: when IBAMR is compiled with OpenMP
+     *   support, spread with all available threads by partitioning the markers
+     *   on each patch into colored bins whose stencils do not overlap (default
+     *   FALSE). Colored spreading accumulates values in a different order than
+     *   serial spreading, so results are not bitwise reproducible between the
+     *   two. Spreading that is already done inside of a parallel region (e.g.,
+     *   by FEDataManager) is not colored.
+     *
+     * - <code>use_single_precision_weights</code>: store the kernel weights and
+     *   form their tensor products in single precision, while still
+     *   accumulating Eulerian and Lagrangian values in double precision
+     *   (default FALSE). This only affects the kernel functions implemented by
+     *   KernelFunction (see setWeightCache()), which are then evaluated in C++
+     *   instead of Fortran and are not spread with colors. The relative error
+     *   introduced by this approximation is of the order of the single
+     *   precision machine epsilon.
      */
     static void setFromDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
@@ -102,6 +126,12 @@ public:
      */
     static int getStencilSize(const std::string& kernel_fcn);
 
+    /*!
+     * \brief Returns the interpolation/spreading stencil corresponding to the
+     * specified kernel function type.
+     */
+    static int getStencilSize(KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Returns the minimum ghost width size corresponding to the
      * specified kernel function.
@@ -114,6 +144,89 @@ public:
      */
     static int getMinimumGhostWidth(const std::string& kernel_fcn);
 
+    /*!
+     * \brief Returns the minimum ghost width size corresponding to the
+     * specified kernel function type.
+     */
+    static int getMinimumGhostWidth(KernelFunctionType kernel_fcn);
+
+    /*!
+     * \brief Returns the kernel function type corresponding to the specified
+     * kernel function name, or emits an error if the name is not known.
+     *
+     * \note Callers that repeatedly interpolate or spread with the same kernel
+     * should look up the kernel type once and reuse it.
+     */
+    static KernelFunctionType getKernelFunctionType(const std::string& kernel_fcn);
+
+    /*!
+     * \brief Class WeightCache stores the interpolation/spreading stencil and
+     * the kernel weights most recently computed at each Lagrangian point so
+     * that subsequent interpolation and spreading operations at the same
+     * positions can reuse them.
+     *
+     * The cached stencils are indexed by the local PETSc index of each point.
+     * Each stencil is validated against the position at which it was computed
+     * before it is reused, so the cache does not need to be reset when the
+     * points move. The cache must be cleared whenever the local indexing of the
+     * points changes, e.g., when Lagrangian data are redistributed. Because
+     * stencils are stored in terms of global cell indices, a cache may be
+     * shared by all patches of a single patch level but not by different
+     * levels or by data with different centerings.
+     */
+    class WeightCache
+    {
+    public:
+        /*!
+         * \brief The cached stencils for a particular kernel function and data
+         * axis. For the point with local index s, X stores the (periodically
+         * shifted) position at which the stencil was computed, lower stores
+         * the lower cell index of the stencil in each direction, and weights
+         * stores the one-dimensional kernel weights in each direction (in
+         * single_weights instead when the weights are stored in single
+         * precision).
+         */
+        struct Stencils
+        {
+            std::vector<double> X;
+            std::vector<int> lower;
+            std::vector<double> weights;
+            std::vector<float> single_weights;
+        };
+
+        /*!
+         * \brief Remove all cached stencils.
+         */
+        void clear();
+
+        /*!
+         * \brief Get the cached stencils for the specified kernel function,
+         * data axis, and precision of the weights, with room for at least
+         * num_points points of a kernel with the specified support (see
+         * KernelFunction::support).
+         */
+        Stencils& getStencils(KernelFunctionType kernel_fcn,
+                              int axis,
+                              int num_points,
+                              int support,
+                              bool single_precision = false);
+
+    private:
+        std::map<std::tuple<int, int, bool>, Stencils> d_stencils;
+    };
+
+    /*!
+     * \brief Set the cache used to store and reuse kernel weights, or nullptr
+     * (the default) to compute the weights every time.
+     *
+     * Weights are only cached for the kernel functions that are implemented by
+     * KernelFunction, i.e., PIECEWISE_LINEAR, PIECEWISE_CUBIC, IB_3, IB_4, IB_5,
+     * and BSPLINE_3 through BSPLINE_6. While a cache is set, these kernel
+     * functions are evaluated in C++ instead of Fortran and spreading is not
+     * colored.
+     */
+    static void setWeightCache(WeightCache* weight_cache);
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -139,6 +252,19 @@ public:
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    template <class T>
+    static void interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
+                            SAMRAI::tbox::Pointer<LData> X_data,
+                            SAMRAI::tbox::Pointer<LIndexSetData<T> > idx_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                            KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -164,6 +290,19 @@ public:
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    template <class T>
+    static void interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
+                            SAMRAI::tbox::Pointer<LData> X_data,
+                            SAMRAI::tbox::Pointer<LIndexSetData<T> > idx_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                            KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -189,6 +328,19 @@ public:
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    template <class T>
+    static void interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
+                            SAMRAI::tbox::Pointer<LData> X_data,
+                            SAMRAI::tbox::Pointer<LIndexSetData<T> > idx_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                            KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -214,6 +366,19 @@ public:
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    template <class T>
+    static void interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
+                            SAMRAI::tbox::Pointer<LData> X_data,
+                            SAMRAI::tbox::Pointer<LIndexSetData<T> > idx_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                            KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -241,6 +406,21 @@ public:
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    template <class T>
+    static void interpolate(double* Q_data,
+                            int Q_depth,
+                            const double* X_data,
+                            int X_depth,
+                            SAMRAI::tbox::Pointer<LIndexSetData<T> > idx_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                            KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -268,6 +448,21 @@ public:
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    template <class T>
+    static void interpolate(double* Q_data,
+                            int Q_depth,
+                            const double* X_data,
+                            int X_depth,
+                            SAMRAI::tbox::Pointer<LIndexSetData<T> > idx_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                            KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -295,6 +490,21 @@ public:
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    template <class T>
+    static void interpolate(double* Q_data,
+                            int Q_depth,
+                            const double* X_data,
+                            int X_depth,
+                            SAMRAI::tbox::Pointer<LIndexSetData<T> > idx_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                            KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -322,6 +532,21 @@ public:
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    template <class T>
+    static void interpolate(double* Q_data,
+                            int Q_depth,
+                            const double* X_data,
+                            int X_depth,
+                            SAMRAI::tbox::Pointer<LIndexSetData<T> > idx_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                            KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -345,6 +570,18 @@ public:
                             SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                             const SAMRAI::hier::Box<NDIM>& interp_box,
                             const std::string& interp_fcn = "IB_4");
+
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void interpolate(std::vector<double>& Q_data,
+                            int Q_depth,
+                            const std::vector<double>& X_data,
+                            int X_depth,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            KernelFunctionType kernel_fcn);
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -370,6 +607,19 @@ public:
                             const SAMRAI::hier::Box<NDIM>& interp_box,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void interpolate(std::vector<double>& Q_data,
+                            int Q_depth,
+                            const std::vector<double>& X_data,
+                            int X_depth,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > mask_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -394,6 +644,18 @@ public:
                             const SAMRAI::hier::Box<NDIM>& interp_box,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void interpolate(std::vector<double>& Q_data,
+                            int Q_depth,
+                            const std::vector<double>& X_data,
+                            int X_depth,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -418,6 +680,18 @@ public:
                             const SAMRAI::hier::Box<NDIM>& interp_box,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void interpolate(std::vector<double>& Q_data,
+                            int Q_depth,
+                            const std::vector<double>& X_data,
+                            int X_depth,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -443,6 +717,19 @@ public:
                             const SAMRAI::hier::Box<NDIM>& interp_box,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void interpolate(std::vector<double>& Q_data,
+                            int Q_depth,
+                            const std::vector<double>& X_data,
+                            int X_depth,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > mask_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -467,6 +754,18 @@ public:
                             const SAMRAI::hier::Box<NDIM>& interp_box,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void interpolate(std::vector<double>& Q_data,
+                            int Q_depth,
+                            const std::vector<double>& X_data,
+                            int X_depth,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -493,6 +792,20 @@ public:
                             const SAMRAI::hier::Box<NDIM>& interp_box,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void interpolate(double* Q_data,
+                            int Q_size,
+                            int Q_depth,
+                            const double* X_data,
+                            int X_size,
+                            int X_depth,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -520,6 +833,21 @@ public:
                             const SAMRAI::hier::Box<NDIM>& interp_box,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void interpolate(double* Q_data,
+                            int Q_size,
+                            int Q_depth,
+                            const double* X_data,
+                            int X_size,
+                            int X_depth,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > mask_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -546,6 +874,20 @@ public:
                             const SAMRAI::hier::Box<NDIM>& interp_box,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void interpolate(double* Q_data,
+                            int Q_size,
+                            int Q_depth,
+                            const double* X_data,
+                            int X_size,
+                            int X_depth,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -572,6 +914,20 @@ public:
                             const SAMRAI::hier::Box<NDIM>& interp_box,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void interpolate(double* Q_data,
+                            int Q_size,
+                            int Q_depth,
+                            const double* X_data,
+                            int X_size,
+                            int X_depth,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -599,6 +955,21 @@ public:
                             const SAMRAI::hier::Box<NDIM>& interp_box,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void interpolate(double* Q_data,
+                            int Q_size,
+                            int Q_depth,
+                            const double* X_data,
+                            int X_size,
+                            int X_depth,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > mask_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -625,6 +996,20 @@ public:
                             const SAMRAI::hier::Box<NDIM>& interp_box,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void interpolate(double* Q_data,
+                            int Q_size,
+                            int Q_depth,
+                            const double* X_data,
+                            int X_size,
+                            int X_depth,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -653,6 +1038,19 @@ public:
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    template <class T>
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                       SAMRAI::tbox::Pointer<LData> Q_data,
+                       SAMRAI::tbox::Pointer<LData> X_data,
+                       SAMRAI::tbox::Pointer<LIndexSetData<T> > idx_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                       KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -681,6 +1079,19 @@ public:
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    template <class T>
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
+                       SAMRAI::tbox::Pointer<LData> Q_data,
+                       SAMRAI::tbox::Pointer<LData> X_data,
+                       SAMRAI::tbox::Pointer<LIndexSetData<T> > idx_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                       KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -709,6 +1120,19 @@ public:
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    template <class T>
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                       SAMRAI::tbox::Pointer<LData> Q_data,
+                       SAMRAI::tbox::Pointer<LData> X_data,
+                       SAMRAI::tbox::Pointer<LIndexSetData<T> > idx_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                       KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -737,6 +1161,19 @@ public:
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    template <class T>
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
+                       SAMRAI::tbox::Pointer<LData> Q_data,
+                       SAMRAI::tbox::Pointer<LData> X_data,
+                       SAMRAI::tbox::Pointer<LIndexSetData<T> > idx_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                       KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -767,6 +1204,21 @@ public:
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    template <class T>
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                       const double* Q_data,
+                       int Q_depth,
+                       const double* X_data,
+                       int X_depth,
+                       SAMRAI::tbox::Pointer<LIndexSetData<T> > idx_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                       KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -797,6 +1249,21 @@ public:
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    template <class T>
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
+                       const double* Q_data,
+                       int Q_depth,
+                       const double* X_data,
+                       int X_depth,
+                       SAMRAI::tbox::Pointer<LIndexSetData<T> > idx_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                       KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -827,6 +1294,21 @@ public:
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    template <class T>
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                       const double* Q_data,
+                       int Q_depth,
+                       const double* X_data,
+                       int X_depth,
+                       SAMRAI::tbox::Pointer<LIndexSetData<T> > idx_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                       KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -857,6 +1339,21 @@ public:
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    template <class T>
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
+                       const double* Q_data,
+                       int Q_depth,
+                       const double* X_data,
+                       int X_depth,
+                       SAMRAI::tbox::Pointer<LIndexSetData<T> > idx_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                       KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -884,6 +1381,18 @@ public:
                        const SAMRAI::hier::Box<NDIM>& spread_box,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                       const std::vector<double>& Q_data,
+                       int Q_depth,
+                       const std::vector<double>& X_data,
+                       int X_depth,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -912,6 +1421,19 @@ public:
                        const SAMRAI::hier::Box<NDIM>& spread_box,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > mask_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                       const std::vector<double>& Q_data,
+                       int Q_depth,
+                       const std::vector<double>& X_data,
+                       int X_depth,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -939,6 +1461,18 @@ public:
                        const SAMRAI::hier::Box<NDIM>& spread_box,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
+                       const std::vector<double>& Q_data,
+                       int Q_depth,
+                       const std::vector<double>& X_data,
+                       int X_depth,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -966,6 +1500,18 @@ public:
                        const SAMRAI::hier::Box<NDIM>& spread_box,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                       const std::vector<double>& Q_data,
+                       int Q_depth,
+                       const std::vector<double>& X_data,
+                       int X_depth,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -994,6 +1540,19 @@ public:
                        const SAMRAI::hier::Box<NDIM>& spread_box,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > mask_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                       const std::vector<double>& Q_data,
+                       int Q_depth,
+                       const std::vector<double>& X_data,
+                       int X_depth,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -1021,6 +1580,18 @@ public:
                        const SAMRAI::hier::Box<NDIM>& spread_box,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
+                       const std::vector<double>& Q_data,
+                       int Q_depth,
+                       const std::vector<double>& X_data,
+                       int X_depth,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -1050,6 +1621,20 @@ public:
                        const SAMRAI::hier::Box<NDIM>& spread_box,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                       const double* Q_data,
+                       int Q_size,
+                       int Q_depth,
+                       const double* X_data,
+                       int X_size,
+                       int X_depth,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -1080,6 +1665,21 @@ public:
                        const SAMRAI::hier::Box<NDIM>& spread_box,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > mask_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                       const double* Q_data,
+                       int Q_size,
+                       int Q_depth,
+                       const double* X_data,
+                       int X_size,
+                       int X_depth,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -1109,6 +1709,20 @@ public:
                        const SAMRAI::hier::Box<NDIM>& spread_box,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
+                       const double* Q_data,
+                       int Q_size,
+                       int Q_depth,
+                       const double* X_data,
+                       int X_size,
+                       int X_depth,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -1138,6 +1752,20 @@ public:
                        const SAMRAI::hier::Box<NDIM>& spread_box,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                       const double* Q_data,
+                       int Q_size,
+                       int Q_depth,
+                       const double* X_data,
+                       int X_size,
+                       int X_depth,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -1168,6 +1796,21 @@ public:
                        const SAMRAI::hier::Box<NDIM>& spread_box,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > mask_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                       const double* Q_data,
+                       int Q_size,
+                       int Q_depth,
+                       const double* X_data,
+                       int X_size,
+                       int X_depth,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       KernelFunctionType kernel_fcn);
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -1197,6 +1840,20 @@ public:
                        const SAMRAI::hier::Box<NDIM>& spread_box,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Same as above, but with the kernel function specified by its type.
+     */
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
+                       const double* Q_data,
+                       int Q_size,
+                       int Q_depth,
+                       const double* X_data,
+                       int X_size,
+                       int X_depth,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       KernelFunctionType kernel_fcn);
+
 private:
     /*!
      * \brief Default constructor.
@@ -1232,6 +1889,22 @@ private:
      */
     LEInteractor& operator=(const LEInteractor& that) = delete;
 
+    /*!
+     * Whether or not to spread concurrently within each patch when OpenMP is
+     * available. Disabled by default.
+     */
+    static bool s_use_colored_spreading;
+
+    /*!
+     * Whether to store the kernel weights in single precision.
+     */
+    static bool s_use_single_precision_weights;
+
+    /*!
+     * The cache used to store and reuse kernel weights, if any.
+     */
+    static WeightCache* s_weight_cache;
+
     /*!
      * Implementation of the IB interpolation operation.
      */
@@ -1249,7 +1922,7 @@ private:
                             const std::array<int, NDIM>& patch_touches_upper_physical_bdry,
                             const std::vector<int>& local_indices,
                             const std::vector<double>& periodic_shifts,
-                            const std::string& interp_fcn,
+                            KernelFunctionType kernel_fcn,
                             int axis = 0);
 
     /*!
@@ -1269,7 +1942,7 @@ private:
                        const std::array<int, NDIM>& patch_touches_upper_physical_bdry,
                        const std::vector<int>& local_indices,
                        const std::vector<double>& periodic_shifts,
-                       const std::string& spread_fcn,
+                       KernelFunctionType kernel_fcn,
                        int axis = 0);
 
     /*!
@@ -1284,6 +1957,25 @@ private:
                                   const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                                   SAMRAI::tbox::Pointer<LIndexSetData<T> > idx_data);
 
+    /*!
+     * \brief Return the local PETSc indices located within the provided box
+     * and their periodic shifts.
+     *
+     * When the box is the patch box or the ghost box of idx_data, the lists
+     * of active nodes cached by LIndexSetData are returned without copying
+     * them, so that the nodes of inactivated structures are skipped.
+     * Otherwise, the lists are computed by buildLocalIndices() and stored in
+     * the provided buffers.
+     */
+    template <class T>
+    static std::pair<const std::vector<int>*, const std::vector<double>*>
+    getLocalIndices(std::vector<int>& local_indices_buf,
+                    std::vector<double>& periodic_shifts_buf,
+                    const SAMRAI::hier::Box<NDIM>& box,
+                    SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                    const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                    SAMRAI::tbox::Pointer<LIndexSetData<T> > idx_data);
+
     /*!
      * \brief Compute the local PETSc indices located within the provided box
      * based on the positions of the Lagrangian mesh nodes.
@@ -26,6 +26,7 @@
 #include "IntVector.h"
 #include "tbox/Pointer.h"
 
+#include <utility>
 #include <vector>
 
 namespace SAMRAI
@@ -67,9 +68,16 @@ public:
 
     /*!
      * \brief Update the cached indexing data.
+     *
+     * If \a sort_by_cell_index is true, the cached indices are ordered along a
+     * Z-order (Morton) curve through the cells of the patch rather than in
+     * storage order, which improves the cache locality of spreading and
+     * interpolation.  The ordering is retained until the next call to this
+     * function.
      */
     void cacheLocalIndices(SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift);
+                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                           bool sort_by_cell_index = false);
 
     /*!
      * \return A constant reference to the set of Lagrangian data indices that
@@ -143,6 +151,41 @@ public:
      */
     const std::vector<double>& getGhostPeriodicShifts() const;
 
+    /*!
+     * \brief Exclude the nodes whose Lagrangian indices lie in one of the
+     * half-open ranges [first, second) in \a inactive_lag_idx_ranges from the
+     * lists of active indices, e.g., the nodes of inactivated structures.
+     *
+     * \note The lists of active indices are reset to the full lists by
+     * cacheLocalIndices(), so this function must be called after each call to
+     * that function.
+     */
+    void setInactiveLagrangianIndexRanges(const std::vector<std::pair<int, int> >& inactive_lag_idx_ranges);
+
+    /*!
+     * \return A constant reference to the set of local PETSc data indices of
+     * the active nodes that lie in the patch (including the ghost cell region).
+     */
+    const std::vector<int>& getActiveLocalPETScIndices() const;
+
+    /*!
+     * \return A constant reference to the set of local PETSc data indices of
+     * the active nodes that lie in the patch interior.
+     */
+    const std::vector<int>& getInteriorActiveLocalPETScIndices() const;
+
+    /*!
+     * \return A constant reference to the periodic shifts for the indices of
+     * the active nodes that lie in the patch (including the ghost cell region).
+     */
+    const std::vector<double>& getActivePeriodicShifts() const;
+
+    /*!
+     * \return A constant reference to the periodic shifts for the indices of
+     * the active nodes that lie in the patch interior.
+     */
+    const std::vector<double>& getInteriorActivePeriodicShifts() const;
+
 private:
     /*!
      * \brief Default constructor.
@@ -175,6 +218,14 @@ private:
     std::vector<int> d_global_petsc_indices, d_interior_global_petsc_indices, d_ghost_global_petsc_indices;
     std::vector<int> d_local_petsc_indices, d_interior_local_petsc_indices, d_ghost_local_petsc_indices;
     std::vector<double> d_periodic_shifts, d_interior_periodic_shifts, d_ghost_periodic_shifts;
+
+    /*
+     * Whether some nodes are inactive, and the indices of the active nodes in
+     * that case.
+     */
+    bool d_has_inactive_indices = false;
+    std::vector<int> d_active_local_petsc_indices, d_interior_active_local_petsc_indices;
+    std::vector<double> d_active_periodic_shifts, d_interior_active_periodic_shifts;
 };
 } // namespace IBTK
 
@@ -185,29 +185,31 @@ private:
      */
     static unsigned int countMarkersOnPatch(SAMRAI::tbox::Pointer<LMarkerSetData> mark_data);
 
+    /*!
+     * Collect pointers to the markers in the interior of a patch into a single
+     * vector.
+     */
+    static void collectMarkersOnPatch(std::vector<LMarker*>& marks, SAMRAI::tbox::Pointer<LMarkerSetData> mark_data);
+
     /*!
      * Collect marker positions into a single vector.
      */
-    static void collectMarkerPositionsOnPatch(std::vector<double>& X_mark,
-                                              SAMRAI::tbox::Pointer<LMarkerSetData> mark_data);
+    static void collectMarkerPositionsOnPatch(std::vector<double>& X_mark, const std::vector<LMarker*>& marks);
 
     /*!
      * Reset marker positions from a single vector.
      */
-    static void resetMarkerPositionsOnPatch(const std::vector<double>& X_mark,
-                                            SAMRAI::tbox::Pointer<LMarkerSetData> mark_data);
+    static void resetMarkerPositionsOnPatch(const std::vector<double>& X_mark, const std::vector<LMarker*>& marks);
 
     /*!
      * Collect marker velocities into a single vector.
      */
-    static void collectMarkerVelocitiesOnPatch(std::vector<double>& U_mark,
-                                               SAMRAI::tbox::Pointer<LMarkerSetData> mark_data);
+    static void collectMarkerVelocitiesOnPatch(std::vector<double>& U_mark, const std::vector<LMarker*>& marks);
 
     /*!
      * Reset marker velocities from a single vector.
      */
-    static void resetMarkerVelocitiesOnPatch(const std::vector<double>& U_mark,
-                                             SAMRAI::tbox::Pointer<LMarkerSetData> mark_data);
+    static void resetMarkerVelocitiesOnPatch(const std::vector<double>& U_mark, const std::vector<LMarker*>& marks);
 
     /*!
      * Prevent markers from leaving the computational domain through physical
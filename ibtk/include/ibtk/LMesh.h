@@ -22,6 +22,8 @@
 
 #include "tbox/DescribedClass.h"
 
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -60,6 +62,29 @@ public:
      */
     const std::vector<LNode*>& getGhostNodes() const;
 
+    /*!
+     * \brief Return a const reference to the column of node data items of
+     * type T associated with the local LNode objects.
+     *
+     * Entry k of the returned vector is the (possibly null) item of type T
+     * associated with the local node getLocalNodes()[k]. The column is built
+     * the first time it is requested and is valid for the lifetime of this
+     * object (i.e., until the Lagrangian data are redistributed), so loops
+     * over all local nodes can read a single contiguous array instead of
+     * querying each node individually.
+     */
+    template <class T>
+    const std::vector<T*>& getLocalNodeDataColumn() const;
+
+    /*!
+     * \brief Return a const reference to the column of node data items of
+     * type T associated with the local ghost LNode objects.
+     *
+     * \see getLocalNodeDataColumn()
+     */
+    template <class T>
+    const std::vector<T*>& getGhostNodeDataColumn() const;
+
 private:
     /*!
      * \brief Copy constructor.
@@ -81,9 +106,36 @@ private:
      */
     LMesh& operator=(const LMesh& that) = delete;
 
+    /*!
+     * \brief Base class for the type-erased storage of node data columns.
+     */
+    struct NodeDataColumnsBase
+    {
+        virtual ~NodeDataColumnsBase() = default;
+    };
+
+    /*!
+     * \brief Local and ghost node data columns for items of type T.
+     */
+    template <class T>
+    struct NodeDataColumns : public NodeDataColumnsBase
+    {
+        std::vector<T*> local, ghost;
+    };
+
+    /*!
+     * \brief Get (and, if necessary, build) the node data columns for items
+     * of type T.
+     */
+    template <class T>
+    const NodeDataColumns<T>& getNodeDataColumns() const;
+
     const std::string& d_object_name;
     const std::vector<LNode*> d_local_nodes;
     const std::vector<LNode*> d_ghost_nodes;
+
+    // node data columns, indexed by the streamable class ID of the item type
+    mutable std::map<int, std::unique_ptr<NodeDataColumnsBase> > d_node_data_columns;
 };
 
 } // namespace IBTK
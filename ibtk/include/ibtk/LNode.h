@@ -21,6 +21,7 @@
 #include <ibtk/config.h>
 
 #include "ibtk/LNodeIndex.h"
+#include "ibtk/ObjectPool.h"
 #include "ibtk/Streamable.h"
 #include "ibtk/ibtk_utilities.h"
 
@@ -53,7 +54,7 @@ namespace IBTK
  * HREF="http://www.mcs.anl.gov/petsc">PETSc</A> indexing information and data
  * storage for a single node of a Lagrangian mesh.
  */
-class LNode : public LNodeIndex
+class LNode : public LNodeIndex, public ObjectPoolAllocated<LNode>
 {
 public:
     /*!
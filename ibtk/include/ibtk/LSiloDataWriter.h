@@ -31,6 +31,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -57,6 +58,20 @@ namespace IBTK
  *
  * For more information about Silo, see the Silo manual <A
  * HREF="http://www.llnl.gov/bdiv/meshtv/manuals/silo.pdf">here</A>.
+ *
+ * By default, writePlotData() returns once all plot files have been written.
+ * If asynchronous output is enabled via setUseAsynchronousOutput(), the data
+ * are instead communicated and copied into buffers owned by the writer, and
+ * the files are written by a separate thread while the computation continues.
+ * The next call to writePlotData(), or to any function that modifies the
+ * registered data, waits for the previous files to be completed.
+ *
+ * The local plot files may also be compressed by Silo; see setCompression().
+ * The coordinates and variable data are always written in single precision.
+ *
+ * \note The Silo library is not thread safe. When asynchronous output is
+ * enabled, no other Silo output (e.g., from another LSiloDataWriter object)
+ * should be written while the plot files are being written.
  */
 class LSiloDataWriter : public SAMRAI::tbox::Serializable
 {
@@ -183,11 +198,37 @@ public:
      */
     void registerLagrangianAO(std::vector<AO>& ao, int coarsest_ln, int finest_ln);
 
+    /*!
+     * \brief Set whether the plot files are written by a separate thread.
+     */
+    void setUseAsynchronousOutput(bool use_asynchronous_output);
+
+    /*!
+     * \brief Set the Silo compression options used for the local plot files.
+     *
+     * The options string is passed to DBSetCompression(). For example,
+     * <code>"METHOD=GZIP LEVEL=6"</code> selects lossless compression and
+     * <code>"METHOD=FPZIP LOSS=8"</code> selects lossy compression of the
+     * floating point data that discards 8 bits of each value. An empty string
+     * (the default) disables compression.
+     *
+     * \note Silo only supports compression on files written with its HDF5
+     * driver, so the local plot files are written in HDF5 format when
+     * compression is enabled. The summary files are not compressed.
+     */
+    void setCompression(const std::string& compression);
+
     /*!
      * \brief Write the plot data to disk.
      */
     void writePlotData(int time_step_number, double simulation_time);
 
+    /*!
+     * \brief Wait for the plot files started by the last call to
+     * writePlotData() to be written.
+     */
+    void waitForPlotData();
+
     /*!
      * Write out object state to the given database.
      *
@@ -230,6 +271,19 @@ private:
      */
     void buildVecScatters(AO& ao, int level_number);
 
+    /*!
+     * \brief The data required to write the plot files for one time step.
+     */
+    struct PlotData;
+
+    /*!
+     * \brief Write the local plot file and, on the root MPI process, the
+     * summary files.
+     *
+     * \note This function does not perform any communication.
+     */
+    void writePlotFiles(const PlotData& data);
+
     /*!
      * Read object state from the restart file and initialize class data
      * members.  The database from which the restart data is read is determined
@@ -321,6 +375,18 @@ private:
     std::vector<bool> d_build_vec_scatters;
     std::vector<std::map<int, Vec> > d_src_vec, d_dst_vec;
     std::vector<std::map<int, VecScatter> > d_vec_scatter;
+
+    /*
+     * The thread that writes the plot files when asynchronous output is
+     * enabled.
+     */
+    bool d_use_asynchronous_output = false;
+    std::thread d_plot_data_thread;
+
+    /*
+     * Silo compression options for the local plot files.
+     */
+    std::string d_compression;
 };
 } // namespace IBTK
 
@@ -93,12 +93,30 @@ public:
      */
     virtual const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& getPhysicalBcCoefs() const;
 
+    /*!
+     * \brief Set whether the communication of ghost cell values may be
+     * overlapped with the computation of the action of the operator at indices
+     * whose stencils do not include ghost cells, when the implementation
+     * supports this.
+     *
+     * When enabled, ghost cell values are filled by persistent communication
+     * schedules (see HierarchyGhostCellInterpolation::setUsePersistentSchedules())
+     * instead of SAMRAI refine schedules.
+     *
+     * \note This setting takes effect the next time that the operator state is
+     * initialized.  Disabled by default.
+     */
+    virtual void setOverlapGhostCellFill(bool overlap_ghost_cell_fill);
+
 protected:
     // Problem specification.
     SAMRAI::solv::PoissonSpecifications d_poisson_spec;
     std::unique_ptr<SAMRAI::solv::RobinBcCoefStrategy<NDIM> > d_default_bc_coef;
     std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> d_bc_coefs;
 
+    // Whether ghost cell filling may be overlapped with computation.
+    bool d_overlap_ghost_cell_fill = false;
+
 private:
     /*!
      * \brief Default constructor.
@@ -0,0 +1,129 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_LevelArena
+#define included_IBTK_LevelArena
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "PatchLevel.h"
+#include "tbox/Arena.h"
+
+#include <cstddef>
+#include <set>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class LevelArena is a SAMRAI::tbox::Arena that places the patch data
+ * of one patch data index on all local patches of a level in a single
+ * contiguous block of memory.
+ *
+ * By default, SAMRAI allocates the data of each patch separately, so the data
+ * of a level are scattered through memory. A LevelArena instead reserves, when
+ * it is constructed, one block that is large enough to hold the data of every
+ * local patch of the level (as reported by the patch data factory) and hands
+ * out consecutive pieces of it, each aligned to ALIGNMENT bytes. The arena is
+ * meant to be passed to SAMRAI::hier::PatchLevel::allocatePatchData() for the
+ * same level and patch data index with which it was constructed:
+ * \code
+ * Pointer<LevelArena> arena = new LevelArena(*level, data_idx);
+ * level->allocatePatchData(data_idx, data_time, arena);
+ * \endcode
+ * The patch data keep the arena alive; the block is returned to the system
+ * when the patch data are deallocated.
+ *
+ * When IBAMR is built with OpenMP, the part of the block that holds the data of
+ * each patch is first touched (i.e., zeroed) by one of the threads that will
+ * process the patches, so that on NUMA systems the pages are spread over the
+ * memory of the sockets on which the threads run instead of all being placed
+ * on the socket of the master thread.
+ *
+ * \note Requests that do not fit in the block (e.g., because the patch data
+ * allocate more than the factory reports) are allocated individually, so
+ * using a LevelArena never changes the results of a computation.
+ */
+class LevelArena : public SAMRAI::tbox::Arena
+{
+public:
+    /*!
+     * \brief The alignment, in bytes, of each piece of memory handed out by the
+     * arena.
+     */
+    static const std::size_t ALIGNMENT = 64;
+
+    /*!
+     * \brief Constructor. Reserves (and first touches) the memory needed to
+     * allocate the patch data of index \p data_idx on all local patches of \p
+     * level.
+     */
+    LevelArena(const SAMRAI::hier::PatchLevel<NDIM>& level, int data_idx);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~LevelArena();
+
+    /*!
+     * \brief Default constructor. This function is not implemented and should not be used.
+     */
+    LevelArena() = delete;
+
+    /*!
+     * \brief Copy constructor. This function is not implemented and should not be used.
+     */
+    LevelArena(const LevelArena& from) = delete;
+
+    /*!
+     * \brief Assignment operator. This function is not implemented and should not be used.
+     */
+    LevelArena& operator=(const LevelArena& that) = delete;
+
+    void* alloc(size_t bytes) override;
+
+    void free(void* p) override;
+
+    /*!
+     * \brief Return the number of bytes reserved in the contiguous block.
+     */
+    std::size_t getBytesReserved() const;
+
+    /*!
+     * \brief Return the number of bytes that did not fit in the contiguous block
+     * and were allocated individually.
+     */
+    std::size_t getBytesOverflowed() const;
+
+private:
+    /// The memory returned by operator new and the aligned start of the block.
+    void* d_memory = nullptr;
+    char* d_block = nullptr;
+
+    /// The size of the block and the offset of its first unused byte.
+    std::size_t d_capacity = 0, d_offset = 0;
+
+    /// Memory that did not fit in the block.
+    std::set<void*> d_overflow_blocks;
+    std::size_t d_bytes_overflowed = 0;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_LevelArena
@@ -29,6 +29,11 @@
 #include <string>
 #include <vector>
 
+namespace IBTK
+{
+class FEVectorPipeline;
+} // namespace IBTK
+
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
 
 namespace IBTK
@@ -133,6 +138,15 @@ public:
      */
     void copy(const std::string& source, const std::vector<std::string>& dests);
 
+    /*!
+     * Same as above, but instead of copying the vectors immediately (which
+     * updates the ghost entries of each output vector one at a time), add
+     * the copies and the subsequent ghost updates of all parts to @p
+     * pipeline. The copies are done when FEVectorPipeline::execute() is
+     * called.
+     */
+    void copy(const std::string& source, const std::vector<std::string>& dests, FEVectorPipeline& pipeline);
+
     /*!
      * Zero vectors owned by a libMesh::System.
      */
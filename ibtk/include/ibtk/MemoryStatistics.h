@@ -0,0 +1,228 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_MemoryStatistics
+#define included_IBTK_MemoryStatistics
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class MemoryStatistics is a singleton class that keeps track of the
+ * current and peak memory used by each subsystem on each process.
+ *
+ * Objects that own large amounts of memory report their current usage via
+ * setUsage() whenever it changes and withdraw it via removeUsage() when they
+ * are destroyed.  The usage of a subsystem is the sum of the usage reported by
+ * all of its objects, and its peak is the largest usage seen by the manager.
+ * The following subsystems are reported:
+ *
+ * - <TT>patch_data</TT>: the SAMRAI patch data of the variables registered with
+ *   each HierarchyIntegrator;
+ * - <TT>samrai_data_cache</TT>: the patch data allocated by SAMRAIDataCache
+ *   objects (including memory kept on the free lists in pooled mode);
+ * - <TT>lagrangian_data</TT>: the PETSc vectors of the LData objects managed by
+ *   LDataManager;
+ * - <TT>fe_data</TT>: the vectors of the libMesh systems and the ghosted
+ *   vectors cached by FEDataManager;
+ * - <TT>level_solver_matrices</TT>: the matrices and vectors set up by
+ *   PETScLevelSolver.
+ *
+ * Since usage is only updated at specific points (e.g., after regridding or
+ * after a solver is initialized), the peaks do not include short-lived
+ * temporary allocations.  The table printed by printStatistics() therefore also
+ * lists the maximum resident set size of the process.
+ *
+ * A table with the minimum, mean, and maximum over all processes of the current
+ * and peak usage of each subsystem is printed to plog after each regrid (if
+ * print_at_regrid is TRUE) and at the end of the run.
+ *
+ * Statistics are not recorded unless they are enabled via setOptions() (which
+ * AppInitializer calls if the input file contains a <TT>MemoryStatistics</TT>
+ * database).
+ *
+ * Sample input:
+ * \verbatim
+ MemoryStatistics {
+    enable          = TRUE     // default is TRUE
+    print_at_regrid = FALSE    // default is TRUE
+ }
+ \endverbatim
+ */
+class MemoryStatistics
+{
+public:
+    /*!
+     * Return a pointer to the instance of the memory statistics manager.
+     * Access to MemoryStatistics objects is mediated by the getManager()
+     * function.
+     *
+     * \return A pointer to the manager instance.
+     */
+    static MemoryStatistics* getManager();
+
+    /*!
+     * Print the statistics (if they are enabled) and deallocate the
+     * MemoryStatistics instance.
+     *
+     * It is not necessary to call this function at program termination since it
+     * is automatically called by the ShutdownRegistry class.
+     *
+     * \note This function is collective when statistics are enabled.
+     */
+    static void freeManager();
+
+    /*!
+     * \brief Return whether statistics are recorded.
+     *
+     * This function does not create the manager instance, so objects can use it
+     * to skip computing their memory usage.
+     */
+    static inline bool enabled()
+    {
+        return s_enabled;
+    } // enabled
+
+    /*!
+     * \brief Set the options from an input database.
+     */
+    void setOptions(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \brief Set the number of bytes currently used by the object owner in a
+     * subsystem.
+     */
+    void setUsage(const std::string& subsystem_name, const void* owner, double num_bytes);
+
+    /*!
+     * \brief Remove the usage of the object owner from a subsystem, e.g., when
+     * the object is destroyed.
+     */
+    void removeUsage(const std::string& subsystem_name, const void* owner);
+
+    /*!
+     * \brief Return the names of the subsystems for which this process has
+     * recorded usage.
+     */
+    std::vector<std::string> getSubsystemNames() const;
+
+    /*!
+     * \brief Return the number of bytes currently used by a subsystem on this
+     * process.
+     */
+    double getCurrentUsage(const std::string& subsystem_name) const;
+
+    /*!
+     * \brief Return the largest number of bytes used by a subsystem on this
+     * process.
+     */
+    double getPeakUsage(const std::string& subsystem_name) const;
+
+    /*!
+     * \brief Return whether printStatistics() should be called after each
+     * regrid.
+     */
+    bool getPrintAtRegrid() const;
+
+    /*!
+     * \brief Print the current and peak usage of each subsystem reduced over all
+     * processes.
+     *
+     * \note This function is collective.
+     */
+    void printStatistics(const std::string& label, std::ostream& os) const;
+
+protected:
+    /*!
+     * \brief Constructor.
+     */
+    MemoryStatistics() = default;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~MemoryStatistics() = default;
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    MemoryStatistics(const MemoryStatistics& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    MemoryStatistics& operator=(const MemoryStatistics& that) = delete;
+
+    /*!
+     * \brief Return the names of the subsystems recorded by any process.
+     *
+     * \note This function is collective.
+     */
+    std::vector<std::string> getGlobalSubsystemNames() const;
+
+    /*!
+     * Static data members used to control access to and destruction of the
+     * manager instance.
+     */
+    static MemoryStatistics* s_memory_statistics_instance;
+    static bool s_registered_callback;
+    static unsigned char s_shutdown_priority;
+    static bool s_enabled;
+
+    /*!
+     * Options.
+     */
+    bool d_print_at_regrid = true;
+
+    /*!
+     * Usage of each subsystem.
+     */
+    struct Usage
+    {
+        std::map<const void*, double> owner_bytes;
+        double current_bytes = 0.0;
+        double peak_bytes = 0.0;
+    };
+    std::map<std::string, Usage> d_usage;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_MemoryStatistics
@@ -20,17 +20,18 @@
 
 #include <ibtk/config.h>
 
+#include "ibtk/PersistentGhostFillSchedule.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "CartesianGridGeometry.h"
 #include "CoarsenAlgorithm.h"
 #include "IntVector.h"
 #include "PatchHierarchy.h"
-#include "RefineAlgorithm.h"
 #include "tbox/DescribedClass.h"
 #include "tbox/Pointer.h"
 
 #include <array>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -40,8 +41,6 @@ namespace xfer
 {
 template <int DIM>
 class CoarsenSchedule;
-template <int DIM>
-class RefineSchedule;
 } // namespace xfer
 } // namespace SAMRAI
 
@@ -202,8 +201,7 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenAlgorithm<NDIM> > d_coarsen_alg;
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > > d_coarsen_scheds;
 
-    std::array<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> >, NDIM> d_refine_alg;
-    std::array<std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >, NDIM> d_refine_scheds;
+    std::array<std::vector<std::unique_ptr<PersistentGhostFillSchedule> >, NDIM> d_synch_scheds;
 };
 } // namespace IBTK
 
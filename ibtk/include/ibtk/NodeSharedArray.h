@@ -0,0 +1,141 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_NodeSharedArray
+#define included_IBTK_NodeSharedArray
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include <mpi.h>
+
+#include <cstddef>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class NodeSharedArray stores an array of read-only data once per
+ * node (i.e., shared memory domain) instead of once per process.
+ *
+ * Data that every process needs in full (e.g., the vertices of all structures
+ * read by an initializer) are usually replicated on every process, so that on
+ * nodes with many processes most of the memory of the node holds identical
+ * copies. A NodeSharedArray is allocated with MPI_Win_allocate_shared() by the
+ * first process of each node (the node root) and is directly accessible by
+ * all other processes of the node. The node root fills in the values, after
+ * which the values are made visible to the other processes by calling
+ * synchronize():
+ * \code
+ * MPI_Comm node_comm = IBTK_MPI::splitByNode();
+ * NodeSharedArray<double> values(n, node_comm);
+ * if (values.isNodeRoot())
+ * {
+ *     for (std::size_t k = 0; k < n; ++k) values[k] = ...;
+ * }
+ * values.synchronize();
+ * \endcode
+ *
+ * \note The entries are not constructed or destroyed, so T should be a type
+ * whose objects can be copied with std::memcpy (e.g., double or IBTK::Point).
+ */
+template <class T>
+class NodeSharedArray
+{
+public:
+    /*!
+     * \brief Constructor. Allocates \p size entries that are shared by the
+     * processes of \p node_communicator, which must only contain processes
+     * that can share memory (see IBTK_MPI::splitByNode()).
+     *
+     * \note This is a collective operation on \p node_communicator.
+     */
+    NodeSharedArray(std::size_t size, MPI_Comm node_communicator);
+
+    /*!
+     * \brief Destructor. Collective on the node communicator.
+     */
+    ~NodeSharedArray();
+
+    /*!
+     * \brief Default constructor. This function is not implemented and should not be used.
+     */
+    NodeSharedArray() = delete;
+
+    /*!
+     * \brief Copy constructor. This function is not implemented and should not be used.
+     */
+    NodeSharedArray(const NodeSharedArray& from) = delete;
+
+    /*!
+     * \brief Assignment operator. This function is not implemented and should not be used.
+     */
+    NodeSharedArray& operator=(const NodeSharedArray& that) = delete;
+
+    /*!
+     * \brief Whether the current process is the node root, i.e., the process
+     * that is expected to set the values of the array.
+     */
+    bool isNodeRoot() const;
+
+    /*!
+     * \brief Make the values set by the node root visible to all processes of
+     * the node. Collective on the node communicator.
+     */
+    void synchronize();
+
+    /*!
+     * \brief Return the number of entries.
+     */
+    std::size_t size() const;
+
+    /*!
+     * \brief Return a pointer to the first entry.
+     */
+    T* data();
+
+    /*!
+     * \brief Return a const pointer to the first entry.
+     */
+    const T* data() const;
+
+    /*!
+     * \brief Return a reference to the entry \p i.
+     */
+    T& operator[](std::size_t i);
+
+    /*!
+     * \brief Return a const reference to the entry \p i.
+     */
+    const T& operator[](std::size_t i) const;
+
+private:
+    MPI_Comm d_node_communicator = MPI_COMM_NULL;
+    MPI_Win d_window = MPI_WIN_NULL;
+    std::size_t d_size;
+    T* d_data = nullptr;
+    bool d_is_node_root = false;
+};
+} // namespace IBTK
+
+/////////////////////////////// INLINE ///////////////////////////////////////
+
+#include "ibtk/private/NodeSharedArray-inl.h" // IWYU pragma: keep
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_NodeSharedArray
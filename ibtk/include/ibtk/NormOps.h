@@ -20,6 +20,11 @@
 
 #include <ibtk/config.h>
 
+#include "PatchHierarchy.h"
+#include "tbox/Pointer.h"
+
+#include <vector>
+
 namespace SAMRAI
 {
 namespace solv
@@ -56,6 +61,50 @@ public:
      */
     static double maxNorm(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>* samrai_vector, bool local_only = false);
 
+    /*!
+     * \brief The discrete norms and the integral of a quantity.
+     */
+    struct Norms
+    {
+        double L1 = 0.0;
+        double L2 = 0.0;
+        double max = 0.0;
+        double integral = 0.0;
+    };
+
+    /*!
+     * \brief Compute the discrete L1, L2, and max-norms and the integral of
+     * each of several cell- or side-centered quantities in a single traversal
+     * of the patch hierarchy and with a single global reduction.
+     *
+     * \param data_idxs Patch data indices of the quantities.
+     *
+     * \param wgt_idxs Patch data indices of the control volumes of the
+     * quantities (e.g., the cell or side weights provided by
+     * HierarchyMathOps), or -1 to use unit weights.  Must either be empty (to
+     * use unit weights for all quantities) or have the same length as \p
+     * data_idxs.
+     *
+     * \param coarsest_ln, finest_ln The range of levels to use. The default
+     * values indicate all levels of the hierarchy.
+     *
+     * \note As for the norm operations of SAMRAI, the max-norm only includes
+     * values with a positive control volume.
+     */
+    static std::vector<Norms> norms(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                    const std::vector<int>& data_idxs,
+                                    const std::vector<int>& wgt_idxs = std::vector<int>(),
+                                    int coarsest_ln = -1,
+                                    int finest_ln = -1,
+                                    bool local_only = false);
+
+    /*!
+     * \brief Compute the discrete L1, L2, and max-norms and the integral of
+     * the SAMRAI vector in a single traversal of the patch hierarchy and with
+     * a single global reduction.
+     */
+    static Norms norms(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>* samrai_vector, bool local_only = false);
+
 protected:
 private:
     /*!
@@ -0,0 +1,172 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_ObjectPool
+#define included_IBTK_ObjectPool
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class ObjectPool manages a free list of fixed-size chunks of memory
+ * that are carved out of large blocks.
+ *
+ * Chunks that are returned to the pool are reused by subsequent allocations
+ * instead of being returned to the system allocator, and the blocks themselves
+ * are never released. This is intended for objects that are created and
+ * destroyed in large numbers, e.g., the Lagrangian nodes and their data items
+ * that are rebuilt every time Lagrangian data are redistributed.
+ *
+ * \note ObjectPool is not thread-safe.
+ */
+class ObjectPool
+{
+public:
+    /*!
+     * \brief Constructor for a pool of chunks that are at least \a chunk_size
+     * bytes large.
+     */
+    ObjectPool(std::size_t chunk_size, std::size_t chunks_per_block = 1024)
+        : d_chunk_size(((chunk_size < sizeof(Chunk) ? sizeof(Chunk) : chunk_size) + ALIGNMENT - 1) / ALIGNMENT *
+                       ALIGNMENT),
+          d_chunks_per_block(chunks_per_block)
+    {
+        // intentionally blank
+    }
+
+    /*!
+     * \brief Destructor.
+     */
+    ~ObjectPool()
+    {
+        for (char* block : d_blocks) ::operator delete(block);
+    }
+
+    /*!
+     * \brief Get a chunk of memory from the pool.
+     */
+    void* allocate()
+    {
+        if (!d_free_list) allocateBlock();
+        Chunk* const chunk = d_free_list;
+        d_free_list = chunk->next;
+        return chunk;
+    }
+
+    /*!
+     * \brief Return a chunk of memory to the pool.
+     */
+    void deallocate(void* ptr)
+    {
+        if (!ptr) return;
+        Chunk* const chunk = static_cast<Chunk*>(ptr);
+        chunk->next = d_free_list;
+        d_free_list = chunk;
+    }
+
+    /*!
+     * \brief Return the size, in bytes, of the chunks managed by the pool.
+     */
+    std::size_t getChunkSize() const
+    {
+        return d_chunk_size;
+    }
+
+private:
+    struct Chunk
+    {
+        Chunk* next;
+    };
+
+    static constexpr std::size_t ALIGNMENT = alignof(std::max_align_t);
+
+    ObjectPool(const ObjectPool& from) = delete;
+
+    ObjectPool& operator=(const ObjectPool& that) = delete;
+
+    void allocateBlock()
+    {
+        char* const block = static_cast<char*>(::operator new(d_chunk_size * d_chunks_per_block));
+        d_blocks.push_back(block);
+        for (std::size_t k = d_chunks_per_block; k > 0; --k)
+        {
+            deallocate(block + (k - 1) * d_chunk_size);
+        }
+    }
+
+    const std::size_t d_chunk_size;
+    const std::size_t d_chunks_per_block;
+    std::vector<char*> d_blocks;
+    Chunk* d_free_list = nullptr;
+};
+
+/*!
+ * \brief Class ObjectPoolAllocated is a mixin class that provides class-level
+ * operator new and operator delete that allocate objects of type T from an
+ * ObjectPool.
+ *
+ * Allocations whose size does not match sizeof(T) (e.g., objects of classes
+ * derived from T that do not provide their own allocation functions) and
+ * array allocations are forwarded to the global allocation functions.
+ */
+template <class T>
+class ObjectPoolAllocated
+{
+public:
+    static void* operator new(std::size_t size)
+    {
+        if (size != sizeof(T)) return ::operator new(size);
+        return getPool().allocate();
+    }
+
+    static void operator delete(void* ptr, std::size_t size)
+    {
+        if (size != sizeof(T))
+        {
+            ::operator delete(ptr);
+            return;
+        }
+        getPool().deallocate(ptr);
+    }
+
+protected:
+    ObjectPoolAllocated() = default;
+
+    ~ObjectPoolAllocated() = default;
+
+private:
+    static ObjectPool& getPool()
+    {
+        // The pool is intentionally never destroyed so that objects may be
+        // safely deleted during static destruction.
+        static ObjectPool* const pool = new ObjectPool(sizeof(T));
+        return *pool;
+    }
+};
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_ObjectPool
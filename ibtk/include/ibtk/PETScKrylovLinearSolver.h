@@ -98,6 +98,7 @@ namespace IBTK
  abs_residual_tol = 1.0e-50    // see setAbsoluteTolerance()
  max_iterations = 10000        // see setMaxIterations()
  enable_logging = FALSE        // see setLoggingEnabled()
+ num_fischer_vectors = 0       // see setNumberOfFischerGuessVectors()
  \endverbatim
  *
  * PETSc is developed in the Mathematics and Computer Science (MCS) Division at
@@ -393,6 +394,10 @@ private:
 
     Vec d_petsc_x = nullptr, d_petsc_b = nullptr;
 
+    // Scratch vector used to compute the residual of the initial guess when it
+    // is corrected using previous solutions.
+    SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_fischer_r;
+
     std::string d_options_prefix;
 
     MPI_Comm d_petsc_comm;
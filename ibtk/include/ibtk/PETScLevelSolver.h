@@ -68,8 +68,27 @@ namespace IBTK
  abs_residual_tol = 1.0e-50    // see setAbsoluteTolerance()
  max_iterations = 10000        // see setMaxIterations()
  enable_logging = FALSE        // see setLoggingEnabled()
+ min_dofs_per_process = 0      // see below
  \endverbatim
  *
+ * When \c min_dofs_per_process is positive and the level has fewer than that
+ * many degrees of freedom per MPI process, the preconditioner is applied on a
+ * subset of the processes (via PETSc's PCTELESCOPE) so that each active process
+ * owns at least roughly that many degrees of freedom. The preconditioner that
+ * was requested via \c pc_type is used on the reduced communicator. This is
+ * typically useful for coarse level solves, which otherwise are dominated by
+ * communication when run on many processes. The solver on the reduced
+ * communicator can be configured with PETSc options that combine the solver's
+ * options prefix with \c telescope_, e.g., \c telescope_pc_type.
+ *
+ * Agglomeration is not supported with the \c "asm", \c "fieldsplit", and \c
+ * "shell" preconditioners, whose subdomains are tied to the processes that own
+ * the patch data, and \c min_dofs_per_process is ignored for them. In
+ * particular, it has no effect with the shell-based additive and
+ * multiplicative Schwarz preconditioners that are typically used for coarse
+ * level solves, or with the default \c "fieldsplit" preconditioner of
+ * StaggeredStokesPETScLevelSolver.
+ *
  * PETSc is developed at the Argonne National Laboratory Mathematics and
  * Computer Science Division.  For more information about \em PETSc, see <A
  * HREF="http://www.mcs.anl.gov/petsc">http://www.mcs.anl.gov/petsc</A>.
@@ -327,6 +346,18 @@ protected:
     std::vector<IS> d_field_is;
     //\}
 
+    /*!
+     * \brief The minimum number of degrees of freedom per process below which
+     * the preconditioner is agglomerated onto fewer processes.
+     */
+    int d_min_dofs_per_process = 0;
+
+    /*!
+     * \brief The name of the PETSc option that was added to select the inner
+     * preconditioner of PCTELESCOPE, or an empty string if no option was added.
+     */
+    std::string d_telescope_pc_type_option;
+
 private:
     /*!
      * \brief Copy constructor.
@@ -348,6 +379,18 @@ private:
      */
     PETScLevelSolver& operator=(const PETScLevelSolver& that) = delete;
 
+    /*!
+     * \brief Determine the factor by which the number of processes used by the
+     * preconditioner is reduced.
+     */
+    int getAgglomerationReductionFactor() const;
+
+    /*!
+     * \brief Report the memory used by the matrices and vectors of the solver
+     * to MemoryStatistics.
+     */
+    void updateMemoryUsage();
+
     /*!
      * \brief Apply the preconditioner to \a x and store the result in \a y.
      */
@@ -130,6 +130,12 @@ public:
      * \brief Construct a parallel PETSc Mat object corresponding to the
      * side-centered IB interpolation operator for the provided kernel function.
      *
+     * If \p mat is a matrix with the same dimensions that was previously
+     * created by this function and the stencil of each IB point contains the
+     * same degrees of freedom as before (i.e., if no IB point has moved to a
+     * different cell) then only the interpolation weights are updated in
+     * place. Otherwise \p mat is destroyed (if it is nonnull) and rebuilt.
+     *
      * \warning This routine does not properly handle delta functions for which
      * interp_stencil is odd, nor does it properly handle physical boundary
      * conditions.
@@ -86,8 +86,30 @@ namespace IBTK
  solution_tol = 1.0e-8         // see setSolutionTolerance()
  max_iterations = 50           // see setMaxIterations()
  enable_logging = FALSE        // see setLoggingEnabled()
+ snes_type = "newtonls"        // e.g., "qn" or "anderson" for secant methods
+ use_eisenstat_walker = FALSE
+ eisenstat_walker_version = 2  // PETSc default
+ eisenstat_walker_rtol_0 = 0.3      // PETSc default
+ eisenstat_walker_rtol_max = 0.9    // PETSc default
+ eisenstat_walker_gamma = 1.0       // PETSc default
+ eisenstat_walker_alpha = 1.618034   // PETSc default
+ eisenstat_walker_alpha2 = 1.618034  // PETSc default
+ eisenstat_walker_threshold = 0.1   // PETSc default
+ mffd_type = "ds"              // see MatMFFDSetType()
+ mffd_recompute_period = 1     // see MatMFFDSetPeriod()
  \endverbatim
  *
+ * If use_eisenstat_walker is TRUE, the relative tolerance of the linear solver
+ * is chosen by the Eisenstat-Walker method, so that early Newton iterations
+ * are solved inexactly.  When the Jacobian is approximated by finite
+ * differences, each Krylov iteration requires an evaluation of the nonlinear
+ * function, and mffd_type = "wp" (which only computes the norm of the base
+ * vector once per Newton iteration) or mffd_recompute_period > 1 (which reuses
+ * the differencing parameter for several products) reduce the cost of each
+ * product.  Secant methods (snes_type = "qn" or "anderson") avoid Jacobian
+ * products entirely.  Options given in the PETSc options database take
+ * precedence over these values.
+ *
  * PETSc is developed in the Mathematics and Computer Science (MCS) Division at
  * Argonne National Laboratory (ANL).  For more information about PETSc, see <A
  * HREF="http://www.mcs.anl.gov/petsc">http://www.mcs.anl.gov/petsc</A>.
@@ -375,6 +397,18 @@ private:
     bool d_managing_petsc_snes = true;
     bool d_user_provided_function = false;
     bool d_user_provided_jacobian = false;
+
+    /*
+     * Options for the nonlinear solver type, the Eisenstat-Walker forcing
+     * terms, and the matrix-free approximation of the Jacobian.
+     */
+    std::string d_snes_type;
+    bool d_use_eisenstat_walker = false;
+    int d_ew_version = PETSC_DEFAULT;
+    double d_ew_rtol_0 = PETSC_DEFAULT, d_ew_rtol_max = PETSC_DEFAULT, d_ew_gamma = PETSC_DEFAULT,
+           d_ew_alpha = PETSC_DEFAULT, d_ew_alpha2 = PETSC_DEFAULT, d_ew_threshold = PETSC_DEFAULT;
+    std::string d_mffd_type;
+    int d_mffd_recompute_period = 1;
 };
 } // namespace IBTK
 
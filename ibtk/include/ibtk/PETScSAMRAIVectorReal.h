@@ -20,6 +20,7 @@
 
 #include <ibtk/config.h>
 
+#include "Box.h"
 #include "IntVector.h"
 #include "SAMRAIVectorReal.h"
 #include "tbox/Pointer.h"
@@ -28,6 +29,8 @@
 #include "petscvec.h"
 
 #include <mpi.h>
+
+#include <vector>
 // IWYU pragma: no_include "petscmath.h"
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
@@ -58,6 +61,14 @@ namespace IBTK
  * vectors, i.e., data of type \p double or \p float.  The (currently
  * unimplemented) class PETScSAMRAIVectorComplex must be used for complex data.
  *
+ * For vectors with only cell- and side-centered components, the inner products
+ * and the AXPY-type operations are computed directly on the patch data arrays
+ * in a single pass, and the operations on several vectors (e.g., VecMDot() and
+ * VecMAXPY()) are fused.  The locations of the patch data arrays are cached the
+ * first time that such an operation is performed.  The cached locations are
+ * checked against the current patch data before each such operation and are
+ * recomputed when the patch data of the SAMRAI vector have been reallocated.
+ *
  * \see SAMRAI::solv::SAMRAIVectorReal
  */
 class PETScSAMRAIVectorReal
@@ -257,6 +268,59 @@ private:
      */
     Vec d_petsc_vector;
     bool d_vector_created_via_duplicate, d_vector_checked_out_read_write = false, d_vector_checked_out_read = false;
+
+    /*
+     * Cached locations of the local data of the SAMRAI vector that are used by
+     * the fused vector operations.  The arrays include ghost cell values.  The
+     * interior rows are the runs of interior values along the first coordinate
+     * direction, which are contiguous in memory, along with the corresponding
+     * control volume weights (which are null when the vector does not have
+     * control volumes).  The control volume arrays are also recorded so that
+     * the reallocation of either the vector data or the control volumes can
+     * be detected.
+     */
+    struct DataSpans
+    {
+        struct Row
+        {
+            unsigned int array_num;
+            int offset, length;
+            const double* cvol;
+        };
+        std::vector<double*> arrays;
+        std::vector<const double*> cvol_arrays;
+        std::vector<int> array_sizes;
+        std::vector<SAMRAI::hier::Box<NDIM> > array_boxes;
+        std::vector<Row> interior_rows;
+    };
+    DataSpans d_data_spans;
+    bool d_data_spans_valid = false, d_data_spans_supported = false;
+
+    /*
+     * Get the cached locations of the local data of the SAMRAI vector, or a
+     * null pointer if the fused vector operations are not supported by the
+     * vector.
+     */
+    const DataSpans* getCachedDataSpans();
+
+    /*
+     * Check whether the cached locations still refer to the current patch data
+     * of the SAMRAI vector.
+     */
+    bool cachedDataSpansAreCurrent() const;
+
+    /*
+     * Get the cached locations of the local data of the vectors.  Returns true
+     * if the fused vector operations are supported by all of the vectors and
+     * all of the vectors have the same data layout.
+     */
+    static bool getDataSpans(const std::vector<Vec>& vecs, std::vector<const DataSpans*>& spans);
+
+    /*
+     * Compute the local contributions to the inner products of x with each of
+     * the vectors y.
+     */
+    static void localMDot(Vec x, PetscInt nv, const Vec* y, PetscScalar* val);
 };
 } // namespace IBTK
 
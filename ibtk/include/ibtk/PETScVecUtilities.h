@@ -99,6 +99,10 @@ public:
      * The DOF indices generated by this method are compatible with the parallel
      * PETSc Vec objects generated by constructPatchLevelVec().
      *
+     * Cell-, side-, and node-centered DOF index data are supported.  Values
+     * that are shared by neighboring patches (e.g., side-centered values on
+     * patch boundaries) are assigned the same DOF index on all patches.
+     *
      * \note DOF indices are \em not assigned to ghost cell values by this
      * method.
      */
@@ -203,6 +207,14 @@ private:
                                                    int dof_index_idx,
                                                    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
 
+    /*!
+     * \brief Implementation of constructPatchLevelDOFIndices() for
+     * node-centered data.
+     */
+    static void constructPatchLevelDOFIndices_node(std::vector<int>& num_dofs_proc,
+                                                   int dof_index_idx,
+                                                   SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+
     /*!
      * \brief Implementation of constructPatchLevelAO for cell-centered data.
      */
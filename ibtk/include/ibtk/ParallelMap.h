@@ -38,6 +38,18 @@ namespace IBTK
 /*!
  * \brief Class ParallelMap is a utility class for associating integer keys with
  * arbitrary data items in parallel.
+ *
+ * By default, the map is replicated: after communicateData() is called, every
+ * process stores every item.  This requires collective operations on arrays of
+ * length equal to the number of processes and memory proportional to the size
+ * of the entire map on each process.
+ *
+ * Alternatively, the map may be distributed: each item is stored only on the
+ * process that owns its key (determined by a hash of the key modulo the number
+ * of processes).  Additions and removals are sent only to the owning processes
+ * via a sparse (non-blocking consensus) exchange, getMap() returns only the
+ * locally owned items, and items owned by other processes are obtained on
+ * demand via the collective function lookupItems().
  */
 class ParallelMap : public SAMRAI::tbox::DescribedClass
 {
@@ -47,6 +59,14 @@ public:
      */
     ParallelMap() = default;
 
+    /*!
+     * \brief Constructor.
+     *
+     * \param distributed Whether each item is stored only on the process that
+     * owns its key rather than on all processes.
+     */
+    ParallelMap(bool distributed);
+
     /*!
      * \brief Copy constructor.
      *
@@ -101,11 +121,41 @@ public:
 
     /*!
      * \brief Return a const reference to the map.
+     *
+     * \note For a distributed map, only the items owned by this process are
+     * included.
      */
     const std::map<int, SAMRAI::tbox::Pointer<Streamable> >& getMap() const;
 
+    /*!
+     * \brief Return whether each item is stored only on the process that owns
+     * its key.
+     */
+    bool isDistributed() const;
+
+    /*!
+     * \brief Return the process that owns the specified key.
+     */
+    int getOwner(int key) const;
+
+    /*!
+     * \brief Return the items with the specified keys.  Keys that are not in
+     * the map are ignored.
+     *
+     * \note This method is collective.  For a distributed map, only processes
+     * that own some of the requested keys are communicated with.
+     */
+    std::map<int, SAMRAI::tbox::Pointer<Streamable> > lookupItems(const std::vector<int>& keys) const;
+
 private:
+    /*!
+     * \brief Send the pending additions and removals to the processes that own
+     * the keys and update the locally owned items.
+     */
+    void communicateDataDistributed();
+
     // Member data.
+    bool d_distributed = false;
     std::map<int, SAMRAI::tbox::Pointer<Streamable> > d_map;
     std::map<int, SAMRAI::tbox::Pointer<Streamable> > d_pending_additions;
     std::vector<int> d_pending_removals;
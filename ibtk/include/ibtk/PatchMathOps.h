@@ -415,6 +415,84 @@ public:
                  int m = 0,
                  int n = 0) const;
 
+    /*!
+     * \brief Computes dst_l = alpha L src1_m + beta src1_m + gamma src2_n at
+     * the cells whose stencils do not include ghost cells of src1.
+     *
+     * Together, laplaceInterior() and laplaceBoundary() compute the same values
+     * as laplace().  Because laplaceInterior() does not read ghost cell values,
+     * it may be called while ghost cell values are being communicated.
+     *
+     * Uses the standard 5 point stencil in 2D (7 point stencil in 3D).
+     */
+    void laplaceInterior(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dst,
+                         double alpha,
+                         double beta,
+                         SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > src1,
+                         double gamma,
+                         SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > src2,
+                         SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                         int l = 0,
+                         int m = 0,
+                         int n = 0) const;
+
+    /*!
+     * \brief Computes dst_l = alpha L src1_m + beta src1_m + gamma src2_n at
+     * the cells adjacent to the patch boundary, i.e., the cells not treated by
+     * laplaceInterior().
+     *
+     * Uses the standard 5 point stencil in 2D (7 point stencil in 3D).
+     */
+    void laplaceBoundary(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dst,
+                         double alpha,
+                         double beta,
+                         SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > src1,
+                         double gamma,
+                         SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > src2,
+                         SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                         int l = 0,
+                         int m = 0,
+                         int n = 0) const;
+
+    /*!
+     * \brief Computes dst_l = alpha L src1_m + beta src1_m + gamma src2_n at
+     * the sides whose stencils do not include ghost values of src1.
+     *
+     * Together, laplaceInterior() and laplaceBoundary() compute the same values
+     * as laplace().  Because laplaceInterior() does not read ghost cell values,
+     * it may be called while ghost cell values are being communicated.
+     *
+     * Uses the standard 5 point stencil in 2D (7 point stencil in 3D).
+     */
+    void laplaceInterior(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > dst,
+                         double alpha,
+                         double beta,
+                         SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > src1,
+                         double gamma,
+                         SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > src2,
+                         SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                         int l = 0,
+                         int m = 0,
+                         int n = 0) const;
+
+    /*!
+     * \brief Computes dst_l = alpha L src1_m + beta src1_m + gamma src2_n at
+     * the sides on or adjacent to the patch boundary, i.e., the sides not
+     * treated by laplaceInterior().
+     *
+     * Uses the standard 5 point stencil in 2D (7 point stencil in 3D).
+     */
+    void laplaceBoundary(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > dst,
+                         double alpha,
+                         double beta,
+                         SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > src1,
+                         double gamma,
+                         SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > src2,
+                         SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                         int l = 0,
+                         int m = 0,
+                         int n = 0) const;
+
     /*!
      * \brief Computes dst_l = div alpha grad src1_m + beta src1_m + gamma
      * src2_n.
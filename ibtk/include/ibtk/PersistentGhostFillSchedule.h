@@ -0,0 +1,206 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_PersistentGhostFillSchedule
+#define included_IBTK_PersistentGhostFillSchedule
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "ibtk/FixedSizedStream.h"
+
+#include "BoxOverlap.h"
+#include "IntVector.h"
+#include "PatchLevel.h"
+#include "RefinePatchStrategy.h"
+#include "VariableFillPattern.h"
+#include "tbox/Pointer.h"
+
+#include <mpi.h>
+
+#include <memory>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PersistentGhostFillSchedule fills the ghost cells of patch data
+ * on a single patch level from the interiors of the neighboring patches on the
+ * same level, including periodic images, using persistent MPI requests.
+ *
+ * The patch data overlaps are computed when the schedule is constructed.  The
+ * message buffers and the persistent MPI requests (see MPI_Send_init() and
+ * MPI_Recv_init()) are set up the first time that fillData() is called, since
+ * the message sizes can only be determined from allocated patch data.  Each
+ * call to fillData() then packs the data into the preallocated buffers, starts
+ * the persistent requests, copies data between local patches, and unpacks the
+ * received data.  Physical boundary conditions
+ * are then set via the optional SAMRAI::xfer::RefinePatchStrategy object.
+ *
+ * This class only performs same-level copies, so it is only a replacement for
+ * a SAMRAI::xfer::RefineSchedule on a level that does not require data from a
+ * coarser level, i.e., the coarsest level of a patch hierarchy.  The schedule
+ * must be rebuilt whenever the patch level or the patch data factories change.
+ *
+ * Each schedule communicates on its own duplicate of the IBTK communicator, so
+ * that the messages of different schedules (or of other code) cannot be
+ * confused even when several fills are in progress at the same time.
+ * Schedules must therefore be constructed and destroyed in the same order on
+ * all processes.
+ */
+class PersistentGhostFillSchedule
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \note This function is collective over all MPI processes.
+     *
+     * \param level The patch level on which to fill ghost cell values.
+     * \param dst_data_idxs The patch data indices of the data to fill.
+     * \param src_data_idxs The patch data indices from which data are copied.
+     * \param fill_patterns Optional fill patterns for each component; a null
+     * pointer indicates that all ghost cells are filled.
+     * \param refine_strategy Optional strategy used to set physical boundary
+     * conditions.
+     */
+    PersistentGhostFillSchedule(
+        SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level,
+        const std::vector<int>& dst_data_idxs,
+        const std::vector<int>& src_data_idxs,
+        const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::VariableFillPattern<NDIM> > >& fill_patterns,
+        SAMRAI::xfer::RefinePatchStrategy<NDIM>* refine_strategy = nullptr);
+
+    /*!
+     * \brief Destructor.
+     *
+     * \note This function is collective over all MPI processes.
+     */
+    ~PersistentGhostFillSchedule();
+
+    /*!
+     * \brief Reset the patch data indices used by the schedule.
+     *
+     * \note The new patch data must be compatible with the patch data used to
+     * construct the schedule, i.e., they must have the same centering, depth,
+     * and ghost cell widths, since the patch data overlaps and the message
+     * buffers are reused.
+     */
+    void setDataIndices(const std::vector<int>& dst_data_idxs, const std::vector<int>& src_data_idxs);
+
+    /*!
+     * \brief Fill ghost cell values.
+     *
+     * This is equivalent to calling beginFillData() followed by endFillData().
+     *
+     * \note This function is collective over all MPI processes.
+     */
+    void fillData(double fill_time);
+
+    /*!
+     * \brief Start filling ghost cell values.
+     *
+     * This function starts the communication of data between processors and
+     * copies data between local patches.  Upon return, patch interior values
+     * of the destination data are set, but ghost cell values filled from other
+     * processors are not available until endFillData() is called.
+     *
+     * \note This function is collective over all MPI processes.
+     */
+    void beginFillData();
+
+    /*!
+     * \brief Finish filling ghost cell values that were started by
+     * beginFillData() and set physical boundary conditions.
+     */
+    void endFillData(double fill_time);
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PersistentGhostFillSchedule(const PersistentGhostFillSchedule& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PersistentGhostFillSchedule& operator=(const PersistentGhostFillSchedule& that) = delete;
+
+    /*!
+     * \brief Allocate the message buffers and set up the persistent MPI
+     * requests.
+     */
+    void initializeRequests();
+
+    /*!
+     * \brief A copy of data from one patch to another.
+     */
+    struct Transaction
+    {
+        int dst_patch_num;
+        int src_patch_num;
+        int shift_num;
+        unsigned int comp_idx;
+        SAMRAI::tbox::Pointer<SAMRAI::hier::BoxOverlap<NDIM> > overlap;
+
+        bool operator<(const Transaction& that) const
+        {
+            if (dst_patch_num != that.dst_patch_num) return dst_patch_num < that.dst_patch_num;
+            if (src_patch_num != that.src_patch_num) return src_patch_num < that.src_patch_num;
+            if (shift_num != that.shift_num) return shift_num < that.shift_num;
+            return comp_idx < that.comp_idx;
+        }
+    };
+
+    /*!
+     * \brief The transactions and message buffer for the data exchanged with a
+     * single processor.
+     */
+    struct Message
+    {
+        int rank;
+        std::vector<Transaction> transactions;
+        std::unique_ptr<FixedSizedStream> stream;
+    };
+
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > d_level;
+    std::vector<int> d_dst_data_idxs, d_src_data_idxs;
+    SAMRAI::xfer::RefinePatchStrategy<NDIM>* const d_refine_strategy;
+    SAMRAI::hier::IntVector<NDIM> d_ghost_width_to_fill;
+
+    std::vector<Transaction> d_local_transactions;
+    std::vector<Message> d_send_messages, d_recv_messages;
+    MPI_Comm d_communicator = MPI_COMM_NULL;
+    bool d_requests_initialized = false;
+    std::vector<MPI_Request> d_send_requests, d_recv_requests;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_PersistentGhostFillSchedule
@@ -24,7 +24,11 @@
 #include "ibtk/ibtk_enums.h"
 
 #include "BoundaryBox.h"
+#include "Box.h"
+#include "BoxArray.h"
+#include "PatchLevel.h"
 #include "PoissonSpecifications.h"
+#include "tbox/Array.h"
 #include "tbox/Pointer.h"
 
 #include <map>
@@ -64,6 +68,25 @@ namespace IBTK
 class PoissonUtilities
 {
 public:
+    /*!
+     * \brief Modifications to the right-hand side entries on a single patch,
+     * stored as lists of offsets into the data arrays of the right-hand side
+     * patch data (one array for cell-centered data and NDIM arrays for
+     * side-centered data) and the values to add at those offsets.
+     *
+     * Since the modifications for physical boundary conditions only depend on
+     * the patch, the problem coefficients, and the boundary condition
+     * coefficients, solvers may compute them once with
+     * computeRHSAdjustmentAtPhysicalBoundary() and then add them to each
+     * right-hand side with applyRHSAdjustment().
+     */
+    struct RHSAdjustment
+    {
+        SAMRAI::hier::Box<NDIM> ghost_box;
+        std::vector<std::vector<int> > offsets;
+        std::vector<std::vector<double> > values;
+    };
+
     /*!
      * Compute the matrix coefficients corresponding to a cell-centered
      * discretization of the Laplacian.
@@ -152,6 +175,54 @@ public:
                                             double data_time,
                                             bool homogeneous_bc);
 
+    /*!
+     * Compute the modifications to the right-hand side entries that account
+     * for physical boundary conditions corresponding to a cell-centered
+     * discretization of the Laplacian.  The right-hand side data is only used
+     * to determine the layout of the data arrays.
+     */
+    static void
+    computeRHSAdjustmentAtPhysicalBoundary(RHSAdjustment& rhs_adjustment,
+                                           const SAMRAI::pdat::CellData<NDIM, double>& rhs_data,
+                                           SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                           const SAMRAI::solv::PoissonSpecifications& poisson_spec,
+                                           const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                                           double data_time,
+                                           bool homogeneous_bc);
+
+    /*!
+     * Compute the modifications to the right-hand side entries that account
+     * for physical boundary conditions corresponding to a side-centered
+     * discretization of the Laplacian.  The right-hand side data is only used
+     * to determine the layout of the data arrays.
+     */
+    static void
+    computeRHSAdjustmentAtPhysicalBoundary(RHSAdjustment& rhs_adjustment,
+                                           const SAMRAI::pdat::SideData<NDIM, double>& rhs_data,
+                                           SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                           const SAMRAI::solv::PoissonSpecifications& poisson_spec,
+                                           const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                                           double data_time,
+                                           bool homogeneous_bc);
+
+    /*!
+     * Add precomputed modifications to cell-centered right-hand side entries.
+     *
+     * \note The right-hand side data must have the same ghost box as the data
+     * used to compute the modifications.
+     */
+    static void applyRHSAdjustment(SAMRAI::pdat::CellData<NDIM, double>& rhs_data,
+                                   const RHSAdjustment& rhs_adjustment);
+
+    /*!
+     * Add precomputed modifications to side-centered right-hand side entries.
+     *
+     * \note The right-hand side data must have the same ghost box as the data
+     * used to compute the modifications.
+     */
+    static void applyRHSAdjustment(SAMRAI::pdat::SideData<NDIM, double>& rhs_data,
+                                   const RHSAdjustment& rhs_adjustment);
+
     /*!
      * Modify the right-hand side entries to account for physical boundary
      * conditions corresponding to a side-centered discretization of the
@@ -220,6 +291,29 @@ public:
         const SAMRAI::tbox::Array<SAMRAI::hier::BoundaryBox<NDIM> >& type1_cf_bdry,
         VCInterpType mu_interp_type = VC_HARMONIC_INTERP);
 
+    /*!
+     * Determine whether the distributed matrix coefficients \a new_values are,
+     * to within roundoff, a scalar multiple of the matrix coefficients \a
+     * old_values.  If so, the scale factor is returned in \a scale.
+     *
+     * \note This function is collective: each processor passes the matrix
+     * coefficients that it owns, and all processors return the same result.
+     */
+    static bool getMatrixScaleFactor(const std::vector<std::vector<double> >& old_values,
+                                     const std::vector<std::vector<double> >& new_values,
+                                     double& scale);
+
+    /*!
+     * Determine whether the patch boxes of \a level and their assignment to
+     * processors are the same as \a boxes and \a mapping.  This allows solvers
+     * to check whether data structures that were set up for a previous patch
+     * level (e.g., before regridding) can be reused without retaining a
+     * reference to that level.
+     */
+    static bool levelLayoutMatches(const SAMRAI::hier::BoxArray<NDIM>& boxes,
+                                   const SAMRAI::tbox::Array<int>& mapping,
+                                   const SAMRAI::hier::PatchLevel<NDIM>& level);
+
 protected:
 private:
     /*!
@@ -0,0 +1,126 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_ReductionBatch
+#define included_IBTK_ReductionBatch
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "ibtk/IBTK_MPI.h"
+
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class ReductionBatch combines several scalar reductions into as few
+ * nonblocking collective operations as possible.
+ *
+ * Each global reduction is a synchronization point at which every process
+ * waits for the slowest one. Values that are reduced independently (e.g., a
+ * CFL number, a displacement estimate, and a diagnostic norm) can instead be
+ * registered with a ReductionBatch and reduced together: all min and max
+ * reductions are done by a single MPI_Iallreduce() (the min reductions are
+ * done as max reductions of the negated values) and all sum reductions are
+ * done by a second one. For example,
+ * \code
+ * ReductionBatch batch;
+ * batch.addMax(&cfl_max);
+ * batch.addMin(&dt_min);
+ * batch.addSum(&num_points);
+ * batch.start();
+ * // ... work that does not need the reduced values ...
+ * batch.finish();
+ * \endcode
+ * The registered values must not be accessed between start() and finish().
+ * After finish() returns, the batch is empty and may be reused.
+ */
+class ReductionBatch
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    explicit ReductionBatch(IBTK_MPI::comm communicator = IBTK_MPI::getCommunicator());
+
+    /*!
+     * \brief Destructor. Completes any reductions that have been started.
+     */
+    ~ReductionBatch();
+
+    /*!
+     * \brief Copy constructor. This function is not implemented and should not be used.
+     */
+    ReductionBatch(const ReductionBatch& from) = delete;
+
+    /*!
+     * \brief Assignment operator. This function is not implemented and should not be used.
+     */
+    ReductionBatch& operator=(const ReductionBatch& that) = delete;
+
+    /*!
+     * \brief Replace *x by the minimum of *x over all processes when the batch
+     * is finished.
+     */
+    void addMin(double* x);
+
+    /*!
+     * \brief Replace *x by the maximum of *x over all processes when the batch
+     * is finished.
+     */
+    void addMax(double* x);
+
+    /*!
+     * \brief Replace *x by the sum of *x over all processes when the batch is
+     * finished.
+     */
+    void addSum(double* x);
+
+    /*!
+     * \brief Start the reductions of all registered values.
+     *
+     * \note This is a collective operation: all processes must register the
+     * same sequence of reductions.
+     */
+    void start();
+
+    /*!
+     * \brief Wait for the reductions to complete and store the results in the
+     * registered values. If start() has not been called, it is called first.
+     */
+    void finish();
+
+private:
+    IBTK_MPI::comm d_communicator;
+
+    /// The registered values; d_min_max_sign is -1 for min reductions and +1
+    /// for max reductions.
+    std::vector<double*> d_min_max_values, d_sum_values;
+    std::vector<double> d_min_max_sign;
+
+    /// The buffers reduced by the collective operations and their requests.
+    std::vector<double> d_min_max_buffer, d_sum_buffer;
+    IBTK_MPI::request d_min_max_request = MPI_REQUEST_NULL, d_sum_request = MPI_REQUEST_NULL;
+    bool d_started = false;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_ReductionBatch
@@ -0,0 +1,198 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_ReferenceElementData
+#define included_IBTK_ReferenceElementData
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include <ibtk/libmesh_utilities.h>
+
+#include <libmesh/enum_elem_type.h>
+#include <libmesh/point.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class ReferenceElementData stores the quadrature points, quadrature
+ * weights, and the values and gradients of the Lagrange shape functions of a
+ * mapping element type at those points on the reference element.
+ *
+ * These values only depend on the quadrature rule and the mapping element
+ * type, so each combination is computed once and then shared (via
+ * std::shared_ptr) by every object that requests it, e.g., the FEMapping
+ * objects created for each part and for each call to the FEDataManager
+ * spreading and interpolation routines. Objects of this class are immutable
+ * once they have been constructed.
+ *
+ * The shape function values and gradients are stored in structure-of-arrays
+ * format: the values of shape function \f$ i \f$ at quadrature point \f$ q
+ * \f$ are stored at index <code>i * getNumberOfQuadraturePoints() + q</code>
+ * and each component of the gradients is stored in its own array with the
+ * same layout. Hence the values of a single shape function at all quadrature
+ * points are contiguous in memory.
+ *
+ * \note get() may be called concurrently from multiple threads.
+ */
+class ReferenceElementData
+{
+public:
+    /*!
+     * Key type. Completely describes (excepting p-refinement) a libMesh
+     * quadrature rule.
+     */
+    using key_type = quadrature_key_type;
+
+    /*!
+     * \brief Return the shared reference element data for the given
+     * quadrature rule and mapping element type. The data are computed the
+     * first time that they are requested.
+     *
+     * @param[in] quad_key The quadrature key (i.e., a complete description of
+     * the quadrature rule).
+     * @param[in] mapping_elem_type The element type whose Lagrange shape
+     * functions are tabulated. This may be different from the element type in
+     * the quadrature rule - for example, one could provide TRI6 in the
+     * quadrature rule and TRI3 here - but the two must have the same
+     * dimension.
+     */
+    static std::shared_ptr<const ReferenceElementData> get(const key_type& quad_key,
+                                                           libMesh::ElemType mapping_elem_type);
+
+    /*!
+     * \brief Remove all stored data from the shared table. Objects previously
+     * returned by get() remain valid.
+     */
+    static void clear();
+
+    /*!
+     * \brief Constructor. Users should call get() instead.
+     */
+    ReferenceElementData(const key_type& quad_key, libMesh::ElemType mapping_elem_type);
+
+    /*!
+     * \brief Get the quadrature key.
+     */
+    const key_type& getQuadratureKey() const
+    {
+        return d_quad_key;
+    }
+
+    /*!
+     * \brief Get the mapping element type.
+     */
+    libMesh::ElemType getMappingElemType() const
+    {
+        return d_mapping_elem_type;
+    }
+
+    /*!
+     * \brief Get the number of quadrature points.
+     */
+    unsigned int getNumberOfQuadraturePoints() const
+    {
+        return static_cast<unsigned int>(d_points.size());
+    }
+
+    /*!
+     * \brief Get the number of shape functions (i.e., the number of nodes of
+     * the mapping element type).
+     */
+    unsigned int getNumberOfNodes() const
+    {
+        return d_n_nodes;
+    }
+
+    /*!
+     * \brief Get the quadrature points on the reference element.
+     */
+    const std::vector<libMesh::Point>& getQuadraturePoints() const
+    {
+        return d_points;
+    }
+
+    /*!
+     * \brief Get the quadrature weights.
+     */
+    const std::vector<double>& getQuadratureWeights() const
+    {
+        return d_weights;
+    }
+
+    /*!
+     * \brief Get the values of the shape functions at the quadrature points.
+     */
+    const double* getShapeValues() const
+    {
+        return d_phi.data();
+    }
+
+    /*!
+     * \brief Get component @p d of the gradients of the shape functions at
+     * the quadrature points.
+     */
+    const double* getShapeDerivatives(const unsigned int d) const
+    {
+        return d_dphi[d].data();
+    }
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    ReferenceElementData(const ReferenceElementData& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    ReferenceElementData& operator=(const ReferenceElementData& that) = delete;
+
+    const key_type d_quad_key;
+
+    const libMesh::ElemType d_mapping_elem_type;
+
+    unsigned int d_n_nodes = 0;
+
+    std::vector<libMesh::Point> d_points;
+
+    std::vector<double> d_weights;
+
+    std::vector<double> d_phi;
+
+    std::array<std::vector<double>, LIBMESH_DIM> d_dphi;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_ReferenceElementData
@@ -20,11 +20,15 @@
 
 #include <ibtk/config.h>
 
+#include "ArrayData.h"
 #include "Box.h"
 #include "ComponentSelector.h"
 #include "IntVector.h"
 #include "RefinePatchStrategy.h"
+#include "tbox/Pointer.h"
 
+#include <array>
+#include <map>
 #include <set>
 #include <vector>
 
@@ -33,7 +37,11 @@ namespace SAMRAI
 namespace hier
 {
 template <int DIM>
+class BoundaryBox;
+template <int DIM>
 class Patch;
+template <int DIM>
+class Variable;
 } // namespace hier
 namespace solv
 {
@@ -188,6 +196,24 @@ public:
                                                     const SAMRAI::hier::IntVector<NDIM>& ghost_width_to_fill);
 
 protected:
+    /*!
+     * \brief Set the Robin coefficients provided by \em bc_coef on the
+     * coefficient box \em bc_coef_box and return the arrays that hold them, in
+     * the order acoef, bcoef, gcoef.
+     *
+     * The arrays are reused by later calls with the same coefficient box and
+     * are only valid until the next call to this function.  Homogeneous
+     * boundary conditions are imposed as specified by setHomogeneousBc().
+     */
+    const std::array<SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> >, 3>&
+    setBcCoefData(SAMRAI::solv::RobinBcCoefStrategy<NDIM>* bc_coef,
+                  int patch_data_idx,
+                  const SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> >& var,
+                  SAMRAI::hier::Patch<NDIM>& patch,
+                  const SAMRAI::hier::BoundaryBox<NDIM>& bdry_box,
+                  const SAMRAI::hier::Box<NDIM>& bc_coef_box,
+                  double fill_time);
+
     /*
      * The patch data indices corresponding to the "scratch" patch data that
      * requires extrapolation of ghost cell values at physical boundaries.
@@ -205,6 +231,15 @@ protected:
     bool d_homogeneous_bc = false;
 
 private:
+    /*
+     * Coefficient arrays indexed by the lower and upper corners of the
+     * coefficient box.  Ghost cells are filled on the same boundary boxes many
+     * times between regrids, so the arrays are kept instead of being
+     * reallocated for every fill.
+     */
+    std::map<std::array<int, 2 * NDIM>, std::array<SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> >, 3> >
+        d_bc_coef_data;
+
     /*!
      * \brief Copy constructor.
      *
@@ -24,15 +24,19 @@
 
 #include "IntVector.h"
 #include "PatchHierarchy.h"
+#include "tbox/Arena.h"
 #include "tbox/DescribedClass.h"
 #include "tbox/Pointer.h"
 
+#include <cstddef>
 #include <map>
 #include <memory>
+#include <ostream>
 #include <set>
 #include <string>
 #include <tuple>
 #include <typeindex>
+#include <utility>
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
 
@@ -81,6 +85,36 @@ public:
 
     //\}
 
+    /// \name Methods to control memory allocation.
+    //\{
+
+    /**
+     * @brief      Enable or disable pooled allocation of patch data.
+     *
+     * In pooled mode, the patch data of a cached index are deallocated when the index is restored to the cache, and
+     * their memory is kept on a free list instead of being returned to the system.  Later allocations of the same
+     * size (e.g., data with the same boxes and depth) reuse this memory, so that operators that repeatedly check out
+     * scratch data do not allocate new memory each time.  Since memory is shared between data of different types,
+     * pooled mode also reduces the memory held by the cache.
+     *
+     * @note       The values of cached patch data are not preserved between uses in pooled mode.
+     *
+     * @param[in]  use_pooled_allocation  Whether to use pooled allocation
+     */
+    void setUsePooledAllocation(bool use_pooled_allocation);
+
+    /**
+     * @brief      Print the current and peak memory used by the patch data of each cloned patch data index on this
+     *             process.
+     *
+     * @note       Memory usage is only tracked in pooled mode.
+     *
+     * @param[in]  os  The output stream
+     */
+    void printMemoryUsage(std::ostream& os) const;
+
+    //\}
+
     /**
      * @brief      Class for accessing cached patch data indices.
      *
@@ -168,6 +202,22 @@ private:
      */
     void restoreCachedPatchDataIndex(int cached_idx);
 
+    /**
+     * @brief      Allocate the patch data for a cloned index on a level, using the pool in pooled mode.
+     */
+    void allocateLevelData(int cloned_idx, int ln);
+
+    /**
+     * @brief      Deallocate the patch data for a cloned index on a level, if it is allocated.
+     */
+    void deallocateLevelData(int cloned_idx, int ln);
+
+    /**
+     * @brief      Report the memory used by the allocated patch data (and the free lists in pooled mode) to
+     *             MemoryStatistics.
+     */
+    void updateMemoryUsage();
+
     /// \brief Disable the copy constructor.
     SAMRAIDataCache(const SAMRAIDataCache& from) = delete;
 
@@ -194,6 +244,48 @@ private:
 
     /// \brief Construct the data descriptor for a given variable and patch data index.
     static key_type construct_data_descriptor(int idx);
+
+    /**
+     * @brief      Memory pool that keeps freed blocks on free lists sorted by size.
+     */
+    class PatchDataPool : public SAMRAI::tbox::Arena
+    {
+    public:
+        PatchDataPool() = default;
+
+        ~PatchDataPool();
+
+        void* alloc(size_t bytes) override;
+
+        void free(void* p) override;
+
+        /// \brief Return the memory on the free lists to the system.
+        void releaseFreeBlocks();
+
+        /// \brief Return the number of bytes in blocks that are currently allocated from the pool.
+        std::size_t getBytesInUse() const;
+
+        /// \brief Return the number of bytes in blocks that are kept on the free lists.
+        std::size_t getBytesOnFreeLists() const;
+
+    private:
+        std::multimap<std::size_t, void*> d_free_blocks;
+        std::map<void*, std::size_t> d_used_blocks;
+        std::size_t d_bytes_in_use = 0;
+    };
+
+    /// \brief Whether to allocate patch data from the pool.
+    bool d_use_pooled_allocation = false;
+
+    /// \brief The pool used in pooled mode.
+    SAMRAI::tbox::Pointer<PatchDataPool> d_pool;
+
+    /// \brief Current and peak number of bytes allocated from the pool for each cloned patch data index.
+    std::map<int, std::pair<std::size_t, std::size_t> > d_pooled_bytes;
+
+    /// \brief Number of bytes of patch data allocated for the cloned patch data indices (only tracked when
+    /// MemoryStatistics is enabled).
+    double d_allocated_bytes = 0.0;
 };
 } // namespace IBTK
 
@@ -0,0 +1,145 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_SAMRAIFischerGuess
+#define included_IBTK_SAMRAIFischerGuess
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "SAMRAIVectorReal.h"
+#include "tbox/Pointer.h"
+
+IBTK_DISABLE_EXTRA_WARNINGS
+#include <Eigen/Core>
+IBTK_ENABLE_EXTRA_WARNINGS
+
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class SAMRAIFischerGuess is a version of FischerGuess for
+ * SAMRAI::solv::SAMRAIVectorReal objects.
+ *
+ * The caller submits pairs of solution and corresponding RHS vectors from
+ * solving the same linear system several times (i.e., at different time
+ * steps). The stored pairs are used to compute an estimate of the solution for
+ * a new RHS by solving the least-squares problem for the linear combination of
+ * stored RHS vectors that is closest to the new RHS, as in FischerGuess. The
+ * projection uses the inner product defined by the control volumes of the
+ * vectors.
+ *
+ * The stored vectors are allocated the first time that they are needed and
+ * are reused once the collection is full, so that submitting a new pair does
+ * not allocate patch data. The stored vectors have the same structure as the
+ * first submitted pair, and so clear() must be called whenever the patch
+ * hierarchy is regridded.
+ */
+class SAMRAIFischerGuess
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param n_vectors The maximum number of stored solution and RHS pairs.
+     */
+    SAMRAIFischerGuess(int n_vectors = 5);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~SAMRAIFischerGuess();
+
+    /*!
+     * \brief Add a new solution and RHS pair to the stored collection. If the
+     * collection is full then the oldest pair is replaced.
+     */
+    void submit(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& solution,
+                const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& rhs);
+
+    /*!
+     * \brief Given a RHS vector, use the stored collection of vectors to
+     * compute an estimate of its corresponding solution vector.
+     *
+     * \note If no vectors are stored, \a solution is not modified.
+     */
+    void guess(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& solution,
+               const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& rhs) const;
+
+    /*!
+     * \brief Given the residual of an approximate solution, add the estimate
+     * of the corresponding correction computed from the stored collection of
+     * vectors to \a solution.
+     *
+     * \note If no vectors are stored, \a solution is not modified.
+     */
+    void correct(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& solution,
+                 const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& residual) const;
+
+    /*!
+     * \brief Remove and deallocate all stored vectors.
+     */
+    void clear();
+
+    /*!
+     * \brief Get the number of stored solution and RHS pairs.
+     */
+    int getNumberOfStoredVectors() const;
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    SAMRAIFischerGuess(const SAMRAIFischerGuess& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    SAMRAIFischerGuess& operator=(const SAMRAIFischerGuess& that) = delete;
+
+    /*!
+     * \brief Compute the coefficients of the stored solutions that give the
+     * estimated solution for \a rhs.
+     */
+    Eigen::VectorXd computeCoefficients(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& rhs) const;
+
+    int d_n_max_vectors = 5;
+
+    int d_n_stored_vectors = 0;
+
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> d_correlation_matrix;
+
+    // Stored vectors, ordered from oldest to newest.
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > > d_solutions, d_rhs;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_SAMRAIFischerGuess
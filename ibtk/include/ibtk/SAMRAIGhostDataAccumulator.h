@@ -37,6 +37,21 @@ namespace IBTK
 /*!
  * \brief Class that can accumulate data summed into ghost regions on a patch
  * hierarchy into their correct locations.
+ *
+ * Cell-, side-, and node-centered data are supported.  Each level in the
+ * range [coarsest_ln, finest_ln] is treated independently: values in the ghost
+ * regions of the patches on a level (including periodic images) are summed
+ * into the entries on the patches that own the same degrees of freedom, and
+ * the sums are then copied back into every ghost entry.  Ghost values that do
+ * not correspond to a degree of freedom on the same level (i.e., values outside
+ * the physical domain or outside the region covered by the level) are left
+ * unchanged.
+ *
+ * The degree of freedom numbering and the PETSc ghosted Vec objects that
+ * perform the communication are set up by the constructor, which also
+ * precomputes, for each patch data array, the list of entries that correspond
+ * to a degree of freedom.  Objects of this class must therefore be recreated
+ * whenever the patch hierarchy changes (e.g., after regridding).
  */
 class SAMRAIGhostDataAccumulator
 {
@@ -87,11 +102,6 @@ protected:
      */
     const int d_finest_ln = -1;
 
-    /*!
-     * Boolean indicating whether or not we have cell-centered data.
-     */
-    bool d_cc_data = true;
-
     /*!
      * Index into d_hierarchy that contains the dof numbering.
      */
@@ -107,6 +117,24 @@ protected:
      * PETSc Vec objects storing the global ordering on each level.
      */
     std::vector<Vec> d_vecs;
+
+    /*!
+     * The entries of a patch data array that correspond to degrees of freedom
+     * and the indices of those degrees of freedom in the local form of the Vec
+     * of the level.
+     */
+    struct ArrayDOFMap
+    {
+        int array_size = 0;
+        std::vector<int> data_offsets, local_dofs;
+    };
+
+    /*!
+     * The maps for the arrays of each patch on each level, stored in the order
+     * in which the patches (and, for side-centered data, the arrays of each
+     * patch) are visited.
+     */
+    std::vector<std::vector<ArrayDOFMap> > d_dof_maps;
 };
 } // namespace IBTK
 
@@ -22,6 +22,7 @@
 
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/LaplaceOperator.h"
+#include "ibtk/PatchMathOps.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "IntVector.h"
@@ -82,6 +83,11 @@ public:
      *
      * \note In general, the vectors x and y \em cannot be the same.
      *
+     * \note On a patch hierarchy consisting of only level zero and for
+     * spatially constant coefficients, the communication of ghost cell values
+     * is overlapped with the computation of y at indices whose stencils do not
+     * include ghost cells (when enabled via setOverlapGhostCellFill()).
+     *
      * Upon return from this function, the y vector will contain the result of
      * the application of A to x.
      *
@@ -132,6 +138,10 @@ protected:
     std::vector<HierarchyGhostCellInterpolation::InterpolationTransactionComponent> d_transaction_comps;
     SAMRAI::tbox::Pointer<HierarchyGhostCellInterpolation> d_hier_bdry_fill, d_no_fill;
 
+    // Patch math operations, used when ghost cell filling is overlapped with
+    // computation.
+    PatchMathOps d_patch_math_ops;
+
     // Scratch data.
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_x, d_b;
 
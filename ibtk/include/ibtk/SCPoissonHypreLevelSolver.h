@@ -25,10 +25,13 @@
 #include "ibtk/ibtk_utilities.h"
 
 #include "Box.h"
+#include "BoxArray.h"
 #include "CoarseFineBoundary.h"
 #include "Index.h"
 #include "IntVector.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
@@ -108,6 +111,7 @@ namespace IBTK
  skip_relax = 1                 // see hypre User's Manual (only used by SysPFMG solver or
  preconditioner)
  two_norm = 1                   // see hypre User's Manual (only used by PCG solver)
+ reuse_solver_setup = TRUE      // see initializeSolverState()
  \endverbatim
  *
  * \em hypre is developed in the Center for Applied Scientific Computing (CASC)
@@ -221,6 +225,11 @@ public:
      * already initialized.  In this case, the solver state is first deallocated
      * and then reinitialized.
      *
+     * \note Unless the input parameter \c reuse_solver_setup is set to \c
+     * FALSE, the hypre data structures are retained by deallocateSolverState()
+     * and reused by the next call to initializeSolverState() on the same patch
+     * level.  See CCPoissonHypreLevelSolver::initializeSolverState().
+     *
      * \see deallocateSolverState
      */
     void initializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
@@ -272,6 +281,7 @@ private:
      * data structures.
      */
     void allocateHypreData();
+    void computeMatrixCoefficients(std::vector<std::vector<double> >& matrix_values);
     void setMatrixCoefficients();
     void setupHypreSolver();
     bool solveSystem(int x_idx, int b_idx);
@@ -283,6 +293,7 @@ private:
                        const SAMRAI::hier::Box<NDIM>& box);
     void destroyHypreSolver();
     void deallocateHypreData();
+    void releaseHypreData();
 
     /*!
      * \brief Associated hierarchy.
@@ -291,10 +302,16 @@ private:
 
     /*!
      * \brief Associated patch level and C-F boundary (for level numbers > 0).
+     *
+     * The level is only retained while the solver is initialized.  The boxes
+     * of the level and their assignment to processors are kept with the
+     * retained hypre data structures to determine whether those can be reused.
      */
     int d_level_num = IBTK::invalid_level_number;
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > d_level;
     SAMRAI::tbox::Pointer<SAMRAI::hier::CoarseFineBoundary<NDIM> > d_cf_boundary;
+    SAMRAI::hier::BoxArray<NDIM> d_level_boxes;
+    SAMRAI::tbox::Array<int> d_level_mapping;
 
     /*!
      * \name hypre objects.
@@ -315,6 +332,15 @@ private:
     HYPRE_SStructSolver d_solver = nullptr, d_precond = nullptr;
     std::vector<SAMRAI::hier::Index<NDIM> > d_stencil_offsets;
 
+    /*
+     * The matrix coefficients stored in the hypre matrix, indexed by the side
+     * axis, and the factor by which the current operator differs from them.
+     */
+    bool d_reuse_solver_setup = true;
+    bool d_hypre_data_allocated = false;
+    std::vector<std::vector<double> > d_matrix_values;
+    double d_matrix_scale = 1.0;
+
     std::string d_solver_type = "Split", d_precond_type = "none", d_split_solver_type = "PFMG";
     int d_rel_change = 0;
     int d_num_pre_relax_steps = 1, d_num_post_relax_steps = 1;
@@ -22,6 +22,7 @@
 
 #include "ibtk/PETScLevelSolver.h"
 #include "ibtk/PoissonSolver.h"
+#include "ibtk/PoissonUtilities.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "IntVector.h"
@@ -89,8 +90,14 @@ namespace IBTK
  rel_residual_tol = 1.0e-6      // see setRelativeTolerance()
  enable_logging = FALSE         // see setLoggingEnabled()
  options_prefix = ""            // see setOptionsPrefix()
+ cache_bc_rhs_adjustment = FALSE
  \endverbatim
  *
+ * If cache_bc_rhs_adjustment is TRUE, the modifications to the right-hand side
+ * that account for inhomogeneous physical boundary conditions are computed once
+ * for each solution time and reused by subsequent solves.  This is only valid
+ * if the boundary condition coefficients depend only on position and time.
+ *
  * PETSc is developed at the Argonne National Laboratory Mathematics and
  * Computer Science Division.  For more information about \em PETSc, see <A
  * HREF="http://www.mcs.anl.gov/petsc">http://www.mcs.anl.gov/petsc</A>.
@@ -169,6 +176,18 @@ protected:
     SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > d_data_synch_sched, d_ghost_fill_sched;
     //\}
 
+    /*!
+     * \name Cached modifications to the right-hand side for inhomogeneous
+     * physical boundary conditions, stored for each local patch that touches
+     * the physical boundary.
+     */
+    //\{
+    bool d_cache_bc_rhs_adjustment = false;
+    bool d_bc_rhs_adjustments_valid = false;
+    double d_bc_rhs_adjustment_time = 0.0;
+    std::vector<PoissonUtilities::RHSAdjustment> d_bc_rhs_adjustments;
+    //\}
+
 private:
     /*!
      * \brief Default constructor.
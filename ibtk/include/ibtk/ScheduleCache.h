@@ -0,0 +1,126 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_ScheduleCache
+#define included_IBTK_ScheduleCache
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "CoarsenAlgorithm.h"
+#include "CoarsenPatchStrategy.h"
+#include "CoarsenSchedule.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "RefineAlgorithm.h"
+#include "RefinePatchStrategy.h"
+#include "RefineSchedule.h"
+#include "tbox/Pointer.h"
+
+#include <map>
+#include <tuple>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class ScheduleCache is a utility class for reusing SAMRAI refine and
+ * coarsen schedules between algorithms that transfer different patch data
+ * between the same patch levels.
+ *
+ * Schedules are stored by the patch levels (and patch strategy) they were
+ * built for.  When a schedule is requested for an algorithm, a stored schedule
+ * that is consistent with that algorithm (i.e., one that transfers data of the
+ * same types with the same ghost cell widths and operators, see
+ * SAMRAI::xfer::RefineAlgorithm::checkConsistency()) is reset to transfer the
+ * data of the algorithm and is returned.  A new schedule is only created if no
+ * such schedule exists.
+ *
+ * \note Since a stored schedule may be reset by a later request, the returned
+ * schedule should be used right away and should not be kept by the caller.
+ *
+ * \note The cache keeps references to the patch levels of its schedules.  It
+ * should be cleared whenever those levels are replaced (e.g., after
+ * regridding).
+ */
+class ScheduleCache
+{
+public:
+    /*!
+     * \brief Return a schedule that fills data on dst_level from src_level
+     * (using the "DEFAULT_FILL" fill pattern) for the specified algorithm.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> >
+    getRefineSchedule(SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> > refine_alg,
+                      SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > dst_level,
+                      SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > src_level,
+                      SAMRAI::xfer::RefinePatchStrategy<NDIM>* patch_strategy = nullptr);
+
+    /*!
+     * \brief Return a schedule that fills data on dst_level from src_level and
+     * from coarser levels of the hierarchy (starting at next_coarser_ln) for
+     * the specified algorithm.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> >
+    getRefineSchedule(SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> > refine_alg,
+                      SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > dst_level,
+                      SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > src_level,
+                      int next_coarser_ln,
+                      SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                      SAMRAI::xfer::RefinePatchStrategy<NDIM>* patch_strategy = nullptr);
+
+    /*!
+     * \brief Return a schedule that coarsens data from fine_level onto
+     * coarse_level for the specified algorithm.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> >
+    getCoarsenSchedule(SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenAlgorithm<NDIM> > coarsen_alg,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > coarse_level,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > fine_level,
+                       SAMRAI::xfer::CoarsenPatchStrategy<NDIM>* patch_strategy = nullptr);
+
+    /*!
+     * \brief Remove all stored schedules and release the references to their
+     * patch levels.
+     */
+    void clear();
+
+private:
+    /*!
+     * Stored schedules together with the patch levels they were built for.
+     * Holding the levels guarantees that the addresses used as keys are not
+     * reused by other levels while the schedules are stored.
+     */
+    template <class ScheduleType>
+    struct Entry
+    {
+        std::vector<SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > > levels;
+        std::vector<SAMRAI::tbox::Pointer<ScheduleType> > schedules;
+    };
+
+    using RefineKey = std::tuple<const void*, const void*, int, const void*, const void*>;
+    using CoarsenKey = std::tuple<const void*, const void*, const void*>;
+
+    std::map<RefineKey, Entry<SAMRAI::xfer::RefineSchedule<NDIM> > > d_refine_schedules;
+    std::map<CoarsenKey, Entry<SAMRAI::xfer::CoarsenSchedule<NDIM> > > d_coarsen_schedules;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_ScheduleCache
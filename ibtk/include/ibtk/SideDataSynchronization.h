@@ -20,16 +20,17 @@
 
 #include <ibtk/config.h>
 
+#include "ibtk/PersistentGhostFillSchedule.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "CartesianGridGeometry.h"
 #include "CoarsenAlgorithm.h"
 #include "IntVector.h"
 #include "PatchHierarchy.h"
-#include "RefineAlgorithm.h"
 #include "tbox/DescribedClass.h"
 #include "tbox/Pointer.h"
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -39,8 +40,6 @@ namespace xfer
 {
 template <int DIM>
 class CoarsenSchedule;
-template <int DIM>
-class RefineSchedule;
 } // namespace xfer
 } // namespace SAMRAI
 
@@ -201,8 +200,7 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenAlgorithm<NDIM> > d_coarsen_alg;
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > > d_coarsen_scheds;
 
-    SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> > d_refine_alg;
-    std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_refine_scheds;
+    std::vector<std::unique_ptr<PersistentGhostFillSchedule> > d_synch_scheds;
 };
 } // namespace IBTK
 
@@ -0,0 +1,111 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_SpaceFillingCurveLoadBalancer
+#define included_IBTK_SpaceFillingCurveLoadBalancer
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "ibtk/ibtk_utilities.h"
+
+#include <tbox/Pointer.h>
+
+#include <BoxArray.h>
+#include <BoxList.h>
+#include <LoadBalancer.h>
+
+#include <map>
+
+namespace SAMRAI
+{
+namespace hier
+{
+class ProcessorMapping;
+template <int DIM>
+class PatchHierarchy;
+} // namespace hier
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class SpaceFillingCurveLoadBalancer assigns the boxes generated by a
+ * load balancer to processors by ordering them along a space-filling curve and
+ * partitioning the curve by cumulative workload.
+ *
+ * The boxes are first generated by the parent class, which enforces the
+ * minimum and maximum box sizes, cut factors, and bad intervals of the
+ * level.  The center of each box is then mapped to its position along a
+ * Z-order (Morton) curve through the physical domain and each processor is
+ * assigned a contiguous segment of the curve with (approximately) equal
+ * workload.  Since neighboring boxes are likely to be nearby on the curve, the
+ * boxes owned by each processor are spatially compact, which reduces the
+ * amount of ghost data exchanged between processors.  Since the curve itself
+ * does not change between regrids, small changes in the workload only move
+ * the boundaries between the segments, which limits the amount of data that
+ * is migrated between processors when the hierarchy is regridded.
+ *
+ * The workload of each box is computed from the workload data on the existing
+ * patch level (if any) that is registered via setWorkloadPatchDataIndex().
+ * If no such data are available, the workload of each box is its number of
+ * cells.
+ *
+ * @note Since SAMRAI::mesh::LoadBalancer::setWorkloadPatchDataIndex() is not
+ * virtual, the workload data index must be registered through a pointer to
+ * this class.  HierarchyIntegrator::registerLoadBalancer() does this
+ * automatically.
+ */
+class SpaceFillingCurveLoadBalancer : public SAMRAI::mesh::LoadBalancer<NDIM>
+{
+public:
+    // use parent constructor
+    using SAMRAI::mesh::LoadBalancer<NDIM>::LoadBalancer;
+
+    /*!
+     * \brief Set the patch data index of the cell-centered workload data used
+     * for the specified level, or for all levels if level_number is -1.
+     *
+     * @note The data index is also registered with the parent class.
+     */
+    void setWorkloadPatchDataIndex(int data_idx, int level_number = -1);
+
+    virtual void loadBalanceBoxes(SAMRAI::hier::BoxArray<NDIM>& out_boxes,
+                                  SAMRAI::hier::ProcessorMapping& mapping,
+                                  const SAMRAI::hier::BoxList<NDIM>& in_boxes,
+                                  const SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                  int level_number,
+                                  const SAMRAI::hier::BoxArray<NDIM>& physical_domain,
+                                  const SAMRAI::hier::IntVector<NDIM>& ratio_to_hierarchy_level_zero,
+                                  const SAMRAI::hier::IntVector<NDIM>& min_size,
+                                  const SAMRAI::hier::IntVector<NDIM>& max_size,
+                                  const SAMRAI::hier::IntVector<NDIM>& cut_factor,
+                                  const SAMRAI::hier::IntVector<NDIM>& bad_interval) const override;
+
+private:
+    /*!
+     * Workload data indices for all levels and for individual levels.
+     */
+    int d_workload_data_idx = IBTK::invalid_index;
+    std::map<int, int> d_level_workload_data_idx;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_SpaceFillingCurveLoadBalancer
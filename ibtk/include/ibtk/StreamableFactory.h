@@ -94,6 +94,34 @@ public:
     virtual SAMRAI::tbox::Pointer<Streamable> unpackStream(SAMRAI::tbox::AbstractStream& stream,
                                                            const SAMRAI::hier::IntVector<NDIM>& offset) = 0;
 
+    /*!
+     * \brief Pack the objects data_items[0], ..., data_items[num_items-1], all
+     * of which must have been created by this factory, into the data stream.
+     *
+     * The default implementation calls Streamable::packStream() for each
+     * object.  Factories of objects with a fixed layout may override this
+     * function and unpackStreams() to pack the data of all objects with a few
+     * copies of contiguous arrays instead of several calls per object.
+     *
+     * \note The amount of data packed must equal the sum of
+     * Streamable::getDataStreamSize() over the objects.
+     */
+    virtual void packStreams(SAMRAI::tbox::AbstractStream& stream,
+                             const SAMRAI::tbox::Pointer<Streamable>* data_items,
+                             int num_items);
+
+    /*!
+     * \brief Build num_items objects by unpacking data packed by packStreams()
+     * from the data stream and store them in data_items[0], ...,
+     * data_items[num_items-1].
+     *
+     * The default implementation calls unpackStream() num_items times.
+     */
+    virtual void unpackStreams(SAMRAI::tbox::AbstractStream& stream,
+                               const SAMRAI::hier::IntVector<NDIM>& offset,
+                               SAMRAI::tbox::Pointer<Streamable>* data_items,
+                               int num_items);
+
 private:
     /*!
      * \brief Copy constructor.
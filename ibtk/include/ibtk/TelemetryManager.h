@@ -0,0 +1,250 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_TelemetryManager
+#define included_IBTK_TelemetryManager
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <set>
+#include <string>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class TelemetryManager is a singleton class that records per-time step
+ * performance metrics and writes them as a machine-readable time series.
+ *
+ * Each row of the time series contains the metrics accumulated since the
+ * previous row:
+ *
+ * - the wall time of the time step (<TT>wall_time</TT>) and of each phase
+ *   measured with startPhase() and stopPhase() (<TT>\<phase\>_time</TT>), e.g.,
+ *   <TT>interp</TT>, <TT>force</TT>, <TT>spread</TT>, <TT>stokes_solve</TT>,
+ *   <TT>regrid</TT>, and <TT>io</TT>;
+ * - counters and values provided via addToMetric() and setMetric(), e.g.,
+ *   Krylov iterations, bytes communicated, and the numbers of local markers and
+ *   elements;
+ * - the memory high-water mark of the process in bytes
+ *   (<TT>memory_high_water_mark</TT>).
+ *
+ * Rows are written by recordStep(), which HierarchyIntegrator::advanceHierarchy()
+ * calls at the end of each time step.  The time series is written either as
+ * JSON lines (one JSON object per row) or as CSV.  By default, the metrics are
+ * reduced over all processes and rank 0 writes the minimum, maximum, and mean
+ * value of each metric, which shows load imbalance directly.  Alternatively,
+ * each process writes its own values to a separate file.
+ *
+ * Telemetry is disabled unless it is enabled via setOptions() (which
+ * AppInitializer calls if the input file contains a <TT>TelemetryManager</TT>
+ * database), in which case the recording functions return immediately.
+ *
+ * Sample input:
+ * \verbatim
+ TelemetryManager {
+    enable         = TRUE     // default is TRUE
+    file_name      = "perf"   // default is "telemetry"
+    format         = "JSON"   // "JSON" (default) or "CSV"
+    reduce         = TRUE     // default is TRUE
+    write_interval = 1        // default is 1
+ }
+ \endverbatim
+ *
+ * \note Since the values are reduced over all processes, recordStep() is
+ * collective when reduce is TRUE.
+ */
+class TelemetryManager
+{
+public:
+    /*!
+     * \brief Class ScopedPhase measures the wall time of a phase from its
+     * construction to its destruction.
+     */
+    class ScopedPhase
+    {
+    public:
+        explicit ScopedPhase(std::string phase_name);
+
+        ~ScopedPhase();
+
+    private:
+        ScopedPhase() = delete;
+        ScopedPhase(const ScopedPhase& from) = delete;
+        ScopedPhase& operator=(const ScopedPhase& that) = delete;
+
+        std::string d_phase_name;
+    };
+
+    /*!
+     * Return a pointer to the instance of the telemetry manager.  Access to
+     * TelemetryManager objects is mediated by the getManager() function.
+     *
+     * \return A pointer to the telemetry manager instance.
+     */
+    static TelemetryManager* getManager();
+
+    /*!
+     * Deallocate the TelemetryManager instance.
+     *
+     * It is not necessary to call this function at program termination since it
+     * is automatically called by the ShutdownRegistry class.
+     */
+    static void freeManager();
+
+    /*!
+     * \brief Set the telemetry options from an input database.
+     */
+    void setOptions(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \brief Return whether telemetry is recorded.
+     */
+    bool isEnabled() const;
+
+    /*!
+     * \brief Start measuring the wall time of a phase.
+     *
+     * Nested calls for the same phase are only measured by the outermost pair
+     * of calls.
+     */
+    void startPhase(const std::string& phase_name);
+
+    /*!
+     * \brief Stop measuring the wall time of a phase and add it to the current
+     * row.
+     */
+    void stopPhase(const std::string& phase_name);
+
+    /*!
+     * \brief Add a value to a metric of the current row.
+     */
+    void addToMetric(const std::string& metric_name, double value);
+
+    /*!
+     * \brief Set the value of a metric of the current row.
+     */
+    void setMetric(const std::string& metric_name, double value);
+
+    /*!
+     * \brief Complete the current time step, write a row if the step is at the
+     * write interval, and reset the metrics after writing.
+     */
+    void recordStep(int step, double time);
+
+protected:
+    /*!
+     * \brief Constructor.
+     */
+    TelemetryManager() = default;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~TelemetryManager() = default;
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    TelemetryManager(const TelemetryManager& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    TelemetryManager& operator=(const TelemetryManager& that) = delete;
+
+    /*!
+     * \brief Make the set of metric names consistent across all processes.
+     */
+    void synchronizeMetricNames();
+
+    /*!
+     * \brief Write the values of this process.
+     */
+    void writeLocalRow(int step, double time);
+
+    /*!
+     * \brief Write the minimum, maximum, and mean values over all processes.
+     */
+    void writeReducedRow(int step, double time);
+
+    /*!
+     * Static data members used to control access to and destruction of the
+     * telemetry manager instance.
+     */
+    static TelemetryManager* s_telemetry_manager_instance;
+    static bool s_registered_callback;
+    static unsigned char s_shutdown_priority;
+
+    /*!
+     * Options.
+     */
+    bool d_enabled = false;
+    std::string d_file_name = "telemetry";
+    bool d_use_csv = false;
+    bool d_reduce = true;
+    int d_write_interval = 1;
+
+    /*!
+     * Metrics of the current row, and the names of all metrics recorded so far.
+     * In reduced mode, the set of names is the same on all processes.
+     */
+    std::map<std::string, double> d_metrics;
+    std::set<std::string> d_metric_names;
+    bool d_metric_names_changed = false;
+
+    /*!
+     * Whether a CSV header must be written before the next row, i.e., whether
+     * the columns have changed since the header was last written.
+     */
+    bool d_write_csv_header = true;
+
+    /*!
+     * Start times and nesting depths of the phases that are being measured,
+     * and the start time of the current row.
+     */
+    std::map<std::string, std::pair<std::chrono::steady_clock::time_point, int> > d_running_phases;
+    std::chrono::steady_clock::time_point d_row_start_time = std::chrono::steady_clock::now();
+
+    /*!
+     * Output stream, which is opened when the first row is written.
+     */
+    std::ofstream d_stream;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_TelemetryManager
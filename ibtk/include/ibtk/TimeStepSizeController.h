@@ -0,0 +1,155 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_TimeStepSizeController
+#define included_IBTK_TimeStepSizeController
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+#include <string>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class TimeStepSizeController chooses a scale factor for the maximum
+ * stable time step size of a HierarchyIntegrator from the measured cost of
+ * previous time steps.
+ *
+ * The largest stable time step size (e.g., the CFL-limited time step size
+ * computed by an INSHierarchyIntegrator) does not necessarily give the largest
+ * amount of simulated time per second of wall clock time, since the cost of
+ * each time step (e.g., the number of Krylov iterations that the linear
+ * solvers require) typically increases with the time step size. This class
+ * scales the maximum time step size by a factor in the interval
+ * [min_scale_factor, 1] and adjusts that factor by a simple hill climbing
+ * algorithm: the wall clock time of each time step (the maximum over all
+ * processors) is measured, and after every num_steps_per_sample time steps
+ * the simulated time per wall clock second of the sample is compared to that
+ * of the previous sample. If the efficiency improved, the scale factor is
+ * changed again in the same direction; if it decreased, the direction is
+ * reversed. Changes that are smaller than relative_efficiency_tol are treated
+ * as noise, in which case larger time steps are preferred.
+ *
+ * The scale factor is never larger than one, so the time step size is always
+ * stable. Each choice is written to the log file when logging is enabled.
+ *
+ * Sample parameters for initialization from database (and their default
+ * values): \verbatim
+
+ min_scale_factor = 0.25          // smallest allowed scale factor
+ scale_factor_increment = 1.1     // factor by which the scale factor is changed
+ num_steps_per_sample = 5         // number of time steps in each sample
+ relative_efficiency_tol = 0.02   // relative change of efficiency treated as noise
+ enable_logging = FALSE           // log each choice of the scale factor
+ \endverbatim
+ *
+ * \note The state of the controller is not written to restart files.
+ */
+class TimeStepSizeController
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    TimeStepSizeController(std::string object_name, SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \brief Get the factor by which the maximum stable time step size is
+     * scaled.
+     */
+    double getTimeStepSizeScaleFactor() const;
+
+    /*!
+     * \brief Get the most recent time step size divided by the scale factor
+     * that was in effect when that time step was taken. This is the time step
+     * size that should be used to limit the growth of the time step size.
+     *
+     * \note A negative value is returned if no time step has been recorded.
+     */
+    double getPreviousUnscaledTimeStepSize() const;
+
+    /*!
+     * \brief Record the size and the wall clock time of a completed time step
+     * and update the scale factor at the end of each sample.
+     *
+     * \note This function must be called on all processors.
+     */
+    void recordTimeStep(double dt, double wall_time);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    TimeStepSizeController() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    TimeStepSizeController(const TimeStepSizeController& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    TimeStepSizeController& operator=(const TimeStepSizeController& that) = delete;
+
+    std::string d_object_name;
+
+    /*
+     * Controller parameters.
+     */
+    double d_min_scale_factor = 0.25, d_scale_factor_increment = 1.1;
+    int d_num_steps_per_sample = 5;
+    double d_relative_efficiency_tol = 0.02;
+    bool d_enable_logging = false;
+
+    /*
+     * Current state of the controller. The scale factor is decreased first
+     * since it cannot be increased beyond one.
+     */
+    double d_scale_factor = 1.0;
+    int d_direction = -1;
+    double d_previous_efficiency = -1.0;
+    double d_previous_unscaled_dt = -1.0;
+
+    /*
+     * Accumulated values for the current sample.
+     */
+    int d_sample_num_steps = 0;
+    double d_sample_dt = 0.0, d_sample_wall_time = 0.0;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_TimeStepSizeController
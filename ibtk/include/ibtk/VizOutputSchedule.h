@@ -0,0 +1,161 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_VizOutputSchedule
+#define included_IBTK_VizOutputSchedule
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "tbox/Database.h"
+#include "tbox/DescribedClass.h"
+#include "tbox/Pointer.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class VizOutputSchedule determines when each output stream of an
+ * application (e.g., the VisIt data of the Cartesian grid or the ExodusII file
+ * of one part of a structure) is written and which variables it contains.
+ *
+ * Output streams are identified by names chosen by the application.  Each
+ * stream is written every <TT>interval</TT> time steps, where the interval of a
+ * stream that is not listed in the <TT>intervals</TT> database defaults to the
+ * visualization dump interval of the application.  An interval of zero
+ * disables the stream.  The <TT>variables</TT> database restricts the
+ * variables written to a stream, e.g., via ExodusII_IO::set_output_variables();
+ * all variables are written to streams that are not listed.
+ *
+ * AppInitializer creates an object of this type from the
+ * <TT>VizOutputSchedule</TT> database of the <TT>Main</TT> database (see
+ * AppInitializer::getVizOutputSchedule()).
+ *
+ * Sample input:
+ * \verbatim
+ Main {
+    viz_dump_interval = 10
+    VizOutputSchedule {
+       intervals {
+          visit  = 50     // Cartesian grid data every 50 steps
+          part_0 = 10     // ExodusII output of part 0 every 10 steps
+          part_1 = 0      // no output of part 1
+       }
+       variables {
+          part_0 = "X_0", "X_1", "U_0", "U_1"
+       }
+    }
+ }
+ \endverbatim
+ */
+class VizOutputSchedule : public virtual SAMRAI::tbox::DescribedClass
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param input_db The input database (may be null).
+     * \param default_interval The interval of the streams that are not listed
+     * in the input database.
+     */
+    VizOutputSchedule(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db, int default_interval);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~VizOutputSchedule() = default;
+
+    /*!
+     * \brief Return the output interval of a stream.
+     */
+    int getInterval(const std::string& stream_name) const;
+
+    /*!
+     * \brief Return whether a stream is ever written.
+     */
+    bool isEnabled(const std::string& stream_name) const;
+
+    /*!
+     * \brief Return whether a stream is written at the specified time step.
+     *
+     * Enabled streams are always written at the last time step.
+     */
+    bool isOutputStep(const std::string& stream_name, int iteration_num, bool last_step = false) const;
+
+    /*!
+     * \brief Return the (one-based) index of the output of a stream at the
+     * specified time step, e.g., the time step index of an ExodusII file to
+     * which all outputs of the stream are appended.
+     */
+    int getOutputIndex(const std::string& stream_name, int iteration_num) const;
+
+    /*!
+     * \brief Return the names of the variables written to a stream.
+     *
+     * An empty vector indicates that all variables are written.
+     */
+    const std::vector<std::string>& getVariables(const std::string& stream_name) const;
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    VizOutputSchedule() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    VizOutputSchedule(const VizOutputSchedule& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    VizOutputSchedule& operator=(const VizOutputSchedule& that) = delete;
+
+    /*!
+     * The interval of the streams that are not listed in d_intervals.
+     */
+    int d_default_interval;
+
+    /*!
+     * The intervals and the variables of the streams listed in the input
+     * database.
+     */
+    std::map<std::string, int> d_intervals;
+    std::map<std::string, std::vector<std::string> > d_variables;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_VizOutputSchedule
@@ -207,6 +207,75 @@ enum_to_string<NodeOutsidePatchCheckType>(NodeOutsidePatchCheckType val)
     return "UNKNOWN_NODE_OUTSIDE_PATCH_CHECK_TYPE";
 } // enum_to_string
 
+/*!
+ * \brief Enumerated type for the kernel functions used to interpolate and
+ * spread data between Eulerian grids and Lagrangian meshes.
+ *
+ * \note Unlike most other enumerations, kernel function names are compared in
+ * a case-sensitive manner for consistency with the names stored in input files
+ * and restart files.
+ */
+enum KernelFunctionType
+{
+    PIECEWISE_CONSTANT_KERNEL,
+    DISCONTINUOUS_LINEAR_KERNEL,
+    PIECEWISE_LINEAR_KERNEL,
+    PIECEWISE_CUBIC_KERNEL,
+    IB_3_KERNEL,
+    IB_4_KERNEL,
+    IB_4_W8_KERNEL,
+    IB_5_KERNEL,
+    IB_6_KERNEL,
+    BSPLINE_3_KERNEL,
+    BSPLINE_4_KERNEL,
+    BSPLINE_5_KERNEL,
+    BSPLINE_6_KERNEL,
+    USER_DEFINED_KERNEL,
+    UNKNOWN_KERNEL_FUNCTION_TYPE = -1
+};
+
+template <>
+inline KernelFunctionType
+string_to_enum<KernelFunctionType>(const std::string& val)
+{
+    if (val == "PIECEWISE_CONSTANT") return PIECEWISE_CONSTANT_KERNEL;
+    if (val == "DISCONTINUOUS_LINEAR") return DISCONTINUOUS_LINEAR_KERNEL;
+    if (val == "PIECEWISE_LINEAR") return PIECEWISE_LINEAR_KERNEL;
+    if (val == "PIECEWISE_CUBIC") return PIECEWISE_CUBIC_KERNEL;
+    if (val == "IB_3") return IB_3_KERNEL;
+    if (val == "IB_4") return IB_4_KERNEL;
+    if (val == "IB_4_W8") return IB_4_W8_KERNEL;
+    if (val == "IB_5") return IB_5_KERNEL;
+    if (val == "IB_6") return IB_6_KERNEL;
+    if (val == "BSPLINE_3") return BSPLINE_3_KERNEL;
+    if (val == "BSPLINE_4") return BSPLINE_4_KERNEL;
+    if (val == "BSPLINE_5") return BSPLINE_5_KERNEL;
+    if (val == "BSPLINE_6") return BSPLINE_6_KERNEL;
+    if (val == "USER_DEFINED") return USER_DEFINED_KERNEL;
+    return UNKNOWN_KERNEL_FUNCTION_TYPE;
+} // string_to_enum
+
+template <>
+inline std::string
+enum_to_string<KernelFunctionType>(KernelFunctionType val)
+{
+    if (val == PIECEWISE_CONSTANT_KERNEL) return "PIECEWISE_CONSTANT";
+    if (val == DISCONTINUOUS_LINEAR_KERNEL) return "DISCONTINUOUS_LINEAR";
+    if (val == PIECEWISE_LINEAR_KERNEL) return "PIECEWISE_LINEAR";
+    if (val == PIECEWISE_CUBIC_KERNEL) return "PIECEWISE_CUBIC";
+    if (val == IB_3_KERNEL) return "IB_3";
+    if (val == IB_4_KERNEL) return "IB_4";
+    if (val == IB_4_W8_KERNEL) return "IB_4_W8";
+    if (val == IB_5_KERNEL) return "IB_5";
+    if (val == IB_6_KERNEL) return "IB_6";
+    if (val == BSPLINE_3_KERNEL) return "BSPLINE_3";
+    if (val == BSPLINE_4_KERNEL) return "BSPLINE_4";
+    if (val == BSPLINE_5_KERNEL) return "BSPLINE_5";
+    if (val == BSPLINE_6_KERNEL) return "BSPLINE_6";
+    if (val == USER_DEFINED_KERNEL) return "USER_DEFINED";
+    return "UNKNOWN_KERNEL_FUNCTION_TYPE";
+} // enum_to_string
+
 } // namespace IBTK
 
 //////////////////////////////////////////////////////////////////////////////
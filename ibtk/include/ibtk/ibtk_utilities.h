@@ -20,9 +20,14 @@
 
 #include <ibtk/config.h>
 
+#include "Box.h"
+#include "Index.h"
+#include "Patch.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/PIO.h"
+#include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
 IBTK_DISABLE_EXTRA_WARNINGS
@@ -32,7 +37,10 @@ IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <utility>
+#include <vector>
 
 /////////////////////////////// MACRO DEFINITIONS ////////////////////////////
 
@@ -144,6 +152,85 @@ get_data_time_str(const double data_time, const double current_time, const doubl
  */
 double get_min_patch_dx(const SAMRAI::hier::PatchLevel<NDIM>& patch_level);
 
+/*!
+ * Get the local patches of the specified level, ordered by decreasing number of
+ * cells.
+ */
+std::vector<SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > >
+get_local_patches_by_size(const SAMRAI::hier::PatchLevel<NDIM>& patch_level);
+
+/*!
+ * Apply f, which is called as f(const Pointer<Patch<NDIM> >& patch), to each
+ * local patch of the specified level.
+ *
+ * When IBAMR is built with OpenMP and threaded is true, the patches are
+ * processed concurrently. Patches are handed out to the threads one at a time,
+ * largest first, so that threads that finish early pick up the remaining
+ * (smaller) patches and the work stays balanced when patch sizes differ.
+ *
+ * \note Since f may be called concurrently for different patches, it may only
+ * modify data that belong to its patch. In particular, the reference counts of
+ * SAMRAI::tbox::Pointer objects are not thread safe, so f must not copy pointers
+ * to objects shared between patches (e.g., variables) and must not allocate or
+ * free SAMRAI patch data outside of an OpenMP critical section. Pass threaded =
+ * false for work that does not satisfy these requirements.
+ */
+template <class PatchFunctor>
+inline void
+parallel_for_patches(const SAMRAI::hier::PatchLevel<NDIM>& patch_level, PatchFunctor f, const bool threaded = true)
+{
+    const std::vector<SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > > patches =
+        get_local_patches_by_size(patch_level);
+    const int num_patches = static_cast<int>(patches.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) if (threaded && num_patches > 1)
+#else
+    NULL_USE(threaded);
+#endif
+    for (int k = 0; k < num_patches; ++k)
+    {
+        f(patches[k]);
+    }
+    return;
+} // parallel_for_patches
+
+/*!
+ * Compute the position of cell index i along a Z-order (Morton) curve through
+ * the cells of a box with lower corner lower by interleaving the bits of the
+ * coordinates of i - lower, which must be nonnegative.
+ */
+inline std::uint64_t
+morton_key(const SAMRAI::hier::Index<NDIM>& i, const SAMRAI::hier::Index<NDIM>& lower)
+{
+    static const unsigned int num_bits = 64 / NDIM;
+    std::uint64_t key = 0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const auto coord = static_cast<std::uint64_t>(i(d) - lower(d));
+        for (unsigned int b = 0; b < num_bits; ++b)
+        {
+            key |= ((coord >> b) & std::uint64_t(1)) << (NDIM * b + d);
+        }
+    }
+    return key;
+} // morton_key
+
+/*!
+ * Compute the offset of index i within a single depth of a column-major
+ * (Fortran-ordered) data array defined on the indices of data_box.
+ */
+inline std::ptrdiff_t
+array_offset(const SAMRAI::hier::Box<NDIM>& data_box, const SAMRAI::hier::Index<NDIM>& i)
+{
+    std::ptrdiff_t offset = 0, stride = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        offset += stride * (i(d) - data_box.lower(d));
+        stride *= data_box.numberCells(d);
+    }
+    return offset;
+} // array_offset
+
 /*!
  * Check whether the relative difference between a and b are within the threshold eps.
  *
@@ -0,0 +1,392 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_kernel_functions
+#define included_IBTK_kernel_functions
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "ibtk/ibtk_enums.h"
+
+#include <cmath>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Struct KernelFunction provides inlined C++ implementations of the
+ * one-dimensional kernel functions used to interpolate and spread data between
+ * Eulerian grids and Lagrangian meshes.
+ *
+ * Each specialization provides
+ *
+ * - the support \p support of the kernel, i.e., the number of grid points at
+ *   which the kernel is (generically) nonzero;
+ * - a function <code>value(r)</code> that evaluates the kernel function
+ *   \f$\phi(r)\f$; and
+ * - a function <code>weights(r, w)</code> that evaluates a full row of
+ *   stencil weights at once, i.e., <code>w[k] = phi(r - k)</code> for
+ *   <code>0 <= k < support</code>, in which \p r is the (scaled) distance
+ *   from the first point of the stencil. \p r is assumed to lie in the
+ *   interval <code>[support/2 - 1, support/2)</code> for even supports and in
+ *   <code>[(support-1)/2 - 1/2, (support-1)/2 + 1/2)</code> for odd supports.
+ *
+ * \note The support is not the same as the stencil size returned by
+ * LEInteractor::getStencilSize(), which is rounded up to the next even number
+ * for kernels with odd supports (e.g., 4 for the three-point IB kernel) to
+ * match the even-sized stencils used by the Fortran implementations. Use
+ * LEInteractor::getStencilSize() to size stencils and ghost cell regions.
+ *
+ * The implementations of <code>weights()</code> avoid branches so that the
+ * compiler is free to vectorize loops over Lagrangian points.
+ *
+ * \note These functions are equivalent to the Fortran implementations of the
+ * kernel functions in lagrangian_delta.f.m4.
+ */
+template <KernelFunctionType kernel>
+struct KernelFunction;
+
+template <>
+struct KernelFunction<PIECEWISE_LINEAR_KERNEL>
+{
+    static constexpr int support = 2;
+
+    static inline double value(double r)
+    {
+        r = std::abs(r);
+        return r < 1.0 ? 1.0 - r : 0.0;
+    }
+
+    static inline void weights(const double r, double* const w)
+    {
+        w[0] = 1.0 - r;
+        w[1] = r;
+    }
+};
+
+template <>
+struct KernelFunction<PIECEWISE_CUBIC_KERNEL>
+{
+    static constexpr int support = 4;
+
+    static inline double value(double r)
+    {
+        r = std::abs(r);
+        if (r < 1.0)
+        {
+            return 1.0 - 0.5 * r - r * r + 0.5 * r * r * r;
+        }
+        else if (r < 2.0)
+        {
+            return 1.0 - (11.0 / 6.0) * r + r * r - (1.0 / 6.0) * r * r * r;
+        }
+        return 0.0;
+    }
+
+    static inline void weights(const double r, double* const w)
+    {
+        const double x = r - 1.0;
+        const double x2 = x * x;
+        const double x3 = x2 * x;
+        w[0] = (-2.0 * x + 3.0 * x2 - x3) / 6.0;
+        w[1] = 1.0 - 0.5 * x - x2 + 0.5 * x3;
+        w[2] = x + 0.5 * x2 - 0.5 * x3;
+        w[3] = (-x + x3) / 6.0;
+    }
+};
+
+template <>
+struct KernelFunction<IB_3_KERNEL>
+{
+    static constexpr int support = 3;
+
+    static inline double value(double r)
+    {
+        r = std::abs(r);
+        if (r < 0.5)
+        {
+            return (1.0 + std::sqrt(1.0 - 3.0 * r * r)) / 3.0;
+        }
+        else if (r < 1.5)
+        {
+            return (5.0 - 3.0 * r - std::sqrt(1.0 - 3.0 * (1.0 - r) * (1.0 - r))) / 6.0;
+        }
+        return 0.0;
+    }
+
+    static inline void weights(const double r, double* const w)
+    {
+        // x is the signed distance from the center point of the stencil.
+        const double x = r - 1.0;
+        const double q = std::sqrt(1.0 - 3.0 * x * x);
+        w[1] = (1.0 + q) / 3.0;
+        w[0] = (2.0 - 3.0 * x - q) / 6.0;
+        w[2] = (2.0 + 3.0 * x - q) / 6.0;
+    }
+};
+
+template <>
+struct KernelFunction<IB_4_KERNEL>
+{
+    static constexpr int support = 4;
+
+    static inline double value(double r)
+    {
+        r = std::abs(r);
+        if (r < 1.0)
+        {
+            const double t2 = r * r;
+            const double t6 = std::sqrt(-0.4e1 * t2 + 0.4e1 * r + 0.1e1);
+            return -r / 0.4e1 + 0.3e1 / 0.8e1 + t6 / 0.8e1;
+        }
+        else if (r < 2.0)
+        {
+            const double t2 = r * r;
+            const double t6 = std::sqrt(0.12e2 * r - 0.7e1 - 0.4e1 * t2);
+            return -r / 0.4e1 + 0.5e1 / 0.8e1 - t6 / 0.8e1;
+        }
+        return 0.0;
+    }
+
+    static inline void weights(const double r, double* const w)
+    {
+        // All four weights share the same square root.
+        const double x = r - 1.0;
+        const double q = std::sqrt(1.0 + 4.0 * x * (1.0 - x));
+        w[0] = (3.0 - 2.0 * x - q) / 8.0;
+        w[1] = (3.0 - 2.0 * x + q) / 8.0;
+        w[2] = (1.0 + 2.0 * x + q) / 8.0;
+        w[3] = (1.0 + 2.0 * x - q) / 8.0;
+    }
+};
+
+template <>
+struct KernelFunction<IB_5_KERNEL>
+{
+    static constexpr int support = 5;
+
+    static inline double value(double r)
+    {
+        const double x = std::abs(r);
+        if (x <= 0.5)
+        {
+            return phi(x);
+        }
+        else if (x <= 1.5)
+        {
+            const double s = x - 1.0;
+            return (4.0 - 4.0 * phi(s) - K - 4.0 * s + 3.0 * K * s - s * s + s * s * s) / 6.0;
+        }
+        else if (x <= 2.5)
+        {
+            const double s = x - 2.0;
+            return (-2.0 + 2.0 * phi(s) + 2.0 * K + s - 3.0 * K * s + 2.0 * s * s - s * s * s) / 12.0;
+        }
+        return 0.0;
+    }
+
+    static inline void weights(const double r, double* const w)
+    {
+        // x is the signed distance from the center point of the stencil.
+        const double x = r - 2.0;
+        const double p = phi(std::abs(x));
+        const double x2 = x * x;
+        const double x3 = x2 * x;
+        w[2] = p;
+        w[1] = (4.0 - 4.0 * p - K - (4.0 - 3.0 * K) * x - x2 + x3) / 6.0;
+        w[3] = (4.0 - 4.0 * p - K + (4.0 - 3.0 * K) * x - x2 - x3) / 6.0;
+        w[0] = (-2.0 + 2.0 * p + 2.0 * K + (1.0 - 3.0 * K) * x + 2.0 * x2 - x3) / 12.0;
+        w[4] = (-2.0 + 2.0 * p + 2.0 * K - (1.0 - 3.0 * K) * x + 2.0 * x2 + x3) / 12.0;
+    }
+
+private:
+    static constexpr double K = 0.4948896022846988; // (38 - sqrt(69))/60
+
+    static inline double phi(const double r)
+    {
+        const double r2 = r * r;
+        const double r4 = r2 * r2;
+        const double r6 = r4 * r2;
+        return (136.0 - 40.0 * K - 40.0 * r2 +
+                std::sqrt(2.0) * std::sqrt(3123.0 - 6840.0 * K + 3600.0 * K * K - 12440.0 * r2 + 25680.0 * K * r2 -
+                                           12600.0 * K * K * r2 + 8080.0 * r4 - 8400.0 * K * r4 - 1400.0 * r6)) /
+               280.0;
+    }
+};
+
+template <>
+struct KernelFunction<BSPLINE_3_KERNEL>
+{
+    static constexpr int support = 3;
+
+    static inline double value(double x)
+    {
+        const double modx = std::abs(x);
+        const double r = modx + 1.5;
+        const double r2 = r * r;
+        if (modx <= 0.5)
+        {
+            return 0.5 * (-2.0 * r2 + 6.0 * r - 3.0);
+        }
+        else if (modx <= 1.5)
+        {
+            return 0.5 * (r2 - 6.0 * r + 9.0);
+        }
+        return 0.0;
+    }
+
+    static inline void weights(const double r, double* const w)
+    {
+        // x is the signed distance from the center point of the stencil.
+        const double x = r - 1.0;
+        w[0] = 0.5 * (0.5 - x) * (0.5 - x);
+        w[1] = 0.75 - x * x;
+        w[2] = 0.5 * (0.5 + x) * (0.5 + x);
+    }
+};
+
+template <>
+struct KernelFunction<BSPLINE_4_KERNEL>
+{
+    static constexpr int support = 4;
+
+    static inline double value(double x)
+    {
+        const double modx = std::abs(x);
+        const double r = modx + 2.0;
+        const double r2 = r * r;
+        const double r3 = r2 * r;
+        if (modx <= 1.0)
+        {
+            return (1.0 / 6.0) * (3.0 * r3 - 24.0 * r2 + 60.0 * r - 44.0);
+        }
+        else if (modx <= 2.0)
+        {
+            return (1.0 / 6.0) * (-r3 + 12.0 * r2 - 48.0 * r + 64.0);
+        }
+        return 0.0;
+    }
+
+    static inline void weights(const double r, double* const w)
+    {
+        const double x = r - 1.0;
+        const double y = 1.0 - x;
+        const double x3 = x * x * x;
+        const double y3 = y * y * y;
+        w[0] = y3 / 6.0;
+        w[1] = (4.0 - 6.0 * x * x + 3.0 * x3) / 6.0;
+        w[2] = (4.0 - 6.0 * y * y + 3.0 * y3) / 6.0;
+        w[3] = x3 / 6.0;
+    }
+};
+
+template <>
+struct KernelFunction<BSPLINE_5_KERNEL>
+{
+    static constexpr int support = 5;
+
+    static inline double value(double x)
+    {
+        const double modx = std::abs(x);
+        const double r = modx + 2.5;
+        const double r2 = r * r;
+        const double r3 = r2 * r;
+        const double r4 = r3 * r;
+        if (modx <= 0.5)
+        {
+            return (1.0 / 24.0) * (6.0 * r4 - 60.0 * r3 + 210.0 * r2 - 300.0 * r + 155.0);
+        }
+        else if (modx <= 1.5)
+        {
+            return (1.0 / 24.0) * (-4.0 * r4 + 60.0 * r3 - 330.0 * r2 + 780.0 * r - 655.0);
+        }
+        else if (modx <= 2.5)
+        {
+            return (1.0 / 24.0) * (r4 - 20.0 * r3 + 150.0 * r2 - 500.0 * r + 625.0);
+        }
+        return 0.0;
+    }
+
+    static inline void weights(const double r, double* const w)
+    {
+        // x is the signed distance from the center point of the stencil.
+        const double x = r - 2.0;
+        const double x2 = x * x;
+        const double x4 = x2 * x2;
+        const double a = 0.5 - x;
+        const double b = 0.5 + x;
+        w[0] = (a * a) * (a * a) / 24.0;
+        w[1] = (19.0 - 44.0 * x + 24.0 * x2 + 16.0 * x2 * x - 16.0 * x4) / 96.0;
+        w[2] = (115.0 - 120.0 * x2 + 48.0 * x4) / 192.0;
+        w[3] = (19.0 + 44.0 * x + 24.0 * x2 - 16.0 * x2 * x - 16.0 * x4) / 96.0;
+        w[4] = (b * b) * (b * b) / 24.0;
+    }
+};
+
+template <>
+struct KernelFunction<BSPLINE_6_KERNEL>
+{
+    static constexpr int support = 6;
+
+    static inline double value(double x)
+    {
+        const double modx = std::abs(x);
+        const double r = modx + 3.0;
+        const double r2 = r * r;
+        const double r3 = r2 * r;
+        const double r4 = r3 * r;
+        const double r5 = r4 * r;
+        if (modx <= 1.0)
+        {
+            return (1.0 / 60.0) * (2193.0 - 3465.0 * r + 2130.0 * r2 - 630.0 * r3 + 90.0 * r4 - 5.0 * r5);
+        }
+        else if (modx <= 2.0)
+        {
+            return (1.0 / 120.0) * (-10974.0 + 12270.0 * r - 5340.0 * r2 + 1140.0 * r3 - 120.0 * r4 + 5.0 * r5);
+        }
+        else if (modx <= 3.0)
+        {
+            return (1.0 / 120.0) * (7776.0 - 6480.0 * r + 2160.0 * r2 - 360.0 * r3 + 30.0 * r4 - r5);
+        }
+        return 0.0;
+    }
+
+    static inline void weights(const double r, double* const w)
+    {
+        // The B-spline weights are evaluated directly from their (branch-free)
+        // polynomial representations on each subinterval.
+        const double x = r - 2.0;
+        const double y = 1.0 - x;
+        const double x2 = x * x;
+        const double y2 = y * y;
+        const double x5 = x2 * x2 * x;
+        const double y5 = y2 * y2 * y;
+        w[0] = y5 / 120.0;
+        w[5] = x5 / 120.0;
+        w[1] = (26.0 - 50.0 * x + 20.0 * x2 + 20.0 * x2 * x - 20.0 * x2 * x2 + 5.0 * x5) / 120.0;
+        w[4] = (26.0 - 50.0 * y + 20.0 * y2 + 20.0 * y2 * y - 20.0 * y2 * y2 + 5.0 * y5) / 120.0;
+        w[2] = (66.0 - 60.0 * x2 + 30.0 * x2 * x2 - 10.0 * x5) / 120.0;
+        w[3] = (66.0 - 60.0 * y2 + 30.0 * y2 * y2 - 10.0 * y5) / 120.0;
+    }
+};
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_kernel_functions
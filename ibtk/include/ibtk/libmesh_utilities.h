@@ -20,7 +20,9 @@
 
 #include <ibtk/config.h>
 
+#include "ibtk/CommunicationStatistics.h"
 #include "ibtk/IBTK_CHKERRQ.h"
+#include "ibtk/ibtk_utilities.h"
 
 #include "tbox/Utilities.h"
 
@@ -47,11 +49,15 @@
 #include "libmesh/vector_value.h"
 
 IBTK_DISABLE_EXTRA_WARNINGS
+#include <Eigen/LU>
+
 #include <boost/multi_array.hpp>
 IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <array>
+#include <map>
 #include <tuple>
+#include <vector>
 
 /////////////////////////////// FUNCTION DEFINITIONS /////////////////////////
 
@@ -362,17 +368,42 @@ batch_vec_assembly(const std::vector<std::vector<libMesh::PetscVector<double>*>
     }
 }
 
+/**
+ * Start the ghost updates of a set of ghosted vectors. Each ghosted PETSc
+ * vector stores the scatter between its owned and ghost entries, so this
+ * function only posts the messages of those scatters: the caller may then do
+ * other work that does not read the ghost entries (or modify the vectors)
+ * before calling batch_vec_ghost_update_end() with the same arguments.
+ */
 inline void
-batch_vec_ghost_update(const std::vector<libMesh::PetscVector<double>*>& vecs,
-                       const InsertMode insert_mode,
-                       const ScatterMode scatter_mode)
+batch_vec_ghost_update_begin(const std::vector<libMesh::PetscVector<double>*>& vecs,
+                             const InsertMode insert_mode,
+                             const ScatterMode scatter_mode)
 {
+    if (CommunicationStatistics::enabled())
+    {
+        CommunicationStatistics::ScopedPhase phase("fe_scatter");
+        for (const auto& v : vecs)
+        {
+            if (v) CommunicationStatistics::getManager()->recordGhostUpdate(v->vec(), scatter_mode);
+        }
+    }
     for (const auto& v : vecs)
     {
         if (!v) continue;
         int ierr = VecGhostUpdateBegin(v->vec(), insert_mode, scatter_mode);
         IBTK_CHKERRQ(ierr);
     }
+}
+
+/**
+ * Finish the ghost updates started by batch_vec_ghost_update_begin().
+ */
+inline void
+batch_vec_ghost_update_end(const std::vector<libMesh::PetscVector<double>*>& vecs,
+                           const InsertMode insert_mode,
+                           const ScatterMode scatter_mode)
+{
     for (const auto& v : vecs)
     {
         if (!v) continue;
@@ -381,30 +412,133 @@ batch_vec_ghost_update(const std::vector<libMesh::PetscVector<double>*>& vecs,
     }
 }
 
+inline void
+batch_vec_ghost_update_begin(const std::vector<std::vector<libMesh::PetscVector<double>*> >& vecs,
+                             const InsertMode insert_mode,
+                             const ScatterMode scatter_mode)
+{
+    for (const auto& v : vecs) batch_vec_ghost_update_begin(v, insert_mode, scatter_mode);
+}
+
+inline void
+batch_vec_ghost_update_end(const std::vector<std::vector<libMesh::PetscVector<double>*> >& vecs,
+                           const InsertMode insert_mode,
+                           const ScatterMode scatter_mode)
+{
+    for (const auto& v : vecs) batch_vec_ghost_update_end(v, insert_mode, scatter_mode);
+}
+
+inline void
+batch_vec_ghost_update(const std::vector<libMesh::PetscVector<double>*>& vecs,
+                       const InsertMode insert_mode,
+                       const ScatterMode scatter_mode)
+{
+    batch_vec_ghost_update_begin(vecs, insert_mode, scatter_mode);
+    batch_vec_ghost_update_end(vecs, insert_mode, scatter_mode);
+}
+
 inline void
 batch_vec_ghost_update(const std::vector<std::vector<libMesh::PetscVector<double>*> >& vecs,
                        const InsertMode insert_mode,
                        const ScatterMode scatter_mode)
 {
-    for (unsigned int n = 0; n < vecs.size(); ++n)
+    batch_vec_ghost_update_begin(vecs, insert_mode, scatter_mode);
+    batch_vec_ghost_update_end(vecs, insert_mode, scatter_mode);
+}
+
+/**
+ * \brief Class FEVectorPipeline collects a sequence of assembly, ghost update,
+ * copy, and scale operations on libMesh vectors (typically the same vectors
+ * for all parts) and executes them in batched, split-phase form.
+ *
+ * Steps are executed in the order in which they were added. Communication
+ * (vector assembly and ghost updates) is only started when a step is
+ * executed and is finished as late as possible: either when a later step
+ * accesses the same vector in a way that conflicts with the operation in
+ * flight or at the end of execute(). Hence the messages of all parts, and of
+ * independent steps, are in flight at the same time. Copies and scaling only
+ * act on the locally owned entries of the vectors, so a copy into a ghosted
+ * vector should be followed by a ghost update of that vector if its ghost
+ * entries are needed.
+ *
+ * Ghost updates of vectors that are not ghosted (e.g., System::solution) are
+ * skipped. Null vectors are ignored.
+ */
+class FEVectorPipeline
+{
+public:
+    /*!
+     * Add a step that assembles the given vectors.
+     */
+    void assemble(const std::vector<libMesh::PetscVector<double>*>& vecs);
+
+    /*!
+     * Add a step that updates the ghost entries (or, for reverse scatters,
+     * the owned entries) of the given vectors.
+     */
+    void ghostUpdate(const std::vector<libMesh::PetscVector<double>*>& vecs,
+                     InsertMode insert_mode = INSERT_VALUES,
+                     ScatterMode scatter_mode = SCATTER_FORWARD);
+
+    /*!
+     * Add a step that copies the owned entries of each vector in @p x_vecs to
+     * the corresponding vector in @p y_vecs.
+     */
+    void copy(const std::vector<libMesh::PetscVector<double>*>& x_vecs,
+              const std::vector<libMesh::PetscVector<double>*>& y_vecs);
+
+    /*!
+     * Add a step that scales the owned entries of the given vectors by @p
+     * alpha.
+     */
+    void scale(const std::vector<libMesh::PetscVector<double>*>& vecs, double alpha);
+
+    /*!
+     * Execute all steps added since the last call to this function and
+     * finish all communication.
+     *
+     * \note This function is collective.
+     */
+    void execute();
+
+private:
+    enum class StepType
     {
-        for (const auto& v : vecs[n])
-        {
-            if (!v) continue;
-            int ierr = VecGhostUpdateBegin(v->vec(), insert_mode, scatter_mode);
-            IBTK_CHKERRQ(ierr);
-        }
-    }
-    for (unsigned int n = 0; n < vecs.size(); ++n)
+        ASSEMBLE,
+        GHOST_UPDATE,
+        COPY,
+        SCALE
+    };
+
+    struct Step
     {
-        for (const auto& v : vecs[n])
-        {
-            if (!v) continue;
-            int ierr = VecGhostUpdateEnd(v->vec(), insert_mode, scatter_mode);
-            IBTK_CHKERRQ(ierr);
-        }
-    }
-}
+        StepType type;
+        std::vector<libMesh::PetscVector<double>*> x_vecs, y_vecs;
+        InsertMode insert_mode = INSERT_VALUES;
+        ScatterMode scatter_mode = SCATTER_FORWARD;
+        double alpha = 1.0;
+    };
+
+    /*!
+     * Communication that has been started but not yet finished.
+     */
+    struct InFlight
+    {
+        StepType type;
+        InsertMode insert_mode;
+        ScatterMode scatter_mode;
+    };
+
+    /*!
+     * Finish the communication in flight for @p vec (if any). If @p read_only
+     * is true then forward ghost updates, which do not modify the owned
+     * entries, are not finished.
+     */
+    void finish(libMesh::PetscVector<double>* vec, bool read_only);
+
+    std::vector<Step> d_steps;
+    std::map<libMesh::PetscVector<double>*, InFlight> d_in_flight;
+};
 
 /**
  * Convenience function that calls setup_system_vector for all specified systems
@@ -1008,6 +1142,93 @@ outer_product(const libMesh::TypeVector<double>& u, const libMesh::TypeVector<do
     return u_prod_v;
 } // outer_product
 
+/*!
+ * Compute the determinant of the leading dim x dim block of @p A.
+ *
+ * For the tensors used by the FE codes (whose trailing block is the identity
+ * when dim < LIBMESH_DIM), this is equal to A.det(). Unlike A.det(), which
+ * always expands a 3x3 determinant, the amount of work depends on the
+ * compile-time dimension.
+ */
+template <int dim>
+inline double
+tensor_det(const libMesh::TypeTensor<double>& A)
+{
+    static_assert(dim == 2 || dim == 3, "only implemented for dim == 2 and dim == 3");
+    if (dim == 2) return A(0, 0) * A(1, 1) - A(0, 1) * A(1, 0);
+    return A.det();
+} // tensor_det
+
+/*!
+ * Compute the inverse transpose of the leading dim x dim block of @p A. The
+ * remaining entries of @p A_inv_trans are set to those of the identity.
+ *
+ * This is equivalent to tensor_inverse_transpose(A_inv_trans, A, dim) for the
+ * tensors used by the FE codes but, since the dimension is known at compile
+ * time, only computes the entries (and the determinant) of the leading block.
+ */
+template <int dim>
+inline void
+tensor_inverse_transpose(libMesh::TensorValue<double>& A_inv_trans, const libMesh::TensorValue<double>& A)
+{
+    static_assert(dim == 2 || dim == 3, "only implemented for dim == 2 and dim == 3");
+    const double det_A = tensor_det<dim>(A);
+    if (dim == 2)
+    {
+        A_inv_trans(0, 0) = +A(1, 1) / det_A;
+        A_inv_trans(0, 1) = -A(1, 0) / det_A;
+        A_inv_trans(0, 2) = 0.0;
+        A_inv_trans(1, 0) = -A(0, 1) / det_A;
+        A_inv_trans(1, 1) = +A(0, 0) / det_A;
+        A_inv_trans(1, 2) = 0.0;
+        A_inv_trans(2, 0) = 0.0;
+        A_inv_trans(2, 1) = 0.0;
+        A_inv_trans(2, 2) = 1.0;
+    }
+    else
+    {
+        tensor_inverse_transpose(A_inv_trans, A, dim);
+    }
+    return;
+} // tensor_inverse_transpose
+
+/*!
+ * Compute the Jacobian dX/ds of the mapping from the reference element at the
+ * specified quadrature point, storing only the dim x dim entries that are
+ * actually needed.
+ *
+ * This is the fixed-size counterpart of the jacobian() function that computes
+ * a libMesh::TypeTensor: the loop bounds are known at compile time and the
+ * result is an Eigen matrix (e.g., IBTK::MatrixNd when dim == NDIM) whose
+ * determinant and inverse are computed in closed form.
+ */
+template <int dim, class MultiArray>
+inline void
+jacobian(Eigen::Matrix<double, dim, dim>& dX_ds,
+         const int qp,
+         const MultiArray& X_node,
+         const std::vector<std::vector<libMesh::VectorValue<double> > >& dphi)
+{
+    const int n_nodes = static_cast<int>(X_node.shape()[0]);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(static_cast<int>(X_node.shape()[1]) == dim);
+#endif
+    dX_ds.setZero();
+    for (int k = 0; k < n_nodes; ++k)
+    {
+        const libMesh::VectorValue<double>& dphi_ds = dphi[k][qp];
+        for (int i = 0; i < dim; ++i)
+        {
+            const double& X = X_node[k][i];
+            for (int j = 0; j < dim; ++j)
+            {
+                dX_ds(i, j) += X * dphi_ds(j);
+            }
+        }
+    }
+    return;
+} // jacobian
+
 // WARNING: This code is specialized to the case in which q is a unit vector
 // aligned with the coordinate axes.
 inline bool
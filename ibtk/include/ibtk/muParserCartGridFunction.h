@@ -23,12 +23,15 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/ibtk_utilities.h"
 
+#include "ArrayData.h"
+#include "Box.h"
 #include "CartesianGridGeometry.h"
 #include "PatchLevel.h"
 #include "tbox/Pointer.h"
 
 #include "muParser.h"
 
+#include <array>
 #include <map>
 #include <string>
 #include <vector>
@@ -149,10 +152,42 @@ private:
     std::vector<mu::Parser> d_parsers;
 
     /*!
-     * Time and position variables.
+     * \brief Ensure that the time and position arrays used by the mu::Parser
+     * objects can store values for the specified number of indices.
+     *
+     * \note The parser variables are redefined whenever the arrays are
+     * reallocated.
+     */
+    void resizeParserArrays(int size);
+
+    /*!
+     * \brief Evaluate a function in bulk at all of the indices of index_box and
+     * store the values in the specified depth of an array of patch data.
+     *
+     * The physical location associated with index i is XLower + dx * (i -
+     * patch_box.lower() + offset).  For face-centered data, in which the
+     * components of the indices are permuted, axis_shift is the axis of the
+     * data; otherwise, axis_shift is zero.
+     */
+    void setDataOnBox(SAMRAI::pdat::ArrayData<NDIM, double>& data,
+                      int data_depth,
+                      const SAMRAI::hier::Box<NDIM>& index_box,
+                      unsigned int axis_shift,
+                      const std::array<double, NDIM>& offset,
+                      const SAMRAI::hier::Box<NDIM>& patch_box,
+                      const double* XLower,
+                      const double* dx,
+                      double data_time,
+                      mu::Parser& parser);
+
+    /*!
+     * Time and position variables.  The values for all of the indices of a box
+     * are stored so that the functions can be evaluated in bulk (see
+     * mu::ParserBase::Eval(value_type*, int)).
      */
-    double d_parser_time = 0.0;
-    Point d_parser_posn;
+    std::vector<double> d_parser_time;
+    std::array<std::vector<double>, NDIM> d_parser_posn;
+    std::vector<double> d_parser_results;
 };
 } // namespace IBTK
 
@@ -29,8 +29,10 @@
 
 #include "muParser.h"
 
+#include <array>
 #include <map>
 #include <string>
+#include <tuple>
 #include <vector>
 
 namespace SAMRAI
@@ -76,6 +78,13 @@ namespace IBTK
  * `condition ? result_if_true : result_if_false`. For more exotic boundary
  * conditions, one would need to create an extension of the class `RobinBcCoefStrategy`.
  *
+ * Because the coefficient functions depend only on position and time, the
+ * coefficient values computed for a boundary box are cached and reused for
+ * later requests for the same boundary box, either for as long as the box is
+ * unchanged (for functions that do not depend on time) or for requests at the
+ * same time (for functions that do).  Constant functions are evaluated only
+ * once per boundary box.
+ *
  * \warning Not all linear solvers in IBTK properly handle time-varying \em
  * homogeneous Robin boundary condition coefficients.  Note, however, that all
  * linear solvers in IBTK are presently designed to support spatially and
@@ -180,25 +189,50 @@ private:
     muParserRobinBcCoefs& operator=(const muParserRobinBcCoefs& that) = delete;
 
     /*!
-     * Current time value used by the mu::Parser instances.
+     * \brief Ensure that the time and position arrays used by the mu::Parser
+     * objects can store values for the specified number of indices.
      *
-     * This value is mutable since the mu::Parser objects each store a pointer
-     * to it but its specific value (the present time) changes during each
-     * call to muParserRobinBcCoefs::setBcCoefs. The alternative would be to
-     * rebuild the mu::Parser objects during each call to
-     * muParserRobinBcCoefs::setBcCoefs, which is much more expensive. Since
-     * this variable is only written to and subsequently read from in that
-     * function this is reasonable.
+     * \note The parser variables are redefined whenever the arrays are
+     * reallocated.
      */
-    mutable double d_parser_time = 0.0;
+    void resizeParserArrays(int size) const;
 
     /*!
-     * Current space point used by the mu::Parser instances.
+     * Time and space points used by the mu::Parser instances.  The values for
+     * all of the indices of a boundary box are stored so that the coefficients
+     * can be evaluated in bulk (see mu::ParserBase::Eval(value_type*, int)).
      *
-     * This value is mutable for the same reasons that
-     * muParserRobinBcCoefs::d_parser_time is mutable.
+     * These values are mutable since the mu::Parser objects each store
+     * pointers to them but their specific values (the present time and the
+     * locations of the boundary points) change during each call to
+     * muParserRobinBcCoefs::setBcCoefs. The alternative would be to rebuild the
+     * mu::Parser objects during each call to muParserRobinBcCoefs::setBcCoefs,
+     * which is much more expensive. Since these variables are only written to
+     * and subsequently read from in that function this is reasonable.
+     */
+    mutable std::vector<double> d_parser_time;
+    mutable std::array<std::vector<double>, NDIM> d_parser_posn;
+
+    /*!
+     * Whether each of the acoef, bcoef, and gcoef functions on each side is
+     * constant and whether any of the functions on each side depend on time.
      */
-    mutable Point d_parser_posn;
+    std::array<std::array<bool, 3>, 2 * NDIM> d_coef_is_constant;
+    std::array<bool, 2 * NDIM> d_coef_is_time_dependent;
+
+    /*!
+     * Cached coefficient values indexed by the location index, the corners of
+     * the coefficient box, the lower index of the patch box, and the physical
+     * lower corner and grid spacing of the patch.  The values of a constant
+     * function are stored as a single value.
+     */
+    using CacheKey = std::tuple<unsigned int, std::array<int, 3 * NDIM>, std::array<double, 2 * NDIM> >;
+    struct CachedCoefs
+    {
+        double time;
+        std::array<std::vector<double>, 3> values;
+    };
+    mutable std::map<CacheKey, CachedCoefs> d_coef_cache;
 
     /*!
      * The Cartesian grid geometry object provides the extents of the
@@ -221,10 +255,13 @@ private:
 
     /*!
      * The mu::Parser objects which evaluate the data-setting functions.
+     *
+     * These objects are mutable since bulk evaluation is a non-const operation
+     * of mu::Parser.
      */
-    std::array<mu::Parser, 2 * NDIM> d_acoef_parsers;
-    std::array<mu::Parser, 2 * NDIM> d_bcoef_parsers;
-    std::array<mu::Parser, 2 * NDIM> d_gcoef_parsers;
+    mutable std::array<mu::Parser, 2 * NDIM> d_acoef_parsers;
+    mutable std::array<mu::Parser, 2 * NDIM> d_bcoef_parsers;
+    mutable std::array<mu::Parser, 2 * NDIM> d_gcoef_parsers;
 };
 } // namespace IBTK
 
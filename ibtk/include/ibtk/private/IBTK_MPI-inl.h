@@ -16,6 +16,7 @@
 #ifndef included_IBTK_MPI_inc
 #define included_IBTK_MPI_inc
 
+#include "ibtk/CommunicationStatistics.h"
 #include "ibtk/IBTK_MPI.h"
 
 namespace IBTK
@@ -34,6 +35,7 @@ inline void
 IBTK_MPI::minReduction(T* x, const int n, int* rank_of_min, IBTK_MPI::comm communicator)
 {
     if (n == 0) return;
+    if (CommunicationStatistics::enabled()) CommunicationStatistics::getManager()->recordCollective(n * sizeof(T));
     if (rank_of_min == nullptr)
     {
         MPI_Allreduce(MPI_IN_PLACE, x, n, mpi_type_id(x[0]), MPI_MIN, communicator);
@@ -57,6 +59,7 @@ inline void
 IBTK_MPI::maxReduction(T* x, const int n, int* rank_of_max, IBTK_MPI::comm communicator)
 {
     if (n == 0) return;
+    if (CommunicationStatistics::enabled()) CommunicationStatistics::getManager()->recordCollective(n * sizeof(T));
     if (rank_of_max == nullptr)
     {
         MPI_Allreduce(MPI_IN_PLACE, x, n, mpi_type_id(x[0]), MPI_MAX, communicator);
@@ -80,9 +83,42 @@ inline void
 IBTK_MPI::sumReduction(T* x, const int n, IBTK_MPI::comm communicator)
 {
     if (n == 0 || getNodes(communicator) < 2) return;
+    if (CommunicationStatistics::enabled()) CommunicationStatistics::getManager()->recordCollective(n * sizeof(T));
     MPI_Allreduce(MPI_IN_PLACE, x, n, mpi_type_id(x[0]), MPI_SUM, communicator);
 } // sumReduction
 
+template <typename T>
+inline IBTK_MPI::request
+IBTK_MPI::iminReduction(T* x, const int n, IBTK_MPI::comm communicator)
+{
+    return iallReduce(x, n, MPI_MIN, communicator);
+} // iminReduction
+
+template <typename T>
+inline IBTK_MPI::request
+IBTK_MPI::imaxReduction(T* x, const int n, IBTK_MPI::comm communicator)
+{
+    return iallReduce(x, n, MPI_MAX, communicator);
+} // imaxReduction
+
+template <typename T>
+inline IBTK_MPI::request
+IBTK_MPI::isumReduction(T* x, const int n, IBTK_MPI::comm communicator)
+{
+    return iallReduce(x, n, MPI_SUM, communicator);
+} // isumReduction
+
+template <typename T>
+inline IBTK_MPI::request
+IBTK_MPI::iallReduce(T* x, const int n, MPI_Op op, IBTK_MPI::comm communicator)
+{
+    IBTK_MPI::request request = MPI_REQUEST_NULL;
+    if (n == 0 || getNodes(communicator) < 2) return request;
+    if (CommunicationStatistics::enabled()) CommunicationStatistics::getManager()->recordCollective(n * sizeof(T));
+    MPI_Iallreduce(MPI_IN_PLACE, x, n, mpi_type_id(x[0]), op, communicator, &request);
+    return request;
+} // iallReduce
+
 template <typename T>
 inline T
 IBTK_MPI::bcast(const T x, const int root, IBTK_MPI::comm communicator)
@@ -99,6 +135,10 @@ IBTK_MPI::bcast(T* x, int& length, const int root, IBTK_MPI::comm communicator)
 {
     if (getNodes(communicator) > 1)
     {
+        if (CommunicationStatistics::enabled())
+        {
+            CommunicationStatistics::getManager()->recordCollective(length * sizeof(T));
+        }
         MPI_Bcast(x, length, mpi_type_id(x[0]), root, communicator);
     }
 } // bcast
@@ -114,6 +154,12 @@ IBTK_MPI::send(const T* buf,
 {
     tag = (tag >= 0) ? tag : 0;
     int size = length;
+    if (CommunicationStatistics::enabled())
+    {
+        CommunicationStatistics::getManager()->recordSend(receiving_proc_number,
+                                                          length * sizeof(T) + (send_length ? sizeof(int) : 0),
+                                                          send_length ? 2 : 1);
+    }
     if (send_length)
     {
         MPI_Send(&size, 1, MPI_INT, receiving_proc_number, tag, communicator);
@@ -145,6 +191,10 @@ IBTK_MPI::allGather(const T* x_in, int size_in, T* x_out, int size_out, IBTK_MPI
 {
     std::vector<int> rcounts, disps;
     allGatherSetup(size_in, size_out, rcounts, disps, communicator);
+    if (CommunicationStatistics::enabled())
+    {
+        CommunicationStatistics::getManager()->recordCollective(size_in * sizeof(T));
+    }
 
     MPI_Allgatherv(
         x_in, size_in, mpi_type_id(x_in[0]), x_out, rcounts.data(), disps.data(), mpi_type_id(x_in[0]), communicator);
@@ -154,6 +204,7 @@ template <typename T>
 inline void
 IBTK_MPI::allGather(T x_in, T* x_out, IBTK_MPI::comm communicator)
 {
+    if (CommunicationStatistics::enabled()) CommunicationStatistics::getManager()->recordCollective(sizeof(T));
     MPI_Allgather(&x_in, 1, mpi_type_id(x_in), x_out, 1, mpi_type_id(x_in), communicator);
 } // allGather
 
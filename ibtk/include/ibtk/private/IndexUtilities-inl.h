@@ -148,6 +148,83 @@ IndexUtilities::getCellIndex(const DoubleArray& X,
     return getCellIndex(X, grid_geom->getXLower(), grid_geom->getXUpper(), dx, domain_box.lower(), domain_box.upper());
 } // getCellIndex
 
+inline void
+IndexUtilities::getCellIndices(const double* const X,
+                               const int num_points,
+                               const double* const x_lower,
+                               const double* const x_upper,
+                               const double* const dx,
+                               const SAMRAI::hier::Index<NDIM>& ilower,
+                               const SAMRAI::hier::Index<NDIM>& iupper,
+                               SAMRAI::hier::Index<NDIM>* const indices)
+{
+    // NOTE: The indices are computed by the same expression as in getCellIndex() (in particular, by dividing by the
+    // grid spacing instead of multiplying by its reciprocal) so that both functions assign the same cell to a point.
+    // The loop over points is done separately for each coordinate direction so that it vectorizes.
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const double x_lower_d = x_lower[d], x_upper_d = x_upper[d], dx_d = dx[d];
+        const int ilower_d = ilower(d), iupper_d = iupper(d);
+        for (int k = 0; k < num_points; ++k)
+        {
+            const double dX_lower = X[NDIM * k + d] - x_lower_d, dX_upper = X[NDIM * k + d] - x_upper_d;
+            indices[k](d) = std::abs(dX_lower) <= std::abs(dX_upper) ? ilower_d + floor(dX_lower / dx_d) :
+                                                                       iupper_d + floor(dX_upper / dx_d) + 1;
+        }
+    }
+    return;
+} // getCellIndices
+
+inline void
+IndexUtilities::getCellIndices(const double* const X,
+                               const int num_points,
+                               const SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianPatchGeometry<NDIM> >& patch_geom,
+                               const SAMRAI::hier::Box<NDIM>& patch_box,
+                               SAMRAI::hier::Index<NDIM>* const indices)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(patch_geom);
+#endif
+    getCellIndices(X,
+                   num_points,
+                   patch_geom->getXLower(),
+                   patch_geom->getXUpper(),
+                   patch_geom->getDx(),
+                   patch_box.lower(),
+                   patch_box.upper(),
+                   indices);
+    return;
+} // getCellIndices
+
+inline void
+IndexUtilities::getCellIndices(const double* const X,
+                               const int num_points,
+                               const SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> >& grid_geom,
+                               const SAMRAI::hier::IntVector<NDIM>& ratio,
+                               SAMRAI::hier::Index<NDIM>* const indices)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(grid_geom);
+#endif
+    const double* const dx0 = grid_geom->getDx();
+    double dx[NDIM];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        dx[d] = dx0[d] / static_cast<double>(ratio(d));
+    }
+    const SAMRAI::hier::Box<NDIM> domain_box =
+        SAMRAI::hier::Box<NDIM>::refine(grid_geom->getPhysicalDomain()[0], ratio);
+    getCellIndices(X,
+                   num_points,
+                   grid_geom->getXLower(),
+                   grid_geom->getXUpper(),
+                   dx,
+                   domain_box.lower(),
+                   domain_box.upper(),
+                   indices);
+    return;
+} // getCellIndices
+
 inline int
 IndexUtilities::mapIndexToInteger(const SAMRAI::hier::Index<NDIM>& i,
                                   const SAMRAI::hier::Index<NDIM>& domain_lower,
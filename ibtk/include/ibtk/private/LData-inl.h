@@ -124,7 +124,17 @@ LData::getGhostedLocalFormVecArray()
 inline void
 LData::restoreArrays()
 {
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_num_accesses == 0);
+#endif
     int ierr;
+    if (d_ghosted_local_read_array)
+    {
+        ierr = VecRestoreArrayRead(d_ghosted_local_vec, &d_ghosted_local_read_array);
+        IBTK_CHKERRQ(ierr);
+        d_ghosted_local_read_array = nullptr;
+    }
+    d_restore_after_write_access = false;
     if (d_ghosted_local_array)
     {
         ierr = VecRestoreArray(d_ghosted_local_vec, &d_ghosted_local_array);
@@ -162,6 +172,98 @@ LData::endGhostUpdate()
     return;
 } // endGhostUpdate
 
+inline LData::ReadAccess::ReadAccess(LData& data) : d_data(data), d_array(data.acquireReadArray())
+{
+    // intentionally blank
+    return;
+} // ReadAccess
+
+inline LData::ReadAccess::~ReadAccess()
+{
+    d_data.releaseArray();
+    return;
+} // ~ReadAccess
+
+inline const double*
+LData::ReadAccess::data() const
+{
+    return d_array;
+} // data
+
+inline unsigned int
+LData::ReadAccess::getLocalNodeCount() const
+{
+    return d_data.d_local_node_count;
+} // getLocalNodeCount
+
+inline unsigned int
+LData::ReadAccess::getGhostNodeCount() const
+{
+    return d_data.d_ghost_node_count;
+} // getGhostNodeCount
+
+inline unsigned int
+LData::ReadAccess::getDepth() const
+{
+    return d_data.d_depth;
+} // getDepth
+
+inline const double&
+LData::ReadAccess::operator()(const unsigned int i, const unsigned int d) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(i < d_data.d_local_node_count + d_data.d_ghost_node_count);
+    TBOX_ASSERT(d < d_data.d_depth);
+#endif
+    return d_array[i * d_data.d_depth + d];
+} // operator()
+
+inline LData::WriteAccess::WriteAccess(LData& data) : d_data(data), d_array(data.acquireWriteArray())
+{
+    // intentionally blank
+    return;
+} // WriteAccess
+
+inline LData::WriteAccess::~WriteAccess()
+{
+    d_data.releaseArray();
+    return;
+} // ~WriteAccess
+
+inline double*
+LData::WriteAccess::data() const
+{
+    return d_array;
+} // data
+
+inline unsigned int
+LData::WriteAccess::getLocalNodeCount() const
+{
+    return d_data.d_local_node_count;
+} // getLocalNodeCount
+
+inline unsigned int
+LData::WriteAccess::getGhostNodeCount() const
+{
+    return d_data.d_ghost_node_count;
+} // getGhostNodeCount
+
+inline unsigned int
+LData::WriteAccess::getDepth() const
+{
+    return d_data.d_depth;
+} // getDepth
+
+inline double&
+LData::WriteAccess::operator()(const unsigned int i, const unsigned int d) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(i < d_data.d_local_node_count + d_data.d_ghost_node_count);
+    TBOX_ASSERT(d < d_data.d_depth);
+#endif
+    return d_array[i * d_data.d_depth + d];
+} // operator()
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 /**
@@ -271,6 +373,69 @@ LData::getGhostedLocalFormArrayCommon()
     return;
 } // getGhostedLocalFormArrayCommon
 
+inline const double*
+LData::acquireReadArray()
+{
+    ++d_num_accesses;
+    if (d_ghosted_local_array) return d_ghosted_local_array;
+    if (!d_ghosted_local_read_array)
+    {
+        int ierr;
+        if (!d_ghosted_local_vec)
+        {
+            ierr = VecGhostGetLocalForm(d_global_vec, &d_ghosted_local_vec);
+            IBTK_CHKERRQ(ierr);
+        }
+        ierr = VecGetArrayRead(d_ghosted_local_vec, &d_ghosted_local_read_array);
+        IBTK_CHKERRQ(ierr);
+    }
+    return d_ghosted_local_read_array;
+} // acquireReadArray
+
+inline double*
+LData::acquireWriteArray()
+{
+    if (!d_ghosted_local_array)
+    {
+#if !defined(NDEBUG)
+        TBOX_ASSERT(d_num_accesses == 0);
+#endif
+        if (d_ghosted_local_read_array)
+        {
+            const int ierr = VecRestoreArrayRead(d_ghosted_local_vec, &d_ghosted_local_read_array);
+            IBTK_CHKERRQ(ierr);
+            d_ghosted_local_read_array = nullptr;
+        }
+        getGhostedLocalFormArrayCommon();
+        d_restore_after_write_access = true;
+    }
+    ++d_num_accesses;
+    return d_ghosted_local_array;
+} // acquireWriteArray
+
+inline void
+LData::releaseArray()
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_num_accesses > 0);
+#endif
+    // A read-only array remains cached until restoreArrays() is called, but an
+    // array obtained for writing is restored once it is no longer used so that
+    // PETSc records that the vector has been modified.
+    --d_num_accesses;
+    if (d_num_accesses == 0 && d_restore_after_write_access)
+    {
+        int ierr = VecRestoreArray(d_ghosted_local_vec, &d_ghosted_local_array);
+        IBTK_CHKERRQ(ierr);
+        d_ghosted_local_array = nullptr;
+        ierr = VecGhostRestoreLocalForm(d_global_vec, &d_ghosted_local_vec);
+        IBTK_CHKERRQ(ierr);
+        d_ghosted_local_vec = nullptr;
+        d_restore_after_write_access = false;
+    }
+    return;
+} // releaseArray
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
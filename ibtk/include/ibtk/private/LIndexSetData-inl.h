@@ -112,6 +112,34 @@ LIndexSetData<T>::getGhostPeriodicShifts() const
     return d_ghost_periodic_shifts;
 } // getGhostPeriodicShifts
 
+template <class T>
+const std::vector<int>&
+LIndexSetData<T>::getActiveLocalPETScIndices() const
+{
+    return d_has_inactive_indices ? d_active_local_petsc_indices : d_local_petsc_indices;
+} // getActiveLocalPETScIndices
+
+template <class T>
+const std::vector<int>&
+LIndexSetData<T>::getInteriorActiveLocalPETScIndices() const
+{
+    return d_has_inactive_indices ? d_interior_active_local_petsc_indices : d_interior_local_petsc_indices;
+} // getInteriorActiveLocalPETScIndices
+
+template <class T>
+const std::vector<double>&
+LIndexSetData<T>::getActivePeriodicShifts() const
+{
+    return d_has_inactive_indices ? d_active_periodic_shifts : d_periodic_shifts;
+} // getActivePeriodicShifts
+
+template <class T>
+const std::vector<double>&
+LIndexSetData<T>::getInteriorActivePeriodicShifts() const
+{
+    return d_has_inactive_indices ? d_interior_active_periodic_shifts : d_interior_periodic_shifts;
+} // getInteriorActivePeriodicShifts
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -21,6 +21,9 @@
 #include <ibtk/config.h>
 
 #include "ibtk/LMesh.h"
+#include "ibtk/LNode.h"
+
+#include <utility>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -42,8 +45,45 @@ LMesh::getGhostNodes() const
     return d_ghost_nodes;
 } // getGhostNodes
 
+template <class T>
+inline const std::vector<T*>&
+LMesh::getLocalNodeDataColumn() const
+{
+    return getNodeDataColumns<T>().local;
+} // getLocalNodeDataColumn
+
+template <class T>
+inline const std::vector<T*>&
+LMesh::getGhostNodeDataColumn() const
+{
+    return getNodeDataColumns<T>().ghost;
+} // getGhostNodeDataColumn
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+template <class T>
+inline const LMesh::NodeDataColumns<T>&
+LMesh::getNodeDataColumns() const
+{
+    std::unique_ptr<NodeDataColumnsBase>& columns_base = d_node_data_columns[T::STREAMABLE_CLASS_ID];
+    if (!columns_base)
+    {
+        std::unique_ptr<NodeDataColumns<T> > columns(new NodeDataColumns<T>());
+        columns->local.reserve(d_local_nodes.size());
+        for (const LNode* const node : d_local_nodes)
+        {
+            columns->local.push_back(node->getNodeDataItem<T>());
+        }
+        columns->ghost.reserve(d_ghost_nodes.size());
+        for (const LNode* const node : d_ghost_nodes)
+        {
+            columns->ghost.push_back(node->getNodeDataItem<T>());
+        }
+        columns_base = std::move(columns);
+    }
+    return static_cast<const NodeDataColumns<T>&>(*columns_base);
+} // getNodeDataColumns
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
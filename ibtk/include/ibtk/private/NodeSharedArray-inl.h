@@ -0,0 +1,137 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_NodeSharedArray_inl_h
+#define included_IBTK_NodeSharedArray_inl_h
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "ibtk/NodeSharedArray.h"
+
+#include "tbox/Utilities.h"
+
+#include <mpi.h>
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+template <class T>
+inline NodeSharedArray<T>::NodeSharedArray(const std::size_t size, MPI_Comm node_communicator) : d_size(size)
+{
+    MPI_Comm_dup(node_communicator, &d_node_communicator);
+    int node_rank = 0;
+    MPI_Comm_rank(d_node_communicator, &node_rank);
+    d_is_node_root = node_rank == 0;
+
+    // Only the node root contributes memory to the window; the other
+    // processes query the address of the memory of the node root.
+    const MPI_Aint num_bytes = d_is_node_root ? static_cast<MPI_Aint>(d_size * sizeof(T)) : 0;
+    void* base = nullptr;
+    const int ierr =
+        MPI_Win_allocate_shared(num_bytes, sizeof(T), MPI_INFO_NULL, d_node_communicator, &base, &d_window);
+    if (ierr != MPI_SUCCESS)
+    {
+        TBOX_ERROR("NodeSharedArray::NodeSharedArray():\n"
+                   << "  unable to allocate " << d_size << " entries of node-shared memory" << std::endl);
+    }
+    MPI_Aint root_num_bytes = 0;
+    int disp_unit = 0;
+    MPI_Win_shared_query(d_window, 0, &root_num_bytes, &disp_unit, &base);
+    d_data = static_cast<T*>(base);
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, d_window);
+    return;
+} // NodeSharedArray
+
+template <class T>
+inline NodeSharedArray<T>::~NodeSharedArray()
+{
+    MPI_Win_unlock_all(d_window);
+    MPI_Win_free(&d_window);
+    MPI_Comm_free(&d_node_communicator);
+    return;
+} // ~NodeSharedArray
+
+template <class T>
+inline bool
+NodeSharedArray<T>::isNodeRoot() const
+{
+    return d_is_node_root;
+} // isNodeRoot
+
+template <class T>
+inline void
+NodeSharedArray<T>::synchronize()
+{
+    MPI_Win_sync(d_window);
+    MPI_Barrier(d_node_communicator);
+    MPI_Win_sync(d_window);
+    return;
+} // synchronize
+
+template <class T>
+inline std::size_t
+NodeSharedArray<T>::size() const
+{
+    return d_size;
+} // size
+
+template <class T>
+inline T*
+NodeSharedArray<T>::data()
+{
+    return d_data;
+} // data
+
+template <class T>
+inline const T*
+NodeSharedArray<T>::data() const
+{
+    return d_data;
+} // data
+
+template <class T>
+inline T&
+NodeSharedArray<T>::operator[](const std::size_t i)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(i < d_size);
+#endif
+    return d_data[i];
+} // operator[]
+
+template <class T>
+inline const T&
+NodeSharedArray<T>::operator[](const std::size_t i) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(i < d_size);
+#endif
+    return d_data[i];
+} // operator[]
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_NodeSharedArray_inl_h
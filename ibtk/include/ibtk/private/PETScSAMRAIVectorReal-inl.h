@@ -90,6 +90,7 @@ PETScSAMRAIVectorReal::restoreSAMRAIVector(
     TBOX_ASSERT(psv->d_samrai_vector.getPointer() == *samrai_vec);
 #endif
     psv->d_vector_checked_out_read_write = false;
+    psv->d_data_spans_valid = false;
     *samrai_vec = NULL;
     int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(petsc_vec));
     IBTK_CHKERRQ(ierr);
@@ -144,6 +145,7 @@ PETScSAMRAIVectorReal::replaceSAMRAIVector(
     TBOX_ASSERT(psv);
 #endif
     psv->d_samrai_vector = samrai_vec;
+    psv->d_data_spans_valid = false;
     int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(petsc_vec));
     IBTK_CHKERRQ(ierr);
 }
@@ -21,6 +21,7 @@
 #include <ibtk/config.h>
 
 #include "ibtk/Streamable.h"
+#include "ibtk/StreamableFactory.h"
 #include "ibtk/StreamableManager.h"
 
 #include "tbox/AbstractStream.h"
@@ -41,10 +42,16 @@ StreamableManager::getDataStreamSize(const SAMRAI::tbox::Pointer<Streamable> dat
 inline size_t
 StreamableManager::getDataStreamSize(const std::vector<SAMRAI::tbox::Pointer<Streamable> >& data_items) const
 {
+    // Each run of consecutive objects of the same class is preceded by the
+    // class ID and the length of the run.
     size_t size = SAMRAI::tbox::AbstractStream::sizeofInt();
+    int prev_streamable_id = getUnregisteredID();
     for (const auto& data_item : data_items)
     {
-        size += getDataStreamSize(data_item);
+        const int streamable_id = data_item->getStreamableClassID();
+        if (streamable_id != prev_streamable_id) size += 2 * SAMRAI::tbox::AbstractStream::sizeofInt();
+        prev_streamable_id = streamable_id;
+        size += data_item->getDataStreamSize();
     }
     return size;
 } // getDataStreamSize
@@ -67,9 +74,24 @@ StreamableManager::packStream(SAMRAI::tbox::AbstractStream& stream,
 {
     const int num_data = static_cast<int>(data_items.size());
     stream.pack(&num_data, 1);
-    for (auto& data_item : data_items)
+    for (int k = 0; k < num_data;)
     {
-        packStream(stream, data_item);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(data_items[k]);
+#endif
+        const int streamable_id = data_items[k]->getStreamableClassID();
+        int run_length = 1;
+        while (k + run_length < num_data && data_items[k + run_length]->getStreamableClassID() == streamable_id)
+        {
+            ++run_length;
+        }
+#if !defined(NDEBUG)
+        TBOX_ASSERT(d_factory_map.count(streamable_id) == 1);
+#endif
+        stream.pack(&streamable_id, 1);
+        stream.pack(&run_length, 1);
+        d_factory_map[streamable_id]->packStreams(stream, &data_items[k], run_length);
+        k += run_length;
     }
     return;
 } // packStream
@@ -93,9 +115,17 @@ StreamableManager::unpackStream(SAMRAI::tbox::AbstractStream& stream,
     int num_data;
     stream.unpack(&num_data, 1);
     data_items.resize(num_data);
-    for (auto& data_item : data_items)
+    for (int k = 0; k < num_data;)
     {
-        data_item = unpackStream(stream, offset);
+        int streamable_id, run_length;
+        stream.unpack(&streamable_id, 1);
+        stream.unpack(&run_length, 1);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(d_factory_map.count(streamable_id) == 1);
+        TBOX_ASSERT(run_length > 0 && k + run_length <= num_data);
+#endif
+        d_factory_map[streamable_id]->unpackStreams(stream, offset, &data_items[k], run_length);
+        k += run_length;
     }
     std::vector<SAMRAI::tbox::Pointer<Streamable> >(data_items).swap(data_items); // trim-to-fit
     return;
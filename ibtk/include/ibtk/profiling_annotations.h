@@ -0,0 +1,119 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_profiling_annotations
+#define included_IBTK_profiling_annotations
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#if defined(IBTK_HAVE_CALIPER)
+#include <caliper/cali.h>
+#elif defined(IBTK_HAVE_NVTX)
+#include <nvToolsExt.h>
+#elif defined(IBTK_HAVE_ITT)
+#include <ittnotify.h>
+#endif
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+/*
+ * Annotations of the regions of the code that are most relevant to
+ * performance, which make the phases of a time step visible in external
+ * profilers.  The annotations are forwarded to the profiling library selected
+ * at configure time by IBAMR_PROFILING_ANNOTATIONS (Caliper, NVTX, or Intel
+ * ITT) and compile to nothing otherwise.
+ *
+ * A region is annotated from the point at which IBTK_PROFILING_REGION(name) is
+ * used to the end of the enclosing scope, e.g.,
+ *
+ * \code
+ * void
+ * IBFEMethod::spreadForce(...)
+ * {
+ *     IBTK_PROFILING_REGION("IBFEMethod::spreadForce");
+ *     ...
+ * }
+ * \endcode
+ *
+ * The name must be a string literal (or otherwise outlive the region).
+ */
+#if defined(IBTK_HAVE_CALIPER) || defined(IBTK_HAVE_NVTX) || defined(IBTK_HAVE_ITT)
+namespace IBTK
+{
+#if defined(IBTK_HAVE_ITT)
+/*!
+ * Return the ITT domain in which all IBAMR regions are annotated.
+ */
+inline __itt_domain*
+get_itt_domain()
+{
+    static __itt_domain* const domain = __itt_domain_create("IBAMR");
+    return domain;
+} // get_itt_domain
+#endif
+
+/*!
+ * \brief Class ProfilingRegion annotates a region of the code from its
+ * construction to its destruction.
+ */
+class ProfilingRegion
+{
+public:
+    explicit ProfilingRegion(const char* const name) : d_name(name)
+    {
+#if defined(IBTK_HAVE_CALIPER)
+        cali_begin_region(d_name);
+#elif defined(IBTK_HAVE_NVTX)
+        nvtxRangePushA(d_name);
+#elif defined(IBTK_HAVE_ITT)
+        __itt_task_begin(get_itt_domain(), __itt_null, __itt_null, __itt_string_handle_create(d_name));
+#endif
+        return;
+    } // ProfilingRegion
+
+    ~ProfilingRegion()
+    {
+#if defined(IBTK_HAVE_CALIPER)
+        cali_end_region(d_name);
+#elif defined(IBTK_HAVE_NVTX)
+        nvtxRangePop();
+#elif defined(IBTK_HAVE_ITT)
+        __itt_task_end(get_itt_domain());
+#endif
+        return;
+    } // ~ProfilingRegion
+
+private:
+    ProfilingRegion() = delete;
+    ProfilingRegion(const ProfilingRegion& from) = delete;
+    ProfilingRegion& operator=(const ProfilingRegion& that) = delete;
+
+    const char* const d_name;
+};
+} // namespace IBTK
+
+#define IBTK_PROFILING_REGION_CONCAT_IMPL(a, b) a##b
+#define IBTK_PROFILING_REGION_CONCAT(a, b) IBTK_PROFILING_REGION_CONCAT_IMPL(a, b)
+#define IBTK_PROFILING_REGION(name)                                                                                    \
+    IBTK::ProfilingRegion IBTK_PROFILING_REGION_CONCAT(ibtk_profiling_region_, __LINE__)(name)
+#else
+#define IBTK_PROFILING_REGION(name)
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_profiling_annotations
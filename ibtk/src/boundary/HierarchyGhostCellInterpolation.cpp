@@ -21,9 +21,12 @@
 #include "ibtk/CartSideDoubleQuadraticCFInterpolation.h"
 #include "ibtk/CartSideRobinPhysBdryOp.h"
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
+#include "ibtk/CommunicationStatistics.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/PersistentGhostFillSchedule.h"
 #include "ibtk/RefinePatchStrategySet.h"
 #include "ibtk/ibtk_utilities.h"
+#include "ibtk/profiling_annotations.h"
 
 #include "Box.h"
 #include "CartesianGridGeometry.h"
@@ -35,6 +38,7 @@
 #include "NodeVariable.h"
 #include "Patch.h"
 #include "PatchData.h"
+#include "PatchDescriptor.h"
 #include "PatchGeometry.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
@@ -127,6 +131,13 @@ HierarchyGhostCellInterpolation::setHomogeneousBc(const bool homogeneous_bc)
     return;
 } // setHomogeneousBc
 
+void
+HierarchyGhostCellInterpolation::setUsePersistentSchedules(const bool use_persistent_schedules)
+{
+    d_use_persistent_schedules = use_persistent_schedules;
+    return;
+} // setUsePersistentSchedules
+
 void
 HierarchyGhostCellInterpolation::initializeOperatorState(const InterpolationTransactionComponent transaction_comp,
                                                          const Pointer<PatchHierarchy<NDIM> > hierarchy,
@@ -326,6 +337,7 @@ HierarchyGhostCellInterpolation::initializeOperatorState(
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(dst_ln);
         d_refine_scheds[dst_ln] = d_refine_alg->createSchedule(level, dst_ln - 1, d_hierarchy, d_refine_strategy.get());
     }
+    resetPersistentSchedule();
 
     // Setup physical BC type.
     setHomogeneousBc(d_homogeneous_bc);
@@ -373,6 +385,10 @@ HierarchyGhostCellInterpolation::resetTransactionComponents(
                       "interpolation transaction components.\n");
     }
 
+    // Determine whether the persistent schedule can be reused with the new
+    // patch data indices.
+    const bool reuse_persistent_sched = d_persistent_sched && isPersistentScheduleCompatible(transaction_comps);
+
     // Reset the transaction components.
     d_transaction_comps = transaction_comps;
 
@@ -510,6 +526,20 @@ HierarchyGhostCellInterpolation::resetTransactionComponents(
     {
         d_refine_alg->resetSchedule(d_refine_scheds[dst_ln]);
     }
+    if (reuse_persistent_sched)
+    {
+        std::vector<int> dst_data_idxs, src_data_idxs;
+        for (const auto& transaction_comp : d_transaction_comps)
+        {
+            dst_data_idxs.push_back(transaction_comp.d_dst_data_idx);
+            src_data_idxs.push_back(transaction_comp.d_src_data_idx);
+        }
+        d_persistent_sched->setDataIndices(dst_data_idxs, src_data_idxs);
+    }
+    else
+    {
+        resetPersistentSchedule();
+    }
 
     IBTK_TIMER_STOP(t_reset_transaction_components);
     return;
@@ -549,6 +579,7 @@ HierarchyGhostCellInterpolation::deallocateOperatorState()
     d_refine_alg.setNull();
     d_refine_strategy = nullptr;
     d_refine_scheds.clear();
+    d_persistent_sched.reset();
 
     // Indicate that the operator is NOT initialized.
     d_is_initialized = false;
@@ -560,7 +591,9 @@ HierarchyGhostCellInterpolation::deallocateOperatorState()
 void
 HierarchyGhostCellInterpolation::fillData(double fill_time)
 {
+    IBTK_PROFILING_REGION("HierarchyGhostCellInterpolation::fillData");
     IBTK_TIMER_START(t_fill_data);
+    CommunicationStatistics::ScopedPhase communication_phase("ghost_fill");
 
 #if !defined(NDEBUG)
     TBOX_ASSERT(d_is_initialized);
@@ -586,26 +619,117 @@ HierarchyGhostCellInterpolation::fillData(double fill_time)
     IBTK_TIMER_START(t_fill_data_refine);
     for (int dst_ln = d_coarsest_ln; dst_ln <= d_finest_ln; ++dst_ln)
     {
-        if (d_refine_scheds[dst_ln]) d_refine_scheds[dst_ln]->fillData(fill_time);
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(dst_ln);
-        const IntVector<NDIM>& ratio = level->getRatioToCoarserLevel();
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        if (dst_ln == 0 && d_persistent_sched)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
-            {
-                if (d_cf_bdry_ops[comp_idx])
-                {
-                    const int dst_data_idx = d_transaction_comps[comp_idx].d_dst_data_idx;
-                    const IntVector<NDIM>& ghost_width_to_fill = patch->getPatchData(dst_data_idx)->getGhostCellWidth();
-                    d_cf_bdry_ops[comp_idx]->computeNormalExtension(*patch, ratio, ghost_width_to_fill);
-                }
-            }
+            d_persistent_sched->fillData(fill_time);
+        }
+        else if (d_refine_scheds[dst_ln])
+        {
+            d_refine_scheds[dst_ln]->fillData(fill_time);
         }
+        computeNormalExtensions(dst_ln);
     }
     IBTK_TIMER_STOP(t_fill_data_refine);
 
     // Set Robin boundary conditions at physical boundaries.
+    setPhysicalBoundaryConditions(fill_time);
+
+    IBTK_TIMER_STOP(t_fill_data);
+    return;
+} // fillData
+
+bool
+HierarchyGhostCellInterpolation::supportsSplitFillData() const
+{
+    return d_is_initialized && d_persistent_sched && d_coarsest_ln == 0 && d_finest_ln == 0;
+} // supportsSplitFillData
+
+void
+HierarchyGhostCellInterpolation::beginFillData(double fill_time)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_is_initialized);
+    TBOX_ASSERT(!d_fill_data_in_progress);
+#endif
+    d_fill_data_in_progress = true;
+    if (!supportsSplitFillData())
+    {
+        fillData(fill_time);
+        return;
+    }
+
+    IBTK_TIMER_START(t_fill_data);
+
+    // Ensure the boundary condition objects are in the correct state.
+    for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
+    {
+        if (d_cc_robin_bc_ops[comp_idx]) d_cc_robin_bc_ops[comp_idx]->setHomogeneousBc(d_homogeneous_bc);
+        if (d_sc_robin_bc_ops[comp_idx]) d_sc_robin_bc_ops[comp_idx]->setHomogeneousBc(d_homogeneous_bc);
+    }
+
+    // Start communicating data.  There are no coarser levels, so no data need
+    // to be synchronized.
+    IBTK_TIMER_START(t_fill_data_refine);
+    d_persistent_sched->beginFillData();
+    IBTK_TIMER_STOP(t_fill_data_refine);
+
+    IBTK_TIMER_STOP(t_fill_data);
+    return;
+} // beginFillData
+
+void
+HierarchyGhostCellInterpolation::endFillData(double fill_time)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_fill_data_in_progress);
+#endif
+    d_fill_data_in_progress = false;
+    if (!supportsSplitFillData()) return;
+
+    IBTK_TIMER_START(t_fill_data);
+
+    // Finish communicating data, using extrapolation to determine ghost cell
+    // values at physical boundaries.
+    IBTK_TIMER_START(t_fill_data_refine);
+    d_persistent_sched->endFillData(fill_time);
+    computeNormalExtensions(0);
+    IBTK_TIMER_STOP(t_fill_data_refine);
+
+    // Set Robin boundary conditions at physical boundaries.
+    setPhysicalBoundaryConditions(fill_time);
+
+    IBTK_TIMER_STOP(t_fill_data);
+    return;
+} // endFillData
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+HierarchyGhostCellInterpolation::computeNormalExtensions(const int ln)
+{
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+    const IntVector<NDIM>& ratio = level->getRatioToCoarserLevel();
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
+        {
+            if (d_cf_bdry_ops[comp_idx])
+            {
+                const int dst_data_idx = d_transaction_comps[comp_idx].d_dst_data_idx;
+                const IntVector<NDIM>& ghost_width_to_fill = patch->getPatchData(dst_data_idx)->getGhostCellWidth();
+                d_cf_bdry_ops[comp_idx]->computeNormalExtension(*patch, ratio, ghost_width_to_fill);
+            }
+        }
+    }
+    return;
+} // computeNormalExtensions
+
+void
+HierarchyGhostCellInterpolation::setPhysicalBoundaryConditions(const double fill_time)
+{
     IBTK_TIMER_START(t_fill_data_set_physical_bcs);
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
@@ -638,14 +762,64 @@ HierarchyGhostCellInterpolation::fillData(double fill_time)
         }
     }
     IBTK_TIMER_STOP(t_fill_data_set_physical_bcs);
-
-    IBTK_TIMER_STOP(t_fill_data);
     return;
-} // fillData
+} // setPhysicalBoundaryConditions
 
-/////////////////////////////// PROTECTED ////////////////////////////////////
+void
+HierarchyGhostCellInterpolation::resetPersistentSchedule()
+{
+    d_persistent_sched.reset();
+    if (!d_use_persistent_schedules || d_coarsest_ln != 0) return;
+
+    // Persistent schedules only perform same-level copies, so they are only
+    // used on the coarsest level of the patch hierarchy.
+    const unsigned int num_comps = static_cast<unsigned int>(d_transaction_comps.size());
+    std::vector<int> dst_data_idxs(num_comps), src_data_idxs(num_comps);
+    std::vector<Pointer<VariableFillPattern<NDIM> > > fill_patterns(num_comps);
+    for (unsigned int comp_idx = 0; comp_idx < num_comps; ++comp_idx)
+    {
+        dst_data_idxs[comp_idx] = d_transaction_comps[comp_idx].d_dst_data_idx;
+        src_data_idxs[comp_idx] = d_transaction_comps[comp_idx].d_src_data_idx;
+        fill_patterns[comp_idx] = d_transaction_comps[comp_idx].d_fill_pattern;
+    }
+    d_persistent_sched.reset(new PersistentGhostFillSchedule(
+        d_hierarchy->getPatchLevel(0), dst_data_idxs, src_data_idxs, fill_patterns, d_refine_strategy.get()));
+    return;
+} // resetPersistentSchedule
 
-/////////////////////////////// PRIVATE //////////////////////////////////////
+bool
+HierarchyGhostCellInterpolation::isPersistentScheduleCompatible(
+    const std::vector<InterpolationTransactionComponent>& transaction_comps) const
+{
+    // The overlaps and message sizes cached by the persistent schedule only
+    // depend on the variables, the ghost cell widths, and the fill patterns.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<PatchDescriptor<NDIM> > patch_descriptor = var_db->getPatchDescriptor();
+    auto compatible_data_idxs = [&](const int idx1, const int idx2) {
+        if (idx1 == idx2) return true;
+        Pointer<Variable<NDIM> > var1, var2;
+        var_db->mapIndexToVariable(idx1, var1);
+        var_db->mapIndexToVariable(idx2, var2);
+        if (!var1 || var1 != var2) return false;
+        return patch_descriptor->getPatchDataFactory(idx1)->getGhostCellWidth() ==
+               patch_descriptor->getPatchDataFactory(idx2)->getGhostCellWidth();
+    };
+    if (transaction_comps.size() != d_transaction_comps.size()) return false;
+    for (unsigned int comp_idx = 0; comp_idx < transaction_comps.size(); ++comp_idx)
+    {
+        const InterpolationTransactionComponent& old_comp = d_transaction_comps[comp_idx];
+        const InterpolationTransactionComponent& new_comp = transaction_comps[comp_idx];
+        if (old_comp.d_fill_pattern != new_comp.d_fill_pattern) return false;
+        if ((old_comp.d_dst_data_idx == old_comp.d_src_data_idx) !=
+            (new_comp.d_dst_data_idx == new_comp.d_src_data_idx))
+        {
+            return false;
+        }
+        if (!compatible_data_idxs(old_comp.d_dst_data_idx, new_comp.d_dst_data_idx)) return false;
+        if (!compatible_data_idxs(old_comp.d_src_data_idx, new_comp.d_src_data_idx)) return false;
+    }
+    return true;
+} // isPersistentScheduleCompatible
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
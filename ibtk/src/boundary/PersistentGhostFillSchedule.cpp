@@ -0,0 +1,376 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/FixedSizedStream.h"
+#include "ibtk/CommunicationStatistics.h"
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/PersistentGhostFillSchedule.h"
+#include "ibtk/TelemetryManager.h"
+
+#include "Box.h"
+#include "BoxArray.h"
+#include "BoxGeometry.h"
+#include "BoxOverlap.h"
+#include "GridGeometry.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchData.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
+#include "PatchGeometry.h"
+#include "PatchLevel.h"
+#include "ProcessorMapping.h"
+#include "RefinePatchStrategy.h"
+#include "VariableFillPattern.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Each schedule uses its own communicator, so a fixed tag suffices.
+static const int GHOST_FILL_MPI_TAG = 0;
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+PersistentGhostFillSchedule::PersistentGhostFillSchedule(
+    Pointer<PatchLevel<NDIM> > level,
+    const std::vector<int>& dst_data_idxs,
+    const std::vector<int>& src_data_idxs,
+    const std::vector<Pointer<VariableFillPattern<NDIM> > >& fill_patterns,
+    RefinePatchStrategy<NDIM>* const refine_strategy)
+    : d_level(level),
+      d_dst_data_idxs(dst_data_idxs),
+      d_src_data_idxs(src_data_idxs),
+      d_refine_strategy(refine_strategy),
+      d_ghost_width_to_fill(0)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_level);
+    TBOX_ASSERT(d_dst_data_idxs.size() == d_src_data_idxs.size());
+    TBOX_ASSERT(d_dst_data_idxs.size() == fill_patterns.size());
+#endif
+    MPI_Comm_dup(IBTK_MPI::getCommunicator(), &d_communicator);
+    const unsigned int num_comps = static_cast<unsigned int>(d_dst_data_idxs.size());
+    Pointer<PatchDescriptor<NDIM> > patch_descriptor = d_level->getPatchDescriptor();
+    std::vector<Pointer<PatchDataFactory<NDIM> > > dst_pdat_factories(num_comps), src_pdat_factories(num_comps);
+    for (unsigned int comp_idx = 0; comp_idx < num_comps; ++comp_idx)
+    {
+        dst_pdat_factories[comp_idx] = patch_descriptor->getPatchDataFactory(d_dst_data_idxs[comp_idx]);
+        src_pdat_factories[comp_idx] = patch_descriptor->getPatchDataFactory(d_src_data_idxs[comp_idx]);
+        const IntVector<NDIM>& ghost_width = dst_pdat_factories[comp_idx]->getGhostCellWidth();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            d_ghost_width_to_fill(d) = std::max(d_ghost_width_to_fill(d), ghost_width(d));
+        }
+    }
+
+    // Determine the periodic images of the level that can contribute data.
+    Pointer<GridGeometry<NDIM> > grid_geom = d_level->getGridGeometry();
+    const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(d_level->getRatio());
+    std::vector<IntVector<NDIM> > shifts(1, IntVector<NDIM>(0));
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        if (periodic_shift(axis) == 0) continue;
+        const std::size_t num_shifts = shifts.size();
+        for (std::size_t k = 0; k < num_shifts; ++k)
+        {
+            for (int sgn = -1; sgn <= 1; sgn += 2)
+            {
+                IntVector<NDIM> shift = shifts[k];
+                shift(axis) += sgn * periodic_shift(axis);
+                shifts.push_back(shift);
+            }
+        }
+    }
+
+    // Compute the overlaps between each pair of patches in which at least one
+    // of the patches is local.  Both the sending and the receiving processor
+    // sort the transactions in a message in the same way, so that the data can
+    // be packed and unpacked without any additional metadata.
+    const BoxArray<NDIM>& boxes = d_level->getBoxes();
+    const ProcessorMapping& proc_mapping = d_level->getProcessorMapping();
+    const int num_patches = d_level->getNumberOfPatches();
+    const IntVector<NDIM> search_width = d_ghost_width_to_fill + IntVector<NDIM>(1);
+    auto add_transactions =
+        [&](const int dst_patch_num, const int src_patch_num, std::vector<Transaction>& transactions) {
+            const Box<NDIM>& dst_box = boxes[dst_patch_num];
+            const Box<NDIM>& src_box = boxes[src_patch_num];
+            const Box<NDIM> dst_search_box = Box<NDIM>::grow(dst_box, search_width);
+            for (unsigned int shift_num = 0; shift_num < shifts.size(); ++shift_num)
+            {
+                // The mask is given in the index space of the source patch:
+                // the overlap calculation applies the periodic shift itself.
+                if ((dst_search_box * Box<NDIM>::shift(src_box, shifts[shift_num])).empty()) continue;
+                const Box<NDIM>& src_mask = src_box;
+                for (unsigned int comp_idx = 0; comp_idx < num_comps; ++comp_idx)
+                {
+                    if (dst_patch_num == src_patch_num && shift_num == 0 &&
+                        d_dst_data_idxs[comp_idx] == d_src_data_idxs[comp_idx])
+                    {
+                        continue;
+                    }
+                    Pointer<BoxGeometry<NDIM> > dst_box_geometry =
+                        dst_pdat_factories[comp_idx]->getBoxGeometry(dst_box);
+                    Pointer<BoxGeometry<NDIM> > src_box_geometry =
+                        src_pdat_factories[comp_idx]->getBoxGeometry(src_box);
+                    const bool overwrite_interior = true;
+                    Pointer<BoxOverlap<NDIM> > overlap =
+                        fill_patterns[comp_idx] ?
+                            fill_patterns[comp_idx]->calculateOverlap(*dst_box_geometry,
+                                                                      *src_box_geometry,
+                                                                      dst_box,
+                                                                      src_mask,
+                                                                      overwrite_interior,
+                                                                      shifts[shift_num]) :
+                            dst_box_geometry->calculateOverlap(
+                                *src_box_geometry, src_mask, overwrite_interior, shifts[shift_num]);
+                    if (overlap->isOverlapEmpty()) continue;
+                    Transaction transaction;
+                    transaction.dst_patch_num = dst_patch_num;
+                    transaction.src_patch_num = src_patch_num;
+                    transaction.shift_num = static_cast<int>(shift_num);
+                    transaction.comp_idx = comp_idx;
+                    transaction.overlap = overlap;
+                    transactions.push_back(transaction);
+                }
+            }
+        };
+
+    const int rank = IBTK_MPI::getRank();
+    std::map<int, std::vector<Transaction> > send_transactions, recv_transactions;
+    for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+    {
+        const int local_patch_num = p();
+        for (int patch_num = 0; patch_num < num_patches; ++patch_num)
+        {
+            const int patch_rank = proc_mapping.getProcessorAssignment(patch_num);
+            if (patch_rank == rank)
+            {
+                add_transactions(local_patch_num, patch_num, d_local_transactions);
+            }
+            else
+            {
+                add_transactions(patch_num, local_patch_num, send_transactions[patch_rank]);
+                add_transactions(local_patch_num, patch_num, recv_transactions[patch_rank]);
+            }
+        }
+    }
+    for (auto& rank_transactions : send_transactions)
+    {
+        if (rank_transactions.second.empty()) continue;
+        std::sort(rank_transactions.second.begin(), rank_transactions.second.end());
+        Message message;
+        message.rank = rank_transactions.first;
+        message.transactions = std::move(rank_transactions.second);
+        d_send_messages.push_back(std::move(message));
+    }
+    for (auto& rank_transactions : recv_transactions)
+    {
+        if (rank_transactions.second.empty()) continue;
+        std::sort(rank_transactions.second.begin(), rank_transactions.second.end());
+        Message message;
+        message.rank = rank_transactions.first;
+        message.transactions = std::move(rank_transactions.second);
+        d_recv_messages.push_back(std::move(message));
+    }
+    return;
+} // PersistentGhostFillSchedule
+
+PersistentGhostFillSchedule::~PersistentGhostFillSchedule()
+{
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if (finalized) return;
+    for (auto& request : d_send_requests)
+    {
+        if (request != MPI_REQUEST_NULL) MPI_Request_free(&request);
+    }
+    for (auto& request : d_recv_requests)
+    {
+        if (request != MPI_REQUEST_NULL) MPI_Request_free(&request);
+    }
+    if (d_communicator != MPI_COMM_NULL) MPI_Comm_free(&d_communicator);
+    return;
+} // ~PersistentGhostFillSchedule
+
+void
+PersistentGhostFillSchedule::setDataIndices(const std::vector<int>& dst_data_idxs,
+                                            const std::vector<int>& src_data_idxs)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(dst_data_idxs.size() == d_dst_data_idxs.size());
+    TBOX_ASSERT(src_data_idxs.size() == d_src_data_idxs.size());
+#endif
+    d_dst_data_idxs = dst_data_idxs;
+    d_src_data_idxs = src_data_idxs;
+    return;
+} // setDataIndices
+
+void
+PersistentGhostFillSchedule::fillData(const double fill_time)
+{
+    beginFillData();
+    endFillData(fill_time);
+    return;
+} // fillData
+
+void
+PersistentGhostFillSchedule::beginFillData()
+{
+    // The message sizes depend on the patch data, which need not be allocated
+    // when the schedule is constructed, so the message buffers and persistent
+    // requests are set up the first time that data are communicated.
+    if (!d_requests_initialized) initializeRequests();
+
+    // Post the receives, pack and send the outgoing data, and copy data between
+    // local patches while the messages are in flight.
+    if (!d_recv_requests.empty()) MPI_Startall(static_cast<int>(d_recv_requests.size()), &d_recv_requests[0]);
+    double num_bytes_sent = 0.0;
+    for (auto& message : d_send_messages)
+    {
+        message.stream->resetIndex();
+        for (const auto& transaction : message.transactions)
+        {
+            Pointer<Patch<NDIM> > patch = d_level->getPatch(transaction.src_patch_num);
+            patch->getPatchData(d_src_data_idxs[transaction.comp_idx])->packStream(*message.stream,
+                                                                                    *transaction.overlap);
+        }
+        num_bytes_sent += message.stream->getCurrentIndex();
+        if (CommunicationStatistics::enabled())
+        {
+            CommunicationStatistics::ScopedPhase phase("ghost_fill");
+            CommunicationStatistics::getManager()->recordSend(message.rank, message.stream->getCurrentIndex());
+        }
+    }
+    if (!d_send_requests.empty()) MPI_Startall(static_cast<int>(d_send_requests.size()), &d_send_requests[0]);
+    TelemetryManager::getManager()->addToMetric("ghost_fill_bytes_sent", num_bytes_sent);
+
+    for (const auto& transaction : d_local_transactions)
+    {
+        Pointer<Patch<NDIM> > dst_patch = d_level->getPatch(transaction.dst_patch_num);
+        Pointer<Patch<NDIM> > src_patch = d_level->getPatch(transaction.src_patch_num);
+        dst_patch->getPatchData(d_dst_data_idxs[transaction.comp_idx])
+            ->copy(*src_patch->getPatchData(d_src_data_idxs[transaction.comp_idx]), *transaction.overlap);
+    }
+    return;
+} // beginFillData
+
+void
+PersistentGhostFillSchedule::endFillData(const double fill_time)
+{
+    // Unpack the incoming data.
+    if (!d_recv_requests.empty())
+    {
+        MPI_Waitall(static_cast<int>(d_recv_requests.size()), &d_recv_requests[0], MPI_STATUSES_IGNORE);
+    }
+    for (auto& message : d_recv_messages)
+    {
+        message.stream->resetIndex();
+        for (const auto& transaction : message.transactions)
+        {
+            Pointer<Patch<NDIM> > patch = d_level->getPatch(transaction.dst_patch_num);
+            patch->getPatchData(d_dst_data_idxs[transaction.comp_idx])->unpackStream(*message.stream,
+                                                                                      *transaction.overlap);
+        }
+    }
+    if (!d_send_requests.empty())
+    {
+        MPI_Waitall(static_cast<int>(d_send_requests.size()), &d_send_requests[0], MPI_STATUSES_IGNORE);
+    }
+
+    // Set physical boundary conditions.
+    if (d_refine_strategy)
+    {
+        for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
+            if (patch->getPatchGeometry()->getTouchesRegularBoundary())
+            {
+                d_refine_strategy->setPhysicalBoundaryConditions(*patch, fill_time, d_ghost_width_to_fill);
+            }
+        }
+    }
+    return;
+} // endFillData
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+PersistentGhostFillSchedule::initializeRequests()
+{
+    for (auto& message : d_send_messages)
+    {
+        int size = 0;
+        for (const auto& transaction : message.transactions)
+        {
+            Pointer<Patch<NDIM> > patch = d_level->getPatch(transaction.src_patch_num);
+            size += patch->getPatchData(d_src_data_idxs[transaction.comp_idx])->getDataStreamSize(*transaction.overlap);
+        }
+        message.stream.reset(new FixedSizedStream(size));
+        MPI_Request request;
+        MPI_Send_init(message.stream->getBufferStart(),
+                      size,
+                      MPI_BYTE,
+                      message.rank,
+                      GHOST_FILL_MPI_TAG,
+                      d_communicator,
+                      &request);
+        d_send_requests.push_back(request);
+    }
+    for (auto& message : d_recv_messages)
+    {
+        int size = 0;
+        for (const auto& transaction : message.transactions)
+        {
+            Pointer<Patch<NDIM> > patch = d_level->getPatch(transaction.dst_patch_num);
+            size += patch->getPatchData(d_dst_data_idxs[transaction.comp_idx])->getDataStreamSize(*transaction.overlap);
+        }
+        message.stream.reset(new FixedSizedStream(size));
+        MPI_Request request;
+        MPI_Recv_init(message.stream->getBufferStart(),
+                      size,
+                      MPI_BYTE,
+                      message.rank,
+                      GHOST_FILL_MPI_TAG,
+                      d_communicator,
+                      &request);
+        d_recv_requests.push_back(request);
+    }
+    d_requests_initialized = true;
+    return;
+} // initializeRequests
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -32,9 +32,11 @@
 #include "tbox/Array.h"
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -221,12 +223,12 @@ CartSideDoubleQuadraticCFInterpolation::postprocessRefine(Patch<NDIM>& fine,
         TBOX_ASSERT(&fine == fine_level->getPatch(patch_num).getPointer());
     }
 #endif
-    // Get the co-dimension 1 cf boundary boxes.
+    // Get the precomputed fill boxes of the co-dimension 1 cf boundary boxes.
     const int patch_num = fine.getPatchNumber();
     const int fine_patch_level_num = fine.getPatchLevelNumber();
-    const Array<BoundaryBox<NDIM> >& cf_bdry_codim1_boxes =
-        d_cf_boundary[fine_patch_level_num].getBoundaries(patch_num, 1);
-    if (cf_bdry_codim1_boxes.size() == 0) return;
+    const auto fill_boxes_it = d_cf_bdry_fill_boxes[fine_patch_level_num].find(patch_num);
+    if (fill_boxes_it == d_cf_bdry_fill_boxes[fine_patch_level_num].end()) return;
+    const std::vector<std::pair<Box<NDIM>, unsigned int> >& cf_bdry_fill_boxes = fill_boxes_it->second;
 
     // Get the patch data.
     for (const auto& patch_data_index : d_patch_data_indices)
@@ -258,20 +260,17 @@ CartSideDoubleQuadraticCFInterpolation::postprocessRefine(Patch<NDIM>& fine,
         TBOX_ASSERT((indicator_data->getGhostCellWidth()).min() == GHOST_WIDTH_TO_FILL);
 #endif
         const int data_depth = fdata->getDepth();
-        const IntVector<NDIM> ghost_width_to_fill = GHOST_WIDTH_TO_FILL;
-        Pointer<CartesianPatchGeometry<NDIM> > pgeom_fine = fine.getPatchGeometry();
         const Box<NDIM>& patch_box_fine = fine.getBox();
         const Box<NDIM>& patch_box_crse = coarse.getBox();
-        for (int k = 0; k < cf_bdry_codim1_boxes.size(); ++k)
-        {
-            const BoundaryBox<NDIM>& bdry_box = cf_bdry_codim1_boxes[k];
-            const Box<NDIM> bc_fill_box = pgeom_fine->getBoundaryFillBox(bdry_box, patch_box_fine, ghost_width_to_fill);
-            const unsigned int location_index = bdry_box.getLocationIndex();
-            const int* const indicator0 = indicator_data->getPointer(0);
-            const int* const indicator1 = indicator_data->getPointer(1);
+        const int* const indicator0 = indicator_data->getPointer(0);
+        const int* const indicator1 = indicator_data->getPointer(1);
 #if (NDIM == 3)
-            const int* const indicator2 = indicator_data->getPointer(2);
+        const int* const indicator2 = indicator_data->getPointer(2);
 #endif
+        for (const auto& fill_box : cf_bdry_fill_boxes)
+        {
+            const Box<NDIM>& bc_fill_box = fill_box.first;
+            const unsigned int location_index = fill_box.second;
             for (int depth = 0; depth < data_depth; ++depth)
             {
                 double* const U_fine0 = fdata->getPointer(0, depth);
@@ -379,10 +378,32 @@ CartSideDoubleQuadraticCFInterpolation::setPatchHierarchy(Pointer<PatchHierarchy
     const int finest_level_number = d_hierarchy->getFinestLevelNumber();
 
     d_cf_boundary.resize(finest_level_number + 1);
+    d_cf_bdry_fill_boxes.resize(finest_level_number + 1);
     const IntVector<NDIM>& max_ghost_width = GHOST_WIDTH_TO_FILL;
     for (int ln = 0; ln <= finest_level_number; ++ln)
     {
         d_cf_boundary[ln] = CoarseFineBoundary<NDIM>(*d_hierarchy, ln, max_ghost_width);
+
+        // Cache the fill boxes of the co-dimension 1 cf boundary boxes so that
+        // they are not recomputed each time ghost cells are filled.
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const int patch_num = p();
+            const Array<BoundaryBox<NDIM> >& cf_bdry_codim1_boxes = d_cf_boundary[ln].getBoundaries(patch_num, 1);
+            if (cf_bdry_codim1_boxes.size() == 0) continue;
+            Pointer<Patch<NDIM> > patch = level->getPatch(patch_num);
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const Box<NDIM>& patch_box = patch->getBox();
+            std::vector<std::pair<Box<NDIM>, unsigned int> >& fill_boxes = d_cf_bdry_fill_boxes[ln][patch_num];
+            fill_boxes.reserve(cf_bdry_codim1_boxes.size());
+            for (int k = 0; k < cf_bdry_codim1_boxes.size(); ++k)
+            {
+                const BoundaryBox<NDIM>& bdry_box = cf_bdry_codim1_boxes[k];
+                fill_boxes.emplace_back(pgeom->getBoundaryFillBox(bdry_box, patch_box, max_ghost_width),
+                                        bdry_box.getLocationIndex());
+            }
+        }
     }
 
     Pointer<RefineAlgorithm<NDIM> > refine_alg = new RefineAlgorithm<NDIM>();
@@ -419,6 +440,7 @@ CartSideDoubleQuadraticCFInterpolation::clearPatchHierarchy()
 {
     d_hierarchy.setNull();
     d_cf_boundary.clear();
+    d_cf_bdry_fill_boxes.clear();
     return;
 } // clearPatchHierarchy
 
@@ -446,15 +468,14 @@ CartSideDoubleQuadraticCFInterpolation::computeNormalExtension(Patch<NDIM>& patc
         TBOX_ASSERT(&patch == level->getPatch(patch_num).getPointer());
     }
 #endif
-    // Get the co-dimension 1 cf boundary boxes.
+    // Get the precomputed fill boxes of the co-dimension 1 cf boundary boxes.
+    // If there are no co-dimension 1 coarse-fine boundary boxes associated
+    // with the patch, there is nothing to do.
     const int patch_num = patch.getPatchNumber();
     const int patch_level_num = patch.getPatchLevelNumber();
-    const Array<BoundaryBox<NDIM> >& cf_bdry_codim1_boxes = d_cf_boundary[patch_level_num].getBoundaries(patch_num, 1);
-    const int n_cf_bdry_codim1_boxes = cf_bdry_codim1_boxes.size();
-
-    // Check to see if there are any co-dimension 1 coarse-fine boundary boxes
-    // associated with the patch; if not, there is nothing to do.
-    if (n_cf_bdry_codim1_boxes == 0) return;
+    const auto fill_boxes_it = d_cf_bdry_fill_boxes[patch_level_num].find(patch_num);
+    if (fill_boxes_it == d_cf_bdry_fill_boxes[patch_level_num].end()) return;
+    const std::vector<std::pair<Box<NDIM>, unsigned int> >& cf_bdry_fill_boxes = fill_boxes_it->second;
 
     // Get the patch data.
     for (const auto& patch_data_index : d_patch_data_indices)
@@ -485,19 +506,16 @@ CartSideDoubleQuadraticCFInterpolation::computeNormalExtension(Patch<NDIM>& patc
         TBOX_ASSERT((indicator_data->getGhostCellWidth()).min() == GHOST_WIDTH_TO_FILL);
 #endif
         const int data_depth = data->getDepth();
-        const IntVector<NDIM> ghost_width_to_fill = GHOST_WIDTH_TO_FILL;
-        Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
         const Box<NDIM>& patch_box = patch.getBox();
-        for (int k = 0; k < n_cf_bdry_codim1_boxes; ++k)
-        {
-            const BoundaryBox<NDIM>& bdry_box = cf_bdry_codim1_boxes[k];
-            const Box<NDIM> bc_fill_box = pgeom->getBoundaryFillBox(bdry_box, patch_box, ghost_width_to_fill);
-            const unsigned int location_index = bdry_box.getLocationIndex();
-            const int* const indicator0 = indicator_data->getPointer(0);
-            const int* const indicator1 = indicator_data->getPointer(1);
+        const int* const indicator0 = indicator_data->getPointer(0);
+        const int* const indicator1 = indicator_data->getPointer(1);
 #if (NDIM == 3)
-            const int* const indicator2 = indicator_data->getPointer(2);
+        const int* const indicator2 = indicator_data->getPointer(2);
 #endif
+        for (const auto& fill_box : cf_bdry_fill_boxes)
+        {
+            const Box<NDIM>& bc_fill_box = fill_box.first;
+            const unsigned int location_index = fill_box.second;
             for (int depth = 0; depth < data_depth; ++depth)
             {
                 double* const U0 = data->getPointer(0, depth);
@@ -14,7 +14,6 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include "ibtk/CartSideRobinPhysBdryOp.h"
-#include "ibtk/ExtendedRobinBcCoefStrategy.h"
 #include "ibtk/PhysicalBoundaryUtilities.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 
@@ -661,21 +660,14 @@ CartSideRobinPhysBdryOp::fillGhostCellValuesCodim1Normal(const int patch_data_id
         const BoundaryBox<NDIM> trimmed_bdry_box(
             bdry_box.getBox() * bc_fill_box, bdry_box.getBoundaryType(), location_index);
         const Box<NDIM> bc_coef_box = PhysicalBoundaryUtilities::makeSideBoundaryCodim1Box(trimmed_bdry_box);
-        Pointer<ArrayData<NDIM, double> > acoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
-        Pointer<ArrayData<NDIM, double> > bcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
-        Pointer<ArrayData<NDIM, double> > gcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
         for (int d = 0; d < patch_data_depth; ++d)
         {
             RobinBcCoefStrategy<NDIM>* bc_coef = d_bc_coefs[NDIM * d + bdry_normal_axis];
-            auto const extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
-            if (extended_bc_coef)
-            {
-                extended_bc_coef->setTargetPatchDataIndex(patch_data_idx);
-                extended_bc_coef->setHomogeneousBc(d_homogeneous_bc);
-            }
-            bc_coef->setBcCoefs(acoef_data, bcoef_data, gcoef_data, var, patch, trimmed_bdry_box, fill_time);
-            if (d_homogeneous_bc && !extended_bc_coef) gcoef_data->fillAll(0.0);
-            if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+            const std::array<Pointer<ArrayData<NDIM, double> >, 3>& coef_data =
+                setBcCoefData(bc_coef, patch_data_idx, var, patch, trimmed_bdry_box, bc_coef_box, fill_time);
+            const Pointer<ArrayData<NDIM, double> >& acoef_data = coef_data[0];
+            const Pointer<ArrayData<NDIM, double> >& bcoef_data = coef_data[1];
+            const Pointer<ArrayData<NDIM, double> >& gcoef_data = coef_data[2];
             if (location_index == 0 || location_index == 1)
             {
                 if (d_type == "LINEAR")
@@ -911,9 +903,6 @@ CartSideRobinPhysBdryOp::fillGhostCellValuesCodim1Transverse(const int patch_dat
             {
                 const Box<NDIM> bc_coef_box = compute_tangential_extension(
                     PhysicalBoundaryUtilities::makeSideBoundaryCodim1Box(trimmed_bdry_box), axis);
-                Pointer<ArrayData<NDIM, double> > acoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
-                Pointer<ArrayData<NDIM, double> > bcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
-                Pointer<ArrayData<NDIM, double> > gcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
 
                 // Temporarily reset the patch geometry object associated with
                 // the patch so that boundary conditions are set at the correct
@@ -937,15 +926,11 @@ CartSideRobinPhysBdryOp::fillGhostCellValuesCodim1Transverse(const int patch_dat
                 for (int d = 0; d < patch_data_depth; ++d)
                 {
                     RobinBcCoefStrategy<NDIM>* bc_coef = d_bc_coefs[NDIM * d + axis];
-                    auto const extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
-                    if (extended_bc_coef)
-                    {
-                        extended_bc_coef->setTargetPatchDataIndex(patch_data_idx);
-                        extended_bc_coef->setHomogeneousBc(d_homogeneous_bc);
-                    }
-                    bc_coef->setBcCoefs(acoef_data, bcoef_data, gcoef_data, var, patch, trimmed_bdry_box, fill_time);
-                    if (d_homogeneous_bc && !extended_bc_coef) gcoef_data->fillAll(0.0);
-                    if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+                    const std::array<Pointer<ArrayData<NDIM, double> >, 3>& coef_data =
+                        setBcCoefData(bc_coef, patch_data_idx, var, patch, trimmed_bdry_box, bc_coef_box, fill_time);
+                    const Pointer<ArrayData<NDIM, double> >& acoef_data = coef_data[0];
+                    const Pointer<ArrayData<NDIM, double> >& bcoef_data = coef_data[1];
+                    const Pointer<ArrayData<NDIM, double> >& gcoef_data = coef_data[2];
 
                     // Restore the original patch geometry object.
                     patch.setPatchGeometry(pgeom);
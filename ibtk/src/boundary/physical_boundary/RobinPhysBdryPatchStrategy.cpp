@@ -13,37 +13,41 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibtk/ExtendedRobinBcCoefStrategy.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 
+#include "ArrayData.h"
+#include "BoundaryBox.h"
 #include "Box.h"
 #include "ComponentSelector.h"
-
+#include "Patch.h"
+#include "RobinBcCoefStrategy.h"
+#include "Variable.h"
+#include "tbox/Pointer.h"
+
+#include <array>
+#include <cstddef>
+#include <map>
 #include <set>
+#include <utility>
 #include <vector>
 
 #include "ibtk/app_namespaces.h" // IWYU pragma: keep
 
-namespace SAMRAI
-{
-namespace hier
-{
-template <int DIM>
-class Patch;
-} // namespace hier
-
-namespace solv
-{
-template <int DIM>
-class RobinBcCoefStrategy;
-} // namespace solv
-} // namespace SAMRAI
-
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Upper bound on the number of coefficient boxes for which coefficient arrays
+// are kept.  The arrays of boxes that no longer exist (e.g., after a regrid)
+// are discarded when the bound is reached.
+static const std::size_t MAX_NUM_BC_COEF_BOXES = 1024;
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 void
@@ -143,6 +147,43 @@ RobinPhysBdryPatchStrategy::accumulateFromPhysicalBoundaryData(Patch<NDIM>& /*pa
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
+const std::array<Pointer<ArrayData<NDIM, double> >, 3>&
+RobinPhysBdryPatchStrategy::setBcCoefData(RobinBcCoefStrategy<NDIM>* const bc_coef,
+                                          const int patch_data_idx,
+                                          const Pointer<Variable<NDIM> >& var,
+                                          Patch<NDIM>& patch,
+                                          const BoundaryBox<NDIM>& bdry_box,
+                                          const Box<NDIM>& bc_coef_box,
+                                          const double fill_time)
+{
+    std::array<int, 2 * NDIM> key;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        key[d] = bc_coef_box.lower(d);
+        key[NDIM + d] = bc_coef_box.upper(d);
+    }
+    auto it = d_bc_coef_data.find(key);
+    if (it == d_bc_coef_data.end())
+    {
+        if (d_bc_coef_data.size() >= MAX_NUM_BC_COEF_BOXES) d_bc_coef_data.clear();
+        std::array<Pointer<ArrayData<NDIM, double> >, 3> coef_data;
+        for (auto& data : coef_data) data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+        it = d_bc_coef_data.insert(std::make_pair(key, coef_data)).first;
+    }
+    std::array<Pointer<ArrayData<NDIM, double> >, 3>& coef_data = it->second;
+
+    auto const extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
+    if (extended_bc_coef)
+    {
+        extended_bc_coef->setTargetPatchDataIndex(patch_data_idx);
+        extended_bc_coef->setHomogeneousBc(d_homogeneous_bc);
+    }
+    bc_coef->setBcCoefs(coef_data[0], coef_data[1], coef_data[2], var, patch, bdry_box, fill_time);
+    if (d_homogeneous_bc && !extended_bc_coef) coef_data[2]->fillAll(0.0);
+    if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+    return coef_data;
+} // setBcCoefData
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -34,9 +34,12 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <initializer_list>
 #include <map>
 #include <ostream>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -60,6 +63,11 @@ namespace IBTK
 namespace
 {
 static const int EXTENSIONS_FILLABLE = 128;
+
+// Upper bound on the number of boundary boxes for which coefficient values are
+// cached.  The values for boxes that no longer exist (e.g., after a regrid) are
+// discarded when the bound is reached.
+static const std::size_t MAX_NUM_CACHED_BOXES = 4096;
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -266,17 +274,31 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
         {
             parser->DefineConst(constant.first, constant.second);
         }
+    }
 
-        // Variables.
-        parser->DefineVar("T", &d_parser_time);
-        parser->DefineVar("t", &d_parser_time);
-        for (unsigned int d = 0; d < NDIM; ++d)
+    // Variables.
+    resizeParserArrays(1);
+
+    // Determine which functions are constant and which depend on time.
+    for (int side = 0; side < 2 * NDIM; ++side)
+    {
+        d_coef_is_time_dependent[side] = false;
+        int c = 0;
+        for (mu::Parser* parser : { &d_acoef_parsers[side], &d_bcoef_parsers[side], &d_gcoef_parsers[side] })
         {
-            const std::string postfix = std::to_string(d);
-            parser->DefineVar("X" + postfix, d_parser_posn.data() + d);
-            parser->DefineVar("x" + postfix, d_parser_posn.data() + d);
-            parser->DefineVar("X_" + postfix, d_parser_posn.data() + d);
-            parser->DefineVar("x_" + postfix, d_parser_posn.data() + d);
+            try
+            {
+                const mu::varmap_type& used_vars = parser->GetUsedVar();
+                d_coef_is_constant[side][c] = used_vars.empty();
+                if (used_vars.count("t") || used_vars.count("T")) d_coef_is_time_dependent[side] = true;
+            }
+            catch (mu::ParserError& e)
+            {
+                TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
+                           << "  error: " << e.GetMsg() << "\n"
+                           << "  in:    " << e.GetExpr() << "\n");
+            }
+            ++c;
         }
     }
     return;
@@ -311,40 +333,111 @@ muParserRobinBcCoefs::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
     TBOX_ASSERT(!gcoef_data || bc_coef_box == gcoef_data->getBox());
 #endif
 
-    const mu::Parser& acoef_parser = d_acoef_parsers[location_index];
-    const mu::Parser& bcoef_parser = d_bcoef_parsers[location_index];
-    const mu::Parser& gcoef_parser = d_gcoef_parsers[location_index];
-    d_parser_time = fill_time;
-    for (Box<NDIM>::Iterator b(bc_coef_box); b; b++)
+    const int num_indices = bc_coef_box.size();
+    if (num_indices <= 0) return;
+
+    // Look up the coefficient values for this boundary box.  The values are
+    // recomputed only if they have not been computed before or if they depend
+    // on time and were computed at a different time.
+    CacheKey key;
+    std::get<0>(key) = location_index;
+    for (unsigned int d = 0; d < NDIM; ++d)
     {
-        const hier::Index<NDIM>& i = b();
-        for (unsigned int d = 0; d < NDIM; ++d)
+        std::get<1>(key)[d] = bc_coef_box.lower(d);
+        std::get<1>(key)[NDIM + d] = bc_coef_box.upper(d);
+        std::get<1>(key)[2 * NDIM + d] = patch_lower(d);
+        std::get<2>(key)[d] = x_lower[d];
+        std::get<2>(key)[NDIM + d] = dx[d];
+    }
+    auto it = d_coef_cache.find(key);
+    const bool found = it != d_coef_cache.end();
+    if (!found)
+    {
+        if (d_coef_cache.size() >= MAX_NUM_CACHED_BOXES) d_coef_cache.clear();
+        it = d_coef_cache.insert(std::make_pair(key, CachedCoefs())).first;
+    }
+    CachedCoefs& cached_coefs = it->second;
+    if (!found || (d_coef_is_time_dependent[location_index] && cached_coefs.time != fill_time))
+    {
+        cached_coefs.time = fill_time;
+        std::array<mu::Parser*, 3> parsers = { { &d_acoef_parsers[location_index],
+                                                 &d_bcoef_parsers[location_index],
+                                                 &d_gcoef_parsers[location_index] } };
+        const std::array<bool, 3>& is_constant = d_coef_is_constant[location_index];
+        const bool all_constant = is_constant[0] && is_constant[1] && is_constant[2];
+
+        // Compute the time and position values for all of the boundary points.
+        if (!all_constant)
         {
-            if (d != bdry_normal_axis)
-            {
-                d_parser_posn[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-            }
-            else
+            resizeParserArrays(num_indices);
+            std::fill(d_parser_time.begin(), d_parser_time.begin() + num_indices, fill_time);
+            int k = 0;
+            for (Box<NDIM>::Iterator b(bc_coef_box); b; b++, ++k)
             {
-                d_parser_posn[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                const hier::Index<NDIM>& i = b();
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    if (d != bdry_normal_axis)
+                    {
+                        d_parser_posn[d][k] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                    }
+                    else
+                    {
+                        d_parser_posn[d][k] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                    }
+                }
             }
         }
-        try
+
+        // Evaluate each coefficient at all of the boundary points at once, or
+        // only once if the coefficient is constant.
+        for (int c = 0; c < 3; ++c)
         {
-            if (acoef_data) (*acoef_data)(i, 0) = acoef_parser.Eval();
-            if (bcoef_data) (*bcoef_data)(i, 0) = bcoef_parser.Eval();
-            if (gcoef_data) (*gcoef_data)(i, 0) = gcoef_parser.Eval();
+            std::vector<double>& values = cached_coefs.values[c];
+            try
+            {
+                if (is_constant[c])
+                {
+                    values.assign(1, parsers[c]->Eval());
+                }
+                else
+                {
+                    values.resize(num_indices);
+                    parsers[c]->Eval(values.data(), num_indices);
+                }
+            }
+            catch (mu::ParserError& e)
+            {
+                TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
+                           << "  error: " << e.GetMsg() << "\n"
+                           << "  in:    " << e.GetExpr() << "\n");
+            }
+            catch (...)
+            {
+                TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
+                           << "  unrecognized exception generated by muParser library.\n");
+            }
         }
-        catch (mu::ParserError& e)
+    }
+
+    // Copy the coefficient values into the coefficient arrays.
+    std::array<ArrayData<NDIM, double>*, 3> coefs = {
+        { acoef_data.getPointer(), bcoef_data.getPointer(), gcoef_data.getPointer() }
+    };
+    for (int c = 0; c < 3; ++c)
+    {
+        ArrayData<NDIM, double>* const coef_data = coefs[c];
+        if (!coef_data) continue;
+        const std::vector<double>& values = cached_coefs.values[c];
+        if (values.size() == 1)
         {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
-                       << "  error: " << e.GetMsg() << "\n"
-                       << "  in:    " << e.GetExpr() << "\n");
+            coef_data->fillAll(values[0]);
+            continue;
         }
-        catch (...)
+        int k = 0;
+        for (Box<NDIM>::Iterator b(bc_coef_box); b; b++, ++k)
         {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
-                       << "  unrecognized exception generated by muParser library.\n");
+            (*coef_data)(b(), 0) = values[k];
         }
     }
     return;
@@ -360,6 +453,34 @@ muParserRobinBcCoefs::numberOfExtensionsFillable() const
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+muParserRobinBcCoefs::resizeParserArrays(const int size) const
+{
+    if (static_cast<int>(d_parser_time.size()) >= size) return;
+    d_parser_time.resize(size);
+    for (unsigned int d = 0; d < NDIM; ++d) d_parser_posn[d].resize(size);
+
+    // The parsers store the addresses of their variables, so the variables must
+    // be redefined after the arrays are reallocated.
+    for (int side = 0; side < 2 * NDIM; ++side)
+    {
+        for (mu::Parser* parser : { &d_acoef_parsers[side], &d_bcoef_parsers[side], &d_gcoef_parsers[side] })
+        {
+            parser->DefineVar("T", d_parser_time.data());
+            parser->DefineVar("t", d_parser_time.data());
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                const std::string postfix = std::to_string(d);
+                parser->DefineVar("X" + postfix, d_parser_posn[d].data());
+                parser->DefineVar("x" + postfix, d_parser_posn[d].data());
+                parser->DefineVar("X_" + postfix, d_parser_posn[d].data());
+                parser->DefineVar("x_" + postfix, d_parser_posn[d].data());
+            }
+        }
+    }
+    return;
+} // resizeParserArrays
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
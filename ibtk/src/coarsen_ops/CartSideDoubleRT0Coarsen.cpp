@@ -16,10 +16,16 @@
 #include "ibtk/CartSideDoubleRT0Coarsen.h"
 #include "ibtk/PhysicalBoundaryUtilities.h"
 
+#include "ArrayData.h"
 #include "Box.h"
+#include "Index.h"
+#include "SideData.h"
+#include "SideGeometry.h"
 #include "SideVariable.h"
 #include "tbox/Pointer.h"
 
+#include <array>
+#include <cmath>
 #include <string>
 #include <utility>
 
@@ -133,7 +139,99 @@ const std::string CartSideDoubleRT0Coarsen::s_op_name = "RT0_COARSEN";
 namespace
 {
 static const int COARSEN_OP_PRIORITY = 0;
-}
+
+// Strides of a data array defined on the indices of array_box, stored in
+// column-major (Fortran) order.
+inline std::array<int, NDIM>
+array_strides(const Box<NDIM>& array_box)
+{
+    std::array<int, NDIM> stride;
+    stride[0] = 1;
+    for (unsigned int d = 1; d < NDIM; ++d)
+    {
+        stride[d] = stride[d - 1] * array_box.numberCells(d - 1);
+    }
+    return stride;
+} // array_strides
+
+// Coarsen the axis component of side-centered data on the side indices of
+// coarse_side_box via the adjoint of RT0 interpolation for a refinement ratio of
+// R in each direction.  This is the same stencil that is used by
+// scrt0coarsen2d/scrt0coarsen3d, but since the refinement ratio is known at
+// compile time, the stencil offsets and weights are precomputed and the
+// stencil loop is fully unrolled.  The innermost loop runs over an entire
+// pencil of coarse indices so that it can be vectorized.
+template <int R>
+void
+rt0_coarsen_interior(double* const U_crse,
+                     const Box<NDIM>& U_crse_box,
+                     const double* const U_fine,
+                     const Box<NDIM>& U_fine_box,
+                     const Box<NDIM>& coarse_side_box,
+                     const int axis)
+{
+    static_assert(R > 1, "the refinement ratio must be larger than one");
+#if (NDIM == 2)
+    static constexpr int stencil_size = (2 * R - 1) * R;
+#endif
+#if (NDIM == 3)
+    static constexpr int stencil_size = (2 * R - 1) * R * R;
+#endif
+
+    // The stencil weights are 1 - |i|/R along the axis of the data and are
+    // constant in the remaining directions.  They sum to R^NDIM.
+    const std::array<int, NDIM> crse_stride = array_strides(U_crse_box);
+    const std::array<int, NDIM> fine_stride = array_strides(U_fine_box);
+    double w_fac = 1.0;
+    for (unsigned int d = 0; d < NDIM; ++d) w_fac /= static_cast<double>(R);
+    std::array<int, stencil_size> offset;
+    std::array<double, stencil_size> weight;
+    int n = 0;
+    hier::Index<NDIM> stencil_lower(0), stencil_upper(R - 1);
+    stencil_lower(axis) = -R + 1;
+    const Box<NDIM> stencil_box(stencil_lower, stencil_upper);
+    for (Box<NDIM>::Iterator b(stencil_box); b; b++, ++n)
+    {
+        const hier::Index<NDIM>& i = b();
+        offset[n] = 0;
+        for (unsigned int d = 0; d < NDIM; ++d) offset[n] += i(d) * fine_stride[d];
+        weight[n] = (1.0 - std::abs(static_cast<double>(i(axis))) / static_cast<double>(R)) * w_fac;
+    }
+
+    const int ilower0 = coarse_side_box.lower(0);
+    const int n0 = coarse_side_box.numberCells(0);
+#if (NDIM == 3)
+    for (int i2 = coarse_side_box.lower(2); i2 <= coarse_side_box.upper(2); ++i2)
+#endif
+    {
+        for (int i1 = coarse_side_box.lower(1); i1 <= coarse_side_box.upper(1); ++i1)
+        {
+            // Pointers to the coarse and fine values associated with the first
+            // coarse index of the pencil.
+            double* const U_crse_pencil = U_crse + (ilower0 - U_crse_box.lower(0)) +
+                                          crse_stride[1] * (i1 - U_crse_box.lower(1))
+#if (NDIM == 3)
+                                          + crse_stride[2] * (i2 - U_crse_box.lower(2))
+#endif
+                ;
+            const double* const U_fine_pencil = U_fine + (R * ilower0 - U_fine_box.lower(0)) +
+                                                fine_stride[1] * (R * i1 - U_fine_box.lower(1))
+#if (NDIM == 3)
+                                                + fine_stride[2] * (R * i2 - U_fine_box.lower(2))
+#endif
+                ;
+            for (int i0 = 0; i0 < n0; ++i0)
+            {
+                const double* const U_fine_i = U_fine_pencil + R * i0;
+                double U_crse_i = 0.0;
+                for (int k = 0; k < stencil_size; ++k) U_crse_i += weight[k] * U_fine_i[offset[k]];
+                U_crse_pencil[i0] = U_crse_i;
+            }
+        }
+    }
+    return;
+} // rt0_coarsen_interior
+} // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
@@ -221,37 +319,67 @@ CartSideDoubleRT0Coarsen::coarsen(Patch<NDIM>& coarse,
 #if (NDIM == 3)
         const double* const U_fine2 = fdata->getPointer(2, depth);
 #endif
-        SC_RT0_COARSEN_FC(U_crse0,
-                          U_crse1,
+        // Use the specialized kernels for the commonly used isotropic
+        // refinement ratios.  Other ratios are treated by the general routine.
+        if (ratio == IntVector<NDIM>(2) || ratio == IntVector<NDIM>(4))
+        {
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                const Box<NDIM> coarse_side_box = SideGeometry<NDIM>::toSideBox(coarse_box, axis);
+                if (ratio(0) == 2)
+                {
+                    rt0_coarsen_interior<2>(cdata->getPointer(axis, depth),
+                                            cdata->getArrayData(axis).getBox(),
+                                            fdata->getPointer(axis, depth),
+                                            fdata->getArrayData(axis).getBox(),
+                                            coarse_side_box,
+                                            axis);
+                }
+                else
+                {
+                    rt0_coarsen_interior<4>(cdata->getPointer(axis, depth),
+                                            cdata->getArrayData(axis).getBox(),
+                                            fdata->getPointer(axis, depth),
+                                            fdata->getArrayData(axis).getBox(),
+                                            coarse_side_box,
+                                            axis);
+                }
+            }
+        }
+        else
+        {
+            SC_RT0_COARSEN_FC(U_crse0,
+                              U_crse1,
 #if (NDIM == 3)
-                          U_crse2,
+                              U_crse2,
 #endif
-                          U_crse_ghosts,
-                          U_fine0,
-                          U_fine1,
+                              U_crse_ghosts,
+                              U_fine0,
+                              U_fine1,
 #if (NDIM == 3)
-                          U_fine2,
+                              U_fine2,
 #endif
-                          U_fine_ghosts,
-                          patch_box_crse.lower(0),
-                          patch_box_crse.upper(0),
-                          patch_box_crse.lower(1),
-                          patch_box_crse.upper(1),
+                              U_fine_ghosts,
+                              patch_box_crse.lower(0),
+                              patch_box_crse.upper(0),
+                              patch_box_crse.lower(1),
+                              patch_box_crse.upper(1),
 #if (NDIM == 3)
-                          patch_box_crse.lower(2),
-                          patch_box_crse.upper(2),
+                              patch_box_crse.lower(2),
+                              patch_box_crse.upper(2),
 #endif
-                          patch_box_fine.lower(0),
-                          patch_box_fine.upper(0),
-                          patch_box_fine.lower(1),
-                          patch_box_fine.upper(1),
+                              patch_box_fine.lower(0),
+                              patch_box_fine.upper(0),
+                              patch_box_fine.lower(1),
+                              patch_box_fine.upper(1),
 #if (NDIM == 3)
-                          patch_box_fine.lower(2),
-                          patch_box_fine.upper(2),
+                              patch_box_fine.lower(2),
+                              patch_box_fine.upper(2),
 #endif
-                          ratio,
-                          coarse_box.lower(),
-                          coarse_box.upper());
+                              ratio,
+                              coarse_box.lower(),
+                              coarse_box.upper());
+        }
 
         for (int k = 0; k < bboxes.getSize(); ++k)
         {
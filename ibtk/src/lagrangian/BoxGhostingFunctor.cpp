@@ -0,0 +1,198 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/BoxGhostingFunctor.h"
+#include "ibtk/BoxTree.h"
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/ibtk_utilities.h"
+
+#include "CartesianPatchGeometry.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+#include "libmesh/elem.h"
+#include "libmesh/ghosting_functor.h"
+#include "libmesh/id_types.h"
+#include "libmesh/mesh_base.h"
+#include "libmesh/node.h"
+#include "libmesh/numeric_vector.h"
+#include "libmesh/system.h"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <limits>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+BoxGhostingFunctor::BoxGhostingFunctor(const MeshBase& mesh, const System& position_system)
+    : d_mesh(mesh), d_position_system(position_system)
+{
+    TBOX_ASSERT(&d_position_system.get_mesh() == &d_mesh);
+} // BoxGhostingFunctor
+
+void
+BoxGhostingFunctor::reinit(const PatchHierarchy<NDIM>& hierarchy, const IntVector<NDIM>& ghost_width)
+{
+    // Find the bounding box of the local patches, grown by the ghost width, of
+    // each processor.
+    std::vector<double> rank_box(2 * NDIM);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        rank_box[d] = std::numeric_limits<double>::max();
+        rank_box[NDIM + d] = -std::numeric_limits<double>::max();
+    }
+    for (int ln = 0; ln <= hierarchy.getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy.getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const dx = pgeom->getDx();
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                rank_box[d] = std::min(rank_box[d], pgeom->getXLower()[d] - dx[d] * ghost_width(d));
+                rank_box[NDIM + d] = std::max(rank_box[NDIM + d], pgeom->getXUpper()[d] + dx[d] * ghost_width(d));
+            }
+        }
+    }
+    const int n_procs = IBTK_MPI::getNodes();
+    std::vector<double> rank_boxes(2 * NDIM * n_procs);
+    IBTK_MPI::allGather(rank_box.data(), 2 * NDIM, rank_boxes.data(), 2 * NDIM * n_procs);
+    EigenAlignedVector<std::pair<Point, Point> > rank_box_pairs(n_procs);
+    for (int rank = 0; rank < n_procs; ++rank)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            rank_box_pairs[rank].first[d] = rank_boxes[2 * NDIM * rank + d];
+            rank_box_pairs[rank].second[d] = rank_boxes[2 * NDIM * rank + NDIM + d];
+        }
+    }
+    const BoxTree rank_tree(rank_box_pairs);
+
+    // Determine which processors need each local element. The positions of
+    // the nodes of local elements are always available in the ghosted
+    // solution vector.
+    const int current_rank = IBTK_MPI::getRank();
+    const unsigned int position_system_num = d_position_system.number();
+    const NumericVector<double>& position = *d_position_system.current_local_solution;
+    d_elem_ids_for_rank.assign(n_procs, std::vector<dof_id_type>());
+    d_needed_elem_ids.clear();
+    std::vector<int> ranks;
+    const auto el_begin = d_mesh.active_local_elements_begin();
+    const auto el_end = d_mesh.active_local_elements_end();
+    for (auto el_it = el_begin; el_it != el_end; ++el_it)
+    {
+        const Elem* const elem = *el_it;
+        d_needed_elem_ids.insert(elem->id());
+        Point elem_lower = Point::Constant(std::numeric_limits<double>::max());
+        Point elem_upper = Point::Constant(-std::numeric_limits<double>::max());
+        for (unsigned int n = 0; n < elem->n_nodes(); ++n)
+        {
+            const Node* const node = elem->node_ptr(n);
+            TBOX_ASSERT(node->n_vars(position_system_num) == NDIM);
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                const double x = position(node->dof_number(position_system_num, d, 0));
+                elem_lower[d] = std::min(elem_lower[d], x);
+                elem_upper[d] = std::max(elem_upper[d], x);
+            }
+        }
+        ranks.clear();
+        rank_tree.query(elem_lower, elem_upper, ranks);
+        for (const int rank : ranks)
+        {
+            if (rank != current_rank) d_elem_ids_for_rank[rank].push_back(elem->id());
+        }
+    }
+
+    // Tell each processor which of the elements owned by the current
+    // processor it needs.
+    std::vector<int> send_counts(n_procs), send_displs(n_procs, 0), recv_counts(n_procs), recv_displs(n_procs, 0);
+    std::vector<unsigned long long> send_buf;
+    for (int rank = 0; rank < n_procs; ++rank)
+    {
+        send_counts[rank] = static_cast<int>(d_elem_ids_for_rank[rank].size());
+        if (rank > 0) send_displs[rank] = send_displs[rank - 1] + send_counts[rank - 1];
+        send_buf.insert(send_buf.end(), d_elem_ids_for_rank[rank].begin(), d_elem_ids_for_rank[rank].end());
+    }
+    int ierr = MPI_Alltoall(
+        send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, IBTK_MPI::getCommunicator());
+    TBOX_ASSERT(ierr == 0);
+    for (int rank = 1; rank < n_procs; ++rank) recv_displs[rank] = recv_displs[rank - 1] + recv_counts[rank - 1];
+    std::vector<unsigned long long> recv_buf(recv_displs[n_procs - 1] + recv_counts[n_procs - 1]);
+    ierr = MPI_Alltoallv(send_buf.data(),
+                         send_counts.data(),
+                         send_displs.data(),
+                         MPI_UNSIGNED_LONG_LONG,
+                         recv_buf.data(),
+                         recv_counts.data(),
+                         recv_displs.data(),
+                         MPI_UNSIGNED_LONG_LONG,
+                         IBTK_MPI::getCommunicator());
+    TBOX_ASSERT(ierr == 0);
+    for (const unsigned long long id : recv_buf) d_needed_elem_ids.insert(static_cast<dof_id_type>(id));
+    return;
+} // reinit
+
+void
+BoxGhostingFunctor::operator()(const MeshBase::const_element_iterator& /*range_begin*/,
+                               const MeshBase::const_element_iterator& /*range_end*/,
+                               processor_id_type p,
+                               map_type& coupled_elements)
+{
+    // Elements not (or no longer) stored on this processor are skipped: they
+    // are provided by the processor that owned them when reinit() was called.
+    const bool is_current_rank = p == static_cast<processor_id_type>(IBTK_MPI::getRank());
+    auto add_elem = [&](const dof_id_type id) {
+        const Elem* const elem = d_mesh.query_elem_ptr(id);
+        if (elem) coupled_elements.insert(std::make_pair(elem, nullptr));
+    };
+    if (is_current_rank)
+    {
+        for (const dof_id_type id : d_needed_elem_ids) add_elem(id);
+    }
+    else if (p < d_elem_ids_for_rank.size())
+    {
+        for (const dof_id_type id : d_elem_ids_for_rank[p]) add_elem(id);
+    }
+    return;
+} // operator()
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
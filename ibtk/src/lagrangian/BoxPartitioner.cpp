@@ -12,6 +12,7 @@
 // ---------------------------------------------------------------------
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
+#include "ibtk/BoxTree.h"
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/ibtk_utilities.h"
 #include <ibtk/BoxPartitioner.h>
@@ -36,7 +37,10 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <numeric>
 #include <sstream>
+#include <utility>
+#include <vector>
 
 #include <ibtk/namespaces.h> // IWYU pragma: keep
 
@@ -138,14 +142,16 @@ BoxPartitioner::writePartitioning(const std::string& file_name) const
 void
 BoxPartitioner::_do_partition(MeshBase& mesh, const unsigned int n)
 {
-    // We assume every cell is on every processor: this function is only in
-    // libMesh 1.2.0 and newer
-#if 1 < LIBMESH_MINOR_VERSION
-    TBOX_ASSERT(mesh.is_replicated());
-#endif
     // only implemented when we use SAMRAI's partitioning
     TBOX_ASSERT(n == static_cast<unsigned int>(IBTK_MPI::getNodes()));
 
+    // Distributed meshes are partitioned without looking at every element.
+    if (!mesh.is_serial())
+    {
+        partitionDistributedMesh(mesh);
+        return;
+    }
+
     // convert the libMesh type to an MPI type
     MPI_Datatype pid_integral_type = 0;
     switch (sizeof(processor_id_type))
@@ -324,6 +330,96 @@ BoxPartitioner::_do_partition(MeshBase& mesh, const unsigned int n)
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+BoxPartitioner::partitionDistributedMesh(MeshBase& mesh)
+{
+    // Gather the partitioning boxes of all processors.
+    const int n_processes = IBTK_MPI::getNodes();
+    const int n_local_boxes = static_cast<int>(d_partitioning_boxes.end() - d_partitioning_boxes.begin());
+    std::vector<int> n_boxes(n_processes);
+    IBTK_MPI::allGather(n_local_boxes, n_boxes.data());
+    std::vector<double> local_box_data;
+    for (const PartitioningBox& box : d_partitioning_boxes)
+    {
+        local_box_data.insert(local_box_data.end(), box.bottom().data(), box.bottom().data() + NDIM);
+        local_box_data.insert(local_box_data.end(), box.top().data(), box.top().data() + NDIM);
+    }
+    const int n_total_boxes = std::accumulate(n_boxes.begin(), n_boxes.end(), 0);
+    std::vector<double> box_data(2 * NDIM * n_total_boxes);
+    IBTK_MPI::allGather(local_box_data.data(), 2 * NDIM * n_local_boxes, box_data.data(), 2 * NDIM * n_total_boxes);
+    std::vector<PartitioningBox> boxes;
+    std::vector<processor_id_type> box_ranks;
+    EigenAlignedVector<std::pair<Point, Point> > box_pairs;
+    for (int rank = 0, box_n = 0; rank < n_processes; ++rank)
+    {
+        for (int k = 0; k < n_boxes[rank]; ++k, ++box_n)
+        {
+            Point bottom, top;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                bottom[d] = box_data[2 * NDIM * box_n + d];
+                top[d] = box_data[2 * NDIM * box_n + NDIM + d];
+            }
+            boxes.emplace_back(bottom, top);
+            box_ranks.push_back(rank);
+            box_pairs.emplace_back(bottom, top);
+        }
+    }
+    const BoxTree box_tree(box_pairs);
+
+    // Assign each local element to the processor whose box contains its
+    // centroid. The positions of the nodes of local elements are always
+    // available in the ghosted solution vector. Elements outside of all boxes
+    // keep their current processor. libMesh sets up the processor ids of
+    // ghost elements and of nodes when the mesh is redistributed.
+    const bool use_position_vector = d_position_system != nullptr;
+    const unsigned int position_system_n = use_position_vector ? d_position_system->number() : 0;
+    const NumericVector<double>* const position =
+        use_position_vector ? d_position_system->current_local_solution.get() : nullptr;
+    std::vector<int> box_ids;
+    int n_unassigned_elems = 0;
+    const auto end_elem = mesh.active_local_elements_end();
+    for (auto elem = mesh.active_local_elements_begin(); elem != end_elem; ++elem)
+    {
+        Point centroid = Point::Zero();
+        const unsigned int n_nodes = (*elem)->n_nodes();
+        for (unsigned int node_n = 0; node_n < n_nodes; ++node_n)
+        {
+            const Node& node = (*elem)->node_ref(node_n);
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                if (use_position_vector)
+                    centroid[d] += (*position)(node.dof_number(position_system_n, d, 0));
+                else
+                    centroid[d] += node(d);
+            }
+        }
+        centroid *= 1.0 / n_nodes;
+
+        box_ids.clear();
+        box_tree.query(centroid, centroid, box_ids);
+        bool assigned = false;
+        for (const int box_id : box_ids)
+        {
+            if (!boxes[box_id].contains(centroid)) continue;
+            (*elem)->processor_id() = box_ranks[box_id];
+            assigned = true;
+            break;
+        }
+        if (!assigned) ++n_unassigned_elems;
+    }
+
+    if (d_enable_logging)
+    {
+        n_unassigned_elems = IBTK_MPI::sumReduction(n_unassigned_elems);
+        if (IBTK_MPI::getRank() == 0)
+        {
+            plog << "elements outside of the partitioning boxes = " << n_unassigned_elems << '\n';
+        }
+    }
+    return;
+} // partitionDistributedMesh
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
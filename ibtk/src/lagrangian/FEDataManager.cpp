@@ -13,6 +13,8 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibtk/BoxTree.h"
+#include "ibtk/CommunicationStatistics.h"
 #include "ibtk/FECache.h"
 #include "ibtk/FEDataManager.h"
 #include "ibtk/FEMappingCache.h"
@@ -21,6 +23,7 @@
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LEInteractor.h"
+#include "ibtk/MemoryStatistics.h"
 #include "ibtk/QuadratureCache.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/SAMRAIDataCache.h"
@@ -29,6 +32,7 @@
 
 #include "BasePatchHierarchy.h"
 #include "Box.h"
+#include "BoxArray.h"
 #include "CartesianCellDoubleWeightedAverage.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
@@ -93,6 +97,7 @@
 #include "libmesh/quadrature.h"
 #include "libmesh/quadrature_grid.h"
 #include "libmesh/sparse_matrix.h"
+#include "libmesh/system.h"
 #include "libmesh/tensor_value.h"
 #include "libmesh/type_vector.h"
 #include "libmesh/variant_filter_iterator.h"
@@ -106,6 +111,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
 #include <iomanip>
 #include <limits>
 #include <map>
@@ -113,9 +119,14 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <set>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
 namespace libMesh
@@ -144,6 +155,7 @@ namespace
 static Timer* t_reinit_element_mappings;
 static Timer* t_build_ghosted_solution_vector;
 static Timer* t_build_ghosted_vector;
+static Timer* t_get_shared_ib_ghosted_vector;
 static Timer* t_spread;
 static Timer* t_prolong_data;
 static Timer* t_interp;
@@ -180,17 +192,45 @@ collect_unique_elems(std::vector<Elem*>& elems, const ContainerOfContainers& ele
     return;
 } // collect_unique_elems
 
+// Return the number of bytes used by the entries of a vector stored on this
+// process.
+double
+get_local_vector_bytes(const NumericVector<double>& vec)
+{
+    if (vec.type() == SERIAL) return static_cast<double>(vec.size()) * sizeof(double);
+    PetscInt n_local_entries = vec.local_size();
+    const auto* petsc_vec = dynamic_cast<const PetscVector<double>*>(&vec);
+    if (vec.type() == GHOSTED && petsc_vec)
+    {
+        // The local form of a ghosted vector also contains the ghost entries.
+        Vec petsc_vec_local_form = nullptr;
+        Vec v = const_cast<PetscVector<double>*>(petsc_vec)->vec();
+        int ierr = VecGhostGetLocalForm(v, &petsc_vec_local_form);
+        IBTK_CHKERRQ(ierr);
+        if (petsc_vec_local_form)
+        {
+            ierr = VecGetSize(petsc_vec_local_form, &n_local_entries);
+            IBTK_CHKERRQ(ierr);
+        }
+        ierr = VecGhostRestoreLocalForm(v, &petsc_vec_local_form);
+        IBTK_CHKERRQ(ierr);
+    }
+    return static_cast<double>(n_local_entries) * sizeof(double);
+} // get_local_vector_bytes
+
 std::set<libMesh::subdomain_id_type>
 collect_subdomain_ids(const libMesh::MeshBase& mesh)
 {
     std::set<libMesh::subdomain_id_type> subdomain_ids;
-    // Get all subdomain ids present, not just local elements.
-    const auto el_begin = mesh.elements_begin();
-    const auto el_end = mesh.elements_end();
+    // Get all subdomain ids present, not just those of local elements: the
+    // mesh may be distributed, so take the union over all processors.
+    const auto el_begin = mesh.local_elements_begin();
+    const auto el_end = mesh.local_elements_end();
     for (auto el_it = el_begin; el_it != el_end; ++el_it)
     {
         subdomain_ids.insert((*el_it)->subdomain_id());
     }
+    mesh.comm().set_union(subdomain_ids);
     return subdomain_ids;
 }
 
@@ -224,47 +264,6 @@ get_JxW(quadrature_key_type key,
     }
 }
 
-#if LIBMESH_VERSION_LESS_THAN(1, 6, 0)
-// libMesh's box intersection code is slow and not in a header (i.e., cannot be
-// inlined). This is problematic for us since we presently call this function
-// for every element on every patch: i.e., for N patches on the current
-// processor and K *total* (i.e., on all processors) elements we call this
-// function K*N times, which takes up a lot of time in regrids. For example:
-// switching to this function lowers the time required to get to the end of the
-// first time step in the TAVR model by 20%.
-inline bool
-bbox_intersects(const libMeshWrappers::BoundingBox& a, const libMeshWrappers::BoundingBox& b)
-{
-    const libMesh::Point& a_lower = a.first;
-    const libMesh::Point& a_upper = a.second;
-
-    const libMesh::Point& b_lower = b.first;
-    const libMesh::Point& b_upper = b.second;
-
-    // Since boxes are tensor products of line intervals it suffices to check
-    // that the line segments for each coordinate axis overlap.
-    for (unsigned int d = 0; d < NDIM; ++d)
-    {
-        // Line segments can intersect in two ways:
-        // 1. They can overlap.
-        // 2. One can be inside the other.
-        //
-        // In the first case we want to see if either end point of the second
-        // line segment lies within the first. In the second case we can simply
-        // check that one end point of the first line segment lies in the second
-        // line segment. Note that we don't need, in the second case, to do two
-        // checks since that case is already covered by the first.
-        if (!((a_lower(d) <= b_lower(d) && b_lower(d) <= a_upper(d)) ||
-              (a_lower(d) <= b_upper(d) && b_upper(d) <= a_upper(d))) &&
-            !((b_lower(d) <= a_lower(d) && a_lower(d) <= b_upper(d))))
-        {
-            return false;
-        }
-    }
-
-    return true;
-}
-#endif
 } // namespace
 
 FEData::FEData(std::string object_name, EquationSystems& equation_systems, const bool register_for_restart)
@@ -403,6 +402,12 @@ SubdomainToPatchLevelTranslation::SubdomainToPatchLevelTranslation(
                 }
             }
         }
+        d_adaptive_levels = input_db->getBoolWithDefault("adaptive_levels", d_adaptive_levels);
+    }
+
+    for (const libMesh::subdomain_id_type id : subdomain_ids)
+    {
+        d_assigned_levels[id] = get(id);
     }
 }
 
@@ -591,8 +596,14 @@ FEDataManager::reinitElementMappings()
     d_active_patch_node_map.resize(d_max_level_number + 1);
     d_active_patch_ghost_dofs.clear();
     d_active_elems.clear();
+    d_patch_quadrature_data.clear();
+    d_patch_nodal_dof_data.clear();
     d_system_ghost_vec.clear();
     d_system_ib_ghost_vec.clear();
+    d_shared_ib_ghost_vecs.clear();
+
+    // Move subdomains to the levels that currently cover them.
+    updateAdaptiveSubdomainLevels();
 
     // Reset the mappings between grid patches and active mesh
     // elements.
@@ -627,9 +638,7 @@ FEDataManager::reinitElementMappings()
         const int rank = IBTK_MPI::getRank();
         const int n_procs = IBTK_MPI::getNodes();
         const MeshBase& mesh = getEquationSystems()->get_mesh();
-        std::unique_ptr<PetscVector<double> > X_petsc_vec = buildIBGhostedVector(COORDINATES_SYSTEM_NAME);
-        *X_petsc_vec = *getCoordsVector();
-        X_petsc_vec->close();
+        PetscVector<double>* X_petsc_vec = &getSharedIBGhostedVector(COORDINATES_SYSTEM_NAME, "solution");
         const double* const X_local_soln = X_petsc_vec->get_array_read();
         const DofMap& X_dof_map = d_fe_data->d_es->get_system(COORDINATES_SYSTEM_NAME).get_dof_map();
 
@@ -697,11 +706,12 @@ FEDataManager::reinitElementMappings()
         {
             const std::string message =
                 "At least one node in the current mesh is inside the fluid domain and not associated with any "
-                "patch. This class currently assumes that all elements are on the finest level and will not "
-                "work correctly if this assumption does not hold. This usually happens when you use multiple "
+                "patch. This class currently assumes that all elements are on their assigned levels and will "
+                "not work correctly if this assumption does not hold. This usually happens when you use multiple "
                 "patch levels and set the regrid CFL interval to a value larger than one. To change this check "
-                "set node_outside_patch_check to a different value in the input database: see the documentation "
-                "of FEDataManager for more information.";
+                "set node_outside_patch_check to a different value in the input database or let subdomains "
+                "migrate to coarser levels by setting adaptive_levels = TRUE in subdomain_ids_on_levels: see the "
+                "documentation of FEDataManager for more information.";
             for (const int node_rank : node_ranks)
             {
                 if (node_rank == 0)
@@ -728,6 +738,8 @@ FEDataManager::reinitElementMappings()
         }
     }
 
+    if (MemoryStatistics::enabled()) updateMemoryUsage();
+
     IBTK_TIMER_STOP(t_reinit_element_mappings);
     return;
 } // reinitElementMappings
@@ -758,9 +770,19 @@ FEDataManager::buildGhostedSolutionVector(const std::string& system_name, const
         sol_ghost_vec->init(
             sol_vec->size(), sol_vec->local_size(), d_active_patch_ghost_dofs[system_name], true, GHOSTED);
         d_system_ghost_vec[system_name] = std::move(sol_ghost_vec);
+        if (MemoryStatistics::enabled()) updateMemoryUsage();
     }
     NumericVector<double>* sol_ghost_vec = d_system_ghost_vec[system_name].get();
-    if (localize_data) copy_and_synch(*sol_vec, *sol_ghost_vec, /*close_v_in*/ false);
+    if (localize_data)
+    {
+        // The ghosted vector's scatter is set up when it is built, so we only
+        // need to update its ghost entries here. This avoids the extra
+        // collective communication done by NumericVector::close() when it
+        // assembles the (empty) off-processor value stash.
+        copy_and_synch(*sol_vec, *sol_ghost_vec, /*close_v_in*/ false, /*close_v_out*/ false);
+        auto sol_ghost_petsc_vec = static_cast<PetscVector<double>*>(sol_ghost_vec);
+        batch_vec_ghost_update({ sol_ghost_petsc_vec }, INSERT_VALUES, SCATTER_FORWARD);
+    }
 
     IBTK_TIMER_STOP(t_build_ghosted_solution_vector);
     return sol_ghost_vec;
@@ -793,6 +815,54 @@ FEDataManager::buildIBGhostedVector(const std::string& system_name)
     return std::unique_ptr<PetscVector<double> >(ptr);
 }
 
+PetscVector<double>&
+FEDataManager::getSharedIBGhostedVector(const std::string& system_name, const std::string& vector_name)
+{
+    IBTK_TIMER_START(t_get_shared_ib_ghosted_vector);
+
+    System& system = d_fe_data->d_es->get_system(system_name);
+    NumericVector<double>* source_vec = nullptr;
+    if (vector_name == "solution")
+        source_vec = system.solution.get();
+    else if (vector_name == "current_local_solution")
+        source_vec = system.current_local_solution.get();
+    else
+        source_vec = &system.get_vector(vector_name);
+    auto source_petsc_vec = dynamic_cast<PetscVector<double>*>(source_vec);
+    TBOX_ASSERT(source_petsc_vec);
+
+    SharedIBGhostedVector& shared_vec = d_shared_ib_ghost_vecs[std::make_pair(system_name, vector_name)];
+    if (!shared_vec.vec)
+    {
+        shared_vec.vec = buildIBGhostedVector(system_name);
+        if (MemoryStatistics::enabled()) updateMemoryUsage();
+    }
+
+    // The copy is out of date if either vector has been modified since the
+    // last update. Since a vector may have been modified only on some
+    // processes, the decision to update (which is collective) is reduced.
+    PetscObjectState source_state, state;
+    int ierr = PetscObjectStateGet(reinterpret_cast<PetscObject>(source_petsc_vec->vec()), &source_state);
+    IBTK_CHKERRQ(ierr);
+    ierr = PetscObjectStateGet(reinterpret_cast<PetscObject>(shared_vec.vec->vec()), &state);
+    IBTK_CHKERRQ(ierr);
+    int update_copy = source_petsc_vec->vec() != shared_vec.source_vec || source_state != shared_vec.source_state ||
+                      state != shared_vec.state;
+    update_copy = IBTK_MPI::maxReduction(update_copy);
+    if (update_copy)
+    {
+        copy_and_synch(*source_vec, *shared_vec.vec, /*close_v_in*/ false);
+        shared_vec.source_vec = source_petsc_vec->vec();
+        ierr = PetscObjectStateGet(reinterpret_cast<PetscObject>(shared_vec.source_vec), &shared_vec.source_state);
+        IBTK_CHKERRQ(ierr);
+        ierr = PetscObjectStateGet(reinterpret_cast<PetscObject>(shared_vec.vec->vec()), &shared_vec.state);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    IBTK_TIMER_STOP(t_get_shared_ib_ghosted_vector);
+    return *shared_vec.vec;
+} // getSharedIBGhostedVector
+
 NumericVector<double>*
 FEDataManager::getCoordsVector() const
 {
@@ -1012,13 +1082,18 @@ FEDataManager::spread(const int f_data_idx,
 
     // convenience alias for the quadrature key type used by FECache and FEMappingCache
     using quad_key_type = quadrature_key_type;
-    FECache F_fe_cache(dim, F_fe_type, FEUpdateFlags::update_phi);
     FECache X_fe_cache(dim, X_fe_type, FEUpdateFlags::update_phi);
 
-    // We have to support both volumetric and surface meshes based on runtime data
-    FEMappingCache<NDIM, NDIM> volume_mapping_cache(FEUpdateFlags::update_JxW);
-    FEMappingCache<NDIM - 1, NDIM> surface_mapping_cache(FEUpdateFlags::update_JxW);
+    // We have to support both volumetric and surface meshes based on runtime
+    // data. The FE objects used to compute the values at the quadrature
+    // points are set up below, since each thread needs its own copies.
     const bool is_volume_mesh = dim == NDIM;
+#ifdef _OPENMP
+    const bool use_threads = d_use_threaded_interaction && omp_get_max_threads() > 1;
+#endif
+
+    // Look up the kernel function once instead of once per patch.
+    const KernelFunctionType spread_kernel_fcn = LEInteractor::getKernelFunctionType(spread_spec.kernel_fcn);
 
     // Check to see if we are using nodal quadrature.
     const bool use_nodal_quadrature = spread_spec.use_nodal_quadrature;
@@ -1035,18 +1110,21 @@ FEDataManager::spread(const int f_data_idx,
 
     if (use_nodal_quadrature)
     {
-        // Multiply by the nodal volume fractions (to convert densities into
-        // values).
+        // The values are multiplied by the nodal volume fractions (to convert
+        // densities into values) as they are extracted.
         PetscVector<double>* dX_vec = buildIBGhostedDiagonalL2MassMatrix(system_name);
-        std::unique_ptr<NumericVector<double> > F_x_dX_vec = F_vec.clone();
-        F_x_dX_vec->pointwise_mult(F_vec, *dX_vec);
 
         // Extract local form vectors.
-        auto F_x_dX_petsc_vec = static_cast<PetscVector<double>*>(F_x_dX_vec.get());
-        const double* const F_x_dX_local_soln = F_x_dX_petsc_vec->get_array_read();
+        auto F_petsc_vec = static_cast<PetscVector<double>*>(&F_vec);
+        const double* const F_local_soln = F_petsc_vec->get_array_read();
+        const double* const dX_local_soln = dX_vec->get_array_read();
         auto X_petsc_vec = static_cast<PetscVector<double>*>(&X_vec);
         const double* const X_local_soln = X_petsc_vec->get_array_read();
 
+        // Like LDataManager, this works directly with the nodes and does not
+        // traverse the elements: the local DOF indices of the nodes on each
+        // patch are computed once per regrid.
+        std::vector<double> F_x_dX_node, X_node;
         for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
         {
             Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -1067,20 +1145,23 @@ FEDataManager::spread(const int f_data_idx,
                 for (unsigned int d = 0; d < NDIM; ++d)
                     touches_upper_regular_bdry[d] = patch_geom->getTouchesRegularBoundary(d, 1);
 
+                const std::vector<dof_id_type>& X_local_idxs =
+                    getPatchNodalDOFData(ln, local_patch_num, COORDINATES_SYSTEM_NAME, *X_petsc_vec).local_dof_indices;
+                const std::vector<dof_id_type>& F_local_idxs =
+                    getPatchNodalDOFData(ln, local_patch_num, system_name, *F_petsc_vec).local_dof_indices;
+
                 // Store the values of F_JxW and X at the nodes inside the patch.
-                std::vector<double> F_x_dX_node, X_node;
+                F_x_dX_node.clear();
+                X_node.clear();
                 F_x_dX_node.reserve(n_vars * num_active_patch_nodes);
                 X_node.reserve(NDIM * num_active_patch_nodes);
-                std::vector<dof_id_type> F_idxs, X_idxs;
                 IBTK::Point X;
                 for (unsigned int k = 0; k < num_active_patch_nodes; ++k)
                 {
-                    const Node* const n = patch_nodes[k];
                     bool inside_patch = true;
                     for (unsigned int d = 0; d < NDIM; ++d)
                     {
-                        IBTK::get_nodal_dof_indices(X_dof_map, n, d, X_idxs);
-                        X[d] = X_local_soln[X_petsc_vec->map_global_to_local_index(X_idxs[0])];
+                        X[d] = X_local_soln[X_local_idxs[NDIM * k + d]];
                         inside_patch =
                             inside_patch && (X[d] >= patch_x_lower[d]) &&
                             ((X[d] < patch_x_upper[d]) || (touches_upper_regular_bdry[d] && X[d] <= patch_x_upper[d]));
@@ -1089,12 +1170,8 @@ FEDataManager::spread(const int f_data_idx,
                     {
                         for (unsigned int i = 0; i < n_vars; ++i)
                         {
-                            IBTK::get_nodal_dof_indices(F_dof_map, n, i, F_idxs);
-                            for (const auto& F_idx : F_idxs)
-                            {
-                                F_x_dX_node.push_back(
-                                    F_x_dX_local_soln[F_x_dX_petsc_vec->map_global_to_local_index(F_idx)]);
-                            }
+                            const dof_id_type F_local_idx = F_local_idxs[n_vars * k + i];
+                            F_x_dX_node.push_back(F_local_soln[F_local_idx] * dX_local_soln[F_local_idx]);
                         }
                         X_node.insert(X_node.end(), &X[0], &X[0] + NDIM);
                     }
@@ -1114,19 +1191,20 @@ FEDataManager::spread(const int f_data_idx,
                 {
                     Pointer<CellData<NDIM, double> > f_cc_data = f_data;
                     LEInteractor::spread(
-                        f_cc_data, F_x_dX_node, n_vars, X_node, NDIM, patch, spread_box, spread_spec.kernel_fcn);
+                        f_cc_data, F_x_dX_node, n_vars, X_node, NDIM, patch, spread_box, spread_kernel_fcn);
                 }
                 if (sc_data)
                 {
                     Pointer<SideData<NDIM, double> > f_sc_data = f_data;
                     LEInteractor::spread(
-                        f_sc_data, F_x_dX_node, n_vars, X_node, NDIM, patch, spread_box, spread_spec.kernel_fcn);
+                        f_sc_data, F_x_dX_node, n_vars, X_node, NDIM, patch, spread_box, spread_kernel_fcn);
                 }
             }
         }
 
         // Restore local form vectors.
-        F_x_dX_petsc_vec->restore_array();
+        F_petsc_vec->restore_array();
+        dX_vec->restore_array();
         X_petsc_vec->restore_array();
     }
     else
@@ -1138,16 +1216,22 @@ FEDataManager::spread(const int f_data_idx,
         auto X_petsc_vec = static_cast<PetscVector<double>*>(&X_vec);
         const double* const X_local_soln = X_petsc_vec->get_array_read();
 
-        // Loop over the patches to interpolate nodal values on the FE mesh to
-        // the element quadrature points, then spread those values onto the
-        // Eulerian grid.
-        boost::multi_array<double, 2> F_node;
-        std::vector<double> F_JxW_qp, X_qp;
+        // Determining which quadrature rule should be used on which
+        // processor is surprisingly expensive, so the keys and the quadrature
+        // point positions are cached between calls. Since neither these nor
+        // the DOF index caches are thread-safe, all cached data is looked up
+        // before any values are computed.
+        struct PatchSpreadData
+        {
+            Pointer<Patch<NDIM> > patch;
+            int ln, local_patch_num;
+            std::vector<const boost::multi_array<dof_id_type, 2>*> F_dof_indices;
+        };
+        std::vector<PatchSpreadData> patch_spread_data;
         for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
         {
             Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
             int local_patch_num = 0;
-            // Spread from the nodes.
             for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
             {
                 // The relevant collection of elements.
@@ -1160,92 +1244,115 @@ FEDataManager::spread(const int f_data_idx,
                 const double* const patch_dx = patch_geom->getDx();
                 const double patch_dx_min = *std::min_element(patch_dx, patch_dx + NDIM);
 
-                // Determining which quadrature rule should be used on which
-                // processor is surprisingly expensive, so cache the keys:
-                std::vector<quad_key_type> quad_keys(num_active_patch_elems);
-
-                // Cache interpolated positions too:
-                std::vector<boost::multi_array<double, 2> > X_nodes(num_active_patch_elems);
-
-                // Setup vectors to store the values of F_JxW and X at the
-                // quadrature points.
-                unsigned int n_qp_patch = 0;
-                for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
-                {
-                    Elem* const elem = patch_elems[e_idx];
 #ifndef NDEBUG
+                for (const Elem* const elem : patch_elems)
+                {
                     TBOX_ASSERT(getPatchLevel(elem) == ln);
+                }
 #endif // ifndef NDEBUG
-                    const auto& X_dof_indices = X_dof_map_cache.dof_indices(elem);
-                    get_values_for_interpolation(X_nodes[e_idx], *X_petsc_vec, X_local_soln, X_dof_indices);
-                    const quad_key_type key = getQuadratureKey(spread_spec.quad_type,
-                                                               spread_spec.quad_order,
-                                                               spread_spec.use_adaptive_quadrature,
-                                                               spread_spec.point_density,
-                                                               spread_spec.allow_rules_with_negative_weights,
-                                                               elem,
-                                                               X_nodes[e_idx],
-                                                               patch_dx_min);
-                    quad_keys[e_idx] = key;
-                    QBase& qrule = d_fe_data->d_quadrature_cache[key];
-                    n_qp_patch += qrule.n_points();
+
+                const PatchQuadratureData& quad_data =
+                    getPatchQuadratureData(ln,
+                                           local_patch_num,
+                                           patch_dx_min,
+                                           spread_spec.quad_type,
+                                           spread_spec.quad_order,
+                                           spread_spec.use_adaptive_quadrature,
+                                           spread_spec.point_density,
+                                           spread_spec.allow_rules_with_negative_weights,
+                                           *X_petsc_vec,
+                                           X_local_soln,
+                                           X_dof_map_cache,
+                                           X_fe_cache);
+                if (!quad_data.n_qp_patch) continue;
+                patch_spread_data.emplace_back();
+                PatchSpreadData& spread_data = patch_spread_data.back();
+                spread_data.patch = patch;
+                spread_data.ln = ln;
+                spread_data.local_patch_num = local_patch_num;
+                spread_data.F_dof_indices.reserve(num_active_patch_elems);
+                for (const Elem* const elem : patch_elems)
+                {
+                    spread_data.F_dof_indices.push_back(&F_dof_map_cache.dof_indices(elem));
                 }
-                if (!n_qp_patch) continue;
-                F_JxW_qp.resize(n_vars * n_qp_patch);
-                X_qp.resize(NDIM * n_qp_patch);
+            }
+        }
 
-                // Loop over the elements and compute the values to be spread and
-                // the positions of the quadrature points.
+        // Loop over the patches to interpolate nodal values on the FE mesh to
+        // the element quadrature points, then spread those values onto the
+        // Eulerian grid. Each patch has its own patch data, so when threading
+        // is enabled the patches are distributed among the threads, each of
+        // which uses its own FE objects.
+        const int num_spread_patches = static_cast<int>(patch_spread_data.size());
+#ifdef _OPENMP
+#pragma omp parallel if (use_threads)
+#endif
+        {
+            FECache F_fe_cache(dim, F_fe_type, FEUpdateFlags::update_phi);
+            FEMappingCache<NDIM, NDIM> volume_mapping_cache(FEUpdateFlags::update_JxW);
+            FEMappingCache<NDIM - 1, NDIM> surface_mapping_cache(FEUpdateFlags::update_JxW);
+            boost::multi_array<double, 2> F_node;
+            std::vector<double> F_JxW_qp;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+            for (int k = 0; k < num_spread_patches; ++k)
+            {
+                const PatchSpreadData& spread_data = patch_spread_data[k];
+                const Pointer<Patch<NDIM> >& patch = spread_data.patch;
+                const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+                const std::vector<Elem*>& patch_elems =
+                    d_active_patch_elem_map[spread_data.ln][spread_data.local_patch_num];
+                const PatchQuadratureData& quad_data =
+                    d_patch_quadrature_data[spread_data.ln][spread_data.local_patch_num];
+                const std::vector<double>& X_qp = quad_data.X_qp;
+                F_JxW_qp.resize(n_vars * quad_data.n_qp_patch);
+
+                // Loop over the elements, grouped by quadrature rule, and
+                // compute the values to be spread.
                 int qp_offset = 0;
-                for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+                for (const PatchQuadratureData::KeyGroup& group : quad_data.key_groups)
                 {
-                    Elem* const elem = patch_elems[e_idx];
-                    const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
-                    get_values_for_interpolation(F_node, *F_petsc_vec, F_local_soln, F_dof_indices);
-                    const quad_key_type& key = quad_keys[e_idx];
-                    const FEBase& X_fe = X_fe_cache(key, elem);
-                    const FEBase& F_fe = F_fe_cache(key, elem);
-                    const QBase& qrule = d_fe_data->d_quadrature_cache[key];
-
-                    // JxW depends on the element
-                    const std::vector<double>& JxW_F =
-                        get_JxW(key, elem, is_volume_mesh, volume_mapping_cache, surface_mapping_cache);
-                    const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
-                    const std::vector<std::vector<double> >& phi_X = X_fe.get_phi();
-
-                    const unsigned int n_qp = qrule.n_points();
-                    TBOX_ASSERT(n_qp == phi_F[0].size());
-                    TBOX_ASSERT(n_qp == phi_X[0].size());
-                    TBOX_ASSERT(n_qp == JxW_F.size());
-                    double* F_begin = &F_JxW_qp[n_vars * qp_offset];
-                    double* X_begin = &X_qp[NDIM * qp_offset];
-                    std::fill(F_begin, F_begin + n_vars * n_qp, 0.0);
-                    std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
-
-                    sum_weighted_elem_solution</*weights_are_unity*/ false>(
-                        n_vars, F_dof_indices[0].size(), qp_offset, phi_F, JxW_F, F_node, F_JxW_qp);
-                    sum_weighted_elem_solution</*weights_are_unity*/ true>(
-                        NDIM, phi_X.size(), qp_offset, phi_X, {}, X_nodes[e_idx], X_qp);
-                    qp_offset += n_qp;
+                    const quad_key_type& key = group.key;
+                    const unsigned int n_qp = group.n_qp;
+                    for (const unsigned int e_idx : group.elem_idxs)
+                    {
+                        Elem* const elem = patch_elems[e_idx];
+                        const auto& F_dof_indices = *spread_data.F_dof_indices[e_idx];
+                        get_values_for_interpolation(F_node, *F_petsc_vec, F_local_soln, F_dof_indices);
+                        const FEBase& F_fe = F_fe_cache(key, elem);
+
+                        // JxW depends on the element
+                        const std::vector<double>& JxW_F =
+                            get_JxW(key, elem, is_volume_mesh, volume_mapping_cache, surface_mapping_cache);
+                        const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
+
+                        TBOX_ASSERT(n_qp == phi_F[0].size());
+                        TBOX_ASSERT(n_qp == JxW_F.size());
+                        double* F_begin = &F_JxW_qp[n_vars * qp_offset];
+                        std::fill(F_begin, F_begin + n_vars * n_qp, 0.0);
+
+                        sum_weighted_elem_solution</*weights_are_unity*/ false>(
+                            n_vars, F_dof_indices[0].size(), qp_offset, phi_F, JxW_F, F_node, F_JxW_qp);
+                        qp_offset += n_qp;
+                    }
                 }
 
                 zeroExteriorValues(*patch_geom, X_qp, F_JxW_qp, n_vars);
 
-                // Spread values from the quadrature points to the Cartesian grid
-                // patch.
+                // Spread values from the quadrature points to the Cartesian
+                // grid patch.
                 const Box<NDIM> spread_box = patch->getBox();
                 Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idx);
                 if (cc_data)
                 {
                     Pointer<CellData<NDIM, double> > f_cc_data = f_data;
-                    LEInteractor::spread(
-                        f_cc_data, F_JxW_qp, n_vars, X_qp, NDIM, patch, spread_box, spread_spec.kernel_fcn);
+                    LEInteractor::spread(f_cc_data, F_JxW_qp, n_vars, X_qp, NDIM, patch, spread_box, spread_kernel_fcn);
                 }
                 if (sc_data)
                 {
                     Pointer<SideData<NDIM, double> > f_sc_data = f_data;
-                    LEInteractor::spread(
-                        f_sc_data, F_JxW_qp, n_vars, X_qp, NDIM, patch, spread_box, spread_spec.kernel_fcn);
+                    LEInteractor::spread(f_sc_data, F_JxW_qp, n_vars, X_qp, NDIM, patch, spread_box, spread_kernel_fcn);
                 }
             }
         }
@@ -1407,7 +1514,7 @@ FEDataManager::prolongData(const int f_data_idx,
 
     // Loop over the patches to interpolate nodal values on the FE mesh to the
     // points of the Eulerian grid.
-    TensorValue<double> dX_ds;
+    MatrixNd dX_ds;
     boost::multi_array<double, 2> F_node, X_node;
     std::vector<libMesh::Point> s_node_cache, X_node_cache;
     Point X_min, X_max;
@@ -1532,8 +1639,8 @@ FEDataManager::prolongData(const int f_data_idx,
                     double F_qp = interpolate(qp, F_node[boost::indices[range(0, n_node)][axis]], phi_F);
                     if (is_density)
                     {
-                        jacobian(dX_ds, qp, X_node, dphi_X);
-                        F_qp /= std::abs(dX_ds.det());
+                        jacobian<NDIM>(dX_ds, qp, X_node, dphi_X);
+                        F_qp /= std::abs(dX_ds.determinant());
                     }
                     (*f_data)(i_s) += F_qp / static_cast<double>(num_intersections(i_s));
                 }
@@ -1718,39 +1825,69 @@ FEDataManager::interpWeighted(const int f_data_idx,
                               const double fill_data_time,
                               const bool close_F,
                               const bool close_X)
+{
+    interpWeighted(std::vector<int>{ f_data_idx },
+                   std::vector<NumericVector<double>*>{ &F_vec },
+                   X_vec,
+                   std::vector<std::string>{ system_name },
+                   interp_spec,
+                   f_refine_scheds,
+                   fill_data_time,
+                   close_F,
+                   close_X);
+    return;
+} // interpWeighted
+
+void
+FEDataManager::interpWeighted(const std::vector<int>& f_data_idxs,
+                              const std::vector<NumericVector<double>*>& F_vecs,
+                              NumericVector<double>& X_vec,
+                              const std::vector<std::string>& system_names,
+                              const std::vector<Pointer<RefineSchedule<NDIM> > >& f_refine_scheds,
+                              const double fill_data_time,
+                              const bool close_F,
+                              const bool close_X)
+{
+    interpWeighted(f_data_idxs,
+                   F_vecs,
+                   X_vec,
+                   system_names,
+                   d_default_interp_spec,
+                   f_refine_scheds,
+                   fill_data_time,
+                   close_F,
+                   close_X);
+    return;
+} // interpWeighted
+
+void
+FEDataManager::interpWeighted(const std::vector<int>& f_data_idxs,
+                              const std::vector<NumericVector<double>*>& F_vecs,
+                              NumericVector<double>& X_vec,
+                              const std::vector<std::string>& system_names,
+                              const FEDataManager::InterpSpec& interp_spec,
+                              const std::vector<Pointer<RefineSchedule<NDIM> > >& f_refine_scheds,
+                              const double fill_data_time,
+                              const bool close_F,
+                              const bool close_X)
 {
     IBTK_TIMER_START(t_interp_weighted);
 
-    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const std::size_t n_systems = system_names.size();
+    TBOX_ASSERT(f_data_idxs.size() == n_systems);
+    TBOX_ASSERT(F_vecs.size() == n_systems);
+    TBOX_ASSERT(n_systems > 0);
 
-    // Determine the type of data centering.
-    Pointer<hier::Variable<NDIM> > f_var;
-    var_db->mapIndexToVariable(f_data_idx, f_var);
-    Pointer<CellVariable<NDIM, double> > f_cc_var = f_var;
-    Pointer<SideVariable<NDIM, double> > f_sc_var = f_var;
-    const bool cc_data = f_cc_var;
-    const bool sc_data = f_sc_var;
-    TBOX_ASSERT(cc_data || sc_data);
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
 
     // Extract the mesh.
     const MeshBase& mesh = d_fe_data->d_es->get_mesh();
     const unsigned int dim = mesh.mesh_dimension();
 
-    // Extract the FE systems and DOF maps, and setup the FECache objects.
-    System& F_system = d_fe_data->d_es->get_system(system_name);
-    const unsigned int n_vars = F_system.n_vars();
-    const DofMap& F_dof_map = F_system.get_dof_map();
-    FEData::SystemDofMapCache& F_dof_map_cache = *getDofMapCache(system_name);
+    // Extract the position system and DOF map.
     System& X_system = d_fe_data->d_es->get_system(COORDINATES_SYSTEM_NAME);
     const DofMap& X_dof_map = X_system.get_dof_map();
     FEData::SystemDofMapCache& X_dof_map_cache = *getDofMapCache(COORDINATES_SYSTEM_NAME);
-    FEType F_fe_type = F_dof_map.variable_type(0);
-    Order F_order = F_dof_map.variable_order(0);
-    for (unsigned i = 0; i < n_vars; ++i)
-    {
-        TBOX_ASSERT(F_dof_map.variable_type(i) == F_fe_type);
-        TBOX_ASSERT(F_dof_map.variable_order(i) == F_order);
-    }
     FEType X_fe_type = X_dof_map.variable_type(0);
     Order X_order = X_dof_map.variable_order(0);
     for (unsigned d = 0; d < NDIM; ++d)
@@ -1759,13 +1896,56 @@ FEDataManager::interpWeighted(const int f_data_idx,
         TBOX_ASSERT(X_dof_map.variable_order(d) == X_order);
     }
 
+    // Extract the FE systems and DOF maps of each interpolated quantity. All
+    // of the systems must use the same finite element type so that the
+    // quadrature rules, shape functions, and Jacobians can be shared between
+    // them.
+    struct InterpSystemData
+    {
+        bool cc_data, sc_data;
+        unsigned int n_vars;
+        const DofMap* dof_map;
+        FEData::SystemDofMapCache* dof_map_cache;
+        PetscVector<double>* petsc_vec;
+        Vec local_form;
+        double* local_soln;
+        PetscInt local_size;
+        bool is_ghosted;
+    };
+    std::vector<InterpSystemData> F_systems(n_systems);
+    const FEType F_fe_type = d_fe_data->d_es->get_system(system_names[0]).get_dof_map().variable_type(0);
+    const Order F_order = d_fe_data->d_es->get_system(system_names[0]).get_dof_map().variable_order(0);
+    for (std::size_t s = 0; s < n_systems; ++s)
+    {
+        InterpSystemData& F_sys = F_systems[s];
+
+        // Determine the type of data centering.
+        Pointer<hier::Variable<NDIM> > f_var;
+        var_db->mapIndexToVariable(f_data_idxs[s], f_var);
+        Pointer<CellVariable<NDIM, double> > f_cc_var = f_var;
+        Pointer<SideVariable<NDIM, double> > f_sc_var = f_var;
+        F_sys.cc_data = f_cc_var;
+        F_sys.sc_data = f_sc_var;
+        TBOX_ASSERT(F_sys.cc_data || F_sys.sc_data);
+
+        System& F_system = d_fe_data->d_es->get_system(system_names[s]);
+        F_sys.n_vars = F_system.n_vars();
+        F_sys.dof_map = &F_system.get_dof_map();
+        F_sys.dof_map_cache = getDofMapCache(system_names[s]);
+        for (unsigned i = 0; i < F_sys.n_vars; ++i)
+        {
+            TBOX_ASSERT(F_sys.dof_map->variable_type(i) == F_fe_type);
+            TBOX_ASSERT(F_sys.dof_map->variable_order(i) == F_order);
+        }
+    }
+
     // convenience alias for the quadrature key type used by FECache and FEMappingCache
     using quad_key_type = quadrature_key_type;
-    FECache F_fe_cache(dim, F_fe_type, FEUpdateFlags::update_phi);
     FECache X_fe_cache(dim, X_fe_type, FEUpdateFlags::update_phi);
-    FEMappingCache<NDIM, NDIM> volume_mapping_cache(FEUpdateFlags::update_JxW);
-    FEMappingCache<NDIM - 1, NDIM> surface_mapping_cache(FEUpdateFlags::update_JxW);
     const bool is_volume_mesh = dim == NDIM;
+#ifdef _OPENMP
+    const bool use_threads = d_use_threaded_interaction && omp_get_max_threads() > 1;
+#endif
 
     // Communicate any unsynchronized ghost data.
     for (const auto& f_refine_sched : f_refine_scheds)
@@ -1775,6 +1955,9 @@ FEDataManager::interpWeighted(const int f_data_idx,
 
     if (close_X) X_vec.close();
 
+    // Look up the kernel function once instead of once per patch.
+    const KernelFunctionType interp_kernel_fcn = LEInteractor::getKernelFunctionType(interp_spec.kernel_fcn);
+
     // Check to see if we are using nodal quadrature.
     const bool use_nodal_quadrature = interp_spec.use_nodal_quadrature;
     if (use_nodal_quadrature) TBOX_ASSERT(F_fe_type == X_fe_type && F_order == X_order);
@@ -1795,31 +1978,46 @@ FEDataManager::interpWeighted(const int f_data_idx,
     // Since we do a lot of assembly in this routine into off-processor
     // entries we will directly insert into the ghost values (and then
     // scatter in the calling function with the usual batch function).
-    F_vec.zero();
-    auto F_petsc_vec = dynamic_cast<PetscVector<double>*>(&F_vec);
-    Vec F_local_form = nullptr;
-    double* F_local_soln = nullptr;
-    PetscInt F_local_size = -1;
-    const bool is_ghosted = F_vec.type() == GHOSTED;
-    if (is_ghosted)
-    {
-        TBOX_ASSERT(F_petsc_vec != nullptr);
-        int ierr = VecGhostGetLocalForm(F_petsc_vec->vec(), &F_local_form);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecGetArray(F_local_form, &F_local_soln);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecGetSize(F_local_form, &F_local_size);
-        IBTK_CHKERRQ(ierr);
+    for (std::size_t s = 0; s < n_systems; ++s)
+    {
+        InterpSystemData& F_sys = F_systems[s];
+        NumericVector<double>& F_vec = *F_vecs[s];
+        F_vec.zero();
+        F_sys.petsc_vec = dynamic_cast<PetscVector<double>*>(&F_vec);
+        F_sys.local_form = nullptr;
+        F_sys.local_soln = nullptr;
+        F_sys.local_size = -1;
+        F_sys.is_ghosted = F_vec.type() == GHOSTED;
+        if (F_sys.is_ghosted)
+        {
+            TBOX_ASSERT(F_sys.petsc_vec != nullptr);
+            int ierr = VecGhostGetLocalForm(F_sys.petsc_vec->vec(), &F_sys.local_form);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecGetArray(F_sys.local_form, &F_sys.local_soln);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecGetSize(F_sys.local_form, &F_sys.local_size);
+            IBTK_CHKERRQ(ierr);
+        }
     }
 
     if (use_nodal_quadrature)
     {
         // Extract local form vectors.
-        PetscVector<double>* dX_vec = buildIBGhostedDiagonalL2MassMatrix(system_name);
-        const double* const dX_local_soln = dX_vec->get_array_read();
+        std::vector<PetscVector<double>*> dX_vecs(n_systems);
+        std::vector<const double*> dX_local_solns(n_systems);
+        for (std::size_t s = 0; s < n_systems; ++s)
+        {
+            dX_vecs[s] = buildIBGhostedDiagonalL2MassMatrix(system_names[s]);
+            dX_local_solns[s] = dX_vecs[s]->get_array_read();
+        }
 
         // Loop over the patches to interpolate values to the nodes from the grid, then use these values to
-        // compute the projection of the interpolated velocity field onto the FE basis functions.
+        // compute the projection of the interpolated velocity field onto the FE basis functions. Like
+        // LDataManager, this works directly with the nodes and does not traverse the elements: the local DOF
+        // indices of the nodes on each patch are computed once per regrid.
+        std::vector<unsigned int> F_nodes;
+        std::vector<dof_id_type> F_node_idxs, F_local_idxs;
+        std::vector<double> F_node, X_node;
         for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
         {
             Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -1840,42 +2038,34 @@ FEDataManager::interpWeighted(const int f_data_idx,
                     touches_upper_regular_bdry[d] = patch_geom->getTouchesRegularBoundary(d, 1);
 
                 // Store the value of X at the nodes that are inside the current
-                // patch.
-                std::vector<dof_id_type> F_node_idxs;
-                std::vector<double> F_node, X_node;
-                F_node_idxs.reserve(n_vars * num_active_patch_nodes);
-                F_node.reserve(n_vars * num_active_patch_nodes);
+                // patch. The positions are shared by all of the interpolated
+                // quantities.
+                const std::vector<dof_id_type>& X_local_idxs =
+                    getPatchNodalDOFData(ln, local_patch_num, COORDINATES_SYSTEM_NAME, *X_petsc_vec).local_dof_indices;
+                F_nodes.clear();
+                X_node.clear();
+                F_nodes.reserve(num_active_patch_nodes);
                 X_node.reserve(NDIM * num_active_patch_nodes);
-                std::vector<dof_id_type> F_idxs, X_idxs;
                 IBTK::Point X;
                 for (unsigned int k = 0; k < num_active_patch_nodes; ++k)
                 {
-                    const Node* const n = patch_nodes[k];
                     bool inside_patch = true;
                     for (unsigned int d = 0; d < NDIM; ++d)
                     {
-                        IBTK::get_nodal_dof_indices(X_dof_map, n, d, X_idxs);
-                        X[d] = X_local_soln[X_petsc_vec->map_global_to_local_index(X_idxs[0])];
+                        X[d] = X_local_soln[X_local_idxs[NDIM * k + d]];
                         inside_patch =
                             inside_patch && (X[d] >= patch_x_lower[d]) &&
                             ((X[d] < patch_x_upper[d]) || (touches_upper_regular_bdry[d] && X[d] <= patch_x_upper[d]));
                     }
                     if (inside_patch)
                     {
-                        F_node.resize(F_node.size() + n_vars, 0.0);
+                        F_nodes.push_back(k);
                         X_node.insert(X_node.end(), &X[0], &X[0] + NDIM);
-                        for (unsigned int i = 0; i < n_vars; ++i)
-                        {
-                            IBTK::get_nodal_dof_indices(F_dof_map, n, i, F_idxs);
-                            F_node_idxs.insert(F_node_idxs.end(), F_idxs.begin(), F_idxs.end());
-                        }
                     }
                 }
-                TBOX_ASSERT(F_node.size() <= n_vars * num_active_patch_nodes);
                 TBOX_ASSERT(X_node.size() <= NDIM * num_active_patch_nodes);
-                TBOX_ASSERT(F_node_idxs.size() <= n_vars * num_active_patch_nodes);
 
-                if (F_node.empty()) continue;
+                if (F_nodes.empty()) continue;
 
                 // Interpolate values from the Cartesian grid patch to the nodes.
                 //
@@ -1884,57 +2074,86 @@ FEDataManager::interpWeighted(const int f_data_idx,
                 // cell width of 1 to ensure that roundoff errors do not
                 // inadvertently exclude the selected points.
                 const Box<NDIM>& interp_box = Box<NDIM>::grow(patch->getBox(), IntVector<NDIM>(1));
-                Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idx);
-                if (cc_data)
+                for (std::size_t s = 0; s < n_systems; ++s)
                 {
-                    Pointer<CellData<NDIM, double> > f_cc_data = f_data;
-                    LEInteractor::interpolate(
-                        F_node, n_vars, X_node, NDIM, f_cc_data, patch, interp_box, interp_spec.kernel_fcn);
-                }
-                if (sc_data)
-                {
-                    Pointer<SideData<NDIM, double> > f_sc_data = f_data;
-                    LEInteractor::interpolate(
-                        F_node, n_vars, X_node, NDIM, f_sc_data, patch, interp_box, interp_spec.kernel_fcn);
-                }
+                    InterpSystemData& F_sys = F_systems[s];
+                    const unsigned int n_vars = F_sys.n_vars;
+                    const PatchNodalDOFData& F_dof_data =
+                        getPatchNodalDOFData(ln, local_patch_num, system_names[s], *F_sys.petsc_vec);
+                    F_node.assign(n_vars * F_nodes.size(), 0.0);
+                    F_node_idxs.clear();
+                    F_local_idxs.clear();
+                    F_node_idxs.reserve(n_vars * F_nodes.size());
+                    F_local_idxs.reserve(n_vars * F_nodes.size());
+                    for (const unsigned int k : F_nodes)
+                    {
+                        for (unsigned int i = 0; i < n_vars; ++i)
+                        {
+                            F_node_idxs.push_back(F_dof_data.dof_indices[n_vars * k + i]);
+                            F_local_idxs.push_back(F_dof_data.local_dof_indices[n_vars * k + i]);
+                        }
+                    }
+                    TBOX_ASSERT(F_node_idxs.size() == F_node.size());
 
-                // Scale by the diagonal mass matrix.
-                std::vector<dof_id_type> F_local_idxs(F_node_idxs.size());
-                for (unsigned int i = 0; i < F_node_idxs.size(); ++i)
-                {
-                    F_local_idxs[i] = F_petsc_vec->map_global_to_local_index(F_node_idxs[i]);
-                    TBOX_ASSERT(F_local_idxs[i] == dX_vec->map_global_to_local_index(F_node_idxs[i]));
-                    F_node[i] *= dX_local_soln[F_local_idxs[i]];
-                }
+                    Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idxs[s]);
+                    if (F_sys.cc_data)
+                    {
+                        Pointer<CellData<NDIM, double> > f_cc_data = f_data;
+                        LEInteractor::interpolate(
+                            F_node, n_vars, X_node, NDIM, f_cc_data, patch, interp_box, interp_kernel_fcn);
+                    }
+                    if (F_sys.sc_data)
+                    {
+                        Pointer<SideData<NDIM, double> > f_sc_data = f_data;
+                        LEInteractor::interpolate(
+                            F_node, n_vars, X_node, NDIM, f_sc_data, patch, interp_box, interp_kernel_fcn);
+                    }
 
-                // Insert the values into the global array.
-                if (is_ghosted)
-                {
+                    // Scale by the diagonal mass matrix.
                     for (unsigned int i = 0; i < F_node_idxs.size(); ++i)
                     {
-                        F_local_soln[F_local_idxs[i]] += F_node[i];
+#ifndef NDEBUG
+                        TBOX_ASSERT(F_local_idxs[i] == dX_vecs[s]->map_global_to_local_index(F_node_idxs[i]));
+#endif
+                        F_node[i] *= dX_local_solns[s][F_local_idxs[i]];
+                    }
+
+                    // Insert the values into the global array.
+                    if (F_sys.is_ghosted)
+                    {
+                        for (unsigned int i = 0; i < F_node_idxs.size(); ++i)
+                        {
+                            F_sys.local_soln[F_local_idxs[i]] += F_node[i];
+                        }
+                    }
+                    else
+                    {
+                        F_vecs[s]->add_vector(F_node, F_node_idxs);
                     }
-                }
-                else
-                {
-                    F_vec.add_vector(F_node, F_node_idxs);
                 }
             }
         }
 
         // Restore local form vectors.
-        dX_vec->restore_array();
+        for (std::size_t s = 0; s < n_systems; ++s)
+        {
+            dX_vecs[s]->restore_array();
+        }
     }
     else
     {
-        // Loop over the patches to interpolate values to the element quadrature
-        // points from the grid, then use these values to compute the projection
-        // of the interpolated velocity field onto the FE basis functions.
-        DenseVector<double> F_rhs;
-        // Assemble F_rhs_e's vectors in an interleaved format (see the implementation):
-        std::vector<double> F_rhs_concatenated;
-        std::vector<double> F_qp, X_qp;
-        std::vector<libMesh::dof_id_type> dof_id_scratch;
+        // Determining which quadrature rule should be used on which
+        // processor is surprisingly expensive, so the keys and the quadrature
+        // point positions are cached between calls. Since neither these nor
+        // the DOF index caches are thread-safe, all cached data is looked up
+        // before any values are computed.
+        struct PatchInterpData
+        {
+            Pointer<Patch<NDIM> > patch;
+            int ln, local_patch_num;
+            std::vector<std::vector<const boost::multi_array<dof_id_type, 2>*> > F_dof_indices;
+        };
+        std::vector<PatchInterpData> patch_interp_data;
         for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
         {
             Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -1951,58 +2170,91 @@ FEDataManager::interpWeighted(const int f_data_idx,
                 const double* const patch_dx = patch_geom->getDx();
                 const double patch_dx_min = *std::min_element(patch_dx, patch_dx + NDIM);
 
-                // Determining which quadrature rule should be used on which
-                // processor is surprisingly expensive, so cache the keys:
-                std::vector<quad_key_type> quad_keys(num_active_patch_elems);
-
-                // Cache interpolated positions too:
-                std::vector<boost::multi_array<double, 2> > X_nodes(num_active_patch_elems);
-
-                // Setup vectors to store the values of F and X at the quadrature
-                // points.
-                unsigned int n_qp_patch = 0;
-                for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+                const PatchQuadratureData& quad_data =
+                    getPatchQuadratureData(ln,
+                                           local_patch_num,
+                                           patch_dx_min,
+                                           interp_spec.quad_type,
+                                           interp_spec.quad_order,
+                                           interp_spec.use_adaptive_quadrature,
+                                           interp_spec.point_density,
+                                           interp_spec.allow_rules_with_negative_weights,
+                                           *X_petsc_vec,
+                                           X_local_soln,
+                                           X_dof_map_cache,
+                                           X_fe_cache);
+                if (!quad_data.n_qp_patch) continue;
+                patch_interp_data.emplace_back();
+                PatchInterpData& interp_data = patch_interp_data.back();
+                interp_data.patch = patch;
+                interp_data.ln = ln;
+                interp_data.local_patch_num = local_patch_num;
+                interp_data.F_dof_indices.resize(n_systems);
+                for (std::size_t s = 0; s < n_systems; ++s)
                 {
-                    Elem* const elem = patch_elems[e_idx];
-                    const auto& X_dof_indices = X_dof_map_cache.dof_indices(elem);
-                    get_values_for_interpolation(X_nodes[e_idx], *X_petsc_vec, X_local_soln, X_dof_indices);
-                    const quad_key_type key = getQuadratureKey(interp_spec.quad_type,
-                                                               interp_spec.quad_order,
-                                                               interp_spec.use_adaptive_quadrature,
-                                                               interp_spec.point_density,
-                                                               interp_spec.allow_rules_with_negative_weights,
-                                                               elem,
-                                                               X_nodes[e_idx],
-                                                               patch_dx_min);
-                    QBase& qrule = d_fe_data->d_quadrature_cache[key];
-                    n_qp_patch += qrule.n_points();
-                    quad_keys[e_idx] = key;
+                    interp_data.F_dof_indices[s].reserve(num_active_patch_elems);
+                    for (const Elem* const elem : patch_elems)
+                    {
+                        interp_data.F_dof_indices[s].push_back(&F_systems[s].dof_map_cache->dof_indices(elem));
+                    }
                 }
-                if (!n_qp_patch) continue;
-                F_qp.resize(n_vars * n_qp_patch);
-                X_qp.resize(NDIM * n_qp_patch);
-                std::fill(F_qp.begin(), F_qp.end(), 0.0);
+            }
+        }
 
-                // Loop over the elements and compute the positions of the
-                // quadrature points.
-                int qp_offset = 0;
-                for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+        // Loop over the patches to interpolate values to the element quadrature
+        // points from the grid, then use these values to compute the projection
+        // of the interpolated velocity field onto the FE basis functions.
+        //
+        // When threading is enabled the patches are distributed among the
+        // threads, each of which uses its own FE objects. Since elements are
+        // shared between patches, each thread also accumulates into its own
+        // copy of the local form of each right-hand side vector. Adding values
+        // to vectors that are not ghosted is not thread-safe, so in that case
+        // the patches are always processed serially.
+        const int num_interp_patches = static_cast<int>(patch_interp_data.size());
+#ifdef _OPENMP
+        bool use_threads_for_systems = use_threads;
+        for (const InterpSystemData& F_sys : F_systems)
+        {
+            use_threads_for_systems = use_threads_for_systems && F_sys.is_ghosted;
+        }
+#pragma omp parallel if (use_threads_for_systems)
+#endif
+        {
+            FECache F_fe_cache(dim, F_fe_type, FEUpdateFlags::update_phi);
+            FEMappingCache<NDIM, NDIM> volume_mapping_cache(FEUpdateFlags::update_JxW);
+            FEMappingCache<NDIM - 1, NDIM> surface_mapping_cache(FEUpdateFlags::update_JxW);
+            DenseVector<double> F_rhs;
+            // Assemble F_rhs_e's vectors in an interleaved format (see the implementation):
+            std::vector<double> F_rhs_concatenated;
+            std::vector<std::vector<double> > F_qps(n_systems);
+            std::vector<libMesh::dof_id_type> dof_id_scratch;
+            std::vector<double*> F_local_solns(n_systems);
+            std::vector<std::vector<double> > F_thread_solns(n_systems);
+            for (std::size_t s = 0; s < n_systems; ++s)
+            {
+                F_local_solns[s] = F_systems[s].local_soln;
+#ifdef _OPENMP
+                if (use_threads_for_systems)
                 {
-                    Elem* const elem = patch_elems[e_idx];
-                    TBOX_ASSERT(elem->active());
-                    const quad_key_type& key = quad_keys[e_idx];
-                    const QBase& qrule = d_fe_data->d_quadrature_cache[key];
-                    const FEBase& X_fe = X_fe_cache(key, elem);
-                    const std::vector<std::vector<double> >& phi_X = X_fe.get_phi();
-
-                    const unsigned int n_node = elem->n_nodes();
-                    const unsigned int n_qp = qrule.n_points();
-                    TBOX_ASSERT(n_qp == phi_X[0].size());
-                    double* X_begin = &X_qp[NDIM * qp_offset];
-                    std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
-                    sum_weighted_elem_solution<true>(NDIM, n_node, qp_offset, phi_X, {}, X_nodes[e_idx], X_qp);
-                    qp_offset += n_qp;
+                    F_thread_solns[s].resize(F_systems[s].local_size, 0.0);
+                    F_local_solns[s] = F_thread_solns[s].data();
                 }
+#endif
+            }
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic) nowait
+#endif
+            for (int k = 0; k < num_interp_patches; ++k)
+            {
+                const PatchInterpData& interp_data = patch_interp_data[k];
+                const Pointer<Patch<NDIM> >& patch = interp_data.patch;
+                const std::vector<Elem*>& patch_elems =
+                    d_active_patch_elem_map[interp_data.ln][interp_data.local_patch_num];
+                const PatchQuadratureData& quad_data =
+                    d_patch_quadrature_data[interp_data.ln][interp_data.local_patch_num];
+                const std::vector<double>& X_qp = quad_data.X_qp;
+                const unsigned int n_qp_patch = quad_data.n_qp_patch;
 
                 // Interpolate values from the Cartesian grid patch to the
                 // quadrature points.
@@ -2010,103 +2262,141 @@ FEDataManager::interpWeighted(const int f_data_idx,
                 // NOTE: Values are interpolated only to those quadrature points
                 // that are within the patch interior.
                 const Box<NDIM>& interp_box = patch->getBox();
-                Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idx);
-                if (cc_data)
-                {
-                    Pointer<CellData<NDIM, double> > f_cc_data = f_data;
-                    LEInteractor::interpolate(
-                        F_qp, n_vars, X_qp, NDIM, f_cc_data, patch, interp_box, interp_spec.kernel_fcn);
-                }
-                if (sc_data)
+                for (std::size_t s = 0; s < n_systems; ++s)
                 {
-                    Pointer<SideData<NDIM, double> > f_sc_data = f_data;
-                    LEInteractor::interpolate(
-                        F_qp, n_vars, X_qp, NDIM, f_sc_data, patch, interp_box, interp_spec.kernel_fcn);
+                    const InterpSystemData& F_sys = F_systems[s];
+                    std::vector<double>& F_qp = F_qps[s];
+                    F_qp.assign(F_sys.n_vars * n_qp_patch, 0.0);
+                    Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idxs[s]);
+                    if (F_sys.cc_data)
+                    {
+                        Pointer<CellData<NDIM, double> > f_cc_data = f_data;
+                        LEInteractor::interpolate(
+                            F_qp, F_sys.n_vars, X_qp, NDIM, f_cc_data, patch, interp_box, interp_kernel_fcn);
+                    }
+                    if (F_sys.sc_data)
+                    {
+                        Pointer<SideData<NDIM, double> > f_sc_data = f_data;
+                        LEInteractor::interpolate(
+                            F_qp, F_sys.n_vars, X_qp, NDIM, f_sc_data, patch, interp_box, interp_kernel_fcn);
+                    }
                 }
 
-                // Loop over the elements and accumulate the right-hand-side values.
-                qp_offset = 0;
-                for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+                // Loop over the elements, grouped by quadrature rule, and
+                // accumulate the right-hand-side values of each system using
+                // the same shape functions and Jacobians.
+                int qp_offset = 0;
+                for (const PatchQuadratureData::KeyGroup& group : quad_data.key_groups)
                 {
-                    Elem* const elem = patch_elems[e_idx];
-                    const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
-                    // check the concatenation assumption
-#ifndef NDEBUG
-                    for (unsigned int i = 0; i < n_vars; ++i)
+                    const quad_key_type& key = group.key;
+                    const unsigned int n_qp = group.n_qp;
+                    for (const unsigned int e_idx : group.elem_idxs)
                     {
-                        TBOX_ASSERT(F_dof_indices[i].size() == F_dof_indices[0].size());
-                    }
-#endif
-                    F_rhs_concatenated.resize(n_vars * F_dof_indices[0].size());
-                    std::fill(F_rhs_concatenated.begin(), F_rhs_concatenated.end(), 0.0);
-                    const quad_key_type& key = quad_keys[e_idx];
-                    const FEBase& F_fe = F_fe_cache(key, elem);
-                    const QBase& qrule = d_fe_data->d_quadrature_cache[key];
+                        Elem* const elem = patch_elems[e_idx];
+                        const FEBase& F_fe = F_fe_cache(key, elem);
 
-                    // JxW depends on the element
-                    const std::vector<double>& JxW_F =
-                        get_JxW(key, elem, is_volume_mesh, volume_mapping_cache, surface_mapping_cache);
-                    const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
+                        // JxW depends on the element
+                        const std::vector<double>& JxW_F =
+                            get_JxW(key, elem, is_volume_mesh, volume_mapping_cache, surface_mapping_cache);
+                        const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
+                        TBOX_ASSERT(n_qp == phi_F[0].size());
+                        TBOX_ASSERT(n_qp == JxW_F.size());
 
-                    const unsigned int n_qp = qrule.n_points();
-                    TBOX_ASSERT(n_qp == phi_F[0].size());
-                    TBOX_ASSERT(n_qp == JxW_F.size());
-                    const size_t n_basis = F_dof_indices[0].size();
-                    integrate_elem_rhs(n_vars, n_basis, qp_offset, phi_F, JxW_F, F_qp, F_rhs_concatenated);
-
-                    for (unsigned int var_n = 0; var_n < n_vars; ++var_n)
-                    {
-                        F_rhs.resize(F_dof_indices[var_n].size());
-                        std::copy(F_rhs_concatenated.begin() + var_n * n_basis,
-                                  F_rhs_concatenated.begin() + (var_n + 1) * n_basis,
-                                  F_rhs.get_values().begin());
-
-                        // We do *not* apply constraints here. See the note in the
-                        // documentation of this function for an explanation.
-                        if (is_ghosted)
+                        for (std::size_t s = 0; s < n_systems; ++s)
                         {
-                            for (unsigned int i = 0; i < F_dof_indices[var_n].size(); ++i)
+                            const InterpSystemData& F_sys = F_systems[s];
+                            const unsigned int n_vars = F_sys.n_vars;
+                            const auto& F_dof_indices = *interp_data.F_dof_indices[s][e_idx];
+                            // check the concatenation assumption
+#ifndef NDEBUG
+                            for (unsigned int i = 0; i < n_vars; ++i)
+                            {
+                                TBOX_ASSERT(F_dof_indices[i].size() == F_dof_indices[0].size());
+                            }
+#endif
+                            const size_t n_basis = F_dof_indices[0].size();
+                            F_rhs_concatenated.resize(n_vars * n_basis);
+                            std::fill(F_rhs_concatenated.begin(), F_rhs_concatenated.end(), 0.0);
+                            integrate_elem_rhs(n_vars, n_basis, qp_offset, phi_F, JxW_F, F_qps[s], F_rhs_concatenated);
+
+                            for (unsigned int var_n = 0; var_n < n_vars; ++var_n)
                             {
-                                const PetscInt index = F_petsc_vec->map_global_to_local_index(F_dof_indices[var_n][i]);
+                                F_rhs.resize(F_dof_indices[var_n].size());
+                                std::copy(F_rhs_concatenated.begin() + var_n * n_basis,
+                                          F_rhs_concatenated.begin() + (var_n + 1) * n_basis,
+                                          F_rhs.get_values().begin());
+
+                                // We do *not* apply constraints here. See the note in the
+                                // documentation of this function for an explanation.
+                                if (F_sys.is_ghosted)
+                                {
+                                    for (unsigned int i = 0; i < F_dof_indices[var_n].size(); ++i)
+                                    {
+                                        const PetscInt index =
+                                            F_sys.petsc_vec->map_global_to_local_index(F_dof_indices[var_n][i]);
 #ifndef NDEBUG
-                                TBOX_ASSERT(0 <= index);
-                                TBOX_ASSERT(index < F_local_size);
+                                        TBOX_ASSERT(0 <= index);
+                                        TBOX_ASSERT(index < F_sys.local_size);
 #endif
-                                F_local_soln[index] += F_rhs(i);
+                                        F_local_solns[s][index] += F_rhs(i);
+                                    }
+                                }
+                                else
+                                {
+                                    copy_dof_ids_to_vector(var_n, F_dof_indices, dof_id_scratch);
+                                    F_vecs[s]->add_vector(F_rhs, dof_id_scratch);
+                                }
                             }
                         }
-                        else
-                        {
-                            copy_dof_ids_to_vector(var_n, F_dof_indices, dof_id_scratch);
-                            F_vec.add_vector(F_rhs, dof_id_scratch);
-                        }
+                        qp_offset += n_qp;
+                    }
+                }
+            }
+#ifdef _OPENMP
+            if (use_threads_for_systems)
+            {
+#pragma omp critical(FEDataManager_interp_rhs_reduction)
+                for (std::size_t s = 0; s < n_systems; ++s)
+                {
+                    for (PetscInt i = 0; i < F_systems[s].local_size; ++i)
+                    {
+                        F_systems[s].local_soln[i] += F_thread_solns[s][i];
                     }
-                    qp_offset += n_qp;
                 }
             }
+#endif
         }
     }
 
     // Restore local form vectors.
     X_petsc_vec->restore_array();
-    if (is_ghosted)
+    for (std::size_t s = 0; s < n_systems; ++s)
     {
-        int ierr = VecRestoreArray(F_local_form, &F_local_soln);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecGhostRestoreLocalForm(F_petsc_vec->vec(), &F_local_form);
-        IBTK_CHKERRQ(ierr);
-
-        if (close_F)
+        InterpSystemData& F_sys = F_systems[s];
+        if (F_sys.is_ghosted)
         {
-            ierr = VecGhostUpdateBegin(F_petsc_vec->vec(), ADD_VALUES, SCATTER_REVERSE);
+            int ierr = VecRestoreArray(F_sys.local_form, &F_sys.local_soln);
             IBTK_CHKERRQ(ierr);
-            ierr = VecGhostUpdateEnd(F_petsc_vec->vec(), ADD_VALUES, SCATTER_REVERSE);
+            ierr = VecGhostRestoreLocalForm(F_sys.petsc_vec->vec(), &F_sys.local_form);
             IBTK_CHKERRQ(ierr);
+
+            if (close_F)
+            {
+                if (CommunicationStatistics::enabled())
+                {
+                    CommunicationStatistics::ScopedPhase phase("fe_scatter");
+                    CommunicationStatistics::getManager()->recordGhostUpdate(F_sys.petsc_vec->vec(), SCATTER_REVERSE);
+                }
+                ierr = VecGhostUpdateBegin(F_sys.petsc_vec->vec(), ADD_VALUES, SCATTER_REVERSE);
+                IBTK_CHKERRQ(ierr);
+                ierr = VecGhostUpdateEnd(F_sys.petsc_vec->vec(), ADD_VALUES, SCATTER_REVERSE);
+                IBTK_CHKERRQ(ierr);
+            }
         }
-    }
 
-    // Accumulate data.
-    if (close_F) F_vec.close();
+        // Accumulate data.
+        if (close_F) F_vecs[s]->close();
+    }
 
     IBTK_TIMER_STOP(t_interp_weighted);
     return;
@@ -2223,7 +2513,7 @@ FEDataManager::restrictData(const int f_data_idx,
     // solve for F.
     std::unique_ptr<NumericVector<double> > F_rhs_vec = F_vec.zero_clone();
     std::vector<DenseVector<double> > F_rhs_e(n_vars);
-    TensorValue<double> dX_ds;
+    MatrixNd dX_ds;
     boost::multi_array<double, 2> X_node;
     std::vector<libMesh::Point> s_node_cache, X_node_cache;
     Point X_min, X_max;
@@ -2350,8 +2640,8 @@ FEDataManager::restrictData(const int f_data_idx,
                 {
                     const SideIndex<NDIM>& i_s = intersection_indices[qp];
                     const int axis = i_s.getAxis();
-                    jacobian(dX_ds, qp, X_node, dphi_X);
-                    const double J = std::abs(dX_ds.det());
+                    jacobian<NDIM>(dX_ds, qp, X_node, dphi_X);
+                    const double J = std::abs(dX_ds.determinant());
                     const double F_qp = (*f_data)(i_s)*dV / J;
                     for (unsigned int k = 0; k < n_basis; ++k)
                     {
@@ -2399,6 +2689,7 @@ FEDataManager::buildIBGhostedDiagonalL2MassMatrix(const std::string& system_name
         *M_vec = *d_fe_projector->buildDiagonalL2MassMatrix(system_name);
         M_vec->close();
         d_L2_proj_matrix_diag_ghost[system_name] = std::move(M_vec);
+        if (MemoryStatistics::enabled()) updateMemoryUsage();
     }
     return d_L2_proj_matrix_diag_ghost[system_name].get();
 }
@@ -2874,6 +3165,10 @@ FEDataManager::FEDataManager(std::string object_name,
         TBOX_ERROR("unrecognized value " << input_db->getString("node_outside_patch_check")
                                          << "for input entry 'node_outside_patch_check'.");
     }
+    d_quad_key_update_tol = input_db->getDoubleWithDefault("quadrature_key_update_tol", d_quad_key_update_tol);
+    d_use_threaded_interaction = input_db->getBoolWithDefault("use_threaded_interaction", d_use_threaded_interaction);
+    d_sort_active_patch_elems_by_cell =
+        input_db->getBoolWithDefault("sort_active_patch_elems_by_cell", d_sort_active_patch_elems_by_cell);
 
     // Setup Timers.
     IBTK_DO_ONCE(
@@ -2882,6 +3177,8 @@ FEDataManager::FEDataManager(std::string object_name,
         t_build_ghosted_solution_vector =
             TimerManager::getManager()->getTimer("IBTK::FEDataManager::buildGhostedSolutionVector()");
         t_build_ghosted_vector = TimerManager::getManager()->getTimer("IBTK::FEDataManager::buildGhostedVector()");
+        t_get_shared_ib_ghosted_vector =
+            TimerManager::getManager()->getTimer("IBTK::FEDataManager::getSharedIBGhostedVector()");
         t_spread = TimerManager::getManager()->getTimer("IBTK::FEDataManager::spread()");
         t_prolong_data = TimerManager::getManager()->getTimer("IBTK::FEDataManager::prolongData()");
         t_interp_weighted = TimerManager::getManager()->getTimer("IBTK::FEDataManager::interpWeighted()");
@@ -2904,6 +3201,11 @@ FEDataManager::~FEDataManager()
     {
         RestartManager::getManager()->unregisterRestartItem(d_object_name);
     }
+    if (MemoryStatistics::enabled())
+    {
+        MemoryStatistics::getManager()->removeUsage("fe_data", this);
+        if (d_fe_data.use_count() == 1) MemoryStatistics::getManager()->removeUsage("fe_data", d_fe_data.get());
+    }
 } // ~FEDataManager
 
 void
@@ -3015,6 +3317,8 @@ FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_
             {
                 const std::vector<Elem*>& patch_elems = d_active_patch_elem_map[ln][local_patch_num];
                 const size_t num_active_patch_elems = patch_elems.size();
+                std::vector<double> X_qp;
+                std::vector<hier::Index<NDIM> > qp_idxs;
                 for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
                 {
                     Elem* const elem = patch_elems[e_idx];
@@ -3035,11 +3339,18 @@ FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_
                     const std::vector<std::vector<double> >& X_phi = X_fe.get_phi();
                     TBOX_ASSERT(qrule.n_points() == X_phi[0].size());
 
-                    Point X_qp;
-                    for (unsigned int qp = 0; qp < qrule.n_points(); ++qp)
+                    const unsigned int n_qp = qrule.n_points();
+                    X_qp.resize(NDIM * n_qp);
+                    qp_idxs.resize(n_qp);
+                    for (unsigned int qp = 0; qp < n_qp; ++qp)
+                    {
+                        interpolate(&X_qp[NDIM * qp], qp, X_node, X_phi);
+                    }
+                    IndexUtilities::getCellIndices(
+                        X_qp.data(), static_cast<int>(n_qp), grid_geom, ratio, qp_idxs.data());
+                    for (unsigned int qp = 0; qp < n_qp; ++qp)
                     {
-                        interpolate(&X_qp[0], qp, X_node, X_phi);
-                        const hier::Index<NDIM> i = IndexUtilities::getCellIndex(X_qp, grid_geom, ratio);
+                        const hier::Index<NDIM>& i = qp_idxs[qp];
                         if (patch_box.contains(i))
                         {
                             (*qp_count_data)(i) += 1.0;
@@ -3081,6 +3392,307 @@ FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_
     return;
 } // updateQuadPointCountData
 
+const FEDataManager::PatchQuadratureData&
+FEDataManager::getPatchQuadratureData(const int ln,
+                                      const int local_patch_num,
+                                      const double patch_dx_min,
+                                      const QuadratureType quad_type,
+                                      const Order quad_order,
+                                      const bool use_adaptive_quadrature,
+                                      const double point_density,
+                                      const bool allow_rules_with_negative_weights,
+                                      const PetscVector<double>& X_petsc_vec,
+                                      const double* const X_local_soln,
+                                      FEData::SystemDofMapCache& X_dof_map_cache,
+                                      FECache& X_fe_cache)
+{
+    if (d_patch_quadrature_data.size() <= static_cast<std::size_t>(ln)) d_patch_quadrature_data.resize(ln + 1);
+    std::vector<PatchQuadratureData>& level_quad_data = d_patch_quadrature_data[ln];
+    if (level_quad_data.size() <= static_cast<std::size_t>(local_patch_num))
+        level_quad_data.resize(local_patch_num + 1);
+    PatchQuadratureData& quad_data = level_quad_data[local_patch_num];
+
+    const std::vector<Elem*>& patch_elems = d_active_patch_elem_map[ln][local_patch_num];
+    const size_t num_active_patch_elems = patch_elems.size();
+
+    // Extract the nodal positions of the elements and check whether they (and
+    // everything else that determines the quadrature rules) match the cached
+    // values.
+    std::vector<boost::multi_array<double, 2> > X_nodes(num_active_patch_elems);
+    const bool quad_params_are_current =
+        quad_data.elems == patch_elems && quad_data.patch_dx_min == patch_dx_min &&
+        quad_data.quad_type == quad_type && quad_data.quad_order == quad_order &&
+        quad_data.use_adaptive_quadrature == use_adaptive_quadrature && quad_data.point_density == point_density &&
+        quad_data.allow_rules_with_negative_weights == allow_rules_with_negative_weights;
+    bool quad_data_is_current = quad_params_are_current;
+    std::size_t X_offset = 0;
+    for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+    {
+        const auto& X_dof_indices = X_dof_map_cache.dof_indices(patch_elems[e_idx]);
+        get_values_for_interpolation(X_nodes[e_idx], X_petsc_vec, X_local_soln, X_dof_indices);
+        if (quad_data_is_current)
+        {
+            const std::size_t n_values = X_nodes[e_idx].num_elements();
+            quad_data_is_current =
+                X_offset + n_values <= quad_data.X_node_values.size() &&
+                std::equal(X_nodes[e_idx].data(),
+                           X_nodes[e_idx].data() + n_values,
+                           quad_data.X_node_values.begin() + X_offset);
+            X_offset += n_values;
+        }
+    }
+    if (quad_data_is_current && X_offset == quad_data.X_node_values.size()) return quad_data;
+
+    // Update the quadrature keys. If the elements, the grid spacing, and the
+    // quadrature parameters are unchanged then the key of an element can only
+    // change (when adaptive quadrature is used) if the number of points per
+    // edge computed from its maximum edge length changes, so we only call
+    // getQuadratureKey() for those elements.
+    if (!quad_params_are_current)
+    {
+        quad_data.elems = patch_elems;
+        quad_data.patch_dx_min = patch_dx_min;
+        quad_data.quad_type = quad_type;
+        quad_data.quad_order = quad_order;
+        quad_data.use_adaptive_quadrature = use_adaptive_quadrature;
+        quad_data.point_density = point_density;
+        quad_data.allow_rules_with_negative_weights = allow_rules_with_negative_weights;
+    }
+    quad_data.quad_keys.resize(num_active_patch_elems);
+    quad_data.quad_key_n_points.resize(num_active_patch_elems);
+    bool quad_keys_changed = !quad_params_are_current;
+    const std::size_t num_updated_elems =
+        quad_params_are_current && !use_adaptive_quadrature ? 0 : num_active_patch_elems;
+    for (unsigned int e_idx = 0; e_idx < num_updated_elems; ++e_idx)
+    {
+        Elem* const elem = patch_elems[e_idx];
+        double n_points = 0.0;
+        if (use_adaptive_quadrature)
+        {
+            const double n_points_exact = point_density * get_max_edge_length(elem, X_nodes[e_idx]) / patch_dx_min;
+            n_points = std::ceil(n_points_exact);
+            const double n_points_cached = quad_data.quad_key_n_points[e_idx];
+            if (quad_params_are_current && (n_points_cached - 1.0) * (1.0 - d_quad_key_update_tol) < n_points_exact &&
+                n_points_exact <= n_points_cached * (1.0 + d_quad_key_update_tol))
+            {
+                continue;
+            }
+        }
+        const quadrature_key_type key = getQuadratureKey(quad_type,
+                                                         quad_order,
+                                                         use_adaptive_quadrature,
+                                                         point_density,
+                                                         allow_rules_with_negative_weights,
+                                                         elem,
+                                                         X_nodes[e_idx],
+                                                         patch_dx_min);
+        quad_keys_changed = quad_keys_changed || key != quad_data.quad_keys[e_idx];
+        quad_data.quad_keys[e_idx] = key;
+        quad_data.quad_key_n_points[e_idx] = n_points;
+    }
+
+    // Group the elements by their quadrature keys.
+    if (quad_keys_changed)
+    {
+        std::map<quadrature_key_type, unsigned int> key_group_idxs;
+        quad_data.key_groups.clear();
+        quad_data.n_qp_patch = 0;
+        for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+        {
+            const quadrature_key_type& key = quad_data.quad_keys[e_idx];
+            const auto it = key_group_idxs.emplace(key, static_cast<unsigned int>(quad_data.key_groups.size())).first;
+            if (it->second == quad_data.key_groups.size())
+            {
+                quad_data.key_groups.emplace_back();
+                quad_data.key_groups.back().key = key;
+                quad_data.key_groups.back().n_qp = d_fe_data->d_quadrature_cache[key].n_points();
+            }
+            PatchQuadratureData::KeyGroup& group = quad_data.key_groups[it->second];
+            group.elem_idxs.push_back(e_idx);
+            quad_data.n_qp_patch += group.n_qp;
+        }
+    }
+
+    // Recompute the positions of the quadrature points.
+    quad_data.X_node_values.clear();
+    for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
+    {
+        quad_data.X_node_values.insert(quad_data.X_node_values.end(),
+                                       X_nodes[e_idx].data(),
+                                       X_nodes[e_idx].data() + X_nodes[e_idx].num_elements());
+    }
+    std::vector<double>& X_qp = quad_data.X_qp;
+    X_qp.resize(NDIM * quad_data.n_qp_patch);
+    int qp_offset = 0;
+    for (const PatchQuadratureData::KeyGroup& group : quad_data.key_groups)
+    {
+        const quadrature_key_type& key = group.key;
+        const unsigned int n_qp = group.n_qp;
+        for (const unsigned int e_idx : group.elem_idxs)
+        {
+            Elem* const elem = patch_elems[e_idx];
+            TBOX_ASSERT(elem->active());
+            const FEBase& X_fe = X_fe_cache(key, elem);
+            const std::vector<std::vector<double> >& phi_X = X_fe.get_phi();
+            TBOX_ASSERT(n_qp == phi_X[0].size());
+            double* X_begin = &X_qp[NDIM * qp_offset];
+            std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
+            sum_weighted_elem_solution</*weights_are_unity*/ true>(
+                NDIM, phi_X.size(), qp_offset, phi_X, {}, X_nodes[e_idx], X_qp);
+            qp_offset += n_qp;
+        }
+    }
+    return quad_data;
+} // getPatchQuadratureData
+
+const FEDataManager::PatchNodalDOFData&
+FEDataManager::getPatchNodalDOFData(const int ln,
+                                    const int local_patch_num,
+                                    const std::string& system_name,
+                                    const PetscVector<double>& vec)
+{
+    std::vector<std::vector<PatchNodalDOFData> >& system_dof_data = d_patch_nodal_dof_data[system_name];
+    if (system_dof_data.size() <= static_cast<std::size_t>(ln)) system_dof_data.resize(ln + 1);
+    std::vector<PatchNodalDOFData>& level_dof_data = system_dof_data[ln];
+    if (level_dof_data.size() <= static_cast<std::size_t>(local_patch_num))
+        level_dof_data.resize(local_patch_num + 1);
+    PatchNodalDOFData& dof_data = level_dof_data[local_patch_num];
+    if (dof_data.initialized)
+    {
+#ifndef NDEBUG
+        for (std::size_t i = 0; i < dof_data.dof_indices.size(); ++i)
+        {
+            TBOX_ASSERT(dof_data.local_dof_indices[i] == vec.map_global_to_local_index(dof_data.dof_indices[i]));
+        }
+#endif
+        return dof_data;
+    }
+
+    const System& system = d_fe_data->d_es->get_system(system_name);
+    const unsigned int n_vars = system.n_vars();
+    const DofMap& dof_map = system.get_dof_map();
+    const std::vector<Node*>& patch_nodes = d_active_patch_node_map[ln][local_patch_num];
+    dof_data.dof_indices.clear();
+    dof_data.dof_indices.reserve(n_vars * patch_nodes.size());
+    std::vector<dof_id_type> idxs;
+    for (const Node* const n : patch_nodes)
+    {
+        for (unsigned int i = 0; i < n_vars; ++i)
+        {
+            IBTK::get_nodal_dof_indices(dof_map, n, i, idxs);
+            TBOX_ASSERT(idxs.size() == 1);
+            dof_data.dof_indices.push_back(idxs[0]);
+        }
+    }
+    dof_data.local_dof_indices.resize(dof_data.dof_indices.size());
+    for (std::size_t i = 0; i < dof_data.dof_indices.size(); ++i)
+    {
+        dof_data.local_dof_indices[i] = vec.map_global_to_local_index(dof_data.dof_indices[i]);
+    }
+    dof_data.initialized = true;
+    return dof_data;
+} // getPatchNodalDOFData
+
+void
+FEDataManager::updateAdaptiveSubdomainLevels()
+{
+    if (!d_level_lookup.hasAdaptiveLevels()) return;
+    const std::map<libMesh::subdomain_id_type, int>& assigned_levels = d_level_lookup.getAssignedLevels();
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+
+    // Index the boxes of each level (on all processes) in physical
+    // coordinates.
+    const Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    const double* const x_lower = grid_geom->getXLower();
+    const double* const x_upper = grid_geom->getXUpper();
+    const double* const dx_0 = grid_geom->getDx();
+    const Box<NDIM> domain_box = grid_geom->getPhysicalDomain()[0];
+    std::vector<BoxTree> level_trees(finest_ln + 1);
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        const IntVector<NDIM>& ratio = level->getRatio();
+        const BoxArray<NDIM>& boxes = level->getBoxes();
+        EigenAlignedVector<std::pair<Point, Point> > level_boxes(boxes.getNumberOfBoxes());
+        for (int k = 0; k < boxes.getNumberOfBoxes(); ++k)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                const double dx = dx_0[d] / ratio(d);
+                const int domain_lower = domain_box.lower(d) * ratio(d);
+                level_boxes[k].first[d] = x_lower[d] + dx * (boxes[k].lower(d) - domain_lower);
+                level_boxes[k].second[d] = x_lower[d] + dx * (boxes[k].upper(d) + 1 - domain_lower);
+            }
+        }
+        level_trees[ln] = BoxTree(level_boxes);
+    }
+
+    // Determine, for each subdomain, the finest level that contains all of its
+    // local nodes. Since nodes may be shared by elements on different
+    // subdomains we check the nodes of each element.
+    std::vector<int> subdomain_levels;
+    std::map<libMesh::subdomain_id_type, std::size_t> subdomain_idxs;
+    for (const auto& id_level : assigned_levels)
+    {
+        subdomain_idxs[id_level.first] = subdomain_levels.size();
+        subdomain_levels.push_back(std::min(id_level.second, finest_ln));
+    }
+
+    const MeshBase& mesh = d_fe_data->d_es->get_mesh();
+    const System& X_system = d_fe_data->d_es->get_system(COORDINATES_SYSTEM_NAME);
+    const DofMap& X_dof_map = X_system.get_dof_map();
+    std::unique_ptr<NumericVector<double> > X_ghost_vec = X_system.current_local_solution->zero_clone();
+    copy_and_synch(*X_system.solution, *X_ghost_vec, /*close_v_in*/ false);
+
+    std::vector<dof_id_type> X_idxs;
+    std::vector<int> box_ids;
+    const auto el_begin = mesh.active_local_elements_begin();
+    const auto el_end = mesh.active_local_elements_end();
+    for (auto el_it = el_begin; el_it != el_end; ++el_it)
+    {
+        const Elem* const elem = *el_it;
+        const auto idx_it = subdomain_idxs.find(elem->subdomain_id());
+        if (idx_it == subdomain_idxs.end()) continue;
+        int& subdomain_ln = subdomain_levels[idx_it->second];
+        for (unsigned int n = 0; n < elem->n_nodes() && subdomain_ln > 0; ++n)
+        {
+            const Node* const node = elem->node_ptr(n);
+            IBTK::Point X;
+            bool inside_domain = true;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                IBTK::get_nodal_dof_indices(X_dof_map, node, d, X_idxs);
+                X[d] = (*X_ghost_vec)(X_idxs[0]);
+                inside_domain = inside_domain && (x_lower[d] < X[d] && X[d] < x_upper[d]);
+            }
+            // Nodes outside the domain are not used for IB calculations.
+            if (!inside_domain) continue;
+            for (; subdomain_ln > 0; --subdomain_ln)
+            {
+                box_ids.clear();
+                level_trees[subdomain_ln].query(X, X, box_ids);
+                if (!box_ids.empty()) break;
+            }
+        }
+    }
+    if (!subdomain_levels.empty())
+    {
+        IBTK_MPI::minReduction(subdomain_levels.data(), static_cast<int>(subdomain_levels.size()));
+    }
+
+    for (const auto& id_idx : subdomain_idxs)
+    {
+        const int new_ln = subdomain_levels[id_idx.second];
+        if (d_enable_logging && new_ln != d_level_lookup[id_idx.first])
+        {
+            plog << "FEDataManager::updateAdaptiveSubdomainLevels(): subdomain " << id_idx.first
+                 << " now interacts with patch level " << new_ln << "\n";
+        }
+        d_level_lookup.setLevel(id_idx.first, new_ln);
+    }
+    return;
+} // updateAdaptiveSubdomainLevels
+
 void
 FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& active_patch_elems,
                                           const int level_number,
@@ -3088,7 +3700,7 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
                                           const int finest_elem_ln)
 {
     // Get the necessary FE data.
-    const MeshBase& mesh = d_fe_data->d_es->get_mesh();
+    MeshBase& mesh = d_fe_data->d_es->get_mesh();
     System& X_system = d_fe_data->d_es->get_system(COORDINATES_SYSTEM_NAME);
 
     // Setup data structures used to assign elements to patches.
@@ -3154,58 +3766,171 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
         local_bboxes.back().union_with(local_qp_bboxes[box_n]);
 #endif
     }
-    const std::vector<libMeshWrappers::BoundingBox> global_bboxes =
-        get_global_element_bounding_boxes(mesh, local_bboxes);
-
-    int local_patch_num = 0;
-    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+    // Index the local patches, grown by the ghost width, with an R-tree and
+    // find the bounding box of the patches of each process.
+    EigenAlignedVector<std::pair<Point, Point> > patch_boxes;
+    std::vector<double> rank_box(2 * NDIM);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        rank_box[d] = std::numeric_limits<double>::max();
+        rank_box[NDIM + d] = -std::numeric_limits<double>::max();
+    }
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
-        std::set<Elem*>& elems = local_patch_elems[local_patch_num];
         Pointer<Patch<NDIM> > patch = level->getPatch(p());
         const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
         const double* const dx = pgeom->getDx();
-        // TODO: reimplement this with an rtree description of SAMRAI's patches
-        libMeshWrappers::BoundingBox patch_bbox;
+        patch_boxes.emplace_back();
         for (unsigned int d = 0; d < NDIM; ++d)
         {
-            patch_bbox.first(d) = pgeom->getXLower()[d] - dx[d] * d_associated_elem_ghost_width(d);
-            patch_bbox.second(d) = pgeom->getXUpper()[d] + dx[d] * d_associated_elem_ghost_width(d);
+            patch_boxes.back().first[d] = pgeom->getXLower()[d] - dx[d] * d_associated_elem_ghost_width(d);
+            patch_boxes.back().second[d] = pgeom->getXUpper()[d] + dx[d] * d_associated_elem_ghost_width(d);
+            rank_box[d] = std::min(rank_box[d], patch_boxes.back().first[d]);
+            rank_box[NDIM + d] = std::max(rank_box[NDIM + d], patch_boxes.back().second[d]);
         }
-        for (unsigned int d = NDIM; d < LIBMESH_DIM; ++d)
+    }
+    const BoxTree patch_tree(patch_boxes);
+
+    const int n_procs = IBTK_MPI::getNodes();
+    std::vector<double> rank_boxes(2 * NDIM * n_procs);
+    IBTK_MPI::allGather(rank_box.data(), 2 * NDIM, rank_boxes.data(), 2 * NDIM * n_procs);
+    EigenAlignedVector<std::pair<Point, Point> > rank_box_pairs(n_procs);
+    for (int rank = 0; rank < n_procs; ++rank)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d)
         {
-            patch_bbox.first(d) = 0.0;
-            patch_bbox.second(d) = 0.0;
+            rank_box_pairs[rank].first[d] = rank_boxes[2 * NDIM * rank + d];
+            rank_box_pairs[rank].second[d] = rank_boxes[2 * NDIM * rank + NDIM + d];
         }
+    }
+    const BoxTree rank_tree(rank_box_pairs);
+
+    // Send the id and bounding box of each local element only to the
+    // processes whose patches may intersect it (instead of replicating all
+    // bounding boxes on all processes).
+    static const int buf_entry_size = 2 * NDIM + 1;
+    std::vector<std::vector<double> > send_bufs(n_procs);
+    std::vector<int> ranks;
+    std::size_t box_n = 0;
+    const auto el_begin = mesh.local_elements_begin();
+    const auto el_end = mesh.local_elements_end();
+    for (auto el_it = el_begin; el_it != el_end; ++el_it, ++box_n)
+    {
+        if (!(*el_it)->active()) continue;
+        const int elem_ln = getPatchLevel(*el_it);
+        if (elem_ln < coarsest_elem_ln || finest_elem_ln < elem_ln) continue;
+        Point elem_lower, elem_upper;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            elem_lower[d] = local_bboxes[box_n].first(d);
+            elem_upper[d] = local_bboxes[box_n].second(d);
+        }
+        ranks.clear();
+        rank_tree.query(elem_lower, elem_upper, ranks);
+        for (const int rank : ranks)
+        {
+            std::vector<double>& send_buf = send_bufs[rank];
+            send_buf.push_back(static_cast<double>((*el_it)->id()));
+            send_buf.insert(send_buf.end(), elem_lower.data(), elem_lower.data() + NDIM);
+            send_buf.insert(send_buf.end(), elem_upper.data(), elem_upper.data() + NDIM);
+        }
+    }
+    std::vector<int> send_counts(n_procs), send_displs(n_procs, 0), recv_counts(n_procs), recv_displs(n_procs, 0);
+    std::vector<double> send_buf;
+    for (int rank = 0; rank < n_procs; ++rank)
+    {
+        send_counts[rank] = static_cast<int>(send_bufs[rank].size());
+        if (rank > 0) send_displs[rank] = send_displs[rank - 1] + send_counts[rank - 1];
+        send_buf.insert(send_buf.end(), send_bufs[rank].begin(), send_bufs[rank].end());
+    }
+    int ierr = MPI_Alltoall(
+        send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, IBTK_MPI::getCommunicator());
+    TBOX_ASSERT(ierr == 0);
+    for (int rank = 1; rank < n_procs; ++rank) recv_displs[rank] = recv_displs[rank - 1] + recv_counts[rank - 1];
+    std::vector<double> recv_buf(recv_displs[n_procs - 1] + recv_counts[n_procs - 1]);
+    ierr = MPI_Alltoallv(send_buf.data(),
+                         send_counts.data(),
+                         send_displs.data(),
+                         MPI_DOUBLE,
+                         recv_buf.data(),
+                         recv_counts.data(),
+                         recv_displs.data(),
+                         MPI_DOUBLE,
+                         IBTK_MPI::getCommunicator());
+    TBOX_ASSERT(ierr == 0);
+    if (CommunicationStatistics::enabled())
+    {
+        for (int rank = 0; rank < n_procs; ++rank)
+        {
+            if (send_counts[rank] > 0)
+                CommunicationStatistics::getManager()->recordSend(rank, sizeof(double) * send_counts[rank]);
+        }
+    }
 
-        auto el_it = mesh.elements_begin();
-        for (const libMeshWrappers::BoundingBox& bbox : global_bboxes)
+    // Associate the received elements with the intersecting local patches.
+    // The centers of the element bounding boxes are only needed to sort the
+    // elements of each patch.
+    std::vector<int> patch_nums;
+    std::unordered_map<Elem*, std::array<double, NDIM> > elem_centers;
+    for (std::size_t k = 0; k < recv_buf.size(); k += buf_entry_size)
+    {
+        Point elem_lower, elem_upper;
+        for (unsigned int d = 0; d < NDIM; ++d)
         {
-            if ((*el_it)->active())
-            {
-                const int elem_ln = getPatchLevel(*el_it);
-                if (coarsest_elem_ln <= elem_ln && elem_ln <= finest_elem_ln)
-                {
-#if LIBMESH_VERSION_LESS_THAN(1, 6, 0)
-                    if (bbox_intersects(bbox, patch_bbox)) elems.insert(*el_it);
-#else
-                    // New versions of libMesh have this function's performance
-                    // problems fixed
-                    if (bbox.intersects(patch_bbox)) elems.insert(*el_it);
-#endif
-                }
-            }
-            ++el_it;
+            elem_lower[d] = recv_buf[k + 1 + d];
+            elem_upper[d] = recv_buf[k + 1 + NDIM + d];
+        }
+        patch_nums.clear();
+        patch_tree.query(elem_lower, elem_upper, patch_nums);
+        if (patch_nums.empty()) continue;
+        // Distributed meshes must keep copies of all elements near the local
+        // patches (e.g., via BoxGhostingFunctor).
+        Elem* const elem = mesh.query_elem_ptr(static_cast<dof_id_type>(recv_buf[k]));
+        if (!elem)
+        {
+            TBOX_ERROR("FEDataManager::collectActivePatchElements():\n"
+                       << "  element " << static_cast<dof_id_type>(recv_buf[k])
+                       << " intersects a local patch but is not stored on this processor" << std::endl);
+        }
+        for (const int patch_num : patch_nums) local_patch_elems[patch_num].insert(elem);
+        if (d_sort_active_patch_elems_by_cell)
+        {
+            std::array<double, NDIM>& center = elem_centers[elem];
+            for (unsigned int d = 0; d < NDIM; ++d) center[d] = 0.5 * (elem_lower[d] + elem_upper[d]);
         }
     }
 
     // Set the active patch element data.
-    local_patch_num = 0;
+    int local_patch_num = 0;
+    std::vector<std::pair<std::uint64_t, Elem*> > elem_keys;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
     {
         const std::set<Elem*>& local_elems = local_patch_elems[local_patch_num];
         std::vector<Elem*>& active_elems = active_patch_elems[local_patch_num];
         active_elems.resize(local_elems.size());
         std::copy(local_elems.begin(), local_elems.end(), active_elems.begin());
+        if (!d_sort_active_patch_elems_by_cell) continue;
+
+        // Order the elements along a Z-order curve through the cells that
+        // contain the centers of their bounding boxes. Centers that lie
+        // outside of the ghost region of the patch are moved onto its lower
+        // faces so that all keys are nonnegative.
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+        const hier::Index<NDIM> ghost_lower = patch_box.lower() - d_associated_elem_ghost_width;
+        elem_keys.resize(active_elems.size());
+        for (std::size_t k = 0; k < active_elems.size(); ++k)
+        {
+            hier::Index<NDIM> i = IndexUtilities::getCellIndex(elem_centers[active_elems[k]], pgeom, patch_box);
+            for (unsigned int d = 0; d < NDIM; ++d) i(d) = std::max(i(d), ghost_lower(d));
+            elem_keys[k] = std::make_pair(morton_key(i, ghost_lower), active_elems[k]);
+        }
+        std::stable_sort(elem_keys.begin(),
+                         elem_keys.end(),
+                         [](const std::pair<std::uint64_t, Elem*>& a, const std::pair<std::uint64_t, Elem*>& b)
+                         { return a.first < b.first; });
+        for (std::size_t k = 0; k < active_elems.size(); ++k) active_elems[k] = elem_keys[k].second;
     }
     return;
 } // collectActivePatchElements
@@ -3332,9 +4057,41 @@ FEDataManager::reinitializeIBGhostedDOFs(const std::string& system_name)
             system.comm(), solution.size(), solution.local_size(), ib_ghost_dofs, libMesh::GHOSTED));
         d_active_patch_ghost_dofs[system_name] = std::move(ib_ghost_dofs);
         d_system_ib_ghost_vec[system_name] = std::move(exemplar_ib_vector);
+        if (MemoryStatistics::enabled()) updateMemoryUsage();
     }
 }
 
+void
+FEDataManager::updateMemoryUsage()
+{
+    // The equation systems may be shared by several FEDataManager objects, so
+    // their vectors are reported for the FEData object.
+    double systems_bytes = 0.0;
+    const EquationSystems& equation_systems = *d_fe_data->d_es;
+    for (unsigned int system_num = 0; system_num < equation_systems.n_systems(); ++system_num)
+    {
+        const System& system = equation_systems.get_system(system_num);
+        systems_bytes += get_local_vector_bytes(*system.solution);
+        systems_bytes += get_local_vector_bytes(*system.current_local_solution);
+        for (auto it = system.vectors_begin(); it != system.vectors_end(); ++it)
+        {
+            systems_bytes += get_local_vector_bytes(*it->second);
+        }
+    }
+    MemoryStatistics::getManager()->setUsage("fe_data", d_fe_data.get(), systems_bytes);
+
+    double cached_bytes = 0.0;
+    for (const auto& name_vec : d_system_ghost_vec) cached_bytes += get_local_vector_bytes(*name_vec.second);
+    for (const auto& name_vec : d_system_ib_ghost_vec) cached_bytes += get_local_vector_bytes(*name_vec.second);
+    for (const auto& name_vec : d_shared_ib_ghost_vecs) cached_bytes += get_local_vector_bytes(*name_vec.second.vec);
+    for (const auto& name_vec : d_L2_proj_matrix_diag_ghost)
+    {
+        cached_bytes += get_local_vector_bytes(*name_vec.second);
+    }
+    MemoryStatistics::getManager()->setUsage("fe_data", this, cached_bytes);
+    return;
+} // updateMemoryUsage
+
 void
 FEDataManager::getFromRestart()
 {
@@ -59,21 +59,10 @@ getCovariant(const Eigen::Matrix<double, dim, dim>& contravariant)
 //
 
 template <int dim, int spacedim, int n_nodes>
-PointMap<dim, spacedim, n_nodes>::PointMap(const libMesh::ElemType elem_type,
-                                           const std::vector<libMesh::Point>& q_points)
-    : d_reference_q_points(q_points)
+PointMap<dim, spacedim, n_nodes>::PointMap(const quadrature_key_type& quad_key, const libMesh::ElemType elem_type)
+    : d_reference_data(ReferenceElementData::get(quad_key, elem_type))
 {
-    const int n_nodes_ = n_nodes == -1 ? get_n_nodes(elem_type) : n_nodes;
-    const auto elem_order = get_default_order(elem_type);
-    d_phi.resize(n_nodes_, d_reference_q_points.size());
-    for (int i = 0; i < n_nodes_; ++i)
-    {
-        for (unsigned int q = 0; q < d_reference_q_points.size(); ++q)
-        {
-            using FE = libMesh::FE<dim, libMesh::LAGRANGE>;
-            d_phi(i, q) = FE::shape(elem_type, elem_order, i, d_reference_q_points[q]);
-        }
-    }
+    if (n_nodes != -1) TBOX_ASSERT(static_cast<int>(d_reference_data->getNumberOfNodes()) == n_nodes);
 }
 
 template <int dim, int spacedim, int n_nodes>
@@ -84,17 +73,22 @@ PointMap<dim, spacedim, n_nodes>::getMappedQuadraturePoints(const libMesh::Point
 {
     if (n_nodes != -1) TBOX_ASSERT(nodes_end - nodes == n_nodes);
     const int n_nodes_ = n_nodes == -1 ? nodes_end - nodes : n_nodes;
-    TBOX_ASSERT(d_reference_q_points.size() == physical_q_points.size());
-    TBOX_ASSERT(n_nodes_ == d_phi.rows());
-    // assumes same node ordering in the input node array as is stored in d_phi
-    for (unsigned int q = 0; q < d_reference_q_points.size(); ++q)
+    const unsigned int n_qp = d_reference_data->getNumberOfQuadraturePoints();
+    TBOX_ASSERT(n_qp == physical_q_points.size());
+    TBOX_ASSERT(n_nodes_ == static_cast<int>(d_reference_data->getNumberOfNodes()));
+    // assumes same node ordering in the input node array as is stored in the
+    // shape function table. The values of each shape function are contiguous
+    // so we loop over the nodes first.
+    const double* const phi = d_reference_data->getShapeValues();
+    for (unsigned int q = 0; q < n_qp; ++q) physical_q_points[q] = 0.0;
+    for (int i = 0; i < n_nodes_; ++i)
     {
-        physical_q_points[q] = 0.0;
-        for (int i = 0; i < n_nodes_; ++i)
+        const double* const phi_i = phi + i * n_qp;
+        for (unsigned int q = 0; q < n_qp; ++q)
         {
             for (int d = 0; d < spacedim; ++d)
             {
-                physical_q_points[q](d) += d_phi(i, q) * nodes[i](d);
+                physical_q_points[q](d) += phi_i[q] * nodes[i](d);
             }
         }
     }
@@ -104,24 +98,37 @@ PointMap<dim, spacedim, n_nodes>::getMappedQuadraturePoints(const libMesh::Point
 // QuadratureData
 //
 
-QuadratureData::QuadratureData(const QuadratureData::key_type quad_key) : d_key(quad_key)
+QuadratureData::QuadratureData(const QuadratureData::key_type quad_key)
+    : d_key(quad_key),
+      d_reference_data(ReferenceElementData::get(d_key, std::get<0>(d_key))),
+      d_points(d_reference_data->getQuadraturePoints()),
+      d_weights(d_reference_data->getQuadratureWeights())
 {
-    const ElemType elem_type = std::get<0>(d_key);
-    const QuadratureType quad_type = std::get<1>(d_key);
-    const Order order = std::get<2>(d_key);
-
-    const int dim = get_dim(elem_type);
-
-    std::unique_ptr<QBase> quad_rule = QBase::build(quad_type, dim, order);
-    quad_rule->init(elem_type);
-    d_points = quad_rule->get_points();
-    d_weights = quad_rule->get_weights();
 }
 
 //
 // FEMapping
 //
 
+template <>
+std::unique_ptr<FEMapping<1, 2> >
+FEMapping<1, 2>::build(const key_type key, const FEUpdateFlags update_flags)
+{
+    switch (std::get<0>(key))
+    {
+    case libMesh::ElemType::EDGE2:
+        return std::unique_ptr<FEMapping<1, 2> >(
+            new FELagrangeMapping<1, 2, 2>(key, libMesh::ElemType::EDGE2, update_flags));
+    case libMesh::ElemType::EDGE3:
+        return std::unique_ptr<FEMapping<1, 2> >(
+            new FELagrangeMapping<1, 2, 3>(key, libMesh::ElemType::EDGE3, update_flags));
+    default:
+        return std::unique_ptr<FEMapping<1, 2> >(new FELagrangeMapping<1, 2>(key, std::get<0>(key), update_flags));
+    }
+
+    return {};
+}
+
 template <>
 std::unique_ptr<FEMapping<2, 2> >
 FEMapping<2, 2>::build(const key_type key, const FEUpdateFlags update_flags)
@@ -134,6 +141,9 @@ FEMapping<2, 2>::build(const key_type key, const FEUpdateFlags update_flags)
         return std::unique_ptr<FEMapping<2, 2> >(new Tri6Mapping(key, update_flags));
     case libMesh::ElemType::QUAD4:
         return std::unique_ptr<FEMapping<2, 2> >(new Quad4Mapping(key, update_flags));
+    case libMesh::ElemType::QUAD8:
+        return std::unique_ptr<FEMapping<2, 2> >(
+            new FELagrangeMapping<2, 2, 8>(key, libMesh::ElemType::QUAD8, update_flags));
     case libMesh::ElemType::QUAD9:
         return std::unique_ptr<FEMapping<2, 2> >(new Quad9Mapping(key, update_flags));
     default:
@@ -143,6 +153,31 @@ FEMapping<2, 2>::build(const key_type key, const FEUpdateFlags update_flags)
     return {};
 }
 
+template <>
+std::unique_ptr<FEMapping<2, 3> >
+FEMapping<2, 3>::build(const key_type key, const FEUpdateFlags update_flags)
+{
+    switch (std::get<0>(key))
+    {
+    case libMesh::ElemType::TRI3:
+        return std::unique_ptr<FEMapping<2, 3> >(
+            new FELagrangeMapping<2, 3, 3>(key, libMesh::ElemType::TRI3, update_flags));
+    case libMesh::ElemType::TRI6:
+        return std::unique_ptr<FEMapping<2, 3> >(
+            new FELagrangeMapping<2, 3, 6>(key, libMesh::ElemType::TRI6, update_flags));
+    case libMesh::ElemType::QUAD4:
+        return std::unique_ptr<FEMapping<2, 3> >(
+            new FELagrangeMapping<2, 3, 4>(key, libMesh::ElemType::QUAD4, update_flags));
+    case libMesh::ElemType::QUAD9:
+        return std::unique_ptr<FEMapping<2, 3> >(
+            new FELagrangeMapping<2, 3, 9>(key, libMesh::ElemType::QUAD9, update_flags));
+    default:
+        return std::unique_ptr<FEMapping<2, 3> >(new FELagrangeMapping<2, 3>(key, std::get<0>(key), update_flags));
+    }
+
+    return {};
+}
+
 template <>
 std::unique_ptr<FEMapping<3, 3> >
 FEMapping<3, 3>::build(const key_type key, const FEUpdateFlags update_flags)
@@ -154,8 +189,10 @@ FEMapping<3, 3>::build(const key_type key, const FEUpdateFlags update_flags)
     case libMesh::ElemType::TET10:
         return std::unique_ptr<FEMapping<3, 3> >(new Tet10Mapping(key, update_flags));
     case libMesh::ElemType::HEX8:
+        return std::unique_ptr<FEMapping<3, 3> >(new Hex8Mapping(key, update_flags));
+    case libMesh::ElemType::HEX20:
         return std::unique_ptr<FEMapping<3, 3> >(
-            new FELagrangeMapping<3, 3, 8>(key, libMesh::ElemType::HEX8, update_flags));
+            new FELagrangeMapping<3, 3, 20>(key, libMesh::ElemType::HEX20, update_flags));
     case libMesh::ElemType::HEX27:
         return std::unique_ptr<FEMapping<3, 3> >(new Hex27Mapping(key, update_flags));
     default:
@@ -182,7 +219,7 @@ FENodalMapping<dim, spacedim, n_nodes>::FENodalMapping(
     const typename FENodalMapping<dim, spacedim, n_nodes>::key_type quad_key,
     const libMesh::ElemType element_mapping_type,
     const FEUpdateFlags update_flags)
-    : d_quadrature_data(quad_key), d_point_map(element_mapping_type, d_quadrature_data.d_points)
+    : d_quadrature_data(quad_key), d_point_map(quad_key, element_mapping_type)
 {
     d_update_flags = update_flags;
 
@@ -287,7 +324,8 @@ FELagrangeMapping<dim, spacedim, n_nodes>::FELagrangeMapping(
     const libMesh::ElemType element_mapping_type,
     const FEUpdateFlags update_flags)
     : FENodalMapping<dim, spacedim, n_nodes>(quad_key, element_mapping_type, update_flags),
-      d_n_nodes(n_nodes == -1 ? get_n_nodes(std::get<0>(quad_key)) : n_nodes)
+      d_n_nodes(n_nodes == -1 ? get_n_nodes(std::get<0>(quad_key)) : n_nodes),
+      d_mapping_data(ReferenceElementData::get(quad_key, element_mapping_type))
 {
     if (n_nodes != -1) TBOX_ASSERT(d_n_nodes == n_nodes);
 #if LIBMESH_VERSION_LESS_THAN(1, 4, 0)
@@ -295,22 +333,7 @@ FELagrangeMapping<dim, spacedim, n_nodes>::FELagrangeMapping(
 #else
     TBOX_ASSERT(d_n_nodes <= static_cast<int>(libMesh::Elem::max_n_nodes));
 #endif
-    typename decltype(d_dphi)::extent_gen extents;
-    d_dphi.resize(extents[d_n_nodes][this->d_quadrature_data.size()]);
-
-    for (int node_n = 0; node_n < d_n_nodes; ++node_n)
-    {
-        for (unsigned int q = 0; q < this->d_quadrature_data.size(); ++q)
-        {
-            for (unsigned int d = 0; d < dim; ++d)
-                d_dphi[node_n][q][d] =
-                    libMesh::FE<dim, libMesh::LAGRANGE>::shape_deriv(element_mapping_type,
-                                                                     get_default_order(element_mapping_type),
-                                                                     node_n,
-                                                                     d,
-                                                                     this->d_quadrature_data.d_points[q]);
-        }
-    }
+    TBOX_ASSERT(d_n_nodes <= static_cast<int>(d_mapping_data->getNumberOfNodes()));
 }
 
 template <int dim, int spacedim, int n_nodes>
@@ -334,17 +357,23 @@ FELagrangeMapping<dim, spacedim, n_nodes>::fillTransforms(const libMesh::Elem* e
         for (unsigned int j = 0; j < spacedim; ++j) xs[i][j] = p(j);
     }
 
-    for (unsigned int q = 0; q < this->d_JxW.size(); ++q)
+    // The values of each shape function gradient component are contiguous in
+    // the shared table so we loop over quadrature points last.
+    const unsigned int n_qp = d_mapping_data->getNumberOfQuadraturePoints();
+    TBOX_ASSERT(n_qp == this->d_contravariants.size());
+    for (unsigned int q = 0; q < n_qp; ++q) this->d_contravariants[q].setZero();
+    for (unsigned int j = 0; j < dim; ++j)
     {
-        auto& contravariant = this->d_contravariants[q];
-        contravariant.setZero();
+        const double* const dphi_j = d_mapping_data->getShapeDerivatives(j);
         for (int node_n = 0; node_n < n_nodes_; ++node_n)
         {
-            for (unsigned int i = 0; i < spacedim; ++i)
+            const double* const dphi_jn = dphi_j + node_n * n_qp;
+            for (unsigned int q = 0; q < n_qp; ++q)
             {
-                for (unsigned int j = 0; j < dim; ++j)
+                auto& contravariant = this->d_contravariants[q];
+                for (unsigned int i = 0; i < spacedim; ++i)
                 {
-                    contravariant(i, j) += xs[node_n][i] * d_dphi[node_n][q][j];
+                    contravariant(i, j) += xs[node_n][i] * dphi_jn[q];
                 }
             }
         }
@@ -405,6 +434,74 @@ Tri3Mapping::isAffine() const
     return true;
 }
 
+//
+// Hex8Mapping
+//
+
+Hex8Mapping::Hex8Mapping(const key_type quad_key, const FEUpdateFlags update_flags)
+    : FELagrangeMapping<3, 3, 8>(quad_key, libMesh::HEX8, update_flags)
+{
+}
+
+void
+Hex8Mapping::fillTransforms(const libMesh::Elem* elem)
+{
+    TBOX_ASSERT(this->d_update_flags & FEUpdateFlags::update_contravariants);
+    // also permit HEX20 and HEX27
+    const auto type = elem->type();
+    TBOX_ASSERT(type == libMesh::HEX8 || type == libMesh::HEX20 || type == libMesh::HEX27);
+
+    std::array<libMesh::Point, 8> nodes;
+    for (unsigned int n = 0; n < nodes.size(); ++n) nodes[n] = elem->point(n);
+
+    // The element is a parallelepiped if each vertex is obtained from vertex
+    // 0 by adding the edge vectors that meet at vertex 0.
+    double characteristic_point_size = 0.0;
+    for (int d = 0; d < LIBMESH_DIM; ++d)
+    {
+        characteristic_point_size += std::abs(nodes[0](d));
+        characteristic_point_size += std::abs(nodes[6](d));
+    }
+    const double tol = 1e-16 * characteristic_point_size;
+    const libMesh::Point e0 = nodes[1] - nodes[0];
+    const libMesh::Point e1 = nodes[3] - nodes[0];
+    const libMesh::Point e2 = nodes[4] - nodes[0];
+    d_elem_is_affine = nodes[2].absolute_fuzzy_equals(nodes[0] + e0 + e1, tol) &&
+                       nodes[5].absolute_fuzzy_equals(nodes[0] + e0 + e2, tol) &&
+                       nodes[7].absolute_fuzzy_equals(nodes[0] + e1 + e2, tol) &&
+                       nodes[6].absolute_fuzzy_equals(nodes[0] + e0 + e1 + e2, tol);
+    if (!d_elem_is_affine)
+    {
+        FELagrangeMapping<3, 3, 8>::fillTransforms(elem);
+        return;
+    }
+
+    // The reference element is [-1, 1]^3, so each edge vector is twice the
+    // corresponding column of the contravariant.
+    Eigen::Matrix<double, 3, 3> contravariant;
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        contravariant(i, 0) = 0.5 * e0(i);
+        contravariant(i, 1) = 0.5 * e1(i);
+        contravariant(i, 2) = 0.5 * e2(i);
+    }
+    std::fill(d_contravariants.begin(), d_contravariants.end(), contravariant);
+
+    if (this->d_update_flags & FEUpdateFlags::update_covariants)
+    {
+        const Eigen::Matrix<double, 3, 3> covariant = getCovariant(contravariant);
+        std::fill(this->d_covariants.begin(), this->d_covariants.end(), covariant);
+    }
+
+    return;
+}
+
+bool
+Hex8Mapping::isAffine() const
+{
+    return d_elem_is_affine;
+}
+
 //
 // Tri6Mapping
 //
@@ -481,6 +578,34 @@ Quad4Mapping::fillTransforms(const libMesh::Elem* elem)
     const double b_2 = 0.25 * (-p0(1) - p1(1) + p2(1) + p3(1));
     const double c_2 = 0.25 * (p0(1) - p1(1) + p2(1) - p3(1));
 
+    // The bilinear terms vanish (up to roundoff) on parallelograms, in which
+    // case the contravariant is constant on the element.
+    double characteristic_point_size = 0.0;
+    for (int d = 0; d < 2; ++d)
+    {
+        characteristic_point_size += std::abs(p0(d));
+        characteristic_point_size += std::abs(p2(d));
+    }
+    const double tol = 1e-16 * characteristic_point_size;
+    d_elem_is_affine = std::abs(c_1) <= tol && std::abs(c_2) <= tol;
+    if (d_elem_is_affine)
+    {
+        Eigen::Matrix<double, 2, 2> contravariant;
+        contravariant(0, 0) = a_1;
+        contravariant(0, 1) = b_1;
+        contravariant(1, 0) = a_2;
+        contravariant(1, 1) = b_2;
+        std::fill(d_contravariants.begin(), d_contravariants.end(), contravariant);
+
+        if (this->d_update_flags & FEUpdateFlags::update_covariants)
+        {
+            const Eigen::Matrix<double, 2, 2> covariant = getCovariant(contravariant);
+            std::fill(this->d_covariants.begin(), this->d_covariants.end(), covariant);
+        }
+
+        return;
+    }
+
     for (unsigned int i = 0; i < this->d_JxW.size(); i++)
     {
         // calculate Jacobians here
@@ -506,6 +631,12 @@ Quad4Mapping::fillTransforms(const libMesh::Elem* elem)
     return;
 }
 
+bool
+Quad4Mapping::isAffine() const
+{
+    return d_elem_is_affine;
+}
+
 //
 // Quad9Mapping
 //
@@ -824,13 +955,34 @@ template class FELagrangeMapping<2, 2>;
 template class FELagrangeMapping<2, 3>;
 template class FELagrangeMapping<3, 3>;
 
+template class FELagrangeMapping<1, 2, 2>;
+template class FELagrangeMapping<1, 2, 3>;
 template class FELagrangeMapping<2, 2, 6>;
+template class FELagrangeMapping<2, 2, 8>;
+template class FELagrangeMapping<2, 3, 3>;
+template class FELagrangeMapping<2, 3, 4>;
+template class FELagrangeMapping<2, 3, 6>;
+template class FELagrangeMapping<2, 3, 9>;
+template class FELagrangeMapping<3, 3, 8>;
 template class FELagrangeMapping<3, 3, 10>;
+template class FELagrangeMapping<3, 3, 20>;
+template class FELagrangeMapping<3, 3, 27>;
 
+template class FENodalMapping<1, 2, 2>;
+template class FENodalMapping<1, 2, 3>;
 template class FENodalMapping<2, 2, 3>;
 template class FENodalMapping<2, 2, 4>;
 template class FENodalMapping<2, 2, 6>;
+template class FENodalMapping<2, 2, 8>;
 template class FENodalMapping<2, 2, 9>;
+template class FENodalMapping<2, 3, 3>;
+template class FENodalMapping<2, 3, 4>;
+template class FENodalMapping<2, 3, 6>;
+template class FENodalMapping<2, 3, 9>;
 template class FENodalMapping<3, 3, 4>;
+template class FENodalMapping<3, 3, 8>;
+template class FENodalMapping<3, 3, 10>;
+template class FENodalMapping<3, 3, 20>;
+template class FENodalMapping<3, 3, 27>;
 
 } // namespace IBTK
@@ -25,6 +25,9 @@
 #include <libmesh/enum_preconditioner_type.h>
 #include <libmesh/enum_solver_type.h>
 
+#include <petscksp.h>
+#include <petscversion.h>
+
 #include <ibtk/namespaces.h> // IWYU pragma: keep
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -154,7 +157,8 @@ assert_qrule_is_nodal(const FEType& fe_type, const QBase* const qrule, const Ele
 FEProjector::FEProjector(EquationSystems* equation_systems, const Pointer<Database>& input_db)
     : d_fe_data(new FEData("FEProjector", *equation_systems, /*register_for_restart*/ false)),
       d_enable_logging(input_db->getBoolWithDefault("enable_logging", false)),
-      d_num_fischer_vectors(input_db->getIntegerWithDefault("num_fischer_vectors", 5))
+      d_num_fischer_vectors(input_db->getIntegerWithDefault("num_fischer_vectors", 5)),
+      d_use_direct_solver(input_db->getBoolWithDefault("use_direct_solver", false))
 {
     IBTK_DO_ONCE(t_build_L2_projection_solver =
                      TimerManager::getManager()->getTimer("IBTK::FEProjector::buildL2ProjectionSolver()");
@@ -173,7 +177,8 @@ FEProjector::FEProjector(EquationSystems* equation_systems, const Pointer<Databa
 FEProjector::FEProjector(std::shared_ptr<FEData> fe_data, const Pointer<Database>& input_db)
     : d_fe_data(std::move(fe_data)),
       d_enable_logging(input_db->getBoolWithDefault("enable_logging", false)),
-      d_num_fischer_vectors(input_db->getIntegerWithDefault("num_fischer_vectors", 5))
+      d_num_fischer_vectors(input_db->getIntegerWithDefault("num_fischer_vectors", 5)),
+      d_use_direct_solver(input_db->getBoolWithDefault("use_direct_solver", false))
 {
     TBOX_ASSERT(d_fe_data);
     IBTK_DO_ONCE(t_build_L2_projection_solver =
@@ -315,11 +320,35 @@ FEProjector::buildL2ProjectionSolver(const std::string& system_name)
         // Assemble the matrix.
         M_mat->close();
 
-        // Setup the solver.
+        // Setup the solver. Since the preconditioner is reused, the Cholesky
+        // factorization is only computed during the first solve.
         solver->reuse_preconditioner(true);
-        solver->set_preconditioner_type(JACOBI_PRECOND);
-        solver->set_solver_type(MINRES);
-        solver->init();
+        if (d_use_direct_solver)
+        {
+            solver->set_preconditioner_type(CHOLESKY_PRECOND);
+            solver->set_solver_type(MINRES);
+            solver->init();
+            int ierr = KSPSetType(solver->ksp(), KSPPREONLY);
+            IBTK_CHKERRQ(ierr);
+            if (comm.size() > 1)
+            {
+                PC pc;
+                ierr = KSPGetPC(solver->ksp(), &pc);
+                IBTK_CHKERRQ(ierr);
+#if PETSC_VERSION_LT(3, 9, 0)
+                ierr = PCFactorSetMatSolverPackage(pc, MATSOLVERMUMPS);
+#else
+                ierr = PCFactorSetMatSolverType(pc, MATSOLVERMUMPS);
+#endif
+                IBTK_CHKERRQ(ierr);
+            }
+        }
+        else
+        {
+            solver->set_preconditioner_type(JACOBI_PRECOND);
+            solver->set_solver_type(MINRES);
+            solver->init();
+        }
 
         // Store the solver, mass matrix, and configuration options.
         d_L2_proj_solver[system_name] = std::move(solver);
@@ -694,10 +723,13 @@ FEProjector::computeL2Projection(PetscVector<double>& U_vec,
     {
         std::pair<PetscLinearSolver<double>*, PetscMatrix<double>*> proj_solver_components =
             consistent_mass_matrix ? buildL2ProjectionSolver(system_name) : buildLumpedL2ProjectionSolver(system_name);
-        // always use the lumped matrix as the preconditioner:
-        PetscMatrix<double>& lumped_mass = *buildLumpedL2ProjectionSolver(system_name).second;
         PetscLinearSolver<double>* solver = proj_solver_components.first;
         PetscMatrix<double>* M_mat = proj_solver_components.second;
+        // always use the lumped matrix as the preconditioner, unless we
+        // factor the consistent mass matrix:
+        const bool use_direct_solver = consistent_mass_matrix && d_use_direct_solver;
+        PetscMatrix<double>& precond_mat =
+            use_direct_solver ? *M_mat : *buildLumpedL2ProjectionSolver(system_name).second;
         PetscBool rtol_set;
         double runtime_rtol;
         ierr = PetscOptionsGetReal(nullptr, "", "-ksp_rtol", &runtime_rtol, &rtol_set);
@@ -709,12 +741,13 @@ FEProjector::computeL2Projection(PetscVector<double>& U_vec,
         ierr = KSPSetFromOptions(solver->ksp());
         IBTK_CHKERRQ(ierr);
 
-        auto pair = d_initial_guesses.emplace(system_name, d_num_fischer_vectors);
+        // An initial guess is not useful for a direct solver.
+        auto pair = d_initial_guesses.emplace(system_name, use_direct_solver ? 0 : d_num_fischer_vectors);
         FischerGuess& fischer_guess = (pair.first)->second;
 
         fischer_guess.guess(U_vec, F_vec);
         solver->solve(
-            *M_mat, lumped_mass, U_vec, F_vec, rtol_set ? runtime_rtol : tol, max_it_set ? runtime_max_it : max_its);
+            *M_mat, precond_mat, U_vec, F_vec, rtol_set ? runtime_rtol : tol, max_it_set ? runtime_max_it : max_its);
         KSPConvergedReason reason;
         ierr = KSPGetConvergedReason(solver->ksp(), &reason);
         IBTK_CHKERRQ(ierr);
@@ -730,6 +763,37 @@ FEProjector::computeL2Projection(PetscVector<double>& U_vec,
     return converged;
 }
 
+bool
+FEProjector::computeL2Projection(const std::vector<PetscVector<double>*>& U_vecs,
+                                 const std::vector<PetscVector<double>*>& F_vecs,
+                                 const std::string& system_name,
+                                 const bool consistent_mass_matrix,
+                                 const bool close_U,
+                                 const bool close_F,
+                                 const double tol,
+                                 const unsigned int max_its)
+{
+    TBOX_ASSERT(U_vecs.size() == F_vecs.size());
+    if (close_F)
+    {
+        for (PetscVector<double>* F_vec : F_vecs) F_vec->close();
+    }
+    bool converged = true;
+    for (unsigned int k = 0; k < U_vecs.size(); ++k)
+    {
+        converged = computeL2Projection(*U_vecs[k],
+                                        *F_vecs[k],
+                                        system_name,
+                                        consistent_mass_matrix,
+                                        close_U,
+                                        /*close_F*/ false,
+                                        tol,
+                                        max_its) &&
+                    converged;
+    }
+    return converged;
+}
+
 bool
 FEProjector::computeStabilizedL2Projection(PetscVector<double>& U_vec,
                                            PetscVector<double>& F_vec,
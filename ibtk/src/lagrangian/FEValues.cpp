@@ -30,6 +30,7 @@
 #include <libmesh/point.h>
 #include <libmesh/quadrature.h>
 
+#include <algorithm>
 #include <map>
 #include <vector>
 
@@ -240,6 +241,160 @@ FEValues<dim, spacedim>::reinit(const libMesh::Elem* elem)
     d_last_elem_type = elem_type;
 }
 
+template <int dim, int spacedim>
+constexpr unsigned int FEValuesBatch<dim, spacedim>::batch_size;
+
+template <int dim, int spacedim>
+FEValuesBatch<dim, spacedim>::FEValuesBatch(libMesh::QBase* qrule,
+                                            const FEType fe_type,
+                                            const FEUpdateFlags update_flags)
+    : d_qrule(qrule), d_fe_type(fe_type), d_update_flags(update_flags)
+{
+    // set up update flag dependencies:
+    if (d_update_flags & update_dphi) d_update_flags |= update_covariants;
+}
+
+template <int dim, int spacedim>
+void
+FEValuesBatch<dim, spacedim>::reinit(const libMesh::Elem* const* elems, const unsigned int n_elems)
+{
+    TBOX_ASSERT(n_elems > 0 && n_elems <= batch_size);
+    const libMesh::ElemType elem_type = elems[0]->type();
+#if !defined(NDEBUG)
+    for (unsigned int k = 0; k < n_elems; ++k)
+    {
+        TBOX_ASSERT(elems[k]->type() == elem_type);
+        TBOX_ASSERT(elems[k]->p_level() == 0);
+        TBOX_ASSERT(elems[k]->dim() == dim);
+    }
+#endif
+
+    // maybe update the quadrature rule:
+    if (elem_type != d_last_elem_type)
+    {
+        d_qrule->init(elem_type, 0);
+    }
+
+    auto map_iter = d_mappings.find(elem_type);
+    if (map_iter == d_mappings.end())
+    {
+        typename decltype(d_mappings)::value_type new_entry{ elem_type, nullptr };
+        map_iter = d_mappings.insert(map_iter, std::move(new_entry));
+        const quadrature_key_type key{
+            elem_type, d_qrule->type(), d_qrule->get_order(), d_qrule->allow_rules_with_negative_weights
+        };
+        map_iter->second = FEMapping<dim, spacedim>::build(key, d_update_flags);
+    }
+    FEMapping<dim, spacedim>& mapping = *map_iter->second;
+
+    auto ref_iter = d_reference_values.find(elem_type);
+    if (ref_iter == d_reference_values.end())
+    {
+        typename FEValues<dim, spacedim>::ReferenceValues ref_values(*d_qrule, d_fe_type);
+        ref_iter = d_reference_values.emplace(elem_type, std::move(ref_values)).first;
+    }
+    const boost::multi_array<double, 2>& ref_shape_values = ref_iter->second.d_reference_shape_values;
+    const boost::multi_array<libMesh::VectorValue<double>, 2>& ref_shape_gradients =
+        ref_iter->second.d_reference_shape_gradients;
+
+    if (elem_type != d_last_elem_type)
+    {
+        d_n_qp = d_qrule->n_points();
+        d_n_shape_functions = ref_shape_values.shape()[0];
+        if (d_update_flags & update_JxW) d_JxW.resize(d_n_qp * batch_size);
+        if (d_update_flags & update_quadrature_points) d_quadrature_points.resize(d_n_qp * spacedim * batch_size);
+        if (d_update_flags & update_covariants) d_covariants.resize(d_n_qp * spacedim * dim * batch_size);
+        if (d_update_flags & update_dphi)
+        {
+            d_shape_gradients.resize(d_n_shape_functions * d_n_qp * spacedim * batch_size);
+        }
+        if (d_update_flags & update_phi)
+        {
+            d_shape_values.resize(d_n_shape_functions);
+            for (unsigned int i = 0; i < d_n_shape_functions; ++i)
+            {
+                d_shape_values[i].assign(&ref_shape_values[i][0], &ref_shape_values[i][0] + d_n_qp);
+            }
+        }
+    }
+
+    // Zero the unused lanes so that they do not contribute to any sums over
+    // all lanes.
+    if (n_elems < batch_size)
+    {
+        std::fill(d_JxW.begin(), d_JxW.end(), 0.0);
+        std::fill(d_quadrature_points.begin(), d_quadrature_points.end(), 0.0);
+        std::fill(d_covariants.begin(), d_covariants.end(), 0.0);
+    }
+    d_n_elems = n_elems;
+
+    // The mapping is computed one element at a time; its results are scattered
+    // into the lanes.
+    for (unsigned int k = 0; k < n_elems; ++k)
+    {
+        mapping.reinit(elems[k]);
+        if (d_update_flags & update_JxW)
+        {
+            const std::vector<double>& JxW = mapping.getJxW();
+            for (unsigned int q = 0; q < d_n_qp; ++q) d_JxW[q * batch_size + k] = JxW[q];
+        }
+        if (d_update_flags & update_quadrature_points)
+        {
+            const std::vector<libMesh::Point>& q_points = mapping.getQuadraturePoints();
+            for (unsigned int q = 0; q < d_n_qp; ++q)
+            {
+                for (unsigned int d = 0; d < spacedim; ++d)
+                {
+                    d_quadrature_points[(q * spacedim + d) * batch_size + k] = q_points[q](d);
+                }
+            }
+        }
+        if (d_update_flags & update_covariants)
+        {
+            const EigenAlignedVector<Eigen::Matrix<double, spacedim, dim> >& covariants = mapping.getCovariants();
+            for (unsigned int q = 0; q < d_n_qp; ++q)
+            {
+                for (unsigned int d = 0; d < spacedim; ++d)
+                {
+                    for (unsigned int e = 0; e < dim; ++e)
+                    {
+                        d_covariants[((q * spacedim + d) * dim + e) * batch_size + k] = covariants[q](d, e);
+                    }
+                }
+            }
+        }
+    }
+
+    // Map the reference gradients. The innermost loops run over the lanes and
+    // have no dependencies, so they can be vectorized.
+    if (d_update_flags & update_dphi)
+    {
+        for (unsigned int i = 0; i < d_n_shape_functions; ++i)
+        {
+            for (unsigned int q = 0; q < d_n_qp; ++q)
+            {
+                const libMesh::VectorValue<double>& ref_shape_grad = ref_shape_gradients[i][q];
+                for (unsigned int d = 0; d < spacedim; ++d)
+                {
+                    double* const shape_grad = &d_shape_gradients[((i * d_n_qp + q) * spacedim + d) * batch_size];
+                    const double* const covariant = &d_covariants[(q * spacedim + d) * dim * batch_size];
+                    for (unsigned int k = 0; k < batch_size; ++k) shape_grad[k] = 0.0;
+                    for (unsigned int e = 0; e < dim; ++e)
+                    {
+                        const double ref_shape_grad_e = ref_shape_grad(e);
+                        for (unsigned int k = 0; k < batch_size; ++k)
+                        {
+                            shape_grad[k] += covariant[e * batch_size + k] * ref_shape_grad_e;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    d_last_elem_type = elem_type;
+}
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 template <int dim, int spacedim>
@@ -281,6 +436,12 @@ template class FEValues<1, 3>;
 template class FEValues<2, 2>;
 template class FEValues<2, 3>;
 template class FEValues<3, 3>;
+template class FEValuesBatch<1, 1>;
+template class FEValuesBatch<1, 2>;
+template class FEValuesBatch<1, 3>;
+template class FEValuesBatch<2, 2>;
+template class FEValuesBatch<2, 3>;
+template class FEValuesBatch<3, 3>;
 } // namespace IBTK
 
 /////////////////////////////////////////////////////////////////////////////
@@ -119,7 +119,14 @@ LData::LData(Pointer<Database> db) : d_name(db->getString("d_name")), d_depth(db
     d_local_node_count = num_local_nodes;
     d_ghost_node_count = static_cast<int>(d_nonlocal_petsc_indices.size());
 
-    // Extract the values from the database.
+    // Extract the values from the database.  The values are not stored if they
+    // were written to a separate file.
+    if (!db->keyExists("vals"))
+    {
+        ierr = VecSet(d_global_vec, 0.0);
+        IBTK_CHKERRQ(ierr);
+        return;
+    }
     double* ghosted_local_vec_array = getGhostedLocalFormVecArray()->data();
     if (num_local_nodes + num_ghost_nodes > 0)
     {
@@ -185,6 +192,13 @@ LData::resetData(Vec vec, const std::vector<int>& nonlocal_petsc_indices, const
 
 void
 LData::putToDatabase(Pointer<Database> db)
+{
+    putToDatabase(db, /*put_values*/ true);
+    return;
+} // putToDatabase
+
+void
+LData::putToDatabase(Pointer<Database> db, const bool put_values)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(db);
@@ -199,6 +213,7 @@ LData::putToDatabase(Pointer<Database> db)
     {
         db->putIntegerArray("d_nonlocal_petsc_indices", &d_nonlocal_petsc_indices[0], num_ghost_nodes);
     }
+    if (!put_values) return;
     const double* const ghosted_local_vec_array = getGhostedLocalFormVecArray()->data();
     if (num_local_nodes + num_ghost_nodes > 0)
     {
@@ -13,6 +13,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibtk/CommunicationStatistics.h"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/IndexUtilities.h"
@@ -33,10 +34,12 @@
 #include "ibtk/LSetDataIterator.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/LTransaction.h"
+#include "ibtk/MemoryStatistics.h"
 #include "ibtk/ParallelSet.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/SAMRAIDataCache.h"
 #include "ibtk/compiler_hints.h"
+#include "ibtk/ibtk_utilities.h"
 
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
@@ -93,6 +96,7 @@
 #include "petscis.h"
 #include "petscistypes.h"
 #include "petscvec.h"
+#include "petscviewer.h"
 #include <petsclog.h>
 
 #include "Eigen/src/Core/Map.h"
@@ -104,13 +108,17 @@ IBTK_DISABLE_EXTRA_WARNINGS
 IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
+#include <iomanip>
 #include <limits>
 #include <map>
 #include <memory>
 #include <numeric>
 #include <ostream>
 #include <set>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -157,7 +165,18 @@ static const int CFL_WIDTH = 2;
 static const double TOL = std::sqrt(std::numeric_limits<double>::epsilon());
 
 // Version of LDataManager restart file data.
-static const int LDATA_MANAGER_VERSION = 1;
+static const int LDATA_MANAGER_VERSION = 2;
+
+// Return an identifier of the centering of Eulerian data, which is used to
+// select the cache of kernel weights used to interact with that data.
+inline int
+get_data_centering(const bool cc_data, const bool ec_data, const bool nc_data)
+{
+    if (cc_data) return 0;
+    if (ec_data) return 1;
+    if (nc_data) return 2;
+    return 3;
+} // get_data_centering
 } // namespace
 
 const std::string LDataManager::POSN_DATA_NAME = "X";
@@ -295,6 +314,133 @@ LDataManager::getPatchLevels() const
     return std::make_pair(d_coarsest_ln, d_finest_ln + 1);
 } // getPatchLevels
 
+void
+LDataManager::setSortLocalIndicesByCell(const bool sort_local_indices_by_cell)
+{
+    d_sort_local_indices_by_cell = sort_local_indices_by_cell;
+    return;
+} // setSortLocalIndicesByCell
+
+void
+LDataManager::setSortLocalNodesByCell(const bool sort_local_nodes_by_cell)
+{
+    d_sort_local_nodes_by_cell = sort_local_nodes_by_cell;
+    return;
+} // setSortLocalNodesByCell
+
+void
+LDataManager::setWorkloadCalibration(const bool calibrate_workload, const double relaxation)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(relaxation >= 0.0 && relaxation <= 1.0);
+#endif
+    d_calibrate_workload = calibrate_workload;
+    d_workload_relaxation = relaxation;
+    d_lag_work_time = 0.0;
+    d_workload_interval_started = false;
+    return;
+} // setWorkloadCalibration
+
+void
+LDataManager::setUseCollectiveRestart(const bool use_collective_restart)
+{
+    d_use_collective_restart = use_collective_restart;
+    return;
+} // setUseCollectiveRestart
+
+void
+LDataManager::setUseWeightCache(const bool use_weight_cache)
+{
+    d_use_weight_cache = use_weight_cache;
+    d_weight_caches.clear();
+    return;
+} // setUseWeightCache
+
+void
+LDataManager::writeLDataToRestartFile(const std::string& restart_dump_dirname, const unsigned int time_step_number)
+{
+    Utilities::recursiveMkdir(restart_dump_dirname);
+    const std::string file_name = getLDataRestartFileName(restart_dump_dirname, time_step_number);
+    PetscViewer viewer;
+    int ierr = PetscViewerCreate(PETSC_COMM_WORLD, &viewer);
+    IBTK_CHKERRQ(ierr);
+    ierr = PetscViewerSetType(viewer, PETSCVIEWERBINARY);
+    IBTK_CHKERRQ(ierr);
+    ierr = PetscViewerFileSetMode(viewer, FILE_MODE_WRITE);
+    IBTK_CHKERRQ(ierr);
+    ierr = PetscViewerBinarySetUseMPIIO(viewer, PETSC_TRUE);
+    IBTK_CHKERRQ(ierr);
+    ierr = PetscViewerBinarySetSkipInfo(viewer, PETSC_TRUE);
+    IBTK_CHKERRQ(ierr);
+    ierr = PetscViewerFileSetName(viewer, file_name.c_str());
+    IBTK_CHKERRQ(ierr);
+
+    // The data are written level by level in the order of their names, and each
+    // vector is permuted to the Lagrangian ordering first.
+    for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
+    {
+        if (!d_level_contains_lag_data[level_number]) continue;
+        for (const auto& mesh_data : d_lag_mesh_data[level_number])
+        {
+            Vec petsc_vec = mesh_data.second->getVec();
+            Vec lagrangian_vec;
+            ierr = VecDuplicate(petsc_vec, &lagrangian_vec);
+            IBTK_CHKERRQ(ierr);
+            scatterPETScToLagrangian(petsc_vec, lagrangian_vec, level_number);
+            ierr = VecView(lagrangian_vec, viewer);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecDestroy(&lagrangian_vec);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+    ierr = PetscViewerDestroy(&viewer);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // writeLDataToRestartFile
+
+void
+LDataManager::readLDataFromRestartFile(const std::string& restart_read_dirname, const unsigned int restore_number)
+{
+    const std::string file_name = getLDataRestartFileName(restart_read_dirname, restore_number);
+    PetscViewer viewer;
+    int ierr = PetscViewerCreate(PETSC_COMM_WORLD, &viewer);
+    IBTK_CHKERRQ(ierr);
+    ierr = PetscViewerSetType(viewer, PETSCVIEWERBINARY);
+    IBTK_CHKERRQ(ierr);
+    ierr = PetscViewerFileSetMode(viewer, FILE_MODE_READ);
+    IBTK_CHKERRQ(ierr);
+    ierr = PetscViewerBinarySetUseMPIIO(viewer, PETSC_TRUE);
+    IBTK_CHKERRQ(ierr);
+    ierr = PetscViewerBinarySetSkipInfo(viewer, PETSC_TRUE);
+    IBTK_CHKERRQ(ierr);
+    ierr = PetscViewerFileSetName(viewer, file_name.c_str());
+    IBTK_CHKERRQ(ierr);
+
+    // Each vector is read in the Lagrangian ordering and permuted to the PETSc
+    // ordering of the present distribution of the nodes.
+    for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
+    {
+        if (!d_level_contains_lag_data[level_number]) continue;
+        for (const auto& mesh_data : d_lag_mesh_data[level_number])
+        {
+            Vec petsc_vec = mesh_data.second->getVec();
+            Vec lagrangian_vec;
+            ierr = VecDuplicate(petsc_vec, &lagrangian_vec);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecLoad(lagrangian_vec, viewer);
+            IBTK_CHKERRQ(ierr);
+            scatterLagrangianToPETSc(lagrangian_vec, petsc_vec, level_number);
+            ierr = VecDestroy(&lagrangian_vec);
+            IBTK_CHKERRQ(ierr);
+            mesh_data.second->beginGhostUpdate();
+            mesh_data.second->endGhostUpdate();
+        }
+    }
+    ierr = PetscViewerDestroy(&viewer);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // readLDataFromRestartFile
+
 void
 LDataManager::spread(const int f_data_idx,
                      Pointer<LData> F_data,
@@ -567,6 +713,11 @@ LDataManager::spread(const int f_data_idx,
     const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
     const int finest_ln = (finest_ln_in == -1 ? d_hierarchy->getFinestLevelNumber() : finest_ln_in);
 
+    // Look up the kernel function once instead of once per patch.
+    const KernelFunctionType spread_kernel_fcn_type = spread_kernel_fcn == d_default_spread_kernel_fcn ?
+                                                          d_default_spread_kernel_fcn_type :
+                                                          LEInteractor::getKernelFunctionType(spread_kernel_fcn);
+
     // Zero inactivated components.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
@@ -586,6 +737,7 @@ LDataManager::spread(const int f_data_idx,
     const bool nc_data = f_nc_var;
     const bool sc_data = f_sc_var;
     TBOX_ASSERT(cc_data || ec_data || nc_data || sc_data);
+    const int data_centering = get_data_centering(cc_data, ec_data, nc_data);
 
     // Make a copy of the Eulerian data.
     const auto f_copy_data_idx = d_cached_eulerian_data.getCachedPatchDataIndex(f_data_idx);
@@ -621,6 +773,12 @@ LDataManager::spread(const int f_data_idx,
         if (X_data_ghost_node_update) X_data[ln]->endGhostUpdate();
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
+        const auto kernel_start = std::chrono::steady_clock::now();
+        if (d_use_weight_cache) LEInteractor::setWeightCache(&d_weight_caches[std::make_pair(ln, data_centering)]);
+        // Keep the Lagrangian arrays open for the whole level instead of
+        // obtaining them from PETSc once per patch.
+        const LData::ReadAccess F_access(*F_data[ln]);
+        const LData::ReadAccess X_access(*X_data[ln]);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
@@ -631,25 +789,25 @@ LDataManager::spread(const int f_data_idx,
             {
                 Pointer<CellData<NDIM, double> > f_cc_data = f_data;
                 LEInteractor::spread(
-                    f_cc_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+                    f_cc_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn_type);
             }
             if (ec_data)
             {
                 Pointer<EdgeData<NDIM, double> > f_ec_data = f_data;
                 LEInteractor::spread(
-                    f_ec_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+                    f_ec_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn_type);
             }
             if (nc_data)
             {
                 Pointer<NodeData<NDIM, double> > f_nc_data = f_data;
                 LEInteractor::spread(
-                    f_nc_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+                    f_nc_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn_type);
             }
             if (sc_data)
             {
                 Pointer<SideData<NDIM, double> > f_sc_data = f_data;
                 LEInteractor::spread(
-                    f_sc_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+                    f_sc_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn_type);
             }
             if (f_phys_bdry_op)
             {
@@ -657,6 +815,8 @@ LDataManager::spread(const int f_data_idx,
                 f_phys_bdry_op->accumulateFromPhysicalBoundaryData(*patch, fill_data_time, f_data->getGhostCellWidth());
             }
         }
+        LEInteractor::setWeightCache(nullptr);
+        d_lag_work_time += std::chrono::duration<double>(std::chrono::steady_clock::now() - kernel_start).count();
     }
 
     // Accumulate data.
@@ -724,6 +884,7 @@ LDataManager::interp(const int f_data_idx,
     const bool nc_data = f_nc_var;
     const bool sc_data = f_sc_var;
     TBOX_ASSERT(cc_data || ec_data || nc_data || sc_data);
+    const int data_centering = get_data_centering(cc_data, ec_data, nc_data);
 
     // Synchronize Eulerian values.
     for (int ln = finest_ln; ln > coarsest_ln; --ln)
@@ -746,6 +907,12 @@ LDataManager::interp(const int f_data_idx,
         }
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
+        const auto kernel_start = std::chrono::steady_clock::now();
+        if (d_use_weight_cache) LEInteractor::setWeightCache(&d_weight_caches[std::make_pair(ln, data_centering)]);
+        // Keep the Lagrangian arrays open for the whole level instead of
+        // obtaining them from PETSc once per patch.
+        const LData::WriteAccess F_access(*F_data[ln]);
+        const LData::ReadAccess X_access(*X_data[ln]);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
@@ -762,7 +929,7 @@ LDataManager::interp(const int f_data_idx,
                                           patch,
                                           box,
                                           periodic_shift,
-                                          d_default_interp_kernel_fcn);
+                                          d_default_interp_kernel_fcn_type);
             }
             if (ec_data)
             {
@@ -774,7 +941,7 @@ LDataManager::interp(const int f_data_idx,
                                           patch,
                                           box,
                                           periodic_shift,
-                                          d_default_interp_kernel_fcn);
+                                          d_default_interp_kernel_fcn_type);
             }
             if (nc_data)
             {
@@ -786,7 +953,7 @@ LDataManager::interp(const int f_data_idx,
                                           patch,
                                           box,
                                           periodic_shift,
-                                          d_default_interp_kernel_fcn);
+                                          d_default_interp_kernel_fcn_type);
             }
             if (sc_data)
             {
@@ -798,9 +965,11 @@ LDataManager::interp(const int f_data_idx,
                                           patch,
                                           box,
                                           periodic_shift,
-                                          d_default_interp_kernel_fcn);
+                                          d_default_interp_kernel_fcn_type);
             }
         }
+        LEInteractor::setWeightCache(nullptr);
+        d_lag_work_time += std::chrono::duration<double>(std::chrono::steady_clock::now() - kernel_start).count();
     }
 
     // Zero inactivated components.
@@ -895,6 +1064,7 @@ LDataManager::createLData(const std::string& quantity_name,
     if (maintain_data)
     {
         d_lag_mesh_data[level_number][quantity_name] = ret_val;
+        if (MemoryStatistics::enabled()) updateMemoryUsage();
     }
     return ret_val;
 } // createLData
@@ -1170,6 +1340,7 @@ LDataManager::activateLagrangianStructures(const std::vector<int>& structure_ids
         d_inactive_strcts[level_number].removeItem(structure_id);
     }
     d_inactive_strcts[level_number].communicateData();
+    resetInactiveNodeIndices(level_number);
     return;
 } // activateLagrangianStructures
 
@@ -1184,6 +1355,7 @@ LDataManager::inactivateLagrangianStructures(const std::vector<int>& structure_i
         d_inactive_strcts[level_number].addItem(structure_id);
     }
     d_inactive_strcts[level_number].communicateData();
+    resetInactiveNodeIndices(level_number);
     return;
 } // inactivateLagrangianStructures
 
@@ -1351,6 +1523,10 @@ LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest
     TBOX_ASSERT(finest_ln >= d_coarsest_ln && finest_ln <= d_finest_ln);
 #endif
 
+    // The local indices of the nodes are about to change, so the cached kernel
+    // weights are no longer valid.
+    d_weight_caches.clear();
+
     // Emit warnings if things seem to be out of synch.
     for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
     {
@@ -1513,6 +1689,7 @@ void
 LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_ln_in)
 {
     IBTK_TIMER_START(t_end_data_redistribution);
+    CommunicationStatistics::ScopedPhase communication_phase("redistribution");
 
     const int coarsest_ln = (coarsest_ln_in == -1) ? d_coarsest_ln : coarsest_ln_in;
     const int finest_ln = (finest_ln_in == -1) ? d_finest_ln : finest_ln_in;
@@ -1592,6 +1769,16 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         }
 
         // Communicate the data.
+        if (CommunicationStatistics::enabled())
+        {
+            const int rank = IBTK_MPI::getRank();
+            for (int dst_proc = 0; dst_proc < num_procs; ++dst_proc)
+            {
+                if (dst_proc == rank || src_index_set[dst_proc].empty()) continue;
+                CommunicationStatistics::getManager()->recordSend(
+                    dst_proc, transactions[rank][dst_proc]->computeOutgoingMessageSize());
+            }
+        }
         lnode_idx_data_mover.communicate();
 
         // Clear the cached displaced nodes.
@@ -1682,6 +1869,7 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
     std::vector<std::map<int, IS> > src_IS(finest_ln + 1);
     std::vector<std::map<int, IS> > dst_IS(finest_ln + 1);
     std::vector<std::map<int, VecScatter> > scatter_template(finest_ln + 1);
+    std::vector<bool> ordering_is_unchanged(finest_ln + 1, false);
 
     // The number of all local (e.g., on processor) and ghost (e.g., off
     // processor) nodes.
@@ -1759,6 +1947,27 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
             (num_local_nodes[level_number] > 0 ? &dst_inds[0] : &s_ao_dummy[0]));
         IBTK_CHKERRQ(ierr);
 
+        // Determine whether the redistribution leaves every node at the same
+        // position in the PETSc ordering (e.g., when the nodes did not move
+        // between processors). In that case, the data does not need to be
+        // communicated and can simply be copied into the new vectors.
+        if (num_data > 0)
+        {
+            PetscInt old_lower, old_upper;
+            Pointer<LData> data = level_data.begin()->second;
+            ierr = VecGetOwnershipRange(data->getVec(), &old_lower, &old_upper);
+            IBTK_CHKERRQ(ierr);
+            const int depth = data->getDepth();
+            bool local_ordering_is_unchanged =
+                (old_lower == depth * static_cast<PetscInt>(d_node_offset[level_number])) &&
+                (old_upper - old_lower == depth * num_local_nodes[level_number]);
+            for (int k = 0; k < num_local_nodes[level_number] && local_ordering_is_unchanged; ++k)
+            {
+                local_ordering_is_unchanged = dst_inds[k] == src_inds[k];
+            }
+            ordering_is_unchanged[level_number] = IBTK_MPI::minReduction(local_ordering_is_unchanged ? 1 : 0) == 1;
+        }
+
         // Setup VecScatter objects for each LData object and start scattering
         // data.
         std::map<std::string, Pointer<LData> >::iterator it;
@@ -1771,6 +1980,24 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
 #endif
             const int depth = data->getDepth();
 
+            if (ordering_is_unchanged[level_number])
+            {
+                // Create the destination Vec and copy the data directly.
+                src_vec[level_number][i] = data->getVec();
+                ierr = VecCreateGhostBlock(
+                    PETSC_COMM_WORLD,
+                    depth,
+                    depth * num_local_nodes[level_number],
+                    PETSC_DECIDE,
+                    num_nonlocal_nodes[level_number],
+                    num_nonlocal_nodes[level_number] > 0 ? &d_nonlocal_petsc_indices[level_number][0] : nullptr,
+                    &dst_vec[level_number][i]);
+                IBTK_CHKERRQ(ierr);
+                ierr = VecCopy(src_vec[level_number][i], dst_vec[level_number][i]);
+                IBTK_CHKERRQ(ierr);
+                continue;
+            }
+
             // Determine the PETSc indices of the source nodes for use when
             // scattering values from the old configuration to the new
             // configuration.  Notice that a different IS object must be used
@@ -1828,6 +2055,48 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
                                    INSERT_VALUES,
                                    SCATTER_FORWARD);
             IBTK_CHKERRQ(ierr);
+
+            // Record the data moved by the scatter. Every scattered node is
+            // indexed by the process that owns it in one of the two orderings,
+            // so each message is recorded by either its sender or its receiver.
+            if (CommunicationStatistics::enabled())
+            {
+                const int rank = IBTK_MPI::getRank();
+                const int num_procs = IBTK_MPI::getNodes();
+                const PetscInt *src_ranges, *dst_ranges;
+                ierr = VecGetOwnershipRanges(src_vec[level_number][i], &src_ranges);
+                IBTK_CHKERRQ(ierr);
+                ierr = VecGetOwnershipRanges(dst_vec[level_number][i], &dst_ranges);
+                IBTK_CHKERRQ(ierr);
+                const auto get_owner = [num_procs, depth](const PetscInt* ranges, const int node_idx) {
+                    return static_cast<int>(
+                        std::upper_bound(ranges, ranges + num_procs + 1, static_cast<PetscInt>(depth * node_idx)) -
+                        ranges - 1);
+                };
+                std::map<int, double> num_sent, num_received;
+                for (int k = 0; k < num_local_nodes[level_number]; ++k)
+                {
+                    const int src_owner = get_owner(src_ranges, src_inds[k]);
+                    const int dst_owner = get_owner(dst_ranges, dst_inds[k]);
+                    if (src_owner == dst_owner) continue;
+                    if (src_owner == rank)
+                    {
+                        num_sent[dst_owner] += depth * sizeof(double);
+                    }
+                    else if (dst_owner == rank)
+                    {
+                        num_received[src_owner] += depth * sizeof(double);
+                    }
+                }
+                for (const auto& neighbor : num_sent)
+                {
+                    CommunicationStatistics::getManager()->recordSend(neighbor.first, neighbor.second);
+                }
+                for (const auto& neighbor : num_received)
+                {
+                    CommunicationStatistics::getManager()->recordReceive(neighbor.first, neighbor.second);
+                }
+            }
         }
     }
 
@@ -1855,7 +2124,7 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-            idx_data->cacheLocalIndices(patch, periodic_shift);
+            idx_data->cacheLocalIndices(patch, periodic_shift, d_sort_local_indices_by_cell);
             const Box<NDIM>& ghost_box = idx_data->getGhostBox();
             for (LNodeSetData::DataIterator it = idx_data->data_begin(ghost_box); it != idx_data->data_end(); ++it)
             {
@@ -1884,6 +2153,7 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         }
         d_lag_mesh[level_number] =
             new LMesh(d_object_name + "::mesh::level_" + std::to_string(level_number), local_nodes, ghost_nodes);
+        resetInactiveNodeIndices(level_number);
     }
 
     // End scattering data, reset LData objects, and destroy the VecScatter
@@ -1897,14 +2167,17 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         int i;
         for (it = level_data.begin(), i = 0; it != level_data.end(); ++it, ++i)
         {
-            ierr = VecScatterEnd(scatter[level_number][i],
-                                 src_vec[level_number][i],
-                                 dst_vec[level_number][i],
-                                 INSERT_VALUES,
-                                 SCATTER_FORWARD);
-            IBTK_CHKERRQ(ierr);
-            ierr = VecScatterDestroy(&scatter[level_number][i]);
-            IBTK_CHKERRQ(ierr);
+            if (!ordering_is_unchanged[level_number])
+            {
+                ierr = VecScatterEnd(scatter[level_number][i],
+                                     src_vec[level_number][i],
+                                     dst_vec[level_number][i],
+                                     INSERT_VALUES,
+                                     SCATTER_FORWARD);
+                IBTK_CHKERRQ(ierr);
+                ierr = VecScatterDestroy(&scatter[level_number][i]);
+                IBTK_CHKERRQ(ierr);
+            }
             Pointer<LData> data = it->second;
             data->resetData(dst_vec[level_number][i], d_nonlocal_petsc_indices[level_number]);
         }
@@ -1947,6 +2220,8 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         d_silo_writer->registerLagrangianAO(d_ao, coarsest_ln, finest_ln);
     }
 
+    if (MemoryStatistics::enabled()) updateMemoryUsage();
+
     IBTK_TIMER_STOP(t_end_data_redistribution);
     return;
 } // endDataRedistribution
@@ -1967,6 +2242,8 @@ LDataManager::addWorkloadEstimate(Pointer<PatchHierarchy<NDIM> > hierarchy,
     TBOX_ASSERT(finest_ln >= d_coarsest_ln && finest_ln <= d_finest_ln);
 #endif
 
+    if (d_calibrate_workload) calibrateWorkloadWeight(hierarchy);
+
     updateNodeCountData(coarsest_ln, finest_ln);
     HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(hierarchy, coarsest_ln, finest_ln);
     hier_cc_data_ops.axpy(workload_data_idx, d_beta_work, d_node_count_idx, workload_data_idx);
@@ -1975,6 +2252,56 @@ LDataManager::addWorkloadEstimate(Pointer<PatchHierarchy<NDIM> > hierarchy,
     return;
 } // addWorkloadEstimate
 
+void
+LDataManager::calibrateWorkloadWeight(Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+    const auto now = std::chrono::steady_clock::now();
+    if (!d_workload_interval_started)
+    {
+        d_workload_interval_start = now;
+        d_workload_interval_started = true;
+        d_lag_work_time = 0.0;
+        return;
+    }
+
+    // Skip intervals without any Lagrangian work (e.g., repeated calls during
+    // a single regrid) and keep accumulating into the current interval.
+    if (IBTK_MPI::sumReduction(d_lag_work_time) <= 0.0) return;
+
+    // Collect the global Lagrangian kernel time, node count, and cell count.
+    // The time spent on Eulerian work is not measured directly, but is
+    // inferred from the total elapsed time of all processes.
+    double totals[3] = { d_lag_work_time, 0.0, 0.0 };
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        if (levelContainsLagrangianData(ln)) totals[1] += static_cast<double>(getNumberOfLocalNodes(ln));
+    }
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            totals[2] += static_cast<double>(level->getPatch(p())->getBox().size());
+        }
+    }
+    IBTK_MPI::sumReduction(totals, 3);
+    const double elapsed_time =
+        IBTK_MPI::maxReduction(std::chrono::duration<double>(now - d_workload_interval_start).count());
+    const double total_time = IBTK_MPI::getNodes() * elapsed_time;
+    const double lag_time = totals[0], num_nodes = totals[1], num_cells = totals[2];
+    if (num_nodes > 0.0 && num_cells > 0.0 && total_time > lag_time)
+    {
+        const double node_cost = lag_time / num_nodes;
+        const double cell_cost = (total_time - lag_time) / num_cells;
+        const double w = d_workload_relaxation;
+        d_beta_work = (1.0 - w) * d_beta_work + w * node_cost / cell_cost;
+    }
+
+    d_workload_interval_start = now;
+    d_lag_work_time = 0.0;
+    return;
+} // calibrateWorkloadWeight
+
 void
 LDataManager::updateNodeCountData(const int coarsest_ln_in, const int finest_ln_in)
 {
@@ -2247,7 +2574,7 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
 
             node_count_data->fillAll(0.0);
 
-            idx_data->cacheLocalIndices(patch, periodic_shift);
+            idx_data->cacheLocalIndices(patch, periodic_shift, d_sort_local_indices_by_cell);
             for (LNodeSetData::SetIterator it(*idx_data); it; it++)
             {
                 const CellIndex<NDIM>& i = it.getIndex();
@@ -2289,6 +2616,7 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
         d_lag_mesh[level_number] = new LMesh(d_object_name + "::mesh::level_" + std::to_string(level_number),
                                              std::vector<LNode*>(local_nodes.begin(), local_nodes.end()),
                                              std::vector<LNode*>(ghost_nodes.begin(), ghost_nodes.end()));
+        if (level_number < static_cast<int>(d_inactive_strcts.size())) resetInactiveNodeIndices(level_number);
 
         // 5. The AO (application order) is determined by the initial values of
         //    the local Lagrangian indices.
@@ -2489,6 +2817,7 @@ LDataManager::putToDatabase(Pointer<Database> db)
     db->putInteger("d_coarsest_ln", d_coarsest_ln);
     db->putInteger("d_finest_ln", d_finest_ln);
     db->putDouble("d_beta_work", d_beta_work);
+    db->putBool("d_use_collective_restart", d_use_collective_restart);
 
     // Write out data that is stored on a level-by-level basis.
     for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
@@ -2532,7 +2861,7 @@ LDataManager::putToDatabase(Pointer<Database> db)
         for (const auto& mesh_data : d_lag_mesh_data[level_number])
         {
             ldata_names.push_back(mesh_data.first);
-            mesh_data.second->putToDatabase(level_db->putDatabase(ldata_names.back()));
+            mesh_data.second->putToDatabase(level_db->putDatabase(ldata_names.back()), !d_use_collective_restart);
         }
         level_db->putInteger("n_ldata_names", static_cast<int>(ldata_names.size()));
         if (!ldata_names.empty())
@@ -2604,6 +2933,8 @@ LDataManager::LDataManager(std::string object_name,
       d_registered_for_restart(register_for_restart),
       d_default_interp_kernel_fcn(std::move(default_interp_kernel_fcn)),
       d_default_spread_kernel_fcn(std::move(default_spread_kernel_fcn)),
+      d_default_interp_kernel_fcn_type(LEInteractor::getKernelFunctionType(d_default_interp_kernel_fcn)),
+      d_default_spread_kernel_fcn_type(LEInteractor::getKernelFunctionType(d_default_spread_kernel_fcn)),
       d_error_if_points_leave_domain(error_if_points_leave_domain),
       d_ghost_width(std::move(ghost_width))
 {
@@ -2707,6 +3038,7 @@ LDataManager::~LDataManager()
             IBTK_CHKERRQ(ierr);
         }
     }
+    if (MemoryStatistics::enabled()) MemoryStatistics::getManager()->removeUsage("lagrangian_data", this);
     return;
 } // ~LDataManager
 
@@ -2784,6 +3116,24 @@ LDataManager::scatterData(Vec& lagrangian_vec, Vec& petsc_vec, const int level_n
     return;
 } // scatterData
 
+void
+LDataManager::updateMemoryUsage()
+{
+    // Each LData object stores the local and ghost values of its nodes.
+    double num_bytes = 0.0;
+    for (const auto& level_data : d_lag_mesh_data)
+    {
+        for (const auto& data : level_data)
+        {
+            if (!data.second) continue;
+            num_bytes += static_cast<double>(data.second->getLocalNodeCount() + data.second->getGhostNodeCount()) *
+                         data.second->getDepth() * sizeof(double);
+        }
+    }
+    MemoryStatistics::getManager()->setUsage("lagrangian_data", this, num_bytes);
+    return;
+} // updateMemoryUsage
+
 void
 LDataManager::beginNonlocalDataFill(const int coarsest_ln_in, const int finest_ln_in)
 {
@@ -2836,6 +3186,27 @@ LDataManager::endNonlocalDataFill(const int coarsest_ln_in, const int finest_ln_
     return;
 } // endNonlocalDataFill
 
+void
+LDataManager::resetInactiveNodeIndices(const int level_number)
+{
+    if (!d_level_contains_lag_data[level_number]) return;
+
+    std::vector<std::pair<int, int> > inactive_lag_idx_ranges;
+    for (int strct_id : d_inactive_strcts[level_number].getSet())
+    {
+        const auto it = d_strct_id_to_lag_idx_range_map[level_number].find(strct_id);
+        if (it != d_strct_id_to_lag_idx_range_map[level_number].end()) inactive_lag_idx_ranges.push_back(it->second);
+    }
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+        idx_data->setInactiveLagrangianIndexRanges(inactive_lag_idx_ranges);
+    }
+    return;
+} // resetInactiveNodeIndices
+
 void
 LDataManager::computeNodeDistribution(AO& ao,
                                       std::vector<int>& local_lag_indices,
@@ -2881,6 +3252,37 @@ LDataManager::computeNodeDistribution(AO& ao,
         const Pointer<Patch<NDIM> > patch = level->getPatch(p());
         const Box<NDIM>& patch_box = patch->getBox();
         const Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+        if (d_sort_local_nodes_by_cell)
+        {
+            // Number the nodes along a Z-order curve through the patch cells so
+            // that nodes in nearby cells are stored in nearby memory.  The sort
+            // is stable so that nodes in the same cell retain their relative
+            // order.
+            std::vector<std::pair<std::uint64_t, LNode*> > sorted_nodes;
+            for (LNodeSetData::SetIterator it(*idx_data); it; it++)
+            {
+                const CellIndex<NDIM>& i = it.getIndex();
+                if (!patch_box.contains(i)) continue;
+                const std::uint64_t key = morton_key(i, patch_box.lower());
+                const LNodeSet& node_set = *it;
+                for (const auto& node_idx : node_set) sorted_nodes.emplace_back(key, node_idx.getPointer());
+            }
+            std::stable_sort(sorted_nodes.begin(),
+                             sorted_nodes.end(),
+                             [](const std::pair<std::uint64_t, LNode*>& a, const std::pair<std::uint64_t, LNode*>& b) {
+                                 return a.first < b.first;
+                             });
+            for (const auto& key_and_node : sorted_nodes)
+            {
+                LNode* const node_idx = key_and_node.second;
+                const int lag_idx = node_idx->getLagrangianIndex();
+                local_lag_indices.push_back(lag_idx);
+                const int petsc_idx = local_offset++;
+                node_idx->setLocalPETScIndex(petsc_idx);
+                lag_idx_to_petsc_idx[lag_idx] = petsc_idx;
+            }
+            continue;
+        }
         for (LNodeSetData::DataIterator it = idx_data->data_begin(patch_box); it != idx_data->data_end(); ++it)
         {
             LNode* const node_idx = *it;
@@ -3047,6 +3449,17 @@ LDataManager::computeNodeOffsets(unsigned int& num_nodes, unsigned int& node_off
     return;
 } // computeNodeOffsets
 
+std::string
+LDataManager::getLDataRestartFileName(const std::string& restart_dirname, const unsigned int time_step_number) const
+{
+    std::string object_name = d_object_name;
+    std::replace(object_name.begin(), object_name.end(), ':', '_');
+    std::ostringstream file_name;
+    file_name << restart_dirname << "/lag_data." << object_name << "." << std::setw(6) << std::setfill('0')
+              << std::right << time_step_number << ".petsc";
+    return file_name.str();
+} // getLDataRestartFileName
+
 void
 LDataManager::getFromRestart()
 {
@@ -3072,6 +3485,7 @@ LDataManager::getFromRestart()
     d_coarsest_ln = db->getInteger("d_coarsest_ln");
     d_finest_ln = db->getInteger("d_finest_ln");
     d_beta_work = db->getDouble("d_beta_work");
+    d_use_collective_restart = db->getBoolWithDefault("d_use_collective_restart", false);
 
     // Resize some arrays.
     d_level_contains_lag_data.resize(d_finest_ln + 1, false);
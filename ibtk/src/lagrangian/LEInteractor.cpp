@@ -19,6 +19,8 @@
 #include "ibtk/LIndexSetData.h"
 #include "ibtk/LSet.h"
 #include "ibtk/ibtk_utilities.h"
+#include "ibtk/kernel_functions.h"
+#include "ibtk/profiling_annotations.h"
 
 #include "ArrayData.h"
 #include "Box.h"
@@ -49,10 +51,18 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <limits>
+#include <map>
 #include <ostream>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 // FORTRAN ROUTINES
 #if (NDIM == 2)
 #define LAGRANGIAN_PIECEWISE_CONSTANT_INTERP_FC                                                                        \
@@ -945,33 +955,215 @@ namespace IBTK
 
 namespace
 {
-inline double
-ib4_kernel_fcn(double r)
+inline int
+NINT(double a)
 {
-    r = std::abs(r);
-    if (r < 1.0)
-    {
-        const double t2 = r * r;
-        const double t6 = std::sqrt(-0.4e1 * t2 + 0.4e1 * r + 0.1e1);
-        return -r / 0.4e1 + 0.3e1 / 0.8e1 + t6 / 0.8e1;
-    }
-    else if (r < 2.0)
+    return (a >= 0.0 ? static_cast<int>(a + 0.5) : static_cast<int>(a - 0.5));
+}
+
+// Function pointer types for the Fortran interpolation and spreading routines.
+// All kernels except DISCONTINUOUS_LINEAR share these signatures.
+#if (NDIM == 2)
+using LagrangianInterpFcnPtr = void (*)(const double*,
+                                        const double*,
+                                        const double*,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        const double*,
+                                        const int*,
+                                        const double*,
+                                        const int&,
+                                        const double*,
+                                        double*);
+using LagrangianSpreadFcnPtr = void (*)(const double*,
+                                        const double*,
+                                        const double*,
+                                        const int&,
+                                        const int*,
+                                        const double*,
+                                        const int&,
+                                        const double*,
+                                        const double*,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        double*);
+#endif
+#if (NDIM == 3)
+using LagrangianInterpFcnPtr = void (*)(const double*,
+                                        const double*,
+                                        const double*,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        const double*,
+                                        const int*,
+                                        const double*,
+                                        const int&,
+                                        const double*,
+                                        double*);
+using LagrangianSpreadFcnPtr = void (*)(const double*,
+                                        const double*,
+                                        const double*,
+                                        const int&,
+                                        const int*,
+                                        const double*,
+                                        const int&,
+                                        const double*,
+                                        const double*,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        const int&,
+                                        double*);
+#endif
+
+inline LagrangianInterpFcnPtr
+get_lagrangian_interp_fcn(const KernelFunctionType kernel_fcn)
+{
+    switch (kernel_fcn)
     {
-        const double t2 = r * r;
-        const double t6 = std::sqrt(0.12e2 * r - 0.7e1 - 0.4e1 * t2);
-        return -r / 0.4e1 + 0.5e1 / 0.8e1 - t6 / 0.8e1;
+    case PIECEWISE_CONSTANT_KERNEL:
+        return LAGRANGIAN_PIECEWISE_CONSTANT_INTERP_FC;
+    case PIECEWISE_LINEAR_KERNEL:
+        return LAGRANGIAN_PIECEWISE_LINEAR_INTERP_FC;
+    case PIECEWISE_CUBIC_KERNEL:
+        return LAGRANGIAN_PIECEWISE_CUBIC_INTERP_FC;
+    case IB_3_KERNEL:
+        return LAGRANGIAN_IB_3_INTERP_FC;
+    case IB_4_KERNEL:
+        return LAGRANGIAN_IB_4_INTERP_FC;
+    case IB_4_W8_KERNEL:
+        return LAGRANGIAN_IB_4_W8_INTERP_FC;
+    case IB_5_KERNEL:
+        return LAGRANGIAN_IB_5_INTERP_FC;
+    case IB_6_KERNEL:
+        return LAGRANGIAN_IB_6_INTERP_FC;
+    case BSPLINE_3_KERNEL:
+        return LAGRANGIAN_BSPLINE_3_INTERP_FC;
+    case BSPLINE_4_KERNEL:
+        return LAGRANGIAN_BSPLINE_4_INTERP_FC;
+    case BSPLINE_5_KERNEL:
+        return LAGRANGIAN_BSPLINE_5_INTERP_FC;
+    case BSPLINE_6_KERNEL:
+        return LAGRANGIAN_BSPLINE_6_INTERP_FC;
+    default:
+        return nullptr;
     }
-    else
+} // get_lagrangian_interp_fcn
+
+inline LagrangianSpreadFcnPtr
+get_lagrangian_spread_fcn(const KernelFunctionType kernel_fcn)
+{
+    switch (kernel_fcn)
     {
-        return 0.0;
+    case PIECEWISE_CONSTANT_KERNEL:
+        return LAGRANGIAN_PIECEWISE_CONSTANT_SPREAD_FC;
+    case PIECEWISE_LINEAR_KERNEL:
+        return LAGRANGIAN_PIECEWISE_LINEAR_SPREAD_FC;
+    case PIECEWISE_CUBIC_KERNEL:
+        return LAGRANGIAN_PIECEWISE_CUBIC_SPREAD_FC;
+    case IB_3_KERNEL:
+        return LAGRANGIAN_IB_3_SPREAD_FC;
+    case IB_4_KERNEL:
+        return LAGRANGIAN_IB_4_SPREAD_FC;
+    case IB_4_W8_KERNEL:
+        return LAGRANGIAN_IB_4_W8_SPREAD_FC;
+    case IB_5_KERNEL:
+        return LAGRANGIAN_IB_5_SPREAD_FC;
+    case IB_6_KERNEL:
+        return LAGRANGIAN_IB_6_SPREAD_FC;
+    case BSPLINE_3_KERNEL:
+        return LAGRANGIAN_BSPLINE_3_SPREAD_FC;
+    case BSPLINE_4_KERNEL:
+        return LAGRANGIAN_BSPLINE_4_SPREAD_FC;
+    case BSPLINE_5_KERNEL:
+        return LAGRANGIAN_BSPLINE_5_SPREAD_FC;
+    case BSPLINE_6_KERNEL:
+        return LAGRANGIAN_BSPLINE_6_SPREAD_FC;
+    default:
+        return nullptr;
     }
-}
+} // get_lagrangian_spread_fcn
 
-inline int
-NINT(double a)
+#ifdef _OPENMP
+// The number of colors required so that no two bins of the same color share a
+// face, edge, or corner.
+const int NUM_SPREAD_COLORS = 1 << NDIM;
+
+// A batch of markers which are located in the same bin of Cartesian grid cells.
+struct SpreadBatch
 {
-    return (a >= 0.0 ? static_cast<int>(a + 0.5) : static_cast<int>(a - 0.5));
-}
+    std::vector<int> local_indices;
+    std::vector<double> periodic_shifts;
+};
+
+/*
+ * Sort markers into bins of Cartesian grid cells and color the bins by the
+ * parity of their bin indices.
+ *
+ * If the width of each bin is at least twice the distance from the cell
+ * containing a marker to the edge of its stencil, then the stencils of markers
+ * which lie in two different bins of the same color never overlap. Batches of
+ * the same color can consequently be spread concurrently without any atomic
+ * operations or locks.
+ */
+void
+build_colored_spread_batches(std::array<std::vector<SpreadBatch>, NUM_SPREAD_COLORS>& batches,
+                             const std::vector<int>& local_indices,
+                             const std::vector<double>& periodic_shifts,
+                             const double* const X_data,
+                             const double* const x_lower,
+                             const double* const dx,
+                             const int bin_width)
+{
+    std::array<std::map<std::array<int, NDIM>, SpreadBatch>, NUM_SPREAD_COLORS> bins;
+    for (std::size_t l = 0; l < local_indices.size(); ++l)
+    {
+        const int s = local_indices[l];
+        std::array<int, NDIM> bin_idx;
+        int color = 0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const double X_o_dx = (X_data[NDIM * s + d] + periodic_shifts[NDIM * l + d] - x_lower[d]) / dx[d];
+            bin_idx[d] = static_cast<int>(std::floor(X_o_dx / bin_width));
+            color |= (bin_idx[d] & 1) << d;
+        }
+        SpreadBatch& batch = bins[color][bin_idx];
+        batch.local_indices.push_back(s);
+        batch.periodic_shifts.insert(batch.periodic_shifts.end(),
+                                     periodic_shifts.begin() + NDIM * l,
+                                     periodic_shifts.begin() + NDIM * (l + 1));
+    }
+    for (int color = 0; color < NUM_SPREAD_COLORS; ++color)
+    {
+        batches[color].clear();
+        batches[color].reserve(bins[color].size());
+        for (auto& bin : bins[color]) batches[color].push_back(std::move(bin.second));
+    }
+    return;
+} // build_colored_spread_batches
+#endif
 
 using Weight = boost::multi_array<double, 1>;
 using TensorProductWeights = std::array<Weight, NDIM>;
@@ -1114,7 +1306,7 @@ perform_mls(const int stencil_sz,
 } // perform_mls
 
 void
-get_mls_weights(const std::string& kernel_fcn,
+get_mls_weights(const KernelFunctionType kernel_fcn,
                 const double* const X,
                 const double* const X_shift,
                 const double* const dx,
@@ -1127,10 +1319,10 @@ get_mls_weights(const std::string& kernel_fcn,
 {
     Weight::extent_gen extents;
 
-    if (kernel_fcn == "IB_4")
+    if (kernel_fcn == IB_4_KERNEL)
     {
         // Resize some arrays.
-        const int stencil_sz = LEInteractor::getStencilSize("IB_4");
+        const int stencil_sz = LEInteractor::getStencilSize(IB_4_KERNEL);
         TensorProductWeights D;
         for (unsigned int d = 0; d < NDIM; ++d)
         {
@@ -1155,7 +1347,7 @@ get_mls_weights(const std::string& kernel_fcn,
         }
         perform_mls(stencil_sz, X, stencil_lower, stencil_upper, p_start, dx, mask_data, D, Psi);
     }
-    else if (kernel_fcn == "USER_DEFINED")
+    else if (kernel_fcn == USER_DEFINED_KERNEL)
     {
         std::array<double, NDIM> X_cell;
         std::array<int, NDIM> stencil_center;
@@ -1311,14 +1503,281 @@ spread_data(const int stencil_sz,
     }
 #endif
 } // spread_data
+
+// Compute the lower index and the one-dimensional kernel weights of the
+// stencil of a point in each direction.  The stencils are identical to those
+// used by the Fortran implementations of the kernel functions.
+template <KernelFunctionType kernel>
+void
+compute_stencil(int* const stencil_lower,
+                double* const w,
+                const double* const X,
+                const double* const x_lower,
+                const double* const dx,
+                const int* const ilower)
+{
+    using Kernel = KernelFunction<kernel>;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const double X_o_dx = (X[d] - x_lower[d]) / dx[d];
+        const int ic = Kernel::support % 2 == 0 ? NINT(X_o_dx) - Kernel::support / 2 :
+                                                  static_cast<int>(std::floor(X_o_dx)) - (Kernel::support - 1) / 2;
+        stencil_lower[d] = ic + ilower[d];
+        Kernel::weights(X_o_dx - (static_cast<double>(ic) + 0.5), w + d * Kernel::support);
+    }
+    return;
+} // compute_stencil
+
+using ComputeStencilFcnPtr = void (*)(int*, double*, const double*, const double*, const double*, const int*);
+
+inline ComputeStencilFcnPtr
+get_compute_stencil_fcn(const KernelFunctionType kernel_fcn, int& support)
+{
+    switch (kernel_fcn)
+    {
+    case PIECEWISE_LINEAR_KERNEL:
+        support = KernelFunction<PIECEWISE_LINEAR_KERNEL>::support;
+        return &compute_stencil<PIECEWISE_LINEAR_KERNEL>;
+    case PIECEWISE_CUBIC_KERNEL:
+        support = KernelFunction<PIECEWISE_CUBIC_KERNEL>::support;
+        return &compute_stencil<PIECEWISE_CUBIC_KERNEL>;
+    case IB_3_KERNEL:
+        support = KernelFunction<IB_3_KERNEL>::support;
+        return &compute_stencil<IB_3_KERNEL>;
+    case IB_4_KERNEL:
+        support = KernelFunction<IB_4_KERNEL>::support;
+        return &compute_stencil<IB_4_KERNEL>;
+    case IB_5_KERNEL:
+        support = KernelFunction<IB_5_KERNEL>::support;
+        return &compute_stencil<IB_5_KERNEL>;
+    case BSPLINE_3_KERNEL:
+        support = KernelFunction<BSPLINE_3_KERNEL>::support;
+        return &compute_stencil<BSPLINE_3_KERNEL>;
+    case BSPLINE_4_KERNEL:
+        support = KernelFunction<BSPLINE_4_KERNEL>::support;
+        return &compute_stencil<BSPLINE_4_KERNEL>;
+    case BSPLINE_5_KERNEL:
+        support = KernelFunction<BSPLINE_5_KERNEL>::support;
+        return &compute_stencil<BSPLINE_5_KERNEL>;
+    case BSPLINE_6_KERNEL:
+        support = KernelFunction<BSPLINE_6_KERNEL>::support;
+        return &compute_stencil<BSPLINE_6_KERNEL>;
+    default:
+        return nullptr;
+    }
+} // get_compute_stencil_fcn
+
+// The largest stencil support of the kernel functions returned by
+// get_compute_stencil_fcn().
+static const int MAX_KERNEL_SUPPORT = 6;
+
+template <class WeightType>
+std::vector<WeightType>& get_cached_weights(LEInteractor::WeightCache::Stencils& stencils);
+
+template <>
+inline std::vector<double>&
+get_cached_weights<double>(LEInteractor::WeightCache::Stencils& stencils)
+{
+    return stencils.weights;
+} // get_cached_weights
+
+template <>
+inline std::vector<float>&
+get_cached_weights<float>(LEInteractor::WeightCache::Stencils& stencils)
+{
+    return stencils.single_weights;
+} // get_cached_weights
+
+// Interpolate or spread with the C++ implementations of the kernel functions.
+// The kernel weights are stored as WeightType and the products of the weights
+// in the different directions are formed in WeightType, but the Eulerian and
+// Lagrangian values are always accumulated in double precision.
+//
+// If stencils is non-null, the stencil of each point is only recomputed if the
+// point has moved since its stencil was cached.  Stencils are stored with
+// global (level) indices, so the cached stencil of a point can be reused on
+// every patch of the level, including patches on which the point lies in the
+// ghost region.
+template <bool spread, class WeightType>
+void
+interact_with_cpp_kernel_impl(LEInteractor::WeightCache::Stencils* const stencils,
+                              const ComputeStencilFcnPtr compute_stencil_fcn,
+                              const int support,
+                              double* const q_data,
+                              const Box<NDIM>& q_data_box,
+                              const IntVector<NDIM>& q_gcw,
+                              const int q_depth,
+                              const double* const Q_in,
+                              double* const Q_out,
+                              const double* const X_data,
+                              const double* const x_lower,
+                              const double* const dx,
+                              const std::vector<int>& local_indices,
+                              const std::vector<double>& periodic_shifts)
+{
+    TBOX_ASSERT(support <= MAX_KERNEL_SUPPORT);
+    int ig_lower[NDIM], ig_upper[NDIM], ig_size[NDIM];
+    double fac = 1.0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        ig_lower[d] = q_data_box.lower()(d) - q_gcw(d);
+        ig_upper[d] = q_data_box.upper()(d) + q_gcw(d);
+        ig_size[d] = ig_upper[d] - ig_lower[d] + 1;
+        fac /= dx[d];
+    }
+    const int* const ilower = q_data_box.lower();
+    int point_lower[NDIM];
+    double point_w[NDIM * MAX_KERNEL_SUPPORT];
+    WeightType point_w_copy[NDIM * MAX_KERNEL_SUPPORT];
+    const int num_local_indices = static_cast<int>(local_indices.size());
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        const int s = local_indices[l];
+        double X[NDIM];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            X[d] = X_data[d + s * NDIM] + periodic_shifts[d + l * NDIM];
+        }
+
+        // Look up or compute the stencil of the point.
+        const int* stencil_lower = point_lower;
+        const WeightType* w = point_w_copy;
+        if (stencils)
+        {
+            bool X_is_cached = true;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                X_is_cached = X_is_cached && stencils->X[d + s * NDIM] == X[d];
+            }
+            WeightType* const cached_w = &get_cached_weights<WeightType>(*stencils)[s * NDIM * support];
+            if (!X_is_cached)
+            {
+                compute_stencil_fcn(&stencils->lower[s * NDIM], point_w, X, x_lower, dx, ilower);
+                std::copy(point_w, point_w + NDIM * support, cached_w);
+                std::copy(X, X + NDIM, &stencils->X[s * NDIM]);
+            }
+            stencil_lower = &stencils->lower[s * NDIM];
+            w = cached_w;
+        }
+        else
+        {
+            compute_stencil_fcn(point_lower, point_w, X, x_lower, dx, ilower);
+            std::copy(point_w, point_w + NDIM * support, point_w_copy);
+        }
+
+        int istart[NDIM], istop[NDIM];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            istart[d] = std::max(ig_lower[d] - stencil_lower[d], 0);
+            istop[d] = std::min(ig_upper[d] - stencil_lower[d], support - 1);
+        }
+        for (int depth = 0; depth < q_depth; ++depth)
+        {
+            const double Q = spread ? Q_in[depth + s * q_depth] * fac : 0.0;
+            double Q_interp = 0.0;
+#if (NDIM == 2)
+            const WeightType w2 = 1;
+            const int offset2 = depth * ig_size[1];
+#endif
+#if (NDIM == 3)
+            for (int i2 = istart[2]; i2 <= istop[2]; ++i2)
+            {
+                const WeightType w2 = w[2 * support + i2];
+                const int offset2 = (depth * ig_size[2] + stencil_lower[2] + i2 - ig_lower[2]) * ig_size[1];
+#endif
+                for (int i1 = istart[1]; i1 <= istop[1]; ++i1)
+                {
+                    const WeightType w12 = w[support + i1] * w2;
+                    double* const q_row = q_data + (offset2 + stencil_lower[1] + i1 - ig_lower[1]) * ig_size[0] +
+                                          stencil_lower[0] - ig_lower[0];
+                    for (int i0 = istart[0]; i0 <= istop[0]; ++i0)
+                    {
+                        const WeightType w012 = w[i0] * w12;
+                        if (spread)
+                            q_row[i0] += Q * w012;
+                        else
+                            Q_interp += q_row[i0] * w012;
+                    }
+                }
+#if (NDIM == 3)
+            }
+#endif
+            if (!spread) Q_out[depth + s * q_depth] = Q_interp;
+        }
+    }
+    return;
+} // interact_with_cpp_kernel_impl
+
+template <bool spread>
+void
+interact_with_cpp_kernel(LEInteractor::WeightCache::Stencils* const stencils,
+                         const bool single_precision,
+                         const ComputeStencilFcnPtr compute_stencil_fcn,
+                         const int support,
+                         double* const q_data,
+                         const Box<NDIM>& q_data_box,
+                         const IntVector<NDIM>& q_gcw,
+                         const int q_depth,
+                         const double* const Q_in,
+                         double* const Q_out,
+                         const double* const X_data,
+                         const double* const x_lower,
+                         const double* const dx,
+                         const std::vector<int>& local_indices,
+                         const std::vector<double>& periodic_shifts)
+{
+    if (single_precision)
+    {
+        interact_with_cpp_kernel_impl<spread, float>(stencils,
+                                                     compute_stencil_fcn,
+                                                     support,
+                                                     q_data,
+                                                     q_data_box,
+                                                     q_gcw,
+                                                     q_depth,
+                                                     Q_in,
+                                                     Q_out,
+                                                     X_data,
+                                                     x_lower,
+                                                     dx,
+                                                     local_indices,
+                                                     periodic_shifts);
+    }
+    else
+    {
+        interact_with_cpp_kernel_impl<spread, double>(stencils,
+                                                      compute_stencil_fcn,
+                                                      support,
+                                                      q_data,
+                                                      q_data_box,
+                                                      q_gcw,
+                                                      q_depth,
+                                                      Q_in,
+                                                      Q_out,
+                                                      X_data,
+                                                      x_lower,
+                                                      dx,
+                                                      local_indices,
+                                                      periodic_shifts);
+    }
+    return;
+} // interact_with_cpp_kernel
 } // namespace
 
-double (*LEInteractor::s_kernel_fcn)(double r) = &ib4_kernel_fcn;
+double (*LEInteractor::s_kernel_fcn)(double r) = &KernelFunction<IB_4_KERNEL>::value;
 int LEInteractor::s_kernel_fcn_stencil_size = 4;
+bool LEInteractor::s_use_colored_spreading = false;
+bool LEInteractor::s_use_single_precision_weights = false;
+LEInteractor::WeightCache* LEInteractor::s_weight_cache = nullptr;
 
-void LEInteractor::setFromDatabase(Pointer<Database> /*db*/)
+void
+LEInteractor::setFromDatabase(Pointer<Database> db)
 {
-    // intentionally blank
+    if (!db) return;
+    if (db->keyExists("use_colored_spreading"))
+        s_use_colored_spreading = db->getBool("use_colored_spreading");
+    if (db->keyExists("use_single_precision_weights"))
+        s_use_single_precision_weights = db->getBool("use_single_precision_weights");
     return;
 }
 
@@ -1326,6 +1785,8 @@ void
 LEInteractor::printClassData(std::ostream& os)
 {
     os << "LEInteractor::printClassData():\n";
+    os << "  s_use_colored_spreading = " << s_use_colored_spreading << "\n";
+    os << "  s_use_single_precision_weights = " << s_use_single_precision_weights << "\n";
     return;
 }
 
@@ -1334,31 +1795,107 @@ LEInteractor::printClassData(std::ostream& os)
 int
 LEInteractor::getStencilSize(const std::string& kernel_fcn)
 {
-    if (kernel_fcn == "PIECEWISE_CONSTANT") return 1;
-    if (kernel_fcn == "DISCONTINUOUS_LINEAR") return 2;
-    if (kernel_fcn == "PIECEWISE_LINEAR") return 2;
-    if (kernel_fcn == "PIECEWISE_CUBIC") return 4;
-    if (kernel_fcn == "IB_3") return 4;
-    if (kernel_fcn == "IB_4") return 4;
-    if (kernel_fcn == "IB_4_W8") return 8;
-    if (kernel_fcn == "IB_5") return 6;
-    if (kernel_fcn == "IB_6") return 6;
-    if (kernel_fcn == "BSPLINE_3") return 4;
-    if (kernel_fcn == "BSPLINE_4") return 4;
-    if (kernel_fcn == "BSPLINE_5") return 6;
-    if (kernel_fcn == "BSPLINE_6") return 6;
-    if (kernel_fcn == "USER_DEFINED") return s_kernel_fcn_stencil_size;
-    TBOX_ERROR("LEInteractor::getStencilSize()\n"
-               << "  Unknown kernel function " << kernel_fcn << std::endl);
+    return getStencilSize(getKernelFunctionType(kernel_fcn));
+}
+
+int
+LEInteractor::getStencilSize(const KernelFunctionType kernel_fcn)
+{
+    switch (kernel_fcn)
+    {
+    case PIECEWISE_CONSTANT_KERNEL:
+        return 1;
+    case DISCONTINUOUS_LINEAR_KERNEL:
+        return 2;
+    case PIECEWISE_LINEAR_KERNEL:
+        return 2;
+    case PIECEWISE_CUBIC_KERNEL:
+        return 4;
+    case IB_3_KERNEL:
+        return 4;
+    case IB_4_KERNEL:
+        return 4;
+    case IB_4_W8_KERNEL:
+        return 8;
+    case IB_5_KERNEL:
+        return 6;
+    case IB_6_KERNEL:
+        return 6;
+    case BSPLINE_3_KERNEL:
+        return 4;
+    case BSPLINE_4_KERNEL:
+        return 4;
+    case BSPLINE_5_KERNEL:
+        return 6;
+    case BSPLINE_6_KERNEL:
+        return 6;
+    case USER_DEFINED_KERNEL:
+        return s_kernel_fcn_stencil_size;
+    default:
+        TBOX_ERROR("LEInteractor::getStencilSize()\n"
+                   << "  Unknown kernel function " << enum_to_string<KernelFunctionType>(kernel_fcn) << std::endl);
+    }
     return -1;
 }
 
 int
 LEInteractor::getMinimumGhostWidth(const std::string& kernel_fcn)
+{
+    return getMinimumGhostWidth(getKernelFunctionType(kernel_fcn));
+}
+
+int
+LEInteractor::getMinimumGhostWidth(const KernelFunctionType kernel_fcn)
 {
     return static_cast<int>(floor(0.5 * getStencilSize(kernel_fcn))) + 1;
 }
 
+KernelFunctionType
+LEInteractor::getKernelFunctionType(const std::string& kernel_fcn)
+{
+    const KernelFunctionType kernel_fcn_type = string_to_enum<KernelFunctionType>(kernel_fcn);
+    if (kernel_fcn_type == UNKNOWN_KERNEL_FUNCTION_TYPE)
+    {
+        TBOX_ERROR("LEInteractor::getKernelFunctionType()\n"
+                   << "  Unknown kernel function " << kernel_fcn << std::endl);
+    }
+    return kernel_fcn_type;
+}
+
+void
+LEInteractor::WeightCache::clear()
+{
+    d_stencils.clear();
+    return;
+}
+
+LEInteractor::WeightCache::Stencils&
+LEInteractor::WeightCache::getStencils(const KernelFunctionType kernel_fcn,
+                                       const int axis,
+                                       const int num_points,
+                                       const int support,
+                                       const bool single_precision)
+{
+    Stencils& stencils = d_stencils[std::make_tuple(static_cast<int>(kernel_fcn), axis, single_precision)];
+    if (static_cast<int>(stencils.lower.size()) < NDIM * num_points)
+    {
+        stencils.X.resize(NDIM * num_points, std::numeric_limits<double>::quiet_NaN());
+        stencils.lower.resize(NDIM * num_points);
+        if (single_precision)
+            stencils.single_weights.resize(NDIM * support * num_points);
+        else
+            stencils.weights.resize(NDIM * support * num_points);
+    }
+    return stencils;
+}
+
+void
+LEInteractor::setWeightCache(WeightCache* const weight_cache)
+{
+    s_weight_cache = weight_cache;
+    return;
+}
+
 template <class T>
 void
 LEInteractor::interpolate(Pointer<LData> Q_data,
@@ -1368,7 +1905,7 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const IntVector<NDIM>& periodic_shift,
-                          const std::string& interp_fcn)
+                          const KernelFunctionType kernel_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(Q_data);
@@ -1379,18 +1916,18 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
     TBOX_ASSERT(Q_data->getDepth() == static_cast<unsigned int>(q_data->getDepth()));
     TBOX_ASSERT(X_data->getDepth() == NDIM);
 #endif
-    interpolate(Q_data->getGhostedLocalFormVecArray()->data(),
+    const LData::WriteAccess Q_access(*Q_data);
+    const LData::ReadAccess X_access(*X_data);
+    interpolate(Q_access.data(),
                 Q_data->getDepth(),
-                X_data->getGhostedLocalFormVecArray()->data(),
+                X_access.data(),
                 X_data->getDepth(),
                 idx_data,
                 q_data,
                 patch,
                 interp_box,
                 periodic_shift,
-                interp_fcn);
-    Q_data->restoreArrays();
-    X_data->restoreArrays();
+                kernel_fcn);
     return;
 }
 
@@ -1399,11 +1936,26 @@ void
 LEInteractor::interpolate(Pointer<LData> Q_data,
                           const Pointer<LData> X_data,
                           const Pointer<LIndexSetData<T> > idx_data,
-                          const Pointer<NodeData<NDIM, double> > q_data,
+                          const Pointer<CellData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const IntVector<NDIM>& periodic_shift,
                           const std::string& interp_fcn)
+{
+    interpolate(Q_data, X_data, idx_data, q_data, patch, interp_box, periodic_shift, getKernelFunctionType(interp_fcn));
+    return;
+}
+
+template <class T>
+void
+LEInteractor::interpolate(Pointer<LData> Q_data,
+                          const Pointer<LData> X_data,
+                          const Pointer<LIndexSetData<T> > idx_data,
+                          const Pointer<NodeData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const IntVector<NDIM>& periodic_shift,
+                          const KernelFunctionType kernel_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(Q_data);
@@ -1414,18 +1966,18 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
     TBOX_ASSERT(Q_data->getDepth() == static_cast<unsigned int>(q_data->getDepth()));
     TBOX_ASSERT(X_data->getDepth() == NDIM);
 #endif
-    interpolate(Q_data->getGhostedLocalFormVecArray()->data(),
+    const LData::WriteAccess Q_access(*Q_data);
+    const LData::ReadAccess X_access(*X_data);
+    interpolate(Q_access.data(),
                 Q_data->getDepth(),
-                X_data->getGhostedLocalFormVecArray()->data(),
+                X_access.data(),
                 X_data->getDepth(),
                 idx_data,
                 q_data,
                 patch,
                 interp_box,
                 periodic_shift,
-                interp_fcn);
-    Q_data->restoreArrays();
-    X_data->restoreArrays();
+                kernel_fcn);
     return;
 }
 
@@ -1434,11 +1986,26 @@ void
 LEInteractor::interpolate(Pointer<LData> Q_data,
                           const Pointer<LData> X_data,
                           const Pointer<LIndexSetData<T> > idx_data,
-                          const Pointer<SideData<NDIM, double> > q_data,
+                          const Pointer<NodeData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const IntVector<NDIM>& periodic_shift,
                           const std::string& interp_fcn)
+{
+    interpolate(Q_data, X_data, idx_data, q_data, patch, interp_box, periodic_shift, getKernelFunctionType(interp_fcn));
+    return;
+}
+
+template <class T>
+void
+LEInteractor::interpolate(Pointer<LData> Q_data,
+                          const Pointer<LData> X_data,
+                          const Pointer<LIndexSetData<T> > idx_data,
+                          const Pointer<SideData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const IntVector<NDIM>& periodic_shift,
+                          const KernelFunctionType kernel_fcn)
 {
     if (Q_data->getDepth() != NDIM || q_data->getDepth() != 1)
     {
@@ -1455,18 +2022,18 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
     TBOX_ASSERT(X_data->getDepth() == NDIM);
     TBOX_ASSERT(q_data->getDepth() == 1);
 #endif
-    interpolate(Q_data->getGhostedLocalFormVecArray()->data(),
+    const LData::WriteAccess Q_access(*Q_data);
+    const LData::ReadAccess X_access(*X_data);
+    interpolate(Q_access.data(),
                 Q_data->getDepth(),
-                X_data->getGhostedLocalFormVecArray()->data(),
+                X_access.data(),
                 X_data->getDepth(),
                 idx_data,
                 q_data,
                 patch,
                 interp_box,
                 periodic_shift,
-                interp_fcn);
-    Q_data->restoreArrays();
-    X_data->restoreArrays();
+                kernel_fcn);
     return;
 }
 
@@ -1475,39 +2042,69 @@ void
 LEInteractor::interpolate(Pointer<LData> Q_data,
                           const Pointer<LData> X_data,
                           const Pointer<LIndexSetData<T> > idx_data,
-                          const Pointer<EdgeData<NDIM, double> > q_data,
+                          const Pointer<SideData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const IntVector<NDIM>& periodic_shift,
                           const std::string& interp_fcn)
 {
-    if (NDIM != 3 || Q_data->getDepth() != NDIM || q_data->getDepth() != 1)
-    {
-        TBOX_ERROR("LEInteractor::interpolate():\n"
-                   << "  edge-centered interpolation requires 3D vector-valued data.\n");
-    }
-#if !defined(NDEBUG)
-    TBOX_ASSERT(Q_data);
-    TBOX_ASSERT(q_data);
-    TBOX_ASSERT(X_data);
-    TBOX_ASSERT(idx_data);
+    interpolate(Q_data, X_data, idx_data, q_data, patch, interp_box, periodic_shift, getKernelFunctionType(interp_fcn));
+    return;
+}
+
+template <class T>
+void
+LEInteractor::interpolate(Pointer<LData> Q_data,
+                          const Pointer<LData> X_data,
+                          const Pointer<LIndexSetData<T> > idx_data,
+                          const Pointer<EdgeData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const IntVector<NDIM>& periodic_shift,
+                          const KernelFunctionType kernel_fcn)
+{
+    if (NDIM != 3 || Q_data->getDepth() != NDIM || q_data->getDepth() != 1)
+    {
+        TBOX_ERROR("LEInteractor::interpolate():\n"
+                   << "  edge-centered interpolation requires 3D vector-valued data.\n");
+    }
+#if !defined(NDEBUG)
+    TBOX_ASSERT(Q_data);
+    TBOX_ASSERT(q_data);
+    TBOX_ASSERT(X_data);
+    TBOX_ASSERT(idx_data);
     TBOX_ASSERT(patch);
     TBOX_ASSERT(Q_data->getDepth() == NDIM);
     TBOX_ASSERT(X_data->getDepth() == NDIM);
     TBOX_ASSERT(q_data->getDepth() == 1);
 #endif
-    interpolate(Q_data->getGhostedLocalFormVecArray()->data(),
+    const LData::WriteAccess Q_access(*Q_data);
+    const LData::ReadAccess X_access(*X_data);
+    interpolate(Q_access.data(),
                 Q_data->getDepth(),
-                X_data->getGhostedLocalFormVecArray()->data(),
+                X_access.data(),
                 X_data->getDepth(),
                 idx_data,
                 q_data,
                 patch,
                 interp_box,
                 periodic_shift,
-                interp_fcn);
-    Q_data->restoreArrays();
-    X_data->restoreArrays();
+                kernel_fcn);
+    return;
+}
+
+template <class T>
+void
+LEInteractor::interpolate(Pointer<LData> Q_data,
+                          const Pointer<LData> X_data,
+                          const Pointer<LIndexSetData<T> > idx_data,
+                          const Pointer<EdgeData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const IntVector<NDIM>& periodic_shift,
+                          const std::string& interp_fcn)
+{
+    interpolate(Q_data, X_data, idx_data, q_data, patch, interp_box, periodic_shift, getKernelFunctionType(interp_fcn));
     return;
 }
 
@@ -1522,7 +2119,7 @@ LEInteractor::interpolate(double* const Q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const IntVector<NDIM>& periodic_shift,
-                          const std::string& interp_fcn)
+                          const KernelFunctionType kernel_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -1548,10 +2145,14 @@ LEInteractor::interpolate(double* const Q_data,
         patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
     }
 
-    // Generate a list of local indices which lie in the specified box.
-    std::vector<int> local_indices;
-    std::vector<double> periodic_shifts;
-    buildLocalIndices(local_indices, periodic_shifts, interp_box, patch, periodic_shift, idx_data);
+    // Generate a list of local indices which lie in the specified box.  The
+    // lists cached by idx_data are used without copying whenever possible.
+    std::vector<int> local_indices_buf;
+    std::vector<double> periodic_shifts_buf;
+    const auto cached_indices =
+        getLocalIndices(local_indices_buf, periodic_shifts_buf, interp_box, patch, periodic_shift, idx_data);
+    const std::vector<int>& local_indices = *cached_indices.first;
+    const std::vector<double>& periodic_shifts = *cached_indices.second;
 
     // Interpolate.
     if (!local_indices.empty())
@@ -1570,7 +2171,7 @@ LEInteractor::interpolate(double* const Q_data,
                     patch_touches_upper_physical_bdry,
                     local_indices,
                     periodic_shifts,
-                    interp_fcn);
+                    kernel_fcn);
     }
     return;
 }
@@ -1582,11 +2183,37 @@ LEInteractor::interpolate(double* const Q_data,
                           const double* const X_data,
                           const int X_depth,
                           const Pointer<LIndexSetData<T> > idx_data,
-                          const Pointer<NodeData<NDIM, double> > q_data,
+                          const Pointer<CellData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const IntVector<NDIM>& periodic_shift,
                           const std::string& interp_fcn)
+{
+    interpolate(Q_data,
+                Q_depth,
+                X_data,
+                X_depth,
+                idx_data,
+                q_data,
+                patch,
+                interp_box,
+                periodic_shift,
+                getKernelFunctionType(interp_fcn));
+    return;
+}
+
+template <class T>
+void
+LEInteractor::interpolate(double* const Q_data,
+                          const int Q_depth,
+                          const double* const X_data,
+                          const int X_depth,
+                          const Pointer<LIndexSetData<T> > idx_data,
+                          const Pointer<NodeData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const IntVector<NDIM>& periodic_shift,
+                          const KernelFunctionType kernel_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -1612,10 +2239,14 @@ LEInteractor::interpolate(double* const Q_data,
         patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
     }
 
-    // Generate a list of local indices which lie in the specified box.
-    std::vector<int> local_indices;
-    std::vector<double> periodic_shifts;
-    buildLocalIndices(local_indices, periodic_shifts, interp_box, patch, periodic_shift, idx_data);
+    // Generate a list of local indices which lie in the specified box.  The
+    // lists cached by idx_data are used without copying whenever possible.
+    std::vector<int> local_indices_buf;
+    std::vector<double> periodic_shifts_buf;
+    const auto cached_indices =
+        getLocalIndices(local_indices_buf, periodic_shifts_buf, interp_box, patch, periodic_shift, idx_data);
+    const std::vector<int>& local_indices = *cached_indices.first;
+    const std::vector<double>& periodic_shifts = *cached_indices.second;
 
     // Interpolate.
     if (!local_indices.empty())
@@ -1640,7 +2271,7 @@ LEInteractor::interpolate(double* const Q_data,
                     patch_touches_upper_physical_bdry,
                     local_indices,
                     periodic_shifts,
-                    interp_fcn);
+                    kernel_fcn);
     }
     return;
 }
@@ -1652,11 +2283,37 @@ LEInteractor::interpolate(double* const Q_data,
                           const double* const X_data,
                           const int X_depth,
                           const Pointer<LIndexSetData<T> > idx_data,
-                          const Pointer<SideData<NDIM, double> > q_data,
+                          const Pointer<NodeData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const IntVector<NDIM>& periodic_shift,
                           const std::string& interp_fcn)
+{
+    interpolate(Q_data,
+                Q_depth,
+                X_data,
+                X_depth,
+                idx_data,
+                q_data,
+                patch,
+                interp_box,
+                periodic_shift,
+                getKernelFunctionType(interp_fcn));
+    return;
+}
+
+template <class T>
+void
+LEInteractor::interpolate(double* const Q_data,
+                          const int Q_depth,
+                          const double* const X_data,
+                          const int X_depth,
+                          const Pointer<LIndexSetData<T> > idx_data,
+                          const Pointer<SideData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const IntVector<NDIM>& periodic_shift,
+                          const KernelFunctionType kernel_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -1689,10 +2346,14 @@ LEInteractor::interpolate(double* const Q_data,
         patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
     }
 
-    // Generate a list of local indices which lie in the specified box.
-    std::vector<int> local_indices;
-    std::vector<double> periodic_shifts;
-    buildLocalIndices(local_indices, periodic_shifts, interp_box, patch, periodic_shift, idx_data);
+    // Generate a list of local indices which lie in the specified box.  The
+    // lists cached by idx_data are used without copying whenever possible.
+    std::vector<int> local_indices_buf;
+    std::vector<double> periodic_shifts_buf;
+    const auto cached_indices =
+        getLocalIndices(local_indices_buf, periodic_shifts_buf, interp_box, patch, periodic_shift, idx_data);
+    const std::vector<int>& local_indices = *cached_indices.first;
+    const std::vector<double>& periodic_shifts = *cached_indices.second;
 
     // Interpolate.
     if (!local_indices.empty())
@@ -1723,7 +2384,7 @@ LEInteractor::interpolate(double* const Q_data,
                         patch_touches_upper_physical_bdry,
                         local_indices,
                         periodic_shifts,
-                        interp_fcn,
+                        kernel_fcn,
                         axis);
             for (const auto& local_index : local_indices)
             {
@@ -1741,11 +2402,37 @@ LEInteractor::interpolate(double* const Q_data,
                           const double* const X_data,
                           const int X_depth,
                           const Pointer<LIndexSetData<T> > idx_data,
-                          const Pointer<EdgeData<NDIM, double> > q_data,
+                          const Pointer<SideData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const IntVector<NDIM>& periodic_shift,
                           const std::string& interp_fcn)
+{
+    interpolate(Q_data,
+                Q_depth,
+                X_data,
+                X_depth,
+                idx_data,
+                q_data,
+                patch,
+                interp_box,
+                periodic_shift,
+                getKernelFunctionType(interp_fcn));
+    return;
+}
+
+template <class T>
+void
+LEInteractor::interpolate(double* const Q_data,
+                          const int Q_depth,
+                          const double* const X_data,
+                          const int X_depth,
+                          const Pointer<LIndexSetData<T> > idx_data,
+                          const Pointer<EdgeData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const IntVector<NDIM>& periodic_shift,
+                          const KernelFunctionType kernel_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -1778,10 +2465,14 @@ LEInteractor::interpolate(double* const Q_data,
         patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
     }
 
-    // Generate a list of local indices which lie in the specified box.
-    std::vector<int> local_indices;
-    std::vector<double> periodic_shifts;
-    buildLocalIndices(local_indices, periodic_shifts, interp_box, patch, periodic_shift, idx_data);
+    // Generate a list of local indices which lie in the specified box.  The
+    // lists cached by idx_data are used without copying whenever possible.
+    std::vector<int> local_indices_buf;
+    std::vector<double> periodic_shifts_buf;
+    const auto cached_indices =
+        getLocalIndices(local_indices_buf, periodic_shifts_buf, interp_box, patch, periodic_shift, idx_data);
+    const std::vector<int>& local_indices = *cached_indices.first;
+    const std::vector<double>& periodic_shifts = *cached_indices.second;
 
     // Interpolate.
     if (!local_indices.empty())
@@ -1815,7 +2506,7 @@ LEInteractor::interpolate(double* const Q_data,
                         patch_touches_upper_physical_bdry,
                         local_indices,
                         periodic_shifts,
-                        interp_fcn,
+                        kernel_fcn,
                         axis);
             for (const auto& local_index : local_indices)
             {
@@ -1826,6 +2517,32 @@ LEInteractor::interpolate(double* const Q_data,
     return;
 }
 
+template <class T>
+void
+LEInteractor::interpolate(double* const Q_data,
+                          const int Q_depth,
+                          const double* const X_data,
+                          const int X_depth,
+                          const Pointer<LIndexSetData<T> > idx_data,
+                          const Pointer<EdgeData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const IntVector<NDIM>& periodic_shift,
+                          const std::string& interp_fcn)
+{
+    interpolate(Q_data,
+                Q_depth,
+                X_data,
+                X_depth,
+                idx_data,
+                q_data,
+                patch,
+                interp_box,
+                periodic_shift,
+                getKernelFunctionType(interp_fcn));
+    return;
+}
+
 void
 LEInteractor::interpolate(std::vector<double>& Q_data,
                           const int Q_depth,
@@ -1834,7 +2551,7 @@ LEInteractor::interpolate(std::vector<double>& Q_data,
                           const Pointer<CellData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
-                          const std::string& interp_fcn)
+                          const KernelFunctionType kernel_fcn)
 {
     if (Q_data.empty()) return;
     interpolate(&Q_data[0],
@@ -1846,7 +2563,7 @@ LEInteractor::interpolate(std::vector<double>& Q_data,
                 q_data,
                 patch,
                 interp_box,
-                interp_fcn);
+                kernel_fcn);
 }
 
 void
@@ -1854,11 +2571,25 @@ LEInteractor::interpolate(std::vector<double>& Q_data,
                           const int Q_depth,
                           const std::vector<double>& X_data,
                           const int X_depth,
-                          const Pointer<CellData<NDIM, double> > mask_data,
                           const Pointer<CellData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const std::string& interp_fcn)
+{
+    interpolate(Q_data, Q_depth, X_data, X_depth, q_data, patch, interp_box, getKernelFunctionType(interp_fcn));
+    return;
+}
+
+void
+LEInteractor::interpolate(std::vector<double>& Q_data,
+                          const int Q_depth,
+                          const std::vector<double>& X_data,
+                          const int X_depth,
+                          const Pointer<CellData<NDIM, double> > mask_data,
+                          const Pointer<CellData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const KernelFunctionType kernel_fcn)
 {
     if (Q_data.empty()) return;
     interpolate(&Q_data[0],
@@ -1871,7 +2602,7 @@ LEInteractor::interpolate(std::vector<double>& Q_data,
                 q_data,
                 patch,
                 interp_box,
-                interp_fcn);
+                kernel_fcn);
 }
 
 void
@@ -1879,10 +2610,26 @@ LEInteractor::interpolate(std::vector<double>& Q_data,
                           const int Q_depth,
                           const std::vector<double>& X_data,
                           const int X_depth,
-                          const Pointer<NodeData<NDIM, double> > q_data,
+                          const Pointer<CellData<NDIM, double> > mask_data,
+                          const Pointer<CellData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const std::string& interp_fcn)
+{
+    interpolate(
+        Q_data, Q_depth, X_data, X_depth, mask_data, q_data, patch, interp_box, getKernelFunctionType(interp_fcn));
+    return;
+}
+
+void
+LEInteractor::interpolate(std::vector<double>& Q_data,
+                          const int Q_depth,
+                          const std::vector<double>& X_data,
+                          const int X_depth,
+                          const Pointer<NodeData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const KernelFunctionType kernel_fcn)
 {
     if (Q_data.empty()) return;
     interpolate(&Q_data[0],
@@ -1894,7 +2641,7 @@ LEInteractor::interpolate(std::vector<double>& Q_data,
                 q_data,
                 patch,
                 interp_box,
-                interp_fcn);
+                kernel_fcn);
 }
 
 void
@@ -1902,10 +2649,24 @@ LEInteractor::interpolate(std::vector<double>& Q_data,
                           const int Q_depth,
                           const std::vector<double>& X_data,
                           const int X_depth,
-                          const Pointer<SideData<NDIM, double> > q_data,
+                          const Pointer<NodeData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const std::string& interp_fcn)
+{
+    interpolate(Q_data, Q_depth, X_data, X_depth, q_data, patch, interp_box, getKernelFunctionType(interp_fcn));
+    return;
+}
+
+void
+LEInteractor::interpolate(std::vector<double>& Q_data,
+                          const int Q_depth,
+                          const std::vector<double>& X_data,
+                          const int X_depth,
+                          const Pointer<SideData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const KernelFunctionType kernel_fcn)
 {
     if (Q_data.empty()) return;
     interpolate(&Q_data[0],
@@ -1917,7 +2678,7 @@ LEInteractor::interpolate(std::vector<double>& Q_data,
                 q_data,
                 patch,
                 interp_box,
-                interp_fcn);
+                kernel_fcn);
 }
 
 void
@@ -1925,11 +2686,25 @@ LEInteractor::interpolate(std::vector<double>& Q_data,
                           const int Q_depth,
                           const std::vector<double>& X_data,
                           const int X_depth,
-                          const Pointer<SideData<NDIM, double> > mask_data,
                           const Pointer<SideData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const std::string& interp_fcn)
+{
+    interpolate(Q_data, Q_depth, X_data, X_depth, q_data, patch, interp_box, getKernelFunctionType(interp_fcn));
+    return;
+}
+
+void
+LEInteractor::interpolate(std::vector<double>& Q_data,
+                          const int Q_depth,
+                          const std::vector<double>& X_data,
+                          const int X_depth,
+                          const Pointer<SideData<NDIM, double> > mask_data,
+                          const Pointer<SideData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const KernelFunctionType kernel_fcn)
 {
     if (Q_data.empty()) return;
     interpolate(&Q_data[0],
@@ -1942,7 +2717,7 @@ LEInteractor::interpolate(std::vector<double>& Q_data,
                 q_data,
                 patch,
                 interp_box,
-                interp_fcn);
+                kernel_fcn);
 }
 
 void
@@ -1950,10 +2725,26 @@ LEInteractor::interpolate(std::vector<double>& Q_data,
                           const int Q_depth,
                           const std::vector<double>& X_data,
                           const int X_depth,
-                          const Pointer<EdgeData<NDIM, double> > q_data,
+                          const Pointer<SideData<NDIM, double> > mask_data,
+                          const Pointer<SideData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const std::string& interp_fcn)
+{
+    interpolate(
+        Q_data, Q_depth, X_data, X_depth, mask_data, q_data, patch, interp_box, getKernelFunctionType(interp_fcn));
+    return;
+}
+
+void
+LEInteractor::interpolate(std::vector<double>& Q_data,
+                          const int Q_depth,
+                          const std::vector<double>& X_data,
+                          const int X_depth,
+                          const Pointer<EdgeData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const KernelFunctionType kernel_fcn)
 {
     if (Q_data.empty()) return;
     interpolate(&Q_data[0],
@@ -1965,7 +2756,21 @@ LEInteractor::interpolate(std::vector<double>& Q_data,
                 q_data,
                 patch,
                 interp_box,
-                interp_fcn);
+                kernel_fcn);
+}
+
+void
+LEInteractor::interpolate(std::vector<double>& Q_data,
+                          const int Q_depth,
+                          const std::vector<double>& X_data,
+                          const int X_depth,
+                          const Pointer<EdgeData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const std::string& interp_fcn)
+{
+    interpolate(Q_data, Q_depth, X_data, X_depth, q_data, patch, interp_box, getKernelFunctionType(interp_fcn));
+    return;
 }
 
 void
@@ -1978,7 +2783,7 @@ LEInteractor::interpolate(double* const Q_data,
                           const Pointer<CellData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
-                          const std::string& interp_fcn)
+                          const KernelFunctionType kernel_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -2027,7 +2832,7 @@ LEInteractor::interpolate(double* const Q_data,
                     patch_touches_upper_physical_bdry,
                     local_indices,
                     periodic_shifts,
-                    interp_fcn);
+                    kernel_fcn);
     }
     return;
 }
@@ -2039,11 +2844,28 @@ LEInteractor::interpolate(double* const Q_data,
                           const double* const X_data,
                           const int X_size,
                           const int X_depth,
-                          const Pointer<CellData<NDIM, double> > mask_data,
                           const Pointer<CellData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const std::string& interp_fcn)
+{
+    interpolate(
+        Q_data, Q_size, Q_depth, X_data, X_size, X_depth, q_data, patch, interp_box, getKernelFunctionType(interp_fcn));
+    return;
+}
+
+void
+LEInteractor::interpolate(double* const Q_data,
+                          const int Q_size,
+                          const int Q_depth,
+                          const double* const X_data,
+                          const int X_size,
+                          const int X_depth,
+                          const Pointer<CellData<NDIM, double> > mask_data,
+                          const Pointer<CellData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const KernelFunctionType kernel_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -2067,14 +2889,14 @@ LEInteractor::interpolate(double* const Q_data,
     // Get ghost cell width info.
     const IntVector<NDIM>& q_gcw = q_data->getGhostCellWidth();
     const IntVector<NDIM>& mask_gcw = q_data->getGhostCellWidth();
-    const int stencil_size = getStencilSize(interp_fcn);
-    const int min_ghosts = getMinimumGhostWidth(interp_fcn);
+    const int stencil_size = getStencilSize(kernel_fcn);
+    const int min_ghosts = getMinimumGhostWidth(kernel_fcn);
     const int q_gcw_min = q_gcw.min();
     const int mask_gcw_min = mask_gcw.min();
     if (q_gcw_min < min_ghosts)
     {
         TBOX_ERROR("LEInteractor::interpolate(): insufficient ghost cells for Eulerian field data:\n"
-                   << "  kernel function          = " << interp_fcn << "\n"
+                   << "  kernel function          = " << enum_to_string<KernelFunctionType>(kernel_fcn) << "\n"
                    << "  kernel stencil size      = " << stencil_size << "\n"
                    << "  minimum ghost cell width = " << min_ghosts << "\n"
                    << "  ghost cell width         = " << q_gcw_min << "\n");
@@ -2082,7 +2904,7 @@ LEInteractor::interpolate(double* const Q_data,
     if (mask_gcw_min < stencil_size)
     {
         TBOX_ERROR("LEInteractor::interpolate(): insufficient ghost cells for Eulerian mask data:\n"
-                   << "  kernel function          = " << interp_fcn << "\n"
+                   << "  kernel function          = " << enum_to_string<KernelFunctionType>(kernel_fcn) << "\n"
                    << "  kernel stencil size      = " << stencil_size << "\n"
                    << "  minimum ghost cell width = " << stencil_size << "\n"
                    << "  ghost cell width         = " << mask_gcw_min << "\n");
@@ -2116,8 +2938,7 @@ LEInteractor::interpolate(double* const Q_data,
         {
             int s = local_indices[k];
             MLSWeight Psi;
-            const int stencil_sz = LEInteractor::getStencilSize(interp_fcn);
-            get_mls_weights(interp_fcn,
+            get_mls_weights(kernel_fcn,
                             &X_data[s * NDIM],
                             &periodic_shifts[k * NDIM],
                             dx,
@@ -2130,7 +2951,7 @@ LEInteractor::interpolate(double* const Q_data,
 
             for (int comp = 0; comp < Q_depth; ++comp)
             {
-                interpolate_data(stencil_sz,
+                interpolate_data(stencil_size,
                                  ig_lower,
                                  ig_upper,
                                  stencil_lower,
@@ -2153,10 +2974,37 @@ LEInteractor::interpolate(double* const Q_data,
                           const double* const X_data,
                           const int X_size,
                           const int X_depth,
-                          const Pointer<NodeData<NDIM, double> > q_data,
+                          const Pointer<CellData<NDIM, double> > mask_data,
+                          const Pointer<CellData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const std::string& interp_fcn)
+{
+    interpolate(Q_data,
+                Q_size,
+                Q_depth,
+                X_data,
+                X_size,
+                X_depth,
+                mask_data,
+                q_data,
+                patch,
+                interp_box,
+                getKernelFunctionType(interp_fcn));
+    return;
+}
+
+void
+LEInteractor::interpolate(double* const Q_data,
+                          const int Q_size,
+                          const int Q_depth,
+                          const double* const X_data,
+                          const int X_size,
+                          const int X_depth,
+                          const Pointer<NodeData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const KernelFunctionType kernel_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -2211,11 +3059,28 @@ LEInteractor::interpolate(double* const Q_data,
                     patch_touches_upper_physical_bdry,
                     local_indices,
                     periodic_shifts,
-                    interp_fcn);
+                    kernel_fcn);
     }
     return;
 }
 
+void
+LEInteractor::interpolate(double* const Q_data,
+                          const int Q_size,
+                          const int Q_depth,
+                          const double* const X_data,
+                          const int X_size,
+                          const int X_depth,
+                          const Pointer<NodeData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const std::string& interp_fcn)
+{
+    interpolate(
+        Q_data, Q_size, Q_depth, X_data, X_size, X_depth, q_data, patch, interp_box, getKernelFunctionType(interp_fcn));
+    return;
+}
+
 void
 LEInteractor::interpolate(double* const Q_data,
                           const int Q_size,
@@ -2226,7 +3091,7 @@ LEInteractor::interpolate(double* const Q_data,
                           const Pointer<SideData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
-                          const std::string& interp_fcn)
+                          const KernelFunctionType kernel_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -2294,7 +3159,7 @@ LEInteractor::interpolate(double* const Q_data,
                         patch_touches_upper_physical_bdry,
                         local_indices,
                         periodic_shifts,
-                        interp_fcn,
+                        kernel_fcn,
                         axis);
             for (const auto& local_index : local_indices)
             {
@@ -2312,11 +3177,28 @@ LEInteractor::interpolate(double* const Q_data,
                           const double* const X_data,
                           const int X_size,
                           const int X_depth,
-                          const Pointer<SideData<NDIM, double> > mask_data,
                           const Pointer<SideData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const std::string& interp_fcn)
+{
+    interpolate(
+        Q_data, Q_size, Q_depth, X_data, X_size, X_depth, q_data, patch, interp_box, getKernelFunctionType(interp_fcn));
+    return;
+}
+
+void
+LEInteractor::interpolate(double* const Q_data,
+                          const int Q_size,
+                          const int Q_depth,
+                          const double* const X_data,
+                          const int X_size,
+                          const int X_depth,
+                          const Pointer<SideData<NDIM, double> > mask_data,
+                          const Pointer<SideData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const KernelFunctionType kernel_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -2341,14 +3223,14 @@ LEInteractor::interpolate(double* const Q_data,
     // Get ghost cell width info.
     const IntVector<NDIM>& q_gcw = q_data->getGhostCellWidth();
     const IntVector<NDIM>& mask_gcw = mask_data->getGhostCellWidth();
-    const int stencil_size = getStencilSize(interp_fcn);
-    const int min_ghosts = getMinimumGhostWidth(interp_fcn);
+    const int stencil_size = getStencilSize(kernel_fcn);
+    const int min_ghosts = getMinimumGhostWidth(kernel_fcn);
     const int q_gcw_min = q_gcw.min();
     const int mask_gcw_min = mask_gcw.min();
     if (q_gcw_min < min_ghosts)
     {
         TBOX_ERROR("LEInteractor::interpolate(): insufficient ghost cells for Eulerian field data:\n"
-                   << "  kernel function          = " << interp_fcn << "\n"
+                   << "  kernel function          = " << enum_to_string<KernelFunctionType>(kernel_fcn) << "\n"
                    << "  kernel stencil size      = " << stencil_size << "\n"
                    << "  minimum ghost cell width = " << min_ghosts << "\n"
                    << "  ghost cell width         = " << q_gcw_min << "\n");
@@ -2356,7 +3238,7 @@ LEInteractor::interpolate(double* const Q_data,
     if (mask_gcw_min < stencil_size)
     {
         TBOX_ERROR("LEInteractor::interpolate(): insufficient ghost cells for Eulerian mask data:\n"
-                   << "  kernel function          = " << interp_fcn << "\n"
+                   << "  kernel function          = " << enum_to_string<KernelFunctionType>(kernel_fcn) << "\n"
                    << "  kernel stencil size      = " << stencil_size << "\n"
                    << "  minimum ghost cell width = " << stencil_size << "\n"
                    << "  ghost cell width         = " << mask_gcw_min << "\n");
@@ -2404,8 +3286,7 @@ LEInteractor::interpolate(double* const Q_data,
             {
                 int s = local_indices[k];
                 MLSWeight Psi;
-                const int stencil_sz = LEInteractor::getStencilSize(interp_fcn);
-                get_mls_weights(interp_fcn,
+                get_mls_weights(kernel_fcn,
                                 &X_data[s * NDIM],
                                 &periodic_shifts[k * NDIM],
                                 dx,
@@ -2415,7 +3296,7 @@ LEInteractor::interpolate(double* const Q_data,
                                 stencil_lower,
                                 stencil_upper,
                                 Psi);
-                interpolate_data(stencil_sz,
+                interpolate_data(stencil_size,
                                  ig_lower,
                                  ig_upper,
                                  stencil_lower,
@@ -2438,10 +3319,37 @@ LEInteractor::interpolate(double* const Q_data,
                           const double* const X_data,
                           const int X_size,
                           const int X_depth,
-                          const Pointer<EdgeData<NDIM, double> > q_data,
+                          const Pointer<SideData<NDIM, double> > mask_data,
+                          const Pointer<SideData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const std::string& interp_fcn)
+{
+    interpolate(Q_data,
+                Q_size,
+                Q_depth,
+                X_data,
+                X_size,
+                X_depth,
+                mask_data,
+                q_data,
+                patch,
+                interp_box,
+                getKernelFunctionType(interp_fcn));
+    return;
+}
+
+void
+LEInteractor::interpolate(double* const Q_data,
+                          const int Q_size,
+                          const int Q_depth,
+                          const double* const X_data,
+                          const int X_size,
+                          const int X_depth,
+                          const Pointer<EdgeData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const KernelFunctionType kernel_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -2512,7 +3420,7 @@ LEInteractor::interpolate(double* const Q_data,
                         patch_touches_upper_physical_bdry,
                         local_indices,
                         periodic_shifts,
-                        interp_fcn,
+                        kernel_fcn,
                         axis);
             for (const auto& local_index : local_indices)
             {
@@ -2523,6 +3431,23 @@ LEInteractor::interpolate(double* const Q_data,
     return;
 }
 
+void
+LEInteractor::interpolate(double* const Q_data,
+                          const int Q_size,
+                          const int Q_depth,
+                          const double* const X_data,
+                          const int X_size,
+                          const int X_depth,
+                          const Pointer<EdgeData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const std::string& interp_fcn)
+{
+    interpolate(
+        Q_data, Q_size, Q_depth, X_data, X_size, X_depth, q_data, patch, interp_box, getKernelFunctionType(interp_fcn));
+    return;
+}
+
 template <class T>
 void
 LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
@@ -2532,7 +3457,7 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
                      const IntVector<NDIM>& periodic_shift,
-                     const std::string& spread_fcn)
+                     const KernelFunctionType kernel_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(Q_data);
@@ -2543,24 +3468,24 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
     TBOX_ASSERT(Q_data->getDepth() == static_cast<unsigned int>(q_data->getDepth()));
     TBOX_ASSERT(X_data->getDepth() == NDIM);
 #endif
+    const LData::ReadAccess Q_access(*Q_data);
+    const LData::ReadAccess X_access(*X_data);
     spread(q_data,
-           Q_data->getGhostedLocalFormVecArray()->data(),
+           Q_access.data(),
            Q_data->getDepth(),
-           X_data->getGhostedLocalFormVecArray()->data(),
+           X_access.data(),
            X_data->getDepth(),
            idx_data,
            patch,
            spread_box,
            periodic_shift,
-           spread_fcn);
-    Q_data->restoreArrays();
-    X_data->restoreArrays();
+           kernel_fcn);
     return;
 }
 
 template <class T>
 void
-LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
+LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
                      const Pointer<LData> Q_data,
                      const Pointer<LData> X_data,
                      const Pointer<LIndexSetData<T> > idx_data,
@@ -2568,6 +3493,21 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
                      const Box<NDIM>& spread_box,
                      const IntVector<NDIM>& periodic_shift,
                      const std::string& spread_fcn)
+{
+    spread(q_data, Q_data, X_data, idx_data, patch, spread_box, periodic_shift, getKernelFunctionType(spread_fcn));
+    return;
+}
+
+template <class T>
+void
+LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
+                     const Pointer<LData> Q_data,
+                     const Pointer<LData> X_data,
+                     const Pointer<LIndexSetData<T> > idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const KernelFunctionType kernel_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(Q_data);
@@ -2578,24 +3518,24 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
     TBOX_ASSERT(Q_data->getDepth() == static_cast<unsigned int>(q_data->getDepth()));
     TBOX_ASSERT(X_data->getDepth() == NDIM);
 #endif
+    const LData::ReadAccess Q_access(*Q_data);
+    const LData::ReadAccess X_access(*X_data);
     spread(q_data,
-           Q_data->getGhostedLocalFormVecArray()->data(),
+           Q_access.data(),
            Q_data->getDepth(),
-           X_data->getGhostedLocalFormVecArray()->data(),
+           X_access.data(),
            X_data->getDepth(),
            idx_data,
            patch,
            spread_box,
            periodic_shift,
-           spread_fcn);
-    Q_data->restoreArrays();
-    X_data->restoreArrays();
+           kernel_fcn);
     return;
 }
 
 template <class T>
 void
-LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
+LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
                      const Pointer<LData> Q_data,
                      const Pointer<LData> X_data,
                      const Pointer<LIndexSetData<T> > idx_data,
@@ -2603,6 +3543,21 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
                      const Box<NDIM>& spread_box,
                      const IntVector<NDIM>& periodic_shift,
                      const std::string& spread_fcn)
+{
+    spread(q_data, Q_data, X_data, idx_data, patch, spread_box, periodic_shift, getKernelFunctionType(spread_fcn));
+    return;
+}
+
+template <class T>
+void
+LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
+                     const Pointer<LData> Q_data,
+                     const Pointer<LData> X_data,
+                     const Pointer<LIndexSetData<T> > idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const KernelFunctionType kernel_fcn)
 {
     if (Q_data->getDepth() != NDIM || q_data->getDepth() != 1)
     {
@@ -2619,24 +3574,24 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
     TBOX_ASSERT(Q_data->getDepth() == NDIM);
     TBOX_ASSERT(X_data->getDepth() == NDIM);
 #endif
+    const LData::ReadAccess Q_access(*Q_data);
+    const LData::ReadAccess X_access(*X_data);
     spread(q_data,
-           Q_data->getGhostedLocalFormVecArray()->data(),
+           Q_access.data(),
            Q_data->getDepth(),
-           X_data->getGhostedLocalFormVecArray()->data(),
+           X_access.data(),
            X_data->getDepth(),
            idx_data,
            patch,
            spread_box,
            periodic_shift,
-           spread_fcn);
-    Q_data->restoreArrays();
-    X_data->restoreArrays();
+           kernel_fcn);
     return;
 }
 
 template <class T>
 void
-LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
+LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
                      const Pointer<LData> Q_data,
                      const Pointer<LData> X_data,
                      const Pointer<LIndexSetData<T> > idx_data,
@@ -2644,6 +3599,21 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
                      const Box<NDIM>& spread_box,
                      const IntVector<NDIM>& periodic_shift,
                      const std::string& spread_fcn)
+{
+    spread(q_data, Q_data, X_data, idx_data, patch, spread_box, periodic_shift, getKernelFunctionType(spread_fcn));
+    return;
+}
+
+template <class T>
+void
+LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
+                     const Pointer<LData> Q_data,
+                     const Pointer<LData> X_data,
+                     const Pointer<LIndexSetData<T> > idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const KernelFunctionType kernel_fcn)
 {
     if (NDIM != 3 || Q_data->getDepth() != NDIM || q_data->getDepth() != 1)
     {
@@ -2660,18 +3630,33 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
     TBOX_ASSERT(Q_data->getDepth() == NDIM);
     TBOX_ASSERT(X_data->getDepth() == NDIM);
 #endif
+    const LData::ReadAccess Q_access(*Q_data);
+    const LData::ReadAccess X_access(*X_data);
     spread(q_data,
-           Q_data->getGhostedLocalFormVecArray()->data(),
+           Q_access.data(),
            Q_data->getDepth(),
-           X_data->getGhostedLocalFormVecArray()->data(),
+           X_access.data(),
            X_data->getDepth(),
            idx_data,
            patch,
            spread_box,
            periodic_shift,
-           spread_fcn);
-    Q_data->restoreArrays();
-    X_data->restoreArrays();
+           kernel_fcn);
+    return;
+}
+
+template <class T>
+void
+LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
+                     const Pointer<LData> Q_data,
+                     const Pointer<LData> X_data,
+                     const Pointer<LIndexSetData<T> > idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const std::string& spread_fcn)
+{
+    spread(q_data, Q_data, X_data, idx_data, patch, spread_box, periodic_shift, getKernelFunctionType(spread_fcn));
     return;
 }
 
@@ -2686,7 +3671,7 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
                      const IntVector<NDIM>& periodic_shift,
-                     const std::string& spread_fcn)
+                     const KernelFunctionType kernel_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -2712,10 +3697,14 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
         patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
     }
 
-    // Generate a list of local indices which lie in the specified box.
-    std::vector<int> local_indices;
-    std::vector<double> periodic_shifts;
-    buildLocalIndices(local_indices, periodic_shifts, spread_box, patch, periodic_shift, idx_data);
+    // Generate a list of local indices which lie in the specified box.  The
+    // lists cached by idx_data are used without copying whenever possible.
+    std::vector<int> local_indices_buf;
+    std::vector<double> periodic_shifts_buf;
+    const auto cached_indices =
+        getLocalIndices(local_indices_buf, periodic_shifts_buf, spread_box, patch, periodic_shift, idx_data);
+    const std::vector<int>& local_indices = *cached_indices.first;
+    const std::vector<double>& periodic_shifts = *cached_indices.second;
 
     // Spread.
     if (!local_indices.empty())
@@ -2734,14 +3723,14 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
                patch_touches_upper_physical_bdry,
                local_indices,
                periodic_shifts,
-               spread_fcn);
+               kernel_fcn);
     }
     return;
 }
 
 template <class T>
 void
-LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
+LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
                      const double* const Q_data,
                      const int Q_depth,
                      const double* const X_data,
@@ -2751,6 +3740,32 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
                      const Box<NDIM>& spread_box,
                      const IntVector<NDIM>& periodic_shift,
                      const std::string& spread_fcn)
+{
+    spread(q_data,
+           Q_data,
+           Q_depth,
+           X_data,
+           X_depth,
+           idx_data,
+           patch,
+           spread_box,
+           periodic_shift,
+           getKernelFunctionType(spread_fcn));
+    return;
+}
+
+template <class T>
+void
+LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_depth,
+                     const Pointer<LIndexSetData<T> > idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const KernelFunctionType kernel_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -2776,10 +3791,14 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
         patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
     }
 
-    // Generate a list of local indices which lie in the specified box.
-    std::vector<int> local_indices;
-    std::vector<double> periodic_shifts;
-    buildLocalIndices(local_indices, periodic_shifts, spread_box, patch, periodic_shift, idx_data);
+    // Generate a list of local indices which lie in the specified box.  The
+    // lists cached by idx_data are used without copying whenever possible.
+    std::vector<int> local_indices_buf;
+    std::vector<double> periodic_shifts_buf;
+    const auto cached_indices =
+        getLocalIndices(local_indices_buf, periodic_shifts_buf, spread_box, patch, periodic_shift, idx_data);
+    const std::vector<int>& local_indices = *cached_indices.first;
+    const std::vector<double>& periodic_shifts = *cached_indices.second;
 
     // Spread.
     if (!local_indices.empty())
@@ -2804,14 +3823,14 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
                patch_touches_upper_physical_bdry,
                local_indices,
                periodic_shifts,
-               spread_fcn);
+               kernel_fcn);
     }
     return;
 }
 
 template <class T>
 void
-LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
+LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
                      const double* const Q_data,
                      const int Q_depth,
                      const double* const X_data,
@@ -2821,6 +3840,32 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
                      const Box<NDIM>& spread_box,
                      const IntVector<NDIM>& periodic_shift,
                      const std::string& spread_fcn)
+{
+    spread(q_data,
+           Q_data,
+           Q_depth,
+           X_data,
+           X_depth,
+           idx_data,
+           patch,
+           spread_box,
+           periodic_shift,
+           getKernelFunctionType(spread_fcn));
+    return;
+}
+
+template <class T>
+void
+LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_depth,
+                     const Pointer<LIndexSetData<T> > idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const KernelFunctionType kernel_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -2853,10 +3898,14 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
         patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
     }
 
-    // Generate a list of local indices which lie in the specified box.
-    std::vector<int> local_indices;
-    std::vector<double> periodic_shifts;
-    buildLocalIndices(local_indices, periodic_shifts, spread_box, patch, periodic_shift, idx_data);
+    // Generate a list of local indices which lie in the specified box.  The
+    // lists cached by idx_data are used without copying whenever possible.
+    std::vector<int> local_indices_buf;
+    std::vector<double> periodic_shifts_buf;
+    const auto cached_indices =
+        getLocalIndices(local_indices_buf, periodic_shifts_buf, spread_box, patch, periodic_shift, idx_data);
+    const std::vector<int>& local_indices = *cached_indices.first;
+    const std::vector<double>& periodic_shifts = *cached_indices.second;
 
     // Spread.
     if (!local_indices.empty())
@@ -2891,7 +3940,7 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
                    patch_touches_upper_physical_bdry,
                    local_indices,
                    periodic_shifts,
-                   spread_fcn,
+                   kernel_fcn,
                    axis);
         }
     }
@@ -2900,7 +3949,7 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
 
 template <class T>
 void
-LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
+LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
                      const double* const Q_data,
                      const int Q_depth,
                      const double* const X_data,
@@ -2910,6 +3959,32 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
                      const Box<NDIM>& spread_box,
                      const IntVector<NDIM>& periodic_shift,
                      const std::string& spread_fcn)
+{
+    spread(q_data,
+           Q_data,
+           Q_depth,
+           X_data,
+           X_depth,
+           idx_data,
+           patch,
+           spread_box,
+           periodic_shift,
+           getKernelFunctionType(spread_fcn));
+    return;
+}
+
+template <class T>
+void
+LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_depth,
+                     const Pointer<LIndexSetData<T> > idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const KernelFunctionType kernel_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -2942,10 +4017,14 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
         patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
     }
 
-    // Generate a list of local indices which lie in the specified box.
-    std::vector<int> local_indices;
-    std::vector<double> periodic_shifts;
-    buildLocalIndices(local_indices, periodic_shifts, spread_box, patch, periodic_shift, idx_data);
+    // Generate a list of local indices which lie in the specified box.  The
+    // lists cached by idx_data are used without copying whenever possible.
+    std::vector<int> local_indices_buf;
+    std::vector<double> periodic_shifts_buf;
+    const auto cached_indices =
+        getLocalIndices(local_indices_buf, periodic_shifts_buf, spread_box, patch, periodic_shift, idx_data);
+    const std::vector<int>& local_indices = *cached_indices.first;
+    const std::vector<double>& periodic_shifts = *cached_indices.second;
 
     // Spread.
     if (!local_indices.empty())
@@ -2983,13 +4062,39 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
                    patch_touches_upper_physical_bdry,
                    local_indices,
                    periodic_shifts,
-                   spread_fcn,
+                   kernel_fcn,
                    axis);
         }
     }
     return;
 }
 
+template <class T>
+void
+LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_depth,
+                     const Pointer<LIndexSetData<T> > idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const std::string& spread_fcn)
+{
+    spread(q_data,
+           Q_data,
+           Q_depth,
+           X_data,
+           X_depth,
+           idx_data,
+           patch,
+           spread_box,
+           periodic_shift,
+           getKernelFunctionType(spread_fcn));
+    return;
+}
+
 void
 LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
                      const std::vector<double>& Q_data,
@@ -2998,7 +4103,7 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
                      const int X_depth,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
+                     const KernelFunctionType kernel_fcn)
 {
     if (Q_data.empty()) return;
     spread(q_data,
@@ -3010,7 +4115,46 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
            X_depth,
            patch,
            spread_box,
-           spread_fcn);
+           kernel_fcn);
+}
+
+void
+LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
+                     const std::vector<double>& Q_data,
+                     const int Q_depth,
+                     const std::vector<double>& X_data,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const std::string& spread_fcn)
+{
+    spread(q_data, Q_data, Q_depth, X_data, X_depth, patch, spread_box, getKernelFunctionType(spread_fcn));
+    return;
+}
+
+void
+LEInteractor::spread(Pointer<CellData<NDIM, double> > mask_data,
+                     Pointer<CellData<NDIM, double> > q_data,
+                     const std::vector<double>& Q_data,
+                     const int Q_depth,
+                     const std::vector<double>& X_data,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const KernelFunctionType kernel_fcn)
+{
+    if (Q_data.empty()) return;
+    spread(mask_data,
+           q_data,
+           &Q_data[0],
+           static_cast<int>(Q_data.size()),
+           Q_depth,
+           &X_data[0],
+           static_cast<int>(X_data.size()),
+           X_depth,
+           patch,
+           spread_box,
+           kernel_fcn);
 }
 
 void
@@ -3023,10 +4167,23 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > mask_data,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
                      const std::string& spread_fcn)
+{
+    spread(mask_data, q_data, Q_data, Q_depth, X_data, X_depth, patch, spread_box, getKernelFunctionType(spread_fcn));
+    return;
+}
+
+void
+LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
+                     const std::vector<double>& Q_data,
+                     const int Q_depth,
+                     const std::vector<double>& X_data,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const KernelFunctionType kernel_fcn)
 {
     if (Q_data.empty()) return;
-    spread(mask_data,
-           q_data,
+    spread(q_data,
            &Q_data[0],
            static_cast<int>(Q_data.size()),
            Q_depth,
@@ -3035,7 +4192,7 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > mask_data,
            X_depth,
            patch,
            spread_box,
-           spread_fcn);
+           kernel_fcn);
 }
 
 void
@@ -3047,6 +4204,20 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
                      const std::string& spread_fcn)
+{
+    spread(q_data, Q_data, Q_depth, X_data, X_depth, patch, spread_box, getKernelFunctionType(spread_fcn));
+    return;
+}
+
+void
+LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
+                     const std::vector<double>& Q_data,
+                     const int Q_depth,
+                     const std::vector<double>& X_data,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const KernelFunctionType kernel_fcn)
 {
     if (Q_data.empty()) return;
     spread(q_data,
@@ -3058,7 +4229,7 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
            X_depth,
            patch,
            spread_box,
-           spread_fcn);
+           kernel_fcn);
 }
 
 void
@@ -3071,17 +4242,8 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
                      const Box<NDIM>& spread_box,
                      const std::string& spread_fcn)
 {
-    if (Q_data.empty()) return;
-    spread(q_data,
-           &Q_data[0],
-           static_cast<int>(Q_data.size()),
-           Q_depth,
-           &X_data[0],
-           static_cast<int>(X_data.size()),
-           X_depth,
-           patch,
-           spread_box,
-           spread_fcn);
+    spread(q_data, Q_data, Q_depth, X_data, X_depth, patch, spread_box, getKernelFunctionType(spread_fcn));
+    return;
 }
 
 void
@@ -3093,7 +4255,7 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > mask_data,
                      const int X_depth,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
+                     const KernelFunctionType kernel_fcn)
 {
     if (Q_data.empty()) return;
     spread(mask_data,
@@ -3106,11 +4268,12 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > mask_data,
            X_depth,
            patch,
            spread_box,
-           spread_fcn);
+           kernel_fcn);
 }
 
 void
-LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
+LEInteractor::spread(Pointer<SideData<NDIM, double> > mask_data,
+                     Pointer<SideData<NDIM, double> > q_data,
                      const std::vector<double>& Q_data,
                      const int Q_depth,
                      const std::vector<double>& X_data,
@@ -3118,6 +4281,20 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
                      const std::string& spread_fcn)
+{
+    spread(mask_data, q_data, Q_data, Q_depth, X_data, X_depth, patch, spread_box, getKernelFunctionType(spread_fcn));
+    return;
+}
+
+void
+LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
+                     const std::vector<double>& Q_data,
+                     const int Q_depth,
+                     const std::vector<double>& X_data,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const KernelFunctionType kernel_fcn)
 {
     if (Q_data.empty()) return;
     spread(q_data,
@@ -3129,7 +4306,21 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
            X_depth,
            patch,
            spread_box,
-           spread_fcn);
+           kernel_fcn);
+}
+
+void
+LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
+                     const std::vector<double>& Q_data,
+                     const int Q_depth,
+                     const std::vector<double>& X_data,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const std::string& spread_fcn)
+{
+    spread(q_data, Q_data, Q_depth, X_data, X_depth, patch, spread_box, getKernelFunctionType(spread_fcn));
+    return;
 }
 
 void
@@ -3142,7 +4333,7 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
                      const int X_depth,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
+                     const KernelFunctionType kernel_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -3191,11 +4382,28 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
                patch_touches_upper_physical_bdry,
                local_indices,
                periodic_shifts,
-               spread_fcn);
+               kernel_fcn);
     }
     return;
 }
 
+void
+LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int Q_size,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_size,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const std::string& spread_fcn)
+{
+    spread(
+        q_data, Q_data, Q_size, Q_depth, X_data, X_size, X_depth, patch, spread_box, getKernelFunctionType(spread_fcn));
+    return;
+}
+
 void
 LEInteractor::spread(Pointer<CellData<NDIM, double> > mask_data,
                      Pointer<CellData<NDIM, double> > q_data,
@@ -3207,7 +4415,7 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > mask_data,
                      const int X_depth,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
+                     const KernelFunctionType kernel_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -3231,14 +4439,14 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > mask_data,
     // Get ghost cell width info.
     const IntVector<NDIM>& q_gcw = q_data->getGhostCellWidth();
     const IntVector<NDIM>& mask_gcw = mask_data->getGhostCellWidth();
-    const int stencil_size = getStencilSize(spread_fcn);
-    const int min_ghosts = getMinimumGhostWidth(spread_fcn);
+    const int stencil_size = getStencilSize(kernel_fcn);
+    const int min_ghosts = getMinimumGhostWidth(kernel_fcn);
     const int q_gcw_min = q_gcw.min();
     const int mask_gcw_min = mask_gcw.min();
     if (q_gcw_min < min_ghosts)
     {
         TBOX_ERROR("LEInteractor::spread(): insufficient ghost cells for Eulerian field data:\n"
-                   << "  kernel function          = " << spread_fcn << "\n"
+                   << "  kernel function          = " << enum_to_string<KernelFunctionType>(kernel_fcn) << "\n"
                    << "  kernel stencil size      = " << stencil_size << "\n"
                    << "  minimum ghost cell width = " << min_ghosts << "\n"
                    << "  ghost cell width         = " << q_gcw_min << "\n");
@@ -3246,7 +4454,7 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > mask_data,
     if (mask_gcw_min < stencil_size)
     {
         TBOX_ERROR("LEInteractor::spread(): insufficient ghost cells for Eulerian mask data:\n"
-                   << "  kernel function          = " << spread_fcn << "\n"
+                   << "  kernel function          = " << enum_to_string<KernelFunctionType>(kernel_fcn) << "\n"
                    << "  kernel stencil size      = " << stencil_size << "\n"
                    << "  minimum ghost cell width = " << stencil_size << "\n"
                    << "  ghost cell width         = " << mask_gcw_min << "\n");
@@ -3280,8 +4488,7 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > mask_data,
         {
             int s = local_indices[k];
             MLSWeight Psi;
-            const int stencil_sz = LEInteractor::getStencilSize(spread_fcn);
-            get_mls_weights(spread_fcn,
+            get_mls_weights(kernel_fcn,
                             &X_data[s * NDIM],
                             &periodic_shifts[k * NDIM],
                             dx,
@@ -3294,7 +4501,7 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > mask_data,
 
             for (int comp = 0; comp < Q_depth; ++comp)
             {
-                spread_data(stencil_sz,
+                spread_data(stencil_size,
                             ig_lower,
                             ig_upper,
                             stencil_lower,
@@ -3312,7 +4519,8 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > mask_data,
 }
 
 void
-LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
+LEInteractor::spread(Pointer<CellData<NDIM, double> > mask_data,
+                     Pointer<CellData<NDIM, double> > q_data,
                      const double* const Q_data,
                      const int Q_size,
                      const int Q_depth,
@@ -3322,6 +4530,32 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
                      const std::string& spread_fcn)
+{
+    spread(mask_data,
+           q_data,
+           Q_data,
+           Q_size,
+           Q_depth,
+           X_data,
+           X_size,
+           X_depth,
+           patch,
+           spread_box,
+           getKernelFunctionType(spread_fcn));
+    return;
+}
+
+void
+LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int Q_size,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_size,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const KernelFunctionType kernel_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -3376,11 +4610,28 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
                patch_touches_upper_physical_bdry,
                local_indices,
                periodic_shifts,
-               spread_fcn);
+               kernel_fcn);
     }
     return;
 }
 
+void
+LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int Q_size,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_size,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const std::string& spread_fcn)
+{
+    spread(
+        q_data, Q_data, Q_size, Q_depth, X_data, X_size, X_depth, patch, spread_box, getKernelFunctionType(spread_fcn));
+    return;
+}
+
 void
 LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
                      const double* const Q_data,
@@ -3391,7 +4642,7 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
                      const int X_depth,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
+                     const KernelFunctionType kernel_fcn)
 {
     if (Q_depth != NDIM || q_data->getDepth() != 1)
     {
@@ -3458,13 +4709,30 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
                    patch_touches_upper_physical_bdry,
                    local_indices,
                    periodic_shifts,
-                   spread_fcn,
+                   kernel_fcn,
                    axis);
         }
     }
     return;
 }
 
+void
+LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int Q_size,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_size,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const std::string& spread_fcn)
+{
+    spread(
+        q_data, Q_data, Q_size, Q_depth, X_data, X_size, X_depth, patch, spread_box, getKernelFunctionType(spread_fcn));
+    return;
+}
+
 void
 LEInteractor::spread(Pointer<SideData<NDIM, double> > mask_data,
                      Pointer<SideData<NDIM, double> > q_data,
@@ -3476,7 +4744,7 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > mask_data,
                      const int X_depth,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
+                     const KernelFunctionType kernel_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -3500,14 +4768,14 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > mask_data,
     // Get ghost cell width info.
     const IntVector<NDIM>& q_gcw = q_data->getGhostCellWidth();
     const IntVector<NDIM>& mask_gcw = mask_data->getGhostCellWidth();
-    const int stencil_size = getStencilSize(spread_fcn);
-    const int min_ghosts = getMinimumGhostWidth(spread_fcn);
+    const int stencil_size = getStencilSize(kernel_fcn);
+    const int min_ghosts = getMinimumGhostWidth(kernel_fcn);
     const int q_gcw_min = q_gcw.min();
     const int mask_gcw_min = mask_gcw.min();
     if (q_gcw_min < min_ghosts)
     {
         TBOX_ERROR("LEInteractor::interpolate(): insufficient ghost cells for Eulerian field data:"
-                   << "  kernel function          = " << spread_fcn << "\n"
+                   << "  kernel function          = " << enum_to_string<KernelFunctionType>(kernel_fcn) << "\n"
                    << "  kernel stencil size      = " << stencil_size << "\n"
                    << "  minimum ghost cell width = " << min_ghosts << "\n"
                    << "  ghost cell width         = " << q_gcw_min << "\n");
@@ -3515,7 +4783,7 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > mask_data,
     if (mask_gcw_min < stencil_size)
     {
         TBOX_ERROR("LEInteractor::interpolate(): insufficient ghost cells for Eulerian mask data:"
-                   << "  kernel function          = " << spread_fcn << "\n"
+                   << "  kernel function          = " << enum_to_string<KernelFunctionType>(kernel_fcn) << "\n"
                    << "  kernel stencil size      = " << stencil_size << "\n"
                    << "  minimum ghost cell width = " << stencil_size << "\n"
                    << "  ghost cell width         = " << mask_gcw_min << "\n");
@@ -3562,8 +4830,7 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > mask_data,
             {
                 int s = local_indices[k];
                 MLSWeight Psi;
-                const int stencil_sz = LEInteractor::getStencilSize(spread_fcn);
-                get_mls_weights(spread_fcn,
+                get_mls_weights(kernel_fcn,
                                 &X_data[s * NDIM],
                                 &periodic_shifts[k * NDIM],
                                 dx,
@@ -3573,7 +4840,7 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > mask_data,
                                 stencil_lower,
                                 stencil_upper,
                                 Psi);
-                spread_data(stencil_sz,
+                spread_data(stencil_size,
                             ig_lower,
                             ig_upper,
                             stencil_lower,
@@ -3589,6 +4856,33 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > mask_data,
     return;
 }
 
+void
+LEInteractor::spread(Pointer<SideData<NDIM, double> > mask_data,
+                     Pointer<SideData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int Q_size,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_size,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const std::string& spread_fcn)
+{
+    spread(mask_data,
+           q_data,
+           Q_data,
+           Q_size,
+           Q_depth,
+           X_data,
+           X_size,
+           X_depth,
+           patch,
+           spread_box,
+           getKernelFunctionType(spread_fcn));
+    return;
+}
+
 void
 LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
                      const double* const Q_data,
@@ -3599,7 +4893,7 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
                      const int X_depth,
                      const Pointer<Patch<NDIM> > patch,
                      const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
+                     const KernelFunctionType kernel_fcn)
 {
     if (NDIM != 3 || Q_depth != NDIM || q_data->getDepth() != 1)
     {
@@ -3669,13 +4963,30 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
                    patch_touches_upper_physical_bdry,
                    local_indices,
                    periodic_shifts,
-                   spread_fcn,
+                   kernel_fcn,
                    axis);
         }
     }
     return;
 }
 
+void
+LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int Q_size,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_size,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const std::string& spread_fcn)
+{
+    spread(
+        q_data, Q_data, Q_size, Q_depth, X_data, X_size, X_depth, patch, spread_box, getKernelFunctionType(spread_fcn));
+    return;
+}
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -3695,16 +5006,17 @@ LEInteractor::interpolate(double* const Q_data,
                           const std::array<int, NDIM>& /*patch_touches_upper_physical_bdry*/,
                           const std::vector<int>& local_indices,
                           const std::vector<double>& periodic_shifts,
-                          const std::string& interp_fcn,
+                          const KernelFunctionType kernel_fcn,
                           const int axis)
 {
-    const int stencil_size = getStencilSize(interp_fcn);
-    const int min_ghosts = getMinimumGhostWidth(interp_fcn);
+    IBTK_PROFILING_REGION("LEInteractor::interpolate");
+    const int stencil_size = getStencilSize(kernel_fcn);
+    const int min_ghosts = getMinimumGhostWidth(kernel_fcn);
     const int q_gcw_min = q_gcw.min();
     if (q_gcw_min < min_ghosts)
     {
         TBOX_ERROR("LEInteractor::interpolate(): insufficient ghost cells:"
-                   << "  kernel function          = " << interp_fcn << "\n"
+                   << "  kernel function          = " << enum_to_string<KernelFunctionType>(kernel_fcn) << "\n"
                    << "  kernel stencil size      = " << stencil_size << "\n"
                    << "  minimum ghost cell width = " << min_ghosts << "\n"
                    << "  ghost cell width         = " << q_gcw_min << "\n");
@@ -3713,40 +5025,9 @@ LEInteractor::interpolate(double* const Q_data,
     const int local_indices_size = static_cast<int>(local_indices.size());
     const IntVector<NDIM>& ilower = q_data_box.lower();
     const IntVector<NDIM>& iupper = q_data_box.upper();
-    if (interp_fcn == "PIECEWISE_CONSTANT")
-    {
-        LAGRANGIAN_PIECEWISE_CONSTANT_INTERP_FC(dx,
-                                                x_lower,
-                                                x_upper,
-                                                q_depth,
-#if (NDIM == 2)
-                                                ilower(0),
-                                                iupper(0),
-                                                ilower(1),
-                                                iupper(1),
-                                                q_gcw(0),
-                                                q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                                ilower(0),
-                                                iupper(0),
-                                                ilower(1),
-                                                iupper(1),
-                                                ilower(2),
-                                                iupper(2),
-                                                q_gcw(0),
-                                                q_gcw(1),
-                                                q_gcw(2),
-#endif
-                                                q_data,
-                                                &local_indices[0],
-                                                &periodic_shifts[0],
-                                                local_indices_size,
-                                                X_data,
-                                                Q_data);
-    }
-    else if (interp_fcn == "DISCONTINUOUS_LINEAR")
+    switch (kernel_fcn)
     {
+    case DISCONTINUOUS_LINEAR_KERNEL:
         LAGRANGIAN_DISCONTINUOUS_LINEAR_INTERP_FC(dx,
                                                   x_lower,
                                                   x_upper,
@@ -3777,361 +5058,8 @@ LEInteractor::interpolate(double* const Q_data,
                                                   local_indices_size,
                                                   X_data,
                                                   Q_data);
-    }
-    else if (interp_fcn == "PIECEWISE_LINEAR")
-    {
-        LAGRANGIAN_PIECEWISE_LINEAR_INTERP_FC(dx,
-                                              x_lower,
-                                              x_upper,
-                                              q_depth,
-#if (NDIM == 2)
-                                              ilower(0),
-                                              iupper(0),
-                                              ilower(1),
-                                              iupper(1),
-                                              q_gcw(0),
-                                              q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                              ilower(0),
-                                              iupper(0),
-                                              ilower(1),
-                                              iupper(1),
-                                              ilower(2),
-                                              iupper(2),
-                                              q_gcw(0),
-                                              q_gcw(1),
-                                              q_gcw(2),
-#endif
-                                              q_data,
-                                              &local_indices[0],
-                                              &periodic_shifts[0],
-                                              local_indices_size,
-                                              X_data,
-                                              Q_data);
-    }
-    else if (interp_fcn == "PIECEWISE_CUBIC")
-    {
-        LAGRANGIAN_PIECEWISE_CUBIC_INTERP_FC(dx,
-                                             x_lower,
-                                             x_upper,
-                                             q_depth,
-#if (NDIM == 2)
-                                             ilower(0),
-                                             iupper(0),
-                                             ilower(1),
-                                             iupper(1),
-                                             q_gcw(0),
-                                             q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                             ilower(0),
-                                             iupper(0),
-                                             ilower(1),
-                                             iupper(1),
-                                             ilower(2),
-                                             iupper(2),
-                                             q_gcw(0),
-                                             q_gcw(1),
-                                             q_gcw(2),
-#endif
-                                             q_data,
-                                             &local_indices[0],
-                                             &periodic_shifts[0],
-                                             local_indices_size,
-                                             X_data,
-                                             Q_data);
-    }
-    else if (interp_fcn == "IB_3")
-    {
-        LAGRANGIAN_IB_3_INTERP_FC(dx,
-                                  x_lower,
-                                  x_upper,
-                                  q_depth,
-#if (NDIM == 2)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  q_gcw(0),
-                                  q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  ilower(2),
-                                  iupper(2),
-                                  q_gcw(0),
-                                  q_gcw(1),
-                                  q_gcw(2),
-#endif
-                                  q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
-                                  X_data,
-                                  Q_data);
-    }
-    else if (interp_fcn == "IB_4")
-    {
-        LAGRANGIAN_IB_4_INTERP_FC(dx,
-                                  x_lower,
-                                  x_upper,
-                                  q_depth,
-#if (NDIM == 2)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  q_gcw(0),
-                                  q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  ilower(2),
-                                  iupper(2),
-                                  q_gcw(0),
-                                  q_gcw(1),
-                                  q_gcw(2),
-#endif
-                                  q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
-                                  X_data,
-                                  Q_data);
-    }
-    else if (interp_fcn == "IB_4_W8")
-    {
-        LAGRANGIAN_IB_4_W8_INTERP_FC(dx,
-                                     x_lower,
-                                     x_upper,
-                                     q_depth,
-#if (NDIM == 2)
-                                     ilower(0),
-                                     iupper(0),
-                                     ilower(1),
-                                     iupper(1),
-                                     q_gcw(0),
-                                     q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                     ilower(0),
-                                     iupper(0),
-                                     ilower(1),
-                                     iupper(1),
-                                     ilower(2),
-                                     iupper(2),
-                                     q_gcw(0),
-                                     q_gcw(1),
-                                     q_gcw(2),
-#endif
-                                     q_data,
-                                     &local_indices[0],
-                                     &periodic_shifts[0],
-                                     local_indices_size,
-                                     X_data,
-                                     Q_data);
-    }
-    else if (interp_fcn == "IB_5")
-    {
-        LAGRANGIAN_IB_5_INTERP_FC(dx,
-                                  x_lower,
-                                  x_upper,
-                                  q_depth,
-#if (NDIM == 2)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  q_gcw(0),
-                                  q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  ilower(2),
-                                  iupper(2),
-                                  q_gcw(0),
-                                  q_gcw(1),
-                                  q_gcw(2),
-#endif
-                                  q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
-                                  X_data,
-                                  Q_data);
-    }
-    else if (interp_fcn == "IB_6")
-    {
-        LAGRANGIAN_IB_6_INTERP_FC(dx,
-                                  x_lower,
-                                  x_upper,
-                                  q_depth,
-#if (NDIM == 2)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  q_gcw(0),
-                                  q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  ilower(2),
-                                  iupper(2),
-                                  q_gcw(0),
-                                  q_gcw(1),
-                                  q_gcw(2),
-#endif
-                                  q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
-                                  X_data,
-                                  Q_data);
-    }
-    else if (interp_fcn == "BSPLINE_3")
-    {
-        LAGRANGIAN_BSPLINE_3_INTERP_FC(dx,
-                                       x_lower,
-                                       x_upper,
-                                       q_depth,
-#if (NDIM == 2)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       q_gcw(0),
-                                       q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       ilower(2),
-                                       iupper(2),
-                                       q_gcw(0),
-                                       q_gcw(1),
-                                       q_gcw(2),
-#endif
-                                       q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
-                                       X_data,
-                                       Q_data);
-    }
-    else if (interp_fcn == "BSPLINE_4")
-    {
-        LAGRANGIAN_BSPLINE_4_INTERP_FC(dx,
-                                       x_lower,
-                                       x_upper,
-                                       q_depth,
-#if (NDIM == 2)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       q_gcw(0),
-                                       q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       ilower(2),
-                                       iupper(2),
-                                       q_gcw(0),
-                                       q_gcw(1),
-                                       q_gcw(2),
-#endif
-                                       q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
-                                       X_data,
-                                       Q_data);
-    }
-    else if (interp_fcn == "BSPLINE_5")
-    {
-        LAGRANGIAN_BSPLINE_5_INTERP_FC(dx,
-                                       x_lower,
-                                       x_upper,
-                                       q_depth,
-#if (NDIM == 2)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       q_gcw(0),
-                                       q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       ilower(2),
-                                       iupper(2),
-                                       q_gcw(0),
-                                       q_gcw(1),
-                                       q_gcw(2),
-#endif
-                                       q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
-                                       X_data,
-                                       Q_data);
-    }
-    else if (interp_fcn == "BSPLINE_6")
-    {
-        LAGRANGIAN_BSPLINE_6_INTERP_FC(dx,
-                                       x_lower,
-                                       x_upper,
-                                       q_depth,
-#if (NDIM == 2)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       q_gcw(0),
-                                       q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       ilower(2),
-                                       iupper(2),
-                                       q_gcw(0),
-                                       q_gcw(1),
-                                       q_gcw(2),
-#endif
-                                       q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
-                                       X_data,
-                                       Q_data);
-    }
-    else if (interp_fcn == "USER_DEFINED")
-    {
+        break;
+    case USER_DEFINED_KERNEL:
         userDefinedInterpolate(Q_data,
                                Q_depth,
                                X_data,
@@ -4145,11 +5073,74 @@ LEInteractor::interpolate(double* const Q_data,
                                &local_indices[0],
                                &periodic_shifts[0],
                                local_indices_size);
-    }
-    else
-    {
-        TBOX_ERROR("LEInteractor::interpolate()\n"
-                   << "  Unknown interpolation kernel function " << interp_fcn << std::endl);
+        break;
+    default:
+        int support = 0;
+        const ComputeStencilFcnPtr compute_stencil_fcn = get_compute_stencil_fcn(kernel_fcn, support);
+        if (compute_stencil_fcn && (s_weight_cache || s_use_single_precision_weights))
+        {
+            WeightCache::Stencils* stencils = nullptr;
+            if (s_weight_cache)
+            {
+                const int num_points = *std::max_element(local_indices.begin(), local_indices.end()) + 1;
+                stencils = &s_weight_cache->getStencils(
+                    kernel_fcn, axis, num_points, support, s_use_single_precision_weights);
+            }
+            // q_data is only read when interpolating.
+            interact_with_cpp_kernel</*spread*/ false>(stencils,
+                                                       s_use_single_precision_weights,
+                                                       compute_stencil_fcn,
+                                                       support,
+                                                       const_cast<double*>(q_data),
+                                                       q_data_box,
+                                                       q_gcw,
+                                                       q_depth,
+                                                       nullptr,
+                                                       Q_data,
+                                                       X_data,
+                                                       x_lower,
+                                                       dx,
+                                                       local_indices,
+                                                       periodic_shifts);
+            break;
+        }
+        const LagrangianInterpFcnPtr interp_fcn_ptr = get_lagrangian_interp_fcn(kernel_fcn);
+        if (!interp_fcn_ptr)
+        {
+            TBOX_ERROR("LEInteractor::interpolate()\n"
+                       << "  Unknown interpolation kernel function " << enum_to_string<KernelFunctionType>(kernel_fcn)
+                       << std::endl);
+        }
+        interp_fcn_ptr(dx,
+                       x_lower,
+                       x_upper,
+                       q_depth,
+#if (NDIM == 2)
+                       ilower(0),
+                       iupper(0),
+                       ilower(1),
+                       iupper(1),
+                       q_gcw(0),
+                       q_gcw(1),
+#endif
+#if (NDIM == 3)
+                       ilower(0),
+                       iupper(0),
+                       ilower(1),
+                       iupper(1),
+                       ilower(2),
+                       iupper(2),
+                       q_gcw(0),
+                       q_gcw(1),
+                       q_gcw(2),
+#endif
+                       q_data,
+                       &local_indices[0],
+                       &periodic_shifts[0],
+                       local_indices_size,
+                       X_data,
+                       Q_data);
+        break;
     }
     return;
 }
@@ -4169,11 +5160,12 @@ LEInteractor::spread(double* const q_data,
                      const std::array<int, NDIM>& patch_touches_upper_physical_bdry,
                      const std::vector<int>& local_indices,
                      const std::vector<double>& periodic_shifts,
-                     const std::string& spread_fcn,
+                     const KernelFunctionType kernel_fcn,
                      const int axis)
 {
-    const int stencil_size = getStencilSize(spread_fcn);
-    const int min_ghosts = getMinimumGhostWidth(spread_fcn);
+    IBTK_PROFILING_REGION("LEInteractor::spread");
+    const int stencil_size = getStencilSize(kernel_fcn);
+    const int min_ghosts = getMinimumGhostWidth(kernel_fcn);
     const int q_gcw_min = q_gcw.min();
     bool patch_touches_physical_bdry = false;
     for (unsigned int d = 0; d < NDIM; ++d)
@@ -4184,7 +5176,7 @@ LEInteractor::spread(double* const q_data,
     if (patch_touches_physical_bdry && q_gcw_min < min_ghosts)
     {
         TBOX_ERROR("LEInteractor::spread(): insufficient ghost cells at physical boundary:"
-                   << "  kernel function          = " << spread_fcn << "\n"
+                   << "  kernel function          = " << enum_to_string<KernelFunctionType>(kernel_fcn) << "\n"
                    << "  kernel stencil size      = " << stencil_size << "\n"
                    << "  minimum ghost cell width = " << min_ghosts << "\n"
                    << "  ghost cell width         = " << q_gcw_min << "\n");
@@ -4193,40 +5185,9 @@ LEInteractor::spread(double* const q_data,
     const int local_indices_size = static_cast<int>(local_indices.size());
     const IntVector<NDIM>& ilower = q_data_box.lower();
     const IntVector<NDIM>& iupper = q_data_box.upper();
-    if (spread_fcn == "PIECEWISE_CONSTANT")
-    {
-        LAGRANGIAN_PIECEWISE_CONSTANT_SPREAD_FC(dx,
-                                                x_lower,
-                                                x_upper,
-                                                q_depth,
-                                                &local_indices[0],
-                                                &periodic_shifts[0],
-                                                local_indices_size,
-                                                X_data,
-                                                Q_data,
-#if (NDIM == 2)
-                                                ilower(0),
-                                                iupper(0),
-                                                ilower(1),
-                                                iupper(1),
-                                                q_gcw(0),
-                                                q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                                ilower(0),
-                                                iupper(0),
-                                                ilower(1),
-                                                iupper(1),
-                                                ilower(2),
-                                                iupper(2),
-                                                q_gcw(0),
-                                                q_gcw(1),
-                                                q_gcw(2),
-#endif
-                                                q_data);
-    }
-    else if (spread_fcn == "DISCONTINUOUS_LINEAR")
+    switch (kernel_fcn)
     {
+    case DISCONTINUOUS_LINEAR_KERNEL:
         LAGRANGIAN_DISCONTINUOUS_LINEAR_SPREAD_FC(dx,
                                                   x_lower,
                                                   x_upper,
@@ -4257,361 +5218,8 @@ LEInteractor::spread(double* const q_data,
                                                   q_gcw(2),
 #endif
                                                   q_data);
-    }
-    else if (spread_fcn == "PIECEWISE_LINEAR")
-    {
-        LAGRANGIAN_PIECEWISE_LINEAR_SPREAD_FC(dx,
-                                              x_lower,
-                                              x_upper,
-                                              q_depth,
-                                              &local_indices[0],
-                                              &periodic_shifts[0],
-                                              local_indices_size,
-                                              X_data,
-                                              Q_data,
-#if (NDIM == 2)
-                                              ilower(0),
-                                              iupper(0),
-                                              ilower(1),
-                                              iupper(1),
-                                              q_gcw(0),
-                                              q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                              ilower(0),
-                                              iupper(0),
-                                              ilower(1),
-                                              iupper(1),
-                                              ilower(2),
-                                              iupper(2),
-                                              q_gcw(0),
-                                              q_gcw(1),
-                                              q_gcw(2),
-#endif
-                                              q_data);
-    }
-    else if (spread_fcn == "PIECEWISE_CUBIC")
-    {
-        LAGRANGIAN_PIECEWISE_CUBIC_SPREAD_FC(dx,
-                                             x_lower,
-                                             x_upper,
-                                             q_depth,
-                                             &local_indices[0],
-                                             &periodic_shifts[0],
-                                             local_indices_size,
-                                             X_data,
-                                             Q_data,
-#if (NDIM == 2)
-                                             ilower(0),
-                                             iupper(0),
-                                             ilower(1),
-                                             iupper(1),
-                                             q_gcw(0),
-                                             q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                             ilower(0),
-                                             iupper(0),
-                                             ilower(1),
-                                             iupper(1),
-                                             ilower(2),
-                                             iupper(2),
-                                             q_gcw(0),
-                                             q_gcw(1),
-                                             q_gcw(2),
-#endif
-                                             q_data);
-    }
-    else if (spread_fcn == "IB_3")
-    {
-        LAGRANGIAN_IB_3_SPREAD_FC(dx,
-                                  x_lower,
-                                  x_upper,
-                                  q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
-                                  X_data,
-                                  Q_data,
-#if (NDIM == 2)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  q_gcw(0),
-                                  q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  ilower(2),
-                                  iupper(2),
-                                  q_gcw(0),
-                                  q_gcw(1),
-                                  q_gcw(2),
-#endif
-                                  q_data);
-    }
-    else if (spread_fcn == "IB_4")
-    {
-        LAGRANGIAN_IB_4_SPREAD_FC(dx,
-                                  x_lower,
-                                  x_upper,
-                                  q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
-                                  X_data,
-                                  Q_data,
-#if (NDIM == 2)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  q_gcw(0),
-                                  q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  ilower(2),
-                                  iupper(2),
-                                  q_gcw(0),
-                                  q_gcw(1),
-                                  q_gcw(2),
-#endif
-                                  q_data);
-    }
-    else if (spread_fcn == "IB_4_W8")
-    {
-        LAGRANGIAN_IB_4_W8_SPREAD_FC(dx,
-                                     x_lower,
-                                     x_upper,
-                                     q_depth,
-                                     &local_indices[0],
-                                     &periodic_shifts[0],
-                                     local_indices_size,
-                                     X_data,
-                                     Q_data,
-#if (NDIM == 2)
-                                     ilower(0),
-                                     iupper(0),
-                                     ilower(1),
-                                     iupper(1),
-                                     q_gcw(0),
-                                     q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                     ilower(0),
-                                     iupper(0),
-                                     ilower(1),
-                                     iupper(1),
-                                     ilower(2),
-                                     iupper(2),
-                                     q_gcw(0),
-                                     q_gcw(1),
-                                     q_gcw(2),
-#endif
-                                     q_data);
-    }
-    else if (spread_fcn == "IB_5")
-    {
-        LAGRANGIAN_IB_5_SPREAD_FC(dx,
-                                  x_lower,
-                                  x_upper,
-                                  q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
-                                  X_data,
-                                  Q_data,
-#if (NDIM == 2)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  q_gcw(0),
-                                  q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  ilower(2),
-                                  iupper(2),
-                                  q_gcw(0),
-                                  q_gcw(1),
-                                  q_gcw(2),
-#endif
-                                  q_data);
-    }
-    else if (spread_fcn == "IB_6")
-    {
-        LAGRANGIAN_IB_6_SPREAD_FC(dx,
-                                  x_lower,
-                                  x_upper,
-                                  q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
-                                  local_indices_size,
-                                  X_data,
-                                  Q_data,
-#if (NDIM == 2)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  q_gcw(0),
-                                  q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                  ilower(0),
-                                  iupper(0),
-                                  ilower(1),
-                                  iupper(1),
-                                  ilower(2),
-                                  iupper(2),
-                                  q_gcw(0),
-                                  q_gcw(1),
-                                  q_gcw(2),
-#endif
-                                  q_data);
-    }
-    else if (spread_fcn == "BSPLINE_3")
-    {
-        LAGRANGIAN_BSPLINE_3_SPREAD_FC(dx,
-                                       x_lower,
-                                       x_upper,
-                                       q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
-                                       X_data,
-                                       Q_data,
-#if (NDIM == 2)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       q_gcw(0),
-                                       q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       ilower(2),
-                                       iupper(2),
-                                       q_gcw(0),
-                                       q_gcw(1),
-                                       q_gcw(2),
-#endif
-                                       q_data);
-    }
-    else if (spread_fcn == "BSPLINE_4")
-    {
-        LAGRANGIAN_BSPLINE_4_SPREAD_FC(dx,
-                                       x_lower,
-                                       x_upper,
-                                       q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
-                                       X_data,
-                                       Q_data,
-#if (NDIM == 2)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       q_gcw(0),
-                                       q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       ilower(2),
-                                       iupper(2),
-                                       q_gcw(0),
-                                       q_gcw(1),
-                                       q_gcw(2),
-#endif
-                                       q_data);
-    }
-    else if (spread_fcn == "BSPLINE_5")
-    {
-        LAGRANGIAN_BSPLINE_5_SPREAD_FC(dx,
-                                       x_lower,
-                                       x_upper,
-                                       q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
-                                       X_data,
-                                       Q_data,
-#if (NDIM == 2)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       q_gcw(0),
-                                       q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       ilower(2),
-                                       iupper(2),
-                                       q_gcw(0),
-                                       q_gcw(1),
-                                       q_gcw(2),
-#endif
-                                       q_data);
-    }
-    else if (spread_fcn == "BSPLINE_6")
-    {
-        LAGRANGIAN_BSPLINE_6_SPREAD_FC(dx,
-                                       x_lower,
-                                       x_upper,
-                                       q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
-                                       local_indices_size,
-                                       X_data,
-                                       Q_data,
-#if (NDIM == 2)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       q_gcw(0),
-                                       q_gcw(1),
-#endif
-#if (NDIM == 3)
-                                       ilower(0),
-                                       iupper(0),
-                                       ilower(1),
-                                       iupper(1),
-                                       ilower(2),
-                                       iupper(2),
-                                       q_gcw(0),
-                                       q_gcw(1),
-                                       q_gcw(2),
-#endif
-                                       q_data);
-    }
-    else if (spread_fcn == "USER_DEFINED")
-    {
+        break;
+    case USER_DEFINED_KERNEL:
         userDefinedSpread(q_data,
                           q_data_box,
                           q_gcw,
@@ -4625,11 +5233,97 @@ LEInteractor::spread(double* const q_data,
                           &local_indices[0],
                           &periodic_shifts[0],
                           local_indices_size);
-    }
-    else
-    {
-        TBOX_ERROR("LEInteractor::spread()\n"
-                   << "  Unknown spreading kernel function " << spread_fcn << std::endl);
+        break;
+    default:
+        int support = 0;
+        const ComputeStencilFcnPtr compute_stencil_fcn = get_compute_stencil_fcn(kernel_fcn, support);
+        if (compute_stencil_fcn && (s_weight_cache || s_use_single_precision_weights))
+        {
+            WeightCache::Stencils* stencils = nullptr;
+            if (s_weight_cache)
+            {
+                const int num_points = *std::max_element(local_indices.begin(), local_indices.end()) + 1;
+                stencils = &s_weight_cache->getStencils(
+                    kernel_fcn, axis, num_points, support, s_use_single_precision_weights);
+            }
+            interact_with_cpp_kernel</*spread*/ true>(stencils,
+                                                      s_use_single_precision_weights,
+                                                      compute_stencil_fcn,
+                                                      support,
+                                                      q_data,
+                                                      q_data_box,
+                                                      q_gcw,
+                                                      q_depth,
+                                                      Q_data,
+                                                      nullptr,
+                                                      X_data,
+                                                      x_lower,
+                                                      dx,
+                                                      local_indices,
+                                                      periodic_shifts);
+            break;
+        }
+        const LagrangianSpreadFcnPtr spread_fcn_ptr = get_lagrangian_spread_fcn(kernel_fcn);
+        if (!spread_fcn_ptr)
+        {
+            TBOX_ERROR("LEInteractor::spread()\n"
+                       << "  Unknown spreading kernel function " << enum_to_string<KernelFunctionType>(kernel_fcn)
+                       << std::endl);
+        }
+        const auto spread_batch = [&](const int* const indices, const double* const shifts, const int num_indices) {
+            spread_fcn_ptr(dx,
+                           x_lower,
+                           x_upper,
+                           q_depth,
+                           indices,
+                           shifts,
+                           num_indices,
+                           X_data,
+                           Q_data,
+#if (NDIM == 2)
+                           ilower(0),
+                           iupper(0),
+                           ilower(1),
+                           iupper(1),
+                           q_gcw(0),
+                           q_gcw(1),
+#endif
+#if (NDIM == 3)
+                           ilower(0),
+                           iupper(0),
+                           ilower(1),
+                           iupper(1),
+                           ilower(2),
+                           iupper(2),
+                           q_gcw(0),
+                           q_gcw(1),
+                           q_gcw(2),
+#endif
+                           q_data);
+        };
+#ifdef _OPENMP
+        if (s_use_colored_spreading && omp_get_max_threads() > 1 && !omp_in_parallel())
+        {
+            std::array<std::vector<SpreadBatch>, NUM_SPREAD_COLORS> batches;
+            build_colored_spread_batches(
+                batches, local_indices, periodic_shifts, X_data, x_lower, dx, 2 * min_ghosts);
+            for (int color = 0; color < NUM_SPREAD_COLORS; ++color)
+            {
+                const int num_batches = static_cast<int>(batches[color].size());
+#pragma omp parallel for schedule(dynamic)
+                for (int k = 0; k < num_batches; ++k)
+                {
+                    const SpreadBatch& batch = batches[color][k];
+                    spread_batch(&batch.local_indices[0],
+                                 &batch.periodic_shifts[0],
+                                 static_cast<int>(batch.local_indices.size()));
+                }
+            }
+            break;
+        }
+#endif
+        spread_batch(&local_indices[0], &periodic_shifts[0], local_indices_size);
+        break;
     }
     return;
 }
@@ -4714,6 +5408,28 @@ LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
     return;
 }
 
+template <class T>
+std::pair<const std::vector<int>*, const std::vector<double>*>
+LEInteractor::getLocalIndices(std::vector<int>& local_indices_buf,
+                              std::vector<double>& periodic_shifts_buf,
+                              const Box<NDIM>& box,
+                              const Pointer<Patch<NDIM> > patch,
+                              const IntVector<NDIM>& periodic_shift,
+                              const Pointer<LIndexSetData<T> > idx_data)
+{
+    if (box == patch->getBox())
+    {
+        return std::make_pair(&idx_data->getInteriorActiveLocalPETScIndices(),
+                              &idx_data->getInteriorActivePeriodicShifts());
+    }
+    else if (box == idx_data->getGhostBox())
+    {
+        return std::make_pair(&idx_data->getActiveLocalPETScIndices(), &idx_data->getActivePeriodicShifts());
+    }
+    buildLocalIndices(local_indices_buf, periodic_shifts_buf, box, patch, periodic_shift, idx_data);
+    return std::make_pair(&local_indices_buf, &periodic_shifts_buf);
+}
+
 void
 LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
                                 const Box<NDIM>& box,
@@ -4729,11 +5445,18 @@ LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
     const Box<NDIM>& patch_box = patch->getBox();
     const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
     local_indices.reserve(upper_bound);
-    for (int k = 0; k < X_size / X_depth; ++k)
+
+    // Locate the points in batches to limit the size of the index buffer.
+    static const int BATCH_SIZE = 256;
+    std::array<hier::Index<NDIM>, BATCH_SIZE> idxs;
+    for (int k_begin = 0; k_begin < upper_bound; k_begin += BATCH_SIZE)
     {
-        const double* const X = &X_data[NDIM * k];
-        const hier::Index<NDIM> i = IndexUtilities::getCellIndex(X, patch_geom, patch_box);
-        if (box.contains(i)) local_indices.push_back(k);
+        const int num_points = std::min(BATCH_SIZE, upper_bound - k_begin);
+        IndexUtilities::getCellIndices(&X_data[NDIM * k_begin], num_points, patch_geom, patch_box, idxs.data());
+        for (int k = 0; k < num_points; ++k)
+        {
+            if (box.contains(idxs[k])) local_indices.push_back(k_begin + k);
+        }
     }
     return;
 }
@@ -5009,6 +5732,15 @@ template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_dat
                                               const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                                               const std::string& interp_fcn);
 
+template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
+                                              const SAMRAI::tbox::Pointer<LData> X_data,
+                                              const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
+                                              const SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                                              const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                              const SAMRAI::hier::Box<NDIM>& interp_box,
+                                              const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                              const KernelFunctionType kernel_fcn);
+
 template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
                                               const SAMRAI::tbox::Pointer<LData> X_data,
                                               const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
@@ -5018,6 +5750,15 @@ template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_dat
                                               const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                                               const std::string& interp_fcn);
 
+template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
+                                              const SAMRAI::tbox::Pointer<LData> X_data,
+                                              const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
+                                              const SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
+                                              const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                              const SAMRAI::hier::Box<NDIM>& interp_box,
+                                              const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                              const KernelFunctionType kernel_fcn);
+
 template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
                                               const SAMRAI::tbox::Pointer<LData> X_data,
                                               const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
@@ -5027,6 +5768,15 @@ template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_dat
                                               const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                                               const std::string& interp_fcn);
 
+template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
+                                              const SAMRAI::tbox::Pointer<LData> X_data,
+                                              const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
+                                              const SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                                              const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                              const SAMRAI::hier::Box<NDIM>& interp_box,
+                                              const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                              const KernelFunctionType kernel_fcn);
+
 template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
                                               const SAMRAI::tbox::Pointer<LData> X_data,
                                               const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
@@ -5036,6 +5786,15 @@ template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_dat
                                               const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                                               const std::string& interp_fcn);
 
+template void IBTK::LEInteractor::interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
+                                              const SAMRAI::tbox::Pointer<LData> X_data,
+                                              const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
+                                              const SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
+                                              const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                              const SAMRAI::hier::Box<NDIM>& interp_box,
+                                              const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                              const KernelFunctionType kernel_fcn);
+
 template void IBTK::LEInteractor::interpolate(double* const Q_data,
                                               const int Q_depth,
                                               const double* const X_data,
@@ -5047,6 +5806,17 @@ template void IBTK::LEInteractor::interpolate(double* const Q_data,
                                               const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                                               const std::string& interp_fcn);
 
+template void IBTK::LEInteractor::interpolate(double* const Q_data,
+                                              const int Q_depth,
+                                              const double* const X_data,
+                                              const int X_depth,
+                                              const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
+                                              const SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                                              const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                              const SAMRAI::hier::Box<NDIM>& interp_box,
+                                              const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                              const KernelFunctionType kernel_fcn);
+
 template void IBTK::LEInteractor::interpolate(double* const Q_data,
                                               const int Q_depth,
                                               const double* const X_data,
@@ -5058,6 +5828,17 @@ template void IBTK::LEInteractor::interpolate(double* const Q_data,
                                               const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                                               const std::string& interp_fcn);
 
+template void IBTK::LEInteractor::interpolate(double* const Q_data,
+                                              const int Q_depth,
+                                              const double* const X_data,
+                                              const int X_depth,
+                                              const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
+                                              const SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
+                                              const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                              const SAMRAI::hier::Box<NDIM>& interp_box,
+                                              const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                              const KernelFunctionType kernel_fcn);
+
 template void IBTK::LEInteractor::interpolate(double* const Q_data,
                                               const int Q_depth,
                                               const double* const X_data,
@@ -5069,6 +5850,17 @@ template void IBTK::LEInteractor::interpolate(double* const Q_data,
                                               const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                                               const std::string& interp_fcn);
 
+template void IBTK::LEInteractor::interpolate(double* const Q_data,
+                                              const int Q_depth,
+                                              const double* const X_data,
+                                              const int X_depth,
+                                              const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
+                                              const SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                                              const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                              const SAMRAI::hier::Box<NDIM>& interp_box,
+                                              const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                              const KernelFunctionType kernel_fcn);
+
 template void IBTK::LEInteractor::interpolate(double* const Q_data,
                                               const int Q_depth,
                                               const double* const X_data,
@@ -5080,6 +5872,17 @@ template void IBTK::LEInteractor::interpolate(double* const Q_data,
                                               const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                                               const std::string& interp_fcn);
 
+template void IBTK::LEInteractor::interpolate(double* const Q_data,
+                                              const int Q_depth,
+                                              const double* const X_data,
+                                              const int X_depth,
+                                              const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
+                                              const SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
+                                              const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                              const SAMRAI::hier::Box<NDIM>& interp_box,
+                                              const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                              const KernelFunctionType kernel_fcn);
+
 template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
                                          const SAMRAI::tbox::Pointer<LData> Q_data,
                                          const SAMRAI::tbox::Pointer<LData> X_data,
@@ -5089,6 +5892,15 @@ template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::Cel
                                          const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                                          const std::string& spread_fcn);
 
+template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                                         const SAMRAI::tbox::Pointer<LData> Q_data,
+                                         const SAMRAI::tbox::Pointer<LData> X_data,
+                                         const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
+                                         const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                         const SAMRAI::hier::Box<NDIM>& spread_box,
+                                         const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                         const KernelFunctionType kernel_fcn);
+
 template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
                                          const SAMRAI::tbox::Pointer<LData> Q_data,
                                          const SAMRAI::tbox::Pointer<LData> X_data,
@@ -5098,6 +5910,15 @@ template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::Nod
                                          const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                                          const std::string& spread_fcn);
 
+template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
+                                         const SAMRAI::tbox::Pointer<LData> Q_data,
+                                         const SAMRAI::tbox::Pointer<LData> X_data,
+                                         const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
+                                         const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                         const SAMRAI::hier::Box<NDIM>& spread_box,
+                                         const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                         const KernelFunctionType kernel_fcn);
+
 template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
                                          const SAMRAI::tbox::Pointer<LData> Q_data,
                                          const SAMRAI::tbox::Pointer<LData> X_data,
@@ -5107,6 +5928,15 @@ template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::Sid
                                          const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                                          const std::string& spread_fcn);
 
+template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                                         const SAMRAI::tbox::Pointer<LData> Q_data,
+                                         const SAMRAI::tbox::Pointer<LData> X_data,
+                                         const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
+                                         const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                         const SAMRAI::hier::Box<NDIM>& spread_box,
+                                         const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                         const KernelFunctionType kernel_fcn);
+
 template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
                                          const SAMRAI::tbox::Pointer<LData> Q_data,
                                          const SAMRAI::tbox::Pointer<LData> X_data,
@@ -5116,6 +5946,15 @@ template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::Edg
                                          const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                                          const std::string& spread_fcn);
 
+template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
+                                         const SAMRAI::tbox::Pointer<LData> Q_data,
+                                         const SAMRAI::tbox::Pointer<LData> X_data,
+                                         const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
+                                         const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                         const SAMRAI::hier::Box<NDIM>& spread_box,
+                                         const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                         const KernelFunctionType kernel_fcn);
+
 template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
                                          const double* const Q_data,
                                          const int Q_depth,
@@ -5127,6 +5966,17 @@ template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::Cel
                                          const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                                          const std::string& spread_fcn);
 
+template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                                         const double* const Q_data,
+                                         const int Q_depth,
+                                         const double* const X_data,
+                                         const int X_depth,
+                                         const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
+                                         const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                         const SAMRAI::hier::Box<NDIM>& spread_box,
+                                         const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                         const KernelFunctionType kernel_fcn);
+
 template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
                                          const double* const Q_data,
                                          const int Q_depth,
@@ -5138,6 +5988,17 @@ template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::Nod
                                          const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                                          const std::string& spread_fcn);
 
+template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
+                                         const double* const Q_data,
+                                         const int Q_depth,
+                                         const double* const X_data,
+                                         const int X_depth,
+                                         const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
+                                         const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                         const SAMRAI::hier::Box<NDIM>& spread_box,
+                                         const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                         const KernelFunctionType kernel_fcn);
+
 template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
                                          const double* const Q_data,
                                          const int Q_depth,
@@ -5149,6 +6010,17 @@ template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::Sid
                                          const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                                          const std::string& spread_fcn);
 
+template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                                         const double* const Q_data,
+                                         const int Q_depth,
+                                         const double* const X_data,
+                                         const int X_depth,
+                                         const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
+                                         const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                         const SAMRAI::hier::Box<NDIM>& spread_box,
+                                         const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                         const KernelFunctionType kernel_fcn);
+
 template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
                                          const double* const Q_data,
                                          const int Q_depth,
@@ -5160,6 +6032,17 @@ template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::Edg
                                          const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                                          const std::string& spread_fcn);
 
+template void IBTK::LEInteractor::spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
+                                         const double* const Q_data,
+                                         const int Q_depth,
+                                         const double* const X_data,
+                                         const int X_depth,
+                                         const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data,
+                                         const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                         const SAMRAI::hier::Box<NDIM>& spread_box,
+                                         const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                         const KernelFunctionType kernel_fcn);
+
 template void IBTK::LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
                                                     std::vector<double>& periodic_shifts,
                                                     const SAMRAI::hier::Box<NDIM>& box,
@@ -5167,4 +6050,12 @@ template void IBTK::LEInteractor::buildLocalIndices(std::vector<int>& local_indi
                                                     const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                                                     const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data);
 
+template std::pair<const std::vector<int>*, const std::vector<double>*>
+IBTK::LEInteractor::getLocalIndices(std::vector<int>& local_indices_buf,
+                                    std::vector<double>& periodic_shifts_buf,
+                                    const SAMRAI::hier::Box<NDIM>& box,
+                                    const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                    const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                    const SAMRAI::tbox::Pointer<LIndexSetData<LNode> > idx_data);
+
 //////////////////////////////////////////////////////////////////////////////
@@ -18,6 +18,7 @@
 #include "ibtk/LNodeIndex.h"
 #include "ibtk/LSet.h"
 #include "ibtk/LSetData.h"
+#include "ibtk/ibtk_utilities.h"
 
 #include "Box.h"
 #include "CartesianPatchGeometry.h"
@@ -29,6 +30,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
@@ -51,7 +53,9 @@ LIndexSetData<T>::LIndexSetData(Box<NDIM> box, IntVector<NDIM> ghosts) : LSetDat
 
 template <class T>
 void
-LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector<NDIM>& periodic_shift)
+LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch,
+                                    const IntVector<NDIM>& periodic_shift,
+                                    const bool sort_by_cell_index)
 {
     d_lag_indices.clear();
     d_interior_lag_indices.clear();
@@ -65,10 +69,16 @@ LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector
     d_periodic_shifts.clear();
     d_interior_periodic_shifts.clear();
     d_ghost_periodic_shifts.clear();
+    d_has_inactive_indices = false;
+    d_active_local_petsc_indices.clear();
+    d_interior_active_local_petsc_indices.clear();
+    d_active_periodic_shifts.clear();
+    d_interior_active_periodic_shifts.clear();
 
     const Box<NDIM>& patch_box = patch->getBox();
     const hier::Index<NDIM>& ilower = patch_box.lower();
     const hier::Index<NDIM>& iupper = patch_box.upper();
+    const hier::Index<NDIM>& ghost_lower = this->getGhostBox().lower();
 
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
@@ -79,6 +89,16 @@ LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector
         patch_touches_upper_periodic_bdry[axis] = pgeom->getTouchesPeriodicBoundary(axis, 1);
     }
 
+    // Collect the indexing data for each node, along with a key that
+    // determines the order in which the nodes are cached.
+    struct CachedIndex
+    {
+        std::uint64_t key;
+        int lag_idx, global_petsc_idx, local_petsc_idx;
+        std::array<int, NDIM> offset;
+        bool is_interior;
+    };
+    std::vector<CachedIndex> cached_indices;
     for (typename LSetData<T>::SetIterator it(*this); it; it++)
     {
         const CellIndex<NDIM>& i = it.getIndex();
@@ -99,46 +119,115 @@ LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector
                 offset[d] = 0;
             }
         }
+        const std::uint64_t key = sort_by_cell_index ? morton_key(i, ghost_lower) : 0;
         const LSet<T>& idx_set = *it;
         const bool patch_owns_idx_set = patch_box.contains(i);
         for (auto n = idx_set.begin(); n != idx_set.end(); ++n)
         {
             const typename LSet<T>::value_type& idx = *n;
-            const int lag_idx = idx->getLagrangianIndex();
-            const int global_petsc_idx = idx->getGlobalPETScIndex();
-            const int local_petsc_idx = idx->getLocalPETScIndex();
-            d_lag_indices.push_back(lag_idx);
-            d_global_petsc_indices.push_back(global_petsc_idx);
-            d_local_petsc_indices.push_back(local_petsc_idx);
+            cached_indices.push_back({ key,
+                                       idx->getLagrangianIndex(),
+                                       idx->getGlobalPETScIndex(),
+                                       idx->getLocalPETScIndex(),
+                                       offset,
+                                       patch_owns_idx_set });
+        }
+    }
+
+    // Order nodes along a Z-order curve through the cells of the patch so that
+    // nodes that are consecutive in the cached arrays touch overlapping grid
+    // data during spreading and interpolation.  The sort is stable so that
+    // nodes in the same cell retain their relative order.
+    if (sort_by_cell_index)
+    {
+        std::stable_sort(cached_indices.begin(),
+                         cached_indices.end(),
+                         [](const CachedIndex& a, const CachedIndex& b) { return a.key < b.key; });
+    }
+
+    const auto num_indices = cached_indices.size();
+    d_lag_indices.reserve(num_indices);
+    d_global_petsc_indices.reserve(num_indices);
+    d_local_petsc_indices.reserve(num_indices);
+    d_periodic_shifts.reserve(NDIM * num_indices);
+    for (const CachedIndex& idx : cached_indices)
+    {
+        d_lag_indices.push_back(idx.lag_idx);
+        d_global_petsc_indices.push_back(idx.global_petsc_idx);
+        d_local_petsc_indices.push_back(idx.local_petsc_idx);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            d_periodic_shifts.push_back(static_cast<double>(idx.offset[d]) * dx[d]);
+        }
+        if (idx.is_interior)
+        {
+            d_interior_lag_indices.push_back(idx.lag_idx);
+            d_interior_global_petsc_indices.push_back(idx.global_petsc_idx);
+            d_interior_local_petsc_indices.push_back(idx.local_petsc_idx);
             for (unsigned int d = 0; d < NDIM; ++d)
             {
-                d_periodic_shifts.push_back(static_cast<double>(offset[d]) * dx[d]);
-            }
-            if (patch_owns_idx_set)
-            {
-                d_interior_lag_indices.push_back(lag_idx);
-                d_interior_global_petsc_indices.push_back(global_petsc_idx);
-                d_interior_local_petsc_indices.push_back(local_petsc_idx);
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_interior_periodic_shifts.push_back(static_cast<double>(offset[d]) * dx[d]);
-                }
+                d_interior_periodic_shifts.push_back(static_cast<double>(idx.offset[d]) * dx[d]);
             }
-            else
+        }
+        else
+        {
+            d_ghost_lag_indices.push_back(idx.lag_idx);
+            d_ghost_global_petsc_indices.push_back(idx.global_petsc_idx);
+            d_ghost_local_petsc_indices.push_back(idx.local_petsc_idx);
+            for (unsigned int d = 0; d < NDIM; ++d)
             {
-                d_ghost_lag_indices.push_back(lag_idx);
-                d_ghost_global_petsc_indices.push_back(global_petsc_idx);
-                d_ghost_local_petsc_indices.push_back(local_petsc_idx);
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_ghost_periodic_shifts.push_back(static_cast<double>(offset[d]) * dx[d]);
-                }
+                d_ghost_periodic_shifts.push_back(static_cast<double>(idx.offset[d]) * dx[d]);
             }
         }
     }
     return;
 } // cacheLocalIndices
 
+template <class T>
+void
+LIndexSetData<T>::setInactiveLagrangianIndexRanges(const std::vector<std::pair<int, int> >& inactive_lag_idx_ranges)
+{
+    d_active_local_petsc_indices.clear();
+    d_interior_active_local_petsc_indices.clear();
+    d_active_periodic_shifts.clear();
+    d_interior_active_periodic_shifts.clear();
+    d_has_inactive_indices = !inactive_lag_idx_ranges.empty();
+    if (!d_has_inactive_indices) return;
+
+    const auto is_active = [&inactive_lag_idx_ranges](const int lag_idx) {
+        for (const std::pair<int, int>& range : inactive_lag_idx_ranges)
+        {
+            if (range.first <= lag_idx && lag_idx < range.second) return false;
+        }
+        return true;
+    };
+    const auto filter = [&is_active](const std::vector<int>& lag_indices,
+                                     const std::vector<int>& local_petsc_indices,
+                                     const std::vector<double>& periodic_shifts,
+                                     std::vector<int>& active_local_petsc_indices,
+                                     std::vector<double>& active_periodic_shifts) {
+        for (std::size_t k = 0; k < lag_indices.size(); ++k)
+        {
+            if (!is_active(lag_indices[k])) continue;
+            active_local_petsc_indices.push_back(local_petsc_indices[k]);
+            active_periodic_shifts.insert(active_periodic_shifts.end(),
+                                          periodic_shifts.begin() + NDIM * k,
+                                          periodic_shifts.begin() + NDIM * (k + 1));
+        }
+    };
+    filter(d_lag_indices,
+           d_local_petsc_indices,
+           d_periodic_shifts,
+           d_active_local_petsc_indices,
+           d_active_periodic_shifts);
+    filter(d_interior_lag_indices,
+           d_interior_local_petsc_indices,
+           d_interior_periodic_shifts,
+           d_interior_active_local_petsc_indices,
+           d_interior_active_periodic_shifts);
+    return;
+} // setInactiveLagrangianIndexRanges
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
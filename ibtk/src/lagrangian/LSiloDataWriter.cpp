@@ -17,6 +17,7 @@
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/LData.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/TelemetryManager.h"
 
 #include "IntVector.h"
 #include "PatchHierarchy.h"
@@ -34,12 +35,14 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <array>
 #include <cstdio>
 #include <map>
 #include <memory>
 #include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -58,9 +61,8 @@ namespace IBTK
 
 namespace
 {
-// The rank of the root MPI process and the MPI tag number.
+// The rank of the root MPI process.
 static const int SILO_MPI_ROOT = 0;
-static const int SILO_MPI_TAG = 0;
 
 // The name of the Silo dumps and database filenames.
 static const int SILO_NAME_BUFSIZE = 128;
@@ -602,6 +604,26 @@ build_local_ucd_mesh(DBfile* dbfile,
 #endif // if defined(IBTK_HAVE_SILO)
 } // namespace
 
+struct LSiloDataWriter::PlotData
+{
+    int time_step_number = -1;
+    double simulation_time = 0.0;
+    int mpi_rank = 0, mpi_nodes = 1;
+    std::string dump_dirname, current_dump_directory_name;
+
+    // Local coordinates and variable data.
+    std::vector<bool> has_coords_data;
+    std::vector<std::vector<double> > X_data;
+    std::vector<std::vector<std::vector<double> > > var_data;
+
+    // Data gathered on the root MPI process.
+    std::vector<std::vector<int> > nclouds_per_proc, nblocks_per_proc, nmbs_per_proc, nucd_meshes_per_proc;
+    std::vector<std::vector<std::vector<int> > > meshtypes_per_proc, vartypes_per_proc, mb_nblocks_per_proc;
+    std::vector<std::vector<std::vector<std::vector<int> > > > multimeshtypes_per_proc, multivartypes_per_proc;
+    std::vector<std::vector<std::vector<std::string> > > cloud_names_per_proc, block_names_per_proc, mb_names_per_proc,
+        ucd_mesh_names_per_proc;
+};
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 LSiloDataWriter::LSiloDataWriter(std::string object_name, std::string dump_directory_name, bool register_for_restart)
@@ -661,6 +683,8 @@ LSiloDataWriter::LSiloDataWriter(std::string object_name, std::string dump_direc
 
 LSiloDataWriter::~LSiloDataWriter()
 {
+    waitForPlotData();
+
     if (d_registered_for_restart)
     {
         RestartManager::getManager()->unregisterRestartItem(d_object_name);
@@ -695,6 +719,7 @@ LSiloDataWriter::~LSiloDataWriter()
 void
 LSiloDataWriter::setPatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy)
 {
+    waitForPlotData();
 #if !defined(NDEBUG)
     TBOX_ASSERT(hierarchy);
     TBOX_ASSERT(hierarchy->getFinestLevelNumber() >= d_finest_ln);
@@ -707,6 +732,7 @@ LSiloDataWriter::setPatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy)
 void
 LSiloDataWriter::resetLevels(const int coarsest_ln, const int finest_ln)
 {
+    waitForPlotData();
 #if !defined(NDEBUG)
     TBOX_ASSERT((coarsest_ln >= 0) && (finest_ln >= coarsest_ln));
     if (d_hierarchy)
@@ -810,6 +836,8 @@ LSiloDataWriter::registerMarkerCloud(const std::string& name,
                                      const int first_lag_idx,
                                      const int level_number)
 {
+    waitForPlotData();
+
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -870,6 +898,8 @@ LSiloDataWriter::registerLogicallyCartesianBlock(const std::string& name,
                                                  const int first_lag_idx,
                                                  const int level_number)
 {
+    waitForPlotData();
+
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -936,6 +966,8 @@ LSiloDataWriter::registerLogicallyCartesianMultiblock(const std::string& name,
                                                       const std::vector<int>& first_lag_idx,
                                                       const int level_number)
 {
+    waitForPlotData();
+
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -1009,6 +1041,8 @@ LSiloDataWriter::registerUnstructuredMesh(const std::string& name,
                                           const std::multimap<int, std::pair<int, int> >& edge_map,
                                           const int level_number)
 {
+    waitForPlotData();
+
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -1074,6 +1108,8 @@ LSiloDataWriter::registerUnstructuredMesh(const std::string& name,
 void
 LSiloDataWriter::registerCoordsData(Pointer<LData> coords_data, const int level_number)
 {
+    waitForPlotData();
+
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -1090,6 +1126,8 @@ LSiloDataWriter::registerCoordsData(Pointer<LData> coords_data, const int level_
 void
 LSiloDataWriter::registerVariableData(const std::string& var_name, Pointer<LData> var_data, const int level_number)
 {
+    waitForPlotData();
+
     const int start_depth = 0;
     const int var_depth = var_data->getDepth();
     registerVariableData(var_name, var_data, start_depth, var_depth, level_number);
@@ -1103,6 +1141,8 @@ LSiloDataWriter::registerVariableData(const std::string& var_name,
                                       const int var_depth,
                                       const int level_number)
 {
+    waitForPlotData();
+
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -1132,6 +1172,8 @@ LSiloDataWriter::registerVariableData(const std::string& var_name,
 void
 LSiloDataWriter::registerLagrangianAO(AO& ao, const int level_number)
 {
+    waitForPlotData();
+
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -1148,6 +1190,7 @@ LSiloDataWriter::registerLagrangianAO(AO& ao, const int level_number)
 void
 LSiloDataWriter::registerLagrangianAO(std::vector<AO>& ao, const int coarsest_ln, const int finest_ln)
 {
+    waitForPlotData();
 #if !defined(NDEBUG)
     TBOX_ASSERT(coarsest_ln <= finest_ln);
 #endif
@@ -1168,6 +1211,22 @@ LSiloDataWriter::registerLagrangianAO(std::vector<AO>& ao, const int coarsest_ln
     return;
 } // registerLagrangianAO
 
+void
+LSiloDataWriter::setUseAsynchronousOutput(const bool use_asynchronous_output)
+{
+    waitForPlotData();
+    d_use_asynchronous_output = use_asynchronous_output;
+    return;
+} // setUseAsynchronousOutput
+
+void
+LSiloDataWriter::setCompression(const std::string& compression)
+{
+    waitForPlotData();
+    d_compression = compression;
+    return;
+} // setCompression
+
 void
 LSiloDataWriter::writePlotData(const int time_step_number, const double simulation_time)
 {
@@ -1176,6 +1235,10 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
     TBOX_ASSERT(time_step_number >= 0);
     TBOX_ASSERT(!d_dump_directory_name.empty());
 #endif
+    TelemetryManager::ScopedPhase io_phase("io");
+
+    // Wait for the previous plot data to be written.
+    waitForPlotData();
 
     if (time_step_number <= d_time_step_number)
     {
@@ -1195,8 +1258,6 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
     int ierr;
     char temp_buf[SILO_NAME_BUFSIZE];
-    std::string current_file_name;
-    DBfile* dbfile;
     const int mpi_rank = IBTK_MPI::getRank();
     const int mpi_nodes = IBTK_MPI::getNodes();
 
@@ -1217,511 +1278,629 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
     Utilities::recursiveMkdir(dump_dirname);
 
-    // Create one local DBfile per MPI process.
-    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", mpi_rank);
-    current_file_name = dump_dirname + "/" + SILO_PROCESSOR_FILE_PREFIX;
-    current_file_name += temp_buf;
-    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-    if (!(dbfile = DBCreate(current_file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, DB_PDB)))
-    {
-        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                 << "  Could not create DBfile named " << current_file_name << std::endl);
-    }
+    auto data = std::make_shared<PlotData>();
+    data->time_step_number = time_step_number;
+    data->simulation_time = simulation_time;
+    data->mpi_rank = mpi_rank;
+    data->mpi_nodes = mpi_nodes;
+    data->dump_dirname = dump_dirname;
+    data->current_dump_directory_name = current_dump_directory_name;
 
+    // Determine the mesh and variable types of the local blocks and
+    // multiblocks.
     std::vector<std::vector<int> > meshtype(d_finest_ln + 1), vartype(d_finest_ln + 1);
     std::vector<std::vector<std::vector<int> > > multimeshtype(d_finest_ln + 1), multivartype(d_finest_ln + 1);
-
-    // Set the local data.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        if (d_coords_data[ln])
+        if (!d_coords_data[ln]) continue;
+        meshtype[ln].assign(d_nblocks[ln], DB_QUAD_CURV);
+        vartype[ln].assign(d_nblocks[ln], DB_QUADVAR);
+        multimeshtype[ln].resize(d_nmbs[ln]);
+        multivartype[ln].resize(d_nmbs[ln]);
+        for (int mb = 0; mb < d_nmbs[ln]; ++mb)
         {
-            // Scatter the data from "global" to "local" form.
-            Vec local_X_vec;
-            ierr = VecDuplicate(d_dst_vec[ln][NDIM], &local_X_vec);
-            IBTK_CHKERRQ(ierr);
+            multimeshtype[ln][mb].assign(d_mb_nblocks[ln][mb], DB_QUAD_CURV);
+            multivartype[ln][mb].assign(d_mb_nblocks[ln][mb], DB_QUADVAR);
+        }
+    }
 
-            Vec global_X_vec = d_coords_data[ln]->getVec();
-            ierr = VecScatterBegin(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
+    // Scatter the data from "global" to "local" form and copy the local data
+    // into the buffers from which the plot files are written.
+    const auto copy_local_data =
+        [&ierr](Vec global_vec, Vec dst_vec, VecScatter& scatter, std::vector<double>& vals) {
+            Vec local_vec;
+            ierr = VecDuplicate(dst_vec, &local_vec);
             IBTK_CHKERRQ(ierr);
-            ierr = VecScatterEnd(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
+            ierr = VecScatterBegin(scatter, global_vec, local_vec, INSERT_VALUES, SCATTER_FORWARD);
             IBTK_CHKERRQ(ierr);
-
-            double* local_X_arr;
-            ierr = VecGetArray(local_X_vec, &local_X_arr);
+            ierr = VecScatterEnd(scatter, global_vec, local_vec, INSERT_VALUES, SCATTER_FORWARD);
             IBTK_CHKERRQ(ierr);
-
-            std::vector<Vec> local_v_vecs;
-            std::vector<double*> local_v_arrs;
-
+            int local_size;
+            ierr = VecGetLocalSize(local_vec, &local_size);
+            IBTK_CHKERRQ(ierr);
+            const double* local_arr;
+            ierr = VecGetArrayRead(local_vec, &local_arr);
+            IBTK_CHKERRQ(ierr);
+            vals.assign(local_arr, local_arr + local_size);
+            ierr = VecRestoreArrayRead(local_vec, &local_arr);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecDestroy(&local_vec);
+            IBTK_CHKERRQ(ierr);
+        };
+    data->has_coords_data.resize(d_finest_ln + 1, false);
+    data->X_data.resize(d_finest_ln + 1);
+    data->var_data.resize(d_finest_ln + 1);
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        if (d_coords_data[ln])
+        {
+            data->has_coords_data[ln] = true;
+            copy_local_data(
+                d_coords_data[ln]->getVec(), d_dst_vec[ln][NDIM], d_vec_scatter[ln][NDIM], data->X_data[ln]);
+            data->var_data[ln].resize(d_nvars[ln]);
             for (int v = 0; v < d_nvars[ln]; ++v)
             {
                 const int var_depth = d_var_depths[ln][v];
-                Vec local_v_vec;
-                ierr = VecDuplicate(d_dst_vec[ln][var_depth], &local_v_vec);
-                IBTK_CHKERRQ(ierr);
-
-                Vec global_v_vec = d_var_data[ln][v]->getVec();
-                ierr = VecScatterBegin(
-                    d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
-                IBTK_CHKERRQ(ierr);
-                ierr = VecScatterEnd(
-                    d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
-                IBTK_CHKERRQ(ierr);
-
-                double* local_v_arr;
-                ierr = VecGetArray(local_v_vec, &local_v_arr);
-                IBTK_CHKERRQ(ierr);
-
-                local_v_vecs.push_back(local_v_vec);
-                local_v_arrs.push_back(local_v_arr);
+                copy_local_data(d_var_data[ln][v]->getVec(),
+                                d_dst_vec[ln][var_depth],
+                                d_vec_scatter[ln][var_depth],
+                                data->var_data[ln][v]);
             }
+        }
+    }
 
-            // Keep track of the current offset in the local Vec data.
-            int offset = 0;
-
-            // Add the local clouds to the local DBfile.
-            for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
-            {
-                const int nmarks = d_cloud_nmarks[ln][cloud];
-
-                std::string dirname = "level_" + std::to_string(ln) + "_cloud_" + std::to_string(cloud);
+    // Gather the data required to create the multimesh and multivar objects
+    // on the root MPI process. The data from all levels are packed into one
+    // integer buffer and one character buffer (containing the null-terminated
+    // object names) on each process, so that only a few collective operations
+    // are needed instead of a sequence of point-to-point messages per process.
+    std::vector<int> int_buf;
+    std::vector<char> char_buf;
+    const auto pack_names = [&char_buf](const std::vector<std::string>& names) {
+        for (const std::string& name : names)
+        {
+            char_buf.insert(char_buf.end(), name.c_str(), name.c_str() + name.size() + 1);
+        }
+    };
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        int_buf.push_back(d_nclouds[ln]);
+        int_buf.push_back(d_nblocks[ln]);
+        int_buf.insert(int_buf.end(), meshtype[ln].begin(), meshtype[ln].end());
+        int_buf.insert(int_buf.end(), vartype[ln].begin(), vartype[ln].end());
+        int_buf.push_back(d_nmbs[ln]);
+        int_buf.insert(int_buf.end(), d_mb_nblocks[ln].begin(), d_mb_nblocks[ln].end());
+        for (int mb = 0; mb < d_nmbs[ln]; ++mb)
+        {
+            int_buf.insert(int_buf.end(), multimeshtype[ln][mb].begin(), multimeshtype[ln][mb].end());
+            int_buf.insert(int_buf.end(), multivartype[ln][mb].begin(), multivartype[ln][mb].end());
+        }
+        int_buf.push_back(d_nucd_meshes[ln]);
+        pack_names(d_cloud_names[ln]);
+        pack_names(d_block_names[ln]);
+        pack_names(d_mb_names[ln]);
+        pack_names(d_ucd_mesh_names[ln]);
+    }
+
+    std::array<int, 2> buf_sizes = { { static_cast<int>(int_buf.size()), static_cast<int>(char_buf.size()) } };
+    std::vector<int> buf_sizes_per_proc(mpi_rank == SILO_MPI_ROOT ? 2 * mpi_nodes : 0);
+    MPI_Gather(buf_sizes.data(),
+               2,
+               MPI_INT,
+               buf_sizes_per_proc.data(),
+               2,
+               MPI_INT,
+               SILO_MPI_ROOT,
+               IBTK_MPI::getCommunicator());
+
+    std::vector<int> int_counts, int_displs, char_counts, char_displs;
+    if (mpi_rank == SILO_MPI_ROOT)
+    {
+        int_counts.resize(mpi_nodes);
+        int_displs.resize(mpi_nodes + 1, 0);
+        char_counts.resize(mpi_nodes);
+        char_displs.resize(mpi_nodes + 1, 0);
+        for (int proc = 0; proc < mpi_nodes; ++proc)
+        {
+            int_counts[proc] = buf_sizes_per_proc[2 * proc];
+            char_counts[proc] = buf_sizes_per_proc[2 * proc + 1];
+            int_displs[proc + 1] = int_displs[proc] + int_counts[proc];
+            char_displs[proc + 1] = char_displs[proc] + char_counts[proc];
+        }
+    }
+    std::vector<int> int_buf_all(mpi_rank == SILO_MPI_ROOT ? int_displs[mpi_nodes] : 0);
+    std::vector<char> char_buf_all(mpi_rank == SILO_MPI_ROOT ? char_displs[mpi_nodes] : 0);
+    MPI_Gatherv(int_buf.data(),
+                buf_sizes[0],
+                MPI_INT,
+                int_buf_all.data(),
+                int_counts.data(),
+                int_displs.data(),
+                MPI_INT,
+                SILO_MPI_ROOT,
+                IBTK_MPI::getCommunicator());
+    MPI_Gatherv(char_buf.data(),
+                buf_sizes[1],
+                MPI_CHAR,
+                char_buf_all.data(),
+                char_counts.data(),
+                char_displs.data(),
+                MPI_CHAR,
+                SILO_MPI_ROOT,
+                IBTK_MPI::getCommunicator());
+
+    // Unpack the gathered data on the root MPI process.
+    auto& nclouds_per_proc = data->nclouds_per_proc;
+    auto& nblocks_per_proc = data->nblocks_per_proc;
+    auto& nmbs_per_proc = data->nmbs_per_proc;
+    auto& nucd_meshes_per_proc = data->nucd_meshes_per_proc;
+    auto& meshtypes_per_proc = data->meshtypes_per_proc;
+    auto& vartypes_per_proc = data->vartypes_per_proc;
+    auto& mb_nblocks_per_proc = data->mb_nblocks_per_proc;
+    auto& multimeshtypes_per_proc = data->multimeshtypes_per_proc;
+    auto& multivartypes_per_proc = data->multivartypes_per_proc;
+    auto& cloud_names_per_proc = data->cloud_names_per_proc;
+    auto& block_names_per_proc = data->block_names_per_proc;
+    auto& mb_names_per_proc = data->mb_names_per_proc;
+    auto& ucd_mesh_names_per_proc = data->ucd_mesh_names_per_proc;
+    if (mpi_rank == SILO_MPI_ROOT)
+    {
+        nclouds_per_proc.resize(d_finest_ln + 1, std::vector<int>(mpi_nodes));
+        nblocks_per_proc.resize(d_finest_ln + 1, std::vector<int>(mpi_nodes));
+        nmbs_per_proc.resize(d_finest_ln + 1, std::vector<int>(mpi_nodes));
+        nucd_meshes_per_proc.resize(d_finest_ln + 1, std::vector<int>(mpi_nodes));
+        meshtypes_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<int> >(mpi_nodes));
+        vartypes_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<int> >(mpi_nodes));
+        mb_nblocks_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<int> >(mpi_nodes));
+        multimeshtypes_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::vector<int> > >(mpi_nodes));
+        multivartypes_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::vector<int> > >(mpi_nodes));
+        cloud_names_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::string> >(mpi_nodes));
+        block_names_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::string> >(mpi_nodes));
+        mb_names_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::string> >(mpi_nodes));
+        ucd_mesh_names_per_proc.resize(d_finest_ln + 1, std::vector<std::vector<std::string> >(mpi_nodes));
 
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
+        for (int proc = 0; proc < mpi_nodes; ++proc)
+        {
+            const int* int_ptr = int_buf_all.data() + int_displs[proc];
+            const char* char_ptr = char_buf_all.data() + char_displs[proc];
+            const auto unpack_ints = [&int_ptr](std::vector<int>& vals, const int n) {
+                vals.assign(int_ptr, int_ptr + n);
+                int_ptr += n;
+            };
+            const auto unpack_names = [&char_ptr](std::vector<std::string>& names, const int n) {
+                names.resize(n);
+                for (int k = 0; k < n; ++k)
                 {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named " << dirname << std::endl);
+                    names[k].assign(char_ptr);
+                    char_ptr += names[k].size() + 1;
                 }
-
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
+            };
+            for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+            {
+                nclouds_per_proc[ln][proc] = *int_ptr++;
+                nblocks_per_proc[ln][proc] = *int_ptr++;
+                unpack_ints(meshtypes_per_proc[ln][proc], nblocks_per_proc[ln][proc]);
+                unpack_ints(vartypes_per_proc[ln][proc], nblocks_per_proc[ln][proc]);
+                nmbs_per_proc[ln][proc] = *int_ptr++;
+                unpack_ints(mb_nblocks_per_proc[ln][proc], nmbs_per_proc[ln][proc]);
+                multimeshtypes_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
+                multivartypes_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
+                for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
                 {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+                    unpack_ints(multimeshtypes_per_proc[ln][proc][mb], mb_nblocks_per_proc[ln][proc][mb]);
+                    unpack_ints(multivartypes_per_proc[ln][proc][mb], mb_nblocks_per_proc[ln][proc][mb]);
                 }
+                nucd_meshes_per_proc[ln][proc] = *int_ptr++;
+                unpack_names(cloud_names_per_proc[ln][proc], nclouds_per_proc[ln][proc]);
+                unpack_names(block_names_per_proc[ln][proc], nblocks_per_proc[ln][proc]);
+                unpack_names(mb_names_per_proc[ln][proc], nmbs_per_proc[ln][proc]);
+                unpack_names(ucd_mesh_names_per_proc[ln][proc], nucd_meshes_per_proc[ln][proc]);
+            }
+        }
+    }
 
-                build_local_marker_cloud(dbfile,
-                                         dirname,
-                                         nmarks,
-                                         X,
-                                         d_nvars[ln],
-                                         d_var_names[ln],
-                                         d_var_start_depths[ln],
-                                         d_var_plot_depths[ln],
-                                         d_var_depths[ln],
-                                         var_vals,
-                                         time_step_number,
-                                         simulation_time);
+    // Write the plot files, either now or on a separate thread. In the latter
+    // case, the data are written while the computation continues, and the
+    // next call to writePlotData() (or any function that modifies the
+    // registered data) waits for the files to be completed.
+    if (d_use_asynchronous_output)
+    {
+        d_plot_data_thread = std::thread([this, data]() { writePlotFiles(*data); });
+    }
+    else
+    {
+        writePlotFiles(*data);
+        IBTK_MPI::barrier();
+    }
+#else
+    TBOX_WARNING("LSiloDataWriter::writePlotData(): SILO is not installed; cannot write data." << std::endl);
+#endif // if defined(IBTK_HAVE_SILO)
+    return;
+} // writePlotData
 
-                offset += nmarks;
-            }
+void
+LSiloDataWriter::waitForPlotData()
+{
+    if (d_plot_data_thread.joinable()) d_plot_data_thread.join();
+    return;
+} // waitForPlotData
 
-            // Add the local blocks to the local DBfile.
-            for (int block = 0; block < d_nblocks[ln]; ++block)
-            {
-                const IntVector<NDIM>& nelem = d_block_nelems[ln][block];
-                const IntVector<NDIM>& periodic = d_block_periodic[ln][block];
-                const int ntot = nelem.getProduct();
+void
+LSiloDataWriter::putToDatabase(Pointer<Database> db)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(db);
+#endif
+    db->putInteger("LAG_SILO_DATA_WRITER_VERSION", LAG_SILO_DATA_WRITER_VERSION);
 
-                std::string dirname = "level_" + std::to_string(ln) + "_block_" + std::to_string(block);
+    db->putInteger("d_coarsest_ln", d_coarsest_ln);
+    db->putInteger("d_finest_ln", d_finest_ln);
 
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named " << dirname << std::endl);
-                }
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        const std::string ln_string = "_" + std::to_string(ln);
 
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
-                {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
-                }
+        db->putInteger("d_nclouds" + ln_string, d_nclouds[ln]);
+        if (d_nclouds[ln] > 0)
+        {
+            db->putStringArray(
+                "d_cloud_names" + ln_string, &d_cloud_names[ln][0], static_cast<int>(d_cloud_names[ln].size()));
+            db->putIntegerArray(
+                "d_cloud_nmarks" + ln_string, &d_cloud_nmarks[ln][0], static_cast<int>(d_cloud_nmarks[ln].size()));
+            db->putIntegerArray("d_cloud_first_lag_idx" + ln_string,
+                                &d_cloud_first_lag_idx[ln][0],
+                                static_cast<int>(d_cloud_first_lag_idx[ln].size()));
+        }
 
-                build_local_curv_block(dbfile,
-                                       dirname,
-                                       nelem,
-                                       periodic,
-                                       X,
-                                       d_nvars[ln],
-                                       d_var_names[ln],
-                                       d_var_start_depths[ln],
-                                       d_var_plot_depths[ln],
-                                       d_var_depths[ln],
-                                       var_vals,
-                                       time_step_number,
-                                       simulation_time);
-                meshtype[ln].push_back(DB_QUAD_CURV);
-                vartype[ln].push_back(DB_QUADVAR);
+        db->putInteger("d_nblocks" + ln_string, d_nblocks[ln]);
+        if (d_nblocks[ln] > 0)
+        {
+            db->putStringArray(
+                "d_block_names" + ln_string, &d_block_names[ln][0], static_cast<int>(d_block_names[ln].size()));
 
-                offset += ntot;
+            std::vector<int> flattened_block_nelems;
+            flattened_block_nelems.reserve(NDIM * d_block_nelems.size());
+            for (const auto& block : d_block_nelems[ln])
+            {
+                flattened_block_nelems.insert(flattened_block_nelems.end(), &block[0], &block[0] + NDIM);
             }
+            db->putIntegerArray("flattened_block_nelems" + ln_string,
+                                &flattened_block_nelems[0],
+                                static_cast<int>(flattened_block_nelems.size()));
 
-            // Add the local multiblocks to the local DBfile.
-            multimeshtype[ln].resize(d_nmbs[ln]);
-            multivartype[ln].resize(d_nmbs[ln]);
-            for (int mb = 0; mb < d_nmbs[ln]; ++mb)
+            std::vector<int> flattened_block_periodic;
+            flattened_block_periodic.reserve(NDIM * d_block_periodic.size());
+            for (const auto& block : d_block_periodic[ln])
             {
-                for (int block = 0; block < d_mb_nblocks[ln][mb]; ++block)
-                {
-                    const IntVector<NDIM>& nelem = d_mb_nelems[ln][mb][block];
-                    const IntVector<NDIM>& periodic = d_mb_periodic[ln][mb][block];
-                    const int ntot = nelem.getProduct();
+                flattened_block_periodic.insert(flattened_block_periodic.end(), &block[0], &block[0] + NDIM);
+            }
+            db->putIntegerArray("flattened_block_periodic" + ln_string,
+                                &flattened_block_periodic[0],
+                                static_cast<int>(flattened_block_periodic.size()));
 
-                    std::string dirname =
-                        "level_" + std::to_string(ln) + "_mb_" + std::to_string(mb) + "_block_" + std::to_string(block);
+            db->putIntegerArray("d_block_first_lag_idx" + ln_string,
+                                &d_block_first_lag_idx[ln][0],
+                                static_cast<int>(d_block_first_lag_idx[ln].size()));
+        }
 
-                    if (DBMkDir(dbfile, dirname.c_str()) == -1)
+        db->putInteger("d_nmbs" + ln_string, d_nmbs[ln]);
+        if (d_nmbs[ln] > 0)
+        {
+            db->putStringArray("d_mb_names" + ln_string, &d_mb_names[ln][0], static_cast<int>(d_mb_names[ln].size()));
+
+            for (int mb = 0; mb < d_nmbs[ln]; ++mb)
+            {
+                const std::string mb_string = "_" + std::to_string(mb);
+
+                db->putInteger("d_mb_nblocks" + ln_string + mb_string, d_mb_nblocks[ln][mb]);
+                if (d_mb_nblocks[ln][mb] > 0)
+                {
+                    std::vector<int> flattened_mb_nelems;
+                    flattened_mb_nelems.reserve(NDIM * d_mb_nelems.size());
+                    for (const auto& block : d_mb_nelems[ln][mb])
                     {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named " << dirname << std::endl);
+                        flattened_mb_nelems.insert(flattened_mb_nelems.end(), &block[0], &block[0] + NDIM);
                     }
+                    db->putIntegerArray("flattened_mb_nelems" + ln_string + mb_string,
+                                        &flattened_mb_nelems[0],
+                                        static_cast<int>(flattened_mb_nelems.size()));
 
-                    const double* const X = local_X_arr + NDIM * offset;
-                    std::vector<const double*> var_vals(d_nvars[ln]);
-                    for (int v = 0; v < d_nvars[ln]; ++v)
+                    std::vector<int> flattened_mb_periodic;
+                    flattened_mb_periodic.reserve(NDIM * d_mb_periodic.size());
+                    for (const auto& vec : d_mb_periodic[ln][mb])
                     {
-                        var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+                        flattened_mb_periodic.insert(flattened_mb_periodic.end(), &vec[0], &vec[0] + NDIM);
                     }
+                    db->putIntegerArray("flattened_mb_periodic" + ln_string + mb_string,
+                                        &flattened_mb_periodic[0],
+                                        static_cast<int>(flattened_mb_periodic.size()));
 
-                    build_local_curv_block(dbfile,
-                                           dirname,
-                                           nelem,
-                                           periodic,
-                                           X,
-                                           d_nvars[ln],
-                                           d_var_names[ln],
-                                           d_var_start_depths[ln],
-                                           d_var_plot_depths[ln],
-                                           d_var_depths[ln],
-                                           var_vals,
-                                           time_step_number,
-                                           simulation_time);
-                    multimeshtype[ln][mb].push_back(DB_QUAD_CURV);
-                    multivartype[ln][mb].push_back(DB_QUADVAR);
-
-                    offset += ntot;
+                    db->putIntegerArray("d_mb_first_lag_idx" + ln_string + mb_string,
+                                        &d_mb_first_lag_idx[ln][mb][0],
+                                        static_cast<int>(d_mb_first_lag_idx[ln][mb].size()));
                 }
             }
+        }
+
+        db->putInteger("d_nucd_meshes" + ln_string, d_nucd_meshes[ln]);
+        if (d_nucd_meshes[ln] > 0)
+        {
+            db->putStringArray("d_ucd_mesh_names" + ln_string,
+                               &d_ucd_mesh_names[ln][0],
+                               static_cast<int>(d_ucd_mesh_names[ln].size()));
 
-            // Add the local UCD meshes to the local DBfile.
             for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
             {
-                const std::set<int>& vertices = d_ucd_mesh_vertices[ln][mesh];
-                const std::multimap<int, std::pair<int, int> >& edge_map = d_ucd_mesh_edge_maps[ln][mesh];
-                const size_t ntot = vertices.size();
-
-                std::string dirname = "level_" + std::to_string(ln) + "_mesh_" + std::to_string(mesh);
+                const std::string mesh_string = "_" + std::to_string(mesh);
 
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
+                std::vector<int> ucd_mesh_vertices_vector;
+                ucd_mesh_vertices_vector.reserve(d_ucd_mesh_vertices[ln][mesh].size());
+                for (const auto& vertex : d_ucd_mesh_vertices[ln][mesh])
                 {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named " << dirname << std::endl);
+                    ucd_mesh_vertices_vector.push_back(vertex);
                 }
+                db->putInteger("ucd_mesh_vertices_vector.size()" + ln_string + mesh_string,
+                               static_cast<int>(ucd_mesh_vertices_vector.size()));
+                db->putIntegerArray("ucd_mesh_vertices_vector" + ln_string + mesh_string,
+                                    &ucd_mesh_vertices_vector[0],
+                                    static_cast<int>(ucd_mesh_vertices_vector.size()));
 
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
+                std::vector<int> ucd_mesh_edge_maps_vector;
+                ucd_mesh_edge_maps_vector.reserve(3 * d_ucd_mesh_edge_maps[ln][mesh].size());
+                for (const auto& edge_pair : d_ucd_mesh_edge_maps[ln][mesh])
                 {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+                    const int i = edge_pair.first;
+                    std::pair<int, int> e = edge_pair.second;
+                    ucd_mesh_edge_maps_vector.push_back(i);
+                    ucd_mesh_edge_maps_vector.push_back(e.first);
+                    ucd_mesh_edge_maps_vector.push_back(e.second);
                 }
-
-                build_local_ucd_mesh(dbfile,
-                                     dirname,
-                                     vertices,
-                                     edge_map,
-                                     X,
-                                     d_nvars[ln],
-                                     d_var_names[ln],
-                                     d_var_start_depths[ln],
-                                     d_var_plot_depths[ln],
-                                     d_var_depths[ln],
-                                     var_vals,
-                                     time_step_number,
-                                     simulation_time);
-
-                offset += ntot;
-            }
-
-            // Clean up allocated data.
-            ierr = VecRestoreArray(local_X_vec, &local_X_arr);
-            IBTK_CHKERRQ(ierr);
-            ierr = VecDestroy(&local_X_vec);
-            IBTK_CHKERRQ(ierr);
-            for (int v = 0; v < d_nvars[ln]; ++v)
-            {
-                ierr = VecRestoreArray(local_v_vecs[v], &local_v_arrs[v]);
-                IBTK_CHKERRQ(ierr);
-                ierr = VecDestroy(&local_v_vecs[v]);
-                IBTK_CHKERRQ(ierr);
+                db->putInteger("ucd_mesh_edge_maps_vector.size()" + ln_string + mesh_string,
+                               static_cast<int>(ucd_mesh_edge_maps_vector.size()));
+                db->putIntegerArray("ucd_mesh_edge_maps_vector" + ln_string + mesh_string,
+                                    &ucd_mesh_edge_maps_vector[0],
+                                    static_cast<int>(ucd_mesh_edge_maps_vector.size()));
             }
         }
     }
+    return;
+} // putToDatabase
 
-    DBClose(dbfile);
+/////////////////////////////// PROTECTED ////////////////////////////////////
 
-    // Send data to the root MPI process required to create the multimesh and
-    // multivar objects.
-    std::vector<std::vector<int> > nclouds_per_proc, nblocks_per_proc, nmbs_per_proc, nucd_meshes_per_proc;
-    std::vector<std::vector<std::vector<int> > > meshtypes_per_proc, vartypes_per_proc, mb_nblocks_per_proc;
-    std::vector<std::vector<std::vector<std::vector<int> > > > multimeshtypes_per_proc, multivartypes_per_proc;
-    std::vector<std::vector<std::vector<std::string> > > cloud_names_per_proc, block_names_per_proc, mb_names_per_proc,
-        ucd_mesh_names_per_proc;
+/////////////////////////////// PRIVATE //////////////////////////////////////
+void
+LSiloDataWriter::writePlotFiles(const PlotData& data)
+{
+#if defined(IBTK_HAVE_SILO)
+    char temp_buf[SILO_NAME_BUFSIZE];
+    std::string current_file_name;
+    DBfile* dbfile;
+    const auto& nclouds_per_proc = data.nclouds_per_proc;
+    const auto& nblocks_per_proc = data.nblocks_per_proc;
+    const auto& nmbs_per_proc = data.nmbs_per_proc;
+    const auto& nucd_meshes_per_proc = data.nucd_meshes_per_proc;
+    const auto& multimeshtypes_per_proc = data.multimeshtypes_per_proc;
+    const auto& multivartypes_per_proc = data.multivartypes_per_proc;
+    const auto& meshtypes_per_proc = data.meshtypes_per_proc;
+    const auto& vartypes_per_proc = data.vartypes_per_proc;
+    const auto& mb_nblocks_per_proc = data.mb_nblocks_per_proc;
+    const auto& cloud_names_per_proc = data.cloud_names_per_proc;
+    const auto& block_names_per_proc = data.block_names_per_proc;
+    const auto& mb_names_per_proc = data.mb_names_per_proc;
+    const auto& ucd_mesh_names_per_proc = data.ucd_mesh_names_per_proc;
 
-    if (mpi_rank == SILO_MPI_ROOT)
+    // Create one local DBfile per MPI process.
+    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", data.mpi_rank);
+    current_file_name = data.dump_dirname + "/" + SILO_PROCESSOR_FILE_PREFIX;
+    current_file_name += temp_buf;
+    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+
+    // Silo only supports compression with the HDF5 driver. The compression
+    // settings are global, so they are only in effect while the local file is
+    // being written.
+    const bool use_compression = !d_compression.empty();
+    if (use_compression) DBSetCompression(d_compression.c_str());
+    if (!(dbfile = DBCreate(
+              current_file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, use_compression ? DB_HDF5 : DB_PDB)))
     {
-        nclouds_per_proc.resize(d_finest_ln + 1);
-        nblocks_per_proc.resize(d_finest_ln + 1);
-        nmbs_per_proc.resize(d_finest_ln + 1);
-        nucd_meshes_per_proc.resize(d_finest_ln + 1);
-        meshtypes_per_proc.resize(d_finest_ln + 1);
-        vartypes_per_proc.resize(d_finest_ln + 1);
-        mb_nblocks_per_proc.resize(d_finest_ln + 1);
-        multimeshtypes_per_proc.resize(d_finest_ln + 1);
-        multivartypes_per_proc.resize(d_finest_ln + 1);
-        cloud_names_per_proc.resize(d_finest_ln + 1);
-        block_names_per_proc.resize(d_finest_ln + 1);
-        mb_names_per_proc.resize(d_finest_ln + 1);
-        ucd_mesh_names_per_proc.resize(d_finest_ln + 1);
+        TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                 << "  Could not create DBfile named " << current_file_name << std::endl);
     }
 
+    // Set the local data.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        if (mpi_rank == SILO_MPI_ROOT)
-        {
-            nclouds_per_proc[ln].resize(mpi_nodes);
-            nblocks_per_proc[ln].resize(mpi_nodes);
-            nmbs_per_proc[ln].resize(mpi_nodes);
-            nucd_meshes_per_proc[ln].resize(mpi_nodes);
-            meshtypes_per_proc[ln].resize(mpi_nodes);
-            vartypes_per_proc[ln].resize(mpi_nodes);
-            mb_nblocks_per_proc[ln].resize(mpi_nodes);
-            multimeshtypes_per_proc[ln].resize(mpi_nodes);
-            multivartypes_per_proc[ln].resize(mpi_nodes);
-            cloud_names_per_proc[ln].resize(mpi_nodes);
-            block_names_per_proc[ln].resize(mpi_nodes);
-            mb_names_per_proc[ln].resize(mpi_nodes);
-            ucd_mesh_names_per_proc[ln].resize(mpi_nodes);
-
-            // Set the values for the root process.
-            nclouds_per_proc[ln][mpi_rank] = d_nclouds[ln];
-            nblocks_per_proc[ln][mpi_rank] = d_nblocks[ln];
-            nmbs_per_proc[ln][mpi_rank] = d_nmbs[ln];
-            nucd_meshes_per_proc[ln][mpi_rank] = d_nucd_meshes[ln];
-            meshtypes_per_proc[ln][mpi_rank] = meshtype[ln];
-            vartypes_per_proc[ln][mpi_rank] = vartype[ln];
-            mb_nblocks_per_proc[ln][mpi_rank] = d_mb_nblocks[ln];
-            multimeshtypes_per_proc[ln][mpi_rank] = multimeshtype[ln];
-            multivartypes_per_proc[ln][mpi_rank] = multivartype[ln];
-            cloud_names_per_proc[ln][mpi_rank] = d_cloud_names[ln];
-            block_names_per_proc[ln][mpi_rank] = d_block_names[ln];
-            mb_names_per_proc[ln][mpi_rank] = d_mb_names[ln];
-            ucd_mesh_names_per_proc[ln][mpi_rank] = d_ucd_mesh_names[ln];
-        }
-
-        // Get the values for the non-root processes.
-        int one = 1;
-        for (int proc = 0; proc < mpi_nodes; ++proc)
+        if (data.has_coords_data[ln])
         {
-            // Skip the root process; we already have those values.
-            if (proc == SILO_MPI_ROOT)
+            const double* const local_X_arr = data.X_data[ln].data();
+            std::vector<const double*> local_v_arrs(d_nvars[ln]);
+            for (int v = 0; v < d_nvars[ln]; ++v)
             {
-                proc += 1;
-                if (proc >= mpi_nodes) break;
+                local_v_arrs[v] = data.var_data[ln][v].data();
             }
 
-            if (mpi_rank == proc)
-            {
-                IBTK_MPI::send(&d_nclouds[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                IBTK_MPI::recv(&nclouds_per_proc[ln][proc], one, proc, false);
-            }
+            // Keep track of the current offset in the local Vec data.
+            int offset = 0;
 
-            if (mpi_rank == proc && d_nclouds[ln] > 0)
+            // Add the local clouds to the local DBfile.
+            for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
             {
-                int num_bytes;
-                for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
+                const int nmarks = d_cloud_nmarks[ln][cloud];
+
+                std::string dirname = "level_" + std::to_string(ln) + "_cloud_" + std::to_string(cloud);
+
+                if (DBMkDir(dbfile, dirname.c_str()) == -1)
                 {
-                    num_bytes = static_cast<int>((d_cloud_names[ln][cloud].size() + 1) * sizeof(char));
-                    IBTK_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-                    IBTK_MPI::sendBytes(
-                        static_cast<const void*>(d_cloud_names[ln][cloud].c_str()), num_bytes, SILO_MPI_ROOT);
+                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                             << "  Could not create directory named " << dirname << std::endl);
                 }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nclouds_per_proc[ln][proc] > 0)
-            {
-                cloud_names_per_proc[ln][proc].resize(nclouds_per_proc[ln][proc]);
 
-                int num_bytes;
-                for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
+                const double* const X = local_X_arr + NDIM * offset;
+                std::vector<const double*> var_vals(d_nvars[ln]);
+                for (int v = 0; v < d_nvars[ln]; ++v)
                 {
-                    IBTK_MPI::recv(&num_bytes, one, proc, false);
-                    std::vector<char> name(num_bytes / sizeof(char));
-                    IBTK_MPI::recvBytes(static_cast<void*>(name.data()), num_bytes);
-                    cloud_names_per_proc[ln][proc][cloud].assign(name.data());
+                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
                 }
-            }
 
-            if (mpi_rank == proc)
-            {
-                IBTK_MPI::send(&d_nblocks[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                IBTK_MPI::recv(&nblocks_per_proc[ln][proc], one, proc, false);
+                build_local_marker_cloud(dbfile,
+                                         dirname,
+                                         nmarks,
+                                         X,
+                                         d_nvars[ln],
+                                         d_var_names[ln],
+                                         d_var_start_depths[ln],
+                                         d_var_plot_depths[ln],
+                                         d_var_depths[ln],
+                                         var_vals,
+                                         data.time_step_number,
+                                         data.simulation_time);
+
+                offset += nmarks;
             }
 
-            if (mpi_rank == proc && d_nblocks[ln] > 0)
+            // Add the local blocks to the local DBfile.
+            for (int block = 0; block < d_nblocks[ln]; ++block)
             {
-                IBTK_MPI::send(&meshtype[ln][0], d_nblocks[ln], SILO_MPI_ROOT, false);
-                IBTK_MPI::send(&vartype[ln][0], d_nblocks[ln], SILO_MPI_ROOT, false);
+                const IntVector<NDIM>& nelem = d_block_nelems[ln][block];
+                const IntVector<NDIM>& periodic = d_block_periodic[ln][block];
+                const int ntot = nelem.getProduct();
+
+                std::string dirname = "level_" + std::to_string(ln) + "_block_" + std::to_string(block);
 
-                int num_bytes;
-                for (int block = 0; block < d_nblocks[ln]; ++block)
+                if (DBMkDir(dbfile, dirname.c_str()) == -1)
                 {
-                    num_bytes = static_cast<int>((d_block_names[ln][block].size() + 1) * sizeof(char));
-                    IBTK_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-                    IBTK_MPI::sendBytes(
-                        static_cast<const void*>(d_block_names[ln][block].c_str()), num_bytes, SILO_MPI_ROOT);
+                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                             << "  Could not create directory named " << dirname << std::endl);
                 }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nblocks_per_proc[ln][proc] > 0)
-            {
-                meshtypes_per_proc[ln][proc].resize(nblocks_per_proc[ln][proc]);
-                vartypes_per_proc[ln][proc].resize(nblocks_per_proc[ln][proc]);
-                block_names_per_proc[ln][proc].resize(nblocks_per_proc[ln][proc]);
 
-                IBTK_MPI::recv(&meshtypes_per_proc[ln][proc][0], nblocks_per_proc[ln][proc], proc, false);
-                IBTK_MPI::recv(&vartypes_per_proc[ln][proc][0], nblocks_per_proc[ln][proc], proc, false);
-
-                int num_bytes;
-                for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
+                const double* const X = local_X_arr + NDIM * offset;
+                std::vector<const double*> var_vals(d_nvars[ln]);
+                for (int v = 0; v < d_nvars[ln]; ++v)
                 {
-                    IBTK_MPI::recv(&num_bytes, one, proc, false);
-                    std::vector<char> name(num_bytes / sizeof(char));
-                    IBTK_MPI::recvBytes(static_cast<void*>(name.data()), num_bytes);
-                    block_names_per_proc[ln][proc][block].assign(name.data());
+                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
                 }
-            }
 
-            if (mpi_rank == proc)
-            {
-                IBTK_MPI::send(&d_nmbs[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                IBTK_MPI::recv(&nmbs_per_proc[ln][proc], one, proc, false);
+                build_local_curv_block(dbfile,
+                                       dirname,
+                                       nelem,
+                                       periodic,
+                                       X,
+                                       d_nvars[ln],
+                                       d_var_names[ln],
+                                       d_var_start_depths[ln],
+                                       d_var_plot_depths[ln],
+                                       d_var_depths[ln],
+                                       var_vals,
+                                       data.time_step_number,
+                                       data.simulation_time);
+
+                offset += ntot;
             }
 
-            if (mpi_rank == proc && d_nmbs[ln] > 0)
+            // Add the local multiblocks to the local DBfile.
+            for (int mb = 0; mb < d_nmbs[ln]; ++mb)
             {
-                IBTK_MPI::send(&d_mb_nblocks[ln][0], d_nmbs[ln], SILO_MPI_ROOT, false);
-
-                int num_bytes;
-                for (int mb = 0; mb < d_nmbs[ln]; ++mb)
+                for (int block = 0; block < d_mb_nblocks[ln][mb]; ++block)
                 {
-                    IBTK_MPI::send(&multimeshtype[ln][mb][0], d_mb_nblocks[ln][mb], SILO_MPI_ROOT, false);
-                    IBTK_MPI::send(&multivartype[ln][mb][0], d_mb_nblocks[ln][mb], SILO_MPI_ROOT, false);
-
-                    num_bytes = static_cast<int>(d_mb_names[ln][mb].size()) + 1;
-                    IBTK_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-
-                    const void* mb_name_ptr = d_mb_names[ln][mb].c_str();
-                    MPI_Send(const_cast<void*>(mb_name_ptr),
-                             num_bytes,
-                             MPI_CHAR,
-                             SILO_MPI_ROOT,
-                             SILO_MPI_TAG,
-                             IBTK_MPI::getCommunicator());
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nmbs_per_proc[ln][proc] > 0)
-            {
-                mb_nblocks_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-                multimeshtypes_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-                multivartypes_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-                mb_names_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-
-                IBTK_MPI::recv(&mb_nblocks_per_proc[ln][proc][0], nmbs_per_proc[ln][proc], proc, false);
+                    const IntVector<NDIM>& nelem = d_mb_nelems[ln][mb][block];
+                    const IntVector<NDIM>& periodic = d_mb_periodic[ln][mb][block];
+                    const int ntot = nelem.getProduct();
 
-                int num_bytes;
-                for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
-                {
-                    multimeshtypes_per_proc[ln][proc][mb].resize(mb_nblocks_per_proc[ln][proc][mb]);
-                    multivartypes_per_proc[ln][proc][mb].resize(mb_nblocks_per_proc[ln][proc][mb]);
+                    std::string dirname =
+                        "level_" + std::to_string(ln) + "_mb_" + std::to_string(mb) + "_block_" + std::to_string(block);
 
-                    IBTK_MPI::recv(
-                        &multimeshtypes_per_proc[ln][proc][mb][0], mb_nblocks_per_proc[ln][proc][mb], proc, false);
-                    IBTK_MPI::recv(
-                        &multivartypes_per_proc[ln][proc][mb][0], mb_nblocks_per_proc[ln][proc][mb], proc, false);
+                    if (DBMkDir(dbfile, dirname.c_str()) == -1)
+                    {
+                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                                 << "  Could not create directory named " << dirname << std::endl);
+                    }
 
-                    IBTK_MPI::recv(&num_bytes, one, proc, false);
-                    std::vector<char> name(num_bytes / sizeof(char));
+                    const double* const X = local_X_arr + NDIM * offset;
+                    std::vector<const double*> var_vals(d_nvars[ln]);
+                    for (int v = 0; v < d_nvars[ln]; ++v)
+                    {
+                        var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+                    }
 
-                    MPI_Status status;
-                    MPI_Recv(
-                        name.data(), num_bytes, MPI_CHAR, proc, SILO_MPI_TAG, IBTK_MPI::getCommunicator(), &status);
+                    build_local_curv_block(dbfile,
+                                           dirname,
+                                           nelem,
+                                           periodic,
+                                           X,
+                                           d_nvars[ln],
+                                           d_var_names[ln],
+                                           d_var_start_depths[ln],
+                                           d_var_plot_depths[ln],
+                                           d_var_depths[ln],
+                                           var_vals,
+                                           data.time_step_number,
+                                           data.simulation_time);
 
-                    mb_names_per_proc[ln][proc][mb].assign(name.data());
+                    offset += ntot;
                 }
             }
 
-            if (mpi_rank == proc)
-            {
-                IBTK_MPI::send(&d_nucd_meshes[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
+            // Add the local UCD meshes to the local DBfile.
+            for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
             {
-                IBTK_MPI::recv(&nucd_meshes_per_proc[ln][proc], one, proc, false);
-            }
+                const std::set<int>& vertices = d_ucd_mesh_vertices[ln][mesh];
+                const std::multimap<int, std::pair<int, int> >& edge_map = d_ucd_mesh_edge_maps[ln][mesh];
+                const size_t ntot = vertices.size();
 
-            if (mpi_rank == proc && d_nucd_meshes[ln] > 0)
-            {
-                int num_bytes;
-                for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
+                std::string dirname = "level_" + std::to_string(ln) + "_mesh_" + std::to_string(mesh);
+
+                if (DBMkDir(dbfile, dirname.c_str()) == -1)
                 {
-                    num_bytes = static_cast<int>((d_ucd_mesh_names[ln][mesh].size() + 1) * sizeof(char));
-                    IBTK_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-                    IBTK_MPI::sendBytes(
-                        static_cast<const void*>(d_ucd_mesh_names[ln][mesh].c_str()), num_bytes, SILO_MPI_ROOT);
+                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                                             << "  Could not create directory named " << dirname << std::endl);
                 }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nucd_meshes_per_proc[ln][proc] > 0)
-            {
-                ucd_mesh_names_per_proc[ln][proc].resize(nucd_meshes_per_proc[ln][proc]);
-                int num_bytes;
-                for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
+
+                const double* const X = local_X_arr + NDIM * offset;
+                std::vector<const double*> var_vals(d_nvars[ln]);
+                for (int v = 0; v < d_nvars[ln]; ++v)
                 {
-                    IBTK_MPI::recv(&num_bytes, one, proc, false);
-                    std::vector<char> name(num_bytes / sizeof(char));
-                    IBTK_MPI::recvBytes(static_cast<void*>(name.data()), num_bytes);
-                    ucd_mesh_names_per_proc[ln][proc][mesh].assign(name.data());
+                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
                 }
-            }
 
-            IBTK_MPI::barrier();
+                build_local_ucd_mesh(dbfile,
+                                     dirname,
+                                     vertices,
+                                     edge_map,
+                                     X,
+                                     d_nvars[ln],
+                                     d_var_names[ln],
+                                     d_var_start_depths[ln],
+                                     d_var_plot_depths[ln],
+                                     d_var_depths[ln],
+                                     var_vals,
+                                     data.time_step_number,
+                                     data.simulation_time);
+
+                offset += ntot;
+            }
         }
     }
 
-    if (mpi_rank == SILO_MPI_ROOT)
+    DBClose(dbfile);
+    if (use_compression) DBSetCompression(nullptr);
+
+    if (data.mpi_rank == SILO_MPI_ROOT)
     {
         // Create and initialize the multimesh Silo database on the root MPI
         // process.
-        std::snprintf(temp_buf, sizeof(temp_buf), "%06d", d_time_step_number);
+        std::snprintf(temp_buf, sizeof(temp_buf), "%06d", data.time_step_number);
         std::string summary_file_name =
-            dump_dirname + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
+            data.dump_dirname + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
         if (!(dbfile = DBCreate(summary_file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, DB_PDB)))
         {
             TBOX_ERROR(d_object_name << "::writePlotData()\n"
                                      << "  Could not create DBfile named " << summary_file_name << std::endl);
         }
 
-        int cycle = time_step_number;
-        auto time = static_cast<float>(simulation_time);
-        double dtime = simulation_time;
+        int cycle = data.time_step_number;
+        auto time = static_cast<float>(data.simulation_time);
+        double dtime = data.simulation_time;
 
         static const int MAX_OPTS = 3;
         DBoptlist* optlist = DBMakeOptlist(MAX_OPTS);
@@ -1729,7 +1908,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
         DBAddOption(optlist, DBOPT_TIME, &time);
         DBAddOption(optlist, DBOPT_DTIME, &dtime);
 
-        for (int proc = 0; proc < mpi_nodes; ++proc)
+        for (int proc = 0; proc < data.mpi_nodes; ++proc)
         {
             for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
             {
@@ -1745,7 +1924,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                     auto meshname_ptr = const_cast<char*>(meshname.c_str());
                     int meshtype = DB_POINTMESH;
 
-                    std::string& cloud_name = cloud_names_per_proc[ln][proc][cloud];
+                    const std::string& cloud_name = cloud_names_per_proc[ln][proc][cloud];
 
                     DBPutMultimesh(dbfile, cloud_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
 
@@ -1768,7 +1947,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                     auto meshname_ptr = const_cast<char*>(meshname.c_str());
                     int meshtype = meshtypes_per_proc[ln][proc][block];
 
-                    std::string& block_name = block_names_per_proc[ln][proc][block];
+                    const std::string& block_name = block_names_per_proc[ln][proc][block];
 
                     DBPutMultimesh(dbfile, block_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
 
@@ -1799,13 +1978,13 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                         meshnames_ptrs.push_back(meshnames[block].c_str());
                     }
 
-                    std::string& mb_name = mb_names_per_proc[ln][proc][mb];
+                    const std::string& mb_name = mb_names_per_proc[ln][proc][mb];
 
                     DBPutMultimesh(dbfile,
                                    mb_name.c_str(),
                                    nblocks,
                                    meshnames_ptrs.data(),
-                                   &multimeshtypes_per_proc[ln][proc][mb][0],
+                                   const_cast<int*>(multimeshtypes_per_proc[ln][proc][mb].data()),
                                    optlist);
 
                     if (DBMkDir(dbfile, mb_name.c_str()) == -1)
@@ -1827,7 +2006,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                     auto meshname_ptr = const_cast<char*>(meshname.c_str());
                     int meshtype = DB_UCDMESH;
 
-                    std::string& mesh_name = ucd_mesh_names_per_proc[ln][proc][mesh];
+                    const std::string& mesh_name = ucd_mesh_names_per_proc[ln][proc][mesh];
 
                     DBPutMultimesh(dbfile, mesh_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
 
@@ -1852,7 +2031,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                         auto varname_ptr = const_cast<char*>(varname.c_str());
                         int vartype = DB_POINTVAR;
 
-                        std::string& cloud_name = cloud_names_per_proc[ln][proc][cloud];
+                        const std::string& cloud_name = cloud_names_per_proc[ln][proc][cloud];
 
                         std::string var_name = cloud_name + "/" + d_var_names[ln][v];
 
@@ -1871,7 +2050,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                         auto varname_ptr = const_cast<char*>(varname.c_str());
                         int vartype = vartypes_per_proc[ln][proc][block];
 
-                        std::string& block_name = block_names_per_proc[ln][proc][block];
+                        const std::string& block_name = block_names_per_proc[ln][proc][block];
 
                         std::string var_name = block_name + "/" + d_var_names[ln][v];
 
@@ -1900,7 +2079,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                             varnames_ptrs.push_back(varnames[block].c_str());
                         }
 
-                        std::string& mb_name = mb_names_per_proc[ln][proc][mb];
+                        const std::string& mb_name = mb_names_per_proc[ln][proc][mb];
 
                         std::string var_name = mb_name + "/" + d_var_names[ln][v];
 
@@ -1908,7 +2087,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                                       var_name.c_str(),
                                       nblocks,
                                       varnames_ptrs.data(),
-                                      &multivartypes_per_proc[ln][proc][mb][0],
+                                      const_cast<int*>(multivartypes_per_proc[ln][proc][mb].data()),
                                       optlist);
                     }
 
@@ -1924,7 +2103,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                         auto varname_ptr = const_cast<char*>(varname.c_str());
                         int vartype = DB_UCDVAR;
 
-                        std::string& mesh_name = ucd_mesh_names_per_proc[ln][proc][mesh];
+                        const std::string& mesh_name = ucd_mesh_names_per_proc[ln][proc][mesh];
 
                         std::string var_name = mesh_name + "/" + d_var_names[ln][v];
 
@@ -1940,9 +2119,9 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
         // Create or update the dumps file on the root MPI process.
         static bool summary_file_opened = false;
         std::string path = d_dump_directory_name + "/" + VISIT_DUMPS_FILENAME;
-        std::snprintf(temp_buf, sizeof(temp_buf), "%06d", d_time_step_number);
+        std::snprintf(temp_buf, sizeof(temp_buf), "%06d", data.time_step_number);
         std::string file =
-            current_dump_directory_name + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
+            data.current_dump_directory_name + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
         if (!summary_file_opened)
         {
             summary_file_opened = true;
@@ -1957,157 +2136,12 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
             sfile.close();
         }
     }
-    IBTK_MPI::barrier();
 #else
-    TBOX_WARNING("LSiloDataWriter::writePlotData(): SILO is not installed; cannot write data." << std::endl);
+    NULL_USE(data);
 #endif // if defined(IBTK_HAVE_SILO)
     return;
-} // writePlotData
-
-void
-LSiloDataWriter::putToDatabase(Pointer<Database> db)
-{
-#if !defined(NDEBUG)
-    TBOX_ASSERT(db);
-#endif
-    db->putInteger("LAG_SILO_DATA_WRITER_VERSION", LAG_SILO_DATA_WRITER_VERSION);
-
-    db->putInteger("d_coarsest_ln", d_coarsest_ln);
-    db->putInteger("d_finest_ln", d_finest_ln);
-
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        const std::string ln_string = "_" + std::to_string(ln);
-
-        db->putInteger("d_nclouds" + ln_string, d_nclouds[ln]);
-        if (d_nclouds[ln] > 0)
-        {
-            db->putStringArray(
-                "d_cloud_names" + ln_string, &d_cloud_names[ln][0], static_cast<int>(d_cloud_names[ln].size()));
-            db->putIntegerArray(
-                "d_cloud_nmarks" + ln_string, &d_cloud_nmarks[ln][0], static_cast<int>(d_cloud_nmarks[ln].size()));
-            db->putIntegerArray("d_cloud_first_lag_idx" + ln_string,
-                                &d_cloud_first_lag_idx[ln][0],
-                                static_cast<int>(d_cloud_first_lag_idx[ln].size()));
-        }
-
-        db->putInteger("d_nblocks" + ln_string, d_nblocks[ln]);
-        if (d_nblocks[ln] > 0)
-        {
-            db->putStringArray(
-                "d_block_names" + ln_string, &d_block_names[ln][0], static_cast<int>(d_block_names[ln].size()));
-
-            std::vector<int> flattened_block_nelems;
-            flattened_block_nelems.reserve(NDIM * d_block_nelems.size());
-            for (const auto& block : d_block_nelems[ln])
-            {
-                flattened_block_nelems.insert(flattened_block_nelems.end(), &block[0], &block[0] + NDIM);
-            }
-            db->putIntegerArray("flattened_block_nelems" + ln_string,
-                                &flattened_block_nelems[0],
-                                static_cast<int>(flattened_block_nelems.size()));
-
-            std::vector<int> flattened_block_periodic;
-            flattened_block_periodic.reserve(NDIM * d_block_periodic.size());
-            for (const auto& block : d_block_periodic[ln])
-            {
-                flattened_block_periodic.insert(flattened_block_periodic.end(), &block[0], &block[0] + NDIM);
-            }
-            db->putIntegerArray("flattened_block_periodic" + ln_string,
-                                &flattened_block_periodic[0],
-                                static_cast<int>(flattened_block_periodic.size()));
-
-            db->putIntegerArray("d_block_first_lag_idx" + ln_string,
-                                &d_block_first_lag_idx[ln][0],
-                                static_cast<int>(d_block_first_lag_idx[ln].size()));
-        }
-
-        db->putInteger("d_nmbs" + ln_string, d_nmbs[ln]);
-        if (d_nmbs[ln] > 0)
-        {
-            db->putStringArray("d_mb_names" + ln_string, &d_mb_names[ln][0], static_cast<int>(d_mb_names[ln].size()));
-
-            for (int mb = 0; mb < d_nmbs[ln]; ++mb)
-            {
-                const std::string mb_string = "_" + std::to_string(mb);
-
-                db->putInteger("d_mb_nblocks" + ln_string + mb_string, d_mb_nblocks[ln][mb]);
-                if (d_mb_nblocks[ln][mb] > 0)
-                {
-                    std::vector<int> flattened_mb_nelems;
-                    flattened_mb_nelems.reserve(NDIM * d_mb_nelems.size());
-                    for (const auto& block : d_mb_nelems[ln][mb])
-                    {
-                        flattened_mb_nelems.insert(flattened_mb_nelems.end(), &block[0], &block[0] + NDIM);
-                    }
-                    db->putIntegerArray("flattened_mb_nelems" + ln_string + mb_string,
-                                        &flattened_mb_nelems[0],
-                                        static_cast<int>(flattened_mb_nelems.size()));
-
-                    std::vector<int> flattened_mb_periodic;
-                    flattened_mb_periodic.reserve(NDIM * d_mb_periodic.size());
-                    for (const auto& vec : d_mb_periodic[ln][mb])
-                    {
-                        flattened_mb_periodic.insert(flattened_mb_periodic.end(), &vec[0], &vec[0] + NDIM);
-                    }
-                    db->putIntegerArray("flattened_mb_periodic" + ln_string + mb_string,
-                                        &flattened_mb_periodic[0],
-                                        static_cast<int>(flattened_mb_periodic.size()));
-
-                    db->putIntegerArray("d_mb_first_lag_idx" + ln_string + mb_string,
-                                        &d_mb_first_lag_idx[ln][mb][0],
-                                        static_cast<int>(d_mb_first_lag_idx[ln][mb].size()));
-                }
-            }
-        }
-
-        db->putInteger("d_nucd_meshes" + ln_string, d_nucd_meshes[ln]);
-        if (d_nucd_meshes[ln] > 0)
-        {
-            db->putStringArray("d_ucd_mesh_names" + ln_string,
-                               &d_ucd_mesh_names[ln][0],
-                               static_cast<int>(d_ucd_mesh_names[ln].size()));
-
-            for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
-            {
-                const std::string mesh_string = "_" + std::to_string(mesh);
-
-                std::vector<int> ucd_mesh_vertices_vector;
-                ucd_mesh_vertices_vector.reserve(d_ucd_mesh_vertices[ln][mesh].size());
-                for (const auto& vertex : d_ucd_mesh_vertices[ln][mesh])
-                {
-                    ucd_mesh_vertices_vector.push_back(vertex);
-                }
-                db->putInteger("ucd_mesh_vertices_vector.size()" + ln_string + mesh_string,
-                               static_cast<int>(ucd_mesh_vertices_vector.size()));
-                db->putIntegerArray("ucd_mesh_vertices_vector" + ln_string + mesh_string,
-                                    &ucd_mesh_vertices_vector[0],
-                                    static_cast<int>(ucd_mesh_vertices_vector.size()));
-
-                std::vector<int> ucd_mesh_edge_maps_vector;
-                ucd_mesh_edge_maps_vector.reserve(3 * d_ucd_mesh_edge_maps[ln][mesh].size());
-                for (const auto& edge_pair : d_ucd_mesh_edge_maps[ln][mesh])
-                {
-                    const int i = edge_pair.first;
-                    std::pair<int, int> e = edge_pair.second;
-                    ucd_mesh_edge_maps_vector.push_back(i);
-                    ucd_mesh_edge_maps_vector.push_back(e.first);
-                    ucd_mesh_edge_maps_vector.push_back(e.second);
-                }
-                db->putInteger("ucd_mesh_edge_maps_vector.size()" + ln_string + mesh_string,
-                               static_cast<int>(ucd_mesh_edge_maps_vector.size()));
-                db->putIntegerArray("ucd_mesh_edge_maps_vector" + ln_string + mesh_string,
-                                    &ucd_mesh_edge_maps_vector[0],
-                                    static_cast<int>(ucd_mesh_edge_maps_vector.size()));
-            }
-        }
-    }
-    return;
-} // putToDatabase
+} // writePlotFiles
 
-/////////////////////////////// PROTECTED ////////////////////////////////////
-
-/////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
 LSiloDataWriter::buildVecScatters(AO& ao, const int level_number)
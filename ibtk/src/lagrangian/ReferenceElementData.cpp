@@ -0,0 +1,153 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/ReferenceElementData.h"
+#include "ibtk/libmesh_utilities.h"
+
+#include "tbox/Utilities.h"
+
+#include <libmesh/enum_fe_family.h>
+#include <libmesh/enum_order.h>
+#include <libmesh/enum_quadrature_type.h>
+#include <libmesh/fe.h>
+#include <libmesh/quadrature.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+using table_key_type = std::pair<ReferenceElementData::key_type, libMesh::ElemType>;
+
+std::mutex&
+get_table_mutex()
+{
+    static std::mutex table_mutex;
+    return table_mutex;
+}
+
+std::map<table_key_type, std::shared_ptr<const ReferenceElementData> >&
+get_table()
+{
+    static std::map<table_key_type, std::shared_ptr<const ReferenceElementData> > table;
+    return table;
+}
+
+template <int dim>
+void
+tabulate_shape_functions(const libMesh::ElemType elem_type,
+                         const unsigned int n_nodes,
+                         const std::vector<libMesh::Point>& q_points,
+                         std::vector<double>& phi,
+                         std::array<std::vector<double>, LIBMESH_DIM>& dphi)
+{
+    using FE = libMesh::FE<dim, libMesh::LAGRANGE>;
+    const libMesh::Order elem_order = get_default_order(elem_type);
+    const std::size_t n_qp = q_points.size();
+    phi.resize(n_nodes * n_qp);
+    for (unsigned int d = 0; d < dim; ++d) dphi[d].resize(n_nodes * n_qp);
+    for (unsigned int i = 0; i < n_nodes; ++i)
+    {
+        for (std::size_t q = 0; q < n_qp; ++q)
+        {
+            phi[i * n_qp + q] = FE::shape(elem_type, elem_order, i, q_points[q]);
+            for (unsigned int d = 0; d < dim; ++d)
+            {
+                dphi[d][i * n_qp + q] = FE::shape_deriv(elem_type, elem_order, i, d, q_points[q]);
+            }
+        }
+    }
+    return;
+} // tabulate_shape_functions
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+std::shared_ptr<const ReferenceElementData>
+ReferenceElementData::get(const key_type& quad_key, const libMesh::ElemType mapping_elem_type)
+{
+    std::lock_guard<std::mutex> lock(get_table_mutex());
+    auto& table = get_table();
+    const table_key_type key(quad_key, mapping_elem_type);
+    auto it = table.find(key);
+    if (it == table.end())
+    {
+        it = table.emplace(key, std::make_shared<const ReferenceElementData>(quad_key, mapping_elem_type)).first;
+    }
+    return it->second;
+} // get
+
+void
+ReferenceElementData::clear()
+{
+    std::lock_guard<std::mutex> lock(get_table_mutex());
+    get_table().clear();
+    return;
+} // clear
+
+ReferenceElementData::ReferenceElementData(const key_type& quad_key, const libMesh::ElemType mapping_elem_type)
+    : d_quad_key(quad_key), d_mapping_elem_type(mapping_elem_type)
+{
+    const ElemType elem_type = std::get<0>(d_quad_key);
+    const QuadratureType quad_type = std::get<1>(d_quad_key);
+    const Order order = std::get<2>(d_quad_key);
+
+    const int dim = get_dim(elem_type);
+    if (get_dim(d_mapping_elem_type) != dim)
+    {
+        TBOX_ERROR("ReferenceElementData::ReferenceElementData():\n"
+                   << "  the quadrature rule element type and the mapping element type have different dimensions"
+                   << std::endl);
+    }
+
+    std::unique_ptr<QBase> quad_rule = QBase::build(quad_type, dim, order);
+    quad_rule->init(elem_type);
+    d_points = quad_rule->get_points();
+    d_weights = quad_rule->get_weights();
+
+    d_n_nodes = get_n_nodes(d_mapping_elem_type);
+    switch (dim)
+    {
+    case 1:
+        tabulate_shape_functions<1>(d_mapping_elem_type, d_n_nodes, d_points, d_phi, d_dphi);
+        break;
+    case 2:
+        tabulate_shape_functions<2>(d_mapping_elem_type, d_n_nodes, d_points, d_phi, d_dphi);
+        break;
+    case 3:
+        tabulate_shape_functions<3>(d_mapping_elem_type, d_n_nodes, d_points, d_phi, d_dphi);
+        break;
+    default:
+        TBOX_ERROR("ReferenceElementData::ReferenceElementData():\n"
+                   << "  unsupported element dimension " << dim << std::endl);
+    }
+    return;
+} // ReferenceElementData
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -84,6 +84,68 @@ define(SPREAD_3D_SPECIALIZE_FIXED_WIDTH,
                            $3, $4,
                            $5, $6)
          endif')dnl
+dnl Variants of the above macros for kernels which precompute the full tensor
+dnl product of the weights in w(i0,i1,i2) and clip the stencil to the ghost box
+dnl via istart0, istop0, ..., istop2. The arguments to the inner macros are the
+dnl lower and upper bounds of i2, i1, and i0.
+define(INTERPOLATE_TENSOR_INNER_3D,
+          ` do d = 0,depth-1
+            V(d,s) = 0.d0
+            do i2 = $1,$2
+               ic2 = ic_lower(2)+i2
+               do i1 = $3,$4
+                  ic1 = ic_lower(1)+i1
+                  do i0 = $5,$6
+                     ic0 = ic_lower(0)+i0
+                     V(d,s) = V(d,s) + w(i0,i1,i2)*u(ic0,ic1,ic2,d)
+                  enddo
+               enddo
+            enddo
+         enddo')
+dnl The only argument is the largest stencil offset (i.e., the width of the
+dnl stencil minus one). When the stencil lies entirely within the ghost box all
+dnl trip counts are compile-time constants, which allows the compiler to fully
+dnl unroll and vectorize the innermost loop and to contract the accumulation
+dnl into fused multiply-adds.
+define(INTERPOLATE_TENSOR_3D_SPECIALIZE_FIXED_WIDTH,
+`if (istart0 .eq. 0 .and. istop0 .eq. $1 .and.
+     &       istart1 .eq. 0 .and. istop1 .eq. $1 .and.
+     &       istart2 .eq. 0 .and. istop2 .eq. $1) then
+           INTERPOLATE_TENSOR_INNER_3D(0, $1,
+                                       0, $1,
+                                       0, $1)
+         else
+           INTERPOLATE_TENSOR_INNER_3D(istart2, istop2,
+                                       istart1, istop1,
+                                       istart0, istop0)
+         endif')dnl
+define(SPREAD_TENSOR_INNER_3D,
+          ` do d = 0,depth-1
+            do i2 = $1,$2
+               ic2 = ic_lower(2)+i2
+               do i1 = $3,$4
+                  ic1 = ic_lower(1)+i1
+                  do i0 = $5,$6
+                     ic0 = ic_lower(0)+i0
+                     u(ic0,ic1,ic2,d) = u(ic0,ic1,ic2,d) +
+     &                    w(i0,i1,i2)*V(d,s)
+                  enddo
+               enddo
+            enddo
+         enddo')
+dnl Same as INTERPOLATE_TENSOR_3D_SPECIALIZE_FIXED_WIDTH.
+define(SPREAD_TENSOR_3D_SPECIALIZE_FIXED_WIDTH,
+`if (istart0 .eq. 0 .and. istop0 .eq. $1 .and.
+     &       istart1 .eq. 0 .and. istop1 .eq. $1 .and.
+     &       istart2 .eq. 0 .and. istop2 .eq. $1) then
+           SPREAD_TENSOR_INNER_3D(0, $1,
+                                  0, $1,
+                                  0, $1)
+         else
+           SPREAD_TENSOR_INNER_3D(istart2, istop2,
+                                  istart1, istop1,
+                                  istart0, istop0)
+         endif')dnl
 include(SAMRAI_FORTDIR/pdat_m4arrdim3d.i)dnl
 include(CURRENT_SRCDIR/lagrangian_delta.f.m4)dnl
 
@@ -1312,19 +1374,7 @@ c
          istop1  = 3-max(ic_upper(1)-ig_upper(1),0)
          istart2 =   max(ig_lower(2)-ic_lower(2),0)
          istop2  = 3-max(ic_upper(2)-ig_upper(2),0)
-         do d = 0,depth-1
-            V(d,s) = 0.d0
-            do i2 = istart2,istop2
-               ic2 = ic_lower(2)+i2
-               do i1 = istart1,istop1
-                  ic1 = ic_lower(1)+i1
-                  do i0 = istart0,istop0
-                     ic0 = ic_lower(0)+i0
-                     V(d,s) = V(d,s) + w(i0,i1,i2)*u(ic0,ic1,ic2,d)
-                  enddo
-               enddo
-            enddo
-         enddo
+         INTERPOLATE_TENSOR_3D_SPECIALIZE_FIXED_WIDTH(3)
 c
 c     End loop over points.
 c
@@ -1453,19 +1503,7 @@ c
          istop1  = 3-max(ic_upper(1)-ig_upper(1),0)
          istart2 =   max(ig_lower(2)-ic_lower(2),0)
          istop2  = 3-max(ic_upper(2)-ig_upper(2),0)
-         do d = 0,depth-1
-            do i2 = istart2,istop2
-               ic2 = ic_lower(2)+i2
-               do i1 = istart1,istop1
-                  ic1 = ic_lower(1)+i1
-                  do i0 = istart0,istop0
-                     ic0 = ic_lower(0)+i0
-                     u(ic0,ic1,ic2,d) = u(ic0,ic1,ic2,d) +
-     &                    w(i0,i1,i2)*V(d,s)
-                  enddo
-               enddo
-            enddo
-         enddo
+         SPREAD_TENSOR_3D_SPECIALIZE_FIXED_WIDTH(3)
 c
 c     End loop over points.
 c
@@ -1613,19 +1651,7 @@ c
          istop1  = 7-max(ic_upper(1)-ig_upper(1),0)
          istart2 =   max(ig_lower(2)-ic_lower(2),0)
          istop2  = 7-max(ic_upper(2)-ig_upper(2),0)
-         do d = 0,depth-1
-            V(d,s) = 0.d0
-            do i2 = istart2,istop2
-               ic2 = ic_lower(2)+i2
-               do i1 = istart1,istop1
-                  ic1 = ic_lower(1)+i1
-                  do i0 = istart0,istop0
-                     ic0 = ic_lower(0)+i0
-                     V(d,s) = V(d,s) + w(i0,i1,i2)*u(ic0,ic1,ic2,d)
-                  enddo
-               enddo
-            enddo
-         enddo
+         INTERPOLATE_TENSOR_3D_SPECIALIZE_FIXED_WIDTH(7)
 c
 c     End loop over points.
 c
@@ -1773,19 +1799,7 @@ c
          istop1  = 7-max(ic_upper(1)-ig_upper(1),0)
          istart2 =   max(ig_lower(2)-ic_lower(2),0)
          istop2  = 7-max(ic_upper(2)-ig_upper(2),0)
-         do d = 0,depth-1
-            do i2 = istart2,istop2
-               ic2 = ic_lower(2)+i2
-               do i1 = istart1,istop1
-                  ic1 = ic_lower(1)+i1
-                  do i0 = istart0,istop0
-                     ic0 = ic_lower(0)+i0
-                     u(ic0,ic1,ic2,d) = u(ic0,ic1,ic2,d) +
-     &                    w(i0,i1,i2)*V(d,s)
-                  enddo
-               enddo
-            enddo
-         enddo
+         SPREAD_TENSOR_3D_SPECIALIZE_FIXED_WIDTH(7)
 c
 c     End loop over points.
 c
@@ -2353,19 +2367,7 @@ c
          istop1  = 5-max(ic_upper(1)-ig_upper(1),0)
          istart2 =   max(ig_lower(2)-ic_lower(2),0)
          istop2  = 5-max(ic_upper(2)-ig_upper(2),0)
-         do d = 0,depth-1
-            V(d,s) = 0.d0
-            do i2 = istart2,istop2
-               ic2 = ic_lower(2)+i2
-               do i1 = istart1,istop1
-                  ic1 = ic_lower(1)+i1
-                  do i0 = istart0,istop0
-                     ic0 = ic_lower(0)+i0
-                     V(d,s) = V(d,s) + w(i0,i1,i2)*u(ic0,ic1,ic2,d)
-                  enddo
-               enddo
-            enddo
-         enddo
+         INTERPOLATE_TENSOR_3D_SPECIALIZE_FIXED_WIDTH(5)
 c
 c     End loop over points.
 c
@@ -2560,19 +2562,7 @@ c
          istop1  = 5-max(ic_upper(1)-ig_upper(1),0)
          istart2 =   max(ig_lower(2)-ic_lower(2),0)
          istop2  = 5-max(ic_upper(2)-ig_upper(2),0)
-         do d = 0,depth-1
-            do i2 = istart2,istop2
-               ic2 = ic_lower(2)+i2
-               do i1 = istart1,istop1
-                  ic1 = ic_lower(1)+i1
-                  do i0 = istart0,istop0
-                     ic0 = ic_lower(0)+i0
-                     u(ic0,ic1,ic2,d) = u(ic0,ic1,ic2,d) +
-     &                    w(i0,i1,i2)*V(d,s)
-                  enddo
-               enddo
-            enddo
-         enddo
+         SPREAD_TENSOR_3D_SPECIALIZE_FIXED_WIDTH(5)
 c
 c     End loop over points.
 c
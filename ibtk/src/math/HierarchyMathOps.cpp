@@ -18,6 +18,7 @@
 #include "ibtk/PatchMathOps.h"
 #include "ibtk/SAMRAIDataCache.h"
 #include "ibtk/ibtk_enums.h"
+#include "ibtk/ibtk_utilities.h"
 
 #include "ArrayDataBasicOps.h"
 #include "BasePatchLevel.h"
@@ -124,6 +125,20 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+inline bool
+box_arrays_equal(const BoxArray<NDIM>& boxes1, const BoxArray<NDIM>& boxes2)
+{
+    if (boxes1.getNumberOfBoxes() != boxes2.getNumberOfBoxes()) return false;
+    for (int i = 0; i < boxes1.getNumberOfBoxes(); ++i)
+    {
+        if (!(boxes1[i] == boxes2[i])) return false;
+    }
+    return true;
+} // box_arrays_equal
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 HierarchyMathOps::HierarchyMathOps(std::string name,
@@ -258,6 +273,7 @@ HierarchyMathOps::setPatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy)
     d_hierarchy = hierarchy;
     d_grid_geom = hierarchy->getGridGeometry();
     d_cached_eulerian_data.setPatchHierarchy(d_hierarchy);
+    d_wgt_level_configs.clear();
 
     // Obtain the hierarchy data operations objects.
     HierarchyDataOpsManager<NDIM>* hier_ops_manager = HierarchyDataOpsManager<NDIM>::getManager();
@@ -303,10 +319,34 @@ HierarchyMathOps::resetLevels(const int coarsest_ln, const int finest_ln)
         d_os_coarsen_scheds[dst_ln] = d_os_coarsen_alg->createSchedule(dst_level, src_level);
     }
 
-    // Reset the cell weights and compute the volume of the domain.
-    resetCellWeights(d_coarsest_ln, d_finest_ln);
-    if (d_using_wgt_fc) resetFaceWeights(d_coarsest_ln, d_finest_ln);
-    if (d_using_wgt_sc) resetSideWeights(d_coarsest_ln, d_finest_ln);
+    // Reset the weights on the levels whose configuration changed since the
+    // weights were last computed (or on which the weights are not allocated),
+    // and compute the volume of the domain.
+    d_wgt_level_configs.resize(d_finest_ln + 1);
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        WeightLevelConfiguration config;
+        config.level = level.getPointer();
+        config.boxes = level->getBoxes();
+        if (ln < d_finest_ln)
+        {
+            Pointer<PatchLevel<NDIM> > next_finer_level = d_hierarchy->getPatchLevel(ln + 1);
+            config.finer_boxes = next_finer_level->getBoxes();
+            config.finer_boxes.coarsen(next_finer_level->getRatioToCoarserLevel());
+        }
+        config.is_coarsest = ln == d_coarsest_ln;
+        config.is_finest = ln == d_finest_ln;
+        const WeightLevelConfiguration& old_config = d_wgt_level_configs[ln];
+        const bool level_changed = config.level != old_config.level || config.is_coarsest != old_config.is_coarsest ||
+                                   config.is_finest != old_config.is_finest ||
+                                   !box_arrays_equal(config.boxes, old_config.boxes) ||
+                                   !box_arrays_equal(config.finer_boxes, old_config.finer_boxes);
+        if (level_changed || !level->checkAllocated(d_wgt_cc_idx)) resetCellWeights(ln, ln);
+        if (d_using_wgt_fc && (level_changed || !level->checkAllocated(d_wgt_fc_idx))) resetFaceWeights(ln, ln);
+        if (d_using_wgt_sc && (level_changed || !level->checkAllocated(d_wgt_sc_idx))) resetSideWeights(ln, ln);
+        d_wgt_level_configs[ln] = config;
+    }
     d_volume = d_hier_cc_data_ops->sumControlVolumes(d_wgt_cc_idx, d_wgt_cc_idx);
 
     // Deallocate scratch data.
@@ -399,15 +439,12 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.curl(dst_data, src_data, patch);
-        }
+        });
     }
     else
     {
@@ -583,15 +620,12 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.curl(dst_data, src_data, patch);
-        }
+        });
     }
     return;
 } // curl
@@ -611,15 +645,12 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.curl(dst_data, src_data, patch);
-        }
+        });
     }
     return;
 } // curl
@@ -639,15 +670,12 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.curl(dst_data, src_data, patch);
-        }
+        });
     }
     return;
 } // curl
@@ -667,15 +695,12 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.curl(dst_data, src_data, patch);
-        }
+        });
     }
     return;
 } // curl
@@ -699,15 +724,12 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.curl(dst_data, src_data, patch);
-        }
+        });
     }
     return;
 } // curl
@@ -731,15 +753,12 @@ HierarchyMathOps::curl(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<EdgeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.curl(dst_data, src_data, patch);
-        }
+        });
     }
     return;
 } // curl
@@ -930,17 +949,14 @@ HierarchyMathOps::div(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete divergence.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<CellData<NDIM, double> > src2_data =
                 (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
 
             d_patch_math_ops.div(dst_data, alpha, src1_data, beta, src2_data, patch, dst_depth, src2_depth);
-        }
+        });
     }
     else
     {
@@ -1010,10 +1026,7 @@ HierarchyMathOps::div(const int dst_idx,
 
         // Compute the discrete divergence and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<CellData<NDIM, double> > src2_data =
@@ -1026,7 +1039,7 @@ HierarchyMathOps::div(const int dst_idx,
                 Pointer<OuterfaceData<NDIM, double> > of_data = patch->getPatchData(d_of_idx);
                 of_data->copy(*src1_data);
             }
-        }
+        });
 
         // Synchronize the coarse-fine interface of src1 and deallocate
         // temporary data.
@@ -1068,10 +1081,7 @@ HierarchyMathOps::div(const int dst_idx,
 
         // Compute the discrete divergence and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<CellData<NDIM, double> > src2_data =
@@ -1084,7 +1094,7 @@ HierarchyMathOps::div(const int dst_idx,
                 Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
                 os_data->copy(*src1_data);
             }
-        }
+        });
 
         // Synchronize the coarse-fine interface of src1 and deallocate
         // temporary data.
@@ -1118,17 +1128,14 @@ HierarchyMathOps::grad(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete gradient.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<CellData<NDIM, double> > src2_data =
                 (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
 
             d_patch_math_ops.grad(dst_data, alpha, src1_data, beta, src2_data, patch, src1_depth);
-        }
+        });
     }
     else
     {
@@ -1217,10 +1224,7 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<FaceData<NDIM, double> > src2_data =
@@ -1233,7 +1237,7 @@ HierarchyMathOps::grad(const int dst_idx,
                 Pointer<OuterfaceData<NDIM, double> > of_data = patch->getPatchData(d_of_idx);
                 of_data->copy(*dst_data);
             }
-        }
+        });
     }
 
     // Synchronize the coarse-fine interface and deallocate temporary data.
@@ -1276,10 +1280,7 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<SideData<NDIM, double> > src2_data =
@@ -1292,7 +1293,7 @@ HierarchyMathOps::grad(const int dst_idx,
                 Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
                 os_data->copy(*dst_data);
             }
-        }
+        });
     }
 
     // Synchronize the coarse-fine interface and deallocate temporary data.
@@ -1482,10 +1483,7 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<FaceData<NDIM, double> > src2_data =
@@ -1535,7 +1533,7 @@ HierarchyMathOps::grad(const int dst_idx,
                 Pointer<OuterfaceData<NDIM, double> > of_data = patch->getPatchData(d_of_idx);
                 of_data->copy(*dst_data);
             }
-        }
+        });
     }
 
     // Synchronize the coarse-fine interface and deallocate temporary data.
@@ -1579,10 +1577,7 @@ HierarchyMathOps::grad(const int dst_idx,
 
         // Compute the discrete gradient and extract data on the coarse-fine
         // interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<SideData<NDIM, double> > src2_data =
@@ -1632,7 +1627,7 @@ HierarchyMathOps::grad(const int dst_idx,
                 Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
                 os_data->copy(*dst_data);
             }
-        }
+        });
     }
 
     // Synchronize the coarse-fine interface and deallocate temporary data.
@@ -1669,10 +1664,7 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
@@ -1683,7 +1675,7 @@ HierarchyMathOps::interp(const int dst_idx,
                 Pointer<OuterfaceData<NDIM, double> > of_data = patch->getPatchData(d_of_idx);
                 of_data->copy(*src_data);
             }
-        }
+        });
 
         // Synchronize the coarse-fine interface and deallocate temporary data.
         if ((ln > d_coarsest_ln) && src_cf_bdry_synch)
@@ -1717,10 +1709,7 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
@@ -1731,7 +1720,7 @@ HierarchyMathOps::interp(const int dst_idx,
                 Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
                 os_data->copy(*src_data);
             }
-        }
+        });
 
         // Synchronize the coarse-fine interface and deallocate temporary data.
         if ((ln > d_coarsest_ln) && src_cf_bdry_synch)
@@ -1765,10 +1754,7 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
@@ -1779,7 +1765,7 @@ HierarchyMathOps::interp(const int dst_idx,
                 Pointer<OuterfaceData<NDIM, double> > of_data = patch->getPatchData(d_of_idx);
                 of_data->copy(*dst_data);
             }
-        }
+        });
     }
 
     // Synchronize the coarse-fine interface and deallocate temporary data.
@@ -1816,10 +1802,7 @@ HierarchyMathOps::interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
@@ -1830,7 +1813,7 @@ HierarchyMathOps::interp(const int dst_idx,
                 Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
                 os_data->copy(*dst_data);
             }
-        }
+        });
     }
 
     // Synchronize the coarse-fine interface and deallocate temporary data.
@@ -1860,15 +1843,12 @@ HierarchyMathOps::interp(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Interpolate.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.interp(dst_data, src_data, patch);
-        }
+        });
     }
     return;
 } // interp
@@ -1888,15 +1868,12 @@ HierarchyMathOps::interp(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Interpolate.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<EdgeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.interp(dst_data, src_data, patch);
-        }
+        });
     }
     return;
 } // interp
@@ -1917,15 +1894,12 @@ HierarchyMathOps::interp(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Interpolate.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.interp(dst_data, src_data, patch, dst_ghost_interp);
-        }
+        });
     }
     return;
 } // interp
@@ -1946,15 +1920,12 @@ HierarchyMathOps::interp(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Interpolate.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<EdgeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.interp(dst_data, src_data, patch, dst_ghost_interp);
-        }
+        });
     }
     return;
 } // interp
@@ -1981,10 +1952,7 @@ HierarchyMathOps::harmonic_interp(const int dst_idx,
         }
 
         // Interpolate and extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
@@ -1995,7 +1963,7 @@ HierarchyMathOps::harmonic_interp(const int dst_idx,
                 Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
                 os_data->copy(*dst_data);
             }
-        }
+        });
     }
 
     // Synchronize the coarse-fine interface and deallocate temporary data.
@@ -2026,15 +1994,12 @@ HierarchyMathOps::harmonic_interp(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Interpolate
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.interp(dst_data, src_data, patch, dst_ghost_interp);
-        }
+        });
     }
     return;
 } // harmonic_interp
@@ -2055,15 +2020,12 @@ HierarchyMathOps::harmonic_interp(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Interpolate.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<EdgeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.interp(dst_data, src_data, patch, dst_ghost_interp);
-        }
+        });
     }
     return;
 } // harmonic_interp
@@ -2130,10 +2092,7 @@ HierarchyMathOps::laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete Laplacian.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<CellData<NDIM, double> > src2_data =
@@ -2141,7 +2100,7 @@ HierarchyMathOps::laplace(const int dst_idx,
 
             d_patch_math_ops.laplace(
                 dst_data, alpha, beta, src1_data, gamma, src2_data, patch, dst_depth, src1_depth, src2_depth);
-        }
+        });
     }
     else
     {
@@ -2296,102 +2255,32 @@ HierarchyMathOps::laplace(const int dst_idx,
                           const Pointer<SideVariable<NDIM, double> > src2_var)
 {
     if (src1_ghost_fill) src1_ghost_fill->fillData(src1_ghost_fill_time);
+    laplaceSide(dst_idx, dst_var, poisson_spec, src1_idx, src1_var, gamma, src2_idx, src2_var, -1);
+    return;
+} // laplace
 
-    const double alpha = poisson_spec.dIsConstant() ? poisson_spec.getDConstant() : 0.0;
-    const double beta = poisson_spec.cIsConstant() ? poisson_spec.getCConstant() : 0.0;
-
-    const int alpha_idx = (poisson_spec.dIsConstant()) ? -1 : poisson_spec.getDPatchDataId();
-    const int beta_idx = (poisson_spec.cIsConstant() || poisson_spec.cIsZero()) ? -1 : poisson_spec.getCPatchDataId();
-
-    if (alpha_idx != -1)
-    {
-        TBOX_ERROR("HierarchyMathOps::laplace():\n"
-                   << "  side-centered Laplacian requires spatially constant scalar-valued "
-                      "diffusivity"
-                   << std::endl);
-    }
-
-    if (beta_idx != -1)
-    {
-        TBOX_ERROR("HierarchyMathOps::laplace():\n"
-                   << "  side-centered Laplacian requires spatially constant scalar-valued "
-                      "damping factor"
-                   << std::endl);
-    }
-
-    if (!src1_var->fineBoundaryRepresentsVariable())
-    {
-        TBOX_WARNING("HierarchyMathOps::laplace():\n"
-                     << "  recommended usage for side-centered Laplace operator is\n"
-                     << "  src1_var->fineBoundaryRepresentsVariable() == true" << std::endl);
-    }
-
-    Pointer<SideDataFactory<NDIM, double> > dst_factory = dst_var->getPatchDataFactory();
-    Pointer<SideDataFactory<NDIM, double> > src1_factory = src1_var->getPatchDataFactory();
-    if (dst_factory->getDefaultDepth() != 1 || src1_factory->getDefaultDepth() != 1)
-    {
-        TBOX_ERROR("HierarchyMathOps::laplace():\n"
-                   << "  side-centered Laplacian requires scalar-valued data" << std::endl);
-    }
-    if (src2_var)
-    {
-        Pointer<SideDataFactory<NDIM, double> > src2_factory = src2_var->getPatchDataFactory();
-        if (src2_factory->getDefaultDepth() != 1)
-        {
-            TBOX_ERROR("HierarchyMathOps::laplace():\n"
-                       << "  side-centered Laplacian requires scalar-valued data" << std::endl);
-        }
-    }
-
-    // Compute dst = div grad src1 independently on each level.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
-            Pointer<SideData<NDIM, double> > src2_data =
-                (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
-
-            d_patch_math_ops.laplace(dst_data, alpha, beta, src1_data, gamma, src2_data, patch);
-        }
-    }
-
-    // Allocate temporary data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_os_idx);
-    }
-
-    // Synchronize data along the coarse-fine interface.
-    for (int ln = d_finest_ln; ln > d_coarsest_ln; --ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-
-        // Extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
-            Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
-            os_data->copy(*dst_data);
-        }
-
-        // Synchronize the coarse-fine interface of dst.
-        xeqScheduleOutersideRestriction(dst_idx, d_os_idx, ln - 1);
-    }
-
-    // Deallocate temporary data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(d_os_idx);
-    }
+void
+HierarchyMathOps::laplace(const int dst_idx,
+                          const Pointer<SideVariable<NDIM, double> > dst_var,
+                          const PoissonSpecifications& poisson_spec,
+                          const int src1_idx,
+                          const Pointer<SideVariable<NDIM, double> > src1_var,
+                          const Pointer<HierarchyGhostCellInterpolation> src1_ghost_fill,
+                          const double src1_ghost_fill_time,
+                          const double gamma,
+                          const int src2_idx,
+                          const Pointer<CellVariable<NDIM, double> > /*src2_var*/)
+{
+    if (src1_ghost_fill) src1_ghost_fill->fillData(src1_ghost_fill_time);
+    laplaceSide(dst_idx,
+                dst_var,
+                poisson_spec,
+                src1_idx,
+                src1_var,
+                gamma,
+                -1,
+                Pointer<SideVariable<NDIM, double> >(nullptr),
+                src2_idx);
     return;
 } // laplace
 
@@ -2445,10 +2334,7 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > coef1_data = patch->getPatchData(coef1_idx);
             Pointer<SideData<NDIM, double> > coef2_data =
@@ -2459,7 +2345,7 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
 
             d_patch_math_ops.vc_laplace(
                 dst_data, alpha, beta, coef1_data, coef2_data, src1_data, gamma, src2_data, patch, use_harmonic_interp);
-        }
+        });
     }
 
     // Allocate temporary data.
@@ -2475,14 +2361,11 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
             os_data->copy(*dst_data);
-        }
+        });
 
         // Synchronize the coarse-fine interface of dst.
         xeqScheduleOutersideRestriction(dst_idx, d_os_idx, ln - 1);
@@ -2547,10 +2430,7 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<EdgeData<NDIM, double> > coef1_data = patch->getPatchData(coef1_idx);
             Pointer<SideData<NDIM, double> > coef2_data =
@@ -2561,7 +2441,7 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
 
             d_patch_math_ops.vc_laplace(
                 dst_data, alpha, beta, coef1_data, coef2_data, src1_data, gamma, src2_data, patch, use_harmonic_interp);
-        }
+        });
     }
 
     // Allocate temporary data.
@@ -2577,14 +2457,11 @@ HierarchyMathOps::vc_laplace(const int dst_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Extract data on the coarse-fine interface.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
             os_data->copy(*dst_data);
-        }
+        });
 
         // Synchronize the coarse-fine interface of dst.
         xeqScheduleOutersideRestriction(dst_idx, d_os_idx, ln - 1);
@@ -2616,10 +2493,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<CellData<NDIM, double> > src2_data =
@@ -2627,7 +2501,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
 
             d_patch_math_ops.pointwiseMultiply(
                 dst_data, alpha, src1_data, beta, src2_data, patch, dst_depth, src1_depth, src2_depth);
-        }
+        });
     }
     return;
 } // pointwiseMultiply
@@ -2651,10 +2525,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<CellData<NDIM, double> > src2_data =
@@ -2671,7 +2542,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                                src1_depth,
                                                src2_depth,
                                                alpha_depth);
-        }
+        });
     }
     return;
 } // pointwiseMultiply
@@ -2697,10 +2568,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<CellData<NDIM, double> > src2_data =
@@ -2719,7 +2587,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                                src2_depth,
                                                alpha_depth,
                                                beta_depth);
-        }
+        });
     }
     return;
 } // pointwiseMultiply
@@ -2741,10 +2609,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<FaceData<NDIM, double> > src2_data =
@@ -2752,7 +2617,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
 
             d_patch_math_ops.pointwiseMultiply(
                 dst_data, alpha, src1_data, beta, src2_data, patch, dst_depth, src1_depth, src2_depth);
-        }
+        });
     }
     return;
 } // pointwiseMultiply
@@ -2776,10 +2641,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<FaceData<NDIM, double> > src2_data =
@@ -2796,7 +2658,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                                src1_depth,
                                                src2_depth,
                                                alpha_depth);
-        }
+        });
     }
     return;
 } // pointwiseMultiply
@@ -2822,10 +2684,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<FaceData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<FaceData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<FaceData<NDIM, double> > src2_data =
@@ -2844,7 +2703,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                                src2_depth,
                                                alpha_depth,
                                                beta_depth);
-        }
+        });
     }
     return;
 } // pointwiseMultiply
@@ -2866,10 +2725,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<NodeData<NDIM, double> > src2_data =
@@ -2877,7 +2733,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
 
             d_patch_math_ops.pointwiseMultiply(
                 dst_data, alpha, src1_data, beta, src2_data, patch, dst_depth, src1_depth, src2_depth);
-        }
+        });
     }
     return;
 } // pointwiseMultiply
@@ -2901,10 +2757,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<NodeData<NDIM, double> > src2_data =
@@ -2921,7 +2774,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                                src1_depth,
                                                src2_depth,
                                                alpha_depth);
-        }
+        });
     }
     return;
 } // pointwiseMultiply
@@ -2947,10 +2800,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<NodeData<NDIM, double> > src2_data =
@@ -2969,7 +2819,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                                src2_depth,
                                                alpha_depth,
                                                beta_depth);
-        }
+        });
     }
     return;
 } // pointwiseMultiply
@@ -2991,10 +2841,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<SideData<NDIM, double> > src2_data =
@@ -3002,7 +2849,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
 
             d_patch_math_ops.pointwiseMultiply(
                 dst_data, alpha, src1_data, beta, src2_data, patch, dst_depth, src1_depth, src2_depth);
-        }
+        });
     }
     return;
 } // pointwiseMultiply
@@ -3026,10 +2873,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<SideData<NDIM, double> > src2_data =
@@ -3046,7 +2890,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                                src1_depth,
                                                src2_depth,
                                                alpha_depth);
-        }
+        });
     }
     return;
 } // pointwiseMultiply
@@ -3072,10 +2916,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
             Pointer<SideData<NDIM, double> > src2_data =
@@ -3094,7 +2935,7 @@ HierarchyMathOps::pointwiseMultiply(const int dst_idx,
                                                src2_depth,
                                                alpha_depth,
                                                beta_depth);
-        }
+        });
     }
     return;
 } // pointwiseMultiply
@@ -3109,15 +2950,12 @@ HierarchyMathOps::pointwiseL1Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.pointwiseL1Norm(dst_data, src_data, patch);
-        }
+        });
     }
     return;
 } // pointwiseL1Norm
@@ -3132,15 +2970,12 @@ HierarchyMathOps::pointwiseL2Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.pointwiseL2Norm(dst_data, src_data, patch);
-        }
+        });
     }
     return;
 } // pointwiseL2Norm
@@ -3178,15 +3013,12 @@ HierarchyMathOps::pointwiseL1Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.pointwiseL1Norm(dst_data, src_data, patch);
-        }
+        });
     }
     return;
 } // pointwiseL1Norm
@@ -3201,15 +3033,12 @@ HierarchyMathOps::pointwiseL2Norm(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<NodeData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<NodeData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.pointwiseL2Norm(dst_data, src_data, patch);
-        }
+        });
     }
     return;
 } // pointwiseL2Norm
@@ -3254,16 +3083,13 @@ HierarchyMathOps::strain_rate(const int dst1_idx,
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Compute the discrete curl.
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst1_data = patch->getPatchData(dst1_idx);
             Pointer<CellData<NDIM, double> > dst2_data = patch->getPatchData(dst2_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.strain_rate(dst1_data, dst2_data, src_data, patch);
-        }
+        });
     }
     return;
 } // strain
@@ -3282,21 +3108,132 @@ HierarchyMathOps::strain_rate(const int dst_idx,
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
             Pointer<SideData<NDIM, double> > src_data = patch->getPatchData(src_idx);
 
             d_patch_math_ops.strain_rate(dst_data, src_data, patch);
-        }
+        });
     }
     return;
 } // strain
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+HierarchyMathOps::laplaceSide(const int dst_idx,
+                              const Pointer<SideVariable<NDIM, double> > dst_var,
+                              const PoissonSpecifications& poisson_spec,
+                              const int src1_idx,
+                              const Pointer<SideVariable<NDIM, double> > src1_var,
+                              const double gamma,
+                              const int src2_idx,
+                              const Pointer<SideVariable<NDIM, double> > src2_var,
+                              const int grad_src_idx)
+{
+    const double alpha = poisson_spec.dIsConstant() ? poisson_spec.getDConstant() : 0.0;
+    const double beta = poisson_spec.cIsConstant() ? poisson_spec.getCConstant() : 0.0;
+
+    const int alpha_idx = (poisson_spec.dIsConstant()) ? -1 : poisson_spec.getDPatchDataId();
+    const int beta_idx = (poisson_spec.cIsConstant() || poisson_spec.cIsZero()) ? -1 : poisson_spec.getCPatchDataId();
+
+    if (alpha_idx != -1)
+    {
+        TBOX_ERROR("HierarchyMathOps::laplace():\n"
+                   << "  side-centered Laplacian requires spatially constant scalar-valued "
+                      "diffusivity"
+                   << std::endl);
+    }
+
+    if (beta_idx != -1)
+    {
+        TBOX_ERROR("HierarchyMathOps::laplace():\n"
+                   << "  side-centered Laplacian requires spatially constant scalar-valued "
+                      "damping factor"
+                   << std::endl);
+    }
+
+    if (!src1_var->fineBoundaryRepresentsVariable())
+    {
+        TBOX_WARNING("HierarchyMathOps::laplace():\n"
+                     << "  recommended usage for side-centered Laplace operator is\n"
+                     << "  src1_var->fineBoundaryRepresentsVariable() == true" << std::endl);
+    }
+
+    Pointer<SideDataFactory<NDIM, double> > dst_factory = dst_var->getPatchDataFactory();
+    Pointer<SideDataFactory<NDIM, double> > src1_factory = src1_var->getPatchDataFactory();
+    if (dst_factory->getDefaultDepth() != 1 || src1_factory->getDefaultDepth() != 1)
+    {
+        TBOX_ERROR("HierarchyMathOps::laplace():\n"
+                   << "  side-centered Laplacian requires scalar-valued data" << std::endl);
+    }
+    if (src2_var)
+    {
+        Pointer<SideDataFactory<NDIM, double> > src2_factory = src2_var->getPatchDataFactory();
+        if (src2_factory->getDefaultDepth() != 1)
+        {
+            TBOX_ERROR("HierarchyMathOps::laplace():\n"
+                       << "  side-centered Laplacian requires scalar-valued data" << std::endl);
+        }
+    }
+
+    // Compute dst independently on each level.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
+            Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
+            Pointer<SideData<NDIM, double> > src1_data = patch->getPatchData(src1_idx);
+            if (grad_src_idx >= 0)
+            {
+                // Compute dst = gamma grad src2 and then add the Laplacian
+                // while the patch data are still in cache.
+                Pointer<CellData<NDIM, double> > grad_src_data = patch->getPatchData(grad_src_idx);
+                d_patch_math_ops.grad(
+                    dst_data, gamma, grad_src_data, 0.0, Pointer<SideData<NDIM, double> >(nullptr), patch);
+                d_patch_math_ops.laplace(dst_data, alpha, beta, src1_data, 1.0, dst_data, patch);
+            }
+            else
+            {
+                Pointer<SideData<NDIM, double> > src2_data =
+                    (src2_idx >= 0) ? patch->getPatchData(src2_idx) : Pointer<PatchData<NDIM> >();
+                d_patch_math_ops.laplace(dst_data, alpha, beta, src1_data, gamma, src2_data, patch);
+            }
+        });
+    }
+
+    // Allocate temporary data.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        level->allocatePatchData(d_os_idx);
+    }
+
+    // Synchronize data along the coarse-fine interface.
+    for (int ln = d_finest_ln; ln > d_coarsest_ln; --ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+
+        // Extract data on the coarse-fine interface.
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
+            Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
+            Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
+            os_data->copy(*dst_data);
+        });
+
+        // Synchronize the coarse-fine interface of dst.
+        xeqScheduleOutersideRestriction(dst_idx, d_os_idx, ln - 1);
+    }
+
+    // Deallocate temporary data.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        level->deallocatePatchData(d_os_idx);
+    }
+    return;
+} // laplaceSide
+
 void
 HierarchyMathOps::resetCoarsenOperators()
 {
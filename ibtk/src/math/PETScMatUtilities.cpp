@@ -56,6 +56,7 @@
 #include "petscvec.h"
 #include <petsclog.h>
 
+#include <algorithm>
 #include <array>
 #include <iterator>
 #include <limits>
@@ -791,11 +792,6 @@ PETScMatUtilities::constructPatchLevelSCInterpOp(Mat& mat,
     if (interp_stencil % 2 != 0) interp_stencil += 1;
 
     int ierr;
-    if (mat)
-    {
-        ierr = MatDestroy(&mat);
-        IBTK_CHKERRQ(ierr);
-    }
 
     // Determine the grid extents.
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = patch_level->getGridGeometry();
@@ -830,6 +826,19 @@ PETScMatUtilities::constructPatchLevelSCInterpOp(Mat& mat,
     const int j_upper = j_lower + n_local;
     const int n_total = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.end(), 0);
 
+    // An existing matrix can be reused if it has the same dimensions and if no
+    // IB point has moved to a stencil with different degrees of freedom, in
+    // which case only the weights need to be updated.
+    bool reuse_mat = false;
+    if (mat)
+    {
+        int mat_m_local, mat_n_local;
+        ierr = MatGetLocalSize(mat, &mat_m_local, &mat_n_local);
+        IBTK_CHKERRQ(ierr);
+        reuse_mat = mat_m_local == m_local && mat_n_local == n_local;
+    }
+    std::vector<int> stencil_cols;
+
     // Determine the index of the Cartesian grid cell containing each local IB
     // point; find that index in a local patch or in the ghost cell region of a
     // local patch; compute the stencil boxes for each local IB point; and
@@ -921,6 +930,7 @@ PETScMatUtilities::constructPatchLevelSCInterpOp(Mat& mat,
 #if !defined(NDEBUG)
             TBOX_ASSERT(SideGeometry<NDIM>::toSideBox(dof_index_data->getGhostBox(), axis).contains(stencil_box_axis));
 #endif
+            stencil_cols.clear();
             for (Box<NDIM>::Iterator b(stencil_box_axis); b; b++)
             {
                 const int dof_index = (*dof_index_data)(SideIndex<NDIM>(b(), axis, SideIndex<NDIM>::Lower));
@@ -932,24 +942,49 @@ PETScMatUtilities::constructPatchLevelSCInterpOp(Mat& mat,
                 {
                     o_nnz[local_idx] += 1;
                 }
+                if (reuse_mat) stencil_cols.push_back(dof_index);
             }
             d_nnz[local_idx] = std::min(n_local, d_nnz[local_idx]);
             o_nnz[local_idx] = std::min(n_total - n_local, o_nnz[local_idx]);
+
+            // Compare the degrees of freedom in the stencil to the nonzero
+            // structure of the existing matrix.
+            if (reuse_mat)
+            {
+                std::sort(stencil_cols.begin(), stencil_cols.end());
+                int ncols;
+                const int* cols;
+                ierr = MatGetRow(mat, i_lower + local_idx, &ncols, &cols, nullptr);
+                IBTK_CHKERRQ(ierr);
+                reuse_mat = ncols == static_cast<int>(stencil_cols.size()) &&
+                            std::equal(stencil_cols.begin(), stencil_cols.end(), cols);
+                ierr = MatRestoreRow(mat, i_lower + local_idx, &ncols, &cols, nullptr);
+                IBTK_CHKERRQ(ierr);
+            }
         }
     }
 
-    // Create an empty matrix.
-    ierr = MatCreateAIJ(PETSC_COMM_WORLD,
-                        m_local,
-                        n_local,
-                        PETSC_DETERMINE,
-                        PETSC_DETERMINE,
-                        0,
-                        m_local ? &d_nnz[0] : nullptr,
-                        0,
-                        m_local ? &o_nnz[0] : nullptr,
-                        &mat);
-    IBTK_CHKERRQ(ierr);
+    // Create an empty matrix unless the existing one can be reused.
+    if (mat) reuse_mat = IBTK_MPI::minReduction(static_cast<int>(reuse_mat)) == 1;
+    if (!reuse_mat)
+    {
+        if (mat)
+        {
+            ierr = MatDestroy(&mat);
+            IBTK_CHKERRQ(ierr);
+        }
+        ierr = MatCreateAIJ(PETSC_COMM_WORLD,
+                            m_local,
+                            n_local,
+                            PETSC_DETERMINE,
+                            PETSC_DETERMINE,
+                            0,
+                            m_local ? &d_nnz[0] : nullptr,
+                            0,
+                            m_local ? &o_nnz[0] : nullptr,
+                            &mat);
+        IBTK_CHKERRQ(ierr);
+    }
 
     // Set the matrix coefficients.
     for (int k = 0; k < m_local / NDIM; ++k)
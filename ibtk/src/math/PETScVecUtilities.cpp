@@ -16,6 +16,7 @@
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/IndexUtilities.h"
+#include "ibtk/NodeSynchCopyFillPattern.h"
 #include "ibtk/PETScVecUtilities.h"
 #include "ibtk/SideSynchCopyFillPattern.h"
 #include "ibtk/compiler_hints.h"
@@ -31,6 +32,10 @@
 #include "Index.h"
 #include "IntVector.h"
 #include "MultiblockDataTranslator.h"
+#include "NodeData.h"
+#include "NodeGeometry.h"
+#include "NodeIndex.h"
+#include "NodeVariable.h"
 #include "Patch.h"
 #include "PatchLevel.h"
 #include "RefineAlgorithm.h"
@@ -213,6 +218,7 @@ PETScVecUtilities::constructPatchLevelDOFIndices(std::vector<int>& num_dofs_per_
     var_db->mapIndexToVariable(dof_index_idx, dof_index_var);
     Pointer<CellVariable<NDIM, int> > dof_index_cc_var = dof_index_var;
     Pointer<SideVariable<NDIM, int> > dof_index_sc_var = dof_index_var;
+    Pointer<NodeVariable<NDIM, int> > dof_index_nc_var = dof_index_var;
     if (dof_index_cc_var)
     {
         constructPatchLevelDOFIndices_cell(num_dofs_per_proc, dof_index_idx, patch_level);
@@ -221,6 +227,10 @@ PETScVecUtilities::constructPatchLevelDOFIndices(std::vector<int>& num_dofs_per_
     {
         constructPatchLevelDOFIndices_side(num_dofs_per_proc, dof_index_idx, patch_level);
     }
+    else if (dof_index_nc_var)
+    {
+        constructPatchLevelDOFIndices_node(num_dofs_per_proc, dof_index_idx, patch_level);
+    }
     else
     {
         TBOX_ERROR("PETScVecUtilities::constructPatchLevelDOFIndices():\n"
@@ -271,6 +281,9 @@ PETScVecUtilities::copyToPatchLevelVec_cell(Vec& vec,
     int i_lower, i_upper;
     ierr = VecGetOwnershipRange(vec, &i_lower, &i_upper);
     IBTK_CHKERRQ(ierr);
+    double* vec_vals = nullptr;
+    ierr = VecGetArray(vec, &vec_vals);
+    IBTK_CHKERRQ(ierr);
     for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
@@ -289,15 +302,12 @@ PETScVecUtilities::copyToPatchLevelVec_cell(Vec& vec,
                 const int dof_index = (*dof_index_data)(i, d);
                 if (LIKELY(i_lower <= dof_index && dof_index < i_upper))
                 {
-                    ierr = VecSetValues(vec, 1, &dof_index, &(*data)(i, d), INSERT_VALUES);
-                    IBTK_CHKERRQ(ierr);
+                    vec_vals[dof_index - i_lower] = (*data)(i, d);
                 }
             }
         }
     }
-    ierr = VecAssemblyBegin(vec);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(vec);
+    ierr = VecRestoreArray(vec, &vec_vals);
     IBTK_CHKERRQ(ierr);
     return;
 } // copyToPatchLevelVec_cell
@@ -312,6 +322,9 @@ PETScVecUtilities::copyToPatchLevelVec_side(Vec& vec,
     int i_lower, i_upper;
     ierr = VecGetOwnershipRange(vec, &i_lower, &i_upper);
     IBTK_CHKERRQ(ierr);
+    double* vec_vals = nullptr;
+    ierr = VecGetArray(vec, &vec_vals);
+    IBTK_CHKERRQ(ierr);
     for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
@@ -332,16 +345,13 @@ PETScVecUtilities::copyToPatchLevelVec_side(Vec& vec,
                     const int dof_index = (*dof_index_data)(i, d);
                     if (LIKELY(i_lower <= dof_index && dof_index < i_upper))
                     {
-                        ierr = VecSetValues(vec, 1, &dof_index, &(*data)(i, d), INSERT_VALUES);
-                        IBTK_CHKERRQ(ierr);
+                        vec_vals[dof_index - i_lower] = (*data)(i, d);
                     }
                 }
             }
         }
     }
-    ierr = VecAssemblyBegin(vec);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(vec);
+    ierr = VecRestoreArray(vec, &vec_vals);
     IBTK_CHKERRQ(ierr);
     return;
 } // copyToPatchLevelVec_side
@@ -356,6 +366,9 @@ PETScVecUtilities::copyFromPatchLevelVec_cell(Vec& vec,
     int i_lower, i_upper;
     ierr = VecGetOwnershipRange(vec, &i_lower, &i_upper);
     IBTK_CHKERRQ(ierr);
+    const double* vec_vals = nullptr;
+    ierr = VecGetArrayRead(vec, &vec_vals);
+    IBTK_CHKERRQ(ierr);
     for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
@@ -374,12 +387,13 @@ PETScVecUtilities::copyFromPatchLevelVec_cell(Vec& vec,
                 const int dof_index = (*dof_index_data)(i, d);
                 if (LIKELY(i_lower <= dof_index && dof_index < i_upper))
                 {
-                    ierr = VecGetValues(vec, 1, &dof_index, &(*data)(i, d));
-                    IBTK_CHKERRQ(ierr);
+                    (*data)(i, d) = vec_vals[dof_index - i_lower];
                 }
             }
         }
     }
+    ierr = VecRestoreArrayRead(vec, &vec_vals);
+    IBTK_CHKERRQ(ierr);
     return;
 } // copyFromPatchLevelVec_cell
 
@@ -393,6 +407,9 @@ PETScVecUtilities::copyFromPatchLevelVec_side(Vec& vec,
     int i_lower, i_upper;
     ierr = VecGetOwnershipRange(vec, &i_lower, &i_upper);
     IBTK_CHKERRQ(ierr);
+    const double* vec_vals = nullptr;
+    ierr = VecGetArrayRead(vec, &vec_vals);
+    IBTK_CHKERRQ(ierr);
     for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
@@ -413,13 +430,14 @@ PETScVecUtilities::copyFromPatchLevelVec_side(Vec& vec,
                     const int dof_index = (*dof_index_data)(i, d);
                     if (LIKELY(i_lower <= dof_index && dof_index < i_upper))
                     {
-                        ierr = VecGetValues(vec, 1, &dof_index, &(*data)(i, d));
-                        IBTK_CHKERRQ(ierr);
+                        (*data)(i, d) = vec_vals[dof_index - i_lower];
                     }
                 }
             }
         }
     }
+    ierr = VecRestoreArrayRead(vec, &vec_vals);
+    IBTK_CHKERRQ(ierr);
     return;
 } // copyFromPatchLevelVec_side
 
@@ -611,6 +629,132 @@ PETScVecUtilities::constructPatchLevelDOFIndices_side(std::vector<int>& num_dofs
     return;
 } // constructPatchLevelDOFIndices_side
 
+void
+PETScVecUtilities::constructPatchLevelDOFIndices_node(std::vector<int>& num_dofs_per_proc,
+                                                      const int dof_index_idx,
+                                                      Pointer<PatchLevel<NDIM> > patch_level)
+{
+    // Create variables to keep track of whether a particular location is the
+    // "master" location.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<NodeVariable<NDIM, int> > patch_num_var =
+        new NodeVariable<NDIM, int>("PETScVecUtilities::constructPatchLevelDOFIndices_node()::patch_num_var");
+    static const int patch_num_idx = var_db->registerPatchDataIndex(patch_num_var);
+    patch_level->allocatePatchData(patch_num_idx);
+    Pointer<NodeVariable<NDIM, bool> > mastr_loc_var =
+        new NodeVariable<NDIM, bool>("PETScVecUtilities::constructPatchLevelDOFIndices_node()::mastr_loc_var");
+    static const int mastr_loc_idx = var_db->registerPatchDataIndex(mastr_loc_var);
+    patch_level->allocatePatchData(mastr_loc_idx);
+    int counter = 0;
+    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+        const int patch_num = patch->getPatchNumber();
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<NodeData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
+        const int depth = dof_index_data->getDepth();
+        Pointer<NodeData<NDIM, int> > patch_num_data = patch->getPatchData(patch_num_idx);
+        patch_num_data->fillAll(patch_num);
+        Pointer<NodeData<NDIM, bool> > mastr_loc_data = patch->getPatchData(mastr_loc_idx);
+        mastr_loc_data->fillAll(false);
+        for (Box<NDIM>::Iterator b(NodeGeometry<NDIM>::toNodeBox(patch_box)); b; b++)
+        {
+            const NodeIndex<NDIM> i(b(), IntVector<NDIM>(0));
+            for (int d = 0; d < depth; ++d)
+            {
+                (*dof_index_data)(i, d) = counter++;
+            }
+        }
+    }
+
+    // Synchronize the patch number and preliminary DOF index data at patch
+    // boundaries to determine which patch owns a given DOF along patch
+    // boundaries.  As in NodeDataSynchronization, values are synchronized one
+    // direction at a time so that nodes shared by more than two patches are
+    // assigned to a unique patch.
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        RefineAlgorithm<NDIM> bdry_synch_alg;
+        bdry_synch_alg.registerRefine(
+            patch_num_idx, patch_num_idx, patch_num_idx, nullptr, new NodeSynchCopyFillPattern(axis));
+        bdry_synch_alg.registerRefine(
+            dof_index_idx, dof_index_idx, dof_index_idx, nullptr, new NodeSynchCopyFillPattern(axis));
+        bdry_synch_alg.createSchedule(patch_level)->fillData(0.0);
+    }
+
+    // Determine the number of local DOFs.
+    int local_dof_count = 0;
+    counter = 0;
+    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+        const int patch_num = patch->getPatchNumber();
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<NodeData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
+        const int depth = dof_index_data->getDepth();
+        Pointer<NodeData<NDIM, int> > patch_num_data = patch->getPatchData(patch_num_idx);
+        Pointer<NodeData<NDIM, bool> > mastr_loc_data = patch->getPatchData(mastr_loc_idx);
+        for (Box<NDIM>::Iterator b(NodeGeometry<NDIM>::toNodeBox(patch_box)); b; b++)
+        {
+            const NodeIndex<NDIM> i(b(), IntVector<NDIM>(0));
+            bool mastr_loc = (*patch_num_data)(i) == patch_num;
+            for (int d = 0; d < depth; ++d)
+            {
+                mastr_loc = ((*dof_index_data)(i, d) == counter++) && mastr_loc;
+            }
+            (*mastr_loc_data)(i) = mastr_loc;
+            if (LIKELY(mastr_loc)) local_dof_count += depth;
+        }
+    }
+
+    // Determine the number of DOFs local to each MPI process and compute the
+    // local DOF index offset.
+    const int mpi_size = IBTK_MPI::getNodes();
+    const int mpi_rank = IBTK_MPI::getRank();
+    num_dofs_per_proc.resize(mpi_size);
+    std::fill(num_dofs_per_proc.begin(), num_dofs_per_proc.end(), 0);
+    IBTK_MPI::allGather(local_dof_count, &num_dofs_per_proc[0]);
+    const int local_dof_offset = std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.begin() + mpi_rank, 0);
+
+    // Assign local DOF indices.
+    counter = local_dof_offset;
+    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = patch_level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<NodeData<NDIM, int> > dof_index_data = patch->getPatchData(dof_index_idx);
+        const int depth = dof_index_data->getDepth();
+        dof_index_data->fillAll(-1);
+        Pointer<NodeData<NDIM, bool> > mastr_loc_data = patch->getPatchData(mastr_loc_idx);
+        for (Box<NDIM>::Iterator b(NodeGeometry<NDIM>::toNodeBox(patch_box)); b; b++)
+        {
+            const NodeIndex<NDIM> i(b(), IntVector<NDIM>(0));
+            if (UNLIKELY(!(*mastr_loc_data)(i))) continue;
+            for (int d = 0; d < depth; ++d)
+            {
+                (*dof_index_data)(i, d) = counter++;
+            }
+        }
+    }
+
+    // Deallocate temporary variable data.
+    patch_level->deallocatePatchData(patch_num_idx);
+    patch_level->deallocatePatchData(mastr_loc_idx);
+
+    // Communicate ghost DOF indices.
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        RefineAlgorithm<NDIM> dof_synch_alg;
+        dof_synch_alg.registerRefine(
+            dof_index_idx, dof_index_idx, dof_index_idx, nullptr, new NodeSynchCopyFillPattern(axis));
+        dof_synch_alg.createSchedule(patch_level)->fillData(0.0);
+    }
+    RefineAlgorithm<NDIM> ghost_fill_alg;
+    ghost_fill_alg.registerRefine(dof_index_idx, dof_index_idx, dof_index_idx, nullptr);
+    ghost_fill_alg.createSchedule(patch_level)->fillData(0.0);
+    return;
+} // constructPatchLevelDOFIndices_node
+
 void
 PETScVecUtilities::constructPatchLevelAO_cell(AO& ao,
                                               std::vector<int>& num_dofs_per_proc,
@@ -15,13 +15,17 @@
 
 #include "ibtk/CartSideRobinPhysBdryOp.h"
 #include "ibtk/PatchMathOps.h"
+#include "ibtk/ibtk_utilities.h"
 
+#include "ArrayData.h"
 #include "Box.h"
+#include "BoxList.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
 #include "EdgeData.h" // IWYU pragma: keep
 #include "FaceData.h" // IWYU pragma: keep
 #include "FaceGeometry.h"
+#include "IntVector.h"
 #include "NodeData.h"
 #include "NodeGeometry.h"
 #include "SideData.h" // IWYU pragma: keep
@@ -76,10 +80,8 @@
 #define C_TO_F_ANISO_FLUX_ADD_FC IBTK_FC_FUNC(ctofanisofluxadd2d, CTOFANISOFLUXADD2D)
 #define C_TO_F_INTERP_FC IBTK_FC_FUNC(ctofinterp2nd2d, CTOFINTERP2ND2D)
 
-#define C_TO_S_GRAD_FC IBTK_FC_FUNC(ctosgrad2d, CTOSGRAD2D)
 #define C_TO_S_FLUX_FC IBTK_FC_FUNC(ctosflux2d, CTOSFLUX2D)
 #define C_TO_S_ANISO_FLUX_FC IBTK_FC_FUNC(ctosanisoflux2d, CTOSANISOFLUX2D)
-#define C_TO_S_GRAD_ADD_FC IBTK_FC_FUNC(ctosgradadd2d, CTOSGRADADD2D)
 #define C_TO_S_FLUX_ADD_FC IBTK_FC_FUNC(ctosfluxadd2d, CTOSFLUXADD2D)
 #define C_TO_S_ANISO_FLUX_ADD_FC IBTK_FC_FUNC(ctosanisofluxadd2d, CTOSANISOFLUXADD2D)
 #define C_TO_S_INTERP_FC IBTK_FC_FUNC(ctosinterp2nd2d, CTOSINTERP2ND2D)
@@ -91,8 +93,6 @@
 #define F_TO_C_INTERP_FC IBTK_FC_FUNC(ftocinterp2nd2d, FTOCINTERP2ND2D)
 
 #define S_TO_C_CURL_FC IBTK_FC_FUNC(stoccurl2d, STOCCURL2D)
-#define S_TO_C_DIV_FC IBTK_FC_FUNC(stocdiv2d, STOCDIV2D)
-#define S_TO_C_DIV_ADD_FC IBTK_FC_FUNC(stocdivadd2d, STOCDIVADD2D)
 #define S_TO_C_INTERP_FC IBTK_FC_FUNC(stocinterp2nd2d, STOCINTERP2ND2D)
 
 #define S_TO_S_VC_LAPLACE_FC IBTK_FC_FUNC(stosvclaplace2d, STOSVCLAPLACE2D)
@@ -149,10 +149,8 @@
 #define C_TO_F_ANISO_FLUX_ADD_FC IBTK_FC_FUNC(ctofanisofluxadd3d, CTOFANISOFLUXADD3D)
 #define C_TO_F_INTERP_FC IBTK_FC_FUNC(ctofinterp2nd3d, CTOFINTERP2ND3D)
 
-#define C_TO_S_GRAD_FC IBTK_FC_FUNC(ctosgrad3d, CTOSGRAD3D)
 #define C_TO_S_FLUX_FC IBTK_FC_FUNC(ctosflux3d, CTOSFLUX3D)
 #define C_TO_S_ANISO_FLUX_FC IBTK_FC_FUNC(ctosanisoflux3d, CTOSANISOFLUX3D)
-#define C_TO_S_GRAD_ADD_FC IBTK_FC_FUNC(ctosgradadd3d, CTOSGRADADD3D)
 #define C_TO_S_FLUX_ADD_FC IBTK_FC_FUNC(ctosfluxadd3d, CTOSFLUXADD3D)
 #define C_TO_S_ANISO_FLUX_ADD_FC IBTK_FC_FUNC(ctosanisofluxadd3d, CTOSANISOFLUXADD3D)
 #define C_TO_S_INTERP_FC IBTK_FC_FUNC(ctosinterp2nd3d, CTOSINTERP2ND3D)
@@ -166,8 +164,6 @@
 #define F_TO_F_CURL_FC IBTK_FC_FUNC(ftofcurl3d, FTOFCURL3D)
 
 #define S_TO_C_CURL_FC IBTK_FC_FUNC(stoccurl3d, STOCCURL3D)
-#define S_TO_C_DIV_FC IBTK_FC_FUNC(stocdiv3d, STOCDIV3D)
-#define S_TO_C_DIV_ADD_FC IBTK_FC_FUNC(stocdivadd3d, STOCDIVADD3D)
 #define S_TO_C_INTERP_FC IBTK_FC_FUNC(stocinterp2nd3d, STOCINTERP2ND3D)
 
 #define S_TO_S_VC_LAPLACE_FC IBTK_FC_FUNC(stosvclaplace3d, STOSVCLAPLACE3D)
@@ -826,25 +822,6 @@ extern "C"
 #endif
     );
 
-    void C_TO_S_GRAD_FC(double* g0,
-                        double* g1,
-#if (NDIM == 3)
-                        double* g2,
-#endif
-                        const int& g_gcw,
-                        const double& alpha,
-                        const double* U,
-                        const int& U_gcw,
-                        const int& ilower0,
-                        const int& iupper0,
-                        const int& ilower1,
-                        const int& iupper1,
-#if (NDIM == 3)
-                        const int& ilower2,
-                        const int& iupper2,
-#endif
-                        const double* dx);
-
     void C_TO_S_FLUX_FC(double* g0,
                         double* g1,
 #if (NDIM == 3)
@@ -893,32 +870,6 @@ extern "C"
 #endif
                               const double* dx);
 
-    void C_TO_S_GRAD_ADD_FC(double* g0,
-                            double* g1,
-#if (NDIM == 3)
-                            double* g2,
-#endif
-                            const int& g_gcw,
-                            const double& alpha,
-                            const double* U,
-                            const int& U_gcw,
-                            const double& beta,
-                            const double* v0,
-                            const double* v1,
-#if (NDIM == 3)
-                            const double* v2,
-#endif
-                            const int& v_gcw,
-                            const int& ilower0,
-                            const int& iupper0,
-                            const int& ilower1,
-                            const int& iupper1,
-#if (NDIM == 3)
-                            const int& ilower2,
-                            const int& iupper2,
-#endif
-                            const double* dx);
-
     void C_TO_S_FLUX_ADD_FC(double* g0,
                             double* g1,
 #if (NDIM == 3)
@@ -1133,47 +1084,6 @@ extern "C"
 #endif
                         const double* dx);
 
-    void S_TO_C_DIV_FC(double* D,
-                       const int& D_gcw,
-                       const double& alpha,
-                       const double* u0,
-                       const double* u1,
-#if (NDIM == 3)
-                       const double* u2,
-#endif
-                       const int& u_gcw,
-                       const int& ilower0,
-                       const int& iupper0,
-                       const int& ilower1,
-                       const int& iupper1,
-#if (NDIM == 3)
-                       const int& ilower2,
-                       const int& iupper2,
-#endif
-                       const double* dx);
-
-    void S_TO_C_DIV_ADD_FC(double* D,
-                           const int& D_gcw,
-                           const double& alpha,
-                           const double* u0,
-                           const double* u1,
-#if (NDIM == 3)
-                           const double* u2,
-#endif
-                           const int& u_gcw,
-                           const double& beta,
-                           const double* V,
-                           const int& V_gcw,
-                           const int& ilower0,
-                           const int& iupper0,
-                           const int& ilower1,
-                           const int& iupper1,
-#if (NDIM == 3)
-                           const int& ilower2,
-                           const int& iupper2,
-#endif
-                           const double* dx);
-
     void S_TO_C_INTERP_FC(double* U,
                           const int& U_gcw,
                           const double* v0,
@@ -1426,6 +1336,292 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Compute F = alpha L U + beta U + gamma V on the indices of data_box that are
+// at least one index away from the boundary of data_box, in which data_box is
+// the index box of the data arrays (excluding ghost cells).  Shrinking the
+// computational box and increasing the ghost cell widths by the same amount
+// gives the Fortran routines the same array layout as the full data arrays.
+void
+laplace_interior(double* const F,
+                 const int F_ghosts,
+                 const double alpha,
+                 const double beta,
+                 const double* const U,
+                 const int U_ghosts,
+                 const double gamma,
+                 const double* const V,
+                 const int V_ghosts,
+                 const Box<NDIM>& data_box,
+                 const double* const dx)
+{
+    const Box<NDIM> box = Box<NDIM>::grow(data_box, IntVector<NDIM>(-1));
+    if (box.empty()) return;
+    if (!V || (gamma == 0.0))
+    {
+        if (beta == 0.0)
+        {
+            LAPLACE_FC(F,
+                       F_ghosts + 1,
+                       alpha,
+                       U,
+                       U_ghosts + 1,
+                       box.lower(0),
+                       box.upper(0),
+                       box.lower(1),
+                       box.upper(1),
+#if (NDIM == 3)
+                       box.lower(2),
+                       box.upper(2),
+#endif
+                       dx);
+        }
+        else
+        {
+            DAMPED_LAPLACE_FC(F,
+                              F_ghosts + 1,
+                              alpha,
+                              beta,
+                              U,
+                              U_ghosts + 1,
+                              box.lower(0),
+                              box.upper(0),
+                              box.lower(1),
+                              box.upper(1),
+#if (NDIM == 3)
+                              box.lower(2),
+                              box.upper(2),
+#endif
+                              dx);
+        }
+    }
+    else
+    {
+        if (beta == 0.0)
+        {
+            LAPLACE_ADD_FC(F,
+                           F_ghosts + 1,
+                           alpha,
+                           U,
+                           U_ghosts + 1,
+                           gamma,
+                           V,
+                           V_ghosts + 1,
+                           box.lower(0),
+                           box.upper(0),
+                           box.lower(1),
+                           box.upper(1),
+#if (NDIM == 3)
+                           box.lower(2),
+                           box.upper(2),
+#endif
+                           dx);
+        }
+        else
+        {
+            DAMPED_LAPLACE_ADD_FC(F,
+                                  F_ghosts + 1,
+                                  alpha,
+                                  beta,
+                                  U,
+                                  U_ghosts + 1,
+                                  gamma,
+                                  V,
+                                  V_ghosts + 1,
+                                  box.lower(0),
+                                  box.upper(0),
+                                  box.lower(1),
+                                  box.upper(1),
+#if (NDIM == 3)
+                                  box.lower(2),
+                                  box.upper(2),
+#endif
+                                  dx);
+        }
+    }
+    return;
+} // laplace_interior
+
+// Compute F = alpha L U + beta U + gamma V on the indices of data_box that are
+// not treated by laplace_interior().  This layer is only one index wide, so the
+// stencil is evaluated directly.
+void
+laplace_boundary(ArrayData<NDIM, double>& F,
+                 const int l,
+                 const double alpha,
+                 const double beta,
+                 const ArrayData<NDIM, double>& U,
+                 const int m,
+                 const double gamma,
+                 const ArrayData<NDIM, double>* const V,
+                 const int n,
+                 const Box<NDIM>& data_box,
+                 const double* const dx)
+{
+    std::array<double, NDIM> fac;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        fac[d] = alpha / (dx[d] * dx[d]);
+    }
+    BoxList<NDIM> boxes(data_box);
+    boxes.removeIntersections(Box<NDIM>::grow(data_box, IntVector<NDIM>(-1)));
+    for (BoxList<NDIM>::Iterator bl(boxes); bl; bl++)
+    {
+        for (Box<NDIM>::Iterator b(bl()); b; b++)
+        {
+            const hier::Index<NDIM>& i = b();
+            const double U_i = U(i, m);
+            double F_i = 0.0;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                hier::Index<NDIM> i_lower(i), i_upper(i);
+                i_lower(d) -= 1;
+                i_upper(d) += 1;
+                F_i += fac[d] * (U(i_lower, m) + U(i_upper, m) - 2.0 * U_i);
+            }
+            if (beta != 0.0) F_i += beta * U_i;
+            if (V && (gamma != 0.0)) F_i += gamma * (*V)(i, n);
+            F(i, l) = F_i;
+        }
+    }
+    return;
+} // laplace_boundary
+
+// Strides of a data array with ghost cell width gcw defined on the indices of
+// array_box, stored in column-major (Fortran) order.
+inline std::array<int, NDIM>
+array_strides(const Box<NDIM>& array_box, const int gcw)
+{
+    std::array<int, NDIM> stride;
+    stride[0] = 1;
+    for (unsigned int d = 1; d < NDIM; ++d)
+    {
+        stride[d] = stride[d - 1] * (array_box.numberCells(d - 1) + 2 * gcw);
+    }
+    return stride;
+} // array_strides
+
+// Compute D = alpha div u (+ beta V if add is true) on the cells of
+// patch_box, in which u is side-centered and D and V are cell-centered.  The
+// innermost loop is unit-stride in all arrays so that it can be vectorized.
+template <bool add>
+void
+side_to_cell_div(double* const D,
+                 const int D_ghosts,
+                 const double alpha,
+                 const std::array<const double*, NDIM>& u,
+                 const int u_ghosts,
+                 const double beta,
+                 const double* const V,
+                 const int V_ghosts,
+                 const Box<NDIM>& patch_box,
+                 const double* const dx)
+{
+    std::array<double, NDIM> fac;
+    std::array<Box<NDIM>, NDIM> u_boxes;
+    std::array<std::array<int, NDIM>, NDIM> u_stride;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        fac[axis] = alpha / dx[axis];
+        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+        u_boxes[axis] = Box<NDIM>::grow(side_box, IntVector<NDIM>(u_ghosts));
+        u_stride[axis] = array_strides(side_box, u_ghosts);
+    }
+    const Box<NDIM> D_box = Box<NDIM>::grow(patch_box, IntVector<NDIM>(D_ghosts));
+    const Box<NDIM> V_box = Box<NDIM>::grow(patch_box, IntVector<NDIM>(V_ghosts));
+    const int n0 = patch_box.numberCells(0);
+    const int i0 = patch_box.lower(0);
+#if (NDIM == 3)
+    for (int i2 = patch_box.lower(2); i2 <= patch_box.upper(2); ++i2)
+#endif
+    {
+        for (int i1 = patch_box.lower(1); i1 <= patch_box.upper(1); ++i1)
+        {
+#if (NDIM == 2)
+            const hier::Index<NDIM> i(i0, i1);
+#endif
+#if (NDIM == 3)
+            const hier::Index<NDIM> i(i0, i1, i2);
+#endif
+            double* const D_row = D + array_offset(D_box, i);
+            const double* const V_row = add ? V + array_offset(V_box, i) : nullptr;
+            const double* const u0_row = u[0] + array_offset(u_boxes[0], i);
+            const double* const u1_row = u[1] + array_offset(u_boxes[1], i);
+#if (NDIM == 3)
+            const double* const u2_row = u[2] + array_offset(u_boxes[2], i);
+            const int u2_shift = u_stride[2][2];
+#endif
+            const int u1_shift = u_stride[1][1];
+#pragma omp simd
+            for (int k = 0; k < n0; ++k)
+            {
+                double D_k = fac[0] * (u0_row[k + 1] - u0_row[k]) + fac[1] * (u1_row[k + u1_shift] - u1_row[k]);
+#if (NDIM == 3)
+                D_k += fac[2] * (u2_row[k + u2_shift] - u2_row[k]);
+#endif
+                D_row[k] = add ? D_k + beta * V_row[k] : D_k;
+            }
+        }
+    }
+    return;
+} // side_to_cell_div
+
+// Compute g = alpha grad U (+ beta v if add is true) on the sides of
+// patch_box, in which U is cell-centered and g and v are side-centered.  The
+// innermost loop is unit-stride in all arrays so that it can be vectorized.
+template <bool add>
+void
+cell_to_side_grad(const std::array<double*, NDIM>& g,
+                  const int g_ghosts,
+                  const double alpha,
+                  const double* const U,
+                  const int U_ghosts,
+                  const double beta,
+                  const std::array<const double*, NDIM>& v,
+                  const int v_ghosts,
+                  const Box<NDIM>& patch_box,
+                  const double* const dx)
+{
+    const Box<NDIM> U_box = Box<NDIM>::grow(patch_box, IntVector<NDIM>(U_ghosts));
+    const std::array<int, NDIM> U_stride = array_strides(patch_box, U_ghosts);
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        const double fac = alpha / dx[axis];
+        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+        const Box<NDIM> g_box = Box<NDIM>::grow(side_box, IntVector<NDIM>(g_ghosts));
+        const Box<NDIM> v_box = Box<NDIM>::grow(side_box, IntVector<NDIM>(v_ghosts));
+        const int U_shift = U_stride[axis];
+        const int n0 = side_box.numberCells(0);
+        const int i0 = side_box.lower(0);
+#if (NDIM == 3)
+        for (int i2 = side_box.lower(2); i2 <= side_box.upper(2); ++i2)
+#endif
+        {
+            for (int i1 = side_box.lower(1); i1 <= side_box.upper(1); ++i1)
+            {
+#if (NDIM == 2)
+                const hier::Index<NDIM> i(i0, i1);
+#endif
+#if (NDIM == 3)
+                const hier::Index<NDIM> i(i0, i1, i2);
+#endif
+                double* const g_row = g[axis] + array_offset(g_box, i);
+                const double* const v_row = add ? v[axis] + array_offset(v_box, i) : nullptr;
+                const double* const U_row = U + array_offset(U_box, i);
+#pragma omp simd
+                for (int k = 0; k < n0; ++k)
+                {
+                    const double g_k = fac * (U_row[k] - U_row[k - U_shift]);
+                    g_row[k] = add ? g_k + beta * v_row[k] : g_k;
+                }
+            }
+        }
+    }
+    return;
+} // cell_to_side_grad
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 void
@@ -2803,11 +2999,8 @@ PatchMathOps::div(Pointer<CellData<NDIM, double> > dst,
     double* const D = dst->getPointer(l);
     const int D_ghosts = (dst->getGhostCellWidth()).max();
 
-    const double* const u0 = src1->getPointer(0);
-    const double* const u1 = src1->getPointer(1);
-#if (NDIM == 3)
-    const double* const u2 = src1->getPointer(2);
-#endif
+    std::array<const double*, NDIM> u;
+    for (unsigned int axis = 0; axis < NDIM; ++axis) u[axis] = src1->getPointer(axis);
     const int u_ghosts = (src1->getGhostCellWidth()).max();
 
     const Box<NDIM>& patch_box = patch->getBox();
@@ -2840,24 +3033,7 @@ PatchMathOps::div(Pointer<CellData<NDIM, double> > dst,
 
     if (!src2 || (beta == 0.0))
     {
-        S_TO_C_DIV_FC(D,
-                      D_ghosts,
-                      alpha,
-                      u0,
-                      u1,
-#if (NDIM == 3)
-                      u2,
-#endif
-                      u_ghosts,
-                      patch_box.lower(0),
-                      patch_box.upper(0),
-                      patch_box.lower(1),
-                      patch_box.upper(1),
-#if (NDIM == 3)
-                      patch_box.lower(2),
-                      patch_box.upper(2),
-#endif
-                      dx);
+        side_to_cell_div<false>(D, D_ghosts, alpha, u, u_ghosts, 0.0, nullptr, 0, patch_box, dx);
     }
     else
     {
@@ -2877,27 +3053,7 @@ PatchMathOps::div(Pointer<CellData<NDIM, double> > dst,
                        << "  dst, src1, and src2 must all live on the same patch" << std::endl);
         }
 #endif
-        S_TO_C_DIV_ADD_FC(D,
-                          D_ghosts,
-                          alpha,
-                          u0,
-                          u1,
-#if (NDIM == 3)
-                          u2,
-#endif
-                          u_ghosts,
-                          beta,
-                          V,
-                          V_ghosts,
-                          patch_box.lower(0),
-                          patch_box.upper(0),
-                          patch_box.lower(1),
-                          patch_box.upper(1),
-#if (NDIM == 3)
-                          patch_box.lower(2),
-                          patch_box.upper(2),
-#endif
-                          dx);
+        side_to_cell_div<true>(D, D_ghosts, alpha, u, u_ghosts, beta, V, V_ghosts, patch_box, dx);
     }
     return;
 } // div
@@ -3186,11 +3342,8 @@ PatchMathOps::grad(Pointer<SideData<NDIM, double> > dst,
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
 
-    double* const g0 = dst->getPointer(0);
-    double* const g1 = dst->getPointer(1);
-#if (NDIM == 3)
-    double* const g2 = dst->getPointer(2);
-#endif
+    std::array<double*, NDIM> g;
+    for (unsigned int axis = 0; axis < NDIM; ++axis) g[axis] = dst->getPointer(axis);
     const int g_ghosts = (dst->getGhostCellWidth()).max();
 
     const double* const U = src1->getPointer(l);
@@ -3235,32 +3388,12 @@ PatchMathOps::grad(Pointer<SideData<NDIM, double> > dst,
 
     if (!src2 || (beta == 0.0))
     {
-        C_TO_S_GRAD_FC(g0,
-                       g1,
-#if (NDIM == 3)
-                       g2,
-#endif
-                       g_ghosts,
-                       alpha,
-                       U,
-                       U_ghosts,
-                       patch_box.lower(0),
-                       patch_box.upper(0),
-                       patch_box.lower(1),
-                       patch_box.upper(1),
-#if (NDIM == 3)
-                       patch_box.lower(2),
-                       patch_box.upper(2),
-#endif
-                       dx);
+        cell_to_side_grad<false>(g, g_ghosts, alpha, U, U_ghosts, 0.0, {}, 0, patch_box, dx);
     }
     else
     {
-        const double* const v0 = src2->getPointer(0);
-        const double* const v1 = src2->getPointer(1);
-#if (NDIM == 3)
-        const double* const v2 = src2->getPointer(2);
-#endif
+        std::array<const double*, NDIM> v;
+        for (unsigned int axis = 0; axis < NDIM; ++axis) v[axis] = src2->getPointer(axis);
         const int v_ghosts = (src2->getGhostCellWidth()).max();
 
 #if !defined(NDEBUG)
@@ -3276,31 +3409,7 @@ PatchMathOps::grad(Pointer<SideData<NDIM, double> > dst,
                        << "  dst, src1, and src2 must all live on the same patch" << std::endl);
         }
 #endif
-        C_TO_S_GRAD_ADD_FC(g0,
-                           g1,
-#if (NDIM == 3)
-                           g2,
-#endif
-                           g_ghosts,
-                           alpha,
-                           U,
-                           U_ghosts,
-                           beta,
-                           v0,
-                           v1,
-#if (NDIM == 3)
-                           v2,
-#endif
-                           v_ghosts,
-                           patch_box.lower(0),
-                           patch_box.upper(0),
-                           patch_box.lower(1),
-                           patch_box.upper(1),
-#if (NDIM == 3)
-                           patch_box.lower(2),
-                           patch_box.upper(2),
-#endif
-                           dx);
+        cell_to_side_grad<true>(g, g_ghosts, alpha, U, U_ghosts, beta, v, v_ghosts, patch_box, dx);
     }
     return;
 } // grad
@@ -5169,6 +5278,142 @@ PatchMathOps::laplace(Pointer<SideData<NDIM, double> > dst,
     return;
 } // laplace
 
+void
+PatchMathOps::laplaceInterior(Pointer<CellData<NDIM, double> > dst,
+                              const double alpha,
+                              const double beta,
+                              const Pointer<CellData<NDIM, double> > src1,
+                              const double gamma,
+                              const Pointer<CellData<NDIM, double> > src2,
+                              const Pointer<Patch<NDIM> > patch,
+                              const int l,
+                              const int m,
+                              const int n) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(dst->getGhostCellWidth().max() == dst->getGhostCellWidth().min());
+    TBOX_ASSERT(src1->getGhostCellWidth().max() == src1->getGhostCellWidth().min());
+    TBOX_ASSERT(!src2 || src2->getGhostCellWidth().max() == src2->getGhostCellWidth().min());
+    TBOX_ASSERT(src1 != dst);
+#endif
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    laplace_interior(dst->getPointer(l),
+                     dst->getGhostCellWidth().max(),
+                     alpha,
+                     beta,
+                     src1->getPointer(m),
+                     src1->getGhostCellWidth().max(),
+                     gamma,
+                     src2 ? src2->getPointer(n) : nullptr,
+                     src2 ? src2->getGhostCellWidth().max() : 0,
+                     patch->getBox(),
+                     dx);
+    return;
+} // laplaceInterior
+
+void
+PatchMathOps::laplaceBoundary(Pointer<CellData<NDIM, double> > dst,
+                              const double alpha,
+                              const double beta,
+                              const Pointer<CellData<NDIM, double> > src1,
+                              const double gamma,
+                              const Pointer<CellData<NDIM, double> > src2,
+                              const Pointer<Patch<NDIM> > patch,
+                              const int l,
+                              const int m,
+                              const int n) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(src1 != dst);
+#endif
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    laplace_boundary(dst->getArrayData(),
+                     l,
+                     alpha,
+                     beta,
+                     src1->getArrayData(),
+                     m,
+                     gamma,
+                     src2 ? &src2->getArrayData() : nullptr,
+                     n,
+                     patch->getBox(),
+                     dx);
+    return;
+} // laplaceBoundary
+
+void
+PatchMathOps::laplaceInterior(Pointer<SideData<NDIM, double> > dst,
+                              const double alpha,
+                              const double beta,
+                              const Pointer<SideData<NDIM, double> > src1,
+                              const double gamma,
+                              const Pointer<SideData<NDIM, double> > src2,
+                              const Pointer<Patch<NDIM> > patch,
+                              const int l,
+                              const int m,
+                              const int n) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(dst->getGhostCellWidth().max() == dst->getGhostCellWidth().min());
+    TBOX_ASSERT(src1->getGhostCellWidth().max() == src1->getGhostCellWidth().min());
+    TBOX_ASSERT(!src2 || src2->getGhostCellWidth().max() == src2->getGhostCellWidth().min());
+    TBOX_ASSERT(src1 != dst);
+#endif
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        laplace_interior(dst->getPointer(axis, l),
+                         dst->getGhostCellWidth().max(),
+                         alpha,
+                         beta,
+                         src1->getPointer(axis, m),
+                         src1->getGhostCellWidth().max(),
+                         gamma,
+                         src2 ? src2->getPointer(axis, n) : nullptr,
+                         src2 ? src2->getGhostCellWidth().max() : 0,
+                         SideGeometry<NDIM>::toSideBox(patch->getBox(), axis),
+                         dx);
+    }
+    return;
+} // laplaceInterior
+
+void
+PatchMathOps::laplaceBoundary(Pointer<SideData<NDIM, double> > dst,
+                              const double alpha,
+                              const double beta,
+                              const Pointer<SideData<NDIM, double> > src1,
+                              const double gamma,
+                              const Pointer<SideData<NDIM, double> > src2,
+                              const Pointer<Patch<NDIM> > patch,
+                              const int l,
+                              const int m,
+                              const int n) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(src1 != dst);
+#endif
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        laplace_boundary(dst->getArrayData(axis),
+                         l,
+                         alpha,
+                         beta,
+                         src1->getArrayData(axis),
+                         m,
+                         gamma,
+                         src2 ? &src2->getArrayData(axis) : nullptr,
+                         n,
+                         SideGeometry<NDIM>::toSideBox(patch->getBox(), axis),
+                         dx);
+    }
+    return;
+} // laplaceBoundary
+
 void
 PatchMathOps::laplace(Pointer<CellData<NDIM, double> > dst,
                       const Pointer<FaceData<NDIM, double> > alpha,
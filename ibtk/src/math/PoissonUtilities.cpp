@@ -14,6 +14,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include "ibtk/ExtendedRobinBcCoefStrategy.h"
+#include "ibtk/IBTK_MPI.h"
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/PhysicalBoundaryUtilities.h"
 #include "ibtk/PoissonUtilities.h"
@@ -23,6 +24,7 @@
 #include "ArrayDataBasicOps.h"
 #include "BoundaryBox.h"
 #include "Box.h"
+#include "BoxArray.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
 #include "CellIndex.h"
@@ -34,7 +36,9 @@
 #include "OutersideData.h"
 #include "Patch.h"
 #include "PatchGeometry.h"
+#include "PatchLevel.h"
 #include "PoissonSpecifications.h"
+#include "ProcessorMapping.h"
 #include "RobinBcCoefStrategy.h"
 #include "SideData.h"
 #include "SideIndex.h"
@@ -42,7 +46,9 @@
 #include "tbox/Array.h"
 #include "tbox/Pointer.h"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <limits>
 #include <map>
 #include <string>
@@ -1240,11 +1246,52 @@ PoissonUtilities::adjustRHSAtPhysicalBoundary(CellData<NDIM, double>& rhs_data,
                                               const std::vector<RobinBcCoefStrategy<NDIM>*>& bc_coefs,
                                               double data_time,
                                               bool homogeneous_bc)
+{
+    RHSAdjustment rhs_adjustment;
+    computeRHSAdjustmentAtPhysicalBoundary(
+        rhs_adjustment, rhs_data, patch, poisson_spec, bc_coefs, data_time, homogeneous_bc);
+    applyRHSAdjustment(rhs_data, rhs_adjustment);
+    return;
+} // adjustRHSAtPhysicalBoundary
+
+void
+PoissonUtilities::adjustRHSAtPhysicalBoundary(SideData<NDIM, double>& rhs_data,
+                                              Pointer<Patch<NDIM> > patch,
+                                              const PoissonSpecifications& poisson_spec,
+                                              const std::vector<RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                                              double data_time,
+                                              bool homogeneous_bc)
+{
+    RHSAdjustment rhs_adjustment;
+    computeRHSAdjustmentAtPhysicalBoundary(
+        rhs_adjustment, rhs_data, patch, poisson_spec, bc_coefs, data_time, homogeneous_bc);
+    applyRHSAdjustment(rhs_data, rhs_adjustment);
+    return;
+} // adjustRHSAtPhysicalBoundary
+
+void
+PoissonUtilities::computeRHSAdjustmentAtPhysicalBoundary(RHSAdjustment& rhs_adjustment,
+                                                         const CellData<NDIM, double>& rhs_data,
+                                                         Pointer<Patch<NDIM> > patch,
+                                                         const PoissonSpecifications& poisson_spec,
+                                                         const std::vector<RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                                                         double data_time,
+                                                         bool homogeneous_bc)
 {
     const int depth = rhs_data.getDepth();
 #if !defined(NDEBUG)
     TBOX_ASSERT(static_cast<int>(bc_coefs.size()) == depth);
 #endif
+    const Box<NDIM>& ghost_box = rhs_data.getGhostBox();
+    rhs_adjustment.ghost_box = ghost_box;
+    rhs_adjustment.offsets.assign(1, std::vector<int>());
+    rhs_adjustment.values.assign(1, std::vector<double>());
+
+    // All modifications are proportional to the inhomogeneous boundary values,
+    // so there is nothing to do for homogeneous boundary conditions.
+    if (homogeneous_bc) return;
+    std::vector<int>& offsets = rhs_adjustment.offsets[0];
+    std::vector<double>& values = rhs_adjustment.values[0];
     const Box<NDIM>& patch_box = patch->getBox();
     OutersideData<NDIM, double> D_data(patch_box, depth);
     if (!poisson_spec.dIsConstant())
@@ -1325,20 +1372,22 @@ PoissonUtilities::adjustRHSAtPhysicalBoundary(CellData<NDIM, double>& rhs_data,
                     i_c_intr(bdry_normal_axis) -= 1;
                 }
                 const double& D = D_data.getArrayData(bdry_normal_axis, bdry_side)(i_s_bdry, d);
-                rhs_data(i_c_intr, d) += (D / h) * (-2.0 * g) / (2.0 * b + h * a);
+                offsets.push_back(d * ghost_box.size() + ghost_box.offset(i_c_intr));
+                values.push_back((D / h) * (-2.0 * g) / (2.0 * b + h * a));
             }
         }
     }
     return;
-} // adjustRHSAtPhysicalBoundary
+} // computeRHSAdjustmentAtPhysicalBoundary
 
 void
-PoissonUtilities::adjustRHSAtPhysicalBoundary(SideData<NDIM, double>& rhs_data,
-                                              Pointer<Patch<NDIM> > patch,
-                                              const PoissonSpecifications& poisson_spec,
-                                              const std::vector<RobinBcCoefStrategy<NDIM>*>& bc_coefs,
-                                              double data_time,
-                                              bool homogeneous_bc)
+PoissonUtilities::computeRHSAdjustmentAtPhysicalBoundary(RHSAdjustment& rhs_adjustment,
+                                                         const SideData<NDIM, double>& rhs_data,
+                                                         Pointer<Patch<NDIM> > patch,
+                                                         const PoissonSpecifications& poisson_spec,
+                                                         const std::vector<RobinBcCoefStrategy<NDIM>*>& bc_coefs,
+                                                         double data_time,
+                                                         bool homogeneous_bc)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(static_cast<int>(bc_coefs.size()) == NDIM);
@@ -1349,6 +1398,13 @@ PoissonUtilities::adjustRHSAtPhysicalBoundary(SideData<NDIM, double>& rhs_data,
             "PoissonUtilities::adjustRHSAtPhysicalBoundary() does not support non-constant "
             "coefficient problems\n");
     }
+    rhs_adjustment.ghost_box = rhs_data.getGhostBox();
+    rhs_adjustment.offsets.assign(NDIM, std::vector<int>());
+    rhs_adjustment.values.assign(NDIM, std::vector<double>());
+
+    // All modifications are proportional to the inhomogeneous boundary values,
+    // so there is nothing to do for homogeneous boundary conditions.
+    if (homogeneous_bc) return;
     const Box<NDIM>& patch_box = patch->getBox();
     const double D = poisson_spec.getDConstant();
     const Array<BoundaryBox<NDIM> > physical_codim1_boxes =
@@ -1380,6 +1436,7 @@ PoissonUtilities::adjustRHSAtPhysicalBoundary(SideData<NDIM, double>& rhs_data,
     // boundary conditions, we set those values last.
     for (unsigned int axis = 0; axis < NDIM; ++axis)
     {
+        const Box<NDIM>& data_box = rhs_data.getArrayData(axis).getBox();
         for (int n = 0; n < n_physical_codim1_boxes; ++n)
         {
             const BoundaryBox<NDIM>& bdry_box = physical_codim1_boxes[n];
@@ -1470,7 +1527,8 @@ PoissonUtilities::adjustRHSAtPhysicalBoundary(SideData<NDIM, double>& rhs_data,
                     i_intr(bdry_normal_axis) -= 1;
                 }
                 const SideIndex<NDIM> i_s(i_intr, axis, SideIndex<NDIM>::Lower);
-                rhs_data(i_s) += (D / h) * (-2.0 * g) / (2.0 * b + h * a);
+                rhs_adjustment.offsets[axis].push_back(data_box.offset(i_s));
+                rhs_adjustment.values[axis].push_back((D / h) * (-2.0 * g) / (2.0 * b + h * a));
             }
         }
     }
@@ -1484,6 +1542,7 @@ PoissonUtilities::adjustRHSAtPhysicalBoundary(SideData<NDIM, double>& rhs_data,
     // boundary conditions, we set those values last.
     for (unsigned int axis = 0; axis < NDIM; ++axis)
     {
+        const Box<NDIM>& data_box = rhs_data.getArrayData(axis).getBox();
         for (int n = 0; n < n_physical_codim1_boxes; ++n)
         {
             const BoundaryBox<NDIM>& bdry_box = physical_codim1_boxes[n];
@@ -1545,13 +1604,53 @@ PoissonUtilities::adjustRHSAtPhysicalBoundary(SideData<NDIM, double>& rhs_data,
 #if !defined(NDEBUG)
                     TBOX_ASSERT(!MathUtilities<double>::equalEps(b, 0.0));
 #endif
-                    rhs_data(i_s_bdry) += (D / h) * (-2.0 * g) / b;
+                    rhs_adjustment.offsets[axis].push_back(data_box.offset(i_s_bdry));
+                    rhs_adjustment.values[axis].push_back((D / h) * (-2.0 * g) / b);
                 }
             }
         }
     }
     return;
-} // adjustRHSAtPhysicalBoundary
+} // computeRHSAdjustmentAtPhysicalBoundary
+
+void
+PoissonUtilities::applyRHSAdjustment(CellData<NDIM, double>& rhs_data, const RHSAdjustment& rhs_adjustment)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(rhs_adjustment.ghost_box == rhs_data.getGhostBox());
+    TBOX_ASSERT(rhs_adjustment.offsets.size() == 1 && rhs_adjustment.values.size() == 1);
+#endif
+    double* const rhs_vals = rhs_data.getPointer();
+    const std::vector<int>& offsets = rhs_adjustment.offsets[0];
+    const std::vector<double>& values = rhs_adjustment.values[0];
+    const std::size_t n_vals = values.size();
+    for (std::size_t k = 0; k < n_vals; ++k)
+    {
+        rhs_vals[offsets[k]] += values[k];
+    }
+    return;
+} // applyRHSAdjustment
+
+void
+PoissonUtilities::applyRHSAdjustment(SideData<NDIM, double>& rhs_data, const RHSAdjustment& rhs_adjustment)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(rhs_adjustment.ghost_box == rhs_data.getGhostBox());
+    TBOX_ASSERT(rhs_adjustment.offsets.size() == NDIM && rhs_adjustment.values.size() == NDIM);
+#endif
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        double* const rhs_vals = rhs_data.getPointer(axis);
+        const std::vector<int>& offsets = rhs_adjustment.offsets[axis];
+        const std::vector<double>& values = rhs_adjustment.values[axis];
+        const std::size_t n_vals = values.size();
+        for (std::size_t k = 0; k < n_vals; ++k)
+        {
+            rhs_vals[offsets[k]] += values[k];
+        }
+    }
+    return;
+} // applyRHSAdjustment
 
 void
 PoissonUtilities::adjustVCSCViscousOpRHSAtPhysicalBoundary(SideData<NDIM, double>& rhs_data,
@@ -2259,6 +2358,83 @@ PoissonUtilities::adjustVCSCViscousOpRHSAtCoarseFineBoundary(SideData<NDIM, doub
     return;
 } // adjustVCSCViscousOpRHSAtCoarseFineBoundary
 
+bool
+PoissonUtilities::getMatrixScaleFactor(const std::vector<std::vector<double> >& old_values,
+                                       const std::vector<std::vector<double> >& new_values,
+                                       double& scale)
+{
+    static const double eps = 1.0e-12;
+    bool proportional = old_values.size() == new_values.size();
+    for (unsigned int k = 0; proportional && k < old_values.size(); ++k)
+    {
+        proportional = old_values[k].size() == new_values[k].size();
+    }
+
+    // Determine the local scale factor from the largest matrix entry.
+    bool has_local_scale = false;
+    double local_scale = 1.0;
+    double max_abs_value = 0.0;
+    for (unsigned int k = 0; proportional && k < old_values.size(); ++k)
+    {
+        for (unsigned int i = 0; i < old_values[k].size(); ++i)
+        {
+            if (std::abs(old_values[k][i]) > max_abs_value)
+            {
+                max_abs_value = std::abs(old_values[k][i]);
+                local_scale = new_values[k][i] / old_values[k][i];
+                has_local_scale = true;
+            }
+        }
+    }
+    proportional = proportional && (!has_local_scale || local_scale != 0.0);
+
+    // Check that all local matrix entries are scaled by the same factor.
+    for (unsigned int k = 0; proportional && k < old_values.size(); ++k)
+    {
+        for (unsigned int i = 0; proportional && i < old_values[k].size(); ++i)
+        {
+            proportional = std::abs(new_values[k][i] - local_scale * old_values[k][i]) <=
+                           eps * std::abs(local_scale) * max_abs_value;
+        }
+    }
+
+    // Check that all processors agree on the scale factor.
+    proportional = IBTK_MPI::minReduction(static_cast<int>(proportional)) == 1;
+    if (!proportional) return false;
+    const double min_scale =
+        IBTK_MPI::minReduction(has_local_scale ? local_scale : std::numeric_limits<double>::max());
+    const double max_scale =
+        IBTK_MPI::maxReduction(has_local_scale ? local_scale : std::numeric_limits<double>::lowest());
+    if (min_scale > max_scale)
+    {
+        // None of the processors has any nonzero matrix entries.
+        scale = 1.0;
+        return true;
+    }
+    if (max_scale - min_scale > eps * std::max(std::abs(min_scale), std::abs(max_scale))) return false;
+    scale = max_scale;
+    return true;
+} // getMatrixScaleFactor
+
+bool
+PoissonUtilities::levelLayoutMatches(const BoxArray<NDIM>& boxes,
+                                     const tbox::Array<int>& mapping,
+                                     const PatchLevel<NDIM>& level)
+{
+    const BoxArray<NDIM>& level_boxes = level.getBoxes();
+    const ProcessorMapping& level_mapping = level.getProcessorMapping();
+    if (boxes.getNumberOfBoxes() != level_boxes.getNumberOfBoxes() || mapping.getSize() != boxes.getNumberOfBoxes())
+    {
+        return false;
+    }
+    for (int i = 0; i < boxes.getNumberOfBoxes(); ++i)
+    {
+        if (!(boxes[i] == level_boxes[i])) return false;
+        if (mapping[i] != level_mapping.getProcessorAssignment(i)) return false;
+    }
+    return true;
+} // levelLayoutMatches
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
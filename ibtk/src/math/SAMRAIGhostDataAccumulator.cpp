@@ -35,6 +35,9 @@
 #include <CellVariable.h>
 #include <IntVector.h>
 #include <MultiblockDataTranslator.h>
+#include <NodeData.h>
+#include <NodeDataFactory.h>
+#include <NodeVariable.h>
 #include <Patch.h>
 #include <PatchData.h>
 #include <PatchLevel.h>
@@ -49,6 +52,7 @@
 #include <numeric>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <ibtk/namespaces.h> // IWYU pragma: keep
@@ -60,68 +64,30 @@ namespace IBTK
 /////////////////////////////// STATIC ///////////////////////////////////////
 namespace
 {
-// The code leading to VecGetValues and VecSetValues is identical, so use one
-// function for both. Here the last argument is true if we set and false if we
-// get.
-void
-add_or_get(Pointer<PatchLevel<NDIM> >& level,
-           const IntVector<NDIM> gcw,
-           const bool cc_data,
-           const int local_dof_idx,
-           const int value_idx,
-           Vec vec,
-           const bool add)
+// Get the arrays of cell-, side-, or node-centered patch data. Side-centered
+// data stores one array for each direction.
+template <typename T>
+std::vector<ArrayData<NDIM, T>*>
+get_arrays(Pointer<PatchData<NDIM> > data)
 {
-    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    std::vector<ArrayData<NDIM, T>*> arrays;
+    Pointer<CellData<NDIM, T> > cc_data = data;
+    Pointer<SideData<NDIM, T> > sc_data = data;
+    Pointer<NodeData<NDIM, T> > nc_data = data;
+    if (cc_data)
     {
-        Pointer<Patch<NDIM> > patch = level->getPatch(p());
-        TBOX_ASSERT(gcw == patch->getPatchData(value_idx)->getGhostCellWidth());
-        std::vector<ArrayData<NDIM, double>*> values_ptrs;
-        std::vector<ArrayData<NDIM, int>*> dofs_ptrs;
-        if (cc_data) // semantics are slightly different for side-centered data
-        {
-            Pointer<CellData<NDIM, double> > value_data = patch->getPatchData(value_idx);
-            Pointer<CellData<NDIM, int> > dof_data = patch->getPatchData(local_dof_idx);
-            TBOX_ASSERT(value_data);
-            TBOX_ASSERT(dof_data);
-
-            dofs_ptrs.push_back(&dof_data->getArrayData());
-            values_ptrs.push_back(&value_data->getArrayData());
-        }
-        else
-        {
-            Pointer<SideData<NDIM, double> > value_data = patch->getPatchData(value_idx);
-            Pointer<SideData<NDIM, int> > dof_data = patch->getPatchData(local_dof_idx);
-            TBOX_ASSERT(value_data);
-            TBOX_ASSERT(dof_data);
-
-            for (int d = 0; d < NDIM; ++d)
-            {
-                dofs_ptrs.push_back(&dof_data->getArrayData(d));
-                values_ptrs.push_back(&value_data->getArrayData(d));
-            }
-        }
-
-        static_assert(std::is_same<PetscInt, int>::value, "only implemented for 32-bit PETSc indices");
-        Vec local;
-        int ierr = VecGhostGetLocalForm(vec, &local);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecSetOption(local, VEC_IGNORE_NEGATIVE_INDICES, PETSC_TRUE);
-        IBTK_CHKERRQ(ierr);
-        for (unsigned int d = 0; d < dofs_ptrs.size(); ++d)
-        {
-            const PetscInt size = dofs_ptrs[d]->getDepth() * dofs_ptrs[d]->getOffset();
-            TBOX_ASSERT(size == values_ptrs[d]->getDepth() * values_ptrs[d]->getOffset());
-            if (add)
-                ierr = VecSetValues(local, size, dofs_ptrs[d]->getPointer(), values_ptrs[d]->getPointer(), ADD_VALUES);
-            else
-                ierr = VecGetValues(local, size, dofs_ptrs[d]->getPointer(), values_ptrs[d]->getPointer());
-
-            IBTK_CHKERRQ(ierr);
-        }
-        ierr = VecGhostRestoreLocalForm(vec, &local);
-        IBTK_CHKERRQ(ierr);
+        arrays.push_back(&cc_data->getArrayData());
+    }
+    else if (sc_data)
+    {
+        for (int d = 0; d < NDIM; ++d) arrays.push_back(&sc_data->getArrayData(d));
     }
+    else if (nc_data)
+    {
+        arrays.push_back(&nc_data->getArrayData());
+    }
+    TBOX_ASSERT(!arrays.empty());
+    return arrays;
 }
 } // namespace
 
@@ -133,42 +99,47 @@ SAMRAIGhostDataAccumulator::SAMRAIGhostDataAccumulator(Pointer<BasePatchHierarch
                                                        const int finest_ln)
     : d_hierarchy(patch_hierarchy), d_var(var), d_gcw(gcw), d_coarsest_ln(coarsest_ln), d_finest_ln(finest_ln)
 {
-    // Determine data layout:
+    // Determine data layout and depth:
     Pointer<CellVariable<NDIM, double> > cc_var = var;
     Pointer<SideVariable<NDIM, double> > sc_var = var;
-    const bool cc_data = cc_var;
-    const bool sc_data = sc_var;
-    TBOX_ASSERT(cc_data || sc_data);
-    d_cc_data = cc_data;
-
-    // Create a context into which all indexing variables are grouped for this class:
-    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
-    Pointer<VariableContext> context = var_db->getContext("SAMRAIGhostDataAccumulator");
-
-    // Determine depth:
+    Pointer<NodeVariable<NDIM, double> > nc_var = var;
+    TBOX_ASSERT(cc_var || sc_var || nc_var);
     int depth = 0;
-    if (d_cc_data)
+    if (cc_var)
     {
         Pointer<CellDataFactory<NDIM, double> > cc_data_factory = cc_var->getPatchDataFactory();
         depth = cc_data_factory->getDefaultDepth();
     }
-    else
+    else if (sc_var)
     {
         Pointer<SideDataFactory<NDIM, double> > sc_data_factory = sc_var->getPatchDataFactory();
         depth = sc_data_factory->getDefaultDepth();
     }
+    else
+    {
+        Pointer<NodeDataFactory<NDIM, double> > nc_data_factory = nc_var->getPatchDataFactory();
+        depth = nc_data_factory->getDefaultDepth();
+    }
     TBOX_ASSERT(depth != 0);
 
+    // Create a context into which all indexing variables are grouped for this class:
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<VariableContext> context = var_db->getContext("SAMRAIGhostDataAccumulator");
+
     const std::string name = "SAMRAIGhostDataAccumulator::dof_" + var->getName();
 
     // Create the dof indexing variable and its data:
     d_vecs.resize(d_finest_ln + 1); // be lazy and index this array directly by level number
+    d_dof_maps.resize(d_finest_ln + 1);
     Pointer<Variable<NDIM> > dof_var;
     if (var_db->checkVariableExists(name))
         dof_var = var_db->getVariable(name);
+    else if (cc_var)
+        dof_var = new CellVariable<NDIM, int>(name, depth);
+    else if (sc_var)
+        dof_var = new SideVariable<NDIM, int>(name, depth);
     else
-        dof_var = d_cc_data ? Pointer<Variable<NDIM> >(new CellVariable<NDIM, int>(name, depth)) :
-                              Pointer<Variable<NDIM> >(new SideVariable<NDIM, int>(name, depth));
+        dof_var = new NodeVariable<NDIM, int>(name, depth);
 
     d_global_dof_idx = var_db->registerVariableAndContext(dof_var, context, d_gcw);
     d_local_dof_idx = var_db->registerClonedPatchDataIndex(dof_var, d_global_dof_idx);
@@ -178,6 +149,8 @@ SAMRAIGhostDataAccumulator::SAMRAIGhostDataAccumulator(Pointer<BasePatchHierarch
         level->allocatePatchData(d_global_dof_idx);
         level->allocatePatchData(d_local_dof_idx);
 
+        // The ghost values of the dof numbering are filled on the level
+        // (including periodic images) by constructPatchLevelDOFIndices().
         std::vector<int> num_dofs_per_proc;
         PETScVecUtilities::constructPatchLevelDOFIndices(num_dofs_per_proc, d_global_dof_idx, level);
         const int mpi_rank = IBTK_MPI::getRank();
@@ -191,19 +164,7 @@ SAMRAIGhostDataAccumulator::SAMRAIGhostDataAccumulator(Pointer<BasePatchHierarch
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            std::vector<ArrayData<NDIM, int>*> dofs_ptrs;
-            if (d_cc_data)
-            {
-                Pointer<CellData<NDIM, int> > dof_data = patch->getPatchData(d_global_dof_idx);
-                dofs_ptrs.push_back(&dof_data->getArrayData());
-            }
-            else
-            {
-                Pointer<SideData<NDIM, int> > dof_data = patch->getPatchData(d_global_dof_idx);
-                // SideData stores multiple arrays (one for each dimension)
-                for (int d = 0; d < NDIM; ++d) dofs_ptrs.push_back(&dof_data->getArrayData(d));
-            }
-            for (ArrayData<NDIM, int>* dofs : dofs_ptrs)
+            for (ArrayData<NDIM, int>* dofs : get_arrays<int>(patch->getPatchData(d_global_dof_idx)))
             {
                 const int* dofs_ptr = dofs->getPointer();
                 const int size = dofs->getBox().size() * dofs->getDepth();
@@ -217,6 +178,7 @@ SAMRAIGhostDataAccumulator::SAMRAIGhostDataAccumulator(Pointer<BasePatchHierarch
         ghosts.erase(std::unique(ghosts.begin(), ghosts.end()), ghosts.end());
         // make sure that ghosts doesn't have any negative entries
         ghosts.erase(ghosts.begin(), std::upper_bound(ghosts.begin(), ghosts.end(), -1));
+        static_assert(std::is_same<PetscInt, int>::value, "only implemented for 32-bit PETSc indices");
         int ierr = VecCreateGhost(PETSC_COMM_WORLD,
                                   num_dofs_per_proc[mpi_rank],
                                   PETSC_DECIDE,
@@ -224,50 +186,46 @@ SAMRAIGhostDataAccumulator::SAMRAIGhostDataAccumulator(Pointer<BasePatchHierarch
                                   ghosts.data(),
                                   &d_vecs[ln]);
         IBTK_CHKERRQ(ierr);
-        ierr = VecSetOption(d_vecs[ln], VEC_IGNORE_NEGATIVE_INDICES, PETSC_TRUE);
-        IBTK_CHKERRQ(ierr);
 
-        // set up local indices
+        // Set up local indices and keep only the entries of each array that
+        // correspond to degrees of freedom.  Since the arrays contain ghost
+        // cells outside the physical domain, they always contain some entries
+        // that are masked out (i.e., set to -1).
         ISLocalToGlobalMapping mapping;
         ierr = VecGetLocalToGlobalMapping(d_vecs[ln], &mapping);
         IBTK_CHKERRQ(ierr);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            std::vector<ArrayData<NDIM, int>*> dofs_ptrs;
-            if (d_cc_data)
+            const std::vector<ArrayData<NDIM, int>*> global_dof_arrays =
+                get_arrays<int>(patch->getPatchData(d_global_dof_idx));
+            const std::vector<ArrayData<NDIM, int>*> local_dof_arrays =
+                get_arrays<int>(patch->getPatchData(d_local_dof_idx));
+            for (unsigned int k = 0; k < global_dof_arrays.size(); ++k)
             {
-                Pointer<CellData<NDIM, int> > global_dofs = patch->getPatchData(d_global_dof_idx);
-                Pointer<CellData<NDIM, int> > local_dofs = patch->getPatchData(d_local_dof_idx);
-                ArrayData<NDIM, int>& global_dof_data = global_dofs->getArrayData();
-                ArrayData<NDIM, int>& local_dof_data = local_dofs->getArrayData();
-                const auto size = local_dof_data.getBox().size() * local_dof_data.getDepth();
-                // since these arrays contain ghost cells outside the physical domain they will always contain -1s
+                ArrayData<NDIM, int>& global_dof_data = *global_dof_arrays[k];
+                ArrayData<NDIM, int>& local_dof_data = *local_dof_arrays[k];
+                const int size = local_dof_data.getBox().size() * local_dof_data.getDepth();
                 ierr = ISGlobalToLocalMappingApply(
                     mapping, IS_GTOLM_MASK, size, global_dof_data.getPointer(), nullptr, local_dof_data.getPointer());
                 IBTK_CHKERRQ(ierr);
-            }
-            else
-            {
-                Pointer<SideData<NDIM, int> > global_dofs = patch->getPatchData(d_global_dof_idx);
-                Pointer<SideData<NDIM, int> > local_dofs = patch->getPatchData(d_local_dof_idx);
-                // SideData stores multiple arrays (one for each dimension)
-                for (int d = 0; d < NDIM; ++d)
+
+                ArrayDOFMap dof_map;
+                dof_map.array_size = size;
+                const int* const local_dofs = local_dof_data.getPointer();
+                for (int n = 0; n < size; ++n)
                 {
-                    ArrayData<NDIM, int>& global_dof_data = global_dofs->getArrayData(d);
-                    ArrayData<NDIM, int>& local_dof_data = local_dofs->getArrayData(d);
-                    const auto size = local_dof_data.getBox().size() * local_dof_data.getDepth();
-                    // since these arrays contain ghost cells outside the physical domain they will always contain -1s
-                    ierr = ISGlobalToLocalMappingApply(mapping,
-                                                       IS_GTOLM_MASK,
-                                                       size,
-                                                       global_dof_data.getPointer(),
-                                                       nullptr,
-                                                       local_dof_data.getPointer());
-                    IBTK_CHKERRQ(ierr);
+                    if (local_dofs[n] < 0) continue;
+                    dof_map.data_offsets.push_back(n);
+                    dof_map.local_dofs.push_back(local_dofs[n]);
                 }
+                d_dof_maps[ln].push_back(std::move(dof_map));
             }
         }
+
+        // The numbering is not needed once the maps have been computed.
+        level->deallocatePatchData(d_global_dof_idx);
+        level->deallocatePatchData(d_local_dof_idx);
     } // loop over levels
 }
 
@@ -280,23 +238,44 @@ SAMRAIGhostDataAccumulator::accumulateGhostData(const int idx)
     TBOX_ASSERT(var == d_var);
 
     // the next part looks like PETScVecUtilities::copyToPatchLevelVec()
-    // except here we include the ghost box and use ADD_VALUES since we
-    // are accumulating.
+    // except here we include the ghost box and add values since we are
+    // accumulating.
 
-    // 1. Copy data to the Vec:
+    // 1. Add data to the local forms of the Vecs:
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        // VecSet doesn't modify ghost values - use the local form instead
         Vec local;
         int ierr = VecGhostGetLocalForm(d_vecs[ln], &local);
         IBTK_CHKERRQ(ierr);
         ierr = VecSet(local, 0.0);
         IBTK_CHKERRQ(ierr);
-        ierr = VecGhostRestoreLocalForm(d_vecs[ln], &local);
+        PetscScalar* local_values = nullptr;
+        ierr = VecGetArray(local, &local_values);
         IBTK_CHKERRQ(ierr);
 
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        add_or_get(level, d_gcw, d_cc_data, d_local_dof_idx, idx, d_vecs[ln], true);
+        unsigned int k = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            TBOX_ASSERT(d_gcw == patch->getPatchData(idx)->getGhostCellWidth());
+            for (ArrayData<NDIM, double>* values : get_arrays<double>(patch->getPatchData(idx)))
+            {
+                const ArrayDOFMap& dof_map = d_dof_maps[ln][k++];
+                TBOX_ASSERT(dof_map.array_size == values->getBox().size() * values->getDepth());
+                const double* const values_ptr = values->getPointer();
+                for (unsigned int n = 0; n < dof_map.local_dofs.size(); ++n)
+                {
+                    local_values[dof_map.local_dofs[n]] += values_ptr[dof_map.data_offsets[n]];
+                }
+            }
+        }
+        TBOX_ASSERT(k == d_dof_maps[ln].size());
+
+        ierr = VecRestoreArray(local, &local_values);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecGhostRestoreLocalForm(d_vecs[ln], &local);
+        IBTK_CHKERRQ(ierr);
     }
 
     // 2. Accumulate:
@@ -324,8 +303,33 @@ SAMRAIGhostDataAccumulator::accumulateGhostData(const int idx)
     // 3. copy back:
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
+        Vec local;
+        int ierr = VecGhostGetLocalForm(d_vecs[ln], &local);
+        IBTK_CHKERRQ(ierr);
+        const PetscScalar* local_values = nullptr;
+        ierr = VecGetArrayRead(local, &local_values);
+        IBTK_CHKERRQ(ierr);
+
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        add_or_get(level, d_gcw, d_cc_data, d_local_dof_idx, idx, d_vecs[ln], false);
+        unsigned int k = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            for (ArrayData<NDIM, double>* values : get_arrays<double>(patch->getPatchData(idx)))
+            {
+                const ArrayDOFMap& dof_map = d_dof_maps[ln][k++];
+                double* const values_ptr = values->getPointer();
+                for (unsigned int n = 0; n < dof_map.local_dofs.size(); ++n)
+                {
+                    values_ptr[dof_map.data_offsets[n]] = local_values[dof_map.local_dofs[n]];
+                }
+            }
+        }
+
+        ierr = VecRestoreArrayRead(local, &local_values);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecGhostRestoreLocalForm(d_vecs[ln], &local);
+        IBTK_CHKERRQ(ierr);
     }
 }
 
@@ -15,10 +15,14 @@
 
 #include "ibtk/CartSideDoubleRT0Refine.h"
 
+#include "ArrayData.h"
 #include "Box.h"
+#include "SideData.h"
+#include "SideGeometry.h"
 #include "SideVariable.h"
 #include "tbox/Pointer.h"
 
+#include <array>
 #include <string>
 
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -107,6 +111,111 @@ namespace
 {
 static const int REFINE_OP_PRIORITY = 0;
 static const int REFINE_OP_STENCIL_WIDTH = 1;
+
+// Strides of a data array defined on the indices of array_box, stored in
+// column-major (Fortran) order.
+inline std::array<int, NDIM>
+array_strides(const Box<NDIM>& array_box)
+{
+    std::array<int, NDIM> stride;
+    stride[0] = 1;
+    for (unsigned int d = 1; d < NDIM; ++d)
+    {
+        stride[d] = stride[d - 1] * array_box.numberCells(d - 1);
+    }
+    return stride;
+} // array_strides
+
+// Index of the coarse cell that contains fine cell i for a refinement ratio of
+// R.
+template <int R>
+inline int
+coarsen_index(const int i)
+{
+    return i < 0 ? (i + 1) / R - 1 : i / R;
+} // coarsen_index
+
+// Refine the axis component of side-centered data on the side indices of
+// fine_side_box via RT0 interpolation for a refinement ratio of R in each
+// direction.  This is the same interpolation that is used by
+// cart_side_rt0_refine2d/cart_side_rt0_refine3d, but since the refinement
+// ratio is known at compile time, the interpolation weights are tabulated and
+// the index arithmetic reduces to shifts.  Each fine pencil normal to the
+// first coordinate direction is interpolated from at most two coarse pencils
+// so that the innermost loop can be vectorized.
+template <int R>
+void
+rt0_refine(double* const u_f,
+           const Box<NDIM>& u_f_box,
+           const double* const u_c,
+           const Box<NDIM>& u_c_box,
+           const Box<NDIM>& fine_side_box,
+           const int axis)
+{
+    static_assert(R > 1, "the refinement ratio must be larger than one");
+    std::array<double, R> w1;
+    for (int r = 0; r < R; ++r) w1[r] = static_cast<double>(r) / static_cast<double>(R);
+
+    const std::array<int, NDIM> f_stride = array_strides(u_f_box);
+    const std::array<int, NDIM> c_stride = array_strides(u_c_box);
+    const int ilower0 = fine_side_box.lower(0);
+    const int n0 = fine_side_box.numberCells(0);
+#if (NDIM == 3)
+    for (int i2 = fine_side_box.lower(2); i2 <= fine_side_box.upper(2); ++i2)
+#endif
+    {
+        for (int i1 = fine_side_box.lower(1); i1 <= fine_side_box.upper(1); ++i1)
+        {
+            // Determine the coarse pencil (and the interpolation weight along
+            // the axis of the data, if the axis is not the first coordinate
+            // direction) associated with the fine pencil.
+            const int i_c1 = coarsen_index<R>(i1);
+            double w = 0.0;
+            if (axis == 1) w = w1[i1 - R * i_c1];
+#if (NDIM == 3)
+            const int i_c2 = coarsen_index<R>(i2);
+            if (axis == 2) w = w1[i2 - R * i_c2];
+#endif
+            double* const u_f_pencil = u_f + (ilower0 - u_f_box.lower(0)) + f_stride[1] * (i1 - u_f_box.lower(1))
+#if (NDIM == 3)
+                                       + f_stride[2] * (i2 - u_f_box.lower(2))
+#endif
+                ;
+            const double* const u_c_pencil = u_c - u_c_box.lower(0) + c_stride[1] * (i_c1 - u_c_box.lower(1))
+#if (NDIM == 3)
+                                             + c_stride[2] * (i_c2 - u_c_box.lower(2))
+#endif
+                ;
+            if (axis == 0)
+            {
+                for (int i0 = 0; i0 < n0; ++i0)
+                {
+                    const int i_c0 = coarsen_index<R>(ilower0 + i0);
+                    const int r = ilower0 + i0 - R * i_c0;
+                    u_f_pencil[i0] = r == 0 ? u_c_pencil[i_c0] :
+                                              (1.0 - w1[r]) * u_c_pencil[i_c0] + w1[r] * u_c_pencil[i_c0 + 1];
+                }
+            }
+            else if (w == 0.0)
+            {
+                for (int i0 = 0; i0 < n0; ++i0)
+                {
+                    u_f_pencil[i0] = u_c_pencil[coarsen_index<R>(ilower0 + i0)];
+                }
+            }
+            else
+            {
+                const double* const u_c_pencil_upper = u_c_pencil + c_stride[axis];
+                for (int i0 = 0; i0 < n0; ++i0)
+                {
+                    const int i_c0 = coarsen_index<R>(ilower0 + i0);
+                    u_f_pencil[i0] = (1.0 - w) * u_c_pencil[i_c0] + w * u_c_pencil_upper[i_c0];
+                }
+            }
+        }
+    }
+    return;
+} // rt0_refine
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -166,7 +275,38 @@ CartSideDoubleRT0Refine::refine(Patch<NDIM>& fine,
     TBOX_ASSERT(cdata_gcw == cdata->getGhostCellWidth().min());
 #endif
 
-    // Refine the data.
+    // Refine the data.  The specialized kernels are used for the commonly used
+    // isotropic refinement ratios.  Other ratios are treated by the general
+    // routine.
+    if (ratio == IntVector<NDIM>(2) || ratio == IntVector<NDIM>(4))
+    {
+        for (int depth = 0; depth < data_depth; ++depth)
+        {
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                const Box<NDIM> fine_side_box = SideGeometry<NDIM>::toSideBox(fine_box, axis);
+                if (ratio(0) == 2)
+                {
+                    rt0_refine<2>(fdata->getPointer(axis, depth),
+                                  fdata->getArrayData(axis).getBox(),
+                                  cdata->getPointer(axis, depth),
+                                  cdata->getArrayData(axis).getBox(),
+                                  fine_side_box,
+                                  axis);
+                }
+                else
+                {
+                    rt0_refine<4>(fdata->getPointer(axis, depth),
+                                  fdata->getArrayData(axis).getBox(),
+                                  cdata->getPointer(axis, depth),
+                                  cdata->getArrayData(axis).getBox(),
+                                  fine_side_box,
+                                  axis);
+                }
+            }
+        }
+        return;
+    }
     for (int depth = 0; depth < data_depth; ++depth)
     {
         CART_SIDE_RT0_REFINE_FC(
@@ -25,6 +25,8 @@
 #include "tbox/ConstPointer.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
 #include <map>
@@ -83,6 +85,8 @@ BGaussSeidelPreconditioner::setComponentPreconditioner(Pointer<LinearSolver> pre
     TBOX_ASSERT(preconditioner);
 #endif
     d_pc_map[component] = preconditioner;
+    d_pc_timer_map[component] = TimerManager::getManager()->getTimer(
+        "IBTK::BGaussSeidelPreconditioner::solveSystem()[component_" + std::to_string(component) + "]");
     return;
 } // setComponentPreconditioner
 
@@ -188,6 +192,12 @@ BGaussSeidelPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRA
     std::vector<Pointer<SAMRAIVectorReal<NDIM, double> > > f_comps = getComponentVectors(f);
 
     // Apply the component preconditioners.
+    //
+    // NOTE: Since the initial guess is zero, the components of the solution
+    // that have not yet been updated do not contribute to the right-hand side
+    // of the other components, and so we skip the corresponding off-diagonal
+    // operators during the first sweep.
+    std::vector<bool> x_comp_is_zero(ncomps, true);
     int count = 0;
     for (auto it = comps.begin(); it != comps.end(); ++it, ++count)
     {
@@ -201,7 +211,7 @@ BGaussSeidelPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRA
         f_comp->setToScalar(0.0);
         for (int c = 0; c < ncomps; ++c)
         {
-            if (c == comp) continue;
+            if (c == comp || x_comp_is_zero[c]) continue;
             d_linear_ops_map[comp][c]->applyAdd(*x_comps[c], *f_comp, *f_comp);
         }
         f_comp->subtract(b_comp, f_comp);
@@ -214,8 +224,11 @@ BGaussSeidelPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRA
         pc_comp->setRelativeTolerance(d_rel_residual_tol);
 
         // Apply the component preconditioner.
+        d_pc_timer_map[comp]->start();
         const bool ret_val_comp = pc_comp->solveSystem(*x_comp, *f_comp);
+        d_pc_timer_map[comp]->stop();
         ret_val = ret_val && ret_val_comp;
+        x_comp_is_zero[comp] = false;
     }
 
     // Free the copied right-hand-side vector data.
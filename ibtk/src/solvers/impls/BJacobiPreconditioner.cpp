@@ -24,6 +24,8 @@
 #include "SAMRAIVectorReal.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
 #include <map>
@@ -76,6 +78,8 @@ BJacobiPreconditioner::setComponentPreconditioner(Pointer<LinearSolver> precondi
     TBOX_ASSERT(preconditioner);
 #endif
     d_pc_map[component] = preconditioner;
+    d_pc_timer_map[component] = TimerManager::getManager()->getTimer(
+        "IBTK::BJacobiPreconditioner::solveSystem()[component_" + std::to_string(component) + "]");
     return;
 } // setComponentPreconditioner
 
@@ -127,7 +131,9 @@ BJacobiPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVect
         pc_comp->setRelativeTolerance(d_rel_residual_tol);
 
         // Apply the component preconditioner.
+        d_pc_timer_map[comp]->start();
         const bool ret_val_comp = pc_comp->solveSystem(x_comp, b_comp);
+        d_pc_timer_map[comp]->stop();
         ret_val = ret_val && ret_val_comp;
     }
 
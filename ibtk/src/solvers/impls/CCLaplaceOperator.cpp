@@ -18,9 +18,12 @@
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/ibtk_utilities.h"
 
+#include "CellData.h"
 #include "CellVariable.h"
 #include "MultiblockDataTranslator.h"
+#include "Patch.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "PoissonSpecifications.h"
 #include "SAMRAIVectorReal.h"
 #include "VariableFillPattern.h"
@@ -135,6 +138,57 @@ CCLaplaceOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDI
     }
     d_hier_bdry_fill->resetTransactionComponents(transaction_comps);
     d_hier_bdry_fill->setHomogeneousBc(d_homogeneous_bc);
+
+    // When possible, overlap the communication of ghost cell values with the
+    // computation of the action of the operator at cells that do not require
+    // ghost cell values.
+    const bool split_apply = d_overlap_ghost_cell_fill && d_hier_bdry_fill->supportsSplitFillData() &&
+                             d_poisson_spec.dIsConstant() &&
+                             (d_poisson_spec.cIsConstant() || d_poisson_spec.cIsZero());
+    if (split_apply)
+    {
+        const double alpha = d_poisson_spec.getDConstant();
+        const double beta = d_poisson_spec.cIsConstant() ? d_poisson_spec.getCConstant() : 0.0;
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_finest_ln);
+        d_hier_bdry_fill->beginFillData(d_solution_time);
+        for (int comp = 0; comp < d_ncomp; ++comp)
+        {
+            const int x_idx = x.getComponentDescriptorIndex(comp);
+            const int y_idx = y.getComponentDescriptorIndex(comp);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > x_data = patch->getPatchData(x_idx);
+                Pointer<CellData<NDIM, double> > y_data = patch->getPatchData(y_idx);
+                for (unsigned int l = 0; l < d_bc_coefs.size(); ++l)
+                {
+                    d_patch_math_ops.laplaceInterior(
+                        y_data, alpha, beta, x_data, 0.0, Pointer<CellData<NDIM, double> >(), patch, l, l);
+                }
+            }
+        }
+        d_hier_bdry_fill->endFillData(d_solution_time);
+        d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
+        for (int comp = 0; comp < d_ncomp; ++comp)
+        {
+            const int x_idx = x.getComponentDescriptorIndex(comp);
+            const int y_idx = y.getComponentDescriptorIndex(comp);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > x_data = patch->getPatchData(x_idx);
+                Pointer<CellData<NDIM, double> > y_data = patch->getPatchData(y_idx);
+                for (unsigned int l = 0; l < d_bc_coefs.size(); ++l)
+                {
+                    d_patch_math_ops.laplaceBoundary(
+                        y_data, alpha, beta, x_data, 0.0, Pointer<CellData<NDIM, double> >(), patch, l, l);
+                }
+            }
+        }
+        IBTK_TIMER_STOP(t_apply);
+        return;
+    }
+
     d_hier_bdry_fill->fillData(d_solution_time);
     d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
 
@@ -228,6 +282,7 @@ CCLaplaceOperator::initializeOperatorState(const SAMRAIVectorReal<NDIM, double>&
 
     // Initialize the interpolation operators.
     d_hier_bdry_fill = new HierarchyGhostCellInterpolation();
+    d_hier_bdry_fill->setUsePersistentSchedules(d_overlap_ghost_cell_fill);
     d_hier_bdry_fill->initializeOperatorState(d_transaction_comps, d_hierarchy, d_coarsest_ln, d_finest_ln);
 
     // Indicate the operator is initialized.
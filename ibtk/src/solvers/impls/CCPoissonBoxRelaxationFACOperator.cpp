@@ -62,10 +62,15 @@
 #include "petscvec.h"
 #include <petsclog.h>
 
+IBTK_DISABLE_EXTRA_WARNINGS
+#include <Eigen/Dense>
+IBTK_ENABLE_EXTRA_WARNINGS
+
 #include <algorithm>
 #include <array>
 #include <cstring>
 #include <functional>
+#include <limits>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -215,6 +220,10 @@ CCPoissonBoxRelaxationFACOperator::CCPoissonBoxRelaxationFACOperator(const std::
         }
         if (input_db->keyExists("petsc_options_prefix"))
             d_petsc_options_prefix = input_db->getString("petsc_options_prefix");
+        if (input_db->keyExists("use_dense_patch_solver"))
+            d_use_dense_patch_solver = input_db->getBool("use_dense_patch_solver");
+        if (input_db->keyExists("dense_patch_solver_max_size"))
+            d_dense_patch_solver_max_size = input_db->getInteger("dense_patch_solver_max_size");
     }
 
     // Configure the coarse level solver.
@@ -357,11 +366,26 @@ CCPoissonBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>& e
             xeqScheduleGhostFillNoCoarse(error_idx, level_num);
         }
 
-        // Smooth the error on the patches.
-        int patch_counter = 0;
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        // Smooth the error on the patches.  When the patches are smoothed
+        // independently and all of them are solved directly, they are smoothed
+        // concurrently when IBTK is compiled with OpenMP.
+        const std::vector<DensePatchOperator>& dense_ops = d_dense_patch_ops[level_num];
+        const bool smooth_concurrently =
+            !update_local_data && std::all_of(dense_ops.begin(), dense_ops.end(), [](const DensePatchOperator& op) {
+                return op.num_cells > 0;
+            });
+        std::vector<Pointer<Patch<NDIM> > > local_patches;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            local_patches.push_back(level->getPatch(p()));
+        }
+        const int num_local_patches = static_cast<int>(local_patches.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (smooth_concurrently)
+#endif
+        for (int patch_counter = 0; patch_counter < num_local_patches; ++patch_counter)
+        {
+            const Pointer<Patch<NDIM> >& patch = local_patches[patch_counter];
             Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
             Pointer<CellData<NDIM, double> > residual_data = residual.getComponentPatchData(0, *patch);
 #if !defined(NDEBUG)
@@ -399,6 +423,16 @@ CCPoissonBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>& e
             residual_data->getArrayData().copy(
                 error_data->getArrayData(), d_patch_bc_box_overlap[level_num][patch_counter], IntVector<NDIM>(0));
 
+            // Solve the patch problems directly when the dense form of the
+            // patch operator is available.
+            const DensePatchOperator& dense_op = dense_ops[patch_counter];
+            if (dense_op.num_cells > 0)
+            {
+                applyDensePatchOperator(
+                    dense_op, &d_dense_patch_inv[level_num][dense_op.inv_offset], *error_data, *residual_data);
+                continue;
+            }
+
             for (int depth = 0; depth < error_data->getDepth(); ++depth)
             {
                 // Smooth the error on the patch using PETSc.  Here, we are
@@ -603,14 +637,17 @@ CCPoissonBoxRelaxationFACOperator::initializeOperatorStateSpecialized(const SAMR
     d_patch_vec_f.resize(d_finest_ln + 1);
     d_patch_mat.resize(d_finest_ln + 1);
     d_patch_ksp.resize(d_finest_ln + 1);
+    d_dense_patch_ops.resize(d_finest_ln + 1);
+    d_dense_patch_inv.resize(d_finest_ln + 1);
     for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         const int num_local_patches = level->getProcessorMapping().getLocalIndices().getSize();
-        d_patch_vec_e[ln].resize(num_local_patches);
-        d_patch_vec_f[ln].resize(num_local_patches);
-        d_patch_mat[ln].resize(num_local_patches);
-        d_patch_ksp[ln].resize(num_local_patches);
+        d_patch_vec_e[ln].resize(num_local_patches, nullptr);
+        d_patch_vec_f[ln].resize(num_local_patches, nullptr);
+        d_patch_mat[ln].resize(num_local_patches, nullptr);
+        d_patch_ksp[ln].resize(num_local_patches, nullptr);
+        d_dense_patch_ops[ln].resize(num_local_patches);
         int patch_counter = 0;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
         {
@@ -618,6 +655,19 @@ CCPoissonBoxRelaxationFACOperator::initializeOperatorStateSpecialized(const SAMR
             const Box<NDIM>& patch_box = patch->getBox();
             const Box<NDIM>& ghost_box = Box<NDIM>::grow(patch_box, d_gcw);
             const int size = ghost_box.size();
+            Mat& A = d_patch_mat[ln][patch_counter];
+            buildPatchLaplaceOperator(A, d_poisson_spec, patch, d_gcw);
+
+            // Small patch problems are solved directly, in which case the PETSc
+            // objects are not needed.
+            if (d_use_dense_patch_solver && patch_box.size() <= d_dense_patch_solver_max_size)
+            {
+                buildDensePatchOperator(d_dense_patch_ops[ln][patch_counter], d_dense_patch_inv[ln], A, patch, d_gcw);
+                ierr = MatDestroy(&A);
+                IBTK_CHKERRQ(ierr);
+                continue;
+            }
+
             Vec& e = d_patch_vec_e[ln][patch_counter];
             Vec& f = d_patch_vec_f[ln][patch_counter];
             const int bs = 1;
@@ -625,8 +675,6 @@ CCPoissonBoxRelaxationFACOperator::initializeOperatorStateSpecialized(const SAMR
             IBTK_CHKERRQ(ierr);
             ierr = VecCreateSeqWithArray(PETSC_COMM_SELF, bs, size, nullptr, &f);
             IBTK_CHKERRQ(ierr);
-            Mat& A = d_patch_mat[ln][patch_counter];
-            buildPatchLaplaceOperator(A, d_poisson_spec, patch, d_gcw);
             KSP& ksp = d_patch_ksp[ln][patch_counter];
             ierr = KSPCreate(PETSC_COMM_SELF, &ksp);
             IBTK_CHKERRQ(ierr);
@@ -731,6 +779,8 @@ CCPoissonBoxRelaxationFACOperator::deallocateOperatorStateSpecialized(const int
             IBTK_CHKERRQ(ierr);
         }
         d_patch_ksp[ln].clear();
+        d_dense_patch_ops[ln].clear();
+        d_dense_patch_inv[ln].clear();
     }
 
     if (!d_in_initialize_operator_state)
@@ -739,6 +789,8 @@ CCPoissonBoxRelaxationFACOperator::deallocateOperatorStateSpecialized(const int
         d_patch_vec_f.clear();
         d_patch_mat.clear();
         d_patch_ksp.clear();
+        d_dense_patch_ops.clear();
+        d_dense_patch_inv.clear();
         d_patch_bc_box_overlap.clear();
         d_patch_neighbor_overlap.clear();
         if (d_coarse_solver) d_coarse_solver->deallocateSolverState();
@@ -1161,6 +1213,112 @@ CCPoissonBoxRelaxationFACOperator::buildPatchLaplaceOperator_nonaligned(Mat& A,
     return;
 } // buildPatchLaplaceOperator_nonaligned
 
+void
+CCPoissonBoxRelaxationFACOperator::buildDensePatchOperator(DensePatchOperator& dense_op,
+                                                           std::vector<double>& level_inv,
+                                                           const Mat& A,
+                                                           const Pointer<Patch<NDIM> > patch,
+                                                           const IntVector<NDIM>& ghost_cell_width)
+{
+    int ierr;
+
+    // Number the patch cells.
+    const Box<NDIM>& patch_box = patch->getBox();
+    const Box<NDIM>& ghost_box = Box<NDIM>::grow(patch_box, ghost_cell_width);
+    const int n = patch_box.size();
+    std::vector<int> cell_idx(ghost_box.size(), -1);
+    dense_op.num_cells = n;
+    dense_op.cell_offsets.resize(n);
+    int k = 0;
+    for (Box<NDIM>::Iterator b(patch_box); b; b++, ++k)
+    {
+        dense_op.cell_offsets[k] = ghost_box.offset(b());
+        cell_idx[dense_op.cell_offsets[k]] = k;
+    }
+
+    // Extract the rows of the patch cells, separating the couplings among the
+    // patch cells from the couplings to the ghost cells.
+    Eigen::MatrixXd A_dense = Eigen::MatrixXd::Zero(n, n);
+    dense_op.bdry_rows.clear();
+    dense_op.bdry_cols.clear();
+    dense_op.bdry_vals.clear();
+    for (k = 0; k < n; ++k)
+    {
+        PetscInt ncols;
+        const PetscInt* cols;
+        const PetscScalar* vals;
+        ierr = MatGetRow(A, dense_op.cell_offsets[k], &ncols, &cols, &vals);
+        IBTK_CHKERRQ(ierr);
+        for (PetscInt j = 0; j < ncols; ++j)
+        {
+            if (vals[j] == 0.0) continue;
+            const int l = cell_idx[cols[j]];
+            if (l >= 0)
+            {
+                A_dense(k, l) = vals[j];
+            }
+            else
+            {
+                dense_op.bdry_rows.push_back(k);
+                dense_op.bdry_cols.push_back(cols[j]);
+                dense_op.bdry_vals.push_back(vals[j]);
+            }
+        }
+        ierr = MatRestoreRow(A, dense_op.cell_offsets[k], &ncols, &cols, &vals);
+        IBTK_CHKERRQ(ierr);
+    }
+
+    // Append the inverse of the patch operator to the inverses of the level.
+    const Eigen::PartialPivLU<Eigen::MatrixXd> lu(A_dense);
+    if (!(lu.rcond() > std::numeric_limits<double>::epsilon()))
+    {
+        TBOX_ERROR("CCPoissonBoxRelaxationFACOperator::buildDensePatchOperator():\n"
+                   << "  the patch operator is singular for the provided problem coefficients" << std::endl);
+    }
+    const Eigen::MatrixXd A_inv = lu.inverse();
+    dense_op.inv_offset = level_inv.size();
+    level_inv.insert(level_inv.end(), A_inv.data(), A_inv.data() + A_inv.size());
+    return;
+} // buildDensePatchOperator
+
+void
+CCPoissonBoxRelaxationFACOperator::applyDensePatchOperator(const DensePatchOperator& dense_op,
+                                                           const double* const inv,
+                                                           CellData<NDIM, double>& error_data,
+                                                           const CellData<NDIM, double>& residual_data)
+{
+    // Set up the right-hand sides of the patch problems for all data depths,
+    // moving the couplings to the ghost cell values to the right-hand side.
+    const int n = dense_op.num_cells;
+    const int depth = error_data.getDepth();
+    Eigen::MatrixXd rhs(n, depth);
+    for (int d = 0; d < depth; ++d)
+    {
+        const double* const e = error_data.getPointer(d);
+        const double* const f = residual_data.getPointer(d);
+        for (int k = 0; k < n; ++k)
+        {
+            rhs(k, d) = f[dense_op.cell_offsets[k]];
+        }
+        for (std::size_t m = 0; m < dense_op.bdry_rows.size(); ++m)
+        {
+            rhs(dense_op.bdry_rows[m], d) -= dense_op.bdry_vals[m] * e[dense_op.bdry_cols[m]];
+        }
+    }
+
+    // Solve the patch problems and update the error.
+    const Eigen::MatrixXd sol = Eigen::Map<const Eigen::MatrixXd>(inv, n, n) * rhs;
+    for (int d = 0; d < depth; ++d)
+    {
+        double* const e = error_data.getPointer(d);
+        for (int k = 0; k < n; ++k)
+        {
+            e[dense_op.cell_offsets[k]] = sol(k, d);
+        }
+    }
+    return;
+} // applyDensePatchOperator
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -0,0 +1,249 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/CCPoissonFFTLevelSolver.h"
+#include "ibtk/FFTUtilities.h"
+#include "ibtk/GeneralSolver.h"
+#include "ibtk/ibtk_utilities.h"
+
+#include "Box.h"
+#include "CartesianGridGeometry.h"
+#include "CellDataFactory.h"
+#include "Index.h"
+#include "IntVector.h"
+#include "PatchDescriptor.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "PoissonSpecifications.h"
+#include "SAMRAIVectorReal.h"
+#include "VariableDatabase.h"
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
+#include "tbox/Utilities.h"
+
+#include <cmath>
+#include <complex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Timers.
+static Timer* t_solve_system;
+static Timer* t_initialize_solver_state;
+static Timer* t_deallocate_solver_state;
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+CCPoissonFFTLevelSolver::CCPoissonFFTLevelSolver(const std::string& object_name,
+                                                 Pointer<Database> input_db,
+                                                 const std::string& /*default_options_prefix*/)
+{
+    // Setup default options.
+    GeneralSolver::init(object_name, /*homogeneous_bc*/ false);
+    d_initial_guess_nonzero = false;
+    d_max_iterations = 1;
+
+    // Get values from the input database.
+    if (input_db)
+    {
+        if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+    }
+
+    // Setup Timers.
+    IBTK_DO_ONCE(t_solve_system = TimerManager::getManager()->getTimer("IBTK::CCPoissonFFTLevelSolver::solveSystem()");
+                 t_initialize_solver_state =
+                     TimerManager::getManager()->getTimer("IBTK::CCPoissonFFTLevelSolver::initializeSolverState()");
+                 t_deallocate_solver_state =
+                     TimerManager::getManager()->getTimer("IBTK::CCPoissonFFTLevelSolver::deallocateSolverState()"););
+    return;
+} // CCPoissonFFTLevelSolver
+
+CCPoissonFFTLevelSolver::~CCPoissonFFTLevelSolver()
+{
+    if (d_is_initialized) deallocateSolverState();
+    return;
+} // ~CCPoissonFFTLevelSolver
+
+bool
+CCPoissonFFTLevelSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDIM, double>& b)
+{
+    IBTK_TIMER_START(t_solve_system);
+
+    // Initialize the solver, when necessary.
+    const bool deallocate_after_solve = !d_is_initialized;
+    if (deallocate_after_solve) initializeSolverState(x, b);
+
+    // Solve for each component by dividing the transformed right-hand side by
+    // the symbol of the operator.  Modes for which the symbol vanishes are in
+    // the nullspace of the operator and are set to zero.
+    const int x_idx = x.getComponentDescriptorIndex(0);
+    const int b_idx = b.getComponentDescriptorIndex(0);
+    const double C = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+    const double D = d_poisson_spec.getDConstant();
+    std::vector<double> values;
+    std::vector<std::complex<double> > values_hat;
+    for (unsigned int depth = 0; depth < d_depth; ++depth)
+    {
+        FFTUtilities::gatherCellData(values, b_idx, depth, d_level, d_domain_box);
+        values_hat.assign(values.begin(), values.end());
+        FFTUtilities::transform(values_hat, d_num_cells, /*inverse*/ false);
+        for (unsigned int k = 0; k < values_hat.size(); ++k)
+        {
+            const double symbol = C + D * d_laplace_symbol[k];
+            values_hat[k] = symbol == 0.0 ? 0.0 : values_hat[k] / symbol;
+        }
+        FFTUtilities::transform(values_hat, d_num_cells, /*inverse*/ true);
+        for (unsigned int k = 0; k < values.size(); ++k) values[k] = values_hat[k].real();
+        FFTUtilities::scatterCellData(x_idx, depth, d_level, d_domain_box, values);
+    }
+    d_current_iterations = 1;
+    d_current_residual_norm = 0.0;
+
+    // Log solver info.
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::solveSystem(): solved " << d_depth << " system(s) on a "
+             << d_domain_box.size() << " cell level\n";
+    }
+
+    // Deallocate the solver, when necessary.
+    if (deallocate_after_solve) deallocateSolverState();
+
+    IBTK_TIMER_STOP(t_solve_system);
+    return true;
+} // solveSystem
+
+void
+CCPoissonFFTLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
+                                               const SAMRAIVectorReal<NDIM, double>& b)
+{
+    IBTK_TIMER_START(t_initialize_solver_state);
+
+#if !defined(NDEBUG)
+    // Rudimentary error checking.
+    if (x.getNumberOfComponents() != b.getNumberOfComponents())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same number of components" << std::endl);
+    }
+    if (x.getPatchHierarchy() != b.getPatchHierarchy())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same hierarchy" << std::endl);
+    }
+    if (x.getCoarsestLevelNumber() != b.getCoarsestLevelNumber() ||
+        x.getFinestLevelNumber() != b.getFinestLevelNumber())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same range of levels" << std::endl);
+    }
+#else
+    NULL_USE(b);
+#endif
+    const int level_num = x.getCoarsestLevelNumber();
+    if (level_num != x.getFinestLevelNumber())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  coarsest_ln != finest_ln in CCPoissonFFTLevelSolver" << std::endl);
+    }
+    if (!(d_poisson_spec.cIsZero() || d_poisson_spec.cIsConstant()) || !d_poisson_spec.dIsConstant())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  CCPoissonFFTLevelSolver requires constant problem coefficients" << std::endl);
+    }
+
+    // Deallocate the solver state if the solver is already initialized.
+    if (d_is_initialized) deallocateSolverState();
+
+    // Get the level and check that it uniformly covers a periodic domain.
+    d_level = x.getPatchHierarchy()->getPatchLevel(level_num);
+    d_domain_box = FFTUtilities::getPeriodicDomainBox(d_level);
+    if (d_domain_box.empty())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  level " << level_num
+                                 << " must uniformly cover a domain that is periodic in every direction" << std::endl);
+    }
+    d_num_cells = d_domain_box.numberCells();
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<CellDataFactory<NDIM, double> > x_fac =
+        var_db->getPatchDescriptor()->getPatchDataFactory(x.getComponentDescriptorIndex(0));
+    d_depth = x_fac->getDefaultDepth();
+
+    // Compute the eigenvalues of the discrete Laplacian.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_level->getGridGeometry();
+    const double* const dx_coarsest = grid_geom->getDx();
+    const IntVector<NDIM>& ratio = d_level->getRatio();
+    d_laplace_symbol.resize(d_domain_box.size());
+    for (Box<NDIM>::Iterator it(d_domain_box); it; it++)
+    {
+        const hier::Index<NDIM>& i = it();
+        double symbol = 0.0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const double dx = dx_coarsest[d] / static_cast<double>(ratio(d));
+            const double theta = 2.0 * M_PI * static_cast<double>(i(d) - d_domain_box.lower(d)) / d_num_cells(d);
+            symbol += (2.0 * std::cos(theta) - 2.0) / (dx * dx);
+        }
+        d_laplace_symbol[d_domain_box.offset(i)] = symbol;
+    }
+
+    // Indicate that the solver is initialized.
+    d_is_initialized = true;
+
+    IBTK_TIMER_STOP(t_initialize_solver_state);
+    return;
+} // initializeSolverState
+
+void
+CCPoissonFFTLevelSolver::deallocateSolverState()
+{
+    if (!d_is_initialized) return;
+
+    IBTK_TIMER_START(t_deallocate_solver_state);
+
+    d_level.setNull();
+    d_laplace_symbol.clear();
+
+    // Indicate that the solver is NOT initialized.
+    d_is_initialized = false;
+
+    IBTK_TIMER_STOP(t_deallocate_solver_state);
+    return;
+} // deallocateSolverState
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
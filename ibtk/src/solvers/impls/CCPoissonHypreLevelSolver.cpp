@@ -55,6 +55,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <mpi.h>
 
 #include <algorithm>
+#include <cmath>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -139,6 +140,8 @@ CCPoissonHypreLevelSolver::CCPoissonHypreLevelSolver(const std::string& object_n
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
         if (input_db->keyExists("rel_change")) d_rel_change = input_db->getInteger("rel_change");
+        if (input_db->keyExists("reuse_solver_setup"))
+            d_reuse_solver_setup = input_db->getBool("reuse_solver_setup");
 
         if (d_solver_type == "SMG" || d_precond_type == "SMG" || d_solver_type == "PFMG" || d_precond_type == "PFMG")
         {
@@ -181,6 +184,7 @@ CCPoissonHypreLevelSolver::CCPoissonHypreLevelSolver(const std::string& object_n
 CCPoissonHypreLevelSolver::~CCPoissonHypreLevelSolver()
 {
     if (d_is_initialized) deallocateSolverState();
+    releaseHypreData();
     return;
 } // ~CCPoissonHypreLevelSolver
 
@@ -283,45 +287,87 @@ CCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
     // Deallocate the solver state if the solver is already initialized.
     if (d_is_initialized) deallocateSolverState();
 
-    // Get the hierarchy information.
-    d_hierarchy = x.getPatchHierarchy();
-    d_level_num = x.getCoarsestLevelNumber();
-    TBOX_ASSERT(d_level_num == x.getFinestLevelNumber());
-    d_level = d_hierarchy->getPatchLevel(d_level_num);
-    if (d_level_num > 0)
-    {
-        d_cf_boundary = new CoarseFineBoundary<NDIM>(*d_hierarchy, d_level_num, IntVector<NDIM>(1));
-    }
-
-    // Allocate and initialize the hypre data structures.
+    // Determine the structure of the linear system.
+    Pointer<PatchHierarchy<NDIM> > hierarchy = x.getPatchHierarchy();
+    const int level_num = x.getCoarsestLevelNumber();
+    TBOX_ASSERT(level_num == x.getFinestLevelNumber());
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_num);
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     const int x_idx = x.getComponentDescriptorIndex(0);
     Pointer<CellDataFactory<NDIM, double> > x_fac = var_db->getPatchDescriptor()->getPatchDataFactory(x_idx);
-    d_depth = x_fac->getDefaultDepth();
-    if (d_poisson_spec.dIsConstant())
-    {
-        d_grid_aligned_anisotropy = true;
-    }
-    else
+    const unsigned int depth = x_fac->getDefaultDepth();
+    bool grid_aligned_anisotropy = true;
+    if (!d_poisson_spec.dIsConstant())
     {
-        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
         Pointer<SideDataFactory<NDIM, double> > pdat_factory =
             var_db->getPatchDescriptor()->getPatchDataFactory(d_poisson_spec.getDPatchDataId());
 #if !defined(NDEBUG)
         TBOX_ASSERT(pdat_factory);
 #endif
-        d_grid_aligned_anisotropy = pdat_factory->getDefaultDepth() == 1;
+        grid_aligned_anisotropy = pdat_factory->getDefaultDepth() == 1;
     }
-    allocateHypreData();
+
+    // The hypre data structures that were retained from the previous
+    // initialization can only be reused if the structure of the linear system
+    // is unchanged.
+    const bool reuse_hypre_data = d_hypre_data_allocated && d_hierarchy == hierarchy && d_level_num == level_num &&
+                                  PoissonUtilities::levelLayoutMatches(d_level_boxes, d_level_mapping, *level) &&
+                                  d_depth == depth && d_grid_aligned_anisotropy == grid_aligned_anisotropy;
+    if (!reuse_hypre_data) releaseHypreData();
+
+    // Get the hierarchy information.
+    d_hierarchy = hierarchy;
+    d_level_num = level_num;
+    d_level = level;
+    d_level_boxes = level->getBoxes();
+    d_level_mapping = level->getProcessorMapping().getProcessorMapping();
+    if (d_level_num > 0)
+    {
+        d_cf_boundary = new CoarseFineBoundary<NDIM>(*d_hierarchy, d_level_num, IntVector<NDIM>(1));
+    }
+    d_depth = depth;
+    d_grid_aligned_anisotropy = grid_aligned_anisotropy;
+
+    // Allocate the hypre data structures, when necessary, and compute the
+    // matrix coefficients.
+    if (!reuse_hypre_data)
+    {
+        allocateHypreData();
+        d_hypre_data_allocated = true;
+    }
+    std::vector<std::vector<double> > matrix_values;
     if (d_grid_aligned_anisotropy)
     {
-        setMatrixCoefficients_aligned();
+        computeMatrixCoefficients_aligned(matrix_values);
+    }
+    else
+    {
+        computeMatrixCoefficients_nonaligned(matrix_values);
+    }
+
+    // Initialize the hypre data structures.  If the new matrix is a scalar
+    // multiple of the retained matrix, the existing solver setup is kept and
+    // the right-hand side is rescaled in solveSystem().  Otherwise, the
+    // retained grid, stencil, matrices, and vectors are updated in place and
+    // only the hypre solver is set up again.
+    double matrix_scale = 1.0;
+    if (reuse_hypre_data && PoissonUtilities::getMatrixScaleFactor(d_matrix_values, matrix_values, matrix_scale))
+    {
+        d_matrix_scale = matrix_scale;
+        if (d_enable_logging)
+        {
+            plog << d_object_name << "::initializeSolverState(): reusing hypre solver setup with matrix scale factor "
+                 << d_matrix_scale << "\n";
+        }
     }
     else
     {
-        setMatrixCoefficients_nonaligned();
+        if (reuse_hypre_data) destroyHypreSolver();
+        d_matrix_values.swap(matrix_values);
+        d_matrix_scale = 1.0;
+        setMatrixCoefficients();
+        setupHypreSolver();
     }
-    setupHypreSolver();
 
     // Indicate that the solver is initialized.
     d_is_initialized = true;
@@ -337,9 +383,15 @@ CCPoissonHypreLevelSolver::deallocateSolverState()
 
     IBTK_TIMER_START(t_deallocate_solver_state);
 
-    // Deallocate the hypre data structures.
-    destroyHypreSolver();
-    deallocateHypreData();
+    // Deallocate the hypre data structures.  When solver setup reuse is
+    // enabled, the hypre data structures are retained so that they may be
+    // reused by the next call to initializeSolverState().
+    if (!d_reuse_solver_setup) releaseHypreData();
+
+    // Do not keep the patch level alive, e.g., after it has been replaced by
+    // regridding.
+    d_level.setNull();
+    d_cf_boundary.setNull();
 
     // Indicate that the solver is NOT initialized.
     d_is_initialized = false;
@@ -476,16 +528,11 @@ CCPoissonHypreLevelSolver::allocateHypreData()
 } // allocateHypreData
 
 void
-CCPoissonHypreLevelSolver::setMatrixCoefficients_aligned()
+CCPoissonHypreLevelSolver::computeMatrixCoefficients_aligned(std::vector<std::vector<double> >& matrix_values)
 {
-    // Set matrix entries and copy them to the hypre matrix structures.
+    // Compute the matrix entries for the grid-aligned stencil.
     const int stencil_sz = static_cast<int>(d_stencil_offsets.size());
-    std::vector<int> stencil_indices(stencil_sz);
-    for (int i = 0; i < stencil_sz; ++i)
-    {
-        stencil_indices[i] = i;
-    }
-    std::vector<double> mat_vals(stencil_sz, 0.0);
+    matrix_values.assign(d_depth, std::vector<double>());
     for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
@@ -497,28 +544,22 @@ CCPoissonHypreLevelSolver::setMatrixCoefficients_aligned()
                 matrix_coefs, patch, d_stencil_offsets, d_poisson_spec, d_bc_coefs[k], d_solution_time);
             for (Box<NDIM>::Iterator b(patch_box); b; b++)
             {
-                hier::Index<NDIM> i = b();
+                const hier::Index<NDIM>& i = b();
                 for (int j = 0; j < stencil_sz; ++j)
                 {
-                    mat_vals[j] = matrix_coefs(i, j);
+                    matrix_values[k].push_back(matrix_coefs(i, j));
                 }
-                HYPRE_StructMatrixSetValues(d_matrices[k], i, stencil_sz, &stencil_indices[0], &mat_vals[0]);
             }
         }
     }
-
-    // Assemble the hypre matrices.
-    for (unsigned int k = 0; k < d_depth; ++k)
-    {
-        HYPRE_StructMatrixAssemble(d_matrices[k]);
-    }
     return;
-} // setMatrixCoefficients_aligned
+} // computeMatrixCoefficients_aligned
 
 void
-CCPoissonHypreLevelSolver::setMatrixCoefficients_nonaligned()
+CCPoissonHypreLevelSolver::computeMatrixCoefficients_nonaligned(std::vector<std::vector<double> >& matrix_values)
 {
     static const IntVector<NDIM> no_ghosts = 0;
+    matrix_values.assign(d_depth, std::vector<double>());
     for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
@@ -536,7 +577,7 @@ CCPoissonHypreLevelSolver::setMatrixCoefficients_nonaligned()
             C_data = patch->getPatchData(d_poisson_spec.getCPatchDataId());
             if (!C_data)
             {
-                TBOX_ERROR(d_object_name << "::setMatrixCoefficients_nonaligned()\n"
+                TBOX_ERROR(d_object_name << "::computeMatrixCoefficients_nonaligned()\n"
                                          << "  to solve (C u + div D grad u) = f with non-constant C,\n"
                                          << "  C must be cell-centered double precision data" << std::endl);
             }
@@ -558,18 +599,13 @@ CCPoissonHypreLevelSolver::setMatrixCoefficients_nonaligned()
 
         if (!D_data)
         {
-            TBOX_ERROR(d_object_name << "::setMatrixCoefficients_nonaligned()\n"
+            TBOX_ERROR(d_object_name << "::computeMatrixCoefficients_nonaligned()\n"
                                      << "  to solve C u + div D grad u = f with non-constant D,\n"
                                      << "  D must be side-centered double precision data" << std::endl);
         }
 
         // Setup the finite difference stencil.
         static const int stencil_sz = (NDIM == 2 ? 9 : 19);
-        int stencil_indices[stencil_sz];
-        for (int i = 0; i < stencil_sz; ++i)
-        {
-            stencil_indices[i] = i;
-        }
 
         std::map<hier::Index<NDIM>, int, IndexComp> stencil_index_map;
         int stencil_index = 0;
@@ -708,18 +744,44 @@ CCPoissonHypreLevelSolver::setMatrixCoefficients_nonaligned()
 
             for (unsigned int k = 0; k < d_depth; ++k)
             {
-                HYPRE_StructMatrixSetValues(d_matrices[k], i, stencil_sz, stencil_indices, &mat_vals[0]);
+                matrix_values[k].insert(matrix_values[k].end(), mat_vals.begin(), mat_vals.end());
             }
         }
     }
+    return;
+} // computeMatrixCoefficients_nonaligned
 
-    // Assemble the hypre matrices.
+void
+CCPoissonHypreLevelSolver::setMatrixCoefficients()
+{
+    // Copy the matrix entries to the hypre matrix structures.  The entries for
+    // each patch are stored with the stencil index varying fastest, followed by
+    // the cell index in the patch box, which is the ordering expected by hypre.
+    const int stencil_sz = static_cast<int>(d_stencil_offsets.size());
+    std::vector<int> stencil_indices(stencil_sz);
+    for (int i = 0; i < stencil_sz; ++i)
+    {
+        stencil_indices[i] = i;
+    }
     for (unsigned int k = 0; k < d_depth; ++k)
     {
+        std::size_t offset = 0;
+        for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+        {
+            const Box<NDIM>& patch_box = d_level->getPatch(p())->getBox();
+            hier::Index<NDIM> lower = patch_box.lower();
+            hier::Index<NDIM> upper = patch_box.upper();
+            HYPRE_StructMatrixSetBoxValues(
+                d_matrices[k], lower, upper, stencil_sz, &stencil_indices[0], &d_matrix_values[k][offset]);
+            offset += static_cast<std::size_t>(patch_box.size()) * stencil_sz;
+        }
+        TBOX_ASSERT(offset == d_matrix_values[k].size());
+
+        // Assemble the hypre matrix.
         HYPRE_StructMatrixAssemble(d_matrices[k]);
     }
     return;
-} // setMatrixCoefficients_nonaligned
+} // setMatrixCoefficients
 
 void
 CCPoissonHypreLevelSolver::setupHypreSolver()
@@ -1055,9 +1117,13 @@ CCPoissonHypreLevelSolver::solveSystem(const int x_idx, const int b_idx)
 
     for (unsigned int k = 0; k < d_depth; ++k)
     {
-        // Assemble the hypre vectors.
+        // Assemble the hypre vectors.  The hypre matrix may be a scaled version
+        // of the current operator, in which case the right-hand side is scaled
+        // accordingly.
         HYPRE_StructVectorAssemble(d_sol_vecs[k]);
         HYPRE_StructVectorAssemble(d_rhs_vecs[k]);
+        if (d_matrix_scale != 1.0) HYPRE_StructVectorScaleValues(d_rhs_vecs[k], 1.0 / d_matrix_scale);
+        const double abs_residual_tol = d_abs_residual_tol / std::abs(d_matrix_scale);
 
         // Solve the system.
         IBTK_TIMER_START(t_solve_system_hypre);
@@ -1101,7 +1167,7 @@ CCPoissonHypreLevelSolver::solveSystem(const int x_idx, const int b_idx)
         {
             HYPRE_StructPCGSetMaxIter(d_solvers[k], d_max_iterations);
             HYPRE_StructPCGSetTol(d_solvers[k], d_rel_residual_tol);
-            HYPRE_StructPCGSetAbsoluteTol(d_solvers[k], d_abs_residual_tol);
+            HYPRE_StructPCGSetAbsoluteTol(d_solvers[k], abs_residual_tol);
             HYPRE_StructPCGSolve(d_solvers[k], d_matrices[k], d_rhs_vecs[k], d_sol_vecs[k]);
             HYPRE_StructPCGGetNumIterations(d_solvers[k], &d_current_iterations);
             HYPRE_StructPCGGetFinalRelativeResidualNorm(d_solvers[k], &d_current_residual_norm);
@@ -1110,7 +1176,7 @@ CCPoissonHypreLevelSolver::solveSystem(const int x_idx, const int b_idx)
         {
             HYPRE_StructGMRESSetMaxIter(d_solvers[k], d_max_iterations);
             HYPRE_StructGMRESSetTol(d_solvers[k], d_rel_residual_tol);
-            HYPRE_StructGMRESSetAbsoluteTol(d_solvers[k], d_abs_residual_tol);
+            HYPRE_StructGMRESSetAbsoluteTol(d_solvers[k], abs_residual_tol);
             HYPRE_StructGMRESSolve(d_solvers[k], d_matrices[k], d_rhs_vecs[k], d_sol_vecs[k]);
             HYPRE_StructGMRESGetNumIterations(d_solvers[k], &d_current_iterations);
             HYPRE_StructGMRESGetFinalRelativeResidualNorm(d_solvers[k], &d_current_residual_norm);
@@ -1119,7 +1185,7 @@ CCPoissonHypreLevelSolver::solveSystem(const int x_idx, const int b_idx)
         {
             HYPRE_StructFlexGMRESSetMaxIter(d_solvers[k], d_max_iterations);
             HYPRE_StructFlexGMRESSetTol(d_solvers[k], d_rel_residual_tol);
-            HYPRE_StructFlexGMRESSetAbsoluteTol(d_solvers[k], d_abs_residual_tol);
+            HYPRE_StructFlexGMRESSetAbsoluteTol(d_solvers[k], abs_residual_tol);
             HYPRE_StructFlexGMRESSolve(d_solvers[k], d_matrices[k], d_rhs_vecs[k], d_sol_vecs[k]);
             HYPRE_StructFlexGMRESGetNumIterations(d_solvers[k], &d_current_iterations);
             HYPRE_StructFlexGMRESGetFinalRelativeResidualNorm(d_solvers[k], &d_current_residual_norm);
@@ -1128,7 +1194,7 @@ CCPoissonHypreLevelSolver::solveSystem(const int x_idx, const int b_idx)
         {
             HYPRE_StructLGMRESSetMaxIter(d_solvers[k], d_max_iterations);
             HYPRE_StructLGMRESSetTol(d_solvers[k], d_rel_residual_tol);
-            HYPRE_StructLGMRESSetAbsoluteTol(d_solvers[k], d_abs_residual_tol);
+            HYPRE_StructLGMRESSetAbsoluteTol(d_solvers[k], abs_residual_tol);
             HYPRE_StructLGMRESSolve(d_solvers[k], d_matrices[k], d_rhs_vecs[k], d_sol_vecs[k]);
             HYPRE_StructLGMRESGetNumIterations(d_solvers[k], &d_current_iterations);
             HYPRE_StructLGMRESGetFinalRelativeResidualNorm(d_solvers[k], &d_current_residual_norm);
@@ -1137,7 +1203,7 @@ CCPoissonHypreLevelSolver::solveSystem(const int x_idx, const int b_idx)
         {
             HYPRE_StructBiCGSTABSetMaxIter(d_solvers[k], d_max_iterations);
             HYPRE_StructBiCGSTABSetTol(d_solvers[k], d_rel_residual_tol);
-            HYPRE_StructBiCGSTABSetAbsoluteTol(d_solvers[k], d_abs_residual_tol);
+            HYPRE_StructBiCGSTABSetAbsoluteTol(d_solvers[k], abs_residual_tol);
             HYPRE_StructBiCGSTABSolve(d_solvers[k], d_matrices[k], d_rhs_vecs[k], d_sol_vecs[k]);
             HYPRE_StructBiCGSTABGetNumIterations(d_solvers[k], &d_current_iterations);
             HYPRE_StructBiCGSTABGetFinalRelativeResidualNorm(d_solvers[k], &d_current_residual_norm);
@@ -1263,6 +1329,18 @@ CCPoissonHypreLevelSolver::destroyHypreSolver()
     return;
 } // destroyHypreSolver
 
+void
+CCPoissonHypreLevelSolver::releaseHypreData()
+{
+    if (!d_hypre_data_allocated) return;
+    destroyHypreSolver();
+    deallocateHypreData();
+    d_matrix_values.clear();
+    d_matrix_scale = 1.0;
+    d_hypre_data_allocated = false;
+    return;
+} // releaseHypreData
+
 void
 CCPoissonHypreLevelSolver::deallocateHypreData()
 {
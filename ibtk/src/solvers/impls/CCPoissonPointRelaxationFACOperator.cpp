@@ -22,6 +22,7 @@
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/IBTK_MPI.h"
 #include "ibtk/LinearSolver.h"
 #include "ibtk/PoissonFACPreconditionerStrategy.h"
 #include "ibtk/PoissonSolver.h"
@@ -33,6 +34,10 @@
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
+#include "CellDataFactory.h"
+#include "CellIndex.h"
+#include "CellIterator.h"
+#include "CellVariable.h"
 #include "CoarsenOperator.h"
 #include "HierarchyCellDataOpsReal.h"
 #include "MultiblockDataTranslator.h"
@@ -43,6 +48,7 @@
 #include "PoissonSpecifications.h"
 #include "ProcessorMapping.h"
 #include "SideData.h"
+#include "SideIndex.h"
 #include "Variable.h"
 #include "VariableDatabase.h"
 #include "VariableFillPattern.h"
@@ -55,6 +61,8 @@
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
+#include <cmath>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -284,6 +292,7 @@ enum SmootherType
     PATCH_GAUSS_SEIDEL,
     PROCESSOR_GAUSS_SEIDEL,
     RED_BLACK_GAUSS_SEIDEL,
+    CHEBYSHEV,
     UNKNOWN = -1
 };
 
@@ -292,8 +301,9 @@ get_smoother_type(const std::string& smoother_type_string)
 {
     if (smoother_type_string == "PATCH_GAUSS_SEIDEL") return PATCH_GAUSS_SEIDEL;
     if (smoother_type_string == "PROCESSOR_GAUSS_SEIDEL") return PROCESSOR_GAUSS_SEIDEL;
-    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL")
-        return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL") return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "CHEBYSHEV")
+        return CHEBYSHEV;
     else
         return UNKNOWN;
 } // get_smoother_type
@@ -323,6 +333,129 @@ do_local_data_update(SmootherType smoother_type)
         return false;
     }
 } // do_local_data_update
+
+// Returns true if the patch smoothers for all local patches of a level may be
+// applied at once (and, when OpenMP is enabled, concurrently). This is the case
+// when either no values are exchanged between local patches during a sweep, or
+// when the exchanged values are only used to update cells of the other color.
+inline bool
+smooth_patches_independently(SmootherType smoother_type)
+{
+    return smoother_type == PATCH_GAUSS_SEIDEL || smoother_type == RED_BLACK_GAUSS_SEIDEL ||
+           smoother_type == CHEBYSHEV;
+} // smooth_patches_independently
+
+// Returns the Gershgorin bound on the largest eigenvalue of the Jacobi-scaled
+// operator diag(L)^{-1} L on the patch.
+double
+compute_jacobi_eigenvalue_bound(const Patch<NDIM>& patch, const PoissonSpecifications& poisson_spec)
+{
+    const Box<NDIM>& patch_box = patch.getBox();
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+
+    const bool D_is_constant = poisson_spec.dIsConstant();
+    const double D = D_is_constant ? poisson_spec.getDConstant() : 0.0;
+    Pointer<SideData<NDIM, double> > D_data;
+    if (!D_is_constant) D_data = patch.getPatchData(poisson_spec.getDPatchDataId());
+    const bool C_is_var = poisson_spec.cIsVariable();
+    const double C = (C_is_var || poisson_spec.cIsZero()) ? 0.0 : poisson_spec.getCConstant();
+    Pointer<CellData<NDIM, double> > C_data;
+    if (C_is_var) C_data = patch.getPatchData(poisson_spec.getCPatchDataId());
+#if !defined(NDEBUG)
+    TBOX_ASSERT(D_is_constant || D_data);
+    TBOX_ASSERT(!C_is_var || C_data);
+#endif
+
+    const int D_depth = D_data ? D_data->getDepth() : 1;
+    double bound = 0.0;
+    for (int depth = 0; depth < D_depth; ++depth)
+    {
+        for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+        {
+            const CellIndex<NDIM>& i = ic();
+            double diag = C_data ? (*C_data)(i) : C;
+            double off_diag = 0.0;
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                const double D_lower = D_data ? (*D_data)(SideIndex<NDIM>(i, axis, SideIndex<NDIM>::Lower), depth) : D;
+                const double D_upper = D_data ? (*D_data)(SideIndex<NDIM>(i, axis, SideIndex<NDIM>::Upper), depth) : D;
+                const double dx2 = dx[axis] * dx[axis];
+                diag -= (D_lower + D_upper) / dx2;
+                off_diag += (std::abs(D_lower) + std::abs(D_upper)) / dx2;
+            }
+            bound = std::max(bound, 1.0 + off_diag / std::abs(diag));
+        }
+    }
+    return bound;
+} // compute_jacobi_eigenvalue_bound
+
+// Performs one step of the Chebyshev iteration for the Jacobi-scaled operator
+// on the patch:
+//
+//    dU := alpha dU + beta diag(L)^{-1} (F - L U)
+//    U  := U + dU
+//
+// The ghost cell values of U must have been filled before calling this
+// function. Only the interior values of dU are used. dU may be stored in single
+// precision; the update itself is always computed in double precision.
+template <typename T>
+void
+chebyshev_patch_update(CellData<NDIM, double>& U_data,
+                       const CellData<NDIM, double>& F_data,
+                       CellData<NDIM, T>& dU_data,
+                       const Patch<NDIM>& patch,
+                       const PoissonSpecifications& poisson_spec,
+                       const double alpha,
+                       const double beta)
+{
+    const Box<NDIM>& patch_box = patch.getBox();
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch.getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+
+    const bool D_is_constant = poisson_spec.dIsConstant();
+    const double D = D_is_constant ? poisson_spec.getDConstant() : 0.0;
+    Pointer<SideData<NDIM, double> > D_data;
+    if (!D_is_constant) D_data = patch.getPatchData(poisson_spec.getDPatchDataId());
+    const bool C_is_var = poisson_spec.cIsVariable();
+    const double C = (C_is_var || poisson_spec.cIsZero()) ? 0.0 : poisson_spec.getCConstant();
+    Pointer<CellData<NDIM, double> > C_data;
+    if (C_is_var) C_data = patch.getPatchData(poisson_spec.getCPatchDataId());
+#if !defined(NDEBUG)
+    TBOX_ASSERT(D_is_constant || D_data);
+    TBOX_ASSERT(!C_is_var || C_data);
+#endif
+
+    for (int depth = 0; depth < U_data.getDepth(); ++depth)
+    {
+        for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+        {
+            const CellIndex<NDIM>& i = ic();
+            const double U = U_data(i, depth);
+            double diag = C_data ? (*C_data)(i) : C;
+            double L_U = diag * U;
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                IntVector<NDIM> shift(0);
+                shift(axis) = 1;
+                const double D_lower = D_data ? (*D_data)(SideIndex<NDIM>(i, axis, SideIndex<NDIM>::Lower), depth) : D;
+                const double D_upper = D_data ? (*D_data)(SideIndex<NDIM>(i, axis, SideIndex<NDIM>::Upper), depth) : D;
+                const double dx2 = dx[axis] * dx[axis];
+                L_U += (D_upper * (U_data(i + shift, depth) - U) - D_lower * (U - U_data(i - shift, depth))) / dx2;
+                diag -= (D_lower + D_upper) / dx2;
+            }
+            const double r = (F_data(i, depth) - L_U) / diag;
+            dU_data(i, depth) =
+                static_cast<T>((alpha == 0.0 ? 0.0 : alpha * static_cast<double>(dU_data(i, depth))) + beta * r);
+        }
+        for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+        {
+            const CellIndex<NDIM>& i = ic();
+            U_data(i, depth) += static_cast<double>(dU_data(i, depth));
+        }
+    }
+    return;
+} // chebyshev_patch_update
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -352,6 +485,10 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
     if (input_db)
     {
         if (input_db->keyExists("smoother_type")) d_smoother_type = input_db->getString("smoother_type");
+        if (input_db->keyExists("chebyshev_eigenvalue_ratio"))
+            d_chebyshev_eigenvalue_ratio = input_db->getDouble("chebyshev_eigenvalue_ratio");
+        if (input_db->keyExists("use_single_precision_smoother_data"))
+            d_use_single_precision_smoother_data = input_db->getBool("use_single_precision_smoother_data");
         if (input_db->keyExists("prolongation_method"))
             d_prolongation_method = input_db->getString("prolongation_method");
         if (input_db->keyExists("restriction_method")) d_restriction_method = input_db->getString("restriction_method");
@@ -388,6 +525,30 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
         }
     }
 
+    if (d_chebyshev_eigenvalue_ratio <= 1.0)
+    {
+        TBOX_ERROR(d_object_name << "::CCPoissonPointRelaxationFACOperator():\n"
+                                 << "  chebyshev_eigenvalue_ratio must be greater than one" << std::endl);
+    }
+
+    // Setup the single-precision variable used by the Chebyshev smoother.
+    if (d_use_single_precision_smoother_data)
+    {
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        const std::string var_name = d_object_name + "::cell_direction_float";
+        Pointer<Variable<NDIM> > var;
+        if (var_db->checkVariableExists(var_name))
+        {
+            var = var_db->getVariable(var_name);
+            var_db->removePatchDataIndex(var_db->mapVariableAndContextToIndex(var, d_context));
+        }
+        else
+        {
+            var = new CellVariable<NDIM, float>(var_name, DEFAULT_DATA_DEPTH);
+        }
+        d_float_direction_idx = var_db->registerVariableAndContext(var, d_context, IntVector<NDIM>(0));
+    }
+
     // Configure the coarse level solver.
     setCoarseSolverType(d_coarse_solver_type);
 
@@ -461,6 +622,30 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
 #endif
     const bool red_black_ordering = use_red_black_ordering(smoother_type);
     const bool update_local_data = do_local_data_update(smoother_type);
+    const bool smooth_level_at_once = smooth_patches_independently(smoother_type);
+    const bool use_float_data = smoother_type == CHEBYSHEV && d_use_single_precision_smoother_data;
+
+    // Collect the local patches so that they can be smoothed concurrently.
+    std::vector<Pointer<Patch<NDIM> > > local_patches;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        local_patches.push_back(level->getPatch(p()));
+    }
+    const int num_local_patches = static_cast<int>(local_patches.size());
+
+    // Determine the interval of the spectrum of the Jacobi-scaled operator that
+    // is targeted by the Chebyshev smoother.
+    double chebyshev_theta = 0.0, chebyshev_delta = 0.0, chebyshev_rho = 0.0;
+    if (smoother_type == CHEBYSHEV)
+    {
+#if !defined(NDEBUG)
+        TBOX_ASSERT(level_num < static_cast<int>(d_chebyshev_max_eigenvalue.size()));
+#endif
+        const double lambda_max = d_chebyshev_max_eigenvalue[level_num];
+        const double lambda_min = lambda_max / d_chebyshev_eigenvalue_ratio;
+        chebyshev_theta = 0.5 * (lambda_max + lambda_min);
+        chebyshev_delta = 0.5 * (lambda_max - lambda_min);
+    }
 
     // Cache coarse-fine interface ghost cell values in the "scratch" data.
     if (level_num > d_coarsest_ln && num_sweeps > 1)
@@ -530,11 +715,48 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
             xeqScheduleGhostFillNoCoarse(error_idx, level_num);
         }
 
+        // Compute the coefficients of the current Chebyshev step.
+        double chebyshev_alpha = 0.0, chebyshev_beta = 0.0;
+        if (smoother_type == CHEBYSHEV)
+        {
+            if (isweep == 0)
+            {
+                chebyshev_rho = chebyshev_delta / chebyshev_theta;
+                chebyshev_beta = 1.0 / chebyshev_theta;
+            }
+            else
+            {
+                const double rho_new = 1.0 / (2.0 * chebyshev_theta / chebyshev_delta - chebyshev_rho);
+                chebyshev_alpha = rho_new * chebyshev_rho;
+                chebyshev_beta = 2.0 * rho_new / chebyshev_delta;
+                chebyshev_rho = rho_new;
+            }
+        }
+
+        // Copy updated values from neighboring local patches before smoothing
+        // the level when the patches can be smoothed independently.
+        if (update_local_data && smooth_level_at_once)
+        {
+            for (int patch_counter = 0; patch_counter < num_local_patches; ++patch_counter)
+            {
+                Pointer<CellData<NDIM, double> > error_data =
+                    error.getComponentPatchData(0, *local_patches[patch_counter]);
+                for (const auto& pair : d_patch_neighbor_overlap[level_num][patch_counter])
+                {
+                    Pointer<Patch<NDIM> > src_patch = level->getPatch(pair.first);
+                    Pointer<CellData<NDIM, double> > src_error_data = error.getComponentPatchData(0, *src_patch);
+                    error_data->getArrayData().copy(src_error_data->getArrayData(), pair.second, IntVector<NDIM>(0));
+                }
+            }
+        }
+
         // Smooth the error on the patches.
-        int patch_counter = 0;
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (smooth_level_at_once)
+#endif
+        for (int patch_counter = 0; patch_counter < num_local_patches; ++patch_counter)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<Patch<NDIM> >& patch = local_patches[patch_counter];
             Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
             Pointer<CellData<NDIM, double> > residual_data = residual.getComponentPatchData(0, *patch);
 #if !defined(NDEBUG)
@@ -544,12 +766,42 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
             TBOX_ASSERT(residual_data->getGhostCellWidth() == d_gcw);
             TBOX_ASSERT(error_data->getDepth() == residual_data->getDepth());
 #endif
+
+            // The Chebyshev smoother stores its search direction in the
+            // interior of the scratch data, which otherwise only caches the
+            // coarse-fine interface ghost cell values during smoothing, or in
+            // separate single-precision data.
+            if (use_float_data)
+            {
+                Pointer<CellData<NDIM, float> > float_direction_data = patch->getPatchData(d_float_direction_idx);
+                chebyshev_patch_update(*error_data,
+                                       *residual_data,
+                                       *float_direction_data,
+                                       *patch,
+                                       d_poisson_spec,
+                                       chebyshev_alpha,
+                                       chebyshev_beta);
+                continue;
+            }
+            if (smoother_type == CHEBYSHEV)
+            {
+                Pointer<CellData<NDIM, double> > scratch_data = patch->getPatchData(scratch_idx);
+                chebyshev_patch_update(*error_data,
+                                       *residual_data,
+                                       *scratch_data,
+                                       *patch,
+                                       d_poisson_spec,
+                                       chebyshev_alpha,
+                                       chebyshev_beta);
+                continue;
+            }
+
             const Box<NDIM>& patch_box = patch->getBox();
             const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
             const double* const dx = pgeom->getDx();
 
             // Copy updated values from neighboring local patches.
-            if (update_local_data)
+            if (update_local_data && !smooth_level_at_once)
             {
                 const std::map<int, Box<NDIM> > neighbor_overlap = d_patch_neighbor_overlap[level_num][patch_counter];
                 for (const auto& pair : neighbor_overlap)
@@ -941,6 +1193,12 @@ CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
     Pointer<CellDataFactory<NDIM, double> > scratch_pdat_fac =
         var_db->getPatchDescriptor()->getPatchDataFactory(d_scratch_idx);
     scratch_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
+    if (d_use_single_precision_smoother_data)
+    {
+        Pointer<CellDataFactory<NDIM, float> > float_pdat_fac =
+            var_db->getPatchDescriptor()->getPatchDataFactory(d_float_direction_idx);
+        float_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
+    }
 
     // Initialize the coarse level solvers when needed.
     if (coarsest_reset_ln == d_coarsest_ln && d_coarse_solver)
@@ -970,6 +1228,34 @@ CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
     // Setup fill pattern spec objects.
     d_op_stencil_fill_pattern = new CellNoCornersFillPattern(CELLG, true, false, false);
 
+    // Estimate the largest eigenvalue of the Jacobi-scaled operator on each
+    // level for the Chebyshev smoother.
+    if (get_smoother_type(d_smoother_type) == CHEBYSHEV || get_smoother_type(d_coarse_solver_type) == CHEBYSHEV)
+    {
+        d_chebyshev_max_eigenvalue.resize(d_finest_ln + 1);
+        for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            double lambda_max = 0.0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                lambda_max = std::max(lambda_max, compute_jacobi_eigenvalue_bound(*patch, d_poisson_spec));
+            }
+            d_chebyshev_max_eigenvalue[ln] = IBTK_MPI::maxReduction(lambda_max);
+        }
+
+        // Allocate the single-precision smoother data.
+        if (d_use_single_precision_smoother_data)
+        {
+            for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+                if (!level->checkAllocated(d_float_direction_idx)) level->allocatePatchData(d_float_direction_idx);
+            }
+        }
+    }
+
     // Get overlap information for setting patch boundary conditions.
     d_patch_bc_box_overlap.resize(d_finest_ln + 1);
     for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
@@ -1020,15 +1306,26 @@ CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
 } // initializeOperatorStateSpecialized
 
 void
-CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const int /*coarsest_reset_ln*/,
-                                                                        const int /*finest_reset_ln*/)
+CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const int coarsest_reset_ln,
+                                                                        const int finest_reset_ln)
 {
     if (!d_is_initialized) return;
 
+    // Deallocate the single-precision smoother data.
+    if (d_use_single_precision_smoother_data)
+    {
+        for (int ln = coarsest_reset_ln; ln <= std::min(d_finest_ln, finest_reset_ln); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            if (level->checkAllocated(d_float_direction_idx)) level->deallocatePatchData(d_float_direction_idx);
+        }
+    }
+
     if (!d_in_initialize_operator_state)
     {
         d_patch_bc_box_overlap.clear();
         d_patch_neighbor_overlap.clear();
+        d_chebyshev_max_eigenvalue.clear();
         if (d_coarse_solver) d_coarse_solver->deallocateSolverState();
     }
     return;
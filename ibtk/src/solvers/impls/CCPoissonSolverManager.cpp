@@ -15,6 +15,7 @@
 
 #include "ibtk/CCLaplaceOperator.h"
 #include "ibtk/CCPoissonBoxRelaxationFACOperator.h"
+#include "ibtk/CCPoissonFFTLevelSolver.h"
 #include "ibtk/CCPoissonHypreLevelSolver.h"
 #include "ibtk/CCPoissonLevelRelaxationFACOperator.h"
 #include "ibtk/CCPoissonPETScLevelSolver.h"
@@ -55,6 +56,7 @@ const std::string CCPoissonSolverManager::POINT_RELAXATION_FAC_PRECONDITIONER =
 const std::string CCPoissonSolverManager::DEFAULT_LEVEL_SOLVER = "DEFAULT_LEVEL_SOLVER";
 const std::string CCPoissonSolverManager::HYPRE_LEVEL_SOLVER = "HYPRE_LEVEL_SOLVER";
 const std::string CCPoissonSolverManager::PETSC_LEVEL_SOLVER = "PETSC_LEVEL_SOLVER";
+const std::string CCPoissonSolverManager::FFT_LEVEL_SOLVER = "FFT_LEVEL_SOLVER";
 
 CCPoissonSolverManager* CCPoissonSolverManager::s_solver_manager_instance = nullptr;
 bool CCPoissonSolverManager::s_registered_callback = false;
@@ -174,6 +176,7 @@ CCPoissonSolverManager::CCPoissonSolverManager() : d_solver_maker_map()
     registerSolverFactoryFunction(DEFAULT_LEVEL_SOLVER, CCPoissonHypreLevelSolver::allocate_solver);
     registerSolverFactoryFunction(HYPRE_LEVEL_SOLVER, CCPoissonHypreLevelSolver::allocate_solver);
     registerSolverFactoryFunction(PETSC_LEVEL_SOLVER, CCPoissonPETScLevelSolver::allocate_solver);
+    registerSolverFactoryFunction(FFT_LEVEL_SOLVER, CCPoissonFFTLevelSolver::allocate_solver);
     return;
 } // CCPoissonSolverManager
 
@@ -17,6 +17,7 @@
 #include "ibtk/FACPreconditionerStrategy.h"
 #include "ibtk/LinearSolver.h"
 #include "ibtk/ibtk_enums.h"
+#include "ibtk/profiling_annotations.h"
 
 #include "MultiblockDataTranslator.h"
 #include "PatchHierarchy.h"
@@ -96,6 +97,7 @@ FACPreconditioner::setTimeInterval(const double current_time, const double new_t
 bool
 FACPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorReal<NDIM, double>& f)
 {
+    IBTK_PROFILING_REGION("FACPreconditioner::solveSystem");
     // Initialize the solver, when necessary.
     const bool deallocate_after_solve = !d_is_initialized;
     if (deallocate_after_solve) initializeSolverState(u, f);
@@ -103,6 +103,13 @@ LaplaceOperator::getPhysicalBcCoefs() const
     return d_bc_coefs;
 } // getPhysicalBcCoefs
 
+void
+LaplaceOperator::setOverlapGhostCellFill(const bool overlap_ghost_cell_fill)
+{
+    d_overlap_ghost_cell_fill = overlap_ghost_cell_fill;
+    return;
+} // setOverlapGhostCellFill
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////////
@@ -93,6 +93,8 @@ PETScKrylovLinearSolver::PETScKrylovLinearSolver(std::string object_name,
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
         if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+        if (input_db->keyExists("num_fischer_vectors"))
+            setNumberOfFischerGuessVectors(input_db->getInteger("num_fischer_vectors"));
     }
 
     // Common constructor functionality.
@@ -202,10 +204,45 @@ PETScKrylovLinearSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVe
     d_A->setHomogeneousBc(d_homogeneous_bc);
     d_A->modifyRhsForBcs(*d_b);
     d_A->setHomogeneousBc(true);
+    if (d_fischer_guess && d_fischer_guess->getNumberOfStoredVectors() > 0)
+    {
+        // Compute the initial guess from the previous solutions. A nonzero
+        // initial guess is corrected using its residual. Otherwise, the KSP
+        // object is told to use the computed guess for this solve only;
+        // resetKSPOptions() restores the original setting for the next solve.
+        if (d_initial_guess_nonzero)
+        {
+            if (!d_fischer_r)
+            {
+                d_fischer_r = d_b->cloneVector("");
+                d_fischer_r->allocateVectorData();
+            }
+            d_A->apply(x, *d_fischer_r);
+            d_fischer_r->subtract(d_b, d_fischer_r);
+            d_fischer_guess->correct(x, *d_fischer_r);
+        }
+        else
+        {
+            d_fischer_guess->guess(x, *d_b);
+            ierr = KSPSetInitialGuessNonzero(d_petsc_ksp, PETSC_TRUE);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
     PETScSAMRAIVectorReal::replaceSAMRAIVector(d_petsc_x, Pointer<SAMRAIVectorReal<NDIM, double> >(&x, false));
     PETScSAMRAIVectorReal::replaceSAMRAIVector(d_petsc_b, d_b);
     ierr = KSPSolve(d_petsc_ksp, d_petsc_b, d_petsc_x);
     IBTK_CHKERRQ(ierr);
+
+    // Determine the convergence reason.
+    KSPConvergedReason reason;
+    ierr = KSPGetConvergedReason(d_petsc_ksp, &reason);
+    IBTK_CHKERRQ(ierr);
+    const bool converged = (static_cast<int>(reason) > 0);
+    if (d_enable_logging) reportKSPConvergedReason(reason, plog);
+
+    // Store the solution of the homogeneous problem for computing subsequent
+    // initial guesses.
+    if (d_fischer_guess && converged) d_fischer_guess->submit(x, *d_b);
     d_A->setHomogeneousBc(d_homogeneous_bc);
     d_A->imposeSolBcs(x);
 
@@ -216,13 +253,6 @@ PETScKrylovLinearSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVe
     IBTK_CHKERRQ(ierr);
     d_A->setHomogeneousBc(d_homogeneous_bc);
 
-    // Determine the convergence reason.
-    KSPConvergedReason reason;
-    ierr = KSPGetConvergedReason(d_petsc_ksp, &reason);
-    IBTK_CHKERRQ(ierr);
-    const bool converged = (static_cast<int>(reason) > 0);
-    if (d_enable_logging) reportKSPConvergedReason(reason, plog);
-
     // Deallocate the solver, when necessary.
     if (deallocate_after_solve) deallocateSolverState();
 
@@ -375,6 +405,16 @@ PETScKrylovLinearSolver::deallocateSolverState()
 
     // Dealocate scratch data.
     d_b->deallocateVectorData();
+    if (d_fischer_r)
+    {
+        d_fischer_r->deallocateVectorData();
+        d_fischer_r->freeVectorComponents();
+        d_fischer_r.setNull();
+    }
+
+    // Discard the previous solutions, which may not be compatible with the
+    // reinitialized solver.
+    if (d_fischer_guess) d_fischer_guess->clear();
 
     // Delete the solution and rhs vectors.
     PETScSAMRAIVectorReal::destroyPETScVector(d_petsc_x);
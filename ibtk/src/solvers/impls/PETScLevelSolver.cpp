@@ -15,6 +15,7 @@
 
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/IBTK_MPI.h"
+#include "ibtk/MemoryStatistics.h"
 #include "ibtk/PETScLevelSolver.h"
 #include "ibtk/SAMRAIDataCache.h"
 #include "ibtk/ibtk_utilities.h"
@@ -352,6 +353,37 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
         ierr = KSPSetOptionsPrefix(d_petsc_ksp, d_options_prefix.c_str());
         IBTK_CHKERRQ(ierr);
     }
+
+    // Agglomerate the preconditioner onto a subset of the processes when each
+    // process would otherwise own only a few degrees of freedom.
+    const int reduction_factor = getAgglomerationReductionFactor();
+    const bool use_agglomeration = reduction_factor > 1;
+    if (use_agglomeration)
+    {
+        ierr = PCSetType(ksp_pc, PCTELESCOPE);
+        IBTK_CHKERRQ(ierr);
+        ierr = PCTelescopeSetReductionFactor(ksp_pc, reduction_factor);
+        IBTK_CHKERRQ(ierr);
+
+        // The inner solver of PCTELESCOPE is only created when the
+        // preconditioner is set up, and it is configured from the options
+        // database using the prefix -<options_prefix>telescope_. Use the
+        // requested preconditioner on the reduced communicator unless a
+        // different one is given on the command line.
+        d_telescope_pc_type_option = "-" + d_options_prefix + "telescope_pc_type";
+        PetscBool has_telescope_pc_type = PETSC_FALSE;
+        ierr = PetscOptionsHasName(nullptr, nullptr, d_telescope_pc_type_option.c_str(), &has_telescope_pc_type);
+        IBTK_CHKERRQ(ierr);
+        if (has_telescope_pc_type)
+        {
+            d_telescope_pc_type_option.clear();
+        }
+        else
+        {
+            ierr = PetscOptionsSetValue(nullptr, d_telescope_pc_type_option.c_str(), d_pc_type.c_str());
+            IBTK_CHKERRQ(ierr);
+        }
+    }
     ierr = KSPSetFromOptions(d_petsc_ksp);
     IBTK_CHKERRQ(ierr);
 
@@ -360,7 +392,7 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
     IBTK_CHKERRQ(ierr);
     ierr = PCGetType(ksp_pc, &pc_type);
     IBTK_CHKERRQ(ierr);
-    d_pc_type = pc_type;
+    if (!use_agglomeration) d_pc_type = pc_type;
 
     // Set the nullspace.
     if (d_nullspace_contains_constant_vec || !d_nullspace_basis_vecs.empty()) setupNullspace();
@@ -639,6 +671,7 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
 
     // Indicate that the solver is initialized.
     d_is_initialized = true;
+    if (MemoryStatistics::enabled()) updateMemoryUsage();
 
     IBTK_TIMER_STOP(t_initialize_solver_state);
     return;
@@ -675,6 +708,15 @@ PETScLevelSolver::deallocateSolverState()
     ierr = VecDestroy(&d_petsc_b);
     IBTK_CHKERRQ(ierr);
 
+    // Remove the inner preconditioner type that was set for PCTELESCOPE so
+    // that it does not affect later solvers.
+    if (!d_telescope_pc_type_option.empty())
+    {
+        ierr = PetscOptionsClearValue(nullptr, d_telescope_pc_type_option.c_str());
+        IBTK_CHKERRQ(ierr);
+        d_telescope_pc_type_option.clear();
+    }
+
     // Deallocate PETSc objects for shell preconditioner.
     if (d_pc_type == "shell")
     {
@@ -727,6 +769,7 @@ PETScLevelSolver::deallocateSolverState()
 
     // Indicate that the solver is NOT initialized.
     d_is_initialized = false;
+    if (MemoryStatistics::enabled()) MemoryStatistics::getManager()->removeUsage("level_solver_matrices", this);
 
     IBTK_TIMER_STOP(t_deallocate_solver_state);
     return;
@@ -754,6 +797,8 @@ PETScLevelSolver::init(Pointer<Database> input_db, const std::string& default_op
             input_db->getIntegerArray("subdomain_box_size", d_box_size, NDIM);
         if (input_db->keyExists("subdomain_overlap_size"))
             input_db->getIntegerArray("subdomain_overlap_size", d_overlap_size, NDIM);
+        if (input_db->keyExists("min_dofs_per_process"))
+            d_min_dofs_per_process = input_db->getInteger("min_dofs_per_process");
     }
     return;
 } // init
@@ -812,6 +857,60 @@ PETScLevelSolver::setupNullspace()
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+int
+PETScLevelSolver::getAgglomerationReductionFactor() const
+{
+    // The subdomain-based preconditioners set up their subdomains on the
+    // processes that own the patch data and cannot be agglomerated.
+    if (d_min_dofs_per_process <= 0 || d_pc_type == "asm" || d_pc_type == "fieldsplit" || d_pc_type == "shell" ||
+        d_pc_type == PCTELESCOPE)
+    {
+        return 1;
+    }
+
+    int ierr;
+    PetscInt n_global_rows, n_global_cols;
+    ierr = MatGetSize(d_petsc_mat, &n_global_rows, &n_global_cols);
+    IBTK_CHKERRQ(ierr);
+    const int n_nodes = IBTK_MPI::getNodes();
+    const auto n_active_nodes = static_cast<int>(std::min<PetscInt>(
+        n_nodes, std::max<PetscInt>(1, (n_global_rows + d_min_dofs_per_process - 1) / d_min_dofs_per_process)));
+    return n_nodes / n_active_nodes;
+} // getAgglomerationReductionFactor
+
+void
+PETScLevelSolver::updateMemoryUsage()
+{
+    // The storage of each matrix is estimated from its number of allocated
+    // nonzeros, assuming a compressed row format.  Memory allocated later by
+    // PETSc (e.g., for factorizations done when the preconditioner is set up)
+    // is not included.
+    double num_bytes = 0.0;
+    const auto add_matrix_bytes = [&num_bytes](Mat mat) {
+        if (!mat) return;
+        MatInfo info;
+        int ierr = MatGetInfo(mat, MAT_LOCAL, &info);
+        IBTK_CHKERRQ(ierr);
+        num_bytes += info.nz_allocated * (sizeof(PetscScalar) + sizeof(PetscInt));
+    };
+    add_matrix_bytes(d_petsc_mat);
+    if (d_petsc_pc != d_petsc_mat) add_matrix_bytes(d_petsc_pc);
+    if (d_pc_type == "shell")
+    {
+        for (int i = 0; i < d_n_local_subdomains; ++i) add_matrix_bytes(d_sub_mat[i]);
+    }
+    for (Vec vec : { d_petsc_x, d_petsc_b })
+    {
+        if (!vec) continue;
+        PetscInt local_size;
+        int ierr = VecGetLocalSize(vec, &local_size);
+        IBTK_CHKERRQ(ierr);
+        num_bytes += local_size * sizeof(PetscScalar);
+    }
+    MemoryStatistics::getManager()->setUsage("level_solver_matrices", this, num_bytes);
+    return;
+} // updateMemoryUsage
+
 PetscErrorCode
 PETScLevelSolver::PCApply_Additive(PC pc, Vec x, Vec y)
 {
@@ -90,6 +90,26 @@ PETScNewtonKrylovSolver::PETScNewtonKrylovSolver(std::string object_name,
         if (input_db->keyExists("rel_residual_tol")) d_rel_residual_tol = input_db->getDouble("rel_residual_tol");
         if (input_db->keyExists("solution_tol")) d_solution_tol = input_db->getDouble("solution_tol");
         if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+        if (input_db->keyExists("snes_type")) d_snes_type = input_db->getString("snes_type");
+        if (input_db->keyExists("use_eisenstat_walker"))
+            d_use_eisenstat_walker = input_db->getBool("use_eisenstat_walker");
+        if (input_db->keyExists("eisenstat_walker_version"))
+            d_ew_version = input_db->getInteger("eisenstat_walker_version");
+        if (input_db->keyExists("eisenstat_walker_rtol_0"))
+            d_ew_rtol_0 = input_db->getDouble("eisenstat_walker_rtol_0");
+        if (input_db->keyExists("eisenstat_walker_rtol_max"))
+            d_ew_rtol_max = input_db->getDouble("eisenstat_walker_rtol_max");
+        if (input_db->keyExists("eisenstat_walker_gamma"))
+            d_ew_gamma = input_db->getDouble("eisenstat_walker_gamma");
+        if (input_db->keyExists("eisenstat_walker_alpha"))
+            d_ew_alpha = input_db->getDouble("eisenstat_walker_alpha");
+        if (input_db->keyExists("eisenstat_walker_alpha2"))
+            d_ew_alpha2 = input_db->getDouble("eisenstat_walker_alpha2");
+        if (input_db->keyExists("eisenstat_walker_threshold"))
+            d_ew_threshold = input_db->getDouble("eisenstat_walker_threshold");
+        if (input_db->keyExists("mffd_type")) d_mffd_type = input_db->getString("mffd_type");
+        if (input_db->keyExists("mffd_recompute_period"))
+            d_mffd_recompute_period = input_db->getInteger("mffd_recompute_period");
     }
 
     // Common constructor functionality.
@@ -301,6 +321,25 @@ PETScNewtonKrylovSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, doub
         ierr = SNESCreate(d_petsc_comm, &d_petsc_snes);
         IBTK_CHKERRQ(ierr);
         resetSNESOptions();
+        if (!d_snes_type.empty())
+        {
+            ierr = SNESSetType(d_petsc_snes, d_snes_type.c_str());
+            IBTK_CHKERRQ(ierr);
+        }
+        if (d_use_eisenstat_walker)
+        {
+            ierr = SNESKSPSetUseEW(d_petsc_snes, PETSC_TRUE);
+            IBTK_CHKERRQ(ierr);
+            ierr = SNESKSPSetParametersEW(d_petsc_snes,
+                                          d_ew_version,
+                                          d_ew_rtol_0,
+                                          d_ew_rtol_max,
+                                          d_ew_gamma,
+                                          d_ew_alpha,
+                                          d_ew_alpha2,
+                                          d_ew_threshold);
+            IBTK_CHKERRQ(ierr);
+        }
     }
     else if (!d_petsc_snes)
     {
@@ -613,6 +652,16 @@ PETScNewtonKrylovSolver::resetSNESJacobian()
         ierr = MatMFFDSetFunction(
             d_petsc_jac, reinterpret_cast<PetscErrorCode (*)(void*, Vec, Vec)>(SNESComputeFunction), d_petsc_snes);
         IBTK_CHKERRQ(ierr);
+        if (!d_mffd_type.empty())
+        {
+            ierr = MatMFFDSetType(d_petsc_jac, d_mffd_type.c_str());
+            IBTK_CHKERRQ(ierr);
+        }
+        if (d_mffd_recompute_period > 1)
+        {
+            ierr = MatMFFDSetPeriod(d_petsc_jac, d_mffd_recompute_period);
+            IBTK_CHKERRQ(ierr);
+        }
         if (!d_options_prefix.empty())
         {
             ierr = MatSetOptionsPrefix(d_petsc_jac, d_options_prefix.c_str());
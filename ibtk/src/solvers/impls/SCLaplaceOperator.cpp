@@ -22,9 +22,12 @@
 #include "ibtk/ibtk_utilities.h"
 
 #include "Box.h"
+#include "Patch.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "PoissonSpecifications.h"
 #include "SAMRAIVectorReal.h"
+#include "SideData.h"
 #include "SideVariable.h"
 #include "VariableFillPattern.h"
 #include "tbox/Timer.h"
@@ -148,6 +151,53 @@ SCLaplaceOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDI
     }
     d_hier_bdry_fill->resetTransactionComponents(transaction_comps);
     d_hier_bdry_fill->setHomogeneousBc(d_homogeneous_bc);
+
+    // When possible, overlap the communication of ghost cell values with the
+    // computation of the action of the operator at sides that do not require
+    // ghost cell values.
+    const bool split_apply = d_overlap_ghost_cell_fill && d_hier_bdry_fill->supportsSplitFillData() &&
+                             d_poisson_spec.dIsConstant() &&
+                             (d_poisson_spec.cIsConstant() || d_poisson_spec.cIsZero());
+    if (split_apply)
+    {
+        const double alpha = d_poisson_spec.getDConstant();
+        const double beta = d_poisson_spec.cIsConstant() ? d_poisson_spec.getCConstant() : 0.0;
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(d_finest_ln);
+        d_hier_bdry_fill->beginFillData(d_solution_time);
+        for (int comp = 0; comp < d_ncomp; ++comp)
+        {
+            const int x_scratch_idx = d_x->getComponentDescriptorIndex(comp);
+            const int y_idx = y.getComponentDescriptorIndex(comp);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<SideData<NDIM, double> > x_data = patch->getPatchData(x_scratch_idx);
+                Pointer<SideData<NDIM, double> > y_data = patch->getPatchData(y_idx);
+                d_patch_math_ops.laplaceInterior(
+                    y_data, alpha, beta, x_data, 0.0, Pointer<SideData<NDIM, double> >(), patch);
+            }
+        }
+        d_hier_bdry_fill->endFillData(d_solution_time);
+        d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
+        for (int comp = 0; comp < d_ncomp; ++comp)
+        {
+            const int x_scratch_idx = d_x->getComponentDescriptorIndex(comp);
+            const int y_idx = y.getComponentDescriptorIndex(comp);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<SideData<NDIM, double> > x_data = patch->getPatchData(x_scratch_idx);
+                Pointer<SideData<NDIM, double> > y_data = patch->getPatchData(y_idx);
+                d_patch_math_ops.laplaceBoundary(
+                    y_data, alpha, beta, x_data, 0.0, Pointer<SideData<NDIM, double> >(), patch);
+            }
+            const int x_idx = x.getComponentDescriptorIndex(comp);
+            d_bc_helpers[comp]->copyDataAtDirichletBoundaries(y_idx, x_idx);
+        }
+        IBTK_TIMER_STOP(t_apply);
+        return;
+    }
+
     d_hier_bdry_fill->fillData(d_solution_time);
     d_hier_bdry_fill->resetTransactionComponents(d_transaction_comps);
 
@@ -241,6 +291,7 @@ SCLaplaceOperator::initializeOperatorState(const SAMRAIVectorReal<NDIM, double>&
 
     // Initialize the interpolation operators.
     d_hier_bdry_fill = new HierarchyGhostCellInterpolation();
+    d_hier_bdry_fill->setUsePersistentSchedules(d_overlap_ghost_cell_fill);
     d_hier_bdry_fill->initializeOperatorState(d_transaction_comps, d_hierarchy, d_coarsest_ln, d_finest_ln);
 
     // Indicate the operator is initialized.
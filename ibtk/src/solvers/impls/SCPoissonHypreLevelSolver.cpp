@@ -46,6 +46,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <mpi.h>
 
 #include <algorithm>
+#include <cmath>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -107,6 +108,8 @@ SCPoissonHypreLevelSolver::SCPoissonHypreLevelSolver(const std::string& object_n
         if (input_db->keyExists("initial_guess_nonzero"))
             d_initial_guess_nonzero = input_db->getBool("initial_guess_nonzero");
         if (input_db->keyExists("rel_change")) d_rel_change = input_db->getInteger("rel_change");
+        if (input_db->keyExists("reuse_solver_setup"))
+            d_reuse_solver_setup = input_db->getBool("reuse_solver_setup");
 
         if (d_solver_type == "SysPFMG" || d_precond_type == "SysPFMG")
         {
@@ -145,6 +148,7 @@ SCPoissonHypreLevelSolver::SCPoissonHypreLevelSolver(const std::string& object_n
 SCPoissonHypreLevelSolver::~SCPoissonHypreLevelSolver()
 {
     if (d_is_initialized) deallocateSolverState();
+    releaseHypreData();
     return;
 } // ~SCPoissonHypreLevelSolver
 
@@ -249,20 +253,58 @@ SCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
     // Deallocate the solver state if the solver is already initialized.
     if (d_is_initialized) deallocateSolverState();
 
+    // The hypre data structures that were retained from the previous
+    // initialization can only be reused on the same patch level.
+    Pointer<PatchHierarchy<NDIM> > hierarchy = x.getPatchHierarchy();
+    const int level_num = x.getCoarsestLevelNumber();
+    TBOX_ASSERT(level_num == x.getFinestLevelNumber());
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_num);
+    const bool reuse_hypre_data = d_hypre_data_allocated && d_hierarchy == hierarchy && d_level_num == level_num &&
+                                  PoissonUtilities::levelLayoutMatches(d_level_boxes, d_level_mapping, *level);
+    if (!reuse_hypre_data) releaseHypreData();
+
     // Get the hierarchy information.
-    d_hierarchy = x.getPatchHierarchy();
-    d_level_num = x.getCoarsestLevelNumber();
-    TBOX_ASSERT(d_level_num == x.getFinestLevelNumber());
-    d_level = d_hierarchy->getPatchLevel(d_level_num);
+    d_hierarchy = hierarchy;
+    d_level_num = level_num;
+    d_level = level;
+    d_level_boxes = level->getBoxes();
+    d_level_mapping = level->getProcessorMapping().getProcessorMapping();
     if (d_level_num > 0)
     {
         d_cf_boundary = new CoarseFineBoundary<NDIM>(*d_hierarchy, d_level_num, IntVector<NDIM>(1));
     }
 
-    // Allocate and initialize the hypre data structures.
-    allocateHypreData();
-    setMatrixCoefficients();
-    setupHypreSolver();
+    // Allocate the hypre data structures, when necessary, and compute the
+    // matrix coefficients.
+    if (!reuse_hypre_data)
+    {
+        allocateHypreData();
+        d_hypre_data_allocated = true;
+    }
+    std::vector<std::vector<double> > matrix_values;
+    computeMatrixCoefficients(matrix_values);
+
+    // Initialize the hypre data structures.  If the new matrix is a scalar
+    // multiple of the retained matrix, the existing solver setup is kept and
+    // the right-hand side is rescaled in solveSystem().
+    double matrix_scale = 1.0;
+    if (reuse_hypre_data && PoissonUtilities::getMatrixScaleFactor(d_matrix_values, matrix_values, matrix_scale))
+    {
+        d_matrix_scale = matrix_scale;
+        if (d_enable_logging)
+        {
+            plog << d_object_name << "::initializeSolverState(): reusing hypre solver setup with matrix scale factor "
+                 << d_matrix_scale << "\n";
+        }
+    }
+    else
+    {
+        if (reuse_hypre_data) destroyHypreSolver();
+        d_matrix_values.swap(matrix_values);
+        d_matrix_scale = 1.0;
+        setMatrixCoefficients();
+        setupHypreSolver();
+    }
 
     // Indicate that the solver is initialized.
     d_is_initialized = true;
@@ -278,9 +320,15 @@ SCPoissonHypreLevelSolver::deallocateSolverState()
 
     IBTK_TIMER_START(t_deallocate_solver_state);
 
-    // Deallocate the hypre data structures.
-    destroyHypreSolver();
-    deallocateHypreData();
+    // Deallocate the hypre data structures.  When solver setup reuse is
+    // enabled, the hypre data structures are retained so that they may be
+    // reused by the next call to initializeSolverState().
+    if (!d_reuse_solver_setup) releaseHypreData();
+
+    // Do not keep the patch level alive, e.g., after it has been replaced by
+    // regridding.
+    d_level.setNull();
+    d_cf_boundary.setNull();
 
     // Indicate that the solver is NOT initialized.
     d_is_initialized = false;
@@ -378,43 +426,66 @@ SCPoissonHypreLevelSolver::allocateHypreData()
 } // allocateHypreData
 
 void
-SCPoissonHypreLevelSolver::setMatrixCoefficients()
+SCPoissonHypreLevelSolver::computeMatrixCoefficients(std::vector<std::vector<double> >& matrix_values)
 {
+    const int stencil_sz = static_cast<int>(d_stencil_offsets.size());
+    matrix_values.assign(NDIM, std::vector<double>());
     for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
         const Box<NDIM>& patch_box = patch->getBox();
-        const int stencil_sz = static_cast<int>(d_stencil_offsets.size());
         SideData<NDIM, double> matrix_coefs(patch_box, stencil_sz, IntVector<NDIM>(0));
         PoissonUtilities::computeMatrixCoefficients(
             matrix_coefs, patch, d_stencil_offsets, d_poisson_spec, d_bc_coefs, d_solution_time);
-
-        // Copy matrix entries to the hypre matrix structure.
-        std::vector<int> stencil_indices(stencil_sz);
-        for (int i = 0; i < stencil_sz; ++i)
-        {
-            stencil_indices[i] = i;
-        }
-        std::vector<double> mat_vals(stencil_sz, 0.0);
         for (unsigned int axis = 0; axis < NDIM; ++axis)
         {
             Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
             for (Box<NDIM>::Iterator b(side_box); b; b++)
             {
-                SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
+                const SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
                 for (int k = 0; k < stencil_sz; ++k)
                 {
-                    mat_vals[k] = matrix_coefs(i, k);
+                    matrix_values[axis].push_back(matrix_coefs(i, k));
                 }
-                // NOTE: In SAMRAI, face-centered values are associated with the
-                // cell index located on the "upper" side of the face, but in
-                // hypre, face-centered values are associated with the cell
-                // index located on the "lower" side of the face.
-                i(axis) -= 1;
-                HYPRE_SStructMatrixSetValues(d_matrix, PART, i, axis, stencil_sz, &stencil_indices[0], &mat_vals[0]);
             }
         }
     }
+    return;
+} // computeMatrixCoefficients
+
+void
+SCPoissonHypreLevelSolver::setMatrixCoefficients()
+{
+    // Copy matrix entries to the hypre matrix structure.  The entries for each
+    // side box are stored with the stencil index varying fastest, which is the
+    // ordering expected by hypre.
+    const int stencil_sz = static_cast<int>(d_stencil_offsets.size());
+    std::vector<int> stencil_indices(stencil_sz);
+    for (int i = 0; i < stencil_sz; ++i)
+    {
+        stencil_indices[i] = i;
+    }
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        std::size_t offset = 0;
+        for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+        {
+            const Box<NDIM>& patch_box = d_level->getPatch(p())->getBox();
+            Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+            // NOTE: In SAMRAI, face-centered values are associated with the
+            // cell index located on the "upper" side of the face, but in hypre,
+            // face-centered values are associated with the cell index located
+            // on the "lower" side of the face.
+            hier::Index<NDIM> lower = side_box.lower();
+            hier::Index<NDIM> upper = side_box.upper();
+            lower(axis) -= 1;
+            upper(axis) -= 1;
+            HYPRE_SStructMatrixSetBoxValues(
+                d_matrix, PART, lower, upper, axis, stencil_sz, &stencil_indices[0], &d_matrix_values[axis][offset]);
+            offset += static_cast<std::size_t>(side_box.size()) * stencil_sz;
+        }
+        TBOX_ASSERT(offset == d_matrix_values[axis].size());
+    }
 
     // Assemble the hypre matrix.
     HYPRE_SStructMatrixAssemble(d_matrix);
@@ -696,9 +767,13 @@ SCPoissonHypreLevelSolver::solveSystem(const int x_idx, const int b_idx)
         }
     }
 
-    // Assemble the hypre vectors.
+    // Assemble the hypre vectors.  The hypre matrix may be a scaled version of
+    // the current operator, in which case the right-hand side is scaled
+    // accordingly.
     HYPRE_SStructVectorAssemble(d_sol_vec);
     HYPRE_SStructVectorAssemble(d_rhs_vec);
+    if (d_matrix_scale != 1.0) HYPRE_SStructVectorScale(1.0 / d_matrix_scale, d_rhs_vec);
+    const double abs_residual_tol = d_abs_residual_tol / std::abs(d_matrix_scale);
 
     // Solve the system.
     IBTK_TIMER_START(t_solve_system_hypre);
@@ -742,7 +817,7 @@ SCPoissonHypreLevelSolver::solveSystem(const int x_idx, const int b_idx)
     {
         HYPRE_SStructPCGSetMaxIter(d_solver, d_max_iterations);
         HYPRE_SStructPCGSetTol(d_solver, d_rel_residual_tol);
-        HYPRE_SStructPCGSetAbsoluteTol(d_solver, d_abs_residual_tol);
+        HYPRE_SStructPCGSetAbsoluteTol(d_solver, abs_residual_tol);
         HYPRE_SStructPCGSolve(d_solver, d_matrix, d_rhs_vec, d_sol_vec);
         HYPRE_SStructPCGGetNumIterations(d_solver, &d_current_iterations);
         HYPRE_SStructPCGGetFinalRelativeResidualNorm(d_solver, &d_current_residual_norm);
@@ -751,7 +826,7 @@ SCPoissonHypreLevelSolver::solveSystem(const int x_idx, const int b_idx)
     {
         HYPRE_SStructGMRESSetMaxIter(d_solver, d_max_iterations);
         HYPRE_SStructGMRESSetTol(d_solver, d_rel_residual_tol);
-        HYPRE_SStructGMRESSetAbsoluteTol(d_solver, d_abs_residual_tol);
+        HYPRE_SStructGMRESSetAbsoluteTol(d_solver, abs_residual_tol);
         HYPRE_SStructGMRESSolve(d_solver, d_matrix, d_rhs_vec, d_sol_vec);
         HYPRE_SStructGMRESGetNumIterations(d_solver, &d_current_iterations);
         HYPRE_SStructGMRESGetFinalRelativeResidualNorm(d_solver, &d_current_residual_norm);
@@ -760,7 +835,7 @@ SCPoissonHypreLevelSolver::solveSystem(const int x_idx, const int b_idx)
     {
         HYPRE_SStructFlexGMRESSetMaxIter(d_solver, d_max_iterations);
         HYPRE_SStructFlexGMRESSetTol(d_solver, d_rel_residual_tol);
-        HYPRE_SStructFlexGMRESSetAbsoluteTol(d_solver, d_abs_residual_tol);
+        HYPRE_SStructFlexGMRESSetAbsoluteTol(d_solver, abs_residual_tol);
         HYPRE_SStructFlexGMRESSolve(d_solver, d_matrix, d_rhs_vec, d_sol_vec);
         HYPRE_SStructFlexGMRESGetNumIterations(d_solver, &d_current_iterations);
         HYPRE_SStructFlexGMRESGetFinalRelativeResidualNorm(d_solver, &d_current_residual_norm);
@@ -769,7 +844,7 @@ SCPoissonHypreLevelSolver::solveSystem(const int x_idx, const int b_idx)
     {
         HYPRE_SStructLGMRESSetMaxIter(d_solver, d_max_iterations);
         HYPRE_SStructLGMRESSetTol(d_solver, d_rel_residual_tol);
-        HYPRE_SStructLGMRESSetAbsoluteTol(d_solver, d_abs_residual_tol);
+        HYPRE_SStructLGMRESSetAbsoluteTol(d_solver, abs_residual_tol);
         HYPRE_SStructLGMRESSolve(d_solver, d_matrix, d_rhs_vec, d_sol_vec);
         HYPRE_SStructLGMRESGetNumIterations(d_solver, &d_current_iterations);
         HYPRE_SStructLGMRESGetFinalRelativeResidualNorm(d_solver, &d_current_residual_norm);
@@ -778,7 +853,7 @@ SCPoissonHypreLevelSolver::solveSystem(const int x_idx, const int b_idx)
     {
         HYPRE_SStructBiCGSTABSetMaxIter(d_solver, d_max_iterations);
         HYPRE_SStructBiCGSTABSetTol(d_solver, d_rel_residual_tol);
-        HYPRE_SStructBiCGSTABSetAbsoluteTol(d_solver, d_abs_residual_tol);
+        HYPRE_SStructBiCGSTABSetAbsoluteTol(d_solver, abs_residual_tol);
         HYPRE_SStructBiCGSTABSolve(d_solver, d_matrix, d_rhs_vec, d_sol_vec);
         HYPRE_SStructBiCGSTABGetNumIterations(d_solver, &d_current_iterations);
         HYPRE_SStructBiCGSTABGetFinalRelativeResidualNorm(d_solver, &d_current_residual_norm);
@@ -900,6 +975,18 @@ SCPoissonHypreLevelSolver::destroyHypreSolver()
     return;
 } // destroyHypreSolver
 
+void
+SCPoissonHypreLevelSolver::releaseHypreData()
+{
+    if (!d_hypre_data_allocated) return;
+    destroyHypreSolver();
+    deallocateHypreData();
+    d_matrix_values.clear();
+    d_matrix_scale = 1.0;
+    d_hypre_data_allocated = false;
+    return;
+} // releaseHypreData
+
 void
 SCPoissonHypreLevelSolver::deallocateHypreData()
 {
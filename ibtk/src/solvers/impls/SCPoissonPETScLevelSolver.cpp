@@ -72,6 +72,8 @@ SCPoissonPETScLevelSolver::SCPoissonPETScLevelSolver(const std::string& object_n
     // Configure solver.
     GeneralSolver::init(object_name, /*homogeneous_bc*/ false);
     PETScLevelSolver::init(input_db, std::move(default_options_prefix));
+    if (input_db && input_db->keyExists("cache_bc_rhs_adjustment"))
+        d_cache_bc_rhs_adjustment = input_db->getBool("cache_bc_rhs_adjustment");
 
     // Construct the DOF index variable/context.
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
@@ -149,6 +151,10 @@ SCPoissonPETScLevelSolver::deallocateSolverStateSpecialized()
 {
     // Deallocate DOF index data.
     if (d_level->checkAllocated(d_dof_index_idx)) d_level->deallocatePatchData(d_dof_index_idx);
+
+    // Clear the cached boundary modifications.
+    d_bc_rhs_adjustments.clear();
+    d_bc_rhs_adjustments_valid = false;
     return;
 } // deallocateSolverStateSpecialized
 
@@ -180,6 +186,15 @@ SCPoissonPETScLevelSolver::setupKSPVecs(Vec& petsc_x,
     const int x_idx = x.getComponentDescriptorIndex(0);
     const int b_idx = b.getComponentDescriptorIndex(0);
     const auto b_adj_idx = d_cached_eulerian_data.getCachedPatchDataIndex(b_idx);
+
+    // Determine whether the cached physical boundary modifications need to be
+    // recomputed.  Modifications for homogeneous boundary conditions vanish, so
+    // they are never cached.
+    const bool use_cached_bc_adjustments = d_cache_bc_rhs_adjustment && !d_homogeneous_bc;
+    const bool recompute_bc_adjustments =
+        use_cached_bc_adjustments && !(d_bc_rhs_adjustments_valid && d_bc_rhs_adjustment_time == d_solution_time);
+    if (recompute_bc_adjustments) d_bc_rhs_adjustments.clear();
+    unsigned int bdry_patch_counter = 0;
     for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
@@ -189,7 +204,22 @@ SCPoissonPETScLevelSolver::setupKSPVecs(Vec& petsc_x,
         Pointer<SideData<NDIM, double> > b_adj_data = patch->getPatchData(b_adj_idx);
         b_adj_data->copy(*b_data);
         const bool at_physical_bdry = pgeom->intersectsPhysicalBoundary();
-        if (at_physical_bdry)
+        if (at_physical_bdry && use_cached_bc_adjustments)
+        {
+            if (recompute_bc_adjustments)
+            {
+                d_bc_rhs_adjustments.emplace_back();
+                PoissonUtilities::computeRHSAdjustmentAtPhysicalBoundary(d_bc_rhs_adjustments.back(),
+                                                                         *b_adj_data,
+                                                                         patch,
+                                                                         d_poisson_spec,
+                                                                         d_bc_coefs,
+                                                                         d_solution_time,
+                                                                         d_homogeneous_bc);
+            }
+            PoissonUtilities::applyRHSAdjustment(*b_adj_data, d_bc_rhs_adjustments[bdry_patch_counter++]);
+        }
+        else if (at_physical_bdry)
         {
             PoissonUtilities::adjustRHSAtPhysicalBoundary(
                 *b_adj_data, patch, d_poisson_spec, d_bc_coefs, d_solution_time, d_homogeneous_bc);
@@ -204,6 +234,11 @@ SCPoissonPETScLevelSolver::setupKSPVecs(Vec& petsc_x,
                 *b_adj_data, *x_data, patch, d_poisson_spec, type_1_cf_bdry);
         }
     }
+    if (recompute_bc_adjustments)
+    {
+        d_bc_rhs_adjustments_valid = true;
+        d_bc_rhs_adjustment_time = d_solution_time;
+    }
     PETScVecUtilities::copyToPatchLevelVec(petsc_b, b_adj_idx, d_dof_index_idx, d_level);
     return;
 } // setupKSPVecs
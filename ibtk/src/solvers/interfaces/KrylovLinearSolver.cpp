@@ -17,8 +17,10 @@
 #include "ibtk/KrylovLinearSolver.h"
 #include "ibtk/LinearOperator.h"
 #include "ibtk/LinearSolver.h"
+#include "ibtk/SAMRAIFischerGuess.h"
 
 #include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
 
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
@@ -113,6 +115,21 @@ KrylovLinearSolver::getPreconditioner() const
     return d_pc_solver;
 } // getPreconditioner
 
+void
+KrylovLinearSolver::setNumberOfFischerGuessVectors(const int n_vectors)
+{
+    TBOX_ASSERT(n_vectors >= 0);
+    if (n_vectors > 0)
+    {
+        d_fischer_guess.reset(new SAMRAIFischerGuess(n_vectors));
+    }
+    else
+    {
+        d_fischer_guess.reset();
+    }
+    return;
+} // setNumberOfFischerGuessVectors
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////////
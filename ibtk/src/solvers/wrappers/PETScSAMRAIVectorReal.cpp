@@ -19,9 +19,20 @@
 #include "ibtk/PETScSAMRAIVectorReal.h"
 #include "ibtk/ibtk_utilities.h"
 
+#include "ArrayData.h"
+#include "Box.h"
+#include "CellData.h"
+#include "CellVariable.h"
+#include "Index.h"
 #include "IntVector.h"
+#include "Patch.h"
+#include "PatchData.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "SAMRAIVectorReal.h"
+#include "SideData.h"
+#include "SideGeometry.h"
+#include "SideVariable.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/Pointer.h"
 #include "tbox/Timer.h"
@@ -35,6 +46,7 @@
 #include <cmath>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
@@ -104,6 +116,65 @@ static Timer* t_vec_dot_norm2;
 #define PSVR_CHECK3(v1, v2, v3)
 #define PSVR_CHECKN(v, N)
 #endif
+
+// Returns true if all components of the vector are cell- or side-centered
+// data, for which the fused kernels are implemented.
+bool
+supports_fused_kernels(const SAMRAIVectorReal<NDIM, double>& v)
+{
+    for (int comp = 0; comp < v.getNumberOfComponents(); ++comp)
+    {
+        Pointer<CellVariable<NDIM, double> > cc_var = v.getComponentVariable(comp);
+        Pointer<SideVariable<NDIM, double> > sc_var = v.getComponentVariable(comp);
+        if (!cc_var && !sc_var) return false;
+    }
+    return true;
+} // supports_fused_kernels
+
+// Calls f(data, cvol_data, box) for each array of data of the vector, in which
+// box is the part of the patch interior that corresponds to the array and
+// cvol_data is a null pointer if the vector does not have control volumes.
+template <class Function>
+void
+for_each_array(const SAMRAIVectorReal<NDIM, double>& v, Function f)
+{
+    Pointer<PatchHierarchy<NDIM> > hierarchy = v.getPatchHierarchy();
+    for (int comp = 0; comp < v.getNumberOfComponents(); ++comp)
+    {
+        const int cvol_idx = v.getControlVolumeIndex(comp);
+        const bool has_cvol = cvol_idx >= 0;
+        Pointer<CellVariable<NDIM, double> > cc_var = v.getComponentVariable(comp);
+        for (int ln = v.getCoarsestLevelNumber(); ln <= v.getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                if (cc_var)
+                {
+                    Pointer<CellData<NDIM, double> > comp_data = v.getComponentPatchData(comp, *patch);
+                    Pointer<CellData<NDIM, double> > cvol_data =
+                        has_cvol ? patch->getPatchData(cvol_idx) : Pointer<PatchData<NDIM> >(nullptr);
+                    f(comp_data->getArrayData(), cvol_data ? &cvol_data->getArrayData() : nullptr, patch_box);
+                }
+                else
+                {
+                    Pointer<SideData<NDIM, double> > comp_data = v.getComponentPatchData(comp, *patch);
+                    Pointer<SideData<NDIM, double> > cvol_data =
+                        has_cvol ? patch->getPatchData(cvol_idx) : Pointer<PatchData<NDIM> >(nullptr);
+                    for (unsigned int axis = 0; axis < NDIM; ++axis)
+                    {
+                        f(comp_data->getArrayData(axis),
+                          cvol_data ? &cvol_data->getArrayData(axis) : nullptr,
+                          SideGeometry<NDIM>::toSideBox(patch_box, axis));
+                    }
+                }
+            }
+        }
+    }
+    return;
+} // for_each_array
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -296,7 +367,8 @@ PETScSAMRAIVectorReal::VecDot_SAMRAI(Vec x, Vec y, PetscScalar* val)
 {
     IBTK_TIMER_START(t_vec_dot);
     PSVR_CHECK2(x, y);
-    *val = PSVR_CAST2(x)->dot(PSVR_CAST2(y));
+    localMDot(x, 1, &y, val);
+    IBTK_MPI::sumReduction(val, 1);
     IBTK_TIMER_STOP(t_vec_dot);
     PetscFunctionReturn(0);
 }
@@ -307,11 +379,7 @@ PETScSAMRAIVectorReal::VecMDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscSca
     IBTK_TIMER_START(t_vec_m_dot);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
-    }
+    localMDot(x, nv, y, val);
     IBTK_MPI::sumReduction(val, nv);
     IBTK_TIMER_STOP(t_vec_m_dot);
     PetscFunctionReturn(0);
@@ -357,7 +425,8 @@ PETScSAMRAIVectorReal::VecTDot_SAMRAI(Vec x, Vec y, PetscScalar* val)
 {
     IBTK_TIMER_START(t_vec_t_dot);
     PSVR_CHECK2(x, y);
-    *val = PSVR_CAST2(x)->dot(PSVR_CAST2(y));
+    localMDot(x, 1, &y, val);
+    IBTK_MPI::sumReduction(val, 1);
     IBTK_TIMER_STOP(t_vec_t_dot);
     PetscFunctionReturn(0);
 }
@@ -368,11 +437,7 @@ PETScSAMRAIVectorReal::VecMTDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscSc
     IBTK_TIMER_START(t_vec_m_t_dot);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
-    }
+    localMDot(x, nv, y, val);
     IBTK_MPI::sumReduction(val, nv);
     IBTK_TIMER_STOP(t_vec_m_t_dot);
     PetscFunctionReturn(0);
@@ -437,18 +502,31 @@ PETScSAMRAIVectorReal::VecAXPY_SAMRAI(Vec y, PetscScalar alpha, Vec x)
 {
     IBTK_TIMER_START(t_vec_axpy);
     PSVR_CHECK2(x, y);
-    static const bool interior_only = false;
-    if (MathUtilities<double>::equalEps(alpha, 1.0))
-    {
-        PSVR_CAST2(y)->add(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
-    }
-    else if (MathUtilities<double>::equalEps(alpha, -1.0))
+    std::vector<const DataSpans*> spans;
+    if (getDataSpans({ y, x }, spans))
     {
-        PSVR_CAST2(y)->subtract(PSVR_CAST2(y), PSVR_CAST2(x), interior_only);
+        for (unsigned int a = 0; a < spans[0]->arrays.size(); ++a)
+        {
+            double* const y_arr = spans[0]->arrays[a];
+            const double* const x_arr = spans[1]->arrays[a];
+            for (int j = 0; j < spans[0]->array_sizes[a]; ++j) y_arr[j] += alpha * x_arr[j];
+        }
     }
     else
     {
-        PSVR_CAST2(y)->axpy(alpha, PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        static const bool interior_only = false;
+        if (MathUtilities<double>::equalEps(alpha, 1.0))
+        {
+            PSVR_CAST2(y)->add(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        }
+        else if (MathUtilities<double>::equalEps(alpha, -1.0))
+        {
+            PSVR_CAST2(y)->subtract(PSVR_CAST2(y), PSVR_CAST2(x), interior_only);
+        }
+        else
+        {
+            PSVR_CAST2(y)->axpy(alpha, PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        }
     }
     int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
     CHKERRQ(ierr);
@@ -461,22 +539,35 @@ PETScSAMRAIVectorReal::VecAXPBY_SAMRAI(Vec y, PetscScalar alpha, PetscScalar bet
 {
     IBTK_TIMER_START(t_vec_axpby);
     PSVR_CHECK2(x, y);
-    static const bool interior_only = false;
-    if (MathUtilities<double>::equalEps(alpha, 1.0) && MathUtilities<double>::equalEps(beta, 1.0))
-    {
-        PSVR_CAST2(y)->add(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
-    }
-    else if (MathUtilities<double>::equalEps(beta, 1.0))
-    {
-        PSVR_CAST2(y)->axpy(alpha, PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
-    }
-    else if (MathUtilities<double>::equalEps(alpha, 1.0))
+    std::vector<const DataSpans*> spans;
+    if (getDataSpans({ y, x }, spans))
     {
-        PSVR_CAST2(y)->axpy(beta, PSVR_CAST2(y), PSVR_CAST2(x), interior_only);
+        for (unsigned int a = 0; a < spans[0]->arrays.size(); ++a)
+        {
+            double* const y_arr = spans[0]->arrays[a];
+            const double* const x_arr = spans[1]->arrays[a];
+            for (int j = 0; j < spans[0]->array_sizes[a]; ++j) y_arr[j] = alpha * x_arr[j] + beta * y_arr[j];
+        }
     }
     else
     {
-        PSVR_CAST2(y)->linearSum(alpha, PSVR_CAST2(x), beta, PSVR_CAST2(y), interior_only);
+        static const bool interior_only = false;
+        if (MathUtilities<double>::equalEps(alpha, 1.0) && MathUtilities<double>::equalEps(beta, 1.0))
+        {
+            PSVR_CAST2(y)->add(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        }
+        else if (MathUtilities<double>::equalEps(beta, 1.0))
+        {
+            PSVR_CAST2(y)->axpy(alpha, PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        }
+        else if (MathUtilities<double>::equalEps(alpha, 1.0))
+        {
+            PSVR_CAST2(y)->axpy(beta, PSVR_CAST2(y), PSVR_CAST2(x), interior_only);
+        }
+        else
+        {
+            PSVR_CAST2(y)->linearSum(alpha, PSVR_CAST2(x), beta, PSVR_CAST2(y), interior_only);
+        }
     }
     int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
     CHKERRQ(ierr);
@@ -490,20 +581,42 @@ PETScSAMRAIVectorReal::VecMAXPY_SAMRAI(Vec y, PetscInt nv, const PetscScalar* al
     IBTK_TIMER_START(t_vec_maxpy);
     PSVR_CHECK1(y);
     PSVR_CHECKN(x, nv);
-    static const bool interior_only = false;
-    for (PetscInt i = 0; i < nv; ++i)
+    std::vector<Vec> vecs(1, y);
+    vecs.insert(vecs.end(), x, x + nv);
+    std::vector<const DataSpans*> spans;
+    if (getDataSpans(vecs, spans))
     {
-        if (MathUtilities<double>::equalEps(alpha[i], 1.0))
+        // Update y with all of the vectors x in a single pass over the data.
+        std::vector<const double*> x_arr(nv);
+        for (unsigned int a = 0; a < spans[0]->arrays.size(); ++a)
         {
-            PSVR_CAST2(y)->add(PSVR_CAST2(x[i]), PSVR_CAST2(y), interior_only);
+            double* const y_arr = spans[0]->arrays[a];
+            for (PetscInt i = 0; i < nv; ++i) x_arr[i] = spans[i + 1]->arrays[a];
+            for (int j = 0; j < spans[0]->array_sizes[a]; ++j)
+            {
+                double sum = 0.0;
+                for (PetscInt i = 0; i < nv; ++i) sum += alpha[i] * x_arr[i][j];
+                y_arr[j] += sum;
+            }
         }
-        else if (MathUtilities<double>::equalEps(alpha[i], -1.0))
-        {
-            PSVR_CAST2(y)->subtract(PSVR_CAST2(y), PSVR_CAST2(x[i]), interior_only);
-        }
-        else
+    }
+    else
+    {
+        static const bool interior_only = false;
+        for (PetscInt i = 0; i < nv; ++i)
         {
-            PSVR_CAST2(y)->axpy(alpha[i], PSVR_CAST2(x[i]), PSVR_CAST2(y), interior_only);
+            if (MathUtilities<double>::equalEps(alpha[i], 1.0))
+            {
+                PSVR_CAST2(y)->add(PSVR_CAST2(x[i]), PSVR_CAST2(y), interior_only);
+            }
+            else if (MathUtilities<double>::equalEps(alpha[i], -1.0))
+            {
+                PSVR_CAST2(y)->subtract(PSVR_CAST2(y), PSVR_CAST2(x[i]), interior_only);
+            }
+            else
+            {
+                PSVR_CAST2(y)->axpy(alpha[i], PSVR_CAST2(x[i]), PSVR_CAST2(y), interior_only);
+            }
         }
     }
     int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
@@ -517,18 +630,31 @@ PETScSAMRAIVectorReal::VecAYPX_SAMRAI(Vec y, const PetscScalar alpha, Vec x)
 {
     IBTK_TIMER_START(t_vec_aypx);
     PSVR_CHECK2(x, y);
-    static const bool interior_only = false;
-    if (MathUtilities<double>::equalEps(alpha, 1.0))
+    std::vector<const DataSpans*> spans;
+    if (getDataSpans({ y, x }, spans))
     {
-        PSVR_CAST2(y)->add(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
-    }
-    else if (MathUtilities<double>::equalEps(alpha, -1.0))
-    {
-        PSVR_CAST2(y)->subtract(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        for (unsigned int a = 0; a < spans[0]->arrays.size(); ++a)
+        {
+            double* const y_arr = spans[0]->arrays[a];
+            const double* const x_arr = spans[1]->arrays[a];
+            for (int j = 0; j < spans[0]->array_sizes[a]; ++j) y_arr[j] = x_arr[j] + alpha * y_arr[j];
+        }
     }
     else
     {
-        PSVR_CAST2(y)->axpy(alpha, PSVR_CAST2(y), PSVR_CAST2(x), interior_only);
+        static const bool interior_only = false;
+        if (MathUtilities<double>::equalEps(alpha, 1.0))
+        {
+            PSVR_CAST2(y)->add(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        }
+        else if (MathUtilities<double>::equalEps(alpha, -1.0))
+        {
+            PSVR_CAST2(y)->subtract(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        }
+        else
+        {
+            PSVR_CAST2(y)->axpy(alpha, PSVR_CAST2(y), PSVR_CAST2(x), interior_only);
+        }
     }
     int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(y));
     CHKERRQ(ierr);
@@ -541,18 +667,32 @@ PETScSAMRAIVectorReal::VecWAXPY_SAMRAI(Vec w, PetscScalar alpha, Vec x, Vec y)
 {
     IBTK_TIMER_START(t_vec_waxpy);
     PSVR_CHECK3(w, x, y);
-    static const bool interior_only = false;
-    if (MathUtilities<double>::equalEps(alpha, 1.0))
+    std::vector<const DataSpans*> spans;
+    if (getDataSpans({ w, x, y }, spans))
     {
-        PSVR_CAST2(w)->add(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
-    }
-    else if (MathUtilities<double>::equalEps(alpha, -1.0))
-    {
-        PSVR_CAST2(w)->subtract(PSVR_CAST2(y), PSVR_CAST2(x), interior_only);
+        for (unsigned int a = 0; a < spans[0]->arrays.size(); ++a)
+        {
+            double* const w_arr = spans[0]->arrays[a];
+            const double* const x_arr = spans[1]->arrays[a];
+            const double* const y_arr = spans[2]->arrays[a];
+            for (int j = 0; j < spans[0]->array_sizes[a]; ++j) w_arr[j] = alpha * x_arr[j] + y_arr[j];
+        }
     }
     else
     {
-        PSVR_CAST2(w)->axpy(alpha, PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        static const bool interior_only = false;
+        if (MathUtilities<double>::equalEps(alpha, 1.0))
+        {
+            PSVR_CAST2(w)->add(PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        }
+        else if (MathUtilities<double>::equalEps(alpha, -1.0))
+        {
+            PSVR_CAST2(w)->subtract(PSVR_CAST2(y), PSVR_CAST2(x), interior_only);
+        }
+        else
+        {
+            PSVR_CAST2(w)->axpy(alpha, PSVR_CAST2(x), PSVR_CAST2(y), interior_only);
+        }
     }
     int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(w));
     CHKERRQ(ierr);
@@ -565,9 +705,26 @@ PETScSAMRAIVectorReal::VecAXPBYPCZ_SAMRAI(Vec z, PetscScalar alpha, PetscScalar
 {
     IBTK_TIMER_START(t_vec_axpbypcz);
     PSVR_CHECK3(x, y, z);
-    static const bool interior_only = false;
-    PSVR_CAST2(z)->linearSum(alpha, PSVR_CAST2(x), gamma, PSVR_CAST2(z), interior_only);
-    PSVR_CAST2(z)->axpy(beta, PSVR_CAST2(y), PSVR_CAST2(z), interior_only);
+    std::vector<const DataSpans*> spans;
+    if (getDataSpans({ z, x, y }, spans))
+    {
+        for (unsigned int a = 0; a < spans[0]->arrays.size(); ++a)
+        {
+            double* const z_arr = spans[0]->arrays[a];
+            const double* const x_arr = spans[1]->arrays[a];
+            const double* const y_arr = spans[2]->arrays[a];
+            for (int j = 0; j < spans[0]->array_sizes[a]; ++j)
+            {
+                z_arr[j] = alpha * x_arr[j] + beta * y_arr[j] + gamma * z_arr[j];
+            }
+        }
+    }
+    else
+    {
+        static const bool interior_only = false;
+        PSVR_CAST2(z)->linearSum(alpha, PSVR_CAST2(x), gamma, PSVR_CAST2(z), interior_only);
+        PSVR_CAST2(z)->axpy(beta, PSVR_CAST2(y), PSVR_CAST2(z), interior_only);
+    }
     int ierr = PetscObjectStateIncrease(reinterpret_cast<PetscObject>(z));
     CHKERRQ(ierr);
     IBTK_TIMER_STOP(t_vec_axpbypcz);
@@ -663,8 +820,7 @@ PETScSAMRAIVectorReal::VecDot_local_SAMRAI(Vec x, Vec y, PetscScalar* val)
 {
     IBTK_TIMER_START(t_vec_dot_local);
     PSVR_CHECK2(x, y);
-    static const bool local_only = true;
-    *val = PSVR_CAST2(x)->dot(PSVR_CAST2(y), local_only);
+    localMDot(x, 1, &y, val);
     IBTK_TIMER_STOP(t_vec_dot_local);
     PetscFunctionReturn(0);
 }
@@ -674,8 +830,7 @@ PETScSAMRAIVectorReal::VecTDot_local_SAMRAI(Vec x, Vec y, PetscScalar* val)
 {
     IBTK_TIMER_START(t_vec_t_dot_local);
     PSVR_CHECK2(x, y);
-    static const bool local_only = true;
-    *val = PSVR_CAST2(x)->dot(PSVR_CAST2(y), local_only);
+    localMDot(x, 1, &y, val);
     IBTK_TIMER_STOP(t_vec_t_dot_local);
     PetscFunctionReturn(0);
 }
@@ -718,11 +873,7 @@ PETScSAMRAIVectorReal::VecMDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, Pe
     IBTK_TIMER_START(t_vec_m_dot_local);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
-    }
+    localMDot(x, nv, y, val);
     IBTK_TIMER_STOP(t_vec_m_dot_local);
     PetscFunctionReturn(0);
 }
@@ -733,11 +884,7 @@ PETScSAMRAIVectorReal::VecMTDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, P
     IBTK_TIMER_START(t_vec_m_t_dot_local);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
-    for (PetscInt i = 0; i < nv; ++i)
-    {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
-    }
+    localMDot(x, nv, y, val);
     IBTK_TIMER_STOP(t_vec_m_t_dot_local);
     PetscFunctionReturn(0);
 }
@@ -757,12 +904,147 @@ PETScSAMRAIVectorReal::VecDotNorm2_SAMRAI(Vec s, Vec t, PetscScalar* dp, PetscSc
 {
     IBTK_TIMER_START(t_vec_dot_norm2);
     PSVR_CHECK2(s, t);
-    *dp = PSVR_CAST2(s)->dot(PSVR_CAST2(t));
-    *nm = PSVR_CAST2(t)->dot(PSVR_CAST2(t));
+    // Compute both inner products with a single reduction.
+    static const bool local_only = true;
+    double vals[2] = { PSVR_CAST2(s)->dot(PSVR_CAST2(t), local_only), PSVR_CAST2(t)->dot(PSVR_CAST2(t), local_only) };
+    IBTK_MPI::sumReduction(vals, 2);
+    *dp = vals[0];
+    *nm = vals[1];
     IBTK_TIMER_STOP(t_vec_dot_norm2);
     PetscFunctionReturn(0);
 }
 
+const PETScSAMRAIVectorReal::DataSpans*
+PETScSAMRAIVectorReal::getCachedDataSpans()
+{
+    // The patch data (or the control volumes) may have been reallocated since
+    // the locations were cached, e.g., when the hierarchy is regridded.
+    if (d_data_spans_valid && d_data_spans_supported && !cachedDataSpansAreCurrent()) d_data_spans_valid = false;
+    if (!d_data_spans_valid)
+    {
+        d_data_spans = DataSpans();
+        d_data_spans_supported = supports_fused_kernels(*d_samrai_vector);
+        if (d_data_spans_supported)
+        {
+            for_each_array(*d_samrai_vector,
+                           [this](ArrayData<NDIM, double>& data,
+                                  const ArrayData<NDIM, double>* const cvol_data,
+                                  const Box<NDIM>& box) {
+                               const auto array_num = static_cast<unsigned int>(d_data_spans.arrays.size());
+                               const Box<NDIM>& data_box = data.getBox();
+                               const int depth = data.getDepth();
+                               d_data_spans.arrays.push_back(data.getPointer());
+                               d_data_spans.cvol_arrays.push_back(cvol_data ? cvol_data->getPointer() : nullptr);
+                               d_data_spans.array_sizes.push_back(data_box.size() * depth);
+                               d_data_spans.array_boxes.push_back(data_box);
+
+                               // Record the rows of the box along the first
+                               // coordinate direction, which are contiguous in
+                               // memory.
+                               Box<NDIM> row_box = box;
+                               row_box.upper(0) = row_box.lower(0);
+                               const int row_length = box.numberCells(0);
+                               for (int d = 0; d < depth; ++d)
+                               {
+                                   const int cvol_depth = (cvol_data && cvol_data->getDepth() == depth) ? d : 0;
+                                   for (Box<NDIM>::Iterator b(row_box); b; b++)
+                                   {
+                                       const hier::Index<NDIM>& i = b();
+                                       DataSpans::Row row;
+                                       row.array_num = array_num;
+                                       row.offset =
+                                           d * data_box.size() + static_cast<int>(array_offset(data.getBox(), i));
+                                       row.length = row_length;
+                                       row.cvol = cvol_data ? cvol_data->getPointer(cvol_depth) +
+                                                                  array_offset(cvol_data->getBox(), i) :
+                                                              nullptr;
+                                       d_data_spans.interior_rows.push_back(row);
+                                   }
+                               }
+                           });
+        }
+        d_data_spans_valid = true;
+    }
+    return d_data_spans_supported ? &d_data_spans : nullptr;
+} // getCachedDataSpans
+
+bool
+PETScSAMRAIVectorReal::cachedDataSpansAreCurrent() const
+{
+    const unsigned int num_arrays = static_cast<unsigned int>(d_data_spans.arrays.size());
+    unsigned int array_num = 0;
+    bool current = true;
+    for_each_array(*d_samrai_vector,
+                   [&](ArrayData<NDIM, double>& data,
+                       const ArrayData<NDIM, double>* const cvol_data,
+                       const Box<NDIM>& /*box*/) {
+                       if (!current) return;
+                       current = array_num < num_arrays && d_data_spans.arrays[array_num] == data.getPointer() &&
+                                 d_data_spans.array_boxes[array_num] == data.getBox() &&
+                                 d_data_spans.cvol_arrays[array_num] ==
+                                     (cvol_data ? cvol_data->getPointer() : nullptr);
+                       ++array_num;
+                   });
+    return current && array_num == num_arrays;
+} // cachedDataSpansAreCurrent
+
+bool
+PETScSAMRAIVectorReal::getDataSpans(const std::vector<Vec>& vecs, std::vector<const DataSpans*>& spans)
+{
+    spans.resize(vecs.size());
+    for (unsigned int k = 0; k < vecs.size(); ++k)
+    {
+        spans[k] = PSVR_CAST1(vecs[k])->getCachedDataSpans();
+        if (!spans[k]) return false;
+        if (spans[k]->array_boxes != spans[0]->array_boxes || spans[k]->array_sizes != spans[0]->array_sizes)
+        {
+            return false;
+        }
+    }
+    return true;
+} // getDataSpans
+
+void
+PETScSAMRAIVectorReal::localMDot(Vec x, PetscInt nv, const Vec* y, PetscScalar* val)
+{
+    std::vector<Vec> vecs(1, x);
+    vecs.insert(vecs.end(), y, y + nv);
+    std::vector<const DataSpans*> spans;
+    if (getDataSpans(vecs, spans))
+    {
+        // Compute all of the inner products in a single pass over the data of
+        // x, weighted by the control volumes of x.
+        std::fill(val, val + nv, 0.0);
+        for (const DataSpans::Row& row : spans[0]->interior_rows)
+        {
+            const double* const x_row = spans[0]->arrays[row.array_num] + row.offset;
+            for (PetscInt i = 0; i < nv; ++i)
+            {
+                const double* const y_row = spans[i + 1]->arrays[row.array_num] + row.offset;
+                double sum = 0.0;
+                if (row.cvol)
+                {
+                    for (int j = 0; j < row.length; ++j) sum += row.cvol[j] * x_row[j] * y_row[j];
+                }
+                else
+                {
+                    for (int j = 0; j < row.length; ++j) sum += x_row[j] * y_row[j];
+                }
+                val[i] += sum;
+            }
+        }
+    }
+    else
+    {
+        static const bool local_only = true;
+        for (PetscInt i = 0; i < nv; ++i)
+        {
+            val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        }
+    }
+    return;
+} // localMDot
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
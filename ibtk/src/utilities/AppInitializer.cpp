@@ -14,8 +14,13 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include "ibtk/AppInitializer.h"
+#include "ibtk/CommunicationStatistics.h"
+#include "ibtk/EnsembleInit.h"
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/MemoryStatistics.h"
+#include "ibtk/TelemetryManager.h"
+#include "ibtk/VizOutputSchedule.h"
 
 #include "VisItDataWriter.h"
 #include "tbox/Array.h"
@@ -83,6 +88,10 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
     d_input_db = new InputDatabase("input_db");
     InputManager::getManager()->parseInputFile(input_filename, d_input_db);
 
+    // Apply the input overrides of the current member of an ensemble.
+    EnsembleInit* const ensemble_init = EnsembleInit::getInstance();
+    if (ensemble_init) ensemble_init->applyMemberOverrides(d_input_db);
+
     // Set custom PETSc options file when one is specified.
     if (d_input_db->keyExists("petsc_options_file"))
     {
@@ -100,7 +109,14 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
     // Configure logging options.
     std::string log_file_name = default_log_file_name;
     bool log_all_nodes = false;
-    if (main_db->keyExists("log_file_name")) log_file_name = main_db->getString("log_file_name");
+    if (main_db->keyExists("log_file_name"))
+    {
+        log_file_name = main_db->getString("log_file_name");
+    }
+    else if (ensemble_init && !log_file_name.empty())
+    {
+        log_file_name += "." + ensemble_init->getMemberSuffix();
+    }
     if (main_db->keyExists("log_all_nodes")) log_all_nodes = main_db->getBool("log_all_nodes");
     if (!log_file_name.empty())
     {
@@ -145,6 +161,20 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
         TimerManager::createManager(timer_manager_db);
     }
 
+    // Configure performance telemetry.
+    if (d_input_db->isDatabase("TelemetryManager"))
+    {
+        TelemetryManager::getManager()->setOptions(d_input_db->getDatabase("TelemetryManager"));
+    }
+    if (d_input_db->isDatabase("CommunicationStatistics"))
+    {
+        CommunicationStatistics::getManager()->setOptions(d_input_db->getDatabase("CommunicationStatistics"));
+    }
+    if (d_input_db->isDatabase("MemoryStatistics"))
+    {
+        MemoryStatistics::getManager()->setOptions(d_input_db->getDatabase("MemoryStatistics"));
+    }
+
     // Configure visualization options.
     std::string viz_dump_interval_key_name;
     if (main_db->keyExists("viz_interval"))
@@ -259,6 +289,10 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
         }
     }
 
+    Pointer<Database> viz_output_schedule_db;
+    if (main_db->isDatabase("VizOutputSchedule")) viz_output_schedule_db = main_db->getDatabase("VizOutputSchedule");
+    d_viz_output_schedule = new VizOutputSchedule(viz_output_schedule_db, d_viz_dump_interval);
+
     // Configure restart options.
     std::string restart_dump_interval_key_name;
     if (main_db->keyExists("restart_interval"))
@@ -473,6 +507,12 @@ AppInitializer::getGMVFilename(const std::string& prefix) const
     return gmv_filename;
 } // getGMVFilename
 
+Pointer<VizOutputSchedule>
+AppInitializer::getVizOutputSchedule() const
+{
+    return d_viz_output_schedule;
+} // getVizOutputSchedule
+
 bool
 AppInitializer::dumpRestartData() const
 {
@@ -0,0 +1,138 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/BoxTree.h"
+#include "ibtk/ibtk_utilities.h"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+const int BoxTree::s_max_leaf_size;
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+BoxTree::BoxTree(const EigenAlignedVector<std::pair<Point, Point> >& boxes) : d_boxes(boxes), d_box_ids(boxes.size())
+{
+    if (d_boxes.empty()) return;
+    std::iota(d_box_ids.begin(), d_box_ids.end(), 0);
+    d_nodes.reserve(2 * d_boxes.size() / s_max_leaf_size + 1);
+    buildSubtree(0, static_cast<int>(d_boxes.size()));
+    return;
+} // BoxTree
+
+int
+BoxTree::size() const
+{
+    return static_cast<int>(d_boxes.size());
+} // size
+
+void
+BoxTree::query(const Point& lower, const Point& upper, std::vector<int>& box_ids) const
+{
+    if (d_nodes.empty()) return;
+    const auto intersects = [&](const Point& box_lower, const Point& box_upper) {
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            if (box_upper[d] < lower[d] || upper[d] < box_lower[d]) return false;
+        }
+        return true;
+    };
+
+    // The root node is always the first node.
+    std::vector<int> stack(1, 0);
+    while (!stack.empty())
+    {
+        const Node& node = d_nodes[stack.back()];
+        stack.pop_back();
+        if (!intersects(node.lower, node.upper)) continue;
+        if (node.left == -1)
+        {
+            for (int k = node.begin; k < node.end; ++k)
+            {
+                const int box_id = d_box_ids[k];
+                if (intersects(d_boxes[box_id].first, d_boxes[box_id].second)) box_ids.push_back(box_id);
+            }
+        }
+        else
+        {
+            stack.push_back(node.left);
+            stack.push_back(node.right);
+        }
+    }
+    return;
+} // query
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+int
+BoxTree::buildSubtree(const int begin, const int end)
+{
+    const int node_idx = static_cast<int>(d_nodes.size());
+    d_nodes.emplace_back();
+    Node node;
+    node.begin = begin;
+    node.end = end;
+    node.lower = d_boxes[d_box_ids[begin]].first;
+    node.upper = d_boxes[d_box_ids[begin]].second;
+    Point center_lower = 0.5 * (node.lower + node.upper), center_upper = center_lower;
+    for (int k = begin + 1; k < end; ++k)
+    {
+        const std::pair<Point, Point>& box = d_boxes[d_box_ids[k]];
+        const Point center = 0.5 * (box.first + box.second);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            node.lower[d] = std::min(node.lower[d], box.first[d]);
+            node.upper[d] = std::max(node.upper[d], box.second[d]);
+            center_lower[d] = std::min(center_lower[d], center[d]);
+            center_upper[d] = std::max(center_upper[d], center[d]);
+        }
+    }
+
+    if (end - begin > s_max_leaf_size)
+    {
+        // Split the boxes at the median of their centers along the direction
+        // in which the centers are spread the most.
+        int axis = 0;
+        (center_upper - center_lower).maxCoeff(&axis);
+        const int mid = begin + (end - begin) / 2;
+        std::nth_element(d_box_ids.begin() + begin,
+                         d_box_ids.begin() + mid,
+                         d_box_ids.begin() + end,
+                         [&](const int a, const int b) {
+                             return d_boxes[a].first[axis] + d_boxes[a].second[axis] <
+                                    d_boxes[b].first[axis] + d_boxes[b].second[axis];
+                         });
+        node.left = buildSubtree(begin, mid);
+        node.right = buildSubtree(mid, end);
+    }
+    d_nodes[node_idx] = node;
+    return node_idx;
+} // buildSubtree
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
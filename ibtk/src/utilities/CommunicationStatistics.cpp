@@ -0,0 +1,353 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/CommunicationStatistics.h"
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/ibtk_utilities.h"
+
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/ShutdownRegistry.h"
+
+#include "petscis.h"
+#include "petscvec.h"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+CommunicationStatistics* CommunicationStatistics::s_communication_statistics_instance = nullptr;
+bool CommunicationStatistics::s_registered_callback = false;
+unsigned char CommunicationStatistics::s_shutdown_priority = 200;
+bool CommunicationStatistics::s_enabled = false;
+
+namespace
+{
+const std::string unassigned_phase_name = "unassigned";
+} // namespace
+
+CommunicationStatistics*
+CommunicationStatistics::getManager()
+{
+    if (!s_communication_statistics_instance)
+    {
+        s_communication_statistics_instance = new CommunicationStatistics();
+    }
+    if (!s_registered_callback)
+    {
+        ShutdownRegistry::registerShutdownRoutine(freeManager, s_shutdown_priority);
+        s_registered_callback = true;
+    }
+    return s_communication_statistics_instance;
+} // getManager
+
+void
+CommunicationStatistics::freeManager()
+{
+    if (s_communication_statistics_instance && s_enabled) s_communication_statistics_instance->writeStatistics();
+    delete s_communication_statistics_instance;
+    s_communication_statistics_instance = nullptr;
+    s_enabled = false;
+    return;
+} // freeManager
+
+CommunicationStatistics::ScopedPhase::ScopedPhase(std::string phase_name) : d_active(s_enabled)
+{
+    if (d_active) CommunicationStatistics::getManager()->d_phase_stack.push_back(std::move(phase_name));
+    return;
+} // ScopedPhase
+
+CommunicationStatistics::ScopedPhase::~ScopedPhase()
+{
+    if (d_active && s_communication_statistics_instance)
+    {
+        s_communication_statistics_instance->d_phase_stack.pop_back();
+    }
+    return;
+} // ~ScopedPhase
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+CommunicationStatistics::setOptions(Pointer<Database> input_db)
+{
+    if (!input_db) return;
+    s_enabled = input_db->getBoolWithDefault("enable", true);
+    d_file_name = input_db->getStringWithDefault("file_name", d_file_name);
+    return;
+} // setOptions
+
+void
+CommunicationStatistics::recordSend(const int dst_rank, const double num_bytes, const int num_messages)
+{
+    if (!s_enabled) return;
+    const std::string& phase_name = getCurrentPhase();
+    Counters& counters = d_counters[phase_name];
+    counters.messages_sent += num_messages;
+    counters.bytes_sent += num_bytes;
+    std::pair<double, double>& neighbor = d_sends[phase_name][dst_rank];
+    neighbor.first += num_messages;
+    neighbor.second += num_bytes;
+    return;
+} // recordSend
+
+void
+CommunicationStatistics::recordReceive(const int src_rank, const double num_bytes, const int num_messages)
+{
+    if (!s_enabled) return;
+    const std::string& phase_name = getCurrentPhase();
+    Counters& counters = d_counters[phase_name];
+    counters.messages_received += num_messages;
+    counters.bytes_received += num_bytes;
+    std::pair<double, double>& neighbor = d_receives[phase_name][src_rank];
+    neighbor.first += num_messages;
+    neighbor.second += num_bytes;
+    return;
+} // recordReceive
+
+void
+CommunicationStatistics::recordCollective(const double num_bytes)
+{
+    if (!s_enabled) return;
+    Counters& counters = d_counters[getCurrentPhase()];
+    counters.collectives += 1.0;
+    counters.collective_bytes += num_bytes;
+    return;
+} // recordCollective
+
+void
+CommunicationStatistics::recordGhostUpdate(Vec vec, const ScatterMode scatter_mode)
+{
+    if (!s_enabled) return;
+
+    // The local form of a ghosted vector stores the owned entries followed by
+    // the ghost entries, and the local-to-global mapping of the vector provides
+    // the global indices of the ghost entries.
+    Vec local_form = nullptr;
+    int ierr = VecGhostGetLocalForm(vec, &local_form);
+    IBTK_CHKERRQ(ierr);
+    if (!local_form) return;
+    PetscInt local_form_size = 0, num_owned = 0;
+    ierr = VecGetSize(local_form, &local_form_size);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGhostRestoreLocalForm(vec, &local_form);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecGetLocalSize(vec, &num_owned);
+    IBTK_CHKERRQ(ierr);
+    if (local_form_size == num_owned) return;
+
+    ISLocalToGlobalMapping local_to_global;
+    ierr = VecGetLocalToGlobalMapping(vec, &local_to_global);
+    IBTK_CHKERRQ(ierr);
+    if (!local_to_global) return;
+    const PetscInt* global_indices = nullptr;
+    ierr = ISLocalToGlobalMappingGetIndices(local_to_global, &global_indices);
+    IBTK_CHKERRQ(ierr);
+    const PetscInt* ownership_ranges = nullptr;
+    ierr = VecGetOwnershipRanges(vec, &ownership_ranges);
+    IBTK_CHKERRQ(ierr);
+    const int num_procs = IBTK_MPI::getNodes();
+
+    std::map<int, double> num_entries;
+    for (PetscInt k = num_owned; k < local_form_size; ++k)
+    {
+        const int owner = static_cast<int>(
+            std::upper_bound(ownership_ranges, ownership_ranges + num_procs + 1, global_indices[k]) -
+            ownership_ranges - 1);
+        num_entries[owner] += 1.0;
+    }
+    ierr = ISLocalToGlobalMappingRestoreIndices(local_to_global, &global_indices);
+    IBTK_CHKERRQ(ierr);
+
+    for (const auto& neighbor : num_entries)
+    {
+        const double num_bytes = neighbor.second * sizeof(PetscScalar);
+        if (scatter_mode == SCATTER_REVERSE)
+        {
+            recordSend(neighbor.first, num_bytes);
+        }
+        else
+        {
+            recordReceive(neighbor.first, num_bytes);
+        }
+    }
+    return;
+} // recordGhostUpdate
+
+std::vector<std::string>
+CommunicationStatistics::getPhaseNames() const
+{
+    std::vector<std::string> phase_names;
+    for (const auto& phase : d_counters) phase_names.push_back(phase.first);
+    return phase_names;
+} // getPhaseNames
+
+CommunicationStatistics::Counters
+CommunicationStatistics::getCounters(const std::string& phase_name) const
+{
+    const auto it = d_counters.find(phase_name);
+    return it == d_counters.end() ? Counters() : it->second;
+} // getCounters
+
+void
+CommunicationStatistics::writeStatistics()
+{
+    // The communication done to write the statistics is not recorded.
+    const bool was_enabled = s_enabled;
+    s_enabled = false;
+    const int rank = IBTK_MPI::getRank();
+    const int num_procs = IBTK_MPI::getNodes();
+
+    // Reduce the counters of each phase.
+    const std::vector<std::string> phase_names = getGlobalPhaseNames();
+    static const int num_counters = 6;
+    const int num_vals = num_counters * static_cast<int>(phase_names.size());
+    std::vector<double> min_vals, max_vals, sum_vals;
+    min_vals.reserve(num_vals);
+    for (const auto& phase_name : phase_names)
+    {
+        const Counters counters = getCounters(phase_name);
+        min_vals.insert(min_vals.end(),
+                        { counters.messages_sent,
+                          counters.bytes_sent,
+                          counters.messages_received,
+                          counters.bytes_received,
+                          counters.collectives,
+                          counters.collective_bytes });
+    }
+    max_vals = min_vals;
+    sum_vals = min_vals;
+    IBTK_MPI::minReduction(min_vals.data(), num_vals);
+    IBTK_MPI::maxReduction(max_vals.data(), num_vals);
+    IBTK_MPI::sumReduction(sum_vals.data(), num_vals);
+    if (rank == 0)
+    {
+        static const std::array<std::string, num_counters> counter_names = {
+            "messages sent", "bytes sent", "messages received", "bytes received", "collectives", "collective bytes"
+        };
+        plog << "CommunicationStatistics::writeStatistics(): communication per process\n";
+        plog << std::setw(20) << std::left << "phase / counter" << std::right << std::setw(15) << "min"
+             << std::setw(15) << "max" << std::setw(15) << "mean\n";
+        for (unsigned int k = 0; k < phase_names.size(); ++k)
+        {
+            plog << phase_names[k] << "\n";
+            for (int c = 0; c < num_counters; ++c)
+            {
+                const int idx = num_counters * k + c;
+                plog << "  " << std::setw(18) << std::left << counter_names[c] << std::right << std::setw(15)
+                     << min_vals[idx] << std::setw(15) << max_vals[idx] << std::setw(15)
+                     << sum_vals[idx] / num_procs << "\n";
+            }
+        }
+        plog << std::left;
+    }
+
+    // Gather the neighbor communication of all processes on rank 0.
+    std::ostringstream local_rows;
+    for (const auto& phase : d_sends)
+    {
+        for (const auto& neighbor : phase.second)
+        {
+            local_rows << phase.first << "," << rank << "," << neighbor.first << "," << neighbor.second.first << ","
+                       << neighbor.second.second << ",src\n";
+        }
+    }
+    for (const auto& phase : d_receives)
+    {
+        for (const auto& neighbor : phase.second)
+        {
+            local_rows << phase.first << "," << neighbor.first << "," << rank << "," << neighbor.second.first << ","
+                       << neighbor.second.second << ",dst\n";
+        }
+    }
+    const std::string local_string = local_rows.str();
+    int local_size = static_cast<int>(local_string.size());
+    std::vector<int> sizes(num_procs), offsets(num_procs, 0);
+    MPI_Gather(&local_size, 1, MPI_INT, sizes.data(), 1, MPI_INT, 0, IBTK_MPI::getCommunicator());
+    for (int p = 1; p < num_procs; ++p) offsets[p] = offsets[p - 1] + sizes[p - 1];
+    std::vector<char> global_string(rank == 0 ? offsets.back() + sizes.back() : 0);
+    MPI_Gatherv(local_string.data(),
+                local_size,
+                MPI_CHAR,
+                global_string.data(),
+                sizes.data(),
+                offsets.data(),
+                MPI_CHAR,
+                0,
+                IBTK_MPI::getCommunicator());
+    if (rank == 0)
+    {
+        std::ofstream stream(d_file_name + ".csv");
+        stream << "phase,src,dst,messages,bytes,recorded_by\n";
+        stream.write(global_string.data(), global_string.size());
+    }
+
+    s_enabled = was_enabled;
+    return;
+} // writeStatistics
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+const std::string&
+CommunicationStatistics::getCurrentPhase() const
+{
+    return d_phase_stack.empty() ? unassigned_phase_name : d_phase_stack.back();
+} // getCurrentPhase
+
+std::vector<std::string>
+CommunicationStatistics::getGlobalPhaseNames() const
+{
+    // Gather the names of the phases of all processes as newline-separated
+    // strings.
+    std::string local_names;
+    for (const auto& phase : d_counters) local_names += phase.first + '\n';
+    const int local_size = static_cast<int>(local_names.size());
+    const int global_size = IBTK_MPI::sumReduction(local_size);
+    std::vector<char> global_names(global_size);
+    IBTK_MPI::allGather(local_names.data(), local_size, global_names.data(), global_size);
+
+    std::set<std::string> phase_names;
+    auto name_begin = global_names.begin();
+    while (name_begin != global_names.end())
+    {
+        const auto name_end = std::find(name_begin, global_names.end(), '\n');
+        phase_names.emplace(name_begin, name_end);
+        name_begin = name_end == global_names.end() ? name_end : name_end + 1;
+    }
+    return std::vector<std::string>(phase_names.begin(), phase_names.end());
+} // getGlobalPhaseNames
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
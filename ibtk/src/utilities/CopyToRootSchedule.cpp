@@ -17,12 +17,14 @@
 #include "ibtk/CopyToRootTransaction.h"
 #include "ibtk/IBTK_MPI.h"
 
+#include "Box.h"
 #include "BoxArray.h"
 #include "GridGeometry.h"
 #include "IntVector.h"
 #include "PatchData.h"
 #include "PatchDataFactory.h"
 #include "PatchDescriptor.h"
+#include "ProcessorMapping.h"
 #include "tbox/Pointer.h"
 #include "tbox/Schedule.h"
 #include "tbox/Transaction.h"
@@ -32,15 +34,6 @@
 
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
-namespace SAMRAI
-{
-namespace hier
-{
-template <int DIM>
-class Box;
-} // namespace hier
-} // namespace SAMRAI
-
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 namespace IBTK
@@ -67,6 +60,20 @@ CopyToRootSchedule::CopyToRootSchedule(const int root_proc,
     return;
 } // CopyToRootSchedule
 
+CopyToRootSchedule::CopyToRootSchedule(const int root_proc,
+                                       const Pointer<PatchLevel<NDIM> > patch_level,
+                                       std::vector<int> src_patch_data_idxs,
+                                       const Box<NDIM>& root_box)
+    : d_root_proc(root_proc),
+      d_patch_level(patch_level),
+      d_src_patch_data_idxs(std::move(src_patch_data_idxs)),
+      d_root_box(root_box),
+      d_use_root_box(true)
+{
+    commonClassCtor();
+    return;
+} // CopyToRootSchedule
+
 void
 CopyToRootSchedule::communicate()
 {
@@ -87,11 +94,14 @@ CopyToRootSchedule::getRootPatchData() const
 void
 CopyToRootSchedule::commonClassCtor()
 {
-    Pointer<GridGeometry<NDIM> > grid_geom = d_patch_level->getGridGeometry();
+    if (!d_use_root_box)
+    {
+        Pointer<GridGeometry<NDIM> > grid_geom = d_patch_level->getGridGeometry();
 #if !defined(NDEBUG)
-    TBOX_ASSERT(grid_geom->getDomainIsSingleBox());
+        TBOX_ASSERT(grid_geom->getDomainIsSingleBox());
 #endif
-    const Box<NDIM>& domain_box = grid_geom->getPhysicalDomain()[0];
+        d_root_box = grid_geom->getPhysicalDomain()[0];
+    }
 
     const size_t num_vars = d_src_patch_data_idxs.size();
 
@@ -102,17 +112,33 @@ CopyToRootSchedule::commonClassCtor()
         {
             Pointer<PatchDataFactory<NDIM> > pdat_factory =
                 d_patch_level->getPatchDescriptor()->getPatchDataFactory(d_src_patch_data_idxs[k]);
-            d_root_patch_data[k] = pdat_factory->allocate(domain_box);
+            d_root_patch_data[k] = pdat_factory->allocate(d_root_box);
         }
     }
 
+    // Only processes that own patches that touch the root box (grown by one
+    // cell to account for data that is not cell-centered) send data.
     const int mpi_nodes = IBTK_MPI::getNodes();
+    std::vector<bool> src_proc_has_data(mpi_nodes, !d_use_root_box);
+    if (d_use_root_box)
+    {
+        const BoxArray<NDIM>& boxes = d_patch_level->getBoxes();
+        const ProcessorMapping& mapping = d_patch_level->getProcessorMapping();
+        for (int p = 0; p < boxes.getNumberOfBoxes(); ++p)
+        {
+            if (!(Box<NDIM>::grow(boxes[p], 1) * d_root_box).empty())
+            {
+                src_proc_has_data[mapping.getProcessorAssignment(p)] = true;
+            }
+        }
+    }
     for (int src_proc = 0; src_proc < mpi_nodes; ++src_proc)
     {
+        if (!src_proc_has_data[src_proc]) continue;
         for (unsigned int k = 0; k < num_vars; ++k)
         {
             d_schedule.appendTransaction(new CopyToRootTransaction(
-                src_proc, d_root_proc, d_patch_level, d_src_patch_data_idxs[k], d_root_patch_data[k]));
+                src_proc, d_root_proc, d_patch_level, d_src_patch_data_idxs[k], d_root_patch_data[k], d_root_box));
         }
     }
     return;
@@ -15,6 +15,7 @@
 
 #include "ibtk/CopyToRootTransaction.h"
 
+#include "Box.h"
 #include "BoxArray.h"
 #include "BoxGeometry.h"
 #include "BoxOverlap.h"
@@ -28,18 +29,10 @@
 #include "tbox/Pointer.h"
 
 #include <ostream>
+#include <vector>
 
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
-namespace SAMRAI
-{
-namespace hier
-{
-template <int DIM>
-class Box;
-} // namespace hier
-} // namespace SAMRAI
-
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 namespace IBTK
@@ -58,6 +51,27 @@ CopyToRootTransaction::CopyToRootTransaction(const int src_proc,
       d_patch_level(patch_level),
       d_src_patch_data_idx(src_patch_data_idx),
       d_dst_patch_data(dst_patch_data)
+{
+    Pointer<GridGeometry<NDIM> > grid_geom = d_patch_level->getGridGeometry();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(grid_geom->getDomainIsSingleBox());
+#endif
+    d_dst_box = grid_geom->getPhysicalDomain()[0];
+    return;
+} // CopyToRootTransaction
+
+CopyToRootTransaction::CopyToRootTransaction(const int src_proc,
+                                             const int dst_proc,
+                                             Pointer<PatchLevel<NDIM> > patch_level,
+                                             const int src_patch_data_idx,
+                                             Pointer<PatchData<NDIM> > dst_patch_data,
+                                             const Box<NDIM>& dst_box)
+    : d_src_proc(src_proc),
+      d_dst_proc(dst_proc),
+      d_patch_level(patch_level),
+      d_src_patch_data_idx(src_patch_data_idx),
+      d_dst_patch_data(dst_patch_data),
+      d_dst_box(dst_box)
 {
     // intentionally blank
     return;
@@ -84,29 +98,14 @@ CopyToRootTransaction::computeIncomingMessageSize()
 int
 CopyToRootTransaction::computeOutgoingMessageSize()
 {
-    Pointer<PatchDataFactory<NDIM> > pdat_factory =
-        d_patch_level->getPatchDescriptor()->getPatchDataFactory(d_src_patch_data_idx);
-
-    Pointer<GridGeometry<NDIM> > grid_geom = d_patch_level->getGridGeometry();
-#if !defined(NDEBUG)
-    TBOX_ASSERT(grid_geom->getDomainIsSingleBox());
-#endif
-    const Box<NDIM>& dst_box = grid_geom->getPhysicalDomain()[0];
-    Pointer<BoxGeometry<NDIM> > dst_box_geometry = pdat_factory->getBoxGeometry(dst_box);
-
     int size = AbstractStream::sizeofInt();
     for (PatchLevel<NDIM>::Iterator p(d_patch_level); p; p++)
     {
         const int src_patch_num = p();
-        size += AbstractStream::sizeofInt();
         Pointer<Patch<NDIM> > patch = d_patch_level->getPatch(src_patch_num);
-        const Box<NDIM>& src_box = patch->getBox();
-        Pointer<BoxGeometry<NDIM> > src_box_geometry = pdat_factory->getBoxGeometry(src_box);
-        const Box<NDIM>& src_mask = dst_box;
-        const bool overwrite_interior = true;
-        const IntVector<NDIM> src_shift = 0;
-        Pointer<BoxOverlap<NDIM> > box_overlap =
-            dst_box_geometry->calculateOverlap(*src_box_geometry, src_mask, overwrite_interior, src_shift);
+        Pointer<BoxOverlap<NDIM> > box_overlap = computeOverlap(patch->getBox());
+        if (box_overlap->isOverlapEmpty()) continue;
+        size += AbstractStream::sizeofInt();
         size += patch->getPatchData(d_src_patch_data_idx)->getDataStreamSize(*box_overlap);
     }
     return size;
@@ -127,36 +126,26 @@ CopyToRootTransaction::getDestinationProcessor()
 void
 CopyToRootTransaction::packStream(AbstractStream& stream)
 {
-    Pointer<PatchDataFactory<NDIM> > pdat_factory =
-        d_patch_level->getPatchDescriptor()->getPatchDataFactory(d_src_patch_data_idx);
-
-    Pointer<GridGeometry<NDIM> > grid_geom = d_patch_level->getGridGeometry();
-#if !defined(NDEBUG)
-    TBOX_ASSERT(grid_geom->getDomainIsSingleBox());
-#endif
-    const Box<NDIM>& dst_box = grid_geom->getPhysicalDomain()[0];
-    Pointer<BoxGeometry<NDIM> > dst_box_geometry = pdat_factory->getBoxGeometry(dst_box);
-
-    int src_patch_count = 0;
+    // Only patches that overlap the destination box are sent.
+    std::vector<int> src_patch_nums;
+    std::vector<Pointer<BoxOverlap<NDIM> > > box_overlaps;
     for (PatchLevel<NDIM>::Iterator p(d_patch_level); p; p++)
     {
-        ++src_patch_count;
+        const int src_patch_num = p();
+        Pointer<BoxOverlap<NDIM> > box_overlap = computeOverlap(d_patch_level->getPatch(src_patch_num)->getBox());
+        if (box_overlap->isOverlapEmpty()) continue;
+        src_patch_nums.push_back(src_patch_num);
+        box_overlaps.push_back(box_overlap);
     }
+    const int src_patch_count = static_cast<int>(src_patch_nums.size());
     stream << src_patch_count;
 
-    for (PatchLevel<NDIM>::Iterator p(d_patch_level); p; p++)
+    for (int k = 0; k < src_patch_count; ++k)
     {
-        const int src_patch_num = p();
+        const int src_patch_num = src_patch_nums[k];
         stream << src_patch_num;
         Pointer<Patch<NDIM> > patch = d_patch_level->getPatch(src_patch_num);
-        const Box<NDIM>& src_box = patch->getBox();
-        Pointer<BoxGeometry<NDIM> > src_box_geometry = pdat_factory->getBoxGeometry(src_box);
-        const Box<NDIM>& src_mask = dst_box;
-        const bool overwrite_interior = true;
-        const IntVector<NDIM> src_shift = 0;
-        Pointer<BoxOverlap<NDIM> > box_overlap =
-            dst_box_geometry->calculateOverlap(*src_box_geometry, src_mask, overwrite_interior, src_shift);
-        patch->getPatchData(d_src_patch_data_idx)->packStream(stream, *box_overlap);
+        patch->getPatchData(d_src_patch_data_idx)->packStream(stream, *box_overlaps[k]);
     }
     return;
 } // packStream
@@ -164,16 +153,6 @@ CopyToRootTransaction::packStream(AbstractStream& stream)
 void
 CopyToRootTransaction::unpackStream(AbstractStream& stream)
 {
-    Pointer<PatchDataFactory<NDIM> > pdat_factory =
-        d_patch_level->getPatchDescriptor()->getPatchDataFactory(d_src_patch_data_idx);
-
-    Pointer<GridGeometry<NDIM> > grid_geom = d_patch_level->getGridGeometry();
-#if !defined(NDEBUG)
-    TBOX_ASSERT(grid_geom->getDomainIsSingleBox());
-#endif
-    const Box<NDIM>& dst_box = grid_geom->getPhysicalDomain()[0];
-    Pointer<BoxGeometry<NDIM> > dst_box_geometry = pdat_factory->getBoxGeometry(dst_box);
-
     int src_patch_count;
     stream >> src_patch_count;
     for (int p = 0; p < src_patch_count; ++p)
@@ -181,12 +160,7 @@ CopyToRootTransaction::unpackStream(AbstractStream& stream)
         int src_patch_num;
         stream >> src_patch_num;
         const Box<NDIM>& src_box = d_patch_level->getBoxes()[src_patch_num];
-        Pointer<BoxGeometry<NDIM> > src_box_geometry = pdat_factory->getBoxGeometry(src_box);
-        const Box<NDIM>& src_mask = dst_box;
-        const bool overwrite_interior = true;
-        const IntVector<NDIM> src_shift = 0;
-        Pointer<BoxOverlap<NDIM> > box_overlap =
-            dst_box_geometry->calculateOverlap(*src_box_geometry, src_mask, overwrite_interior, src_shift);
+        Pointer<BoxOverlap<NDIM> > box_overlap = computeOverlap(src_box);
         d_dst_patch_data->unpackStream(stream, *box_overlap);
     }
     return;
@@ -195,27 +169,12 @@ CopyToRootTransaction::unpackStream(AbstractStream& stream)
 void
 CopyToRootTransaction::copyLocalData()
 {
-    Pointer<PatchDataFactory<NDIM> > pdat_factory =
-        d_patch_level->getPatchDescriptor()->getPatchDataFactory(d_src_patch_data_idx);
-
-    Pointer<GridGeometry<NDIM> > grid_geom = d_patch_level->getGridGeometry();
-#if !defined(NDEBUG)
-    TBOX_ASSERT(grid_geom->getDomainIsSingleBox());
-#endif
-    const Box<NDIM>& dst_box = grid_geom->getPhysicalDomain()[0];
-    Pointer<BoxGeometry<NDIM> > dst_box_geometry = pdat_factory->getBoxGeometry(dst_box);
-
     for (PatchLevel<NDIM>::Iterator p(d_patch_level); p; p++)
     {
         int src_patch_num = p();
         Pointer<Patch<NDIM> > patch = d_patch_level->getPatch(src_patch_num);
-        const Box<NDIM>& src_box = patch->getBox();
-        Pointer<BoxGeometry<NDIM> > src_box_geometry = pdat_factory->getBoxGeometry(src_box);
-        const Box<NDIM>& src_mask = dst_box;
-        const bool overwrite_interior = true;
-        const IntVector<NDIM> src_shift = 0;
-        Pointer<BoxOverlap<NDIM> > box_overlap =
-            dst_box_geometry->calculateOverlap(*src_box_geometry, src_mask, overwrite_interior, src_shift);
+        Pointer<BoxOverlap<NDIM> > box_overlap = computeOverlap(patch->getBox());
+        if (box_overlap->isOverlapEmpty()) continue;
         d_dst_patch_data->copy(*patch->getPatchData(d_src_patch_data_idx), *box_overlap);
     }
     return;
@@ -232,6 +191,19 @@ CopyToRootTransaction::printClassData(std::ostream& stream) const
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+Pointer<BoxOverlap<NDIM> >
+CopyToRootTransaction::computeOverlap(const Box<NDIM>& src_box) const
+{
+    Pointer<PatchDataFactory<NDIM> > pdat_factory =
+        d_patch_level->getPatchDescriptor()->getPatchDataFactory(d_src_patch_data_idx);
+    Pointer<BoxGeometry<NDIM> > dst_box_geometry = pdat_factory->getBoxGeometry(d_dst_box);
+    Pointer<BoxGeometry<NDIM> > src_box_geometry = pdat_factory->getBoxGeometry(src_box);
+    const Box<NDIM>& src_mask = d_dst_box;
+    const bool overwrite_interior = true;
+    const IntVector<NDIM> src_shift = 0;
+    return dst_box_geometry->calculateOverlap(*src_box_geometry, src_mask, overwrite_interior, src_shift);
+} // computeOverlap
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
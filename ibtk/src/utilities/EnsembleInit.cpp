@@ -0,0 +1,280 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/EnsembleInit.h"
+#include "ibtk/IBTKInit.h"
+#include "ibtk/IBTK_MPI.h"
+
+#include "tbox/Array.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+#include <mpi.h>
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+EnsembleInit* EnsembleInit::s_instance = nullptr;
+
+namespace
+{
+// Copy all entries of src_db to dst_db, replacing existing entries except for
+// databases, which are merged.
+void
+merge_database(Pointer<Database> src_db, Pointer<Database> dst_db)
+{
+    const Array<std::string> keys = src_db->getAllKeys();
+    for (int k = 0; k < keys.getSize(); ++k)
+    {
+        const std::string& key = keys[k];
+        if (src_db->isDatabase(key))
+        {
+            Pointer<Database> sub_db = dst_db->isDatabase(key) ? dst_db->getDatabase(key) : dst_db->putDatabase(key);
+            merge_database(src_db->getDatabase(key), sub_db);
+        }
+        else if (src_db->isBool(key))
+        {
+            dst_db->putBoolArray(key, src_db->getBoolArray(key));
+        }
+        else if (src_db->isChar(key))
+        {
+            dst_db->putCharArray(key, src_db->getCharArray(key));
+        }
+        else if (src_db->isComplex(key))
+        {
+            dst_db->putComplexArray(key, src_db->getComplexArray(key));
+        }
+        else if (src_db->isDatabaseBox(key))
+        {
+            dst_db->putDatabaseBoxArray(key, src_db->getDatabaseBoxArray(key));
+        }
+        else if (src_db->isDouble(key))
+        {
+            dst_db->putDoubleArray(key, src_db->getDoubleArray(key));
+        }
+        else if (src_db->isFloat(key))
+        {
+            dst_db->putFloatArray(key, src_db->getFloatArray(key));
+        }
+        else if (src_db->isInteger(key))
+        {
+            dst_db->putIntegerArray(key, src_db->getIntegerArray(key));
+        }
+        else if (src_db->isString(key))
+        {
+            dst_db->putStringArray(key, src_db->getStringArray(key));
+        }
+    }
+    return;
+} // merge_database
+
+// Keys of the Main database that name output locations.
+static const char* const OUTPUT_NAME_KEYS[] = { "log_file_name",
+                                                "viz_dirname",
+                                                "viz_dump_dirname",
+                                                "viz_write_dirname",
+                                                "restart_dirname",
+                                                "restart_dump_dirname",
+                                                "restart_write_dirname",
+                                                "data_dirname",
+                                                "data_dump_dirname",
+                                                "data_write_dirname" };
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+EnsembleInit::EnsembleInit(int argc,
+                           char** argv,
+                           const int num_members,
+                           MPI_Comm world_communicator,
+                           char* petsc_file,
+                           char* petsc_help)
+    : d_world_communicator(world_communicator), d_num_members(num_members)
+{
+    if (s_instance) TBOX_ERROR("EnsembleInit::EnsembleInit(): an ensemble has already been initialized.\n");
+
+    // MPI must be running before the world communicator can be split.
+    int mpi_initialized = 0;
+    MPI_Initialized(&mpi_initialized);
+    if (!mpi_initialized)
+    {
+        MPI_Init(&argc, &argv);
+        d_finalize_mpi = true;
+    }
+
+    // Assign contiguous blocks of processes to the members so that the sizes
+    // of the members differ by at most one process.
+    const int world_rank = IBTK_MPI::getRank(d_world_communicator);
+    const int world_size = IBTK_MPI::getNodes(d_world_communicator);
+    if (d_num_members < 1 || d_num_members > world_size)
+    {
+        TBOX_ERROR("EnsembleInit::EnsembleInit(): the number of members ("
+                   << d_num_members << ") must be between 1 and the number of processes (" << world_size << ").\n");
+    }
+    d_member_number = static_cast<int>((static_cast<long>(world_rank) * d_num_members) / world_size);
+    MPI_Comm_split(d_world_communicator, d_member_number, world_rank, &d_member_communicator);
+
+    d_ibtk_init.reset(new IBTKInit(argc, argv, d_member_communicator, petsc_file, petsc_help));
+    s_instance = this;
+} // EnsembleInit
+
+EnsembleInit::~EnsembleInit()
+{
+    d_ibtk_init.reset();
+    MPI_Comm_free(&d_member_communicator);
+    if (d_finalize_mpi) MPI_Finalize();
+    s_instance = nullptr;
+} // ~EnsembleInit
+
+EnsembleInit*
+EnsembleInit::getInstance()
+{
+    return s_instance;
+} // getInstance
+
+int
+EnsembleInit::getNumberOfMembers() const
+{
+    return d_num_members;
+} // getNumberOfMembers
+
+int
+EnsembleInit::getMemberNumber() const
+{
+    return d_member_number;
+} // getMemberNumber
+
+std::string
+EnsembleInit::getMemberSuffix() const
+{
+    return "member_" + std::to_string(d_member_number);
+} // getMemberSuffix
+
+MPI_Comm
+EnsembleInit::getWorldCommunicator() const
+{
+    return d_world_communicator;
+} // getWorldCommunicator
+
+MPI_Comm
+EnsembleInit::getMemberCommunicator() const
+{
+    return d_member_communicator;
+} // getMemberCommunicator
+
+IBTKInit&
+EnsembleInit::getIBTKInit()
+{
+    return *d_ibtk_init;
+} // getIBTKInit
+
+void
+EnsembleInit::applyMemberOverrides(Pointer<Database> input_db) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(input_db);
+#endif
+    const std::string member_suffix = getMemberSuffix();
+    if (input_db->isDatabase("Ensemble"))
+    {
+        Pointer<Database> ensemble_db = input_db->getDatabase("Ensemble");
+        if (ensemble_db->isDatabase(member_suffix)) merge_database(ensemble_db->getDatabase(member_suffix), input_db);
+    }
+    if (input_db->isDatabase("Main"))
+    {
+        Pointer<Database> main_db = input_db->getDatabase("Main");
+        for (const char* const key : OUTPUT_NAME_KEYS)
+        {
+            if (main_db->isString(key))
+            {
+                const std::string name = main_db->getString(key);
+                if (!name.empty()) main_db->putString(key, name + "." + member_suffix);
+            }
+        }
+    }
+    return;
+} // applyMemberOverrides
+
+std::string
+EnsembleInit::readSharedFile(const std::string& file_name) const
+{
+    std::string contents;
+    int length = 0;
+    if (IBTK_MPI::getRank(d_world_communicator) == 0)
+    {
+        std::ifstream file(file_name);
+        if (!file)
+        {
+            TBOX_ERROR("EnsembleInit::readSharedFile(): unable to open file `" << file_name << "'.\n");
+        }
+        contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        length = static_cast<int>(contents.size());
+    }
+    length = IBTK_MPI::bcast(length, 0, d_world_communicator);
+    contents.resize(length);
+    if (length > 0) IBTK_MPI::bcast(&contents[0], length, 0, d_world_communicator);
+    return contents;
+} // readSharedFile
+
+std::vector<std::string>
+EnsembleInit::gatherMemberOutput(const std::string& output) const
+{
+    // Only the first process of each member contributes its output.
+    const int world_size = IBTK_MPI::getNodes(d_world_communicator);
+    const bool is_member_root = IBTK_MPI::getRank(d_member_communicator) == 0;
+    const std::string local_output = is_member_root ? output : std::string();
+    std::vector<int> lengths(world_size), members(world_size);
+    IBTK_MPI::allGather(static_cast<int>(local_output.size()), lengths.data(), d_world_communicator);
+    IBTK_MPI::allGather(is_member_root ? d_member_number : -1, members.data(), d_world_communicator);
+    int total_length = 0;
+    for (const int length : lengths) total_length += length;
+    std::vector<char> buffer(total_length + 1);
+    IBTK_MPI::allGather(local_output.c_str(),
+                        static_cast<int>(local_output.size()),
+                        buffer.data(),
+                        total_length,
+                        d_world_communicator);
+
+    std::vector<std::string> member_outputs(d_num_members);
+    int offset = 0;
+    for (int rank = 0; rank < world_size; ++rank)
+    {
+        if (members[rank] >= 0) member_outputs[members[rank]].assign(buffer.data() + offset, lengths[rank]);
+        offset += lengths[rank];
+    }
+    return member_outputs;
+} // gatherMemberOutput
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
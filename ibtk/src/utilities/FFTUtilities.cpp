@@ -0,0 +1,315 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/FFTUtilities.h"
+#include "ibtk/IBTK_MPI.h"
+
+#include "Box.h"
+#include "BoxArray.h"
+#include "CellData.h"
+#include "CellIndex.h"
+#include "GridGeometry.h"
+#include "Index.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchLevel.h"
+#include "SideData.h"
+#include "SideGeometry.h"
+#include "SideIndex.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <utility>
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+using Complex = std::complex<double>;
+
+/*!
+ * Return the twiddle factors exp(+/- 2 pi i j / m), j = 0, ..., m/2 - 1.
+ */
+std::vector<Complex>
+compute_twiddles(const int m, const bool inverse)
+{
+    std::vector<Complex> twiddles(m / 2);
+    const double sign = inverse ? 1.0 : -1.0;
+    for (int j = 0; j < m / 2; ++j) twiddles[j] = std::polar(1.0, sign * 2.0 * M_PI * j / m);
+    return twiddles;
+} // compute_twiddles
+
+/*!
+ * Compute the unscaled transform of the m = 2^p values in a in place.
+ */
+void
+radix2_transform(Complex* const a, const int m, const std::vector<Complex>& twiddles)
+{
+    for (int i = 1, j = 0; i < m; ++i)
+    {
+        int bit = m >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) std::swap(a[i], a[j]);
+    }
+    for (int len = 2; len <= m; len <<= 1)
+    {
+        const int half_len = len / 2, step = m / len;
+        for (int i = 0; i < m; i += len)
+        {
+            for (int k = 0; k < half_len; ++k)
+            {
+                const Complex u = a[i + k], v = a[i + k + half_len] * twiddles[k * step];
+                a[i + k] = u + v;
+                a[i + k + half_len] = u - v;
+            }
+        }
+    }
+    return;
+} // radix2_transform
+
+/*!
+ * Precomputed data for transforms of a fixed length n.  Lengths that are not
+ * powers of two are handled by Bluestein's algorithm, which expresses the
+ * transform as a circular convolution of length m >= 2 n - 1, m = 2^p.
+ */
+class FFTPlan
+{
+public:
+    FFTPlan(const int n, const bool inverse) : d_n(n), d_m(1), d_inverse(inverse)
+    {
+        while (d_m < d_n) d_m *= 2;
+        if (d_m == d_n)
+        {
+            d_twiddles = compute_twiddles(d_m, d_inverse);
+            d_work.resize(d_m);
+            return;
+        }
+        while (d_m < 2 * d_n - 1) d_m *= 2;
+        d_twiddles = compute_twiddles(d_m, /*inverse*/ false);
+        d_inverse_twiddles = compute_twiddles(d_m, /*inverse*/ true);
+
+        // The chirp is exp(-/+ pi i k^2 / n).  The exponent is reduced modulo
+        // 2 n to avoid losing accuracy for large k.
+        const double sign = d_inverse ? 1.0 : -1.0;
+        d_chirp.resize(d_n);
+        for (int k = 0; k < d_n; ++k)
+        {
+            const long long k_sq = (static_cast<long long>(k) * k) % (2 * d_n);
+            d_chirp[k] = std::polar(1.0, sign * M_PI * static_cast<double>(k_sq) / d_n);
+        }
+        d_chirp_hat.assign(d_m, Complex(0.0));
+        d_chirp_hat[0] = std::conj(d_chirp[0]);
+        for (int k = 1; k < d_n; ++k) d_chirp_hat[k] = d_chirp_hat[d_m - k] = std::conj(d_chirp[k]);
+        radix2_transform(d_chirp_hat.data(), d_m, d_twiddles);
+        d_work.resize(d_m);
+        return;
+    } // FFTPlan
+
+    /*!
+     * Transform the n values data[0], data[stride], ..., data[(n-1)*stride].
+     */
+    void execute(Complex* const data, const int stride)
+    {
+        const double scale = d_inverse ? 1.0 / d_n : 1.0;
+        if (d_chirp.empty())
+        {
+            for (int k = 0; k < d_n; ++k) d_work[k] = data[k * stride];
+            radix2_transform(d_work.data(), d_m, d_twiddles);
+            for (int k = 0; k < d_n; ++k) data[k * stride] = scale * d_work[k];
+            return;
+        }
+        for (int k = 0; k < d_n; ++k) d_work[k] = data[k * stride] * d_chirp[k];
+        std::fill(d_work.begin() + d_n, d_work.end(), Complex(0.0));
+        radix2_transform(d_work.data(), d_m, d_twiddles);
+        for (int k = 0; k < d_m; ++k) d_work[k] *= d_chirp_hat[k];
+        radix2_transform(d_work.data(), d_m, d_inverse_twiddles);
+        const double conv_scale = scale / d_m;
+        for (int k = 0; k < d_n; ++k) data[k * stride] = conv_scale * d_work[k] * d_chirp[k];
+        return;
+    } // execute
+
+private:
+    int d_n, d_m;
+    bool d_inverse;
+    std::vector<Complex> d_twiddles, d_inverse_twiddles, d_chirp, d_chirp_hat, d_work;
+};
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+FFTUtilities::transform(std::vector<std::complex<double> >& data, const bool inverse)
+{
+    if (data.empty()) return;
+    FFTPlan plan(static_cast<int>(data.size()), inverse);
+    plan.execute(data.data(), 1);
+    return;
+} // transform
+
+void
+FFTUtilities::transform(std::vector<std::complex<double> >& data,
+                        const IntVector<NDIM>& num_cells,
+                        const bool inverse)
+{
+    const int size = static_cast<int>(data.size());
+#if !defined(NDEBUG)
+    int num_entries = 1;
+    for (unsigned int d = 0; d < NDIM; ++d) num_entries *= num_cells(d);
+    TBOX_ASSERT(num_entries == size);
+#endif
+    if (size == 0) return;
+
+    // Transform all lines of values in each coordinate direction in turn.
+    int stride = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const int n = num_cells(d);
+        if (n > 1)
+        {
+            FFTPlan plan(n, inverse);
+            for (int outer = 0; outer < size; outer += stride * n)
+            {
+                for (int inner = 0; inner < stride; ++inner) plan.execute(data.data() + outer + inner, stride);
+            }
+        }
+        stride *= n;
+    }
+    return;
+} // transform
+
+void
+FFTUtilities::gatherCellData(std::vector<double>& values,
+                             const int data_idx,
+                             const int depth,
+                             Pointer<PatchLevel<NDIM> > level,
+                             const Box<NDIM>& domain_box)
+{
+    values.assign(domain_box.size(), 0.0);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > data = patch->getPatchData(data_idx);
+        for (Box<NDIM>::Iterator b(patch->getBox()); b; b++)
+        {
+            const hier::Index<NDIM>& i = b();
+            values[domain_box.offset(i)] = (*data)(CellIndex<NDIM>(i), depth);
+        }
+    }
+    IBTK_MPI::sumReduction(values.data(), static_cast<int>(values.size()));
+    return;
+} // gatherCellData
+
+void
+FFTUtilities::scatterCellData(const int data_idx,
+                              const int depth,
+                              Pointer<PatchLevel<NDIM> > level,
+                              const Box<NDIM>& domain_box,
+                              const std::vector<double>& values)
+{
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > data = patch->getPatchData(data_idx);
+        for (Box<NDIM>::Iterator b(patch->getBox()); b; b++)
+        {
+            const hier::Index<NDIM>& i = b();
+            (*data)(CellIndex<NDIM>(i), depth) = values[domain_box.offset(i)];
+        }
+    }
+    return;
+} // scatterCellData
+
+void
+FFTUtilities::gatherSideData(std::vector<double>& values,
+                             const int data_idx,
+                             const int axis,
+                             Pointer<PatchLevel<NDIM> > level,
+                             const Box<NDIM>& domain_box)
+{
+    values.assign(domain_box.size(), 0.0);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<SideData<NDIM, double> > data = patch->getPatchData(data_idx);
+        for (Box<NDIM>::Iterator b(patch->getBox()); b; b++)
+        {
+            const hier::Index<NDIM>& i = b();
+            values[domain_box.offset(i)] = (*data)(SideIndex<NDIM>(i, axis, SideIndex<NDIM>::Lower));
+        }
+    }
+    IBTK_MPI::sumReduction(values.data(), static_cast<int>(values.size()));
+    return;
+} // gatherSideData
+
+void
+FFTUtilities::scatterSideData(const int data_idx,
+                              const int axis,
+                              Pointer<PatchLevel<NDIM> > level,
+                              const Box<NDIM>& domain_box,
+                              const std::vector<double>& values)
+{
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<SideData<NDIM, double> > data = patch->getPatchData(data_idx);
+        for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch->getBox(), axis)); b; b++)
+        {
+            // The faces on the upper side of the domain are the periodic
+            // images of the faces on its lower side.
+            hier::Index<NDIM> i = b();
+            const SideIndex<NDIM> s_i(i, axis, SideIndex<NDIM>::Lower);
+            if (i(axis) > domain_box.upper(axis)) i(axis) = domain_box.lower(axis);
+            (*data)(s_i) = values[domain_box.offset(i)];
+        }
+    }
+    return;
+} // scatterSideData
+
+Box<NDIM>
+FFTUtilities::getPeriodicDomainBox(Pointer<PatchLevel<NDIM> > level)
+{
+    const BoxArray<NDIM>& physical_domain = level->getPhysicalDomain();
+    if (physical_domain.size() != 1) return Box<NDIM>();
+    Pointer<GridGeometry<NDIM> > grid_geom = level->getGridGeometry();
+    const IntVector<NDIM> periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (periodic_shift(d) == 0) return Box<NDIM>();
+    }
+    const Box<NDIM>& domain_box = physical_domain[0];
+    const BoxArray<NDIM>& boxes = level->getBoxes();
+    int num_level_cells = 0;
+    for (int k = 0; k < boxes.size(); ++k) num_level_cells += (boxes[k] * domain_box).size();
+    return num_level_cells == domain_box.size() ? domain_box : Box<NDIM>();
+} // getPeriodicDomainBox
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -17,12 +17,21 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/InSituAnalysisStrategy.h"
+#include "ibtk/LevelArena.h"
+#include "ibtk/MemoryStatistics.h"
+#include "ibtk/ReductionBatch.h"
 #include "ibtk/RefinePatchStrategySet.h"
+#include "ibtk/SpaceFillingCurveLoadBalancer.h"
+#include "ibtk/TelemetryManager.h"
+#include "ibtk/TimeStepSizeController.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "BasePatchHierarchy.h"
 #include "Box.h"
+#include "BoxArray.h"
 #include "CartesianGridGeometry.h"
 #include "CellData.h"
 #include "CellVariable.h"
@@ -32,14 +41,22 @@
 #include "CoarsenSchedule.h"
 #include "ComponentSelector.h"
 #include "EdgeData.h"
+#include "EdgeVariable.h"
 #include "FaceData.h"
+#include "FaceVariable.h"
 #include "GriddingAlgorithm.h"
 #include "HierarchyCellDataOpsReal.h"
+#include "HierarchyDataOpsManager.h"
+#include "HierarchyDataOpsReal.h"
+#include "IntVector.h"
 #include "LoadBalancer.h"
 #include "MultiblockDataTranslator.h"
 #include "NodeData.h"
+#include "NodeVariable.h"
 #include "Patch.h"
 #include "PatchData.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "RefineAlgorithm.h"
@@ -47,6 +64,7 @@
 #include "RefinePatchStrategy.h"
 #include "RefineSchedule.h"
 #include "SideData.h"
+#include "SideVariable.h"
 #include "TagAndInitializeStrategy.h"
 #include "Variable.h"
 #include "VariableContext.h"
@@ -61,13 +79,20 @@
 #include "tbox/Utilities.h"
 
 #include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
 #include <deque>
+#include <fstream>
+#include <iomanip>
 #include <limits>
 #include <list>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <set>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -84,6 +109,11 @@ namespace
 {
 // Version of HierarchyIntegrator restart file data.
 static const int HIERARCHY_INTEGRATOR_VERSION = 1;
+
+// Nesting depth of calls to getMaximumTimeStepSize(). The time step sizes
+// computed by nested calls are only reduced across processes by the outermost
+// call.
+static int s_max_time_step_size_depth = 0;
 } // namespace
 
 const std::string HierarchyIntegrator::SYNCH_CURRENT_DATA_ALG = "SYNCH_CURRENT_DATA";
@@ -135,6 +165,7 @@ HierarchyIntegrator::~HierarchyIntegrator()
         RestartManager::getManager()->unregisterRestartItem(d_object_name);
         d_registered_for_restart = false;
     }
+    if (MemoryStatistics::enabled()) MemoryStatistics::getManager()->removeUsage("patch_data", this);
     return;
 } // ~HierarchyIntegrator
 
@@ -189,16 +220,26 @@ HierarchyIntegrator::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hie
     }
     else
     {
+        // When the initial hierarchy is generated from a cache, the cached boxes
+        // already include the tag buffer.
         const bool initial_time = true;
+        d_using_initial_hierarchy_cache = !d_initial_hierarchy_cache_file_name.empty() && readInitialHierarchyCache();
         d_gridding_alg->makeCoarsestLevel(d_hierarchy, d_start_time);
         int level_number = 0;
         bool done = false;
         while (!done && (d_gridding_alg->levelCanBeRefined(level_number)))
         {
-            d_gridding_alg->makeFinerLevel(d_hierarchy, d_integrator_time, initial_time, d_tag_buffer[level_number]);
+            const int tag_buffer = d_using_initial_hierarchy_cache ? 0 : d_tag_buffer[level_number];
+            d_gridding_alg->makeFinerLevel(d_hierarchy, d_integrator_time, initial_time, tag_buffer);
             done = !d_hierarchy->finerLevelExists(level_number);
             ++level_number;
         }
+        if (!d_initial_hierarchy_cache_file_name.empty() && !d_using_initial_hierarchy_cache)
+        {
+            writeInitialHierarchyCache();
+        }
+        d_using_initial_hierarchy_cache = false;
+        d_initial_hierarchy_cache_tag_boxes.clear();
 
         // Initialize composite hierarchy data that was not initailized by
         // gridding algorithm's call to initializeLevelData().
@@ -218,11 +259,41 @@ HierarchyIntegrator::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hie
         hier_integrators.insert(
             hier_integrators.end(), integrator->d_child_integrators.begin(), integrator->d_child_integrators.end());
     }
+    if (MemoryStatistics::enabled()) updateMemoryUsage();
     return;
 } // initializePatchHierarchy
 
 void
-HierarchyIntegrator::advanceHierarchy(double dt)
+HierarchyIntegrator::advanceHierarchy(const double dt)
+{
+    // Repeat failed time steps with smaller time step sizes if rollback is
+    // enabled.
+    d_num_rollback_retries = 0;
+    double step_dt = dt;
+    while (true)
+    {
+        const double step_cost = takeTimeStep(step_dt);
+        if (d_num_rollback_retries == 0) d_rollback_base_dt = step_dt;
+        if (d_parent_integrator || d_rollback_depth == 0 || !stepFailed())
+        {
+            // Only successful time steps update the time step size controller.
+            if (d_dt_controller) d_dt_controller->recordTimeStep(step_dt, step_cost);
+            break;
+        }
+        step_dt = rollBack();
+    }
+    d_num_rollback_retries = 0;
+
+    // Execute the in-situ analyses on the updated data.
+    if (!d_parent_integrator) executeInSituAnalyses();
+
+    // Record the performance metrics of the time step.
+    if (!d_parent_integrator) TelemetryManager::getManager()->recordStep(d_integrator_step, d_integrator_time);
+    return;
+} // advanceHierarchy
+
+double
+HierarchyIntegrator::takeTimeStep(double& dt)
 {
     const double dt_min = getMinimumTimeStepSize();
     const double dt_max = getMaximumTimeStepSize();
@@ -267,11 +338,24 @@ HierarchyIntegrator::advanceHierarchy(double dt)
         if (d_enable_logging)
             plog << d_object_name << "::advanceHierarchy(): regridding prior to timestep " << d_integrator_step << "\n";
         d_regridding_hierarchy = true;
-        regridHierarchy();
+        {
+            TelemetryManager::ScopedPhase regrid_phase("regrid");
+            regridHierarchy();
+        }
         d_regridding_hierarchy = false;
         d_at_regrid_time_step = true;
+
+        // Saved states are defined on the old patch hierarchy.
+        if (!d_parent_integrator) clearRollbackStates();
     }
 
+    // Save the state required to repeat the time step.
+    if (!d_parent_integrator && d_rollback_depth > 0) saveRollbackState();
+
+    // The cost of the regrid is not included in the measured cost of the time
+    // step.
+    const auto step_start = std::chrono::steady_clock::now();
+
     // Determine the number of cycles and the time step size.
     d_current_num_cycles = getNumberOfCycles();
     d_current_dt = new_time - current_time;
@@ -281,6 +365,10 @@ HierarchyIntegrator::advanceHierarchy(double dt)
     // parent and child integrators.
     preprocessIntegrateHierarchy(current_time, new_time, d_current_num_cycles);
 
+    // The new and scratch data are typically allocated by the preprocessing
+    // methods, so this is where the patch data memory usage is largest.
+    if (MemoryStatistics::enabled()) updateMemoryUsage();
+
     // Perform one or more cycles.  In each cycle, execute the integration
     // method of the parent integrator, and recursively execute all integration
     // callbacks registered with the parent and child integrators.
@@ -325,8 +413,10 @@ HierarchyIntegrator::advanceHierarchy(double dt)
 
     // Reset the regrid indicator.
     d_at_regrid_time_step = false;
-    return;
-} // advanceHierarchy
+
+    const auto step_end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(step_end - step_start).count();
+} // takeTimeStep
 
 double
 HierarchyIntegrator::getMinimumTimeStepSize()
@@ -342,12 +432,23 @@ HierarchyIntegrator::getMinimumTimeStepSize()
 double
 HierarchyIntegrator::getMaximumTimeStepSize()
 {
+    ++s_max_time_step_size_depth;
     double dt = getMaximumTimeStepSizeSpecialized();
     for (const auto& child_integrator : d_child_integrators)
     {
         dt = std::min(dt, child_integrator->getMaximumTimeStepSize());
     }
-    return std::min(dt, d_end_time - d_integrator_time);
+    if (d_dt_controller)
+    {
+        dt = std::max(d_dt_controller->getTimeStepSizeScaleFactor() * dt, std::min(dt, getMinimumTimeStepSize()));
+    }
+    dt = std::min(dt, d_end_time - d_integrator_time);
+    --s_max_time_step_size_depth;
+
+    // The operations above are nondecreasing in the local time step sizes, so
+    // a single reduction of the final value is equivalent to reducing each of
+    // the intermediate values.
+    return minReduceTimeStepSize(dt);
 } // getMaximumTimeStepSize
 
 void
@@ -404,6 +505,14 @@ HierarchyIntegrator::regridHierarchy()
         child_integrator->regridHierarchyBeginSpecialized();
     }
 
+    // Keep track of the current patch levels so that levels that are not
+    // replaced by the gridding algorithm can be detected.
+    d_regrid_old_levels.resize(d_hierarchy->getFinestLevelNumber() + 1);
+    for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        d_regrid_old_levels[ln] = d_hierarchy->getPatchLevel(ln);
+    }
+
     // Regrid the hierarchy.
     switch (d_regrid_mode)
     {
@@ -421,6 +530,7 @@ HierarchyIntegrator::regridHierarchy()
                                  << "  unrecognized regrid mode: " << enum_to_string<RegridMode>(d_regrid_mode) << "."
                                  << std::endl);
     }
+    d_regrid_old_levels.clear();
 
     const double new_volume = check_volume_change ? d_hier_math_ops->getVolumeOfPhysicalDomain() : 0.0;
 
@@ -449,6 +559,19 @@ HierarchyIntegrator::regridHierarchy()
 
     // Synchronize the state data on the patch hierarchy.
     synchronizeHierarchyData(CURRENT_DATA);
+
+    // Report the memory usage after regridding.
+    if (MemoryStatistics::enabled())
+    {
+        updateMemoryUsage();
+        MemoryStatistics* memory_statistics = MemoryStatistics::getManager();
+        if (!d_parent_integrator && memory_statistics->getPrintAtRegrid())
+        {
+            std::ostringstream label;
+            label << "after regrid at time " << d_integrator_time;
+            memory_statistics->printStatistics(label.str(), plog);
+        }
+    }
     return;
 } // regridHierarchy
 
@@ -542,7 +665,11 @@ HierarchyIntegrator::registerLoadBalancer(Pointer<LoadBalancer<NDIM> > load_bala
         d_workload_var = new CellVariable<NDIM, double>(d_object_name + "::workload");
         registerVariable(d_workload_idx, d_workload_var, 0, getCurrentContext());
     }
-    d_load_balancer->setWorkloadPatchDataIndex(d_workload_idx);
+    Pointer<SpaceFillingCurveLoadBalancer> sfc_load_balancer = d_load_balancer;
+    if (sfc_load_balancer)
+        sfc_load_balancer->setWorkloadPatchDataIndex(d_workload_idx);
+    else
+        d_load_balancer->setWorkloadPatchDataIndex(d_workload_idx);
     return;
 } // registerLoadBalancer
 
@@ -556,6 +683,43 @@ HierarchyIntegrator::getWorkloadDataIndex() const
     return d_workload_idx;
 }
 
+void
+HierarchyIntegrator::printPatchDataMemoryUsage(std::ostream& os) const
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<PatchDescriptor<NDIM> > patch_descriptor = var_db->getPatchDescriptor();
+    std::vector<int> idxs;
+    std::vector<double> local_bytes;
+    getLocalPatchDataMemoryUsage(idxs, local_bytes);
+
+    // Do all of the reductions at once instead of one per variable.
+    std::vector<double> total_bytes(local_bytes), max_bytes(local_bytes);
+    double max_total_local = std::accumulate(local_bytes.begin(), local_bytes.end(), 0.0);
+    ReductionBatch batch;
+    for (std::size_t k = 0; k < idxs.size(); ++k)
+    {
+        batch.addSum(&total_bytes[k]);
+        batch.addMax(&max_bytes[k]);
+    }
+    batch.addMax(&max_total_local);
+    batch.finish();
+
+    static const double MB = 1024.0 * 1024.0;
+    double total = 0.0;
+    os << d_object_name << "::printPatchDataMemoryUsage():\n"
+       << "  patch data memory usage in MB (total over all processors, maximum on one processor):\n";
+    for (std::size_t k = 0; k < idxs.size(); ++k)
+    {
+        if (total_bytes[k] == 0.0) continue;
+        os << "  " << std::setw(48) << std::left << patch_descriptor->mapIndexToName(idxs[k]) << std::right
+           << std::setw(12) << total_bytes[k] / MB << std::setw(12) << max_bytes[k] / MB << "\n";
+        total += total_bytes[k];
+    }
+    os << "  " << std::setw(48) << std::left << "total" << std::right << std::setw(12) << total / MB
+       << std::setw(12) << max_total_local / MB << "\n";
+    return;
+} // printPatchDataMemoryUsage
+
 void
 HierarchyIntegrator::registerVisItDataWriter(Pointer<VisItDataWriter<NDIM> > visit_writer)
 {
@@ -704,6 +868,15 @@ HierarchyIntegrator::registerApplyGradientDetectorCallback(ApplyGradientDetector
     return;
 } // registerApplyGradientDetectorCallback
 
+void
+HierarchyIntegrator::registerApplyGradientDetectorPatchCallback(ApplyGradientDetectorPatchCallbackFcnPtr callback,
+                                                                void* ctx)
+{
+    d_apply_gradient_detector_patch_callbacks.push_back(callback);
+    d_apply_gradient_detector_patch_callback_ctxs.push_back(ctx);
+    return;
+} // registerApplyGradientDetectorPatchCallback
+
 void
 HierarchyIntegrator::registerRegridHierarchyCallback(RegridHierarchyCallbackFcnPtr callback, void* ctx)
 {
@@ -711,6 +884,24 @@ HierarchyIntegrator::registerRegridHierarchyCallback(RegridHierarchyCallbackFcnP
     d_regrid_hierarchy_callback_ctxs.push_back(ctx);
 }
 
+void
+HierarchyIntegrator::indicateStepFailure(const std::string& reason)
+{
+    d_step_failure_indicated = true;
+    d_step_failure_reason = reason;
+    return;
+} // indicateStepFailure
+
+void
+HierarchyIntegrator::registerInSituAnalysis(Pointer<InSituAnalysisStrategy> analysis)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(analysis);
+#endif
+    d_in_situ_analyses.push_back(analysis);
+    return;
+} // registerInSituAnalysis
+
 void
 HierarchyIntegrator::initializeCompositeHierarchyData(double init_data_time, bool initial_time)
 {
@@ -753,7 +944,7 @@ HierarchyIntegrator::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM>
     Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
     if (allocate_data)
     {
-        level->allocatePatchData(d_current_data, init_data_time);
+        allocateLevelPatchData(level, d_current_data, init_data_time);
     }
     else
     {
@@ -763,7 +954,7 @@ HierarchyIntegrator::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM>
     // Fill data from coarser levels in AMR hierarchy.
     if (!initial_time && (level_number > 0 || old_level))
     {
-        level->allocatePatchData(d_scratch_data, init_data_time);
+        allocateLevelPatchData(level, d_scratch_data, init_data_time);
         std::vector<RefinePatchStrategy<NDIM>*> fill_after_regrid_prolong_patch_strategies;
         CartExtrapPhysBdryOp fill_after_regrid_extrap_bc_op(d_fill_after_regrid_bc_idxs, d_bdry_extrap_type);
         fill_after_regrid_prolong_patch_strategies.push_back(&fill_after_regrid_extrap_bc_op);
@@ -832,9 +1023,10 @@ HierarchyIntegrator::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM>
 
 void
 HierarchyIntegrator::resetHierarchyConfiguration(const Pointer<BasePatchHierarchy<NDIM> > base_hierarchy,
-                                                 const int coarsest_level,
+                                                 const int coarsest_level_in,
                                                  const int finest_level)
 {
+    int coarsest_level = coarsest_level_in;
     const Pointer<PatchHierarchy<NDIM> > hierarchy = base_hierarchy;
 #if !defined(NDEBUG)
     TBOX_ASSERT(hierarchy);
@@ -847,6 +1039,30 @@ HierarchyIntegrator::resetHierarchyConfiguration(const Pointer<BasePatchHierarch
 #endif
     const int finest_hier_level = hierarchy->getFinestLevelNumber();
 
+    // During regridding, skip levels that were not replaced by the gridding
+    // algorithm: their communication schedules are still valid.
+    if (!d_regrid_old_levels.empty())
+    {
+        const int num_old_levels = static_cast<int>(d_regrid_old_levels.size());
+        while (coarsest_level <= finest_level && coarsest_level < num_old_levels &&
+               hierarchy->getPatchLevel(coarsest_level).getPointer() ==
+                   d_regrid_old_levels[coarsest_level].getPointer())
+        {
+            ++coarsest_level;
+        }
+        const bool num_levels_changed = num_old_levels != finest_hier_level + 1;
+        d_regrid_old_levels.resize(finest_hier_level + 1);
+        for (int ln = 0; ln <= finest_hier_level; ++ln)
+        {
+            d_regrid_old_levels[ln] = hierarchy->getPatchLevel(ln);
+        }
+        if (coarsest_level > finest_level)
+        {
+            if (!num_levels_changed) return;
+            coarsest_level = finest_level;
+        }
+    }
+
     // Initialize or reset the hierarchy math operations object.
     d_hier_math_ops = buildHierarchyMathOps(hierarchy);
     if (d_manage_hier_math_ops)
@@ -935,14 +1151,43 @@ HierarchyIntegrator::applyGradientDetector(const Pointer<BasePatchHierarchy<NDIM
 #endif
     Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
 
-    // First untag all cells.
+    // When the initial hierarchy is generated from a cache, tag exactly the
+    // cells covered by the cached boxes of the next finer level.
+    if (d_using_initial_hierarchy_cache && initial_time)
+    {
+        const bool has_tag_boxes = level_number + 1 < static_cast<int>(d_initial_hierarchy_cache_tag_boxes.size());
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, int> > tags_data = patch->getPatchData(tag_index);
+            tags_data->fillAll(0);
+            if (!has_tag_boxes) continue;
+            const BoxArray<NDIM>& tag_boxes = d_initial_hierarchy_cache_tag_boxes[level_number + 1];
+            for (int i = 0; i < tag_boxes.getNumberOfBoxes(); ++i)
+            {
+                const Box<NDIM> tag_box = tag_boxes[i] * patch->getBox();
+                if (!tag_box.empty()) tags_data->fillAll(1, tag_box);
+            }
+        }
+        return;
+    }
+
+    // First untag all cells and then apply the patch tagging criteria of this
+    // integrator and all of its descendants in a single pass over the patches.
     if (!d_parent_integrator)
     {
+        std::vector<ApplyGradientDetectorPatchCallbackFcnPtr> patch_callbacks;
+        std::vector<void*> patch_ctxs;
+        getApplyGradientDetectorPatchCallbackFcns(patch_callbacks, patch_ctxs);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<CellData<NDIM, int> > tags_data = patch->getPatchData(tag_index);
             tags_data->fillAll(0);
+            for (unsigned int k = 0; k < patch_callbacks.size(); ++k)
+            {
+                (*patch_callbacks[k])(patch, level_number, error_data_time, *tags_data, initial_time, patch_ctxs[k]);
+            }
         }
     }
 
@@ -1002,11 +1247,36 @@ HierarchyIntegrator::allocatePatchData(const int data_idx, const double data_tim
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        if (!level->checkAllocated(data_idx)) level->allocatePatchData(data_idx, data_time);
+        if (level->checkAllocated(data_idx)) continue;
+        if (d_use_level_arenas)
+        {
+            level->allocatePatchData(data_idx, data_time, new LevelArena(*level, data_idx));
+        }
+        else
+        {
+            level->allocatePatchData(data_idx, data_time);
+        }
     }
     return;
 } // allocatePatchData
 
+void
+HierarchyIntegrator::allocateLevelPatchData(Pointer<PatchLevel<NDIM> > level,
+                                            const ComponentSelector& data,
+                                            const double data_time) const
+{
+    if (!d_use_level_arenas)
+    {
+        level->allocatePatchData(data, data_time);
+        return;
+    }
+    for (int data_idx = 0; data_idx < data.getSize(); ++data_idx)
+    {
+        if (data.isSet(data_idx)) level->allocatePatchData(data_idx, data_time, new LevelArena(*level, data_idx));
+    }
+    return;
+} // allocateLevelPatchData
+
 void
 HierarchyIntegrator::deallocatePatchData(const int data_idx, int coarsest_ln, int finest_ln) const
 {
@@ -1193,11 +1463,25 @@ HierarchyIntegrator::getMaximumTimeStepSizeSpecialized()
     }
     else
     {
-        dt = std::min(dt, std::max(1.0, d_dt_growth_factor) * d_dt_previous[0]);
+        // Limit the growth relative to the unscaled time step size so that a
+        // scale factor less than one is not compounded from step to step.
+        double dt_previous = d_dt_previous[0];
+        if (d_dt_controller && d_dt_controller->getPreviousUnscaledTimeStepSize() > 0.0)
+        {
+            dt_previous = d_dt_controller->getPreviousUnscaledTimeStepSize();
+        }
+        dt = std::min(dt, std::max(1.0, d_dt_growth_factor) * dt_previous);
     }
     return dt;
 } // getMaximumTimeStepSizeSpecialized
 
+double
+HierarchyIntegrator::minReduceTimeStepSize(const double dt) const
+{
+    if (s_max_time_step_size_depth > 0) return dt;
+    return IBTK_MPI::minReduction(dt);
+} // minReduceTimeStepSize
+
 void
 HierarchyIntegrator::synchronizeHierarchyDataSpecialized(VariableContextType ctx_type)
 {
@@ -1355,6 +1639,27 @@ void HierarchyIntegrator::putToDatabaseSpecialized(Pointer<Database> /*db*/)
     return;
 } // putToDatabaseSpecialized
 
+void
+HierarchyIntegrator::saveRollbackStateSpecialized(const int /*slot*/)
+{
+    // intentionally blank
+    return;
+} // saveRollbackStateSpecialized
+
+void
+HierarchyIntegrator::restoreRollbackStateSpecialized(const int /*slot*/)
+{
+    // intentionally blank
+    return;
+} // restoreRollbackStateSpecialized
+
+void
+HierarchyIntegrator::discardRollbackStateSpecialized(const int /*slot*/)
+{
+    // intentionally blank
+    return;
+} // discardRollbackStateSpecialized
+
 void
 HierarchyIntegrator::addWorkloadEstimate(Pointer<PatchHierarchy<NDIM> >, const int)
 {
@@ -1597,6 +1902,451 @@ HierarchyIntegrator::setupTagBuffer(Pointer<GriddingAlgorithm<NDIM> > gridding_a
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+HierarchyIntegrator::getApplyGradientDetectorPatchCallbackFcns(
+    std::vector<ApplyGradientDetectorPatchCallbackFcnPtr>& callbacks,
+    std::vector<void*>& ctxs) const
+{
+    callbacks.insert(callbacks.end(),
+                     d_apply_gradient_detector_patch_callbacks.begin(),
+                     d_apply_gradient_detector_patch_callbacks.end());
+    ctxs.insert(ctxs.end(),
+                d_apply_gradient_detector_patch_callback_ctxs.begin(),
+                d_apply_gradient_detector_patch_callback_ctxs.end());
+    for (const auto& child_integrator : d_child_integrators)
+    {
+        child_integrator->getApplyGradientDetectorPatchCallbackFcns(callbacks, ctxs);
+    }
+    return;
+} // getApplyGradientDetectorPatchCallbackFcns
+
+void
+HierarchyIntegrator::getLocalPatchDataMemoryUsage(std::vector<int>& idxs, std::vector<double>& local_bytes) const
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<PatchDescriptor<NDIM> > patch_descriptor = var_db->getPatchDescriptor();
+
+    // Collect the patch data indices of the registered variables.
+    idxs.clear();
+    std::set<int> found_idxs;
+    const std::array<Pointer<VariableContext>, 3> ctxs = { getCurrentContext(), getNewContext(), getScratchContext() };
+    for (const auto* variables : { &d_state_variables, &d_scratch_variables })
+    {
+        for (const auto& var : *variables)
+        {
+            for (const auto& ctx : ctxs)
+            {
+                const int idx = var_db->mapVariableAndContextToIndex(var, ctx);
+                if (idx != invalid_index && found_idxs.insert(idx).second) idxs.push_back(idx);
+            }
+        }
+    }
+
+    // Determine the memory used by the locally allocated patch data.
+    local_bytes.assign(idxs.size(), 0.0);
+    for (std::size_t k = 0; k < idxs.size(); ++k)
+    {
+        Pointer<PatchDataFactory<NDIM> > factory = patch_descriptor->getPatchDataFactory(idxs[k]);
+        for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                if (patch->checkAllocated(idxs[k]))
+                {
+                    local_bytes[k] += static_cast<double>(factory->getSizeOfMemory(patch->getBox()));
+                }
+            }
+        }
+    }
+    return;
+} // getLocalPatchDataMemoryUsage
+
+void
+HierarchyIntegrator::updateMemoryUsage()
+{
+    std::deque<HierarchyIntegrator*> hier_integrators(1, this);
+    while (!hier_integrators.empty())
+    {
+        HierarchyIntegrator* integrator = hier_integrators.front();
+        std::vector<int> idxs;
+        std::vector<double> local_bytes;
+        integrator->getLocalPatchDataMemoryUsage(idxs, local_bytes);
+        MemoryStatistics::getManager()->setUsage(
+            "patch_data", integrator, std::accumulate(local_bytes.begin(), local_bytes.end(), 0.0));
+        hier_integrators.pop_front();
+        hier_integrators.insert(
+            hier_integrators.end(), integrator->d_child_integrators.begin(), integrator->d_child_integrators.end());
+    }
+    return;
+} // updateMemoryUsage
+
+std::string
+HierarchyIntegrator::getInitialHierarchyCacheKey() const
+{
+    std::ostringstream key;
+    key << "key=" << d_initial_hierarchy_cache_key << " dim=" << NDIM;
+    const BoxArray<NDIM>& domain_boxes = d_hierarchy->getGridGeometry()->getPhysicalDomain();
+    key << " domain=";
+    for (int i = 0; i < domain_boxes.getNumberOfBoxes(); ++i)
+    {
+        for (int d = 0; d < NDIM; ++d) key << domain_boxes[i].lower(d) << ",";
+        for (int d = 0; d < NDIM; ++d) key << domain_boxes[i].upper(d) << ",";
+    }
+    const int max_levels = d_gridding_alg->getMaxLevels();
+    key << " max_levels=" << max_levels << " ratios=";
+    for (int ln = 1; ln < max_levels; ++ln)
+    {
+        const IntVector<NDIM>& ratio = d_gridding_alg->getRatioToCoarserLevel(ln);
+        for (int d = 0; d < NDIM; ++d) key << ratio(d) << ",";
+    }
+    return key.str();
+} // getInitialHierarchyCacheKey
+
+bool
+HierarchyIntegrator::readInitialHierarchyCache()
+{
+    // Read the cache file on the root process and broadcast its contents.
+    std::string cache;
+    if (IBTK_MPI::getRank() == 0)
+    {
+        std::ifstream file(d_initial_hierarchy_cache_file_name);
+        if (file)
+        {
+            std::ostringstream contents;
+            contents << file.rdbuf();
+            cache = contents.str();
+        }
+    }
+    int cache_size = IBTK_MPI::bcast(static_cast<int>(cache.size()), 0);
+    if (cache_size == 0) return false;
+    std::vector<char> cache_data(cache.begin(), cache.end());
+    cache_data.resize(cache_size);
+    IBTK_MPI::bcast(cache_data.data(), cache_size, 0);
+
+    std::istringstream cache_stream(std::string(cache_data.begin(), cache_data.end()));
+    std::string key;
+    std::getline(cache_stream, key);
+    if (key != getInitialHierarchyCacheKey())
+    {
+        plog << d_object_name << "::initializePatchHierarchy(): initial hierarchy cache "
+             << d_initial_hierarchy_cache_file_name << " does not match the present configuration\n";
+        return false;
+    }
+    int num_levels = 0;
+    cache_stream >> num_levels;
+    std::vector<BoxArray<NDIM> > tag_boxes(num_levels);
+    for (int ln = 0; ln < num_levels && cache_stream; ++ln)
+    {
+        int num_boxes = 0;
+        cache_stream >> num_boxes;
+        tag_boxes[ln] = BoxArray<NDIM>(num_boxes);
+        for (int i = 0; i < num_boxes; ++i)
+        {
+            for (int d = 0; d < NDIM; ++d) cache_stream >> tag_boxes[ln][i].lower(d);
+            for (int d = 0; d < NDIM; ++d) cache_stream >> tag_boxes[ln][i].upper(d);
+        }
+        if (ln > 0) tag_boxes[ln].coarsen(d_gridding_alg->getRatioToCoarserLevel(ln));
+    }
+    if (!cache_stream)
+    {
+        TBOX_WARNING(d_object_name << "::initializePatchHierarchy():\n"
+                                   << "  unable to read initial hierarchy cache "
+                                   << d_initial_hierarchy_cache_file_name << "\n");
+        return false;
+    }
+    d_initial_hierarchy_cache_tag_boxes = tag_boxes;
+    plog << d_object_name << "::initializePatchHierarchy(): generating initial hierarchy from cache "
+         << d_initial_hierarchy_cache_file_name << "\n";
+    return true;
+} // readInitialHierarchyCache
+
+void
+HierarchyIntegrator::writeInitialHierarchyCache() const
+{
+    // The boxes of all levels are known on every process.
+    if (IBTK_MPI::getRank() != 0) return;
+    std::ofstream file(d_initial_hierarchy_cache_file_name);
+    file << getInitialHierarchyCacheKey() << "\n";
+    const int num_levels = d_hierarchy->getNumberOfLevels();
+    file << num_levels << "\n";
+    for (int ln = 0; ln < num_levels; ++ln)
+    {
+        const BoxArray<NDIM>& boxes = d_hierarchy->getPatchLevel(ln)->getBoxes();
+        file << boxes.getNumberOfBoxes() << "\n";
+        for (int i = 0; i < boxes.getNumberOfBoxes(); ++i)
+        {
+            for (int d = 0; d < NDIM; ++d) file << boxes[i].lower(d) << " ";
+            for (int d = 0; d < NDIM; ++d) file << boxes[i].upper(d) << (d + 1 < NDIM ? " " : "\n");
+        }
+    }
+    if (!file)
+    {
+        TBOX_WARNING(d_object_name << "::initializePatchHierarchy():\n"
+                                   << "  unable to write initial hierarchy cache "
+                                   << d_initial_hierarchy_cache_file_name << "\n");
+    }
+    return;
+} // writeInitialHierarchyCache
+
+void
+HierarchyIntegrator::executeInSituAnalyses()
+{
+    std::deque<HierarchyIntegrator*> hier_integrators(1, this);
+    while (!hier_integrators.empty())
+    {
+        HierarchyIntegrator* integrator = hier_integrators.front();
+        for (const auto& analysis : integrator->d_in_situ_analyses)
+        {
+            if (analysis->isAnalysisStep(d_hierarchy, d_integrator_time, d_integrator_step))
+            {
+                TelemetryManager::ScopedPhase analysis_phase("in_situ_analysis");
+                analysis->executeAnalysis(d_hierarchy, d_integrator_time, d_integrator_step);
+            }
+        }
+        hier_integrators.pop_front();
+        hier_integrators.insert(
+            hier_integrators.end(), integrator->d_child_integrators.begin(), integrator->d_child_integrators.end());
+    }
+    return;
+} // executeInSituAnalyses
+
+void
+HierarchyIntegrator::saveRollbackState()
+{
+    if (static_cast<int>(d_rollback_states.size()) == d_rollback_depth) discardRollbackState(/*newest*/ false);
+
+    // Find a free slot and register the patch data indices of the slot if it
+    // is used for the first time.
+    std::vector<bool> slot_is_used(d_rollback_depth, false);
+    for (const auto& state : d_rollback_states) slot_is_used[state.slot] = true;
+    const int slot =
+        static_cast<int>(std::find(slot_is_used.begin(), slot_is_used.end(), false) - slot_is_used.begin());
+    d_rollback_idxs.resize(d_rollback_depth);
+    std::vector<HierarchyIntegrator*> integrators;
+    std::deque<HierarchyIntegrator*> hier_integrators(1, this);
+    while (!hier_integrators.empty())
+    {
+        integrators.push_back(hier_integrators.front());
+        hier_integrators.pop_front();
+        hier_integrators.insert(hier_integrators.end(),
+                                integrators.back()->d_child_integrators.begin(),
+                                integrators.back()->d_child_integrators.end());
+    }
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    if (d_rollback_idxs[slot].empty())
+    {
+        Pointer<VariableContext> rollback_ctx =
+            var_db->getContext(d_object_name + "::ROLLBACK_" + std::to_string(slot));
+        for (const auto& integrator : integrators)
+        {
+            for (const auto& var : integrator->d_state_variables)
+            {
+                const int current_idx = var_db->mapVariableAndContextToIndex(var, integrator->getCurrentContext());
+                const int rollback_idx = var_db->registerVariableAndContext(var, rollback_ctx);
+                d_rollback_idxs[slot].emplace_back(current_idx, rollback_idx);
+            }
+        }
+    }
+
+    // Copy the current data.
+    for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (const auto& idxs : d_rollback_idxs[slot])
+        {
+            if (!level->checkAllocated(idxs.second)) level->allocatePatchData(idxs.second, d_integrator_time);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<PatchData<NDIM> > rollback_data = patch->getPatchData(idxs.second);
+                rollback_data->copy(*patch->getPatchData(idxs.first));
+                rollback_data->setTime(patch->getPatchData(idxs.first)->getTime());
+            }
+        }
+    }
+
+    RollbackState state;
+    state.slot = slot;
+    for (const auto& integrator : integrators)
+    {
+        state.integrator_times.push_back(integrator->d_integrator_time);
+        state.integrator_steps.push_back(integrator->d_integrator_step);
+        state.dt_previous.push_back(integrator->d_dt_previous);
+        integrator->saveRollbackStateSpecialized(slot);
+    }
+    d_rollback_states.push_back(state);
+    return;
+} // saveRollbackState
+
+void
+HierarchyIntegrator::restoreRollbackState()
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!d_rollback_states.empty());
+#endif
+    const RollbackState& state = d_rollback_states.back();
+    for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (const auto& idxs : d_rollback_idxs[state.slot])
+        {
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<PatchData<NDIM> > current_data = patch->getPatchData(idxs.first);
+                current_data->copy(*patch->getPatchData(idxs.second));
+                current_data->setTime(patch->getPatchData(idxs.second)->getTime());
+            }
+        }
+    }
+
+    unsigned int k = 0;
+    std::deque<HierarchyIntegrator*> hier_integrators(1, this);
+    while (!hier_integrators.empty())
+    {
+        HierarchyIntegrator* integrator = hier_integrators.front();
+        integrator->d_integrator_time = state.integrator_times[k];
+        integrator->d_integrator_step = state.integrator_steps[k];
+        integrator->d_dt_previous = state.dt_previous[k];
+        integrator->d_step_failure_indicated = false;
+        integrator->restoreRollbackStateSpecialized(state.slot);
+        ++k;
+        hier_integrators.pop_front();
+        hier_integrators.insert(
+            hier_integrators.end(), integrator->d_child_integrators.begin(), integrator->d_child_integrators.end());
+    }
+    discardRollbackState(/*newest*/ true);
+    return;
+} // restoreRollbackState
+
+void
+HierarchyIntegrator::discardRollbackState(const bool newest)
+{
+    if (d_rollback_states.empty()) return;
+    const int slot = newest ? d_rollback_states.back().slot : d_rollback_states.front().slot;
+    std::deque<HierarchyIntegrator*> hier_integrators(1, this);
+    while (!hier_integrators.empty())
+    {
+        HierarchyIntegrator* integrator = hier_integrators.front();
+        integrator->discardRollbackStateSpecialized(slot);
+        hier_integrators.pop_front();
+        hier_integrators.insert(
+            hier_integrators.end(), integrator->d_child_integrators.begin(), integrator->d_child_integrators.end());
+    }
+    if (newest)
+        d_rollback_states.pop_back();
+    else
+        d_rollback_states.pop_front();
+    return;
+} // discardRollbackState
+
+void
+HierarchyIntegrator::clearRollbackStates()
+{
+    while (!d_rollback_states.empty()) discardRollbackState(/*newest*/ true);
+    for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (const auto& slot_idxs : d_rollback_idxs)
+        {
+            for (const auto& idxs : slot_idxs)
+            {
+                if (level->checkAllocated(idxs.second)) level->deallocatePatchData(idxs.second);
+            }
+        }
+    }
+    return;
+} // clearRollbackStates
+
+bool
+HierarchyIntegrator::stepFailed()
+{
+    bool failed = false;
+    std::deque<HierarchyIntegrator*> hier_integrators(1, this);
+    while (!hier_integrators.empty())
+    {
+        HierarchyIntegrator* integrator = hier_integrators.front();
+        if (d_rollback_on_step_failure && integrator->d_step_failure_indicated)
+        {
+            plog << integrator->d_object_name << "::stepFailed(): at time = " << d_integrator_time << ": "
+                 << integrator->d_step_failure_reason << "\n";
+            failed = true;
+        }
+        integrator->d_step_failure_indicated = false;
+        if (d_rollback_check_finite)
+        {
+            // The sum of the absolute values is not finite if any value is not
+            // finite.
+            VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+            for (const auto& var : integrator->d_state_variables)
+            {
+                const bool is_double_var = var.dynamicCast<CellVariable<NDIM, double> >() ||
+                                           var.dynamicCast<SideVariable<NDIM, double> >() ||
+                                           var.dynamicCast<FaceVariable<NDIM, double> >() ||
+                                           var.dynamicCast<NodeVariable<NDIM, double> >() ||
+                                           var.dynamicCast<EdgeVariable<NDIM, double> >();
+                if (!is_double_var) continue;
+                const int current_idx = var_db->mapVariableAndContextToIndex(var, integrator->getCurrentContext());
+                Pointer<HierarchyDataOpsReal<NDIM, double> > data_ops =
+                    HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(var, d_hierarchy, true);
+                data_ops->resetLevels(0, d_hierarchy->getFinestLevelNumber());
+                if (!std::isfinite(data_ops->L1Norm(current_idx)))
+                {
+                    plog << d_object_name << "::stepFailed(): at time = " << d_integrator_time << ": "
+                         << var->getName() << " is not finite\n";
+                    failed = true;
+                }
+            }
+        }
+        hier_integrators.pop_front();
+        hier_integrators.insert(
+            hier_integrators.end(), integrator->d_child_integrators.begin(), integrator->d_child_integrators.end());
+    }
+    return IBTK_MPI::maxReduction(static_cast<int>(failed)) != 0;
+} // stepFailed
+
+double
+HierarchyIntegrator::rollBack()
+{
+    // Repeat the time step from the most recently saved state up to
+    // d_rollback_max_retries times with successively smaller time step sizes,
+    // and then fall back to older states.  The time step size of the k-th
+    // retry is d_rollback_base_dt * d_rollback_dt_factor^k, in which
+    // d_rollback_base_dt is the size of the step that was originally taken from
+    // the restored state.
+    ++d_num_rollback_retries;
+    if (d_num_rollback_retries > d_rollback_max_retries)
+    {
+        const double newest_time = d_rollback_states.back().integrator_times.front();
+        discardRollbackState(/*newest*/ true);
+        d_num_rollback_retries = 1;
+        if (!d_rollback_states.empty())
+        {
+            d_rollback_base_dt = newest_time - d_rollback_states.back().integrator_times.front();
+        }
+    }
+    if (d_rollback_states.empty())
+    {
+        TBOX_ERROR(d_object_name << "::advanceHierarchy():\n"
+                                 << "  time step failed at time = " << d_integrator_time
+                                 << " and no saved state is left to roll back to.\n");
+    }
+    restoreRollbackState();
+    const double retry_dt = d_rollback_base_dt * std::pow(d_rollback_dt_factor, d_num_rollback_retries);
+    if (retry_dt < getMinimumTimeStepSize())
+    {
+        TBOX_ERROR(d_object_name << "::advanceHierarchy():\n"
+                                 << "  time step failed at time = " << d_integrator_time
+                                 << " and the reduced time step size dt = " << retry_dt
+                                 << " is smaller than the minimum time step size.\n");
+    }
+    plog << d_object_name << "::advanceHierarchy(): rolling back to time = " << d_integrator_time
+         << " and retrying with dt = " << retry_dt << " (retry " << d_num_rollback_retries << ")\n";
+    return retry_dt;
+} // rollBack
+
 void
 HierarchyIntegrator::getFromInput(Pointer<Database> db, bool is_from_restart)
 {
@@ -1617,6 +2367,11 @@ HierarchyIntegrator::getFromInput(Pointer<Database> db, bool is_from_restart)
     if (db->keyExists("num_cycles")) d_num_cycles = db->getInteger("num_cycles");
     if (db->keyExists("regrid_interval")) d_regrid_interval = db->getInteger("regrid_interval");
     if (db->keyExists("regrid_mode")) d_regrid_mode = string_to_enum<RegridMode>(db->getString("regrid_mode"));
+    if (db->isDatabase("TimeStepSizeController"))
+    {
+        d_dt_controller.reset(new TimeStepSizeController(d_object_name + "::TimeStepSizeController",
+                                                         db->getDatabase("TimeStepSizeController")));
+    }
     if (db->keyExists("enable_logging"))
     {
         d_enable_logging = db->getBool("enable_logging");
@@ -1629,8 +2384,19 @@ HierarchyIntegrator::getFromInput(Pointer<Database> db, bool is_from_restart)
             d_enable_logging_solver_iterations = d_enable_logging;
         }
     }
+    if (db->keyExists("use_level_arenas")) d_use_level_arenas = db->getBool("use_level_arenas");
     if (db->keyExists("bdry_extrap_type")) d_bdry_extrap_type = db->getString("bdry_extrap_type");
     if (db->keyExists("tag_buffer")) d_tag_buffer = db->getIntegerArray("tag_buffer");
+    if (db->keyExists("rollback_depth")) d_rollback_depth = db->getInteger("rollback_depth");
+    if (db->keyExists("rollback_max_retries")) d_rollback_max_retries = db->getInteger("rollback_max_retries");
+    if (db->keyExists("rollback_dt_factor")) d_rollback_dt_factor = db->getDouble("rollback_dt_factor");
+    if (db->keyExists("rollback_check_finite")) d_rollback_check_finite = db->getBool("rollback_check_finite");
+    if (db->keyExists("rollback_on_step_failure"))
+        d_rollback_on_step_failure = db->getBool("rollback_on_step_failure");
+    if (db->keyExists("initial_hierarchy_cache_file"))
+        d_initial_hierarchy_cache_file_name = db->getString("initial_hierarchy_cache_file");
+    if (db->keyExists("initial_hierarchy_cache_key"))
+        d_initial_hierarchy_cache_key = db->getString("initial_hierarchy_cache_key");
     return;
 } // getFromInput
 
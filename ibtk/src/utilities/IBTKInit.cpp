@@ -35,7 +35,9 @@ IBTKInit::IBTKInit(int argc, char** argv, MPI_Comm communicator, char* petsc_fil
     NULL_USE(petsc_file);
     NULL_USE(petsc_help);
 #else
-    // We need to initialize PETSc.
+    // We need to initialize PETSc (on the given communicator, which need not be
+    // MPI_COMM_WORLD when running an ensemble).
+    PETSC_COMM_WORLD = communicator;
     PetscInitialize(&argc, &argv, petsc_file, petsc_help);
 #endif
 #if SAMRAI_VERSION_MAJOR > 2
@@ -13,6 +13,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibtk/CommunicationStatistics.h"
 #include "ibtk/IBTK_MPI.h"
 
 #include "SAMRAI_config.h"
@@ -67,17 +68,35 @@ IBTK_MPI::getRank(IBTK_MPI::comm communicator)
     return node;
 } // getRank
 
+IBTK_MPI::comm
+IBTK_MPI::splitByNode(IBTK_MPI::comm communicator)
+{
+    IBTK_MPI::comm node_communicator = MPI_COMM_NULL;
+    MPI_Comm_split_type(communicator, MPI_COMM_TYPE_SHARED, getRank(communicator), MPI_INFO_NULL, &node_communicator);
+    return node_communicator;
+} // splitByNode
+
 void
 IBTK_MPI::barrier(IBTK_MPI::comm communicator)
 {
     (void)MPI_Barrier(communicator);
 } // barrier
 
+void
+IBTK_MPI::wait(IBTK_MPI::request& request)
+{
+    if (request != MPI_REQUEST_NULL) MPI_Wait(&request, MPI_STATUS_IGNORE);
+} // wait
+
 void
 IBTK_MPI::allToOneSumReduction(int* x, const int n, const int root, IBTK_MPI::comm communicator)
 {
     if (getNodes(communicator) > 1)
     {
+        if (CommunicationStatistics::enabled())
+        {
+            CommunicationStatistics::getManager()->recordCollective(n * sizeof(int));
+        }
         if (IBTK_MPI::getRank() == root)
             MPI_Reduce(MPI_IN_PLACE, x, n, MPI_INT, MPI_SUM, root, communicator);
         else
@@ -91,6 +110,10 @@ IBTK_MPI::sendBytes(const void* buf,
                     const int receiving_proc_number,
                     IBTK_MPI::comm communicator)
 {
+    if (CommunicationStatistics::enabled())
+    {
+        CommunicationStatistics::getManager()->recordSend(receiving_proc_number, number_bytes);
+    }
     MPI_Send((void*)buf, number_bytes, MPI_BYTE, receiving_proc_number, 0, communicator);
 } // sendBytes
 
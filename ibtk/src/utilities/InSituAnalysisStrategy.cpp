@@ -0,0 +1,72 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/InSituAnalysisStrategy.h"
+
+#include "PatchHierarchy.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+InSituAnalysisStrategy::InSituAnalysisStrategy(const int interval) : d_interval(interval)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_interval >= 0);
+#endif
+    return;
+} // InSituAnalysisStrategy
+
+void
+InSituAnalysisStrategy::setInterval(const int interval)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(interval >= 0);
+#endif
+    d_interval = interval;
+    return;
+} // setInterval
+
+int
+InSituAnalysisStrategy::getInterval() const
+{
+    return d_interval;
+} // getInterval
+
+bool
+InSituAnalysisStrategy::isAnalysisStep(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                       const double /*data_time*/,
+                                       const int iteration_num)
+{
+    return d_interval > 0 && iteration_num % d_interval == 0;
+} // isAnalysisStep
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
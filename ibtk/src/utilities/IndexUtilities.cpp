@@ -15,6 +15,11 @@
 
 #include "ibtk/IndexUtilities.h"
 
+#include "Box.h"
+#include "CellData.h"
+#include "CellIndex.h"
+#include "tbox/Utilities.h"
+
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -25,6 +30,25 @@ namespace IBTK
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
+Box<NDIM>
+IndexUtilities::getSublevelSetBoundingBox(const CellData<NDIM, double>& phi_data,
+                                          const Box<NDIM>& box,
+                                          const double threshold,
+                                          const int depth)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(0 <= depth && depth < phi_data.getDepth());
+#endif
+    Box<NDIM> bounding_box;
+    const Box<NDIM> search_box = box * phi_data.getGhostBox();
+    for (Box<NDIM>::Iterator it(search_box); it; it++)
+    {
+        const CellIndex<NDIM> ci(it());
+        if (phi_data(ci, depth) <= threshold) bounding_box += Box<NDIM>(ci, ci);
+    }
+    return bounding_box;
+} // getSublevelSetBoundingBox
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -61,6 +61,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -274,13 +275,18 @@ LMarkerUtilities::eulerStep(const int mark_current_idx,
             Pointer<LMarkerSetData> mark_current_data = patch->getPatchData(mark_current_idx);
             Pointer<LMarkerSetData> mark_new_data = patch->getPatchData(mark_new_idx);
 
-            const unsigned int num_patch_marks = countMarkersOnPatch(mark_current_data);
+            // Gather the markers of the patch into contiguous arrays so that the
+            // marker sets are traversed only once.
+            std::vector<LMarker*> marks_current, marks_new;
+            collectMarkersOnPatch(marks_current, mark_current_data);
+            collectMarkersOnPatch(marks_new, mark_new_data);
+            const auto num_patch_marks = static_cast<unsigned int>(marks_current.size());
 #if !defined(NDEBUG)
-            TBOX_ASSERT(num_patch_marks == countMarkersOnPatch(mark_new_data));
+            TBOX_ASSERT(num_patch_marks == marks_new.size());
 #endif
             // Collect the local marker positions at time n.
             std::vector<double> X_mark_current;
-            collectMarkerPositionsOnPatch(X_mark_current, mark_current_data);
+            collectMarkerPositionsOnPatch(X_mark_current, marks_current);
 
             // Compute U_mark(n) = u(X_mark(n),n).
             std::vector<double> U_mark_current(X_mark_current.size());
@@ -304,8 +310,8 @@ LMarkerUtilities::eulerStep(const int mark_current_idx,
 
             // Store the local marker velocities at at time n, and the marker
             // positions at time n+1.
-            resetMarkerVelocitiesOnPatch(U_mark_current, mark_current_data);
-            resetMarkerPositionsOnPatch(X_mark_new, mark_new_data);
+            resetMarkerVelocitiesOnPatch(U_mark_current, marks_current);
+            resetMarkerPositionsOnPatch(X_mark_new, marks_new);
         }
     }
     return;
@@ -338,16 +344,21 @@ LMarkerUtilities::midpointStep(const int mark_current_idx,
             Pointer<LMarkerSetData> mark_current_data = patch->getPatchData(mark_current_idx);
             Pointer<LMarkerSetData> mark_new_data = patch->getPatchData(mark_new_idx);
 
-            const unsigned int num_patch_marks = countMarkersOnPatch(mark_current_data);
+            // Gather the markers of the patch into contiguous arrays so that the
+            // marker sets are traversed only once.
+            std::vector<LMarker*> marks_current, marks_new;
+            collectMarkersOnPatch(marks_current, mark_current_data);
+            collectMarkersOnPatch(marks_new, mark_new_data);
+            const auto num_patch_marks = static_cast<unsigned int>(marks_current.size());
 #if !defined(NDEBUG)
-            TBOX_ASSERT(num_patch_marks == countMarkersOnPatch(mark_new_data));
+            TBOX_ASSERT(num_patch_marks == marks_new.size());
 #endif
             // Collect the local marker positions at time n and predicted marker
             // positions at time n+1.
             std::vector<double> X_mark_current;
-            collectMarkerPositionsOnPatch(X_mark_current, mark_current_data);
+            collectMarkerPositionsOnPatch(X_mark_current, marks_current);
             std::vector<double> X_mark_new;
-            collectMarkerPositionsOnPatch(X_mark_new, mark_new_data);
+            collectMarkerPositionsOnPatch(X_mark_new, marks_new);
 
             // Set X(n+1/2) = 0.5*(X(n)+X(n+1)).
             std::vector<double> X_mark_half(NDIM * num_patch_marks);
@@ -376,7 +387,7 @@ LMarkerUtilities::midpointStep(const int mark_current_idx,
             preventMarkerEscape(X_mark_new, hierarchy->getGridGeometry());
 
             // Store the local marker positions at time n+1.
-            resetMarkerPositionsOnPatch(X_mark_new, mark_new_data);
+            resetMarkerPositionsOnPatch(X_mark_new, marks_new);
         }
     }
     return;
@@ -409,20 +420,25 @@ LMarkerUtilities::trapezoidalStep(const int mark_current_idx,
             Pointer<LMarkerSetData> mark_current_data = patch->getPatchData(mark_current_idx);
             Pointer<LMarkerSetData> mark_new_data = patch->getPatchData(mark_new_idx);
 
-            const unsigned int num_patch_marks = countMarkersOnPatch(mark_current_data);
+            // Gather the markers of the patch into contiguous arrays so that the
+            // marker sets are traversed only once.
+            std::vector<LMarker*> marks_current, marks_new;
+            collectMarkersOnPatch(marks_current, mark_current_data);
+            collectMarkersOnPatch(marks_new, mark_new_data);
+            const auto num_patch_marks = static_cast<unsigned int>(marks_current.size());
 #if !defined(NDEBUG)
-            TBOX_ASSERT(num_patch_marks == countMarkersOnPatch(mark_new_data));
+            TBOX_ASSERT(num_patch_marks == marks_new.size());
 #endif
             // Collect the local marker positions at time n and predicted marker
             // positions at time n+1.
             std::vector<double> X_mark_current;
-            collectMarkerPositionsOnPatch(X_mark_current, mark_current_data);
+            collectMarkerPositionsOnPatch(X_mark_current, marks_current);
             std::vector<double> X_mark_new;
-            collectMarkerPositionsOnPatch(X_mark_new, mark_new_data);
+            collectMarkerPositionsOnPatch(X_mark_new, marks_new);
 
             // Collect the local marker velocities at time n.
             std::vector<double> U_mark_current;
-            collectMarkerVelocitiesOnPatch(U_mark_current, mark_current_data);
+            collectMarkerVelocitiesOnPatch(U_mark_current, marks_current);
 
             // Compute U_mark(n+1/) = u(X_mark(n+1/2),n+1/2).
             std::vector<double> U_mark_new(X_mark_new.size());
@@ -452,8 +468,8 @@ LMarkerUtilities::trapezoidalStep(const int mark_current_idx,
 
             // Store the local marker velocities at at time n, and the marker
             // positions at time n+1.
-            resetMarkerVelocitiesOnPatch(U_mark_new, mark_new_data);
-            resetMarkerPositionsOnPatch(X_mark_new, mark_new_data);
+            resetMarkerVelocitiesOnPatch(U_mark_new, marks_new);
+            resetMarkerPositionsOnPatch(X_mark_new, marks_new);
         }
     }
     return;
@@ -558,11 +574,12 @@ LMarkerUtilities::collectMarkersOnPatchHierarchy(const int mark_idx, Pointer<Pat
         const double* const patchXUpper = patch_geom->getXUpper();
         const double* const patchDx = patch_geom->getDx();
 
+        // Determine the cells of the markers owned by this patch.
         Pointer<LMarkerSetData> mark_data = patch->getPatchData(mark_idx);
-        Pointer<LMarkerSetData> mark_data_new = new LMarkerSetData(mark_data->getBox(), mark_data->getGhostCellWidth());
-        for (LMarkerSetData::DataIterator it = mark_data->data_begin(mark_data->getGhostBox());
-             it != mark_data->data_end();
-             ++it)
+        const Box<NDIM>& ghost_box = mark_data->getGhostBox();
+        std::vector<LMarkerSet::value_type> owned_marks;
+        std::vector<double> owned_X;
+        for (LMarkerSetData::DataIterator it = mark_data->data_begin(ghost_box); it != mark_data->data_end(); ++it)
         {
             const LMarkerSet::value_type& mark = *it;
             const Point& X = mark->getPosition();
@@ -583,14 +600,38 @@ LMarkerUtilities::collectMarkersOnPatchHierarchy(const int mark_idx, Pointer<Pat
                 ;
             if (patch_owns_mark_at_new_loc)
             {
-                const hier::Index<NDIM> i = IndexUtilities::getCellIndex(X_shifted, grid_geom, ratio);
-                if (!mark_data_new->isElement(i))
-                {
-                    mark_data_new->appendItemPointer(i, new LMarkerSet());
-                }
-                LMarkerSet& new_mark_set = *(mark_data_new->getItem(i));
-                new_mark_set.push_back(mark);
+                owned_marks.push_back(mark);
+                owned_X.insert(owned_X.end(), X_shifted.data(), X_shifted.data() + NDIM);
+            }
+        }
+        const int num_owned_marks = static_cast<int>(owned_marks.size());
+        std::vector<hier::Index<NDIM> > owned_idxs(num_owned_marks);
+        IndexUtilities::getCellIndices(owned_X.data(), num_owned_marks, grid_geom, ratio, owned_idxs.data());
+        std::vector<std::pair<int, LMarkerSet::value_type> > binned_marks;
+        binned_marks.reserve(num_owned_marks);
+        for (int k = 0; k < num_owned_marks; ++k)
+        {
+            binned_marks.emplace_back(ghost_box.offset(owned_idxs[k]), owned_marks[k]);
+        }
+
+        // Sort the markers by cell and build each cell's marker set in a
+        // single pass.  The sort is stable so that markers in the same cell
+        // retain their relative order.
+        std::stable_sort(binned_marks.begin(),
+                         binned_marks.end(),
+                         [](const std::pair<int, LMarkerSet::value_type>& a,
+                            const std::pair<int, LMarkerSet::value_type>& b) { return a.first < b.first; });
+        Pointer<LMarkerSetData> mark_data_new = new LMarkerSetData(mark_data->getBox(), mark_data->getGhostCellWidth());
+        for (auto bin_begin = binned_marks.begin(); bin_begin != binned_marks.end();)
+        {
+            auto bin_end = bin_begin;
+            auto* const new_mark_set = new LMarkerSet();
+            for (; bin_end != binned_marks.end() && bin_end->first == bin_begin->first; ++bin_end)
+            {
+                new_mark_set->push_back(bin_end->second);
             }
+            mark_data_new->appendItemPointer(ghost_box.index(bin_begin->first), new_mark_set);
+            bin_begin = bin_end;
         }
 
         // Swap the old and new patch data pointers.
@@ -768,15 +809,24 @@ LMarkerUtilities::countMarkersOnPatch(Pointer<LMarkerSetData> mark_data)
 } // countMarkersOnPatch
 
 void
-LMarkerUtilities::collectMarkerPositionsOnPatch(std::vector<double>& X_mark, Pointer<LMarkerSetData> mark_data)
+LMarkerUtilities::collectMarkersOnPatch(std::vector<LMarker*>& marks, Pointer<LMarkerSetData> mark_data)
 {
-    X_mark.resize(NDIM * countMarkersOnPatch(mark_data));
-    unsigned int k = 0;
+    marks.clear();
     for (LMarkerSetData::DataIterator it = mark_data->data_begin(mark_data->getBox()); it != mark_data->data_end();
-         ++it, ++k)
+         ++it)
+    {
+        marks.push_back((*it).getPointer());
+    }
+    return;
+} // collectMarkersOnPatch
+
+void
+LMarkerUtilities::collectMarkerPositionsOnPatch(std::vector<double>& X_mark, const std::vector<LMarker*>& marks)
+{
+    X_mark.resize(NDIM * marks.size());
+    for (unsigned int k = 0; k < marks.size(); ++k)
     {
-        const LMarkerSet::value_type& mark = *it;
-        const Point& X = mark->getPosition();
+        const Point& X = marks[k]->getPosition();
         for (unsigned int d = 0; d < NDIM; ++d)
         {
             X_mark[NDIM * k + d] = X[d];
@@ -786,14 +836,11 @@ LMarkerUtilities::collectMarkerPositionsOnPatch(std::vector<double>& X_mark, Poi
 } // collectMarkerPositionsOnPatch
 
 void
-LMarkerUtilities::resetMarkerPositionsOnPatch(const std::vector<double>& X_mark, Pointer<LMarkerSetData> mark_data)
+LMarkerUtilities::resetMarkerPositionsOnPatch(const std::vector<double>& X_mark, const std::vector<LMarker*>& marks)
 {
-    unsigned int k = 0;
-    for (LMarkerSetData::DataIterator it = mark_data->data_begin(mark_data->getBox()); it != mark_data->data_end();
-         ++it, ++k)
+    for (unsigned int k = 0; k < marks.size(); ++k)
     {
-        const LMarkerSet::value_type& mark = *it;
-        Point& X = mark->getPosition();
+        Point& X = marks[k]->getPosition();
         for (unsigned int d = 0; d < NDIM; ++d)
         {
             X[d] = X_mark[NDIM * k + d];
@@ -803,15 +850,12 @@ LMarkerUtilities::resetMarkerPositionsOnPatch(const std::vector<double>& X_mark,
 } // resetMarkerPositionsOnPatch
 
 void
-LMarkerUtilities::collectMarkerVelocitiesOnPatch(std::vector<double>& U_mark, Pointer<LMarkerSetData> mark_data)
+LMarkerUtilities::collectMarkerVelocitiesOnPatch(std::vector<double>& U_mark, const std::vector<LMarker*>& marks)
 {
-    U_mark.resize(NDIM * countMarkersOnPatch(mark_data));
-    unsigned int k = 0;
-    for (LMarkerSetData::DataIterator it = mark_data->data_begin(mark_data->getBox()); it != mark_data->data_end();
-         ++it, ++k)
+    U_mark.resize(NDIM * marks.size());
+    for (unsigned int k = 0; k < marks.size(); ++k)
     {
-        const LMarkerSet::value_type& mark = *it;
-        const Vector& U = mark->getVelocity();
+        const Vector& U = marks[k]->getVelocity();
         for (unsigned int d = 0; d < NDIM; ++d)
         {
             U_mark[NDIM * k + d] = U[d];
@@ -821,14 +865,11 @@ LMarkerUtilities::collectMarkerVelocitiesOnPatch(std::vector<double>& U_mark, Po
 } // collectMarkerVelocitiesOnPatch
 
 void
-LMarkerUtilities::resetMarkerVelocitiesOnPatch(const std::vector<double>& U_mark, Pointer<LMarkerSetData> mark_data)
+LMarkerUtilities::resetMarkerVelocitiesOnPatch(const std::vector<double>& U_mark, const std::vector<LMarker*>& marks)
 {
-    unsigned int k = 0;
-    for (LMarkerSetData::DataIterator it = mark_data->data_begin(mark_data->getBox()); it != mark_data->data_end();
-         ++it, ++k)
+    for (unsigned int k = 0; k < marks.size(); ++k)
     {
-        const LMarkerSet::value_type& mark = *it;
-        Vector& U = mark->getVelocity();
+        Vector& U = marks[k]->getVelocity();
         for (unsigned int d = 0; d < NDIM; ++d)
         {
             U[d] = U_mark[NDIM * k + d];
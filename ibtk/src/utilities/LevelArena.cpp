@@ -0,0 +1,144 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/LevelArena.h"
+
+#include "Patch.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
+#include "PatchLevel.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Upper bound on the number of allocations made for the data on one patch
+// (the patch data object itself plus one array for each data axis).
+static const std::size_t MAX_ALLOCS_PER_PATCH = NDIM + 2;
+
+inline std::size_t
+round_up(const std::size_t bytes)
+{
+    return ((bytes + LevelArena::ALIGNMENT - 1) / LevelArena::ALIGNMENT) * LevelArena::ALIGNMENT;
+} // round_up
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+LevelArena::LevelArena(const PatchLevel<NDIM>& level, const int data_idx)
+{
+    const Pointer<PatchDataFactory<NDIM> > factory = level.getPatchDescriptor()->getPatchDataFactory(data_idx);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(factory);
+#endif
+
+    // Lay out the data of the local patches one after the other. Each patch is
+    // given enough room to align all of its allocations.
+    std::vector<std::size_t> patch_offsets(1, 0);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        const Pointer<Patch<NDIM> > patch = level.getPatch(p());
+        const std::size_t patch_bytes =
+            round_up(factory->getSizeOfMemory(patch->getBox())) + MAX_ALLOCS_PER_PATCH * ALIGNMENT;
+        patch_offsets.push_back(patch_offsets.back() + patch_bytes);
+    }
+    d_capacity = patch_offsets.back();
+    if (d_capacity == 0) return;
+    d_memory = ::operator new(d_capacity + ALIGNMENT);
+    d_block = static_cast<char*>(d_memory) + (ALIGNMENT - reinterpret_cast<std::uintptr_t>(d_memory) % ALIGNMENT) %
+                                                 ALIGNMENT;
+
+    // First touch the memory of each patch on one of the threads that will
+    // process the patches.
+    const int num_patches = static_cast<int>(patch_offsets.size()) - 1;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (num_patches > 1)
+#endif
+    for (int k = 0; k < num_patches; ++k)
+    {
+        std::memset(d_block + patch_offsets[k], 0, patch_offsets[k + 1] - patch_offsets[k]);
+    }
+    return;
+} // LevelArena
+
+LevelArena::~LevelArena()
+{
+    for (void* const p : d_overflow_blocks) ::operator delete(p);
+    ::operator delete(d_memory);
+} // ~LevelArena
+
+void*
+LevelArena::alloc(const size_t bytes)
+{
+    if (d_offset + bytes <= d_capacity)
+    {
+        void* const p = d_block + d_offset;
+        d_offset = round_up(d_offset + bytes);
+        return p;
+    }
+    void* const p = ::operator new(bytes);
+    d_overflow_blocks.insert(p);
+    d_bytes_overflowed += bytes;
+    return p;
+} // alloc
+
+void
+LevelArena::free(void* const p)
+{
+    // Memory in the block is only reclaimed when the arena is destroyed, i.e.,
+    // after all patch data allocated from it have been deallocated.
+    auto it = d_overflow_blocks.find(p);
+    if (it != d_overflow_blocks.end())
+    {
+        ::operator delete(p);
+        d_overflow_blocks.erase(it);
+    }
+    return;
+} // free
+
+std::size_t
+LevelArena::getBytesReserved() const
+{
+    return d_capacity;
+} // getBytesReserved
+
+std::size_t
+LevelArena::getBytesOverflowed() const
+{
+    return d_bytes_overflowed;
+} // getBytesOverflowed
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
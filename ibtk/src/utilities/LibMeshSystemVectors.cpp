@@ -14,6 +14,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <ibtk/LibMeshSystemVectors.h>
+#include <ibtk/libmesh_utilities.h>
 
 #include <tbox/Utilities.h>
 
@@ -112,6 +113,23 @@ LibMeshSystemVectors::copy(const std::string& source, const std::vector<std::str
     }
 }
 
+void
+LibMeshSystemVectors::copy(const std::string& source,
+                           const std::vector<std::string>& dests,
+                           FEVectorPipeline& pipeline)
+{
+    // The source vectors must already exist
+    TBOX_ASSERT(!vec_stored_in_map(source) || d_systems[0]->request_vector(source));
+    const std::vector<libMesh::PetscVector<double>*> source_vecs = get(source);
+    for (const std::string& dest : dests)
+    {
+        maybeAdd(dest);
+        const std::vector<libMesh::PetscVector<double>*> dest_vecs = get(dest);
+        pipeline.copy(source_vecs, dest_vecs);
+        pipeline.ghostUpdate(dest_vecs);
+    }
+}
+
 void
 LibMeshSystemVectors::zero(const std::string& vec_name)
 {
@@ -0,0 +1,228 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/MemoryStatistics.h"
+
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/ShutdownRegistry.h"
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+MemoryStatistics* MemoryStatistics::s_memory_statistics_instance = nullptr;
+bool MemoryStatistics::s_registered_callback = false;
+unsigned char MemoryStatistics::s_shutdown_priority = 200;
+bool MemoryStatistics::s_enabled = false;
+
+namespace
+{
+/*!
+ * Return the maximum resident set size of this process in bytes.
+ */
+double
+get_memory_high_water_mark()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0.0;
+#if defined(__APPLE__)
+    // ru_maxrss is measured in bytes on macOS and in kilobytes elsewhere.
+    return static_cast<double>(usage.ru_maxrss);
+#else
+    return 1024.0 * static_cast<double>(usage.ru_maxrss);
+#endif
+} // get_memory_high_water_mark
+} // namespace
+
+MemoryStatistics*
+MemoryStatistics::getManager()
+{
+    if (!s_memory_statistics_instance)
+    {
+        s_memory_statistics_instance = new MemoryStatistics();
+    }
+    if (!s_registered_callback)
+    {
+        ShutdownRegistry::registerShutdownRoutine(freeManager, s_shutdown_priority);
+        s_registered_callback = true;
+    }
+    return s_memory_statistics_instance;
+} // getManager
+
+void
+MemoryStatistics::freeManager()
+{
+    if (s_memory_statistics_instance && s_enabled) s_memory_statistics_instance->printStatistics("end of run", plog);
+    delete s_memory_statistics_instance;
+    s_memory_statistics_instance = nullptr;
+    s_enabled = false;
+    return;
+} // freeManager
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+MemoryStatistics::setOptions(Pointer<Database> input_db)
+{
+    if (!input_db) return;
+    s_enabled = input_db->getBoolWithDefault("enable", true);
+    d_print_at_regrid = input_db->getBoolWithDefault("print_at_regrid", d_print_at_regrid);
+    return;
+} // setOptions
+
+void
+MemoryStatistics::setUsage(const std::string& subsystem_name, const void* owner, const double num_bytes)
+{
+    if (!s_enabled) return;
+    Usage& usage = d_usage[subsystem_name];
+    double& owner_bytes = usage.owner_bytes[owner];
+    usage.current_bytes += num_bytes - owner_bytes;
+    usage.peak_bytes = std::max(usage.peak_bytes, usage.current_bytes);
+    owner_bytes = num_bytes;
+    return;
+} // setUsage
+
+void
+MemoryStatistics::removeUsage(const std::string& subsystem_name, const void* owner)
+{
+    const auto usage_it = d_usage.find(subsystem_name);
+    if (usage_it == d_usage.end()) return;
+    Usage& usage = usage_it->second;
+    const auto owner_it = usage.owner_bytes.find(owner);
+    if (owner_it == usage.owner_bytes.end()) return;
+    usage.current_bytes -= owner_it->second;
+    usage.owner_bytes.erase(owner_it);
+    return;
+} // removeUsage
+
+std::vector<std::string>
+MemoryStatistics::getSubsystemNames() const
+{
+    std::vector<std::string> subsystem_names;
+    for (const auto& usage : d_usage) subsystem_names.push_back(usage.first);
+    return subsystem_names;
+} // getSubsystemNames
+
+double
+MemoryStatistics::getCurrentUsage(const std::string& subsystem_name) const
+{
+    const auto it = d_usage.find(subsystem_name);
+    return it == d_usage.end() ? 0.0 : it->second.current_bytes;
+} // getCurrentUsage
+
+double
+MemoryStatistics::getPeakUsage(const std::string& subsystem_name) const
+{
+    const auto it = d_usage.find(subsystem_name);
+    return it == d_usage.end() ? 0.0 : it->second.peak_bytes;
+} // getPeakUsage
+
+bool
+MemoryStatistics::getPrintAtRegrid() const
+{
+    return d_print_at_regrid;
+} // getPrintAtRegrid
+
+void
+MemoryStatistics::printStatistics(const std::string& label, std::ostream& os) const
+{
+    // Reduce the current and peak usage of each subsystem and the maximum
+    // resident set size of the process (stored last).
+    const std::vector<std::string> subsystem_names = getGlobalSubsystemNames();
+    const int num_rows = static_cast<int>(subsystem_names.size()) + 1;
+    std::vector<double> min_vals(2 * num_rows);
+    for (int k = 0; k + 1 < num_rows; ++k)
+    {
+        min_vals[2 * k] = getCurrentUsage(subsystem_names[k]);
+        min_vals[2 * k + 1] = getPeakUsage(subsystem_names[k]);
+    }
+    min_vals[2 * num_rows - 2] = get_memory_high_water_mark();
+    min_vals[2 * num_rows - 1] = min_vals[2 * num_rows - 2];
+    std::vector<double> max_vals(min_vals), sum_vals(min_vals);
+    IBTK_MPI::minReduction(min_vals.data(), 2 * num_rows);
+    IBTK_MPI::maxReduction(max_vals.data(), 2 * num_rows);
+    IBTK_MPI::sumReduction(sum_vals.data(), 2 * num_rows);
+    if (IBTK_MPI::getRank() != 0) return;
+
+    static const double MB = 1024.0 * 1024.0;
+    const int num_procs = IBTK_MPI::getNodes();
+    os << "MemoryStatistics::printStatistics(): memory usage in MB per process (" << label << ")\n"
+       << "  " << std::setw(24) << std::left << "subsystem" << std::right << std::setw(12) << "current min"
+       << std::setw(12) << "mean" << std::setw(12) << "max" << std::setw(12) << "peak min" << std::setw(12)
+       << "mean" << std::setw(12) << "max"
+       << "\n";
+    for (int k = 0; k < num_rows; ++k)
+    {
+        os << "  " << std::setw(24) << std::left
+           << (k + 1 < num_rows ? subsystem_names[k] : std::string("process (max RSS)")) << std::right;
+        for (int c = 0; c < 2; ++c)
+        {
+            const int idx = 2 * k + c;
+            os << std::setw(12) << min_vals[idx] / MB << std::setw(12) << sum_vals[idx] / num_procs / MB
+               << std::setw(12) << max_vals[idx] / MB;
+        }
+        os << "\n";
+    }
+    os << std::left;
+    return;
+} // printStatistics
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+std::vector<std::string>
+MemoryStatistics::getGlobalSubsystemNames() const
+{
+    // Gather the names of the subsystems of all processes as newline-separated
+    // strings.
+    std::string local_names;
+    for (const auto& usage : d_usage) local_names += usage.first + '\n';
+    const int local_size = static_cast<int>(local_names.size());
+    const int global_size = IBTK_MPI::sumReduction(local_size);
+    std::vector<char> global_names(global_size);
+    IBTK_MPI::allGather(local_names.data(), local_size, global_names.data(), global_size);
+
+    std::set<std::string> subsystem_names;
+    auto name_begin = global_names.begin();
+    while (name_begin != global_names.end())
+    {
+        const auto name_end = std::find(name_begin, global_names.end(), '\n');
+        subsystem_names.emplace(name_begin, name_end);
+        name_begin = name_end == global_names.end() ? name_end : name_end + 1;
+    }
+    return std::vector<std::string>(subsystem_names.begin(), subsystem_names.end());
+} // getGlobalSubsystemNames
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
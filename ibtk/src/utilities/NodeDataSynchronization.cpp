@@ -15,6 +15,7 @@
 
 #include "ibtk/NodeDataSynchronization.h"
 #include "ibtk/NodeSynchCopyFillPattern.h"
+#include "ibtk/PersistentGhostFillSchedule.h"
 
 #include "CartesianGridGeometry.h"
 #include "CoarsenAlgorithm.h"
@@ -24,9 +25,6 @@
 #include "NodeVariable.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
-#include "RefineAlgorithm.h"
-#include "RefineOperator.h"
-#include "RefineSchedule.h"
 #include "Variable.h"
 #include "VariableDatabase.h"
 #include "VariableFillPattern.h"
@@ -127,35 +125,37 @@ NodeDataSynchronization::initializeOperatorState(
         }
     }
 
-    // Setup cached refine algorithms and schedules.
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    // Setup cached synchronization schedules.  These schedules precompute the
+    // shared node-centered indices of the patches of each level and exchange
+    // only those values, with a single message per processor.
+    std::vector<int> data_idxs;
+    for (const auto& transaction_comp : d_transaction_comps)
     {
-        d_refine_alg[axis] = new RefineAlgorithm<NDIM>();
-        for (const auto& transaction_comp : d_transaction_comps)
+        const int data_idx = transaction_comp.d_data_idx;
+        Pointer<Variable<NDIM> > var;
+        var_db->mapIndexToVariable(data_idx, var);
+        Pointer<NodeVariable<NDIM, double> > nc_var = var;
+        if (!nc_var)
         {
-            const int data_idx = transaction_comp.d_data_idx;
-            Pointer<Variable<NDIM> > var;
-            var_db->mapIndexToVariable(data_idx, var);
-            Pointer<NodeVariable<NDIM, double> > nc_var = var;
-            if (!nc_var)
-            {
-                TBOX_ERROR("NodeDataSynchronization::initializeOperatorState():\n"
-                           << "  only double-precision node-centered data is supported." << std::endl);
-            }
-            Pointer<RefineOperator<NDIM> > refine_op = nullptr;
-            Pointer<VariableFillPattern<NDIM> > fill_pattern = new NodeSynchCopyFillPattern(axis);
-            d_refine_alg[axis]->registerRefine(data_idx, // destination
-                                               data_idx, // source
-                                               data_idx, // temporary work space
-                                               refine_op,
-                                               fill_pattern);
+            TBOX_ERROR("NodeDataSynchronization::initializeOperatorState():\n"
+                       << "  only double-precision node-centered data is supported." << std::endl);
         }
+        data_idxs.push_back(data_idx);
+    }
 
-        d_refine_scheds[axis].resize(d_finest_ln + 1);
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        std::vector<Pointer<VariableFillPattern<NDIM> > > fill_patterns;
+        for (unsigned int k = 0; k < data_idxs.size(); ++k)
+        {
+            fill_patterns.push_back(new NodeSynchCopyFillPattern(axis));
+        }
+        d_synch_scheds[axis].resize(d_finest_ln + 1);
         for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
         {
             Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-            d_refine_scheds[axis][ln] = d_refine_alg[axis]->createSchedule(level);
+            d_synch_scheds[axis][ln].reset(
+                new PersistentGhostFillSchedule(level, data_idxs, data_idxs, fill_patterns));
         }
     }
 
@@ -231,33 +231,27 @@ NodeDataSynchronization::resetTransactionComponents(
         }
     }
 
-    // Reset cached refine algorithms and schedules.
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    // Reset cached synchronization schedules.
+    std::vector<int> data_idxs;
+    for (const auto& transaction_comp : d_transaction_comps)
     {
-        d_refine_alg[axis] = new RefineAlgorithm<NDIM>();
-        for (const auto& transaction_comp : d_transaction_comps)
+        const int data_idx = transaction_comp.d_data_idx;
+        Pointer<Variable<NDIM> > var;
+        var_db->mapIndexToVariable(data_idx, var);
+        Pointer<NodeVariable<NDIM, double> > nc_var = var;
+        if (!nc_var)
         {
-            const int data_idx = transaction_comp.d_data_idx;
-            Pointer<Variable<NDIM> > var;
-            var_db->mapIndexToVariable(data_idx, var);
-            Pointer<NodeVariable<NDIM, double> > nc_var = var;
-            if (!nc_var)
-            {
-                TBOX_ERROR("NodeDataSynchronization::resetTransactionComponents():\n"
-                           << "  only double-precision node-centered data is supported." << std::endl);
-            }
-            Pointer<RefineOperator<NDIM> > refine_op = nullptr;
-            Pointer<VariableFillPattern<NDIM> > fill_pattern = new NodeSynchCopyFillPattern(axis);
-            d_refine_alg[axis]->registerRefine(data_idx, // destination
-                                               data_idx, // source
-                                               data_idx, // temporary work space
-                                               refine_op,
-                                               fill_pattern);
+            TBOX_ERROR("NodeDataSynchronization::resetTransactionComponents():\n"
+                       << "  only double-precision node-centered data is supported." << std::endl);
         }
+        data_idxs.push_back(data_idx);
+    }
 
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
         for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
         {
-            d_refine_alg[axis]->resetSchedule(d_refine_scheds[axis][ln]);
+            d_synch_scheds[axis][ln]->setDataIndices(data_idxs, data_idxs);
         }
     }
     return;
@@ -274,8 +268,7 @@ NodeDataSynchronization::deallocateOperatorState()
 
     for (unsigned int axis = 0; axis < NDIM; ++axis)
     {
-        d_refine_alg[axis].setNull();
-        d_refine_scheds[axis].clear();
+        d_synch_scheds[axis].clear();
     }
 
     // Indicate that the operator is NOT initialized.
@@ -296,7 +289,7 @@ NodeDataSynchronization::synchronizeData(const double fill_time)
         // Synchronize data on the current level.
         for (unsigned int axis = 0; axis < NDIM; ++axis)
         {
-            d_refine_scheds[axis][ln]->fillData(fill_time);
+            d_synch_scheds[axis][ln]->fillData(fill_time);
         }
 
         // When appropriate, coarsen data from the current level to the next
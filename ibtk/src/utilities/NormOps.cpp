@@ -16,6 +16,8 @@
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/NormOps.h"
 
+#include "ArrayData.h"
+#include "Box.h"
 #include "CellData.h"
 #include "CellVariable.h"
 #include "IntVector.h"
@@ -27,8 +29,12 @@
 #include "PatchSideDataNormOpsReal.h"
 #include "SAMRAIVectorReal.h"
 #include "SideData.h"
+#include "SideGeometry.h"
 #include "SideVariable.h"
 #include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+#include <mpi.h>
 
 #include <algorithm>
 #include <cmath>
@@ -45,8 +51,6 @@ namespace hier
 {
 template <int DIM>
 class Variable;
-template <int DIM>
-class Box;
 } // namespace hier
 } // namespace SAMRAI
 
@@ -75,6 +79,129 @@ accurate_sum_of_squares(std::vector<double>& vec)
     std::sort(vec.begin(), vec.end(), std::less<double>());
     return std::inner_product(vec.begin(), vec.end(), vec.begin(), 0.0);
 } // accurate_sum_of_squares
+
+// Offsets of the values accumulated for each quantity by NormOps::norms().
+static const int L1_OFFSET = 0;
+static const int L2_SQUARED_OFFSET = 1;
+static const int MAX_OFFSET = 2;
+static const int INTEGRAL_OFFSET = 3;
+static const int NUM_VALUES = 4;
+
+// Accumulate the L1 norm, the square of the L2 norm, the max-norm, and the
+// integral of the data in the box.
+void
+accumulate_norms(double* const values,
+                 const ArrayData<NDIM, double>& data,
+                 const ArrayData<NDIM, double>* const wgt_data,
+                 const Box<NDIM>& box)
+{
+    const int depth = data.getDepth();
+    const bool scalar_wgt = wgt_data && wgt_data->getDepth() == 1;
+    for (Box<NDIM>::Iterator b(box); b; b++)
+    {
+        const hier::Index<NDIM>& i = b();
+        for (int d = 0; d < depth; ++d)
+        {
+            const double w = wgt_data ? (*wgt_data)(i, scalar_wgt ? 0 : d) : 1.0;
+            if (w <= 0.0) continue;
+            const double u = data(i, d);
+            values[L1_OFFSET] += w * std::abs(u);
+            values[L2_SQUARED_OFFSET] += w * u * u;
+            values[MAX_OFFSET] = std::max(values[MAX_OFFSET], std::abs(u));
+            values[INTEGRAL_OFFSET] += w * u;
+        }
+    }
+    return;
+} // accumulate_norms
+
+// Accumulate the local values of a cell- or side-centered quantity on a range
+// of levels.
+void
+accumulate_local_norms(double* const values,
+                       Pointer<PatchHierarchy<NDIM> > hierarchy,
+                       const int data_idx,
+                       const int wgt_idx,
+                       const int coarsest_ln,
+                       const int finest_ln)
+{
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<PatchData<NDIM> > data = patch->getPatchData(data_idx);
+            Pointer<PatchData<NDIM> > wgt_data =
+                (wgt_idx >= 0 ? patch->getPatchData(wgt_idx) : Pointer<PatchData<NDIM> >(nullptr));
+            Pointer<CellData<NDIM, double> > data_cc = data;
+            Pointer<SideData<NDIM, double> > data_sc = data;
+            if (data_cc)
+            {
+                Pointer<CellData<NDIM, double> > wgt_cc = wgt_data;
+                accumulate_norms(
+                    values, data_cc->getArrayData(), wgt_cc ? &wgt_cc->getArrayData() : nullptr, patch_box);
+            }
+            else if (data_sc)
+            {
+                Pointer<SideData<NDIM, double> > wgt_sc = wgt_data;
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    accumulate_norms(values,
+                                     data_sc->getArrayData(axis),
+                                     wgt_sc ? &wgt_sc->getArrayData(axis) : nullptr,
+                                     SideGeometry<NDIM>::toSideBox(patch_box, axis));
+                }
+            }
+            else
+            {
+                TBOX_ERROR("NormOps::norms():\n"
+                           << "  unsupported patch data type for patch data index " << data_idx << "\n"
+                           << "  only cell- and side-centered double-precision data are supported" << std::endl);
+            }
+        }
+    }
+    return;
+} // accumulate_local_norms
+
+// Combine the local values of each quantity computed by all processes with a
+// single collective operation.
+std::vector<NormOps::Norms>
+reduce_norms(const std::vector<double>& local_values, const bool local_only)
+{
+    const int num_quantities = static_cast<int>(local_values.size()) / NUM_VALUES;
+    const int nprocs = local_only ? 1 : IBTK_MPI::getNodes();
+    std::vector<double> values = local_values;
+    if (!local_only && nprocs > 1)
+    {
+        values.resize(local_values.size() * nprocs);
+        const int ierr = MPI_Allgather(local_values.data(),
+                                       static_cast<int>(local_values.size()),
+                                       MPI_DOUBLE,
+                                       values.data(),
+                                       static_cast<int>(local_values.size()),
+                                       MPI_DOUBLE,
+                                       IBTK_MPI::getCommunicator());
+        TBOX_ASSERT(ierr == 0);
+    }
+    std::vector<NormOps::Norms> norms(num_quantities);
+    std::vector<double> L1_proc(nprocs), L2_squared_proc(nprocs), integral_proc(nprocs);
+    for (int k = 0; k < num_quantities; ++k)
+    {
+        for (int proc = 0; proc < nprocs; ++proc)
+        {
+            const double* const proc_values = &values[(proc * num_quantities + k) * NUM_VALUES];
+            L1_proc[proc] = proc_values[L1_OFFSET];
+            L2_squared_proc[proc] = proc_values[L2_SQUARED_OFFSET];
+            norms[k].max = std::max(norms[k].max, proc_values[MAX_OFFSET]);
+            integral_proc[proc] = proc_values[INTEGRAL_OFFSET];
+        }
+        norms[k].L1 = accurate_sum(L1_proc);
+        norms[k].L2 = std::sqrt(accurate_sum(L2_squared_proc));
+        norms[k].integral = accurate_sum(integral_proc);
+    }
+    return norms;
+} // reduce_norms
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -111,6 +238,54 @@ NormOps::maxNorm(const SAMRAIVectorReal<NDIM, double>* const samrai_vector, cons
     return samrai_vector->maxNorm(local_only);
 } // maxNorm
 
+std::vector<NormOps::Norms>
+NormOps::norms(Pointer<PatchHierarchy<NDIM> > hierarchy,
+               const std::vector<int>& data_idxs,
+               const std::vector<int>& wgt_idxs,
+               const int coarsest_ln_in,
+               const int finest_ln_in,
+               const bool local_only)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(hierarchy);
+    TBOX_ASSERT(wgt_idxs.empty() || wgt_idxs.size() == data_idxs.size());
+#endif
+    const int coarsest_ln = coarsest_ln_in == -1 ? 0 : coarsest_ln_in;
+    const int finest_ln = finest_ln_in == -1 ? hierarchy->getFinestLevelNumber() : finest_ln_in;
+    std::vector<double> local_values(NUM_VALUES * data_idxs.size(), 0.0);
+    for (unsigned int k = 0; k < data_idxs.size(); ++k)
+    {
+        accumulate_local_norms(&local_values[NUM_VALUES * k],
+                               hierarchy,
+                               data_idxs[k],
+                               wgt_idxs.empty() ? -1 : wgt_idxs[k],
+                               coarsest_ln,
+                               finest_ln);
+    }
+    return reduce_norms(local_values, local_only);
+} // norms
+
+NormOps::Norms
+NormOps::norms(const SAMRAIVectorReal<NDIM, double>* const samrai_vector, const bool local_only)
+{
+    // All components contribute to the same values.
+    std::vector<double> local_values(NUM_VALUES, 0.0);
+    Pointer<PatchHierarchy<NDIM> > hierarchy = samrai_vector->getPatchHierarchy();
+    const int coarsest_ln = samrai_vector->getCoarsestLevelNumber();
+    const int finest_ln = samrai_vector->getFinestLevelNumber();
+    const int ncomp = samrai_vector->getNumberOfComponents();
+    for (int comp = 0; comp < ncomp; ++comp)
+    {
+        accumulate_local_norms(local_values.data(),
+                               hierarchy,
+                               samrai_vector->getComponentDescriptorIndex(comp),
+                               samrai_vector->getControlVolumeIndex(comp),
+                               coarsest_ln,
+                               finest_ln);
+    }
+    return reduce_norms(local_values, local_only)[0];
+} // norms
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -22,6 +22,9 @@
 #include "IntVector.h"
 #include "tbox/Pointer.h"
 
+#include <mpi.h>
+
+#include <cstddef>
 #include <map>
 #include <utility>
 #include <vector>
@@ -34,13 +37,161 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Tag used by the sparse exchanges of distributed maps.  Each exchange uses its
+// own duplicate of the communicator, so messages from different exchanges (or
+// from other code using the same tag) cannot be confused.
+static const int SPARSE_EXCHANGE_TAG = 0;
+
+/*!
+ * Send each buffer to the process it is associated with and return the buffers
+ * received from other processes, indexed by the sending process.  The number of
+ * messages that will be received is not known in advance, so this uses the
+ * non-blocking consensus algorithm of Hoefler, Siebert, and Lumsdaine (PPoPP
+ * 2010), which only communicates with the processes that actually exchange data
+ * (plus a non-blocking barrier).  Messages received from the same process are
+ * concatenated.
+ *
+ * \note This function must be called on all processes.
+ */
+std::map<int, std::vector<char> >
+sparse_exchange(const std::map<int, std::vector<char> >& send_buffers)
+{
+    // Processes that finish this exchange may start the next one while other
+    // processes are still probing for messages, so each exchange communicates
+    // on its own communicator.
+    IBTK_MPI::comm communicator = MPI_COMM_NULL;
+    MPI_Comm_dup(IBTK_MPI::getCommunicator(), &communicator);
+    const int rank = IBTK_MPI::getRank();
+    std::map<int, std::vector<char> > recv_buffers;
+    std::vector<MPI_Request> send_requests;
+    send_requests.reserve(send_buffers.size());
+    for (const auto& send_buffer : send_buffers)
+    {
+        if (send_buffer.first == rank)
+        {
+            std::vector<char>& buffer = recv_buffers[rank];
+            buffer.insert(buffer.end(), send_buffer.second.begin(), send_buffer.second.end());
+            continue;
+        }
+        send_requests.push_back(MPI_REQUEST_NULL);
+        MPI_Issend(send_buffer.second.data(),
+                   static_cast<int>(send_buffer.second.size()),
+                   MPI_CHAR,
+                   send_buffer.first,
+                   SPARSE_EXCHANGE_TAG,
+                   communicator,
+                   &send_requests.back());
+    }
+
+    MPI_Request barrier_request = MPI_REQUEST_NULL;
+    bool barrier_active = false;
+    int done = 0;
+    while (!done)
+    {
+        int flag = 0;
+        MPI_Status status;
+        MPI_Iprobe(MPI_ANY_SOURCE, SPARSE_EXCHANGE_TAG, communicator, &flag, &status);
+        if (flag)
+        {
+            int count = 0;
+            MPI_Get_count(&status, MPI_CHAR, &count);
+            std::vector<char>& buffer = recv_buffers[status.MPI_SOURCE];
+            const std::size_t offset = buffer.size();
+            buffer.resize(offset + count);
+            MPI_Recv(buffer.data() + offset,
+                     count,
+                     MPI_CHAR,
+                     status.MPI_SOURCE,
+                     SPARSE_EXCHANGE_TAG,
+                     communicator,
+                     MPI_STATUS_IGNORE);
+        }
+        if (barrier_active)
+        {
+            MPI_Test(&barrier_request, &done, MPI_STATUS_IGNORE);
+        }
+        else
+        {
+            // Once all of our (synchronous) sends have been matched, enter the
+            // barrier; it completes once all processes have done so.
+            int sends_done = 0;
+            MPI_Testall(static_cast<int>(send_requests.size()), send_requests.data(), &sends_done, MPI_STATUSES_IGNORE);
+            if (sends_done)
+            {
+                MPI_Ibarrier(communicator, &barrier_request);
+                barrier_active = true;
+            }
+        }
+    }
+    MPI_Comm_free(&communicator);
+    return recv_buffers;
+} // sparse_exchange
+
+/*!
+ * Pack keys and (optionally) the corresponding items into a buffer.
+ */
+void
+pack_keys_and_items(std::vector<char>& buffer,
+                    const std::vector<int>& keys,
+                    std::vector<tbox::Pointer<Streamable> >& items,
+                    const bool pack_items)
+{
+    StreamableManager* streamable_manager = StreamableManager::getManager();
+    const int num_keys = static_cast<int>(keys.size());
+    int data_size = static_cast<int>(tbox::AbstractStream::sizeofInt() * (1 + keys.size()));
+    if (pack_items && num_keys > 0) data_size += static_cast<int>(streamable_manager->getDataStreamSize(items));
+    FixedSizedStream stream(data_size);
+    stream.pack(&num_keys, 1);
+    if (num_keys > 0) stream.pack(keys.data(), num_keys);
+    if (pack_items && num_keys > 0) streamable_manager->packStream(stream, items);
+    const char* const buffer_start = static_cast<const char*>(stream.getBufferStart());
+    buffer.insert(buffer.end(), buffer_start, buffer_start + stream.getCurrentSize());
+    return;
+} // pack_keys_and_items
+
+/*!
+ * Unpack keys and (optionally) the corresponding items from a stream.
+ */
+void
+unpack_keys_and_items(FixedSizedStream& stream,
+                      std::vector<int>& keys,
+                      std::vector<tbox::Pointer<Streamable> >& items,
+                      const bool unpack_items)
+{
+    int num_keys = 0;
+    stream.unpack(&num_keys, 1);
+    keys.resize(num_keys);
+    items.clear();
+    if (num_keys == 0) return;
+    stream.unpack(keys.data(), num_keys);
+    if (unpack_items)
+    {
+        hier::IntVector<NDIM> offset = 0;
+        StreamableManager::getManager()->unpackStream(stream, offset, items);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(keys.size() == items.size());
+#endif
+    }
+    return;
+} // unpack_keys_and_items
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
+ParallelMap::ParallelMap(const bool distributed) : d_distributed(distributed)
+{
+    // intentionally blank
+    return;
+} // ParallelMap
+
 ParallelMap&
 ParallelMap::operator=(const ParallelMap& that)
 {
     if (this != &that)
     {
+        d_distributed = that.d_distributed;
         d_map = that.d_map;
         d_pending_additions = that.d_pending_additions;
         d_pending_removals = that.d_pending_removals;
@@ -65,6 +216,12 @@ ParallelMap::removeItem(const int key)
 void
 ParallelMap::communicateData()
 {
+    if (d_distributed)
+    {
+        communicateDataDistributed();
+        return;
+    }
+
     const int size = IBTK_MPI::getNodes();
     const int rank = IBTK_MPI::getRank();
 
@@ -194,8 +351,142 @@ ParallelMap::getMap() const
     return d_map;
 } // getMap
 
+bool
+ParallelMap::isDistributed() const
+{
+    return d_distributed;
+} // isDistributed
+
+int
+ParallelMap::getOwner(const int key) const
+{
+    // Use a multiplicative hash so that consecutive keys are spread over all
+    // processes.
+    const unsigned int hash = static_cast<unsigned int>(key) * 2654435761U;
+    return static_cast<int>(hash % static_cast<unsigned int>(IBTK_MPI::getNodes()));
+} // getOwner
+
+std::map<int, SAMRAI::tbox::Pointer<Streamable> >
+ParallelMap::lookupItems(const std::vector<int>& keys) const
+{
+    std::map<int, tbox::Pointer<Streamable> > items;
+    if (!d_distributed)
+    {
+        for (const auto& key : keys)
+        {
+            const auto it = d_map.find(key);
+            if (it != d_map.end()) items.insert(*it);
+        }
+        return items;
+    }
+
+    // Send the requested keys to the processes that own them.
+    std::map<int, std::vector<int> > requested_keys;
+    for (const auto& key : keys) requested_keys[getOwner(key)].push_back(key);
+    std::map<int, std::vector<char> > request_buffers;
+    std::vector<tbox::Pointer<Streamable> > no_items;
+    for (const auto& owner_keys : requested_keys)
+    {
+        pack_keys_and_items(request_buffers[owner_keys.first], owner_keys.second, no_items, false);
+    }
+    const std::map<int, std::vector<char> > received_requests = sparse_exchange(request_buffers);
+
+    // Reply with the locally owned items.
+    std::map<int, std::vector<char> > reply_buffers;
+    for (const auto& request : received_requests)
+    {
+        const int request_size = static_cast<int>(request.second.size());
+        FixedSizedStream stream(request.second.data(), request_size);
+        std::vector<int> keys_found;
+        std::vector<tbox::Pointer<Streamable> > items_found;
+        while (stream.getCurrentIndex() < request_size)
+        {
+            std::vector<int> keys_received;
+            unpack_keys_and_items(stream, keys_received, no_items, false);
+            for (const auto& key : keys_received)
+            {
+                const auto it = d_map.find(key);
+                if (it == d_map.end()) continue;
+                keys_found.push_back(it->first);
+                items_found.push_back(it->second);
+            }
+        }
+        pack_keys_and_items(reply_buffers[request.first], keys_found, items_found, true);
+    }
+    const std::map<int, std::vector<char> > received_replies = sparse_exchange(reply_buffers);
+    for (const auto& reply : received_replies)
+    {
+        const int reply_size = static_cast<int>(reply.second.size());
+        FixedSizedStream stream(reply.second.data(), reply_size);
+        while (stream.getCurrentIndex() < reply_size)
+        {
+            std::vector<int> keys_received;
+            std::vector<tbox::Pointer<Streamable> > items_received;
+            unpack_keys_and_items(stream, keys_received, items_received, true);
+            for (unsigned int k = 0; k < keys_received.size(); ++k)
+            {
+                items[keys_received[k]] = items_received[k];
+            }
+        }
+    }
+    return items;
+} // lookupItems
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+ParallelMap::communicateDataDistributed()
+{
+    // Sort the pending additions and removals by the processes that own the
+    // keys.
+    std::map<int, std::vector<int> > addition_keys, removal_keys;
+    std::map<int, std::vector<tbox::Pointer<Streamable> > > addition_items;
+    for (const auto& pending_addition : d_pending_additions)
+    {
+        const int owner = getOwner(pending_addition.first);
+        addition_keys[owner].push_back(pending_addition.first);
+        addition_items[owner].push_back(pending_addition.second);
+    }
+    for (const auto& key : d_pending_removals) removal_keys[getOwner(key)].push_back(key);
+    d_pending_additions.clear();
+    d_pending_removals.clear();
+
+    // Send the additions and removals only to the processes that own the keys.
+    std::map<int, std::vector<char> > send_buffers;
+    for (const auto& owner_keys : addition_keys) send_buffers[owner_keys.first];
+    for (const auto& owner_keys : removal_keys) send_buffers[owner_keys.first];
+    for (auto& send_buffer : send_buffers)
+    {
+        const int owner = send_buffer.first;
+        pack_keys_and_items(send_buffer.second, addition_keys[owner], addition_items[owner], true);
+        pack_keys_and_items(send_buffer.second, removal_keys[owner], addition_items[owner], false);
+    }
+    const std::map<int, std::vector<char> > recv_buffers = sparse_exchange(send_buffers);
+
+    // Update the locally owned items.  As in the replicated case, all additions
+    // are processed before any removals.
+    std::vector<int> keys_to_remove;
+    for (const auto& recv_buffer : recv_buffers)
+    {
+        const int recv_size = static_cast<int>(recv_buffer.second.size());
+        FixedSizedStream stream(recv_buffer.second.data(), recv_size);
+        while (stream.getCurrentIndex() < recv_size)
+        {
+            std::vector<int> keys_received;
+            std::vector<tbox::Pointer<Streamable> > items_received;
+            unpack_keys_and_items(stream, keys_received, items_received, true);
+            for (unsigned int k = 0; k < keys_received.size(); ++k)
+            {
+                d_map[keys_received[k]] = items_received[k];
+            }
+            unpack_keys_and_items(stream, keys_received, items_received, false);
+            keys_to_remove.insert(keys_to_remove.end(), keys_received.begin(), keys_received.end());
+        }
+    }
+    for (const auto& key : keys_to_remove) d_map.erase(key);
+    return;
+} // communicateDataDistributed
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
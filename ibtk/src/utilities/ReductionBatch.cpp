@@ -0,0 +1,129 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/ReductionBatch.h"
+
+#include "tbox/Utilities.h"
+
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+ReductionBatch::ReductionBatch(IBTK_MPI::comm communicator) : d_communicator(communicator)
+{
+    // intentionally blank
+    return;
+} // ReductionBatch
+
+ReductionBatch::~ReductionBatch()
+{
+    if (d_started) finish();
+    return;
+} // ~ReductionBatch
+
+void
+ReductionBatch::addMin(double* const x)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(x);
+    TBOX_ASSERT(!d_started);
+#endif
+    d_min_max_values.push_back(x);
+    d_min_max_sign.push_back(-1.0);
+    return;
+} // addMin
+
+void
+ReductionBatch::addMax(double* const x)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(x);
+    TBOX_ASSERT(!d_started);
+#endif
+    d_min_max_values.push_back(x);
+    d_min_max_sign.push_back(1.0);
+    return;
+} // addMax
+
+void
+ReductionBatch::addSum(double* const x)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(x);
+    TBOX_ASSERT(!d_started);
+#endif
+    d_sum_values.push_back(x);
+    return;
+} // addSum
+
+void
+ReductionBatch::start()
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!d_started);
+#endif
+    const int num_min_max = static_cast<int>(d_min_max_values.size());
+    d_min_max_buffer.resize(num_min_max);
+    for (int k = 0; k < num_min_max; ++k) d_min_max_buffer[k] = d_min_max_sign[k] * (*d_min_max_values[k]);
+    d_min_max_request = IBTK_MPI::imaxReduction(d_min_max_buffer.data(), num_min_max, d_communicator);
+
+    const int num_sum = static_cast<int>(d_sum_values.size());
+    d_sum_buffer.resize(num_sum);
+    for (int k = 0; k < num_sum; ++k) d_sum_buffer[k] = *d_sum_values[k];
+    d_sum_request = IBTK_MPI::isumReduction(d_sum_buffer.data(), num_sum, d_communicator);
+
+    d_started = true;
+    return;
+} // start
+
+void
+ReductionBatch::finish()
+{
+    if (!d_started) start();
+    IBTK_MPI::wait(d_min_max_request);
+    IBTK_MPI::wait(d_sum_request);
+    for (unsigned int k = 0; k < d_min_max_values.size(); ++k)
+    {
+        *d_min_max_values[k] = d_min_max_sign[k] * d_min_max_buffer[k];
+    }
+    for (unsigned int k = 0; k < d_sum_values.size(); ++k)
+    {
+        *d_sum_values[k] = d_sum_buffer[k];
+    }
+    d_min_max_values.clear();
+    d_min_max_sign.clear();
+    d_sum_values.clear();
+    d_started = false;
+    return;
+} // finish
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
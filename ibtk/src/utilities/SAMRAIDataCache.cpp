@@ -13,6 +13,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibtk/MemoryStatistics.h"
 #include "ibtk/SAMRAIDataCache.h"
 #include "ibtk/ibtk_utilities.h"
 
@@ -33,13 +34,20 @@
 #include "OuternodeVariable.h"
 #include "OutersideDataFactory.h"
 #include "OutersideVariable.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
 #include "PatchLevel.h"
 #include "SideDataFactory.h"
 #include "SideVariable.h"
 #include "Variable.h"
 #include "VariableDatabase.h"
+#include "tbox/Arena.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <ostream>
 #include <utility>
 
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -142,6 +150,18 @@ get_data_characteristics(const int idx, int& depth, int& ghost_width)
     ghost_width = characteristics.second;
     return convertable;
 }
+
+double
+get_level_data_bytes(Pointer<PatchLevel<NDIM> > level, const int idx)
+{
+    Pointer<PatchDataFactory<NDIM> > factory = level->getPatchDescriptor()->getPatchDataFactory(idx);
+    double num_bytes = 0.0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        num_bytes += static_cast<double>(factory->getSizeOfMemory(level->getPatch(p())->getBox()));
+    }
+    return num_bytes;
+}
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -154,6 +174,7 @@ SAMRAIDataCache::~SAMRAIDataCache()
     {
         var_db->removePatchDataIndex(cloned_idx);
     }
+    if (MemoryStatistics::enabled()) MemoryStatistics::getManager()->removeUsage("samrai_data_cache", this);
 }
 
 void
@@ -167,13 +188,14 @@ SAMRAIDataCache::setPatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy)
         {
             for (auto ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
             {
-                Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-                if (level->checkAllocated(cloned_idx)) level->deallocatePatchData(cloned_idx);
+                deallocateLevelData(cloned_idx, ln);
             }
         }
     }
+    if (d_pool) d_pool->releaseFreeBlocks();
     d_hierarchy = hierarchy;
     if (!hierarchy) resetLevels(IBTK::invalid_level_number, IBTK::invalid_level_number);
+    if (MemoryStatistics::enabled()) updateMemoryUsage();
 }
 
 void
@@ -192,18 +214,18 @@ SAMRAIDataCache::resetLevels(const int coarsest_ln, const int finest_ln)
         {
             for (auto ln = d_coarsest_ln; ln < coarsest_ln; ++ln)
             {
-                Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-                if (level->checkAllocated(cloned_idx)) level->deallocatePatchData(cloned_idx);
+                deallocateLevelData(cloned_idx, ln);
             }
             for (auto ln = finest_ln + 1; ln <= d_finest_ln; ++ln)
             {
-                Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-                if (level->checkAllocated(cloned_idx)) level->deallocatePatchData(cloned_idx);
+                deallocateLevelData(cloned_idx, ln);
             }
         }
     }
+    if (d_pool) d_pool->releaseFreeBlocks();
     d_coarsest_ln = coarsest_ln;
     d_finest_ln = finest_ln;
+    if (MemoryStatistics::enabled()) updateMemoryUsage();
 }
 
 int
@@ -218,6 +240,31 @@ SAMRAIDataCache::getFinestLevelNumber() const
     return d_finest_ln;
 } // getFinestLevelNumber
 
+void
+SAMRAIDataCache::setUsePooledAllocation(const bool use_pooled_allocation)
+{
+    d_use_pooled_allocation = use_pooled_allocation;
+    if (d_use_pooled_allocation && !d_pool) d_pool = new PatchDataPool();
+    if (!d_use_pooled_allocation && d_pool) d_pool->releaseFreeBlocks();
+    return;
+} // setUsePooledAllocation
+
+void
+SAMRAIDataCache::printMemoryUsage(std::ostream& os) const
+{
+    auto var_db = VariableDatabase<NDIM>::getDatabase();
+    for (const auto& idx_bytes : d_pooled_bytes)
+    {
+        Pointer<Variable<NDIM> > var;
+        var_db->mapIndexToVariable(idx_bytes.first, var);
+        os << "SAMRAIDataCache: patch data index " << idx_bytes.first << " (" << (var ? var->getName() : "unknown")
+           << "): current = " << idx_bytes.second.first << " bytes, peak = " << idx_bytes.second.second
+           << " bytes\n";
+    }
+    if (d_pool) os << "SAMRAIDataCache: total pooled memory in use = " << d_pool->getBytesInUse() << " bytes\n";
+    return;
+} // printMemoryUsage
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 int
@@ -253,8 +300,7 @@ SAMRAIDataCache::lookupCachedPatchDataIndex(const int idx)
     // Allocate data if needed.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        if (!level->checkAllocated(cloned_idx)) level->allocatePatchData(cloned_idx);
+        allocateLevelData(cloned_idx, ln);
     }
     return cloned_idx;
 }
@@ -280,9 +326,68 @@ SAMRAIDataCache::restoreCachedPatchDataIndex(const int cached_idx)
     }
     d_available_data_idx_map.emplace(data_descriptor, cached_idx);
     d_unavailable_data_idx_map.erase(it);
+
+    // In pooled mode, return the memory to the pool so that it can be used by the next request.
+    if (d_use_pooled_allocation)
+    {
+        for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+        {
+            deallocateLevelData(cached_idx, ln);
+        }
+    }
     return;
 }
 
+void
+SAMRAIDataCache::allocateLevelData(const int cloned_idx, const int ln)
+{
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+    if (level->checkAllocated(cloned_idx)) return;
+    if (MemoryStatistics::enabled()) d_allocated_bytes += get_level_data_bytes(level, cloned_idx);
+    if (d_use_pooled_allocation)
+    {
+        const std::size_t bytes_in_use = d_pool->getBytesInUse();
+        level->allocatePatchData(cloned_idx, 0.0, d_pool);
+        std::pair<std::size_t, std::size_t>& bytes = d_pooled_bytes[cloned_idx];
+        bytes.first += d_pool->getBytesInUse() - bytes_in_use;
+        bytes.second = std::max(bytes.second, bytes.first);
+    }
+    else
+    {
+        level->allocatePatchData(cloned_idx);
+    }
+    if (MemoryStatistics::enabled()) updateMemoryUsage();
+    return;
+} // allocateLevelData
+
+void
+SAMRAIDataCache::deallocateLevelData(const int cloned_idx, const int ln)
+{
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+    if (!level->checkAllocated(cloned_idx)) return;
+    if (MemoryStatistics::enabled())
+    {
+        d_allocated_bytes = std::max(d_allocated_bytes - get_level_data_bytes(level, cloned_idx), 0.0);
+    }
+    const std::size_t bytes_in_use = d_pool ? d_pool->getBytesInUse() : 0;
+    level->deallocatePatchData(cloned_idx);
+    if (d_pool)
+    {
+        std::pair<std::size_t, std::size_t>& bytes = d_pooled_bytes[cloned_idx];
+        bytes.first -= std::min(bytes.first, bytes_in_use - d_pool->getBytesInUse());
+    }
+    if (MemoryStatistics::enabled()) updateMemoryUsage();
+    return;
+} // deallocateLevelData
+
+void
+SAMRAIDataCache::updateMemoryUsage()
+{
+    const double free_list_bytes = d_pool ? static_cast<double>(d_pool->getBytesOnFreeLists()) : 0.0;
+    MemoryStatistics::getManager()->setUsage("samrai_data_cache", this, d_allocated_bytes + free_list_bytes);
+    return;
+} // updateMemoryUsage
+
 SAMRAIDataCache::key_type
 SAMRAIDataCache::construct_data_descriptor(const int idx)
 {
@@ -303,6 +408,72 @@ SAMRAIDataCache::construct_data_descriptor(const int idx)
     return SAMRAIDataCache::key_type{ var_type_id, depth, ghost_width };
 }
 
+SAMRAIDataCache::PatchDataPool::~PatchDataPool()
+{
+    releaseFreeBlocks();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_used_blocks.empty());
+#endif
+}
+
+void*
+SAMRAIDataCache::PatchDataPool::alloc(const size_t bytes)
+{
+    void* p = nullptr;
+    auto it = d_free_blocks.find(bytes);
+    if (it != d_free_blocks.end())
+    {
+        p = it->second;
+        d_free_blocks.erase(it);
+    }
+    else
+    {
+        p = ::operator new(bytes);
+    }
+    d_used_blocks.emplace(p, bytes);
+    d_bytes_in_use += bytes;
+    return p;
+} // alloc
+
+void
+SAMRAIDataCache::PatchDataPool::free(void* const p)
+{
+    if (!p) return;
+    auto it = d_used_blocks.find(p);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(it != d_used_blocks.end());
+#endif
+    d_bytes_in_use -= it->second;
+    d_free_blocks.emplace(it->second, p);
+    d_used_blocks.erase(it);
+    return;
+} // free
+
+void
+SAMRAIDataCache::PatchDataPool::releaseFreeBlocks()
+{
+    for (const auto& size_block : d_free_blocks)
+    {
+        ::operator delete(size_block.second);
+    }
+    d_free_blocks.clear();
+    return;
+} // releaseFreeBlocks
+
+std::size_t
+SAMRAIDataCache::PatchDataPool::getBytesInUse() const
+{
+    return d_bytes_in_use;
+} // getBytesInUse
+
+std::size_t
+SAMRAIDataCache::PatchDataPool::getBytesOnFreeLists() const
+{
+    std::size_t num_bytes = 0;
+    for (const auto& size_block : d_free_blocks) num_bytes += size_block.first;
+    return num_bytes;
+} // getBytesOnFreeLists
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
@@ -0,0 +1,192 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/SAMRAIFischerGuess.h"
+#include "ibtk/ibtk_utilities.h"
+
+#include "SAMRAIVectorReal.h"
+#include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
+#include "tbox/Utilities.h"
+
+IBTK_DISABLE_EXTRA_WARNINGS
+#include <Eigen/Dense>
+IBTK_ENABLE_EXTRA_WARNINGS
+
+#include <algorithm>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Timers.
+static Timer* t_submit;
+static Timer* t_guess;
+
+// SAMRAI's vector operations take non-const Pointer arguments even when the
+// vector is not modified.
+inline Pointer<SAMRAIVectorReal<NDIM, double> >
+wrap(const SAMRAIVectorReal<NDIM, double>& v)
+{
+    return Pointer<SAMRAIVectorReal<NDIM, double> >(const_cast<SAMRAIVectorReal<NDIM, double>*>(&v), false);
+}
+
+Pointer<SAMRAIVectorReal<NDIM, double> >
+allocate_copy(const SAMRAIVectorReal<NDIM, double>& v)
+{
+    Pointer<SAMRAIVectorReal<NDIM, double> > copy = v.cloneVector("");
+    copy->allocateVectorData();
+    copy->copyVector(wrap(v));
+    return copy;
+}
+
+void
+deallocate(Pointer<SAMRAIVectorReal<NDIM, double> >& v)
+{
+    v->deallocateVectorData();
+    v->freeVectorComponents();
+    v.setNull();
+}
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+SAMRAIFischerGuess::SAMRAIFischerGuess(const int n_vectors) : d_n_max_vectors(n_vectors)
+{
+    TBOX_ASSERT(d_n_max_vectors >= 0);
+    IBTK_DO_ONCE(t_submit = TimerManager::getManager()->getTimer("IBTK::SAMRAIFischerGuess::submit()");
+                 t_guess = TimerManager::getManager()->getTimer("IBTK::SAMRAIFischerGuess::guess()"););
+    return;
+} // SAMRAIFischerGuess
+
+SAMRAIFischerGuess::~SAMRAIFischerGuess()
+{
+    clear();
+    return;
+} // ~SAMRAIFischerGuess
+
+void
+SAMRAIFischerGuess::submit(const SAMRAIVectorReal<NDIM, double>& solution, const SAMRAIVectorReal<NDIM, double>& rhs)
+{
+    if (d_n_max_vectors == 0) return;
+    IBTK_TIMER_START(t_submit);
+    if (d_n_stored_vectors == d_n_max_vectors)
+    {
+        // Reuse the storage of the oldest pair for the new pair.
+        std::rotate(d_solutions.begin(), d_solutions.begin() + 1, d_solutions.end());
+        d_solutions.back()->copyVector(wrap(solution));
+        std::rotate(d_rhs.begin(), d_rhs.begin() + 1, d_rhs.end());
+        d_rhs.back()->copyVector(wrap(rhs));
+
+        // Shift the computed inner products up and to the left.
+        const Eigen::MatrixXd mat_copy(d_correlation_matrix);
+        d_correlation_matrix.topLeftCorner(d_n_max_vectors - 1, d_n_max_vectors - 1) =
+            mat_copy.bottomRightCorner(d_n_max_vectors - 1, d_n_max_vectors - 1);
+    }
+    else
+    {
+        ++d_n_stored_vectors;
+        d_solutions.push_back(allocate_copy(solution));
+        d_rhs.push_back(allocate_copy(rhs));
+        d_correlation_matrix.conservativeResize(d_n_stored_vectors, d_n_stored_vectors);
+    }
+
+    // Compute the last row and then copy it into the last column.
+    for (int j = 0; j < d_n_stored_vectors; ++j)
+    {
+        const double inner = d_rhs.back()->dot(d_rhs[j]);
+        d_correlation_matrix(d_n_stored_vectors - 1, j) = inner;
+        d_correlation_matrix(j, d_n_stored_vectors - 1) = inner;
+    }
+    IBTK_TIMER_STOP(t_submit);
+    return;
+} // submit
+
+void
+SAMRAIFischerGuess::guess(SAMRAIVectorReal<NDIM, double>& solution, const SAMRAIVectorReal<NDIM, double>& rhs) const
+{
+    if (d_n_stored_vectors == 0) return;
+    IBTK_TIMER_START(t_guess);
+    const Eigen::VectorXd coefs = computeCoefficients(rhs);
+    solution.scale(coefs(0), d_solutions[0]);
+    for (int i = 1; i < d_n_stored_vectors; ++i)
+    {
+        solution.axpy(coefs(i), d_solutions[i], wrap(solution));
+    }
+    IBTK_TIMER_STOP(t_guess);
+    return;
+} // guess
+
+void
+SAMRAIFischerGuess::correct(SAMRAIVectorReal<NDIM, double>& solution,
+                            const SAMRAIVectorReal<NDIM, double>& residual) const
+{
+    if (d_n_stored_vectors == 0) return;
+    IBTK_TIMER_START(t_guess);
+    const Eigen::VectorXd coefs = computeCoefficients(residual);
+    for (int i = 0; i < d_n_stored_vectors; ++i)
+    {
+        solution.axpy(coefs(i), d_solutions[i], wrap(solution));
+    }
+    IBTK_TIMER_STOP(t_guess);
+    return;
+} // correct
+
+void
+SAMRAIFischerGuess::clear()
+{
+    for (auto& solution : d_solutions) deallocate(solution);
+    for (auto& rhs : d_rhs) deallocate(rhs);
+    d_solutions.clear();
+    d_rhs.clear();
+    d_correlation_matrix.resize(0, 0);
+    d_n_stored_vectors = 0;
+    return;
+} // clear
+
+int
+SAMRAIFischerGuess::getNumberOfStoredVectors() const
+{
+    return d_n_stored_vectors;
+} // getNumberOfStoredVectors
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+Eigen::VectorXd
+SAMRAIFischerGuess::computeCoefficients(const SAMRAIVectorReal<NDIM, double>& rhs) const
+{
+    Eigen::VectorXd coef_rhs(d_n_stored_vectors);
+    for (int i = 0; i < d_n_stored_vectors; ++i)
+    {
+        coef_rhs(i) = d_rhs[i]->dot(wrap(rhs));
+    }
+
+    // As in FischerGuess, the least-squares problem is solved with the SVD so
+    // that the correlation matrix may be singular (or nearly so).
+    return d_correlation_matrix.jacobiSvd(Eigen::ComputeThinU | Eigen::ComputeThinV).solve(coef_rhs);
+} // computeCoefficients
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
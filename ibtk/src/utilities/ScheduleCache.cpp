@@ -0,0 +1,147 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/ScheduleCache.h"
+
+#include "CoarsenAlgorithm.h"
+#include "CoarsenPatchStrategy.h"
+#include "CoarsenSchedule.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "RefineAlgorithm.h"
+#include "RefinePatchStrategy.h"
+#include "RefineSchedule.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+Pointer<RefineSchedule<NDIM> >
+ScheduleCache::getRefineSchedule(Pointer<RefineAlgorithm<NDIM> > refine_alg,
+                                 Pointer<PatchLevel<NDIM> > dst_level,
+                                 Pointer<PatchLevel<NDIM> > src_level,
+                                 RefinePatchStrategy<NDIM>* patch_strategy)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(refine_alg);
+    TBOX_ASSERT(dst_level);
+    TBOX_ASSERT(src_level);
+#endif
+    const RefineKey key(dst_level.getPointer(), src_level.getPointer(), -1, nullptr, patch_strategy);
+    Entry<RefineSchedule<NDIM> >& entry = d_refine_schedules[key];
+    for (const auto& schedule : entry.schedules)
+    {
+        if (refine_alg->checkConsistency(schedule))
+        {
+            refine_alg->resetSchedule(schedule);
+            return schedule;
+        }
+    }
+    if (entry.levels.empty()) entry.levels = { dst_level, src_level };
+    entry.schedules.push_back(
+        refine_alg->createSchedule("DEFAULT_FILL", dst_level, src_level, patch_strategy, false, nullptr));
+    return entry.schedules.back();
+} // getRefineSchedule
+
+Pointer<RefineSchedule<NDIM> >
+ScheduleCache::getRefineSchedule(Pointer<RefineAlgorithm<NDIM> > refine_alg,
+                                 Pointer<PatchLevel<NDIM> > dst_level,
+                                 Pointer<PatchLevel<NDIM> > src_level,
+                                 const int next_coarser_ln,
+                                 Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                 RefinePatchStrategy<NDIM>* patch_strategy)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(refine_alg);
+    TBOX_ASSERT(dst_level);
+    TBOX_ASSERT(hierarchy);
+#endif
+    const RefineKey key(
+        dst_level.getPointer(), src_level.getPointer(), next_coarser_ln, hierarchy.getPointer(), patch_strategy);
+    Entry<RefineSchedule<NDIM> >& entry = d_refine_schedules[key];
+    for (const auto& schedule : entry.schedules)
+    {
+        if (refine_alg->checkConsistency(schedule))
+        {
+            refine_alg->resetSchedule(schedule);
+            return schedule;
+        }
+    }
+    if (entry.levels.empty())
+    {
+        entry.levels.push_back(dst_level);
+        if (src_level) entry.levels.push_back(src_level);
+        for (int ln = 0; ln <= next_coarser_ln; ++ln) entry.levels.push_back(hierarchy->getPatchLevel(ln));
+    }
+    entry.schedules.push_back(
+        refine_alg->createSchedule(dst_level, src_level, next_coarser_ln, hierarchy, patch_strategy));
+    return entry.schedules.back();
+} // getRefineSchedule
+
+Pointer<CoarsenSchedule<NDIM> >
+ScheduleCache::getCoarsenSchedule(Pointer<CoarsenAlgorithm<NDIM> > coarsen_alg,
+                                  Pointer<PatchLevel<NDIM> > coarse_level,
+                                  Pointer<PatchLevel<NDIM> > fine_level,
+                                  CoarsenPatchStrategy<NDIM>* patch_strategy)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(coarsen_alg);
+    TBOX_ASSERT(coarse_level);
+    TBOX_ASSERT(fine_level);
+#endif
+    const CoarsenKey key(coarse_level.getPointer(), fine_level.getPointer(), patch_strategy);
+    Entry<CoarsenSchedule<NDIM> >& entry = d_coarsen_schedules[key];
+    for (const auto& schedule : entry.schedules)
+    {
+        if (coarsen_alg->checkConsistency(schedule))
+        {
+            coarsen_alg->resetSchedule(schedule);
+            return schedule;
+        }
+    }
+    if (entry.levels.empty()) entry.levels = { coarse_level, fine_level };
+    entry.schedules.push_back(coarsen_alg->createSchedule(coarse_level, fine_level, patch_strategy));
+    return entry.schedules.back();
+} // getCoarsenSchedule
+
+void
+ScheduleCache::clear()
+{
+    d_refine_schedules.clear();
+    d_coarsen_schedules.clear();
+    return;
+} // clear
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -14,6 +14,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include "ibtk/CartSideDoubleCubicCoarsen.h"
+#include "ibtk/PersistentGhostFillSchedule.h"
 #include "ibtk/SideDataSynchronization.h"
 #include "ibtk/SideSynchCopyFillPattern.h"
 
@@ -24,9 +25,6 @@
 #include "CoarsenSchedule.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
-#include "RefineAlgorithm.h"
-#include "RefineOperator.h"
-#include "RefineSchedule.h"
 #include "SideVariable.h"
 #include "Variable.h"
 #include "VariableDatabase.h"
@@ -131,8 +129,11 @@ SideDataSynchronization::initializeOperatorState(
         }
     }
 
-    // Setup cached refine algorithms and schedules.
-    d_refine_alg = new RefineAlgorithm<NDIM>();
+    // Setup cached synchronization schedules.  These schedules precompute the
+    // shared side-centered indices of the patches of each level and exchange
+    // only those values, with a single message per processor.
+    std::vector<int> data_idxs;
+    std::vector<Pointer<VariableFillPattern<NDIM> > > fill_patterns;
     for (const auto& transaction_comp : d_transaction_comps)
     {
         const int data_idx = transaction_comp.d_data_idx;
@@ -144,20 +145,15 @@ SideDataSynchronization::initializeOperatorState(
             TBOX_ERROR("SideDataSynchronization::initializeOperatorState():\n"
                        << "  only double-precision side-centered data is supported." << std::endl);
         }
-        Pointer<RefineOperator<NDIM> > refine_op = nullptr;
-        Pointer<VariableFillPattern<NDIM> > fill_pattern = new SideSynchCopyFillPattern();
-        d_refine_alg->registerRefine(data_idx, // destination
-                                     data_idx, // source
-                                     data_idx, // temporary work space
-                                     refine_op,
-                                     fill_pattern);
+        data_idxs.push_back(data_idx);
+        fill_patterns.push_back(new SideSynchCopyFillPattern());
     }
 
-    d_refine_scheds.resize(d_finest_ln + 1);
+    d_synch_scheds.resize(d_finest_ln + 1);
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        d_refine_scheds[ln] = d_refine_alg->createSchedule(level);
+        d_synch_scheds[ln].reset(new PersistentGhostFillSchedule(level, data_idxs, data_idxs, fill_patterns));
     }
 
     // Indicate the operator is initialized.
@@ -232,8 +228,8 @@ SideDataSynchronization::resetTransactionComponents(
         }
     }
 
-    // Reset cached refine algorithms and schedules.
-    d_refine_alg = new RefineAlgorithm<NDIM>();
+    // Reset cached synchronization schedules.
+    std::vector<int> data_idxs;
     for (const auto& transaction_comp : d_transaction_comps)
     {
         const int data_idx = transaction_comp.d_data_idx;
@@ -245,18 +241,12 @@ SideDataSynchronization::resetTransactionComponents(
             TBOX_ERROR("SideDataSynchronization::resetTransactionComponents():\n"
                        << "  only double-precision side-centered data is supported." << std::endl);
         }
-        Pointer<RefineOperator<NDIM> > refine_op = nullptr;
-        Pointer<VariableFillPattern<NDIM> > fill_pattern = new SideSynchCopyFillPattern();
-        d_refine_alg->registerRefine(data_idx, // destination
-                                     data_idx, // source
-                                     data_idx, // temporary work space
-                                     refine_op,
-                                     fill_pattern);
+        data_idxs.push_back(data_idx);
     }
 
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        d_refine_alg->resetSchedule(d_refine_scheds[ln]);
+        d_synch_scheds[ln]->setDataIndices(data_idxs, data_idxs);
     }
     return;
 } // resetTransactionComponents
@@ -270,8 +260,7 @@ SideDataSynchronization::deallocateOperatorState()
     d_coarsen_alg.setNull();
     d_coarsen_scheds.clear();
 
-    d_refine_alg.setNull();
-    d_refine_scheds.clear();
+    d_synch_scheds.clear();
 
     // Indicate that the operator is NOT initialized.
     d_is_initialized = false;
@@ -289,7 +278,7 @@ SideDataSynchronization::synchronizeData(const double fill_time)
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
 
         // Synchronize data on the current level.
-        d_refine_scheds[ln]->fillData(fill_time);
+        d_synch_scheds[ln]->fillData(fill_time);
 
         // When appropriate, coarsen data from the current level to the next
         // coarser level.
@@ -0,0 +1,177 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/SpaceFillingCurveLoadBalancer.h"
+#include "ibtk/ibtk_utilities.h"
+
+#include "Box.h"
+#include "CellData.h"
+#include "Index.h"
+#include "Patch.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "ProcessorMapping.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+/*!
+ * Compute the Morton (Z-order) key of the center of a box relative to the lower
+ * corner of the domain.
+ */
+inline std::uint64_t
+box_morton_key(const hier::Box<NDIM>& box, const hier::Index<NDIM>& lower)
+{
+    hier::Index<NDIM> center;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        center(d) = std::max((box.lower(d) + box.upper(d)) / 2, lower(d));
+    }
+    return morton_key(center, lower);
+} // box_morton_key
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+SpaceFillingCurveLoadBalancer::setWorkloadPatchDataIndex(const int data_idx, const int level_number)
+{
+    mesh::LoadBalancer<NDIM>::setWorkloadPatchDataIndex(data_idx, level_number);
+    if (level_number < 0)
+    {
+        d_workload_data_idx = data_idx;
+        d_level_workload_data_idx.clear();
+    }
+    else
+    {
+        d_level_workload_data_idx[level_number] = data_idx;
+    }
+    return;
+} // setWorkloadPatchDataIndex
+
+void
+SpaceFillingCurveLoadBalancer::loadBalanceBoxes(hier::BoxArray<NDIM>& out_boxes,
+                                                hier::ProcessorMapping& mapping,
+                                                const hier::BoxList<NDIM>& in_boxes,
+                                                const tbox::Pointer<hier::PatchHierarchy<NDIM> > hierarchy,
+                                                int level_number,
+                                                const hier::BoxArray<NDIM>& physical_domain,
+                                                const hier::IntVector<NDIM>& ratio_to_hierarchy_level_zero,
+                                                const hier::IntVector<NDIM>& min_size,
+                                                const hier::IntVector<NDIM>& max_size,
+                                                const hier::IntVector<NDIM>& cut_factor,
+                                                const hier::IntVector<NDIM>& bad_interval) const
+{
+    // Let the parent class generate boxes that satisfy the size constraints of
+    // the level.  Its processor mapping is discarded.
+    mesh::LoadBalancer<NDIM>::loadBalanceBoxes(out_boxes,
+                                               mapping,
+                                               in_boxes,
+                                               hierarchy,
+                                               level_number,
+                                               physical_domain,
+                                               ratio_to_hierarchy_level_zero,
+                                               min_size,
+                                               max_size,
+                                               cut_factor,
+                                               bad_interval);
+    const int num_boxes = out_boxes.size();
+    if (num_boxes == 0) return;
+
+    // Determine the workload of each box.  If the existing level has workload
+    // data, each process sums the data on its own patches and the results are
+    // combined.  Otherwise, the workload is the number of cells in the box.
+    const auto it = d_level_workload_data_idx.find(level_number);
+    const int workload_data_idx = it != d_level_workload_data_idx.end() ? it->second : d_workload_data_idx;
+    tbox::Pointer<hier::PatchLevel<NDIM> > old_level;
+    if (hierarchy && level_number <= hierarchy->getFinestLevelNumber())
+    {
+        old_level = hierarchy->getPatchLevel(level_number);
+    }
+    const bool use_workload_data = workload_data_idx != IBTK::invalid_index && old_level &&
+                                   old_level->getRatio() == ratio_to_hierarchy_level_zero &&
+                                   old_level->checkAllocated(workload_data_idx);
+    std::vector<double> workloads(num_boxes, 0.0);
+    if (use_workload_data)
+    {
+        for (hier::PatchLevel<NDIM>::Iterator p(old_level); p; p++)
+        {
+            tbox::Pointer<hier::Patch<NDIM> > patch = old_level->getPatch(p());
+            tbox::Pointer<pdat::CellData<NDIM, double> > workload_data = patch->getPatchData(workload_data_idx);
+            const hier::Box<NDIM>& patch_box = patch->getBox();
+            for (int k = 0; k < num_boxes; ++k)
+            {
+                const hier::Box<NDIM> overlap = patch_box * out_boxes[k];
+                for (hier::Box<NDIM>::Iterator b(overlap); b; b++) workloads[k] += (*workload_data)(b(), 0);
+            }
+        }
+        IBTK_MPI::sumReduction(workloads.data(), num_boxes);
+    }
+    for (int k = 0; k < num_boxes; ++k)
+    {
+        // Boxes that do not overlap the old level still have a nonzero cost.
+        if (workloads[k] <= 0.0) workloads[k] = static_cast<double>(out_boxes[k].size());
+    }
+
+    // Order the boxes along a Z-order curve through the physical domain.
+    hier::Box<NDIM> domain_box = physical_domain[0];
+    for (int i = 1; i < physical_domain.size(); ++i) domain_box += physical_domain[i];
+    std::vector<std::pair<std::uint64_t, int> > keys(num_boxes);
+    for (int k = 0; k < num_boxes; ++k) keys[k] = std::make_pair(box_morton_key(out_boxes[k], domain_box.lower()), k);
+    std::sort(keys.begin(), keys.end());
+
+    // Assign each processor a contiguous segment of the curve.  A box is
+    // assigned to the processor whose share of the total workload contains the
+    // midpoint of the box's workload.
+    const int n_nodes = IBTK_MPI::getNodes();
+    const double total_workload = std::accumulate(workloads.begin(), workloads.end(), 0.0);
+    const hier::BoxArray<NDIM> unsorted_boxes(out_boxes);
+    mapping.setMappingSize(num_boxes);
+    double cumulative_workload = 0.0;
+    for (int i = 0; i < num_boxes; ++i)
+    {
+        const int k = keys[i].second;
+        const double midpoint = cumulative_workload + 0.5 * workloads[k];
+        const int rank = std::min(n_nodes - 1, static_cast<int>(midpoint * n_nodes / total_workload));
+        cumulative_workload += workloads[k];
+        out_boxes[i] = unsorted_boxes[k];
+        mapping.setProcessorAssignment(i, rank);
+    }
+    return;
+} // loadBalanceBoxes
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,64 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/Streamable.h"
+#include "ibtk/StreamableFactory.h"
+
+#include "IntVector.h"
+#include "tbox/AbstractStream.h"
+#include "tbox/Pointer.h"
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+StreamableFactory::packStreams(AbstractStream& stream, const Pointer<Streamable>* const data_items, const int num_items)
+{
+    for (int k = 0; k < num_items; ++k)
+    {
+        data_items[k]->packStream(stream);
+    }
+    return;
+} // packStreams
+
+void
+StreamableFactory::unpackStreams(AbstractStream& stream,
+                                 const IntVector<NDIM>& offset,
+                                 Pointer<Streamable>* const data_items,
+                                 const int num_items)
+{
+    for (int k = 0; k < num_items; ++k)
+    {
+        data_items[k] = unpackStream(stream, offset);
+    }
+    return;
+} // unpackStreams
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
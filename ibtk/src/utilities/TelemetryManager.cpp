@@ -0,0 +1,346 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/TelemetryManager.h"
+
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+#include "tbox/ShutdownRegistry.h"
+#include "tbox/Utilities.h"
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <map>
+#include <ostream>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+TelemetryManager* TelemetryManager::s_telemetry_manager_instance = nullptr;
+bool TelemetryManager::s_registered_callback = false;
+unsigned char TelemetryManager::s_shutdown_priority = 200;
+
+namespace
+{
+/*!
+ * Return the maximum resident set size of this process in bytes.
+ */
+double
+get_memory_high_water_mark()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0.0;
+#if defined(__APPLE__)
+    // ru_maxrss is measured in bytes on macOS and in kilobytes elsewhere.
+    return static_cast<double>(usage.ru_maxrss);
+#else
+    return 1024.0 * static_cast<double>(usage.ru_maxrss);
+#endif
+} // get_memory_high_water_mark
+} // namespace
+
+TelemetryManager*
+TelemetryManager::getManager()
+{
+    if (!s_telemetry_manager_instance)
+    {
+        s_telemetry_manager_instance = new TelemetryManager();
+    }
+    if (!s_registered_callback)
+    {
+        ShutdownRegistry::registerShutdownRoutine(freeManager, s_shutdown_priority);
+        s_registered_callback = true;
+    }
+    return s_telemetry_manager_instance;
+} // getManager
+
+void
+TelemetryManager::freeManager()
+{
+    delete s_telemetry_manager_instance;
+    s_telemetry_manager_instance = nullptr;
+    return;
+} // freeManager
+
+TelemetryManager::ScopedPhase::ScopedPhase(std::string phase_name) : d_phase_name(std::move(phase_name))
+{
+    TelemetryManager::getManager()->startPhase(d_phase_name);
+    return;
+} // ScopedPhase
+
+TelemetryManager::ScopedPhase::~ScopedPhase()
+{
+    TelemetryManager::getManager()->stopPhase(d_phase_name);
+    return;
+} // ~ScopedPhase
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+TelemetryManager::setOptions(Pointer<Database> input_db)
+{
+    if (!input_db) return;
+    d_enabled = input_db->getBoolWithDefault("enable", true);
+    d_file_name = input_db->getStringWithDefault("file_name", d_file_name);
+    const std::string format = input_db->getStringWithDefault("format", "JSON");
+    if (format == "JSON")
+    {
+        d_use_csv = false;
+    }
+    else if (format == "CSV")
+    {
+        d_use_csv = true;
+    }
+    else
+    {
+        TBOX_ERROR("TelemetryManager::setOptions():\n"
+                   << "  unrecognized output format: " << format << "\n"
+                   << "  valid formats are: JSON, CSV" << std::endl);
+    }
+    d_reduce = input_db->getBoolWithDefault("reduce", d_reduce);
+    d_write_interval = input_db->getIntegerWithDefault("write_interval", d_write_interval);
+    if (d_write_interval <= 0)
+    {
+        TBOX_ERROR("TelemetryManager::setOptions():\n"
+                   << "  write_interval must be positive" << std::endl);
+    }
+    d_row_start_time = std::chrono::steady_clock::now();
+    return;
+} // setOptions
+
+bool
+TelemetryManager::isEnabled() const
+{
+    return d_enabled;
+} // isEnabled
+
+void
+TelemetryManager::startPhase(const std::string& phase_name)
+{
+    if (!d_enabled) return;
+    auto& phase = d_running_phases[phase_name];
+    if (phase.second++ == 0) phase.first = std::chrono::steady_clock::now();
+    return;
+} // startPhase
+
+void
+TelemetryManager::stopPhase(const std::string& phase_name)
+{
+    if (!d_enabled) return;
+    auto it = d_running_phases.find(phase_name);
+    if (it == d_running_phases.end() || it->second.second == 0)
+    {
+        TBOX_ERROR("TelemetryManager::stopPhase():\n"
+                   << "  phase " << phase_name << " was stopped before it was started" << std::endl);
+    }
+    if (--it->second.second == 0)
+    {
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - it->second.first;
+        addToMetric(phase_name + "_time", elapsed.count());
+    }
+    return;
+} // stopPhase
+
+void
+TelemetryManager::addToMetric(const std::string& metric_name, const double value)
+{
+    if (!d_enabled) return;
+    if (d_metric_names.insert(metric_name).second) d_metric_names_changed = true;
+    d_metrics[metric_name] += value;
+    return;
+} // addToMetric
+
+void
+TelemetryManager::setMetric(const std::string& metric_name, const double value)
+{
+    if (!d_enabled) return;
+    if (d_metric_names.insert(metric_name).second) d_metric_names_changed = true;
+    d_metrics[metric_name] = value;
+    return;
+} // setMetric
+
+void
+TelemetryManager::recordStep(const int step, const double time)
+{
+    if (!d_enabled || step % d_write_interval != 0) return;
+
+    const auto now = std::chrono::steady_clock::now();
+    const std::chrono::duration<double> elapsed = now - d_row_start_time;
+    setMetric("wall_time", elapsed.count());
+    setMetric("memory_high_water_mark", get_memory_high_water_mark());
+
+    if (d_reduce)
+    {
+        writeReducedRow(step, time);
+    }
+    else
+    {
+        writeLocalRow(step, time);
+    }
+
+    d_metrics.clear();
+    d_row_start_time = now;
+    return;
+} // recordStep
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+TelemetryManager::synchronizeMetricNames()
+{
+    if (IBTK_MPI::maxReduction(d_metric_names_changed ? 1 : 0) == 0) return;
+
+    // Gather the names of the metrics of all processes as newline-separated
+    // strings.
+    std::string local_names;
+    for (const auto& name : d_metric_names) local_names += name + '\n';
+    const int local_size = static_cast<int>(local_names.size());
+    const int global_size = IBTK_MPI::sumReduction(local_size);
+    std::vector<char> global_names(global_size);
+    IBTK_MPI::allGather(local_names.data(), local_size, global_names.data(), global_size);
+
+    auto name_begin = global_names.begin();
+    while (name_begin != global_names.end())
+    {
+        const auto name_end = std::find(name_begin, global_names.end(), '\n');
+        d_metric_names.emplace(name_begin, name_end);
+        name_begin = name_end == global_names.end() ? name_end : name_end + 1;
+    }
+    d_metric_names_changed = false;
+    d_write_csv_header = true;
+    return;
+} // synchronizeMetricNames
+
+void
+TelemetryManager::writeLocalRow(const int step, const double time)
+{
+    if (!d_stream.is_open())
+    {
+        const std::string extension = d_use_csv ? ".csv" : ".jsonl";
+        d_stream.open(d_file_name + "." + std::to_string(IBTK_MPI::getRank()) + extension);
+        d_stream.precision(std::numeric_limits<double>::digits10);
+    }
+    if (d_metric_names_changed)
+    {
+        d_metric_names_changed = false;
+        d_write_csv_header = true;
+    }
+
+    if (d_use_csv)
+    {
+        if (d_write_csv_header)
+        {
+            d_stream << "step,time";
+            for (const auto& name : d_metric_names) d_stream << "," << name;
+            d_stream << "\n";
+            d_write_csv_header = false;
+        }
+        d_stream << step << "," << time;
+        for (const auto& name : d_metric_names) d_stream << "," << d_metrics[name];
+        d_stream << "\n";
+    }
+    else
+    {
+        d_stream << "{\"step\":" << step << ",\"time\":" << time << ",\"metrics\":{";
+        bool first = true;
+        for (const auto& name : d_metric_names)
+        {
+            d_stream << (first ? "" : ",") << "\"" << name << "\":" << d_metrics[name];
+            first = false;
+        }
+        d_stream << "}}\n";
+    }
+    d_stream.flush();
+    return;
+} // writeLocalRow
+
+void
+TelemetryManager::writeReducedRow(const int step, const double time)
+{
+    synchronizeMetricNames();
+
+    // Metrics that were not recorded by this process since the last row are
+    // reduced as zero.
+    const int num_metrics = static_cast<int>(d_metric_names.size());
+    std::vector<double> min_vals, max_vals, sum_vals;
+    min_vals.reserve(num_metrics);
+    for (const auto& name : d_metric_names) min_vals.push_back(d_metrics[name]);
+    max_vals = min_vals;
+    sum_vals = min_vals;
+    IBTK_MPI::minReduction(min_vals.data(), num_metrics);
+    IBTK_MPI::maxReduction(max_vals.data(), num_metrics);
+    IBTK_MPI::sumReduction(sum_vals.data(), num_metrics);
+    if (IBTK_MPI::getRank() != 0) return;
+
+    if (!d_stream.is_open())
+    {
+        d_stream.open(d_file_name + (d_use_csv ? ".csv" : ".jsonl"));
+        d_stream.precision(std::numeric_limits<double>::digits10);
+    }
+
+    const double num_procs = static_cast<double>(IBTK_MPI::getNodes());
+    if (d_use_csv)
+    {
+        if (d_write_csv_header)
+        {
+            d_stream << "step,time";
+            for (const auto& name : d_metric_names)
+            {
+                d_stream << "," << name << "_min," << name << "_max," << name << "_mean";
+            }
+            d_stream << "\n";
+            d_write_csv_header = false;
+        }
+        d_stream << step << "," << time;
+        for (int k = 0; k < num_metrics; ++k)
+        {
+            d_stream << "," << min_vals[k] << "," << max_vals[k] << "," << sum_vals[k] / num_procs;
+        }
+        d_stream << "\n";
+    }
+    else
+    {
+        d_stream << "{\"step\":" << step << ",\"time\":" << time << ",\"metrics\":{";
+        int k = 0;
+        for (const auto& name : d_metric_names)
+        {
+            d_stream << (k == 0 ? "" : ",") << "\"" << name << "\":{\"min\":" << min_vals[k]
+                     << ",\"max\":" << max_vals[k] << ",\"mean\":" << sum_vals[k] / num_procs << "}";
+            ++k;
+        }
+        d_stream << "}}\n";
+    }
+    d_stream.flush();
+    return;
+} // writeReducedRow
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,127 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/TimeStepSizeController.h"
+
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+TimeStepSizeController::TimeStepSizeController(std::string object_name, Pointer<Database> input_db)
+    : d_object_name(std::move(object_name))
+{
+    if (input_db)
+    {
+        if (input_db->keyExists("min_scale_factor")) d_min_scale_factor = input_db->getDouble("min_scale_factor");
+        if (input_db->keyExists("scale_factor_increment"))
+            d_scale_factor_increment = input_db->getDouble("scale_factor_increment");
+        if (input_db->keyExists("num_steps_per_sample"))
+            d_num_steps_per_sample = input_db->getInteger("num_steps_per_sample");
+        if (input_db->keyExists("relative_efficiency_tol"))
+            d_relative_efficiency_tol = input_db->getDouble("relative_efficiency_tol");
+        if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+    }
+    if (!(d_min_scale_factor > 0.0 && d_min_scale_factor <= 1.0))
+    {
+        TBOX_ERROR(d_object_name << "::TimeStepSizeController():\n"
+                                 << "  min_scale_factor must be in the interval (0,1]\n");
+    }
+    if (!(d_scale_factor_increment > 1.0))
+    {
+        TBOX_ERROR(d_object_name << "::TimeStepSizeController():\n"
+                                 << "  scale_factor_increment must be greater than one\n");
+    }
+    if (d_num_steps_per_sample < 1)
+    {
+        TBOX_ERROR(d_object_name << "::TimeStepSizeController():\n"
+                                 << "  num_steps_per_sample must be positive\n");
+    }
+    return;
+} // TimeStepSizeController
+
+double
+TimeStepSizeController::getTimeStepSizeScaleFactor() const
+{
+    return d_scale_factor;
+} // getTimeStepSizeScaleFactor
+
+double
+TimeStepSizeController::getPreviousUnscaledTimeStepSize() const
+{
+    return d_previous_unscaled_dt;
+} // getPreviousUnscaledTimeStepSize
+
+void
+TimeStepSizeController::recordTimeStep(const double dt, const double wall_time)
+{
+    d_previous_unscaled_dt = dt / d_scale_factor;
+
+    // The slowest processor determines the cost of the time step, and using the
+    // maximum also ensures that all processors make the same choice.
+    d_sample_dt += dt;
+    d_sample_wall_time += IBTK_MPI::maxReduction(wall_time);
+    ++d_sample_num_steps;
+    if (d_sample_num_steps < d_num_steps_per_sample) return;
+
+    const double efficiency = d_sample_dt / std::max(d_sample_wall_time, std::numeric_limits<double>::epsilon());
+    if (d_previous_efficiency > 0.0)
+    {
+        if (efficiency < (1.0 - d_relative_efficiency_tol) * d_previous_efficiency)
+        {
+            d_direction = -d_direction;
+        }
+        else if (efficiency <= (1.0 + d_relative_efficiency_tol) * d_previous_efficiency)
+        {
+            d_direction = 1;
+        }
+    }
+    const double previous_scale_factor = d_scale_factor;
+    d_scale_factor *= std::pow(d_scale_factor_increment, d_direction);
+    d_scale_factor = std::max(d_min_scale_factor, std::min(1.0, d_scale_factor));
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::recordTimeStep(): simulated time per wall clock second = " << efficiency
+             << " over the last " << d_sample_num_steps << " time steps with scale factor = " << previous_scale_factor
+             << ", new scale factor = " << d_scale_factor << "\n";
+    }
+
+    d_previous_efficiency = efficiency;
+    d_sample_num_steps = 0;
+    d_sample_dt = 0.0;
+    d_sample_wall_time = 0.0;
+    return;
+} // recordTimeStep
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,116 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/VizOutputSchedule.h"
+
+#include "tbox/Array.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+VizOutputSchedule::VizOutputSchedule(Pointer<Database> input_db, const int default_interval)
+    : d_default_interval(default_interval)
+{
+    if (!input_db) return;
+    if (input_db->isDatabase("intervals"))
+    {
+        Pointer<Database> intervals_db = input_db->getDatabase("intervals");
+        const Array<std::string> stream_names = intervals_db->getAllKeys();
+        for (int k = 0; k < stream_names.size(); ++k)
+        {
+            const int interval = intervals_db->getInteger(stream_names[k]);
+            if (interval < 0)
+            {
+                TBOX_ERROR("VizOutputSchedule::VizOutputSchedule():\n"
+                           << "  invalid output interval " << interval << " for " << stream_names[k] << "\n");
+            }
+            d_intervals[stream_names[k]] = interval;
+        }
+    }
+    if (input_db->isDatabase("variables"))
+    {
+        Pointer<Database> variables_db = input_db->getDatabase("variables");
+        const Array<std::string> stream_names = variables_db->getAllKeys();
+        for (int k = 0; k < stream_names.size(); ++k)
+        {
+            const Array<std::string> variables = variables_db->getStringArray(stream_names[k]);
+            d_variables[stream_names[k]] =
+                std::vector<std::string>(variables.getPointer(), variables.getPointer() + variables.size());
+        }
+    }
+    return;
+} // VizOutputSchedule
+
+int
+VizOutputSchedule::getInterval(const std::string& stream_name) const
+{
+    const auto it = d_intervals.find(stream_name);
+    return it == d_intervals.end() ? d_default_interval : it->second;
+} // getInterval
+
+bool
+VizOutputSchedule::isEnabled(const std::string& stream_name) const
+{
+    return getInterval(stream_name) > 0;
+} // isEnabled
+
+bool
+VizOutputSchedule::isOutputStep(const std::string& stream_name, const int iteration_num, const bool last_step) const
+{
+    const int interval = getInterval(stream_name);
+    return interval > 0 && (iteration_num % interval == 0 || last_step);
+} // isOutputStep
+
+int
+VizOutputSchedule::getOutputIndex(const std::string& stream_name, const int iteration_num) const
+{
+    const int interval = getInterval(stream_name);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(interval > 0);
+#endif
+    return iteration_num / interval + 1;
+} // getOutputIndex
+
+const std::vector<std::string>&
+VizOutputSchedule::getVariables(const std::string& stream_name) const
+{
+    static const std::vector<std::string> all_variables;
+    const auto it = d_variables.find(stream_name);
+    return it == d_variables.end() ? all_variables : it->second;
+} // getVariables
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
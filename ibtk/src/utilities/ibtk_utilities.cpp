@@ -16,11 +16,15 @@
 #include <ibtk/IBTK_MPI.h>
 #include <ibtk/ibtk_utilities.h>
 
+#include <Box.h>
 #include <CartesianPatchGeometry.h>
+#include <Patch.h>
 #include <PatchLevel.h>
+#include <tbox/Pointer.h>
 
 #include <algorithm>
 #include <cmath>
+#include <vector>
 
 #include <ibtk/app_namespaces.h>
 
@@ -48,4 +52,19 @@ get_min_patch_dx(const PatchLevel<NDIM>& patch_level)
 
     return result;
 } // get_min_patch_dx
+
+std::vector<Pointer<Patch<NDIM> > >
+get_local_patches_by_size(const PatchLevel<NDIM>& patch_level)
+{
+    std::vector<Pointer<Patch<NDIM> > > patches;
+    for (PatchLevel<NDIM>::Iterator p(patch_level); p; p++)
+    {
+        patches.push_back(patch_level.getPatch(p()));
+    }
+    const auto larger_patch = [](const Pointer<Patch<NDIM> >& a, const Pointer<Patch<NDIM> >& b) {
+        return a->getBox().size() > b->getBox().size();
+    };
+    std::stable_sort(patches.begin(), patches.end(), larger_patch);
+    return patches;
+} // get_local_patches_by_size
 } // namespace IBTK
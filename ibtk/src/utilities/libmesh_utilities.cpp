@@ -28,6 +28,7 @@
 #include "libmesh/elem.h"
 #include "libmesh/enum_elem_type.h"
 #include "libmesh/enum_order.h"
+#include "libmesh/enum_parallel_type.h"
 #include "libmesh/enum_quadrature_type.h"
 #include "libmesh/explicit_system.h"
 #include "libmesh/fem_context.h"
@@ -56,10 +57,12 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <cmath>
 #include <fstream>
 #include <limits>
+#include <map>
 #include <memory>
 #include <sstream>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -69,6 +72,134 @@ namespace IBTK
 /////////////////////////////// STATIC ///////////////////////////////////////
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
+void
+FEVectorPipeline::assemble(const std::vector<libMesh::PetscVector<double>*>& vecs)
+{
+    Step step;
+    step.type = StepType::ASSEMBLE;
+    step.y_vecs = vecs;
+    d_steps.push_back(std::move(step));
+    return;
+} // assemble
+
+void
+FEVectorPipeline::ghostUpdate(const std::vector<libMesh::PetscVector<double>*>& vecs,
+                              const InsertMode insert_mode,
+                              const ScatterMode scatter_mode)
+{
+    Step step;
+    step.type = StepType::GHOST_UPDATE;
+    step.y_vecs = vecs;
+    step.insert_mode = insert_mode;
+    step.scatter_mode = scatter_mode;
+    d_steps.push_back(std::move(step));
+    return;
+} // ghostUpdate
+
+void
+FEVectorPipeline::copy(const std::vector<libMesh::PetscVector<double>*>& x_vecs,
+                       const std::vector<libMesh::PetscVector<double>*>& y_vecs)
+{
+    TBOX_ASSERT(x_vecs.size() == y_vecs.size());
+    Step step;
+    step.type = StepType::COPY;
+    step.x_vecs = x_vecs;
+    step.y_vecs = y_vecs;
+    d_steps.push_back(std::move(step));
+    return;
+} // copy
+
+void
+FEVectorPipeline::scale(const std::vector<libMesh::PetscVector<double>*>& vecs, const double alpha)
+{
+    Step step;
+    step.type = StepType::SCALE;
+    step.y_vecs = vecs;
+    step.alpha = alpha;
+    d_steps.push_back(std::move(step));
+    return;
+} // scale
+
+void
+FEVectorPipeline::execute()
+{
+    int ierr;
+    for (const Step& step : d_steps)
+    {
+        switch (step.type)
+        {
+        case StepType::ASSEMBLE:
+            for (const auto& v : step.y_vecs)
+            {
+                if (!v) continue;
+                finish(v, /*read_only*/ false);
+                ierr = VecAssemblyBegin(v->vec());
+                IBTK_CHKERRQ(ierr);
+                d_in_flight[v] = { step.type, step.insert_mode, step.scatter_mode };
+            }
+            break;
+        case StepType::GHOST_UPDATE:
+        {
+            CommunicationStatistics::ScopedPhase phase("fe_scatter");
+            for (const auto& v : step.y_vecs)
+            {
+                if (!v || v->type() != libMesh::GHOSTED) continue;
+                finish(v, /*read_only*/ false);
+                if (CommunicationStatistics::enabled())
+                    CommunicationStatistics::getManager()->recordGhostUpdate(v->vec(), step.scatter_mode);
+                ierr = VecGhostUpdateBegin(v->vec(), step.insert_mode, step.scatter_mode);
+                IBTK_CHKERRQ(ierr);
+                d_in_flight[v] = { step.type, step.insert_mode, step.scatter_mode };
+            }
+            break;
+        }
+        case StepType::COPY:
+            for (unsigned int k = 0; k < step.x_vecs.size(); ++k)
+            {
+                if (!step.x_vecs[k] || !step.y_vecs[k]) continue;
+                finish(step.x_vecs[k], /*read_only*/ true);
+                finish(step.y_vecs[k], /*read_only*/ false);
+                ierr = VecCopy(step.x_vecs[k]->vec(), step.y_vecs[k]->vec());
+                IBTK_CHKERRQ(ierr);
+            }
+            break;
+        case StepType::SCALE:
+            for (const auto& v : step.y_vecs)
+            {
+                if (!v) continue;
+                finish(v, /*read_only*/ false);
+                ierr = VecScale(v->vec(), step.alpha);
+                IBTK_CHKERRQ(ierr);
+            }
+            break;
+        }
+    }
+
+    // Finish all remaining communication.
+    while (!d_in_flight.empty()) finish(d_in_flight.begin()->first, /*read_only*/ false);
+    d_steps.clear();
+    return;
+} // execute
+
+void
+FEVectorPipeline::finish(libMesh::PetscVector<double>* vec, const bool read_only)
+{
+    const auto it = d_in_flight.find(vec);
+    if (it == d_in_flight.end()) return;
+    const InFlight& op = it->second;
+    // Forward ghost updates only write to the ghost entries, so the owned
+    // entries may be read while they are in flight.
+    if (read_only && op.type == StepType::GHOST_UPDATE && op.scatter_mode == SCATTER_FORWARD) return;
+    int ierr;
+    if (op.type == StepType::ASSEMBLE)
+        ierr = VecAssemblyEnd(vec->vec());
+    else
+        ierr = VecGhostUpdateEnd(vec->vec(), op.insert_mode, op.scatter_mode);
+    IBTK_CHKERRQ(ierr);
+    d_in_flight.erase(it);
+    return;
+} // finish
+
 void
 setup_system_vectors(libMesh::EquationSystems* equation_systems,
                      const std::vector<std::string>& system_names,
@@ -530,7 +661,8 @@ std::vector<libMeshWrappers::BoundingBox>
 get_global_element_bounding_boxes(const libMesh::MeshBase& mesh,
                                   const std::vector<libMeshWrappers::BoundingBox>& local_bboxes)
 {
-    const std::size_t n_elem = mesh.n_elem();
+    // Element ids need not be contiguous (e.g., for a distributed mesh).
+    const std::size_t n_elem = mesh.max_elem_id();
     std::vector<double> flattened_bboxes(2 * LIBMESH_DIM * n_elem);
     std::size_t elem_n = 0;
     const auto el_begin = mesh.local_elements_begin();
@@ -17,28 +17,23 @@
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/muParserCartGridFunction.h"
 
+#include "ArrayData.h"
 #include "Box.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
-#include "CellIndex.h"
-#include "CellIterator.h"
 #include "EdgeData.h"
-#include "EdgeIndex.h"
-#include "EdgeIterator.h"
+#include "EdgeGeometry.h"
 #include "FaceData.h"
-#include "FaceIndex.h"
-#include "FaceIterator.h"
+#include "FaceGeometry.h"
 #include "Index.h"
 #include "IntVector.h"
 #include "NodeData.h"
-#include "NodeIndex.h"
-#include "NodeIterator.h"
+#include "NodeGeometry.h"
 #include "Patch.h"
 #include "PatchData.h"
 #include "SideData.h"
-#include "SideIndex.h"
-#include "SideIterator.h"
+#include "SideGeometry.h"
 #include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
@@ -48,6 +43,7 @@
 #include "muParserError.h"
 
 #include <algorithm>
+#include <array>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -244,19 +240,10 @@ muParserCartGridFunction::muParserCartGridFunction(std::string object_name,
         {
             parser.DefineConst(constant.first, constant.second);
         }
-
-        // Variables.
-        parser.DefineVar("T", &d_parser_time);
-        parser.DefineVar("t", &d_parser_time);
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            const std::string postfix = std::to_string(d);
-            parser.DefineVar("X" + postfix, &(d_parser_posn[d]));
-            parser.DefineVar("x" + postfix, &(d_parser_posn[d]));
-            parser.DefineVar("X_" + postfix, &(d_parser_posn[d]));
-            parser.DefineVar("x_" + postfix, &(d_parser_posn[d]));
-        }
     }
+
+    // Variables.
+    resizeParserArrays(1);
     return;
 } // muParserCartGridFunction
 
@@ -274,10 +261,7 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                                          const bool /*initial_time*/,
                                          Pointer<PatchLevel<NDIM> > /*level*/)
 {
-    d_parser_time = data_time;
-
     const Box<NDIM>& patch_box = patch->getBox();
-    const hier::Index<NDIM>& patch_lower = patch_box.lower();
     Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
 
     const double* const XLower = pgeom->getXLower();
@@ -298,32 +282,21 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
 #if !defined(NDEBUG)
         TBOX_ASSERT(d_parsers.size() == 1 || d_parsers.size() == static_cast<unsigned int>(cc_data->getDepth()));
 #endif
+        std::array<double, NDIM> offset;
+        offset.fill(0.5);
         for (int data_depth = 0; data_depth < cc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (CellIterator<NDIM> ic(patch_box); ic; ic++)
-            {
-                const CellIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                }
-                try
-                {
-                    (*cc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: " << e.GetMsg() << "\n"
-                               << "  in:    " << e.GetExpr() << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
-                }
-            }
+            setDataOnBox(cc_data->getArrayData(),
+                         data_depth,
+                         patch_box,
+                         0,
+                         offset,
+                         patch_box,
+                         XLower,
+                         dx,
+                         data_time,
+                         d_parsers[function_depth]);
         }
     }
     else if (fc_data)
@@ -357,38 +330,19 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                     function_depth = NDIM * data_depth + axis;
                 }
 
-                for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++)
-                {
-                    const FaceIndex<NDIM>& i = ic();
-                    const hier::Index<NDIM>& cell_idx = i.toCell(1);
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] =
-                                XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)) + 0.5);
-                        }
-                    }
-                    try
-                    {
-                        (*fc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: " << e.GetMsg() << "\n"
-                                   << "  in:    " << e.GetExpr() << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
-                }
+                std::array<double, NDIM> offset;
+                offset.fill(0.5);
+                offset[axis] = 0.0;
+                setDataOnBox(fc_data->getArrayData(axis),
+                             data_depth,
+                             FaceGeometry<NDIM>::toFaceBox(patch_box, axis),
+                             axis,
+                             offset,
+                             patch_box,
+                             XLower,
+                             dx,
+                             data_time,
+                             d_parsers[function_depth]);
             }
         }
     }
@@ -397,32 +351,21 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
 #if !defined(NDEBUG)
         TBOX_ASSERT(d_parsers.size() == 1 || d_parsers.size() == static_cast<unsigned int>(nc_data->getDepth()));
 #endif
+        std::array<double, NDIM> offset;
+        offset.fill(0.0);
         for (int data_depth = 0; data_depth < nc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (NodeIterator<NDIM> ic(patch_box); ic; ic++)
-            {
-                const NodeIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                }
-                try
-                {
-                    (*nc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: " << e.GetMsg() << "\n"
-                               << "  in:    " << e.GetExpr() << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
-                }
-            }
+            setDataOnBox(nc_data->getArrayData(),
+                         data_depth,
+                         NodeGeometry<NDIM>::toNodeBox(patch_box),
+                         0,
+                         offset,
+                         patch_box,
+                         XLower,
+                         dx,
+                         data_time,
+                         d_parsers[function_depth]);
         }
     }
     else if (sc_data)
@@ -456,36 +399,19 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                     function_depth = NDIM * data_depth + axis;
                 }
 
-                for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++)
-                {
-                    const SideIndex<NDIM>& i = ic();
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                        }
-                    }
-                    try
-                    {
-                        (*sc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: " << e.GetMsg() << "\n"
-                                   << "  in:    " << e.GetExpr() << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
-                }
+                std::array<double, NDIM> offset;
+                offset.fill(0.5);
+                offset[axis] = 0.0;
+                setDataOnBox(sc_data->getArrayData(axis),
+                             data_depth,
+                             SideGeometry<NDIM>::toSideBox(patch_box, axis),
+                             0,
+                             offset,
+                             patch_box,
+                             XLower,
+                             dx,
+                             data_time,
+                             d_parsers[function_depth]);
             }
         }
     }
@@ -520,36 +446,19 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                     function_depth = NDIM * data_depth + axis;
                 }
 
-                for (EdgeIterator<NDIM> ic(patch_box, axis); ic; ic++)
-                {
-                    const EdgeIndex<NDIM>& i = ic();
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                        }
-                        else
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                        }
-                    }
-                    try
-                    {
-                        (*ec_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: " << e.GetMsg() << "\n"
-                                   << "  in:    " << e.GetExpr() << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
-                }
+                std::array<double, NDIM> offset;
+                offset.fill(0.0);
+                offset[axis] = 0.5;
+                setDataOnBox(ec_data->getArrayData(axis),
+                             data_depth,
+                             EdgeGeometry<NDIM>::toEdgeBox(patch_box, axis),
+                             0,
+                             offset,
+                             patch_box,
+                             XLower,
+                             dx,
+                             data_time,
+                             d_parsers[function_depth]);
             }
         }
     }
@@ -561,6 +470,88 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
     return;
 } // setDataOnPatch
 
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+muParserCartGridFunction::resizeParserArrays(const int size)
+{
+    if (static_cast<int>(d_parser_time.size()) >= size) return;
+    d_parser_time.resize(size);
+    for (unsigned int d = 0; d < NDIM; ++d) d_parser_posn[d].resize(size);
+    d_parser_results.resize(size);
+
+    // The parsers store the addresses of their variables, so the variables must
+    // be redefined after the arrays are reallocated.
+    for (auto& parser : d_parsers)
+    {
+        parser.DefineVar("T", d_parser_time.data());
+        parser.DefineVar("t", d_parser_time.data());
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const std::string postfix = std::to_string(d);
+            parser.DefineVar("X" + postfix, d_parser_posn[d].data());
+            parser.DefineVar("x" + postfix, d_parser_posn[d].data());
+            parser.DefineVar("X_" + postfix, d_parser_posn[d].data());
+            parser.DefineVar("x_" + postfix, d_parser_posn[d].data());
+        }
+    }
+    return;
+} // resizeParserArrays
+
+void
+muParserCartGridFunction::setDataOnBox(ArrayData<NDIM, double>& data,
+                                       const int data_depth,
+                                       const Box<NDIM>& index_box,
+                                       const unsigned int axis_shift,
+                                       const std::array<double, NDIM>& offset,
+                                       const Box<NDIM>& patch_box,
+                                       const double* const XLower,
+                                       const double* const dx,
+                                       const double data_time,
+                                       mu::Parser& parser)
+{
+    const int num_indices = index_box.size();
+    if (num_indices <= 0) return;
+    resizeParserArrays(num_indices);
+
+    // Compute the time and position values for all of the indices in the box.
+    std::fill(d_parser_time.begin(), d_parser_time.begin() + num_indices, data_time);
+    int k = 0;
+    for (Box<NDIM>::Iterator b(index_box); b; b++, ++k)
+    {
+        const hier::Index<NDIM>& i = b();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const int i_d = i((d + NDIM - axis_shift) % NDIM);
+            d_parser_posn[d][k] = XLower[d] + dx[d] * (static_cast<double>(i_d - patch_box.lower(d)) + offset[d]);
+        }
+    }
+
+    // Evaluate the function at all of the indices at once.
+    try
+    {
+        parser.Eval(d_parser_results.data(), num_indices);
+    }
+    catch (mu::ParserError& e)
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  error: " << e.GetMsg() << "\n"
+                   << "  in:    " << e.GetExpr() << "\n");
+    }
+    catch (...)
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  unrecognized exception generated by muParser library.\n");
+    }
+
+    k = 0;
+    for (Box<NDIM>::Iterator b(index_box); b; b++, ++k)
+    {
+        data(b(), data_depth) = d_parser_results[k];
+    }
+    return;
+} // setDataOnBox
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -20,6 +20,7 @@
 
 #include <ibamr/config.h>
 
+#include "ibamr/AdvDiffReactionIntegrator.h"
 #include "ibamr/ibamr_enums.h"
 #include "ibamr/ibamr_utilities.h"
 
@@ -71,6 +72,7 @@ namespace solv
 {
 template <int DIM, class TYPE>
 class SAMRAIVectorReal;
+class PoissonSpecifications;
 template <int DIM>
 class RobinBcCoefStrategy;
 } // namespace solv
@@ -85,6 +87,23 @@ namespace IBAMR
  * time integrator for advection-diffusion or advection-reaction-diffusion
  * equations on an AMR grid hierarchy, along with basic data management for
  * variables defined on that hierarchy.
+ *
+ * The setup of the Helmholtz solvers (e.g., the construction of hypre or FAC
+ * preconditioners) may be reused by setting the following optional input
+ * database entries (shown with their default values): \verbatim
+
+ share_helmholtz_solvers = FALSE        // use one solver for all quantities with identical solver configurations
+ helmholtz_solver_reinit_rel_tol = 0.0  // relative change of C below which Krylov solvers are not reinitialized
+ \endverbatim
+ *
+ * Quantities have identical solver configurations when they have the same
+ * depth, diffusion time stepping type, diffusion and damping coefficients,
+ * and boundary condition objects. Only solvers that are allocated by the
+ * integrator are shared. When the constant coefficient C of the Helmholtz
+ * problem changes by no more than the given tolerance (e.g., due to a small
+ * change in the time step size), a Krylov solver is not reinitialized: the
+ * Krylov method uses the updated operator, and only its preconditioner is
+ * based on the previous coefficient.
  */
 class AdvDiffHierarchyIntegrator : public IBTK::HierarchyIntegrator
 {
@@ -149,6 +168,27 @@ public:
     bool
     getAdvectionVelocityIsDivergenceFree(SAMRAI::tbox::Pointer<SAMRAI::pdat::FaceVariable<NDIM, double> > u_var) const;
 
+    /*!
+     * Indicate whether the current, new, and scratch values of a particular
+     * advection velocity are all set by another object (e.g., by the
+     * INSHierarchyIntegrator that registered the velocity). In this case, the
+     * hierarchy integrator does not update the velocity itself, and the
+     * velocity data are shared as-is by all transported quantities.
+     *
+     * \note An advection velocity that is managed externally may not have an
+     * advection velocity function.
+     */
+    void
+    setAdvectionVelocityIsManagedExternally(SAMRAI::tbox::Pointer<SAMRAI::pdat::FaceVariable<NDIM, double> > u_var,
+                                            bool is_managed_externally);
+
+    /*!
+     * Determine whether a particular advection velocity has been indicated to
+     * be managed externally.
+     */
+    bool getAdvectionVelocityIsManagedExternally(
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::FaceVariable<NDIM, double> > u_var) const;
+
     /*!
      * Supply an IBTK::CartGridFunction object to specify the value of a
      * particular advection velocity.
@@ -195,6 +235,19 @@ public:
      *
      * Data management for the registered quantity will be handled by the
      * hierarchy integrator.
+     *
+     * \note Several quantities that are advected by the same velocity, that
+     * have the same diffusion coefficient, and that use the same types of
+     * boundary conditions may be registered as the components of a single
+     * multi-depth variable. Doing so requires only one application of the
+     * convective operator, one ghost cell fill, and one (block diagonal)
+     * linear solve per cycle for all of the components, instead of one of
+     * each per quantity, which substantially reduces the overhead when many
+     * quantities (e.g., chemical species) are transported. Boundary condition
+     * objects are provided separately for each component. When the quantity
+     * is plotted and its depth is neither 1 nor NDIM, each component is
+     * written as a separate scalar named Q_var->getName() + "_" + component
+     * index; a quantity of depth NDIM is written as a vector.
      */
     virtual void registerTransportedQuantity(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > Q_var,
                                              const bool output_Q = true);
@@ -368,6 +421,28 @@ public:
     std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>
     getPhysicalBcCoefs(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > Q_var) const;
 
+    /*!
+     * Set the object used to integrate the cell-local reaction terms of a
+     * transported quantity.
+     *
+     * When a reaction integrator is provided, the reaction terms are treated
+     * by Strang splitting: they are integrated over the first half of each
+     * time step before the transport step (in preprocessIntegrateHierarchy())
+     * and over the second half of the time step after the transport step (in
+     * postprocessIntegrateHierarchy()). Stiff reactions should be treated in
+     * this way instead of through a source term, which is evaluated
+     * explicitly.
+     */
+    void setReactionIntegrator(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > Q_var,
+                               SAMRAI::tbox::Pointer<AdvDiffReactionIntegrator> reaction_integrator);
+
+    /*!
+     * Get the object used to integrate the cell-local reaction terms of a
+     * transported quantity, if any.
+     */
+    SAMRAI::tbox::Pointer<AdvDiffReactionIntegrator>
+    getReactionIntegrator(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > Q_var) const;
+
     /*!
      * Register a solver for the Helmholtz equation (time-discretized diffusion
      * equation).
@@ -439,6 +514,14 @@ public:
      */
     void preprocessIntegrateHierarchy(double current_time, double new_time, int num_cycles = 1) override;
 
+    /*!
+     * Clean up data following call(s) to integrateHierarchy().
+     */
+    void postprocessIntegrateHierarchy(double current_time,
+                                       double new_time,
+                                       bool skip_synchronize_new_state_data,
+                                       int num_cycles = 1) override;
+
     /*!
      * \brief Function to reset variables registered by this integrator
      */
@@ -519,6 +602,23 @@ protected:
      */
     void registerVariables();
 
+    /*!
+     * Initialize the Helmholtz solver for the transported quantity with index
+     * @p l for the problem specified by @p solver_spec if it has been marked
+     * as requiring initialization. The existing solver setup is reused when
+     * possible, and all quantities sharing the solver are marked as not
+     * requiring initialization.
+     */
+    void initializeHelmholtzSolver(unsigned int l, const SAMRAI::solv::PoissonSpecifications& solver_spec);
+
+    /*!
+     * Determine whether the two transported quantities can use the same
+     * Helmholtz solver when sharing solvers is enabled.
+     */
+    virtual bool
+    canShareHelmholtzSolver(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > Q1_var,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > Q2_var) const;
+
     /*
      * Boolean value that indicates whether the integrator has been initialized.
      */
@@ -544,6 +644,7 @@ protected:
      */
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::pdat::FaceVariable<NDIM, double> > > d_u_var;
     std::map<SAMRAI::tbox::Pointer<SAMRAI::pdat::FaceVariable<NDIM, double> >, bool> d_u_is_div_free;
+    std::map<SAMRAI::tbox::Pointer<SAMRAI::pdat::FaceVariable<NDIM, double> >, bool> d_u_is_managed_externally;
     std::map<SAMRAI::tbox::Pointer<SAMRAI::pdat::FaceVariable<NDIM, double> >,
              SAMRAI::tbox::Pointer<IBTK::CartGridFunction> >
         d_u_fcn;
@@ -598,6 +699,9 @@ protected:
              std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> >
         d_Q_bc_coef;
     std::map<SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> >, bool> d_Q_output;
+    std::map<SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> >,
+             SAMRAI::tbox::Pointer<AdvDiffReactionIntegrator> >
+        d_Q_reaction_integrator;
 
     /*!
      * Objects to keep track of the resetting functions.
@@ -625,6 +729,8 @@ protected:
     std::vector<SAMRAI::tbox::Pointer<IBTK::PoissonSolver> > d_helmholtz_solvers;
     std::vector<SAMRAI::tbox::Pointer<IBTK::LaplaceOperator> > d_helmholtz_rhs_ops;
     std::vector<bool> d_helmholtz_solvers_need_init, d_helmholtz_rhs_ops_need_init;
+    bool d_share_helmholtz_solvers = false;
+    double d_helmholtz_solver_reinit_rel_tol = 0.0;
     int d_coarsest_reset_ln = IBTK::invalid_level_number, d_finest_reset_ln = IBTK::invalid_level_number;
 
 private:
@@ -666,6 +772,18 @@ private:
      * by the object_name specified in the class constructor.
      */
     void getFromRestart();
+
+    /*!
+     * Invalidate the record of the coefficients for which the Helmholtz solver
+     * of the transported quantity with index @p l was last initialized.
+     */
+    void resetHelmholtzSolverInitCoefs(unsigned int l);
+
+    /*
+     * Constant Helmholtz coefficients for which the solvers were last
+     * initialized. NaN values indicate that the setup may not be reused.
+     */
+    std::vector<double> d_helmholtz_solvers_init_C, d_helmholtz_solvers_init_D;
 };
 } // namespace IBAMR
 
@@ -0,0 +1,176 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBAMR_AdvDiffReactionIntegrator
+#define included_IBAMR_AdvDiffReactionIntegrator
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibamr/config.h>
+
+#include "ibamr/AdvDiffReactionStrategy.h"
+
+#include "tbox/Database.h"
+#include "tbox/DescribedClass.h"
+#include "tbox/Pointer.h"
+
+#include <string>
+
+namespace SAMRAI
+{
+namespace hier
+{
+template <int DIM>
+class Box;
+template <int DIM>
+class PatchHierarchy;
+} // namespace hier
+namespace pdat
+{
+template <int DIM, class TYPE>
+class CellData;
+} // namespace pdat
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBAMR
+{
+/*!
+ * \brief Class AdvDiffReactionIntegrator integrates the cell-local (and
+ * possibly stiff) reaction terms \f$ \frac{dQ}{dt} = f(Q) \f$ specified by an
+ * AdvDiffReactionStrategy object over a time interval in every cell of a patch
+ * hierarchy.
+ *
+ * This class is used by AdvDiffHierarchyIntegrator to treat reactions by
+ * Strang splitting: the reaction terms are integrated over half of each time
+ * step before and after the transport step (see
+ * AdvDiffHierarchyIntegrator::setReactionIntegrator()), so that the transport
+ * time step size is not limited by the reaction time scales.
+ *
+ * The ODE systems are integrated by the two-stage, second-order, L-stable
+ * Rosenbrock method ROS2 of Verwer et al. (1999). Each cell takes its own
+ * substeps, which are chosen adaptively from the embedded first-order error
+ * estimate. Cells are processed in batches so that the reaction rates and
+ * their Jacobians are evaluated for all active cells of a batch at once, and,
+ * when IBAMR is built with OpenMP, the local patches of each level are
+ * distributed among the threads.
+ *
+ * Sample parameters for initialization from database (and their default
+ * values): \verbatim
+
+ rel_tol = 1.0e-6            // relative error tolerance of each substep
+ abs_tol = 1.0e-10           // absolute error tolerance of each substep
+ max_num_substeps = 10000    // maximum number of substeps in any cell
+ cells_per_batch = 64        // number of cells in each batch
+ enable_logging = FALSE      // log substep statistics of each integration
+ \endverbatim
+ *
+ * \note Ghost cell values are not updated.
+ */
+class AdvDiffReactionIntegrator : public virtual SAMRAI::tbox::DescribedClass
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    AdvDiffReactionIntegrator(std::string object_name,
+                              SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                              SAMRAI::tbox::Pointer<AdvDiffReactionStrategy> reaction_strategy);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~AdvDiffReactionIntegrator() = default;
+
+    /*!
+     * \brief Integrate the reaction terms over a time interval of length @p dt
+     * in the interior cells of all local patches of the hierarchy.
+     *
+     * \note This function must be called on all processors.
+     */
+    void integrate(int Q_idx, SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy, double dt);
+
+    /*!
+     * \brief Get the number of accepted substeps (summed over all cells) taken
+     * by this processor during the most recent call to integrate().
+     */
+    unsigned int getNumberOfAcceptedSubsteps() const;
+
+    /*!
+     * \brief Get the number of rejected substeps (summed over all cells) taken
+     * by this processor during the most recent call to integrate().
+     */
+    unsigned int getNumberOfRejectedSubsteps() const;
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    AdvDiffReactionIntegrator() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    AdvDiffReactionIntegrator(const AdvDiffReactionIntegrator& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    AdvDiffReactionIntegrator& operator=(const AdvDiffReactionIntegrator& that) = delete;
+
+    /*!
+     * \brief Integrate the reaction terms in the cells of the given box.
+     */
+    void integrateBox(SAMRAI::pdat::CellData<NDIM, double>& Q_data,
+                      const SAMRAI::hier::Box<NDIM>& box,
+                      double dt,
+                      unsigned int& num_accepted_substeps,
+                      unsigned int& num_rejected_substeps) const;
+
+    std::string d_object_name;
+
+    SAMRAI::tbox::Pointer<AdvDiffReactionStrategy> d_reaction_strategy;
+
+    /*
+     * Integrator parameters.
+     */
+    double d_rel_tol = 1.0e-6, d_abs_tol = 1.0e-10;
+    int d_max_num_substeps = 10000;
+    int d_cells_per_batch = 64;
+    bool d_enable_logging = false;
+
+    /*
+     * Statistics of the most recent integration.
+     */
+    unsigned int d_num_accepted_substeps = 0, d_num_rejected_substeps = 0;
+};
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBAMR_AdvDiffReactionIntegrator
@@ -0,0 +1,106 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBAMR_AdvDiffReactionStrategy
+#define included_IBAMR_AdvDiffReactionStrategy
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibamr/config.h>
+
+#include "tbox/DescribedClass.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBAMR
+{
+/*!
+ * \brief Class AdvDiffReactionStrategy is an abstract class that specifies the
+ * cell-local reaction terms \f$ \frac{dy}{dt} = f(y) \f$ of a multi-component
+ * transported quantity, which are integrated by an AdvDiffReactionIntegrator.
+ *
+ * Rates and Jacobians are evaluated for batches of cells at once: all arrays
+ * are stored in structure-of-arrays format, so that the value of component
+ * \f$ s \f$ in cell \f$ c \f$ of a batch of \f$ n_c \f$ cells is stored at
+ * index <code>s * num_cells + c</code>, and the entry \f$ \partial f_r /
+ * \partial y_s \f$ of the Jacobian in cell \f$ c \f$ is stored at index
+ * <code>(r * num_species + s) * num_cells + c</code>. Loops over the cells of
+ * a batch are therefore contiguous in memory and can be vectorized.
+ *
+ * The reaction terms are assumed not to depend explicitly on time.
+ *
+ * \note Implementations are called concurrently from multiple threads when
+ * IBAMR is built with OpenMP and must therefore not modify shared state.
+ */
+class AdvDiffReactionStrategy : public virtual SAMRAI::tbox::DescribedClass
+{
+public:
+    /*!
+     * \brief Default constructor.
+     */
+    AdvDiffReactionStrategy() = default;
+
+    /*!
+     * \brief Destructor.
+     */
+    virtual ~AdvDiffReactionStrategy() = default;
+
+    /*!
+     * \brief Compute the reaction rates \f$ f(y) \f$ for a batch of cells.
+     */
+    virtual void computeReactionRates(double* f, const double* y, int num_species, int num_cells) const = 0;
+
+    /*!
+     * \brief Compute the Jacobian \f$ \partial f / \partial y \f$ of the
+     * reaction rates for a batch of cells.
+     *
+     * The default implementation uses one-sided finite differences, which
+     * requires num_species additional evaluations of the reaction rates.
+     * Implementations should override this function when the Jacobian is
+     * known analytically.
+     *
+     * @param[out] J The Jacobian.
+     * @param[in] y The state.
+     * @param[in] f The reaction rates evaluated at @p y.
+     */
+    virtual void
+    computeReactionJacobian(double* J, const double* y, const double* f, int num_species, int num_cells) const;
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    AdvDiffReactionStrategy(const AdvDiffReactionStrategy& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    AdvDiffReactionStrategy& operator=(const AdvDiffReactionStrategy& that) = delete;
+};
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBAMR_AdvDiffReactionStrategy
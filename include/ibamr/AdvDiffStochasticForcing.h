@@ -176,6 +176,16 @@ private:
     int d_num_rand_vals = 0;
     std::vector<SAMRAI::tbox::Array<double> > d_weights;
 
+    /*!
+     * Whether to generate the random values with the counter-based generator
+     * provided by class RNG (keyed on the seed, the time step number, and the
+     * indices of the data) instead of the Mersenne Twister.  The values obtained
+     * with the counter-based generator do not depend on the number of processes
+     * or the patch layout.
+     */
+    bool d_use_counter_based_rng = false;
+    int d_rng_seed = 0;
+
     /*!
      * Boundary condition scalings.
      */
@@ -151,6 +151,16 @@ public:
     } // getBrinkmanPenalization
 
 protected:
+    /*!
+     * Determine whether the two transported quantities can use the same
+     * Helmholtz solver. Quantities with Brinkman penalization boundary
+     * conditions never share solvers because their Helmholtz problems depend
+     * on the penalization coefficients of the individual quantities.
+     */
+    bool
+    canShareHelmholtzSolver(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > Q1_var,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > Q2_var) const override;
+
     /*!
      * Additional variables required for Brinkman penalization
      */
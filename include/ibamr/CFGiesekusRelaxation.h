@@ -101,6 +101,15 @@ public:
 
     //\}
 
+protected:
+    /*!
+     * \brief Integrate the relaxation equation for the eigenvalues of the
+     * conformation tensor exactly. For each eigenvalue c, x = c - 1 satisfies
+     * the Bernoulli equation dx/dt = -(x + alpha x^2) / lambda, which has a
+     * closed-form solution.
+     */
+    void relaxEigenvalues(IBTK::VectorNd& eig_vals, double dt) override;
+
 private:
     double d_alpha, d_lambda;
 };
@@ -82,6 +82,11 @@ namespace IBAMR
  * parameter "fluid_parameter". By specifying "USER_DEFINED", you can register your own relaxation function. This class
  * currently solves for the conformation tensor or the square root or logarithm of the conformation tensor. The current
  * assumption is that the stress is linearly related to the conformation tensor through the elastic modulus.
+ *
+ * By default, the relaxation function is an explicit source term of the transport equation, which limits the time step
+ * size to a fraction of the relaxation time. If the database parameter "split_relaxation" is TRUE, the relaxation is
+ * instead integrated in each cell after the transport step by CFRelaxationOperator::relaxOnPatchHierarchy(), which is
+ * exact or semi-implicit for the pre-programmed models and does not limit the time step size.
  */
 class CFINSForcing : public IBTK::CartGridFunction
 {
@@ -236,6 +241,16 @@ public:
 
     static void apply_project_tensor_callback(double current_time, double new_time, int cycle_num, void* ctx);
 
+    /*!
+     * \brief Integrate the relaxation of the new conformation tensor over the time step when the relaxation is split
+     * from the transport.
+     */
+    static void apply_relaxation_callback(double current_time,
+                                          double new_time,
+                                          bool skip_synchronize_new_state_data,
+                                          int num_cycles,
+                                          void* ctx);
+
     inline double getViscosity()
     {
         return d_eta;
@@ -257,28 +272,18 @@ private:
                            SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > grid_geometry,
                            std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> vel_bcs);
 
-    void findDeterminant(const int data_idx,
-                         const SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > var,
-                         const double data_time,
-                         const bool initial_time);
-
-    void squareMatrix(const int data_idx,
-                      const SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > var,
-                      const SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
-                      const double data_time,
-                      const bool initial_time,
-                      const int coarsest_ln,
-                      const int finest_ln,
-                      const bool extended_box);
-
-    void exponentiateMatrix(const int data_idx,
-                            const SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > var,
-                            const SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
-                            const double data_time,
-                            const bool initial_time,
-                            const int coarsest_ln,
-                            const int finest_ln,
-                            const bool extended_box);
+    /*!
+     * \brief Convert the evolved quantity stored in data_idx, including its ghost cells, to the conformation tensor,
+     * and check the definiteness and compute the extremal determinants of the conformation tensor on the patch
+     * interiors, all in a single pass over the patch data.
+     *
+     * The results of the checks are accumulated into d_positive_def, d_max_det and d_min_det on this processor.
+     */
+    void convertAndCheckConformationTensor(const int data_idx,
+                                           const SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                           const bool initial_time,
+                                           const int coarsest_ln,
+                                           const int finest_ln);
 
     // Scratch variables
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_W_cc_var;
@@ -298,10 +303,11 @@ private:
 
     // Extra parameters
     std::string d_fluid_model = "OLDROYDB", d_interp_type = "LINEAR";
-    bool d_project_conform = true;
+    bool d_project_conform = true, d_split_relaxation = false;
     TensorEvolutionType d_evolve_type = STANDARD;
     SAMRAI::tbox::Pointer<AdvDiffSemiImplicitHierarchyIntegrator> d_adv_diff_integrator;
     SAMRAI::tbox::Pointer<CFUpperConvectiveOperator> d_convec_oper;
+    SAMRAI::tbox::Pointer<CFRelaxationOperator> d_relax_oper;
     std::string d_convec_oper_type;
     std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> d_conc_bc_coefs;
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
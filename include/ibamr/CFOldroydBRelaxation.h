@@ -116,6 +116,14 @@ public:
 
     //\}
 
+protected:
+    /*!
+     * \brief Integrate the relaxation equation for the eigenvalues of the
+     * conformation tensor exactly. The relaxation function is linear, so each
+     * eigenvalue decays exponentially to one.
+     */
+    void relaxEigenvalues(IBTK::VectorNd& eig_vals, double dt) override;
+
 private:
     double d_lambda;
 };
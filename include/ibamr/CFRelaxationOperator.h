@@ -23,6 +23,7 @@
 #include "ibamr/ibamr_enums.h"
 
 #include "ibtk/CartGridFunction.h"
+#include "ibtk/ibtk_utilities.h"
 
 #include "CellVariable.h"
 #include "HierarchyDataOpsManager.h"
@@ -94,7 +95,36 @@ public:
      */
     bool isTimeDependent() const override;
 
+    /*!
+     * \brief Integrate the local relaxation equation dC/dt = R(C) over a time
+     * interval of length \p dt in each cell of the specified levels of the
+     * patch hierarchy, in which \p data_idx stores the evolved version of the
+     * conformation tensor C.
+     *
+     * This is used when the relaxation is split from the transport of the
+     * conformation tensor, so that the time step size is not limited by the
+     * relaxation time. The relaxation functions of the pre-programmed models
+     * are isotropic functions of C, so the eigenvectors of C do not change and
+     * only its eigenvalues are integrated by relaxEigenvalues().
+     */
+    void relaxOnPatchHierarchy(int data_idx,
+                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                               double dt,
+                               int coarsest_ln = -1,
+                               int finest_ln = -1);
+
 protected:
+    /*!
+     * \brief Integrate the relaxation equation for the eigenvalues of the
+     * conformation tensor over a time interval of length \p dt.
+     *
+     * Implementations should be stable for time step sizes that are much larger
+     * than the relaxation time. The default implementation raises an error, so
+     * relaxation operators that do not implement this function cannot be split
+     * from the transport.
+     */
+    virtual void relaxEigenvalues(IBTK::VectorNd& eig_vals, double dt);
+
     /*!
      * \brief This function converts the data stored in the patch data index to the conformation tensor. This has a
      * default implementation that converts from the logarithm or square root to the full conformation tensor.
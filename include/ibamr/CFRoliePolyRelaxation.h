@@ -116,6 +116,16 @@ public:
 
     //\}
 
+protected:
+    /*!
+     * \brief Integrate the relaxation equation for the eigenvalues of the
+     * conformation tensor semi-implicitly. The relaxation function is linear in
+     * the conformation tensor with coefficients that depend on its trace. The
+     * coefficients are frozen at a predicted midpoint value of the trace and
+     * the resulting linear equation is integrated exactly.
+     */
+    void relaxEigenvalues(IBTK::VectorNd& eig_vals, double dt) override;
+
 private:
     double d_lambda_d, d_lambda_R, d_beta, d_delta;
 };
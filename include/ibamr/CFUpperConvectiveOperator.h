@@ -116,6 +116,13 @@ public:
      */
     void registerSourceFunction(SAMRAI::tbox::Pointer<IBAMR::CFRelaxationOperator> source_fcn);
 
+    /*!
+     * \brief Set whether the source function is integrated separately from the convective operator (see
+     * CFRelaxationOperator::relaxOnPatchHierarchy()). If so, applyConvectiveOperator() does not evaluate the source
+     * function.
+     */
+    void setSourceFunctionIsSplit(bool split_source_fcn);
+
 private:
     // Hierarchy configuration.
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
@@ -129,6 +136,7 @@ private:
     // Source function data.
     SAMRAI::tbox::Pointer<IBAMR::CFRelaxationOperator> d_s_fcn;
     int d_s_idx = IBTK::invalid_index;
+    bool d_split_s_fcn = false;
 
     // Convective Operator
     std::string d_difference_form;
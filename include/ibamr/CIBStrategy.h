@@ -461,6 +461,22 @@ public:
      */
     const Eigen::Vector3d& getNewBodyCenterOfMass(const unsigned int part);
 
+    /*!
+     * \brief Get body center of mass at the initial time.
+     */
+    const Eigen::Vector3d& getInitialBodyCenterOfMass(const unsigned int part);
+
+    /*!
+     * \brief Get body center of mass at the midpoint of the time step.
+     */
+    const Eigen::Vector3d& getMidpointBodyCenterOfMass(const unsigned int part);
+
+    /*!
+     * \brief Get body orientation (relative to the initial configuration) at
+     * the midpoint of the time step.
+     */
+    const Eigen::Quaterniond& getMidpointBodyQuaternion(const unsigned int part);
+
     /*!
      * \brief Construct dense mobility matrix for the prototypical structures
      * identified by their indices.
@@ -366,14 +366,9 @@ private:
     void interpolateFluidSolveVelocity();
 
     /*!
-     * \brief Calculate the rigid translational velocity.
+     * \brief Calculate the rigid translational and rotational velocities.
      */
-    void calculateRigidTranslationalMomentum();
-
-    /*!
-     * \brief Calculate the rigid rotational velocity.
-     */
-    void calculateRigidRotationalMomentum();
+    void calculateRigidMomentum();
 
     /*!
      * \brief Calculate current velocity on the material points.
@@ -53,6 +53,29 @@ namespace IBAMR
 /*!
  * \brief Class DirectMobilitySolver solves the mobility and body-mobility
  * sub-problem by employing direct solvers.
+ *
+ * If the input option <tt>max_cluster_size</tt> is positive, the nodes of
+ * each prototypical structure are split into clusters of at most that many
+ * consecutive nodes, and only the diagonal blocks of the mobility matrix
+ * coupling the nodes within a cluster are factorized. This block-diagonal
+ * (near-field) approximate inverse reduces the factorization cost from
+ * \f$ O(N^3) \f$ to \f$ O(N m^2) \f$ for \f$ N \f$ nodes and cluster size
+ * \f$ m \f$, and is meant to be used when this class serves as a preconditioner
+ * for large structures. Clusters follow the node ordering of the structure,
+ * so nodes should be numbered such that consecutive nodes are spatially close.
+ *
+ * Since the cluster blocks are independent, their factorizations are dealt out
+ * round-robin to all processors and the factors are gathered back on the
+ * managing processor, which performs the solves. This can be disabled by
+ * setting <tt>distribute_cluster_factorization</tt> to FALSE.
+ *
+ * If <tt>recompute_mob_mat_perstep</tt> is TRUE, the mobility matrices are
+ * rebuilt and refactorized whenever the solver is initialized. Setting
+ * <tt>reuse_rigid_factorization</tt> to TRUE instead keeps the body frame
+ * factorization of a matrix, as is done when <tt>recompute_mob_mat_perstep</tt>
+ * is FALSE, for as long as the structures sharing it have only translated and
+ * rotated together (up to <tt>rigid_configuration_tol</tt>). The matrix is
+ * rebuilt in the current configuration once they move relative to each other.
  */
 class DirectMobilitySolver : public SAMRAI::tbox::DescribedClass
 {
@@ -214,8 +237,18 @@ private:
      */
     void getFromInput(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
 
+    /*!
+     * \brief Check whether the structures sharing the mobility matrix
+     * \a mat_name have only moved rigidly with respect to each other since the
+     * initial time.
+     */
+    bool isRigidConfiguration(const std::string& mat_name);
+
     /*!
      * \brief Factorize mobility matrix using direct solvers.
+     *
+     * \note This is a collective operation when the cluster factorizations are
+     * distributed.
      */
     void factorizeMobilityMatrix();
 
@@ -230,10 +263,12 @@ private:
     void factorizeBodyMobilityMatrix();
 
     /*!
-     * \brief Factorize dense matrix.
+     * \brief Factorize dense matrix, or a diagonal block of it stored with
+     * leading dimension \a lda.
      */
     void factorizeDenseMatrix(double* mat_data,
                               const int mat_size,
+                              const int lda,
                               const MobilityMatrixInverseType& inv_type,
                               int* ipiv,
                               const std::string& mat_name,
@@ -241,8 +276,15 @@ private:
 
     /*!
      * \brief Compute solution and store in the rhs vector.
+     *
+     * The diagonal blocks of the factorized matrix are given by the dof offsets
+     * \a block_offsets, whose last entry is the size of the matrix.
      */
-    void computeSolution(Mat& mat, const MobilityMatrixInverseType& inv_type, int* ipiv, double* rhs);
+    void computeSolution(Mat& mat,
+                         const MobilityMatrixInverseType& inv_type,
+                         int* ipiv,
+                         double* rhs,
+                         const std::vector<int>& block_offsets);
 
     // Solver stuff
     std::string d_object_name;
@@ -264,6 +306,9 @@ private:
     std::map<std::string, std::pair<double, double> > d_mat_scale_map;
     std::map<std::string, std::string> d_mat_filename_map;
     std::map<std::string, std::pair<std::vector<int>, std::vector<int> > > d_ipiv_map; // permutation matrices for LU
+    std::map<std::string, std::vector<int> > d_mat_block_offsets_map; // factorized diagonal blocks of mobility matrix
+    std::map<std::string, bool> d_mat_body_frame_map;   // whether the matrix is stored in the body frame
+    std::map<std::string, bool> d_mat_needs_update_map; // whether the matrix is rebuilt in this initialization
 
     // PETSc representation of matrices.
     std::map<std::string, std::pair<Mat, Mat> > d_petsc_mat_map;
@@ -277,6 +322,10 @@ private:
     // Parameters used in this class.
     double d_f_periodic_corr = 0.0;
     bool d_recompute_mob_mat = false;
+    int d_max_cluster_size = 0;
+    bool d_distribute_cluster_factorization = true;
+    bool d_reuse_rigid_factorization = false;
+    double d_rigid_configuration_tol = 1.0e-8;
     double d_svd_replace_value, d_svd_eps;
 
 }; // DirectMobilitySolver
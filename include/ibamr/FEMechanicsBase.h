@@ -187,8 +187,36 @@ public:
      */
     using PK1StressFcnPtr = IBTK::TensorMeshFcnPtr;
 
+    /*!
+     * Typedef specifying interface for a batched PK1 stress tensor function.
+     *
+     * A batched function evaluates the stress at \p n_points quadrature points
+     * of the element \p elem in a single call: the arrays \p PP, \p FF, \p x,
+     * \p X, \p system_var_data, and \p system_grad_var_data each have
+     * \p n_points entries, and the entries of \p system_var_data and
+     * \p system_grad_var_data are the same vectors that would be passed to a
+     * PK1StressFcnPtr at each quadrature point. Passing all quadrature points
+     * of an element at once lets the constitutive law be inlined and
+     * vectorized, and lets quantities that are the same at all points (e.g.,
+     * material parameters) be computed once per element.
+     */
+    using PK1StressBatchFcnPtr =
+        void (*)(libMesh::TensorValue<double>* PP,
+                 const libMesh::TensorValue<double>* FF,
+                 const libMesh::Point* x,
+                 const libMesh::Point* X,
+                 unsigned int n_points,
+                 libMesh::Elem* elem,
+                 const std::vector<const std::vector<double>*>* system_var_data,
+                 const std::vector<const std::vector<libMesh::VectorValue<double> >*>* system_grad_var_data,
+                 double data_time,
+                 void* ctx);
+
     /*!
      * Struct encapsulating PK1 stress tensor function data.
+     *
+     * Exactly one of PK1StressFcnData::fcn and PK1StressFcnData::batch_fcn
+     * should be set.
      */
     struct PK1StressFcnData
     {
@@ -201,7 +229,46 @@ public:
         {
         }
 
+        PK1StressFcnData(PK1StressBatchFcnPtr batch_fcn,
+                         std::vector<IBTK::SystemData> system_data = {},
+                         void* const ctx = nullptr,
+                         const libMesh::QuadratureType& quad_type = libMesh::INVALID_Q_RULE,
+                         const libMesh::Order& quad_order = libMesh::INVALID_ORDER)
+            : fcn(nullptr),
+              batch_fcn(batch_fcn),
+              system_data(std::move(system_data)),
+              ctx(ctx),
+              quad_type(quad_type),
+              quad_order(quad_order)
+        {
+        }
+
+        /*!
+         * Whether either a pointwise or a batched stress function is set.
+         */
+        bool isSet() const
+        {
+            return fcn || batch_fcn;
+        }
+
+        /*!
+         * Evaluate the stress at \p n_points quadrature points of \p elem,
+         * either via a single call to the batched function or, if only the
+         * pointwise function is set, one call per point. \p system_var_data
+         * and \p system_grad_var_data are arrays of \p n_points entries.
+         */
+        void evaluate(libMesh::TensorValue<double>* PP,
+                      const libMesh::TensorValue<double>* FF,
+                      const libMesh::Point* x,
+                      const libMesh::Point* X,
+                      unsigned int n_points,
+                      libMesh::Elem* elem,
+                      const std::vector<const std::vector<double>*>* system_var_data,
+                      const std::vector<const std::vector<libMesh::VectorValue<double> >*>* system_grad_var_data,
+                      double data_time) const;
+
         PK1StressFcnPtr fcn;
+        PK1StressBatchFcnPtr batch_fcn = nullptr;
         std::vector<IBTK::SystemData> system_data;
         void* ctx;
         libMesh::QuadratureType quad_type;
@@ -643,6 +710,15 @@ protected:
     std::vector<libMesh::Order> d_default_quad_order_stress, d_default_quad_order_force, d_default_quad_order_pressure;
     bool d_use_consistent_mass_matrix = true;
     bool d_allow_rules_with_negative_weights = true;
+
+    /*!
+     * Whether the element loop that assembles the stress contributions to the
+     * interior force density is run on all available OpenMP threads.  This
+     * requires that all registered PK1 stress functions are thread-safe and
+     * has no effect if IBAMR is compiled without OpenMP.
+     */
+    bool d_use_threaded_stress_assembly = false;
+
     bool d_include_normal_stress_in_weak_form = false;
     bool d_include_tangential_stress_in_weak_form = false;
     bool d_include_normal_surface_forces_in_weak_form = true;
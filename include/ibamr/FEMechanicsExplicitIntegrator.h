@@ -30,6 +30,16 @@ namespace IBAMR
  * elastodynamics time integrator with an interface that is similar to
  * IBFEMethod to facilitate model re-use.
  *
+ * In addition to the input database entries read by FEMechanicsBase, this
+ * class reads:
+ *
+ * <ul>
+ *   <li><code>mass_density</code>: the mass density of each part (default
+ *   1.0).</li>
+ *   <li><code>num_substeps</code>: the number of steps taken by
+ *   subcycledStep() per call (default 1).</li>
+ * </ul>
+ *
  * \see IBFEMethod
  */
 class FEMechanicsExplicitIntegrator : public FEMechanicsBase
@@ -132,6 +142,36 @@ public:
      */
     void modifiedTrapezoidalStep(double current_time, double new_time);
 
+    /*!
+     * Advance the structural velocities and positions from @p current_time to
+     * @p new_time by taking getNumberOfSubsteps() equally sized steps with the
+     * specified one-step method, e.g.,
+     *
+     * @code
+     * solver->subcycledStep(t, t + dt, &FEMechanicsExplicitIntegrator::modifiedTrapezoidalStep);
+     * @endcode
+     *
+     * This permits stiff structures to be advanced with a smaller time step
+     * size than the one used by the rest of the simulation. Only the force
+     * assembly is repeated at each substep.
+     *
+     * Upon return, the "new" force vector contains the time-averaged force
+     * over the interval, i.e., the force that, applied over the whole time
+     * step, produces the same change in the structural velocity as the
+     * substeps. The "current" vectors are not modified.
+     *
+     * @note This function must be called between preprocessIntegrateData()
+     * and postprocessIntegrateData().
+     */
+    void subcycledStep(double current_time,
+                       double new_time,
+                       void (FEMechanicsExplicitIntegrator::*step_fcn)(double, double));
+
+    /*!
+     * Get the number of steps taken by subcycledStep().
+     */
+    int getNumberOfSubsteps() const;
+
     /*!
      * Compute the Lagrangian force at the specified time within the current
      * time interval.
@@ -166,6 +206,9 @@ protected:
     /// Structure mass densities.
     std::vector<double> d_rhos;
 
+    /// Number of steps taken by subcycledStep().
+    int d_num_substeps = 1;
+
 private:
     /*!
      * Implementation of class constructor.
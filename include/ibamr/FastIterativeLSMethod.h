@@ -0,0 +1,154 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBAMR_FastIterativeLSMethod
+#define included_IBAMR_FastIterativeLSMethod
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibamr/config.h>
+
+#include "ibamr/LSInitStrategy.h"
+#include "ibamr/ibamr_enums.h"
+
+#include "tbox/Pointer.h"
+
+#include <string>
+
+namespace SAMRAI
+{
+namespace pdat
+{
+template <int DIM, class TYPE>
+class CellData;
+} // namespace pdat
+namespace hier
+{
+template <int DIM>
+class Box;
+template <int DIM>
+class Patch;
+} // namespace hier
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBAMR
+{
+/*!
+ * \brief Class FastIterativeLSMethod provides a fast iterative method
+ * implementation of the level set method. Specifically, this class produces a
+ * solution to the Eikonal equation \f$ |\nabla Q | = 1 \f$, which produces the
+ * signed distance away from an interface.
+ *
+ * The Eikonal equation is solved on each patch by the fast iterative method,
+ * which maintains a list of active cells whose values are updated until they
+ * converge. Converged cells activate their neighbors when those neighbors can
+ * be improved, so that the updates follow the characteristics of the distance
+ * function rather than a fixed set of sweeping orderings. Each patch is solved
+ * to convergence for its current ghost cell values, after which the ghost cell
+ * values are exchanged and only the cells next to the patch boundaries are
+ * used to restart the method. The number of communication rounds (each
+ * consisting of one ghost cell fill and one reduction) is therefore determined
+ * by the number of patches crossed by the characteristics, rather than by the
+ * convergence rate of the sweeps. The maximum number of rounds is set by the
+ * input database entry <code>max_iterations</code>, and the method stops when
+ * no value changes by more than <code>abs_tol</code> in a round.
+ *
+ * The first-order upwind discretization and the treatment of physical domain
+ * walls are the same as in FastSweepingLSMethod.
+ *
+ * References
+ * Jeong, W.-K. and Whitaker, R. T., <A HREF="https://epubs.siam.org/doi/10.1137/060670298">
+ * A Fast Iterative Method for Eikonal Equations</A>
+ */
+class FastIterativeLSMethod : public IBAMR::LSInitStrategy
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    FastIterativeLSMethod(std::string object_name,
+                          SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db = NULL,
+                          bool register_for_restart = true);
+
+    /*!
+     * \brief Destructor.
+     */
+    virtual ~FastIterativeLSMethod() = default;
+
+    /*!
+     * \brief Initialize level set data using the fast iterative method.
+     */
+    void initializeLSData(int D_idx,
+                          SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> hierarchy_math_ops,
+                          int integrator_step,
+                          double time,
+                          bool initial_time) override;
+
+protected:
+    // Algorithm parameters.
+    bool d_consider_phys_bdry_wall = false;
+    int d_wall_location_idx[2 * NDIM];
+
+private:
+    /*!
+     * \brief Solve the Eikonal equation on a patch for the current ghost cell
+     * values. The method is started from all interior cells if @p seed_all is
+     * true and from the interior cells next to the patch boundary otherwise.
+     *
+     * \return The maximum change of any value of the patch.
+     */
+    double iteratePatch(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dist_data,
+                        const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                        const SAMRAI::hier::Box<NDIM>& domain_box,
+                        bool seed_all) const;
+
+    /*!
+     * Read input values from a given database.
+     */
+    void getFromInput(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
+
+    /*!
+     * Read object state from the restart file and initialize class data
+     * members.
+     */
+    void getFromRestart();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    FastIterativeLSMethod(const FastIterativeLSMethod& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    FastIterativeLSMethod& operator=(const FastIterativeLSMethod& that) = delete;
+};
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBAMR_FastIterativeLSMethod
@@ -20,6 +20,7 @@
 
 #include <ibamr/config.h>
 
+#include "ibtk/ObjectPool.h"
 #include "ibtk/Streamable.h"
 #include "ibtk/StreamableFactory.h"
 
@@ -49,7 +50,7 @@ namespace IBAMR
  * \note Anchored curvilinear mesh nodes are fixed in space and are not allowed
  * to spread force to the Cartesian grid.
  */
-class IBAnchorPointSpec : public IBTK::Streamable
+class IBAnchorPointSpec : public IBTK::Streamable, public IBTK::ObjectPoolAllocated<IBAnchorPointSpec>
 {
 public:
     /*!
@@ -172,6 +173,22 @@ private:
         SAMRAI::tbox::Pointer<IBTK::Streamable> unpackStream(SAMRAI::tbox::AbstractStream& stream,
                                                              const SAMRAI::hier::IntVector<NDIM>& offset) override;
 
+        /*!
+         * \brief Pack the IBAnchorPointSpec objects with a few copies of contiguous
+         * arrays.
+         */
+        void packStreams(SAMRAI::tbox::AbstractStream& stream,
+                         const SAMRAI::tbox::Pointer<IBTK::Streamable>* data_items,
+                         int num_items) override;
+
+        /*!
+         * \brief Build IBAnchorPointSpec objects from data packed by packStreams().
+         */
+        void unpackStreams(SAMRAI::tbox::AbstractStream& stream,
+                           const SAMRAI::hier::IntVector<NDIM>& offset,
+                           SAMRAI::tbox::Pointer<IBTK::Streamable>* data_items,
+                           int num_items) override;
+
     private:
         /*!
          * \brief Default constructor.
@@ -20,6 +20,7 @@
 
 #include <ibamr/config.h>
 
+#include "ibtk/ObjectPool.h"
 #include "ibtk/Streamable.h"
 #include "ibtk/StreamableFactory.h"
 #include "ibtk/ibtk_utilities.h"
@@ -55,7 +56,7 @@ namespace IBAMR
  * IBBeamForceSpec objects are stored as IBTK::Streamable data associated with
  * only the master beam nodes in the mesh.
  */
-class IBBeamForceSpec : public IBTK::Streamable
+class IBBeamForceSpec : public IBTK::Streamable, public IBTK::ObjectPoolAllocated<IBBeamForceSpec>
 {
 public:
     /*!
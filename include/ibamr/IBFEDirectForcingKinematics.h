@@ -213,6 +213,19 @@ protected:
      */
     void computeMOIOfStructure(Eigen::Matrix3d& I, const Eigen::Vector3d& X0);
 
+    /*!
+     * Compute center of mass and the moment of inertia tensor about the center
+     * of mass of the structure with a single pass over the elements.
+     */
+    void computeCOMAndMOIOfStructure(Eigen::Vector3d& X0, Eigen::Matrix3d& I);
+
+    /*!
+     * Compute the volume, the first moment (the integral of X), and the second
+     * moment (the integral of X X^T) of the structure with a single pass over
+     * the elements and a single reduction.
+     */
+    void computeMomentsOfStructure(double& vol, Eigen::Vector3d& M1, Eigen::Matrix3d& M2);
+
     /*
      * The current time step interval.
      */
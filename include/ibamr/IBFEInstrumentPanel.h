@@ -25,6 +25,10 @@
 #include "ibtk/FEDataManager.h"
 #include "ibtk/ibtk_utilities.h"
 
+#include "Box.h"
+#include "BoxArray.h"
+#include "CellIndex.h"
+#include "SideIndex.h"
 #include "tbox/DescribedClass.h"
 #include "tbox/Pointer.h"
 
@@ -40,7 +44,9 @@ IBTK_DISABLE_EXTRA_WARNINGS
 IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <fstream>
+#include <map>
 #include <memory>
+#include <vector>
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
 
@@ -281,6 +287,46 @@ private:
      */
     using QuadPointMap = std::multimap<SAMRAI::hier::Index<NDIM>, QuadPointStruct, IndexFortranOrder>;
     std::vector<QuadPointMap> d_quad_point_map;
+
+    /*!
+     * \brief struct for storing the Eulerian interpolation stencils of the
+     * quadrature points that lie in a single patch.
+     *
+     * Each quadrature point has 2^NDIM cell-centered stencil entries, whose
+     * weights are scaled by the quadrature weight, and NDIM * 2^NDIM
+     * side-centered stencil entries (ordered by component), whose weights are
+     * scaled by the quadrature weight and the component of the normal vector.
+     */
+    struct PatchQuadPointStencils
+    {
+        SAMRAI::hier::Box<NDIM> patch_box;
+        std::vector<int> meter_num;
+        std::vector<double> JxW;
+        IBTK::EigenAlignedVector<IBTK::Vector> normal;
+        std::vector<SAMRAI::pdat::CellIndex<NDIM> > cc_idx;
+        std::vector<double> cc_wgt;
+        std::vector<SAMRAI::pdat::SideIndex<NDIM> > sc_idx;
+        std::vector<double> sc_flux_wgt;
+    };
+
+    /*!
+     * \brief the interpolation stencils of each local patch, indexed by level
+     * number and patch number.
+     */
+    std::vector<std::map<int, PatchQuadPointStencils> > d_patch_qp_stencils;
+
+    /*!
+     * \brief the data used to compute the stencils: they are only recomputed
+     * when the patch boxes or the quadrature orders change, or when a
+     * component of the displacement of a meter mesh changes by more than
+     * d_stencil_update_tol times the finest grid spacing (input key
+     * meters_stencil_update_tol, default 0, i.e., the stencils are recomputed
+     * whenever a meter mesh moves).
+     */
+    double d_stencil_update_tol = 0.0;
+    std::vector<libMesh::Order> d_stencil_quad_order;
+    std::vector<std::vector<double> > d_stencil_displacements;
+    std::vector<SAMRAI::hier::BoxArray<NDIM> > d_stencil_level_boxes;
 };
 } // namespace IBAMR
 
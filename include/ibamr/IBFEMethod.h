@@ -25,10 +25,12 @@
 #include "ibamr/IBStrategy.h"
 #include "ibamr/ibamr_enums.h"
 
+#include "ibtk/BoxGhostingFunctor.h"
 #include "ibtk/FEDataManager.h"
 #include "ibtk/LibMeshSystemIBVectors.h"
 #include "ibtk/SAMRAIDataCache.h"
 #include "ibtk/SAMRAIGhostDataAccumulator.h"
+#include "ibtk/ScheduleCache.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/libmesh_utilities.h"
 
@@ -37,6 +39,7 @@
 #include "IntVector.h"
 #include "LoadBalancer.h"
 #include "PatchHierarchy.h"
+#include "SideIndex.h"
 #include "SideVariable.h"
 #include "TagAndInitializeStrategy.h"
 #include "Variable.h"
@@ -56,6 +59,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -167,6 +171,11 @@ class IBFEDirectForcingKinematics;
  *   <li><code>spread_use_nodal_quadrature</code>: Same as above, but for spreading.
  *   <li><code>IB_use_nodal_quadrature</code>: overriding alias for the two previous
  *   entries - has the same default.</li>
+ *   <li><code>use_threaded_stress_assembly</code>: Whether or not the element
+ *   loop that assembles the PK1 stress contributions to the interior force
+ *   density is run on all available OpenMP threads. All registered PK1 stress
+ *   functions must then be thread-safe. Has no effect if IBAMR is compiled
+ *   without OpenMP. Defaults to <code>FALSE</code>.</li>
  * </ul>
  *
  * <h2>Options Controlling libMesh Partitioning</h2>
@@ -193,13 +202,23 @@ class IBFEDirectForcingKinematics;
  *
  *  <li>If <code>libmesh_partitioner_type</code> is <code>SAMRAI_BOX</code>
  *      then this class will always repartition the libMesh data with
- *      IBTK::BoxPartitioner every time the Eulerian data is regridded.</li>
+ *      IBTK::BoxPartitioner every time the Eulerian data is regridded. Each
+ *      Elem is assigned to the processor that owns the patch on the finest
+ *      level of the hierarchy used for interpolation and spreading (i.e., the
+ *      scratch hierarchy, if it is in use) containing its centroid, and the
+ *      degrees of freedom of each System are then redistributed to match.</li>
  * </ul>
  * The default value for <code>libmesh_partitioner_type</code> is
  * <code>LIBMESH_DEFAULT</code>. The intent of these choices is to
  * automatically use the fairest (that is, partitioning based on equal work
  * when computing force densities and L2 projections) partitioner.
  *
+ * The meshes may be instances of libMesh::DistributedMesh, in which case each
+ * processor only stores its own elements and the elements near its patches
+ * (see IBTK::BoxGhostingFunctor). These are updated every time the Eulerian
+ * data is regridded. With <code>SAMRAI_BOX</code> partitioning the elements
+ * are also moved to the processors that own the patches containing them.
+ *
  * <h2>Options Controlling IB Data Partitioning</h2>
  *
  * The main computational expenses of this class are
@@ -287,10 +306,12 @@ class IBFEDirectForcingKinematics;
  * <code>FALSE</code>) turns on the scratch hierarchy and the remaining
  * parameters determine how patches are generated and load balanced. The extra
  * argument <code>type</code> to <code>LoadBalancer</code> specifies whether
- * an IBTK::MergingLoadBalancer (chosen by <code>"MERGING"</code>) or the
- * default SAMRAI LoadBalancer (chosen by <code>"DEFAULT"</code>) is
- * used. Since IBTK::MergingLoadBalancer is usually what one wants
- * <code>"MERGING"</code> is the default. The merging option is better since
+ * an IBTK::MergingLoadBalancer (chosen by <code>"MERGING"</code>), an
+ * IBTK::SpaceFillingCurveLoadBalancer (chosen by
+ * <code>"SPACE_FILLING_CURVE"</code>), or the default SAMRAI LoadBalancer
+ * (chosen by <code>"DEFAULT"</code>) is used. Since
+ * IBTK::MergingLoadBalancer is usually what one wants <code>"MERGING"</code>
+ * is the default. The merging option is better since
  * it reduces the total number of elements which end up in patch ghost
  * regions since some patches will be merged together.
  *
@@ -477,9 +498,9 @@ public:
     IBFEMethod& operator=(const IBFEMethod& that) = delete;
 
     /*!
-     * \brief Defaulted destructor.
+     * \brief Destructor.
      */
-    ~IBFEMethod() override = default;
+    ~IBFEMethod() override;
 
     /*!
      * Return a pointer to the finite element data manager object for the
@@ -556,6 +577,18 @@ public:
      */
     const SAMRAI::hier::IntVector<NDIM>& getMinimumGhostCellWidth() const override;
 
+    /*!
+     * Return the number of ghost cells required to interpolate Eulerian data
+     * with the interpolation kernels of all parts.
+     */
+    const SAMRAI::hier::IntVector<NDIM>& getMinimumInterpolationGhostCellWidth() const override;
+
+    /*!
+     * Return the number of ghost cells required to spread Lagrangian data with
+     * the spreading kernels of all parts.
+     */
+    const SAMRAI::hier::IntVector<NDIM>& getMinimumSpreadingGhostCellWidth() const override;
+
     /*!
      * Setup the tag buffer.
      */
@@ -567,6 +600,12 @@ public:
      */
     virtual double getMaxPointDisplacement() const override;
 
+    /*!
+     * Same as the base class. The bounding box of each active part is
+     * compared to the boxes of the finest patch level of that part.
+     */
+    virtual bool areStructuresWithinRefinedRegions(int num_margin_cells) const override;
+
     /*!
      * Inactivate a structure/part. See IBAMR::IBStrategy::inactivateLagrangianStructure().
      *
@@ -606,6 +645,19 @@ public:
      */
     void postprocessIntegrateData(double current_time, double new_time, int num_cycles) override;
 
+    /*!
+     * Save a copy of the current structure position and velocity in the given
+     * slot.  The copies are stored as additional vectors of the position and
+     * velocity systems, which are reused when the slot is used again.
+     */
+    void saveRollbackState(int slot) override;
+
+    /*!
+     * Reset the current structure position and velocity to the copy stored in
+     * the given slot.
+     */
+    void restoreRollbackState(int slot) override;
+
     /*!
      * Interpolate the Eulerian velocity to the curvilinear mesh at the
      * specified time within the current time interval.
@@ -656,6 +708,18 @@ public:
                 const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& f_prolongation_scheds,
                 double data_time) override;
 
+    /*!
+     * Indicate whether spreadForce() can leave the summation of the values
+     * spread into patch ghost regions to the caller.
+     */
+    bool canDeferForceGhostDataAccumulation() const override;
+
+    /*!
+     * Set whether spreadForce() defers the summation of the values spread into
+     * patch ghost regions to the caller.
+     */
+    void setDeferForceGhostDataAccumulation(bool defer_ghost_data_accumulation) override;
+
     /*!
      * Indicate whether there are any internal fluid sources/sinks.
      */
@@ -982,26 +1046,14 @@ protected:
     const std::string d_lagrangian_workload_refine_type = "CONSERVATIVE_LINEAR_REFINE";
 
     /*!
-     * Refinement schedules for transferring data from d_hierarchy to
-     * d_scratch_hierarchy. The key type is the level number and a pair of
-     * indices (the primary and scratch, in that order).
-     *
-     * @note this function assumes that only data on the finest level needs to
-     * be transferred.
-     */
-    std::map<std::pair<int, std::pair<int, int> >, SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >
-        d_scratch_transfer_forward_schedules;
-
-    /*!
-     * Refinement schedules for transferring data from d_scratch_hierarchy to
-     * d_hierarchy. The key type is the level number and a pair of indices
-     * (the primary and scratch, in that order).
+     * Refinement schedules for transferring data between d_hierarchy and
+     * d_scratch_hierarchy. Schedules are shared by all pairs of patch data
+     * indices with consistent data types.
      *
      * @note this function assumes that only data on the finest level needs to
      * be transferred.
      */
-    std::map<std::pair<int, std::pair<int, int> >, SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >
-        d_scratch_transfer_backward_schedules;
+    IBTK::ScheduleCache d_scratch_transfer_schedules;
 
     /*!
      * Maximum level number in the patch hierarchy.
@@ -1050,17 +1102,27 @@ protected:
     /// Pointer to object used to accumulate forces during spreading.
     std::unique_ptr<IBTK::SAMRAIGhostDataAccumulator> d_ghost_data_accumulator;
 
+    /// Ghosting functors attached to the distributed meshes (null for
+    /// replicated meshes).
+    std::vector<std::unique_ptr<IBTK::BoxGhostingFunctor> > d_ghosting_functors;
+
+    /// Whether spreadForce() leaves the summation of ghost values to the
+    /// caller.
+    bool d_defer_force_ghost_data_accumulation = false;
+
     /*!
-     * Schedules for prolonging data during spreading. The keys are the level
-     * number, the patch data index for the coarse level data, and the patch
-     * data index which will be filled with fine level data.
+     * Schedules for prolonging data during spreading. Schedules are shared by
+     * all pairs of patch data indices with consistent data types.
      */
-    std::map<std::pair<int, std::pair<int, int> >, SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >
-        d_prolongation_schedules;
+    IBTK::ScheduleCache d_prolongation_schedules;
 
     /// Minimum ghost cell width.
     SAMRAI::hier::IntVector<NDIM> d_ghosts = 0;
 
+    /// Minimum ghost cell widths of the interpolated and the spread Eulerian
+    /// data.
+    SAMRAI::hier::IntVector<NDIM> d_interp_ghosts = 0, d_spread_ghosts = 0;
+
     /// Vectors of pointers to the systems for each part (for sources; other
     /// systems are handled by the base class).
     std::vector<libMesh::ExplicitSystem*> d_Q_systems;
@@ -1107,6 +1169,32 @@ protected:
     bool d_split_normal_force = false, d_split_tangential_force = false;
     bool d_use_jump_conditions = false;
 
+    /*!
+     * Cache of the intersections of the physical boundary sides of the
+     * elements with the Cartesian grid lines found by imposeJumpConditions().
+     * The intersections found for a side on a patch are reused as long as no
+     * node of the side has moved by more than
+     * d_jump_conditions_intersection_cache_tol times the grid spacing since
+     * they were computed.  The cache is cleared whenever the elements are
+     * reassociated with patches.
+     *
+     * Caching is enabled by setting cache_jump_condition_intersections to TRUE
+     * in the input database.  The default tolerance of zero only reuses
+     * intersections of sides that have not moved at all, which is exact.  A
+     * positive tolerance trades accuracy for speed: the jump conditions are
+     * then imposed at the reference coordinates of the cached intersections.
+     */
+    bool d_cache_jump_condition_intersections = false;
+    double d_jump_conditions_intersection_cache_tol = 0.0;
+    struct JumpConditionIntersections
+    {
+        std::vector<libMesh::Point> x_nodes;
+        std::vector<libMesh::Point> ref_coords;
+        std::vector<SAMRAI::pdat::SideIndex<NDIM> > indices;
+    };
+    std::vector<std::map<std::tuple<int, libMesh::dof_id_type, unsigned int>, JumpConditionIntersections> >
+        d_jump_condition_intersection_cache;
+
     /*!
      * Data related to handling stress normalization.
      */
@@ -1200,6 +1288,14 @@ private:
      */
     void assertStructureOnFinestLevel() const;
 
+    /*!
+     * Repartition the meshes with IBTK::BoxPartitioner, if requested, and make
+     * sure that each processor stores the elements of each distributed mesh
+     * that are near its patches. Returns true if any mesh was changed, in
+     * which case the FE data must be reinitialized.
+     */
+    bool updateMeshDistribution();
+
     /*!
      * Convenience function that reinitializes the patch-to-element mappings on
      * all relevant FEDataManagers (i.e., for all parts and, if enabled, on the
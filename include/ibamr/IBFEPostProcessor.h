@@ -46,7 +46,10 @@
 
 #include "petscsys.h"
 
+#include <limits>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace libMesh
@@ -126,11 +129,9 @@ public:
         TBOX_ASSERT(ctx);
         auto PK1_stress_fcn_data = static_cast<IBFEMethod::PK1StressFcnData*>(ctx);
         TBOX_ASSERT(PK1_stress_fcn_data);
-        IBTK::TensorMeshFcnPtr PK1_stress_fcn = PK1_stress_fcn_data->fcn;
-        void* PK1_stress_fcn_ctx = PK1_stress_fcn_data->ctx;
         libMesh::TensorValue<double> PP;
-        PK1_stress_fcn(PP, FF, X, s, elem, system_var_data, system_grad_var_data, data_time, PK1_stress_fcn_ctx);
-        sigma = PP * FF.transpose() / FF.det();
+        PK1_stress_fcn_data->evaluate(&PP, &FF, &X, &s, 1, elem, &system_var_data, &system_grad_var_data, data_time);
+        sigma = PP * FF.transpose() / IBTK::tensor_det<NDIM>(FF);
         return;
     } // cauchy_stress_from_PK1_stress_fcn
 
@@ -282,6 +283,43 @@ public:
      */
     virtual void postProcessData(double data_time);
 
+    /*!
+     * Execute the first half of postProcessData(): interpolate the registered
+     * Eulerian variables and store a copy of the solution vectors of all
+     * systems that are used to reconstruct variables on the mesh (i.e., the
+     * coordinates system and every system listed in the SystemData objects of
+     * the registered variables).
+     *
+     * The reconstruction is done later, by endPostProcessData(), from the
+     * stored copies, so the simulation may be advanced in between without
+     * changing the result. This permits moving the reconstruction off of the
+     * visualization dump step, e.g., to a step at which the caller writes
+     * other output.
+     *
+     * 
+ote Only one set of stored vectors is kept: it is an error to call
+     * this function again before calling endPostProcessData().
+     */
+    virtual void beginPostProcessData(double data_time);
+
+    /*!
+     * Execute the second half of postProcessData(): reconstruct the
+     * registered variables from the vectors stored by the last call to
+     * beginPostProcessData() and then release those vectors. The solution
+     * vectors of the systems managed by the simulation are restored before
+     * this function returns.
+     *
+     * @return The data time passed to beginPostProcessData(), which should be
+     * used when writing the reconstructed data.
+     */
+    virtual double endPostProcessData();
+
+    /*!
+     * Whether or not there is data stored by beginPostProcessData() which
+     * has not yet been reconstructed by endPostProcessData().
+     */
+    bool hasPendingPostProcessData() const;
+
 protected:
     /*!
      * Virtual function to interpolate Eulerian data to the mesh.
@@ -347,6 +385,15 @@ protected:
      */
     std::vector<libMesh::System*> d_var_systems;
 
+    /*!
+     * Copies of the solution vectors of the systems used by the
+     * reconstruction, made by beginPostProcessData(), and the corresponding
+     * data time.
+     */
+    std::vector<std::pair<libMesh::System*, std::unique_ptr<libMesh::NumericVector<double> > > > d_snapshot_vecs;
+    double d_snapshot_time = std::numeric_limits<double>::quiet_NaN();
+    bool d_snapshot_pending = false;
+
 private:
     /*!
      * \brief Default constructor.
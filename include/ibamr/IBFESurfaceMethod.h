@@ -346,6 +346,18 @@ public:
                 const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& f_prolongation_scheds,
                 double data_time) override;
 
+    /*!
+     * Indicate whether spreadForce() can leave the summation of the values
+     * spread into patch ghost regions to the caller.
+     */
+    bool canDeferForceGhostDataAccumulation() const override;
+
+    /*!
+     * Set whether spreadForce() defers the summation of the values spread into
+     * patch ghost regions to the caller.
+     */
+    void setDeferForceGhostDataAccumulation(bool defer_ghost_data_accumulation) override;
+
     /*!
      * Get the default interpolation spec object used by the class.
      */
@@ -576,6 +588,10 @@ protected:
     // Pointer to object used to accumulate forces during spreading.
     std::unique_ptr<IBTK::SAMRAIGhostDataAccumulator> d_ghost_data_accumulator;
 
+    // Whether spreadForce() leaves the summation of ghost values to the
+    // caller.
+    bool d_defer_force_ghost_data_accumulation = false;
+
     SAMRAI::hier::IntVector<NDIM> d_ghosts = 0;
 
     std::vector<libMesh::System*> d_U_systems;
@@ -682,6 +698,14 @@ protected:
     std::vector<LagSurfaceForceFcnData> d_lag_surface_force_fcn_data;
     std::vector<libMesh::VectorValue<double> > d_lag_surface_force_integral;
 
+    /*
+     * Positions, unit normals, and area elements in the reference
+     * configuration at the quadrature points of the active local elements used
+     * by computeLagrangianForce(), stored contiguously for each part. These
+     * only depend on the initial coordinates and are computed on first use.
+     */
+    std::vector<std::vector<double> > d_X_ref_qp, d_N_ref_qp, d_dA_ref_qp;
+
     /*
      * Nonuniform load balancing data structures.
      */
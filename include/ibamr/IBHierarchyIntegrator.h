@@ -302,6 +302,23 @@ protected:
      */
     void putToDatabaseSpecialized(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db) override;
 
+    /*!
+     * Save the Lagrangian state of the IBStrategy object in the given slot.
+     */
+    void saveRollbackStateSpecialized(int slot) override;
+
+    /*!
+     * Restore the Lagrangian state of the IBStrategy object from the given
+     * slot.
+     */
+    void restoreRollbackStateSpecialized(int slot) override;
+
+    /*!
+     * Discard the Lagrangian state of the IBStrategy object stored in the
+     * given slot.
+     */
+    void discardRollbackStateSpecialized(int slot) override;
+
     /*!
      * Add the work contributions (excluding the background grid) for the
      * current hierarchy into the variable with index
@@ -360,6 +377,16 @@ protected:
      */
     double d_regrid_structure_cfl_interval = -1.0;
 
+    /*
+     * If nonnegative, a regrid triggered only by the structure CFL estimate is
+     * skipped as long as every structure remains covered, with this many cells
+     * of margin, by the patch level on which it is assigned (see
+     * IBStrategy::areStructuresWithinRefinedRegions()). This avoids regridding
+     * the entire hierarchy while fast-moving structures are still well inside
+     * their refined regions.
+     */
+    int d_regrid_structure_margin = -1;
+
     /**
      * Estimation on the maximum fraction of fluid cells the structure has
      * moved based on the maximum fluid velocity.
@@ -331,6 +331,30 @@ private:
      */
     void resetFaceVolWeight(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > patch_hierarchy);
 
+    /*!
+     * \brief Reset the face area and volume weights if the patch hierarchy has
+     * changed since they were last computed.
+     *
+     * \return Whether the weights were recomputed.
+     */
+    bool resetFaceWeights(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > patch_hierarchy);
+
+    /*!
+     * \brief Reset the lists of local patch boxes covering the control volume
+     * of each structure and its boundary, for the structures whose control
+     * volume has moved or when the weights have been recomputed.
+     */
+    void resetControlVolumePatchBoxes(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > patch_hierarchy);
+
+    /*!
+     * \brief Compute the linear and angular momentum of the fluid inside the
+     * new control volume of a structure.
+     */
+    void computeBoxMomentumIntegral(const IBHydrodynamicForceObject& fobj,
+                                    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > patch_hierarchy,
+                                    IBTK::Vector3d& P_box,
+                                    IBTK::Vector3d& L_box);
+
     /*!
      * \brief Allocate and fill velocity and pressure patch data.
      */
@@ -381,6 +405,33 @@ private:
      * \brief Data structure encapsulating hydrodynamic force on an object.
      */
     std::map<int, IBHydrodynamicForceObject> d_hydro_objs;
+
+    /*!
+     * \brief The hierarchy and finest level number for which the face weights
+     * were computed.
+     */
+    SAMRAI::hier::PatchHierarchy<NDIM>* d_wgt_hierarchy = nullptr;
+    int d_wgt_finest_ln = -1;
+
+    /*!
+     * \brief Part of a control volume, or of one of its faces, on a local patch.
+     */
+    struct ControlVolumePatchBox
+    {
+        int level_number = -1, patch_number = -1;
+        int axis = -1, upper_lower = -1;
+        SAMRAI::hier::Box<NDIM> box;
+    };
+
+    /*!
+     * \brief Control volume boxes on each level and their parts on the local
+     * patches, for each structure, along with the control volume extents for
+     * which they were computed.
+     */
+    bool d_cv_patch_boxes_are_valid = false;
+    std::map<int, std::pair<IBTK::Vector3d, IBTK::Vector3d> > d_cv_patch_boxes_X;
+    std::map<int, std::vector<SAMRAI::hier::Box<NDIM> > > d_cv_integration_boxes;
+    std::map<int, std::vector<ControlVolumePatchBox> > d_cv_volume_boxes, d_cv_surface_boxes;
 };
 } // namespace IBAMR
 
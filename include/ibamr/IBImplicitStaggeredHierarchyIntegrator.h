@@ -74,6 +74,24 @@ namespace IBAMR
  * \brief Class IBImplicitStaggeredHierarchyIntegrator is an implementation of a
  * formally second-order accurate, nonlinearly-implicit version of the immersed
  * boundary method.
+ *
+ * The nonlinear solver (a PETSc SNES object with the options prefix
+ * <code>ib_</code>) and the Lagrangian Schur complement solver are created the
+ * first time they are needed and are reused in all subsequent time steps, so
+ * the PETSc options database is only read once. Only the shell matrices are
+ * rebuilt, and only when the number of local unknowns changes (e.g., after
+ * regridding). Jacobian lagging may be set from the input database:
+ *
+ * <code>snes_lag_jacobian</code>: the Jacobian is recomputed every this many
+ * Newton iterations (see SNESSetLagJacobian()). The default value is 1.
+ *
+ * <code>snes_lag_preconditioner</code>: the preconditioner is rebuilt every
+ * this many times the Jacobian is recomputed (see
+ * SNESSetLagPreconditioner()). The default value is 1.
+ *
+ * As usual, <code>-ib_snes_lag_jacobian</code> and
+ * <code>-ib_snes_lag_preconditioner</code> in the PETSc options database
+ * override these values.
  */
 class IBImplicitStaggeredHierarchyIntegrator : public IBHierarchyIntegrator
 {
@@ -93,9 +111,9 @@ public:
     /*!
      * The destructor for class IBImplicitStaggeredHierarchyIntegrator
      * unregisters the integrator object with the restart manager when the
-     * object is so registered.
+     * object is so registered and destroys the PETSc solver objects.
      */
-    ~IBImplicitStaggeredHierarchyIntegrator() = default;
+    ~IBImplicitStaggeredHierarchyIntegrator();
 
     /*!
      * Prepare to advance the data from current_time to new_time.
@@ -269,6 +287,18 @@ private:
      */
     void getFromRestart();
 
+    /*!
+     * \brief Create the nonlinear solver (if it does not exist yet) and set the
+     * residual vector and the Jacobian for the current time step.
+     */
+    void setupNonlinearSolver(Vec res_vec, Vec sol_vec);
+
+    /*!
+     * \brief Create the Lagrangian Schur complement solver (if it does not
+     * exist yet) for Lagrangian vectors like lag_vec.
+     */
+    void setupSchurSolver(Vec lag_vec);
+
     /*!
      * \brief Solve for position along with fluid variables.
      */
@@ -360,7 +390,14 @@ private:
     std::string d_jac_delta_fcn = "IB_4";
     SAMRAI::tbox::Pointer<StaggeredStokesSolver> d_stokes_solver;
     SAMRAI::tbox::Pointer<StaggeredStokesOperator> d_stokes_op;
-    KSP d_schur_solver;
+    SNES d_snes = nullptr;
+    Mat d_snes_jac = nullptr;
+    int d_snes_jac_local_size = -1;
+    int d_snes_lag_jacobian = 1, d_snes_lag_preconditioner = 1;
+    KSP d_schur_solver = nullptr;
+    Mat d_schur_mat = nullptr;
+    int d_schur_local_size = -1;
+    Mat d_interp_op = nullptr;
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_u_scratch_vec, d_f_scratch_vec;
     Vec d_X_current;
 };
@@ -133,7 +133,8 @@ public:
         double data_time) = 0;
 
     /*!
-     * Construct the IB interpolation operator.
+     * Construct the IB interpolation operator. If J is nonnull then it is
+     * either updated in place or destroyed and rebuilt.
      */
     virtual void constructInterpOp(Mat& J,
                                    void (*spread_fnc)(const double, double*),
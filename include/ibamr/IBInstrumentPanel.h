@@ -20,6 +20,7 @@
 
 #include <ibamr/config.h>
 
+#include "ibtk/IBTK_MPI.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "Index.h"
@@ -96,6 +97,9 @@ public:
      *
      * \note This vector is not initialized until the first call is made to
      * readInstrumentData().
+     *
+     * \note If nonblocking reductions are used, completeInstrumentData() must
+     * be called before this vector is accessed.
      */
     const std::vector<double>& getFlowValues() const;
 
@@ -104,6 +108,9 @@ public:
      *
      * \note This vector is not initialized until the first call is made to
      * readInstrumentData().
+     *
+     * \note If nonblocking reductions are used, completeInstrumentData() must
+     * be called before this vector is accessed.
      */
     const std::vector<double>& getMeanPressureValues() const;
 
@@ -112,6 +119,9 @@ public:
      *
      * \note This vector is not initialized until the first call is made to
      * readInstrumentData().
+     *
+     * \note If nonblocking reductions are used, completeInstrumentData() must
+     * be called before this vector is accessed.
      */
     const std::vector<double>& getPointwisePressureValues() const;
 
@@ -152,6 +162,28 @@ public:
                             int timestep_num,
                             double data_time);
 
+    /*!
+     * \return Whether the values computed by the most recent call to
+     * readInstrumentData() are still being synchronized across processes.
+     */
+    bool hasPendingInstrumentData() const;
+
+    /*!
+     * \brief Complete the synchronization of the values computed by the most
+     * recent call to readInstrumentData() and log them.
+     *
+     * The local contributions to all instrument values are synchronized by a
+     * single reduction. If the input database entry
+     * <code>use_nonblocking_reductions</code> is set to <code>TRUE</code>,
+     * readInstrumentData() only posts this reduction (via MPI_Iallreduce) and
+     * it is completed by this function, so that other work may be done while
+     * the reduction is in progress. This function is also called by
+     * readInstrumentData(), initializeHierarchyDependentData(), and the
+     * destructor. Otherwise, the reduction is completed before
+     * readInstrumentData() returns and this function does nothing.
+     */
+    void completeInstrumentData();
+
     /*!
      * \brief Set the directory where plot data is to be written.
      *
@@ -227,6 +259,14 @@ private:
     std::vector<std::string> d_instrument_names;
     std::vector<double> d_flow_values, d_mean_pres_values, d_point_pres_values;
 
+    /*
+     * Packed buffer and request for the reduction of the instrument values.
+     */
+    bool d_use_nonblocking_reductions = false;
+    bool d_reduction_pending = false;
+    std::vector<double> d_reduction_buffer;
+    IBTK::IBTK_MPI::request d_reduction_request = MPI_REQUEST_NULL;
+
     /*!
      * \brief Data structures employed to manage mappings between cell indices
      * and web patch data (i.e., patch centroids and area-weighted normals) and
@@ -266,6 +306,12 @@ private:
     using WebCentroidMap = std::multimap<SAMRAI::hier::Index<NDIM>, WebCentroid, IndexFortranOrder>;
     std::vector<WebCentroidMap> d_web_centroid_map;
 
+    /*
+     * The cells of each local patch (indexed by level number and patch number)
+     * that contain any web patch or web centroid.
+     */
+    std::vector<std::map<int, std::vector<SAMRAI::hier::Index<NDIM> > > > d_patch_meter_cells;
+
     /*
      * The directory where data is to be dumped and the most recent timestep
      * number at which data was dumped.
@@ -20,6 +20,7 @@
 
 #include <ibamr/config.h>
 
+#include "ibtk/ObjectPool.h"
 #include "ibtk/Streamable.h"
 #include "ibtk/StreamableFactory.h"
 
@@ -49,7 +50,7 @@ namespace IBAMR
  * \brief Class IBInstrumentationSpec encapsulates the data required to
  * initialize distributed internal flow meters and pressure gauges.
  */
-class IBInstrumentationSpec : public IBTK::Streamable
+class IBInstrumentationSpec : public IBTK::Streamable, public IBTK::ObjectPoolAllocated<IBInstrumentationSpec>
 {
 public:
     /*!
@@ -60,6 +60,11 @@ namespace IBAMR
  *
  * \note Class IBKirchhoffRodForceGen DOES NOT correct for periodic
  * displacements of IB points.
+ *
+ * If the input database sets <code>use_threaded_force_evaluation</code> to
+ * <code>TRUE</code> (the default is <code>FALSE</code>) and IBAMR is compiled
+ * with OpenMP, the rod forces and torques are computed on all available
+ * threads.
  */
 class IBKirchhoffRodForceGen : public virtual SAMRAI::tbox::DescribedClass
 {
@@ -137,6 +142,11 @@ private:
     std::vector<std::vector<std::array<double, IBRodForceSpec::NUM_MATERIAL_PARAMS> > > d_material_params;
     std::vector<bool> d_is_initialized;
     //\}
+
+    /*!
+     * Whether or not to compute rod forces on all available OpenMP threads.
+     */
+    bool d_use_threaded_force_evaluation = false;
 };
 } // namespace IBAMR
 
@@ -41,6 +41,7 @@
 #include "petscvec.h"
 
 #include <limits>
+#include <map>
 #include <set>
 #include <string>
 #include <vector>
@@ -150,6 +151,18 @@ public:
      */
     const SAMRAI::hier::IntVector<NDIM>& getMinimumGhostCellWidth() const override;
 
+    /*!
+     * Return the number of ghost cells required to interpolate Eulerian data
+     * with the interpolation kernel.
+     */
+    const SAMRAI::hier::IntVector<NDIM>& getMinimumInterpolationGhostCellWidth() const override;
+
+    /*!
+     * Return the number of ghost cells required to spread Lagrangian data with
+     * the spreading kernel.
+     */
+    const SAMRAI::hier::IntVector<NDIM>& getMinimumSpreadingGhostCellWidth() const override;
+
     /*!
      * Setup the tag buffer.
      */
@@ -353,6 +366,24 @@ public:
      */
     void postprocessData() override;
 
+    /*!
+     * Save a copy of the current structure position and velocity in the given
+     * slot.
+     */
+    void saveRollbackState(int slot) override;
+
+    /*!
+     * Reset the current structure position and velocity to the copy stored in
+     * the given slot.
+     */
+    void restoreRollbackState(int slot) override;
+
+    /*!
+     * Free the copy of the structure position and velocity stored in the
+     * given slot.
+     */
+    void discardRollbackState(int slot) override;
+
     /*!
      * Initialize Lagrangian data corresponding to the given AMR patch hierarchy
      * at the start of a computation.  If the computation is begun from a
@@ -544,8 +575,20 @@ protected:
     IBTK::LDataManager* d_l_data_manager;
     std::string d_interp_kernel_fcn = "IB_4", d_spread_kernel_fcn = "IB_4";
     bool d_error_if_points_leave_domain = false;
+    bool d_sort_local_indices_by_cell = false;
+    bool d_sort_local_nodes_by_cell = false;
+    bool d_calibrate_workload = false;
+    double d_workload_relaxation = 0.5;
+    bool d_cache_interaction_weights = false;
     SAMRAI::hier::IntVector<NDIM> d_ghosts;
 
+    /*
+     * Ghost cell widths of the interpolated and the spread Eulerian data. These
+     * differ from d_ghosts only when the interpolation and spreading kernels
+     * have different widths.
+     */
+    SAMRAI::hier::IntVector<NDIM> d_interp_ghosts, d_spread_ghosts;
+
     /*
      * Lagrangian variables.
      */
@@ -554,6 +597,21 @@ protected:
     std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_U_current_data, d_U_new_data, d_U_half_data, d_U_jac_data;
     std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > d_F_current_data, d_F_new_data, d_F_half_data, d_F_jac_data;
 
+    /*
+     * Lagrangian scratch data allocated at the beginning of each time step.
+     * These are kept resident between time steps, so that the PETSc vectors
+     * and their ghost scatters are not rebuilt every step, and are only
+     * reallocated after the Lagrangian data are redistributed.
+     */
+    std::map<std::string, std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > > d_scratch_l_data;
+    bool d_scratch_l_data_needs_reinit = true;
+
+    /*
+     * Copies of the structure position and velocity saved for repeating failed
+     * time steps, indexed by slot and level number.
+     */
+    std::map<int, std::vector<SAMRAI::tbox::Pointer<IBTK::LData> > > d_X_rollback_data, d_U_rollback_data;
+
     /*
      * List of local indices of local anchor points.
      *
@@ -568,6 +626,7 @@ protected:
      */
     SAMRAI::tbox::Pointer<IBInstrumentPanel> d_instrument_panel;
     std::vector<double> d_total_flow_volume;
+    double d_pending_flow_volume_dt = 0.0;
 
     /*
      * The specification and initialization information for the Lagrangian data
@@ -663,6 +722,12 @@ private:
      */
     void updateIBInstrumentationData(int timestep_num, double data_time);
 
+    /*!
+     * Add the flow through the internal flow meters over the time step of
+     * length d_pending_flow_volume_dt to the total flow volumes.
+     */
+    void updateTotalFlowVolume();
+
     /*!
      * Read input values from a given database.
      */
@@ -24,14 +24,17 @@
 
 #include "ibtk/LInitStrategy.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/NodeSharedArray.h"
 #include "ibtk/ibtk_utilities.h"
 
+#include "Box.h"
 #include "IntVector.h"
 #include "tbox/Pointer.h"
 
 #include <array>
 #include <functional>
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -50,6 +53,8 @@ template <int DIM>
 class Patch;
 template <int DIM>
 class PatchHierarchy;
+template <int DIM>
+class PatchLevel;
 } // namespace hier
 namespace tbox
 {
@@ -66,6 +71,16 @@ namespace IBAMR
  * initializes the configuration of one or more Lagrangian structures from input
  * files.
  *
+ * By default, the registered callbacks are called for every structure on every
+ * process. If the input database entry <tt>distribute_callbacks</tt> is set to
+ * TRUE, the structures are instead distributed among the processes in a
+ * round-robin fashion: the callbacks that generate the vertex positions and the
+ * springs of a structure are only called on the process to which the structure
+ * is assigned, and the generated data are then broadcast to all processes. This
+ * speeds up the initialization of many procedurally generated structures, but
+ * requires that the callbacks do not communicate and do not depend on being
+ * called on every process.
+ *
  * \todo Document input database entries.
  *
  */
@@ -563,6 +578,15 @@ protected:
                                  SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                  int level_number) const;
 
+    /*!
+     * \brief Sort the vertices associated with a given level number into the
+     * local patches of the specified patch level.
+     */
+    void buildPatchVertexCache(PatchVertexCache& cache,
+                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level,
+                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                               int level_number) const;
+
     /*!
      * \return The canonical Lagrangian index of the specified vertex.
      */
@@ -673,12 +697,38 @@ protected:
     double d_length_scale_factor = 1.0;
     IBTK::Vector d_posn_shift;
 
+    /*
+     * Whether the structure and spring callbacks are called for each
+     * structure on a single process instead of on all processes.
+     */
+    bool d_distribute_callbacks = false;
+
     /*
      * Vertex information.
      */
     std::vector<std::vector<int> > d_num_vertex, d_vertex_offset;
     std::vector<std::vector<std::vector<IBTK::Point> > > d_vertex_posn;
 
+    /*
+     * The positions of all vertices on each level, indexed by the vertex
+     * offsets, when they are stored in node-shared memory instead of in
+     * d_vertex_posn.
+     */
+    std::vector<std::unique_ptr<IBTK::NodeSharedArray<IBTK::Point> > > d_shared_vertex_posn;
+
+    /*
+     * The indices of the vertices initially located within each local patch,
+     * keyed by the patch level number and the level number of the vertices.
+     * These are computed in a single pass over the vertices and are reused
+     * until the local patch boxes change.
+     */
+    struct PatchVertexCache
+    {
+        std::map<int, SAMRAI::hier::Box<NDIM> > patch_boxes;
+        std::map<int, std::vector<std::pair<int, int> > > patch_vertices;
+    };
+    mutable std::map<std::pair<int, int>, PatchVertexCache> d_patch_vertex_cache;
+
     /*
      * Spring information.
      */
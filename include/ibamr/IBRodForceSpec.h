@@ -20,6 +20,7 @@
 
 #include <ibamr/config.h>
 
+#include "ibtk/ObjectPool.h"
 #include "ibtk/Streamable.h"
 #include "ibtk/StreamableFactory.h"
 #include "ibtk/ibtk_utilities.h"
@@ -51,7 +52,7 @@ namespace IBAMR
  * forces generated by a network of Kirchhoff rods at a single node of the
  * Lagrangian mesh.
  */
-class IBRodForceSpec : public IBTK::Streamable
+class IBRodForceSpec : public IBTK::Streamable, public IBTK::ObjectPoolAllocated<IBRodForceSpec>
 {
 public:
     static const int NUM_MATERIAL_PARAMS = 10;
@@ -20,6 +20,7 @@
 
 #include <ibamr/config.h>
 
+#include "ibtk/ObjectPool.h"
 #include "ibtk/Streamable.h"
 #include "ibtk/StreamableFactory.h"
 
@@ -46,7 +47,7 @@ namespace IBAMR
  * \brief Class IBSourceSpec encapsulates the data required to initialize
  * distributed internal sources and sinks.
  */
-class IBSourceSpec : public IBTK::Streamable
+class IBSourceSpec : public IBTK::Streamable, public IBTK::ObjectPoolAllocated<IBSourceSpec>
 {
 public:
     /*!
@@ -181,6 +182,22 @@ private:
         SAMRAI::tbox::Pointer<IBTK::Streamable> unpackStream(SAMRAI::tbox::AbstractStream& stream,
                                                              const SAMRAI::hier::IntVector<NDIM>& offset) override;
 
+        /*!
+         * \brief Pack the IBSourceSpec objects with a few copies of contiguous
+         * arrays.
+         */
+        void packStreams(SAMRAI::tbox::AbstractStream& stream,
+                         const SAMRAI::tbox::Pointer<IBTK::Streamable>* data_items,
+                         int num_items) override;
+
+        /*!
+         * \brief Build IBSourceSpec objects from data packed by packStreams().
+         */
+        void unpackStreams(SAMRAI::tbox::AbstractStream& stream,
+                           const SAMRAI::hier::IntVector<NDIM>& offset,
+                           SAMRAI::tbox::Pointer<IBTK::Streamable>* data_items,
+                           int num_items) override;
+
     private:
         /*!
          * \brief Default constructor.
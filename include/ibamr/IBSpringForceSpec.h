@@ -20,6 +20,7 @@
 
 #include <ibamr/config.h>
 
+#include "ibtk/ObjectPool.h"
 #include "ibtk/Streamable.h"
 #include "ibtk/StreamableFactory.h"
 #include "ibtk/ibtk_utilities.h"
@@ -69,7 +70,7 @@ namespace IBAMR
  * that implements the interface required by
  * IBSpringForceGen::registerSpringForceFunction().
  */
-class IBSpringForceSpec : public IBTK::Streamable
+class IBSpringForceSpec : public IBTK::Streamable, public IBTK::ObjectPoolAllocated<IBSpringForceSpec>
 {
 public:
     /*!
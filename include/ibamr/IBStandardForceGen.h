@@ -67,6 +67,20 @@ namespace IBAMR
  * force function with any function that implements the interface required by
  * registerSpringForceFunction().  Users may also specify additional force
  * functions that may be associated with arbitrary integer indices.
+ *
+ * If the input database sets <code>use_threaded_force_evaluation</code> to
+ * <code>TRUE</code> (the default is <code>FALSE</code>) and IBAMR is compiled
+ * with OpenMP, the spring and beam forces are computed on all available
+ * threads: each thread accumulates forces in its own buffer and the buffers
+ * are summed after all forces have been computed. All registered spring force
+ * functions must then be thread-safe.
+ *
+ * If the input database sets <code>overlap_force_communication</code> to
+ * <code>TRUE</code> (the default is <code>FALSE</code>), the target point
+ * forces, which only depend on the positions of locally owned nodes, are
+ * computed while the positions of the ghost nodes needed by the spring and beam
+ * forces are being communicated. Since the forces are then accumulated in a
+ * different order, the results may differ from the default ones by roundoff.
  */
 class IBStandardForceGen : public IBLagrangianForceStrategy
 {
@@ -191,6 +205,12 @@ private:
         std::vector<SpringForceFcnPtr> force_fcns;
         std::vector<SpringForceDerivFcnPtr> force_deriv_fcns;
         std::vector<const double*> parameters;
+
+        // The first num_default_springs springs use default_spring_force().
+        // Their forces are computed without calling the force function and
+        // T_over_R is scratch space for their scaled tensions.
+        int num_default_springs = 0;
+        std::vector<double> T_over_R;
     };
     std::vector<SpringData> d_spring_data;
 
@@ -274,6 +294,20 @@ private:
      * \brief Logging settings.
      */
     bool d_log_target_point_displacements = false;
+
+    /*!
+     * \brief Whether or not spring and beam forces are computed on all
+     * available OpenMP threads, and the per-thread force buffers used to do
+     * so.
+     */
+    bool d_use_threaded_force_evaluation = false;
+    std::vector<std::vector<double> > d_thread_force_buffers;
+
+    /*!
+     * \brief Whether or not the target point forces are computed while the
+     * ghost node positions are being communicated.
+     */
+    bool d_overlap_force_communication = false;
 };
 } // namespace IBAMR
 
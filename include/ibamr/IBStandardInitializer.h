@@ -32,6 +32,7 @@
 
 #include <array>
 #include <functional>
+#include <iosfwd>
 #include <map>
 #include <string>
 #include <utility>
@@ -95,6 +96,23 @@ namespace IBAMR
  ...
  \endverbatim
  *
+ * Vertex data may also be provided in binary form in a file with the
+ * extension <TT>".vertex.bin"</TT>. If such a file exists, it is read in
+ * place of the ASCII file. Binary vertex files consist of the eight characters
+ * <TT>IBAMRVTX</TT>, the spatial dimension and the number of vertices (as
+ * 32-bit integers), followed by the coordinates of each vertex (as 64-bit
+ * floating point values, stored vertex by vertex). All values use the native
+ * byte order of the machine. The script
+ * <TT>scripts/IB/vertex_ascii_to_binary.pl</TT> converts ASCII vertex files
+ * to this format. Large vertex files are read considerably faster in binary
+ * form since the coordinates do not need to be parsed.
+ *
+ * If <TT>use_node_shared_memory</TT> is set to <TT>TRUE</TT> in the input
+ * database, the vertex files are only read by the first MPI process on each
+ * node and the vertex positions are stored once per node in memory shared by
+ * all processes of the node (see IBTK::NodeSharedArray) instead of once per
+ * process.
+ *
  * <HR>
  *
  * <B>Spring file format</B>
@@ -471,6 +489,12 @@ private:
      */
     void readVertexFiles(const std::string& extension);
 
+    /*!
+     * \brief Read the vertex data for base file \a j on level \a ln from an
+     * open binary input file.
+     */
+    void readBinaryVertexFile(std::ifstream& file_stream, const std::string& vertex_filename, int ln, int j);
+
     /*!
      * \brief Read the spring data from one or more input files.
      */
@@ -543,6 +567,12 @@ private:
      */
     bool d_use_file_batons = true;
 
+    /*
+     * Whether the vertex positions are read once per node and stored in
+     * node-shared memory instead of being read and stored by every process.
+     */
+    bool d_use_node_shared_memory = false;
+
     /*
      * The maximum number of levels in the Cartesian grid patch hierarchy and a
      * vector of boolean values indicating whether a particular level has been
@@ -158,6 +158,26 @@ public:
      */
     virtual const SAMRAI::hier::IntVector<NDIM>& getMinimumGhostCellWidth() const = 0;
 
+    /*!
+     * Return the number of ghost cells required for the Eulerian data that are
+     * interpolated to the Lagrangian structure (e.g., the velocity and the
+     * pressure).
+     *
+     * A default implementation is provided that returns
+     * getMinimumGhostCellWidth().
+     */
+    virtual const SAMRAI::hier::IntVector<NDIM>& getMinimumInterpolationGhostCellWidth() const;
+
+    /*!
+     * Return the number of ghost cells required for the Eulerian data that are
+     * spread from the Lagrangian structure (e.g., the force density and the
+     * fluid source strength).
+     *
+     * A default implementation is provided that returns
+     * getMinimumGhostCellWidth().
+     */
+    virtual const SAMRAI::hier::IntVector<NDIM>& getMinimumSpreadingGhostCellWidth() const;
+
     /*!
      * Setup the tag buffer.
      *
@@ -241,6 +261,17 @@ public:
      */
     virtual double getMaxPointDisplacement() const;
 
+    /*!
+     * Return whether each structure owned by the current class is still
+     * covered, with a margin of \p num_margin_cells cells, by the patch level
+     * on which it is assigned. In this case, the hierarchy does not need to be
+     * regridded to keep the structures in the refined region, even if
+     * getMaxPointDisplacement() exceeds the regrid threshold.
+     *
+     * The default implementation returns false.
+     */
+    virtual bool areStructuresWithinRefinedRegions(int num_margin_cells) const;
+
     /*!
      * Method to prepare to advance data from current_time to new_time.
      *
@@ -323,6 +354,30 @@ public:
                 const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& f_prolongation_scheds,
                 double data_time) = 0;
 
+    /*!
+     * Indicate whether spreadForce() can leave the summation of the values
+     * spread into patch ghost regions to the caller.
+     *
+     * A default implementation is provided that returns false.
+     *
+     * \see setDeferForceGhostDataAccumulation()
+     */
+    virtual bool canDeferForceGhostDataAccumulation() const;
+
+    /*!
+     * Set whether spreadForce() defers the summation of the values spread into
+     * patch ghost regions.  When deferred, spreadForce() only spreads onto the
+     * finest level of the patch hierarchy and adds the spread values to both
+     * the patch interiors and the ghost regions of f_data_idx.  The caller is
+     * then responsible for applying the physical boundary operator and for
+     * summing the ghost values into the neighboring patches, which allows a
+     * single ghost data accumulation to be performed for several strategies.
+     *
+     * A default implementation is provided that reports an error if deferral
+     * is requested.
+     */
+    virtual void setDeferForceGhostDataAccumulation(bool defer_ghost_data_accumulation);
+
     /*!
      * Indicate whether there are any internal fluid sources/sinks.
      *
@@ -383,6 +438,34 @@ public:
      */
     virtual void postprocessData();
 
+    /*!
+     * Save a copy of the current Lagrangian state in the given slot so that a
+     * failed time step can be repeated.
+     *
+     * \see IBTK::HierarchyIntegrator::indicateStepFailure()
+     *
+     * A default implementation is provided that emits an unrecoverable
+     * exception.
+     */
+    virtual void saveRollbackState(int slot);
+
+    /*!
+     * Reset the current Lagrangian state to the copy stored in the given slot
+     * by saveRollbackState().
+     *
+     * A default implementation is provided that emits an unrecoverable
+     * exception.
+     */
+    virtual void restoreRollbackState(int slot);
+
+    /*!
+     * Free the copy of the Lagrangian state stored in the given slot by
+     * saveRollbackState().
+     *
+     * An empty default implementation is provided.
+     */
+    virtual void discardRollbackState(int slot);
+
     /*!
      * Initialize Lagrangian data corresponding to the given AMR patch hierarchy
      * at the start of a computation.  If the computation is begun from a
@@ -22,9 +22,14 @@
 
 #include "ibamr/IBStrategy.h"
 
+#include "ibtk/SAMRAIDataCache.h"
+#include "ibtk/SAMRAIGhostDataAccumulator.h"
+
 #include "IntVector.h"
+#include "PatchHierarchy.h"
 #include "tbox/Pointer.h"
 
+#include <memory>
 #include <vector>
 
 namespace IBTK
@@ -118,6 +123,18 @@ public:
      */
     const SAMRAI::hier::IntVector<NDIM>& getMinimumGhostCellWidth() const override;
 
+    /*!
+     * Return the number of ghost cells required for the Eulerian data that are
+     * interpolated by any of the owned IBStrategy objects.
+     */
+    const SAMRAI::hier::IntVector<NDIM>& getMinimumInterpolationGhostCellWidth() const override;
+
+    /*!
+     * Return the number of ghost cells required for the Eulerian data that are
+     * spread by any of the owned IBStrategy objects.
+     */
+    const SAMRAI::hier::IntVector<NDIM>& getMinimumSpreadingGhostCellWidth() const override;
+
     /*!
      * Setup the tag buffer.
      */
@@ -129,6 +146,11 @@ public:
      */
     virtual double getMaxPointDisplacement() const override;
 
+    /*!
+     * Same as the base class: considers all owned IBStrategy objects.
+     */
+    virtual bool areStructuresWithinRefinedRegions(int num_margin_cells) const override;
+
     /*!
      * Method to prepare to advance data from current_time to new_time.
      */
@@ -179,6 +201,19 @@ public:
      */
     void computeLagrangianForce(double data_time) override;
 
+    /*!
+     * \brief Set whether the values spread into patch ghost regions by the
+     * strategies that support deferring their summation (see
+     * IBStrategy::canDeferForceGhostDataAccumulation()) are summed in a single
+     * step.
+     *
+     * When enabled and at least two strategies support it, spreadForce() lets
+     * these strategies spread into a shared buffer and performs one ghost data
+     * accumulation for all of them instead of one per strategy.  Disabled by
+     * default.
+     */
+    void setCombineForceGhostDataAccumulation(bool combine_ghost_data_accumulation);
+
     /*!
      * Spread the Lagrangian force to the Cartesian grid at the specified time
      * within the current time interval.
@@ -351,6 +386,20 @@ private:
      * \brief The set of IBStrategy objects.
      */
     std::vector<SAMRAI::tbox::Pointer<IBStrategy> > d_strategy_set;
+
+    /*!
+     * \brief Whether to sum the ghost data of the spread forces of all
+     * strategies that support it in a single step.
+     */
+    bool d_combine_force_ghost_data_accumulation = false;
+
+    /*!
+     * \brief Data used to spread the forces of the strategies that defer their
+     * ghost data accumulation.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
+    IBTK::SAMRAIDataCache d_eulerian_data_cache;
+    std::unique_ptr<IBTK::SAMRAIGhostDataAccumulator> d_ghost_data_accumulator;
 };
 } // namespace IBAMR
 
@@ -20,6 +20,7 @@
 
 #include <ibamr/config.h>
 
+#include "ibtk/ObjectPool.h"
 #include "ibtk/Streamable.h"
 #include "ibtk/StreamableFactory.h"
 #include "ibtk/ibtk_utilities.h"
@@ -49,7 +50,7 @@ namespace IBAMR
  * force that approximately imposes a Dirichlet boundary condition at a single
  * node of the Lagrangian mesh).
  */
-class IBTargetPointForceSpec : public IBTK::Streamable
+class IBTargetPointForceSpec : public IBTK::Streamable, public IBTK::ObjectPoolAllocated<IBTargetPointForceSpec>
 {
 public:
     /*!
@@ -208,6 +209,22 @@ private:
         SAMRAI::tbox::Pointer<IBTK::Streamable> unpackStream(SAMRAI::tbox::AbstractStream& stream,
                                                              const SAMRAI::hier::IntVector<NDIM>& offset) override;
 
+        /*!
+         * \brief Pack the IBTargetPointForceSpec objects with a few copies of contiguous
+         * arrays.
+         */
+        void packStreams(SAMRAI::tbox::AbstractStream& stream,
+                         const SAMRAI::tbox::Pointer<IBTK::Streamable>* data_items,
+                         int num_items) override;
+
+        /*!
+         * \brief Build IBTargetPointForceSpec objects from data packed by packStreams().
+         */
+        void unpackStreams(SAMRAI::tbox::AbstractStream& stream,
+                           const SAMRAI::hier::IntVector<NDIM>& offset,
+                           SAMRAI::tbox::Pointer<IBTK::Streamable>* data_items,
+                           int num_items) override;
+
     private:
         /*!
          * \brief Default constructor.
@@ -121,6 +121,34 @@ public:
      */
     void registerPK1StressTensorFunction(PK1StressFcnPtr PK1_stress_fcn, void* PK1_stress_fcn_ctx = nullptr);
 
+    /*!
+     * Typedef specifying interface for a batched PK1 stress tensor function.
+     *
+     * The function evaluates the stress at \em num_points material points at
+     * once. Tensors are stored contiguously as 3x3 row-major blocks (so that
+     * \f$ F_{ij} \f$ of point \em k is <tt>FF[9*k+3*i+j]</tt>), and positions
+     * as blocks of NDIM components. In two spatial dimensions, the
+     * out-of-plane component of the deformation gradient is set to one.
+     */
+    using PK1StressBatchFcnPtr = void (*)(double* PP,
+                                          const double* FF,
+                                          const double* x,
+                                          const double* X,
+                                          const libMesh::subdomain_id_type* subdomain_ids,
+                                          std::vector<double>* const* internal_vars,
+                                          int num_points,
+                                          double time,
+                                          void* ctx);
+
+    /*!
+     * Register the (optional) batched function to compute the first
+     * Piola-Kirchhoff stress tensor. If provided, this function is used in
+     * place of any function registered via registerPK1StressTensorFunction(),
+     * and it is called once per patch level with all local material points.
+     */
+    void registerPK1StressTensorBatchFunction(PK1StressBatchFcnPtr PK1_stress_batch_fcn,
+                                              void* PK1_stress_batch_fcn_ctx = nullptr);
+
     /*!
      * Supply a Lagrangian initialization object.
      */
@@ -364,8 +392,24 @@ protected:
     /*
      * Functions used to compute the first Piola-Kirchhoff stress tensor.
      */
-    PK1StressFcnPtr d_PK1_stress_fcn;
-    void* d_PK1_stress_fcn_ctx;
+    PK1StressFcnPtr d_PK1_stress_fcn = nullptr;
+    void* d_PK1_stress_fcn_ctx = nullptr;
+    PK1StressBatchFcnPtr d_PK1_stress_batch_fcn = nullptr;
+    void* d_PK1_stress_batch_fcn_ctx = nullptr;
+
+    /*
+     * Structure-of-arrays copy of the local material point data used to
+     * evaluate the constitutive model. The storage is reused between calls to
+     * computeLagrangianForce().
+     */
+    struct MaterialPointBatch
+    {
+        std::vector<int> petsc_idxs;
+        std::vector<double> FF, PP, x, X;
+        std::vector<libMesh::subdomain_id_type> subdomain_ids;
+        std::vector<std::vector<double>*> internal_vars;
+    };
+    MaterialPointBatch d_mp_batch;
 
     /*
      * Lagrangian variables.
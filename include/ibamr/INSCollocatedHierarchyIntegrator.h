@@ -203,15 +203,10 @@ protected:
                                            int finest_level) override;
 
     /*!
-     * Set integer tags to "one" in cells where refinement of the given level
-     * should occur according to the magnitude of the fluid vorticity.
+     * Return the patch data index of the cell-centered vorticity used to tag
+     * cells for refinement.
      */
-    void applyGradientDetectorSpecialized(SAMRAI::tbox::Pointer<SAMRAI::hier::BasePatchHierarchy<NDIM> > hierarchy,
-                                          int level_number,
-                                          double error_data_time,
-                                          int tag_index,
-                                          bool initial_time,
-                                          bool uses_richardson_extrapolation_too) override;
+    int getVorticityPatchDataIndex() const override;
 
     /*!
      * Prepare variables for plotting.
@@ -257,6 +252,23 @@ private:
      */
     void computeDivSourceTerm(int F_idx, int Q_idx, int U_idx);
 
+    /*!
+     * Apply the gradient correction of the projection in a single pass over
+     * the patches, i.e., set
+     *
+     *    u_ADV_dst := u_ADV_src + alpha*Grad_Phi_fc,
+     *    Grad_Phi_cc := interp(Grad_Phi_fc),
+     *    U_dst := U_src + alpha*Grad_Phi_cc,
+     *
+     * in which Grad_Phi_fc must already be computed and synchronized at
+     * coarse-fine interfaces.
+     */
+    void applyProjectionGradientCorrection(double alpha,
+                                           int u_ADV_dst_idx,
+                                           int u_ADV_src_idx,
+                                           int U_dst_idx,
+                                           int U_src_idx);
+
     /*!
      * Reinitialize the operators and solvers used by the hierarchy integrator.
      */
@@ -50,6 +50,11 @@ class Patch;
 template <int DIM>
 class PatchLevel;
 } // namespace hier
+namespace pdat
+{
+template <int DIM, class TYPE>
+class CellData;
+} // namespace pdat
 namespace solv
 {
 template <int DIM>
@@ -426,6 +431,15 @@ protected:
      */
     void putToDatabaseSpecialized(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db) override;
 
+    /*!
+     * Return the patch data index of the cell-centered vorticity used to tag
+     * cells for refinement.
+     *
+     * The default implementation returns IBTK::invalid_index, in which case no
+     * cells are tagged based on the vorticity.
+     */
+    virtual int getVorticityPatchDataIndex() const;
+
     /*
      * Boolean value that indicates whether the integrator has been initialized.
      */
@@ -613,6 +627,20 @@ private:
      * members.
      */
     void getFromRestart();
+
+    /*!
+     * Tag cells on a single patch based on the magnitude of the vorticity.
+     *
+     * This function is registered with the HierarchyIntegrator base class as a
+     * patch tagging callback so that vorticity tagging is performed in the
+     * same pass over the patches as all other patch tagging criteria.
+     */
+    static void applyVorticityTaggingCallback(SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                              int level_number,
+                                              double error_data_time,
+                                              SAMRAI::pdat::CellData<NDIM, int>& tags_data,
+                                              bool initial_time,
+                                              void* ctx);
 };
 } // namespace IBAMR
 
@@ -29,6 +29,7 @@
 #include "ibtk/SideDataSynchronization.h"
 
 #include "CellVariable.h"
+#include "ComponentSelector.h"
 #include "HierarchyCellDataOpsReal.h"
 #include "HierarchyFaceDataOpsReal.h"
 #include "HierarchySideDataOpsReal.h"
@@ -77,6 +78,35 @@ namespace IBAMR
 /*!
  * \brief Class INSStaggeredHierarchyIntegrator provides a staggered-grid solver
  * for the incompressible Navier-Stokes equations on an AMR grid hierarchy.
+ *
+ * By default, the cell-centered diagnostic quantities (the interpolated
+ * velocity and body force, the vorticity, the divergence of the velocity, and
+ * the strain rate) are allocated on every level along with the state
+ * variables. If the input parameter \c lazy_allocate_diagnostic_data is set
+ * to \c TRUE, these quantities are instead only allocated when they are
+ * computed (i.e., when plot data are prepared or the hierarchy is regridded)
+ * and are freed at the beginning of the following time step. The vorticity is
+ * always allocated when it is used to tag cells for refinement. Lazily
+ * allocated data are not written to restart files.
+ *
+ * When more than one cycle is performed per time step, the Stokes solves of
+ * all but the last cycle only provide predicted values that are subsequently
+ * corrected.  If the input parameter \c predictor_cycle_rel_residual_tol is
+ * set, these solves use the larger of this value and the relative tolerance of
+ * the Stokes solver, and only the solve of the last cycle uses the tolerance of
+ * the Stokes solver.  The Stokes solver iterations of the predictor cycles are
+ * reported in the telemetry metric \c stokes_solver_predictor_iterations.
+ *
+ * Setting \c convective_time_stepping_type to \c IMEX_ARS222 or \c IMEX_ARS443
+ * selects the second- or third-order additive implicit-explicit Runge-Kutta
+ * schemes of Ascher, Ruuth, and Spiteri, in which the viscous and pressure
+ * terms are treated implicitly and the convective and body forcing terms
+ * (including forces spread from immersed structures) are treated explicitly.
+ * Each cycle computes one implicit stage, so these schemes use 2 and 4 cycles
+ * per time step, respectively, and the \c viscous_time_stepping_type is
+ * ignored.  The pressure computed in the last stage is the Lagrange multiplier
+ * of that stage.  Boundary conditions are imposed at the end of the time step
+ * in all stages.
  */
 class INSStaggeredHierarchyIntegrator : public INSHierarchyIntegrator
 {
@@ -188,6 +218,12 @@ public:
                                        bool skip_synchronize_new_state_data,
                                        int num_cycles = 1) override;
 
+    /*!
+     * Return the number of cycles to perform each time step.  For IMEX
+     * Runge-Kutta schemes, this is the number of implicit stages.
+     */
+    int getNumberOfCycles() const override;
+
     /*!
      * Setup solution and RHS vectors using state data maintained by the
      * integrator.
@@ -294,15 +330,10 @@ protected:
                                            int finest_level) override;
 
     /*!
-     * Set integer tags to "one" in cells where refinement of the given level
-     * should occur according to the magnitude of the fluid vorticity.
+     * Return the patch data index of the cell-centered vorticity used to tag
+     * cells for refinement.
      */
-    void applyGradientDetectorSpecialized(SAMRAI::tbox::Pointer<SAMRAI::hier::BasePatchHierarchy<NDIM> > hierarchy,
-                                          int level_number,
-                                          double error_data_time,
-                                          int tag_index,
-                                          bool initial_time,
-                                          bool uses_richardson_extrapolation_too) override;
+    int getVorticityPatchDataIndex() const override;
 
     /*!
      * Prepare variables for plotting.
@@ -315,6 +346,18 @@ protected:
     void regridProjection() override;
 
 private:
+    /*!
+     * Allocate the patch data with index \p idx on all levels of the patch
+     * hierarchy if it is lazily allocated diagnostic data that is not yet
+     * allocated.
+     */
+    void allocateDiagnosticData(int idx, double data_time);
+
+    /*!
+     * Deallocate all lazily allocated diagnostic data.
+     */
+    void deallocateDiagnosticData();
+
     /*!
      * \brief Default constructor.
      *
@@ -359,6 +402,14 @@ private:
      */
     TimeSteppingType getConvectiveTimeSteppingType(int cycle_num);
 
+    /*!
+     * Evaluate the explicit and implicit terms of the most recently computed
+     * stage of an IMEX Runge-Kutta scheme and add the contributions of all
+     * previous stages to the velocity right-hand side of the stage computed in
+     * cycle \em cycle_num.
+     */
+    void accumulateIMEXStageTerms(int U_rhs_idx, double current_time, double new_time, int cycle_num);
+
     /*!
      * Hierarchy operations objects.
      */
@@ -389,6 +440,20 @@ private:
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > > d_U_nul_vecs;
     bool d_vectors_need_init, d_explicitly_remove_nullspace;
 
+    /*
+     * The explicit and implicit terms of each stage and the accumulated
+     * right-hand side of the current stage of an IMEX Runge-Kutta scheme.
+     */
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > > d_imex_explicit_vecs,
+        d_imex_implicit_vecs;
+    SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_imex_rhs_vec;
+
+    /*
+     * Diagnostic data that are only allocated when they are needed.
+     */
+    bool d_lazy_allocate_diagnostic_data = false;
+    SAMRAI::hier::ComponentSelector d_diagnostic_data;
+
     std::string d_stokes_solver_type = StaggeredStokesSolverManager::UNDEFINED,
                 d_stokes_precond_type = StaggeredStokesSolverManager::UNDEFINED,
                 d_stokes_sub_precond_type = StaggeredStokesSolverManager::UNDEFINED;
@@ -396,6 +461,12 @@ private:
     SAMRAI::tbox::Pointer<StaggeredStokesSolver> d_stokes_solver;
     bool d_stokes_solver_needs_init;
 
+    /*
+     * Relative residual tolerance of the Stokes solves in predictor cycles (not
+     * used if nonpositive).
+     */
+    double d_predictor_cycle_rel_residual_tol = -1.0;
+
     /*!
      * Fluid solver variables.
      */
@@ -88,6 +88,13 @@ namespace IBAMR
  * This operator is to be used in conjuction with the conservative form of the variable coefficient
  * Navier-Stokes equations, which will produce better results for high density ratio flows.
  *
+ * Each stage of the density update is computed tile by tile. By default each
+ * patch is a single tile. If the input parameter \c tile_size is positive,
+ * patches are split into tiles with at most \c tile_size cells in each
+ * coordinate direction, which gives work to all threads on levels with only a
+ * few large patches. When IBAMR is compiled with OpenMP, the tiles of a level
+ * are processed concurrently unless the PPM limiter is used.
+ *
  * \see INSVCStaggeredHierarchyIntegrator
  */
 class INSVCStaggeredConservativeMassMomentumIntegrator : public virtual SAMRAI::tbox::DescribedClass
@@ -365,6 +372,11 @@ private:
     // Variable to indicate the density update time-stepping type.
     TimeSteppingType d_density_time_stepping_type = FORWARD_EULER;
 
+    // Maximum number of cells in each coordinate direction of the tiles on
+    // which the density update is computed. A nonpositive value means that
+    // each patch is a single tile.
+    int d_tile_size = 0;
+
     // Source term variable and function for the mass density update.
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > d_S_var;
     int d_S_scratch_idx = IBTK::invalid_index;
@@ -484,22 +484,32 @@ protected:
                                            int finest_level) override;
 
     /*!
-     * Virtual method to set integer tags to "one" in cells where refinement of the given level
-     * should occur according to the magnitude of the fluid vorticity.
+     * Return the patch data index of the cell-centered vorticity used to tag
+     * cells for refinement.
      */
-    virtual void
-    applyGradientDetectorSpecialized(SAMRAI::tbox::Pointer<SAMRAI::hier::BasePatchHierarchy<NDIM> > hierarchy,
-                                     int level_number,
-                                     double error_data_time,
-                                     int tag_index,
-                                     bool initial_time,
-                                     bool uses_richardson_extrapolation_too) override;
+    int getVorticityPatchDataIndex() const override;
 
     /*!
      * Virtual method to prepare variables for plotting.
      */
     virtual void setupPlotDataSpecialized() override;
 
+    /*!
+     * \brief Determine whether the solvers and preconditioners need to be
+     * reinitialized at the current time step.
+     *
+     * The solvers are reinitialized every \c precond_reinit_interval time
+     * steps. If \c precond_reinit_coef_change_tol is positive then they are
+     * also reinitialized whenever the relative change, in the maximum norm,
+     * of the variable density or viscosity since the solvers were last
+     * reinitialized exceeds that tolerance. In this case \c
+     * precond_reinit_interval is the maximum number of time steps between
+     * reinitializations. The density and viscosity are monitored through the
+     * pressure coefficient and the cell-centered viscous coefficient, which
+     * must be computed before this function is called.
+     */
+    bool preconditionersNeedReinit();
+
     /*!
      * Copy data from a side-centered variable to a face-centered variable.
      */
@@ -696,6 +706,16 @@ protected:
      */
     int d_precond_reinit_interval = 1;
 
+    /*
+     * Relative change in the variable coefficients that triggers the
+     * reinitialization of the preconditioner, and the copies of the
+     * coefficients that were used when it was last reinitialized. A
+     * nonpositive tolerance disables this check.
+     */
+    double d_precond_reinit_coef_change_tol = 0.0;
+    bool d_precond_coefs_stored = false;
+    int d_pressure_D_precond_idx, d_velocity_D_cc_precond_idx;
+
     /*
      * Objects to set initial condition for density and viscosity when they are maintained by the fluid integrator.
      */
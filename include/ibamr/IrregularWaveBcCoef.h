@@ -28,6 +28,8 @@
 #include "RobinBcCoefStrategy.h"
 #include "tbox/Pointer.h"
 
+#include <limits>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -173,6 +175,23 @@ private:
      */
     double getVelocity(double x, double z_plus_d, double time) const;
 
+    /*!
+     * Recompute the phases of the component waves and the surface elevation at
+     * horizontal position \a x and time \a time, and discard the cached velocity
+     * profile, if they differ from the position and time of the cached values.
+     *
+     * \note Boundary coefficients are requested in every ghost cell fill of the
+     * solvers, whereas the inlet profile changes only once per time step.
+     */
+    void updateInletProfile(double x, double time) const;
+
+    /*!
+     * Return the tabulated values of \f$ a_i \omega_i \cosh(k_i (z+d)) / \sinh(k_i d) \f$
+     * followed by \f$ a_i \omega_i \sinh(k_i (z+d)) / \sinh(k_i d) \f$ for all component
+     * waves at vertical position \a z_plus_d.
+     */
+    const std::vector<double>& getVerticalProfile(double z_plus_d) const;
+
     /*!
      * Book-keeping.
      */
@@ -219,6 +238,30 @@ private:
      * Number of interface cells.
      */
     double d_num_interface_cells;
+
+    /*!
+     * Horizontal position and time of the cached inlet profile.
+     */
+    mutable double d_profile_x = std::numeric_limits<double>::quiet_NaN(),
+                   d_profile_time = std::numeric_limits<double>::quiet_NaN();
+
+    /*!
+     * Cosine and sine of the phases \f$ k_i x - \omega_i t + \phi_i \f$ of the
+     * component waves, and the surface elevation, at the cached position and time.
+     */
+    mutable std::vector<double> d_cos_theta, d_sin_theta;
+    mutable double d_profile_eta = std::numeric_limits<double>::quiet_NaN();
+
+    /*!
+     * Velocity at the cached position and time, keyed on the vertical position.
+     */
+    mutable std::map<double, double> d_velocity_profile;
+
+    /*!
+     * Time-independent vertical profiles of the component waves, tabulated on
+     * the positions at which the velocity has been evaluated.
+     */
+    mutable std::map<double, std::vector<double> > d_vertical_profiles;
 };
 } // namespace IBAMR
 
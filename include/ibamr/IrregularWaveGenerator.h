@@ -26,6 +26,7 @@
 
 #include <fstream>
 #include <limits>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -68,6 +69,26 @@ private:
      */
     void getFromInput(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
+    /*!
+     * Recompute the time-dependent phase factors of the component waves if
+     * \a time differs from the time for which they were last computed.
+     */
+    void updatePhaseFactors(double time) const;
+
+    /*!
+     * Return the tabulated values of \f$ \cos(k_i x) \f$ followed by
+     * \f$ \sin(k_i x) \f$ for all component waves at horizontal position
+     * \a x.
+     */
+    const std::vector<double>& getHorizontalProfile(double x) const;
+
+    /*!
+     * Return the tabulated values of \f$ a_i \omega_i \cosh(k_i (z+d)) / \sinh(k_i d) \f$
+     * followed by \f$ a_i \omega_i \sinh(k_i (z+d)) / \sinh(k_i d) \f$ for all component
+     * waves at vertical position \a z_plus_d.
+     */
+    const std::vector<double>& getVerticalProfile(double z_plus_d) const;
+
     ///
     /// Number of component waves with random phases to be generated (default = 50).
     ///
@@ -117,6 +138,22 @@ private:
     /// Phase (random) of component waves [rad].
     ///
     std::vector<double> d_phase;
+
+    ///
+    /// Time at which the phase factors were last computed.
+    ///
+    mutable double d_phase_time = std::numeric_limits<double>::quiet_NaN();
+
+    ///
+    /// Cosine and sine of \f$ \phi_i - \omega_i t \f$ at the time d_phase_time.
+    ///
+    mutable std::vector<double> d_cos_phase, d_sin_phase;
+
+    ///
+    /// Time-independent horizontal and vertical profiles of the component
+    /// waves, tabulated on the positions at which the wave has been evaluated.
+    ///
+    mutable std::map<double, std::vector<double> > d_horizontal_profiles, d_vertical_profiles;
 };
 
 } // namespace IBAMR
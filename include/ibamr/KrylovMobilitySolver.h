@@ -58,6 +58,20 @@ namespace IBAMR
  * operator, \f$ L \f$ is the Stokes operator, and \f$ S \f$ is the spreading
  * operator.
  *
+ * Each application of \f$ M \f$ requires an inner Stokes solve. Two optional
+ * input parameters reduce the cost of these inner solves:
+ *
+ * - <tt>reuse_stokes_solution</tt> (default FALSE): start each inner Stokes
+ *   solve from the solution of the previous one instead of from zero.
+ * - <tt>adaptive_stokes_tolerance</tt> (default FALSE): relax the relative
+ *   tolerance of the inner Stokes solves as the outer residual decreases, so
+ *   that the inner tolerance is the base tolerance of the Stokes solver scaled
+ *   by the ratio of the initial to the current outer residual norm, and is
+ *   capped by <tt>max_stokes_rel_residual_tol</tt> (default 1.0e-2).
+ *
+ * Both options make the operator applied by the outer Krylov method vary
+ * slightly between iterations, so they should be used with a flexible
+ * method such as FGMRES.
  */
 class KrylovMobilitySolver : public SAMRAI::tbox::DescribedClass
 {
@@ -278,6 +292,12 @@ private:
      */
     static PetscErrorCode monitorKSP(KSP ksp, int it, PetscReal rnorm, void* mctx);
 
+    /*!
+     * \brief Record the outer residual norm used to set the inner Stokes
+     * solver tolerance.
+     */
+    static PetscErrorCode trackResidualNormKSP(KSP ksp, int it, PetscReal rnorm, void* mctx);
+
     //\}
 
     // Solver stuff
@@ -304,6 +324,11 @@ private:
     bool d_initial_guess_nonzero = false;
     bool d_enable_logging = false;
 
+    // Inner Stokes solver options.
+    bool d_reuse_stokes_solution = false, d_adaptive_stokes_tolerance = false;
+    double d_stokes_rel_residual_tol = 1.0e-5, d_max_stokes_rel_residual_tol = 1.0e-2;
+    double d_initial_outer_residual_norm = 0.0, d_outer_residual_norm = 0.0;
+
     // Velocity BCs and cached communication operators for interpolation operation.
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
     std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> d_u_bc_coefs;
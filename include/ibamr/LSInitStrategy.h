@@ -22,9 +22,11 @@
 
 #include "ibamr/ibamr_enums.h"
 
+#include "CellIndex.h"
 #include "tbox/Pointer.h"
 #include "tbox/Serializable.h"
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -63,6 +65,13 @@ namespace IBAMR
 /*!
  * \brief Class LSInitStrategy provides a generic interface for initializing the
  * implementation details of a particular version of the level set method.
+ *
+ * Implementations may support narrow band reinitialization, which is enabled by
+ * setting the input database entry <code>narrow_band_width</code> to a positive
+ * number of cells. In this mode, only the cells within that number of cells of
+ * the interface (located by the sign changes of the level set function) are
+ * reinitialized, and the level set function is set to plus or minus the band
+ * width everywhere else.
  */
 class LSInitStrategy : public SAMRAI::tbox::Serializable
 {
@@ -139,6 +148,34 @@ protected:
     std::vector<LocateInterfaceNeighborhoodFcnPtr> d_locate_interface_fcns;
     std::vector<void*> d_locate_interface_fcns_ctx;
 
+    /*!
+     * \brief Determine the cells of each local patch that are within
+     * d_narrow_band_width cells of the interface, which is located by the sign
+     * changes of the level set function stored in @p D_idx.
+     *
+     * \note The ghost cells of @p D_idx must be filled.
+     */
+    void
+    computeNarrowBand(int D_idx, SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy, double time);
+
+    /*!
+     * \brief Determine whether the given patch contains cells of the narrow
+     * band. This is always true when the narrow band is disabled.
+     */
+    bool patchIntersectsNarrowBand(int ln, int patch_num) const;
+
+    /*!
+     * \brief Set the level set function to plus or minus the band width in all
+     * interior cells that are not in the narrow band.
+     */
+    void clampNarrowBandFarField(int D_idx, SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy) const;
+
+    // Narrow band width (in number of cells), with zero indicating that the
+    // entire domain is reinitialized, and the cells of the narrow band on each
+    // local patch, indexed by level and patch number.
+    int d_narrow_band_width = 0;
+    std::vector<std::map<int, std::vector<SAMRAI::pdat::CellIndex<NDIM> > > > d_narrow_band_idxs;
+
 private:
     /*!
      * \brief Copy constructor.
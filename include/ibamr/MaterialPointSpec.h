@@ -20,6 +20,7 @@
 
 #include <ibamr/config.h>
 
+#include "ibtk/ObjectPool.h"
 #include "ibtk/Streamable.h"
 #include "ibtk/StreamableFactory.h"
 
@@ -50,7 +51,7 @@ namespace IBAMR
  * \brief Class MaterialPointSpec encapsulates data necessary to define the
  * properties associated with an immersed material point.
  */
-class MaterialPointSpec : public IBTK::Streamable
+class MaterialPointSpec : public IBTK::Streamable, public IBTK::ObjectPoolAllocated<MaterialPointSpec>
 {
 public:
     /*!
@@ -32,6 +32,7 @@
 
 #include "muParser.h"
 
+#include <array>
 #include <vector>
 
 namespace IBTK
@@ -79,7 +80,20 @@ public:
                         std::vector<int> cell_offset,
                         SAMRAI::tbox::Pointer<IBTK::LData> F_data);
 
+    // Implementation of initializeLevelData. Discards the stored pair list.
+    void initializeLevelData(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                             int level_number,
+                             double init_data_time,
+                             bool initial_time,
+                             IBTK::LDataManager* l_data_manager) override;
+
     // Implementation of computeLagrangianForce.
+    //
+    // If skin_distance is set in the input database then the interacting
+    // pairs of nodes (those within interaction_radius + skin_distance of each
+    // other, in units of the grid spacing) are stored and reused until some
+    // node has moved more than half of the skin distance. Otherwise the pairs
+    // are found by a search of the neighboring cells at each call.
     void computeLagrangianForce(SAMRAI::tbox::Pointer<IBTK::LData> F_data,
                                 SAMRAI::tbox::Pointer<IBTK::LData> X_data,
                                 SAMRAI::tbox::Pointer<IBTK::LData> U_data,
@@ -101,6 +115,26 @@ private:
     // Assignment operator, not implemented.
     NonbondedForceEvaluator& operator=(const NonbondedForceEvaluator& that) = delete;
 
+    // A pair of interacting nodes and the periodic shift of the search node.
+    struct NonbondedPair
+    {
+        int mstr_petsc_idx;
+        int search_petsc_idx;
+        std::array<double, NDIM> periodic_shift;
+    };
+
+    // Find all pairs of interacting nodes. If skin_distance is positive then
+    // only pairs closer than interaction_radius + skin_distance are kept.
+    void findPairs(std::vector<NonbondedPair>& pairs,
+                   const double* position,
+                   SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                   int level_number,
+                   IBTK::LDataManager* l_data_manager,
+                   double skin_distance) const;
+
+    // Add the force between a pair of nodes.
+    void evaluatePairForce(const NonbondedPair& pair, const double* position, double* force) const;
+
     // interaction radius:
     double d_interaction_radius;
 
@@ -116,6 +150,15 @@ private:
     // spring force function pointer, to evaluate the force between particles:
     // TODO: Add species, make this a map from species1 x species2 -> Force Function Pointer
     NonBddForceFcnPtr d_force_fcn_ptr;
+
+    // skin distance for the stored pair list (disabled when not positive):
+    double d_skin_distance = 0.0;
+
+    // stored pair list and the node positions at the time it was built:
+    bool d_pair_list_is_valid = false;
+    int d_pair_list_level_number = -1;
+    std::vector<NonbondedPair> d_pairs;
+    std::vector<double> d_X_pair_list;
 };
 } // namespace IBAMR
 
@@ -66,6 +66,11 @@ namespace IBAMR
  * \brief Class PenaltyIBMethod is an implementation of the abstract base class
  * IBStrategy that provides functionality required by the penalty IB (pIB)
  * method.
+ *
+ * If the input database sets <code>use_threaded_structure_update</code> to
+ * <code>TRUE</code> (the default is <code>FALSE</code>) and IBAMR is compiled
+ * with OpenMP, the penalty forces and the positions and velocities of the
+ * massive structure are computed on all available threads.
  */
 class PenaltyIBMethod : public IBMethod
 {
@@ -167,6 +172,12 @@ protected:
      */
     IBTK::Vector d_gravitational_acceleration;
 
+    /*
+     * Whether or not to update the massive structure on all available OpenMP
+     * threads.
+     */
+    bool d_use_threaded_structure_update = false;
+
 private:
     /*!
      * \brief Default constructor.
@@ -195,6 +206,14 @@ private:
      */
     PenaltyIBMethod& operator=(const PenaltyIBMethod& that) = delete;
 
+    /*!
+     * \brief Update the positions Y^{n+1} and velocities V^{n+1} of the massive
+     * structure using either the current values (forward Euler) or the
+     * averages of the current and new values (midpoint and trapezoidal rules)
+     * to evaluate the right-hand side.
+     */
+    void updateMassiveStructure(double dt, bool use_half_values);
+
     /*!
      * Read input values from a given database.
      */
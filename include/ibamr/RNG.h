@@ -20,11 +20,24 @@
 
 #include <ibamr/config.h>
 
+#include <array>
+#include <cstdint>
+
 namespace IBAMR
 {
 /*!
  * \brief Class RNG organizes functions that provide random-number generator
  * functionality.
+ *
+ * Two kinds of generators are provided:
+ *
+ * - a Mersenne Twister with a single (per-process) state, which is seeded via
+ *   srandgen() or parallel_seed() and accessed via genrand() and genrandn();
+ * - the counter-based Philox4x32-10 generator (Salmon et al., SC'11), which
+ *   maps a key and a counter to a random number without any internal state.
+ *   The values generated for a given key and counter do not depend on the
+ *   order in which they are generated, on the number of processes, or on the
+ *   partitioning of the computational domain.
  */
 class RNG
 {
@@ -37,6 +50,24 @@ public:
 
     static void parallel_seed(int global_seed);
 
+    /*!
+     * \brief Apply the Philox4x32-10 bijection to a counter for a given key.
+     */
+    static std::array<std::uint32_t, 4> philox(const std::array<std::uint32_t, 2>& key,
+                                               const std::array<std::uint32_t, 4>& counter);
+
+    /*!
+     * \brief Return a random number uniformly distributed on the (0,1)-interval
+     * that is a deterministic function of the key and the counter.
+     */
+    static double genrand(const std::array<std::uint32_t, 2>& key, const std::array<std::uint32_t, 4>& counter);
+
+    /*!
+     * \brief Return a standard normal random number that is a deterministic
+     * function of the key and the counter.
+     */
+    static double genrandn(const std::array<std::uint32_t, 2>& key, const std::array<std::uint32_t, 4>& counter);
+
 private:
     RNG() = delete;
     RNG(RNG&) = delete;
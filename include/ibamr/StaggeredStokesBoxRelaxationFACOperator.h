@@ -24,10 +24,6 @@
 
 #include "tbox/Pointer.h"
 
-#include "petscksp.h"
-#include "petscmat.h"
-#include "petscvec.h"
-
 #include <array>
 #include <string>
 #include <vector>
@@ -58,6 +54,17 @@ namespace IBAMR
  * \brief Class StaggeredStokesBoxRelaxationFACOperator is a concrete
  * StaggeredStokesFACPreconditionerStrategy implementing a box relaxation
  * (Vanka-type) smoother for use as a multigrid preconditioner.
+ *
+ * Each box consists of a single cell, i.e., the cell-centered pressure and the
+ * normal velocity components on the sides of the cell. Because the box problem
+ * is the same for every cell on a level, its inverse is computed once per level
+ * when the operator state is initialized and each box solve is a small dense
+ * matrix-vector product. The cells of each patch are relaxed in sequence, and
+ * when IBAMR is compiled with OpenMP, the patches of a level are smoothed
+ * concurrently.
+ *
+ * \note The box operator only depends on the constant C and D coefficients of
+ * the velocity problem, so variable coefficients are not supported.
  */
 class StaggeredStokesBoxRelaxationFACOperator : public StaggeredStokesFACPreconditionerStrategy
 {
@@ -145,11 +152,9 @@ private:
     StaggeredStokesBoxRelaxationFACOperator& operator=(const StaggeredStokesBoxRelaxationFACOperator& that) = delete;
 
     /*
-     * Box operator data.
+     * Inverse of the box operator on each level, stored in row-major order.
      */
-    std::vector<Mat> d_box_op;
-    std::vector<Vec> d_box_e, d_box_r;
-    std::vector<KSP> d_box_ksp;
+    std::vector<std::array<double, (2 * NDIM + 1) * (2 * NDIM + 1)> > d_box_inv;
 
     /*
      * Mappings from patch indices to patch operators.
@@ -0,0 +1,171 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBAMR_StaggeredStokesFFTLevelSolver
+#define included_IBAMR_StaggeredStokesFFTLevelSolver
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibamr/config.h>
+
+#include "ibamr/StaggeredStokesSolver.h"
+
+#include "ibtk/LinearSolver.h"
+
+#include "Box.h"
+#include "IntVector.h"
+#include "PatchLevel.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+#include <string>
+
+namespace SAMRAI
+{
+namespace solv
+{
+template <int DIM, class TYPE>
+class SAMRAIVectorReal;
+} // namespace solv
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBAMR
+{
+/*!
+ * \brief Class StaggeredStokesFFTLevelSolver is a concrete LinearSolver for the
+ * staggered-grid (MAC) discretization of the incompressible Stokes equations
+ * \f[
+ *   (C I + D L) u + \nabla p = f, \quad -\nabla \cdot u = g
+ * \f]
+ * on a \em single, uniform SAMRAI::hier::PatchLevel of a domain that is
+ * periodic in every direction.
+ *
+ * The coefficients \f$C\f$ and \f$D\f$ of the velocity problem must be
+ * constant.  In this case, the discrete operator is diagonalized by the
+ * discrete Fourier transform, and each mode is solved exactly by eliminating
+ * the velocity.  The mean of the pressure is set to zero, and the constant
+ * component of \f$g\f$ is discarded.  If \f$C = 0\f$, the mean of each
+ * velocity component is also set to zero.
+ *
+ * As for IBTK::CCPoissonFFTLevelSolver, the right-hand side is gathered onto
+ * every process, so this solver is intended for levels that are small enough
+ * to be replicated, e.g., as the coarsest level solver of a FAC
+ * preconditioner or as a direct solver for moderately sized uniform grids.
+ *
+ * Sample parameters for initialization from database (and their default
+ * values): \verbatim
+ enable_logging = FALSE  // see setLoggingEnabled()
+ \endverbatim
+ */
+class StaggeredStokesFFTLevelSolver : public IBTK::LinearSolver, public StaggeredStokesSolver
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    StaggeredStokesFFTLevelSolver(const std::string& object_name,
+                                  SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                                  const std::string& default_options_prefix);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~StaggeredStokesFFTLevelSolver();
+
+    /*!
+     * \brief Static function to construct a StaggeredStokesFFTLevelSolver.
+     */
+    static SAMRAI::tbox::Pointer<StaggeredStokesSolver>
+    allocate_solver(const std::string& object_name,
+                    SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                    const std::string& default_options_prefix)
+    {
+        return new StaggeredStokesFFTLevelSolver(object_name, input_db, default_options_prefix);
+    } // allocate_solver
+
+    /*!
+     * \name Linear solver functionality.
+     */
+    //\{
+
+    /*!
+     * \brief Solve the linear system of equations \f$Ax=b\f$ for \f$x\f$.
+     *
+     * \return \p true
+     */
+    bool solveSystem(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                     SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b) override;
+
+    /*!
+     * \brief Compute hierarchy dependent data required for solving \f$Ax=b\f$.
+     *
+     * An unrecoverable error occurs if the vectors are not defined on a single
+     * uniform level of a periodic domain or if the velocity problem
+     * coefficients are not constant.
+     */
+    void initializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                               const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b) override;
+
+    /*!
+     * \brief Remove all hierarchy dependent data allocated by
+     * initializeSolverState().
+     */
+    void deallocateSolverState() override;
+
+    //\}
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    StaggeredStokesFFTLevelSolver() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    StaggeredStokesFFTLevelSolver(const StaggeredStokesFFTLevelSolver& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    StaggeredStokesFFTLevelSolver& operator=(const StaggeredStokesFFTLevelSolver& that) = delete;
+
+    /*!
+     * \brief Associated patch level, its domain box, and its grid spacing.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > d_level;
+    SAMRAI::hier::Box<NDIM> d_domain_box;
+    SAMRAI::hier::IntVector<NDIM> d_num_cells;
+    double d_dx[NDIM];
+};
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBAMR_StaggeredStokesFFTLevelSolver
@@ -113,7 +113,25 @@ namespace IBAMR
  coarse_solver_db = { ... }                     // SAMRAI::tbox::Database for initializing
  coarse
  level solver
+ SAJ_approximation = "EXACT"                    // see below
+ use_matrix_free_SAJ = FALSE                    // see below
  \endverbatim
+ *
+ * The IB part of the finest level operator is S*A*J, where A is the Jacobian
+ * of the elasticity force, J is the interpolation operator and S = J^T is the
+ * (scaled) spreading operator. By default (<code>SAJ_approximation =
+ * "EXACT"</code>) this product is assembled and added to the level operators
+ * used by the smoothers. For large structures the product may use a lot of
+ * memory since each Lagrangian coupling in A couples all of the Eulerian
+ * degrees of freedom in the stencils of the two points. Setting
+ * <code>SAJ_approximation = "DIAGONAL"</code> instead assembles S*D*J, where D
+ * is the diagonal of A, which has the sparsity pattern of S*J and is much
+ * cheaper to compute. Since the level operators are only used to precondition
+ * the Stokes-IB system this approximation only affects the convergence rate.
+ *
+ * If <code>use_matrix_free_SAJ = TRUE</code> then the residuals on the finest
+ * level are computed with the exact operator S*A*J, which is applied
+ * matrix-free, instead of with the (possibly approximate) assembled product.
 */
 class StaggeredStokesIBLevelRelaxationFACOperator : public StaggeredStokesFACPreconditionerStrategy
 {
@@ -281,6 +299,17 @@ private:
     StaggeredStokesIBLevelRelaxationFACOperator&
     operator=(const StaggeredStokesIBLevelRelaxationFACOperator& that) = delete;
 
+    /*!
+     * \brief Apply the exact finest level IB operator S*A*J matrix-free.
+     */
+    static PetscErrorCode applyMatrixFreeSAJ(Mat SAJ, Vec x, Vec y);
+
+    /*!
+     * \brief Add the difference between the exact (matrix-free) and the
+     * assembled finest level IB operator applied to x to y.
+     */
+    void addMatrixFreeSAJCorrection(Vec x, Vec y);
+
     /*
      * Whether we re-discretize the Stokes operator on coarser level or are
      * using Galerkin projection.
@@ -335,9 +364,19 @@ private:
      * on various patch levels.
      */
     double d_SAJ_fill = 1.0, d_RStokesIBP_fill = 1.0;
+    std::string d_SAJ_approximation = "EXACT";
     std::vector<Mat> d_SAJ_mat, d_SAJ_prolongation_mat, d_stokesib_prolongation_mat, d_galerkin_stokesib_mat;
     std::vector<Vec> d_scale_SAJ_restriction_mat, d_scale_stokesib_restriction_mat;
 
+    /*
+     * Matrix-free representation of the finest level IB operator, the scaling
+     * of the spreading operator, and Lagrangian work vectors.
+     */
+    bool d_use_matrix_free_SAJ = false;
+    Mat d_SAJ_shell_mat = nullptr;
+    double d_SAJ_spread_scale = 1.0;
+    Vec d_SAJ_lag_work_vec = nullptr, d_SAJ_lag_force_vec = nullptr;
+
     /*
      * Mappings from patch indices to patch operators.
      */
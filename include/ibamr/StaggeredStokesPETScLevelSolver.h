@@ -25,6 +25,7 @@
 #include "ibtk/PETScLevelSolver.h"
 #include "ibtk/ibtk_utilities.h"
 
+#include "Box.h"
 #include "CellVariable.h"
 #include "IntVector.h"
 #include "RefineSchedule.h"
@@ -33,6 +34,7 @@
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
+#include "petscmat.h"
 #include "petscvec.h"
 
 #include <set>
@@ -48,6 +50,8 @@ class PatchLevel;
 } // namespace hier
 namespace solv
 {
+template <int DIM>
+class RobinBcCoefStrategy;
 template <int DIM, class TYPE>
 class SAMRAIVectorReal;
 } // namespace solv
@@ -62,6 +66,16 @@ namespace IBAMR
  * for a staggered-grid (MAC) discretization of the incompressible Stokes
  * equations.
  *
+ * The assembled level matrix is kept when the solver state is deallocated.
+ * When the solver state is reinitialized for a patch level with the same box
+ * layout and processor mapping, the non-zero structure of the matrix is reused.
+ * If, in addition, the problem coefficients, the boundary condition objects,
+ * the level number, and the time at which the boundary conditions are
+ * evaluated are unchanged, then the matrix is not reassembled. This may be
+ * disabled by setting the input parameter \c reuse_assembled_matrix to FALSE,
+ * e.g., if the boundary condition coefficients depend on state that is not
+ * captured by the solution time.
+ *
  * \see INSStaggeredHierarchyIntegrator
  */
 class StaggeredStokesPETScLevelSolver : public IBTK::PETScLevelSolver, public StaggeredStokesSolver
@@ -90,6 +104,27 @@ public:
         return new StaggeredStokesPETScLevelSolver(object_name, input_db, default_options_prefix);
     } // allocate_solver
 
+    /*!
+     * \brief Static function to construct a StaggeredStokesPETScLevelSolver
+     * that uses a Schur complement PCFIELDSPLIT preconditioner with hypre
+     * BoomerAMG.
+     *
+     * Unless the input database specifies a different \c pc_type, the solver
+     * uses a PCFIELDSPLIT preconditioner with an upper block factorization.
+     * BoomerAMG is applied to the velocity block and to the assembled
+     * approximation \f$ C - B \mbox{diag}(A)^{-1} B^T \f$ of the Schur
+     * complement.  Each of these defaults may be changed through the PETSc
+     * options database, e.g., via
+     * <TT>-[prefix]pc_fieldsplit_schur_precondition</TT> and
+     * <TT>-[prefix]fieldsplit_pressure_pc_type lsc</TT>.
+     *
+     * \note PETSc must be configured with hypre to use the default options.
+     */
+    static SAMRAI::tbox::Pointer<StaggeredStokesSolver>
+    allocate_fieldsplit_amg_solver(const std::string& object_name,
+                                   SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                                   const std::string& default_options_prefix);
+
 protected:
     /*!
      * \brief Generate IS/subdomains for Schwartz type preconditioners.
@@ -163,6 +198,24 @@ private:
      */
     StaggeredStokesPETScLevelSolver& operator=(const StaggeredStokesPETScLevelSolver& that) = delete;
 
+    /*!
+     * \brief Set up the PCFIELDSPLIT and BoomerAMG defaults used by solvers
+     * constructed via allocate_fieldsplit_amg_solver().
+     */
+    void setFieldSplitAMGDefaults(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \brief Determine whether the cached matrix was assembled for a patch
+     * level with the same box layout and DOF distribution as the current one.
+     */
+    bool cachedMatrixHasSameLayout() const;
+
+    /*!
+     * \brief Determine whether the values of the cached matrix are the values
+     * of the operator that would be assembled for the current level.
+     */
+    bool cachedMatrixHasSameValues() const;
+
     /*!
      * \name PETSc objects.
      */
@@ -179,6 +232,21 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > d_data_synch_sched, d_ghost_fill_sched;
 
     //\}
+
+    /*!
+     * \name Cached level matrix and the data describing how it was assembled.
+     */
+    //\{
+
+    bool d_reuse_assembled_matrix = true;
+    Mat d_cached_petsc_mat = nullptr;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_cached_boxes;
+    std::vector<int> d_cached_box_mapping, d_cached_num_dofs_per_proc;
+    int d_cached_level_num = IBTK::invalid_level_number;
+    double d_cached_C = 0.0, d_cached_D = 0.0, d_cached_data_time = 0.0;
+    std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> d_cached_U_bc_coefs;
+
+    //\}
 };
 } // namespace IBAMR
 
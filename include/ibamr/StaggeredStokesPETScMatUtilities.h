@@ -68,6 +68,13 @@ public:
      * \brief Construct a parallel PETSc Mat object corresponding to a MAC
      * discretization of the time-dependent incompressible Stokes equations on a
      * single SAMRAI::hier::PatchLevel.
+     *
+     * If \a reuse_nonzero_pattern is true and \a mat is not null, then \a mat
+     * must have been previously constructed by this function for a patch level
+     * with the same box layout and DOF indices. In this case, the existing
+     * non-zero structure of \a mat is kept and only its values are reset, which
+     * avoids the cost of determining the non-zero structure and reallocating
+     * the matrix.
      */
     static void constructPatchLevelMACStokesOp(Mat& mat,
                                                const SAMRAI::solv::PoissonSpecifications& u_problem_coefs,
@@ -76,7 +83,8 @@ public:
                                                const std::vector<int>& num_dofs_per_proc,
                                                int u_dof_index_idx,
                                                int p_dof_index_idx,
-                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level);
+                                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
+                                               bool reuse_nonzero_pattern = false);
 
     /*!
      * \brief Partition the patch level into subdomains suitable to be used for
@@ -68,6 +68,13 @@ public:
     // add a wall to the WallForceEvaluator
     void addWall(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> wall_db, double wall_ghost_dist);
 
+    // rebuild the cached lists of nodes that can interact with each wall
+    void initializeLevelData(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                             int level_number,
+                             double init_data_time,
+                             bool initial_time,
+                             IBTK::LDataManager* l_data_manager) override;
+
     // compute forces from all walls
     void computeLagrangianForce(SAMRAI::tbox::Pointer<IBTK::LData> F_data,
                                 SAMRAI::tbox::Pointer<IBTK::LData> X_data,
@@ -87,9 +94,22 @@ private:
     // Assignment operator, not implemented.
     WallForceEvaluator& operator=(const WallForceEvaluator& that) = delete;
 
+    // Collect the local PETSc indices of the nodes in the force area of each
+    // wall on the given level.
+    void buildWallNodeLists(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                            int level_number,
+                            IBTK::LDataManager* l_data_manager);
+
     // collection of walls:
     std::vector<Wall> d_walls_vec;
 
+    // cached local PETSc indices of the nodes near each wall, indexed by level
+    // number and then by wall.  The force areas are padded by the Lagrangian
+    // regrid distance, so these lists remain valid until the Lagrangian data
+    // are next redistributed.
+    std::vector<std::vector<std::vector<int> > > d_wall_node_idxs;
+    std::vector<bool> d_wall_node_idxs_valid;
+
     // grid geometry, used when making walls:
     SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > d_grid_geometry;
 };
@@ -256,6 +256,8 @@ enum TimeSteppingType
     TRAPEZOIDAL_RULE,
     SSPRK2,
     SSPRK3,
+    IMEX_ARS222,
+    IMEX_ARS443,
     UNKNOWN_TIME_STEPPING_TYPE = -1
 };
 
@@ -272,6 +274,10 @@ string_to_enum<TimeSteppingType>(const std::string& val)
     if (strcasecmp(val.c_str(), "SSPRK1") == 0) return FORWARD_EULER;
     if (strcasecmp(val.c_str(), "SSPRK2") == 0) return SSPRK2;
     if (strcasecmp(val.c_str(), "SSPRK3") == 0) return SSPRK3;
+    if (strcasecmp(val.c_str(), "IMEX_ARS222") == 0) return IMEX_ARS222;
+    if (strcasecmp(val.c_str(), "ARS222") == 0) return IMEX_ARS222;
+    if (strcasecmp(val.c_str(), "IMEX_ARS443") == 0) return IMEX_ARS443;
+    if (strcasecmp(val.c_str(), "ARS443") == 0) return IMEX_ARS443;
     return UNKNOWN_TIME_STEPPING_TYPE;
 } // string_to_enum
 
@@ -286,6 +292,8 @@ enum_to_string<TimeSteppingType>(TimeSteppingType val)
     if (val == TRAPEZOIDAL_RULE) return "TRAPEZOIDAL_RULE";
     if (val == SSPRK2) return "SSPRK2";
     if (val == SSPRK3) return "SSPRK3";
+    if (val == IMEX_ARS222) return "IMEX_ARS222";
+    if (val == IMEX_ARS443) return "IMEX_ARS443";
     return "UNKNOWN_TIME_STEPPING_TYPE";
 } // enum_to_string
 
@@ -300,6 +308,8 @@ is_multistep_time_stepping_type(TimeSteppingType val)
     case FORWARD_EULER:
     case MIDPOINT_RULE:
     case TRAPEZOIDAL_RULE:
+    case IMEX_ARS222:
+    case IMEX_ARS443:
         return false;
     default:
         TBOX_ERROR("is_multistep_time_stepping_type(): unknown time stepping type\n");
@@ -307,6 +317,12 @@ is_multistep_time_stepping_type(TimeSteppingType val)
     }
 } // is_multistep_time_stepping_type
 
+inline bool
+is_imex_runge_kutta_time_stepping_type(TimeSteppingType val)
+{
+    return val == IMEX_ARS222 || val == IMEX_ARS443;
+} // is_imex_runge_kutta_time_stepping_type
+
 /*!
  * \brief Enumerated type for different types of traction boundary conditions.
  */
@@ -0,0 +1,70 @@
+#!/usr/bin/perl -w
+## ---------------------------------------------------------------------
+##
+## Copyright (c) 2026 - 2026 by the IBAMR developers
+## All rights reserved.
+##
+## This file is part of IBAMR.
+##
+## IBAMR is free software and is distributed under the 3-clause BSD
+## license. The full text of the license can be found in the file
+## COPYRIGHT at the top level directory of IBAMR.
+##
+## ---------------------------------------------------------------------
+
+#
+# filename: vertex_ascii_to_binary.pl
+# usage: vertex_ascii_to_binary.pl <dimension> <input filename> <output filename>
+#
+# A simple Perl script to convert an ASCII IBAMR vertex input file into the
+# binary vertex format read by IBStandardInitializer. The output file should be
+# named <base>.vertex.bin. The binary file uses the native byte order of the
+# machine on which this script is run.
+
+if ($#ARGV != 2) {
+    die "incorrect number of command line arguments.\nusage:\n  vertex_ascii_to_binary.pl <dimension> <input filename> <output filename>\n";
+}
+
+# parse the command line arguments
+$dim = shift @ARGV;  chomp $dim;
+$input_filename = shift @ARGV;  chomp $input_filename;
+$output_filename = shift @ARGV;  chomp $output_filename;
+
+if ($dim != 2 && $dim != 3) {
+    die "invalid dimension: $dim\n";
+}
+
+open(INPUT, "<$input_filename") or die "cannot open input file $input_filename\n";
+open(OUTPUT, ">$output_filename") or die "cannot open output file $output_filename\n";
+binmode OUTPUT;
+
+# strip comments from a line of the input file
+sub strip_comments {
+    my $line = shift;
+    $line =~ s/[!#%].*$//;
+    $line =~ s/^\s+//;
+    $line =~ s/\s+$//;
+    return $line;
+}
+
+# the first entry in the file is the number of vertices
+$line = <INPUT>;
+defined($line) or die "premature end to input file $input_filename\n";
+($num_vertex) = split(/\s+/, strip_comments($line));
+(defined($num_vertex) && $num_vertex > 0) or die "invalid number of vertices in $input_filename\n";
+
+print OUTPUT pack("a8", "IBAMRVTX");
+print OUTPUT pack("l", $dim);
+print OUTPUT pack("l", $num_vertex);
+
+# each successive line provides the position of one vertex
+for ($k = 0; $k < $num_vertex; $k++) {
+    $line = <INPUT>;
+    defined($line) or die "premature end to input file $input_filename before line ", $k + 2, "\n";
+    @X = split(/\s+/, strip_comments($line));
+    ($#X + 1 >= $dim) or die "invalid entry on line ", $k + 2, " of $input_filename\n";
+    print OUTPUT pack("d$dim", @X[0 .. $dim - 1]);
+}
+
+close(INPUT);
+close(OUTPUT);
@@ -365,29 +365,35 @@ BrinkmanAdvDiffBcHelper::computeDampingCoefficient(int C_idx, Pointer<CellVariab
             for (int d = 0; d < NDIM; ++d) vol_cell *= patch_dx[d];
 
             Pointer<CellData<NDIM, double> > C_data = patch->getPatchData(C_idx);
-            for (Box<NDIM>::Iterator it(patch_box); it; it++)
+            C_data->fillAll(0.0, patch_box);
+
+            // Loop over all the level sets and add up their contributions.
+            // Each zone contributes only where chi = 1 - H(phi) is nonzero, so
+            // we restrict its loop to the bounding box of that region.
+            // TODO: Pointwise check that level sets don't overlap
+            for (const auto& bc_prop : brinkman_zones)
             {
-                CellIndex<NDIM> ci(it());
+                // Get the BC specifications for each zone.
+                Pointer<CellVariable<NDIM, double> > ls_solid_var = bc_prop.ls_solid_var;
+                AdvDiffBrinkmanPenalizationBcType bc_type = bc_prop.bc_type;
+                if (bc_type != DIRICHLET) continue;
 
-                // Loop over all the level sets and add up their contributions.
-                // TODO: Pointwise check that level sets don't overlap
-                double brinkman_coef = 0.0;
-                for (const auto& bc_prop : brinkman_zones)
+                double eta = bc_prop.eta;
+                double num_interface_cells = bc_prop.num_interface_cells;
+                const double alpha = num_interface_cells * std::pow(vol_cell, 1.0 / static_cast<double>(NDIM));
+                const int phi_idx =
+                    var_db->mapVariableAndContextToIndex(ls_solid_var, d_adv_diff_solver->getNewContext());
+                Pointer<CellData<NDIM, double> > ls_solid_data = patch->getPatchData(phi_idx);
+
+                IndicatorFunctionType indicator_func_type = bc_prop.indicator_func_type;
+                const double phi_threshold = indicator_func_type == SMOOTH ? alpha : 0.0;
+                const Box<NDIM> zone_box =
+                    IBTK::IndexUtilities::getSublevelSetBoundingBox(*ls_solid_data, patch_box, phi_threshold);
+                for (Box<NDIM>::Iterator it(zone_box); it; it++)
                 {
-                    // Get the BC specifications for each zone.
-                    Pointer<CellVariable<NDIM, double> > ls_solid_var = bc_prop.ls_solid_var;
-                    AdvDiffBrinkmanPenalizationBcType bc_type = bc_prop.bc_type;
-                    if (bc_type != DIRICHLET) continue;
-
-                    double eta = bc_prop.eta;
-                    double num_interface_cells = bc_prop.num_interface_cells;
-                    const double alpha = num_interface_cells * std::pow(vol_cell, 1.0 / static_cast<double>(NDIM));
-                    const int phi_idx =
-                        var_db->mapVariableAndContextToIndex(ls_solid_var, d_adv_diff_solver->getNewContext());
-                    Pointer<CellData<NDIM, double> > ls_solid_data = patch->getPatchData(phi_idx);
+                    CellIndex<NDIM> ci(it());
                     double phi = (*ls_solid_data)(ci);
 
-                    IndicatorFunctionType indicator_func_type = bc_prop.indicator_func_type;
                     double Hphi = 0.0;
                     if (indicator_func_type == SMOOTH)
                         Hphi = IBTK::smooth_heaviside(phi, alpha);
@@ -397,11 +403,9 @@ BrinkmanAdvDiffBcHelper::computeDampingCoefficient(int C_idx, Pointer<CellVariab
                     // Note: assumes that chi is positive when phi is negative.
                     const double chi = 1.0 - Hphi;
 
-                    brinkman_coef += (chi / eta);
+                    // Set the Brinkman damping coefficient.
+                    (*C_data)(ci) += (chi / eta);
                 }
-
-                // Set the Brinkman damping coefficient.
-                (*C_data)(ci) = brinkman_coef;
             }
         }
     }
@@ -327,9 +327,17 @@ BrinkmanPenalizationRigidBodyDynamics::computeBrinkmanVelocity(int u_idx, double
         Pointer<SideData<NDIM, double> > rho_data = patch->getPatchData(rho_ins_idx);
         TBOX_ASSERT((ls_solid_data->getGhostCellWidth()).min() >= 1);
 
+        // Only faces adjacent to a cell with phi <= alpha can be penalized, so
+        // restrict the loops to the bounding box of those cells.
+        const Box<NDIM> zone_box =
+            IBTK::IndexUtilities::getSublevelSetBoundingBox(*ls_solid_data, Box<NDIM>::grow(patch_box, 1), alpha);
+        if (zone_box.empty()) continue;
+
         for (unsigned int axis = 0; axis < NDIM; ++axis)
         {
-            for (Box<NDIM>::Iterator it(SideGeometry<NDIM>::toSideBox(patch_box, axis)); it; it++)
+            const Box<NDIM> side_box =
+                SideGeometry<NDIM>::toSideBox(patch_box, axis) * SideGeometry<NDIM>::toSideBox(zone_box, axis);
+            for (Box<NDIM>::Iterator it(side_box); it; it++)
             {
                 SideIndex<NDIM> s_i(it(), axis, SideIndex<NDIM>::Lower);
 
@@ -389,9 +397,15 @@ BrinkmanPenalizationRigidBodyDynamics::demarcateBrinkmanZone(int u_idx, double t
         Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_idx);
         Pointer<SideData<NDIM, double> > rho_data = patch->getPatchData(rho_ins_idx);
 
+        const Box<NDIM> zone_box =
+            IBTK::IndexUtilities::getSublevelSetBoundingBox(*ls_solid_data, Box<NDIM>::grow(patch_box, 1), alpha);
+        if (zone_box.empty()) continue;
+
         for (unsigned int axis = 0; axis < NDIM; ++axis)
         {
-            for (Box<NDIM>::Iterator it(SideGeometry<NDIM>::toSideBox(patch_box, axis)); it; it++)
+            const Box<NDIM> side_box =
+                SideGeometry<NDIM>::toSideBox(patch_box, axis) * SideGeometry<NDIM>::toSideBox(zone_box, axis);
+            for (Box<NDIM>::Iterator it(side_box); it; it++)
             {
                 SideIndex<NDIM> s_i(it(), axis, SideIndex<NDIM>::Lower);
 
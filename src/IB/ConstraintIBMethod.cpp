@@ -77,9 +77,14 @@ IBTK_DISABLE_EXTRA_WARNINGS
 IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <algorithm>
+#include <iterator>
 #include <limits>
 #include <utility>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace SAMRAI
 {
 namespace hier
@@ -178,6 +183,97 @@ find_struct_handle_position(itr begin, itr end, const T& value)
     return -1;
 }
 
+// Find, for each local node on level ln, the position in ib_kinematics of the
+// structure to which it belongs, or -1 if it does not belong to any of them.
+std::vector<int>
+find_local_node_struct_handles(LDataManager* const l_data_manager,
+                               const std::vector<Pointer<ConstraintIBKinematics> >& ib_kinematics,
+                               const int ln,
+                               const std::vector<LNode*>& local_nodes)
+{
+    const std::vector<int> structIDs = l_data_manager->getLagrangianStructureIDs(ln);
+    std::vector<std::pair<std::pair<int, int>, int> > struct_ranges;
+    struct_ranges.reserve(structIDs.size());
+    for (const auto& struct_id : structIDs)
+    {
+        std::pair<int, int> lag_idx_range = l_data_manager->getLagrangianStructureIndexRange(struct_id, ln);
+        auto it = std::find_if(ib_kinematics.begin(), ib_kinematics.end(), find_struct_handle(lag_idx_range));
+        TBOX_ASSERT(it != ib_kinematics.end());
+        struct_ranges.emplace_back(lag_idx_range, static_cast<int>(std::distance(ib_kinematics.begin(), it)));
+    }
+    std::sort(struct_ranges.begin(), struct_ranges.end());
+
+    std::vector<int> struct_handles(local_nodes.size(), -1);
+    for (std::size_t k = 0; k < local_nodes.size(); ++k)
+    {
+        const int lag_idx = local_nodes[k]->getLagrangianIndex();
+        auto it = std::upper_bound(struct_ranges.begin(),
+                                   struct_ranges.end(),
+                                   lag_idx,
+                                   [](const int idx, const std::pair<std::pair<int, int>, int>& struct_range) {
+                                       return idx < struct_range.first.first;
+                                   });
+        if (it == struct_ranges.begin()) continue;
+        --it;
+        if (lag_idx < it->first.second) struct_handles[k] = it->second;
+    }
+    return struct_handles;
+} // find_local_node_struct_handles
+
+// Add the per-structure sums computed by moment_fcn(k, sums) for local nodes
+// k = 0, ..., n - 1 to moments. When threads are used each thread accumulates
+// into its own buffer and the buffers are summed at the end.
+template <typename MomentFcn>
+void
+accumulate_structure_moments(std::vector<double>& moments, const int n, MomentFcn moment_fcn)
+{
+#ifdef _OPENMP
+    if (omp_get_max_threads() > 1)
+    {
+        std::vector<std::vector<double> > thread_moments(omp_get_max_threads(),
+                                                         std::vector<double>(moments.size(), 0.0));
+#pragma omp parallel
+        {
+            double* const thread_sums = thread_moments[omp_get_thread_num()].data();
+#pragma omp for schedule(static)
+            for (int k = 0; k < n; ++k) moment_fcn(k, thread_sums);
+        }
+        for (const auto& thread_sums : thread_moments)
+        {
+            for (std::size_t i = 0; i < moments.size(); ++i) moments[i] += thread_sums[i];
+        }
+        return;
+    }
+#endif
+    for (int k = 0; k < n; ++k) moment_fcn(k, moments.data());
+    return;
+} // accumulate_structure_moments
+
+// Add the contribution of the point X to the upper triangle of the (column
+// major) moment of inertia tensor I about X_com.
+inline void
+add_inertia_contribution(const double* const X, const std::vector<double>& X_com, double* const I)
+{
+#if (NDIM == 2)
+    const double x = X[0] - X_com[0], y = X[1] - X_com[1];
+    I[0] += y * y;
+    I[3] += -x * y;
+    I[4] += x * x;
+    I[8] += x * x + y * y;
+#endif
+
+#if (NDIM == 3)
+    const double x = X[0] - X_com[0], y = X[1] - X_com[1], z = X[2] - X_com[2];
+    I[0] += y * y + z * z;
+    I[3] += -x * y;
+    I[6] += -x * z;
+    I[4] += x * x + z * z;
+    I[7] += -y * z;
+    I[8] += x * x + y * y;
+#endif
+    return;
+} // add_inertia_contribution
+
 #if (NDIM == 3)
 // Routine to solve 3X3 equation to get rigid body rotational velocity.
 inline void
@@ -444,8 +540,7 @@ ConstraintIBMethod::postprocessSolveFluidEquations(double current_time, double n
     IBTK_TIMER_STOP(t_calculateKinematicsVelocity);
 
     IBTK_TIMER_START(t_calculateRigidMomentum);
-    calculateRigidTranslationalMomentum();
-    calculateRigidRotationalMomentum();
+    calculateRigidMomentum();
     IBTK_TIMER_STOP(t_calculateRigidMomentum);
 
     IBTK_TIMER_START(t_correctVelocityOnLagrangianMesh);
@@ -897,17 +992,11 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
 
-    // Zero out the COM vector.
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        for (int d = 0; d < 3; ++d)
-        {
-            d_center_of_mass_current[struct_no][d] = 0.0;
-            d_center_of_mass_new[struct_no][d] = 0.0;
-        }
-    }
-    std::vector<std::vector<double> > tagged_position(d_no_structures, std::vector<double>(3, 0.0));
-
+    // The moments of all structures are accumulated in a single sweep over the
+    // local nodes of each level and reduced together. For each structure we
+    // store the current and new position sums and the tagged point position.
+    static const int COM_DEPTH = 9;
+    std::vector<double> com_moments(COM_DEPTH * d_no_structures, 0.0);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
@@ -929,78 +1018,56 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         const boost::multi_array_ref<double, 2>& X_data_new = *ptr_x_lag_data_new->getLocalFormVecArray();
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
         const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
-        {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
-
-            double X_com_current[NDIM] = { 0.0 }, X_com_new[NDIM] = { 0.0 };
-            for (const auto& node_idx : local_nodes)
-            {
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const X_current = &X_data_current[local_idx][0];
-                    const double* const X_new = &X_data_new[local_idx][0];
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        X_com_current[d] += X_current[d];
-                        X_com_new[d] += X_new[d];
-                    }
-                    if (lag_idx == d_tagged_pt_lag_idx[location_struct_handle])
-                    {
-                        for (unsigned int d = 0; d < NDIM; ++d) tagged_position[location_struct_handle][d] = X_new[d];
-                    }
-                }
-            }
-            for (int d = 0; d < NDIM; ++d)
-            {
-                d_center_of_mass_current[location_struct_handle][d] += X_com_current[d];
-                d_center_of_mass_new[location_struct_handle][d] += X_com_new[d];
-            }
-        }
+        const std::vector<int> struct_handles =
+            find_local_node_struct_handles(d_l_data_manager, d_ib_kinematics, ln, local_nodes);
+
+        accumulate_structure_moments(com_moments,
+                                     static_cast<int>(local_nodes.size()),
+                                     [&](const int k, double* const sums) {
+                                         const int struct_handle = struct_handles[k];
+                                         if (struct_handle < 0) return;
+                                         const int local_idx = local_nodes[k]->getLocalPETScIndex();
+                                         const double* const X_current = &X_data_current[local_idx][0];
+                                         const double* const X_new = &X_data_new[local_idx][0];
+                                         double* const struct_sums = &sums[COM_DEPTH * struct_handle];
+                                         for (unsigned int d = 0; d < NDIM; ++d)
+                                         {
+                                             struct_sums[d] += X_current[d];
+                                             struct_sums[3 + d] += X_new[d];
+                                         }
+                                         if (local_nodes[k]->getLagrangianIndex() ==
+                                             d_tagged_pt_lag_idx[struct_handle])
+                                         {
+                                             for (unsigned int d = 0; d < NDIM; ++d) struct_sums[6 + d] += X_new[d];
+                                         }
+                                     });
         ptr_x_lag_data_current->restoreArrays();
         ptr_x_lag_data_new->restoreArrays();
     }
+    IBTK_MPI::sumReduction(com_moments.data(), static_cast<int>(com_moments.size()));
 
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         const int total_nodes = struct_param.getTotalNodes();
-
-        IBTK_MPI::sumReduction(d_center_of_mass_current[struct_no].data(), d_center_of_mass_current[struct_no].size());
-        IBTK_MPI::sumReduction(d_center_of_mass_new[struct_no].data(), d_center_of_mass_new[struct_no].size());
-
+        const double* const struct_sums = &com_moments[COM_DEPTH * struct_no];
         for (int i = 0; i < 3; ++i)
         {
-            d_center_of_mass_current[struct_no][i] /= total_nodes;
-            d_center_of_mass_new[struct_no][i] /= total_nodes;
+            d_center_of_mass_current[struct_no][i] = struct_sums[i] / total_nodes;
+            d_center_of_mass_new[struct_no][i] = struct_sums[3 + i] / total_nodes;
+            d_tagged_pt_position[struct_no][i] = struct_sums[6 + i];
         }
     }
 
+    // Likewise accumulate the current and new moment of inertia tensors about
+    // the center of mass of the self-rotating structures.
+    static const int MOI_DEPTH = 18;
+    std::vector<char> self_rotating(d_no_structures);
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        IBTK_MPI::sumReduction(&tagged_position[struct_no][0], 3);
-        d_tagged_pt_position[struct_no] = tagged_position[struct_no];
-    }
-
-    // Zero out the moment of inertia tensor.
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        d_moment_of_inertia_current[struct_no].setZero();
-        d_moment_of_inertia_new[struct_no].setZero();
+        self_rotating[struct_no] = d_ib_kinematics[struct_no]->getStructureParameters().getStructureIsSelfRotating();
     }
-
+    std::vector<double> moi_moments(MOI_DEPTH * d_no_structures, 0.0);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
@@ -1021,90 +1088,34 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         const boost::multi_array_ref<double, 2>& X_data_new = *ptr_x_lag_data_new->getLocalFormVecArray();
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
         const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
-        {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
-            if (!struct_param.getStructureIsSelfRotating()) continue;
-
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
-            const std::vector<double>& X_com_current = d_center_of_mass_current[location_struct_handle];
-            const std::vector<double>& X_com_new = d_center_of_mass_new[location_struct_handle];
-
-            Eigen::Matrix3d Inertia_current(3, 3), Inertia_new(3, 3);
-            Inertia_current.setZero();
-            Inertia_new.setZero();
-
-            for (const auto& node_idx : local_nodes)
-            {
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const X_current = &X_data_current[local_idx][0];
-                    const double* const X_new = &X_data_new[local_idx][0];
-#if (NDIM == 2)
-                    Inertia_current(0, 0) += std::pow(X_current[1] - X_com_current[1], 2);
-                    Inertia_current(0, 1) += -(X_current[0] - X_com_current[0]) * (X_current[1] - X_com_current[1]);
-                    Inertia_current(1, 1) += std::pow(X_current[0] - X_com_current[0], 2);
-                    Inertia_current(2, 2) +=
-                        std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[1] - X_com_current[1], 2);
-
-                    Inertia_new(0, 0) += std::pow(X_new[1] - X_com_new[1], 2);
-                    Inertia_new(0, 1) += -(X_new[0] - X_com_new[0]) * (X_new[1] - X_com_new[1]);
-                    Inertia_new(1, 1) += std::pow(X_new[0] - X_com_new[0], 2);
-                    Inertia_new(2, 2) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[1] - X_com_new[1], 2);
-#endif
-
-#if (NDIM == 3)
-                    Inertia_current(0, 0) +=
-                        std::pow(X_current[1] - X_com_current[1], 2) + std::pow(X_current[2] - X_com_current[2], 2);
-                    Inertia_current(0, 1) += -(X_current[0] - X_com_current[0]) * (X_current[1] - X_com_current[1]);
-                    Inertia_current(0, 2) += -(X_current[0] - X_com_current[0]) * (X_current[2] - X_com_current[2]);
-                    Inertia_current(1, 1) +=
-                        std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[2] - X_com_current[2], 2);
-                    Inertia_current(1, 2) += -(X_current[1] - X_com_current[1]) * (X_current[2] - X_com_current[2]);
-                    Inertia_current(2, 2) +=
-                        std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[1] - X_com_current[1], 2);
-
-                    Inertia_new(0, 0) += std::pow(X_new[1] - X_com_new[1], 2) + std::pow(X_new[2] - X_com_new[2], 2);
-                    Inertia_new(0, 1) += -(X_new[0] - X_com_new[0]) * (X_new[1] - X_com_new[1]);
-                    Inertia_new(0, 2) += -(X_new[0] - X_com_new[0]) * (X_new[2] - X_com_new[2]);
-                    Inertia_new(1, 1) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[2] - X_com_new[2], 2);
-                    Inertia_new(1, 2) += -(X_new[1] - X_com_new[1]) * (X_new[2] - X_com_new[2]);
-                    Inertia_new(2, 2) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[1] - X_com_new[1], 2);
-#endif
-                }
-            }
-            d_moment_of_inertia_current[location_struct_handle] += Inertia_current;
-            d_moment_of_inertia_new[location_struct_handle] += Inertia_new;
-        } // all structs
+        const std::vector<int> struct_handles =
+            find_local_node_struct_handles(d_l_data_manager, d_ib_kinematics, ln, local_nodes);
+
+        accumulate_structure_moments(moi_moments,
+                                     static_cast<int>(local_nodes.size()),
+                                     [&](const int k, double* const sums) {
+                                         const int struct_handle = struct_handles[k];
+                                         if (struct_handle < 0 || !self_rotating[struct_handle]) return;
+                                         const int local_idx = local_nodes[k]->getLocalPETScIndex();
+                                         double* const struct_sums = &sums[MOI_DEPTH * struct_handle];
+                                         add_inertia_contribution(&X_data_current[local_idx][0],
+                                                                  d_center_of_mass_current[struct_handle],
+                                                                  struct_sums);
+                                         add_inertia_contribution(&X_data_new[local_idx][0],
+                                                                  d_center_of_mass_new[struct_handle],
+                                                                  struct_sums + 9);
+                                     });
         ptr_x_lag_data_current->restoreArrays();
         ptr_x_lag_data_new->restoreArrays();
     } // all levels
-
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-        if (struct_param.getStructureIsSelfRotating())
-        {
-            IBTK_MPI::sumReduction(&d_moment_of_inertia_current[struct_no](0, 0), 9);
-            IBTK_MPI::sumReduction(&d_moment_of_inertia_new[struct_no](0, 0), 9);
-        }
-    }
+    IBTK_MPI::sumReduction(moi_moments.data(), static_cast<int>(moi_moments.size()));
 
     // Fill-in symmetric part of inertia tensor.
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
+        d_moment_of_inertia_current[struct_no] = Eigen::Map<const Eigen::Matrix3d>(&moi_moments[MOI_DEPTH * struct_no]);
+        d_moment_of_inertia_new[struct_no] = Eigen::Map<const Eigen::Matrix3d>(&moi_moments[MOI_DEPTH * struct_no + 9]);
+
         d_moment_of_inertia_current[struct_no](1, 0) = d_moment_of_inertia_current[struct_no](0, 1);
         d_moment_of_inertia_current[struct_no](2, 0) = d_moment_of_inertia_current[struct_no](0, 2);
         d_moment_of_inertia_current[struct_no](2, 1) = d_moment_of_inertia_current[struct_no](1, 2);
@@ -1463,69 +1474,85 @@ ConstraintIBMethod::calculateVolumeElement()
 } // calculateVolumeElement
 
 void
-ConstraintIBMethod::calculateRigidTranslationalMomentum()
+ConstraintIBMethod::calculateRigidMomentum()
 {
-    // Zero out new rigid momentum.
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        for (int d = 0; d < 3; ++d) d_rigid_trans_vel_new[struct_no][d] = 0.0;
-    }
-
     using StructureParameters = ConstraintIBKinematics::StructureParameters;
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
 
-    // Calculate rigid translational velocity.
+    // Accumulate the linear and angular momentum of all structures in a single
+    // sweep over the local nodes of each level and reduce them together.
+    static const int MOM_DEPTH = 6;
+    std::vector<char> self_translating(d_no_structures), self_rotating(d_no_structures);
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        self_translating[struct_no] = struct_param.getStructureIsSelfTranslating();
+        self_rotating[struct_no] = struct_param.getStructureIsSelfRotating();
+    }
+    std::vector<double> momenta(MOM_DEPTH * d_no_structures, 0.0);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
 
-        // Get LData corresponding to the present position of the structures.
+        // Get ponter to LData.
         const boost::multi_array_ref<double, 2>& U_interp_data = *d_l_data_U_interp[ln]->getLocalFormVecArray();
+        const boost::multi_array_ref<double, 2>& X_data = *d_l_data_X_half_Euler[ln]->getLocalFormVecArray();
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
         const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        const std::vector<int> struct_handles =
+            find_local_node_struct_handles(d_l_data_manager, d_ib_kinematics, ln, local_nodes);
+
+        accumulate_structure_moments(momenta,
+                                     static_cast<int>(local_nodes.size()),
+                                     [&](const int k, double* const sums) {
+                                         const int struct_handle = struct_handles[k];
+                                         if (struct_handle < 0) return;
+                                         const int local_idx = local_nodes[k]->getLocalPETScIndex();
+                                         const double* const U = &U_interp_data[local_idx][0];
+                                         double* const U_rigid = &sums[MOM_DEPTH * struct_handle];
+                                         double* const Omega_rigid = U_rigid + 3;
+                                         if (self_translating[struct_handle])
+                                         {
+                                             for (int d = 0; d < NDIM; ++d) U_rigid[d] += U[d];
+                                         }
+                                         if (self_rotating[struct_handle])
+                                         {
+                                             const double* const X = &X_data[local_idx][0];
+                                             const std::vector<double>& X_com = d_center_of_mass_new[struct_handle];
+#if (NDIM == 2)
+                                             const double x = X[0] - X_com[0];
+                                             const double y = X[1] - X_com[1];
+                                             Omega_rigid[2] += x * U[1] - y * U[0];
+#endif
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
-        {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
-            if (!struct_param.getStructureIsSelfTranslating()) continue;
-
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
-
-            double U_rigid[NDIM] = { 0.0 };
-            for (const auto& node_idx : local_nodes)
-            {
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U = &U_interp_data[local_idx][0];
-                    for (int d = 0; d < NDIM; ++d)
-                    {
-                        U_rigid[d] += U[d];
-                    }
-                }
-            }
-            for (int d = 0; d < NDIM; ++d) d_rigid_trans_vel_new[location_struct_handle][d] += U_rigid[d];
-        } // all structs
+#if (NDIM == 3)
+                                             const double x = X[0] - X_com[0];
+                                             const double y = X[1] - X_com[1];
+                                             const double z = X[2] - X_com[2];
+                                             Omega_rigid[0] += y * U[2] - z * U[1];
+                                             Omega_rigid[1] += -x * U[2] + z * U[0];
+                                             Omega_rigid[2] += x * U[1] - y * U[0];
+#endif
+                                         }
+                                     });
         d_l_data_U_interp[ln]->restoreArrays();
+        d_l_data_X_half_Euler[ln]->restoreArrays();
     } // all levels
+    IBTK_MPI::sumReduction(momenta.data(), static_cast<int>(momenta.size()));
 
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        for (int d = 0; d < 3; ++d)
+        {
+            d_rigid_trans_vel_new[struct_no][d] = momenta[MOM_DEPTH * struct_no + d];
+            d_rigid_rot_vel_new[struct_no][d] = momenta[MOM_DEPTH * struct_no + 3 + d];
+        }
+
+        // Calculate rigid translational velocity.
         if (struct_param.getStructureIsSelfTranslating())
         {
-            IBTK_MPI::sumReduction(d_rigid_trans_vel_new[struct_no].data(), d_rigid_trans_vel_new[struct_no].size());
             tbox::Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
             for (int d = 0; d < NDIM; ++d)
             {
@@ -1535,101 +1562,10 @@ ConstraintIBMethod::calculateRigidTranslationalMomentum()
                     d_rigid_trans_vel_new[struct_no][d] = 0.0;
             }
         }
-    }
-
-    if (!IBTK_MPI::getRank() && d_print_output && d_output_trans_vel && (d_timestep_counter % d_output_interval) == 0)
-    {
-        for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-        {
-            *d_trans_vel_stream[struct_no]
-                << d_FuRMoRP_new_time << '\t' << d_rigid_trans_vel_new[struct_no][0] << '\t'
-                << d_rigid_trans_vel_new[struct_no][1] << '\t' << d_rigid_trans_vel_new[struct_no][2] << '\t'
-                << d_vel_com_def_new[struct_no][0] << '\t' << d_vel_com_def_new[struct_no][1] << '\t'
-                << d_vel_com_def_new[struct_no][2] << std::endl;
-        }
-    }
-
-    return;
-
-} // calculateRigidTranslationalMomentum
-
-void
-ConstraintIBMethod::calculateRigidRotationalMomentum()
-{
-    // Zero out new rigid momentum.
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        for (int d = 0; d < 3; ++d) d_rigid_rot_vel_new[struct_no][d] = 0.0;
-    }
-
-    using StructureParameters = ConstraintIBKinematics::StructureParameters;
-    const int coarsest_ln = 0;
-    const int finest_ln = d_hierarchy->getFinestLevelNumber();
 
-    // Calculate rigid rotational velocity.
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
-
-        // Get ponter to LData.
-        const boost::multi_array_ref<double, 2>& U_interp_data = *d_l_data_U_interp[ln]->getLocalFormVecArray();
-        const boost::multi_array_ref<double, 2>& X_data = *d_l_data_X_half_Euler[ln]->getLocalFormVecArray();
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
-        {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
-            if (!struct_param.getStructureIsSelfRotating()) continue;
-
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
-
-            double Omega_rigid[3] = { 0.0 };
-            for (const auto& node_idx : local_nodes)
-            {
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U = &U_interp_data[local_idx][0];
-                    const double* const X = &X_data[local_idx][0];
-#if (NDIM == 2)
-                    const double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
-                    const double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
-                    Omega_rigid[2] += x * U[1] - y * U[0];
-#endif
-
-#if (NDIM == 3)
-                    const double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
-                    const double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
-                    const double z = X[2] - d_center_of_mass_new[location_struct_handle][2];
-                    Omega_rigid[0] += y * U[2] - z * U[1];
-                    Omega_rigid[1] += -x * U[2] + z * U[0];
-                    Omega_rigid[2] += x * U[1] - y * U[0];
-#endif
-                }
-            }
-            for (int d = 0; d < 3; ++d) d_rigid_rot_vel_new[location_struct_handle][d] += Omega_rigid[d];
-        } // all structs
-        d_l_data_U_interp[ln]->restoreArrays();
-        d_l_data_X_half_Euler[ln]->restoreArrays();
-    } // all levels
-
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        // Calculate rigid rotational velocity.
         if (struct_param.getStructureIsSelfRotating())
         {
-            IBTK_MPI::sumReduction(&d_rigid_rot_vel_new[struct_no][0], 3);
 #if (NDIM == 2)
             d_rigid_rot_vel_new[struct_no][2] /= d_moment_of_inertia_new[struct_no](2, 2);
 #endif
@@ -1645,6 +1581,18 @@ ConstraintIBMethod::calculateRigidRotationalMomentum()
         }
     }
 
+    if (!IBTK_MPI::getRank() && d_print_output && d_output_trans_vel && (d_timestep_counter % d_output_interval) == 0)
+    {
+        for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+        {
+            *d_trans_vel_stream[struct_no]
+                << d_FuRMoRP_new_time << '\t' << d_rigid_trans_vel_new[struct_no][0] << '\t'
+                << d_rigid_trans_vel_new[struct_no][1] << '\t' << d_rigid_trans_vel_new[struct_no][2] << '\t'
+                << d_vel_com_def_new[struct_no][0] << '\t' << d_vel_com_def_new[struct_no][1] << '\t'
+                << d_vel_com_def_new[struct_no][2] << std::endl;
+        }
+    }
+
     if (!IBTK_MPI::getRank() && d_print_output && d_output_rot_vel && (d_timestep_counter % d_output_interval) == 0)
     {
         for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
@@ -1660,7 +1608,7 @@ ConstraintIBMethod::calculateRigidRotationalMomentum()
 
     return;
 
-} // calculateRigidRotationalMomentum
+} // calculateRigidMomentum
 
 void
 ConstraintIBMethod::calculateCurrentLagrangianVelocity()
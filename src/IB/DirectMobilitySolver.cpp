@@ -219,9 +219,36 @@ DirectMobilitySolver::registerMobilityMat(const std::string& mat_name,
     d_mat_map[mat_name] = { {}, {} };
     d_geometric_mat_map[mat_name] = {};
     d_ipiv_map[mat_name] = { {}, {} };
+    d_mat_block_offsets_map[mat_name] = {};
+    d_mat_body_frame_map[mat_name] = false;
+    d_mat_needs_update_map[mat_name] = true;
     d_petsc_mat_map[mat_name] = { nullptr, nullptr };
     d_petsc_geometric_mat_map[mat_name] = nullptr;
 
+    // Split the nodes of each structure into clusters whose diagonal blocks are
+    // factorized. By default the whole matrix forms a single block.
+    std::vector<int>& block_offsets = d_mat_block_offsets_map[mat_name];
+    block_offsets.push_back(0);
+    if (d_max_cluster_size > 0)
+    {
+        unsigned int part_offset = 0;
+        for (const auto& prototype_struct_id : prototype_struct_ids)
+        {
+            const unsigned int part_nodes = d_cib_strategy->getNumberOfNodes(prototype_struct_id);
+            const unsigned int num_clusters =
+                (part_nodes + static_cast<unsigned int>(d_max_cluster_size) - 1) / d_max_cluster_size;
+            for (unsigned int c = 1; c <= num_clusters; ++c)
+            {
+                block_offsets.push_back((part_offset + c * part_nodes / num_clusters) * NDIM);
+            }
+            part_offset += part_nodes;
+        }
+    }
+    else
+    {
+        block_offsets.push_back(num_nodes * NDIM);
+    }
+
     // Allocate the actual matrices.
     const int mobility_mat_size = num_nodes * NDIM;
     const int body_mobility_mat_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
@@ -335,13 +362,14 @@ DirectMobilitySolver::solveSystem(Vec x, Vec b)
         const int managing_proc = d_mat_proc_map[mat_name];
         const int mat_size = d_mat_nodes_map[mat_name] * data_depth;
         const int num_structs = static_cast<int>(struct_ids.size());
+        const bool body_frame = d_mat_body_frame_map[mat_name];
 
         for (int k = 0; k < num_structs; ++k)
         {
             std::vector<double> rhs;
             if (rank == managing_proc) rhs.resize(mat_size);
             d_cib_strategy->copyVecToArray(b, rhs.data(), struct_ids[k], data_depth, managing_proc);
-            if (!d_recompute_mob_mat)
+            if (body_frame)
             {
                 d_cib_strategy->rotateArray(rhs.data(),
                                             struct_ids[k],
@@ -349,8 +377,15 @@ DirectMobilitySolver::solveSystem(Vec x, Vec b)
                                             managing_proc,
                                             data_depth);
             }
-            if (rank == managing_proc) computeSolution(mat, inv_type, d_ipiv_map[mat_name].first.data(), rhs.data());
-            if (!d_recompute_mob_mat)
+            if (rank == managing_proc)
+            {
+                computeSolution(mat,
+                                inv_type,
+                                d_ipiv_map[mat_name].first.data(),
+                                rhs.data(),
+                                d_mat_block_offsets_map[mat_name]);
+            }
+            if (body_frame)
             {
                 d_cib_strategy->rotateArray(rhs.data(),
                                             struct_ids[k],
@@ -388,13 +423,14 @@ DirectMobilitySolver::solveBodySystem(Vec x, Vec b)
         const int mat_size = d_mat_parts_map[mat_name] * data_depth;
         const int managing_proc = d_mat_proc_map[mat_name];
         const int num_structs = static_cast<int>(struct_ids.size());
+        const bool body_frame = d_mat_body_frame_map[mat_name];
 
         for (int k = 0; k < num_structs; ++k)
         {
             std::vector<double> rhs;
             if (rank == managing_proc) rhs.resize(mat_size);
             d_cib_strategy->copyFreeDOFsVecToArray(b, rhs.data(), struct_ids[k], managing_proc);
-            if (!d_recompute_mob_mat)
+            if (body_frame)
             {
                 d_cib_strategy->rotateArray(rhs.data(),
                                             struct_ids[k],
@@ -402,8 +438,11 @@ DirectMobilitySolver::solveBodySystem(Vec x, Vec b)
                                             managing_proc,
                                             data_depth);
             }
-            if (rank == managing_proc) computeSolution(mat, inv_type, d_ipiv_map[mat_name].second.data(), rhs.data());
-            if (!d_recompute_mob_mat)
+            if (rank == managing_proc)
+            {
+                computeSolution(mat, inv_type, d_ipiv_map[mat_name].second.data(), rhs.data(), { 0, mat_size });
+            }
+            if (body_frame)
             {
                 d_cib_strategy->rotateArray(rhs.data(),
                                             struct_ids[k],
@@ -432,7 +471,6 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
 
     static bool recreate_mobility_matrices = true;
     static std::vector<bool> read_files(managed_mats, false);
-    bool initial_time = !d_recompute_mob_mat;
 
     if (recreate_mobility_matrices)
     {
@@ -468,6 +506,16 @@ DirectMobilitySolver::initializeSolverState(Vec x, Vec /*b*/)
             const std::pair<double, double>& scale = d_mat_scale_map[mat_name];
             const int managing_proc = d_mat_proc_map[mat_name];
 
+            // Matrices of structures that have only moved rigidly since the
+            // initial time are built once in the body frame and reused by
+            // rotating the right-hand side and solution.
+            const bool rigid = d_recompute_mob_mat && d_reuse_rigid_factorization && isRigidConfiguration(mat_name);
+            bool& body_frame = d_mat_body_frame_map[mat_name];
+            d_mat_needs_update_map[mat_name] = !(rigid && body_frame);
+            if (!d_mat_needs_update_map[mat_name]) continue;
+            body_frame = !d_recompute_mob_mat || rigid;
+            const bool initial_time = body_frame;
+
             if (mat_type == READ_FROM_FILE && !read_files[file_counter])
             {
                 // Get the matrix from file.
@@ -559,25 +607,159 @@ DirectMobilitySolver::getFromInput(Pointer<Database> input_db)
     // Other parameters
     d_f_periodic_corr = input_db->getDoubleWithDefault("f_periodic_correction", d_f_periodic_corr);
     d_recompute_mob_mat = input_db->getBoolWithDefault("recompute_mob_mat_perstep", d_recompute_mob_mat);
+    d_max_cluster_size = input_db->getIntegerWithDefault("max_cluster_size", d_max_cluster_size);
+    d_distribute_cluster_factorization =
+        input_db->getBoolWithDefault("distribute_cluster_factorization", d_distribute_cluster_factorization);
+    d_reuse_rigid_factorization =
+        input_db->getBoolWithDefault("reuse_rigid_factorization", d_reuse_rigid_factorization);
+    d_rigid_configuration_tol = input_db->getDoubleWithDefault("rigid_configuration_tol", d_rigid_configuration_tol);
 
     return;
 } // getFromInput
 
+bool
+DirectMobilitySolver::isRigidConfiguration(const std::string& mat_name)
+{
+    // A group of structures has moved rigidly if all of them share the same
+    // orientation and their centers of mass, seen from the body frame of the
+    // first structure, are where they were initially.
+    for (const auto& struct_ids : d_mat_actual_id_map[mat_name])
+    {
+        if (struct_ids.size() < 2) continue;
+        const unsigned ref_id = struct_ids[0];
+        const Eigen::Quaterniond& q_ref = d_cib_strategy->getMidpointBodyQuaternion(ref_id);
+        const Eigen::Matrix3d R_ref_T = q_ref.toRotationMatrix().transpose();
+        const Eigen::Vector3d& X_ref = d_cib_strategy->getMidpointBodyCenterOfMass(ref_id);
+        const Eigen::Vector3d& X0_ref = d_cib_strategy->getInitialBodyCenterOfMass(ref_id);
+        for (const auto& struct_id : struct_ids)
+        {
+            const Eigen::Quaterniond& q = d_cib_strategy->getMidpointBodyQuaternion(struct_id);
+            if (1.0 - std::abs(q_ref.dot(q)) > d_rigid_configuration_tol) return false;
+
+            const Eigen::Vector3d dX0 = d_cib_strategy->getInitialBodyCenterOfMass(struct_id) - X0_ref;
+            const Eigen::Vector3d dX = R_ref_T * (d_cib_strategy->getMidpointBodyCenterOfMass(struct_id) - X_ref);
+            if ((dX - dX0).norm() > d_rigid_configuration_tol * std::max(dX0.norm(), 1.0)) return false;
+        }
+    }
+    return true;
+} // isRigidConfiguration
+
 void
 DirectMobilitySolver::factorizeMobilityMatrix()
 {
-    int rank = IBTK_MPI::getRank();
+    const int rank = IBTK_MPI::getRank();
+    const int nodes = IBTK_MPI::getNodes();
     for (const auto& petsc_mat_pair : d_petsc_mat_map)
     {
         const std::string& mat_name = petsc_mat_pair.first;
-        if (rank != d_mat_proc_map[mat_name]) continue;
-
-        Mat& mat = d_petsc_mat_map[mat_name].first;
+        if (!d_mat_needs_update_map[mat_name]) continue;
+        const int managing_proc = d_mat_proc_map[mat_name];
         const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].first;
         const int mat_size = d_mat_nodes_map[mat_name] * NDIM;
+        const std::vector<int>& block_offsets = d_mat_block_offsets_map[mat_name];
+        const int num_blocks = static_cast<int>(block_offsets.size()) - 1;
+
+        // The cluster blocks are independent, so they are dealt out round-robin
+        // to all processors, starting with the managing processor. A single
+        // block (the exact inverse) is always factorized by the managing one.
+        const bool distribute = d_distribute_cluster_factorization && nodes > 1 && num_blocks > 1;
+        if (!distribute && rank != managing_proc) continue;
+        const auto block_owner = [&](const int b) { return distribute ? (managing_proc + b) % nodes : managing_proc; };
+
+        if (rank != managing_proc)
+        {
+            // Receive the owned blocks, factorize them, and send the factors
+            // (and pivots) back. Messages are matched in block order.
+            std::map<int, std::vector<double> > blocks;
+            std::map<int, std::vector<int> > pivots;
+            for (int b = 0; b < num_blocks; ++b)
+            {
+                if (block_owner(b) != rank) continue;
+                const int block_size = block_offsets[b + 1] - block_offsets[b];
+                int length = block_size * block_size;
+                blocks[b].resize(length);
+                IBTK_MPI::recv(blocks[b].data(), length, managing_proc, false, b);
+            }
+            for (auto& block_pair : blocks)
+            {
+                const int b = block_pair.first;
+                const int block_size = block_offsets[b + 1] - block_offsets[b];
+                if (inv_type == LAPACK_LU) pivots[b].resize(block_size);
+                factorizeDenseMatrix(block_pair.second.data(),
+                                     block_size,
+                                     block_size,
+                                     inv_type,
+                                     inv_type == LAPACK_LU ? pivots[b].data() : nullptr,
+                                     mat_name,
+                                     "Mobility");
+            }
+            for (const auto& block_pair : blocks)
+            {
+                const int b = block_pair.first;
+                const int block_size = block_offsets[b + 1] - block_offsets[b];
+                IBTK_MPI::send(block_pair.second.data(), block_size * block_size, managing_proc, false, b);
+                if (inv_type == LAPACK_LU) IBTK_MPI::send(pivots[b].data(), block_size, managing_proc, false, b);
+            }
+            continue;
+        }
+
+        Mat& mat = d_petsc_mat_map[mat_name].first;
+        int* ipiv = d_ipiv_map[mat_name].first.data();
         double* mat_data = nullptr;
         MatDenseGetArray(mat, &mat_data);
-        factorizeDenseMatrix(mat_data, mat_size, inv_type, d_ipiv_map[mat_name].first.data(), mat_name, "Mobility");
+
+        // Copy a diagonal block to or from a contiguous buffer.
+        std::vector<double> buffer;
+        const auto pack_block = [&](const int b) {
+            const int offset = block_offsets[b];
+            const int block_size = block_offsets[b + 1] - offset;
+            buffer.resize(block_size * block_size);
+            for (int j = 0; j < block_size; ++j)
+            {
+                std::copy_n(&mat_data[(offset + j) * mat_size + offset], block_size, &buffer[j * block_size]);
+            }
+        };
+        const auto unpack_block = [&](const int b) {
+            const int offset = block_offsets[b];
+            const int block_size = block_offsets[b + 1] - offset;
+            for (int j = 0; j < block_size; ++j)
+            {
+                std::copy_n(&buffer[j * block_size], block_size, &mat_data[(offset + j) * mat_size + offset]);
+            }
+        };
+
+        for (int b = 0; b < num_blocks; ++b)
+        {
+            if (block_owner(b) == rank) continue;
+            pack_block(b);
+            IBTK_MPI::send(buffer.data(), static_cast<int>(buffer.size()), block_owner(b), false, b);
+        }
+        for (int b = 0; b < num_blocks; ++b)
+        {
+            if (block_owner(b) != rank) continue;
+            const int offset = block_offsets[b];
+            factorizeDenseMatrix(&mat_data[offset * mat_size + offset],
+                                 block_offsets[b + 1] - offset,
+                                 mat_size,
+                                 inv_type,
+                                 ipiv ? &ipiv[offset] : nullptr,
+                                 mat_name,
+                                 "Mobility");
+        }
+        for (int b = 0; b < num_blocks; ++b)
+        {
+            if (block_owner(b) == rank) continue;
+            const int block_size = block_offsets[b + 1] - block_offsets[b];
+            int length = block_size * block_size;
+            buffer.resize(length);
+            IBTK_MPI::recv(buffer.data(), length, block_owner(b), false, b);
+            unpack_block(b);
+            if (ipiv)
+            {
+                length = block_size;
+                IBTK_MPI::recv(&ipiv[block_offsets[b]], length, block_owner(b), false, b);
+            }
+        }
         MatDenseRestoreArray(mat, &mat_data);
     }
     return;
@@ -591,7 +773,7 @@ DirectMobilitySolver::constructBodyMobilityMatrix()
     for (const auto& petsc_mat_pair : d_petsc_mat_map)
     {
         const std::string& mat_name = petsc_mat_pair.first;
-        if (rank != d_mat_proc_map[mat_name]) continue;
+        if (!d_mat_needs_update_map[mat_name] || rank != d_mat_proc_map[mat_name]) continue;
 
         const int row_size = d_mat_nodes_map[mat_name] * NDIM;
         const int col_size = d_mat_parts_map[mat_name] * s_max_free_dofs;
@@ -612,8 +794,11 @@ DirectMobilitySolver::constructBodyMobilityMatrix()
         {
             double* col_data;
             MatDenseGetArray(product_mat, &col_data);
-            computeSolution(
-                mobility_mat, mobility_inv_type, d_ipiv_map[mat_name].first.data(), &col_data[col * row_size]);
+            computeSolution(mobility_mat,
+                            mobility_inv_type,
+                            d_ipiv_map[mat_name].first.data(),
+                            &col_data[col * row_size],
+                            d_mat_block_offsets_map[mat_name]);
             MatDenseRestoreArray(product_mat, &col_data);
         }
         MatTransposeMatMult(geometric_mat, product_mat, MAT_REUSE_MATRIX, PETSC_DEFAULT, &body_mob_mat);
@@ -631,7 +816,7 @@ DirectMobilitySolver::factorizeBodyMobilityMatrix()
     for (const auto& petsc_mat_pair : d_petsc_mat_map)
     {
         const std::string& mat_name = petsc_mat_pair.first;
-        if (rank != d_mat_proc_map[mat_name]) continue;
+        if (!d_mat_needs_update_map[mat_name] || rank != d_mat_proc_map[mat_name]) continue;
 
         Mat& mat = d_petsc_mat_map[mat_name].second;
         const MobilityMatrixInverseType& inv_type = d_mat_inv_type_map[mat_name].second;
@@ -640,7 +825,7 @@ DirectMobilitySolver::factorizeBodyMobilityMatrix()
         double* mat_data = nullptr;
         MatDenseGetArray(mat, &mat_data);
         factorizeDenseMatrix(
-            mat_data, mat_size, inv_type, d_ipiv_map[mat_name].second.data(), mat_name, "Body Mobility");
+            mat_data, mat_size, mat_size, inv_type, d_ipiv_map[mat_name].second.data(), mat_name, "Body Mobility");
         MatDenseRestoreArray(mat, &mat_data);
     }
     return;
@@ -650,6 +835,7 @@ DirectMobilitySolver::factorizeBodyMobilityMatrix()
 void
 DirectMobilitySolver::factorizeDenseMatrix(double* mat_data,
                                            const int mat_size,
+                                           const int lda,
                                            const MobilityMatrixInverseType& inv_type,
                                            int* ipiv,
                                            const std::string& mat_name,
@@ -658,7 +844,7 @@ DirectMobilitySolver::factorizeDenseMatrix(double* mat_data,
     int err = 0;
     if (inv_type == LAPACK_CHOLESKY)
     {
-        dpotrf_((char*)"L", mat_size, mat_data, mat_size, err);
+        dpotrf_((char*)"L", mat_size, mat_data, lda, err);
         if (err)
         {
             TBOX_ERROR("DirectMobilityMatrix::factorizeDenseMatrix(). " << err_msg << " matrix factorization "
@@ -669,7 +855,7 @@ DirectMobilitySolver::factorizeDenseMatrix(double* mat_data,
     }
     else if (inv_type == LAPACK_LU)
     {
-        dgetrf_(mat_size, mat_size, mat_data, mat_size, ipiv, err);
+        dgetrf_(mat_size, mat_size, mat_data, lda, ipiv, err);
         if (err)
         {
             TBOX_ERROR("DirectMobilityMatrix::factorizeDenseMatrix(). "
@@ -699,7 +885,7 @@ DirectMobilitySolver::factorizeDenseMatrix(double* mat_data,
                 (char*)"L",
                 mat_size,
                 mat_data,
-                mat_size,
+                lda,
                 vl,
                 vu,
                 il,
@@ -734,7 +920,7 @@ DirectMobilitySolver::factorizeDenseMatrix(double* mat_data,
                 (char*)"L",
                 mat_size,
                 mat_data,
-                mat_size,
+                lda,
                 vl,
                 vu,
                 il,
@@ -780,11 +966,11 @@ DirectMobilitySolver::factorizeDenseMatrix(double* mat_data,
             {
                 if (MathUtilities<double>::equalEps(w[j], 0.0))
                 {
-                    mat_data[j * mat_size + i] = 0.0;
+                    mat_data[j * lda + i] = 0.0;
                 }
                 else
                 {
-                    mat_data[j * mat_size + i] = z[j * mat_size + i] / std::sqrt(w[j]);
+                    mat_data[j * lda + i] = z[j * mat_size + i] / std::sqrt(w[j]);
                 }
             }
         }
@@ -803,58 +989,71 @@ DirectMobilitySolver::factorizeDenseMatrix(double* mat_data,
 } // factorizeDenseMatrix
 
 void
-DirectMobilitySolver::computeSolution(Mat& mat, const MobilityMatrixInverseType& inv_type, int* ipiv, double* rhs)
+DirectMobilitySolver::computeSolution(Mat& mat,
+                                      const MobilityMatrixInverseType& inv_type,
+                                      int* ipiv,
+                                      double* rhs,
+                                      const std::vector<int>& block_offsets)
 {
     // Get pointer to matrix.
-    int mat_size;
+    int lda;
     double* mat_data = nullptr;
-    MatGetSize(mat, &mat_size, nullptr);
+    MatGetSize(mat, &lda, nullptr);
     MatDenseGetArray(mat, &mat_data);
 
-    int err = 0;
-    if (inv_type == LAPACK_CHOLESKY)
+    // Solve with each factorized diagonal block.
+    for (unsigned int b = 0; b + 1 < block_offsets.size(); ++b)
     {
-        dpotrs_((char*)"L", mat_size, 1, mat_data, mat_size, rhs, mat_size, err);
-        if (err)
-        {
-            TBOX_ERROR("DirectMobilitySolver::computeSolution(). Solution failed using "
-                       << "LAPACK CHOLESKY with error code " << err << std::endl);
-        }
-    }
-    else if (inv_type == LAPACK_LU)
-    {
-        dgetrs_((char*)"N", mat_size, 1, mat_data, mat_size, ipiv, rhs, mat_size, err);
+        const int offset = block_offsets[b];
+        const int mat_size = block_offsets[b + 1] - offset;
+        const double* const block_data = &mat_data[offset * lda + offset];
+        double* const block_rhs = &rhs[offset];
 
-        if (err)
+        int err = 0;
+        if (inv_type == LAPACK_CHOLESKY)
         {
-            TBOX_ERROR("DirectMobilitySolver::computeSolution(). Solution failed using "
-                       << "LAPACK LU with error code " << err << std::endl);
+            dpotrs_((char*)"L", mat_size, 1, block_data, lda, block_rhs, mat_size, err);
+            if (err)
+            {
+                TBOX_ERROR("DirectMobilitySolver::computeSolution(). Solution failed using "
+                           << "LAPACK CHOLESKY with error code " << err << std::endl);
+            }
         }
-    }
-    else if (inv_type == LAPACK_SVD)
-    {
-        std::vector<double> temp(mat_size);
-        for (int i = 0; i < mat_size; ++i)
+        else if (inv_type == LAPACK_LU)
         {
-            temp[i] = 0.0;
-            for (int j = 0; j < mat_size; ++j)
+            dgetrs_((char*)"N", mat_size, 1, block_data, lda, &ipiv[offset], block_rhs, mat_size, err);
+
+            if (err)
             {
-                temp[i] += mat_data[i * mat_size + j] * rhs[j];
+                TBOX_ERROR("DirectMobilitySolver::computeSolution(). Solution failed using "
+                           << "LAPACK LU with error code " << err << std::endl);
             }
         }
-
-        for (int i = 0; i < mat_size; ++i)
+        else if (inv_type == LAPACK_SVD)
         {
-            rhs[i] = 0.0;
-            for (int j = 0; j < mat_size; ++j)
+            std::vector<double> temp(mat_size);
+            for (int i = 0; i < mat_size; ++i)
+            {
+                temp[i] = 0.0;
+                for (int j = 0; j < mat_size; ++j)
+                {
+                    temp[i] += block_data[i * lda + j] * block_rhs[j];
+                }
+            }
+
+            for (int i = 0; i < mat_size; ++i)
             {
-                rhs[i] += mat_data[j * mat_size + i] * temp[j];
+                block_rhs[i] = 0.0;
+                for (int j = 0; j < mat_size; ++j)
+                {
+                    block_rhs[i] += block_data[j * lda + i] * temp[j];
+                }
             }
         }
-    }
-    else
-    {
-        TBOX_ERROR("DirectMobilitySolver::computeSolution(). Inverse method not supported." << std::endl);
+        else
+        {
+            TBOX_ERROR("DirectMobilitySolver::computeSolution(). Inverse method not supported." << std::endl);
+        }
     }
 
     MatDenseRestoreArray(mat, &mat_data);
@@ -71,6 +71,10 @@
 #include <iterator>
 #include <utility>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -288,6 +292,31 @@ FEMechanicsBase::registerPK1StressFunction(const PK1StressFcnData& data, const u
     }
 }
 
+void
+FEMechanicsBase::PK1StressFcnData::evaluate(
+    TensorValue<double>* PP,
+    const TensorValue<double>* FF,
+    const libMesh::Point* x,
+    const libMesh::Point* X,
+    const unsigned int n_points,
+    Elem* const elem,
+    const std::vector<const std::vector<double>*>* system_var_data,
+    const std::vector<const std::vector<VectorValue<double> >*>* system_grad_var_data,
+    const double data_time) const
+{
+    if (batch_fcn)
+    {
+        batch_fcn(PP, FF, x, X, n_points, elem, system_var_data, system_grad_var_data, data_time, ctx);
+        return;
+    }
+    TBOX_ASSERT(fcn);
+    for (unsigned int qp = 0; qp < n_points; ++qp)
+    {
+        fcn(PP[qp], FF[qp], x[qp], X[qp], elem, system_var_data[qp], system_grad_var_data[qp], data_time, ctx);
+    }
+    return;
+}
+
 std::vector<FEMechanicsBase::PK1StressFcnData>
 FEMechanicsBase::getPK1StressFunction(unsigned int part) const
 {
@@ -703,7 +732,7 @@ FEMechanicsBase::computeStaticPressure(PetscVector<double>& P_vec,
         {
             const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
             get_FF(FF, grad_x_data);
-            double J = FF.det();
+            double J = tensor_det<NDIM>(FF);
             const double P = (dU_dJ_fcn ? dU_dJ_fcn(J) : -d_static_pressure_kappa * std::log(J));
             for (unsigned int k = 0; k < n_basis; ++k)
             {
@@ -811,10 +840,10 @@ FEMechanicsBase::computeDynamicPressureRateOfChange(PetscVector<double>& dP_dt_v
         {
             const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
             get_FF(FF, grad_x_data);
-            FF_inv_trans = tensor_inverse_transpose(FF);
+            tensor_inverse_transpose<NDIM>(FF_inv_trans, FF);
             const std::vector<VectorValue<double> >& grad_U_data = fe_interp_grad_var_data[qp][U_sys_idx];
             get_Grad_U(Grad_U, grad_U_data);
-            double J = FF.det();
+            double J = tensor_det<NDIM>(FF);
             const double dP_dt =
                 (d2U_dJ2_fcn ? J * d2U_dJ2_fcn(J) : -d_dynamic_pressure_kappa) * FF_inv_trans.contract(Grad_U);
             for (unsigned int k = 0; k < n_basis; ++k)
@@ -877,17 +906,30 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
     double* F_rhs_local_soln = nullptr;
     ierr = VecGetArray(F_rhs_vec_local, &F_rhs_local_soln);
     IBTK_CHKERRQ(ierr);
-    std::array<DenseVector<double>, NDIM> F_rhs_e;
-    std::vector<libMesh::dof_id_type> dof_id_scratch;
 
     // First handle the stress contributions.  These are handled separately
     // because each stress function may use a different quadrature rule.
+    //
+    // When threaded stress assembly is enabled, the elements are distributed
+    // among the threads, each of which uses its own FE objects and accumulates
+    // into its own copy of the local right-hand side vector.  The DOF map
+    // caches and the libMesh vectors are not thread-safe, so the DOF indices
+    // and the element data are collected in a critical section.
+    const std::vector<Elem*> local_elems(mesh.active_local_elements_begin(), mesh.active_local_elements_end());
+    const int n_local_elems = static_cast<int>(local_elems.size());
+    PetscInt F_rhs_local_size;
+    ierr = VecGetLocalSize(F_rhs_vec_local, &F_rhs_local_size);
+    IBTK_CHKERRQ(ierr);
+#ifdef _OPENMP
+    const bool use_threads = d_use_threaded_stress_assembly && omp_get_max_threads() > 1;
+#endif
     const size_t num_PK1_fcns = d_PK1_stress_fcn_data[part].size();
     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
     {
-        if (!d_PK1_stress_fcn_data[part][k].fcn) continue;
+        const PK1StressFcnData& PK1_stress_fcn_data = d_PK1_stress_fcn_data[part][k];
+        if (!PK1_stress_fcn_data.isSet()) continue;
 
-        // Extract the FE systems and DOF maps, and setup the FE object.
+        // Extract the FE systems and DOF maps.
         const DofMap& F_dof_map = F_system.get_dof_map();
         FEDataManager::SystemDofMapCache& F_dof_map_cache = *d_fe_data[part]->getDofMapCache(FORCE_SYSTEM_NAME);
         FEType F_fe_type = F_dof_map.variable_type(0);
@@ -899,177 +941,251 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
         std::vector<int> vars(NDIM);
         for (unsigned int d = 0; d < NDIM; ++d) vars[d] = d;
 
-        FEDataInterpolation fe(dim, d_fe_data[part]);
-        std::unique_ptr<QBase> qrule =
-            QBase::build(d_PK1_stress_fcn_data[part][k].quad_type, dim, d_PK1_stress_fcn_data[part][k].quad_order);
-        qrule->allow_rules_with_negative_weights = d_allow_rules_with_negative_weights;
-        std::unique_ptr<QBase> qrule_face =
-            QBase::build(d_PK1_stress_fcn_data[part][k].quad_type, dim - 1, d_PK1_stress_fcn_data[part][k].quad_order);
-        qrule_face->allow_rules_with_negative_weights = d_allow_rules_with_negative_weights;
-        fe.attachQuadratureRule(qrule.get());
-        fe.attachQuadratureRuleFace(qrule_face.get());
-        fe.evalNormalsFace();
-        fe.evalQuadraturePoints();
-        fe.evalQuadraturePointsFace();
-        fe.evalQuadratureWeights();
-        fe.evalQuadratureWeightsFace();
-        fe.registerSystem(F_system, std::vector<int>(), vars); // compute dphi for the force system
-        const size_t X_sys_idx = fe.registerInterpolatedSystem(X_system, vars, vars, &X_vec);
-        std::vector<size_t> PK1_fcn_system_idxs;
-        fe.setupInterpolatedSystemDataIndexes(
-            PK1_fcn_system_idxs, d_PK1_stress_fcn_data[part][k].system_data, &equation_systems);
-        fe.init();
-
-        const std::vector<libMesh::Point>& q_point = fe.getQuadraturePoints();
-        const std::vector<double>& JxW = fe.getQuadratureWeights();
-        const std::vector<std::vector<VectorValue<double> > >& dphi = fe.getDphi(F_fe_type);
-
-        const std::vector<libMesh::Point>& q_point_face = fe.getQuadraturePointsFace();
-        const std::vector<double>& JxW_face = fe.getQuadratureWeightsFace();
-        const std::vector<libMesh::Point>& normal_face = fe.getNormalsFace();
-        const std::vector<std::vector<double> >& phi_face = fe.getPhiFace(F_fe_type);
-
-        const std::vector<std::vector<std::vector<double> > >& fe_interp_var_data = fe.getVarInterpolation();
-        const std::vector<std::vector<std::vector<VectorValue<double> > > >& fe_interp_grad_var_data =
-            fe.getGradVarInterpolation();
-
-        std::vector<const std::vector<double>*> PK1_var_data;
-        std::vector<const std::vector<VectorValue<double> >*> PK1_grad_var_data;
-
-        // Loop over the elements to compute the right-hand side vector.  This
-        // is computed via
-        //
-        //    rhs_k = -int{PP(s,t) grad phi_k(s)}ds + int{PP(s,t) N(s,t)
-        //    phi_k(s)}dA(s)
-        //
-        // This right-hand side vector is used to solve for the nodal values of
-        // the interior elastic force density.
-        TensorValue<double> PP, FF, FF_inv_trans;
-        VectorValue<double> F, F_qp, n, x;
-        const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
-        const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
-        for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
+#ifdef _OPENMP
+#pragma omp parallel if (use_threads)
+#endif
         {
-            Elem* const elem = *el_it;
-            const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
-            for (unsigned int d = 0; d < NDIM; ++d)
+            // Setup the FE object.
+            FEDataInterpolation fe(dim, d_fe_data[part]);
+            std::unique_ptr<QBase> qrule =
+                QBase::build(PK1_stress_fcn_data.quad_type, dim, PK1_stress_fcn_data.quad_order);
+            qrule->allow_rules_with_negative_weights = d_allow_rules_with_negative_weights;
+            std::unique_ptr<QBase> qrule_face =
+                QBase::build(PK1_stress_fcn_data.quad_type, dim - 1, PK1_stress_fcn_data.quad_order);
+            qrule_face->allow_rules_with_negative_weights = d_allow_rules_with_negative_weights;
+            fe.attachQuadratureRule(qrule.get());
+            fe.attachQuadratureRuleFace(qrule_face.get());
+            fe.evalNormalsFace();
+            fe.evalQuadraturePoints();
+            fe.evalQuadraturePointsFace();
+            fe.evalQuadratureWeights();
+            fe.evalQuadratureWeightsFace();
+            size_t X_sys_idx;
+            std::vector<size_t> PK1_fcn_system_idxs;
+#ifdef _OPENMP
+#pragma omp critical(FEMechanicsBase_dof_data)
+#endif
+            {
+                fe.registerSystem(F_system, std::vector<int>(), vars); // compute dphi for the force system
+                X_sys_idx = fe.registerInterpolatedSystem(X_system, vars, vars, &X_vec);
+                fe.setupInterpolatedSystemDataIndexes(
+                    PK1_fcn_system_idxs, PK1_stress_fcn_data.system_data, &equation_systems);
+                fe.init();
+            }
+
+            const std::vector<libMesh::Point>& q_point = fe.getQuadraturePoints();
+            const std::vector<double>& JxW = fe.getQuadratureWeights();
+            const std::vector<std::vector<VectorValue<double> > >& dphi = fe.getDphi(F_fe_type);
+
+            const std::vector<libMesh::Point>& q_point_face = fe.getQuadraturePointsFace();
+            const std::vector<double>& JxW_face = fe.getQuadratureWeightsFace();
+            const std::vector<libMesh::Point>& normal_face = fe.getNormalsFace();
+            const std::vector<std::vector<double> >& phi_face = fe.getPhiFace(F_fe_type);
+
+            const std::vector<std::vector<std::vector<double> > >& fe_interp_var_data = fe.getVarInterpolation();
+            const std::vector<std::vector<std::vector<VectorValue<double> > > >& fe_interp_grad_var_data =
+                fe.getGradVarInterpolation();
+
+            // The stresses are evaluated at all quadrature points of an element
+            // (or of an element side) at once so that batched stress functions
+            // can be used.
+            std::vector<std::vector<const std::vector<double>*> > PK1_var_data;
+            std::vector<std::vector<const std::vector<VectorValue<double> >*> > PK1_grad_var_data;
+            std::vector<TensorValue<double> > PP_qp, FF_qp;
+            std::vector<libMesh::Point> x_qp, X_qp;
+            const auto prepare_stress_data =
+                [&](const std::vector<libMesh::Point>& X_points, Elem* const elem, const unsigned int n_points) {
+                    PP_qp.resize(n_points);
+                    FF_qp.resize(n_points);
+                    x_qp.resize(n_points);
+                    X_qp.resize(n_points);
+                    PK1_var_data.resize(n_points);
+                    PK1_grad_var_data.resize(n_points);
+                    VectorValue<double> x;
+                    for (unsigned int qp = 0; qp < n_points; ++qp)
+                    {
+                        const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
+                        const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
+                        get_x_and_FF(x, FF_qp[qp], x_data, grad_x_data);
+                        x_qp[qp] = x;
+                        X_qp[qp] = X_points[qp];
+                        fe.setInterpolatedDataPointers(
+                            PK1_var_data[qp], PK1_grad_var_data[qp], PK1_fcn_system_idxs, elem, qp);
+                    }
+                };
+
+            // Each thread sums into its own copy of the local right-hand side
+            // vector, which is added to the global vector after the element
+            // loop.
+            std::vector<double> F_rhs_thread_soln;
+            double* F_rhs_soln = F_rhs_local_soln;
+#ifdef _OPENMP
+            if (use_threads)
             {
-                F_rhs_e[d].resize(static_cast<int>(F_dof_indices[d].size()));
+                F_rhs_thread_soln.resize(F_rhs_local_size, 0.0);
+                F_rhs_soln = F_rhs_thread_soln.data();
             }
-            fe.reinit(elem);
-            fe.collectDataForInterpolation(elem);
-            fe.interpolate(elem);
-            const unsigned int n_qp = qrule->n_points();
-            const size_t n_basis = dphi.size();
-            for (unsigned int qp = 0; qp < n_qp; ++qp)
+#endif
+            std::array<DenseVector<double>, NDIM> F_rhs_e;
+            std::vector<libMesh::dof_id_type> dof_id_scratch;
+
+            // Loop over the elements to compute the right-hand side vector.
+            // This is computed via
+            //
+            //    rhs_k = -int{PP(s,t) grad phi_k(s)}ds + int{PP(s,t) N(s,t)
+            //    phi_k(s)}dA(s)
+            //
+            // This right-hand side vector is used to solve for the nodal values
+            // of the interior elastic force density.
+            TensorValue<double> FF_inv_trans;
+            VectorValue<double> F, F_qp, n;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif
+            for (int e = 0; e < n_local_elems; ++e)
             {
-                const libMesh::Point& X = q_point[qp];
-                const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
-                const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
-                get_x_and_FF(x, FF, x_data, grad_x_data);
+                Elem* const elem = local_elems[e];
+                fe.reinit(elem);
+                const boost::multi_array<libMesh::dof_id_type, 2>* F_dof_indices_ptr;
+#ifdef _OPENMP
+#pragma omp critical(FEMechanicsBase_dof_data)
+#endif
+                {
+                    F_dof_indices_ptr = &F_dof_map_cache.dof_indices(elem);
+                    fe.collectDataForInterpolation(elem);
+                }
+                const auto& F_dof_indices = *F_dof_indices_ptr;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    F_rhs_e[d].resize(static_cast<int>(F_dof_indices[d].size()));
+                }
+                fe.interpolate(elem);
+                const unsigned int n_qp = qrule->n_points();
+                const size_t n_basis = dphi.size();
 
-                // Compute the value of the first Piola-Kirchhoff stress tensor
-                // at the quadrature point and add the corresponding forces to
+                // Compute the values of the first Piola-Kirchhoff stress tensor
+                // at the quadrature points and add the corresponding forces to
                 // the right-hand-side vector.
-                fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
-                d_PK1_stress_fcn_data[part][k].fcn(
-                    PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time, d_PK1_stress_fcn_data[part][k].ctx);
-                for (unsigned int basis_n = 0; basis_n < n_basis; ++basis_n)
+                prepare_stress_data(q_point, elem, n_qp);
+                PK1_stress_fcn_data.evaluate(PP_qp.data(),
+                                             FF_qp.data(),
+                                             x_qp.data(),
+                                             X_qp.data(),
+                                             n_qp,
+                                             elem,
+                                             PK1_var_data.data(),
+                                             PK1_grad_var_data.data(),
+                                             data_time);
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
                 {
-                    F_qp = -PP * dphi[basis_n][qp] * JxW[qp];
-                    for (unsigned int i = 0; i < NDIM; ++i)
+                    const TensorValue<double>& PP = PP_qp[qp];
+                    for (unsigned int basis_n = 0; basis_n < n_basis; ++basis_n)
                     {
-                        F_rhs_e[i](basis_n) += F_qp(i);
+                        F_qp = -PP * dphi[basis_n][qp] * JxW[qp];
+                        for (unsigned int i = 0; i < NDIM; ++i)
+                        {
+                            F_rhs_e[i](basis_n) += F_qp(i);
+                        }
                     }
                 }
-            }
 
-            // Loop over the element boundaries.
-            for (unsigned int side = 0; side < elem->n_sides(); ++side)
-            {
-                // Skip non-physical boundaries.
-                if (!is_physical_bdry(elem, side, boundary_info, F_dof_map)) continue;
-
-                // Determine if we need to integrate surface forces along this
-                // part of the physical boundary; if not, skip the present side.
-                const bool at_dirichlet_bdry = is_dirichlet_bdry(elem, side, boundary_info, F_dof_map);
-                const bool integrate_normal_stress = (d_include_normal_stress_in_weak_form && !at_dirichlet_bdry) ||
-                                                     (!d_include_normal_stress_in_weak_form && at_dirichlet_bdry);
-                const bool integrate_tangential_stress =
-                    (d_include_tangential_stress_in_weak_form && !at_dirichlet_bdry) ||
-                    (!d_include_tangential_stress_in_weak_form && at_dirichlet_bdry);
-                if (!integrate_normal_stress && !integrate_tangential_stress) continue;
-
-                fe.reinit(elem, side);
-                fe.interpolate(elem, side);
-                const unsigned int n_qp_face = qrule_face->n_points();
-                const size_t n_basis_face = phi_face.size();
-                for (unsigned int qp = 0; qp < n_qp_face; ++qp)
+                // Loop over the element boundaries.
+                for (unsigned int side = 0; side < elem->n_sides(); ++side)
                 {
-                    const libMesh::Point& X = q_point_face[qp];
-                    const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
-                    const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
-                    get_x_and_FF(x, FF, x_data, grad_x_data);
-                    tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
-
-                    F.zero();
-
-                    // Compute the value of the first Piola-Kirchhoff stress
-                    // tensor at the quadrature point and add the corresponding
-                    // traction force to the right-hand-side vector.
-                    if (d_PK1_stress_fcn_data[part][k].fcn)
+                    // Skip non-physical boundaries.
+                    if (!is_physical_bdry(elem, side, boundary_info, F_dof_map)) continue;
+
+                    // Determine if we need to integrate surface forces along
+                    // this part of the physical boundary; if not, skip the
+                    // present side.
+                    const bool at_dirichlet_bdry = is_dirichlet_bdry(elem, side, boundary_info, F_dof_map);
+                    const bool integrate_normal_stress =
+                        (d_include_normal_stress_in_weak_form && !at_dirichlet_bdry) ||
+                        (!d_include_normal_stress_in_weak_form && at_dirichlet_bdry);
+                    const bool integrate_tangential_stress =
+                        (d_include_tangential_stress_in_weak_form && !at_dirichlet_bdry) ||
+                        (!d_include_tangential_stress_in_weak_form && at_dirichlet_bdry);
+                    if (!integrate_normal_stress && !integrate_tangential_stress) continue;
+
+                    fe.reinit(elem, side);
+                    fe.interpolate(elem, side);
+                    const unsigned int n_qp_face = qrule_face->n_points();
+                    const size_t n_basis_face = phi_face.size();
+
+                    // Compute the values of the first Piola-Kirchhoff stress
+                    // tensor at the quadrature points and add the corresponding
+                    // traction forces to the right-hand-side vector.
+                    prepare_stress_data(q_point_face, elem, n_qp_face);
+                    PK1_stress_fcn_data.evaluate(PP_qp.data(),
+                                                 FF_qp.data(),
+                                                 x_qp.data(),
+                                                 X_qp.data(),
+                                                 n_qp_face,
+                                                 elem,
+                                                 PK1_var_data.data(),
+                                                 PK1_grad_var_data.data(),
+                                                 data_time);
+                    for (unsigned int qp = 0; qp < n_qp_face; ++qp)
                     {
-                        fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
-                        d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                           FF,
-                                                           x,
-                                                           X,
-                                                           elem,
-                                                           PK1_var_data,
-                                                           PK1_grad_var_data,
-                                                           data_time,
-                                                           d_PK1_stress_fcn_data[part][k].ctx);
-                        F += PP * normal_face[qp];
-                    }
+                        const TensorValue<double>& FF = FF_qp[qp];
+                        tensor_inverse_transpose<NDIM>(FF_inv_trans, FF);
 
-                    n = (FF_inv_trans * normal_face[qp]).unit();
+                        F = PP_qp[qp] * normal_face[qp];
 
-                    if (!integrate_normal_stress)
-                    {
-                        F -= (F * n) * n; // remove the normal component.
-                    }
+                        n = (FF_inv_trans * normal_face[qp]).unit();
 
-                    if (!integrate_tangential_stress)
-                    {
-                        F -= (F - (F * n) * n); // remove the tangential component.
-                    }
+                        if (!integrate_normal_stress)
+                        {
+                            F -= (F * n) * n; // remove the normal component.
+                        }
 
-                    // Add the boundary forces to the right-hand-side vector.
-                    for (unsigned int basis_face_n = 0; basis_face_n < n_basis_face; ++basis_face_n)
-                    {
-                        F_qp = F * phi_face[basis_face_n][qp] * JxW_face[qp];
-                        for (unsigned int i = 0; i < NDIM; ++i)
+                        if (!integrate_tangential_stress)
+                        {
+                            F -= (F - (F * n) * n); // remove the tangential component.
+                        }
+
+                        // Add the boundary forces to the right-hand-side vector.
+                        for (unsigned int basis_face_n = 0; basis_face_n < n_basis_face; ++basis_face_n)
                         {
-                            F_rhs_e[i](basis_face_n) += F_qp(i);
+                            F_qp = F * phi_face[basis_face_n][qp] * JxW_face[qp];
+                            for (unsigned int i = 0; i < NDIM; ++i)
+                            {
+                                F_rhs_e[i](basis_face_n) += F_qp(i);
+                            }
                         }
                     }
                 }
+
+                // Apply constraints (e.g., enforce periodic boundary
+                // conditions) and add the elemental contributions to the
+                // right-hand side vector.
+                for (unsigned int var_n = 0; var_n < NDIM; ++var_n)
+                {
+                    copy_dof_ids_to_vector(var_n, F_dof_indices, dof_id_scratch);
+                    F_dof_map.constrain_element_vector(F_rhs_e[var_n], dof_id_scratch);
+                    for (unsigned int j = 0; j < dof_id_scratch.size(); ++j)
+                    {
+                        F_rhs_soln[F_rhs_vec.map_global_to_local_index(dof_id_scratch[j])] += F_rhs_e[var_n](j);
+                    }
+                }
             }
 
-            // Apply constraints (e.g., enforce periodic boundary conditions)
-            // and add the elemental contributions to the global vector.
-            for (unsigned int var_n = 0; var_n < NDIM; ++var_n)
+#ifdef _OPENMP
+            if (use_threads)
             {
-                copy_dof_ids_to_vector(var_n, F_dof_indices, dof_id_scratch);
-                F_dof_map.constrain_element_vector(F_rhs_e[var_n], dof_id_scratch);
-                for (unsigned int j = 0; j < dof_id_scratch.size(); ++j)
+#pragma omp critical(FEMechanicsBase_rhs_reduction)
+                for (PetscInt i = 0; i < F_rhs_local_size; ++i)
                 {
-                    F_rhs_local_soln[F_rhs_vec.map_global_to_local_index(dof_id_scratch[j])] += F_rhs_e[var_n](j);
+                    F_rhs_local_soln[i] += F_rhs_thread_soln[i];
                 }
             }
+#endif
         }
     }
 
+    std::array<DenseVector<double>, NDIM> F_rhs_e;
+    std::vector<libMesh::dof_id_type> dof_id_scratch;
+
     // Now account for any additional force contributions.
 
     // Extract the FE systems and DOF maps, and setup the FE objects.
@@ -1159,8 +1275,8 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
             const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
             const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
             get_x_and_FF(x, FF, x_data, grad_x_data);
-            const double J = std::abs(FF.det());
-            tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
+            const double J = std::abs(tensor_det<NDIM>(FF));
+            tensor_inverse_transpose<NDIM>(FF_inv_trans, FF);
 
             if (using_pressure)
             {
@@ -1231,8 +1347,8 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
                 const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
                 const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
                 get_x_and_FF(x, FF, x_data, grad_x_data);
-                const double J = std::abs(FF.det());
-                tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
+                const double J = std::abs(tensor_det<NDIM>(FF));
+                tensor_inverse_transpose<NDIM>(FF_inv_trans, FF);
                 const libMesh::VectorValue<double>& N = normal_face[qp];
                 n = (FF_inv_trans * N).unit();
 
@@ -1525,8 +1641,8 @@ FEMechanicsBase::commonConstructor(const std::string& object_name,
         const MeshBase& mesh = *meshes[part];
         bool mesh_has_first_order_elems = false;
         bool mesh_has_second_order_elems = false;
-        MeshBase::const_element_iterator el_it = mesh.elements_begin();
-        const MeshBase::const_element_iterator el_end = mesh.elements_end();
+        MeshBase::const_element_iterator el_it = mesh.local_elements_begin();
+        const MeshBase::const_element_iterator el_end = mesh.local_elements_end();
         for (; el_it != el_end; ++el_it)
         {
             const Elem* const elem = *el_it;
@@ -1632,6 +1748,8 @@ FEMechanicsBase::getFromInput(const Pointer<Database>& db, bool /*is_from_restar
         d_use_consistent_mass_matrix = db->getBool("use_consistent_mass_matrix");
     if (db->isBool("allow_rules_with_negative_weights"))
         d_allow_rules_with_negative_weights = db->getBool("allow_rules_with_negative_weights");
+    if (db->isBool("use_threaded_stress_assembly"))
+        d_use_threaded_stress_assembly = db->getBool("use_threaded_stress_assembly");
 
     // Pressure settings.
     if (db->isDouble("static_pressure_kappa")) d_static_pressure_kappa = db->getDouble("static_pressure_kappa");
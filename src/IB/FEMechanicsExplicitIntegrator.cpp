@@ -73,10 +73,12 @@ FEMechanicsExplicitIntegrator::preprocessIntegrateData(double current_time, doub
     FEMechanicsBase::preprocessIntegrateData(current_time, new_time, num_cycles);
 
     // Initialize variables.
-    d_X_vecs->copy("solution", { "current", "new", "half" });
-    d_U_vecs->copy("solution", { "current", "new", "half" });
-    d_F_vecs->copy("solution", { "current", "new", "half" });
-    if (d_P_vecs) d_P_vecs->copy("solution", { "current", "new", "half" });
+    FEVectorPipeline pipeline;
+    d_X_vecs->copy("solution", { "current", "new", "half" }, pipeline);
+    d_U_vecs->copy("solution", { "current", "new", "half" }, pipeline);
+    d_F_vecs->copy("solution", { "current", "new", "half" }, pipeline);
+    if (d_P_vecs) d_P_vecs->copy("solution", { "current", "new", "half" }, pipeline);
+    pipeline.execute();
 }
 
 void
@@ -86,12 +88,13 @@ FEMechanicsExplicitIntegrator::postprocessIntegrateData(double current_time, dou
                                                           d_U_vecs->get("new"),
                                                           d_F_vecs->get("new") };
     if (d_P_vecs) vecs.push_back(d_P_vecs->get("new"));
-    batch_vec_ghost_update(vecs, INSERT_VALUES, SCATTER_FORWARD);
-
-    d_X_vecs->copy("new", { "solution", "current" });
-    d_U_vecs->copy("new", { "solution", "current" });
-    d_F_vecs->copy("new", { "solution", "current" });
-    if (d_P_vecs) d_P_vecs->copy("new", { "solution", "current" });
+    FEVectorPipeline pipeline;
+    for (const auto& part_vecs : vecs) pipeline.ghostUpdate(part_vecs);
+    d_X_vecs->copy("new", { "solution", "current" }, pipeline);
+    d_U_vecs->copy("new", { "solution", "current" }, pipeline);
+    d_F_vecs->copy("new", { "solution", "current" }, pipeline);
+    if (d_P_vecs) d_P_vecs->copy("new", { "solution", "current" }, pipeline);
+    pipeline.execute();
 
     FEMechanicsBase::postprocessIntegrateData(current_time, new_time, num_cycles);
 }
@@ -442,6 +445,78 @@ FEMechanicsExplicitIntegrator::modifiedTrapezoidalStep(const double current_time
     }
 }
 
+void
+FEMechanicsExplicitIntegrator::subcycledStep(const double current_time,
+                                             const double new_time,
+                                             void (FEMechanicsExplicitIntegrator::*step_fcn)(double, double))
+{
+    if (d_num_substeps == 1)
+    {
+        (this->*step_fcn)(current_time, new_time);
+        return;
+    }
+
+    // Each substep advances the "current" vectors into the "new" vectors, so
+    // the time interval used to select the vectors is temporarily reset to
+    // the substep interval. The initial values are still stored in the
+    // "solution" vectors.
+    const double dt = new_time - current_time;
+    const double dt_substep = dt / static_cast<double>(d_num_substeps);
+    for (int k = 0; k < d_num_substeps; ++k)
+    {
+        const double substep_current_time = current_time + k * dt_substep;
+        const double substep_new_time = k + 1 == d_num_substeps ? new_time : substep_current_time + dt_substep;
+        if (k > 0)
+        {
+            std::vector<std::vector<PetscVector<double>*> > vecs{ d_X_vecs->get("new"), d_U_vecs->get("new") };
+            if (d_P_vecs) vecs.push_back(d_P_vecs->get("new"));
+            FEVectorPipeline pipeline;
+            for (const auto& part_vecs : vecs) pipeline.ghostUpdate(part_vecs);
+            d_X_vecs->copy("new", { "current" }, pipeline);
+            d_U_vecs->copy("new", { "current" }, pipeline);
+            if (d_P_vecs) d_P_vecs->copy("new", { "current" }, pipeline);
+            pipeline.execute();
+        }
+        d_current_time = substep_current_time;
+        d_new_time = substep_new_time;
+        d_half_time = substep_current_time + 0.5 * (substep_new_time - substep_current_time);
+        (this->*step_fcn)(substep_current_time, substep_new_time);
+    }
+    d_current_time = current_time;
+    d_new_time = new_time;
+    d_half_time = current_time + 0.5 * dt;
+
+    // Restore the initial values.
+    FEVectorPipeline pipeline;
+    d_X_vecs->copy("solution", { "current" }, pipeline);
+    d_U_vecs->copy("solution", { "current" }, pipeline);
+    if (d_P_vecs) d_P_vecs->copy("solution", { "current" }, pipeline);
+    pipeline.execute();
+
+    // Every scheme updates the velocity as U^{k+1} := U^{k} + (dt/rho) F for
+    // some force F, so the time-averaged force is determined by the total
+    // change in the velocity:
+    //
+    //    F^{avg} := (rho/dt) (U^{n+1} - U^{n})
+    for (unsigned int part = 0; part < d_meshes.size(); ++part)
+    {
+        int ierr = VecWAXPY(d_F_vecs->get("new", part).vec(),
+                            -1.0,
+                            d_U_vecs->get("current", part).vec(),
+                            d_U_vecs->get("new", part).vec());
+        IBTK_CHKERRQ(ierr);
+        ierr = VecScale(d_F_vecs->get("new", part).vec(), d_rhos[part] / dt);
+        IBTK_CHKERRQ(ierr);
+    }
+    return;
+} // subcycledStep
+
+int
+FEMechanicsExplicitIntegrator::getNumberOfSubsteps() const
+{
+    return d_num_substeps;
+} // getNumberOfSubsteps
+
 void
 FEMechanicsExplicitIntegrator::computeLagrangianForce(const double data_time)
 {
@@ -557,6 +632,15 @@ FEMechanicsExplicitIntegrator::getFromInput(const Pointer<Database>& db, bool /*
         TBOX_ASSERT(static_cast<std::size_t>(db->getArraySize("mass_density")) == d_rhos.size());
         db->getDoubleArray("mass_density", d_rhos.data(), db->getArraySize("mass_density"));
     }
+
+    // Time stepping parameters.
+    if (db->isInteger("num_substeps")) d_num_substeps = db->getInteger("num_substeps");
+    if (d_num_substeps < 1)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  num_substeps must be positive but num_substeps = " << d_num_substeps
+                                 << std::endl);
+    }
 }
 
 void
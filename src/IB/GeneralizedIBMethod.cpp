@@ -495,8 +495,6 @@ GeneralizedIBMethod::spreadForce(const int f_data_idx,
                                  const std::vector<Pointer<RefineSchedule<NDIM> > >& f_prolongation_scheds,
                                  const double data_time)
 {
-    IBMethod::spreadForce(f_data_idx, f_phys_bdry_op, f_prolongation_scheds, data_time);
-
     std::vector<Pointer<LData> >* N_data = nullptr;
     bool* N_needs_ghost_fill = nullptr;
     if (MathUtilities<double>::equalEps(data_time, d_current_time))
@@ -519,6 +517,31 @@ GeneralizedIBMethod::spreadForce(const int f_data_idx,
     TBOX_ASSERT(N_data);
     TBOX_ASSERT(N_needs_ghost_fill);
 
+    // Start updating the Lagrangian ghost node values of the torque density so
+    // that the communication overlaps with spreading the force density.
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    if (*N_needs_ghost_fill)
+    {
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            if (d_l_data_manager->levelContainsLagrangianData(ln)) (*N_data)[ln]->beginGhostUpdate();
+        }
+    }
+
+    IBMethod::spreadForce(f_data_idx, f_phys_bdry_op, f_prolongation_scheds, data_time);
+
+    if (*N_needs_ghost_fill)
+    {
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            if (d_l_data_manager->levelContainsLagrangianData(ln)) (*N_data)[ln]->endGhostUpdate();
+        }
+        *N_needs_ghost_fill = false;
+    }
+
+    // The force and the torque densities are spread using the same positions,
+    // whose ghost node values have already been updated by IBMethod.
     std::vector<Pointer<LData> >* X_LE_data;
     bool* X_LE_needs_ghost_fill;
     getLECouplingPositionData(&X_LE_data, &X_LE_needs_ghost_fill, data_time);
@@ -529,17 +552,13 @@ GeneralizedIBMethod::spreadForce(const int f_data_idx,
                              f_phys_bdry_op,
                              std::vector<Pointer<RefineSchedule<NDIM> > >(),
                              data_time,
-                             *N_needs_ghost_fill,
+                             /*F_data_ghost_node_update*/ false,
                              *X_LE_needs_ghost_fill);
-    *N_needs_ghost_fill = false;
     *X_LE_needs_ghost_fill = false;
-    const int coarsest_ln = 0;
-    const int finest_ln = d_hierarchy->getFinestLevelNumber();
     const std::vector<Pointer<RefineSchedule<NDIM> > >& n_ghostfill_scheds =
         getGhostfillRefineSchedules(d_object_name + "::n");
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         n_ghostfill_scheds[ln]->fillData(data_time);
     }
     Pointer<Variable<NDIM> > u_var = d_ib_solver->getVelocityVariable();
@@ -21,6 +21,8 @@
 #include "tbox/AbstractStream.h"
 #include "tbox/Pointer.h"
 
+#include <vector>
+
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 
 namespace SAMRAI
@@ -65,6 +67,37 @@ IBAnchorPointSpec::Factory::unpackStream(AbstractStream& stream, const IntVector
     return ret_val;
 } // unpackStream
 
+void
+IBAnchorPointSpec::Factory::packStreams(AbstractStream& stream,
+                                        const Pointer<Streamable>* const data_items,
+                                        const int num_items)
+{
+    std::vector<int> node_idxs(num_items);
+    for (int k = 0; k < num_items; ++k)
+    {
+        node_idxs[k] = static_cast<const IBAnchorPointSpec*>(data_items[k].getPointer())->d_node_idx;
+    }
+    stream.pack(node_idxs.data(), num_items);
+    return;
+} // packStreams
+
+void
+IBAnchorPointSpec::Factory::unpackStreams(AbstractStream& stream,
+                                          const IntVector<NDIM>& /*offset*/,
+                                          Pointer<Streamable>* const data_items,
+                                          const int num_items)
+{
+    std::vector<int> node_idxs(num_items);
+    stream.unpack(node_idxs.data(), num_items);
+    for (int k = 0; k < num_items; ++k)
+    {
+        Pointer<IBAnchorPointSpec> spec = new IBAnchorPointSpec();
+        spec->d_node_idx = node_idxs[k];
+        data_items[k] = spec;
+    }
+    return;
+} // unpackStreams
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
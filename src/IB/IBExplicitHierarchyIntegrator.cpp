@@ -23,6 +23,7 @@
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/ibtk_enums.h"
+#include "ibtk/profiling_annotations.h"
 
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
@@ -102,6 +103,7 @@ IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double current
                                                             const double new_time,
                                                             const int num_cycles)
 {
+    IBTK_PROFILING_REGION("IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy");
     IBHierarchyIntegrator::preprocessIntegrateHierarchy(current_time, new_time, num_cycles);
 
     const int coarsest_ln = 0;
@@ -119,8 +121,8 @@ IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double current
             level->allocatePatchData(d_p_idx, current_time);
             level->allocatePatchData(d_q_idx, current_time);
         }
-        level->allocatePatchData(d_scratch_data, current_time);
-        level->allocatePatchData(d_new_data, new_time);
+        allocateLevelPatchData(level, d_scratch_data, current_time);
+        allocateLevelPatchData(level, d_new_data, new_time);
     }
 
     // Initialize IB data.
@@ -191,6 +193,7 @@ IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double current
 void
 IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, const double new_time, const int cycle_num)
 {
+    IBTK_PROFILING_REGION("IBExplicitHierarchyIntegrator::integrateHierarchy");
     IBHierarchyIntegrator::integrateHierarchy(current_time, new_time, cycle_num);
     const double half_time = current_time + 0.5 * (new_time - current_time);
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
@@ -398,6 +401,7 @@ IBExplicitHierarchyIntegrator::postprocessIntegrateHierarchy(const double curren
                                                              const bool skip_synchronize_new_state_data,
                                                              const int num_cycles)
 {
+    IBTK_PROFILING_REGION("IBExplicitHierarchyIntegrator::postprocessIntegrateHierarchy");
     // The last thing we need to do (before we really postprocess) is update the structure velocity:
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     const int u_new_idx = var_db->mapVariableAndContextToIndex(d_ins_hier_integrator->getVelocityVariable(),
@@ -55,6 +55,7 @@ IBTK_DISABLE_EXTRA_WARNINGS
 #include "Eigen/Core"
 IBTK_ENABLE_EXTRA_WARNINGS
 
+#include <array>
 #include <memory>
 #include <ostream>
 #include <utility>
@@ -127,6 +128,20 @@ set_rotation_matrix(const Eigen::Vector3d& rot_vel,
 
 } // set_rotation_matrix
 
+// Compute the moment of inertia tensor about X0 of a body with volume vol,
+// first moment M1 = int X, and second moment M2 = int X X^T.
+Eigen::Matrix3d
+get_inertia_tensor(const double vol, const Eigen::Vector3d& M1, const Eigen::Matrix3d& M2, const Eigen::Vector3d& X0)
+{
+    // The second moment about X0, i.e., int (X - X0) (X - X0)^T.
+    Eigen::Matrix3d S = M2 - X0 * M1.transpose() - M1 * X0.transpose() + vol * X0 * X0.transpose();
+#if (NDIM == 2)
+    S.row(2).setZero();
+    S.col(2).setZero();
+#endif
+    return S.trace() * Eigen::Matrix3d::Identity() - S;
+} // get_inertia_tensor
+
 } // namespace
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
@@ -188,10 +203,8 @@ IBFEDirectForcingKinematics::initializeKinematicsData(bool initial_time)
 {
     if (initial_time)
     {
-        computeCOMOfStructure(d_center_of_mass_initial);
+        computeCOMAndMOIOfStructure(d_center_of_mass_initial, d_inertia_tensor_initial);
         d_center_of_mass_current = d_center_of_mass_initial;
-
-        computeMOIOfStructure(d_inertia_tensor_initial, d_center_of_mass_initial);
     }
 
     return;
@@ -545,73 +558,38 @@ IBFEDirectForcingKinematics::getFromRestart()
 void
 IBFEDirectForcingKinematics::computeCOMOfStructure(Eigen::Vector3d& X0)
 {
-    // Get the FE data.
-    EquationSystems* equation_systems = d_ibfe_method_ops->getFEDataManager(d_part)->getEquationSystems();
-    MeshBase& mesh = equation_systems->get_mesh();
-    const unsigned int dim = mesh.mesh_dimension();
-
-    // Extract the FE system and DOF map, and setup the FE object.
-    System& X_system = equation_systems->get_system(IBFEMethod::COORDS_SYSTEM_NAME);
-    copy_and_synch(*X_system.solution, *X_system.current_local_solution);
-    DofMap& X_dof_map = X_system.get_dof_map();
-    std::vector<std::vector<unsigned int> > X_dof_indices(NDIM);
-    FEType fe_type = X_dof_map.variable_type(0);
-    std::unique_ptr<QBase> qrule = fe_type.default_quadrature_rule(dim);
-
-    std::unique_ptr<FEBase> fe(FEBase::build(dim, fe_type));
-    fe->attach_quadrature_rule(qrule.get());
-    const std::vector<double>& JxW = fe->get_JxW();
-    const std::vector<std::vector<double> >& phi = fe->get_phi();
-
-    // Extract the nodal coordinates.
-    auto& X_petsc = dynamic_cast<PetscVector<double>&>(*X_system.current_local_solution.get());
-    X_petsc.close();
-    Vec X_global_vec = X_petsc.vec();
-    Vec X_local_ghost_vec;
-    VecGhostGetLocalForm(X_global_vec, &X_local_ghost_vec);
-    double* X_local_ghost_soln;
-    VecGetArray(X_local_ghost_vec, &X_local_ghost_soln);
-
-    // Loop over the local elements to compute the local integrals.
-    boost::multi_array<double, 2> X_node;
-    double X_qp[NDIM];
-    double vol_part = 0.0;
-    X0.setZero();
-    const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
-    const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
-    for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
-    {
-        const Elem* const elem = *el_it;
-        fe->reinit(elem);
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            X_dof_map.dof_indices(elem, X_dof_indices[d], d);
-        }
-        get_values_for_interpolation(X_node, X_petsc, X_local_ghost_soln, X_dof_indices);
-
-        const unsigned int n_qp = qrule->n_points();
-        for (unsigned int qp = 0; qp < n_qp; ++qp)
-        {
-            interpolate(X_qp, qp, X_node, phi);
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                X0[d] += X_qp[d] * JxW[qp];
-            }
-            vol_part += JxW[qp];
-        }
-    }
-    IBTK_MPI::sumReduction(X0.data(), X0.size());
-    vol_part = IBTK_MPI::sumReduction(vol_part);
-    X0 /= vol_part;
-
-    VecRestoreArray(X_local_ghost_vec, &X_local_ghost_soln);
-    VecGhostRestoreLocalForm(X_global_vec, &X_local_ghost_vec);
-
+    double vol;
+    Eigen::Matrix3d M2;
+    computeMomentsOfStructure(vol, X0, M2);
+    X0 /= vol;
     return;
 } // computeCOMOfStructure
 
 void
 IBFEDirectForcingKinematics::computeMOIOfStructure(Eigen::Matrix3d& I, const Eigen::Vector3d& X0)
+{
+    double vol;
+    Eigen::Vector3d M1;
+    Eigen::Matrix3d M2;
+    computeMomentsOfStructure(vol, M1, M2);
+    I = get_inertia_tensor(vol, M1, M2, X0);
+    return;
+} // computeMOIOfStructure
+
+void
+IBFEDirectForcingKinematics::computeCOMAndMOIOfStructure(Eigen::Vector3d& X0, Eigen::Matrix3d& I)
+{
+    double vol;
+    Eigen::Vector3d M1;
+    Eigen::Matrix3d M2;
+    computeMomentsOfStructure(vol, M1, M2);
+    X0 = M1 / vol;
+    I = get_inertia_tensor(vol, M1, M2, X0);
+    return;
+} // computeCOMAndMOIOfStructure
+
+void
+IBFEDirectForcingKinematics::computeMomentsOfStructure(double& vol, Eigen::Vector3d& M1, Eigen::Matrix3d& M2)
 {
     // Get the FE data.
     EquationSystems* equation_systems = d_ibfe_method_ops->getFEDataManager(d_part)->getEquationSystems();
@@ -643,10 +621,14 @@ IBFEDirectForcingKinematics::computeMOIOfStructure(Eigen::Matrix3d& I, const Eig
     ierr = VecGetArray(X_local_ghost_vec, &X_local_ghost_soln);
     IBTK_CHKERRQ(ierr);
 
-    // Loop over the local elements to compute the local integrals.
+    // Loop over the local elements once to compute the local integrals of 1,
+    // X, and X X^T, which are packed into a single array so that they can be
+    // summed with one reduction.
+    static const int n_moments = 1 + NDIM + NDIM * NDIM;
+    std::array<double, n_moments> moments;
+    moments.fill(0.0);
     boost::multi_array<double, 2> X_node;
     double X_qp[NDIM];
-    I.setZero();
     const MeshBase::const_element_iterator el_begin = mesh.active_local_elements_begin();
     const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
     for (MeshBase::const_element_iterator el_it = el_begin; el_it != el_end; ++el_it)
@@ -663,30 +645,30 @@ IBFEDirectForcingKinematics::computeMOIOfStructure(Eigen::Matrix3d& I, const Eig
         for (unsigned int qp = 0; qp < n_qp; ++qp)
         {
             interpolate(X_qp, qp, X_node, phi);
-#if (NDIM == 2)
-            I(0, 0) += std::pow(X_qp[1] - X0[1], 2) * JxW[qp];
-            I(0, 1) += -(X_qp[0] - X0[0]) * (X_qp[1] - X0[1]) * JxW[qp];
-            I(1, 1) += std::pow(X_qp[0] - X0[0], 2) * JxW[qp];
-            I(2, 2) += (std::pow(X_qp[0] - X0[0], 2) + std::pow(X_qp[1] - X0[1], 2)) * JxW[qp];
-#endif
-
-#if (NDIM == 3)
-            I(0, 0) += (std::pow(X_qp[1] - X0[1], 2) + std::pow(X_qp[2] - X0[2], 2)) * JxW[qp];
-            I(0, 1) += -(X_qp[0] - X0[0]) * (X_qp[1] - X0[1]) * JxW[qp];
-            I(0, 2) += -(X_qp[0] - X0[0]) * (X_qp[2] - X0[2]) * JxW[qp];
-            I(1, 1) += (std::pow(X_qp[0] - X0[0], 2) + std::pow(X_qp[2] - X0[2], 2)) * JxW[qp];
-            I(1, 2) += -(X_qp[1] - X0[1]) * (X_qp[2] - X0[2]) * JxW[qp];
-            I(2, 2) += (std::pow(X_qp[0] - X0[0], 2) + std::pow(X_qp[1] - X0[1], 2)) * JxW[qp];
-
-#endif
+            moments[0] += JxW[qp];
+            for (unsigned int i = 0; i < NDIM; ++i)
+            {
+                moments[1 + i] += X_qp[i] * JxW[qp];
+                for (unsigned int j = 0; j < NDIM; ++j)
+                {
+                    moments[1 + NDIM + NDIM * i + j] += X_qp[i] * X_qp[j] * JxW[qp];
+                }
+            }
         }
     }
-    IBTK_MPI::sumReduction(&I(0, 0), 9);
+    IBTK_MPI::sumReduction(moments.data(), n_moments);
 
-    // Fill-in the symmetric part of inertia tensor.
-    I(1, 0) = I(0, 1);
-    I(2, 0) = I(0, 2);
-    I(2, 1) = I(1, 2);
+    vol = moments[0];
+    M1.setZero();
+    M2.setZero();
+    for (unsigned int i = 0; i < NDIM; ++i)
+    {
+        M1[i] = moments[1 + i];
+        for (unsigned int j = 0; j < NDIM; ++j)
+        {
+            M2(i, j) = moments[1 + NDIM + NDIM * i + j];
+        }
+    }
 
     ierr = VecRestoreArray(X_local_ghost_vec, &X_local_ghost_soln);
     IBTK_CHKERRQ(ierr);
@@ -694,7 +676,7 @@ IBFEDirectForcingKinematics::computeMOIOfStructure(Eigen::Matrix3d& I, const Eig
     IBTK_CHKERRQ(ierr);
 
     return;
-} // computeMOIOfStructure
+} // computeMomentsOfStructure
 
 void
 IBFEDirectForcingKinematics::computeImposedLagrangianForceDensity(PetscVector<double>& F_petsc,
@@ -754,20 +736,21 @@ IBFEDirectForcingKinematics::computeImposedLagrangianForceDensity(PetscVector<do
     W(1, 2) = -d_rot_vel_half[0]; //-U[3];
     W(2, 1) = d_rot_vel_half[0];  // U[3];
 #endif
-    Eigen::Vector3d R(Eigen::Vector3d::Zero());
-    Eigen::Vector3d WxR(Eigen::Vector3d::Zero());
-    for (unsigned int k = 0; k < total_local_nodes; ++k)
-    {
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            R[d] = nodal_X_values[d][k] - X_com[d];
-        }
 
-        WxR = W * R;
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            F_petsc.set(nodal_indices[d][k], d_trans_vel_half[d] + WxR[d]);
-        }
+    // Evaluate the rigid body velocity U_b = U_com + W (X - X_com) at all of the
+    // local nodes at once and insert each of its components with one call.
+    const auto num_nodes = static_cast<int>(nodal_indices[0].size());
+    Eigen::Matrix3Xd R(Eigen::Matrix3Xd::Zero(3, num_nodes));
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        R.row(d) = Eigen::Map<const Eigen::RowVectorXd>(nodal_X_values[d].data(), num_nodes).array() - X_com[d];
+    }
+    const Eigen::Matrix3Xd U_b = (W * R).colwise() + d_trans_vel_half;
+    std::vector<double> F_values(num_nodes);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        Eigen::Map<Eigen::RowVectorXd>(F_values.data(), num_nodes) = U_b.row(d);
+        F_petsc.insert(F_values, nodal_indices[d]);
     }
     F_petsc.close();
 
@@ -870,9 +853,13 @@ IBFEDirectForcingKinematics::computeMixedLagrangianForceDensity(PetscVector<doub
 #endif
         }
     }
-    IBTK_MPI::sumReduction(&F[0], 3);
-    IBTK_MPI::sumReduction(&L[0], 3);
-    vol_mesh = IBTK_MPI::sumReduction(vol_mesh);
+
+    // Sum the momenta and the volume with a single reduction.
+    std::array<double, 7> integrals = { { F[0], F[1], F[2], L[0], L[1], L[2], vol_mesh } };
+    IBTK_MPI::sumReduction(integrals.data(), static_cast<int>(integrals.size()));
+    F = Eigen::Vector3d(integrals[0], integrals[1], integrals[2]);
+    L = Eigen::Vector3d(integrals[3], integrals[4], integrals[5]);
+    vol_mesh = integrals[6];
 
     ierr = VecRestoreArray(X_local_ghost_vec, &X_local_ghost_soln);
     IBTK_CHKERRQ(ierr);
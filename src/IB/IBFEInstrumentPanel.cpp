@@ -42,7 +42,6 @@
 #include "tbox/Utilities.h"
 
 #include "libmesh/boundary_info.h"
-#include "libmesh/dense_matrix.h"
 #include "libmesh/dof_map.h"
 #include "libmesh/elem.h"
 #include "libmesh/enum_fe_family.h"
@@ -106,83 +105,29 @@ namespace IBAMR
 
 namespace
 {
-double
-linear_interp(const Vector& X,
-              const hier::Index<NDIM>& i_cell,
-              const Vector& X_cell,
-              const CellData<NDIM, double>& v,
-              const hier::Index<NDIM>& /*patch_lower*/,
-              const hier::Index<NDIM>& /*patch_upper*/,
-              const double* const /*x_lower*/,
-              const double* const /*x_upper*/,
-              const double* const dx)
-{
-    std::array<bool, NDIM> is_lower;
-    for (unsigned int d = 0; d < NDIM; ++d)
-    {
-        is_lower[d] = X[d] < X_cell[d];
-    }
-    double U = 0.0;
-#if (NDIM == 3)
-    for (int i_shift2 = (is_lower[2] ? -1 : 0); i_shift2 <= (is_lower[2] ? 0 : 1); ++i_shift2)
-    {
-#endif
-        for (int i_shift1 = (is_lower[1] ? -1 : 0); i_shift1 <= (is_lower[1] ? 0 : 1); ++i_shift1)
-        {
-            for (int i_shift0 = (is_lower[0] ? -1 : 0); i_shift0 <= (is_lower[0] ? 0 : 1); ++i_shift0)
-            {
-                const Vector X_center(X_cell[0] + static_cast<double>(i_shift0) * dx[0],
-                                      X_cell[1] + static_cast<double>(i_shift1) * dx[1]
-#if (NDIM == 3)
-                                      ,
-                                      X_cell[2] + static_cast<double>(i_shift2) * dx[2]
-#endif
-                );
-                const double wgt =
-                    (((X[0] < X_center[0] ? X[0] - (X_center[0] - dx[0]) : (X_center[0] + dx[0]) - X[0]) / dx[0]) *
-                     ((X[1] < X_center[1] ? X[1] - (X_center[1] - dx[1]) : (X_center[1] + dx[1]) - X[1]) / dx[1])
-#if (NDIM == 3)
-                     * ((X[2] < X_center[2] ? X[2] - (X_center[2] - dx[2]) : (X_center[2] + dx[2]) - X[2]) / dx[2])
-#endif
-                    );
-                const hier::Index<NDIM> i(i_shift0 + i_cell(0),
-                                          i_shift1 + i_cell(1)
-#if (NDIM == 3)
-                                              ,
-                                          i_shift2 + i_cell(2)
-#endif
-                );
-                const CellIndex<NDIM> i_c(i);
-                U += v(i_c) * wgt;
-            }
-        }
-#if (NDIM == 3)
-    }
-#endif
-    return U;
-}
-
-template <int N>
-Eigen::Matrix<double, N, 1>
-linear_interp(const Vector& X,
-              const hier::Index<NDIM>& i_cell,
-              const Vector& X_cell,
-              const CellData<NDIM, double>& v,
-              const hier::Index<NDIM>& /*patch_lower*/,
-              const hier::Index<NDIM>& /*patch_upper*/,
-              const double* const /*x_lower*/,
-              const double* const /*x_upper*/,
-              const double* const dx)
+// Number of cells in a cell-centered (or, for each component, side-centered)
+// linear interpolation stencil.
+static const int STENCIL_SIZE = 1 << NDIM;
+
+/*!
+ * Append the indices and weights of the cell-centered bilinear (or trilinear)
+ * interpolation stencil of the point X, which lies in cell i_cell with center
+ * X_cell. The weights are multiplied by scale.
+ */
+void
+append_cc_stencil(const Vector& X,
+                  const hier::Index<NDIM>& i_cell,
+                  const Vector& X_cell,
+                  const double* const dx,
+                  const double scale,
+                  std::vector<CellIndex<NDIM> >& idxs,
+                  std::vector<double>& wgts)
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT(v.getDepth() == N);
-#endif
     std::array<bool, NDIM> is_lower;
     for (unsigned int d = 0; d < NDIM; ++d)
     {
         is_lower[d] = X[d] < X_cell[d];
     }
-    Eigen::Matrix<double, N, 1> U(Eigen::Matrix<double, N, 1>::Zero());
 #if (NDIM == 3)
     for (int i_shift2 = (is_lower[2] ? -1 : 0); i_shift2 <= (is_lower[2] ? 0 : 1); ++i_shift2)
     {
@@ -212,34 +157,31 @@ linear_interp(const Vector& X,
                                           i_shift2 + i_cell(2)
 #endif
                 );
-                const CellIndex<NDIM> i_c(i);
-                for (int k = 0; k < N; ++k)
-                {
-                    U[k] += v(i_c, k) * wgt;
-                }
+                idxs.emplace_back(i);
+                wgts.push_back(scale * wgt);
             }
         }
 #if (NDIM == 3)
     }
 #endif
-    return U;
+    return;
 }
 
-Vector
-linear_interp(const Vector& X,
-              const hier::Index<NDIM>& i_cell,
-              const Vector& X_cell,
-              const SideData<NDIM, double>& v,
-              const hier::Index<NDIM>& /*patch_lower*/,
-              const hier::Index<NDIM>& /*patch_upper*/,
-              const double* const /*x_lower*/,
-              const double* const /*x_upper*/,
-              const double* const dx)
+/*!
+ * Append the indices and weights of the side-centered interpolation stencils
+ * of the components of a vector field at the point X, which lies in cell
+ * i_cell with center X_cell. The weights of the stencil of component axis are
+ * multiplied by scale[axis].
+ */
+void
+append_sc_stencil(const Vector& X,
+                  const hier::Index<NDIM>& i_cell,
+                  const Vector& X_cell,
+                  const double* const dx,
+                  const Vector& scale,
+                  std::vector<SideIndex<NDIM> >& idxs,
+                  std::vector<double>& wgts)
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT(v.getDepth() == 1);
-#endif
-    Vector U(Vector::Zero());
     for (unsigned int axis = 0; axis < NDIM; ++axis)
     {
         std::array<bool, NDIM> is_lower;
@@ -283,15 +225,38 @@ linear_interp(const Vector& X,
                                               i_shift2 + i_cell(2)
 #endif
                     );
-                    const SideIndex<NDIM> i_s(i, axis, SideIndex<NDIM>::Lower);
-                    U[axis] += v(i_s) * wgt;
+                    idxs.emplace_back(i, axis, SideIndex<NDIM>::Lower);
+                    wgts.push_back(scale[axis] * wgt);
                 }
             }
 #if (NDIM == 3)
         }
 #endif
     }
-    return U;
+    return;
+}
+
+/*!
+ * Evaluate a vector-valued finite element field at the quadrature points of an
+ * element, i.e., compute U_qp = U_node * phi_mat with phi_mat(nn, qp) =
+ * phi[nn][qp], in which the columns of U_node are the nodal values of the
+ * field.
+ */
+void
+evaluate_at_qps(Eigen::Matrix<double, NDIM, Eigen::Dynamic>& U_qp,
+                const Eigen::Matrix<double, NDIM, Eigen::Dynamic>& U_node,
+                Eigen::MatrixXd& phi_mat,
+                const std::vector<std::vector<Real> >& phi)
+{
+    const int n_nodes = static_cast<int>(phi.size());
+    const int n_qp = n_nodes > 0 ? static_cast<int>(phi[0].size()) : 0;
+    phi_mat.resize(n_nodes, n_qp);
+    for (int nn = 0; nn < n_nodes; ++nn)
+    {
+        for (int qp = 0; qp < n_qp; ++qp) phi_mat(nn, qp) = phi[nn][qp];
+    }
+    U_qp.noalias() = U_node * phi_mat;
+    return;
 }
 } // namespace
 
@@ -568,6 +533,58 @@ IBFEInstrumentPanel::initializeHierarchyDependentData(IBFEMethod* ib_method_ops,
         }
     }
 
+    // the quadrature points and their interpolation stencils only need to be
+    // recomputed if the patch hierarchy or the quadrature rules have changed,
+    // or if a meter mesh has moved by more than d_stencil_update_tol times the
+    // finest grid spacing since they were last computed.
+    std::vector<std::vector<double> > meter_displacements(d_num_meters);
+    for (unsigned int jj = 0; jj < d_num_meters; ++jj)
+    {
+        const LinearImplicitSystem& displacement_sys =
+            d_meter_systems[jj]->get_system<LinearImplicitSystem>(IBFEMethod::COORD_MAPPING_SYSTEM_NAME);
+        const NumericVector<double>& displacement_coords = displacement_sys.get_vector("serial solution");
+        meter_displacements[jj].resize(displacement_coords.size());
+        for (unsigned int k = 0; k < displacement_coords.size(); ++k)
+        {
+            meter_displacements[jj][k] = displacement_coords(k);
+        }
+    }
+    bool stencils_are_valid = d_stencil_quad_order == d_quad_order &&
+                              d_stencil_displacements.size() == d_num_meters &&
+                              static_cast<int>(d_patch_qp_stencils.size()) == finest_ln + 1;
+    for (unsigned int jj = 0; jj < d_num_meters && stencils_are_valid; ++jj)
+    {
+        stencils_are_valid = d_stencil_displacements[jj].size() == meter_displacements[jj].size();
+        for (unsigned int k = 0; k < meter_displacements[jj].size() && stencils_are_valid; ++k)
+        {
+            stencils_are_valid = std::abs(meter_displacements[jj][k] - d_stencil_displacements[jj][k]) <=
+                                 d_stencil_update_tol * h_finest;
+        }
+    }
+    for (int ln = coarsest_ln; ln <= finest_ln && stencils_are_valid; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        const BoxArray<NDIM>& level_boxes = level->getBoxes();
+        stencils_are_valid = level_boxes.size() == d_stencil_level_boxes[ln].size();
+        for (int k = 0; k < level_boxes.size() && stencils_are_valid; ++k)
+        {
+            stencils_are_valid = level_boxes[k] == d_stencil_level_boxes[ln][k];
+        }
+        int num_local_patches = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p && stencils_are_valid; p++, ++num_local_patches)
+        {
+            const auto it = d_patch_qp_stencils[ln].find(p());
+            stencils_are_valid =
+                it != d_patch_qp_stencils[ln].end() && it->second.patch_box == level->getPatch(p())->getBox();
+        }
+        stencils_are_valid =
+            stencils_are_valid && num_local_patches == static_cast<int>(d_patch_qp_stencils[ln].size());
+    }
+    if (stencils_are_valid) return;
+    d_stencil_quad_order = d_quad_order;
+    d_stencil_displacements = std::move(meter_displacements);
+    d_stencil_level_boxes.resize(finest_ln + 1);
+
     // reset the quad point maps
     d_quad_point_map.clear();
     d_quad_point_map.resize(finest_ln + 1);
@@ -576,6 +593,7 @@ IBFEInstrumentPanel::initializeHierarchyDependentData(IBFEMethod* ib_method_ops,
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        d_stencil_level_boxes[ln] = level->getBoxes();
         const IntVector<NDIM>& ratio = level->getRatio();
         const Box<NDIM> domain_box_level = Box<NDIM>::refine(domain_box, ratio);
         const hier::Index<NDIM>& domain_box_level_lower = domain_box_level.lower();
@@ -615,7 +633,8 @@ IBFEInstrumentPanel::initializeHierarchyDependentData(IBFEMethod* ib_method_ops,
             const std::vector<std::vector<Real> >& phi = fe_elem->get_phi();
             const std::vector<libMesh::Point>& qp_points = fe_elem->get_xyz();
             std::vector<dof_id_type> dof_indices;
-            DenseMatrix<double> disp_coords;
+            Eigen::Matrix<double, NDIM, Eigen::Dynamic> disp_coords, disp_qp;
+            Eigen::MatrixXd phi_mat;
 
             // loop over ALL elements in meter mesh, not just the local ones on this process!!
             MeshBase::const_element_iterator el = d_meter_meshes[jj]->active_elements_begin();
@@ -635,6 +654,7 @@ IBFEInstrumentPanel::initializeHierarchyDependentData(IBFEMethod* ib_method_ops,
                         disp_coords(d, nn) = displacement_coords(dof_indices[nn]);
                     }
                 }
+                evaluate_at_qps(disp_qp, disp_coords, phi_mat, phi);
 
                 // compute normal vector to element
                 const libMesh::Point tau1 = *elem->node_ptr(1) - *elem->node_ptr(0);
@@ -650,13 +670,8 @@ IBFEInstrumentPanel::initializeHierarchyDependentData(IBFEMethod* ib_method_ops,
                     Vector qp_temp;
                     for (unsigned int d = 0; d < NDIM; ++d)
                     {
-                        double disp_comp = 0.0;
-                        for (unsigned int nn = 0; nn < phi.size(); ++nn)
-                        {
-                            disp_comp += disp_coords(d, nn) * phi[nn][qp];
-                        }
                         // calculating physical location of the quadrature point
-                        qp_temp[d] = qp_points[qp](d) + disp_comp;
+                        qp_temp[d] = qp_points[qp](d) + disp_qp(d, qp);
                     }
 
                     const hier::Index<NDIM> i = IndexUtilities::getCellIndex(&qp_temp[0],
@@ -687,6 +702,64 @@ IBFEInstrumentPanel::initializeHierarchyDependentData(IBFEMethod* ib_method_ops,
             }
         }
     }
+
+    // compute the interpolation stencils of the quadrature points that lie in
+    // each local patch. the weights are scaled by the quadrature weights (and,
+    // for the flux, by the normal vectors) so that readInstrumentData() only
+    // needs to accumulate weighted sums of the Eulerian data.
+    d_patch_qp_stencils.clear();
+    d_patch_qp_stencils.resize(finest_ln + 1);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            const hier::Index<NDIM>& patch_lower = patch_box.lower();
+            const hier::Index<NDIM>& patch_upper = patch_box.upper();
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const x_lower = pgeom->getXLower();
+            const double* const dx = pgeom->getDx();
+
+            PatchQuadPointStencils& stencils = d_patch_qp_stencils[ln][p()];
+            stencils.patch_box = patch_box;
+
+            // the quadrature point map is ordered by the first index, so only
+            // the quadrature points in this range can lie in the patch.
+            const QuadPointMap& quad_point_map = d_quad_point_map[ln];
+            const auto it_begin = quad_point_map.lower_bound(patch_lower);
+            const auto it_end = quad_point_map.upper_bound(patch_upper);
+            for (auto it = it_begin; it != it_end; ++it)
+            {
+                const hier::Index<NDIM>& i = it->first;
+                if (!patch_box.contains(i)) continue;
+                const Vector X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
+                                    x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
+#if (NDIM == 3)
+                                        ,
+                                    x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
+#endif
+                );
+                const QuadPointStruct& q = it->second;
+                stencils.meter_num.push_back(q.meter_num);
+                stencils.JxW.push_back(q.JxW);
+                stencils.normal.push_back(q.normal);
+                append_cc_stencil(q.qp_xyz_current, i, X_cell, dx, q.JxW, stencils.cc_idx, stencils.cc_wgt);
+                append_sc_stencil(q.qp_xyz_current,
+                                  i,
+                                  X_cell,
+                                  dx,
+                                  q.JxW * q.normal,
+                                  stencils.sc_idx,
+                                  stencils.sc_flux_wgt);
+            }
+#if !defined(NDEBUG)
+            TBOX_ASSERT(stencils.cc_idx.size() == STENCIL_SIZE * stencils.meter_num.size());
+            TBOX_ASSERT(stencils.sc_idx.size() == NDIM * STENCIL_SIZE * stencils.meter_num.size());
+#endif
+        }
+    }
 }
 
 void
@@ -710,7 +783,8 @@ IBFEInstrumentPanel::readInstrumentData(const int U_data_idx,
     int count_qp_1 = 0;
     int count_qp_2 = 0;
 
-    // compute flow and mean pressure on mesh meters
+    // compute flow and mean pressure on mesh meters using the interpolation
+    // stencils computed by initializeHierarchyDependentData().
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         count_qp_1 += d_quad_point_map[ln].size();
@@ -718,75 +792,65 @@ IBFEInstrumentPanel::readInstrumentData(const int U_data_idx,
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            const Box<NDIM>& patch_box = patch->getBox();
-            const hier::Index<NDIM>& patch_lower = patch_box.lower();
-            const hier::Index<NDIM>& patch_upper = patch_box.upper();
-
-            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-            const double* const x_lower = pgeom->getXLower();
-            const double* const x_upper = pgeom->getXUpper();
-            const double* const dx = pgeom->getDx();
+            const auto stencils_it = d_patch_qp_stencils[ln].find(p());
+            if (stencils_it == d_patch_qp_stencils[ln].end()) continue;
+            const PatchQuadPointStencils& stencils = stencils_it->second;
+            const int num_qps = static_cast<int>(stencils.meter_num.size());
+            if (num_qps == 0) continue;
 
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<CellData<NDIM, double> > U_cc_data = patch->getPatchData(U_data_idx);
             Pointer<SideData<NDIM, double> > U_sc_data = patch->getPatchData(U_data_idx);
             Pointer<CellData<NDIM, double> > P_cc_data = patch->getPatchData(P_data_idx);
 
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            if (U_cc_data)
             {
-                const hier::Index<NDIM>& i = b();
-                std::pair<QuadPointMap::const_iterator, QuadPointMap::const_iterator> qp_range =
-                    d_quad_point_map[ln].equal_range(i);
-                if (qp_range.first != qp_range.second)
-                {
-                    const Vector X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                        x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
-#if (NDIM == 3)
-                                            ,
-                                        x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
+#if !defined(NDEBUG)
+                TBOX_ASSERT(U_cc_data->getDepth() == NDIM);
 #endif
-                    );
-                    if (U_cc_data)
+                for (int qp = 0; qp < num_qps; ++qp)
+                {
+                    const Vector& normal = stencils.normal[qp];
+                    double flux = 0.0;
+                    for (int k = qp * STENCIL_SIZE; k < (qp + 1) * STENCIL_SIZE; ++k)
                     {
-                        for (auto it = qp_range.first; it != qp_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const double& JxW = it->second.JxW;
-                            const Vector& X = it->second.qp_xyz_current;
-                            const Vector& normal = it->second.normal;
-                            const Vector U = linear_interp<NDIM>(
-                                X, i, X_cell, *U_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += (U.dot(normal)) * JxW;
-                        }
+                        const CellIndex<NDIM>& i_c = stencils.cc_idx[k];
+                        double U_n = 0.0;
+                        for (unsigned int d = 0; d < NDIM; ++d) U_n += (*U_cc_data)(i_c, d) * normal[d];
+                        flux += stencils.cc_wgt[k] * U_n;
                     }
-                    if (U_sc_data)
+                    d_flow_values[stencils.meter_num[qp]] += flux;
+                }
+            }
+            if (U_sc_data)
+            {
+#if !defined(NDEBUG)
+                TBOX_ASSERT(U_sc_data->getDepth() == 1);
+#endif
+                for (int qp = 0; qp < num_qps; ++qp)
+                {
+                    double flux = 0.0;
+                    for (int k = qp * NDIM * STENCIL_SIZE; k < (qp + 1) * NDIM * STENCIL_SIZE; ++k)
                     {
-                        for (auto it = qp_range.first; it != qp_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const double& JxW = it->second.JxW;
-                            const Vector& X = it->second.qp_xyz_current;
-                            const Vector& normal = it->second.normal;
-                            const Vector U =
-                                linear_interp(X, i, X_cell, *U_sc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += (U.dot(normal)) * JxW;
-                        }
+                        flux += stencils.sc_flux_wgt[k] * (*U_sc_data)(stencils.sc_idx[k]);
                     }
-                    if (P_cc_data)
+                    d_flow_values[stencils.meter_num[qp]] += flux;
+                }
+            }
+            if (P_cc_data)
+            {
+                for (int qp = 0; qp < num_qps; ++qp)
+                {
+                    double P_JxW = 0.0;
+                    for (int k = qp * STENCIL_SIZE; k < (qp + 1) * STENCIL_SIZE; ++k)
                     {
-                        for (auto it = qp_range.first; it != qp_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const double& JxW = it->second.JxW;
-                            const Vector& X = it->second.qp_xyz_current;
-                            double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_mean_pressure_values[meter_num] += P * JxW;
-                            A[meter_num] += JxW;
-                            count_qp_2 += 1;
-                        }
+                        P_JxW += stencils.cc_wgt[k] * (*P_cc_data)(stencils.cc_idx[k]);
                     }
+                    const int meter_num = stencils.meter_num[qp];
+                    d_mean_pressure_values[meter_num] += P_JxW;
+                    A[meter_num] += stencils.JxW[qp];
                 }
+                count_qp_2 += num_qps;
             }
         }
     }
@@ -835,7 +899,8 @@ IBFEInstrumentPanel::readInstrumentData(const int U_data_idx,
         const std::vector<std::vector<Real> >& phi = fe_elem->get_phi();
         const std::vector<libMesh::Point>& qp_points = fe_elem->get_xyz();
         std::vector<dof_id_type> dof_indices;
-        DenseMatrix<double> vel_coords;
+        Eigen::Matrix<double, NDIM, Eigen::Dynamic> vel_coords, vel_qp;
+        Eigen::MatrixXd phi_mat;
 
         // loop over elements again to compute mass flux and mean pressure
         double flux_correction = 0.0;
@@ -857,24 +922,19 @@ IBFEInstrumentPanel::readInstrumentData(const int U_data_idx,
                 }
             }
 
+            evaluate_at_qps(vel_qp, vel_coords, phi_mat, phi);
+
             // compute normal vector to element
             const libMesh::Point tau1 = *elem->node_ptr(1) - *elem->node_ptr(0);
             const libMesh::Point tau2 = *elem->node_ptr(2) - *elem->node_ptr(1);
-            const libMesh::Point normal = (tau1.cross(tau2)).unit();
+            const libMesh::Point normal_temp = (tau1.cross(tau2)).unit();
+            Vector normal;
+            for (unsigned int d = 0; d < NDIM; ++d) normal[d] = normal_temp(d);
 
             // loop over quadrature points
-            double vel_comp;
             for (unsigned int qp = 0; qp < qp_points.size(); ++qp)
             {
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    vel_comp = 0.0;
-                    for (unsigned int nn = 0; nn < phi.size(); ++nn)
-                    {
-                        vel_comp += vel_coords(d, nn) * phi[nn][qp];
-                    }
-                    flux_correction += vel_comp * normal(d) * JxW[qp];
-                }
+                flux_correction += normal.dot(vel_qp.col(qp)) * JxW[qp];
             }
         }
 
@@ -899,6 +959,7 @@ IBFEInstrumentPanel::getFromInput(Pointer<Database> db)
     d_use_adaptive_quadrature = db->getBoolWithDefault("meters_adaptive_quadrature", false);
     d_quad_type = Utility::string_to_enum<QuadratureType>(db->getStringWithDefault("meters_quad_type", "QGAUSS"));
     d_input_quad_order = Utility::string_to_enum<Order>(db->getStringWithDefault("meters_quad_order", "FORTIETH"));
+    d_stencil_update_tol = db->getDoubleWithDefault("meters_stencil_update_tol", d_stencil_update_tol);
     if (d_use_adaptive_quadrature && d_quad_type != libMesh::QGRID)
     {
         TBOX_ERROR("IBFEInstrumentPanel::getFromInput :"
@@ -20,6 +20,7 @@
 #include "ibamr/ibamr_enums.h"
 #include "ibamr/ibamr_utilities.h"
 
+#include "ibtk/BoxGhostingFunctor.h"
 #include "ibtk/BoxPartitioner.h"
 #include "ibtk/CartSideDoubleRT0Refine.h"
 #include "ibtk/FEDataInterpolation.h"
@@ -35,13 +36,17 @@
 #include "ibtk/QuadratureCache.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/SAMRAIDataCache.h"
+#include "ibtk/SpaceFillingCurveLoadBalancer.h"
+#include "ibtk/TelemetryManager.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/libmesh_utilities.h"
+#include "ibtk/profiling_annotations.h"
 
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
 #include "BergerRigoutsos.h"
 #include "Box.h"
+#include "BoxList.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellIndex.h"
@@ -346,11 +351,21 @@ build_ib_ghosted_system_data(std::vector<SystemData>& ghosted_system_data,
         const std::string& system_name = system_data.system_name;
         const System& system = equation_systems->get_system(system_name);
         NumericVector<double>* original_system_vec = system_data.system_vec;
-        if (!original_system_vec) original_system_vec = system.current_local_solution.get();
-        ib_ghost_system_vecs.emplace_back(fe_data_manager->buildIBGhostedVector(system_name));
-        copy_and_synch(*original_system_vec, *ib_ghost_system_vecs.back(), /*close_v_in*/ false);
+        NumericVector<double>* ghosted_system_vec = nullptr;
+        if (!original_system_vec || original_system_vec == system.current_local_solution.get())
+        {
+            // The same systems are usually used by several force functions, so
+            // share a single ghosted copy of the current solution.
+            ghosted_system_vec = &fe_data_manager->getSharedIBGhostedVector(system_name, "current_local_solution");
+        }
+        else
+        {
+            ib_ghost_system_vecs.emplace_back(fe_data_manager->buildIBGhostedVector(system_name));
+            copy_and_synch(*original_system_vec, *ib_ghost_system_vecs.back(), /*close_v_in*/ false);
+            ghosted_system_vec = ib_ghost_system_vecs.back().get();
+        }
         ghosted_system_data.emplace_back(
-            SystemData(system_name, system_data.vars, system_data.grad_vars, ib_ghost_system_vecs.back().get()));
+            SystemData(system_name, system_data.vars, system_data.grad_vars, ghosted_system_vec));
     }
     return;
 }
@@ -386,6 +401,17 @@ IBFEMethod::IBFEMethod(const std::string& object_name,
     return;
 } // IBFEMethod
 
+IBFEMethod::~IBFEMethod()
+{
+    // The meshes outlive this object, so they must not keep references to
+    // its ghosting functors.
+    for (unsigned int part = 0; part < d_ghosting_functors.size(); ++part)
+    {
+        if (d_ghosting_functors[part]) d_meshes[part]->remove_ghosting_functor(*d_ghosting_functors[part]);
+    }
+    return;
+} // ~IBFEMethod
+
 FEDataManager*
 IBFEMethod::getFEDataManager(const unsigned int part) const
 {
@@ -480,6 +506,18 @@ IBFEMethod::getMinimumGhostCellWidth() const
     return d_ghosts;
 } // getMinimumGhostCellWidth
 
+const IntVector<NDIM>&
+IBFEMethod::getMinimumInterpolationGhostCellWidth() const
+{
+    return d_interp_ghosts;
+} // getMinimumInterpolationGhostCellWidth
+
+const IntVector<NDIM>&
+IBFEMethod::getMinimumSpreadingGhostCellWidth() const
+{
+    return d_spread_ghosts;
+} // getMinimumSpreadingGhostCellWidth
+
 void
 IBFEMethod::setupTagBuffer(Array<int>& tag_buffer, Pointer<GriddingAlgorithm<NDIM> > gridding_alg) const
 {
@@ -524,6 +562,58 @@ IBFEMethod::getMaxPointDisplacement() const
                                   *d_hierarchy->getPatchLevel(getFinestPatchLevelNumber())));
 } // getMaxPointDisplacement
 
+bool
+IBFEMethod::areStructuresWithinRefinedRegions(const int num_margin_cells) const
+{
+    // Compute the bounding boxes of the parts. The lower bounds are stored
+    // negated so that a single max reduction determines all of the bounds.
+    const unsigned int n_parts = static_cast<unsigned int>(d_meshes.size());
+    std::vector<double> bounds(2 * NDIM * n_parts, -std::numeric_limits<double>::max());
+    for (unsigned int part = 0; part < n_parts; ++part)
+    {
+        if (!d_part_is_active[part]) continue;
+        EquationSystems& equation_systems = *d_fe_data[part]->getEquationSystems();
+        const MeshBase& mesh = equation_systems.get_mesh();
+        const unsigned int X_sys_num = equation_systems.get_system(COORDS_SYSTEM_NAME).number();
+        PetscVector<double>& X_vec = d_X_vecs->get("solution", part);
+        double* const part_bounds = &bounds[2 * NDIM * part];
+        for (auto it = mesh.local_nodes_begin(); it != mesh.local_nodes_end(); ++it)
+        {
+            const Node* const n = *it;
+            if (!n->n_vars(X_sys_num)) continue;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                const double X = X_vec(n->dof_number(X_sys_num, d, 0));
+                part_bounds[d] = std::max(part_bounds[d], -X);
+                part_bounds[NDIM + d] = std::max(part_bounds[NDIM + d], X);
+            }
+        }
+    }
+    IBTK_MPI::maxReduction(bounds.data(), static_cast<int>(bounds.size()));
+
+    // Check that the bounding boxes, grown by the margin, are covered by the
+    // patch levels of the parts.
+    for (unsigned int part = 0; part < n_parts; ++part)
+    {
+        if (!d_part_is_active[part]) continue;
+        const int ln = d_active_fe_data_managers[part]->getFinestPatchLevelNumber();
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        IBTK::Point X_lower, X_upper;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            X_lower[d] = -bounds[2 * NDIM * part + d];
+            X_upper[d] = bounds[2 * NDIM * part + NDIM + d];
+        }
+        Box<NDIM> part_box(IndexUtilities::getCellIndex(X_lower, level->getGridGeometry(), level->getRatio()),
+                           IndexUtilities::getCellIndex(X_upper, level->getGridGeometry(), level->getRatio()));
+        part_box.grow(IntVector<NDIM>(num_margin_cells));
+        BoxList<NDIM> uncovered_boxes(part_box);
+        uncovered_boxes.removeIntersections(BoxList<NDIM>(level->getBoxes()));
+        if (!uncovered_boxes.isEmpty()) return false;
+    }
+    return true;
+} // areStructuresWithinRefinedRegions
+
 void
 IBFEMethod::inactivateLagrangianStructure(int structure_number, int /*level_number*/)
 {
@@ -591,20 +681,23 @@ IBFEMethod::preprocessIntegrateData(double current_time, double new_time, int nu
         }
     }
 
-    // Initialize variables.
-    d_X_vecs->copy("solution", { "current", "new", "half" });
-    d_U_vecs->copy("solution", { "current", "new", "half" });
+    // Initialize variables. The ghost updates of all of the copies are done
+    // at the same time.
+    FEVectorPipeline pipeline;
+    d_X_vecs->copy("solution", { "current", "new", "half" }, pipeline);
+    d_U_vecs->copy("solution", { "current", "new", "half" }, pipeline);
     switch (d_ib_solver->getTimeSteppingType())
     {
     case MIDPOINT_RULE:
-        d_F_vecs->copy("solution", { "current", "half" });
-        if (d_P_vecs) d_P_vecs->copy("solution", { "current", "half" });
+        d_F_vecs->copy("solution", { "current", "half" }, pipeline);
+        if (d_P_vecs) d_P_vecs->copy("solution", { "current", "half" }, pipeline);
         break;
     default:
-        d_F_vecs->copy("solution", { "current", "new", "half" });
-        if (d_P_vecs) d_P_vecs->copy("solution", { "current", "new", "half" });
+        d_F_vecs->copy("solution", { "current", "new", "half" }, pipeline);
+        if (d_P_vecs) d_P_vecs->copy("solution", { "current", "new", "half" }, pipeline);
     }
-    if (d_Q_vecs) d_Q_vecs->copy("solution", { "current", "half" });
+    if (d_Q_vecs) d_Q_vecs->copy("solution", { "current", "half" }, pipeline);
+    pipeline.execute();
 
     // Update the mask data.
     getVelocityHierarchyDataOps()->copyData(mask_new_idx, mask_current_idx);
@@ -623,13 +716,14 @@ IBFEMethod::postprocessIntegrateData(double current_time, double new_time, int n
                                                           d_F_vecs->get(forcing_data_time_str) };
     if (d_P_vecs) vecs.push_back(d_P_vecs->get(forcing_data_time_str));
     if (d_Q_vecs) vecs.push_back(d_Q_vecs->get("half"));
-    batch_vec_ghost_update(vecs, INSERT_VALUES, SCATTER_FORWARD);
-
-    d_X_vecs->copy("new", { "solution", "current" });
-    d_U_vecs->copy("new", { "solution", "current" });
-    d_F_vecs->copy(forcing_data_time_str, { "solution", "current" });
-    if (d_P_vecs) d_P_vecs->copy(forcing_data_time_str, { "solution", "current" });
-    if (d_Q_vecs) d_Q_vecs->copy("half", { "solution", "current" });
+    FEVectorPipeline pipeline;
+    for (const auto& part_vecs : vecs) pipeline.ghostUpdate(part_vecs);
+    d_X_vecs->copy("new", { "solution", "current" }, pipeline);
+    d_U_vecs->copy("new", { "solution", "current" }, pipeline);
+    d_F_vecs->copy(forcing_data_time_str, { "solution", "current" }, pipeline);
+    if (d_P_vecs) d_P_vecs->copy(forcing_data_time_str, { "solution", "current" }, pipeline);
+    if (d_Q_vecs) d_Q_vecs->copy("half", { "solution", "current" }, pipeline);
+    pipeline.execute();
 
     // Update direct forcing data.
     for (unsigned part = 0; part < d_meshes.size(); ++part)
@@ -645,12 +739,32 @@ IBFEMethod::postprocessIntegrateData(double current_time, double new_time, int n
     return;
 } // postprocessIntegrateData
 
+void
+IBFEMethod::saveRollbackState(const int slot)
+{
+    const std::string rollback_vec_name = "rollback_" + std::to_string(slot);
+    d_X_vecs->copy("solution", { rollback_vec_name });
+    d_U_vecs->copy("solution", { rollback_vec_name });
+    return;
+} // saveRollbackState
+
+void
+IBFEMethod::restoreRollbackState(const int slot)
+{
+    const std::string rollback_vec_name = "rollback_" + std::to_string(slot);
+    d_X_vecs->copy(rollback_vec_name, { "solution", "current" });
+    d_U_vecs->copy(rollback_vec_name, { "solution", "current" });
+    return;
+} // restoreRollbackState
+
 void
 IBFEMethod::interpolateVelocity(const int u_data_idx,
                                 const std::vector<Pointer<CoarsenSchedule<NDIM> > >& u_synch_scheds,
                                 const std::vector<Pointer<RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
                                 const double data_time)
 {
+    IBTK_PROFILING_REGION("IBFEMethod::interpolateVelocity");
+    TelemetryManager::ScopedPhase interp_phase("interp");
     IBAMR_TIMER_START(t_interpolate_velocity);
     const std::string data_time_str = get_data_time_str(data_time, d_current_time, d_new_time);
 
@@ -663,6 +777,15 @@ IBFEMethod::interpolateVelocity(const int u_data_idx,
         }
     }
 
+    // Start communicating the structure positions: the Eulerian ghost data
+    // fill below does not depend on them, so the two can overlap.
+    std::vector<PetscVector<double>*> U_vecs = d_U_vecs->get(data_time_str);
+    std::vector<PetscVector<double>*> X_vecs = d_X_vecs->get(data_time_str);
+    std::vector<PetscVector<double>*> U_rhs_vecs = d_U_IB_vecs->getIBGhosted("tmp");
+    std::vector<PetscVector<double>*> X_IB_ghost_vecs = d_X_IB_vecs->getIBGhosted("tmp");
+    batch_vec_copy(X_vecs, X_IB_ghost_vecs);
+    batch_vec_ghost_update_begin(X_IB_ghost_vecs, INSERT_VALUES, SCATTER_FORWARD);
+
     if (d_use_scratch_hierarchy)
     {
         for (int ln = 0; ln <= getFinestPatchLevelNumber(); ++ln)
@@ -682,12 +805,7 @@ IBFEMethod::interpolateVelocity(const int u_data_idx,
         }
     }
 
-    std::vector<PetscVector<double>*> U_vecs = d_U_vecs->get(data_time_str);
-    std::vector<PetscVector<double>*> X_vecs = d_X_vecs->get(data_time_str);
-    std::vector<PetscVector<double>*> U_rhs_vecs = d_U_IB_vecs->getIBGhosted("tmp");
-    std::vector<PetscVector<double>*> X_IB_ghost_vecs = d_X_IB_vecs->getIBGhosted("tmp");
-    batch_vec_copy(X_vecs, X_IB_ghost_vecs);
-    batch_vec_ghost_update(X_IB_ghost_vecs, INSERT_VALUES, SCATTER_FORWARD);
+    batch_vec_ghost_update_end(X_IB_ghost_vecs, INSERT_VALUES, SCATTER_FORWARD);
 
     // Build the right-hand-sides to compute the interpolated data.
     std::vector<Pointer<RefineSchedule<NDIM> > > no_fill(u_ghost_fill_scheds.size());
@@ -876,13 +994,17 @@ IBFEMethod::trapezoidalStep(const double current_time, const double new_time)
 void
 IBFEMethod::computeLagrangianForce(const double data_time)
 {
+    IBTK_PROFILING_REGION("IBFEMethod::computeLagrangianForce");
+    TelemetryManager::ScopedPhase force_phase("force");
     IBAMR_TIMER_START(t_compute_lagrangian_force);
     const std::string data_time_str = get_data_time_str(data_time, d_current_time, d_new_time);
     batch_vec_ghost_update(d_X_vecs->get(data_time_str), INSERT_VALUES, SCATTER_FORWARD);
     d_F_vecs->zero("RHS Vector");
     d_F_vecs->zero("tmp");
+    unsigned int num_local_elems = 0;
     for (unsigned part = 0; part < d_meshes.size(); ++part)
     {
+        num_local_elems += d_meshes[part]->n_active_local_elem();
         if (d_stress_normalization_part[part])
         {
             computeStressNormalization(
@@ -923,6 +1045,7 @@ IBFEMethod::computeLagrangianForce(const double data_time)
             IBTK_CHKERRQ(ierr);
         }
     }
+    TelemetryManager::getManager()->setMetric("finite_elements", num_local_elems);
     IBAMR_TIMER_STOP(t_compute_lagrangian_force);
     return;
 } // computeLagrangianForce
@@ -933,6 +1056,8 @@ IBFEMethod::spreadForce(const int f_data_idx,
                         const std::vector<Pointer<RefineSchedule<NDIM> > >& /*f_prolongation_scheds*/,
                         const double data_time)
 {
+    IBTK_PROFILING_REGION("IBFEMethod::spreadForce");
+    TelemetryManager::ScopedPhase spread_phase("spread");
     IBAMR_TIMER_START(t_spread_force);
     const std::string data_time_str = get_data_time_str(data_time, d_current_time, d_new_time);
 
@@ -941,7 +1066,7 @@ IBFEMethod::spreadForce(const int f_data_idx,
     std::vector<PetscVector<double>*> F_IB_ghost_vecs = d_F_IB_vecs->getIBGhosted("tmp");
     batch_vec_copy({ d_X_vecs->get(data_time_str), d_F_vecs->get(data_time_str) },
                    { X_IB_ghost_vecs, F_IB_ghost_vecs });
-    batch_vec_ghost_update({ X_IB_ghost_vecs, F_IB_ghost_vecs }, INSERT_VALUES, SCATTER_FORWARD);
+    batch_vec_ghost_update_begin({ X_IB_ghost_vecs, F_IB_ghost_vecs }, INSERT_VALUES, SCATTER_FORWARD);
 
     // set up a new data index for computing forces on the active hierarchy.
     Pointer<PatchHierarchy<NDIM> > hierarchy = d_use_scratch_hierarchy ? d_scratch_hierarchy : d_hierarchy;
@@ -959,6 +1084,7 @@ IBFEMethod::spreadForce(const int f_data_idx,
     f_active_data_ops->setToScalar(f_prolong_scratch_data_idx,
                                    0.0,
                                    /*interior_only*/ false);
+    batch_vec_ghost_update_end({ X_IB_ghost_vecs, F_IB_ghost_vecs }, INSERT_VALUES, SCATTER_FORWARD);
 
     // Spread interior force density values.
     for (unsigned int part = 0; part < d_meshes.size(); ++part)
@@ -990,6 +1116,17 @@ IBFEMethod::spreadForce(const int f_data_idx,
         }
     }
 
+    // If the caller accumulates the ghost data, hand over the values spread
+    // into both the patch interiors and the ghost regions. All parts live on
+    // the finest level in this case so that there is nothing to prolong.
+    if (d_defer_force_ghost_data_accumulation)
+    {
+        f_active_data_ops->resetLevels(ln, ln);
+        f_active_data_ops->add(f_data_idx, f_data_idx, f_scratch_data_idx, /*interior_only*/ false);
+        IBAMR_TIMER_STOP(t_spread_force);
+        return;
+    }
+
     // Deal with force values spread outside the physical domain. Since these
     // are spread into ghost regions that don't correspond to actual degrees
     // of freedom they are ignored by the accumulation step - we have to
@@ -1021,7 +1158,6 @@ IBFEMethod::spreadForce(const int f_data_idx,
             const IntVector<NDIM> gcw =
                 level->getPatchDescriptor()->getPatchDataFactory(f_scratch_data_idx)->getGhostCellWidth();
 
-            // TODO - SAMRAIGhostDataAccumulator has not been tested with multiple levels
             d_ghost_data_accumulator.reset(new SAMRAIGhostDataAccumulator(
                 hierarchy, f_var, gcw, getCoarsestPatchLevelNumber(), getFinestPatchLevelNumber()));
         }
@@ -1071,6 +1207,26 @@ IBFEMethod::spreadForce(const int f_data_idx,
     return;
 } // spreadForce
 
+bool
+IBFEMethod::canDeferForceGhostDataAccumulation() const
+{
+    // Deferred accumulation requires that forces are spread directly onto the
+    // finest level of the primary hierarchy.
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    return !d_use_scratch_hierarchy && getCoarsestPatchLevelNumber() == finest_ln &&
+           getFinestPatchLevelNumber() == finest_ln;
+} // canDeferForceGhostDataAccumulation
+
+void
+IBFEMethod::setDeferForceGhostDataAccumulation(const bool defer_ghost_data_accumulation)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!defer_ghost_data_accumulation || canDeferForceGhostDataAccumulation());
+#endif
+    d_defer_force_ghost_data_accumulation = defer_ghost_data_accumulation;
+    return;
+} // setDeferForceGhostDataAccumulation
+
 bool
 IBFEMethod::hasFluidSources() const
 {
@@ -1306,6 +1462,12 @@ IBFEMethod::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy,
                                                                      IntVector<NDIM>(1),
                                                                      /*register_for_restart*/ false);
 
+    // Distributed meshes need copies of the elements near the local patches
+    // before the elements can be associated with patches.
+    const bool has_distributed_mesh =
+        std::any_of(d_meshes.begin(), d_meshes.end(), [](const MeshBase* mesh) { return !mesh->is_serial(); });
+    if (has_distributed_mesh && updateMeshDistribution()) reinitializeFEData();
+
     // Initialize the FE data managers.
     reinitElementMappings();
 
@@ -1484,7 +1646,11 @@ void IBFEMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarch
 
             // At this point the primary hierarchy has been regridded but the
             // scratch hierarchy has not.
-            d_scratch_load_balancer->setWorkloadPatchDataIndex(d_lagrangian_workload_current_idx);
+            Pointer<SpaceFillingCurveLoadBalancer> sfc_load_balancer = d_scratch_load_balancer;
+            if (sfc_load_balancer)
+                sfc_load_balancer->setWorkloadPatchDataIndex(d_lagrangian_workload_current_idx);
+            else
+                d_scratch_load_balancer->setWorkloadPatchDataIndex(d_lagrangian_workload_current_idx);
 
             for (int ln = 0; ln <= d_scratch_hierarchy->getFinestLevelNumber(); ++ln)
             {
@@ -1535,29 +1701,25 @@ void IBFEMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarch
             // patch data in the scratch hierarchy. However, the data index is not
             // known until the call to interpolateVelocity or spreadForce, so
             // clear existing data but do not allocate yet.
-            d_scratch_transfer_forward_schedules.clear();
-            d_scratch_transfer_backward_schedules.clear();
+            d_scratch_transfer_schedules.clear();
         }
 
         // At this point in the code SAMRAI has already redistributed the
         // patches (usually by taking into account the number of IB points on
         // each patch). Here is the other half: if requested, we inform
         // libMesh of the updated partitioning so that libMesh Elems and Nodes
-        // are on the same processor as the relevant SAMRAI patch.
-        if (d_libmesh_partitioner_type == SAMRAI_BOX)
-        {
-            for (unsigned int part = 0; part < d_meshes.size(); ++part)
-            {
-                EquationSystems& equation_systems = *d_active_fe_data_managers[part]->getEquationSystems();
-                MeshBase& mesh = equation_systems.get_mesh();
-                BoxPartitioner partitioner(*d_hierarchy, equation_systems.get_system(COORDS_SYSTEM_NAME));
-                partitioner.repartition(mesh);
-            }
-        }
-
-        // We only need to reinitialize FE data when AMR is enabled (which is
-        // not yet implemented)
-        if (d_libmesh_use_amr) reinitializeFEData();
+        // are on the same processor as the relevant SAMRAI patch. Since
+        // interpolation and spreading are done on the active hierarchy we
+        // partition with respect to it (i.e., the scratch hierarchy, if it is
+        // in use) so that most IB ghost data are locally owned.
+        const bool meshes_changed = updateMeshDistribution();
+
+        // We need to reinitialize FE data when AMR is enabled (which is not
+        // yet implemented) or when the meshes were repartitioned or
+        // redistributed: in the second case this redistributes the degrees of
+        // freedom (and the values of the solution vectors) to match the new
+        // Elem and Node ownership.
+        if (d_libmesh_use_amr || meshes_changed) reinitializeFEData();
 
         reinitElementMappings();
 
@@ -1732,6 +1894,8 @@ IBFEMethod::doInitializeFEEquationSystems()
     d_scratch_fe_data_managers.resize(d_meshes.size());
     d_active_fe_data_managers.resize(d_meshes.size());
     IntVector<NDIM> min_ghost_width(0);
+    d_interp_ghosts = d_ghosts;
+    d_spread_ghosts = d_ghosts;
     if (!d_primary_eulerian_data_cache) d_primary_eulerian_data_cache = std::make_shared<SAMRAIDataCache>();
     d_active_eulerian_data_cache = d_primary_eulerian_data_cache;
     for (unsigned int part = 0; part < d_meshes.size(); ++part)
@@ -1768,6 +1932,10 @@ IBFEMethod::doInitializeFEEquationSystems()
 
         d_active_fe_data_managers[part]->setLoggingEnabled(d_do_log);
         d_ghosts = IntVector<NDIM>::max(d_ghosts, d_active_fe_data_managers[part]->getGhostCellWidth());
+        d_interp_ghosts = IntVector<NDIM>::max(
+            d_interp_ghosts, IntVector<NDIM>(LEInteractor::getMinimumGhostWidth(d_interp_spec[part].kernel_fcn)));
+        d_spread_ghosts = IntVector<NDIM>::max(
+            d_spread_ghosts, IntVector<NDIM>(LEInteractor::getMinimumGhostWidth(d_spread_spec[part].kernel_fcn)));
 
         // Since the scratch and primary FEDataManagers use the same FEData
         // object we only have to do this assignment once
@@ -1949,9 +2117,9 @@ IBFEMethod::computeStressNormalization(PetscVector<double>& Phi_vec,
                 const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
                 const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
                 get_x_and_FF(x, FF, x_data, grad_x_data);
-                const double J = std::abs(FF.det());
+                const double J = std::abs(tensor_det<NDIM>(FF));
                 FF_trans = FF.transpose();
-                tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
+                tensor_inverse_transpose<NDIM>(FF_inv_trans, FF);
                 const libMesh::VectorValue<double>& N = normal_face[qp];
                 n = (FF_inv_trans * N).unit();
                 const double dA_da = 1.0 / (J * (FF_inv_trans * N) * n);
@@ -1960,22 +2128,16 @@ IBFEMethod::computeStressNormalization(PetscVector<double>& Phi_vec,
                 double Phi = 0.0;
                 for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                 {
-                    if (d_PK1_stress_fcn_data[part][k].fcn)
+                    if (d_PK1_stress_fcn_data[part][k].isSet())
                     {
                         // Compute the value of the first Piola-Kirchhoff stress
                         // tensor at the quadrature point and add the corresponding
                         // traction force to the right-hand-side vector.
                         fe.setInterpolatedDataPointers(
                             PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                        d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                           FF,
-                                                           x,
-                                                           X,
-                                                           elem,
-                                                           PK1_var_data[k],
-                                                           PK1_grad_var_data[k],
-                                                           data_time,
-                                                           d_PK1_stress_fcn_data[part][k].ctx);
+                        const libMesh::Point x_point(x);
+                        d_PK1_stress_fcn_data[part][k].evaluate(
+                            &PP, &FF, &x_point, &X, 1, elem, &PK1_var_data[k], &PK1_grad_var_data[k], data_time);
                         Phi += n * ((PP * FF_trans) * n) / J;
                     }
                 }
@@ -2234,8 +2396,8 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
                     const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
                     const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
                     get_x_and_FF(x, FF, x_data, grad_x_data);
-                    const double J = std::abs(FF.det());
-                    tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
+                    const double J = std::abs(tensor_det<NDIM>(FF));
+                    tensor_inverse_transpose<NDIM>(FF_inv_trans, FF);
                     const libMesh::VectorValue<double>& N = normal_face[qp];
                     n = (FF_inv_trans * N).unit();
 
@@ -2243,22 +2405,16 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        if (d_PK1_stress_fcn_data[part][k].isSet())
                         {
                             // Compute the value of the first Piola-Kirchhoff stress
                             // tensor at the quadrature point and compute the
                             // corresponding force.
                             fe.setInterpolatedDataPointers(
                                 PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                            d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                               FF,
-                                                               x,
-                                                               X,
-                                                               elem,
-                                                               PK1_var_data[k],
-                                                               PK1_grad_var_data[k],
-                                                               data_time,
-                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                            const libMesh::Point x_point(x);
+                            d_PK1_stress_fcn_data[part][k].evaluate(
+                                &PP, &FF, &x_point, &X, 1, elem, &PK1_var_data[k], &PK1_grad_var_data[k], data_time);
                             F -= PP * normal_face[qp] * JxW_face[qp];
                         }
                     }
@@ -2450,6 +2606,8 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
     std::vector<libMesh::Point> intersection_ref_coords;
     std::vector<SideIndex<NDIM> > intersection_indices;
     std::vector<std::pair<double, libMesh::Point> > intersections;
+    double intersection_tol = 0.0;
+    if (d_cache_jump_condition_intersections) d_jump_condition_intersection_cache.resize(d_meshes.size());
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
     const IntVector<NDIM>& ratio = level->getRatio();
     const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
@@ -2519,6 +2677,31 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
                     }
                     side_elem->point(k) = x;
                 }
+
+                // Reuse the intersections found for this side if its nodes
+                // have not moved by more than the cache tolerance.
+                JumpConditionIntersections* cached_intersections = nullptr;
+                bool use_cached_intersections = false;
+                intersection_tol = 0.0;
+                if (d_cache_jump_condition_intersections)
+                {
+                    cached_intersections =
+                        &d_jump_condition_intersection_cache[part][std::make_tuple(local_patch_num, elem->id(), side)];
+                    intersection_tol = d_jump_conditions_intersection_cache_tol * *std::min_element(dx, dx + NDIM);
+                    use_cached_intersections = cached_intersections->x_nodes.size() == n_node_side;
+                    for (unsigned int k = 0; k < n_node_side && use_cached_intersections; ++k)
+                    {
+                        use_cached_intersections = (x_node_cache[k] - cached_intersections->x_nodes[k]).norm() <=
+                                                   intersection_tol;
+                    }
+                }
+                if (use_cached_intersections)
+                {
+                    intersection_ref_coords = cached_intersections->ref_coords;
+                    intersection_indices = cached_intersections->indices;
+                    for (const SideIndex<NDIM>& i_s : intersection_indices) num_intersections(i_s) += 1;
+                }
+
                 Box<NDIM> box(IndexUtilities::getCellIndex(&x_min[0], grid_geom, ratio),
                               IndexUtilities::getCellIndex(&x_max[0], grid_geom, ratio));
                 box.grow(IntVector<NDIM>(1));
@@ -2526,9 +2709,12 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
 
                 // Loop over coordinate directions and look for intersections
                 // with the background fluid grid.
-                intersection_ref_coords.clear();
-                intersection_indices.clear();
-                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                if (!use_cached_intersections)
+                {
+                    intersection_ref_coords.clear();
+                    intersection_indices.clear();
+                }
+                for (unsigned int axis = 0; axis < NDIM && !use_cached_intersections; ++axis)
                 {
                     // Setup a unit vector pointing in the coordinate direction
                     // of interest.
@@ -2573,6 +2759,14 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
                     side_elem->point(k) = X_node_cache[k];
                 }
 
+                // Cache the newly found intersections.
+                if (cached_intersections && !use_cached_intersections)
+                {
+                    cached_intersections->x_nodes = x_node_cache;
+                    cached_intersections->ref_coords = intersection_ref_coords;
+                    cached_intersections->indices = intersection_indices;
+                }
+
                 // If there are no intersection points, then continue to the
                 // next side.
                 if (intersection_ref_coords.empty()) continue;
@@ -2593,8 +2787,8 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
                     const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
                     libMesh::VectorValue<double> x;
                     get_x_and_FF(x, FF, x_data, grad_x_data);
-                    const double J = std::abs(FF.det());
-                    tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
+                    const double J = std::abs(tensor_det<NDIM>(FF));
+                    tensor_inverse_transpose<NDIM>(FF_inv_trans, FF);
                     const libMesh::VectorValue<double>& N = normal_face[qp];
                     n = (FF_inv_trans * N).unit();
                     const double dA_da = 1.0 / (J * (FF_inv_trans * N) * n);
@@ -2607,10 +2801,12 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
                         {
                             const double x_lower_bound = x_lower[d] +
                                                          (static_cast<double>(i_s(d) - patch_lower[d]) - 0.5) * dx[d] -
-                                                         std::sqrt(std::numeric_limits<double>::epsilon());
+                                                         std::sqrt(std::numeric_limits<double>::epsilon()) -
+                                                         intersection_tol;
                             const double x_upper_bound = x_lower[d] +
                                                          (static_cast<double>(i_s(d) - patch_lower[d]) + 0.5) * dx[d] +
-                                                         std::sqrt(std::numeric_limits<double>::epsilon());
+                                                         std::sqrt(std::numeric_limits<double>::epsilon()) +
+                                                         intersection_tol;
                             TBOX_ASSERT(x_lower_bound <= x(d) && x(d) <= x_upper_bound);
                         }
                         else
@@ -2621,7 +2817,8 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
                             const double rel_diff =
                                 std::abs(x_intersection - x_interp) /
                                 std::max(1.0, std::max(std::abs(x_intersection), std::abs(x_interp)));
-                            TBOX_ASSERT(rel_diff <= std::sqrt(std::numeric_limits<double>::epsilon()));
+                            TBOX_ASSERT(rel_diff <= std::sqrt(std::numeric_limits<double>::epsilon()) ||
+                                        std::abs(x_intersection - x_interp) <= intersection_tol);
                         }
                     }
 #endif
@@ -2629,22 +2826,16 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        if (d_PK1_stress_fcn_data[part][k].isSet())
                         {
                             // Compute the value of the first Piola-Kirchhoff
                             // stress tensor at the quadrature point and compute
                             // the corresponding force.
                             fe.setInterpolatedDataPointers(
                                 PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                            d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                               FF,
-                                                               x,
-                                                               X,
-                                                               elem,
-                                                               PK1_var_data[k],
-                                                               PK1_grad_var_data[k],
-                                                               data_time,
-                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                            const libMesh::Point x_point(x);
+                            d_PK1_stress_fcn_data[part][k].evaluate(
+                                &PP, &FF, &x_point, &X, 1, elem, &PK1_var_data[k], &PK1_grad_var_data[k], data_time);
                             F -= PP * normal_face[qp];
                         }
                     }
@@ -2758,19 +2949,13 @@ IBFEMethod::getPrimaryToScratchSchedule(const int level_number,
                                         SAMRAI::xfer::RefinePatchStrategy<NDIM>* patch_strategy)
 {
     TBOX_ASSERT(d_scratch_hierarchy);
-    const auto key = std::make_pair(level_number, std::make_pair(primary_data_idx, scratch_data_idx));
-    if (d_scratch_transfer_forward_schedules.count(key) == 0)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
-        Pointer<PatchLevel<NDIM> > scratch_level = d_scratch_hierarchy->getPatchLevel(level_number);
-        if (!scratch_level->checkAllocated(scratch_data_idx)) scratch_level->allocatePatchData(scratch_data_idx, 0.0);
-        Pointer<RefineAlgorithm<NDIM> > refine_algorithm = new RefineAlgorithm<NDIM>();
-        Pointer<RefineOperator<NDIM> > refine_op_f = nullptr;
-        refine_algorithm->registerRefine(scratch_data_idx, primary_data_idx, scratch_data_idx, refine_op_f);
-        d_scratch_transfer_forward_schedules[key] =
-            refine_algorithm->createSchedule("DEFAULT_FILL", scratch_level, level, patch_strategy, false, nullptr);
-    }
-    return *d_scratch_transfer_forward_schedules[key];
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+    Pointer<PatchLevel<NDIM> > scratch_level = d_scratch_hierarchy->getPatchLevel(level_number);
+    if (!scratch_level->checkAllocated(scratch_data_idx)) scratch_level->allocatePatchData(scratch_data_idx, 0.0);
+    Pointer<RefineAlgorithm<NDIM> > refine_algorithm = new RefineAlgorithm<NDIM>();
+    Pointer<RefineOperator<NDIM> > refine_op_f = nullptr;
+    refine_algorithm->registerRefine(scratch_data_idx, primary_data_idx, scratch_data_idx, refine_op_f);
+    return *d_scratch_transfer_schedules.getRefineSchedule(refine_algorithm, scratch_level, level, patch_strategy);
 } // getPrimaryToScratchSchedule
 
 SAMRAI::xfer::RefineSchedule<NDIM>&
@@ -2780,63 +2965,50 @@ IBFEMethod::getScratchToPrimarySchedule(const int level_number,
                                         SAMRAI::xfer::RefinePatchStrategy<NDIM>* patch_strategy)
 {
     TBOX_ASSERT(d_scratch_hierarchy);
-    const auto key = std::make_pair(level_number, std::make_pair(primary_data_idx, scratch_data_idx));
-    if (d_scratch_transfer_backward_schedules.count(key) == 0)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
-        Pointer<PatchLevel<NDIM> > scratch_level = d_scratch_hierarchy->getPatchLevel(level_number);
-        Pointer<RefineAlgorithm<NDIM> > refine_algorithm = new RefineAlgorithm<NDIM>();
-        Pointer<RefineOperator<NDIM> > refine_op_b = nullptr;
-        refine_algorithm->registerRefine(primary_data_idx, scratch_data_idx, primary_data_idx, refine_op_b);
-        d_scratch_transfer_backward_schedules[key] =
-            refine_algorithm->createSchedule("DEFAULT_FILL", level, scratch_level, patch_strategy, false, nullptr);
-    }
-    return *d_scratch_transfer_backward_schedules[key];
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+    Pointer<PatchLevel<NDIM> > scratch_level = d_scratch_hierarchy->getPatchLevel(level_number);
+    Pointer<RefineAlgorithm<NDIM> > refine_algorithm = new RefineAlgorithm<NDIM>();
+    Pointer<RefineOperator<NDIM> > refine_op_b = nullptr;
+    refine_algorithm->registerRefine(primary_data_idx, scratch_data_idx, primary_data_idx, refine_op_b);
+    return *d_scratch_transfer_schedules.getRefineSchedule(refine_algorithm, level, scratch_level, patch_strategy);
 } // getScratchToPrimarySchedule
 
 SAMRAI::xfer::RefineSchedule<NDIM>&
 IBFEMethod::getProlongationSchedule(const int level_number, const int coarse_data_idx, const int fine_data_idx)
 {
-    const auto key = std::make_pair(level_number, std::make_pair(coarse_data_idx, fine_data_idx));
-    if (d_prolongation_schedules.count(key) == 0)
-    {
-        Pointer<PatchHierarchy<NDIM> > hierarchy = d_use_scratch_hierarchy ? d_scratch_hierarchy : d_hierarchy;
-        Pointer<RefineAlgorithm<NDIM> > refine_algorithm = new RefineAlgorithm<NDIM>();
-        Pointer<RefineOperator<NDIM> > refine_op;
+    Pointer<PatchHierarchy<NDIM> > hierarchy = d_use_scratch_hierarchy ? d_scratch_hierarchy : d_hierarchy;
+    Pointer<RefineAlgorithm<NDIM> > refine_algorithm = new RefineAlgorithm<NDIM>();
+    Pointer<RefineOperator<NDIM> > refine_op;
 
-        Pointer<hier::Variable<NDIM> > f_var;
-        VariableDatabase<NDIM>::getDatabase()->mapIndexToVariable(coarse_data_idx, f_var);
-        {
-            Pointer<hier::Variable<NDIM> > f_var_2;
-            VariableDatabase<NDIM>::getDatabase()->mapIndexToVariable(fine_data_idx, f_var_2);
-            // These should be the same variable
-            TBOX_ASSERT(&*f_var == &*f_var_2);
-        }
+    Pointer<hier::Variable<NDIM> > f_var;
+    VariableDatabase<NDIM>::getDatabase()->mapIndexToVariable(coarse_data_idx, f_var);
+    {
+        Pointer<hier::Variable<NDIM> > f_var_2;
+        VariableDatabase<NDIM>::getDatabase()->mapIndexToVariable(fine_data_idx, f_var_2);
+        // These should be the same variable
+        TBOX_ASSERT(&*f_var == &*f_var_2);
+    }
 
-        Pointer<CellVariable<NDIM, double> > f_cc_var = f_var;
-        Pointer<SideVariable<NDIM, double> > f_sc_var = f_var;
-        const bool cc_data = f_cc_var;
-        const bool sc_data = f_sc_var;
-        TBOX_ASSERT(cc_data || sc_data);
-        if (cc_data)
-        {
-            Pointer<CartesianGridGeometry<NDIM> > geometry = hierarchy->getGridGeometry();
-            refine_op = geometry->lookupRefineOperator(f_var, "CONSERVATIVE_LINEAR_REFINE");
-        }
-        else
-            refine_op = new CartSideDoubleRT0Refine();
-        TBOX_ASSERT(refine_op);
-        refine_algorithm->registerRefine(fine_data_idx, coarse_data_idx, fine_data_idx, refine_op);
-        Pointer<PatchLevel<NDIM> > fine_level = hierarchy->getPatchLevel(level_number + 1);
-        // We can ignore the fifth argument since we don't need to deal with
-        // forces outside the physical domain (this was handled previously by
-        // f_phys_bdry_op). In particular we don't need it since we don't care
-        // about ghost force values (they aren't used in the solver).
-        Pointer<RefineSchedule<NDIM> > schedule =
-            refine_algorithm->createSchedule(fine_level, nullptr, level_number, hierarchy);
-        d_prolongation_schedules[key] = schedule;
-    }
-    return *d_prolongation_schedules[key];
+    Pointer<CellVariable<NDIM, double> > f_cc_var = f_var;
+    Pointer<SideVariable<NDIM, double> > f_sc_var = f_var;
+    const bool cc_data = f_cc_var;
+    const bool sc_data = f_sc_var;
+    TBOX_ASSERT(cc_data || sc_data);
+    if (cc_data)
+    {
+        Pointer<CartesianGridGeometry<NDIM> > geometry = hierarchy->getGridGeometry();
+        refine_op = geometry->lookupRefineOperator(f_var, "CONSERVATIVE_LINEAR_REFINE");
+    }
+    else
+        refine_op = new CartSideDoubleRT0Refine();
+    TBOX_ASSERT(refine_op);
+    refine_algorithm->registerRefine(fine_data_idx, coarse_data_idx, fine_data_idx, refine_op);
+    Pointer<PatchLevel<NDIM> > fine_level = hierarchy->getPatchLevel(level_number + 1);
+    // We can ignore the fifth argument since we don't need to deal with
+    // forces outside the physical domain (this was handled previously by
+    // f_phys_bdry_op). In particular we don't need it since we don't care
+    // about ghost force values (they aren't used in the solver).
+    return *d_prolongation_schedules.getRefineSchedule(refine_algorithm, fine_level, nullptr, level_number, hierarchy);
 } // getProlongationSchedule
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -2913,6 +3085,8 @@ IBFEMethod::commonConstructor(const Pointer<Database>& input_db, int max_levels)
             d_scratch_load_balancer = new LoadBalancer<NDIM>(d_scratch_load_balancer_db);
         else if (load_balancer_type == "MERGING")
             d_scratch_load_balancer = new MergingLoadBalancer(d_scratch_load_balancer_db);
+        else if (load_balancer_type == "SPACE_FILLING_CURVE")
+            d_scratch_load_balancer = new SpaceFillingCurveLoadBalancer(d_scratch_load_balancer_db);
         else
             TBOX_ERROR(d_object_name << "::IBFEMethod():\n"
                                      << "unimplemented load balancer type " << load_balancer_type << std::endl);
@@ -3060,6 +3234,10 @@ IBFEMethod::getFromInput(const Pointer<Database>& db, bool /*is_from_restart*/)
     else if (db->isBool("split_forces"))
         d_split_tangential_force = db->getBool("split_forces");
     if (db->isBool("use_jump_conditions")) d_use_jump_conditions = db->getBool("use_jump_conditions");
+    if (db->isBool("cache_jump_condition_intersections"))
+        d_cache_jump_condition_intersections = db->getBool("cache_jump_condition_intersections");
+    if (db->keyExists("jump_conditions_intersection_cache_tol"))
+        d_jump_conditions_intersection_cache_tol = db->getDouble("jump_conditions_intersection_cache_tol");
 
     // FEDataManager settings.
     if (db->keyExists("FEDataManager"))
@@ -3173,11 +3351,66 @@ IBFEMethod::assertStructureOnFinestLevel() const
                 getCoarsestPatchLevelNumber() == d_hierarchy->getFinestLevelNumber());
 }
 
+bool
+IBFEMethod::updateMeshDistribution()
+{
+    // Partitioning and ghosting are done with respect to the hierarchy used
+    // for interpolation and spreading.
+    Pointer<PatchHierarchy<NDIM> > active_hierarchy = d_use_scratch_hierarchy ? d_scratch_hierarchy : d_hierarchy;
+    d_ghosting_functors.resize(d_meshes.size());
+    bool meshes_changed = false;
+    for (unsigned int part = 0; part < d_meshes.size(); ++part)
+    {
+        EquationSystems& equation_systems = *d_active_fe_data_managers[part]->getEquationSystems();
+        MeshBase& mesh = equation_systems.get_mesh();
+        const System& X_system = equation_systems.get_system(COORDS_SYSTEM_NAME);
+        if (mesh.is_serial())
+        {
+            if (d_libmesh_partitioner_type == SAMRAI_BOX)
+            {
+                BoxPartitioner partitioner(*active_hierarchy, X_system);
+                partitioner.repartition(mesh);
+                meshes_changed = true;
+            }
+            continue;
+        }
+
+        // Each processor of a distributed mesh keeps copies of the elements
+        // near its patches. FEDataManager associates elements with patches
+        // grown by one cell: we use one more cell since the bounding boxes of
+        // the quadrature points of an element may extend past those of its
+        // nodes and since the structure moves between regrids.
+        if (!d_ghosting_functors[part])
+        {
+            d_ghosting_functors[part].reset(new BoxGhostingFunctor(mesh, X_system));
+            mesh.add_ghosting_functor(*d_ghosting_functors[part]);
+        }
+        d_ghosting_functors[part]->reinit(*active_hierarchy, IntVector<NDIM>(2));
+        if (d_libmesh_partitioner_type == SAMRAI_BOX)
+        {
+            // Unlike repartition(), partition() also moves the elements to
+            // their new processors.
+            BoxPartitioner partitioner(*active_hierarchy, X_system);
+            partitioner.partition(mesh, IBTK_MPI::getNodes());
+        }
+        else
+        {
+            mesh.redistribute();
+        }
+        mesh.delete_remote_elements();
+        meshes_changed = true;
+    }
+    return meshes_changed;
+} // updateMeshDistribution
+
 void
 IBFEMethod::reinitElementMappings()
 {
     // Store the coordinates at which we performed the last reinit.
     d_X_vecs->copy("solution", { "last_patch_elem_assoc" });
+
+    // Cached intersections are associated with the old patches.
+    d_jump_condition_intersection_cache.clear();
     for (unsigned int part = 0; part < d_meshes.size(); ++part)
     {
         d_primary_fe_data_managers[part]->reinitElementMappings();
@@ -311,7 +311,8 @@ IBFEPatchRecoveryPostProcessor::initializeFEData(const PeriodicBoundaries* const
     d_n_qp_global = 0;
     d_n_qp_local = 0;
     d_qp_global_offset = 0;
-    const unsigned int n_elem = d_mesh->n_elem();
+    // Element ids need not be contiguous (e.g., for a distributed mesh).
+    const unsigned int n_elem = d_mesh->max_elem_id();
     d_elem_n_qp.resize(n_elem, 0);
     d_elem_qp_global_offset.resize(n_elem, 0);
     d_elem_qp_local_offset.resize(n_elem, 0);
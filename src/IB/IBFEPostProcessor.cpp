@@ -33,6 +33,7 @@
 #include "libmesh/enum_fe_family.h"
 #include "libmesh/enum_order.h"
 #include "libmesh/equation_systems.h"
+#include "libmesh/numeric_vector.h"
 #include "libmesh/system.h"
 
 #include <algorithm>
@@ -215,6 +216,79 @@ IBFEPostProcessor::postProcessData(const double data_time)
     return;
 } // postProcessData
 
+void
+IBFEPostProcessor::beginPostProcessData(const double data_time)
+{
+    if (d_snapshot_pending)
+    {
+        TBOX_ERROR(d_name << "::beginPostProcessData():\n"
+                          << "  endPostProcessData() must be called before post processing data again" << std::endl);
+    }
+
+    // The Eulerian data will change when the simulation is advanced, so it
+    // must be interpolated now.
+    interpolateVariables(data_time);
+
+    // Determine which systems are read during the reconstruction. Systems
+    // managed by this object are only modified by this object and do not
+    // need to be copied.
+    EquationSystems* equation_systems = d_fe_data_manager->getEquationSystems();
+    std::set<std::string> system_names = { IBFEMethod::COORDS_SYSTEM_NAME };
+    for (const auto* system_data_vec :
+         { &d_scalar_var_system_data, &d_vector_var_system_data, &d_tensor_var_system_data })
+    {
+        for (const auto& system_data : *system_data_vec)
+        {
+            for (const auto& data : system_data) system_names.insert(data.system_name);
+        }
+    }
+    for (const auto& var_system : d_var_systems) system_names.erase(var_system->name());
+
+    TBOX_ASSERT(d_snapshot_vecs.empty());
+    for (const auto& system_name : system_names)
+    {
+        System& system = equation_systems->get_system(system_name);
+        d_snapshot_vecs.emplace_back(&system, system.solution->clone());
+    }
+    d_snapshot_time = data_time;
+    d_snapshot_pending = true;
+    return;
+} // beginPostProcessData
+
+double
+IBFEPostProcessor::endPostProcessData()
+{
+    if (!d_snapshot_pending)
+    {
+        TBOX_ERROR(d_name << "::endPostProcessData():\n"
+                          << "  beginPostProcessData() must be called before endPostProcessData()" << std::endl);
+    }
+
+    // Temporarily replace the solution vectors with the stored copies (and
+    // update the ghosted vectors to match) and then restore them.
+    auto swap_snapshot = [this]() {
+        for (auto& system_vec : d_snapshot_vecs)
+        {
+            System& system = *system_vec.first;
+            system.solution->swap(*system_vec.second);
+            system.update();
+        }
+    };
+    swap_snapshot();
+    reconstructVariables(d_snapshot_time);
+    swap_snapshot();
+
+    d_snapshot_vecs.clear();
+    d_snapshot_pending = false;
+    return d_snapshot_time;
+} // endPostProcessData
+
+bool
+IBFEPostProcessor::hasPendingPostProcessData() const
+{
+    return d_snapshot_pending;
+} // hasPendingPostProcessData
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 void
@@ -264,9 +338,8 @@ IBFEPostProcessor::interpolateVariables(const double data_time)
     ghost_fill_op.fillData(data_time);
 
     // Interpolate variables.
-    std::unique_ptr<libMesh::PetscVector<double> > X_ghost_vec =
-        d_fe_data_manager->buildIBGhostedVector(IBFEMethod::COORDS_SYSTEM_NAME);
-    copy_and_synch(*d_fe_data_manager->getSolutionVector(IBFEMethod::COORDS_SYSTEM_NAME), *X_ghost_vec);
+    libMesh::PetscVector<double>* X_ghost_vec =
+        &d_fe_data_manager->getSharedIBGhostedVector(IBFEMethod::COORDS_SYSTEM_NAME, "solution");
     for (unsigned int k = 0; k < num_eulerian_vars; ++k)
     {
         System* system = d_scalar_interp_var_systems[k];
@@ -420,9 +420,10 @@ IBFESurfaceMethod::interpolateVelocity(const int u_data_idx,
         U_t_rhs_vec->zero();
         std::vector<DenseVector<double> > U_t_rhs_e(NDIM);
         boost::multi_array<double, 2> X_node, x_node;
-        std::vector<double> U_qp, x_qp;
-        VectorValue<double> U, U_n, U_t, N, n;
-        std::array<VectorValue<double>, 2> dX_dxi, dx_dxi;
+        std::vector<double> U_qp, x_qp, N_qp, phi_JxW_qp;
+        std::vector<unsigned int> elem_n_qp;
+        VectorValue<double> U, U_n, U_t, N;
+        std::array<VectorValue<double>, 2> dX_dxi;
 
         std::vector<libMesh::dof_id_type> dof_id_scratch;
         Pointer<PatchLevel<NDIM> > level =
@@ -455,15 +456,23 @@ IBFESurfaceMethod::interpolateVelocity(const int u_data_idx,
             if (!n_qp_patch) continue;
             U_qp.resize(NDIM * n_qp_patch);
             x_qp.resize(NDIM * n_qp_patch);
+            N_qp.resize(NDIM * n_qp_patch);
+            elem_n_qp.resize(num_active_patch_elems);
+            phi_JxW_qp.clear();
             std::fill(U_qp.begin(), U_qp.end(), 0.0);
 
-            // Loop over the elements and compute the positions of the quadrature points.
+            // Loop over the elements and compute the positions of the
+            // quadrature points. The reference normals and the products of the
+            // basis functions and the quadrature weights are cached in
+            // contiguous buffers so that the accumulation of the right-hand
+            // sides below does not need to reinitialize the FE objects.
             qrule.reset();
             unsigned int qp_offset = 0;
             for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
             {
                 Elem* const elem = patch_elems[e_idx];
                 const auto& X_dof_indices = X_dof_map_cache.dof_indices(elem);
+                get_values_for_interpolation(X_node, *X0_vec, X_dof_indices);
                 get_values_for_interpolation(x_node, *X_vec, X_local_soln, X_dof_indices);
                 const bool qrule_changed =
                     FEDataManager::updateInterpQuadratureRule(qrule, d_default_interp_spec, elem, x_node, patch_dx_min);
@@ -471,6 +480,7 @@ IBFESurfaceMethod::interpolateVelocity(const int u_data_idx,
                 fe->reinit(elem);
                 const unsigned int n_node = elem->n_nodes();
                 const unsigned int n_qp = qrule->n_points();
+                elem_n_qp[e_idx] = n_qp;
                 double* x_begin = &x_qp[NDIM * qp_offset];
                 std::fill(x_begin, x_begin + NDIM * n_qp, 0.0);
                 for (unsigned int k = 0; k < n_node; ++k)
@@ -482,6 +492,20 @@ IBFESurfaceMethod::interpolateVelocity(const int u_data_idx,
                         {
                             x_qp[NDIM * (qp_offset + qp) + d] += x_node[k][d] * p;
                         }
+                        phi_JxW_qp.push_back(p * JxW[qp]);
+                    }
+                }
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                {
+                    for (unsigned int k = 0; k < NDIM - 1; ++k)
+                    {
+                        interpolate(dX_dxi[k], qp, X_node, *dphi_dxi[k]);
+                    }
+                    if (NDIM == 2) dX_dxi[1] = VectorValue<double>(0.0, 0.0, 1.0);
+                    N = (dX_dxi[0].cross(dX_dxi[1])).unit();
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        N_qp[NDIM * (qp_offset + qp) + d] = N(d);
                     }
                 }
                 qp_offset += n_qp;
@@ -508,51 +532,33 @@ IBFESurfaceMethod::interpolateVelocity(const int u_data_idx,
             }
 
             // Loop over the elements and accumulate the right-hand-side values.
-            qrule.reset();
             qp_offset = 0;
+            unsigned int phi_offset = 0;
             for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
             {
                 Elem* const elem = patch_elems[e_idx];
                 const auto& U_dof_indices = U_dof_map_cache.dof_indices(elem);
-                const auto& X_dof_indices = X_dof_map_cache.dof_indices(elem);
                 for (unsigned int d = 0; d < NDIM; ++d)
                 {
                     U_rhs_e[d].resize(static_cast<int>(U_dof_indices[d].size()));
                     U_n_rhs_e[d].resize(static_cast<int>(U_dof_indices[d].size()));
                     U_t_rhs_e[d].resize(static_cast<int>(U_dof_indices[d].size()));
                 }
-                get_values_for_interpolation(X_node, *X0_vec, X_dof_indices);
-                get_values_for_interpolation(x_node, *X_vec, X_local_soln, X_dof_indices);
-                const bool qrule_changed =
-                    FEDataManager::updateInterpQuadratureRule(qrule, d_default_interp_spec, elem, x_node, patch_dx_min);
-                if (qrule_changed) fe->attach_quadrature_rule(qrule.get());
-                fe->reinit(elem);
-                const unsigned int n_qp = qrule->n_points();
+                const unsigned int n_qp = elem_n_qp[e_idx];
                 const size_t n_basis = U_dof_indices[0].size();
                 for (unsigned int qp = 0; qp < n_qp; ++qp)
                 {
-                    for (unsigned int k = 0; k < NDIM - 1; ++k)
-                    {
-                        interpolate(dX_dxi[k], qp, X_node, *dphi_dxi[k]);
-                        interpolate(dx_dxi[k], qp, x_node, *dphi_dxi[k]);
-                    }
-                    if (NDIM == 2)
-                    {
-                        dX_dxi[1] = VectorValue<double>(0.0, 0.0, 1.0);
-                        dx_dxi[1] = VectorValue<double>(0.0, 0.0, 1.0);
-                    }
-                    N = (dX_dxi[0].cross(dX_dxi[1])).unit();
-                    n = (dx_dxi[0].cross(dx_dxi[1])).unit();
                     const int idx = NDIM * (qp_offset + qp);
                     for (unsigned int d = 0; d < NDIM; ++d)
                     {
                         U(d) = U_qp[idx + d];
+                        N(d) = N_qp[idx + d];
                     }
                     U_n = (U * N) * N;
                     U_t = U - U_n;
                     for (unsigned int k = 0; k < n_basis; ++k)
                     {
-                        const double p_JxW = phi[k][qp] * JxW[qp];
+                        const double p_JxW = phi_JxW_qp[phi_offset + k * n_qp + qp];
                         for (unsigned int d = 0; d < NDIM; ++d)
                         {
                             U_rhs_e[d](k) += U(d) * p_JxW;
@@ -580,6 +586,7 @@ IBFESurfaceMethod::interpolateVelocity(const int u_data_idx,
                     U_t_rhs_vec->add_vector(U_t_rhs_e[var_n], dof_id_scratch);
                 }
                 qp_offset += n_qp;
+                phi_offset += n_basis * n_qp;
             }
         }
 
@@ -787,6 +794,14 @@ IBFESurfaceMethod::computeLagrangianForce(const double data_time)
         std::vector<const std::vector<VectorValue<double> >*> surface_force_grad_var_data,
             surface_pressure_grad_var_data;
 
+        // The reference configuration quantities are computed during the first
+        // call and read from the cache afterwards.
+        std::vector<double>& X_ref_qp = d_X_ref_qp[part];
+        std::vector<double>& N_ref_qp = d_N_ref_qp[part];
+        std::vector<double>& dA_ref_qp = d_dA_ref_qp[part];
+        const bool compute_ref_qp = dA_ref_qp.empty();
+        unsigned int qp_offset = 0;
+
         // Loop over the elements to compute the right-hand side vector.
         boost::multi_array<double, 2> X_node, x_node;
         TensorValue<double> FF;
@@ -813,29 +828,46 @@ IBFESurfaceMethod::computeLagrangianForce(const double data_time)
             fe_interpolator.collectDataForInterpolation(elem);
             fe_interpolator.interpolate(elem);
             get_values_for_interpolation(x_node, X_vec, X_dof_indices);
-            get_values_for_interpolation(X_node, X0_vec, X_dof_indices);
+            if (compute_ref_qp) get_values_for_interpolation(X_node, X0_vec, X_dof_indices);
             const unsigned int n_qp = qrule->n_points();
             const size_t n_basis = phi.size();
-            for (unsigned int qp = 0; qp < n_qp; ++qp)
+            for (unsigned int qp = 0; qp < n_qp; ++qp, ++qp_offset)
             {
-                interpolate(X, qp, X_node, phi);
-                interpolate(x, qp, x_node, phi);
-                for (unsigned int k = 0; k < NDIM - 1; ++k)
+                // Construct unit vectors in the reference and current
+                // configurations.
+                if (compute_ref_qp)
                 {
-                    interpolate(dX_dxi[k], qp, X_node, *dphi_dxi[k]);
-                    interpolate(dx_dxi[k], qp, x_node, *dphi_dxi[k]);
+                    interpolate(X, qp, X_node, phi);
+                    for (unsigned int k = 0; k < NDIM - 1; ++k)
+                    {
+                        interpolate(dX_dxi[k], qp, X_node, *dphi_dxi[k]);
+                    }
+                    if (NDIM == 2) dX_dxi[1] = VectorValue<double>(0.0, 0.0, 1.0);
+                    N = dX_dxi[0].cross(dX_dxi[1]);
+                    dA_ref_qp.push_back(N.norm());
+                    N = N.unit();
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        X_ref_qp.push_back(X(d));
+                        N_ref_qp.push_back(N(d));
+                    }
                 }
-                if (NDIM == 2)
+                else
                 {
-                    dX_dxi[1] = VectorValue<double>(0.0, 0.0, 1.0);
-                    dx_dxi[1] = VectorValue<double>(0.0, 0.0, 1.0);
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        X(d) = X_ref_qp[NDIM * qp_offset + d];
+                        N(d) = N_ref_qp[NDIM * qp_offset + d];
+                    }
                 }
+                const double dA = dA_ref_qp[qp_offset];
 
-                // Construct unit vectors in the reference and current
-                // configurations.
-                N = dX_dxi[0].cross(dX_dxi[1]);
-                const double dA = N.norm();
-                N = N.unit();
+                interpolate(x, qp, x_node, phi);
+                for (unsigned int k = 0; k < NDIM - 1; ++k)
+                {
+                    interpolate(dx_dxi[k], qp, x_node, *dphi_dxi[k]);
+                }
+                if (NDIM == 2) dx_dxi[1] = VectorValue<double>(0.0, 0.0, 1.0);
                 n = dx_dxi[0].cross(dx_dxi[1]);
                 const double da = n.norm();
                 n = n.unit();
@@ -999,6 +1031,14 @@ IBFESurfaceMethod::spreadForce(const int f_data_idx,
         }
     }
 
+    // If the caller accumulates the ghost data, hand over the values spread
+    // into both the patch interiors and the ghost regions.
+    if (d_defer_force_ghost_data_accumulation)
+    {
+        f_active_data_ops->add(f_data_idx, f_data_idx, f_scratch_data_idx, /*interior_only*/ false);
+        return;
+    }
+
     if (f_phys_bdry_op)
     {
         f_phys_bdry_op->setPatchDataIndex(f_scratch_data_idx);
@@ -1026,6 +1066,20 @@ IBFESurfaceMethod::spreadForce(const int f_data_idx,
     return;
 } // spreadForce
 
+bool
+IBFESurfaceMethod::canDeferForceGhostDataAccumulation() const
+{
+    // Forces are always spread onto the finest level.
+    return true;
+} // canDeferForceGhostDataAccumulation
+
+void
+IBFESurfaceMethod::setDeferForceGhostDataAccumulation(const bool defer_ghost_data_accumulation)
+{
+    d_defer_force_ghost_data_accumulation = defer_ghost_data_accumulation;
+    return;
+} // setDeferForceGhostDataAccumulation
+
 FEDataManager::InterpSpec
 IBFESurfaceMethod::getDefaultInterpSpec() const
 {
@@ -1178,6 +1232,10 @@ IBFESurfaceMethod::initializeFEData()
     if (d_use_pressure_jump_conditions)
         d_DP_vecs.reset(new LibMeshSystemIBVectors(d_fe_data_managers, PRESSURE_JUMP_SYSTEM_NAME));
 
+    d_X_ref_qp.assign(d_num_parts, std::vector<double>());
+    d_N_ref_qp.assign(d_num_parts, std::vector<double>());
+    d_dA_ref_qp.assign(d_num_parts, std::vector<double>());
+
     const bool from_restart = RestartManager::getManager()->isFromRestart();
     for (unsigned int part = 0; part < d_num_parts; ++part)
     {
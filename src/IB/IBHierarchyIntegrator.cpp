@@ -29,6 +29,7 @@
 #include "ibtk/LMarkerUtilities.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/ibtk_utilities.h"
+#include "ibtk/profiling_annotations.h"
 
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
@@ -168,6 +169,7 @@ IBHierarchyIntegrator::preprocessIntegrateHierarchy(const double current_time,
                                                     const double new_time,
                                                     const int num_cycles)
 {
+    IBTK_PROFILING_REGION("IBHierarchyIntegrator::preprocessIntegrateHierarchy");
     HierarchyIntegrator::preprocessIntegrateHierarchy(current_time, new_time, num_cycles);
 
     // Determine whether there has been a time step size change.
@@ -200,6 +202,7 @@ IBHierarchyIntegrator::postprocessIntegrateHierarchy(const double current_time,
                                                      const bool skip_synchronize_new_state_data,
                                                      const int num_cycles)
 {
+    IBTK_PROFILING_REGION("IBHierarchyIntegrator::postprocessIntegrateHierarchy");
     // postprocess the objects this class manages...
     d_ib_method_ops->postprocessIntegrateData(current_time, new_time, num_cycles);
 
@@ -240,14 +243,18 @@ IBHierarchyIntegrator::postprocessIntegrateHierarchy(const double current_time,
         }
     }
 
-    cfl_max = IBTK_MPI::maxReduction(cfl_max);
-    d_regrid_fluid_cfl_estimate += cfl_max;
+    // Overlap the reduction of the CFL number with the computation of the
+    // structure displacement.
+    IBTK_MPI::request cfl_max_request = IBTK_MPI::imaxReduction(&cfl_max);
 
     // Not all IBStrategy objects implement this so make it optional (-1.0 is
     // the default value)
     if (d_regrid_structure_cfl_interval != -1.0)
         d_regrid_structure_cfl_estimate = d_ib_method_ops->getMaxPointDisplacement();
 
+    IBTK_MPI::wait(cfl_max_request);
+    d_regrid_fluid_cfl_estimate += cfl_max;
+
     if (d_enable_logging)
     {
         plog << d_object_name << "::postprocessIntegrateHierarchy(): CFL number = " << cfl_max << "\n";
@@ -285,11 +292,14 @@ IBHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHierarchy<NDIM
     // Initialize all variables.
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
 
-    const IntVector<NDIM> ib_ghosts = d_ib_method_ops->getMinimumGhostCellWidth();
+    // The interpolated and the spread quantities are given only as many ghost
+    // cells as the corresponding kernels require.
+    const IntVector<NDIM> interp_ghosts = d_ib_method_ops->getMinimumInterpolationGhostCellWidth();
+    const IntVector<NDIM> spread_ghosts = d_ib_method_ops->getMinimumSpreadingGhostCellWidth();
     const IntVector<NDIM> ghosts = 1;
 
-    d_u_idx = var_db->registerVariableAndContext(d_u_var, d_ib_context, ib_ghosts);
-    d_f_idx = var_db->registerVariableAndContext(d_f_var, d_ib_context, ib_ghosts);
+    d_u_idx = var_db->registerVariableAndContext(d_u_var, d_ib_context, interp_ghosts);
+    d_f_idx = var_db->registerVariableAndContext(d_f_var, d_ib_context, spread_ghosts);
     switch (d_time_stepping_type)
     {
     case FORWARD_EULER:
@@ -302,8 +312,8 @@ IBHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHierarchy<NDIM
 
     if (d_ib_method_ops->hasFluidSources())
     {
-        d_p_idx = var_db->registerVariableAndContext(d_p_var, d_ib_context, ib_ghosts);
-        d_q_idx = var_db->registerVariableAndContext(d_q_var, d_ib_context, ib_ghosts);
+        d_p_idx = var_db->registerVariableAndContext(d_p_var, d_ib_context, interp_ghosts);
+        d_q_idx = var_db->registerVariableAndContext(d_q_var, d_ib_context, spread_ghosts);
     }
     else
     {
@@ -470,7 +480,7 @@ IBHierarchyIntegrator::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > h
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         level->allocatePatchData(d_u_idx, d_integrator_time);
-        level->allocatePatchData(d_scratch_data, d_integrator_time);
+        allocateLevelPatchData(level, d_scratch_data, d_integrator_time);
     }
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     const int u_current_idx = var_db->mapVariableAndContextToIndex(d_u_var, getCurrentContext());
@@ -503,6 +513,7 @@ IBHierarchyIntegrator::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > h
 void
 IBHierarchyIntegrator::regridHierarchyBeginSpecialized()
 {
+    IBTK_PROFILING_REGION("IBHierarchyIntegrator::regridHierarchyBeginSpecialized");
     // This must be done here since (if a load balancer is used) it effects
     // the distribution of patches.
     updateWorkloadEstimates();
@@ -523,6 +534,7 @@ IBHierarchyIntegrator::regridHierarchyBeginSpecialized()
 void
 IBHierarchyIntegrator::regridHierarchyEndSpecialized()
 {
+    IBTK_PROFILING_REGION("IBHierarchyIntegrator::regridHierarchyEndSpecialized");
     // After regridding, finish Lagrangian data movement.
     if (d_enable_logging) plog << d_object_name << "::regridHierarchy(): finishing Lagrangian data movement\n";
     d_ib_method_ops->endDataRedistribution(d_hierarchy, d_gridding_alg);
@@ -592,9 +604,18 @@ IBHierarchyIntegrator::atRegridPointSpecialized() const
         // Account for the use of -1.0 as a default value
         const bool regrid_fluid =
             d_regrid_fluid_cfl_interval == -1.0 ? false : d_regrid_fluid_cfl_estimate >= d_regrid_fluid_cfl_interval;
-        const bool regrid_structure = d_regrid_structure_cfl_interval == -1.0 ?
-                                          false :
-                                          d_regrid_structure_cfl_estimate >= d_regrid_structure_cfl_interval;
+        bool regrid_structure = d_regrid_structure_cfl_interval == -1.0 ?
+                                    false :
+                                    d_regrid_structure_cfl_estimate >= d_regrid_structure_cfl_interval;
+        if (regrid_structure && !regrid_fluid && d_regrid_structure_margin >= 0 &&
+            d_ib_method_ops->areStructuresWithinRefinedRegions(d_regrid_structure_margin))
+        {
+            if (d_enable_logging)
+                plog << d_object_name
+                     << "::atRegridPointSpecialized(): structures remain within their refined regions, skipping "
+                        "regrid\n";
+            regrid_structure = false;
+        }
         return regrid_fluid || regrid_structure;
     }
     else if (d_regrid_interval != 0)
@@ -707,6 +728,27 @@ IBHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Database> db)
     return;
 } // putToDatabaseSpecialized
 
+void
+IBHierarchyIntegrator::saveRollbackStateSpecialized(const int slot)
+{
+    d_ib_method_ops->saveRollbackState(slot);
+    return;
+} // saveRollbackStateSpecialized
+
+void
+IBHierarchyIntegrator::restoreRollbackStateSpecialized(const int slot)
+{
+    d_ib_method_ops->restoreRollbackState(slot);
+    return;
+} // restoreRollbackStateSpecialized
+
+void
+IBHierarchyIntegrator::discardRollbackStateSpecialized(const int slot)
+{
+    d_ib_method_ops->discardRollbackState(slot);
+    return;
+} // discardRollbackStateSpecialized
+
 void
 IBHierarchyIntegrator::addWorkloadEstimate(Pointer<PatchHierarchy<NDIM> > hierarchy, const int workload_data_idx)
 {
@@ -724,6 +766,8 @@ IBHierarchyIntegrator::getFromInput(Pointer<Database> db, bool /*is_from_restart
         d_regrid_fluid_cfl_interval = db->getDouble("regrid_fluid_cfl_interval");
     if (db->keyExists("regrid_structure_cfl_interval"))
         d_regrid_structure_cfl_interval = db->getDouble("regrid_structure_cfl_interval");
+    if (db->keyExists("regrid_structure_margin"))
+        d_regrid_structure_margin = db->getInteger("regrid_structure_margin");
     if (db->keyExists("error_on_dt_change"))
         d_error_on_dt_change = db->getBool("error_on_dt_change");
     else if (db->keyExists("error_on_timestep_change"))
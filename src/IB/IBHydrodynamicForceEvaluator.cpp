@@ -314,141 +314,18 @@ IBHydrodynamicForceEvaluator::computeLaggedMomentumIntegral(
     Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
     const std::vector<RobinBcCoefStrategy<NDIM>*>& u_src_bc_coef)
 {
-    resetFaceAreaWeight(patch_hierarchy);
-    resetFaceVolWeight(patch_hierarchy);
+    resetFaceWeights(patch_hierarchy);
+    resetControlVolumePatchBoxes(patch_hierarchy);
     fillPatchData(u_old_idx, -1, patch_hierarchy, u_src_bc_coef, nullptr, d_current_time);
 
-    const int coarsest_ln = 0;
-    const int finest_ln = patch_hierarchy->getFinestLevelNumber();
-
-    // Whether or not the simulation has adaptive mesh refinement
-    const bool amr_case = (coarsest_ln != finest_ln);
-
     for (auto& hydro_obj : d_hydro_objs)
     {
         IBHydrodynamicForceObject& fobj = hydro_obj.second;
 
-        // Compute the momentum integral:= (rho * u * dv) for the previous time step (integral is over new control
-        // volume)
-        fobj.P_box_current.setZero();
-
-        // Compute the rotational momentum integral:= (rho * r x u * dv) for the previous time step (integral is over
-        // new control volume)
-        fobj.L_box_current.setZero();
-
-        // Coordinate of the side index and r vector needed for cross product
-        IBTK::Vector3d side_coord, r_vec;
-
-        for (int ln = finest_ln; ln >= coarsest_ln; --ln)
-        {
-            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
-            Box<NDIM> integration_box(
-                IndexUtilities::getCellIndex(fobj.box_X_lower_new.data(), level->getGridGeometry(), level->getRatio()),
-                IndexUtilities::getCellIndex(fobj.box_X_upper_new.data(), level->getGridGeometry(), level->getRatio()));
-
-            // Shorten the integration box so it only includes the control volume
-            integration_box.upper() -= 1;
-
-            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-            {
-                Pointer<Patch<NDIM> > patch = level->getPatch(p());
-                const Box<NDIM>& patch_box = patch->getBox();
-                const bool boxes_intersect = patch_box.intersects(integration_box);
-                if (!boxes_intersect) continue;
-
-                // Part of the box on this patch.
-                Box<NDIM> trim_box = patch_box * integration_box;
-
-                // Loop over the box and compute momentum.
-                Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(d_u_idx);
-                Pointer<SideData<NDIM, double> > vol_sc_data = patch->getPatchData(d_vol_wgt_sc_idx);
-
-                for (int axis = 0; axis < NDIM; ++axis)
-                {
-                    for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(trim_box, axis)); b; b++)
-                    {
-                        const CellIndex<NDIM>& cell_idx = *b;
-                        const SideIndex<NDIM> side_idx(cell_idx, axis, SideIndex<NDIM>::Lower);
-                        const double& u_axis = (*u_data)(side_idx);
-                        const double& vol = (*vol_sc_data)(side_idx);
-                        double dV;
-
-                        // Check if cell is a CV boundary
-                        const bool lower_bdry_vel = (cell_idx(axis) == (integration_box.lower())(axis));
-                        const bool upper_bdry_vel = (cell_idx(axis) == (integration_box.upper())(axis) + 1);
-
-                        // Check if CV boundary intersects a patch boundary
-                        const bool lower_patch_bdry_eq_box_bdry =
-                            ((patch_box.lower())(axis) == (integration_box.lower())(axis));
-                        const bool upper_patch_bdry_eq_box_bdry =
-                            ((patch_box.upper())(axis) + 1 == (integration_box.upper())(axis) + 1);
-
-                        if (!amr_case)
-                        {
-                            /* Uniform mesh scaling correction
-                             * If the velocity is on the CV boundary, scale the volume element by 1/2
-                             * If the patch boundary equals the CV boundary, then volume element is correct (dx * dy)/2
-                             */
-
-                            const bool scale_dV = (lower_bdry_vel && !lower_patch_bdry_eq_box_bdry) ||
-                                                  (upper_bdry_vel && !upper_patch_bdry_eq_box_bdry);
-
-                            dV = scale_dV ? 0.5 * vol : vol;
-                        }
-                        else
-                        {
-                            /* Adaptive mesh scaling correction
-                             * If on a CV boundary, set dV to (dx * dy)/2, using the patch grid spacing
-                             * If vol == 0, don't change anything
-                             */
-
-                            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-                            const double* const patch_dx = patch_geom->getDx();
-                            const double box_edge_dV = 0.5 * patch_dx[0] * patch_dx[1]
-#if (NDIM == 3)
-                                                       * patch_dx[2]
-#endif
-                                ;
-
-                            const bool modify_dV = (lower_bdry_vel || upper_bdry_vel) && vol > 0;
-                            dV = modify_dV ? box_edge_dV : vol;
-                        }
-
-                        fobj.P_box_current(axis) += d_rho * u_axis * dV;
-
-                        // Compute angular momentum by looping over all the sides in one axis direction
-
-                        if (axis == 0)
-                        {
-                            // Get the coordinate of the side index and r vector
-                            side_coord.setZero();
-                            getPhysicalCoordinateFromSideIndex(side_coord, level, patch, side_idx, axis);
-                            r_vec = side_coord - fobj.r0;
-                            IBTK::Vector3d u_vec = IBTK::Vector3d::Zero();
-                            u_vec(axis) = u_axis;
-
-                            for (int d = 0; d < NDIM; ++d)
-                            {
-                                if (d == axis) continue;
-
-                                CellIndex<NDIM> cell_left_idx = cell_idx;
-                                cell_left_idx(axis) -= 1;
-                                u_vec(d) =
-                                    0.25 * ((*u_data)(SideIndex<NDIM>(cell_left_idx, d, SideIndex<NDIM>::Lower)) +
-                                            (*u_data)(SideIndex<NDIM>(cell_left_idx, d, SideIndex<NDIM>::Upper)) +
-                                            (*u_data)(SideIndex<NDIM>(cell_idx, d, SideIndex<NDIM>::Lower)) +
-                                            (*u_data)(SideIndex<NDIM>(cell_idx, d, SideIndex<NDIM>::Upper)));
-                            }
-
-                            fobj.L_box_current += d_rho * r_vec.cross(u_vec) * dV;
-                        }
-                    }
-                }
-            }
-        }
-
-        IBTK_MPI::sumReduction(fobj.P_box_current.data(), 3);
-        IBTK_MPI::sumReduction(fobj.L_box_current.data(), 3);
+        // Compute the momentum integral:= (rho * u * dv) and the rotational
+        // momentum integral:= (rho * r x u * dv) for the previous time step
+        // (integral is over new control volume)
+        computeBoxMomentumIntegral(fobj, patch_hierarchy, fobj.P_box_current, fobj.L_box_current);
     }
 
     return;
@@ -483,293 +360,136 @@ IBHydrodynamicForceEvaluator::computeHydrodynamicForce(int u_idx,
                                                        const std::vector<RobinBcCoefStrategy<NDIM>*>& u_src_bc_coef,
                                                        RobinBcCoefStrategy<NDIM>* p_src_bc_coef)
 {
-    resetFaceAreaWeight(patch_hierarchy);
-    resetFaceVolWeight(patch_hierarchy);
+    resetFaceWeights(patch_hierarchy);
+    resetControlVolumePatchBoxes(patch_hierarchy);
     fillPatchData(u_idx, p_idx, patch_hierarchy, u_src_bc_coef, p_src_bc_coef, d_current_time + dt);
 
-    const int coarsest_ln = 0;
-    const int finest_ln = patch_hierarchy->getFinestLevelNumber();
-
-    // Whether or not the simulation has adaptive mesh refinement
-    const bool amr_case = (coarsest_ln != finest_ln);
-
     for (auto& hydro_obj : d_hydro_objs)
     {
         IBHydrodynamicForceObject& fobj = hydro_obj.second;
 
-        // Compute the momentum integral:= (rho * u * dv)
-        fobj.P_box_new.setZero();
+        // Compute the momentum integral:= (rho * u * dv) and the rotational
+        // momentum integral:= (rho * r x u * dv) for the new time step
+        // (integral is over new control volume)
+        computeBoxMomentumIntegral(fobj, patch_hierarchy, fobj.P_box_new, fobj.L_box_new);
 
-        // Compute the rotational momentum integral:= (rho * r x u * dv) for the new time step (integral is over new
-        // control volume)
-        fobj.L_box_new.setZero();
+        // Compute surface integral term over the parts of the control volume
+        // boundary on the local patches.
+        IBTK::Vector3d trac, torque_trac;
+        trac.setZero();
+        torque_trac.setZero();
 
         // Coordinate of the side index and r vector needed for cross product
         IBTK::Vector3d side_coord, r_vec;
 
-        for (int ln = finest_ln; ln >= coarsest_ln; --ln)
+        for (const auto& surface_box : d_cv_surface_boxes[hydro_obj.first])
         {
-            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
-            Box<NDIM> integration_box(
-                IndexUtilities::getCellIndex(fobj.box_X_lower_new.data(), level->getGridGeometry(), level->getRatio()),
-                IndexUtilities::getCellIndex(fobj.box_X_upper_new.data(), level->getGridGeometry(), level->getRatio()));
-
-            // Shorten the integration box so it only includes the control volume
-            integration_box.upper() -= 1;
-
-            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(surface_box.level_number);
+            Pointer<Patch<NDIM> > patch = level->getPatch(surface_box.patch_number);
+            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+            const double* const patch_dx = patch_geom->getDx();
+            const int axis = surface_box.axis;
+            const int upperlower = surface_box.upper_lower;
+            const Box<NDIM>& trim_box = surface_box.box;
+
+            Pointer<CellData<NDIM, double> > p_data = patch->getPatchData(d_p_idx);
+            Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(d_u_idx);
+            Pointer<SideData<NDIM, double> > face_sc_data = patch->getPatchData(d_face_wgt_sc_idx);
+            IBTK::Vector3d n = IBTK::Vector3d::Zero();
+            n(axis) = upperlower ? 1 : -1;
+            for (Box<NDIM>::Iterator b(trim_box); b; b++)
             {
-                Pointer<Patch<NDIM> > patch = level->getPatch(p());
-                const Box<NDIM>& patch_box = patch->getBox();
-                const bool boxes_intersect = patch_box.intersects(integration_box);
-                if (!boxes_intersect) continue;
-
-                // Part of the box on this patch.
-                Box<NDIM> trim_box = patch_box * integration_box;
-
-                // Loop over the box and compute momentum.
-                Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(d_u_idx);
-                Pointer<SideData<NDIM, double> > vol_sc_data = patch->getPatchData(d_vol_wgt_sc_idx);
+                const CellIndex<NDIM>& cell_idx = *b;
+                CellIndex<NDIM> cell_nbr_idx = cell_idx;
+                cell_nbr_idx(axis) += n(axis);
 
-                for (int axis = 0; axis < NDIM; ++axis)
-                {
-                    for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(trim_box, axis)); b; b++)
-                    {
-                        const CellIndex<NDIM>& cell_idx = *b;
-                        const SideIndex<NDIM> side_idx(cell_idx, axis, SideIndex<NDIM>::Lower);
-                        const double& u_axis = (*u_data)(side_idx);
-                        const double& vol = (*vol_sc_data)(side_idx);
-                        double dV;
-
-                        // Check if cell is a CV boundary
-                        const bool lower_bdry_vel = (cell_idx(axis) == (integration_box.lower())(axis));
-                        const bool upper_bdry_vel = (cell_idx(axis) == (integration_box.upper())(axis) + 1);
-
-                        // Check if CV boundary intersects a patch boundary
-                        const bool lower_patch_bdry_eq_box_bdry =
-                            ((patch_box.lower())(axis) == (integration_box.lower())(axis));
-                        const bool upper_patch_bdry_eq_box_bdry =
-                            ((patch_box.upper())(axis) + 1 == (integration_box.upper())(axis) + 1);
-
-                        if (!amr_case)
-                        {
-                            /* Uniform mesh scaling correction
-                             * If the velocity is on the CV boundary, scale the volume element by 1/2
-                             * If the patch boundary equals the CV boundary, then volume element is correct (dx * dy)/2
-                             */
-                            const bool scale_dV = (lower_bdry_vel && !lower_patch_bdry_eq_box_bdry) ||
-                                                  (upper_bdry_vel && !upper_patch_bdry_eq_box_bdry);
-
-                            dV = scale_dV ? 0.5 * vol : vol;
-                        }
-                        else
-                        {
-                            /* Adaptive mesh scaling correction
-                             * If on a CV boundary, set dV to (dx * dy)/2, using the patch grid spacing
-                             * If vol == 0, don't change anything
-                             */
-
-                            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-                            const double* const patch_dx = patch_geom->getDx();
-                            const double box_edge_dV = 0.5 * patch_dx[0] * patch_dx[1]
-#if (NDIM == 3)
-                                                       * patch_dx[2]
-#endif
-                                ;
+                SideIndex<NDIM> bdry_idx(cell_idx, axis, upperlower ? SideIndex<NDIM>::Upper : SideIndex<NDIM>::Lower);
+                const double& dA = (*face_sc_data)(bdry_idx);
 
-                            const bool modify_dV = (lower_bdry_vel || upper_bdry_vel) && vol > 0;
-                            dV = modify_dV ? box_edge_dV : vol;
-                        }
+                // Get the coordinate of the side index and r vector
+                side_coord.setZero();
+                getPhysicalCoordinateFromSideIndex(side_coord, level, patch, bdry_idx, axis);
+                r_vec = side_coord - fobj.r0;
 
-                        fobj.P_box_new(axis) += d_rho * u_axis * dV;
+                IBTK::Vector3d pn = 0.5 * n * ((*p_data)(cell_idx) + (*p_data)(cell_nbr_idx));
 
-                        // Compute angular momentum by looping over all the sides in one axis direction
+                // Pressure force := (n. -p I) * dA
+                trac += -pn * dA;
 
-                        if (axis == 0)
-                        {
-                            // Get the coordinate of the side index and r vector
-                            side_coord.setZero();
-                            getPhysicalCoordinateFromSideIndex(side_coord, level, patch, side_idx, axis);
-                            r_vec = side_coord - fobj.r0;
-                            IBTK::Vector3d u_vec = IBTK::Vector3d::Zero();
-                            u_vec(axis) = u_axis;
-
-                            for (int d = 0; d < NDIM; ++d)
-                            {
-                                if (d == axis) continue;
-
-                                CellIndex<NDIM> cell_left_idx = cell_idx;
-                                cell_left_idx(axis) -= 1;
-                                u_vec(d) =
-                                    0.25 * ((*u_data)(SideIndex<NDIM>(cell_left_idx, d, SideIndex<NDIM>::Lower)) +
-                                            (*u_data)(SideIndex<NDIM>(cell_left_idx, d, SideIndex<NDIM>::Upper)) +
-                                            (*u_data)(SideIndex<NDIM>(cell_idx, d, SideIndex<NDIM>::Lower)) +
-                                            (*u_data)(SideIndex<NDIM>(cell_idx, d, SideIndex<NDIM>::Upper)));
-                            }
+                // Pressure torque := r x (-p n I) * dA
+                torque_trac += r_vec.cross(-pn) * dA;
 
-                            fobj.L_box_new += d_rho * r_vec.cross(u_vec) * dV;
-                        }
+                // Momentum force := (n. -rho*(u)u) * dA
+                IBTK::Vector3d u = IBTK::Vector3d::Zero();
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    if (d == axis)
+                    {
+                        u(d) = (*u_data)(bdry_idx);
+                    }
+                    else
+                    {
+                        u(d) = 0.25 * ((*u_data)(SideIndex<NDIM>(cell_idx, d, SideIndex<NDIM>::Lower)) +
+                                       (*u_data)(SideIndex<NDIM>(cell_idx, d, SideIndex<NDIM>::Upper)) +
+                                       (*u_data)(SideIndex<NDIM>(cell_nbr_idx, d, SideIndex<NDIM>::Lower)) +
+                                       (*u_data)(SideIndex<NDIM>(cell_nbr_idx, d, SideIndex<NDIM>::Upper)));
                     }
                 }
-            }
-        }
-
-        IBTK_MPI::sumReduction(fobj.P_box_new.data(), 3);
-        IBTK_MPI::sumReduction(fobj.L_box_new.data(), 3);
-
-        // Compute surface integral term.
-        IBTK::Vector3d trac, torque_trac;
-        trac.setZero();
-        torque_trac.setZero();
+                trac += -d_rho * n.dot(u) * u * dA;
 
-        for (int ln = finest_ln; ln >= coarsest_ln; --ln)
-        {
-            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
-            Box<NDIM> integration_box(
-                IndexUtilities::getCellIndex(fobj.box_X_lower_new.data(), level->getGridGeometry(), level->getRatio()),
-                IndexUtilities::getCellIndex(fobj.box_X_upper_new.data(), level->getGridGeometry(), level->getRatio()));
+                // Momentum torque := -(n. u) * rho * (r x u) * dA
+                torque_trac += -n.dot(u) * d_rho * r_vec.cross(u) * dA;
 
-            // Shorten the integration box so it only includes the control volume
-            integration_box.upper() -= 1;
-
-            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-            {
-                Pointer<Patch<NDIM> > patch = level->getPatch(p());
-                const Box<NDIM>& patch_box = patch->getBox();
-                const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-                const double* const patch_dx = patch_geom->getDx();
-                const bool boxes_intersect = patch_box.intersects(integration_box);
-                if (!boxes_intersect) continue;
-
-                // Store boxes corresponding to integration domain boundaries.
-                std::array<std::array<Box<NDIM>, 2>, NDIM> bdry_boxes;
-                for (int axis = 0; axis < NDIM; ++axis)
+                // Viscous traction force := n . mu(grad u + grad u ^ T) * dA
+                IBTK::Vector3d viscous_force = IBTK::Vector3d::Zero();
+                for (int d = 0; d < NDIM; ++d)
                 {
-                    Box<NDIM> bdry_box;
-
-                    static const int lower_side = 0;
-                    bdry_box = integration_box;
-                    bdry_box.upper()(axis) = bdry_box.lower()(axis);
-                    bdry_boxes[axis][lower_side] = bdry_box;
-
-                    static const int upper_side = 1;
-                    bdry_box = integration_box;
-                    bdry_box.lower()(axis) = bdry_box.upper()(axis);
-                    bdry_boxes[axis][upper_side] = bdry_box;
-                }
-
-                // Integrate over boundary boxes.
-                Pointer<CellData<NDIM, double> > p_data = patch->getPatchData(d_p_idx);
-                Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(d_u_idx);
-                Pointer<SideData<NDIM, double> > face_sc_data = patch->getPatchData(d_face_wgt_sc_idx);
-                for (int axis = 0; axis < NDIM; ++axis)
-                {
-                    for (int upperlower = 0; upperlower <= 1; ++upperlower)
+                    if (d == axis)
                     {
-                        const Box<NDIM>& side_box = bdry_boxes[axis][upperlower];
-                        if (!patch_box.intersects(side_box)) continue;
-
-                        Box<NDIM> trim_box = patch_box * side_box;
-                        IBTK::Vector3d n = IBTK::Vector3d::Zero();
-                        n(axis) = upperlower ? 1 : -1;
-                        for (Box<NDIM>::Iterator b(trim_box); b; b++)
-                        {
-                            const CellIndex<NDIM>& cell_idx = *b;
-                            CellIndex<NDIM> cell_nbr_idx = cell_idx;
-                            cell_nbr_idx(axis) += n(axis);
-
-                            SideIndex<NDIM> bdry_idx(
-                                cell_idx, axis, upperlower ? SideIndex<NDIM>::Upper : SideIndex<NDIM>::Lower);
-                            const double& dA = (*face_sc_data)(bdry_idx);
-
-                            // Get the coordinate of the side index and r vector
-                            side_coord.setZero();
-                            getPhysicalCoordinateFromSideIndex(side_coord, level, patch, bdry_idx, axis);
-                            r_vec = side_coord - fobj.r0;
-
-                            IBTK::Vector3d pn = 0.5 * n * ((*p_data)(cell_idx) + (*p_data)(cell_nbr_idx));
-
-                            // Pressure force := (n. -p I) * dA
-                            trac += -pn * dA;
-
-                            // Pressure torque := r x (-p n I) * dA
-                            torque_trac += r_vec.cross(-pn) * dA;
-
-                            // Momentum force := (n. -rho*(u)u) * dA
-                            IBTK::Vector3d u = IBTK::Vector3d::Zero();
-                            for (int d = 0; d < NDIM; ++d)
-                            {
-                                if (d == axis)
-                                {
-                                    u(d) = (*u_data)(bdry_idx);
-                                }
-                                else
-                                {
-                                    u(d) = 0.25 * ((*u_data)(SideIndex<NDIM>(cell_idx, d, SideIndex<NDIM>::Lower)) +
-                                                   (*u_data)(SideIndex<NDIM>(cell_idx, d, SideIndex<NDIM>::Upper)) +
-                                                   (*u_data)(SideIndex<NDIM>(cell_nbr_idx, d, SideIndex<NDIM>::Lower)) +
-                                                   (*u_data)(SideIndex<NDIM>(cell_nbr_idx, d, SideIndex<NDIM>::Upper)));
-                                }
-                            }
-                            trac += -d_rho * n.dot(u) * u * dA;
-
-                            // Momentum torque := -(n. u) * rho * (r x u) * dA
-                            torque_trac += -n.dot(u) * d_rho * r_vec.cross(u) * dA;
-
-                            // Viscous traction force := n . mu(grad u + grad u ^ T) * dA
-                            IBTK::Vector3d viscous_force = IBTK::Vector3d::Zero();
-                            for (int d = 0; d < NDIM; ++d)
-                            {
-                                if (d == axis)
-                                {
-                                    viscous_force(axis) =
-                                        n(axis) * (2.0 * d_mu) / (2.0 * patch_dx[axis]) *
-                                        ((*u_data)(SideIndex<NDIM>(cell_nbr_idx,
-                                                                   axis,
-                                                                   upperlower ? SideIndex<NDIM>::Upper :
-                                                                                SideIndex<NDIM>::Lower)) -
-                                         (*u_data)(SideIndex<NDIM>(cell_idx,
-                                                                   axis,
-                                                                   upperlower ? SideIndex<NDIM>::Lower :
-                                                                                SideIndex<NDIM>::Upper)));
-                                }
-                                else
-                                {
-                                    CellIndex<NDIM> offset(0);
-                                    offset(d) = 1;
-
-                                    viscous_force(d) =
-                                        d_mu / (2.0 * patch_dx[d]) *
-                                            ((*u_data)(SideIndex<NDIM>(cell_idx + offset,
-                                                                       axis,
-                                                                       upperlower ? SideIndex<NDIM>::Upper :
-                                                                                    SideIndex<NDIM>::Lower)) -
-                                             (*u_data)(SideIndex<NDIM>(cell_idx - offset,
-                                                                       axis,
-                                                                       upperlower ? SideIndex<NDIM>::Upper :
-                                                                                    SideIndex<NDIM>::Lower)))
-
-                                        +
-
-                                        d_mu * n(axis) / (2.0 * patch_dx[axis]) *
-                                            ((*u_data)(SideIndex<NDIM>(cell_nbr_idx, d, SideIndex<NDIM>::Lower)) +
-                                             (*u_data)(
-                                                 SideIndex<NDIM>(cell_nbr_idx + offset, d, SideIndex<NDIM>::Lower)) -
-                                             (*u_data)(SideIndex<NDIM>(cell_idx, d, SideIndex<NDIM>::Lower)) -
-                                             (*u_data)(SideIndex<NDIM>(cell_idx + offset, d, SideIndex<NDIM>::Lower))
-
-                                            );
-                                }
-                            }
-                            IBTK::Vector3d n_dot_T = n(axis) * viscous_force;
-
-                            trac += n_dot_T * dA;
-
-                            // Viscous traction torque r x ( n . mu(grad u + grad u ^ T) * dA
-                            torque_trac += r_vec.cross(n_dot_T) * dA;
-                        }
+                        viscous_force(axis) =
+                            n(axis) * (2.0 * d_mu) / (2.0 * patch_dx[axis]) *
+                            ((*u_data)(SideIndex<NDIM>(cell_nbr_idx,
+                                                       axis,
+                                                       upperlower ? SideIndex<NDIM>::Upper :
+                                                                    SideIndex<NDIM>::Lower)) -
+                             (*u_data)(SideIndex<NDIM>(cell_idx,
+                                                       axis,
+                                                       upperlower ? SideIndex<NDIM>::Lower :
+                                                                    SideIndex<NDIM>::Upper)));
+                    }
+                    else
+                    {
+                        CellIndex<NDIM> offset(0);
+                        offset(d) = 1;
+
+                        viscous_force(d) =
+                            d_mu / (2.0 * patch_dx[d]) *
+                                ((*u_data)(SideIndex<NDIM>(cell_idx + offset,
+                                                           axis,
+                                                           upperlower ? SideIndex<NDIM>::Upper :
+                                                                        SideIndex<NDIM>::Lower)) -
+                                 (*u_data)(SideIndex<NDIM>(cell_idx - offset,
+                                                           axis,
+                                                           upperlower ? SideIndex<NDIM>::Upper :
+                                                                        SideIndex<NDIM>::Lower)))
+
+                            +
+
+                            d_mu * n(axis) / (2.0 * patch_dx[axis]) *
+                                ((*u_data)(SideIndex<NDIM>(cell_nbr_idx, d, SideIndex<NDIM>::Lower)) +
+                                 (*u_data)(SideIndex<NDIM>(cell_nbr_idx + offset, d, SideIndex<NDIM>::Lower)) -
+                                 (*u_data)(SideIndex<NDIM>(cell_idx, d, SideIndex<NDIM>::Lower)) -
+                                 (*u_data)(SideIndex<NDIM>(cell_idx + offset, d, SideIndex<NDIM>::Lower))
+
+                                );
                     }
                 }
+                IBTK::Vector3d n_dot_T = n(axis) * viscous_force;
+
+                trac += n_dot_T * dA;
+
+                // Viscous traction torque r x ( n . mu(grad u + grad u ^ T) * dA
+                torque_trac += r_vec.cross(n_dot_T) * dA;
             }
         }
         IBTK_MPI::sumReduction(trac.data(), 3);
@@ -1192,6 +912,242 @@ IBHydrodynamicForceEvaluator::resetFaceVolWeight(Pointer<PatchHierarchy<NDIM> >
     return;
 } // resetFaceVolWeight
 
+void
+IBHydrodynamicForceEvaluator::computeBoxMomentumIntegral(const IBHydrodynamicForceObject& fobj,
+                                                         Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                                                         IBTK::Vector3d& P_box,
+                                                         IBTK::Vector3d& L_box)
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+
+    // Whether or not the simulation has adaptive mesh refinement
+    const bool amr_case = (coarsest_ln != finest_ln);
+
+    P_box.setZero();
+    L_box.setZero();
+
+    // Coordinate of the side index and r vector needed for cross product
+    IBTK::Vector3d side_coord, r_vec;
+
+    for (const auto& volume_box : d_cv_volume_boxes[fobj.strct_id])
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(volume_box.level_number);
+        Pointer<Patch<NDIM> > patch = level->getPatch(volume_box.patch_number);
+        const Box<NDIM>& patch_box = patch->getBox();
+        const Box<NDIM>& integration_box = d_cv_integration_boxes[fobj.strct_id][volume_box.level_number];
+
+        // Part of the box on this patch.
+        const Box<NDIM>& trim_box = volume_box.box;
+
+        // Loop over the box and compute momentum.
+        Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(d_u_idx);
+        Pointer<SideData<NDIM, double> > vol_sc_data = patch->getPatchData(d_vol_wgt_sc_idx);
+
+        for (int axis = 0; axis < NDIM; ++axis)
+        {
+            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(trim_box, axis)); b; b++)
+            {
+                const CellIndex<NDIM>& cell_idx = *b;
+                const SideIndex<NDIM> side_idx(cell_idx, axis, SideIndex<NDIM>::Lower);
+                const double& u_axis = (*u_data)(side_idx);
+                const double& vol = (*vol_sc_data)(side_idx);
+                double dV;
+
+                // Check if cell is a CV boundary
+                const bool lower_bdry_vel = (cell_idx(axis) == (integration_box.lower())(axis));
+                const bool upper_bdry_vel = (cell_idx(axis) == (integration_box.upper())(axis) + 1);
+
+                // Check if CV boundary intersects a patch boundary
+                const bool lower_patch_bdry_eq_box_bdry =
+                    ((patch_box.lower())(axis) == (integration_box.lower())(axis));
+                const bool upper_patch_bdry_eq_box_bdry =
+                    ((patch_box.upper())(axis) + 1 == (integration_box.upper())(axis) + 1);
+
+                if (!amr_case)
+                {
+                    /* Uniform mesh scaling correction
+                     * If the velocity is on the CV boundary, scale the volume element by 1/2
+                     * If the patch boundary equals the CV boundary, then volume element is correct (dx * dy)/2
+                     */
+
+                    const bool scale_dV = (lower_bdry_vel && !lower_patch_bdry_eq_box_bdry) ||
+                                          (upper_bdry_vel && !upper_patch_bdry_eq_box_bdry);
+
+                    dV = scale_dV ? 0.5 * vol : vol;
+                }
+                else
+                {
+                    /* Adaptive mesh scaling correction
+                     * If on a CV boundary, set dV to (dx * dy)/2, using the patch grid spacing
+                     * If vol == 0, don't change anything
+                     */
+
+                    const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+                    const double* const patch_dx = patch_geom->getDx();
+                    const double box_edge_dV = 0.5 * patch_dx[0] * patch_dx[1]
+#if (NDIM == 3)
+                                               * patch_dx[2]
+#endif
+                        ;
+
+                    const bool modify_dV = (lower_bdry_vel || upper_bdry_vel) && vol > 0;
+                    dV = modify_dV ? box_edge_dV : vol;
+                }
+
+                P_box(axis) += d_rho * u_axis * dV;
+
+                // Compute angular momentum by looping over all the sides in one axis direction
+
+                if (axis == 0)
+                {
+                    // Get the coordinate of the side index and r vector
+                    side_coord.setZero();
+                    getPhysicalCoordinateFromSideIndex(side_coord, level, patch, side_idx, axis);
+                    r_vec = side_coord - fobj.r0;
+                    IBTK::Vector3d u_vec = IBTK::Vector3d::Zero();
+                    u_vec(axis) = u_axis;
+
+                    for (int d = 0; d < NDIM; ++d)
+                    {
+                        if (d == axis) continue;
+
+                        CellIndex<NDIM> cell_left_idx = cell_idx;
+                        cell_left_idx(axis) -= 1;
+                        u_vec(d) = 0.25 * ((*u_data)(SideIndex<NDIM>(cell_left_idx, d, SideIndex<NDIM>::Lower)) +
+                                           (*u_data)(SideIndex<NDIM>(cell_left_idx, d, SideIndex<NDIM>::Upper)) +
+                                           (*u_data)(SideIndex<NDIM>(cell_idx, d, SideIndex<NDIM>::Lower)) +
+                                           (*u_data)(SideIndex<NDIM>(cell_idx, d, SideIndex<NDIM>::Upper)));
+                    }
+
+                    L_box += d_rho * r_vec.cross(u_vec) * dV;
+                }
+            }
+        }
+    }
+
+    double PL_box[6] = { P_box(0), P_box(1), P_box(2), L_box(0), L_box(1), L_box(2) };
+    IBTK_MPI::sumReduction(PL_box, 6);
+    for (int d = 0; d < 3; ++d)
+    {
+        P_box(d) = PL_box[d];
+        L_box(d) = PL_box[3 + d];
+    }
+    return;
+} // computeBoxMomentumIntegral
+
+bool
+IBHydrodynamicForceEvaluator::resetFaceWeights(Pointer<PatchHierarchy<NDIM> > patch_hierarchy)
+{
+    // The weights only depend on the grid, so they are kept until the
+    // hierarchy is regridded. Regridded levels are new objects on which the
+    // weights have not been allocated yet.
+    const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+    bool weights_are_valid = patch_hierarchy.getPointer() == d_wgt_hierarchy && finest_ln == d_wgt_finest_ln;
+    for (int ln = 0; ln <= finest_ln && weights_are_valid; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        weights_are_valid = level->checkAllocated(d_face_wgt_sc_idx) && level->checkAllocated(d_vol_wgt_sc_idx);
+    }
+    if (weights_are_valid) return false;
+
+    resetFaceAreaWeight(patch_hierarchy);
+    resetFaceVolWeight(patch_hierarchy);
+    d_wgt_hierarchy = patch_hierarchy.getPointer();
+    d_wgt_finest_ln = finest_ln;
+    d_cv_patch_boxes_are_valid = false;
+    return true;
+} // resetFaceWeights
+
+void
+IBHydrodynamicForceEvaluator::resetControlVolumePatchBoxes(Pointer<PatchHierarchy<NDIM> > patch_hierarchy)
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+
+    for (const auto& hydro_obj : d_hydro_objs)
+    {
+        const int strct_id = hydro_obj.first;
+        const IBHydrodynamicForceObject& fobj = hydro_obj.second;
+
+        // Only rebuild the lists when the grid or the control volume changed.
+        auto box_it = d_cv_patch_boxes_X.find(strct_id);
+        if (d_cv_patch_boxes_are_valid && box_it != d_cv_patch_boxes_X.end() &&
+            box_it->second.first == fobj.box_X_lower_new && box_it->second.second == fobj.box_X_upper_new)
+        {
+            continue;
+        }
+        d_cv_patch_boxes_X[strct_id] = std::make_pair(fobj.box_X_lower_new, fobj.box_X_upper_new);
+
+        std::vector<Box<NDIM> >& integration_boxes = d_cv_integration_boxes[strct_id];
+        std::vector<ControlVolumePatchBox>& volume_boxes = d_cv_volume_boxes[strct_id];
+        std::vector<ControlVolumePatchBox>& surface_boxes = d_cv_surface_boxes[strct_id];
+        integration_boxes.resize(finest_ln + 1);
+        volume_boxes.clear();
+        surface_boxes.clear();
+        for (int ln = finest_ln; ln >= coarsest_ln; --ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            Box<NDIM> integration_box(
+                IndexUtilities::getCellIndex(fobj.box_X_lower_new.data(), level->getGridGeometry(), level->getRatio()),
+                IndexUtilities::getCellIndex(fobj.box_X_upper_new.data(), level->getGridGeometry(), level->getRatio()));
+
+            // Shorten the integration box so it only includes the control volume
+            integration_box.upper() -= 1;
+            integration_boxes[ln] = integration_box;
+
+            // Store boxes corresponding to integration domain boundaries.
+            std::array<std::array<Box<NDIM>, 2>, NDIM> bdry_boxes;
+            for (int axis = 0; axis < NDIM; ++axis)
+            {
+                Box<NDIM> bdry_box;
+
+                static const int lower_side = 0;
+                bdry_box = integration_box;
+                bdry_box.upper()(axis) = bdry_box.lower()(axis);
+                bdry_boxes[axis][lower_side] = bdry_box;
+
+                static const int upper_side = 1;
+                bdry_box = integration_box;
+                bdry_box.lower()(axis) = bdry_box.upper()(axis);
+                bdry_boxes[axis][upper_side] = bdry_box;
+            }
+
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                if (!patch_box.intersects(integration_box)) continue;
+
+                ControlVolumePatchBox volume_box;
+                volume_box.level_number = ln;
+                volume_box.patch_number = p();
+                volume_box.box = patch_box * integration_box;
+                volume_boxes.push_back(volume_box);
+
+                for (int axis = 0; axis < NDIM; ++axis)
+                {
+                    for (int upperlower = 0; upperlower <= 1; ++upperlower)
+                    {
+                        const Box<NDIM>& side_box = bdry_boxes[axis][upperlower];
+                        if (!patch_box.intersects(side_box)) continue;
+
+                        ControlVolumePatchBox surface_box;
+                        surface_box.level_number = ln;
+                        surface_box.patch_number = p();
+                        surface_box.axis = axis;
+                        surface_box.upper_lower = upperlower;
+                        surface_box.box = patch_box * side_box;
+                        surface_boxes.push_back(surface_box);
+                    }
+                }
+            }
+        }
+    }
+    d_cv_patch_boxes_are_valid = true;
+    return;
+} // resetControlVolumePatchBoxes
+
 void
 IBHydrodynamicForceEvaluator::fillPatchData(const int u_src_idx,
                                             const int p_src_idx,
@@ -150,6 +150,9 @@ IBImplicitStaggeredHierarchyIntegrator::IBImplicitStaggeredHierarchyIntegrator(
         if (input_db->keyExists("use_structure_predictor"))
             d_use_structure_predictor = input_db->getBool("use_structure_predictor");
         if (input_db->keyExists("jacobian_delta_fcn")) d_jac_delta_fcn = input_db->getString("jacobian_delta_fcn");
+        d_snes_lag_jacobian = input_db->getIntegerWithDefault("snes_lag_jacobian", d_snes_lag_jacobian);
+        d_snes_lag_preconditioner =
+            input_db->getIntegerWithDefault("snes_lag_preconditioner", d_snes_lag_preconditioner);
     }
 
     if (d_use_structure_predictor)
@@ -171,6 +174,22 @@ IBImplicitStaggeredHierarchyIntegrator::IBImplicitStaggeredHierarchyIntegrator(
     return;
 } // IBImplicitStaggeredHierarchyIntegrator
 
+IBImplicitStaggeredHierarchyIntegrator::~IBImplicitStaggeredHierarchyIntegrator()
+{
+    PetscErrorCode ierr;
+    ierr = SNESDestroy(&d_snes);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatDestroy(&d_snes_jac);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPDestroy(&d_schur_solver);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatDestroy(&d_schur_mat);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatDestroy(&d_interp_op);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // ~IBImplicitStaggeredHierarchyIntegrator
+
 void
 IBImplicitStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy(const double current_time,
                                                                      const double new_time,
@@ -205,8 +224,8 @@ IBImplicitStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
         level->allocatePatchData(d_u_idx, current_time);
         level->allocatePatchData(d_f_idx, current_time);
-        level->allocatePatchData(d_scratch_data, current_time);
-        level->allocatePatchData(d_new_data, new_time);
+        allocateLevelPatchData(level, d_scratch_data, current_time);
+        allocateLevelPatchData(level, d_new_data, new_time);
         if (!d_solve_for_position && ln == finest_ln)
         {
             level->allocatePatchData(d_u_dof_index_idx, current_time);
@@ -379,6 +398,112 @@ IBImplicitStaggeredHierarchyIntegrator::getFromRestart()
     return;
 } // getFromRestart
 
+void
+IBImplicitStaggeredHierarchyIntegrator::setupNonlinearSolver(Vec res_vec, Vec sol_vec)
+{
+    PetscErrorCode ierr;
+    const bool create_snes = !d_snes;
+    if (create_snes)
+    {
+        ierr = SNESCreate(PETSC_COMM_WORLD, &d_snes);
+        IBTK_CHKERRQ(ierr);
+        ierr = SNESSetOptionsPrefix(d_snes, "ib_");
+        IBTK_CHKERRQ(ierr);
+        ierr = SNESSetLagJacobian(d_snes, d_snes_lag_jacobian);
+        IBTK_CHKERRQ(ierr);
+        ierr = SNESSetLagPreconditioner(d_snes, d_snes_lag_preconditioner);
+        IBTK_CHKERRQ(ierr);
+
+        // Create the KSP for Jacobian setup for SNES.
+        KSP snes_ksp;
+        ierr = SNESGetKSP(d_snes, &snes_ksp);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetType(snes_ksp, KSPFGMRES);
+        IBTK_CHKERRQ(ierr);
+        PC snes_pc;
+        ierr = KSPGetPC(snes_ksp, &snes_pc);
+        IBTK_CHKERRQ(ierr);
+        ierr = PCSetType(snes_pc, PCSHELL);
+        IBTK_CHKERRQ(ierr);
+        ierr = PCShellSetContext(snes_pc, this);
+        IBTK_CHKERRQ(ierr);
+        ierr = PCShellSetApply(snes_pc, IBPCApply_SAMRAI);
+        IBTK_CHKERRQ(ierr);
+    }
+    ierr = SNESSetFunction(d_snes, res_vec, IBFunction_SAMRAI, this);
+    IBTK_CHKERRQ(ierr);
+
+    // Create the Jacobian for Newton iterations. It is a shell matrix, so it
+    // only needs to be rebuilt when the number of local unknowns changes.
+    int n_local;
+    ierr = VecGetLocalSize(sol_vec, &n_local);
+    IBTK_CHKERRQ(ierr);
+    if (!d_snes_jac || n_local != d_snes_jac_local_size)
+    {
+        ierr = MatDestroy(&d_snes_jac);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatCreateShell(PETSC_COMM_WORLD, n_local, n_local, PETSC_DETERMINE, PETSC_DETERMINE, this, &d_snes_jac);
+        IBTK_CHKERRQ(ierr);
+        ierr = MatShellSetOperation(d_snes_jac, MATOP_MULT, reinterpret_cast<void (*)(void)>(IBJacobianApply_SAMRAI));
+        IBTK_CHKERRQ(ierr);
+        d_snes_jac_local_size = n_local;
+    }
+    ierr = SNESSetJacobian(d_snes, d_snes_jac, d_snes_jac, IBJacobianSetup_SAMRAI, this);
+    IBTK_CHKERRQ(ierr);
+
+    // The options database is only read when the solver is created.
+    if (create_snes)
+    {
+        ierr = SNESSetFromOptions(d_snes);
+        IBTK_CHKERRQ(ierr);
+    }
+    return;
+} // setupNonlinearSolver
+
+void
+IBImplicitStaggeredHierarchyIntegrator::setupSchurSolver(Vec lag_vec)
+{
+    PetscErrorCode ierr;
+    int n_local;
+    ierr = VecGetLocalSize(lag_vec, &n_local);
+    IBTK_CHKERRQ(ierr);
+    if (d_schur_solver && n_local == d_schur_local_size) return;
+
+    ierr = MatDestroy(&d_schur_mat);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatCreateShell(PETSC_COMM_WORLD, n_local, n_local, PETSC_DETERMINE, PETSC_DETERMINE, this, &d_schur_mat);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatShellSetOperation(d_schur_mat, MATOP_MULT, reinterpret_cast<void (*)(void)>(lagrangianSchurApply_SAMRAI));
+    IBTK_CHKERRQ(ierr);
+    d_schur_local_size = n_local;
+    if (d_schur_solver)
+    {
+        // The Krylov work vectors have the old size.
+        ierr = KSPReset(d_schur_solver);
+        IBTK_CHKERRQ(ierr);
+        ierr = KSPSetOperators(d_schur_solver, d_schur_mat, d_schur_mat);
+        IBTK_CHKERRQ(ierr);
+        return;
+    }
+
+    ierr = KSPCreate(PETSC_COMM_WORLD, &d_schur_solver);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetOptionsPrefix(d_schur_solver, "ib_schur_");
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetOperators(d_schur_solver, d_schur_mat, d_schur_mat);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetReusePreconditioner(d_schur_solver, PETSC_TRUE);
+    IBTK_CHKERRQ(ierr);
+    PC schur_pc;
+    ierr = KSPGetPC(d_schur_solver, &schur_pc);
+    IBTK_CHKERRQ(ierr);
+    ierr = PCSetType(schur_pc, PCNONE);
+    IBTK_CHKERRQ(ierr);
+    ierr = KSPSetFromOptions(d_schur_solver);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // setupSchurSolver
+
 void
 IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy_position(const double current_time,
                                                                     const double new_time,
@@ -390,7 +515,6 @@ IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy_position(const double
     TBOX_ASSERT(ins_hier_integrator);
 
     PetscErrorCode ierr;
-    int n_local;
 
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
@@ -461,73 +585,14 @@ IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy_position(const double
     // Solve the implicit IB equations.
     d_ib_implicit_ops->preprocessSolveFluidEquations(current_time, new_time, cycle_num);
 
-    SNES snes;
-    ierr = SNESCreate(PETSC_COMM_WORLD, &snes);
-    IBTK_CHKERRQ(ierr);
-    ierr = SNESSetFunction(snes, composite_res_petsc_vec, IBFunction_SAMRAI, this);
-    IBTK_CHKERRQ(ierr);
-    ierr = SNESSetOptionsPrefix(snes, "ib_");
-    IBTK_CHKERRQ(ierr);
-
-    Mat jac;
-    ierr = VecGetLocalSize(composite_sol_petsc_vec, &n_local);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatCreateShell(PETSC_COMM_WORLD, n_local, n_local, PETSC_DETERMINE, PETSC_DETERMINE, this, &jac);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatShellSetOperation(jac, MATOP_MULT, reinterpret_cast<void (*)(void)>(IBJacobianApply_SAMRAI));
-    IBTK_CHKERRQ(ierr);
-    ierr = SNESSetJacobian(snes, jac, jac, IBJacobianSetup_SAMRAI, this);
-    IBTK_CHKERRQ(ierr);
-
-    Mat schur;
-    ierr = VecGetLocalSize(lag_sol_petsc_vec, &n_local);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatCreateShell(PETSC_COMM_WORLD, n_local, n_local, PETSC_DETERMINE, PETSC_DETERMINE, this, &schur);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatShellSetOperation(schur, MATOP_MULT, reinterpret_cast<void (*)(void)>(lagrangianSchurApply_SAMRAI));
-    IBTK_CHKERRQ(ierr);
-    ierr = KSPCreate(PETSC_COMM_WORLD, &d_schur_solver);
-    IBTK_CHKERRQ(ierr);
-    ierr = KSPSetOptionsPrefix(d_schur_solver, "ib_schur_");
-    IBTK_CHKERRQ(ierr);
-    ierr = KSPSetOperators(d_schur_solver, schur, schur);
-    IBTK_CHKERRQ(ierr);
-    ierr = KSPSetReusePreconditioner(d_schur_solver, PETSC_TRUE);
-    IBTK_CHKERRQ(ierr);
-    PC schur_pc;
-    ierr = KSPGetPC(d_schur_solver, &schur_pc);
-    IBTK_CHKERRQ(ierr);
-    ierr = PCSetType(schur_pc, PCNONE);
-    IBTK_CHKERRQ(ierr);
-    ierr = KSPSetFromOptions(d_schur_solver);
-    IBTK_CHKERRQ(ierr);
-
-    KSP snes_ksp;
-    ierr = SNESGetKSP(snes, &snes_ksp);
-    IBTK_CHKERRQ(ierr);
-    ierr = KSPSetType(snes_ksp, KSPFGMRES);
-    IBTK_CHKERRQ(ierr);
-    PC snes_pc;
-    ierr = KSPGetPC(snes_ksp, &snes_pc);
-    IBTK_CHKERRQ(ierr);
-    ierr = PCSetType(snes_pc, PCSHELL);
-    IBTK_CHKERRQ(ierr);
-    ierr = PCShellSetContext(snes_pc, this);
-    IBTK_CHKERRQ(ierr);
-    ierr = PCShellSetApply(snes_pc, IBPCApply_SAMRAI);
+    setupNonlinearSolver(composite_res_petsc_vec, composite_sol_petsc_vec);
+    setupSchurSolver(lag_sol_petsc_vec);
+    ierr = SNESSolve(d_snes, composite_rhs_petsc_vec, composite_sol_petsc_vec);
     IBTK_CHKERRQ(ierr);
 
-    ierr = SNESSetFromOptions(snes);
-    IBTK_CHKERRQ(ierr);
-    ierr = SNESSolve(snes, composite_rhs_petsc_vec, composite_sol_petsc_vec);
-    IBTK_CHKERRQ(ierr);
-    ierr = SNESDestroy(&snes);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatDestroy(&jac);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatDestroy(&schur);
-    IBTK_CHKERRQ(ierr);
-    ierr = KSPDestroy(&d_schur_solver);
+    // Release the vectors of this time step (they are destroyed below) but
+    // keep the solver configuration.
+    ierr = SNESReset(d_snes);
     IBTK_CHKERRQ(ierr);
 
     d_ib_implicit_ops->postprocessSolveFluidEquations(current_time, new_time, cycle_num);
@@ -571,7 +636,6 @@ IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy_velocity(const double
     TBOX_ASSERT(ins_hier_integrator);
 
     PetscErrorCode ierr;
-    int n_local;
 
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
@@ -642,10 +706,11 @@ IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy_velocity(const double
     stokes_fac_op->setIBTimeSteppingType(d_time_stepping_type);
     d_ib_implicit_ops->constructLagrangianForceJacobian(elastic_op, MATAIJ, data_time);
     stokes_fac_op->setIBForceJacobian(elastic_op);
-    Mat interp_op = nullptr;
+    // The interpolation operator is kept between time steps so that only its
+    // weights need to be updated while the structure stays in the same cells.
     if (d_jac_delta_fcn == "IB_4")
     {
-        d_ib_implicit_ops->constructInterpOp(interp_op,
+        d_ib_implicit_ops->constructInterpOp(d_interp_op,
                                              ib_4_interp_fcn,
                                              ib_4_interp_stencil,
                                              d_num_dofs_per_proc[finest_ln],
@@ -654,7 +719,7 @@ IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy_velocity(const double
     }
     else if (d_jac_delta_fcn == "PIECEWISE_LINEAR")
     {
-        d_ib_implicit_ops->constructInterpOp(interp_op,
+        d_ib_implicit_ops->constructInterpOp(d_interp_op,
                                              pwl_interp_fcn,
                                              pwl_interp_stencil,
                                              d_num_dofs_per_proc[finest_ln],
@@ -666,7 +731,7 @@ IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy_velocity(const double
         TBOX_ERROR("IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy_velocity()."
                    << " Delta function " << d_jac_delta_fcn << " is not supported in creating Jacobian." << std::endl);
     }
-    stokes_fac_op->setIBInterpOp(interp_op);
+    stokes_fac_op->setIBInterpOp(d_interp_op);
     stokes_fac_pc->initializeSolverState(*eul_sol_vec, *eul_rhs_vec);
 
     // Indicate that the current approximation to position of the structure
@@ -687,50 +752,14 @@ IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy_velocity(const double
     Vec eul_rhs_petsc_vec = PETScSAMRAIVectorReal::createPETScVector(eul_rhs_vec, PETSC_COMM_WORLD);
     Vec eul_res_petsc_vec = PETScSAMRAIVectorReal::createPETScVector(d_f_scratch_vec, PETSC_COMM_WORLD);
 
-    // Create the outer nonlinear solver.
-    SNES snes;
-    ierr = SNESCreate(PETSC_COMM_WORLD, &snes);
-    IBTK_CHKERRQ(ierr);
-    ierr = SNESSetFunction(snes, eul_res_petsc_vec, IBFunction_SAMRAI, this);
-    IBTK_CHKERRQ(ierr);
-    ierr = SNESSetOptionsPrefix(snes, "ib_");
-    IBTK_CHKERRQ(ierr);
-
-    // Create the Jacobian for Newton iterations.
-    Mat jac;
-    ierr = VecGetLocalSize(eul_sol_petsc_vec, &n_local);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatCreateShell(PETSC_COMM_WORLD, n_local, n_local, PETSC_DETERMINE, PETSC_DETERMINE, this, &jac);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatShellSetOperation(jac, MATOP_MULT, reinterpret_cast<void (*)(void)>(IBJacobianApply_SAMRAI));
-    IBTK_CHKERRQ(ierr);
-    ierr = SNESSetJacobian(snes, jac, jac, IBJacobianSetup_SAMRAI, this);
-    IBTK_CHKERRQ(ierr);
-
-    // Create the KSP for Jacobian setup for SNES.
-    KSP snes_ksp;
-    ierr = SNESGetKSP(snes, &snes_ksp);
-    IBTK_CHKERRQ(ierr);
-    ierr = KSPSetType(snes_ksp, KSPFGMRES);
-    IBTK_CHKERRQ(ierr);
-    PC snes_pc;
-    ierr = KSPGetPC(snes_ksp, &snes_pc);
-    IBTK_CHKERRQ(ierr);
-    ierr = PCSetType(snes_pc, PCSHELL);
-    IBTK_CHKERRQ(ierr);
-    ierr = PCShellSetContext(snes_pc, this);
-    IBTK_CHKERRQ(ierr);
-    ierr = PCShellSetApply(snes_pc, IBPCApply_SAMRAI);
+    // Set up the outer nonlinear solver and solve the system.
+    setupNonlinearSolver(eul_res_petsc_vec, eul_sol_petsc_vec);
+    ierr = SNESSolve(d_snes, eul_rhs_petsc_vec, eul_sol_petsc_vec);
     IBTK_CHKERRQ(ierr);
 
-    // Solve the system.
-    ierr = SNESSetFromOptions(snes);
-    IBTK_CHKERRQ(ierr);
-    ierr = SNESSolve(snes, eul_rhs_petsc_vec, eul_sol_petsc_vec);
-    IBTK_CHKERRQ(ierr);
-    ierr = SNESDestroy(&snes);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatDestroy(&jac);
+    // Release the vectors of this time step (they are destroyed below) but
+    // keep the solver configuration.
+    ierr = SNESReset(d_snes);
     IBTK_CHKERRQ(ierr);
 
     d_stokes_op->imposeSolBcs(*eul_sol_vec);
@@ -804,8 +833,6 @@ IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy_velocity(const double
     stokes_fac_op->deallocateOperatorState();
     ierr = MatDestroy(&elastic_op);
     IBTK_CHKERRQ(ierr);
-    ierr = MatDestroy(&interp_op);
-    IBTK_CHKERRQ(ierr);
 
     // Execute any registered callbacks.
     executeIntegrateHierarchyCallbackFcns(current_time, new_time, cycle_num);
@@ -66,6 +66,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <cmath>
 #include <fstream>
 #include <limits>
+#include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
@@ -222,6 +223,21 @@ compute_flow_correction(const boost::multi_array<Vector, 1>& U_perimeter,
     return U_dot_dA;
 } // compute_flow_correction
 
+// Append the keys of the map that are contained within the patch box. The maps
+// are ordered by the first index component, so only the entries between the
+// lower and upper corners of the box need to be examined.
+template <class MapType>
+void
+collect_patch_cells(const MapType& map, const Box<NDIM>& patch_box, std::vector<hier::Index<NDIM> >& cells)
+{
+    const auto end = map.upper_bound(patch_box.upper());
+    for (auto it = map.lower_bound(patch_box.lower()); it != end; ++it)
+    {
+        if (patch_box.contains(it->first)) cells.push_back(it->first);
+    }
+    return;
+} // collect_patch_cells
+
 #if defined(IBAMR_HAVE_SILO)
 /*!
  * \brief Build a local mesh database entry corresponding to a meter web.
@@ -520,6 +536,9 @@ IBInstrumentPanel::IBInstrumentPanel(std::string object_name, Pointer<Database>
 
 IBInstrumentPanel::~IBInstrumentPanel()
 {
+    // Complete any outstanding reduction so that the final values are logged.
+    completeInstrumentData();
+
     // Close the log file stream.
     if (IBTK_MPI::getRank() == 0)
     {
@@ -543,18 +562,27 @@ IBInstrumentPanel::getInstrumentDataReadTime() const
 const std::vector<double>&
 IBInstrumentPanel::getFlowValues() const
 {
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!d_reduction_pending);
+#endif
     return d_flow_values;
 } // getFlowValues
 
 const std::vector<double>&
 IBInstrumentPanel::getMeanPressureValues() const
 {
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!d_reduction_pending);
+#endif
     return d_mean_pres_values;
 } // getMeanPressureValues
 
 const std::vector<double>&
 IBInstrumentPanel::getPointwisePressureValues() const
 {
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!d_reduction_pending);
+#endif
     return d_point_pres_values;
 } // getPointwisePressureValues
 
@@ -697,6 +725,10 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
     }
     if (d_num_meters == 0) return;
 
+    // The perimeter positions are needed to complete any outstanding
+    // reduction of the instrument data.
+    completeInstrumentData();
+
     IBAMR_TIMER_START(t_initialize_hierarchy_dependent_data);
 
     const int coarsest_ln = 0;
@@ -908,6 +940,32 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
         }
     }
 
+    // Determine the cells of each local patch that are associated with any web
+    // patch or web centroid, so that readInstrumentData() only needs to visit
+    // those cells. The cells are ordered in the same way as Box::Iterator
+    // visits them.
+    d_patch_meter_cells.clear();
+    d_patch_meter_cells.resize(finest_ln + 1);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const Box<NDIM>& patch_box = level->getPatch(p())->getBox();
+            std::vector<hier::Index<NDIM> >& cells = d_patch_meter_cells[ln][p()];
+            collect_patch_cells(d_web_patch_map[ln], patch_box, cells);
+            collect_patch_cells(d_web_centroid_map[ln], patch_box, cells);
+            std::sort(cells.begin(), cells.end(), [](const hier::Index<NDIM>& lhs, const hier::Index<NDIM>& rhs) {
+                for (int d = NDIM - 1; d >= 0; --d)
+                {
+                    if (lhs(d) != rhs(d)) return lhs(d) < rhs(d);
+                }
+                return false;
+            });
+            cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+        }
+    }
+
     IBAMR_TIMER_STOP(t_initialize_hierarchy_dependent_data);
     return;
 } // initializeHierarchyDependentData
@@ -922,6 +980,8 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
 {
     if (d_num_meters == 0) return;
 
+    completeInstrumentData();
+
     IBAMR_TIMER_START(t_read_instrument_data);
 
     const int coarsest_ln = 0;
@@ -971,9 +1031,8 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
             Pointer<SideData<NDIM, double> > U_sc_data = patch->getPatchData(U_data_idx);
             Pointer<CellData<NDIM, double> > P_cc_data = patch->getPatchData(P_data_idx);
 
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            for (const hier::Index<NDIM>& i : d_patch_meter_cells[ln][p()])
             {
-                const hier::Index<NDIM>& i = b();
                 std::pair<WebPatchMap::const_iterator, WebPatchMap::const_iterator> patch_range =
                     d_web_patch_map[ln].equal_range(i);
                 if (patch_range.first != patch_range.second)
@@ -1051,18 +1110,6 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
         }
     }
 
-    // Synchronize the values across all processes.
-    IBTK_MPI::sumReduction(&d_flow_values[0], d_num_meters);
-    IBTK_MPI::sumReduction(&d_mean_pres_values[0], d_num_meters);
-    IBTK_MPI::sumReduction(&d_point_pres_values[0], d_num_meters);
-    IBTK_MPI::sumReduction(&A[0], d_num_meters);
-
-    // Normalize the mean pressure.
-    for (unsigned int m = 0; m < d_num_meters; ++m)
-    {
-        d_mean_pres_values[m] /= A[m];
-    }
-
     // Loop over all local nodes to determine the velocities of the local
     // perimeter nodes.
     std::vector<boost::multi_array<Vector, 1> > U_perimeter(d_num_meters);
@@ -1107,26 +1154,87 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
         }
     }
 
-    // Set the velocities of all perimeter nodes on all processes.
-    std::vector<double> U_perimeter_flattened;
+    // Pack the local contributions into a single buffer so that all of the
+    // values are synchronized across all processes by one reduction.
+    const std::size_t num_perimeter_values =
+        NDIM * std::accumulate(d_num_perimeter_nodes.begin(), d_num_perimeter_nodes.end(), std::size_t(0));
+    d_reduction_buffer.resize(4 * d_num_meters + num_perimeter_values);
+    auto buffer_it = d_reduction_buffer.begin();
+    buffer_it = std::copy(d_flow_values.begin(), d_flow_values.end(), buffer_it);
+    buffer_it = std::copy(d_mean_pres_values.begin(), d_mean_pres_values.end(), buffer_it);
+    buffer_it = std::copy(d_point_pres_values.begin(), d_point_pres_values.end(), buffer_it);
+    buffer_it = std::copy(A.begin(), A.end(), buffer_it);
     for (unsigned int m = 0; m < d_num_meters; ++m)
     {
         for (int n = 0; n < d_num_perimeter_nodes[m]; ++n)
         {
-            U_perimeter_flattened.insert(
-                U_perimeter_flattened.end(), U_perimeter[m][n].data(), U_perimeter[m][n].data() + NDIM);
+            buffer_it = std::copy(U_perimeter[m][n].data(), U_perimeter[m][n].data() + NDIM, buffer_it);
         }
     }
-    IBTK_MPI::sumReduction(&U_perimeter_flattened[0], static_cast<int>(U_perimeter_flattened.size()));
-    for (unsigned int m = 0, k = 0; m < d_num_meters; ++m)
+    d_reduction_pending = true;
+#if (MPI_VERSION >= 3)
+    if (d_use_nonblocking_reductions)
     {
-        for (int n = 0; n < d_num_perimeter_nodes[m]; ++n, ++k)
+        // The reduction is completed by completeInstrumentData().
+        MPI_Iallreduce(MPI_IN_PLACE,
+                       d_reduction_buffer.data(),
+                       static_cast<int>(d_reduction_buffer.size()),
+                       MPI_DOUBLE,
+                       MPI_SUM,
+                       IBTK_MPI::getCommunicator(),
+                       &d_reduction_request);
+        IBAMR_TIMER_STOP(t_read_instrument_data);
+        return;
+    }
+#endif
+    IBTK_MPI::sumReduction(d_reduction_buffer.data(), static_cast<int>(d_reduction_buffer.size()));
+    completeInstrumentData();
+
+    IBAMR_TIMER_STOP(t_read_instrument_data);
+    return;
+} // readInstrumentData
+
+bool
+IBInstrumentPanel::hasPendingInstrumentData() const
+{
+    return d_reduction_pending;
+} // hasPendingInstrumentData
+
+void
+IBInstrumentPanel::completeInstrumentData()
+{
+    if (!d_reduction_pending) return;
+    d_reduction_pending = false;
+#if (MPI_VERSION >= 3)
+    if (d_reduction_request != MPI_REQUEST_NULL) MPI_Wait(&d_reduction_request, MPI_STATUS_IGNORE);
+#endif
+
+    // Unpack the synchronized values.
+    auto buffer_it = d_reduction_buffer.cbegin();
+    std::copy(buffer_it, buffer_it + d_num_meters, d_flow_values.begin());
+    buffer_it += d_num_meters;
+    std::copy(buffer_it, buffer_it + d_num_meters, d_mean_pres_values.begin());
+    buffer_it += d_num_meters;
+    std::copy(buffer_it, buffer_it + d_num_meters, d_point_pres_values.begin());
+    buffer_it += d_num_meters;
+    const std::vector<double> A(buffer_it, buffer_it + d_num_meters);
+    buffer_it += d_num_meters;
+    std::vector<boost::multi_array<Vector, 1> > U_perimeter(d_num_meters);
+    for (unsigned int m = 0; m < d_num_meters; ++m)
+    {
+        U_perimeter[m].resize(boost::extents[d_num_perimeter_nodes[m]]);
+        for (int n = 0; n < d_num_perimeter_nodes[m]; ++n, buffer_it += NDIM)
         {
-            std::copy(
-                &U_perimeter_flattened[NDIM * k], (&U_perimeter_flattened[NDIM * k]) + NDIM, U_perimeter[m][n].data());
+            std::copy(buffer_it, buffer_it + NDIM, U_perimeter[m][n].data());
         }
     }
 
+    // Normalize the mean pressure.
+    for (unsigned int m = 0; m < d_num_meters; ++m)
+    {
+        d_mean_pres_values[m] /= A[m];
+    }
+
     // Determine the velocity of the centroid of each perimeter.
     std::vector<Vector> U_centroid(d_num_meters, Vector::Zero());
     for (unsigned int m = 0; m < d_num_meters; ++m)
@@ -1166,9 +1274,8 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
         d_log_file_stream.flush();
     }
 
-    IBAMR_TIMER_STOP(t_read_instrument_data);
     return;
-} // readInstrumentData
+} // completeInstrumentData
 
 void
 IBInstrumentPanel::setPlotDirectory(const std::string& plot_directory_name)
@@ -1347,6 +1454,8 @@ IBInstrumentPanel::getFromInput(Pointer<Database> db)
     if (db->keyExists("pres_conv")) d_pres_conv = db->getDouble("pres_conv");
     if (db->keyExists("flow_units")) d_flow_units = db->getString("flow_units");
     if (db->keyExists("pres_units")) d_pres_units = db->getString("pres_units");
+    if (db->keyExists("use_nonblocking_reductions"))
+        d_use_nonblocking_reductions = db->getBool("use_nonblocking_reductions");
     return;
 } // getFromInput
 
@@ -112,8 +112,8 @@ IBInterpolantHierarchyIntegrator::preprocessIntegrateHierarchy(const double curr
     for (int level_num = coarsest_level_num; level_num <= finest_level_num; ++level_num)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
-        level->allocatePatchData(d_scratch_data, current_time);
-        level->allocatePatchData(d_new_data, new_time);
+        allocateLevelPatchData(level, d_scratch_data, current_time);
+        allocateLevelPatchData(level, d_new_data, new_time);
     }
 
     // Initialize IB data.
@@ -40,7 +40,6 @@
 
 IBTK_DISABLE_EXTRA_WARNINGS
 #include "Eigen/Geometry"
-#include "unsupported/Eigen/MatrixFunctions"
 IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <algorithm>
@@ -384,39 +383,39 @@ IBKirchhoffRodForceGen::computeLagrangianForceAndTorque(Pointer<LData> F_data,
     std::vector<double> F_next_node_vals(NDIM * local_sz, 0.0);
     std::vector<double> N_next_node_vals(NDIM * local_sz, 0.0);
 
-    for (unsigned int k = 0; k < local_sz; ++k)
+    // Each rod writes only to its own entries of the force and torque arrays,
+    // so the rods can be processed concurrently.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (d_use_threaded_force_evaluation)
+#endif
+    for (int k = 0; k < static_cast<int>(local_sz); ++k)
     {
         // Compute the forces applied by the rod to the "current" and "next"
         // nodes.
-        const int D1_offset = 0;
-        Eigen::Map<const Vector3d> D1(&D_vals[(petsc_curr_node_idxs[k] - global_offset) * 3 * 3 + D1_offset]);
-        Eigen::Map<const Vector3d> D1_next(&D_next_vals[k * 3 * 3 + D1_offset]);
-
-        const int D2_offset = 3;
-        Eigen::Map<const Vector3d> D2(&D_vals[(petsc_curr_node_idxs[k] - global_offset) * 3 * 3 + D2_offset]);
-        Eigen::Map<const Vector3d> D2_next(&D_next_vals[k * 3 * 3 + D2_offset]);
+        const int curr_local_idx = petsc_curr_node_idxs[k] - global_offset;
 
-        const int D3_offset = 6;
-        Eigen::Map<const Vector3d> D3(&D_vals[(petsc_curr_node_idxs[k] - global_offset) * 3 * 3 + D3_offset]);
-        Eigen::Map<const Vector3d> D3_next(&D_next_vals[k * 3 * 3 + D3_offset]);
+        // The columns of D and D_next are the director triads at the
+        // "current" and "next" nodes.
+        Eigen::Map<const Matrix3d> D(&D_vals[curr_local_idx * 3 * 3]);
+        Eigen::Map<const Matrix3d> D_next(&D_next_vals[k * 3 * 3]);
+        const auto D1 = D.col(0), D2 = D.col(1), D3 = D.col(2);
+        const auto D1_next = D_next.col(0), D2_next = D_next.col(1), D3_next = D_next.col(2);
 
-        Eigen::Map<const Vector3d> X(&X_vals[(petsc_curr_node_idxs[k] - global_offset) * NDIM]);
+        Eigen::Map<const Vector3d> X(&X_vals[curr_local_idx * NDIM]);
         Eigen::Map<const Vector3d> X_next(&X_next_vals[k * NDIM]);
 
-        std::array<Eigen::Map<const Vector3d>*, 3> D = { { &D1, &D2, &D3 } };
-        std::array<Eigen::Map<const Vector3d>*, 3> D_next = { { &D1_next, &D2_next, &D3_next } };
-        Matrix3d A(Matrix3d::Zero());
-        for (int i = 0; i < 3; ++i)
-        {
-            A += (*D_next[i]) * (*D[i]).transpose();
-        }
-        Matrix3d sqrt_A = A.sqrt();
-        Vector3d D1_half, D2_half, D3_half;
-        std::array<Vector3d*, 3> D_half = { { &D1_half, &D2_half, &D3_half } };
-        for (int i = 0; i < 3; ++i)
-        {
-            *D_half[i] = sqrt_A * (*D[i]);
-        }
+        // A = D_next D^T is the rotation that maps the "current" triad to the
+        // "next" triad, and the triad at the midpoint of the rod is obtained by
+        // applying the principal square root of A, i.e., the rotation about the
+        // same axis by half the angle.  We compute it from the unit quaternion
+        // representation of A instead of via a general matrix square root.
+        const Matrix3d A = D_next * D.transpose();
+        Eigen::Quaterniond q(A);
+        if (q.w() < 0.0) q.coeffs() = -q.coeffs();
+        q.w() += 1.0;
+        q.normalize();
+        const Matrix3d D_half = q.toRotationMatrix() * D;
+        const auto D1_half = D_half.col(0), D2_half = D_half.col(1), D3_half = D_half.col(2);
 
         const double ds = material_params[k][0];
         const double a1 = material_params[k][1];
@@ -521,7 +520,8 @@ IBKirchhoffRodForceGen::getFromInput(Pointer<Database> db)
 {
     if (db)
     {
-        // intentionally blank
+        if (db->keyExists("use_threaded_force_evaluation"))
+            d_use_threaded_force_evaluation = db->getBool("use_threaded_force_evaluation");
     }
     return;
 } // getFromInput
@@ -35,6 +35,7 @@
 #include "ibtk/LNode.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/PETScMatUtilities.h"
+#include "ibtk/TelemetryManager.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/private/IndexUtilities-inl.h"
 #include "ibtk/private/LData-inl.h"
@@ -175,6 +176,19 @@ IBMethod::IBMethod(std::string object_name, Pointer<Database> input_db, bool reg
                                                 d_registered_for_restart);
     d_ghosts = d_l_data_manager->getGhostCellWidth();
 
+    // Data that are only interpolated (or only spread) are not padded for the
+    // wider of the two kernels. Any additional ghost cells requested in the
+    // input database are kept for both.
+    const int interp_kernel_width = LEInteractor::getMinimumGhostWidth(d_interp_kernel_fcn);
+    const int spread_kernel_width = LEInteractor::getMinimumGhostWidth(d_spread_kernel_fcn);
+    const int max_kernel_width = std::max(interp_kernel_width, spread_kernel_width);
+    d_interp_ghosts = d_ghosts - IntVector<NDIM>(max_kernel_width - interp_kernel_width);
+    d_spread_ghosts = d_ghosts - IntVector<NDIM>(max_kernel_width - spread_kernel_width);
+    d_l_data_manager->setSortLocalIndicesByCell(d_sort_local_indices_by_cell);
+    d_l_data_manager->setSortLocalNodesByCell(d_sort_local_nodes_by_cell);
+    d_l_data_manager->setWorkloadCalibration(d_calibrate_workload, d_workload_relaxation);
+    d_l_data_manager->setUseWeightCache(d_cache_interaction_weights);
+
     // Create the instrument panel object.
     d_instrument_panel =
         new IBInstrumentPanel(d_object_name + "::IBInstrumentPanel",
@@ -274,6 +288,18 @@ IBMethod::getMinimumGhostCellWidth() const
     return d_ghosts;
 } // getMinimumGhostCellWidth
 
+const IntVector<NDIM>&
+IBMethod::getMinimumInterpolationGhostCellWidth() const
+{
+    return d_interp_ghosts;
+} // getMinimumInterpolationGhostCellWidth
+
+const IntVector<NDIM>&
+IBMethod::getMinimumSpreadingGhostCellWidth() const
+{
+    return d_spread_ghosts;
+} // getMinimumSpreadingGhostCellWidth
+
 void
 IBMethod::setupTagBuffer(Array<int>& tag_buffer, Pointer<GriddingAlgorithm<NDIM> > gridding_alg) const
 {
@@ -373,21 +399,32 @@ IBMethod::preprocessIntegrateData(double current_time, double new_time, int /*nu
         d_X_LE_new_data.resize(finest_ln + 1);
         d_X_LE_half_data.resize(finest_ln + 1);
     }
+    if (d_scratch_l_data_needs_reinit)
+    {
+        d_scratch_l_data.clear();
+        d_scratch_l_data_needs_reinit = false;
+    }
+    auto get_scratch_data = [&](const std::string& quantity_name, const int ln) {
+        std::vector<Pointer<LData> >& scratch_data = d_scratch_l_data[quantity_name];
+        if (static_cast<int>(scratch_data.size()) <= ln) scratch_data.resize(ln + 1);
+        if (!scratch_data[ln]) scratch_data[ln] = d_l_data_manager->createLData(quantity_name, ln, NDIM);
+        return scratch_data[ln];
+    };
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
         d_X_current_data[ln] = d_l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
-        d_X_new_data[ln] = d_l_data_manager->createLData("X_new", ln, NDIM);
-        d_X_half_data[ln] = d_l_data_manager->createLData("X_half", ln, NDIM);
+        d_X_new_data[ln] = get_scratch_data("X_new", ln);
+        d_X_half_data[ln] = get_scratch_data("X_half", ln);
         d_U_current_data[ln] = d_l_data_manager->getLData(LDataManager::VEL_DATA_NAME, ln);
-        d_U_new_data[ln] = d_l_data_manager->createLData("U_new", ln, NDIM);
-        d_U_half_data[ln] = d_l_data_manager->createLData("U_half", ln, NDIM);
+        d_U_new_data[ln] = get_scratch_data("U_new", ln);
+        d_U_half_data[ln] = get_scratch_data("U_half", ln);
         d_F_current_data[ln] = d_l_data_manager->getLData("F", ln);
-        d_F_half_data[ln] = d_l_data_manager->createLData("F_half", ln, NDIM);
+        d_F_half_data[ln] = get_scratch_data("F_half", ln);
         if (d_use_fixed_coupling_ops)
         {
-            d_X_LE_new_data[ln] = d_l_data_manager->createLData("X_LE_new", ln, NDIM);
-            d_X_LE_half_data[ln] = d_l_data_manager->createLData("X_LE_half", ln, NDIM);
+            d_X_LE_new_data[ln] = get_scratch_data("X_LE_new", ln);
+            d_X_LE_half_data[ln] = get_scratch_data("X_LE_half", ln);
         }
 
         // Initialize X^{n+1} and X^{n+1/2} to equal X^{n}, and initialize U^{n+1}
@@ -427,19 +464,15 @@ IBMethod::postprocessIntegrateData(double current_time, double new_time, int /*n
     const double dt = new_time - current_time;
     const int integrator_step = d_ib_solver->getIntegratorStep();
 
-    // Update the instrumentation data.
+    // Update the instrumentation data. If the instrument values from the
+    // previous time step were still being synchronized, their contribution to
+    // the flow volume is added first.
+    if (d_pending_flow_volume_dt > 0.0) updateTotalFlowVolume();
     updateIBInstrumentationData(integrator_step + 1, new_time);
     if (d_instrument_panel->isInstrumented())
     {
-        const std::vector<std::string>& instrument_name = d_instrument_panel->getInstrumentNames();
-        const std::vector<double>& flow_data = d_instrument_panel->getFlowValues();
-        for (unsigned int m = 0; m < flow_data.size(); ++m)
-        {
-            // NOTE: Flow volume is calculated in default units.
-            d_total_flow_volume[m] += flow_data[m] * dt;
-            if (d_do_log)
-                plog << "flow volume through " << instrument_name[m] << ":\t " << d_total_flow_volume[m] << "\n";
-        }
+        d_pending_flow_volume_dt = dt;
+        if (!d_instrument_panel->hasPendingInstrumentData()) updateTotalFlowVolume();
     }
 
     // Reset time-dependent Lagrangian data.
@@ -679,6 +712,7 @@ IBMethod::interpolateVelocity(const int u_data_idx,
                               const std::vector<Pointer<RefineSchedule<NDIM> > >& u_ghost_fill_scheds,
                               const double data_time)
 {
+    TelemetryManager::ScopedPhase interp_phase("interp");
     std::vector<Pointer<LData> >*U_data, *X_LE_data;
     bool* X_LE_needs_ghost_fill;
     getVelocityData(&U_data, data_time);
@@ -838,6 +872,7 @@ IBMethod::hasFluidSources() const
 void
 IBMethod::computeLagrangianForce(const double data_time)
 {
+    TelemetryManager::ScopedPhase force_phase("force");
     int ierr;
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
@@ -846,9 +881,11 @@ IBMethod::computeLagrangianForce(const double data_time)
     getForceData(&F_data, &F_needs_ghost_fill, data_time);
     getPositionData(&X_data, &X_needs_ghost_fill, data_time);
     getVelocityData(&U_data, data_time);
+    int num_local_nodes = 0;
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        num_local_nodes += d_l_data_manager->getNumberOfLocalNodes(ln);
         ierr = VecSet((*F_data)[ln]->getVec(), 0.0);
         IBTK_CHKERRQ(ierr);
         if (d_ib_force_fcn)
@@ -858,6 +895,7 @@ IBMethod::computeLagrangianForce(const double data_time)
         }
     }
     *F_needs_ghost_fill = true;
+    TelemetryManager::getManager()->setMetric("lagrangian_nodes", num_local_nodes);
     return;
 } // computeLagrangianForce
 
@@ -979,6 +1017,7 @@ IBMethod::spreadForce(const int f_data_idx,
                       const std::vector<Pointer<RefineSchedule<NDIM> > >& f_prolongation_scheds,
                       const double data_time)
 {
+    TelemetryManager::ScopedPhase spread_phase("spread");
     std::vector<Pointer<LData> >*F_data, *X_LE_data;
     bool *F_needs_ghost_fill, *X_LE_needs_ghost_fill;
     getForceData(&F_data, &F_needs_ghost_fill, data_time);
@@ -1033,18 +1072,13 @@ IBMethod::constructInterpOp(Mat& J,
                             const int dof_index_idx,
                             const double data_time)
 {
-    if (J)
-    {
-        int ierr = MatDestroy(&J);
-        IBTK_CHKERRQ(ierr);
-    }
-
     // Get the "frozen" position for Lagrangian structure
     std::vector<Pointer<LData> >* X_LE_data;
     bool* X_LE_needs_ghost_fill;
     getLECouplingPositionData(&X_LE_data, &X_LE_needs_ghost_fill, data_time);
 
-    // Build the Jacobian matrix.
+    // Build the Jacobian matrix. An existing matrix is updated in place if its
+    // nonzero structure is still valid.
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
     Pointer<PatchLevel<NDIM> > finest_level = d_hierarchy->getPatchLevel(finest_ln);
     Vec X_vec = (*X_LE_data)[finest_ln]->getVec();
@@ -1397,6 +1431,64 @@ IBMethod::postprocessData()
     return;
 } // postprocessData
 
+void
+IBMethod::saveRollbackState(const int slot)
+{
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    std::vector<Pointer<LData> >& X_rollback_data = d_X_rollback_data[slot];
+    std::vector<Pointer<LData> >& U_rollback_data = d_U_rollback_data[slot];
+    X_rollback_data.resize(finest_ln + 1);
+    U_rollback_data.resize(finest_ln + 1);
+    PetscErrorCode ierr;
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        if (!X_rollback_data[ln]) X_rollback_data[ln] = d_l_data_manager->createLData("X_rollback", ln, NDIM);
+        if (!U_rollback_data[ln]) U_rollback_data[ln] = d_l_data_manager->createLData("U_rollback", ln, NDIM);
+        ierr = VecCopy(d_l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln)->getVec(),
+                       X_rollback_data[ln]->getVec());
+        IBTK_CHKERRQ(ierr);
+        ierr = VecCopy(d_l_data_manager->getLData(LDataManager::VEL_DATA_NAME, ln)->getVec(),
+                       U_rollback_data[ln]->getVec());
+        IBTK_CHKERRQ(ierr);
+    }
+    return;
+} // saveRollbackState
+
+void
+IBMethod::restoreRollbackState(const int slot)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_X_rollback_data.count(slot) && d_U_rollback_data.count(slot));
+#endif
+    const std::vector<Pointer<LData> >& X_rollback_data = d_X_rollback_data[slot];
+    const std::vector<Pointer<LData> >& U_rollback_data = d_U_rollback_data[slot];
+    PetscErrorCode ierr;
+    for (int ln = 0; ln < static_cast<int>(X_rollback_data.size()); ++ln)
+    {
+        if (!X_rollback_data[ln]) continue;
+        Pointer<LData> X_data = d_l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+        Pointer<LData> U_data = d_l_data_manager->getLData(LDataManager::VEL_DATA_NAME, ln);
+        ierr = VecCopy(X_rollback_data[ln]->getVec(), X_data->getVec());
+        IBTK_CHKERRQ(ierr);
+        ierr = VecCopy(U_rollback_data[ln]->getVec(), U_data->getVec());
+        IBTK_CHKERRQ(ierr);
+        X_data->beginGhostUpdate();
+        U_data->beginGhostUpdate();
+        X_data->endGhostUpdate();
+        U_data->endGhostUpdate();
+    }
+    return;
+} // restoreRollbackState
+
+void
+IBMethod::discardRollbackState(const int slot)
+{
+    d_X_rollback_data.erase(slot);
+    d_U_rollback_data.erase(slot);
+    return;
+} // discardRollbackState
+
 void
 IBMethod::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy,
                                    Pointer<GriddingAlgorithm<NDIM> > gridding_alg,
@@ -1459,9 +1551,11 @@ IBMethod::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy,
         }
     }
 
-    // Indicate that the force and source strategies need to be re-initialized.
+    // Indicate that the force and source strategies and the Lagrangian
+    // scratch data need to be re-initialized.
     d_ib_force_fcn_needs_init = true;
     d_ib_source_fcn_needs_init = true;
+    d_scratch_l_data_needs_reinit = true;
 
     // Deallocate any previously allocated Jacobian data structures.
     if (d_force_jac)
@@ -1552,9 +1646,11 @@ IBMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
         X_data[ln]->restoreArrays();
     }
 
-    // Indicate that the force and source strategies need to be re-initialized.
+    // Indicate that the force and source strategies and the Lagrangian
+    // scratch data need to be re-initialized.
     d_ib_force_fcn_needs_init = true;
     d_ib_source_fcn_needs_init = true;
+    d_scratch_l_data_needs_reinit = true;
     return;
 } // endDataRedistribution
 
@@ -1599,6 +1695,9 @@ IBMethod::resetHierarchyConfiguration(Pointer<BasePatchHierarchy<NDIM> > hierarc
     d_P_src.resize(finest_hier_level + 1);
     d_Q_src.resize(finest_hier_level + 1);
     d_n_src.resize(finest_hier_level + 1, 0);
+
+    // The Lagrangian scratch data must be reallocated for the new hierarchy.
+    d_scratch_l_data_needs_reinit = true;
     return;
 } // resetHierarchyConfiguration
 
@@ -1683,6 +1782,7 @@ IBMethod::putToDatabase(Pointer<Database> db)
         db->putInteger("instrument_names_sz", instrument_names_sz);
         db->putStringArray("instrument_names", &instrument_names[0], instrument_names_sz);
     }
+    if (d_pending_flow_volume_dt > 0.0) updateTotalFlowVolume();
     const int d_total_flow_volume_sz = static_cast<int>(d_total_flow_volume.size());
     db->putInteger("d_total_flow_volume_sz", d_total_flow_volume_sz);
     if (!d_total_flow_volume.empty())
@@ -1931,6 +2031,22 @@ IBMethod::resetLagrangianSourceFunction(const double init_data_time, const bool
     return;
 } // resetLagrangianSourceFunction
 
+void
+IBMethod::updateTotalFlowVolume()
+{
+    d_instrument_panel->completeInstrumentData();
+    const std::vector<std::string>& instrument_name = d_instrument_panel->getInstrumentNames();
+    const std::vector<double>& flow_data = d_instrument_panel->getFlowValues();
+    for (unsigned int m = 0; m < flow_data.size(); ++m)
+    {
+        // NOTE: Flow volume is calculated in default units.
+        d_total_flow_volume[m] += flow_data[m] * d_pending_flow_volume_dt;
+        if (d_do_log) plog << "flow volume through " << instrument_name[m] << ":\t " << d_total_flow_volume[m] << "\n";
+    }
+    d_pending_flow_volume_dt = 0.0;
+    return;
+} // updateTotalFlowVolume
+
 void
 IBMethod::updateIBInstrumentationData(const int timestep_num, const double data_time)
 {
@@ -2029,6 +2145,14 @@ IBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
     }
     if (db->keyExists("error_if_points_leave_domain"))
         d_error_if_points_leave_domain = db->getBool("error_if_points_leave_domain");
+    if (db->keyExists("sort_local_indices_by_cell"))
+        d_sort_local_indices_by_cell = db->getBool("sort_local_indices_by_cell");
+    if (db->keyExists("sort_local_nodes_by_cell"))
+        d_sort_local_nodes_by_cell = db->getBool("sort_local_nodes_by_cell");
+    if (db->keyExists("calibrate_workload")) d_calibrate_workload = db->getBool("calibrate_workload");
+    if (db->keyExists("workload_relaxation")) d_workload_relaxation = db->getDouble("workload_relaxation");
+    if (db->keyExists("cache_interaction_weights"))
+        d_cache_interaction_weights = db->getBool("cache_interaction_weights");
     if (db->keyExists("force_jac_mffd")) d_force_jac_mffd = db->getBool("force_jac_mffd");
     if (db->keyExists("do_log"))
         d_do_log = db->getBool("do_log");
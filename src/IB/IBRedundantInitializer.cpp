@@ -76,6 +76,80 @@ class LDataManager;
 
 namespace IBAMR
 {
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+using Edge = IBRedundantInitializer::Edge;
+using EdgeComp = IBRedundantInitializer::EdgeComp;
+using SpringSpec = IBRedundantInitializer::SpringSpec;
+
+// Broadcast the vertex positions of a structure from process root.
+void
+bcast_vertex_posn(int& num_vertex, std::vector<Point>& vertex_posn, const int root)
+{
+    num_vertex = IBTK_MPI::bcast(num_vertex, root);
+    int length = IBTK_MPI::bcast(static_cast<int>(NDIM * vertex_posn.size()), root);
+    std::vector<double> buffer(length);
+    if (IBTK_MPI::getRank() == root)
+    {
+        for (std::size_t k = 0; k < vertex_posn.size(); ++k)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d) buffer[NDIM * k + d] = vertex_posn[k][d];
+        }
+    }
+    if (length > 0) IBTK_MPI::bcast(buffer.data(), length, root);
+    vertex_posn.resize(length / NDIM);
+    for (std::size_t k = 0; k < vertex_posn.size(); ++k)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d) vertex_posn[k][d] = buffer[NDIM * k + d];
+    }
+    return;
+} // bcast_vertex_posn
+
+// Broadcast the springs of a structure from process root. The springs are
+// packed as (master index, edge, force function index, number of parameters,
+// parameters) tuples; indices are stored exactly as doubles.
+void
+bcast_springs(std::multimap<int, Edge>& spring_map, std::map<Edge, SpringSpec, EdgeComp>& spring_spec, const int root)
+{
+    std::vector<double> buffer;
+    if (IBTK_MPI::getRank() == root)
+    {
+        for (const auto& edge_pair : spring_map)
+        {
+            const Edge& e = edge_pair.second;
+            const SpringSpec& spec = spring_spec[e];
+            buffer.push_back(edge_pair.first);
+            buffer.push_back(e.first);
+            buffer.push_back(e.second);
+            buffer.push_back(spec.force_fcn_idx);
+            buffer.push_back(static_cast<double>(spec.parameters.size()));
+            buffer.insert(buffer.end(), spec.parameters.begin(), spec.parameters.end());
+        }
+    }
+    int length = IBTK_MPI::bcast(static_cast<int>(buffer.size()), root);
+    if (length == 0) return;
+    buffer.resize(length);
+    IBTK_MPI::bcast(buffer.data(), length, root);
+    if (IBTK_MPI::getRank() == root) return;
+    spring_map.clear();
+    spring_spec.clear();
+    for (std::size_t pos = 0; pos < buffer.size();)
+    {
+        const int master_idx = static_cast<int>(buffer[pos]);
+        const Edge e(static_cast<int>(buffer[pos + 1]), static_cast<int>(buffer[pos + 2]));
+        SpringSpec& spec = spring_spec[e];
+        spec.force_fcn_idx = static_cast<int>(buffer[pos + 3]);
+        const std::size_t num_parameters = static_cast<std::size_t>(buffer[pos + 4]);
+        spec.parameters.assign(buffer.begin() + pos + 5, buffer.begin() + pos + 5 + num_parameters);
+        spring_map.insert(std::make_pair(master_idx, e));
+        pos += 5 + num_parameters;
+    }
+    return;
+} // bcast_springs
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 IBRedundantInitializer::IBRedundantInitializer(std::string object_name, Pointer<Database> input_db)
@@ -292,6 +366,9 @@ IBRedundantInitializer::initializeStructurePosition()
         TBOX_ERROR("IBRedundantInitializer::initializeStructurePosition()\n"
                    << " no function registered to initialize structure.\n");
     }
+    const int rank = IBTK_MPI::getRank();
+    const int n_nodes = IBTK_MPI::getNodes();
+    int callback_num = 0;
     for (int ln = 0; ln < d_max_levels; ++ln)
     {
         const size_t num_base_filename = d_base_filename[ln].size();
@@ -309,7 +386,14 @@ IBRedundantInitializer::initializeStructurePosition()
                 d_vertex_offset[ln][j] = d_vertex_offset[ln][j - 1] + d_num_vertex[ln][j - 1];
             }
 
-            d_init_structure_on_level_fcn(j, ln, d_num_vertex[ln][j], d_vertex_posn[ln][j]);
+            // When distributing the callbacks, only the process to which the
+            // structure is assigned generates it.
+            const int root = (callback_num++) % n_nodes;
+            if (!d_distribute_callbacks || rank == root)
+            {
+                d_init_structure_on_level_fcn(j, ln, d_num_vertex[ln][j], d_vertex_posn[ln][j]);
+            }
+            if (d_distribute_callbacks) bcast_vertex_posn(d_num_vertex[ln][j], d_vertex_posn[ln][j], root);
 #if !defined(NDEBUG)
             if (d_vertex_posn[ln][j].size() != std::size_t(d_num_vertex[ln][j]))
             {
@@ -337,6 +421,9 @@ IBRedundantInitializer::initializeStructurePosition()
 void
 IBRedundantInitializer::initializeSprings()
 {
+    const int rank = IBTK_MPI::getRank();
+    const int n_nodes = IBTK_MPI::getNodes();
+    int callback_num = 0;
     for (int ln = 0; ln < d_max_levels; ++ln)
     {
         const size_t num_base_filename = d_base_filename[ln].size();
@@ -346,7 +433,12 @@ IBRedundantInitializer::initializeSprings()
         {
             for (unsigned int j = 0; j < num_base_filename; ++j)
             {
-                d_init_spring_on_level_fcn(j, ln, d_spring_edge_map[ln][j], d_spring_spec_data[ln][j]);
+                const int root = (callback_num++) % n_nodes;
+                if (!d_distribute_callbacks || rank == root)
+                {
+                    d_init_spring_on_level_fcn(j, ln, d_spring_edge_map[ln][j], d_spring_spec_data[ln][j]);
+                }
+                if (d_distribute_callbacks) bcast_springs(d_spring_edge_map[ln][j], d_spring_spec_data[ln][j], root);
 
                 int min_idx = 0;
                 int max_idx = d_num_vertex[ln][j];
@@ -1347,23 +1439,67 @@ IBRedundantInitializer::getPatchVerticesAtLevel(std::vector<std::pair<int, int>
                                                 const Pointer<PatchHierarchy<NDIM> > hierarchy,
                                                 const int vertex_level_number) const
 {
-    const Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
-    const double* const domain_x_lower = grid_geom->getXLower();
-    const double* const domain_x_upper = grid_geom->getXUpper();
 #if !defined(NDEBUG)
     TBOX_ASSERT(patch->inHierarchy());
 #endif
     const int level_number = patch->getPatchLevelNumber();
     const Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+
+    // The vertices are sorted into all of the local patches of the level at
+    // once. The sorted indices are reused as long as the local patch boxes are
+    // unchanged, so that repeated queries (e.g., when counting the local
+    // nodes and then initializing their data) do not each require a loop over
+    // all of the vertices.
+    PatchVertexCache& cache = d_patch_vertex_cache[std::make_pair(level_number, vertex_level_number)];
+    bool cache_is_valid = true;
+    int num_local_patches = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p && cache_is_valid; p++, ++num_local_patches)
+    {
+        const auto it = cache.patch_boxes.find(p());
+        cache_is_valid = it != cache.patch_boxes.end() && it->second == level->getPatch(p())->getBox();
+    }
+    cache_is_valid = cache_is_valid && num_local_patches == static_cast<int>(cache.patch_boxes.size());
+    if (!cache_is_valid) buildPatchVertexCache(cache, level, hierarchy, vertex_level_number);
+
+    const auto it = cache.patch_vertices.find(patch->getPatchNumber());
+    if (it != cache.patch_vertices.end())
+    {
+        patch_vertices.insert(patch_vertices.end(), it->second.begin(), it->second.end());
+    }
+    return;
+} // getPatchVerticesAtLevel
+
+void
+IBRedundantInitializer::buildPatchVertexCache(PatchVertexCache& cache,
+                                              const Pointer<PatchLevel<NDIM> > level,
+                                              const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                              const int vertex_level_number) const
+{
+    const Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+    const double* const domain_x_lower = grid_geom->getXLower();
+    const double* const domain_x_upper = grid_geom->getXUpper();
     const IntVector<NDIM>& ratio = level->getRatio();
     const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(ratio);
 
-    // Loop over all of the vertices to determine the indices of those vertices
-    // within the present patch.
-    //
-    // NOTE: This is clearly not the best way to do this, but it will work for
-    // now.
-    const Box<NDIM>& patch_box = patch->getBox();
+    cache.patch_boxes.clear();
+    cache.patch_vertices.clear();
+    std::vector<std::pair<int, Box<NDIM> > > local_boxes;
+    Box<NDIM> bounding_box;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        const Box<NDIM>& patch_box = level->getPatch(p())->getBox();
+        cache.patch_boxes[p()] = patch_box;
+        cache.patch_vertices[p()];
+        local_boxes.emplace_back(p(), patch_box);
+        bounding_box += patch_box;
+    }
+    if (local_boxes.empty()) return;
+
+    // Loop over all of the vertices once and assign each vertex to the local
+    // patch (if any) that contains it. Since the patches of a level do not
+    // overlap, each vertex is assigned to at most one patch, and vertices
+    // outside of the bounding box of the local patches are skipped without
+    // examining the individual patches.
     for (unsigned int j = 0; j < d_num_vertex[vertex_level_number].size(); ++j)
     {
         for (int k = 0; k < d_num_vertex[vertex_level_number][j]; ++k)
@@ -1372,11 +1508,19 @@ IBRedundantInitializer::getPatchVerticesAtLevel(std::vector<std::pair<int, int>
             const Point& X =
                 getShiftedVertexPosn(point_index, vertex_level_number, domain_x_lower, domain_x_upper, periodic_shift);
             const CellIndex<NDIM> idx = IndexUtilities::getCellIndex(X, grid_geom, ratio);
-            if (patch_box.contains(idx)) patch_vertices.push_back(point_index);
+            if (!bounding_box.contains(idx)) continue;
+            for (const auto& local_box : local_boxes)
+            {
+                if (local_box.second.contains(idx))
+                {
+                    cache.patch_vertices[local_box.first].push_back(point_index);
+                    break;
+                }
+            }
         }
     }
     return;
-} // getPatchVerticesAtLevel
+} // buildPatchVertexCache
 
 int
 IBRedundantInitializer::getCanonicalLagrangianIndex(const std::pair<int, int>& point_index,
@@ -1388,6 +1532,11 @@ IBRedundantInitializer::getCanonicalLagrangianIndex(const std::pair<int, int>& p
 Point
 IBRedundantInitializer::getVertexPosn(const std::pair<int, int>& point_index, const int level_number) const
 {
+    if (level_number < static_cast<int>(d_shared_vertex_posn.size()) && d_shared_vertex_posn[level_number])
+    {
+        const int offset = d_vertex_offset[level_number][point_index.first];
+        return (*d_shared_vertex_posn[level_number])[offset + point_index.second];
+    }
     return d_vertex_posn[level_number][point_index.first][point_index.second];
 } // getVertexPosn
 
@@ -1656,6 +1805,8 @@ IBRedundantInitializer::getFromInput(Pointer<Database> db)
                                  << "Key data `max_levels' found in input is < 1.");
     }
 
+    if (db->keyExists("distribute_callbacks")) d_distribute_callbacks = db->getBool("distribute_callbacks");
+
     d_level_is_initialized.resize(d_max_levels, false);
     d_base_filename.resize(d_max_levels);
     d_num_vertex.resize(d_max_levels);
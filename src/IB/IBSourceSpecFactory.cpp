@@ -21,6 +21,8 @@
 #include "tbox/AbstractStream.h"
 #include "tbox/Pointer.h"
 
+#include <vector>
+
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 
 namespace SAMRAI
@@ -66,6 +68,40 @@ IBSourceSpec::Factory::unpackStream(AbstractStream& stream, const IntVector<NDIM
     return ret_val;
 } // unpackStream
 
+void
+IBSourceSpec::Factory::packStreams(AbstractStream& stream,
+                                   const Pointer<Streamable>* const data_items,
+                                   const int num_items)
+{
+    std::vector<int> idxs(2 * num_items);
+    for (int k = 0; k < num_items; ++k)
+    {
+        const auto spec = static_cast<const IBSourceSpec*>(data_items[k].getPointer());
+        idxs[2 * k] = spec->d_master_idx;
+        idxs[2 * k + 1] = spec->d_source_idx;
+    }
+    stream.pack(idxs.data(), 2 * num_items);
+    return;
+} // packStreams
+
+void
+IBSourceSpec::Factory::unpackStreams(AbstractStream& stream,
+                                     const IntVector<NDIM>& /*offset*/,
+                                     Pointer<Streamable>* const data_items,
+                                     const int num_items)
+{
+    std::vector<int> idxs(2 * num_items);
+    stream.unpack(idxs.data(), 2 * num_items);
+    for (int k = 0; k < num_items; ++k)
+    {
+        Pointer<IBSourceSpec> spec = new IBSourceSpec();
+        spec->d_master_idx = idxs[2 * k];
+        spec->d_source_idx = idxs[2 * k + 1];
+        data_items[k] = spec;
+    }
+    return;
+} // unpackStreams
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -57,12 +57,17 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <limits>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 namespace IBAMR
@@ -118,6 +123,57 @@ resetLocalOrNonlocalPETScIndices(std::vector<int>& inds,
     }
     return;
 } // resetLocalOrNonlocalPETScIndices
+
+template <typename T>
+void
+applyPermutation(std::vector<T>& values, const std::vector<int>& permutation)
+{
+    std::vector<T> permuted_values(values.size());
+    for (std::size_t k = 0; k < permutation.size(); ++k) permuted_values[k] = values[permutation[k]];
+    values.swap(permuted_values);
+    return;
+} // applyPermutation
+
+// Add the forces computed by force_fcn(k, F) for k = 0, ..., n - 1 to F_node.
+// When threads are used each thread accumulates its forces in its own buffer,
+// so that no two threads write to the same entry, and the buffers are summed
+// at the end.
+template <typename ForceFcn>
+void
+accumulateForces(double* const F_node,
+                 const int F_size,
+                 const int n,
+                 const bool use_threads,
+                 std::vector<std::vector<double> >& thread_buffers,
+                 ForceFcn force_fcn)
+{
+#ifdef _OPENMP
+    if (use_threads && omp_get_max_threads() > 1)
+    {
+        thread_buffers.resize(omp_get_max_threads());
+#pragma omp parallel
+        {
+            std::vector<double>& F_thread = thread_buffers[omp_get_thread_num()];
+            F_thread.assign(F_size, 0.0);
+#pragma omp for schedule(static)
+            for (int k = 0; k < n; ++k) force_fcn(k, F_thread.data());
+            const int n_threads = omp_get_num_threads();
+#pragma omp for schedule(static)
+            for (int i = 0; i < F_size; ++i)
+            {
+                for (int t = 0; t < n_threads; ++t) F_node[i] += thread_buffers[t][i];
+            }
+        }
+        return;
+    }
+#else
+    NULL_USE(F_size);
+    NULL_USE(use_threads);
+    NULL_USE(thread_buffers);
+#endif
+    for (int k = 0; k < n; ++k) force_fcn(k, F_node);
+    return;
+} // accumulateForces
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -132,6 +188,10 @@ IBStandardForceGen::IBStandardForceGen(Pointer<Database> input_db)
     {
         if (input_db->keyExists("log_target_point_displacements"))
             d_log_target_point_displacements = input_db->getBool("log_target_point_displacements");
+        if (input_db->keyExists("use_threaded_force_evaluation"))
+            d_use_threaded_force_evaluation = input_db->getBool("use_threaded_force_evaluation");
+        if (input_db->keyExists("overlap_force_communication"))
+            d_overlap_force_communication = input_db->getBool("overlap_force_communication");
     }
     return;
 } // IBStandardForceGen
@@ -278,14 +338,25 @@ IBStandardForceGen::computeLagrangianForce(Pointer<LData> F_data,
     IBTK_CHKERRQ(ierr);
     ierr = VecGhostUpdateBegin(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
     IBTK_CHKERRQ(ierr);
+
+    // Target point forces only involve locally owned nodes, so they may be
+    // computed before the ghost node positions have arrived.
+    if (d_overlap_force_communication)
+    {
+        computeLagrangianTargetPointForce(
+            F_ghost_data, X_ghost_data, U_data, hierarchy, level_number, data_time, l_data_manager);
+    }
     ierr = VecGhostUpdateEnd(X_ghost_data->getVec(), INSERT_VALUES, SCATTER_FORWARD);
     IBTK_CHKERRQ(ierr);
 
     // Compute the forces.
     computeLagrangianSpringForce(F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager);
     computeLagrangianBeamForce(F_ghost_data, X_ghost_data, hierarchy, level_number, data_time, l_data_manager);
-    computeLagrangianTargetPointForce(
-        F_ghost_data, X_ghost_data, U_data, hierarchy, level_number, data_time, l_data_manager);
+    if (!d_overlap_force_communication)
+    {
+        computeLagrangianTargetPointForce(
+            F_ghost_data, X_ghost_data, U_data, hierarchy, level_number, data_time, l_data_manager);
+    }
 
     // Add the locally computed forces to the Lagrangian force vector.
     //
@@ -734,9 +805,9 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
 
     // Determine how many springs are associated with the present MPI process.
     unsigned int total_num_springs = 0;
-    for (const auto& node_idx : local_nodes)
+    const std::vector<IBSpringForceSpec*>& force_specs = mesh->getLocalNodeDataColumn<IBSpringForceSpec>();
+    for (const IBSpringForceSpec* const force_spec : force_specs)
     {
-        const IBSpringForceSpec* const force_spec = node_idx->getNodeDataItem<IBSpringForceSpec>();
         if (force_spec) total_num_springs += force_spec->getNumberOfSprings();
     }
 
@@ -753,10 +824,11 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
 
     // Setup the data structures used to compute spring forces.
     int current_spring = 0;
-    for (const auto& node_idx : local_nodes)
+    for (std::size_t local_idx = 0; local_idx < local_nodes.size(); ++local_idx)
     {
-        const IBSpringForceSpec* const force_spec = node_idx->getNodeDataItem<IBSpringForceSpec>();
+        const IBSpringForceSpec* const force_spec = force_specs[local_idx];
         if (!force_spec) continue;
+        const LNode* const node_idx = local_nodes[local_idx];
 
         const int lag_idx = node_idx->getLagrangianIndex();
 #if !defined(NDEBUG)
@@ -784,6 +856,23 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
         }
     }
 
+    // Group the springs that use the default force function so that their
+    // forces can be computed by a loop that does not call the force function.
+    std::vector<int> permutation(total_num_springs);
+    std::iota(permutation.begin(), permutation.end(), 0);
+    const auto default_springs_end = std::stable_partition(permutation.begin(), permutation.end(), [&](const int k) {
+        return force_fcns[k] == &default_spring_force && parameters[k];
+    });
+    d_spring_data[level_number].num_default_springs =
+        static_cast<int>(std::distance(permutation.begin(), default_springs_end));
+    d_spring_data[level_number].T_over_R.resize(d_spring_data[level_number].num_default_springs);
+    applyPermutation(lag_mastr_node_idxs, permutation);
+    applyPermutation(lag_slave_node_idxs, permutation);
+    applyPermutation(petsc_mastr_node_idxs, permutation);
+    applyPermutation(force_fcns, permutation);
+    applyPermutation(force_deriv_fcns, permutation);
+    applyPermutation(parameters, permutation);
+
     // Map the Lagrangian slave node indices to the PETSc indices corresponding
     // to the present data distribution.
     petsc_slave_node_idxs = lag_slave_node_idxs;
@@ -816,18 +905,106 @@ IBStandardForceGen::computeLagrangianSpringForce(Pointer<LData> F_data,
                                                  const double /*data_time*/,
                                                  LDataManager* const /*l_data_manager*/)
 {
-    const int num_springs = static_cast<int>(d_spring_data[level_number].lag_mastr_node_idxs.size());
+    double* const F_node = F_data->getLocalFormVecArray()->data();
+    const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
+
+    // First compute the forces generated by springs that use the default
+    // force function. The scaled tensions are computed in a separate loop
+    // from the one that accumulates the forces: the first loop does not call
+    // a function through a pointer or write to shared nodes so that it may
+    // be vectorized by the compiler.
+    SpringData& spring_data = d_spring_data[level_number];
+    const int num_default_springs = spring_data.num_default_springs;
+    const int F_size = static_cast<int>(F_data->getLocalFormVecArray()->num_elements());
+    {
+        const int* const petsc_mastr_node_idxs = spring_data.petsc_mastr_node_idxs.data();
+        const int* const petsc_slave_node_idxs = spring_data.petsc_slave_node_idxs.data();
+        const double* const* const parameters = spring_data.parameters.data();
+        double* const T_over_R = spring_data.T_over_R.data();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (d_use_threaded_force_evaluation)
+#endif
+        for (int k = 0; k < num_default_springs; ++k)
+        {
+            const int mastr_idx = petsc_mastr_node_idxs[k];
+            const int slave_idx = petsc_slave_node_idxs[k];
+            double R_sq = 0.0;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                const double D = X_node[slave_idx + d] - X_node[mastr_idx + d];
+                R_sq += D * D;
+            }
+            const double R = std::sqrt(R_sq);
+            const double* const params = parameters[k];
+            T_over_R[k] = R < std::numeric_limits<double>::epsilon() ? 0.0 : params[0] * (R - params[1]) / R;
+        }
+        accumulateForces(F_node,
+                         F_size,
+                         num_default_springs,
+                         d_use_threaded_force_evaluation,
+                         d_thread_force_buffers,
+                         [&](const int k, double* const F_vals) {
+                             const int mastr_idx = petsc_mastr_node_idxs[k];
+                             const int slave_idx = petsc_slave_node_idxs[k];
+#if !defined(NDEBUG)
+                             TBOX_ASSERT(mastr_idx != slave_idx);
+#endif
+                             for (unsigned int d = 0; d < NDIM; ++d)
+                             {
+                                 const double F = T_over_R[k] * (X_node[slave_idx + d] - X_node[mastr_idx + d]);
+                                 F_vals[mastr_idx + d] += F;
+                                 F_vals[slave_idx + d] -= F;
+                             }
+                         });
+    }
+
+    // Then compute the forces generated by all other springs.
+    const int num_springs = static_cast<int>(spring_data.lag_mastr_node_idxs.size()) - num_default_springs;
     const bool uses_springs = (num_springs > 0);
-    const int* const lag_mastr_node_idxs = uses_springs ? &d_spring_data[level_number].lag_mastr_node_idxs[0] : nullptr;
-    const int* const lag_slave_node_idxs = uses_springs ? &d_spring_data[level_number].lag_slave_node_idxs[0] : nullptr;
+    const int* const lag_mastr_node_idxs =
+        uses_springs ? &spring_data.lag_mastr_node_idxs[num_default_springs] : nullptr;
+    const int* const lag_slave_node_idxs =
+        uses_springs ? &spring_data.lag_slave_node_idxs[num_default_springs] : nullptr;
     const int* const petsc_mastr_node_idxs =
-        uses_springs ? &d_spring_data[level_number].petsc_mastr_node_idxs[0] : nullptr;
+        uses_springs ? &spring_data.petsc_mastr_node_idxs[num_default_springs] : nullptr;
     const int* const petsc_slave_node_idxs =
-        uses_springs ? &d_spring_data[level_number].petsc_slave_node_idxs[0] : nullptr;
-    const SpringForceFcnPtr* const force_fcns = uses_springs ? &d_spring_data[level_number].force_fcns[0] : nullptr;
-    const double** const parameters = uses_springs ? &d_spring_data[level_number].parameters[0] : nullptr;
-    double* const F_node = F_data->getLocalFormVecArray()->data();
-    const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
+        uses_springs ? &spring_data.petsc_slave_node_idxs[num_default_springs] : nullptr;
+    const SpringForceFcnPtr* const force_fcns = uses_springs ? &spring_data.force_fcns[num_default_springs] : nullptr;
+    const double** const parameters = uses_springs ? &spring_data.parameters[num_default_springs] : nullptr;
+
+    if (d_use_threaded_force_evaluation)
+    {
+        accumulateForces(F_node,
+                         F_size,
+                         num_springs,
+                         /*use_threads*/ true,
+                         d_thread_force_buffers,
+                         [&](const int k, double* const F_vals) {
+                             const int mastr_idx = petsc_mastr_node_idxs[k];
+                             const int slave_idx = petsc_slave_node_idxs[k];
+#if !defined(NDEBUG)
+                             TBOX_ASSERT(mastr_idx != slave_idx);
+#endif
+                             double D[NDIM], R_sq = 0.0;
+                             for (unsigned int d = 0; d < NDIM; ++d)
+                             {
+                                 D[d] = X_node[slave_idx + d] - X_node[mastr_idx + d];
+                                 R_sq += D[d] * D[d];
+                             }
+                             const double R = std::sqrt(R_sq);
+                             if (UNLIKELY(R < std::numeric_limits<double>::epsilon())) return;
+                             const double T_over_R =
+                                 (force_fcns[k])(R, parameters[k], lag_mastr_node_idxs[k], lag_slave_node_idxs[k]) / R;
+                             for (unsigned int d = 0; d < NDIM; ++d)
+                             {
+                                 F_vals[mastr_idx + d] += T_over_R * D[d];
+                                 F_vals[slave_idx + d] -= T_over_R * D[d];
+                             }
+                         });
+        F_data->restoreArrays();
+        X_data->restoreArrays();
+        return;
+    }
 
     static const int BLOCKSIZE = 16; // this parameter needs to be tuned
     int k, kblock, kunroll, mastr_idx, slave_idx;
@@ -951,9 +1128,9 @@ IBStandardForceGen::initializeBeamLevelData(std::set<int>& nonlocal_petsc_idx_se
 
     // Determine how many beams are associated with the present MPI process.
     unsigned int total_num_beams = 0;
-    for (const auto& node_idx : local_nodes)
+    const std::vector<IBBeamForceSpec*>& force_specs = mesh->getLocalNodeDataColumn<IBBeamForceSpec>();
+    for (const IBBeamForceSpec* const force_spec : force_specs)
     {
-        const IBBeamForceSpec* const force_spec = node_idx->getNodeDataItem<IBBeamForceSpec>();
         if (force_spec) total_num_beams += force_spec->getNumberOfBeams();
     }
     petsc_mastr_node_idxs.resize(total_num_beams);
@@ -967,10 +1144,11 @@ IBStandardForceGen::initializeBeamLevelData(std::set<int>& nonlocal_petsc_idx_se
 
     // Setup the data structures used to compute beam forces.
     int current_beam = 0;
-    for (const auto& node_idx : local_nodes)
+    for (std::size_t local_idx = 0; local_idx < local_nodes.size(); ++local_idx)
     {
-        const IBBeamForceSpec* const force_spec = node_idx->getNodeDataItem<IBBeamForceSpec>();
+        const IBBeamForceSpec* const force_spec = force_specs[local_idx];
         if (!force_spec) continue;
+        const LNode* const node_idx = local_nodes[local_idx];
 
 #if !defined(NDEBUG)
         const int lag_idx = node_idx->getLagrangianIndex();
@@ -1050,6 +1228,38 @@ IBStandardForceGen::computeLagrangianBeamForce(Pointer<LData> F_data,
     double* const F_node = F_data->getLocalFormVecArray()->data();
     const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
 
+    if (d_use_threaded_force_evaluation)
+    {
+        const int F_size = static_cast<int>(F_data->getLocalFormVecArray()->num_elements());
+        accumulateForces(F_node,
+                         F_size,
+                         num_beams,
+                         /*use_threads*/ true,
+                         d_thread_force_buffers,
+                         [&](const int k, double* const F_vals) {
+                             const int mastr_idx = petsc_mastr_node_idxs[k];
+                             const int next_idx = petsc_next_node_idxs[k];
+                             const int prev_idx = petsc_prev_node_idxs[k];
+#if !defined(NDEBUG)
+                             TBOX_ASSERT(mastr_idx != next_idx);
+                             TBOX_ASSERT(mastr_idx != prev_idx);
+#endif
+                             const double K = *rigidities[k];
+                             const double* const D2X0 = curvatures[k]->data();
+                             for (unsigned int d = 0; d < NDIM; ++d)
+                             {
+                                 const double F = K * (X_node[next_idx + d] + X_node[prev_idx + d] -
+                                                       2.0 * X_node[mastr_idx + d] - D2X0[d]);
+                                 F_vals[mastr_idx + d] += 2.0 * F;
+                                 F_vals[next_idx + d] -= F;
+                                 F_vals[prev_idx + d] -= F;
+                             }
+                         });
+        F_data->restoreArrays();
+        X_data->restoreArrays();
+        return;
+    }
+
     static const int BLOCKSIZE = 16; // This parameter needs to be tuned.
     int k, kblock, kunroll, mastr_idx, next_idx, prev_idx;
     double K;
@@ -1165,9 +1375,9 @@ IBStandardForceGen::initializeTargetPointLevelData(std::set<int>& /*nonlocal_pet
     // Determine how many target points are associated with the present MPI
     // process.
     unsigned int total_num_target_points = 0;
-    for (const auto& node_idx : local_nodes)
+    const std::vector<IBTargetPointForceSpec*>& force_specs = mesh->getLocalNodeDataColumn<IBTargetPointForceSpec>();
+    for (const IBTargetPointForceSpec* const force_spec : force_specs)
     {
-        const IBTargetPointForceSpec* const force_spec = node_idx->getNodeDataItem<IBTargetPointForceSpec>();
         if (force_spec) total_num_target_points += 1;
     }
 
@@ -1181,10 +1391,11 @@ IBStandardForceGen::initializeTargetPointLevelData(std::set<int>& /*nonlocal_pet
 
     // Setup the data structures used to compute target point forces.
     int current_target_point = 0;
-    for (const auto& node_idx : local_nodes)
+    for (std::size_t local_idx = 0; local_idx < local_nodes.size(); ++local_idx)
     {
-        const IBTargetPointForceSpec* const force_spec = node_idx->getNodeDataItem<IBTargetPointForceSpec>();
+        const IBTargetPointForceSpec* const force_spec = force_specs[local_idx];
         if (!force_spec) continue;
+        const LNode* const node_idx = local_nodes[local_idx];
         petsc_global_node_idxs[current_target_point] = petsc_node_idxs[current_target_point] =
             node_idx->getGlobalPETScIndex();
         kappa[current_target_point] = &force_spec->getStiffness();
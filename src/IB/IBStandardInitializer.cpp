@@ -26,6 +26,7 @@
 
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/NodeSharedArray.h"
 #include "ibtk/Streamable.h"
 #include "ibtk/ibtk_utilities.h"
 
@@ -36,9 +37,13 @@
 #include "tbox/RestartManager.h"
 #include "tbox/Utilities.h"
 
+#include <mpi.h>
+
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
+#include <fstream>
 #include <ios>
 #include <iosfwd>
 #include <istream>
@@ -192,6 +197,16 @@ IBStandardInitializer::readVertexFiles(const std::string& extension)
     int flag = 1;
     int sz = 1;
 
+    // When the vertices are stored in node-shared memory, only the first
+    // process on each node reads the vertex files.
+    MPI_Comm node_comm = MPI_COMM_NULL;
+    bool read_vertex_files = true;
+    if (d_use_node_shared_memory)
+    {
+        node_comm = IBTK_MPI::splitByNode();
+        read_vertex_files = IBTK_MPI::getRank(node_comm) == 0;
+    }
+
     for (int ln = 0; ln < d_max_levels; ++ln)
     {
         const size_t num_base_filename = d_base_filename[ln].size();
@@ -212,78 +227,101 @@ IBStandardInitializer::readVertexFiles(const std::string& extension)
                 d_vertex_offset[ln][j] = d_vertex_offset[ln][j - 1] + d_num_vertex[ln][j - 1];
             }
 
-            // Ensure that the file exists.
-            const std::string vertex_filename = d_base_filename[ln][j] + extension;
-            std::ifstream file_stream(vertex_filename);
-            if (file_stream.is_open())
+            if (read_vertex_files)
             {
-                plog << d_object_name << ":  "
-                     << "processing vertex data from ASCII input file named " << vertex_filename << std::endl
-                     << "  on MPI process " << IBTK_MPI::getRank() << std::endl;
-
-                // The first entry in the file is the number of vertices.
-                if (!std::getline(file_stream, line_string))
-                {
-                    TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered "
-                                                "before line 1 of file "
-                                             << vertex_filename << std::endl);
-                }
-                else
-                {
-                    line_string = discard_comments(line_string);
-                    std::istringstream line_stream(line_string);
-                    if (!(line_stream >> d_num_vertex[ln][j]))
-                    {
-                        TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file "
-                                                    "encountered on line 1 of file "
-                                                 << vertex_filename << std::endl);
-                    }
-                }
-
-                if (d_num_vertex[ln][j] <= 0)
-                {
-                    TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line 1 of file "
-                                             << vertex_filename << std::endl);
-                }
-
-                // Each successive line provides the initial position of each
-                // vertex in the input file.
-                d_vertex_posn[ln][j].resize(d_num_vertex[ln][j]);
-                for (int k = 0; k < d_num_vertex[ln][j]; ++k)
-                {
-                    Point& X = d_vertex_posn[ln][j][k];
+                // Use the binary vertex file if there is one; otherwise, ensure
+                // that the ASCII file exists.
+                const std::string vertex_filename = d_base_filename[ln][j] + extension;
+                const std::string binary_vertex_filename = vertex_filename + ".bin";
+                std::ifstream binary_file_stream(binary_vertex_filename, std::ios::in | std::ios::binary);
+                std::ifstream file_stream;
+                if (!binary_file_stream.is_open()) file_stream.open(vertex_filename);
+                if (binary_file_stream.is_open())
+                {
+                    plog << d_object_name << ":  "
+                         << "processing vertex data from binary input file named " << binary_vertex_filename
+                         << std::endl
+                         << "  on MPI process " << IBTK_MPI::getRank() << std::endl;
+
+                    readBinaryVertexFile(binary_file_stream, binary_vertex_filename, ln, j);
+                    binary_file_stream.close();
+
+                    plog << d_object_name << ":  "
+                         << "read " << d_num_vertex[ln][j] << " vertices from binary input file named "
+                         << binary_vertex_filename << std::endl
+                         << "  on MPI process " << IBTK_MPI::getRank() << std::endl;
+                }
+                else if (file_stream.is_open())
+                {
+                    plog << d_object_name << ":  "
+                         << "processing vertex data from ASCII input file named " << vertex_filename << std::endl
+                         << "  on MPI process " << IBTK_MPI::getRank() << std::endl;
+
+                    // The first entry in the file is the number of vertices.
                     if (!std::getline(file_stream, line_string))
                     {
-                        TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered before line " << k + 2
-                                                 << " of file " << vertex_filename << std::endl);
+                        TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered "
+                                                    "before line 1 of file "
+                                                 << vertex_filename << std::endl);
                     }
                     else
                     {
                         line_string = discard_comments(line_string);
                         std::istringstream line_stream(line_string);
-                        for (unsigned int d = 0; d < NDIM; ++d)
+                        if (!(line_stream >> d_num_vertex[ln][j]))
                         {
-                            if (!(line_stream >> X[d]))
+                            TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file "
+                                                        "encountered on line 1 of file "
+                                                     << vertex_filename << std::endl);
+                        }
+                    }
+
+                    if (d_num_vertex[ln][j] <= 0)
+                    {
+                        TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line 1 of file "
+                                                 << vertex_filename << std::endl);
+                    }
+
+                    // Each successive line provides the initial position of each
+                    // vertex in the input file.
+                    d_vertex_posn[ln][j].resize(d_num_vertex[ln][j]);
+                    for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+                    {
+                        Point& X = d_vertex_posn[ln][j][k];
+                        if (!std::getline(file_stream, line_string))
+                        {
+                            TBOX_ERROR(d_object_name << ":\n  Premature end to input file encountered before line "
+                                                     << k + 2 << " of file " << vertex_filename << std::endl);
+                        }
+                        else
+                        {
+                            line_string = discard_comments(line_string);
+                            std::istringstream line_stream(line_string);
+                            for (unsigned int d = 0; d < NDIM; ++d)
                             {
-                                TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line "
-                                                         << k + 2 << " of file " << vertex_filename << std::endl);
+                                if (!(line_stream >> X[d]))
+                                {
+                                    TBOX_ERROR(d_object_name << ":\n  Invalid entry in input file encountered on line "
+                                                             << k + 2 << " of file " << vertex_filename << std::endl);
+                                }
+                                X[d] = d_length_scale_factor * (X[d] + d_posn_shift[d]);
                             }
-                            X[d] = d_length_scale_factor * (X[d] + d_posn_shift[d]);
                         }
                     }
-                }
 
-                // Close the input file.
-                file_stream.close();
+                    // Close the input file.
+                    file_stream.close();
 
-                plog << d_object_name << ":  "
-                     << "read " << d_num_vertex[ln][j] << " vertices from ASCII input file named " << vertex_filename
-                     << std::endl
-                     << "  on MPI process " << IBTK_MPI::getRank() << std::endl;
-            }
-            else
-            {
-                TBOX_ERROR(d_object_name << ":\n  Cannot find required vertex file: " << vertex_filename << std::endl);
+                    plog << d_object_name << ":  "
+                         << "read " << d_num_vertex[ln][j] << " vertices from ASCII input file named "
+                         << vertex_filename << std::endl
+                         << "  on MPI process " << IBTK_MPI::getRank() << std::endl;
+                }
+                else
+                {
+                    TBOX_ERROR(d_object_name << ":\n  Cannot find required vertex file: " << vertex_filename
+                                             << std::endl);
+                }
             }
 
             // Free the next MPI process to start reading the current file.
@@ -293,9 +331,98 @@ IBStandardInitializer::readVertexFiles(const std::string& extension)
 
     // Synchronize the processes.
     if (d_use_file_batons) IBTK_MPI::barrier();
+
+    // Copy the vertices read on each node to node-shared memory and release
+    // the copies owned by the individual processes.
+    if (d_use_node_shared_memory)
+    {
+        d_shared_vertex_posn.resize(d_max_levels);
+        for (int ln = 0; ln < d_max_levels; ++ln)
+        {
+            int num_base_filename = static_cast<int>(d_base_filename[ln].size());
+            if (num_base_filename == 0) continue;
+            IBTK_MPI::bcast(d_num_vertex[ln].data(), num_base_filename, 0, node_comm);
+            int num_vertex = 0;
+            for (int j = 0; j < num_base_filename; ++j)
+            {
+                d_vertex_offset[ln][j] = num_vertex;
+                num_vertex += d_num_vertex[ln][j];
+            }
+            d_shared_vertex_posn[ln].reset(new NodeSharedArray<Point>(num_vertex, node_comm));
+            NodeSharedArray<Point>& vertex_posn = *d_shared_vertex_posn[ln];
+            if (vertex_posn.isNodeRoot())
+            {
+                for (int j = 0; j < num_base_filename; ++j)
+                {
+                    std::copy(d_vertex_posn[ln][j].begin(),
+                              d_vertex_posn[ln][j].end(),
+                              vertex_posn.data() + d_vertex_offset[ln][j]);
+                }
+            }
+            vertex_posn.synchronize();
+            std::vector<std::vector<Point> >(num_base_filename).swap(d_vertex_posn[ln]);
+        }
+        MPI_Comm_free(&node_comm);
+    }
     return;
 } // readVertexFiles
 
+void
+IBStandardInitializer::readBinaryVertexFile(std::ifstream& file_stream,
+                                            const std::string& vertex_filename,
+                                            const int ln,
+                                            const int j)
+{
+    // The header consists of an eight character tag, the spatial dimension,
+    // and the number of vertices.
+    std::array<char, 8> tag;
+    std::int32_t dim = 0, num_vertex = 0;
+    file_stream.read(tag.data(), tag.size());
+    file_stream.read(reinterpret_cast<char*>(&dim), sizeof(dim));
+    file_stream.read(reinterpret_cast<char*>(&num_vertex), sizeof(num_vertex));
+    if (!file_stream)
+    {
+        TBOX_ERROR(d_object_name << ":\n  Premature end to binary input file encountered in the header of file "
+                                 << vertex_filename << std::endl);
+    }
+    if (std::string(tag.data(), tag.size()) != "IBAMRVTX")
+    {
+        TBOX_ERROR(d_object_name << ":\n  Invalid header in binary input file " << vertex_filename << std::endl);
+    }
+    if (dim != NDIM)
+    {
+        TBOX_ERROR(d_object_name << ":\n  Binary input file " << vertex_filename << " contains " << dim
+                                 << "-dimensional vertex data but NDIM = " << NDIM << std::endl);
+    }
+    if (num_vertex <= 0)
+    {
+        TBOX_ERROR(d_object_name << ":\n  Invalid number of vertices in binary input file " << vertex_filename
+                                 << std::endl);
+    }
+    d_num_vertex[ln][j] = num_vertex;
+
+    // The coordinates are stored contiguously, so that they can be read in a
+    // single operation instead of being parsed line by line.
+    std::vector<double> coords(static_cast<std::size_t>(num_vertex) * NDIM);
+    file_stream.read(reinterpret_cast<char*>(coords.data()), coords.size() * sizeof(double));
+    if (!file_stream)
+    {
+        TBOX_ERROR(d_object_name << ":\n  Premature end to binary input file encountered in file "
+                                 << vertex_filename << std::endl);
+    }
+
+    d_vertex_posn[ln][j].resize(num_vertex);
+    for (int k = 0; k < num_vertex; ++k)
+    {
+        Point& X = d_vertex_posn[ln][j][k];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            X[d] = d_length_scale_factor * (coords[k * NDIM + d] + d_posn_shift[d]);
+        }
+    }
+    return;
+} // readBinaryVertexFile
+
 void
 IBStandardInitializer::readSpringFiles(const std::string& extension, const bool input_uses_global_idxs)
 {
@@ -2580,6 +2707,7 @@ IBStandardInitializer::getFromInput(Pointer<Database> db)
     // Determine whether to use "batons" to prevent multiple MPI processes from
     // reading the same file at once.
     if (db->keyExists("use_file_batons")) d_use_file_batons = db->getBool("use_file_batons");
+    if (db->keyExists("use_node_shared_memory")) d_use_node_shared_memory = db->getBool("use_node_shared_memory");
 
     // Determine the (maximum) number of levels in the locally refined grid.
     // Note that each piece of the Lagrangian structure must be assigned to a
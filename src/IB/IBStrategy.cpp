@@ -105,6 +105,18 @@ IBStrategy::registerEulerianCommunicationAlgorithms()
     return;
 } // registerEulerianCommunicationAlgorithms
 
+const IntVector<NDIM>&
+IBStrategy::getMinimumInterpolationGhostCellWidth() const
+{
+    return getMinimumGhostCellWidth();
+} // getMinimumInterpolationGhostCellWidth
+
+const IntVector<NDIM>&
+IBStrategy::getMinimumSpreadingGhostCellWidth() const
+{
+    return getMinimumGhostCellWidth();
+} // getMinimumSpreadingGhostCellWidth
+
 void
 IBStrategy::setupTagBuffer(Array<int>& tag_buffer, Pointer<GriddingAlgorithm<NDIM> > gridding_alg) const
 {
@@ -148,6 +160,12 @@ IBStrategy::getMaxPointDisplacement() const
     return std::numeric_limits<double>::max();
 } // getMaxPointDisplacement
 
+bool
+IBStrategy::areStructuresWithinRefinedRegions(int /*num_margin_cells*/) const
+{
+    return false;
+} // areStructuresWithinRefinedRegions
+
 void
 IBStrategy::preprocessIntegrateData(double /*current_time*/, double /*new_time*/, int /*num_cycles*/)
 {
@@ -183,6 +201,22 @@ IBStrategy::backwardEulerStep(double /*current_time*/, double /*new_time*/)
     return;
 } // backwardEulerStep
 
+bool
+IBStrategy::canDeferForceGhostDataAccumulation() const
+{
+    return false;
+} // canDeferForceGhostDataAccumulation
+
+void
+IBStrategy::setDeferForceGhostDataAccumulation(const bool defer_ghost_data_accumulation)
+{
+    if (defer_ghost_data_accumulation)
+    {
+        TBOX_ERROR("IBStrategy::setDeferForceGhostDataAccumulation(): unimplemented\n");
+    }
+    return;
+} // setDeferForceGhostDataAccumulation
+
 bool
 IBStrategy::hasFluidSources() const
 {
@@ -237,6 +271,27 @@ IBStrategy::postprocessData()
     return;
 } // postprocessData
 
+void
+IBStrategy::saveRollbackState(const int /*slot*/)
+{
+    TBOX_ERROR("IBStrategy::saveRollbackState(): unimplemented\n");
+    return;
+} // saveRollbackState
+
+void
+IBStrategy::restoreRollbackState(const int /*slot*/)
+{
+    TBOX_ERROR("IBStrategy::restoreRollbackState(): unimplemented\n");
+    return;
+} // restoreRollbackState
+
+void
+IBStrategy::discardRollbackState(const int /*slot*/)
+{
+    // intentionally blank
+    return;
+} // discardRollbackState
+
 void
 IBStrategy::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
                                      Pointer<GriddingAlgorithm<NDIM> > /*gridding_alg*/,
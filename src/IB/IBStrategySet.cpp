@@ -17,25 +17,34 @@
 #include "ibamr/IBStrategySet.h"
 #include "ibamr/ibamr_utilities.h"
 
+#include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/SAMRAIDataCache.h"
+#include "ibtk/SAMRAIGhostDataAccumulator.h"
+
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
 #include "GriddingAlgorithm.h"
+#include "HierarchyDataOpsManager.h"
+#include "HierarchyDataOpsReal.h"
 #include "IntVector.h"
 #include "LoadBalancer.h"
+#include "Patch.h"
+#include "PatchData.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "Variable.h"
+#include "VariableDatabase.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 
-namespace IBTK
-{
-class RobinPhysBdryPatchStrategy;
-} // namespace IBTK
-
 namespace IBAMR
 {
 class IBHierarchyIntegrator;
@@ -105,6 +114,28 @@ IBStrategySet::getMinimumGhostCellWidth() const
     return ghost_cell_width;
 } // getMinimumGhostCellWidth
 
+const IntVector<NDIM>&
+IBStrategySet::getMinimumInterpolationGhostCellWidth() const
+{
+    static IntVector<NDIM> ghost_cell_width = 0;
+    for (const auto& strategy : d_strategy_set)
+    {
+        ghost_cell_width = IntVector<NDIM>::max(ghost_cell_width, strategy->getMinimumInterpolationGhostCellWidth());
+    }
+    return ghost_cell_width;
+} // getMinimumInterpolationGhostCellWidth
+
+const IntVector<NDIM>&
+IBStrategySet::getMinimumSpreadingGhostCellWidth() const
+{
+    static IntVector<NDIM> ghost_cell_width = 0;
+    for (const auto& strategy : d_strategy_set)
+    {
+        ghost_cell_width = IntVector<NDIM>::max(ghost_cell_width, strategy->getMinimumSpreadingGhostCellWidth());
+    }
+    return ghost_cell_width;
+} // getMinimumSpreadingGhostCellWidth
+
 void
 IBStrategySet::setupTagBuffer(Array<int>& tag_buffer, Pointer<GriddingAlgorithm<NDIM> > gridding_alg) const
 {
@@ -127,6 +158,16 @@ IBStrategySet::getMaxPointDisplacement() const
     return displacement;
 } // getMaxPointDisplacement
 
+bool
+IBStrategySet::areStructuresWithinRefinedRegions(const int num_margin_cells) const
+{
+    for (const auto& strategy : d_strategy_set)
+    {
+        if (!strategy->areStructuresWithinRefinedRegions(num_margin_cells)) return false;
+    }
+    return true;
+} // areStructuresWithinRefinedRegions
+
 void
 IBStrategySet::preprocessIntegrateData(double current_time, double new_time, int num_cycles)
 {
@@ -210,16 +251,82 @@ IBStrategySet::computeLagrangianForce(double data_time)
     return;
 } // computeLagrangianForce
 
+void
+IBStrategySet::setCombineForceGhostDataAccumulation(const bool combine_ghost_data_accumulation)
+{
+    d_combine_force_ghost_data_accumulation = combine_ghost_data_accumulation;
+    return;
+} // setCombineForceGhostDataAccumulation
+
 void
 IBStrategySet::spreadForce(int f_data_idx,
                            RobinPhysBdryPatchStrategy* f_phys_bdry_op,
                            const std::vector<Pointer<RefineSchedule<NDIM> > >& f_prolongation_scheds,
                            double data_time)
 {
-    for (const auto& strategy : d_strategy_set)
+    // Determine which strategies leave the summation of their ghost data to
+    // this object.  Doing so only pays off if there are at least two of them.
+    std::vector<bool> defer_ghost_data_accumulation(d_strategy_set.size(), false);
+    int num_deferring_strategies = 0;
+    if (d_combine_force_ghost_data_accumulation && d_hierarchy)
+    {
+        for (unsigned int k = 0; k < d_strategy_set.size(); ++k)
+        {
+            defer_ghost_data_accumulation[k] = d_strategy_set[k]->canDeferForceGhostDataAccumulation();
+            if (defer_ghost_data_accumulation[k]) ++num_deferring_strategies;
+        }
+    }
+    if (num_deferring_strategies < 2) defer_ghost_data_accumulation.assign(d_strategy_set.size(), false);
+
+    for (unsigned int k = 0; k < d_strategy_set.size(); ++k)
+    {
+        if (defer_ghost_data_accumulation[k]) continue;
+        d_strategy_set[k]->spreadForce(f_data_idx, f_phys_bdry_op, f_prolongation_scheds, data_time);
+    }
+    if (num_deferring_strategies < 2) return;
+
+    // Spread the forces of the remaining strategies into a shared buffer on the
+    // finest level of the patch hierarchy.
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    d_eulerian_data_cache.resetLevels(finest_ln, finest_ln);
+    const auto f_buffer_data_idx = d_eulerian_data_cache.getCachedPatchDataIndex(f_data_idx);
+    Pointer<Variable<NDIM> > f_var;
+    VariableDatabase<NDIM>::getDatabase()->mapIndexToVariable(f_data_idx, f_var);
+    auto f_data_ops = HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, d_hierarchy, true);
+    f_data_ops->resetLevels(finest_ln, finest_ln);
+    f_data_ops->setToScalar(f_buffer_data_idx, 0.0, /*interior_only*/ false);
+    for (unsigned int k = 0; k < d_strategy_set.size(); ++k)
+    {
+        if (!defer_ghost_data_accumulation[k]) continue;
+        d_strategy_set[k]->setDeferForceGhostDataAccumulation(true);
+        d_strategy_set[k]->spreadForce(f_buffer_data_idx, nullptr, f_prolongation_scheds, data_time);
+        d_strategy_set[k]->setDeferForceGhostDataAccumulation(false);
+    }
+
+    // Deal with force values spread outside the physical domain before they
+    // are discarded by the accumulation step.
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(finest_ln);
+    if (f_phys_bdry_op)
+    {
+        f_phys_bdry_op->setPatchDataIndex(f_buffer_data_idx);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            const Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_buffer_data_idx);
+            f_phys_bdry_op->accumulateFromPhysicalBoundaryData(*patch, data_time, f_data->getGhostCellWidth());
+        }
+    }
+
+    // Sum the values spread into patch ghost regions once for all of the
+    // deferring strategies and add the result to the force.
+    if (!d_ghost_data_accumulator)
     {
-        strategy->spreadForce(f_data_idx, f_phys_bdry_op, f_prolongation_scheds, data_time);
+        const IntVector<NDIM> gcw =
+            level->getPatchDescriptor()->getPatchDataFactory(f_buffer_data_idx)->getGhostCellWidth();
+        d_ghost_data_accumulator.reset(new SAMRAIGhostDataAccumulator(d_hierarchy, f_var, gcw, finest_ln, finest_ln));
     }
+    d_ghost_data_accumulator->accumulateGhostData(f_buffer_data_idx);
+    f_data_ops->add(f_data_idx, f_data_idx, f_buffer_data_idx);
     return;
 } // spreadForce
 
@@ -321,6 +428,9 @@ IBStrategySet::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hierarchy
                                            init_data_time,
                                            initial_time);
     }
+    d_hierarchy = hierarchy;
+    d_eulerian_data_cache.setPatchHierarchy(hierarchy);
+    d_ghost_data_accumulator.reset();
     return;
 } // initializePatchHierarchy
 
@@ -353,6 +463,7 @@ IBStrategySet::beginDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
     {
         strategy->beginDataRedistribution(hierarchy, gridding_alg);
     }
+    d_ghost_data_accumulator.reset();
     return;
 } // beginDataRedistribution
 
@@ -22,6 +22,8 @@
 #include "tbox/AbstractStream.h"
 #include "tbox/Pointer.h"
 
+#include <vector>
+
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 
 namespace SAMRAI
@@ -69,6 +71,48 @@ IBTargetPointForceSpec::Factory::unpackStream(AbstractStream& stream, const IntV
     return ret_val;
 } // unpackStream
 
+void
+IBTargetPointForceSpec::Factory::packStreams(AbstractStream& stream,
+                                             const Pointer<Streamable>* const data_items,
+                                             const int num_items)
+{
+    std::vector<int> master_idxs(num_items);
+    std::vector<double> values((2 + NDIM) * num_items);
+    for (int k = 0; k < num_items; ++k)
+    {
+        const auto spec = static_cast<const IBTargetPointForceSpec*>(data_items[k].getPointer());
+        master_idxs[k] = spec->d_master_idx;
+        values[(2 + NDIM) * k] = spec->d_kappa_target;
+        values[(2 + NDIM) * k + 1] = spec->d_eta_target;
+        for (unsigned int d = 0; d < NDIM; ++d) values[(2 + NDIM) * k + 2 + d] = spec->d_X_target[d];
+    }
+    stream.pack(master_idxs.data(), num_items);
+    stream.pack(values.data(), (2 + NDIM) * num_items);
+    return;
+} // packStreams
+
+void
+IBTargetPointForceSpec::Factory::unpackStreams(AbstractStream& stream,
+                                               const IntVector<NDIM>& /*offset*/,
+                                               Pointer<Streamable>* const data_items,
+                                               const int num_items)
+{
+    std::vector<int> master_idxs(num_items);
+    std::vector<double> values((2 + NDIM) * num_items);
+    stream.unpack(master_idxs.data(), num_items);
+    stream.unpack(values.data(), (2 + NDIM) * num_items);
+    for (int k = 0; k < num_items; ++k)
+    {
+        Pointer<IBTargetPointForceSpec> spec = new IBTargetPointForceSpec();
+        spec->d_master_idx = master_idxs[k];
+        spec->d_kappa_target = values[(2 + NDIM) * k];
+        spec->d_eta_target = values[(2 + NDIM) * k + 1];
+        for (unsigned int d = 0; d < NDIM; ++d) spec->d_X_target[d] = values[(2 + NDIM) * k + 2 + d];
+        data_items[k] = spec;
+    }
+    return;
+} // unpackStreams
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
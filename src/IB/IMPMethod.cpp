@@ -102,6 +102,9 @@ namespace
 {
 static const std::string KERNEL_FCN = "IB_6";
 static const int kernel_width = 3;
+static const int stencil_size = 2 * kernel_width;
+using KernelValues = std::array<std::array<double, stencil_size>, NDIM>;
+
 void
 kernel(const double X,
        const double patch_x_lower,
@@ -111,8 +114,8 @@ kernel(const double X,
        const int /*patch_box_upper*/,
        int& stencil_box_lower,
        int& stencil_box_upper,
-       boost::multi_array<double, 1>& phi,
-       boost::multi_array<double, 1>& dphi)
+       std::array<double, stencil_size>& phi,
+       std::array<double, stencil_size>& dphi)
 {
     const double X_o_dx = (X - patch_x_lower) / dx;
     stencil_box_lower = boost::math::round(X_o_dx) + patch_box_lower - kernel_width;
@@ -436,6 +439,8 @@ IMPMethod::interpolateVelocity(const int u_data_idx,
             {
                 side_boxes[axis] = SideGeometry<NDIM>::toSideBox(u_data->getGhostBox() * idx_data->getGhostBox(), axis);
             }
+            Box<NDIM> stencil_box;
+            KernelValues phi, dphi, dphi_o_dx;
             for (LNodeSetData::CellIterator it(idx_data->getGhostBox()); it; it++)
             {
                 const hier::Index<NDIM>& i = *it;
@@ -450,14 +455,6 @@ IMPMethod::interpolateVelocity(const int u_data_idx,
 
                     // Interpolate U and Grad U using a smoothed kernel
                     // function evaluated about X.
-                    Box<NDIM> stencil_box;
-                    const int stencil_size = LEInteractor::getStencilSize(KERNEL_FCN);
-                    std::array<boost::multi_array<double, 1>, NDIM> phi, dphi;
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        phi[d].resize(boost::extents[stencil_size]);
-                        dphi[d].resize(boost::extents[stencil_size]);
-                    }
                     for (unsigned int component = 0; component < NDIM; ++component)
                     {
                         for (unsigned int d = 0; d < NDIM; ++d)
@@ -472,6 +469,7 @@ IMPMethod::interpolateVelocity(const int u_data_idx,
                                    stencil_box.upper(d),
                                    phi[d],
                                    dphi[d]);
+                            for (int k = 0; k < stencil_size; ++k) dphi_o_dx[d][k] = dphi[d][k] / dx[d];
                         }
                         for (Box<NDIM>::Iterator b(stencil_box * side_boxes[component]); b; b++)
                         {
@@ -490,14 +488,7 @@ IMPMethod::interpolateVelocity(const int u_data_idx,
                                 double dw_dx_k = 1.0;
                                 for (unsigned int d = 0; d < NDIM; ++d)
                                 {
-                                    if (d == k)
-                                    {
-                                        dw_dx_k *= dphi[d][i_shift(d)] / dx[d];
-                                    }
-                                    else
-                                    {
-                                        dw_dx_k *= phi[d][i_shift(d)];
-                                    }
+                                    dw_dx_k *= (d == k ? dphi_o_dx[d][i_shift(d)] : phi[d][i_shift(d)]);
                                 }
                                 Grad_U(component, k) -= u * dw_dx_k;
                             }
@@ -702,6 +693,8 @@ IMPMethod::computeLagrangianForce(const double data_time)
     bool* X_needs_ghost_fill;
     getPositionData(&X_data, &X_needs_ghost_fill, data_time);
     getDeformationGradientData(&F_data, data_time);
+    const bool has_stress_fcn = d_PK1_stress_fcn || d_PK1_stress_batch_fcn;
+    MaterialPointBatch& mp = d_mp_batch;
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
@@ -711,45 +704,112 @@ IMPMethod::computeLagrangianForce(const double data_time)
         boost::multi_array_ref<double, 2>& X_array = *d_X0_data[ln]->getVecArray();
         boost::multi_array_ref<double, 2>& F_array = *(*F_data)[ln]->getVecArray();
         boost::multi_array_ref<double, 2>& tau_array = *d_tau_data[ln]->getVecArray();
-        TensorValue<double> FF, PP, tau;
-        VectorValue<double> X, x;
+
+        // Gather the material point data into contiguous arrays and zero out
+        // the stress at all other nodes.
+        mp.petsc_idxs.clear();
+        mp.subdomain_ids.clear();
+        mp.internal_vars.clear();
         for (const auto& node_idx : local_nodes)
         {
             const int idx = node_idx->getGlobalPETScIndex();
             auto mp_spec = node_idx->getNodeDataItem<MaterialPointSpec>();
-            if (mp_spec && d_PK1_stress_fcn)
+            if (mp_spec && has_stress_fcn)
             {
-                for (int i = 0; i < NDIM; ++i)
+                mp.petsc_idxs.push_back(idx);
+                mp.subdomain_ids.push_back(mp_spec->getSubdomainId());
+                mp.internal_vars.push_back(&mp_spec->getInternalVariables());
+            }
+            else
+            {
+                for (int k = 0; k < NDIM * NDIM; ++k) tau_array[idx][k] = 0.0;
+            }
+        }
+        const int num_points = static_cast<int>(mp.petsc_idxs.size());
+        if (num_points == 0) continue;
+        mp.FF.assign(9 * num_points, 0.0);
+        mp.PP.assign(9 * num_points, 0.0);
+        mp.x.resize(NDIM * num_points);
+        mp.X.resize(NDIM * num_points);
+        for (int k = 0; k < num_points; ++k)
+        {
+            const int idx = mp.petsc_idxs[k];
+            for (int i = 0; i < NDIM; ++i)
+            {
+                for (int j = 0; j < NDIM; ++j)
                 {
-                    for (int j = 0; j < NDIM; ++j)
-                    {
-                        FF(i, j) = F_array[idx][NDIM * i + j];
-                    }
-                    x(i) = x_array[idx][i];
-                    X(i) = X_array[idx][i];
+                    mp.FF[9 * k + 3 * i + j] = F_array[idx][NDIM * i + j];
                 }
+                mp.x[NDIM * k + i] = x_array[idx][i];
+                mp.X[NDIM * k + i] = X_array[idx][i];
+            }
 #if (NDIM == 2)
-                FF(2, 2) = 1.0;
+            mp.FF[9 * k + 8] = 1.0;
 #endif
+        }
+
+        // Evaluate the constitutive model.
+        if (d_PK1_stress_batch_fcn)
+        {
+            (*d_PK1_stress_batch_fcn)(mp.PP.data(),
+                                      mp.FF.data(),
+                                      mp.x.data(),
+                                      mp.X.data(),
+                                      mp.subdomain_ids.data(),
+                                      mp.internal_vars.data(),
+                                      num_points,
+                                      data_time,
+                                      d_PK1_stress_batch_fcn_ctx);
+        }
+        else
+        {
+            TensorValue<double> FF, PP;
+            VectorValue<double> X, x;
+            for (int k = 0; k < num_points; ++k)
+            {
+                for (int i = 0; i < 3; ++i)
+                {
+                    for (int j = 0; j < 3; ++j)
+                    {
+                        FF(i, j) = mp.FF[9 * k + 3 * i + j];
+                    }
+                }
+                for (int i = 0; i < NDIM; ++i)
+                {
+                    x(i) = mp.x[NDIM * k + i];
+                    X(i) = mp.X[NDIM * k + i];
+                }
                 (*d_PK1_stress_fcn)(PP,
                                     FF,
                                     x,
                                     X,
-                                    mp_spec->getSubdomainId(),
-                                    mp_spec->getInternalVariables(),
+                                    mp.subdomain_ids[k],
+                                    *mp.internal_vars[k],
                                     data_time,
                                     d_PK1_stress_fcn_ctx);
-                tau = PP * FF.transpose();
-            }
-            else
-            {
-                tau.zero();
+                for (int i = 0; i < 3; ++i)
+                {
+                    for (int j = 0; j < 3; ++j)
+                    {
+                        mp.PP[9 * k + 3 * i + j] = PP(i, j);
+                    }
+                }
             }
+        }
+
+        // Compute the Cauchy-like stress tau = PP * FF^T and scatter it back.
+        for (int k = 0; k < num_points; ++k)
+        {
+            const double* const PP = &mp.PP[9 * k];
+            const double* const FF = &mp.FF[9 * k];
+            const int idx = mp.petsc_idxs[k];
             for (int i = 0; i < NDIM; ++i)
             {
                 for (int j = 0; j < NDIM; ++j)
                 {
-                    tau_array[idx][NDIM * i + j] = tau(i, j);
+                    double tau_ij = 0.0;
+                    for (int l = 0; l < 3; ++l) tau_ij += PP[3 * i + l] * FF[3 * j + l];
+                    tau_array[idx][NDIM * i + j] = tau_ij;
                 }
             }
         }
@@ -824,6 +884,8 @@ IMPMethod::spreadForce(const int f_data_idx,
             const double* const dx = patch_geom->getDx();
             double dV_c = 1.0;
             for (unsigned int d = 0; d < NDIM; ++d) dV_c *= dx[d];
+            Box<NDIM> stencil_box;
+            KernelValues phi, dphi, dphi_o_dx;
             for (LNodeSetData::CellIterator it(idx_data->getGhostBox()); it; it++)
             {
                 const hier::Index<NDIM>& i = *it;
@@ -847,14 +909,6 @@ IMPMethod::spreadForce(const int f_data_idx,
 
                     // Weight tau using a smooth kernel function evaluated about
                     // X.
-                    Box<NDIM> stencil_box;
-                    const int stencil_size = LEInteractor::getStencilSize(KERNEL_FCN);
-                    std::array<boost::multi_array<double, 1>, NDIM> phi, dphi;
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        phi[d].resize(boost::extents[stencil_size]);
-                        dphi[d].resize(boost::extents[stencil_size]);
-                    }
                     for (unsigned int component = 0; component < NDIM; ++component)
                     {
                         for (unsigned int d = 0; d < NDIM; ++d)
@@ -869,6 +923,7 @@ IMPMethod::spreadForce(const int f_data_idx,
                                    stencil_box.upper(d),
                                    phi[d],
                                    dphi[d]);
+                            for (int k = 0; k < stencil_size; ++k) dphi_o_dx[d][k] = dphi[d][k] / dx[d];
                         }
                         for (Box<NDIM>::Iterator b(stencil_box * side_boxes[component]); b; b++)
                         {
@@ -881,14 +936,7 @@ IMPMethod::spreadForce(const int f_data_idx,
                                 double dw_dx_k = 1.0;
                                 for (unsigned int d = 0; d < NDIM; ++d)
                                 {
-                                    if (d == k)
-                                    {
-                                        dw_dx_k *= dphi[d][i_shift(d)] / dx[d];
-                                    }
-                                    else
-                                    {
-                                        dw_dx_k *= phi[d][i_shift(d)];
-                                    }
+                                    dw_dx_k *= (d == k ? dphi_o_dx[d][i_shift(d)] : phi[d][i_shift(d)]);
                                 }
                                 f += tau(component, k) * dw_dx_k;
                             }
@@ -948,6 +996,15 @@ IMPMethod::registerPK1StressTensorFunction(PK1StressFcnPtr PK1_stress_fcn, void*
     return;
 } // registerPK1StressTensorFunction
 
+void
+IMPMethod::registerPK1StressTensorBatchFunction(PK1StressBatchFcnPtr PK1_stress_batch_fcn,
+                                                void* PK1_stress_batch_fcn_ctx)
+{
+    d_PK1_stress_batch_fcn = PK1_stress_batch_fcn;
+    d_PK1_stress_batch_fcn_ctx = PK1_stress_batch_fcn_ctx;
+    return;
+} // registerPK1StressTensorBatchFunction
+
 void
 IMPMethod::registerLoadBalancer(Pointer<LoadBalancer<NDIM> > load_balancer, int workload_data_idx)
 {
@@ -434,7 +434,10 @@ KrylovMobilitySolver::solveSystem(Vec x, Vec b)
     VecCopy(b, d_petsc_b);
 
     // Solve the system using a PETSc KSP object.
+    d_initial_outer_residual_norm = 0.0;
+    d_outer_residual_norm = 0.0;
     KSPSolve(d_petsc_ksp, d_petsc_b, d_petsc_x);
+    if (d_adaptive_stokes_tolerance) d_LInv->setRelativeTolerance(d_stokes_rel_residual_tol);
     KSPGetIterationNumber(d_petsc_ksp, &d_current_iterations);
     KSPGetResidualNorm(d_petsc_ksp, &d_current_residual_norm);
 
@@ -480,6 +483,7 @@ KrylovMobilitySolver::initializeSolverState(Vec x, Vec b)
         d_samrai_temp[i] = vx0->cloneVector("");
         d_samrai_temp[i]->allocateVectorData();
     }
+    if (d_reuse_stokes_solution) d_samrai_temp[1]->setToScalar(0.0);
     IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVectorRead(vx[0], &vx0);
 
     // Initialize PETSc KSP
@@ -580,6 +584,12 @@ KrylovMobilitySolver::getFromInput(Pointer<Database> input_db)
     if (input_db->keyExists("normalize_pressure")) d_normalize_pressure = input_db->getBool("normalize_pressure");
     if (input_db->keyExists("normalize_velocity")) d_normalize_velocity = input_db->getBool("normalize_velocity");
     if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+    if (input_db->keyExists("reuse_stokes_solution"))
+        d_reuse_stokes_solution = input_db->getBool("reuse_stokes_solution");
+    if (input_db->keyExists("adaptive_stokes_tolerance"))
+        d_adaptive_stokes_tolerance = input_db->getBool("adaptive_stokes_tolerance");
+    if (input_db->keyExists("max_stokes_rel_residual_tol"))
+        d_max_stokes_rel_residual_tol = input_db->getDouble("max_stokes_rel_residual_tol");
 } // getFromInput
 
 void
@@ -720,14 +730,16 @@ KrylovMobilitySolver::initializeStokesSolver(const SAMRAIVectorReal<NDIM, double
                                                   d_ins_integrator->getProjectionBoundaryConditions());
         }
 
-        // In preconditioner initial guess has to be zero.
-        p_stokes_linear_solver->setInitialGuessNonzero(false);
+        // Unless the previous inner solution is reused, the initial guess
+        // has to be zero.
+        p_stokes_linear_solver->setInitialGuessNonzero(d_reuse_stokes_solution);
         if (has_velocity_nullspace || has_pressure_nullspace)
         {
             p_stokes_linear_solver->setNullspace(false, d_nul_vecs);
         }
         p_stokes_linear_solver->initializeSolverState(sol_vec, rhs_vec);
     }
+    d_stokes_rel_residual_tol = d_LInv->getRelativeTolerance();
 } // initializeStokesSolver
 
 void
@@ -835,16 +847,24 @@ KrylovMobilitySolver::resetKSPOptions()
     KSPSetInitialGuessNonzero(d_petsc_ksp, initial_guess_nonzero);
     KSPSetTolerances(d_petsc_ksp, d_rel_residual_tol, d_abs_residual_tol, PETSC_DEFAULT, d_max_iterations);
 
-    // Set KSP monitor routine.
+    // Set KSP monitor routines.
+    if (d_enable_logging || d_adaptive_stokes_tolerance) KSPMonitorCancel(d_petsc_ksp);
     if (d_enable_logging)
     {
-        KSPMonitorCancel(d_petsc_ksp);
         KSPMonitorSet(
             d_petsc_ksp,
             reinterpret_cast<PetscErrorCode (*)(KSP, PetscInt, PetscReal, void*)>(KrylovMobilitySolver::monitorKSP),
             nullptr,
             nullptr);
     }
+    if (d_adaptive_stokes_tolerance)
+    {
+        KSPMonitorSet(d_petsc_ksp,
+                      reinterpret_cast<PetscErrorCode (*)(KSP, PetscInt, PetscReal, void*)>(
+                          KrylovMobilitySolver::trackResidualNormKSP),
+                      static_cast<void*>(this),
+                      nullptr);
+    }
 } // resetKSPOptions
 
 void
@@ -950,7 +970,19 @@ KrylovMobilitySolver::MatVecMult_KMInv(Mat A, Vec x, Vec y)
         solver->d_cib_strategy->subtractMeanConstraintForce(
             x, solver->d_samrai_temp[0]->getComponentDescriptorIndex(0), gamma);
     }
-    // 2) Solve Stokes system.
+    // 2) Solve Stokes system. When requested, the inner tolerance is relaxed
+    // in proportion to the reduction of the outer residual.
+    if (solver->d_adaptive_stokes_tolerance)
+    {
+        double stokes_rel_residual_tol = solver->d_stokes_rel_residual_tol;
+        if (solver->d_outer_residual_norm > 0.0 && solver->d_initial_outer_residual_norm > 0.0)
+        {
+            stokes_rel_residual_tol *= solver->d_initial_outer_residual_norm / solver->d_outer_residual_norm;
+        }
+        stokes_rel_residual_tol = std::max(solver->d_stokes_rel_residual_tol,
+                                           std::min(stokes_rel_residual_tol, solver->d_max_stokes_rel_residual_tol));
+        solver->d_LInv->setRelativeTolerance(stokes_rel_residual_tol);
+    }
     solver->d_LInv->solveSystem(*solver->d_samrai_temp[1], *solver->d_samrai_temp[0]);
 
     // 3a) Fill velocity ghost cells.
@@ -1001,6 +1033,16 @@ PetscErrorCode KrylovMobilitySolver::PCApply_KMInv(PC /*pc*/, Vec /*x*/, Vec /*y
     PetscFunctionReturn(0);
 } // PCApply_KMInv
 
+// Routine to record the outer residual norm for the inner solver tolerance
+PetscErrorCode
+KrylovMobilitySolver::trackResidualNormKSP(KSP /*ksp*/, int it, PetscReal rnorm, void* mctx)
+{
+    auto solver = static_cast<KrylovMobilitySolver*>(mctx);
+    if (it == 0) solver->d_initial_outer_residual_norm = rnorm;
+    solver->d_outer_residual_norm = rnorm;
+    PetscFunctionReturn(0);
+} // trackResidualNormKSP
+
 // Routine to log output of KrylovMobilitySolver
 PetscErrorCode
 KrylovMobilitySolver::monitorKSP(KSP ksp, int it, PetscReal rnorm, void* /*mctx*/)
@@ -15,6 +15,7 @@
 
 #include "ibamr/NonbondedForceEvaluator.h"
 
+#include "ibtk/IBTK_MPI.h"
 #include "ibtk/LData.h"
 #include "ibtk/LDataManager.h"
 #include "ibtk/LIndexSetData.h"
@@ -41,6 +42,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <string>
 
 #include "ibamr/app_namespaces.h" // IWYU pragma: keep
@@ -82,6 +84,9 @@ NonbondedForceEvaluator::NonbondedForceEvaluator(Pointer<Database> input_db,
 
     // get parameters for force function
     d_parameters = input_db->getDoubleArray("parameters");
+
+    // get the (optional) skin distance used to reuse pair lists
+    if (input_db->keyExists("skin_distance")) d_skin_distance = input_db->getDouble("skin_distance");
 }
 
 void
@@ -108,8 +113,6 @@ NonbondedForceEvaluator::evaluateForces(int mstr_petsc_idx,
     //
     //////////////////////////////////////////////////////////////////////////////////
 
-    // get vectors of data
-    // How costly is this?  TODO: Check, maybe just do this once in the loop.
     PetscScalar* position;
     VecGetArray(X_data->getVec(), &position);
     PetscScalar* force;
@@ -119,28 +122,35 @@ NonbondedForceEvaluator::evaluateForces(int mstr_petsc_idx,
     const double* x_lower = d_grid_geometry->getXLower();
     const double* x_upper = d_grid_geometry->getXUpper();
 
-    double R = 0.0; // distance between particles
-    double D[NDIM]; // vector connecting particles.
-
+    NonbondedPair pair;
+    pair.mstr_petsc_idx = mstr_petsc_idx;
+    pair.search_petsc_idx = search_petsc_idx;
     for (int k = 0; k < NDIM; ++k)
     {
-        D[k] = (position[mstr_petsc_idx * NDIM + k] - position[search_petsc_idx * NDIM + k] -
-                cell_offset[k] * (x_upper[k] - x_lower[k]));
-        R += std::pow(D[k], 2);
+        pair.periodic_shift[k] = cell_offset[k] * (x_upper[k] - x_lower[k]);
     }
-    R = std::sqrt(R);
+    evaluatePairForce(pair, position, force);
 
-    double nonbdd_force[NDIM];
-    (d_force_fcn_ptr)(D, d_parameters, nonbdd_force);
-    for (int k = 0; k < NDIM; ++k)
-    {
-        force[mstr_petsc_idx * NDIM + k] += nonbdd_force[k];
-        force[search_petsc_idx * NDIM + k] += -1.0 * nonbdd_force[k];
-    }
     VecRestoreArray(F_data->getVec(), &force);
+    VecRestoreArray(X_data->getVec(), &position);
     return;
 } // evaluateForces
 
+void
+NonbondedForceEvaluator::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                             const int /*level_number*/,
+                                             const double /*init_data_time*/,
+                                             const bool /*initial_time*/,
+                                             LDataManager* const /*l_data_manager*/)
+{
+    // The local PETSc indices of the nodes change when the Lagrangian data are
+    // redistributed, so any stored pair list is no longer usable.
+    d_pairs.clear();
+    d_X_pair_list.clear();
+    d_pair_list_is_valid = false;
+    return;
+} // initializeLevelData
+
 void
 NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
                                                 Pointer<LData> X_data,
@@ -154,15 +164,93 @@ NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
     if (!grid_geom->getDomainIsSingleBox()) TBOX_ERROR("physical domain must be a single box...\n");
 
-    // These will only work if the domain is a single box.
-    assert(grid_geom->getDomainIsSingleBox());
+    PetscScalar* position;
+    VecGetArray(X_data->getVec(), &position);
+    PetscScalar* force;
+    VecGetArray(F_data->getVec(), &force);
+
+    if (d_skin_distance > 0.0)
+    {
+        // Rebuild the pair list only once some node has moved more than half
+        // of the skin distance since the list was built. This guarantees that
+        // no pair of nodes that was outside of the extended cutoff radius can
+        // have come within the interaction radius in the meantime.
+        const int n_local = static_cast<int>(X_data->getLocalNodeCount());
+        double max_displacement_sq = std::numeric_limits<double>::max();
+        if (d_pair_list_is_valid && d_pair_list_level_number == level_number &&
+            static_cast<int>(d_X_pair_list.size()) == n_local * NDIM)
+        {
+            const double* const dx_coarsest = grid_geom->getDx();
+            const IntVector<NDIM>& ratio = hierarchy->getPatchLevel(level_number)->getRatio();
+            max_displacement_sq = 0.0;
+            for (int i = 0; i < n_local; ++i)
+            {
+                double displacement_sq = 0.0;
+                for (int k = 0; k < NDIM; ++k)
+                {
+                    const double dX = (position[i * NDIM + k] - d_X_pair_list[i * NDIM + k]) *
+                                      static_cast<double>(ratio(k)) / dx_coarsest[k];
+                    displacement_sq += dX * dX;
+                }
+                max_displacement_sq = std::max(max_displacement_sq, displacement_sq);
+            }
+        }
+        max_displacement_sq = IBTK_MPI::maxReduction(max_displacement_sq);
+        const bool rebuild = 4.0 * max_displacement_sq > d_skin_distance * d_skin_distance;
+        if (rebuild)
+        {
+            d_pairs.clear();
+            findPairs(d_pairs, position, hierarchy, level_number, l_data_manager, d_skin_distance);
+            d_X_pair_list.assign(position, position + n_local * NDIM);
+            d_pair_list_level_number = level_number;
+            d_pair_list_is_valid = true;
+        }
+        for (const NonbondedPair& pair : d_pairs) evaluatePairForce(pair, position, force);
+    }
+    else
+    {
+        std::vector<NonbondedPair> pairs;
+        findPairs(pairs, position, hierarchy, level_number, l_data_manager, /*skin_distance*/ -1.0);
+        for (const NonbondedPair& pair : pairs) evaluatePairForce(pair, position, force);
+    }
+
+    VecRestoreArray(F_data->getVec(), &force);
+    VecRestoreArray(X_data->getVec(), &position);
+    return;
+} // computeLagrangianForce
+
+void
+NonbondedForceEvaluator::registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr)
+{
+    // set the nonbonded force function pointer to the given force function pointer
+    d_force_fcn_ptr = force_fcn_ptr;
+    return;
+} // registerForceFcnPtr
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+NonbondedForceEvaluator::findPairs(std::vector<NonbondedPair>& pairs,
+                                   const double* const position,
+                                   const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                   const int level_number,
+                                   LDataManager* const l_data_manager,
+                                   const double skin_distance) const
+{
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
     const double* const x_lower = grid_geom->getXLower();
     const double* const x_upper = grid_geom->getXUpper();
 
     // we will grow the search box by interaction_radius + 2.0*regrid_alpha
-    IntVector<NDIM> grow_amount(static_cast<int>(ceil(d_interaction_radius + 2.0 * d_regrid_alpha)));
+    // (plus the skin distance when a pair list is being constructed).
+    const double search_radius = d_interaction_radius + 2.0 * d_regrid_alpha + std::max(skin_distance, 0.0);
+    IntVector<NDIM> grow_amount(static_cast<int>(ceil(search_radius)));
     const int lag_node_idx_current_idx = l_data_manager->getLNodePatchDescriptorIndex();
 
+    // When a pair list is being constructed, only keep the pairs that are
+    // within the interaction radius plus the skin distance.
+    const double list_radius_sq = skin_distance > 0.0 ? std::pow(d_interaction_radius + skin_distance, 2) : -1.0;
+
     // iterate through levels.
     Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
@@ -173,7 +261,7 @@ NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
         const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
         const double* const patch_dx = patch_geom->getDx();
 
-        std::vector<int> cell_offset(NDIM);
+        NonbondedPair pair;
         // Loop through cells in this processors patch. For each iteration, this
         // is the "master" cell. Iterate through particles in the box, and add
         // springs.
@@ -194,6 +282,8 @@ NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
                     // point we know both cells, need to figure out periodic
                     // additions.
                     const hier::Index<NDIM>& search_cell_idx = *scit;
+                    LNodeSet* search_node_set = current_idx_data->getItem(search_cell_idx);
+                    if (!search_node_set) continue;
 
                     // search across periodic boundaries.
                     for (int k = 0; k < NDIM; ++k)
@@ -201,46 +291,69 @@ NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
                         // Difference between lower boundary and this search cell.
                         double absolute_diff = search_cell_idx[k] * patch_dx[k];
                         // Periodic offset of this cell.
-                        cell_offset[k] = floor(absolute_diff / (x_upper[k] - x_lower[k]));
+                        pair.periodic_shift[k] = floor(absolute_diff / (x_upper[k] - x_lower[k])) *
+                                                 (x_upper[k] - x_lower[k]);
                     }
-                    LNodeSet* search_node_set = current_idx_data->getItem(search_cell_idx);
-                    if (search_node_set)
+
+                    // we have a set of nodes in the first cell and the search
+                    // cell, so record the interacting pairs.
+                    for (const auto& mstr_node_idx : *mstr_node_set)
                     {
-                        // we have a set of nodes in the first cell and the search cell,
-                        // add up forces
-                        // and accumulate for the first cell.
-                        for (const auto& mstr_node_idx : *mstr_node_set)
-                        {
-                            // master nodes
-                            const int mstr_lag_idx = mstr_node_idx->getLagrangianIndex();
-                            const int mstr_petsc_idx = mstr_node_idx->getLocalPETScIndex();
+                        // master nodes
+                        const int mstr_lag_idx = mstr_node_idx->getLagrangianIndex();
+                        pair.mstr_petsc_idx = mstr_node_idx->getLocalPETScIndex();
 
-                            for (const auto& search_node_idx : *search_node_set)
+                        for (const auto& search_node_idx : *search_node_set)
+                        {
+                            const int search_lag_idx = search_node_idx->getLagrangianIndex();
+                            if (mstr_lag_idx >= search_lag_idx) continue;
+                            pair.search_petsc_idx = search_node_idx->getLocalPETScIndex();
+                            if (list_radius_sq > 0.0)
                             {
-                                const int search_lag_idx = search_node_idx->getLagrangianIndex();
-                                const int search_petsc_idx = search_node_idx->getLocalPETScIndex();
-                                if (mstr_lag_idx < search_lag_idx)
+                                // The distance is measured in units of the
+                                // grid spacing, as is the interaction radius.
+                                double R_sq = 0.0;
+                                for (int k = 0; k < NDIM; ++k)
                                 {
-                                    // apply forces with the force evaluator
-                                    evaluateForces(mstr_petsc_idx, search_petsc_idx, X_data, cell_offset, F_data);
+                                    const double D = (position[pair.mstr_petsc_idx * NDIM + k] -
+                                                      position[pair.search_petsc_idx * NDIM + k] -
+                                                      pair.periodic_shift[k]) /
+                                                     patch_dx[k];
+                                    R_sq += D * D;
                                 }
-                            } // search node index
-                        }     // mstr node index
-                    }         // if(search node set)
-                }             // search cell loop
-            }                 // if mastr_node_idx
-        }                     // first cell
-    }                         // patches
+                                if (R_sq >= list_radius_sq) continue;
+                            }
+                            pairs.push_back(pair);
+                        } // search node index
+                    }     // mstr node index
+                }         // search cell loop
+            }             // if mastr_node_idx
+        }                 // first cell
+    }                     // patches
     return;
-} // computeLagrangianForce
+} // findPairs
 
 void
-NonbondedForceEvaluator::registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr)
+NonbondedForceEvaluator::evaluatePairForce(const NonbondedPair& pair,
+                                           const double* const position,
+                                           double* const force) const
 {
-    // set the nonbonded force function pointer to the given force function pointer
-    d_force_fcn_ptr = force_fcn_ptr;
+    double D[NDIM]; // vector connecting particles.
+    for (int k = 0; k < NDIM; ++k)
+    {
+        D[k] = position[pair.mstr_petsc_idx * NDIM + k] - position[pair.search_petsc_idx * NDIM + k] -
+               pair.periodic_shift[k];
+    }
+
+    double nonbdd_force[NDIM];
+    (d_force_fcn_ptr)(D, d_parameters, nonbdd_force);
+    for (int k = 0; k < NDIM; ++k)
+    {
+        force[pair.mstr_petsc_idx * NDIM + k] += nonbdd_force[k];
+        force[pair.search_petsc_idx * NDIM + k] -= nonbdd_force[k];
+    }
     return;
-} // registerForceFcnPtr
+} // evaluatePairForce
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -158,33 +158,8 @@ PenaltyIBMethod::forwardEulerStep(const double current_time, const double new_ti
 {
     IBMethod::forwardEulerStep(current_time, new_time);
 
-    const int coarsest_ln = 0;
-    const int finest_ln = d_hierarchy->getFinestLevelNumber();
-    const double dt = new_time - current_time;
-
     // Update the values of Y^{n+1} and V^{n+1} using forward Euler.
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
-        const double* const K = d_K_data[ln]->getLocalFormArray()->data();
-        const double* const M = d_M_data[ln]->getLocalFormArray()->data();
-        const double* const X = d_X_current_data[ln]->getLocalFormVecArray()->data();
-        const double* const Y = d_Y_current_data[ln]->getLocalFormVecArray()->data();
-        const double* const V = d_V_current_data[ln]->getLocalFormVecArray()->data();
-        double* const Y_new = d_Y_new_data[ln]->getLocalFormVecArray()->data();
-        double* const V_new = d_V_new_data[ln]->getLocalFormVecArray()->data();
-        const unsigned int n_local = d_X_current_data[ln]->getLocalNodeCount();
-        unsigned int i, d;
-        for (i = 0; i < n_local; ++i)
-        {
-            for (d = 0; d < NDIM; ++d)
-            {
-                Y_new[NDIM * i + d] = Y[NDIM * i + d] + dt * V[NDIM * i + d];
-                V_new[NDIM * i + d] = V[NDIM * i + d] + dt * (-K[i] * (Y[NDIM * i + d] - X[NDIM * i + d]) / M[i] +
-                                                              d_gravitational_acceleration[d]);
-            }
-        }
-    }
+    updateMassiveStructure(new_time - current_time, /*use_half_values*/ false);
     return;
 } // eulerStep
 
@@ -193,38 +168,8 @@ PenaltyIBMethod::midpointStep(const double current_time, const double new_time)
 {
     IBMethod::midpointStep(current_time, new_time);
 
-    const int coarsest_ln = 0;
-    const int finest_ln = d_hierarchy->getFinestLevelNumber();
-    const double dt = new_time - current_time;
-
     // Update the values of Y^{n+1} and V^{n+1} using the midpoint rule.
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
-        const double* const K = d_K_data[ln]->getLocalFormArray()->data();
-        const double* const M = d_M_data[ln]->getLocalFormArray()->data();
-        const double* const X = d_X_current_data[ln]->getLocalFormVecArray()->data();
-        const double* const Y = d_Y_current_data[ln]->getLocalFormVecArray()->data();
-        const double* const V = d_V_current_data[ln]->getLocalFormVecArray()->data();
-        const double* const X_new = d_X_new_data[ln]->getLocalFormVecArray()->data();
-        double* const Y_new = d_Y_new_data[ln]->getLocalFormVecArray()->data();
-        double* const V_new = d_V_new_data[ln]->getLocalFormVecArray()->data();
-        const unsigned int n_local = d_X_current_data[ln]->getLocalNodeCount();
-        unsigned int i, d;
-        double X_half, Y_half, V_half;
-        for (i = 0; i < n_local; ++i)
-        {
-            for (d = 0; d < NDIM; ++d)
-            {
-                X_half = 0.5 * (X[NDIM * i + d] + X_new[NDIM * i + d]);
-                Y_half = 0.5 * (Y[NDIM * i + d] + Y_new[NDIM * i + d]);
-                V_half = 0.5 * (V[NDIM * i + d] + V_new[NDIM * i + d]);
-                Y_new[NDIM * i + d] = Y[NDIM * i + d] + dt * V_half;
-                V_new[NDIM * i + d] =
-                    V[NDIM * i + d] + dt * (-K[i] * (Y_half - X_half) / M[i] + d_gravitational_acceleration[d]);
-            }
-        }
-    }
+    updateMassiveStructure(new_time - current_time, /*use_half_values*/ true);
     return;
 } // midpointStep
 
@@ -233,38 +178,8 @@ PenaltyIBMethod::trapezoidalStep(const double current_time, const double new_tim
 {
     IBMethod::trapezoidalStep(current_time, new_time);
 
-    const int coarsest_ln = 0;
-    const int finest_ln = d_hierarchy->getFinestLevelNumber();
-    const double dt = new_time - current_time;
-
     // Update the values of Y^{n+1} and V^{n+1} using the trapezoidal rule.
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
-        const double* const K = d_K_data[ln]->getLocalFormArray()->data();
-        const double* const M = d_M_data[ln]->getLocalFormArray()->data();
-        const double* const X = d_X_current_data[ln]->getLocalFormVecArray()->data();
-        const double* const Y = d_Y_current_data[ln]->getLocalFormVecArray()->data();
-        const double* const V = d_V_current_data[ln]->getLocalFormVecArray()->data();
-        const double* const X_new = d_X_new_data[ln]->getLocalFormVecArray()->data();
-        double* const Y_new = d_Y_new_data[ln]->getLocalFormVecArray()->data();
-        double* const V_new = d_V_new_data[ln]->getLocalFormVecArray()->data();
-        const unsigned int n_local = d_X_current_data[ln]->getLocalNodeCount();
-        unsigned int i, d;
-        double X_half, Y_half, V_half;
-        for (i = 0; i < n_local; ++i)
-        {
-            for (d = 0; d < NDIM; ++d)
-            {
-                X_half = 0.5 * (X[NDIM * i + d] + X_new[NDIM * i + d]);
-                Y_half = 0.5 * (Y[NDIM * i + d] + Y_new[NDIM * i + d]);
-                V_half = 0.5 * (V[NDIM * i + d] + V_new[NDIM * i + d]);
-                Y_new[NDIM * i + d] = Y[NDIM * i + d] + dt * V_half;
-                V_new[NDIM * i + d] =
-                    V[NDIM * i + d] + dt * (-K[i] * (Y_half - X_half) / M[i] + d_gravitational_acceleration[d]);
-            }
-        }
-    }
+    updateMassiveStructure(new_time - current_time, /*use_half_values*/ true);
     return;
 } // trapezoidalStep
 
@@ -287,8 +202,11 @@ PenaltyIBMethod::computeLagrangianForce(const double data_time)
             const double* const K = d_K_data[ln]->getLocalFormArray()->data();
             const double* const X = d_X_current_data[ln]->getLocalFormVecArray()->data();
             const double* const Y = d_Y_current_data[ln]->getLocalFormVecArray()->data();
-            const unsigned int n_local = d_X_current_data[ln]->getLocalNodeCount();
-            for (unsigned int i = 0; i < n_local; ++i)
+            const int n_local = static_cast<int>(d_X_current_data[ln]->getLocalNodeCount());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(max : max_displacement) if (d_use_threaded_structure_update)
+#endif
+            for (int i = 0; i < n_local; ++i)
             {
                 double dX = 0.0;
                 for (unsigned int d = 0; d < NDIM; ++d)
@@ -313,8 +231,11 @@ PenaltyIBMethod::computeLagrangianForce(const double data_time)
             const double* const Y = d_Y_current_data[ln]->getLocalFormVecArray()->data();
             const double* const X_new = d_X_new_data[ln]->getLocalFormVecArray()->data();
             const double* const Y_new = d_Y_new_data[ln]->getLocalFormVecArray()->data();
-            const unsigned int n_local = d_X_current_data[ln]->getLocalNodeCount();
-            for (unsigned int i = 0; i < n_local; ++i)
+            const int n_local = static_cast<int>(d_X_current_data[ln]->getLocalNodeCount());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(max : max_displacement) if (d_use_threaded_structure_update)
+#endif
+            for (int i = 0; i < n_local; ++i)
             {
                 double dX = 0.0;
                 for (unsigned int d = 0; d < NDIM; ++d)
@@ -339,8 +260,11 @@ PenaltyIBMethod::computeLagrangianForce(const double data_time)
             const double* const K = d_K_data[ln]->getLocalFormArray()->data();
             const double* const X = d_X_new_data[ln]->getLocalFormVecArray()->data();
             const double* const Y = d_Y_new_data[ln]->getLocalFormVecArray()->data();
-            const unsigned int n_local = d_X_current_data[ln]->getLocalNodeCount();
-            for (unsigned int i = 0; i < n_local; ++i)
+            const int n_local = static_cast<int>(d_X_current_data[ln]->getLocalNodeCount());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(max : max_displacement) if (d_use_threaded_structure_update)
+#endif
+            for (int i = 0; i < n_local; ++i)
             {
                 double dX = 0.0;
                 for (unsigned int d = 0; d < NDIM; ++d)
@@ -471,9 +395,54 @@ PenaltyIBMethod::putToDatabase(Pointer<Database> db)
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+PenaltyIBMethod::updateMassiveStructure(const double dt, const bool use_half_values)
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        const double* const K = d_K_data[ln]->getLocalFormArray()->data();
+        const double* const M = d_M_data[ln]->getLocalFormArray()->data();
+        const double* const X = d_X_current_data[ln]->getLocalFormVecArray()->data();
+        const double* const Y = d_Y_current_data[ln]->getLocalFormVecArray()->data();
+        const double* const V = d_V_current_data[ln]->getLocalFormVecArray()->data();
+        const double* const X_new = use_half_values ? d_X_new_data[ln]->getLocalFormVecArray()->data() : X;
+        double* const Y_new = d_Y_new_data[ln]->getLocalFormVecArray()->data();
+        double* const V_new = d_V_new_data[ln]->getLocalFormVecArray()->data();
+        const int n_local = static_cast<int>(d_X_current_data[ln]->getLocalNodeCount());
+
+        // Each node is updated independently.  For forward Euler, the
+        // right-hand side is evaluated at the current values; otherwise, it is
+        // evaluated at the averages of the current and new values.
+        const double w_new = use_half_values ? 0.5 : 0.0;
+        const double w_current = 1.0 - w_new;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (d_use_threaded_structure_update)
+#endif
+        for (int i = 0; i < n_local; ++i)
+        {
+            const double K_over_M = K[i] / M[i];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                const int k = NDIM * i + d;
+                const double X_rhs = w_current * X[k] + w_new * X_new[k];
+                const double Y_rhs = w_current * Y[k] + w_new * Y_new[k];
+                const double V_rhs = w_current * V[k] + w_new * V_new[k];
+                Y_new[k] = Y[k] + dt * V_rhs;
+                V_new[k] = V[k] + dt * (-K_over_M * (Y_rhs - X_rhs) + d_gravitational_acceleration[d]);
+            }
+        }
+    }
+    return;
+} // updateMassiveStructure
+
 void
 PenaltyIBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
 {
+    if (db->keyExists("use_threaded_structure_update"))
+        d_use_threaded_structure_update = db->getBool("use_threaded_structure_update");
     if (!is_from_restart)
     {
         if (db->keyExists("gravitational_acceleration"))
@@ -114,6 +114,9 @@ StaggeredStokesIBLevelRelaxationFACOperator::StaggeredStokesIBLevelRelaxationFAC
             d_level_solver_max_iterations = input_db->getInteger("level_solver_max_iterations");
         if (input_db->keyExists("SAJ_fill")) d_SAJ_fill = input_db->getDouble("SAJ_fill");
         if (input_db->keyExists("RStokesIBP_fill")) d_RStokesIBP_fill = input_db->getDouble("RStokesIBP_fill");
+        if (input_db->keyExists("SAJ_approximation")) d_SAJ_approximation = input_db->getString("SAJ_approximation");
+        if (input_db->keyExists("use_matrix_free_SAJ"))
+            d_use_matrix_free_SAJ = input_db->getBool("use_matrix_free_SAJ");
         if (input_db->isDatabase("level_solver_db"))
         {
             d_level_solver_db = input_db->getDatabase("level_solver_db");
@@ -127,6 +130,12 @@ StaggeredStokesIBLevelRelaxationFACOperator::StaggeredStokesIBLevelRelaxationFAC
         if (input_db->keyExists("p_petsc_prolongation_method"))
             d_p_petsc_prolongation_method = input_db->getString("p_petsc_prolongation_method");
     }
+    if (d_SAJ_approximation != "EXACT" && d_SAJ_approximation != "DIAGONAL")
+    {
+        TBOX_ERROR(d_object_name << "::StaggeredStokesIBLevelRelaxationFACOperator():\n"
+                                 << "  unsupported SAJ_approximation " << d_SAJ_approximation << "\n"
+                                 << "  valid choices are: EXACT, DIAGONAL" << std::endl);
+    }
 
     // Construct the DOF index variable/context.
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
@@ -270,6 +279,7 @@ StaggeredStokesIBLevelRelaxationFACOperator::computeResidual(SAMRAIVectorReal<ND
             IBTK_CHKERRQ(ierr);
             ierr = MatMultAdd(d_SAJ_mat[ln], solution_vec, residual_vec, residual_vec);
             IBTK_CHKERRQ(ierr);
+            if (ln == d_finest_ln && d_SAJ_shell_mat) addMatrixFreeSAJCorrection(solution_vec, residual_vec);
             ierr = VecScale(residual_vec, -1.0);
             IBTK_CHKERRQ(ierr);
 
@@ -321,6 +331,7 @@ StaggeredStokesIBLevelRelaxationFACOperator::computeResidual(SAMRAIVectorReal<ND
             IBTK_CHKERRQ(ierr);
             ierr = MatMult(A, solution_vec, residual_vec);
             IBTK_CHKERRQ(ierr);
+            if (ln == d_finest_ln && d_SAJ_shell_mat) addMatrixFreeSAJCorrection(solution_vec, residual_vec);
             ierr = VecAYPX(residual_vec, -1.0, rhs_vec);
             IBTK_CHKERRQ(ierr);
 
@@ -564,8 +575,32 @@ StaggeredStokesIBLevelRelaxationFACOperator::initializeOperatorStateSpecialized(
     {
         if (ln == d_finest_ln)
         {
-            ierr = MatPtAP(d_A_mat, d_J_mat, MAT_INITIAL_MATRIX, d_SAJ_fill, &d_SAJ_mat[ln]);
-            IBTK_CHKERRQ(ierr);
+            if (d_SAJ_approximation == "DIAGONAL")
+            {
+                // Approximate A by its diagonal D so that S*D*J has the
+                // sparsity pattern of S*J.
+                Vec A_diag;
+                ierr = MatCreateVecs(d_A_mat, nullptr, &A_diag);
+                IBTK_CHKERRQ(ierr);
+                ierr = MatGetDiagonal(d_A_mat, A_diag);
+                IBTK_CHKERRQ(ierr);
+                Mat DJ_mat;
+                ierr = MatDuplicate(d_J_mat, MAT_COPY_VALUES, &DJ_mat);
+                IBTK_CHKERRQ(ierr);
+                ierr = MatDiagonalScale(DJ_mat, A_diag, nullptr);
+                IBTK_CHKERRQ(ierr);
+                ierr = MatTransposeMatMult(d_J_mat, DJ_mat, MAT_INITIAL_MATRIX, d_SAJ_fill, &d_SAJ_mat[ln]);
+                IBTK_CHKERRQ(ierr);
+                ierr = MatDestroy(&DJ_mat);
+                IBTK_CHKERRQ(ierr);
+                ierr = VecDestroy(&A_diag);
+                IBTK_CHKERRQ(ierr);
+            }
+            else
+            {
+                ierr = MatPtAP(d_A_mat, d_J_mat, MAT_INITIAL_MATRIX, d_SAJ_fill, &d_SAJ_mat[ln]);
+                IBTK_CHKERRQ(ierr);
+            }
 
             // Compute the scale for the spreading operator.
             Pointer<PatchLevel<NDIM> > finest_level = d_hierarchy->getPatchLevel(d_finest_ln);
@@ -576,6 +611,22 @@ StaggeredStokesIBLevelRelaxationFACOperator::initializeOperatorStateSpecialized(
             for (unsigned d = 0; d < NDIM; ++d) spread_scale *= ratio(d) / dx0[d];
             ierr = MatScale(d_SAJ_mat[ln], spread_scale);
             IBTK_CHKERRQ(ierr);
+
+            if (d_use_matrix_free_SAJ)
+            {
+                d_SAJ_spread_scale = spread_scale;
+                ierr = MatCreateVecs(d_A_mat, &d_SAJ_lag_work_vec, &d_SAJ_lag_force_vec);
+                IBTK_CHKERRQ(ierr);
+                PetscInt m_local, n_local;
+                ierr = MatGetLocalSize(d_SAJ_mat[ln], &m_local, &n_local);
+                IBTK_CHKERRQ(ierr);
+                ierr = MatCreateShell(
+                    PETSC_COMM_WORLD, m_local, n_local, PETSC_DETERMINE, PETSC_DETERMINE, this, &d_SAJ_shell_mat);
+                IBTK_CHKERRQ(ierr);
+                ierr = MatShellSetOperation(
+                    d_SAJ_shell_mat, MATOP_MULT, reinterpret_cast<void (*)(void)>(applyMatrixFreeSAJ));
+                IBTK_CHKERRQ(ierr);
+            }
         }
         else
         {
@@ -802,6 +853,16 @@ StaggeredStokesIBLevelRelaxationFACOperator::deallocateOperatorStateSpecialized(
         IBTK_CHKERRQ(ierr);
         d_SAJ_mat[ln] = nullptr;
 
+        if (ln == d_finest_ln)
+        {
+            ierr = MatDestroy(&d_SAJ_shell_mat);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecDestroy(&d_SAJ_lag_work_vec);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecDestroy(&d_SAJ_lag_force_vec);
+            IBTK_CHKERRQ(ierr);
+        }
+
         ierr = MatDestroy(&d_galerkin_stokesib_mat[ln]);
         IBTK_CHKERRQ(ierr);
         d_galerkin_stokesib_mat[ln] = nullptr;
@@ -819,6 +880,42 @@ StaggeredStokesIBLevelRelaxationFACOperator::deallocateOperatorStateSpecialized(
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+PetscErrorCode
+StaggeredStokesIBLevelRelaxationFACOperator::applyMatrixFreeSAJ(Mat SAJ, Vec x, Vec y)
+{
+    PetscErrorCode ierr;
+    void* ctx;
+    ierr = MatShellGetContext(SAJ, &ctx);
+    CHKERRQ(ierr);
+    auto fac_op = static_cast<StaggeredStokesIBLevelRelaxationFACOperator*>(ctx);
+    ierr = MatMult(fac_op->d_J_mat, x, fac_op->d_SAJ_lag_work_vec);
+    CHKERRQ(ierr);
+    ierr = MatMult(fac_op->d_A_mat, fac_op->d_SAJ_lag_work_vec, fac_op->d_SAJ_lag_force_vec);
+    CHKERRQ(ierr);
+    ierr = MatMultTranspose(fac_op->d_J_mat, fac_op->d_SAJ_lag_force_vec, y);
+    CHKERRQ(ierr);
+    ierr = VecScale(y, fac_op->d_SAJ_spread_scale);
+    CHKERRQ(ierr);
+    PetscFunctionReturn(0);
+} // applyMatrixFreeSAJ
+
+void
+StaggeredStokesIBLevelRelaxationFACOperator::addMatrixFreeSAJCorrection(Vec x, Vec y)
+{
+    Vec SAJ_x;
+    int ierr = VecDuplicate(y, &SAJ_x);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatMult(d_SAJ_mat[d_finest_ln], x, SAJ_x);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecAXPY(y, -1.0, SAJ_x);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatMultAdd(d_SAJ_shell_mat, x, y, y);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&SAJ_x);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // addMatrixFreeSAJCorrection
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
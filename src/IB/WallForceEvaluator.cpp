@@ -38,6 +38,7 @@
 
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "ibamr/app_namespaces.h" // IWYU pragma: keep
 
@@ -124,9 +125,23 @@ WallForceEvaluator::addWall(Pointer<Database> wall_db, double wall_ghost_dist)
 
     // add wall to vector of present walls
     d_walls_vec.push_back(new_wall);
+
+    // the cached node lists no longer cover all walls
+    d_wall_node_idxs_valid.assign(d_wall_node_idxs_valid.size(), false);
     return;
 } // addWall
 
+void
+WallForceEvaluator::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                        const int level_number,
+                                        const double /*init_data_time*/,
+                                        const bool /*initial_time*/,
+                                        LDataManager* const l_data_manager)
+{
+    buildWallNodeLists(hierarchy, level_number, l_data_manager);
+    return;
+} // initializeLevelData
+
 void
 WallForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
                                            Pointer<LData> X_data,
@@ -136,6 +151,13 @@ WallForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
                                            const double eval_time,
                                            LDataManager* const l_data_manager)
 {
+    // the node lists are normally built in initializeLevelData(), but build
+    // them here if this object was not registered for re-initialization.
+    if (level_number >= static_cast<int>(d_wall_node_idxs_valid.size()) || !d_wall_node_idxs_valid[level_number])
+    {
+        buildWallNodeLists(hierarchy, level_number, l_data_manager);
+    }
+
     PetscScalar* force;
     VecGetArray(F_data->getVec(), &force);
 
@@ -143,25 +165,58 @@ WallForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
     PetscScalar* lposition;
     VecGetArray(X_data->getVec(), &lposition);
 
-    const int lag_node_idx_current_idx = l_data_manager->getLNodePatchDescriptorIndex();
-
-    for (auto& wall : d_walls_vec)
+    const std::vector<std::vector<int> >& wall_node_idxs = d_wall_node_idxs[level_number];
+    for (unsigned int k = 0; k < d_walls_vec.size(); ++k)
     { // iterate through walls
+        Wall& wall = d_walls_vec[k];
+
+        // get axis (which direction the wall is normal to) and location
+        const int axis = wall.getAxis();
+        const double location = wall.getLocation();
+
+        // add forces to the nodes near the wall
+        for (const int particle_petsc_idx : wall_node_idxs[k])
+        {
+            const double wall_distance = lposition[particle_petsc_idx * NDIM + axis] - location;
+            force[particle_petsc_idx * NDIM + axis] += wall.applyForce(wall_distance, eval_time);
+        } // iterate through nodes
+    }     // iterate through walls
+    VecRestoreArray(X_data->getVec(), &lposition);
+    VecRestoreArray(F_data->getVec(), &force);
+    return;
+} // computeLagrangianForce
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
 
-        // get axis (which direction the wall is normal to)
-        int axis = wall.getAxis();
+void
+WallForceEvaluator::buildWallNodeLists(const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                       const int level_number,
+                                       LDataManager* const l_data_manager)
+{
+    if (level_number >= static_cast<int>(d_wall_node_idxs.size()))
+    {
+        d_wall_node_idxs.resize(level_number + 1);
+        d_wall_node_idxs_valid.resize(level_number + 1, false);
+    }
+    std::vector<std::vector<int> >& wall_node_idxs = d_wall_node_idxs[level_number];
+    wall_node_idxs.resize(d_walls_vec.size());
 
-        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
-        const IntVector<NDIM>& ratio = level->getRatio();
+    const int lag_node_idx_current_idx = l_data_manager->getLNodePatchDescriptorIndex();
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+    const IntVector<NDIM>& ratio = level->getRatio();
+    for (unsigned int k = 0; k < d_walls_vec.size(); ++k)
+    { // iterate through walls
+        std::vector<int>& node_idxs = wall_node_idxs[k];
+        node_idxs.clear();
+        const Box<NDIM> force_area = Box<NDIM>::refine(d_walls_vec[k].getForceArea(), ratio);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         { // iterate through patches
-
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<LNodeSetData> current_idx_data = patch->getPatchData(lag_node_idx_current_idx);
             const Box<NDIM>& patch_box = patch->getBox();
 
             // get just the area near the wall
-            const Box<NDIM> intersect_box = patch_box * Box<NDIM>::refine(wall.getForceArea(), ratio);
+            const Box<NDIM> intersect_box = patch_box * force_area;
 
             // iterate through cells in relevant area
             for (LNodeSetData::CellIterator scit(intersect_box); scit; scit++)
@@ -169,26 +224,17 @@ WallForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
                 // get current nodes in the cell.
                 const hier::Index<NDIM>& search_cell_idx = *scit;
                 LNodeSet* search_node_set = current_idx_data->getItem(search_cell_idx);
-
-                // if particles exist in this cell, add forces to them
-                if (search_node_set)
+                if (!search_node_set) continue;
+                for (const auto& particle_node_idx : *search_node_set)
                 {
-                    for (const auto& particle_node_idx : *search_node_set)
-                    {
-                        // get node data
-                        const int particle_petsc_idx = particle_node_idx->getLocalPETScIndex();
-
-                        // get wall distance
-                        double wall_distance = lposition[particle_petsc_idx * NDIM + axis] - wall.getLocation();
-                        force[particle_petsc_idx * NDIM + axis] += wall.applyForce(wall_distance, eval_time);
-                    } // iterate through nodes
-                }     // if search_node_set
-            }         // iterate through cells in wall area
-        }             // iterate through patches
-    }                 // iterate through walls
-    VecRestoreArray(F_data->getVec(), &force);
+                    node_idxs.push_back(particle_node_idx->getLocalPETScIndex());
+                }
+            } // iterate through cells in wall area
+        }     // iterate through patches
+    }         // iterate through walls
+    d_wall_node_idxs_valid[level_number] = true;
     return;
-} // computeLagrangianForce
+} // buildWallNodeLists
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -14,6 +14,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include "ibamr/AdvDiffHierarchyIntegrator.h"
+#include "ibamr/AdvDiffReactionIntegrator.h"
 #include "ibamr/ibamr_enums.h"
 #include "ibamr/ibamr_utilities.h"
 
@@ -24,7 +25,7 @@
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/HierarchyMathOps.h"
-#include "ibtk/IBTK_MPI.h"
+#include "ibtk/KrylovLinearSolver.h"
 #include "ibtk/LaplaceOperator.h"
 #include "ibtk/PoissonSolver.h"
 
@@ -49,6 +50,7 @@
 #include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "PoissonSpecifications.h"
 #include "SAMRAIVectorReal.h"
 #include "SideDataFactory.h"
 #include "SideVariable.h"
@@ -64,6 +66,7 @@
 #include "tbox/Utilities.h"
 
 #include <algorithm>
+#include <cmath>
 #include <iterator>
 #include <limits>
 #include <map>
@@ -208,6 +211,7 @@ AdvDiffHierarchyIntegrator::registerAdvectionVelocity(Pointer<FaceVariable<NDIM,
 
     // Set default values.
     d_u_is_div_free[u_var] = true;
+    d_u_is_managed_externally[u_var] = false;
     d_u_fcn[u_var] = nullptr;
     return;
 } // registerAdvectionVelocity
@@ -232,12 +236,35 @@ AdvDiffHierarchyIntegrator::getAdvectionVelocityIsDivergenceFree(Pointer<FaceVar
     return d_u_is_div_free.find(u_var)->second;
 } // getAdvectionVelocityIsDivergenceFree
 
+void
+AdvDiffHierarchyIntegrator::setAdvectionVelocityIsManagedExternally(Pointer<FaceVariable<NDIM, double> > u_var,
+                                                                    const bool is_managed_externally)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(std::find(d_u_var.begin(), d_u_var.end(), u_var) != d_u_var.end());
+#endif
+    d_u_is_managed_externally[u_var] = is_managed_externally;
+    return;
+} // setAdvectionVelocityIsManagedExternally
+
+bool
+AdvDiffHierarchyIntegrator::getAdvectionVelocityIsManagedExternally(Pointer<FaceVariable<NDIM, double> > u_var) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(std::find(d_u_var.begin(), d_u_var.end(), u_var) != d_u_var.end());
+#endif
+    return d_u_is_managed_externally.find(u_var)->second;
+} // getAdvectionVelocityIsManagedExternally
+
 void
 AdvDiffHierarchyIntegrator::setAdvectionVelocityFunction(Pointer<FaceVariable<NDIM, double> > u_var,
                                                          Pointer<IBTK::CartGridFunction> u_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(std::find(d_u_var.begin(), d_u_var.end(), u_var) != d_u_var.end());
+#endif
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!(u_fcn && d_u_is_managed_externally[u_var]));
 #endif
     d_u_fcn[u_var] = u_fcn;
     return;
@@ -632,6 +659,27 @@ AdvDiffHierarchyIntegrator::getPhysicalBcCoefs(Pointer<CellVariable<NDIM, double
     return d_Q_bc_coef.find(Q_var)->second;
 } // getPhysicalBcCoefs
 
+void
+AdvDiffHierarchyIntegrator::setReactionIntegrator(Pointer<CellVariable<NDIM, double> > Q_var,
+                                                  Pointer<AdvDiffReactionIntegrator> reaction_integrator)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(std::find(d_Q_var.begin(), d_Q_var.end(), Q_var) != d_Q_var.end());
+#endif
+    d_Q_reaction_integrator[Q_var] = reaction_integrator;
+    return;
+} // setReactionIntegrator
+
+Pointer<AdvDiffReactionIntegrator>
+AdvDiffHierarchyIntegrator::getReactionIntegrator(Pointer<CellVariable<NDIM, double> > Q_var) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(std::find(d_Q_var.begin(), d_Q_var.end(), Q_var) != d_Q_var.end());
+#endif
+    const auto it = d_Q_reaction_integrator.find(Q_var);
+    return it != d_Q_reaction_integrator.end() ? it->second : Pointer<AdvDiffReactionIntegrator>(nullptr);
+} // getReactionIntegrator
+
 void
 AdvDiffHierarchyIntegrator::setHelmholtzSolver(Pointer<CellVariable<NDIM, double> > Q_var,
                                                Pointer<PoissonSolver> helmholtz_solver)
@@ -647,6 +695,7 @@ AdvDiffHierarchyIntegrator::setHelmholtzSolver(Pointer<CellVariable<NDIM, double
 #endif
     d_helmholtz_solvers[l] = helmholtz_solver;
     d_helmholtz_solvers_need_init[l] = true;
+    resetHelmholtzSolverInitCoefs(l);
     return;
 } // setHelmholtzSolver
 
@@ -672,6 +721,7 @@ AdvDiffHierarchyIntegrator::getHelmholtzSolver(Pointer<CellVariable<NDIM, double
                                                                  d_helmholtz_precond_db,
                                                                  "adv_diff_pc_" + std::to_string(l) + "_");
         d_helmholtz_solvers_need_init[l] = true;
+        resetHelmholtzSolverInitCoefs(l);
     }
     return d_helmholtz_solvers[l];
 } // getHelmholtzSolver
@@ -694,6 +744,7 @@ AdvDiffHierarchyIntegrator::setHelmholtzSolverNeedsInit(Pointer<CellVariable<NDI
 #endif
     const size_t l = distance(d_Q_var.begin(), std::find(d_Q_var.begin(), d_Q_var.end(), Q_var));
     d_helmholtz_solvers_need_init[l] = true;
+    resetHelmholtzSolverInitCoefs(l);
     return;
 }
 
@@ -806,9 +857,35 @@ AdvDiffHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHierarchy
     }
     d_helmholtz_solvers.resize(d_Q_var.size());
     d_helmholtz_solvers_need_init.resize(d_Q_var.size());
+    std::vector<bool> allocate_helmholtz_solver(d_Q_var.size());
+    for (unsigned int l = 0; l < d_Q_var.size(); ++l)
+    {
+        allocate_helmholtz_solver[l] = !d_helmholtz_solvers[l];
+    }
     for (const auto& Q_var : d_Q_var)
     {
         const size_t l = distance(d_Q_var.begin(), std::find(d_Q_var.begin(), d_Q_var.end(), Q_var));
+        if (d_share_helmholtz_solvers && allocate_helmholtz_solver[l])
+        {
+            // Use the solver of a previously registered quantity that
+            // requires a solver with the same configuration, if any.
+            for (unsigned int k = 0; k < l; ++k)
+            {
+                if (allocate_helmholtz_solver[k] && canShareHelmholtzSolver(d_Q_var[k], Q_var))
+                {
+                    d_helmholtz_solvers[l] = d_helmholtz_solvers[k];
+                    d_helmholtz_solvers_need_init[l] = true;
+                    resetHelmholtzSolverInitCoefs(l);
+                    if (d_enable_logging)
+                    {
+                        plog << d_object_name << ": "
+                             << "sharing Helmholtz solver of variable number " << k << " with variable number " << l
+                             << "\n";
+                    }
+                    break;
+                }
+            }
+        }
         d_helmholtz_solvers[l] = getHelmholtzSolver(Q_var);
     }
     d_helmholtz_rhs_ops.resize(d_Q_var.size());
@@ -860,9 +937,42 @@ AdvDiffHierarchyIntegrator::preprocessIntegrateHierarchy(double current_time, do
                                      d_Q_reset_fcns_ctx[Q_var][k]);
         }
     }
+
+    // Integrate the reaction terms over the first half of the time step.
+    const double dt = new_time - current_time;
+    for (const auto& Q_reaction_integrator : d_Q_reaction_integrator)
+    {
+        if (!Q_reaction_integrator.second) continue;
+        const int Q_current_idx =
+            var_db->mapVariableAndContextToIndex(Q_reaction_integrator.first, getCurrentContext());
+        Q_reaction_integrator.second->integrate(Q_current_idx, d_hierarchy, 0.5 * dt);
+    }
     return;
 } // preprocessIntegrateHierarchy
 
+void
+AdvDiffHierarchyIntegrator::postprocessIntegrateHierarchy(const double current_time,
+                                                          const double new_time,
+                                                          const bool skip_synchronize_new_state_data,
+                                                          const int num_cycles)
+{
+    // Integrate the reaction terms over the second half of the time step.
+    // This is done before the new state data are synchronized so that the
+    // coarse grid values are consistent with the fine grid values.
+    const double dt = new_time - current_time;
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    for (const auto& Q_reaction_integrator : d_Q_reaction_integrator)
+    {
+        if (!Q_reaction_integrator.second) continue;
+        const int Q_new_idx = var_db->mapVariableAndContextToIndex(Q_reaction_integrator.first, getNewContext());
+        Q_reaction_integrator.second->integrate(Q_new_idx, d_hierarchy, 0.5 * dt);
+    }
+
+    HierarchyIntegrator::postprocessIntegrateHierarchy(
+        current_time, new_time, skip_synchronize_new_state_data, num_cycles);
+    return;
+} // postprocessIntegrateHierarchy
+
 void
 AdvDiffHierarchyIntegrator::registerResetFunction(Pointer<CellVariable<NDIM, double> > Q_var,
                                                   ResetPropertiesFcnPtr callback,
@@ -978,7 +1088,7 @@ AdvDiffHierarchyIntegrator::getMaximumTimeStepSizeSpecialized()
             }
         }
     }
-    return IBTK_MPI::minReduction(dt);
+    return minReduceTimeStepSize(dt);
 } // getMaximumTimeStepSizeSpecialized
 
 void
@@ -1090,11 +1200,93 @@ AdvDiffHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
     // Indicate that all linear solvers must be re-initialized.
     std::fill(d_helmholtz_solvers_need_init.begin(), d_helmholtz_solvers_need_init.end(), true);
     std::fill(d_helmholtz_rhs_ops_need_init.begin(), d_helmholtz_rhs_ops_need_init.end(), true);
+    for (unsigned int l = 0; l < d_Q_var.size(); ++l) resetHelmholtzSolverInitCoefs(l);
     d_coarsest_reset_ln = coarsest_level;
     d_finest_reset_ln = finest_level;
     return;
 } // resetHierarchyConfigurationSpecialized
 
+void
+AdvDiffHierarchyIntegrator::initializeHelmholtzSolver(const unsigned int l, const PoissonSpecifications& solver_spec)
+{
+    if (!d_helmholtz_solvers_need_init[l]) return;
+    Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
+
+    // Determine whether the current setup of the solver can be retained. This
+    // is only possible if the solver was last initialized (for the current
+    // hierarchy configuration) for the same constant D coefficient, and
+    // either the same constant C coefficient or, for Krylov solvers, a
+    // sufficiently similar one. Krylov methods always use the updated
+    // operator, so the old setup only affects the preconditioner.
+    static const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double C = solver_spec.cIsZero() ? 0.0 : (solver_spec.cIsConstant() ? solver_spec.getCConstant() : nan);
+    const double D = solver_spec.dIsConstant() ? solver_spec.getDConstant() : nan;
+    double C_init = d_helmholtz_solvers_init_C[l], D_init = d_helmholtz_solvers_init_D[l];
+    bool reuse_setup = !std::isnan(C) && !std::isnan(D) && !std::isnan(C_init) && D == D_init;
+    for (unsigned int k = 0; k < d_Q_var.size(); ++k)
+    {
+        if (d_helmholtz_solvers[k].getPointer() != helmholtz_solver.getPointer()) continue;
+        reuse_setup = reuse_setup && !std::isnan(d_helmholtz_solvers_init_C[k]);
+    }
+    if (reuse_setup && C != C_init)
+    {
+        Pointer<KrylovLinearSolver> krylov_solver = helmholtz_solver;
+        reuse_setup = krylov_solver && std::abs(C - C_init) <= d_helmholtz_solver_reinit_rel_tol * std::abs(C_init);
+    }
+
+    if (reuse_setup)
+    {
+        if (d_enable_logging)
+        {
+            plog << d_object_name << ": "
+                 << "Reusing Helmholtz solver setup for variable number " << l << "\n";
+        }
+    }
+    else
+    {
+        if (d_enable_logging)
+        {
+            plog << d_object_name << ": "
+                 << "Initializing Helmholtz solvers for variable number " << l << "\n";
+        }
+        helmholtz_solver->initializeSolverState(*d_sol_vecs[l], *d_rhs_vecs[l]);
+        C_init = C;
+        D_init = D;
+    }
+
+    // The solver is now ready for all of the quantities that share it.
+    for (unsigned int k = 0; k < d_Q_var.size(); ++k)
+    {
+        if (d_helmholtz_solvers[k].getPointer() != helmholtz_solver.getPointer()) continue;
+        d_helmholtz_solvers_need_init[k] = false;
+        d_helmholtz_solvers_init_C[k] = C_init;
+        d_helmholtz_solvers_init_D[k] = D_init;
+    }
+    return;
+} // initializeHelmholtzSolver
+
+bool
+AdvDiffHierarchyIntegrator::canShareHelmholtzSolver(Pointer<CellVariable<NDIM, double> > Q1_var,
+                                                    Pointer<CellVariable<NDIM, double> > Q2_var) const
+{
+    Pointer<CellDataFactory<NDIM, double> > Q1_factory = Q1_var->getPatchDataFactory();
+    Pointer<CellDataFactory<NDIM, double> > Q2_factory = Q2_var->getPatchDataFactory();
+    if (Q1_factory->getDefaultDepth() != Q2_factory->getDefaultDepth()) return false;
+    if (d_Q_diffusion_time_stepping_type.find(Q1_var)->second !=
+        d_Q_diffusion_time_stepping_type.find(Q2_var)->second)
+        return false;
+    if (d_Q_damping_coef.find(Q1_var)->second != d_Q_damping_coef.find(Q2_var)->second) return false;
+    if (d_Q_bc_coef.find(Q1_var)->second != d_Q_bc_coef.find(Q2_var)->second) return false;
+    const bool Q1_has_D_var = isDiffusionCoefficientVariable(Q1_var);
+    const bool Q2_has_D_var = isDiffusionCoefficientVariable(Q2_var);
+    if (Q1_has_D_var != Q2_has_D_var) return false;
+    if (Q1_has_D_var)
+    {
+        return d_Q_diffusion_coef_variable.find(Q1_var)->second == d_Q_diffusion_coef_variable.find(Q2_var)->second;
+    }
+    return d_Q_diffusion_coef.find(Q1_var)->second == d_Q_diffusion_coef.find(Q2_var)->second;
+} // canShareHelmholtzSolver
+
 void
 AdvDiffHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Database> db)
 {
@@ -1142,7 +1334,21 @@ AdvDiffHierarchyIntegrator::registerVariables()
         const int Q_depth = Q_factory->getDefaultDepth();
         const bool Q_data_output = d_Q_output[Q_var];
         if (d_visit_writer && Q_data_output)
-            d_visit_writer->registerPlotQuantity(Q_var->getName(), Q_depth == 1 ? "SCALAR" : "VECTOR", Q_current_idx);
+        {
+            if (Q_depth == 1 || Q_depth == NDIM)
+            {
+                d_visit_writer->registerPlotQuantity(
+                    Q_var->getName(), Q_depth == 1 ? "SCALAR" : "VECTOR", Q_current_idx);
+            }
+            else
+            {
+                for (int d = 0; d < Q_depth; ++d)
+                {
+                    d_visit_writer->registerPlotQuantity(
+                        Q_var->getName() + "_" + std::to_string(d), "SCALAR", Q_current_idx, d);
+                }
+            }
+        }
     }
     for (const auto& F_var : d_F_var)
     {
@@ -1159,7 +1365,21 @@ AdvDiffHierarchyIntegrator::registerVariables()
         const int F_depth = F_factory->getDefaultDepth();
         const bool F_data_output = d_F_output[F_var];
         if (d_visit_writer && F_data_output)
-            d_visit_writer->registerPlotQuantity(F_var->getName(), F_depth == 1 ? "SCALAR" : "VECTOR", F_current_idx);
+        {
+            if (F_depth == 1 || F_depth == NDIM)
+            {
+                d_visit_writer->registerPlotQuantity(
+                    F_var->getName(), F_depth == 1 ? "SCALAR" : "VECTOR", F_current_idx);
+            }
+            else
+            {
+                for (int d = 0; d < F_depth; ++d)
+                {
+                    d_visit_writer->registerPlotQuantity(
+                        F_var->getName() + "_" + std::to_string(d), "SCALAR", F_current_idx, d);
+                }
+            }
+        }
     }
     for (const auto& D_var : d_diffusion_coef_var)
     {
@@ -1188,6 +1408,17 @@ AdvDiffHierarchyIntegrator::registerVariables()
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+AdvDiffHierarchyIntegrator::resetHelmholtzSolverInitCoefs(const unsigned int l)
+{
+    static const double nan = std::numeric_limits<double>::quiet_NaN();
+    d_helmholtz_solvers_init_C.resize(d_Q_var.size(), nan);
+    d_helmholtz_solvers_init_D.resize(d_Q_var.size(), nan);
+    d_helmholtz_solvers_init_C[l] = nan;
+    d_helmholtz_solvers_init_D[l] = nan;
+    return;
+} // resetHelmholtzSolverInitCoefs
+
 void
 AdvDiffHierarchyIntegrator::getFromInput(Pointer<Database> db, bool is_from_restart)
 {
@@ -1271,6 +1502,10 @@ AdvDiffHierarchyIntegrator::getFromInput(Pointer<Database> db, bool is_from_rest
             d_helmholtz_sub_precond_db = db->getDatabase("helmholtz_sub_precond_db");
     }
     if (!d_helmholtz_sub_precond_db) d_helmholtz_sub_precond_db = new MemoryDatabase("helmholtz_sub_precond_db");
+
+    if (db->keyExists("share_helmholtz_solvers")) d_share_helmholtz_solvers = db->getBool("share_helmholtz_solvers");
+    if (db->keyExists("helmholtz_solver_reinit_rel_tol"))
+        d_helmholtz_solver_reinit_rel_tol = db->getDouble("helmholtz_solver_reinit_rel_tol");
     return;
 } // getFromInput
 
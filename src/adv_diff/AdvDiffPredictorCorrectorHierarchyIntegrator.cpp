@@ -565,16 +565,7 @@ AdvDiffPredictorCorrectorHierarchyIntegrator::integrateHierarchy(const double cu
         helmholtz_solver->setHomogeneousBc(false);
         helmholtz_solver->setSolutionTime(new_time);
         helmholtz_solver->setTimeInterval(current_time, new_time);
-        if (d_helmholtz_solvers_need_init[l])
-        {
-            if (d_enable_logging)
-            {
-                plog << d_object_name << ": "
-                     << "Initializing Helmholtz solvers for variable number " << l << "\n";
-            }
-            helmholtz_solver->initializeSolverState(*d_sol_vecs[l], *d_rhs_vecs[l]);
-            d_helmholtz_solvers_need_init[l] = false;
-        }
+        initializeHelmholtzSolver(l, solver_spec);
 
         // Solve for Q(n+1).
         helmholtz_solver->solveSystem(*d_sol_vecs[l], *d_rhs_vecs[l]);
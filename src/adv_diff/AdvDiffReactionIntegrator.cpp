@@ -0,0 +1,291 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibamr/AdvDiffReactionIntegrator.h"
+#include "ibamr/AdvDiffReactionStrategy.h"
+
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/ibtk_utilities.h"
+
+#include "Box.h"
+#include "CellData.h"
+#include "Index.h"
+#include "Patch.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ibamr/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBAMR
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Parameter of the ROS2 method.
+static const double GAMMA = 1.0 + 1.0 / std::sqrt(2.0);
+
+// Parameters of the substep size controller.
+static const double SAFETY_FACTOR = 0.9;
+static const double MIN_FACTOR = 0.2;
+static const double MAX_FACTOR = 5.0;
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+AdvDiffReactionIntegrator::AdvDiffReactionIntegrator(std::string object_name,
+                                                     Pointer<Database> input_db,
+                                                     Pointer<AdvDiffReactionStrategy> reaction_strategy)
+    : d_object_name(std::move(object_name)), d_reaction_strategy(reaction_strategy)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_reaction_strategy);
+#endif
+    if (input_db)
+    {
+        if (input_db->keyExists("rel_tol")) d_rel_tol = input_db->getDouble("rel_tol");
+        if (input_db->keyExists("abs_tol")) d_abs_tol = input_db->getDouble("abs_tol");
+        if (input_db->keyExists("max_num_substeps")) d_max_num_substeps = input_db->getInteger("max_num_substeps");
+        if (input_db->keyExists("cells_per_batch")) d_cells_per_batch = input_db->getInteger("cells_per_batch");
+        if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+    }
+    if (!(d_rel_tol > 0.0) || d_abs_tol < 0.0)
+    {
+        TBOX_ERROR(d_object_name << "::AdvDiffReactionIntegrator():\n"
+                                 << "  rel_tol must be positive and abs_tol must be nonnegative\n");
+    }
+    if (d_max_num_substeps < 1 || d_cells_per_batch < 1)
+    {
+        TBOX_ERROR(d_object_name << "::AdvDiffReactionIntegrator():\n"
+                                 << "  max_num_substeps and cells_per_batch must be positive\n");
+    }
+    return;
+} // AdvDiffReactionIntegrator
+
+void
+AdvDiffReactionIntegrator::integrate(const int Q_idx, Pointer<PatchHierarchy<NDIM> > hierarchy, const double dt)
+{
+    unsigned int num_accepted_substeps = 0, num_rejected_substeps = 0;
+    if (dt > 0.0)
+    {
+        for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            // Collect the patch data before entering the threaded region since
+            // the reference counting of SAMRAI's smart pointers is not
+            // thread-safe.
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            std::vector<CellData<NDIM, double>*> Q_data;
+            std::vector<Box<NDIM> > patch_boxes;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > data = patch->getPatchData(Q_idx);
+#if !defined(NDEBUG)
+                TBOX_ASSERT(data);
+#endif
+                Q_data.push_back(data.getPointer());
+                patch_boxes.push_back(patch->getBox());
+            }
+            const int num_patches = static_cast<int>(Q_data.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) reduction(+ : num_accepted_substeps, num_rejected_substeps)
+#endif
+            for (int k = 0; k < num_patches; ++k)
+            {
+                integrateBox(*Q_data[k], patch_boxes[k], dt, num_accepted_substeps, num_rejected_substeps);
+            }
+        }
+    }
+    d_num_accepted_substeps = num_accepted_substeps;
+    d_num_rejected_substeps = num_rejected_substeps;
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::integrate(): accepted substeps = "
+             << IBTK_MPI::sumReduction(d_num_accepted_substeps)
+             << ", rejected substeps = " << IBTK_MPI::sumReduction(d_num_rejected_substeps) << "\n";
+    }
+    return;
+} // integrate
+
+unsigned int
+AdvDiffReactionIntegrator::getNumberOfAcceptedSubsteps() const
+{
+    return d_num_accepted_substeps;
+} // getNumberOfAcceptedSubsteps
+
+unsigned int
+AdvDiffReactionIntegrator::getNumberOfRejectedSubsteps() const
+{
+    return d_num_rejected_substeps;
+} // getNumberOfRejectedSubsteps
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+AdvDiffReactionIntegrator::integrateBox(CellData<NDIM, double>& Q_data,
+                                        const Box<NDIM>& box,
+                                        const double dt,
+                                        unsigned int& num_accepted_substeps,
+                                        unsigned int& num_rejected_substeps) const
+{
+    const int n = Q_data.getDepth();
+    std::vector<double*> Q(n);
+    for (int s = 0; s < n; ++s) Q[s] = Q_data.getPointer(s);
+
+    // Offsets of the cells of the box in the patch data arrays.
+    const Box<NDIM>& ghost_box = Q_data.getGhostBox();
+    std::vector<std::ptrdiff_t> offsets;
+    offsets.reserve(box.size());
+    for (Box<NDIM>::Iterator b(box); b; b++) offsets.push_back(IBTK::array_offset(ghost_box, b()));
+    const int num_cells = static_cast<int>(offsets.size());
+    if (num_cells == 0) return;
+
+    // Work arrays. Values with the suffix _a are only stored for the cells of
+    // the current batch that have not yet reached the end of the time
+    // interval, which are packed at the beginning of each array.
+    const int batch_size = std::min(d_cells_per_batch, num_cells);
+    std::vector<double> y(n * batch_size), t(batch_size), h(batch_size);
+    std::vector<int> num_steps(batch_size), active(batch_size);
+    std::vector<double> y_a(n * batch_size), f_a(n * batch_size), J_a(n * n * batch_size), k1_a(n * batch_size),
+        y_stage_a(n * batch_size), f_stage_a(n * batch_size), h_a(batch_size);
+    std::vector<Eigen::PartialPivLU<Eigen::MatrixXd> > lu(batch_size);
+    Eigen::MatrixXd W(n, n);
+    Eigen::VectorXd rhs(n), k(n);
+
+    for (int first = 0; first < num_cells; first += batch_size)
+    {
+        const int nb = std::min(batch_size, num_cells - first);
+        for (int s = 0; s < n; ++s)
+        {
+            for (int c = 0; c < nb; ++c) y[s * nb + c] = Q[s][offsets[first + c]];
+        }
+        for (int c = 0; c < nb; ++c)
+        {
+            t[c] = 0.0;
+            h[c] = dt;
+            num_steps[c] = 0;
+            active[c] = c;
+        }
+
+        int na = nb;
+        while (na > 0)
+        {
+            // Evaluate the reaction rates and their Jacobians for all active
+            // cells at once.
+            for (int s = 0; s < n; ++s)
+            {
+                for (int a = 0; a < na; ++a) y_a[s * na + a] = y[s * nb + active[a]];
+            }
+            d_reaction_strategy->computeReactionRates(f_a.data(), y_a.data(), n, na);
+            d_reaction_strategy->computeReactionJacobian(J_a.data(), y_a.data(), f_a.data(), n, na);
+
+            // First stage: (I - gamma h J) k1 = f(y).
+            for (int a = 0; a < na; ++a)
+            {
+                const int c = active[a];
+                h_a[a] = std::min(h[c], dt - t[c]);
+                for (int r = 0; r < n; ++r)
+                {
+                    for (int s = 0; s < n; ++s)
+                    {
+                        W(r, s) = (r == s ? 1.0 : 0.0) - GAMMA * h_a[a] * J_a[(r * n + s) * na + a];
+                    }
+                    rhs(r) = f_a[r * na + a];
+                }
+                lu[a].compute(W);
+                k = lu[a].solve(rhs);
+                for (int s = 0; s < n; ++s)
+                {
+                    k1_a[s * na + a] = k(s);
+                    y_stage_a[s * na + a] = y_a[s * na + a] + h_a[a] * k(s);
+                }
+            }
+            d_reaction_strategy->computeReactionRates(f_stage_a.data(), y_stage_a.data(), n, na);
+
+            // Second stage: (I - gamma h J) k2 = f(y + h k1) - 2 k1, followed
+            // by the error estimate and the choice of the next substep size.
+            int num_active = 0;
+            for (int a = 0; a < na; ++a)
+            {
+                const int c = active[a];
+                for (int s = 0; s < n; ++s) rhs(s) = f_stage_a[s * na + a] - 2.0 * k1_a[s * na + a];
+                k = lu[a].solve(rhs);
+                double err = 0.0;
+                for (int s = 0; s < n; ++s)
+                {
+                    const double y_old = y_a[s * na + a];
+                    const double y_new = y_old + h_a[a] * (1.5 * k1_a[s * na + a] + 0.5 * k(s));
+                    const double scale = d_abs_tol + d_rel_tol * std::max(std::abs(y_old), std::abs(y_new));
+                    const double e = 0.5 * h_a[a] * (k1_a[s * na + a] + k(s)) / scale;
+                    err += e * e;
+                    y_stage_a[s * na + a] = y_new;
+                }
+                err = std::sqrt(err / static_cast<double>(n));
+                if (err <= 1.0)
+                {
+                    const bool last_substep = h[c] >= dt - t[c];
+                    t[c] = last_substep ? dt : t[c] + h_a[a];
+                    for (int s = 0; s < n; ++s) y[s * nb + c] = y_stage_a[s * na + a];
+                    ++num_accepted_substeps;
+                }
+                else
+                {
+                    ++num_rejected_substeps;
+                }
+                const double factor =
+                    std::isfinite(err) ? SAFETY_FACTOR / std::sqrt(std::max(err, 1.0e-10)) : MIN_FACTOR;
+                h[c] = h_a[a] * std::min(MAX_FACTOR, std::max(MIN_FACTOR, factor));
+                if (t[c] < dt)
+                {
+                    if (++num_steps[c] >= d_max_num_substeps)
+                    {
+                        TBOX_ERROR(d_object_name << "::integrateBox():\n"
+                                                 << "  maximum number of substeps exceeded\n");
+                    }
+                    active[num_active++] = c;
+                }
+            }
+            na = num_active;
+        }
+
+        for (int s = 0; s < n; ++s)
+        {
+            for (int c = 0; c < nb; ++c) Q[s][offsets[first + c]] = y[s * nb + c];
+        }
+    }
+    return;
+} // integrateBox
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
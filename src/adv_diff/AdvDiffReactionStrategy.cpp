@@ -0,0 +1,71 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibamr/AdvDiffReactionStrategy.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "ibamr/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBAMR
+{
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+AdvDiffReactionStrategy::computeReactionJacobian(double* const J,
+                                                 const double* const y,
+                                                 const double* const f,
+                                                 const int num_species,
+                                                 const int num_cells) const
+{
+    static const double sqrt_eps = std::sqrt(std::numeric_limits<double>::epsilon());
+    const int n = num_species * num_cells;
+    std::vector<double> y_pert(y, y + n), f_pert(n), h(num_cells);
+    for (int s = 0; s < num_species; ++s)
+    {
+        // Perturb component s in all cells of the batch at once.
+        double* const y_s = y_pert.data() + s * num_cells;
+        for (int c = 0; c < num_cells; ++c)
+        {
+            h[c] = sqrt_eps * std::max(std::abs(y_s[c]), 1.0);
+            y_s[c] += h[c];
+            h[c] = y_s[c] - y[s * num_cells + c];
+        }
+        computeReactionRates(f_pert.data(), y_pert.data(), num_species, num_cells);
+        for (int r = 0; r < num_species; ++r)
+        {
+            double* const J_rs = J + (r * num_species + s) * num_cells;
+            const double* const f_r = f + r * num_cells;
+            const double* const f_pert_r = f_pert.data() + r * num_cells;
+            for (int c = 0; c < num_cells; ++c)
+            {
+                J_rs[c] = (f_pert_r[c] - f_r[c]) / h[c];
+            }
+        }
+        std::copy(y + s * num_cells, y + (s + 1) * num_cells, y_s);
+    }
+    return;
+} // computeReactionJacobian
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
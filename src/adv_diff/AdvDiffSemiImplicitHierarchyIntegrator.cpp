@@ -480,13 +480,14 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_scratch_data, current_time);
-        level->allocatePatchData(d_new_data, new_time);
+        allocateLevelPatchData(level, d_scratch_data, current_time);
+        allocateLevelPatchData(level, d_new_data, new_time);
     }
 
     // Update the advection velocity.
     for (const auto& u_var : d_u_var)
     {
+        if (d_u_is_managed_externally[u_var]) continue;
         const int u_current_idx = var_db->mapVariableAndContextToIndex(u_var, getCurrentContext());
         const int u_scratch_idx = var_db->mapVariableAndContextToIndex(u_var, getScratchContext());
         const int u_new_idx = var_db->mapVariableAndContextToIndex(u_var, getNewContext());
@@ -601,16 +602,7 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
         helmholtz_solver->setHomogeneousBc(false);
         helmholtz_solver->setSolutionTime(new_time);
         helmholtz_solver->setTimeInterval(current_time, new_time);
-        if (d_helmholtz_solvers_need_init[l])
-        {
-            if (d_enable_logging)
-            {
-                plog << d_object_name << ": "
-                     << "Initializing Helmholtz solvers for variable number " << l << "\n";
-            }
-            helmholtz_solver->initializeSolverState(*d_sol_vecs[l], *d_rhs_vecs[l]);
-            d_helmholtz_solvers_need_init[l] = false;
-        }
+        initializeHelmholtzSolver(l, solver_spec);
 
         // Account for the convective difference term.
         Pointer<FaceVariable<NDIM, double> > u_var = d_Q_u_map[Q_var];
@@ -687,6 +679,24 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
         });
     }
 
+    // Update the advection velocities. This is done once for all transported
+    // quantities since several quantities generally share the same velocity.
+    if (cycle_num > 0)
+    {
+        for (const auto& u_var : d_u_var)
+        {
+            if (d_u_is_managed_externally[u_var]) continue;
+            const int u_current_idx = var_db->mapVariableAndContextToIndex(u_var, getCurrentContext());
+            const int u_scratch_idx = var_db->mapVariableAndContextToIndex(u_var, getScratchContext());
+            const int u_new_idx = var_db->mapVariableAndContextToIndex(u_var, getNewContext());
+            if (d_u_fcn[u_var])
+            {
+                d_u_fcn[u_var]->setDataOnPatchHierarchy(u_new_idx, u_var, d_hierarchy, new_time);
+            }
+            d_hier_fc_data_ops->linearSum(u_scratch_idx, 0.5, u_current_idx, 0.5, u_new_idx);
+        }
+    }
+
     // Perform a single step of fixed point iteration.
     unsigned int l = 0;
     for (auto cit = d_Q_var.begin(); cit != d_Q_var.end(); ++cit, ++l)
@@ -702,22 +712,6 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
         const int F_new_idx = d_F_fcn[F_var] ? var_db->mapVariableAndContextToIndex(F_var, getNewContext()) : -1;
         const int Q_rhs_scratch_idx = var_db->mapVariableAndContextToIndex(Q_rhs_var, getScratchContext());
 
-        // Update the advection velocity.
-        if (cycle_num > 0)
-        {
-            for (const auto& u_var : d_u_var)
-            {
-                const int u_current_idx = var_db->mapVariableAndContextToIndex(u_var, getCurrentContext());
-                const int u_scratch_idx = var_db->mapVariableAndContextToIndex(u_var, getScratchContext());
-                const int u_new_idx = var_db->mapVariableAndContextToIndex(u_var, getNewContext());
-                if (d_u_fcn[u_var])
-                {
-                    d_u_fcn[u_var]->setDataOnPatchHierarchy(u_new_idx, u_var, d_hierarchy, new_time);
-                }
-                d_hier_fc_data_ops->linearSum(u_scratch_idx, 0.5, u_current_idx, 0.5, u_new_idx);
-            }
-        }
-
         // Account for the convective difference term.
         Pointer<FaceVariable<NDIM, double> > u_var = d_Q_u_map[Q_var];
         Pointer<CellVariable<NDIM, double> > N_var = d_Q_N_map[Q_var];
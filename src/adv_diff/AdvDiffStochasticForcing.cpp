@@ -53,7 +53,9 @@
 #include "muParser.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <ostream>
 #include <string>
@@ -82,6 +84,35 @@ genrandn(ArrayData<NDIM, double>& data, const Box<NDIM>& box)
     }
     return;
 } // genrandn
+
+void
+genrandn(ArrayData<NDIM, double>& data,
+         const Box<NDIM>& box,
+         const std::array<std::uint32_t, 2>& key,
+         const std::uint32_t stream)
+{
+    // The counter is the index of the data point together with the stream and
+    // depth, so the generated values do not depend on the patch layout.
+    std::array<std::uint32_t, 4> counter = { 0, 0, 0, 0 };
+    for (int depth = 0; depth < data.getDepth(); ++depth)
+    {
+        counter[3] = stream + static_cast<std::uint32_t>(depth);
+        for (Box<NDIM>::Iterator i(box); i; i++)
+        {
+            const Index<NDIM>& idx = i();
+            for (int d = 0; d < NDIM; ++d) counter[d] = static_cast<std::uint32_t>(idx(d));
+            data(idx, depth) = RNG::genrandn(key, counter);
+        }
+    }
+    return;
+} // genrandn
+
+inline std::uint32_t
+compute_rng_stream(const int level_num, const int k, const int field)
+{
+    return (static_cast<std::uint32_t>(level_num) << 24) | (static_cast<std::uint32_t>(k) << 16) |
+           (static_cast<std::uint32_t>(field) << 8);
+} // compute_rng_stream
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -97,6 +128,9 @@ AdvDiffStochasticForcing::AdvDiffStochasticForcing(std::string object_name,
     {
         if (input_db->keyExists("std")) d_std = input_db->getDouble("std");
         if (input_db->keyExists("num_rand_vals")) d_num_rand_vals = input_db->getInteger("num_rand_vals");
+        if (input_db->keyExists("use_counter_based_rng"))
+            d_use_counter_based_rng = input_db->getBool("use_counter_based_rng");
+        if (input_db->keyExists("rng_seed")) d_rng_seed = input_db->getInteger("rng_seed");
         int k = 0;
         std::string key_name = "weights_0";
         while (input_db->keyExists(key_name))
@@ -235,6 +269,13 @@ AdvDiffStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
         // Generate random components.
         if (cycle_num == 0)
         {
+            // When the counter-based generator is used, the random values are
+            // determined by the seed, the time step number, and the indices of
+            // the data.
+            const std::array<std::uint32_t, 2> rng_key = {
+                static_cast<std::uint32_t>(d_rng_seed),
+                static_cast<std::uint32_t>(d_adv_diff_solver->getIntegratorStep())
+            };
             for (int k = 0; k < d_num_rand_vals; ++k)
             {
                 for (int level_num = coarsest_ln; level_num <= finest_ln; ++level_num)
@@ -246,7 +287,12 @@ AdvDiffStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
                         Pointer<SideData<NDIM, double> > F_sc_data = patch->getPatchData(d_F_sc_idxs[k]);
                         for (int d = 0; d < NDIM; ++d)
                         {
-                            genrandn(F_sc_data->getArrayData(d), SideGeometry<NDIM>::toSideBox(F_sc_data->getBox(), d));
+                            const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(F_sc_data->getBox(), d);
+                            if (d_use_counter_based_rng)
+                                genrandn(
+                                    F_sc_data->getArrayData(d), side_box, rng_key, compute_rng_stream(level_num, k, d));
+                            else
+                                genrandn(F_sc_data->getArrayData(d), side_box);
                         }
                     }
                 }
@@ -213,13 +213,14 @@ BrinkmanAdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(con
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_scratch_data, current_time);
-        level->allocatePatchData(d_new_data, new_time);
+        allocateLevelPatchData(level, d_scratch_data, current_time);
+        allocateLevelPatchData(level, d_new_data, new_time);
     }
 
     // Update the advection velocity.
     for (const auto& u_var : d_u_var)
     {
+        if (d_u_is_managed_externally[u_var]) continue;
         const int u_current_idx = var_db->mapVariableAndContextToIndex(u_var, getCurrentContext());
         const int u_scratch_idx = var_db->mapVariableAndContextToIndex(u_var, getScratchContext());
         const int u_new_idx = var_db->mapVariableAndContextToIndex(u_var, getNewContext());
@@ -446,6 +447,24 @@ BrinkmanAdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double
         });
     }
 
+    // Update the advection velocities. This is done once for all transported
+    // quantities since several quantities generally share the same velocity.
+    if (cycle_num > 0)
+    {
+        for (const auto& u_var : d_u_var)
+        {
+            if (d_u_is_managed_externally[u_var]) continue;
+            const int u_current_idx = var_db->mapVariableAndContextToIndex(u_var, getCurrentContext());
+            const int u_scratch_idx = var_db->mapVariableAndContextToIndex(u_var, getScratchContext());
+            const int u_new_idx = var_db->mapVariableAndContextToIndex(u_var, getNewContext());
+            if (d_u_fcn[u_var])
+            {
+                d_u_fcn[u_var]->setDataOnPatchHierarchy(u_new_idx, u_var, d_hierarchy, new_time);
+            }
+            d_hier_fc_data_ops->linearSum(u_scratch_idx, 0.5, u_current_idx, 0.5, u_new_idx);
+        }
+    }
+
     // Perform a single step of fixed point iteration.
     unsigned int l = 0;
     for (auto cit = d_Q_var.begin(); cit != d_Q_var.end(); ++cit, ++l)
@@ -596,22 +615,6 @@ BrinkmanAdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double
             }
         }
 
-        // Update the advection velocity.
-        if (cycle_num > 0)
-        {
-            for (const auto& u_var : d_u_var)
-            {
-                const int u_current_idx = var_db->mapVariableAndContextToIndex(u_var, getCurrentContext());
-                const int u_scratch_idx = var_db->mapVariableAndContextToIndex(u_var, getScratchContext());
-                const int u_new_idx = var_db->mapVariableAndContextToIndex(u_var, getNewContext());
-                if (d_u_fcn[u_var])
-                {
-                    d_u_fcn[u_var]->setDataOnPatchHierarchy(u_new_idx, u_var, d_hierarchy, new_time);
-                }
-                d_hier_fc_data_ops->linearSum(u_scratch_idx, 0.5, u_current_idx, 0.5, u_new_idx);
-            }
-        }
-
         // Account for the convective difference term.
         Pointer<FaceVariable<NDIM, double> > u_var = d_Q_u_map[Q_var];
         Pointer<CellVariable<NDIM, double> > N_var = d_Q_N_map[Q_var];
@@ -858,6 +861,21 @@ BrinkmanAdvDiffSemiImplicitHierarchyIntegrator::registerBrinkmanAdvDiffBcHelper(
     return;
 } // registerBrinkmanAdvDiffBcHelper
 
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+bool
+BrinkmanAdvDiffSemiImplicitHierarchyIntegrator::canShareHelmholtzSolver(
+    Pointer<CellVariable<NDIM, double> > Q1_var,
+    Pointer<CellVariable<NDIM, double> > Q2_var) const
+{
+    if (d_brinkman_penalization && (d_brinkman_penalization->hasBrinkmanBoundaryCondition(Q1_var) ||
+                                    d_brinkman_penalization->hasBrinkmanBoundaryCondition(Q2_var)))
+    {
+        return false;
+    }
+    return AdvDiffSemiImplicitHierarchyIntegrator::canShareHelmholtzSolver(Q1_var, Q2_var);
+} // canShareHelmholtzSolver
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
@@ -105,7 +105,7 @@ c     Improve the accuracy of the weights (following the approach of
 c     Henrick, Aslam, and Powers).
       do i = 0,2
          omega(i) = omega(i)*(omega_bar(i)+omega_bar(i)**2.d0
-     &        -3.d0*omega_bar(i)*omega(i)+omega(i)**2.d0)/
+     &           -3.d0*omega_bar(i)*omega(i)+omega(i)**2.d0)/
      &        (omega_bar(i)**2.d0+omega(i)*(1.d0-2.d0*omega_bar(i)))
       enddo
       omega_sum = 0.d0
@@ -800,6 +800,97 @@ c
 c
       return
       end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Compute (limited) slopes on a one-dimensional pencil of cells.
+c
+c     The limiter is selected once per pencil rather than once per cell,
+c     so that each of the loops below is free of limiter branches.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine advect_pencil_slopes(
+     &     limiter,
+     &     ifirst,ilast,
+     &     nQgc,
+     &     Q,
+     &     Qx)
+c
+      implicit none
+include(TOP_SRCDIR/src/fortran/const.i)dnl
+include(TOP_SRCDIR/src/advect/fortran/limitertypes.i)dnl
+c
+c     Functions.
+c
+      REAL minmod,muscldiff,maxmod2,minmod3
+c
+c     Input.
+c
+      INTEGER limiter
+
+      INTEGER ifirst,ilast
+
+      INTEGER nQgc
+
+      REAL Q(ifirst-nQgc:ilast+nQgc)
+c
+c     Input/Output.
+c
+      REAL Qx(ifirst-1:ilast+1)
+c
+c     Local variables.
+c
+      INTEGER ic
+c
+c     Compute slopes in cells ifirst-1,...,ilast+1.
+c
+      if     ( limiter.eq.second_order ) then
+c     Employ second order slopes (no limiting).
+         do ic = ifirst-1,ilast+1
+            Qx(ic) = half*(Q(ic+1)-Q(ic-1))
+         enddo
+      elseif ( limiter.eq.fourth_order ) then
+         do ic = ifirst-1,ilast+1
+            Qx(ic) = twothird*(Q(ic+1)-Q(ic-1))
+     &           - sixth*half*(Q(ic+2)-Q(ic-2))
+         enddo
+      elseif ( limiter.eq.minmod_limited ) then
+c     Employ minmod limiter
+         do ic = ifirst-1,ilast+1
+            Qx(ic) = minmod(Q(ic)-Q(ic-1),Q(ic+1)-Q(ic))
+         enddo
+      elseif ( limiter.eq.mc_limited ) then
+c     Employ van Leer's MC limiter.
+         do ic = ifirst-1,ilast+1
+            Qx(ic) = minmod3(
+     &           0.5d0*(Q(ic+1)-Q(ic-1)),
+     &           2.0d0*(Q(ic  )-Q(ic-1)),
+     &           2.0d0*(Q(ic+1)-Q(ic  )))
+         enddo
+      elseif ( limiter.eq.superbee_limited ) then
+c     Employ superbee limiter
+         do ic = ifirst-1,ilast+1
+            Qx(ic) = maxmod2(
+     &           minmod(2.0d0*(Q(ic  )-Q(ic-1)),
+     &                         Q(ic+1)-Q(ic  )),
+     &           minmod(       Q(ic  )-Q(ic-1),
+     &                  2.0d0*(Q(ic+1)-Q(ic  ))))
+         enddo
+      elseif ( limiter.eq.muscl_limited ) then
+c     Employ Colella's MUSCL limiter.
+         do ic = ifirst-1,ilast+1
+            Qx(ic) = muscldiff(Q(ic-2))
+         enddo
+      else
+c     Employ simple upwind scheme (piece-wise constant approximation)
+         do ic = ifirst-1,ilast+1
+            Qx(ic) = 0.d0
+         enddo
+      endif
+c
+      return
+      end
 c
       subroutine advect_predictnormal2d(
      &     dx0,dt,
@@ -813,12 +904,10 @@ c
      &     qhalf0)
 c
       implicit none
-include(TOP_SRCDIR/src/fortran/const.i)dnl
-include(TOP_SRCDIR/src/advect/fortran/limitertypes.i)dnl
 c
 c     Functions.
 c
-      REAL minmod,sign_eps,muscldiff,maxmod2,minmod3
+      REAL sign_eps
 c
 c     Input.
 c
@@ -844,8 +933,9 @@ c
 c     Local variables.
 c
       INTEGER ic0,ic1
-      REAL Qx,qL,qR
-      REAL unorm
+      REAL Qx(ifirst0-1:ilast0+1)
+      REAL qL,qR
+      REAL unorm_L,unorm_R
 c
 c     Predict face centered values using a Taylor expansion about each
 c     cell center.
@@ -853,82 +943,30 @@ c
 c     (Limited) centered differences are used to approximate normal
 c     derivatives.  Transverse derivatives are NOT included.
 c
-      Qx = 0.d0
-
+c     The slopes are computed for a whole pencil of cells at once, so that
+c     the limiter is selected once per pencil and the loop over the faces
+c     of the pencil is branch free.
+c
       do ic1 = ifirst1-1,ilast1+1
-
-         if     ( limiter.eq.second_order ) then
-c     Employ second order slopes (no limiting).
-            Qx = half*(Q(ifirst0-1+1,ic1)-Q(ifirst0-1-1,ic1))
-         else if ( limiter.eq.fourth_order ) then
-            Qx = twothird*(Q(ifirst0-1+1,ic1)-Q(ifirst0-1-1,ic1))
-     &           - sixth*half*(Q(ifirst0-1+2,ic1)-Q(ifirst0-1-2,ic1))
-         else if ( limiter.eq.minmod_limited ) then
-c     Employ minmod limiter
-            Qx = minmod(Q(ifirst0-1,ic1)-Q(ifirst0-2,ic1),
-     &                   Q(ifirst0  ,ic1)-Q(ifirst0-1,ic1))
-         else if ( limiter.eq.mc_limited ) then
-c     Employ van Leer's MC limiter.
-            Qx = minmod3(
-     &           0.5d0*(Q(ifirst0-1+1,ic1)-Q(ifirst0-1-1,ic1)),
-     &           2.0d0*(Q(ifirst0-1  ,ic1)-Q(ifirst0-1-1,ic1)),
-     &           2.0d0*(Q(ifirst0-1+1,ic1)-Q(ifirst0-1  ,ic1)))
-         else if ( limiter.eq.superbee_limited ) then
-c     Employ superbee limiter
-            Qx = maxmod2(
-     &           minmod(2.0d0*(Q(ifirst0-1,ic1)-Q(ifirst0-2,ic1)),
-     &                         Q(ifirst0  ,ic1)-Q(ifirst0-1,ic1)),
-     &           minmod(       Q(ifirst0-1,ic1)-Q(ifirst0-2,ic1),
-     &                  2.0d0*(Q(ifirst0  ,ic1)-Q(ifirst0-1,ic1))))
-         else if ( limiter.eq.muscl_limited ) then
-c     Employ Colella's MUSCL limiter.
-            Qx = muscldiff(Q(ifirst0-1-2,ic1))
-         else if ( limiter.eq.ctu_only) then
-c     Employ simple upwind scheme (piece-wise constant approximation)
-            Qx = 0.d0
-         endif
-
-         unorm = 0.5d0*(u0(ifirst0-1  ,ic1)+u0(ifirst0-1+1,ic1))
+         call advect_pencil_slopes(
+     &     limiter,
+     &     ifirst0,ilast0,
+     &     nQgc0,
+     &     Q(ifirst0-nQgc0,ic1),
+     &     Qx)
 
          do ic0 = ifirst0-1,ilast0
+            unorm_L = 0.5d0*(u0(ic0  ,ic1)+u0(ic0+1,ic1))
+            unorm_R = 0.5d0*(u0(ic0+1,ic1)+u0(ic0+2,ic1))
 
             qL = Q(ic0  ,ic1)
-     &           + 0.5d0*(1.d0-unorm*dt/dx0)*Qx
-
-            if     ( limiter.eq.second_order ) then
-               Qx = 0.5d0*(Q(ic0+1+1,ic1)-Q(ic0+1-1,ic1))
-            elseif ( limiter.eq.fourth_order ) then
-               Qx = twothird*(Q(ic0+1+1,ic1)-Q(ic0+1-1,ic1))
-     &              - sixth*half*(Q(ic0+1+2,ic1)-Q(ic0+1-2,ic1))
-            elseif ( limiter.eq.minmod_limited ) then
-               Qx = minmod(Q(ic0+1,ic1)-Q(ic0  ,ic1),
-     &                     Q(ic0+2,ic1)-Q(ic0+1,ic1))
-            elseif ( limiter.eq.mc_limited ) then
-               Qx = minmod3(
-     &              0.5d0*(Q(ic0+1+1,ic1)-Q(ic0+1-1,ic1)),
-     &              2.0d0*(Q(ic0+1  ,ic1)-Q(ic0+1-1,ic1)),
-     &              2.0d0*(Q(ic0+1+1,ic1)-Q(ic0+1  ,ic1)))
-            elseif ( limiter.eq.superbee_limited ) then
-               Qx = maxmod2(
-     &              minmod(2.0d0*(Q(ic0+1,ic1)-Q(ic0  ,ic1)),
-     &                            Q(ic0+2,ic1)-Q(ic0+1,ic1)),
-     &              minmod(       Q(ic0+1,ic1)-Q(ic0  ,ic1),
-     &                     2.0d0*(Q(ic0+2,ic1)-Q(ic0+1,ic1))))
-            elseif ( limiter.eq.muscl_limited ) then
-               Qx = muscldiff(Q(ic0+1-2,ic1))
-            elseif ( limiter.eq.ctu_only) then
-               Qx = 0.d0
-            endif
-
-            unorm = 0.5d0*(u0(ic0+1,ic1)+u0(ic0+2,ic1))
-
+     &           + 0.5d0*(1.d0-unorm_L*dt/dx0)*Qx(ic0  )
             qR = Q(ic0+1,ic1)
-     &           - 0.5d0*(1.d0+unorm*dt/dx0)*Qx
+     &           - 0.5d0*(1.d0+unorm_R*dt/dx0)*Qx(ic0+1)
 
             qhalf0(ic0+1,ic1) =
-     &         0.5d0*(qL+qR)+sign_eps(u0(ic0+1,ic1))*0.5d0*(qL-qR)
+     &           0.5d0*(qL+qR)+sign_eps(u0(ic0+1,ic1))*0.5d0*(qL-qR)
          enddo
-
       enddo
 c
       return
@@ -950,12 +988,10 @@ c
      &     qhalf0)
 c
       implicit none
-include(TOP_SRCDIR/src/fortran/const.i)dnl
-include(TOP_SRCDIR/src/advect/fortran/limitertypes.i)dnl
 c
 c     Functions.
 c
-      REAL minmod,sign_eps,muscldiff,maxmod2,minmod3
+      REAL sign_eps
 c
 c     Input.
 c
@@ -983,8 +1019,9 @@ c
 c     Local variables.
 c
       INTEGER ic0,ic1
-      REAL Qx,qL,qR
-      REAL unorm
+      REAL Qx(ifirst0-1:ilast0+1)
+      REAL qL,qR
+      REAL unorm_L,unorm_R
 c
 c     Predict face centered values using a Taylor expansion about each
 c     cell center.
@@ -992,89 +1029,32 @@ c
 c     (Limited) centered differences are used to approximate normal
 c     derivatives.  Transverse derivatives are NOT included.
 c
-      Qx = 0.d0
-
+c     The slopes are computed for a whole pencil of cells at once, so that
+c     the limiter is selected once per pencil and the loop over the faces
+c     of the pencil is branch free.
+c
       do ic1 = ifirst1-1,ilast1+1
-
-         if     ( limiter.eq.second_order ) then
-c     Employ second order slopes (no limiting).
-            Qx = half*(Q(ifirst0-1+1,ic1)-Q(ifirst0-1-1,ic1))
-         elseif ( limiter.eq.fourth_order ) then
-            Qx = twothird*(Q(ifirst0-1+1,ic1)-Q(ifirst0-1-1,ic1))
-     &           - sixth*half*(Q(ifirst0-1+2,ic1)-Q(ifirst0-1-2,ic1))
-         else if ( limiter.eq.minmod_limited ) then
-c     Employ minmod limiter
-            Qx = minmod(Q(ifirst0-1,ic1)-Q(ifirst0-2,ic1),
-     &                   Q(ifirst0  ,ic1)-Q(ifirst0-1,ic1))
-         elseif ( limiter.eq.mc_limited ) then
-c     Employ van Leer's MC limiter.
-            Qx = minmod3(
-     &           0.5d0*(Q(ifirst0-1+1,ic1)-Q(ifirst0-1-1,ic1)),
-     &           2.0d0*(Q(ifirst0-1  ,ic1)-Q(ifirst0-1-1,ic1)),
-     &           2.0d0*(Q(ifirst0-1+1,ic1)-Q(ifirst0-1  ,ic1)))
-         else if ( limiter.eq.superbee_limited ) then
-c     Employ superbee limiter
-            Qx = maxmod2(
-     &           minmod(2.0d0*(Q(ifirst0-1,ic1)-Q(ifirst0-2,ic1)),
-     &                         Q(ifirst0  ,ic1)-Q(ifirst0-1,ic1)),
-     &           minmod(       Q(ifirst0-1,ic1)-Q(ifirst0-2,ic1),
-     &                  2.0d0*(Q(ifirst0  ,ic1)-Q(ifirst0-1,ic1))))
-         elseif ( limiter.eq.muscl_limited ) then
-c     Employ Colella's MUSCL limiter.
-            Qx = muscldiff(Q(ifirst0-1-2,ic1))
-         elseif ( limiter.eq.ctu_only) then
-c     Employ simple upwind scheme (piece-wise constant approximation)
-            Qx = 0.d0
-         endif
-
-         unorm = 0.5d0*(u0(ifirst0-1,ic1)+u0(ifirst0-1+1,ic1))
-!        unorm = fourth*fourth*
-!    &        ( 9.d0*(u0(ifirst0-1  ,ic1)+u0(ifirst0-1+1,ic1))
-!    &        - 1.d0*(u0(ifirst0-1-1,ic1)+u0(ifirst0-1+2,ic1)) )
+         call advect_pencil_slopes(
+     &     limiter,
+     &     ifirst0,ilast0,
+     &     nQgc0,
+     &     Q(ifirst0-nQgc0,ic1),
+     &     Qx)
 
          do ic0 = ifirst0-1,ilast0
+            unorm_L = 0.5d0*(u0(ic0  ,ic1)+u0(ic0+1,ic1))
+            unorm_R = 0.5d0*(u0(ic0+1,ic1)+u0(ic0+2,ic1))
+
             qL = Q(ic0  ,ic1)
-     &           + 0.5d0*(1.d0-unorm*dt/dx0)*Qx
+     &           + 0.5d0*(1.d0-unorm_L*dt/dx0)*Qx(ic0  )
      &           + 0.5d0*dt*F(ic0  ,ic1)
-
-            if     ( limiter.eq.second_order ) then
-               Qx = 0.5d0*(Q(ic0+1+1,ic1)-Q(ic0+1-1,ic1))
-            elseif ( limiter.eq.fourth_order ) then
-               Qx = twothird*(Q(ic0+1+1,ic1)-Q(ic0+1-1,ic1))
-     &              - sixth*half*(Q(ic0+1+2,ic1)-Q(ic0+1-2,ic1))
-            elseif ( limiter.eq.minmod_limited ) then
-               Qx = minmod(Q(ic0+1,ic1)-Q(ic0  ,ic1),
-     &                     Q(ic0+2,ic1)-Q(ic0+1,ic1))
-            elseif ( limiter.eq.mc_limited ) then
-               Qx = minmod3(
-     &              0.5d0*(Q(ic0+1+1,ic1)-Q(ic0+1-1,ic1)),
-     &              2.0d0*(Q(ic0+1  ,ic1)-Q(ic0+1-1,ic1)),
-     &              2.0d0*(Q(ic0+1+1,ic1)-Q(ic0+1  ,ic1)))
-            elseif ( limiter.eq.superbee_limited ) then
-               Qx = maxmod2(
-     &              minmod(2.0d0*(Q(ic0+1,ic1)-Q(ic0  ,ic1)),
-     &                            Q(ic0+2,ic1)-Q(ic0+1,ic1)),
-     &              minmod(       Q(ic0+1,ic1)-Q(ic0  ,ic1),
-     &                     2.0d0*(Q(ic0+2,ic1)-Q(ic0+1,ic1))))
-            elseif ( limiter.eq.muscl_limited ) then
-               Qx = muscldiff(Q(ic0+1-2,ic1))
-            elseif ( limiter.eq.ctu_only) then
-               Qx = 0.d0
-            endif
-
-            unorm = 0.5d0*(u0(ic0+1,ic1)+u0(ic0+2,ic1))
-!           unorm = fourth*fourth*
-!    &           ( 9.d0*(u0(ic0+1,ic1)+u0(ic0+2,ic1))
-!    &           - 1.d0*(u0(ic0  ,ic1)+u0(ic0+3,ic1)) )
-
             qR = Q(ic0+1,ic1)
-     &           - 0.5d0*(1.d0+unorm*dt/dx0)*Qx
+     &           - 0.5d0*(1.d0+unorm_R*dt/dx0)*Qx(ic0+1)
      &           + 0.5d0*dt*F(ic0+1,ic1)
 
             qhalf0(ic0+1,ic1) =
      &           0.5d0*(qL+qR)+sign_eps(u0(ic0+1,ic1))*0.5d0*(qL-qR)
          enddo
-
       enddo
 c
       return
@@ -20,6 +20,8 @@
 #include "Patch.h"
 #include "tbox/Database.h"
 
+#include <cmath>
+
 #include "ibamr/app_namespaces.h" // IWYU pragma: keep
 
 namespace SAMRAI
@@ -108,4 +110,19 @@ CFGiesekusRelaxation::setDataOnPatch(const int data_idx,
     }
 } // setDataOnPatch
 
+void
+CFGiesekusRelaxation::relaxEigenvalues(VectorNd& eig_vals, const double dt)
+{
+    const double decay = std::exp(-dt / d_lambda);
+    for (int d = 0; d < NDIM; ++d)
+    {
+        const double x = eig_vals(d) - 1.0;
+        const double denom = 1.0 + d_alpha * x * (1.0 - decay);
+        // The denominator is positive for nonnegative eigenvalues. Otherwise,
+        // only the linear part of the relaxation is applied.
+        eig_vals(d) = 1.0 + (denom > 0.0 ? x * decay / denom : x * decay);
+    }
+    return;
+} // relaxEigenvalues
+
 } // namespace IBAMR
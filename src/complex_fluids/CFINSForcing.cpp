@@ -58,6 +58,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <cmath>
 #include <ostream>
 #include <utility>
+#include <vector>
 
 #include "ibamr/app_namespaces.h" // IWYU pragma: keep
 
@@ -213,6 +214,11 @@ CFINSForcing::commonConstructor(const Pointer<Database> input_db,
     if (d_project_conform)
         d_adv_diff_integrator->registerIntegrateHierarchyCallback(&apply_project_tensor_callback,
                                                                   static_cast<void*>(this));
+    // Have advection diffusion integrator integrate the relaxation separately from the transport if necessary.
+    d_split_relaxation = input_db->getBoolWithDefault("split_relaxation", d_split_relaxation);
+    if (d_split_relaxation)
+        d_adv_diff_integrator->registerPostprocessIntegrateHierarchyCallback(&apply_relaxation_callback,
+                                                                             static_cast<void*>(this));
 
     // Set up drawing variables if necessary
     d_conform_draw = input_db->getBoolWithDefault("output_conformation_tensor", d_conform_draw);
@@ -263,6 +269,7 @@ CFINSForcing::commonConstructor(const Pointer<Database> input_db,
     }
     d_convec_oper = new CFUpperConvectiveOperator(
         "ComplexFluidConvectiveOperator", d_W_cc_var, input_db, d_convec_oper_type, d_conc_bc_coefs, vel_bcs);
+    d_convec_oper->setSourceFunctionIsSplit(d_split_relaxation);
     d_adv_diff_integrator->setConvectiveOperator(d_W_cc_var, d_convec_oper);
 
     // Register relaxation function
@@ -356,47 +363,19 @@ CFINSForcing::setDataOnPatchHierarchy(const int data_idx,
     ghost_fill_op.initializeOperatorState(ghost_cell_components, hierarchy);
     ghost_fill_op.fillData(data_time);
 
-    HierarchyDataOpsManager<NDIM>* hier_data_ops_manager = HierarchyDataOpsManager<NDIM>::getManager();
-    Pointer<HierarchyDataOpsReal<NDIM, double> > hier_cc_data_ops =
-        hier_data_ops_manager->getOperationsDouble(d_W_cc_var, hierarchy, true);
-    // Convert evolved quantity including ghost cells to conformation tensor.
-    switch (d_evolve_type)
+    // Convert evolved quantity including ghost cells to conformation tensor, and check that the conformation tensor is
+    // positive definite and compute its extremal determinants in the same sweep over the patch data.
+    if (d_evolve_type == UNKNOWN_TENSOR_EVOLUTION_TYPE)
     {
-    case SQUARE_ROOT:
-        squareMatrix(d_W_scratch_idx,
-                     d_W_cc_var,
-                     hierarchy,
-                     data_time,
-                     initial_time,
-                     coarsest_ln,
-                     finest_ln,
-                     true /*extended_box*/);
-        break;
-    case LOGARITHM:
-        exponentiateMatrix(d_W_scratch_idx,
-                           d_W_cc_var,
-                           hierarchy,
-                           data_time,
-                           initial_time,
-                           coarsest_ln,
-                           finest_ln,
-                           true /*extended_box*/);
-        break;
-    case STANDARD:
-        if (d_project_conform)
-            projectTensor(d_W_scratch_idx, d_W_cc_var, data_time, initial_time, true /*extended_box*/);
-        break;
-    case UNKNOWN_TENSOR_EVOLUTION_TYPE:
         TBOX_ERROR(d_object_name << "\n:"
                                  << "  Unknown tensor evolution type");
-        break;
     }
-
-    // Check to ensure conformation tensor is positive definite
     d_positive_def = true;
-    checkPositiveDefinite(d_W_scratch_idx, d_W_cc_var, data_time, initial_time);
+    d_max_det = 0.0;
+    d_min_det = std::numeric_limits<double>::max();
+    convertAndCheckConformationTensor(d_W_scratch_idx, hierarchy, initial_time, coarsest_ln, finest_ln);
     int temp = d_positive_def ? 1 : 0;
-    d_positive_def = IBTK_MPI::maxReduction(temp) == 1 ? true : false;
+    d_positive_def = IBTK_MPI::minReduction(temp) == 1 ? true : false;
     plog << "Conformation tensor is " << (d_positive_def ? "SPD" : "NOT SPD") << "\n";
     if (d_error_on_spd && !d_positive_def)
     {
@@ -404,12 +383,9 @@ CFINSForcing::setDataOnPatchHierarchy(const int data_idx,
                    << "    CONFORMATION TENSOR IS NOT SPD! \n\n");
     }
 
-    // Check max and min determinant
+    // Output max and min determinant
     if (d_log_det)
     {
-        d_max_det = 0.0;
-        d_min_det = std::numeric_limits<double>::max();
-        findDeterminant(d_W_scratch_idx, d_W_cc_var, data_time, initial_time);
         d_max_det = IBTK_MPI::maxReduction(d_max_det);
         d_min_det = IBTK_MPI::minReduction(d_min_det);
         plog << "Largest det:  " << d_max_det << "\n";
@@ -679,6 +655,7 @@ CFINSForcing::setDataOnPatch(const int data_idx,
 void
 CFINSForcing::registerRelaxationOperator(Pointer<CFRelaxationOperator> rhs)
 {
+    d_relax_oper = rhs;
     d_convec_oper->registerSourceFunction(rhs);
     return;
 } // registerRelaxationOperator
@@ -718,120 +695,106 @@ CFINSForcing::checkPositiveDefinite(const int data_idx,
 } // checkPositiveDefinite
 
 void
-CFINSForcing::squareMatrix(const int data_idx,
-                           const Pointer<Variable<NDIM> > /*var*/,
-                           const Pointer<PatchHierarchy<NDIM> > hierarchy,
-                           const double /*data_time*/,
-                           const bool initial_time,
-                           const int coarsest_ln,
-                           const int finest_ln,
-                           const bool extended_box)
+CFINSForcing::convertAndCheckConformationTensor(const int data_idx,
+                                                const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                const bool initial_time,
+                                                const int coarsest_ln,
+                                                const int finest_ln)
 {
+    // At the initial time, the data are already in the form of the conformation tensor except when evolving its
+    // logarithm, and the tensor is not checked for positive definiteness.
+    const bool convert = d_evolve_type == LOGARITHM || (!initial_time && d_evolve_type == SQUARE_ROOT) ||
+                         (!initial_time && d_evolve_type == STANDARD && d_project_conform);
+    const bool check_spd = !initial_time;
+    const bool find_det = d_log_det;
+    if (!convert && !check_spd && !find_det) return;
+
+    static const int NVOIGT = NDIM * (NDIM + 1) / 2;
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
+        // Collect the patch data before entering the threaded region since the reference counting of SAMRAI's smart
+        // pointers is not thread-safe.
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        std::vector<CellData<NDIM, double>*> W_data;
+        std::vector<Box<NDIM> > patch_boxes;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            if (initial_time) return;
             Pointer<CellData<NDIM, double> > data = patch->getPatchData(data_idx);
-            const Box<NDIM>& box = extended_box ? data->getGhostBox() : patch->getBox();
-            const Pointer<PatchGeometry<NDIM> > p_geom = patch->getPatchGeometry();
-
-            for (CellIterator<NDIM> it(box); it; it++)
-            {
-                CellIndex<NDIM> i = *it;
-                MatrixNd tens;
-                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
-                {
-                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
-                    tens(idx.first, idx.second) = tens(idx.second, idx.first) = (*data)(i, k);
-                }
-                tens = tens * tens;
-                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
-                {
-                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
-                    (*data)(i, k) = tens(idx.first, idx.second);
-                }
-            }
+            W_data.push_back(data.getPointer());
+            patch_boxes.push_back(patch->getBox());
         }
-    }
-    return;
-} // squareMatrix
-
-void
-CFINSForcing::findDeterminant(const int data_idx,
-                              const Pointer<Variable<NDIM> > /*var*/,
-                              const double /*data_time*/,
-                              const bool /*initial_time*/)
-{
-    double det;
-    for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator i(level); i; i++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(i());
-            const Box<NDIM>& box = patch->getBox();
-            Pointer<CellData<NDIM, double> > data = patch->getPatchData(data_idx);
-            for (CellIterator<NDIM> it(box); it; it++)
-            {
-                CellIndex<NDIM> i = *it;
-#if (NDIM == 2)
-                det = (*data)(i, 0) * (*data)(i, 1) - (*data)(i, 2) * (*data)(i, 2);
+        const int num_patches = static_cast<int>(W_data.size());
+        bool positive_def = d_positive_def;
+        double max_det = d_max_det, min_det = d_min_det;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) reduction(&& : positive_def) reduction(max : max_det) \
+    reduction(min : min_det)
 #endif
-#if (NDIM == 3)
-                det = (*data)(i, 0) * (*data)(i, 1) * (*data)(i, 2) - (*data)(i, 0) * (*data)(i, 3) * (*data)(i, 3) -
-                      (*data)(i, 1) * (*data)(i, 4) * (*data)(i, 4) +
-                      2.0 * (*data)(i, 3) * (*data)(i, 4) * (*data)(i, 5) -
-                      (*data)(i, 2) * (*data)(i, 5) * (*data)(i, 5);
-#endif
-                d_max_det = det > d_max_det ? det : d_max_det;
-                d_min_det = det < d_min_det ? det : d_min_det;
-            }
-        }
-    }
-    return;
-} // findDeterminant
-
-void
-CFINSForcing::exponentiateMatrix(const int data_idx,
-                                 const Pointer<Variable<NDIM> > /*var*/,
-                                 const Pointer<PatchHierarchy<NDIM> > hierarchy,
-                                 const double /*data_time*/,
-                                 const bool /*initial_time*/,
-                                 const int coarsest_ln,
-                                 const int finest_ln,
-                                 const bool extended_box)
-{
-    for (int ln = coarsest_ln; ln <= finest_ln; ln++)
-    {
-        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        for (int k = 0; k < num_patches; ++k)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            Pointer<CellData<NDIM, double> > data = patch->getPatchData(data_idx);
-            const Box<NDIM>& box = extended_box ? data->getGhostBox() : patch->getBox();
+            CellData<NDIM, double>& data = *W_data[k];
+            const Box<NDIM>& patch_box = patch_boxes[k];
+            const Box<NDIM>& box = convert ? data.getGhostBox() : patch_box;
+            Eigen::SelfAdjointEigenSolver<MatrixNd> eigs;
             for (CellIterator<NDIM> it(box); it; it++)
             {
-                CellIndex<NDIM> i = *it;
+                const CellIndex<NDIM>& i = *it;
+                const bool interior = patch_box.contains(i);
+                if (!convert && !interior) continue;
                 MatrixNd tens;
-                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
+                for (int d = 0; d < NVOIGT; ++d)
                 {
-                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
-                    tens(idx.first, idx.second) = tens(idx.second, idx.first) = (*data)(i, k);
+                    const std::pair<int, int>& idx = voigt_to_tensor_idx(d);
+                    tens(idx.first, idx.second) = tens(idx.second, idx.first) = data(i, d);
                 }
-                tens = tens.exp();
-                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
+
+                // A single closed-form eigendecomposition of the evolved quantity provides the conformation tensor
+                // as well as its eigenvalues, which determine its definiteness and its determinant.
+                eigs.computeDirect(tens);
+                VectorNd eig_vals = eigs.eigenvalues();
+                if (convert)
                 {
-                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
-                    (*data)(i, k) = tens(idx.first, idx.second);
+                    for (int d = 0; d < NDIM; ++d)
+                    {
+                        switch (d_evolve_type)
+                        {
+                        case SQUARE_ROOT:
+                            eig_vals(d) = eig_vals(d) * eig_vals(d);
+                            break;
+                        case LOGARITHM:
+                            eig_vals(d) = std::exp(eig_vals(d));
+                            break;
+                        default:
+                            eig_vals(d) = std::max(eig_vals(d), 0.0);
+                            break;
+                        }
+                    }
+                    const MatrixNd& eig_vecs = eigs.eigenvectors();
+                    tens = eig_vecs * eig_vals.asDiagonal() * eig_vecs.transpose();
+                    for (int d = 0; d < NVOIGT; ++d)
+                    {
+                        const std::pair<int, int>& idx = voigt_to_tensor_idx(d);
+                        data(i, d) = tens(idx.first, idx.second);
+                    }
+                }
+                if (!interior) continue;
+                if (check_spd && !(eig_vals.minCoeff() > 0.0)) positive_def = false;
+                if (find_det)
+                {
+                    const double det = eig_vals.prod();
+                    max_det = std::max(max_det, det);
+                    min_det = std::min(min_det, det);
                 }
             }
         }
+        d_positive_def = positive_def;
+        d_max_det = max_det;
+        d_min_det = min_det;
     }
     return;
-} // exponentiateMatrix
+} // convertAndCheckConformationTensor
+
 
 void
 CFINSForcing::projectTensor(const int data_idx,
@@ -949,4 +912,26 @@ CFINSForcing::apply_project_tensor_callback(const double current_time,
     object->projectTensor(Q_idx, object->getVariable(), current_time, false /*initial_time*/, false /*extended_box*/);
     return;
 } // apply_project_tensor_callback
+
+void
+CFINSForcing::apply_relaxation_callback(const double current_time,
+                                        const double new_time,
+                                        const bool /*skip_synchronize_new_state_data*/,
+                                        const int /*num_cycles*/,
+                                        void* ctx)
+{
+    auto object = static_cast<CFINSForcing*>(ctx);
+    if (!object->d_relax_oper)
+    {
+        TBOX_ERROR(object->d_object_name << "::apply_relaxation_callback():\n"
+                                         << "  A relaxation operator must be registered to split the relaxation."
+                                         << std::endl);
+    }
+    auto var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<AdvDiffSemiImplicitHierarchyIntegrator> adv_diff_integrator = object->getAdvDiffHierarchyIntegrator();
+    const int Q_idx = var_db->mapVariableAndContextToIndex(object->getVariable(), adv_diff_integrator->getNewContext());
+    object->d_relax_oper->relaxOnPatchHierarchy(
+        Q_idx, adv_diff_integrator->getPatchHierarchy(), new_time - current_time);
+    return;
+} // apply_relaxation_callback
 } // namespace IBAMR
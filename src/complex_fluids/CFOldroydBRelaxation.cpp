@@ -20,6 +20,8 @@
 #include "Patch.h"
 #include "tbox/Database.h"
 
+#include <cmath>
+
 #include "ibamr/app_namespaces.h" // IWYU pragma: keep
 
 namespace SAMRAI
@@ -96,4 +98,12 @@ CFOldroydBRelaxation::setDataOnPatch(const int data_idx,
     }
 } // setDataOnPatch
 
+void
+CFOldroydBRelaxation::relaxEigenvalues(VectorNd& eig_vals, const double dt)
+{
+    const double decay = std::exp(-dt / d_lambda);
+    for (int d = 0; d < NDIM; ++d) eig_vals(d) = 1.0 + (eig_vals(d) - 1.0) * decay;
+    return;
+} // relaxEigenvalues
+
 } // namespace IBAMR
@@ -15,12 +15,22 @@
 
 #include "ibtk/ibtk_utilities.h"
 
+#include "CellData.h"
+#include "CellIndex.h"
+#include "CellIterator.h"
+#include "Patch.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "tbox/Utilities.h"
 
 IBTK_DISABLE_EXTRA_WARNINGS
-#include <unsupported/Eigen/MatrixFunctions>
+#include <Eigen/Eigenvalues>
 IBTK_ENABLE_EXTRA_WARNINGS
 
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
 #include "ibamr/app_namespaces.h" // IWYU pragma: keep
 
 // Namespace
@@ -52,6 +62,92 @@ CFRelaxationOperator::isTimeDependent() const
     return true;
 } // isTimeDependent
 
+void
+CFRelaxationOperator::relaxOnPatchHierarchy(const int data_idx,
+                                            Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                            const double dt,
+                                            const int coarsest_ln_in,
+                                            const int finest_ln_in)
+{
+    const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
+    const int finest_ln = (finest_ln_in == -1 ? hierarchy->getFinestLevelNumber() : finest_ln_in);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > data = patch->getPatchData(data_idx);
+            for (CellIterator<NDIM> it(patch->getBox()); it; it++)
+            {
+                const CellIndex<NDIM>& i = it();
+                MatrixNd mat;
+                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
+                {
+                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
+                    mat(idx.first, idx.second) = mat(idx.second, idx.first) = (*data)(i, k);
+                }
+
+                // The square root and the logarithm of the conformation tensor
+                // have the same eigenvectors as the conformation tensor, so the
+                // conversions are done on the eigenvalues.
+                Eigen::SelfAdjointEigenSolver<MatrixNd> eigs;
+                eigs.computeDirect(mat);
+                const VectorNd& vals = eigs.eigenvalues();
+                VectorNd conform_vals;
+                switch (d_evolve_type)
+                {
+                case SQUARE_ROOT:
+                    conform_vals = vals.array().square();
+                    break;
+                case LOGARITHM:
+                    conform_vals = vals.array().exp();
+                    break;
+                case STANDARD:
+                    conform_vals = vals;
+                    break;
+                default:
+                    TBOX_ERROR(d_object_name << "::relaxOnPatchHierarchy():\n"
+                                             << "  Unknown tensor evolution type." << std::endl);
+                }
+                relaxEigenvalues(conform_vals, dt);
+                VectorNd new_vals;
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    switch (d_evolve_type)
+                    {
+                    case SQUARE_ROOT:
+                        new_vals(d) = std::copysign(std::sqrt(std::max(conform_vals(d), 0.0)), vals(d));
+                        break;
+                    case LOGARITHM:
+                        new_vals(d) = std::log(conform_vals(d));
+                        break;
+                    default:
+                        new_vals(d) = conform_vals(d);
+                    }
+                }
+                mat = eigs.eigenvectors() * new_vals.asDiagonal() * eigs.eigenvectors().transpose();
+                for (int k = 0; k < NDIM * (NDIM + 1) / 2; ++k)
+                {
+                    const std::pair<int, int>& idx = voigt_to_tensor_idx(k);
+                    (*data)(i, k) = mat(idx.first, idx.second);
+                }
+            }
+        }
+    }
+    return;
+} // relaxOnPatchHierarchy
+
+void
+CFRelaxationOperator::relaxEigenvalues(VectorNd& /*eig_vals*/, const double /*dt*/)
+{
+    TBOX_ERROR(d_object_name << "::relaxEigenvalues():\n"
+                             << "  This relaxation operator cannot be split from the transport of the conformation "
+                                "tensor.\n"
+                             << "  Implement relaxEigenvalues() or set split_relaxation to FALSE." << std::endl);
+    return;
+} // relaxEigenvalues
+
 MatrixNd
 CFRelaxationOperator::convertToConformation(const MatrixNd& mat)
 {
@@ -60,7 +156,14 @@ CFRelaxationOperator::convertToConformation(const MatrixNd& mat)
     case SQUARE_ROOT:
         return mat * mat;
     case LOGARITHM:
-        return mat.exp();
+    {
+        // The matrix is symmetric, so its exponential is obtained from a closed-form eigendecomposition, which is far
+        // cheaper than the general-purpose Pade approximation.
+        Eigen::SelfAdjointEigenSolver<MatrixNd> eigs;
+        eigs.computeDirect(mat);
+        const VectorNd exp_eig_vals = eigs.eigenvalues().array().exp();
+        return eigs.eigenvectors() * exp_eig_vals.asDiagonal() * eigs.eigenvectors().transpose();
+    }
     case STANDARD:
         return mat;
     case UNKNOWN_TENSOR_EVOLUTION_TYPE:
@@ -128,4 +128,27 @@ CFRoliePolyRelaxation::setDataOnPatch(const int data_idx,
     }
 } // setDataOnPatch
 
+void
+CFRoliePolyRelaxation::relaxEigenvalues(VectorNd& eig_vals, const double dt)
+{
+    // Write the relaxation equation for each eigenvalue c as dc/dt = nu - mu c.
+    // The first pass freezes mu and nu at the initial trace, and the second
+    // pass freezes them at the average of the initial and predicted traces.
+    static const double n = static_cast<double>(NDIM);
+    const VectorNd eig_vals_old = eig_vals;
+    double tr = eig_vals_old.sum();
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        const double k = 2.0 * (1.0 - sqrt(n / tr)) / d_lambda_R;
+        const double b = d_beta * pow(tr / n, d_delta);
+        const double mu = 1.0 / d_lambda_d + k * (1.0 + b);
+        const double nu = 1.0 / d_lambda_d + k * b;
+        const double z = mu * dt;
+        const double phi = std::abs(z) > 1.0e-8 ? -std::expm1(-z) / z : 1.0;
+        for (int d = 0; d < NDIM; ++d) eig_vals(d) = eig_vals_old(d) + dt * phi * (nu - mu * eig_vals_old(d));
+        tr = 0.5 * (eig_vals_old.sum() + eig_vals.sum());
+    }
+    return;
+} // relaxEigenvalues
+
 } // namespace IBAMR
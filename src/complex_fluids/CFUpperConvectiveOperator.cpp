@@ -261,8 +261,24 @@ CFUpperConvectiveOperator::applyConvectiveOperator(int Q_idx, int Y_idx)
 
     d_convec_oper->applyConvectiveOperator(Q_idx, d_Q_convec_idx);
 
-    d_s_fcn->setPatchDataIndex(Q_idx);
-    d_s_fcn->setDataOnPatchHierarchy(d_s_idx, d_Q_var, d_hierarchy, d_solution_time, false, d_coarsest_ln, d_finest_ln);
+    if (d_split_s_fcn)
+    {
+        for (int level_num = d_coarsest_ln; level_num <= d_finest_ln; ++level_num)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<CellData<NDIM, double> > S_data = level->getPatch(p())->getPatchData(d_s_idx);
+                S_data->fillAll(0.0);
+            }
+        }
+    }
+    else
+    {
+        d_s_fcn->setPatchDataIndex(Q_idx);
+        d_s_fcn->setDataOnPatchHierarchy(
+            d_s_idx, d_Q_var, d_hierarchy, d_solution_time, false, d_coarsest_ln, d_finest_ln);
+    }
 
     for (int level_num = d_coarsest_ln; level_num <= d_finest_ln; ++level_num)
     {
@@ -474,4 +490,11 @@ CFUpperConvectiveOperator::registerSourceFunction(Pointer<CFRelaxationOperator>
     d_s_fcn = source_fcn;
 }
 
+void
+CFUpperConvectiveOperator::setSourceFunctionIsSplit(const bool split_source_fcn)
+{
+    d_split_s_fcn = split_source_fcn;
+    return;
+} // setSourceFunctionIsSplit
+
 } // namespace IBAMR
@@ -57,9 +57,11 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <limits>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <set>
 #include <string>
@@ -116,6 +118,137 @@ make_edge(T2 n0, T2 n1)
     T1 e0(n1(0) - n0(0), n1(1) - n0(1), n1(2) - n0(2));
     return (e0);
 } // make_edge
+
+// Axis-aligned bounding box tree over a collection of surface elements, which
+// is used to find the elements whose bounding boxes overlap a given box without
+// testing every element.
+class ElemBoxTree
+{
+public:
+    explicit ElemBoxTree(const std::vector<Elem*>& elems)
+        : d_elems(elems), d_elem_bl(elems.size()), d_elem_tr(elems.size()), d_order(elems.size())
+    {
+        for (std::size_t k = 0; k < d_elems.size(); ++k)
+        {
+            const Elem* const elem = d_elems[k];
+            d_elem_bl[k].setConstant(std::numeric_limits<double>::max());
+            d_elem_tr[k].setConstant(std::numeric_limits<double>::lowest());
+            for (unsigned int n = 0; n < elem->n_nodes(); ++n)
+            {
+                const libMesh::Point& X = elem->point(n);
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    d_elem_bl[k][d] = std::min(d_elem_bl[k][d], X(d));
+                    d_elem_tr[k][d] = std::max(d_elem_tr[k][d], X(d));
+                }
+            }
+        }
+        std::iota(d_order.begin(), d_order.end(), 0);
+        if (!d_elems.empty()) build(0, static_cast<int>(d_elems.size()));
+        return;
+    } // ElemBoxTree
+
+    // Call f for each element whose bounding box overlaps the box [bl, tr].
+    template <class F>
+    void forEachOverlappingElem(const IBTK::Vector3d& bl, const IBTK::Vector3d& tr, F f) const
+    {
+        if (d_nodes.empty()) return;
+        std::vector<int> stack(1, 0);
+        while (!stack.empty())
+        {
+            const Node& node = d_nodes[stack.back()];
+            stack.pop_back();
+            if (!overlaps(node.bl, node.tr, bl, tr)) continue;
+            if (node.left < 0)
+            {
+                for (int i = node.begin; i < node.end; ++i)
+                {
+                    const int k = d_order[i];
+                    if (overlaps(d_elem_bl[k], d_elem_tr[k], bl, tr)) f(d_elems[k]);
+                }
+            }
+            else
+            {
+                stack.push_back(node.left);
+                stack.push_back(node.right);
+            }
+        }
+        return;
+    } // forEachOverlappingElem
+
+private:
+    struct Node
+    {
+        IBTK::Vector3d bl, tr;
+        int begin, end, left, right;
+    };
+
+    static const int LEAF_SIZE = 4;
+
+    static bool overlaps(const IBTK::Vector3d& bl0,
+                         const IBTK::Vector3d& tr0,
+                         const IBTK::Vector3d& bl1,
+                         const IBTK::Vector3d& tr1)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            if (tr0[d] < bl1[d] || tr1[d] < bl0[d]) return false;
+        }
+        return true;
+    } // overlaps
+
+    // Build the subtree for the elements d_order[begin], ..., d_order[end-1],
+    // splitting at the median of the element centers along the longest axis.
+    int build(const int begin, const int end)
+    {
+        const int node_idx = static_cast<int>(d_nodes.size());
+        d_nodes.push_back(Node());
+        IBTK::Vector3d bl, tr;
+        bl.setConstant(std::numeric_limits<double>::max());
+        tr.setConstant(std::numeric_limits<double>::lowest());
+        for (int i = begin; i < end; ++i)
+        {
+            const int k = d_order[i];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                bl[d] = std::min(bl[d], d_elem_bl[k][d]);
+                tr[d] = std::max(tr[d], d_elem_tr[k][d]);
+            }
+        }
+        int left = -1, right = -1;
+        if (end - begin > LEAF_SIZE)
+        {
+            unsigned int axis = 0;
+            for (unsigned int d = 1; d < NDIM; ++d)
+            {
+                if (tr[d] - bl[d] > tr[axis] - bl[axis]) axis = d;
+            }
+            const int mid = begin + (end - begin) / 2;
+            std::nth_element(d_order.begin() + begin,
+                             d_order.begin() + mid,
+                             d_order.begin() + end,
+                             [this, axis](const int k0, const int k1) {
+                                 return d_elem_bl[k0][axis] + d_elem_tr[k0][axis] <
+                                        d_elem_bl[k1][axis] + d_elem_tr[k1][axis];
+                             });
+            left = build(begin, mid);
+            right = build(mid, end);
+        }
+        Node& node = d_nodes[node_idx];
+        node.bl = bl;
+        node.tr = tr;
+        node.begin = begin;
+        node.end = end;
+        node.left = left;
+        node.right = right;
+        return node_idx;
+    } // build
+
+    const std::vector<Elem*>& d_elems;
+    std::vector<IBTK::Vector3d> d_elem_bl, d_elem_tr;
+    std::vector<int> d_order;
+    std::vector<Node> d_nodes;
+};
 } // namespace
 
 const double FESurfaceDistanceEvaluator::s_large_distance = 1234567.0;
@@ -269,6 +402,10 @@ FESurfaceDistanceEvaluator::mapIntersections()
         // computations.
         if (!patch_box.intersects(struct_box)) continue;
 
+        // Sort the elements of the patch into a bounding box tree so that only
+        // the elements near each cell are tested for intersections.
+        const ElemBoxTree elem_tree(patch_elems);
+
         // Loop over cells
         for (Box<NDIM>::Iterator it(patch_box); it; it++)
         {
@@ -311,9 +448,9 @@ FESurfaceDistanceEvaluator::mapIntersections()
             }
 #endif
 
-            // Loop over elements in the patch.
-            for (const auto& elem : patch_elems)
-            {
+            // Loop over elements in the patch whose bounding boxes overlap the
+            // grown cell.
+            elem_tree.forEachOverlappingElem(r_bl, r_tr, [&](Elem* const elem) {
                 // Get the coordinates of the nodes.
                 const libMesh::Point& n0 = elem->point(0);
                 const libMesh::Point& n1 = elem->point(1);
@@ -339,7 +476,7 @@ FESurfaceDistanceEvaluator::mapIntersections()
                 {
                     d_cell_elem_neighbor_map[ci].insert(elem);
                 }
-            }
+            });
         }
     }
 
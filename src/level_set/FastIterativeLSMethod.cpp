@@ -0,0 +1,398 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibamr/FastIterativeLSMethod.h"
+#include "ibamr/LSInitStrategy.h"
+#include "ibamr/ibamr_enums.h"
+
+#include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/HierarchyMathOps.h"
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/ibtk_utilities.h"
+
+#include "Box.h"
+#include "BoxArray.h"
+#include "CartesianPatchGeometry.h"
+#include "CellData.h"
+#include "CellVariable.h"
+#include "HierarchyCellDataOpsReal.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "Variable.h"
+#include "VariableContext.h"
+#include "VariableDatabase.h"
+#include "tbox/Array.h"
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ibamr/namespaces.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBAMR
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Solve the first-order upwind discretization of |grad u| = 1 for u, given the
+// upwind values a and the grid spacings h in each coordinate direction.
+inline double
+solve_eikonal(const double* const a, const double* const h)
+{
+    int perm[NDIM];
+    for (unsigned int d = 0; d < NDIM; ++d) perm[d] = d;
+    std::sort(perm, perm + NDIM, [a](const int d1, const int d2) { return a[d1] < a[d2]; });
+
+    // Include the upwind values in increasing order for as long as they are
+    // smaller than the solution.
+    double u = a[perm[0]] + h[perm[0]];
+    double sum_w = 0.0, sum_wa = 0.0, sum_waa = 0.0;
+    for (unsigned int k = 0; k < NDIM; ++k)
+    {
+        const int d = perm[k];
+        if (k > 0 && u <= a[d]) break;
+        const double w = 1.0 / (h[d] * h[d]);
+        sum_w += w;
+        sum_wa += w * a[d];
+        sum_waa += w * a[d] * a[d];
+        const double disc = sum_wa * sum_wa - sum_w * (sum_waa - 1.0);
+        u = (sum_wa + std::sqrt(std::max(disc, 0.0))) / sum_w;
+    }
+    return u;
+} // solve_eikonal
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+FastIterativeLSMethod::FastIterativeLSMethod(std::string object_name, Pointer<Database> db, bool register_for_restart)
+    : LSInitStrategy(std::move(object_name), register_for_restart)
+{
+    for (int& wall_idx : d_wall_location_idx) wall_idx = 0;
+
+    if (d_registered_for_restart) getFromRestart();
+    if (!db.isNull()) getFromInput(db);
+
+    return;
+} // FastIterativeLSMethod
+
+void
+FastIterativeLSMethod::initializeLSData(int D_idx,
+                                        Pointer<HierarchyMathOps> hier_math_ops,
+                                        int integrator_step,
+                                        double time,
+                                        bool initial_time)
+{
+    bool initialize_ls =
+        d_reinitialize_ls || initial_time || (d_reinit_interval && integrator_step % d_reinit_interval == 0);
+    if (!initialize_ls) return;
+
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<Variable<NDIM> > data_var;
+    var_db->mapIndexToVariable(D_idx, data_var);
+    Pointer<CellVariable<NDIM, double> > D_var = data_var;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!D_var.isNull());
+#endif
+
+    Pointer<PatchHierarchy<NDIM> > hierarchy = hier_math_ops->getPatchHierarchy();
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+
+    // Create a temporary variable with appropriate ghost cell width since it is
+    // not guaranteed that D_idx will have proper ghost cell width.
+    IntVector<NDIM> cell_ghosts;
+    if (d_ls_order == FIRST_ORDER_LS)
+    {
+        cell_ghosts = 1;
+    }
+    else
+    {
+        TBOX_ERROR("FastIterativeLSMethod does not support " << enum_to_string(d_ls_order) << std::endl);
+    }
+    const int D_scratch_idx =
+        var_db->registerVariableAndContext(D_var, var_db->getContext(d_object_name + "::SCRATCH"), cell_ghosts);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        hierarchy->getPatchLevel(ln)->allocatePatchData(D_scratch_idx, time);
+    }
+
+    // First, fill cells with some large positive/negative values
+    // away from the interface and actual distance value near the interface.
+    for (unsigned k = 0; k < d_locate_interface_fcns.size(); ++k)
+    {
+        (*d_locate_interface_fcns[k])(D_scratch_idx, hier_math_ops, time, initial_time, d_locate_interface_fcns_ctx[k]);
+    }
+
+    // Set hierarchy objects.
+    using InterpolationTransactionComponent = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
+    InterpolationTransactionComponent D_transaction(
+        D_scratch_idx, "LINEAR_REFINE", true, "NONE", "LINEAR", false, d_bc_coef);
+    Pointer<HierarchyGhostCellInterpolation> fill_op = new HierarchyGhostCellInterpolation();
+    fill_op->initializeOperatorState(D_transaction, hierarchy);
+    HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(hierarchy, coarsest_ln, finest_ln);
+
+    // Only reinitialize the cells near the interface.
+    if (d_narrow_band_width > 0)
+    {
+        fill_op->fillData(time);
+        computeNarrowBand(D_scratch_idx, hierarchy, time);
+        clampNarrowBandFarField(D_scratch_idx, hierarchy);
+    }
+
+    // Carry out communication rounds. In each round, every patch is solved to
+    // convergence for its current ghost cell values.
+    double max_change = 1.0e12;
+    int outer_iter = 0;
+    while (max_change > d_abs_tol && outer_iter < d_max_its)
+    {
+        fill_op->fillData(time);
+
+        max_change = 0.0;
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            const BoxArray<NDIM>& domain_boxes = level->getPhysicalDomain();
+#if !defined(NDEBUG)
+            TBOX_ASSERT(domain_boxes.size() == 1);
+#endif
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                if (!patchIntersectsNarrowBand(ln, p())) continue;
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(D_scratch_idx);
+                max_change = std::max(max_change,
+                                      iteratePatch(dist_data, patch, domain_boxes[0], /*seed_all*/ outer_iter == 0));
+            }
+        }
+        clampNarrowBandFarField(D_scratch_idx, hierarchy);
+        max_change = IBTK_MPI::maxReduction(max_change);
+
+        outer_iter += 1;
+
+        if (d_enable_logging)
+        {
+            plog << d_object_name << "::initializeLSData(): After communication round # " << outer_iter << std::endl;
+            plog << d_object_name << "::initializeLSData(): Maximum change = " << max_change << std::endl;
+        }
+
+        if (max_change <= d_abs_tol && d_enable_logging)
+        {
+            plog << d_object_name << "::initializeLSData(): Fast iterative method converged for entire domain"
+                 << std::endl;
+        }
+    }
+
+    if (outer_iter >= d_max_its && max_change > d_abs_tol)
+    {
+        if (d_enable_logging)
+        {
+            plog << d_object_name << "::initializeLSData(): Reached maximum allowable communication rounds"
+                 << std::endl;
+            plog << d_object_name << "::initializeLSData(): Maximum change = " << max_change << std::endl;
+        }
+    }
+
+    // Copy signed distance into supplied patch data index
+    hier_cc_data_ops.copyData(D_idx, D_scratch_idx);
+
+    // Deallocate the temporary variable.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        hierarchy->getPatchLevel(ln)->deallocatePatchData(D_scratch_idx);
+    }
+    var_db->removePatchDataIndex(D_scratch_idx);
+
+    // Indicate that the LS has been initialized.
+    d_narrow_band_idxs.clear();
+    d_reinitialize_ls = false;
+
+    return;
+} // initializeLSData
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+double
+FastIterativeLSMethod::iteratePatch(Pointer<CellData<NDIM, double> > dist_data,
+                                    const Pointer<Patch<NDIM> > patch,
+                                    const Box<NDIM>& domain_box,
+                                    const bool seed_all) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(dist_data->getDepth() == 1);
+    TBOX_ASSERT(dist_data->getGhostCellWidth().min() >= 1);
+#endif
+    double* const D = dist_data->getPointer(0);
+    const Box<NDIM>& patch_box = patch->getBox();
+    const Box<NDIM>& ghost_box = dist_data->getGhostBox();
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+
+    // Determine the sides of the patch that are physical domain walls.
+    bool wall_lower[NDIM], wall_upper[NDIM];
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        wall_lower[axis] = d_consider_phys_bdry_wall && pgeom->getTouchesRegularBoundary(axis, 0) &&
+                           d_wall_location_idx[2 * axis];
+        wall_upper[axis] = d_consider_phys_bdry_wall && pgeom->getTouchesRegularBoundary(axis, 1) &&
+                           d_wall_location_idx[2 * axis + 1];
+    }
+
+    // Set up the array strides and flag the interior cells.
+    int stride[NDIM], num_cells[NDIM];
+    int n = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        stride[d] = n;
+        num_cells[d] = ghost_box.numberCells(d);
+        n *= num_cells[d];
+    }
+    std::vector<char> is_interior(n, 0), in_list(n, 0);
+    for (Box<NDIM>::Iterator b(patch_box); b; b++) is_interior[IBTK::array_offset(ghost_box, b())] = 1;
+
+    // Compute the upwind update of the cell with offset k. As in the fast
+    // sweeping method, the distance vanishes at physical domain walls, which
+    // are half of a grid cell away from the adjacent cell centers.
+    auto compute_update = [&](const int k) {
+        const double u = D[k];
+        if (u == 0.0) return 0.0;
+        const double sgn = u > 0.0 ? 1.0 : -1.0;
+        double a[NDIM], h[NDIM];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            a[d] = std::min(sgn * D[k - stride[d]], sgn * D[k + stride[d]]);
+            h[d] = dx[d];
+            const int i_d = ghost_box.lower(d) + (k / stride[d]) % num_cells[d];
+            if ((wall_lower[d] && i_d == domain_box.lower(d)) || (wall_upper[d] && i_d == domain_box.upper(d)))
+            {
+                a[d] = 0.0;
+                h[d] = 0.5 * dx[d];
+            }
+        }
+        return sgn * std::min(sgn * u, solve_eikonal(a, h));
+    };
+
+    std::vector<int> active, next;
+    double max_change = 0.0;
+    auto try_activate = [&](const int k) {
+        const double u_new = compute_update(k);
+        const double change = std::abs(u_new - D[k]);
+        if (change <= d_abs_tol) return;
+        D[k] = u_new;
+        max_change = std::max(max_change, change);
+        in_list[k] = 1;
+        next.push_back(k);
+    };
+
+    // Seed the active list either with all interior cells or with the cells
+    // whose neighbors include ghost cells.
+    for (Box<NDIM>::Iterator b(patch_box); b; b++)
+    {
+        const hier::Index<NDIM>& i = b();
+        bool seed = seed_all;
+        for (unsigned int d = 0; d < NDIM && !seed; ++d)
+        {
+            seed = i(d) == patch_box.lower(d) || i(d) == patch_box.upper(d);
+        }
+        if (seed) try_activate(static_cast<int>(IBTK::array_offset(ghost_box, i)));
+    }
+    active.swap(next);
+
+    // Update the active cells until they converge, and activate the neighbors
+    // of converged cells that can be improved.
+    while (!active.empty())
+    {
+        next.clear();
+        for (const int k : active)
+        {
+            const double u_new = compute_update(k);
+            const double change = std::abs(u_new - D[k]);
+            D[k] = u_new;
+            max_change = std::max(max_change, change);
+            if (change > d_abs_tol)
+            {
+                next.push_back(k);
+                continue;
+            }
+            in_list[k] = 0;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                for (int shift = -stride[d]; shift <= stride[d]; shift += 2 * stride[d])
+                {
+                    const int k_nbr = k + shift;
+                    if (is_interior[k_nbr] && !in_list[k_nbr]) try_activate(k_nbr);
+                }
+            }
+        }
+        active.swap(next);
+    }
+    return max_change;
+} // iteratePatch
+
+void
+FastIterativeLSMethod::getFromInput(Pointer<Database> input_db)
+{
+    std::string ls_order = "FIRST_ORDER";
+    ls_order = input_db->getStringWithDefault("order", ls_order);
+    d_ls_order = string_to_enum<LevelSetOrder>(ls_order);
+
+    d_max_its = input_db->getIntegerWithDefault("max_iterations", d_max_its);
+    d_max_its = input_db->getIntegerWithDefault("max_its", d_max_its);
+
+    d_abs_tol = input_db->getDoubleWithDefault("abs_tol", d_abs_tol);
+
+    d_enable_logging = input_db->getBoolWithDefault("enable_logging", d_enable_logging);
+
+    d_reinit_interval = input_db->getIntegerWithDefault("reinit_interval", d_reinit_interval);
+
+    d_narrow_band_width = input_db->getIntegerWithDefault("narrow_band_width", d_narrow_band_width);
+
+    d_consider_phys_bdry_wall = input_db->getBoolWithDefault("physical_bdry_wall", d_consider_phys_bdry_wall);
+    Array<int> wall_loc_idices;
+    if (input_db->keyExists("physical_bdry_wall_loc_idx"))
+    {
+        input_db->getArray("physical_bdry_wall_loc_idx", wall_loc_idices);
+    }
+    for (int k = 0; k < wall_loc_idices.size(); ++k)
+    {
+        d_wall_location_idx[wall_loc_idices[k]] = 1;
+    }
+
+    return;
+} // getFromInput
+
+void
+FastIterativeLSMethod::getFromRestart()
+{
+    // intentionally left-blank.
+    return;
+} // getFromRestart
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
@@ -166,12 +166,21 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
     int outer_iter = 0;
     const int cc_wgt_idx = hier_math_ops->getCellWeightPatchDescriptorIndex();
 
+    // Only reinitialize the cells near the interface.
+    if (d_narrow_band_width > 0)
+    {
+        fill_op->fillData(time);
+        computeNarrowBand(D_scratch_idx, hierarchy, time);
+        clampNarrowBandFarField(D_scratch_idx, hierarchy);
+    }
+
     while (diff_L2_norm > d_abs_tol && outer_iter < d_max_its)
     {
         hier_cc_data_ops.copyData(D_iter_idx, D_scratch_idx);
         fill_op->fillData(time);
 
         fastSweep(hier_math_ops, D_scratch_idx);
+        clampNarrowBandFarField(D_scratch_idx, hierarchy);
 
         hier_cc_data_ops.axmy(D_iter_idx, 1.0, D_iter_idx, D_scratch_idx);
         diff_L2_norm = hier_cc_data_ops.L2Norm(D_iter_idx, cc_wgt_idx);
@@ -217,6 +226,7 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
     var_db->removePatchDataIndex(D_iter_idx);
 
     // Indicate that the LS has been initialized.
+    d_narrow_band_idxs.clear();
     d_reinitialize_ls = false;
 
     return;
@@ -241,6 +251,7 @@ FastSweepingLSMethod::fastSweep(Pointer<HierarchyMathOps> hier_math_ops, int dis
 
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
+            if (!patchIntersectsNarrowBand(ln, p())) continue;
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
             fastSweep(dist_data, patch, domain_boxes[0]);
@@ -331,6 +342,8 @@ FastSweepingLSMethod::getFromInput(Pointer<Database> input_db)
 
     d_reinit_interval = input_db->getIntegerWithDefault("reinit_interval", d_reinit_interval);
 
+    d_narrow_band_width = input_db->getIntegerWithDefault("narrow_band_width", d_narrow_band_width);
+
     d_consider_phys_bdry_wall = input_db->getBoolWithDefault("physical_bdry_wall", d_consider_phys_bdry_wall);
     Array<int> wall_loc_idices;
     if (input_db->keyExists("physical_bdry_wall_loc_idx"))
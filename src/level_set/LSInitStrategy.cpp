@@ -15,9 +15,27 @@
 
 #include "ibamr/LSInitStrategy.h"
 
+#include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/IBTK_MPI.h"
+#include "ibtk/ibtk_utilities.h"
+
+#include "Box.h"
+#include "CartesianPatchGeometry.h"
+#include "CellData.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "Variable.h"
+#include "VariableDatabase.h"
 #include "tbox/Database.h"
+#include "tbox/PIO.h"
 #include "tbox/RestartManager.h"
+#include "tbox/Utilities.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <utility>
 
 #include "ibamr/namespaces.h"
@@ -80,6 +98,172 @@ void LSInitStrategy::putToDatabase(Pointer<Database> /*db*/)
     return;
 } // putToDatabase
 
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+void
+LSInitStrategy::computeNarrowBand(const int D_idx, Pointer<PatchHierarchy<NDIM> > hierarchy, const double time)
+{
+    d_narrow_band_idxs.clear();
+    if (d_narrow_band_width <= 0) return;
+
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    d_narrow_band_idxs.resize(finest_ln + 1);
+
+    // Mark the cells adjacent to a sign change of the level set function. The
+    // marker data have ghost cells of the band width so that the band can be
+    // determined from patch-local data.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<Variable<NDIM> > D_var;
+    var_db->mapIndexToVariable(D_idx, D_var);
+    const int mask_idx = var_db->registerVariableAndContext(
+        D_var, var_db->getContext(d_object_name + "::NARROW_BAND"), IntVector<NDIM>(d_narrow_band_width));
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        level->allocatePatchData(mask_idx, time);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CellData<NDIM, double> > D_data = patch->getPatchData(D_idx);
+            Pointer<CellData<NDIM, double> > mask_data = patch->getPatchData(mask_idx);
+#if !defined(NDEBUG)
+            TBOX_ASSERT(D_data->getGhostCellWidth().min() >= 1);
+#endif
+            mask_data->fillAll(0.0);
+            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            {
+                const CellIndex<NDIM>& i = b();
+                const double phi = (*D_data)(i);
+                bool at_interface = phi == 0.0;
+                for (unsigned int axis = 0; axis < NDIM && !at_interface; ++axis)
+                {
+                    for (int shift = -1; shift <= 1; shift += 2)
+                    {
+                        CellIndex<NDIM> i_nbr = i;
+                        i_nbr(axis) += shift;
+                        at_interface = at_interface || ((phi < 0.0) != ((*D_data)(i_nbr) < 0.0));
+                    }
+                }
+                if (at_interface) (*mask_data)(i) = 1.0;
+            }
+        }
+    }
+    using InterpolationTransactionComponent = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
+    InterpolationTransactionComponent mask_transaction(
+        mask_idx, "CONSTANT_REFINE", false, "NONE", "CONSTANT", false, nullptr);
+    HierarchyGhostCellInterpolation mask_fill_op;
+    mask_fill_op.initializeOperatorState(mask_transaction, hierarchy);
+    mask_fill_op.fillData(time);
+
+    // Dilate the marked cells by the band width along each coordinate direction
+    // and record the interior cells of the resulting band.
+    int num_band_cells = 0, num_cells = 0;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CellData<NDIM, double> > mask_data = patch->getPatchData(mask_idx);
+            const Box<NDIM>& ghost_box = mask_data->getGhostBox();
+            const double* const mask = mask_data->getPointer(0);
+            const int n = ghost_box.size();
+            std::vector<char> in_band(n), dilated(n);
+            for (int k = 0; k < n; ++k) in_band[k] = mask[k] > 0.5;
+            int stride = 1;
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                const int n_axis = ghost_box.numberCells(axis);
+                for (int k = 0; k < n; ++k)
+                {
+                    const int i_axis = (k / stride) % n_axis;
+                    const int j_lower = std::max(0, i_axis - d_narrow_band_width);
+                    const int j_upper = std::min(n_axis - 1, i_axis + d_narrow_band_width);
+                    char val = 0;
+                    for (int j = j_lower; j <= j_upper && !val; ++j) val = in_band[k + (j - i_axis) * stride];
+                    dilated[k] = val;
+                }
+                in_band.swap(dilated);
+                stride *= n_axis;
+            }
+            std::vector<CellIndex<NDIM> > band_idxs;
+            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            {
+                if (in_band[IBTK::array_offset(ghost_box, b())]) band_idxs.push_back(b());
+            }
+            num_band_cells += static_cast<int>(band_idxs.size());
+            num_cells += patch_box.size();
+            if (!band_idxs.empty()) d_narrow_band_idxs[ln][p()] = std::move(band_idxs);
+        }
+        level->deallocatePatchData(mask_idx);
+    }
+    var_db->removePatchDataIndex(mask_idx);
+
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::computeNarrowBand(): narrow band contains "
+             << IBTK_MPI::sumReduction(num_band_cells) << " of " << IBTK_MPI::sumReduction(num_cells) << " cells"
+             << std::endl;
+    }
+    return;
+} // computeNarrowBand
+
+bool
+LSInitStrategy::patchIntersectsNarrowBand(const int ln, const int patch_num) const
+{
+    if (d_narrow_band_width <= 0) return true;
+    if (ln >= static_cast<int>(d_narrow_band_idxs.size())) return false;
+    return d_narrow_band_idxs[ln].find(patch_num) != d_narrow_band_idxs[ln].end();
+} // patchIntersectsNarrowBand
+
+void
+LSInitStrategy::clampNarrowBandFarField(const int D_idx, Pointer<PatchHierarchy<NDIM> > hierarchy) const
+{
+    if (d_narrow_band_width <= 0) return;
+
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(finest_ln < static_cast<int>(d_narrow_band_idxs.size()));
+#endif
+    std::vector<double> band_vals;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const dx = pgeom->getDx();
+            const double band_dist = static_cast<double>(d_narrow_band_width) * (*std::min_element(dx, dx + NDIM));
+            Pointer<CellData<NDIM, double> > D_data = patch->getPatchData(D_idx);
+
+            // Save the values in the band, clamp all values, and restore the
+            // values in the band.
+            const auto it = d_narrow_band_idxs[ln].find(p());
+            band_vals.clear();
+            if (it != d_narrow_band_idxs[ln].end())
+            {
+                for (const auto& i : it->second) band_vals.push_back((*D_data)(i));
+            }
+            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            {
+                double& phi = (*D_data)(b());
+                phi = std::copysign(band_dist, phi);
+            }
+            if (it != d_narrow_band_idxs[ln].end())
+            {
+                for (std::size_t k = 0; k < it->second.size(); ++k) (*D_data)(it->second[k]) = band_vals[k];
+            }
+        }
+    }
+    return;
+} // clampNarrowBandFarField
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
@@ -359,6 +359,13 @@ RelaxationLSMethod::initializeLSData(int D_idx,
 
     // Copy initial condition, including ghost cells
     D_fill_op->fillData(time);
+    if (d_narrow_band_width > 0)
+    {
+        // Only reinitialize the cells near the interface.
+        computeNarrowBand(D_scratch_idx, hierarchy, time);
+        clampNarrowBandFarField(D_scratch_idx, hierarchy);
+        D_fill_op->fillData(time);
+    }
     hier_cc_data_ops.copyData(D_init_idx, D_scratch_idx, /*interior_only*/ false);
 
     // Compute the volume of the initial level set variable
@@ -385,6 +392,7 @@ RelaxationLSMethod::initializeLSData(int D_idx,
         hier_cc_data_ops.copyData(D_iter_idx, D_scratch_idx);
         D_fill_op->fillData(time);
         relax(hier_math_ops, D_scratch_idx, D_init_idx, outer_iter);
+        clampNarrowBandFarField(D_scratch_idx, hierarchy);
         hier_cc_data_ops.linearSum(D_scratch_idx, d_alpha, D_scratch_idx, 1.0 - d_alpha, D_iter_idx);
 
         if (d_apply_volume_shift)
@@ -479,6 +487,7 @@ RelaxationLSMethod::initializeLSData(int D_idx,
     }
 
     // Indicate that the LS has been initialized.
+    d_narrow_band_idxs.clear();
     d_reinitialize_ls = false;
 
     return;
@@ -536,6 +545,7 @@ RelaxationLSMethod::relax(Pointer<HierarchyMathOps> hier_math_ops,
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
+            if (!patchIntersectsNarrowBand(ln, p())) continue;
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
             const Pointer<CellData<NDIM, double> > dist_init_data = patch->getPatchData(dist_init_idx);
@@ -1002,6 +1012,8 @@ RelaxationLSMethod::getFromInput(Pointer<Database> input_db)
 
     d_reinit_interval = input_db->getIntegerWithDefault("reinit_interval", d_reinit_interval);
 
+    d_narrow_band_width = input_db->getIntegerWithDefault("narrow_band_width", d_narrow_band_width);
+
     d_enable_logging = input_db->getBoolWithDefault("enable_logging", d_enable_logging);
 
     d_apply_mass_constraint = input_db->getBoolWithDefault("apply_mass_constraint", d_apply_mass_constraint);
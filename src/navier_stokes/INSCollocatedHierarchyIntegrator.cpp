@@ -33,9 +33,11 @@
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/LinearSolver.h"
+#include "ibtk/PatchMathOps.h"
 #include "ibtk/PoissonSolver.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
+#include "ibtk/profiling_annotations.h"
 
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
@@ -63,6 +65,7 @@
 #include "MultiblockDataTranslator.h"
 #include "Patch.h"
 #include "PatchCellDataOpsReal.h"
+#include "PatchFaceDataOpsReal.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "PoissonSpecifications.h"
@@ -874,6 +877,7 @@ INSCollocatedHierarchyIntegrator::preprocessIntegrateHierarchy(const double curr
                                                                const double new_time,
                                                                const int num_cycles)
 {
+    IBTK_PROFILING_REGION("INSCollocatedHierarchyIntegrator::preprocessIntegrateHierarchy");
     INSHierarchyIntegrator::preprocessIntegrateHierarchy(current_time, new_time, num_cycles);
 
     const int coarsest_ln = 0;
@@ -896,8 +900,8 @@ INSCollocatedHierarchyIntegrator::preprocessIntegrateHierarchy(const double curr
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_scratch_data, current_time);
-        level->allocatePatchData(d_new_data, new_time);
+        allocateLevelPatchData(level, d_scratch_data, current_time);
+        allocateLevelPatchData(level, d_new_data, new_time);
     }
 
     // Setup the operators and solvers.
@@ -1055,6 +1059,7 @@ INSCollocatedHierarchyIntegrator::integrateHierarchy(const double current_time,
                                                      const double new_time,
                                                      const int cycle_num)
 {
+    IBTK_PROFILING_REGION("INSCollocatedHierarchyIntegrator::integrateHierarchy");
     INSHierarchyIntegrator::integrateHierarchy(current_time, new_time, cycle_num);
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
@@ -1306,15 +1311,8 @@ INSCollocatedHierarchyIntegrator::integrateHierarchy(const double current_time,
                           d_Phi_var,
                           d_Phi_bdry_bc_fill_op,
                           half_time);
-    d_hier_fc_data_ops->axpy(d_u_ADV_new_idx, -1.0 / div_fac, d_Grad_Phi_fc_idx, d_u_ADV_scratch_idx);
-    d_hier_math_ops->interp(d_Grad_Phi_cc_idx,
-                            d_Grad_Phi_cc_var,
-                            d_Grad_Phi_fc_idx,
-                            d_Grad_Phi_fc_var,
-                            d_no_fill_op,
-                            half_time,
-                            /*synch_cf_bdry*/ false);
-    d_hier_cc_data_ops->axpy(d_U_new_idx, -1.0 / div_fac, d_Grad_Phi_cc_idx, d_U_scratch_idx);
+    applyProjectionGradientCorrection(
+        -1.0 / div_fac, d_u_ADV_new_idx, d_u_ADV_scratch_idx, d_U_new_idx, d_U_scratch_idx);
 
     // Determine P(n+1/2).
     double K = 0.0;
@@ -1447,6 +1445,7 @@ INSCollocatedHierarchyIntegrator::postprocessIntegrateHierarchy(const double cur
                                                                 const bool skip_synchronize_new_state_data,
                                                                 const int num_cycles)
 {
+    IBTK_PROFILING_REGION("INSCollocatedHierarchyIntegrator::postprocessIntegrateHierarchy");
     INSHierarchyIntegrator::postprocessIntegrateHierarchy(
         current_time, new_time, skip_synchronize_new_state_data, num_cycles);
 
@@ -1753,76 +1752,11 @@ INSCollocatedHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
     return;
 } // resetHierarchyConfigurationSpecialized
 
-void
-INSCollocatedHierarchyIntegrator::applyGradientDetectorSpecialized(const Pointer<BasePatchHierarchy<NDIM> > hierarchy,
-                                                                   const int level_number,
-                                                                   const double /*error_data_time*/,
-                                                                   const int tag_index,
-                                                                   const bool /*initial_time*/,
-                                                                   const bool /*uses_richardson_extrapolation_too*/)
+int
+INSCollocatedHierarchyIntegrator::getVorticityPatchDataIndex() const
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT(hierarchy);
-    TBOX_ASSERT((level_number >= 0) && (level_number <= hierarchy->getFinestLevelNumber()));
-    TBOX_ASSERT(hierarchy->getPatchLevel(level_number));
-#endif
-    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
-
-    // Tag cells based on the magnitude of the vorticity.
-    //
-    // Note that if either the relative or absolute threshold is zero for a
-    // particular level, no tagging is performed on that level.
-    if (d_using_vorticity_tagging)
-    {
-        double Omega_rel_thresh = 0.0;
-        if (d_Omega_rel_thresh.size() > 0)
-        {
-            Omega_rel_thresh = d_Omega_rel_thresh[std::max(std::min(level_number, d_Omega_rel_thresh.size() - 1), 0)];
-        }
-        double Omega_abs_thresh = 0.0;
-        if (d_Omega_abs_thresh.size() > 0)
-        {
-            Omega_abs_thresh = d_Omega_abs_thresh[std::max(std::min(level_number, d_Omega_abs_thresh.size() - 1), 0)];
-        }
-        if (Omega_rel_thresh > 0.0 || Omega_abs_thresh > 0.0)
-        {
-            double thresh = std::numeric_limits<double>::max();
-            if (Omega_rel_thresh > 0.0) thresh = std::min(thresh, Omega_rel_thresh * d_Omega_max);
-            if (Omega_abs_thresh > 0.0) thresh = std::min(thresh, Omega_abs_thresh);
-            thresh += std::sqrt(std::numeric_limits<double>::epsilon());
-            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-            {
-                Pointer<Patch<NDIM> > patch = level->getPatch(p());
-                const Box<NDIM>& patch_box = patch->getBox();
-                Pointer<CellData<NDIM, int> > tags_data = patch->getPatchData(tag_index);
-                Pointer<CellData<NDIM, double> > Omega_data = patch->getPatchData(d_Omega_idx);
-                for (CellIterator<NDIM> ic(patch_box); ic; ic++)
-                {
-                    const hier::Index<NDIM>& i = ic();
-#if (NDIM == 2)
-                    if (std::abs((*Omega_data)(i)) > thresh)
-                    {
-                        (*tags_data)(i) = 1;
-                    }
-#endif
-#if (NDIM == 3)
-                    double norm_Omega_sq = 0.0;
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        norm_Omega_sq += (*Omega_data)(i, d) * (*Omega_data)(i, d);
-                    }
-                    const double norm_Omega = std::sqrt(norm_Omega_sq);
-                    if (norm_Omega > thresh)
-                    {
-                        (*tags_data)(i) = 1;
-                    }
-#endif
-                }
-            }
-        }
-    }
-    return;
-} // applyGradientDetectorSpecialized
+    return d_Omega_idx;
+} // getVorticityPatchDataIndex
 
 void
 INSCollocatedHierarchyIntegrator::setupPlotDataSpecialized()
@@ -1986,15 +1920,7 @@ INSCollocatedHierarchyIntegrator::regridProjection()
                           d_Phi_var,
                           d_no_fill_op,
                           d_integrator_time);
-    d_hier_fc_data_ops->subtract(d_u_ADV_current_idx, d_u_ADV_current_idx, d_Grad_Phi_fc_idx);
-    d_hier_math_ops->interp(d_Grad_Phi_cc_idx,
-                            d_Grad_Phi_cc_var,
-                            d_Grad_Phi_fc_idx,
-                            d_Grad_Phi_fc_var,
-                            d_no_fill_op,
-                            d_integrator_time,
-                            /*synch_cf_bdry*/ false);
-    d_hier_cc_data_ops->subtract(d_U_current_idx, d_U_current_idx, d_Grad_Phi_cc_idx);
+    applyProjectionGradientCorrection(-1.0, d_u_ADV_current_idx, d_u_ADV_current_idx, d_U_current_idx, d_U_current_idx);
 
     // Deallocate scratch data.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
@@ -2339,6 +2265,40 @@ INSCollocatedHierarchyIntegrator::computeDivSourceTerm(const int F_idx, const in
     return;
 } // computeDivSourceTerm
 
+void
+INSCollocatedHierarchyIntegrator::applyProjectionGradientCorrection(const double alpha,
+                                                                    const int u_ADV_dst_idx,
+                                                                    const int u_ADV_src_idx,
+                                                                    const int U_dst_idx,
+                                                                    const int U_src_idx)
+{
+    // Each patch is updated while its data are in cache, instead of updating
+    // the face-centered velocity, interpolating the gradient, and updating
+    // the cell-centered velocity in three separate passes over the hierarchy.
+    PatchMathOps patch_math_ops;
+    PatchFaceDataOpsReal<NDIM, double> patch_fc_data_ops;
+    PatchCellDataOpsReal<NDIM, double> patch_cc_data_ops;
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<FaceData<NDIM, double> > Grad_Phi_fc_data = patch->getPatchData(d_Grad_Phi_fc_idx);
+            Pointer<CellData<NDIM, double> > Grad_Phi_cc_data = patch->getPatchData(d_Grad_Phi_cc_idx);
+            Pointer<FaceData<NDIM, double> > u_ADV_dst_data = patch->getPatchData(u_ADV_dst_idx);
+            Pointer<FaceData<NDIM, double> > u_ADV_src_data = patch->getPatchData(u_ADV_src_idx);
+            Pointer<CellData<NDIM, double> > U_dst_data = patch->getPatchData(U_dst_idx);
+            Pointer<CellData<NDIM, double> > U_src_data = patch->getPatchData(U_src_idx);
+            patch_fc_data_ops.axpy(u_ADV_dst_data, alpha, Grad_Phi_fc_data, u_ADV_src_data, patch_box);
+            patch_math_ops.interp(Grad_Phi_cc_data, Grad_Phi_fc_data, patch);
+            patch_cc_data_ops.axpy(U_dst_data, alpha, Grad_Phi_cc_data, U_src_data, patch_box);
+        });
+    }
+    return;
+} // applyProjectionGradientCorrection
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
@@ -27,8 +27,13 @@
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/PoissonSolver.h"
+#include "ibtk/ibtk_utilities.h"
 
+#include "Box.h"
+#include "CellData.h"
+#include "CellIterator.h"
 #include "FaceVariable.h"
+#include "Index.h"
 #include "IntVector.h"
 #include "LocationIndexRobinBcCoefs.h"
 #include "MultiblockDataTranslator.h"
@@ -47,6 +52,7 @@
 #include "tbox/Utilities.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <ostream>
 #include <string>
@@ -109,6 +115,7 @@ INSHierarchyIntegrator::registerAdvDiffHierarchyIntegrator(Pointer<AdvDiffHierar
     registerChildHierarchyIntegrator(d_adv_diff_hier_integrator);
     d_adv_diff_hier_integrator->registerAdvectionVelocity(d_U_adv_diff_var);
     d_adv_diff_hier_integrator->setAdvectionVelocityIsDivergenceFree(d_U_adv_diff_var, !d_Q_fcn);
+    d_adv_diff_hier_integrator->setAdvectionVelocityIsManagedExternally(d_U_adv_diff_var, true);
     return;
 } // registerAdvDiffHierarchyIntegrator
 
@@ -481,6 +488,10 @@ INSHierarchyIntegrator::INSHierarchyIntegrator(std::string object_name,
     // allocated for this variable only when an advection-diffusion solver is
     // registered with the INSHierarchyIntegrator.
     d_U_adv_diff_var = new FaceVariable<NDIM, double>(d_object_name + "::U_adv_diff");
+
+    // Tag cells based on the magnitude of the vorticity together with all other
+    // patch tagging criteria.
+    registerApplyGradientDetectorPatchCallback(&INSHierarchyIntegrator::applyVorticityTaggingCallback, this);
     return;
 } // INSHierarchyIntegrator
 
@@ -491,9 +502,13 @@ INSHierarchyIntegrator::getMaximumTimeStepSizeSpecialized()
     for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        dt = std::min(dt, d_cfl_max * getStableTimestep(level));
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            dt = std::min(dt, d_cfl_max * getStableTimestep(patch));
+        }
     }
-    return dt;
+    return minReduceTimeStepSize(dt);
 } // getMaximumTimeStepSizeSpecialized
 
 double
@@ -549,6 +564,12 @@ INSHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Database> db)
     return;
 } // putToDatabaseSpecialized
 
+int
+INSHierarchyIntegrator::getVorticityPatchDataIndex() const
+{
+    return IBTK::invalid_index;
+} // getVorticityPatchDataIndex
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
@@ -815,6 +836,62 @@ INSHierarchyIntegrator::getFromRestart()
     return;
 } // getFromRestart
 
+void
+INSHierarchyIntegrator::applyVorticityTaggingCallback(Pointer<Patch<NDIM> > patch,
+                                                      const int level_number,
+                                                      const double /*error_data_time*/,
+                                                      CellData<NDIM, int>& tags_data,
+                                                      const bool /*initial_time*/,
+                                                      void* ctx)
+{
+    auto ins_integrator = static_cast<INSHierarchyIntegrator*>(ctx);
+    if (!ins_integrator->d_using_vorticity_tagging) return;
+    const int Omega_idx = ins_integrator->getVorticityPatchDataIndex();
+    if (Omega_idx == IBTK::invalid_index) return;
+
+    // Tag cells based on the magnitude of the vorticity.
+    //
+    // Note that if either the relative or absolute threshold is zero for a
+    // particular level, no tagging is performed on that level.
+    const Array<double>& Omega_rel_thresh_array = ins_integrator->d_Omega_rel_thresh;
+    const Array<double>& Omega_abs_thresh_array = ins_integrator->d_Omega_abs_thresh;
+    double Omega_rel_thresh = 0.0;
+    if (Omega_rel_thresh_array.size() > 0)
+    {
+        Omega_rel_thresh =
+            Omega_rel_thresh_array[std::max(std::min(level_number, Omega_rel_thresh_array.size() - 1), 0)];
+    }
+    double Omega_abs_thresh = 0.0;
+    if (Omega_abs_thresh_array.size() > 0)
+    {
+        Omega_abs_thresh =
+            Omega_abs_thresh_array[std::max(std::min(level_number, Omega_abs_thresh_array.size() - 1), 0)];
+    }
+    if (Omega_rel_thresh <= 0.0 && Omega_abs_thresh <= 0.0) return;
+    double thresh = std::numeric_limits<double>::max();
+    if (Omega_rel_thresh > 0.0) thresh = std::min(thresh, Omega_rel_thresh * ins_integrator->d_Omega_max);
+    if (Omega_abs_thresh > 0.0) thresh = std::min(thresh, Omega_abs_thresh);
+    thresh += std::sqrt(std::numeric_limits<double>::epsilon());
+
+    const Box<NDIM>& patch_box = patch->getBox();
+    Pointer<CellData<NDIM, double> > Omega_data = patch->getPatchData(Omega_idx);
+    for (CellIterator<NDIM> ic(patch_box); ic; ic++)
+    {
+        const hier::Index<NDIM>& i = ic();
+        double norm_Omega_sq = 0.0;
+        for (unsigned int d = 0; d < (NDIM == 2 ? 1 : NDIM); ++d)
+        {
+            norm_Omega_sq += (*Omega_data)(i, d) * (*Omega_data)(i, d);
+        }
+        const double norm_Omega = std::sqrt(norm_Omega_sq);
+        if (norm_Omega > thresh)
+        {
+            tags_data(i) = 1;
+        }
+    }
+    return;
+} // applyVorticityTaggingCallback
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
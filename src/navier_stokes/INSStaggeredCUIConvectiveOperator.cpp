@@ -20,6 +20,7 @@
 #include "ibamr/ibamr_utilities.h"
 
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/ibtk_utilities.h"
 
 #include "Box.h"
 #include "CartesianPatchGeometry.h"
@@ -607,10 +608,7 @@ INSStaggeredCUIConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
             const double* const dx = patch_geom->getDx();
 
@@ -628,8 +626,19 @@ INSStaggeredCUIConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
                 side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-                U_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
+            }
+
+            // SAMRAI memory management is not thread safe, so the scratch data
+            // are allocated (and freed) by one thread at a time.
+#ifdef _OPENMP
+#pragma omp critical(INSStaggeredCUIConvectiveOperator_scratch_data)
+#endif
+            {
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    U_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
+                    U_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
+                }
             }
 #if (NDIM == 2)
             NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
@@ -1030,7 +1039,19 @@ INSStaggeredCUIConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                   "SKEW_SYMMETRIC\n");
                 }
             }
-        }
+
+            // Free the scratch data one thread at a time; see above.
+#ifdef _OPENMP
+#pragma omp critical(INSStaggeredCUIConvectiveOperator_scratch_data)
+#endif
+            {
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    U_adv_data[axis].setNull();
+                    U_half_data[axis].setNull();
+                }
+            }
+        });
     }
 
     // Deallocate scratch data.
@@ -20,6 +20,7 @@
 #include "ibamr/ibamr_utilities.h"
 
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/ibtk_utilities.h"
 
 #include "Box.h"
 #include "CartesianPatchGeometry.h"
@@ -319,10 +320,7 @@ INSStaggeredCenteredConvectiveOperator::applyConvectiveOperator(const int U_idx,
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
             const double* const dx = patch_geom->getDx();
 
@@ -461,7 +459,7 @@ INSStaggeredCenteredConvectiveOperator::applyConvectiveOperator(const int U_idx,
                     << "  valid choices are: ADVECTIVE, CONSERVATIVE, "
                        "SKEW_SYMMETRIC\n");
             }
-        }
+        });
     }
 
     // Deallocate scratch data.
@@ -45,11 +45,14 @@
 #include "ibtk/KrylovLinearSolver.h"
 #include "ibtk/LinearSolver.h"
 #include "ibtk/NewtonKrylovSolver.h"
+#include "ibtk/NormOps.h"
 #include "ibtk/PoissonSolver.h"
 #include "ibtk/SCPoissonSolverManager.h"
 #include "ibtk/SideDataSynchronization.h"
+#include "ibtk/TelemetryManager.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
+#include "ibtk/profiling_annotations.h"
 
 #include "ArrayData.h"
 #include "BasePatchHierarchy.h"
@@ -398,6 +401,58 @@ copy_side_to_face(const int U_fc_idx, const int U_sc_idx, Pointer<PatchHierarchy
     }
     return;
 } // copy_side_to_face
+
+// Butcher tableau of an additive implicit-explicit (IMEX) Runge-Kutta scheme.
+// Stage 0 is explicit, i.e., the solution of stage 0 is the solution at the
+// start of the time step, and the remaining stages are diagonally implicit
+// with diagonal coefficient gamma.
+struct IMEXRungeKuttaTableau
+{
+    int num_stages;
+    double gamma;
+    std::vector<double> c;
+    std::vector<std::vector<double> > a_explicit, a_implicit;
+};
+
+// Return the tableau of the specified IMEX scheme.  The schemes are those of
+// Ascher, Ruuth, and Spiteri (Appl. Numer. Math. 25:151-167, 1997).  Both parts
+// of each scheme are stiffly accurate (their weights are the last rows of their
+// coefficient matrices), so the solution at the end of the time step is the
+// solution of the last stage, which satisfies the divergence constraint.
+IMEXRungeKuttaTableau
+get_imex_runge_kutta_tableau(const TimeSteppingType time_stepping_type)
+{
+    IMEXRungeKuttaTableau tableau;
+    switch (time_stepping_type)
+    {
+    case IMEX_ARS222:
+    {
+        const double gamma = 1.0 - 1.0 / std::sqrt(2.0);
+        const double delta = 1.0 - 1.0 / (2.0 * gamma);
+        tableau.num_stages = 3;
+        tableau.gamma = gamma;
+        tableau.c = { 0.0, gamma, 1.0 };
+        tableau.a_explicit = { {}, { gamma }, { delta, 1.0 - delta } };
+        tableau.a_implicit = { {}, { 0.0, gamma }, { 0.0, 1.0 - gamma, gamma } };
+        break;
+    }
+    case IMEX_ARS443:
+        tableau.num_stages = 5;
+        tableau.gamma = 0.5;
+        tableau.c = { 0.0, 0.5, 2.0 / 3.0, 0.5, 1.0 };
+        tableau.a_explicit = {
+            {}, { 0.5 }, { 11.0 / 18.0, 1.0 / 18.0 }, { 5.0 / 6.0, -5.0 / 6.0, 0.5 }, { 0.25, 1.75, 0.75, -1.75 }
+        };
+        tableau.a_implicit = {
+            {}, { 0.0, 0.5 }, { 0.0, 1.0 / 6.0, 0.5 }, { 0.0, -0.5, 0.5, 0.5 }, { 0.0, 1.5, -1.5, 0.5, 0.5 }
+        };
+        break;
+    default:
+        TBOX_ERROR("get_imex_runge_kutta_tableau(): unsupported time stepping type: "
+                   << enum_to_string<TimeSteppingType>(time_stepping_type) << "\n");
+    }
+    return tableau;
+} // get_imex_runge_kutta_tableau
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -477,13 +532,15 @@ INSStaggeredHierarchyIntegrator::INSStaggeredHierarchyIntegrator(std::string obj
     case FORWARD_EULER:
     case MIDPOINT_RULE:
     case TRAPEZOIDAL_RULE:
+    case IMEX_ARS222:
+    case IMEX_ARS443:
         break;
     default:
         TBOX_ERROR(d_object_name << "::INSStaggeredHierarchyIntegrator():\n"
                                  << "  unsupported convective time stepping type: "
                                  << enum_to_string<TimeSteppingType>(d_convective_time_stepping_type) << " \n"
                                  << "  valid choices are: ADAMS_BASHFORTH, FORWARD_EULER, "
-                                    "MIDPOINT_RULE, TRAPEZOIDAL_RULE\n");
+                                    "MIDPOINT_RULE, TRAPEZOIDAL_RULE, IMEX_ARS222, IMEX_ARS443\n");
     }
     if (is_multistep_time_stepping_type(d_convective_time_stepping_type))
     {
@@ -541,6 +598,13 @@ INSStaggeredHierarchyIntegrator::INSStaggeredHierarchyIntegrator(std::string obj
     if (input_db->keyExists("explicitly_remove_nullspace"))
         d_explicitly_remove_nullspace = input_db->getBool("explicitly_remove_nullspace");
 
+    // Flag to determine whether diagnostic data are only allocated when they
+    // are needed.
+    if (input_db->keyExists("lazy_allocate_diagnostic_data"))
+        d_lazy_allocate_diagnostic_data = input_db->getBool("lazy_allocate_diagnostic_data");
+    if (input_db->keyExists("predictor_cycle_rel_residual_tol"))
+        d_predictor_cycle_rel_residual_tol = input_db->getDouble("predictor_cycle_rel_residual_tol");
+
     // Setup physical boundary conditions objects.
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_U_bc_coefs.resize(NDIM);
@@ -620,6 +684,9 @@ INSStaggeredHierarchyIntegrator::~INSStaggeredHierarchyIntegrator()
     if (d_U_adv_vec) d_U_adv_vec->freeVectorComponents();
     if (d_N_vec) d_N_vec->freeVectorComponents();
     if (d_P_rhs_vec) d_P_rhs_vec->freeVectorComponents();
+    for (const auto& imex_vec : d_imex_explicit_vecs) imex_vec->freeVectorComponents();
+    for (const auto& imex_vec : d_imex_implicit_vecs) imex_vec->freeVectorComponents();
+    if (d_imex_rhs_vec) d_imex_rhs_vec->freeVectorComponents();
     for (const auto& nul_vec : d_nul_vecs)
     {
         if (nul_vec) nul_vec->freeVectorComponents();
@@ -1093,6 +1160,24 @@ INSStaggeredHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHier
         }
     }
 
+    // Diagnostic data that are allocated lazily are not allocated along with
+    // the other current data, and they are not written to restart files. The
+    // vorticity is needed to tag cells for refinement and so it is always
+    // allocated when vorticity tagging is used.
+    if (d_lazy_allocate_diagnostic_data)
+    {
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        std::vector<int> diagnostic_idxs = { d_U_cc_idx, d_F_cc_idx, d_Div_U_idx, d_EE_idx };
+        if (!d_using_vorticity_tagging) diagnostic_idxs.push_back(d_Omega_idx);
+        for (const int idx : diagnostic_idxs)
+        {
+            if (idx == IBTK::invalid_index) continue;
+            d_current_data.clrFlag(idx);
+            if (d_registered_for_restart) var_db->unregisterPatchDataForRestart(idx);
+            d_diagnostic_data.setFlag(idx);
+        }
+    }
+
     // Setup a specialized coarsen algorithm.
     Pointer<CoarsenAlgorithm<NDIM> > coarsen_alg = new CoarsenAlgorithm<NDIM>();
     Pointer<CoarsenOperator<NDIM> > coarsen_op = grid_geom->lookupCoarsenOperator(d_U_var, d_U_coarsen_type);
@@ -1212,12 +1297,16 @@ INSStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy(const double curre
                                                               const double new_time,
                                                               const int num_cycles)
 {
+    IBTK_PROFILING_REGION("INSStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy");
     INSHierarchyIntegrator::preprocessIntegrateHierarchy(current_time, new_time, num_cycles);
 
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
     const double dt = new_time - current_time;
 
+    // Free any diagnostic data that were allocated since the last time step.
+    deallocateDiagnosticData();
+
     // Keep track of the number of cycles to be used for the present integration
     // step.
     if (!d_creeping_flow && (d_current_num_cycles == 1) &&
@@ -1229,13 +1318,22 @@ INSStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy(const double curre
                                  << " requires num_cycles > 1.\n"
                                  << "  at current time step, num_cycles = " << d_current_num_cycles << "\n");
     }
+    const bool use_imex = is_imex_runge_kutta_time_stepping_type(d_convective_time_stepping_type);
+    if (use_imex && d_current_num_cycles != getNumberOfCycles())
+    {
+        TBOX_ERROR(d_object_name << "::preprocessIntegrateHierarchy():\n"
+                                 << "  time stepping type: "
+                                 << enum_to_string<TimeSteppingType>(d_convective_time_stepping_type)
+                                 << " requires num_cycles = " << getNumberOfCycles() << ".\n"
+                                 << "  at current time step, num_cycles = " << d_current_num_cycles << "\n");
+    }
 
     // Allocate the scratch and new data.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_scratch_data, current_time);
-        level->allocatePatchData(d_new_data, new_time);
+        allocateLevelPatchData(level, d_scratch_data, current_time);
+        allocateLevelPatchData(level, d_new_data, new_time);
     }
 
     // Setup the operators and solvers.
@@ -1253,6 +1351,12 @@ INSStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy(const double curre
         d_N_vec->allocateVectorData(current_time);
         d_N_vec->setToScalar(0.0);
     }
+    if (use_imex)
+    {
+        for (const auto& imex_vec : d_imex_explicit_vecs) imex_vec->allocateVectorData(current_time);
+        for (const auto& imex_vec : d_imex_implicit_vecs) imex_vec->allocateVectorData(current_time);
+        d_imex_rhs_vec->allocateVectorData(current_time);
+    }
 
     // Cache BC data.
     d_bc_helper->cacheBcCoefData(d_bc_coefs, new_time, d_hierarchy);
@@ -1279,6 +1383,14 @@ INSStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy(const double curre
     PoissonSpecifications U_rhs_problem_coefs(d_object_name + "::U_rhs_problem_coefs");
     U_rhs_problem_coefs.setCConstant((rho / dt) - K_rhs * lambda);
     U_rhs_problem_coefs.setDConstant(+K_rhs * mu);
+    if (use_imex)
+    {
+        // The viscous terms of earlier stages are accounted for by
+        // setupSolverVectors().
+        const double gamma = get_imex_runge_kutta_tableau(d_convective_time_stepping_type).gamma;
+        U_rhs_problem_coefs.setCConstant(rho / (gamma * dt));
+        U_rhs_problem_coefs.setDConstant(0.0);
+    }
     const int U_rhs_idx = d_U_rhs_vec->getComponentDescriptorIndex(0);
     const Pointer<SideVariable<NDIM, double> > U_rhs_var = d_U_rhs_vec->getComponentVariable(0);
     d_hier_sc_data_ops->copyData(d_U_scratch_idx, d_U_current_idx);
@@ -1403,6 +1515,7 @@ INSStaggeredHierarchyIntegrator::integrateHierarchy(const double current_time,
                                                     const double new_time,
                                                     const int cycle_num)
 {
+    IBTK_PROFILING_REGION("INSStaggeredHierarchyIntegrator::integrateHierarchy");
     INSHierarchyIntegrator::integrateHierarchy(current_time, new_time, cycle_num);
 
     // Check to make sure that the number of cycles is what we expect it to be.
@@ -1425,8 +1538,27 @@ INSStaggeredHierarchyIntegrator::integrateHierarchy(const double current_time,
     // Setup the solution and right-hand-side vectors.
     setupSolverVectors(d_sol_vec, d_rhs_vec, current_time, new_time, cycle_num);
 
+    // Loosen the tolerance of the Stokes solver in predictor cycles, i.e., in
+    // all but the last cycle.
+    const bool is_predictor_cycle = cycle_num + 1 < d_current_num_cycles;
+    const bool use_predictor_tol = is_predictor_cycle && d_predictor_cycle_rel_residual_tol > 0.0;
+    const double stokes_rel_residual_tol = d_stokes_solver->getRelativeTolerance();
+    if (use_predictor_tol)
+    {
+        d_stokes_solver->setRelativeTolerance(std::max(stokes_rel_residual_tol, d_predictor_cycle_rel_residual_tol));
+    }
+
     // Solve for u(n+1), p(n+1/2).
-    d_stokes_solver->solveSystem(*d_sol_vec, *d_rhs_vec);
+    TelemetryManager* telemetry_manager = TelemetryManager::getManager();
+    telemetry_manager->startPhase("stokes_solve");
+    const bool converged = d_stokes_solver->solveSystem(*d_sol_vec, *d_rhs_vec);
+    telemetry_manager->stopPhase("stokes_solve");
+    telemetry_manager->addToMetric("stokes_solver_iterations", d_stokes_solver->getNumIterations());
+    if (is_predictor_cycle)
+    {
+        telemetry_manager->addToMetric("stokes_solver_predictor_iterations", d_stokes_solver->getNumIterations());
+    }
+    if (use_predictor_tol) d_stokes_solver->setRelativeTolerance(stokes_rel_residual_tol);
     if (d_enable_logging && d_enable_logging_solver_iterations)
         plog << d_object_name
              << "::integrateHierarchy(): stokes solve number of iterations = " << d_stokes_solver->getNumIterations()
@@ -1435,6 +1567,7 @@ INSStaggeredHierarchyIntegrator::integrateHierarchy(const double current_time,
         plog << d_object_name
              << "::integrateHierarchy(): stokes solve residual norm        = " << d_stokes_solver->getResidualNorm()
              << "\n";
+    if (!converged) indicateStepFailure("stokes solver did not converge");
     if (d_explicitly_remove_nullspace) removeNullSpace(d_sol_vec);
 
     // Reset the solution and right-hand-side vectors.
@@ -1489,6 +1622,7 @@ INSStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(const double curr
                                                                const bool skip_synchronize_new_state_data,
                                                                const int num_cycles)
 {
+    IBTK_PROFILING_REGION("INSStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy");
     INSHierarchyIntegrator::postprocessIntegrateHierarchy(
         current_time, new_time, skip_synchronize_new_state_data, num_cycles);
 
@@ -1556,6 +1690,12 @@ INSStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(const double curr
         d_U_adv_vec->deallocateVectorData();
         d_N_vec->deallocateVectorData();
     }
+    if (is_imex_runge_kutta_time_stepping_type(d_convective_time_stepping_type))
+    {
+        for (const auto& imex_vec : d_imex_explicit_vecs) imex_vec->deallocateVectorData();
+        for (const auto& imex_vec : d_imex_implicit_vecs) imex_vec->deallocateVectorData();
+        d_imex_rhs_vec->deallocateVectorData();
+    }
 
     // Deallocate any registered advection-diffusion solver.
     if (d_adv_diff_hier_integrator)
@@ -1677,6 +1817,16 @@ INSStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(const double curr
     return;
 } // postprocessIntegrateHierarchy
 
+int
+INSStaggeredHierarchyIntegrator::getNumberOfCycles() const
+{
+    if (is_imex_runge_kutta_time_stepping_type(d_convective_time_stepping_type))
+    {
+        return get_imex_runge_kutta_tableau(d_convective_time_stepping_type).num_stages - 1;
+    }
+    return INSHierarchyIntegrator::getNumberOfCycles();
+} // getNumberOfCycles
+
 void
 INSStaggeredHierarchyIntegrator::setupSolverVectors(const Pointer<SAMRAIVectorReal<NDIM, double> >& sol_vec,
                                                     const Pointer<SAMRAIVectorReal<NDIM, double> >& rhs_vec,
@@ -1702,8 +1852,16 @@ INSStaggeredHierarchyIntegrator::setupSolverVectors(const Pointer<SAMRAIVectorRe
                                      d_P_rhs_vec->getComponentDescriptorIndex(0));
     }
 
+    // Account for the convective acceleration and body forcing terms of an IMEX
+    // scheme.
+    const bool use_imex = is_imex_runge_kutta_time_stepping_type(d_convective_time_stepping_type);
+    if (use_imex)
+    {
+        accumulateIMEXStageTerms(rhs_vec->getComponentDescriptorIndex(0), current_time, new_time, cycle_num);
+    }
+
     // Account for the convective acceleration term.
-    if (!d_creeping_flow)
+    if (!d_creeping_flow && !use_imex)
     {
         const TimeSteppingType convective_time_stepping_type = getConvectiveTimeSteppingType(cycle_num);
         if (cycle_num > 0)
@@ -1758,7 +1916,7 @@ INSStaggeredHierarchyIntegrator::setupSolverVectors(const Pointer<SAMRAIVectorRe
     }
 
     // Account for body forcing terms.
-    if (d_F_fcn)
+    if (d_F_fcn && !use_imex)
     {
         d_F_fcn->setDataOnPatchHierarchy(d_F_scratch_idx, d_F_var, d_hierarchy, half_time);
         d_hier_sc_data_ops->add(
@@ -1847,7 +2005,14 @@ INSStaggeredHierarchyIntegrator::resetSolverVectors(const Pointer<SAMRAIVectorRe
 
     // Reset the right-hand side vector.
     const double rho = d_problem_coefs.getRho();
-    if (!d_creeping_flow)
+    const bool use_imex = is_imex_runge_kutta_time_stepping_type(d_convective_time_stepping_type);
+    if (use_imex)
+    {
+        d_hier_sc_data_ops->subtract(rhs_vec->getComponentDescriptorIndex(0),
+                                     rhs_vec->getComponentDescriptorIndex(0),
+                                     d_imex_rhs_vec->getComponentDescriptorIndex(0));
+    }
+    else if (!d_creeping_flow)
     {
         const TimeSteppingType convective_time_stepping_type = getConvectiveTimeSteppingType(cycle_num);
         const int N_idx = d_N_vec->getComponentDescriptorIndex(0);
@@ -1864,8 +2029,11 @@ INSStaggeredHierarchyIntegrator::resetSolverVectors(const Pointer<SAMRAIVectorRe
     }
     if (d_F_fcn)
     {
-        d_hier_sc_data_ops->subtract(
-            rhs_vec->getComponentDescriptorIndex(0), rhs_vec->getComponentDescriptorIndex(0), d_F_scratch_idx);
+        if (!use_imex)
+        {
+            d_hier_sc_data_ops->subtract(
+                rhs_vec->getComponentDescriptorIndex(0), rhs_vec->getComponentDescriptorIndex(0), d_F_scratch_idx);
+        }
         d_hier_sc_data_ops->copyData(d_F_new_idx, d_F_scratch_idx);
     }
     if (d_Q_fcn)
@@ -1939,6 +2107,7 @@ void
 INSStaggeredHierarchyIntegrator::regridHierarchyBeginSpecialized()
 {
     // Determine the divergence of the velocity field before regridding.
+    allocateDiagnosticData(d_Div_U_idx, d_integrator_time);
     d_hier_math_ops->div(d_Div_U_idx,
                          d_Div_U_var,
                          1.0,
@@ -1951,9 +2120,10 @@ INSStaggeredHierarchyIntegrator::regridHierarchyBeginSpecialized()
                          d_Q_current_idx,
                          d_Q_var);
     const int wgt_cc_idx = d_hier_math_ops->getCellWeightPatchDescriptorIndex();
-    d_div_U_norm_1_pre = d_hier_cc_data_ops->L1Norm(d_Div_U_idx, wgt_cc_idx);
-    d_div_U_norm_2_pre = d_hier_cc_data_ops->L2Norm(d_Div_U_idx, wgt_cc_idx);
-    d_div_U_norm_oo_pre = d_hier_cc_data_ops->maxNorm(d_Div_U_idx, wgt_cc_idx);
+    const NormOps::Norms div_U_norms = NormOps::norms(d_hierarchy, { d_Div_U_idx }, { wgt_cc_idx })[0];
+    d_div_U_norm_1_pre = div_U_norms.L1;
+    d_div_U_norm_2_pre = div_U_norms.L2;
+    d_div_U_norm_oo_pre = div_U_norms.max;
     return;
 } // regridHierarchyBeginSpecialized
 
@@ -1962,6 +2132,7 @@ INSStaggeredHierarchyIntegrator::regridHierarchyEndSpecialized()
 {
     const int wgt_cc_idx = d_hier_math_ops->getCellWeightPatchDescriptorIndex();
     // Determine the divergence of the velocity field after regridding.
+    allocateDiagnosticData(d_Div_U_idx, d_integrator_time);
     d_hier_math_ops->div(d_Div_U_idx,
                          d_Div_U_var,
                          1.0,
@@ -1973,9 +2144,10 @@ INSStaggeredHierarchyIntegrator::regridHierarchyEndSpecialized()
                          -1.0,
                          d_Q_current_idx,
                          d_Q_var);
-    d_div_U_norm_1_post = d_hier_cc_data_ops->L1Norm(d_Div_U_idx, wgt_cc_idx);
-    d_div_U_norm_2_post = d_hier_cc_data_ops->L2Norm(d_Div_U_idx, wgt_cc_idx);
-    d_div_U_norm_oo_post = d_hier_cc_data_ops->maxNorm(d_Div_U_idx, wgt_cc_idx);
+    const NormOps::Norms div_U_norms = NormOps::norms(d_hierarchy, { d_Div_U_idx }, { wgt_cc_idx })[0];
+    d_div_U_norm_1_post = div_U_norms.L1;
+    d_div_U_norm_2_post = div_U_norms.L2;
+    d_div_U_norm_oo_post = div_U_norms.max;
     d_do_regrid_projection = d_div_U_norm_1_post > d_regrid_max_div_growth_factor * d_div_U_norm_1_pre ||
                              d_div_U_norm_2_post > d_regrid_max_div_growth_factor * d_div_U_norm_2_pre ||
                              d_div_U_norm_oo_post > d_regrid_max_div_growth_factor * d_div_U_norm_oo_pre;
@@ -2248,68 +2420,11 @@ INSStaggeredHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
     return;
 } // resetHierarchyConfigurationSpecialized
 
-void
-INSStaggeredHierarchyIntegrator::applyGradientDetectorSpecialized(const Pointer<BasePatchHierarchy<NDIM> > hierarchy,
-                                                                  const int level_number,
-                                                                  const double /*error_data_time*/,
-                                                                  const int tag_index,
-                                                                  const bool /*initial_time*/,
-                                                                  const bool /*uses_richardson_extrapolation_too*/)
+int
+INSStaggeredHierarchyIntegrator::getVorticityPatchDataIndex() const
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT(hierarchy);
-    TBOX_ASSERT((level_number >= 0) && (level_number <= hierarchy->getFinestLevelNumber()));
-    TBOX_ASSERT(hierarchy->getPatchLevel(level_number));
-#endif
-    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
-
-    // Tag cells based on the magnitude of the vorticity.
-    //
-    // Note that if either the relative or absolute threshold is zero for a
-    // particular level, no tagging is performed on that level.
-    if (d_using_vorticity_tagging)
-    {
-        double Omega_rel_thresh = 0.0;
-        if (d_Omega_rel_thresh.size() > 0)
-        {
-            Omega_rel_thresh = d_Omega_rel_thresh[std::max(std::min(level_number, d_Omega_rel_thresh.size() - 1), 0)];
-        }
-        double Omega_abs_thresh = 0.0;
-        if (d_Omega_abs_thresh.size() > 0)
-        {
-            Omega_abs_thresh = d_Omega_abs_thresh[std::max(std::min(level_number, d_Omega_abs_thresh.size() - 1), 0)];
-        }
-        if (Omega_rel_thresh > 0.0 || Omega_abs_thresh > 0.0)
-        {
-            double thresh = std::numeric_limits<double>::max();
-            if (Omega_rel_thresh > 0.0) thresh = std::min(thresh, Omega_rel_thresh * d_Omega_max);
-            if (Omega_abs_thresh > 0.0) thresh = std::min(thresh, Omega_abs_thresh);
-            thresh += std::sqrt(std::numeric_limits<double>::epsilon());
-            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-            {
-                Pointer<Patch<NDIM> > patch = level->getPatch(p());
-                const Box<NDIM>& patch_box = patch->getBox();
-                Pointer<CellData<NDIM, int> > tags_data = patch->getPatchData(tag_index);
-                Pointer<CellData<NDIM, double> > Omega_data = patch->getPatchData(d_Omega_idx);
-                for (CellIterator<NDIM> ic(patch_box); ic; ic++)
-                {
-                    const hier::Index<NDIM>& i = ic();
-                    double norm_Omega_sq = 0.0;
-                    for (unsigned int d = 0; d < (NDIM == 2 ? 1 : NDIM); ++d)
-                    {
-                        norm_Omega_sq += (*Omega_data)(i, d) * (*Omega_data)(i, d);
-                    }
-                    const double norm_Omega = std::sqrt(norm_Omega_sq);
-                    if (norm_Omega > thresh)
-                    {
-                        (*tags_data)(i) = 1;
-                    }
-                }
-            }
-        }
-    }
-    return;
-} // applyGradientDetectorSpecialized
+    return d_Omega_idx;
+} // getVorticityPatchDataIndex
 
 void
 INSStaggeredHierarchyIntegrator::setupPlotDataSpecialized()
@@ -2322,6 +2437,7 @@ INSStaggeredHierarchyIntegrator::setupPlotDataSpecialized()
     // Interpolate u to cell centers.
     if (d_output_U)
     {
+        allocateDiagnosticData(d_U_cc_idx, d_integrator_time);
         const int U_sc_idx = var_db->mapVariableAndContextToIndex(d_U_var, ctx);
         const int U_cc_idx = var_db->mapVariableAndContextToIndex(d_U_cc_var, ctx);
         d_hier_math_ops->interp(
@@ -2331,6 +2447,7 @@ INSStaggeredHierarchyIntegrator::setupPlotDataSpecialized()
     // Interpolate f to cell centers.
     if (d_F_fcn && d_output_F)
     {
+        allocateDiagnosticData(d_F_cc_idx, d_integrator_time);
         const int F_sc_idx = var_db->mapVariableAndContextToIndex(d_F_var, ctx);
         const int F_cc_idx = var_db->mapVariableAndContextToIndex(d_F_cc_var, ctx);
         d_hier_math_ops->interp(
@@ -2340,6 +2457,7 @@ INSStaggeredHierarchyIntegrator::setupPlotDataSpecialized()
     // Compute Omega = curl U.
     if (d_output_Omega)
     {
+        allocateDiagnosticData(d_Omega_idx, d_integrator_time);
         const int coarsest_ln = 0;
         const int finest_ln = d_hierarchy->getFinestLevelNumber();
         for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
@@ -2360,6 +2478,7 @@ INSStaggeredHierarchyIntegrator::setupPlotDataSpecialized()
     // Compute Div U.
     if (d_output_Div_U)
     {
+        allocateDiagnosticData(d_Div_U_idx, d_integrator_time);
         d_hier_math_ops->div(
             d_Div_U_idx, d_Div_U_var, 1.0, d_U_current_idx, d_U_var, d_no_fill_op, d_integrator_time, false);
     }
@@ -2368,6 +2487,7 @@ INSStaggeredHierarchyIntegrator::setupPlotDataSpecialized()
     if (d_output_EE)
     {
         const int EE_idx = var_db->mapVariableAndContextToIndex(d_EE_var, ctx);
+        allocateDiagnosticData(EE_idx, d_integrator_time);
         const int coarsest_ln = 0;
         const int finest_ln = d_hierarchy->getFinestLevelNumber();
         for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
@@ -2394,6 +2514,7 @@ INSStaggeredHierarchyIntegrator::regridProjection()
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
     const int wgt_cc_idx = d_hier_math_ops->getCellWeightPatchDescriptorIndex();
     const double volume = d_hier_math_ops->getVolumeOfPhysicalDomain();
+    allocateDiagnosticData(d_Div_U_idx, d_integrator_time);
 
     // Setup the solver vectors.
     SAMRAIVectorReal<NDIM, double> sol_vec(d_object_name + "::sol_vec", d_hierarchy, coarsest_ln, finest_ln);
@@ -2545,6 +2666,15 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
     PoissonSpecifications U_problem_coefs(d_object_name + "::U_problem_coefs");
     U_problem_coefs.setCConstant((rho / dt) + K * lambda);
     U_problem_coefs.setDConstant(-K * mu);
+    const bool use_imex = is_imex_runge_kutta_time_stepping_type(d_convective_time_stepping_type);
+    if (use_imex)
+    {
+        // Each implicit stage of an IMEX scheme solves a backward Euler-like
+        // system with time step size gamma * dt.
+        const double gamma = get_imex_runge_kutta_tableau(d_convective_time_stepping_type).gamma;
+        U_problem_coefs.setCConstant((rho / (gamma * dt)) + lambda);
+        U_problem_coefs.setDConstant(-mu);
+    }
     PoissonSpecifications P_problem_coefs(d_object_name + "::P_problem_coefs");
     P_problem_coefs.setCZero();
     P_problem_coefs.setDConstant(rho == 0.0 ? -1.0 : -1.0 / rho);
@@ -2581,6 +2711,24 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
         d_N_vec = d_U_scratch_vec->cloneVector(d_object_name + "::N_vec");
         d_P_rhs_vec = d_P_scratch_vec->cloneVector(d_object_name + "::P_rhs_vec");
 
+        for (const auto& imex_vec : d_imex_explicit_vecs) imex_vec->freeVectorComponents();
+        for (const auto& imex_vec : d_imex_implicit_vecs) imex_vec->freeVectorComponents();
+        if (d_imex_rhs_vec) d_imex_rhs_vec->freeVectorComponents();
+        d_imex_explicit_vecs.clear();
+        d_imex_implicit_vecs.clear();
+        d_imex_rhs_vec.setNull();
+        if (use_imex)
+        {
+            const int num_stages = get_imex_runge_kutta_tableau(d_convective_time_stepping_type).num_stages;
+            for (int k = 0; k < num_stages - 1; ++k)
+            {
+                const std::string postfix = std::to_string(k);
+                d_imex_explicit_vecs.push_back(d_U_scratch_vec->cloneVector(d_object_name + "::E_vec_" + postfix));
+                d_imex_implicit_vecs.push_back(d_U_scratch_vec->cloneVector(d_object_name + "::V_vec_" + postfix));
+            }
+            d_imex_rhs_vec = d_U_scratch_vec->cloneVector(d_object_name + "::imex_rhs_vec");
+        }
+
         d_sol_vec =
             new SAMRAIVectorReal<NDIM, double>(d_object_name + "::sol_vec", d_hierarchy, coarsest_ln, finest_ln);
         d_sol_vec->addComponent(d_U_var, d_U_scratch_idx, wgt_sc_idx, d_hier_sc_data_ops);
@@ -3014,6 +3162,138 @@ INSStaggeredHierarchyIntegrator::getConvectiveTimeSteppingType(const int cycle_n
     return convective_time_stepping_type;
 } // getConvectiveTimeSteppingType
 
+void
+INSStaggeredHierarchyIntegrator::accumulateIMEXStageTerms(const int U_rhs_idx,
+                                                          const double current_time,
+                                                          const double new_time,
+                                                          const int cycle_num)
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    const double dt = new_time - current_time;
+    const double rho = d_problem_coefs.getRho();
+    const double mu = d_problem_coefs.getMu();
+    const double lambda = d_problem_coefs.getLambda();
+    const IMEXRungeKuttaTableau tableau = get_imex_runge_kutta_tableau(d_convective_time_stepping_type);
+
+    // Stage j is the most recently computed stage (stage 0 is the solution at
+    // the start of the time step) and stage i is computed in this cycle.
+    const int j = cycle_num;
+    const int i = cycle_num + 1;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(i < tableau.num_stages);
+#endif
+    const double stage_time = current_time + tableau.c[j] * dt;
+    const int U_stage_idx = j == 0 ? d_U_current_idx : d_U_new_idx;
+
+    // Evaluate the explicit terms of stage j, E_j = -rho N(u_j) + f(t_j).  The
+    // convective term of stage 0 is computed by preprocessIntegrateHierarchy().
+    const int E_idx = d_imex_explicit_vecs[j]->getComponentDescriptorIndex(0);
+    d_hier_sc_data_ops->setToScalar(E_idx, 0.0);
+    if (!d_creeping_flow)
+    {
+        const int N_idx = d_N_vec->getComponentDescriptorIndex(0);
+        if (j > 0)
+        {
+            const int U_adv_idx = d_U_adv_vec->getComponentDescriptorIndex(0);
+            d_hier_sc_data_ops->copyData(U_adv_idx, U_stage_idx);
+            for (int ln = finest_ln; ln > coarsest_ln; --ln)
+            {
+                Pointer<CoarsenAlgorithm<NDIM> > coarsen_alg = new CoarsenAlgorithm<NDIM>();
+                Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+                Pointer<CoarsenOperator<NDIM> > coarsen_op =
+                    grid_geom->lookupCoarsenOperator(d_U_var, d_U_coarsen_type);
+                coarsen_alg->registerCoarsen(U_adv_idx, U_adv_idx, coarsen_op);
+                coarsen_alg->resetSchedule(getCoarsenSchedules(d_object_name + "::CONVECTIVE_OP")[ln]);
+                getCoarsenSchedules(d_object_name + "::CONVECTIVE_OP")[ln]->coarsenData();
+                getCoarsenAlgorithm(d_object_name + "::CONVECTIVE_OP")
+                    ->resetSchedule(getCoarsenSchedules(d_object_name + "::CONVECTIVE_OP")[ln]);
+            }
+            d_convective_op->setAdvectionVelocity(U_adv_idx);
+            d_convective_op->setSolutionTime(stage_time);
+            d_convective_op->apply(*d_U_adv_vec, *d_N_vec);
+        }
+        d_hier_sc_data_ops->scale(E_idx, -rho, N_idx);
+    }
+    if (d_F_fcn)
+    {
+        d_F_fcn->setDataOnPatchHierarchy(d_F_scratch_idx, d_F_var, d_hierarchy, stage_time);
+        d_hier_sc_data_ops->add(E_idx, E_idx, d_F_scratch_idx);
+    }
+
+    // Evaluate the implicit terms of stage j, V_j = mu L u_j - lambda u_j, if
+    // they are needed by any later stage.
+    bool need_implicit_terms = false;
+    for (int k = i; k < tableau.num_stages; ++k)
+    {
+        need_implicit_terms = need_implicit_terms || tableau.a_implicit[k][j] != 0.0;
+    }
+    if (need_implicit_terms)
+    {
+        const int V_idx = d_imex_implicit_vecs[j]->getComponentDescriptorIndex(0);
+        PoissonSpecifications V_problem_coefs(d_object_name + "::V_problem_coefs");
+        V_problem_coefs.setCConstant(-lambda);
+        V_problem_coefs.setDConstant(mu);
+        d_hier_sc_data_ops->copyData(d_U_scratch_idx, U_stage_idx);
+        StaggeredStokesPhysicalBoundaryHelper::setupBcCoefObjects(d_U_bc_coefs,
+                                                                  /*P_bc_coef*/ nullptr,
+                                                                  d_U_scratch_idx,
+                                                                  /*P_data_idx*/ -1,
+                                                                  /*homogeneous_bc*/ false);
+        d_U_bdry_bc_fill_op->fillData(stage_time);
+        StaggeredStokesPhysicalBoundaryHelper::resetBcCoefObjects(d_U_bc_coefs,
+                                                                  /*P_bc_coef*/ nullptr);
+        d_hier_math_ops->laplace(V_idx, d_U_var, V_problem_coefs, d_U_scratch_idx, d_U_var, d_no_fill_op, stage_time);
+    }
+
+    // Accumulate the right-hand side of stage i, which is the sum over the
+    // previous stages k of (a_explicit[i][k] E_k + a_implicit[i][k] V_k) /
+    // gamma.  The term rho u(n) / (gamma dt) is set up by
+    // preprocessIntegrateHierarchy().
+    const int R_idx = d_imex_rhs_vec->getComponentDescriptorIndex(0);
+    d_hier_sc_data_ops->setToScalar(R_idx, 0.0);
+    for (int k = 0; k < i; ++k)
+    {
+        const double a_explicit = tableau.a_explicit[i][k];
+        const double a_implicit = tableau.a_implicit[i][k];
+        if (a_explicit != 0.0)
+        {
+            d_hier_sc_data_ops->axpy(
+                R_idx, a_explicit / tableau.gamma, d_imex_explicit_vecs[k]->getComponentDescriptorIndex(0), R_idx);
+        }
+        if (a_implicit != 0.0)
+        {
+            d_hier_sc_data_ops->axpy(
+                R_idx, a_implicit / tableau.gamma, d_imex_implicit_vecs[k]->getComponentDescriptorIndex(0), R_idx);
+        }
+    }
+    d_hier_sc_data_ops->add(U_rhs_idx, U_rhs_idx, R_idx);
+    return;
+} // accumulateIMEXStageTerms
+
+void
+INSStaggeredHierarchyIntegrator::allocateDiagnosticData(const int idx, const double data_time)
+{
+    if (idx == IBTK::invalid_index || !d_diagnostic_data.isSet(idx)) return;
+    for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (!level->checkAllocated(idx)) level->allocatePatchData(idx, data_time);
+    }
+    return;
+} // allocateDiagnosticData
+
+void
+INSStaggeredHierarchyIntegrator::deallocateDiagnosticData()
+{
+    if (!d_lazy_allocate_diagnostic_data) return;
+    for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        d_hierarchy->getPatchLevel(ln)->deallocatePatchData(d_diagnostic_data);
+    }
+    return;
+} // deallocateDiagnosticData
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
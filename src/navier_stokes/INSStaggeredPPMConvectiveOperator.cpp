@@ -20,9 +20,11 @@
 #include "ibamr/ibamr_utilities.h"
 
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/ibtk_utilities.h"
 
 #include "Box.h"
 #include "CartesianPatchGeometry.h"
+#include "CellData.h"
 #include "FaceData.h"
 #include "Index.h"
 #include "IntVector.h"
@@ -553,10 +555,7 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
+        parallel_for_patches(*level, [&](const Pointer<Patch<NDIM> >& patch) {
             const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
             const double* const dx = patch_geom->getDx();
 
@@ -571,11 +570,38 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
             std::array<Box<NDIM>, NDIM> side_boxes;
             std::array<Pointer<FaceData<NDIM, double> >, NDIM> U_adv_data;
             std::array<Pointer<FaceData<NDIM, double> >, NDIM> U_half_data;
+
+            // The extrapolation only needs scratch data for the current velocity
+            // component, so we allocate single-depth arrays over the side boxes
+            // instead of full SideData objects.
+            const IntVector<NDIM>& U_gcw = U_data->getGhostCellWidth();
+            std::array<Pointer<CellData<NDIM, double> >, NDIM> dU_data, U_L_data, U_R_data, U_scratch1_data;
+#if (NDIM == 3)
+            std::array<Pointer<CellData<NDIM, double> >, NDIM> U_scratch2_data;
+#endif
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
                 side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-                U_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
+            }
+
+            // SAMRAI memory management is not thread safe, so the scratch data
+            // are allocated (and freed) by one thread at a time.
+#ifdef _OPENMP
+#pragma omp critical(INSStaggeredPPMConvectiveOperator_scratch_data)
+#endif
+            {
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    U_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
+                    U_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
+                    dU_data[axis] = new CellData<NDIM, double>(side_boxes[axis], 1, U_gcw);
+                    U_L_data[axis] = new CellData<NDIM, double>(side_boxes[axis], 1, U_gcw);
+                    U_R_data[axis] = new CellData<NDIM, double>(side_boxes[axis], 1, U_gcw);
+                    U_scratch1_data[axis] = new CellData<NDIM, double>(side_boxes[axis], 1, U_gcw);
+#if (NDIM == 3)
+                    U_scratch2_data[axis] = new CellData<NDIM, double>(side_boxes[axis], 1, U_gcw);
+#endif
+                }
             }
 #if (NDIM == 2)
             NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
@@ -655,18 +681,6 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
 #endif
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
-                Pointer<SideData<NDIM, double> > dU_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_L_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_R_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_scratch1_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-#if (NDIM == 3)
-                Pointer<SideData<NDIM, double> > U_scratch2_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-#endif
 #if (NDIM == 2)
                 GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
                                        side_boxes[axis].upper(0),
@@ -675,10 +689,10 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                        U_data->getGhostCellWidth()(0),
                                        U_data->getGhostCellWidth()(1),
                                        U_data->getPointer(axis),
-                                       U_scratch1_data->getPointer(axis),
-                                       dU_data->getPointer(axis),
-                                       U_L_data->getPointer(axis),
-                                       U_R_data->getPointer(axis),
+                                       U_scratch1_data[axis]->getPointer(),
+                                       dU_data[axis]->getPointer(),
+                                       U_L_data[axis]->getPointer(),
+                                       U_R_data[axis]->getPointer(),
                                        U_adv_data[axis]->getGhostCellWidth()(0),
                                        U_adv_data[axis]->getGhostCellWidth()(1),
                                        U_half_data[axis]->getGhostCellWidth()(0),
@@ -699,11 +713,11 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                        U_data->getGhostCellWidth()(1),
                                        U_data->getGhostCellWidth()(2),
                                        U_data->getPointer(axis),
-                                       U_scratch1_data->getPointer(axis),
-                                       U_scratch2_data->getPointer(axis),
-                                       dU_data->getPointer(axis),
-                                       U_L_data->getPointer(axis),
-                                       U_R_data->getPointer(axis),
+                                       U_scratch1_data[axis]->getPointer(),
+                                       U_scratch2_data[axis]->getPointer(),
+                                       dU_data[axis]->getPointer(),
+                                       U_L_data[axis]->getPointer(),
+                                       U_R_data[axis]->getPointer(),
                                        U_adv_data[axis]->getGhostCellWidth()(0),
                                        U_adv_data[axis]->getGhostCellWidth()(1),
                                        U_adv_data[axis]->getGhostCellWidth()(2),
@@ -947,7 +961,26 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
                                   "SKEW_SYMMETRIC\n");
                 }
             }
-        }
+
+            // Free the scratch data one thread at a time; see above.
+#ifdef _OPENMP
+#pragma omp critical(INSStaggeredPPMConvectiveOperator_scratch_data)
+#endif
+            {
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    U_adv_data[axis].setNull();
+                    U_half_data[axis].setNull();
+                    dU_data[axis].setNull();
+                    U_L_data[axis].setNull();
+                    U_R_data[axis].setNull();
+                    U_scratch1_data[axis].setNull();
+#if (NDIM == 3)
+                    U_scratch2_data[axis].setNull();
+#endif
+                }
+            }
+        });
     }
 
     // Deallocate scratch data.
@@ -57,7 +57,9 @@
 #include "tbox/Utilities.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -160,6 +162,35 @@ genrandn(ArrayData<NDIM, double>& data, const Box<NDIM>& box)
     }
     return;
 } // genrandn
+
+void
+genrandn(ArrayData<NDIM, double>& data,
+         const Box<NDIM>& box,
+         const std::array<std::uint32_t, 2>& key,
+         const std::uint32_t stream)
+{
+    // The counter is the index of the data point together with the stream and
+    // depth, so the generated values do not depend on the patch layout.
+    std::array<std::uint32_t, 4> counter = { 0, 0, 0, 0 };
+    for (int depth = 0; depth < data.getDepth(); ++depth)
+    {
+        counter[3] = stream + static_cast<std::uint32_t>(depth);
+        for (Box<NDIM>::Iterator i(box); i; i++)
+        {
+            const Index<NDIM>& idx = i();
+            for (int d = 0; d < NDIM; ++d) counter[d] = static_cast<std::uint32_t>(idx(d));
+            data(idx, depth) = RNG::genrandn(key, counter);
+        }
+    }
+    return;
+} // genrandn
+
+inline std::uint32_t
+compute_rng_stream(const int level_num, const int k, const int field)
+{
+    return (static_cast<std::uint32_t>(level_num) << 24) | (static_cast<std::uint32_t>(k) << 16) |
+           (static_cast<std::uint32_t>(field) << 8);
+} // compute_rng_stream
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -178,6 +209,9 @@ INSStaggeredStochasticForcing::INSStaggeredStochasticForcing(std::string object_
                 string_to_enum<StochasticStressTensorType>(input_db->getString("stress_tensor_type"));
         if (input_db->keyExists("std")) d_std = input_db->getDouble("std");
         if (input_db->keyExists("num_rand_vals")) d_num_rand_vals = input_db->getInteger("num_rand_vals");
+        if (input_db->keyExists("use_counter_based_rng"))
+            d_use_counter_based_rng = input_db->getBool("use_counter_based_rng");
+        if (input_db->keyExists("rng_seed")) d_rng_seed = input_db->getInteger("rng_seed");
         int k = 0;
         std::string key_name = "weights_0";
         while (input_db->keyExists(key_name))
@@ -265,6 +299,12 @@ INSStaggeredStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
         // Generate random components.
         if (cycle_num == 0)
         {
+            // When the counter-based generator is used, the random values are
+            // determined by the seed, the time step number, and the indices of
+            // the data.
+            const std::array<std::uint32_t, 2> rng_key = {
+                static_cast<std::uint32_t>(d_rng_seed), static_cast<std::uint32_t>(d_fluid_solver->getIntegratorStep())
+            };
             for (int k = 0; k < d_num_rand_vals; ++k)
             {
                 for (int level_num = coarsest_ln; level_num <= finest_ln; ++level_num)
@@ -274,16 +314,33 @@ INSStaggeredStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
                     {
                         Pointer<Patch<NDIM> > patch = level->getPatch(p());
                         Pointer<CellData<NDIM, double> > W_cc_data = patch->getPatchData(d_W_cc_idxs[k]);
-                        genrandn(W_cc_data->getArrayData(), W_cc_data->getBox());
+                        if (d_use_counter_based_rng)
+                            genrandn(W_cc_data->getArrayData(),
+                                     W_cc_data->getBox(),
+                                     rng_key,
+                                     compute_rng_stream(level_num, k, 0));
+                        else
+                            genrandn(W_cc_data->getArrayData(), W_cc_data->getBox());
 #if (NDIM == 2)
                         Pointer<NodeData<NDIM, double> > W_nc_data = patch->getPatchData(d_W_nc_idxs[k]);
-                        genrandn(W_nc_data->getArrayData(), NodeGeometry<NDIM>::toNodeBox(W_nc_data->getBox()));
+                        const Box<NDIM> node_box = NodeGeometry<NDIM>::toNodeBox(W_nc_data->getBox());
+                        if (d_use_counter_based_rng)
+                            genrandn(W_nc_data->getArrayData(), node_box, rng_key, compute_rng_stream(level_num, k, 1));
+                        else
+                            genrandn(W_nc_data->getArrayData(), node_box);
 #endif
 #if (NDIM == 3)
                         Pointer<EdgeData<NDIM, double> > W_ec_data = patch->getPatchData(d_W_ec_idxs[k]);
                         for (int d = 0; d < NDIM; ++d)
                         {
-                            genrandn(W_ec_data->getArrayData(d), EdgeGeometry<NDIM>::toEdgeBox(W_ec_data->getBox(), d));
+                            const Box<NDIM> edge_box = EdgeGeometry<NDIM>::toEdgeBox(W_ec_data->getBox(), d);
+                            if (d_use_counter_based_rng)
+                                genrandn(W_ec_data->getArrayData(d),
+                                         edge_box,
+                                         rng_key,
+                                         compute_rng_stream(level_num, k, 1 + d));
+                            else
+                                genrandn(W_ec_data->getArrayData(d), edge_box);
                         }
 #endif
                     }
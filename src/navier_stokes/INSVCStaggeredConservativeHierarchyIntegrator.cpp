@@ -37,6 +37,7 @@
 #include "ibtk/PoissonSolver.h"
 #include "ibtk/SideDataSynchronization.h"
 #include "ibtk/ibtk_enums.h"
+#include "ibtk/profiling_annotations.h"
 
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
@@ -225,6 +226,7 @@ INSVCStaggeredConservativeHierarchyIntegrator::preprocessIntegrateHierarchy(cons
                                                                             const double new_time,
                                                                             const int num_cycles)
 {
+    IBTK_PROFILING_REGION("INSVCStaggeredConservativeHierarchyIntegrator::preprocessIntegrateHierarchy");
     INSVCStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy(current_time, new_time, num_cycles);
     const double dt = new_time - current_time;
 
@@ -535,6 +537,7 @@ INSVCStaggeredConservativeHierarchyIntegrator::integrateHierarchy(const double c
                                                                   const double new_time,
                                                                   const int cycle_num)
 {
+    IBTK_PROFILING_REGION("INSVCStaggeredConservativeHierarchyIntegrator::integrateHierarchy");
     INSVCStaggeredHierarchyIntegrator::integrateHierarchy(current_time, new_time, cycle_num);
 
     // Get the coarsest and finest level numbers.
@@ -836,6 +839,7 @@ INSVCStaggeredConservativeHierarchyIntegrator::postprocessIntegrateHierarchy(con
                                                                              const bool skip_synchronize_new_state_data,
                                                                              const int num_cycles)
 {
+    IBTK_PROFILING_REGION("INSVCStaggeredConservativeHierarchyIntegrator::postprocessIntegrateHierarchy");
     INSVCStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(
         current_time, new_time, skip_synchronize_new_state_data, num_cycles);
 
@@ -938,20 +942,6 @@ INSVCStaggeredConservativeHierarchyIntegrator::resetHierarchyConfigurationSpecia
     return;
 } // resetHierarchyConfigurationSpecialized
 
-void
-INSVCStaggeredConservativeHierarchyIntegrator::applyGradientDetectorSpecialized(
-    const Pointer<BasePatchHierarchy<NDIM> > hierarchy,
-    const int level_number,
-    const double error_data_time,
-    const int tag_index,
-    const bool initial_time,
-    const bool uses_richardson_extrapolation_too)
-{
-    INSVCStaggeredHierarchyIntegrator::applyGradientDetectorSpecialized(
-        hierarchy, level_number, error_data_time, tag_index, initial_time, uses_richardson_extrapolation_too);
-    return;
-} // applyGradientDetectorSpecialized
-
 void
 INSVCStaggeredConservativeHierarchyIntegrator::setupPlotDataSpecialized()
 {
@@ -1248,7 +1238,7 @@ INSVCStaggeredConservativeHierarchyIntegrator::updateOperatorsAndSolvers(const d
     // correct intervals or
     // when the time step size changes.
     const bool dt_change = initial_time || !MathUtilities<double>::equalEps(dt, d_dt_previous[0]);
-    const bool precond_reinit = d_integrator_step % d_precond_reinit_interval == 0;
+    const bool precond_reinit = preconditionersNeedReinit();
     if (precond_reinit)
     {
         d_velocity_solver_needs_init = true;
@@ -51,6 +51,7 @@
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
 #include <array>
 #include <limits>
 #include <memory>
@@ -952,6 +953,61 @@ static const int NOGHOSTS = 0;
 // free condition
 static const int CF_GHOST_WIDTH = 1;
 
+// Scratch data used to advance the density and to compute the convective
+// derivative on one tile of a patch. If the tile is the entire patch then the
+// side-centered data are the patch data themselves. Otherwise they are
+// tile-local data with the same ghost cell widths as the patch data.
+struct TileScratchData
+{
+    Box<NDIM> tile_box, patch_box;
+    const double* dx = nullptr;
+    bool is_patch = true;
+    Pointer<SideData<NDIM, double> > N_data, V_data, R_cur_data, R_pre_data, R_new_data, R_src_data;
+    Pointer<SideData<NDIM, double> > N_patch_data, V_patch_data, R_cur_patch_data, R_pre_patch_data,
+        R_new_patch_data, R_src_patch_data;
+    std::array<Box<NDIM>, NDIM> side_boxes;
+    std::array<Pointer<FaceData<NDIM, double> >, NDIM> V_adv_data, V_half_data, R_half_data, P_half_data;
+};
+
+// Partition a box into tiles with at most tile_size cells in each coordinate
+// direction. A nonpositive tile_size yields the box itself.
+std::vector<Box<NDIM> >
+partition_box(const Box<NDIM>& box, const int tile_size)
+{
+    std::vector<Box<NDIM> > tiles;
+    if (tile_size <= 0)
+    {
+        tiles.push_back(box);
+        return tiles;
+    }
+    IntVector<NDIM> num_tiles;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        num_tiles(d) = (box.numberCells(d) + tile_size - 1) / tile_size;
+    }
+    const int total_num_tiles = num_tiles.getProduct();
+    tiles.reserve(total_num_tiles);
+    for (int t = 0; t < total_num_tiles; ++t)
+    {
+        Box<NDIM> tile_box = box;
+        int offset = t;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            tile_box.lower(d) = box.lower(d) + (offset % num_tiles(d)) * tile_size;
+            tile_box.upper(d) = std::min(box.upper(d), tile_box.lower(d) + tile_size - 1);
+            offset /= num_tiles(d);
+        }
+        tiles.push_back(tile_box);
+    }
+    return tiles;
+} // partition_box
+
+inline Pointer<SideData<NDIM, double> >
+allocate_tile_data(const Box<NDIM>& tile_box, const Pointer<SideData<NDIM, double> >& patch_data)
+{
+    return new SideData<NDIM, double>(tile_box, patch_data->getDepth(), patch_data->getGhostCellWidth());
+} // allocate_tile_data
+
 // Timers.
 static Timer* t_apply_convective_operator;
 static Timer* t_integrate;
@@ -1008,6 +1064,10 @@ INSVCStaggeredConservativeMassMomentumIntegrator::INSVCStaggeredConservativeMass
         {
             d_enable_logging = input_db->getBool("enable_logging");
         }
+        if (input_db->keyExists("tile_size"))
+        {
+            d_tile_size = input_db->getInteger("tile_size");
+        }
     }
 
     switch (d_velocity_convective_limiter)
@@ -1374,129 +1434,209 @@ INSVCStaggeredConservativeMassMomentumIntegrator::integrate(double dt)
             d_hier_sc_data_ops->setToScalar(d_S_scratch_idx, 0.0);
         }
 
+        // Determine the coefficients of the density update and whether the
+        // convective derivative is computed during this stage.
+        double a0, a1, a2;
+        switch (step)
+        {
+        case 0:
+            a0 = 0.5;
+            a1 = 0.5;
+            a2 = 1.0;
+            break;
+        case 1:
+            if (d_density_time_stepping_type == SSPRK2)
+            {
+                a0 = 0.5;
+                a1 = 0.5;
+                a2 = 0.5;
+                break;
+            }
+            else if (d_density_time_stepping_type == SSPRK3)
+            {
+                a0 = 0.75;
+                a1 = 0.25;
+                a2 = 0.25;
+                break;
+            }
+            else
+            {
+                TBOX_ERROR("This statement should not be reached");
+                break;
+            }
+        case 2:
+            a0 = 1.0 / 3.0;
+            a1 = 2.0 / 3.0;
+            a2 = 2.0 / 3.0;
+            break;
+        default:
+            TBOX_ERROR("This statement should not be reached");
+        }
+        const bool compute_convective_derivative = (d_density_time_stepping_type == FORWARD_EULER && step == 0) ||
+                                                   (d_density_time_stepping_type == SSPRK2 && step == 1) ||
+                                                   (d_density_time_stepping_type == SSPRK3 && step == 2);
+
+        // The PPM limiter allocates patch data, which is not thread safe, so
+        // the tiles are only processed concurrently with the other limiters.
+        const bool process_tiles_concurrently =
+            d_density_convective_limiter != PPM &&
+            (!compute_convective_derivative || d_velocity_convective_limiter != PPM);
+
+        if (compute_convective_derivative) IBAMR_TIMER_START(t_apply_convective_operator);
         for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
         {
+            // Set up the tiles and allocate all scratch data before entering
+            // the (possibly) threaded region.
             Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            std::vector<TileScratchData> tiles;
             for (PatchLevel<NDIM>::Iterator p(level); p; p++)
             {
                 Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
                 const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-                const double* const dx = patch_geom->getDx();
-
                 const Box<NDIM>& patch_box = patch->getBox();
-                const IntVector<NDIM>& patch_lower = patch_box.lower();
-                const IntVector<NDIM>& patch_upper = patch_box.upper();
-
-                Pointer<SideData<NDIM, double> > N_data = patch->getPatchData(d_N_idx);
-                Pointer<SideData<NDIM, double> > V_data = patch->getPatchData(d_V_scratch_idx);
-                Pointer<SideData<NDIM, double> > R_cur_data = patch->getPatchData(d_rho_sc_current_idx);
-                Pointer<SideData<NDIM, double> > R_pre_data = patch->getPatchData(d_rho_sc_scratch_idx);
-                Pointer<SideData<NDIM, double> > R_new_data = patch->getPatchData(d_rho_sc_new_idx);
-                Pointer<SideData<NDIM, double> > R_src_data = patch->getPatchData(d_S_scratch_idx);
-
-                // Define variables that live on the "faces" of control
-                // volumes centered about side-centered staggered velocity
-                // components
-                const IntVector<NDIM> ghosts = IntVector<NDIM>(1);
-                std::array<Box<NDIM>, NDIM> side_boxes;
-                std::array<Pointer<FaceData<NDIM, double> >, NDIM> V_adv_data;
-                std::array<Pointer<FaceData<NDIM, double> >, NDIM> V_half_data;
-                std::array<Pointer<FaceData<NDIM, double> >, NDIM> R_half_data;
-                std::array<Pointer<FaceData<NDIM, double> >, NDIM> P_half_data;
-                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                for (const Box<NDIM>& tile_box : partition_box(patch_box, d_tile_size))
+                {
+                    TileScratchData tile;
+                    tile.tile_box = tile_box;
+                    tile.patch_box = patch_box;
+                    tile.dx = patch_geom->getDx();
+                    tile.N_patch_data = patch->getPatchData(d_N_idx);
+                    tile.V_patch_data = patch->getPatchData(d_V_scratch_idx);
+                    tile.R_cur_patch_data = patch->getPatchData(d_rho_sc_current_idx);
+                    tile.R_pre_patch_data = patch->getPatchData(d_rho_sc_scratch_idx);
+                    tile.R_new_patch_data = patch->getPatchData(d_rho_sc_new_idx);
+                    tile.R_src_patch_data = patch->getPatchData(d_S_scratch_idx);
+                    tile.is_patch = tile_box == patch_box;
+                    if (tile.is_patch)
+                    {
+                        tile.N_data = tile.N_patch_data;
+                        tile.V_data = tile.V_patch_data;
+                        tile.R_cur_data = tile.R_cur_patch_data;
+                        tile.R_pre_data = tile.R_pre_patch_data;
+                        tile.R_new_data = tile.R_new_patch_data;
+                        tile.R_src_data = tile.R_src_patch_data;
+                    }
+                    else
+                    {
+                        tile.N_data = allocate_tile_data(tile_box, tile.N_patch_data);
+                        tile.V_data = allocate_tile_data(tile_box, tile.V_patch_data);
+                        tile.R_cur_data = allocate_tile_data(tile_box, tile.R_cur_patch_data);
+                        tile.R_pre_data = allocate_tile_data(tile_box, tile.R_pre_patch_data);
+                        tile.R_new_data = allocate_tile_data(tile_box, tile.R_new_patch_data);
+                        tile.R_src_data = allocate_tile_data(tile_box, tile.R_src_patch_data);
+                    }
+
+                    // Define variables that live on the "faces" of control
+                    // volumes centered about side-centered staggered velocity
+                    // components
+                    const IntVector<NDIM> ghosts = IntVector<NDIM>(1);
+                    for (unsigned int axis = 0; axis < NDIM; ++axis)
+                    {
+                        tile.side_boxes[axis] = SideGeometry<NDIM>::toSideBox(tile_box, axis);
+                        tile.V_adv_data[axis] = new FaceData<NDIM, double>(tile.side_boxes[axis], 1, ghosts);
+                        tile.R_half_data[axis] = new FaceData<NDIM, double>(tile.side_boxes[axis], 1, ghosts);
+                        if (compute_convective_derivative)
+                        {
+                            tile.V_half_data[axis] = new FaceData<NDIM, double>(tile.side_boxes[axis], 1, ghosts);
+                            tile.P_half_data[axis] = new FaceData<NDIM, double>(tile.side_boxes[axis], 1, ghosts);
+                        }
+                    }
+                    tiles.push_back(tile);
+                }
+            }
+
+            // Each tile only modifies its own scratch data and the sides of
+            // the patch data that it owns.
+            const int num_tiles = static_cast<int>(tiles.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (process_tiles_concurrently)
+#endif
+            for (int tile_num = 0; tile_num < num_tiles; ++tile_num)
+            {
+                TileScratchData& tile = tiles[tile_num];
+                if (!tile.is_patch)
                 {
-                    side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-                    V_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                    V_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                    R_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                    P_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
+                    tile.V_data->copy(*tile.V_patch_data);
+                    tile.R_cur_data->copy(*tile.R_cur_patch_data);
+                    tile.R_pre_data->copy(*tile.R_pre_patch_data);
+                    tile.R_src_data->copy(*tile.R_src_patch_data);
                 }
+
+                const IntVector<NDIM>& tile_lower = tile.tile_box.lower();
+                const IntVector<NDIM>& tile_upper = tile.tile_box.upper();
+
                 // Interpolate velocity components onto "faces" using simple averages.
-                computeAdvectionVelocity(V_adv_data, V_data, patch_lower, patch_upper, side_boxes);
+                computeAdvectionVelocity(tile.V_adv_data, tile.V_data, tile_lower, tile_upper, tile.side_boxes);
 
                 // Upwind side-centered densities onto faces.
-                interpolateSideQuantity(R_half_data,
-                                        V_adv_data,
-                                        R_pre_data,
-                                        patch_lower,
-                                        patch_upper,
-                                        side_boxes,
+                interpolateSideQuantity(tile.R_half_data,
+                                        tile.V_adv_data,
+                                        tile.R_pre_data,
+                                        tile_lower,
+                                        tile_upper,
+                                        tile.side_boxes,
                                         d_density_convective_limiter);
 
                 // Compute the convective derivative with the penultimate density and
                 // velocity, if necessary
-                if ((d_density_time_stepping_type == FORWARD_EULER && step == 0) ||
-                    (d_density_time_stepping_type == SSPRK2 && step == 1) ||
-                    (d_density_time_stepping_type == SSPRK3 && step == 2))
+                if (compute_convective_derivative)
                 {
-                    interpolateSideQuantity(V_half_data,
-                                            V_adv_data,
-                                            V_data,
-                                            patch_lower,
-                                            patch_upper,
-                                            side_boxes,
+                    interpolateSideQuantity(tile.V_half_data,
+                                            tile.V_adv_data,
+                                            tile.V_data,
+                                            tile_lower,
+                                            tile_upper,
+                                            tile.side_boxes,
                                             d_velocity_convective_limiter);
 
-                    IBAMR_TIMER_START(t_apply_convective_operator);
-
-                    computeConvectiveDerivative(
-                        N_data, P_half_data, V_adv_data, R_half_data, V_half_data, side_boxes, dx);
-
-                    IBAMR_TIMER_STOP(t_apply_convective_operator);
+                    computeConvectiveDerivative(tile.N_data,
+                                                tile.P_half_data,
+                                                tile.V_adv_data,
+                                                tile.R_half_data,
+                                                tile.V_half_data,
+                                                tile.side_boxes,
+                                                tile.dx);
                 }
 
                 // Compute the updated density
-                double a0, a1, a2;
-                switch (step)
-                {
-                case 0:
-                    a0 = 0.5;
-                    a1 = 0.5;
-                    a2 = 1.0;
-                    break;
-                case 1:
-                    if (d_density_time_stepping_type == SSPRK2)
-                    {
-                        a0 = 0.5;
-                        a1 = 0.5;
-                        a2 = 0.5;
-                        break;
-                    }
-                    else if (d_density_time_stepping_type == SSPRK3)
-                    {
-                        a0 = 0.75;
-                        a1 = 0.25;
-                        a2 = 0.25;
-                        break;
-                    }
-                    else
-                    {
-                        TBOX_ERROR("This statement should not be reached");
-                        break;
-                    }
-                case 2:
-                    a0 = 1.0 / 3.0;
-                    a1 = 2.0 / 3.0;
-                    a2 = 2.0 / 3.0;
-                    break;
-                default:
-                    TBOX_ERROR("This statement should not be reached");
-                }
-                computeDensityUpdate(R_new_data,
+                computeDensityUpdate(tile.R_new_data,
                                      a0,
-                                     R_cur_data,
+                                     tile.R_cur_data,
                                      a1,
-                                     R_pre_data,
+                                     tile.R_pre_data,
                                      a2,
-                                     V_adv_data,
-                                     R_half_data,
-                                     R_src_data,
-                                     side_boxes,
+                                     tile.V_adv_data,
+                                     tile.R_half_data,
+                                     tile.R_src_data,
+                                     tile.side_boxes,
                                      dt,
-                                     dx);
+                                     tile.dx);
+
+                // Copy the computed values back into the patch data. Sides on
+                // the upper boundary of a tile are shared with the next tile
+                // in that direction and are only copied by the tile that owns
+                // them.
+                if (!tile.is_patch)
+                {
+                    for (unsigned int axis = 0; axis < NDIM; ++axis)
+                    {
+                        Box<NDIM> owned_side_box = tile.side_boxes[axis];
+                        if (tile.tile_box.upper(axis) < tile.patch_box.upper(axis))
+                        {
+                            owned_side_box.upper(axis) = tile.tile_box.upper(axis);
+                        }
+                        tile.R_new_patch_data->getArrayData(axis).copy(tile.R_new_data->getArrayData(axis),
+                                                                       owned_side_box);
+                        if (compute_convective_derivative)
+                        {
+                            tile.N_patch_data->getArrayData(axis).copy(tile.N_data->getArrayData(axis),
+                                                                       owned_side_box);
+                        }
+                    }
+                }
             }
         }
+        if (compute_convective_derivative) IBAMR_TIMER_STOP(t_apply_convective_operator);
     }
 
     // Refill boundary values of newest density
@@ -47,6 +47,7 @@
 #include "ibtk/LinearOperator.h"
 #include "ibtk/LinearSolver.h"
 #include "ibtk/NewtonKrylovSolver.h"
+#include "ibtk/NormOps.h"
 #include "ibtk/PETScKrylovLinearSolver.h"
 #include "ibtk/PETScKrylovPoissonSolver.h"
 #include "ibtk/PoissonFACPreconditioner.h"
@@ -57,6 +58,7 @@
 #include "ibtk/VCSCViscousOperator.h"
 #include "ibtk/VCSCViscousPETScLevelSolver.h"
 #include "ibtk/ibtk_enums.h"
+#include "ibtk/profiling_annotations.h"
 
 #include "ArrayData.h"
 #include "BasePatchHierarchy.h"
@@ -97,6 +99,8 @@
 #include "RobinBcCoefStrategy.h"
 #include "SAMRAIVectorReal.h"
 #include "SideData.h"
+#include "SideGeometry.h"
+#include "SideIndex.h"
 #include "SideVariable.h"
 #include "Variable.h"
 #include "VariableContext.h"
@@ -224,6 +228,68 @@ static const std::string DEFAULT_VC_VELOCITY_SOLVER = "VC_VELOCITY_PETSC_KRYLOV_
 static const std::string DEFAULT_VC_VELOCITY_PRECOND = "VC_VELOCITY_POINT_RELAXATION_FAC_PRECONDITIONER";
 static const std::string DEFAULT_VC_VELOCITY_LEVEL_SOLVER = "VC_VELOCITY_PETSC_LEVEL_SOLVER";
 
+// Accumulate the largest difference between the values of two patch data
+// objects and the largest magnitude of the values of the reference data in the
+// patch interior.
+void
+accumulate_max_change(const CellData<NDIM, double>& data,
+                      const CellData<NDIM, double>& ref_data,
+                      const Box<NDIM>& patch_box,
+                      double& max_change,
+                      double& max_ref)
+{
+    for (Box<NDIM>::Iterator b(patch_box); b; b++)
+    {
+        const CellIndex<NDIM> i(b());
+        max_change = std::max(max_change, std::abs(data(i) - ref_data(i)));
+        max_ref = std::max(max_ref, std::abs(ref_data(i)));
+    }
+    return;
+} // accumulate_max_change
+
+void
+accumulate_max_change(const SideData<NDIM, double>& data,
+                      const SideData<NDIM, double>& ref_data,
+                      const Box<NDIM>& patch_box,
+                      double& max_change,
+                      double& max_ref)
+{
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
+        {
+            const SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
+            max_change = std::max(max_change, std::abs(data(i) - ref_data(i)));
+            max_ref = std::max(max_ref, std::abs(ref_data(i)));
+        }
+    }
+    return;
+} // accumulate_max_change
+
+// Compute the relative change, in the maximum norm, between the data of two
+// patch data indices.
+template <class DataType>
+double
+compute_relative_change(const int idx, const int ref_idx, Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+    double max_change = 0.0, max_ref = 0.0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<DataType> data = patch->getPatchData(idx);
+            Pointer<DataType> ref_data = patch->getPatchData(ref_idx);
+            accumulate_max_change(*data, *ref_data, patch->getBox(), max_change, max_ref);
+        }
+    }
+    max_change = IBTK_MPI::maxReduction(max_change);
+    max_ref = IBTK_MPI::maxReduction(max_ref);
+    return max_ref > 0.0 ? max_change / max_ref : max_change;
+} // compute_relative_change
+
 // Copy data from a side-centered variable to a face-centered variable.
 void
 copy_side_to_face(const int U_fc_idx, const int U_sc_idx, Pointer<PatchHierarchy<NDIM> > hierarchy)
@@ -442,6 +508,8 @@ INSVCStaggeredHierarchyIntegrator::INSVCStaggeredHierarchyIntegrator(std::string
                                  << " preconditioner reinitialization interval\n"
                                  << " must be a positive integer");
     }
+    if (input_db->keyExists("precond_reinit_coef_change_tol"))
+        d_precond_reinit_coef_change_tol = input_db->getDouble("precond_reinit_coef_change_tol");
 
     // Check to make sure the time stepping types are supported.
     switch (d_viscous_time_stepping_type)
@@ -1045,6 +1113,13 @@ INSVCStaggeredHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHi
     d_velocity_D_cc_var = new CellVariable<NDIM, double>(d_object_name + "::velocity_D_cc");
     d_velocity_D_cc_idx = var_db->registerVariableAndContext(d_velocity_D_cc_var, getCurrentContext(), no_ghosts);
 
+    // Copies of the coefficients that were used the last time that the solvers
+    // were initialized.  These are kept between time steps.
+    Pointer<VariableContext> precond_coefs_ctx = var_db->getContext(d_object_name + "::precond_coefs");
+    d_pressure_D_precond_idx = var_db->registerVariableAndContext(d_pressure_D_var, precond_coefs_ctx, no_ghosts);
+    d_velocity_D_cc_precond_idx =
+        var_db->registerVariableAndContext(d_velocity_D_cc_var, precond_coefs_ctx, no_ghosts);
+
     d_temp_sc_var = new SideVariable<NDIM, double>(d_object_name + "::temp_sc");
     d_temp_sc_idx = var_db->registerVariableAndContext(d_temp_sc_var, getCurrentContext(), no_ghosts);
     d_temp_cc_var = new CellVariable<NDIM, double>(d_object_name + ":temp_cc",
@@ -1177,6 +1252,7 @@ INSVCStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy(const double cur
                                                                 const double new_time,
                                                                 const int num_cycles)
 {
+    IBTK_PROFILING_REGION("INSVCStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy");
     INSHierarchyIntegrator::preprocessIntegrateHierarchy(current_time, new_time, num_cycles);
 
     const int coarsest_ln = 0;
@@ -1186,8 +1262,8 @@ INSVCStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy(const double cur
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_scratch_data, current_time);
-        level->allocatePatchData(d_new_data, new_time);
+        allocateLevelPatchData(level, d_scratch_data, current_time);
+        allocateLevelPatchData(level, d_new_data, new_time);
         level->allocatePatchData(d_velocity_C_idx, current_time);
         level->allocatePatchData(d_velocity_L_idx, current_time);
         level->allocatePatchData(d_velocity_rhs_C_idx, current_time);
@@ -1228,6 +1304,7 @@ INSVCStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(const double cu
                                                                  const bool skip_synchronize_new_state_data,
                                                                  const int num_cycles)
 {
+    IBTK_PROFILING_REGION("INSVCStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy");
     INSHierarchyIntegrator::postprocessIntegrateHierarchy(
         current_time, new_time, skip_synchronize_new_state_data, num_cycles);
 
@@ -1524,9 +1601,10 @@ INSVCStaggeredHierarchyIntegrator::regridHierarchyBeginSpecialized()
                          d_Q_current_idx,
                          d_Q_var);
     const int wgt_cc_idx = d_hier_math_ops->getCellWeightPatchDescriptorIndex();
-    d_div_U_norm_1_pre = d_hier_cc_data_ops->L1Norm(d_Div_U_idx, wgt_cc_idx);
-    d_div_U_norm_2_pre = d_hier_cc_data_ops->L2Norm(d_Div_U_idx, wgt_cc_idx);
-    d_div_U_norm_oo_pre = d_hier_cc_data_ops->maxNorm(d_Div_U_idx, wgt_cc_idx);
+    const NormOps::Norms div_U_norms = NormOps::norms(d_hierarchy, { d_Div_U_idx }, { wgt_cc_idx })[0];
+    d_div_U_norm_1_pre = div_U_norms.L1;
+    d_div_U_norm_2_pre = div_U_norms.L2;
+    d_div_U_norm_oo_pre = div_U_norms.max;
 
     return;
 } // regridHierarchyBeginSpecialized
@@ -1547,9 +1625,10 @@ INSVCStaggeredHierarchyIntegrator::regridHierarchyEndSpecialized()
                          -1.0,
                          d_Q_current_idx,
                          d_Q_var);
-    d_div_U_norm_1_post = d_hier_cc_data_ops->L1Norm(d_Div_U_idx, wgt_cc_idx);
-    d_div_U_norm_2_post = d_hier_cc_data_ops->L2Norm(d_Div_U_idx, wgt_cc_idx);
-    d_div_U_norm_oo_post = d_hier_cc_data_ops->maxNorm(d_Div_U_idx, wgt_cc_idx);
+    const NormOps::Norms div_U_norms = NormOps::norms(d_hierarchy, { d_Div_U_idx }, { wgt_cc_idx })[0];
+    d_div_U_norm_1_post = div_U_norms.L1;
+    d_div_U_norm_2_post = div_U_norms.L2;
+    d_div_U_norm_oo_post = div_U_norms.max;
     d_do_regrid_projection = d_div_U_norm_1_post > d_regrid_max_div_growth_factor * d_div_U_norm_1_pre ||
                              d_div_U_norm_2_post > d_regrid_max_div_growth_factor * d_div_U_norm_2_pre ||
                              d_div_U_norm_oo_post > d_regrid_max_div_growth_factor * d_div_U_norm_oo_pre;
@@ -1837,79 +1916,15 @@ INSVCStaggeredHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
     d_velocity_solver_needs_init = true;
     d_pressure_solver_needs_init = true;
     d_stokes_solver_needs_init = true;
+    d_precond_coefs_stored = false;
     return;
 } // resetHierarchyConfigurationSpecialized
 
-void
-INSVCStaggeredHierarchyIntegrator::applyGradientDetectorSpecialized(const Pointer<BasePatchHierarchy<NDIM> > hierarchy,
-                                                                    const int level_number,
-                                                                    const double /*error_data_time*/,
-                                                                    const int tag_index,
-                                                                    const bool /*initial_time*/,
-                                                                    const bool /*uses_richardson_extrapolation_too*/)
+int
+INSVCStaggeredHierarchyIntegrator::getVorticityPatchDataIndex() const
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT(hierarchy);
-    TBOX_ASSERT((level_number >= 0) && (level_number <= hierarchy->getFinestLevelNumber()));
-    TBOX_ASSERT(hierarchy->getPatchLevel(level_number));
-#endif
-    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
-
-    // Tag cells based on the magnitude of the vorticity.
-    //
-    // Note that if either the relative or absolute threshold is zero for a
-    // particular level, no tagging is performed on that level.
-    if (d_using_vorticity_tagging)
-    {
-        double Omega_rel_thresh = 0.0;
-        if (d_Omega_rel_thresh.size() > 0)
-        {
-            Omega_rel_thresh = d_Omega_rel_thresh[std::max(std::min(level_number, d_Omega_rel_thresh.size() - 1), 0)];
-        }
-        double Omega_abs_thresh = 0.0;
-        if (d_Omega_abs_thresh.size() > 0)
-        {
-            Omega_abs_thresh = d_Omega_abs_thresh[std::max(std::min(level_number, d_Omega_abs_thresh.size() - 1), 0)];
-        }
-        if (Omega_rel_thresh > 0.0 || Omega_abs_thresh > 0.0)
-        {
-            double thresh = std::numeric_limits<double>::max();
-            if (Omega_rel_thresh > 0.0) thresh = std::min(thresh, Omega_rel_thresh * d_Omega_max);
-            if (Omega_abs_thresh > 0.0) thresh = std::min(thresh, Omega_abs_thresh);
-            thresh += std::sqrt(std::numeric_limits<double>::epsilon());
-            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-            {
-                Pointer<Patch<NDIM> > patch = level->getPatch(p());
-                const Box<NDIM>& patch_box = patch->getBox();
-                Pointer<CellData<NDIM, int> > tags_data = patch->getPatchData(tag_index);
-                Pointer<CellData<NDIM, double> > Omega_data = patch->getPatchData(d_Omega_idx);
-                for (CellIterator<NDIM> ic(patch_box); ic; ic++)
-                {
-                    const hier::Index<NDIM>& i = ic();
-#if (NDIM == 2)
-                    if (std::abs((*Omega_data)(i)) > thresh)
-                    {
-                        (*tags_data)(i) = 1;
-                    }
-#endif
-#if (NDIM == 3)
-                    double norm_Omega_sq = 0.0;
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        norm_Omega_sq += (*Omega_data)(i, d) * (*Omega_data)(i, d);
-                    }
-                    const double norm_Omega = std::sqrt(norm_Omega_sq);
-                    if (norm_Omega > thresh)
-                    {
-                        (*tags_data)(i) = 1;
-                    }
-#endif
-                }
-            }
-        }
-    }
-    return;
-} // applyGradientDetectorSpecialized
+    return d_Omega_idx;
+} // getVorticityPatchDataIndex
 
 void
 INSVCStaggeredHierarchyIntegrator::setupPlotDataSpecialized()
@@ -1988,6 +2003,58 @@ INSVCStaggeredHierarchyIntegrator::setupPlotDataSpecialized()
     return;
 } // setupPlotDataSpecialized
 
+bool
+INSVCStaggeredHierarchyIntegrator::preconditionersNeedReinit()
+{
+    bool reinit = d_integrator_step % d_precond_reinit_interval == 0;
+    if (d_precond_reinit_coef_change_tol <= 0.0) return reinit;
+
+    // Compare the current coefficients to those used the last time that the
+    // solvers were initialized.
+    const bool check_rho = !d_rho_is_const, check_mu = !d_mu_is_const;
+    if (!reinit && !d_precond_coefs_stored) reinit = check_rho || check_mu;
+    if (!reinit && check_rho)
+    {
+        const double rho_change =
+            compute_relative_change<SideData<NDIM, double> >(d_pressure_D_idx, d_pressure_D_precond_idx, d_hierarchy);
+        reinit = rho_change > d_precond_reinit_coef_change_tol;
+    }
+    if (!reinit && check_mu)
+    {
+        const double mu_change = compute_relative_change<CellData<NDIM, double> >(
+            d_velocity_D_cc_idx, d_velocity_D_cc_precond_idx, d_hierarchy);
+        reinit = mu_change > d_precond_reinit_coef_change_tol;
+    }
+
+    // Store the coefficients that will be used to reinitialize the solvers.
+    if (reinit && (check_rho || check_mu))
+    {
+        const int finest_ln = d_hierarchy->getFinestLevelNumber();
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            if (check_rho && !level->checkAllocated(d_pressure_D_precond_idx))
+                level->allocatePatchData(d_pressure_D_precond_idx);
+            if (check_mu && !level->checkAllocated(d_velocity_D_cc_precond_idx))
+                level->allocatePatchData(d_velocity_D_cc_precond_idx);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                if (check_rho)
+                {
+                    patch->getPatchData(d_pressure_D_precond_idx)->copy(*patch->getPatchData(d_pressure_D_idx));
+                }
+                if (check_mu)
+                {
+                    patch->getPatchData(d_velocity_D_cc_precond_idx)->copy(*patch->getPatchData(d_velocity_D_cc_idx));
+                }
+            }
+        }
+        d_precond_coefs_stored = true;
+    }
+    return reinit;
+} // preconditionersNeedReinit
+
 void
 INSVCStaggeredHierarchyIntegrator::copySideToFace(const int U_fc_idx,
                                                   const int U_sc_idx,
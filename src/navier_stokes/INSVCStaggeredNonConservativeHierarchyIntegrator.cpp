@@ -37,6 +37,7 @@
 #include "ibtk/PoissonSolver.h"
 #include "ibtk/SideDataSynchronization.h"
 #include "ibtk/ibtk_enums.h"
+#include "ibtk/profiling_annotations.h"
 
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
@@ -279,6 +280,7 @@ INSVCStaggeredNonConservativeHierarchyIntegrator::preprocessIntegrateHierarchy(c
                                                                                const double new_time,
                                                                                const int num_cycles)
 {
+    IBTK_PROFILING_REGION("INSVCStaggeredNonConservativeHierarchyIntegrator::preprocessIntegrateHierarchy");
     INSVCStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy(current_time, new_time, num_cycles);
 
     // Keep track of the number of cycles to be used for the present integration
@@ -564,6 +566,7 @@ INSVCStaggeredNonConservativeHierarchyIntegrator::integrateHierarchy(const doubl
                                                                      const double new_time,
                                                                      const int cycle_num)
 {
+    IBTK_PROFILING_REGION("INSVCStaggeredNonConservativeHierarchyIntegrator::integrateHierarchy");
     INSVCStaggeredHierarchyIntegrator::integrateHierarchy(current_time, new_time, cycle_num);
 
     // Get the coarsest and finest level numbers.
@@ -874,6 +877,7 @@ INSVCStaggeredNonConservativeHierarchyIntegrator::postprocessIntegrateHierarchy(
     const bool skip_synchronize_new_state_data,
     const int num_cycles)
 {
+    IBTK_PROFILING_REGION("INSVCStaggeredNonConservativeHierarchyIntegrator::postprocessIntegrateHierarchy");
     INSVCStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(
         current_time, new_time, skip_synchronize_new_state_data, num_cycles);
 
@@ -964,20 +968,6 @@ INSVCStaggeredNonConservativeHierarchyIntegrator::resetHierarchyConfigurationSpe
     return;
 } // resetHierarchyConfigurationSpecialized
 
-void
-INSVCStaggeredNonConservativeHierarchyIntegrator::applyGradientDetectorSpecialized(
-    const Pointer<BasePatchHierarchy<NDIM> > hierarchy,
-    const int level_number,
-    const double error_data_time,
-    const int tag_index,
-    const bool initial_time,
-    const bool uses_richardson_extrapolation_too)
-{
-    INSVCStaggeredHierarchyIntegrator::applyGradientDetectorSpecialized(
-        hierarchy, level_number, error_data_time, tag_index, initial_time, uses_richardson_extrapolation_too);
-    return;
-} // applyGradientDetectorSpecialized
-
 void
 INSVCStaggeredNonConservativeHierarchyIntegrator::setupPlotDataSpecialized()
 {
@@ -1371,7 +1361,7 @@ INSVCStaggeredNonConservativeHierarchyIntegrator::updateOperatorsAndSolvers(cons
     // Ensure that solver components are appropriately reinitialized at the
     // correct intervals or when the time step size changes.
     const bool dt_change = initial_time || !MathUtilities<double>::equalEps(dt, d_dt_previous[0]);
-    const bool precond_reinit = d_integrator_step % d_precond_reinit_interval == 0;
+    const bool precond_reinit = preconditionersNeedReinit();
     if (precond_reinit)
     {
         d_velocity_solver_needs_init = true;
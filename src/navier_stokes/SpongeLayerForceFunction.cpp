@@ -20,6 +20,7 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/ibtk_utilities.h"
 
+#include "ArrayData.h"
 #include "Box.h"
 #include "BoxArray.h"
 #include "CartesianGridGeometry.h"
@@ -31,7 +32,6 @@
 #include "PatchData.h"
 #include "SideData.h"
 #include "SideGeometry.h"
-#include "SideIndex.h"
 #include "Variable.h"
 #include "VariableContext.h"
 #include "tbox/Array.h"
@@ -40,6 +40,7 @@
 
 #include <cmath>
 #include <string>
+#include <vector>
 
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 
@@ -65,6 +66,58 @@ smooth_kernel(const double r)
 {
     return std::abs(r) < 1.0 ? 0.5 * (std::cos(M_PI * r) + 1.0) : 0.0;
 } // smooth_kernel
+
+// Set F = -kappa * w * U on box, in which w is the kernel tabulated along the
+// given axis (starting at box.lower(axis)) and U is either the current
+// velocity or the average of the current and new velocities. The data are
+// accessed one grid line at a time so that the innermost loop is contiguous
+// and can be vectorized.
+void
+set_sponge_force(ArrayData<NDIM, double>& F_data,
+                 const int F_depth,
+                 const ArrayData<NDIM, double>& U_current_data,
+                 const ArrayData<NDIM, double>* const U_new_data,
+                 const int U_depth,
+                 const Box<NDIM>& box,
+                 const unsigned int axis,
+                 const std::vector<double>& w,
+                 const double kappa,
+                 const bool average)
+{
+    if (box.empty()) return;
+    const int n0 = box.numberCells(0);
+    Box<NDIM> line_box = box;
+    line_box.upper(0) = line_box.lower(0);
+    const double c = average ? -0.5 * kappa : -kappa;
+    double* const F_base = F_data.getPointer(F_depth);
+    const double* const U_current_base = U_current_data.getPointer(U_depth);
+    const double* const U_new_base = (average && U_new_data) ? U_new_data->getPointer(U_depth) : nullptr;
+    for (Box<NDIM>::Iterator b(line_box); b; b++)
+    {
+        const hier::Index<NDIM>& i = b();
+        double* const F = F_base + IBTK::array_offset(F_data.getBox(), i);
+        const double* const U_current = U_current_base + IBTK::array_offset(U_current_data.getBox(), i);
+        const double w_line = axis == 0 ? 0.0 : w[i(axis) - box.lower(axis)];
+        if (U_new_base)
+        {
+            const double* const U_new = U_new_base + IBTK::array_offset(U_new_data->getBox(), i);
+            for (int k = 0; k < n0; ++k)
+            {
+                const double w_k = axis == 0 ? w[k] : w_line;
+                F[k] = c * w_k * (U_current[k] + U_new[k]);
+            }
+        }
+        else
+        {
+            for (int k = 0; k < n0; ++k)
+            {
+                const double w_k = axis == 0 ? w[k] : w_line;
+                F[k] = c * w_k * U_current[k];
+            }
+        }
+    }
+    return;
+} // set_sponge_force
 } // namespace
 
 ////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -125,6 +178,23 @@ SpongeLayerForceFunction::setDataOnPatch(const int data_idx,
     if (f_cc_data) f_cc_data->fillAll(0.0);
     if (f_sc_data) f_sc_data->fillAll(0.0);
     if (initial_time) return;
+
+    // Only patches that touch a boundary at which forcing is enabled intersect
+    // the sponge layers, so there is nothing else to do on the other patches.
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    bool touches_sponge_layer = false;
+    for (unsigned int location_index = 0; location_index < 2 * NDIM; ++location_index)
+    {
+        const unsigned int axis = location_index / 2;
+        const unsigned int side = location_index % 2;
+        if (!pgeom->getTouchesRegularBoundary(axis, side)) continue;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            touches_sponge_layer = touches_sponge_layer || d_forcing_enabled[location_index][d];
+        }
+    }
+    if (!touches_sponge_layer) return;
+
     const int cycle_num = d_fluid_solver->getCurrentCycleNumber();
     const double dt = d_fluid_solver->getCurrentTimeStepSize();
     const double rho = d_fluid_solver->getStokesSpecifications()->getRho();
@@ -182,17 +252,27 @@ SpongeLayerForceFunction::setDataOnPatchCell(Pointer<CellData<NDIM, double> > F_
                 {
                     bdry_box.lower(axis) = domain_box.upper(axis) - offset;
                 }
-                for (Box<NDIM>::Iterator b(bdry_box * patch_box); b; b++)
+                const Box<NDIM> box = bdry_box * patch_box;
+                if (box.empty()) continue;
+                const double x_bdry = (is_lower ? x_lower[axis] : x_upper[axis]);
+                std::vector<double> w(box.numberCells(axis));
+                for (int k = 0; k < box.numberCells(axis); ++k)
                 {
-                    const hier::Index<NDIM>& i = b();
-                    const double U_current = U_current_data ? (*U_current_data)(i, d) : 0.0;
-                    const double U_new = U_new_data ? (*U_new_data)(i, d) : 0.0;
-                    const double U = (cycle_num > 0) ? 0.5 * (U_new + U_current) : U_current;
+                    const int i_axis = box.lower(axis) + k;
                     const double x =
-                        x_lower[axis] + dx[axis] * (static_cast<double>(i(axis) - patch_box.lower(axis)) + 0.5);
-                    const double x_bdry = (is_lower ? x_lower[axis] : x_upper[axis]);
-                    (*F_data)(i, d) = smooth_kernel((x - x_bdry) / d_width[location_index]) * kappa * (0.0 - U);
+                        x_lower[axis] + dx[axis] * (static_cast<double>(i_axis - patch_box.lower(axis)) + 0.5);
+                    w[k] = smooth_kernel((x - x_bdry) / d_width[location_index]);
                 }
+                set_sponge_force(F_data->getArrayData(),
+                                 d,
+                                 U_current_data->getArrayData(),
+                                 U_new_data ? &U_new_data->getArrayData() : nullptr,
+                                 d,
+                                 box,
+                                 axis,
+                                 w,
+                                 kappa,
+                                 cycle_num > 0);
             }
         }
     }
@@ -236,17 +316,27 @@ SpongeLayerForceFunction::setDataOnPatchSide(Pointer<SideData<NDIM, double> > F_
                 {
                     bdry_box.lower(axis) = domain_box.upper(axis) - offset;
                 }
-                for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(bdry_box * patch_box, d)); b; b++)
+                const Box<NDIM> cell_box = bdry_box * patch_box;
+                if (cell_box.empty()) continue;
+                const Box<NDIM> box = SideGeometry<NDIM>::toSideBox(cell_box, d);
+                const double x_bdry = (is_lower ? x_lower[axis] : x_upper[axis]);
+                std::vector<double> w(box.numberCells(axis));
+                for (int k = 0; k < box.numberCells(axis); ++k)
                 {
-                    const hier::Index<NDIM>& i = b();
-                    const SideIndex<NDIM> i_s(i, d, SideIndex<NDIM>::Lower);
-                    const double U_current = U_current_data ? (*U_current_data)(i_s) : 0.0;
-                    const double U_new = U_new_data ? (*U_new_data)(i_s) : 0.0;
-                    const double U = (cycle_num > 0) ? 0.5 * (U_new + U_current) : U_current;
-                    const double x = x_lower[axis] + dx[axis] * static_cast<double>(i(axis) - patch_box.lower(axis));
-                    const double x_bdry = (is_lower ? x_lower[axis] : x_upper[axis]);
-                    (*F_data)(i_s) = smooth_kernel((x - x_bdry) / d_width[location_index]) * kappa * (0.0 - U);
+                    const double x =
+                        x_lower[axis] + dx[axis] * static_cast<double>(box.lower(axis) + k - patch_box.lower(axis));
+                    w[k] = smooth_kernel((x - x_bdry) / d_width[location_index]);
                 }
+                set_sponge_force(F_data->getArrayData(d),
+                                 0,
+                                 U_current_data->getArrayData(d),
+                                 U_new_data ? &U_new_data->getArrayData(d) : nullptr,
+                                 0,
+                                 box,
+                                 axis,
+                                 w,
+                                 kappa,
+                                 cycle_num > 0);
             }
         }
     }
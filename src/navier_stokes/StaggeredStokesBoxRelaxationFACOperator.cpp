@@ -17,7 +17,6 @@
 #include "ibamr/StaggeredStokesFACPreconditionerStrategy.h"
 
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
-#include "ibtk/IBTK_CHKERRQ.h"
 
 #include "ArrayData.h"
 #include "BasePatchLevel.h"
@@ -43,15 +42,12 @@
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
-#include "petscksp.h"
-#include "petscmat.h"
-#include "petscpc.h"
-#include "petscsys.h"
-#include "petscvec.h"
+IBTK_DISABLE_EXTRA_WARNINGS
+#include <Eigen/Dense>
+IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <algorithm>
 #include <array>
-#include <limits>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -70,363 +66,137 @@ namespace
 // Number of ghosts cells used for each variable quantity.
 static const int GHOSTS = 1;
 
-inline int
-compute_side_index(const hier::Index<NDIM>& i, const Box<NDIM>& box, const unsigned int axis)
-{
-    const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-    if (!side_box.contains(i)) return -1;
-    int offset = 0;
-    for (unsigned int d = 0; d < axis; ++d)
-    {
-        offset += SideGeometry<NDIM>::toSideBox(box, d).size();
-    }
-    return offset + side_box.offset(i);
-} // compute_side_index
+// Number of unknowns in the box problem for a single cell: the normal velocity
+// components on the 2*NDIM sides of the cell and the cell-centered pressure.
+static const int BOX_SIZE = 2 * NDIM + 1;
+
+// Position of the pressure in the box problem.
+static const int P_DOF = 2 * NDIM;
+
+// Damping factor used in the box relaxation.
+static const double OMEGA = 0.65;
+
+using BoxMatrix = Eigen::Matrix<double, BOX_SIZE, BOX_SIZE, Eigen::RowMajor>;
 
+// Position of the velocity component on the lower (side = 0) or upper (side =
+// 1) side of the cell in the box problem.
 inline int
-compute_cell_index(const hier::Index<NDIM>& i, const Box<NDIM>& box)
+side_dof(const unsigned int axis, const int side)
 {
-    if (!box.contains(i)) return -1;
-    int offset = 0;
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        offset += SideGeometry<NDIM>::toSideBox(box, axis).size();
-    }
-    return box.offset(i) + offset;
-} // compute_cell_index
+    return 2 * static_cast<int>(axis) + side;
+} // side_dof
 
 void
-buildBoxOperator(Mat& A,
-                 const PoissonSpecifications& U_problem_coefs,
-                 const Box<NDIM>& box,
-                 const Box<NDIM>& ghost_box,
-                 const std::array<double, NDIM>& dx)
+buildBoxOperatorInverse(std::array<double, BOX_SIZE * BOX_SIZE>& A_inv,
+                        const PoissonSpecifications& U_problem_coefs,
+                        const std::array<double, NDIM>& dx)
 {
-    int ierr;
-
     const double C = U_problem_coefs.getCConstant();
     const double D = U_problem_coefs.getDConstant();
 
-    // Allocate a PETSc matrix for the box operator.
-    std::array<Box<NDIM>, NDIM> side_boxes;
-    std::array<BoxList<NDIM>, NDIM> side_ghost_boxes;
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        side_boxes[axis] = SideGeometry<NDIM>::toSideBox(box, axis);
-        side_ghost_boxes[axis] = SideGeometry<NDIM>::toSideBox(ghost_box, axis);
-        side_ghost_boxes[axis].removeIntersections(side_boxes[axis]);
-    }
-    BoxList<NDIM> cell_ghost_boxes(ghost_box);
-    cell_ghost_boxes.removeIntersections(box);
-
-    int size = 0;
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        size += SideGeometry<NDIM>::toSideBox(ghost_box, axis).size();
-    }
-    size += ghost_box.size();
-
-    static const int U_stencil_sz = 2 * NDIM + 3;
-    static const int P_stencil_sz = 2 * NDIM + 1;
-    std::vector<int> nnz(size, 0);
-
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        for (Box<NDIM>::Iterator b(side_boxes[axis]); b; b++)
-        {
-            nnz[compute_side_index(b(), ghost_box, axis)] = std::min(size, U_stencil_sz);
-        }
-        for (BoxList<NDIM>::Iterator bl(side_ghost_boxes[axis]); bl; bl++)
-        {
-            for (Box<NDIM>::Iterator b(bl()); b; b++)
-            {
-                nnz[compute_side_index(b(), ghost_box, axis)] = 1;
-            }
-        }
-    }
-
-    for (Box<NDIM>::Iterator b(box); b; b++)
-    {
-        nnz[compute_cell_index(b(), ghost_box)] = std::min(size, P_stencil_sz);
-    }
-    for (BoxList<NDIM>::Iterator bl(cell_ghost_boxes); bl; bl++)
-    {
-        for (Box<NDIM>::Iterator b(bl()); b; b++)
-        {
-            nnz[compute_cell_index(b(), ghost_box)] = 1;
-        }
-    }
-
-    ierr = MatCreateSeqAIJ(PETSC_COMM_SELF, size, size, 0, size ? &nnz[0] : nullptr, &A);
-    IBTK_CHKERRQ(ierr);
-
-// Set some general matrix options.
-#if !defined(NDEBUG)
-    ierr = MatSetOption(A, MAT_NEW_NONZERO_LOCATION_ERR, PETSC_TRUE);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatSetOption(A, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_TRUE);
-    IBTK_CHKERRQ(ierr);
-#endif
-
     // Set the matrix coefficients to correspond to the standard finite
     // difference approximation to the time-dependent incompressible Stokes
-    // operator.
+    // operator restricted to the unknowns of a single cell.
     //
     // Note that boundary conditions at both physical boundaries and at
     // coarse-fine interfaces are implicitly treated by setting ghost cell
-    // values appropriately.  Thus the matrix coefficients are independent of
-    // any boundary conditions.
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        for (Box<NDIM>::Iterator b(side_boxes[axis]); b; b++)
-        {
-            hier::Index<NDIM> i = b();
-            const int mat_row = compute_side_index(i, ghost_box, axis);
-
-            std::vector<int> mat_cols(U_stencil_sz, -1);
-            std::vector<double> mat_vals(U_stencil_sz, 0.0);
-
-            mat_cols[0] = mat_row;
-            mat_vals[0] = C;
-
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                hier::Index<NDIM> shift = 0;
-                shift(d) = 1;
-                const hier::Index<NDIM> u_left = i - shift;
-                const hier::Index<NDIM> u_rght = i + shift;
-                mat_cols[2 * d + 1] = compute_side_index(u_left, ghost_box, axis);
-                mat_cols[2 * d + 2] = compute_side_index(u_rght, ghost_box, axis);
-
-                mat_vals[0] -= 2.0 * D / (dx[d] * dx[d]);
-                mat_vals[2 * d + 1] = D / (dx[d] * dx[d]);
-                mat_vals[2 * d + 2] = D / (dx[d] * dx[d]);
-            }
-
-            hier::Index<NDIM> shift = 0;
-            shift(axis) = 1;
-            const hier::Index<NDIM> p_left = i - shift;
-            const hier::Index<NDIM> p_rght = i;
-            mat_cols[2 * NDIM + 1] = compute_cell_index(p_left, ghost_box);
-            mat_cols[2 * NDIM + 2] = compute_cell_index(p_rght, ghost_box);
-
-            mat_vals[2 * NDIM + 1] = -1.0 / dx[axis];
-            mat_vals[2 * NDIM + 2] = 1.0 / dx[axis];
-
-            static const int m = 1;
-            static const int n = U_stencil_sz;
-            ierr = MatSetValues(A, m, &mat_row, n, &mat_cols[0], &mat_vals[0], INSERT_VALUES);
-            IBTK_CHKERRQ(ierr);
-        }
-    }
-
-    for (Box<NDIM>::Iterator b(box); b; b++)
+    // values appropriately, and that the couplings to the unknowns outside of
+    // the cell are moved to the right-hand side (see smoothBox()).  Thus the
+    // matrix coefficients are independent of any boundary conditions and of
+    // the location of the cell.
+    BoxMatrix A = BoxMatrix::Zero();
+    double diag = C;
+    for (unsigned int d = 0; d < NDIM; ++d)
     {
-        hier::Index<NDIM> i = b();
-        const int mat_row = compute_cell_index(i, ghost_box);
-
-        std::vector<int> mat_cols(P_stencil_sz, -1);
-        std::vector<double> mat_vals(P_stencil_sz, 0.0);
-
-        mat_cols[0] = mat_row;
-        mat_vals[0] = 0.0;
-
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-            hier::Index<NDIM> shift = 0;
-            shift(axis) = 1;
-            const hier::Index<NDIM> u_left = i;
-            const hier::Index<NDIM> u_rght = i + shift;
-            mat_cols[2 * axis + 1] = compute_side_index(u_left, ghost_box, axis);
-            mat_cols[2 * axis + 2] = compute_side_index(u_rght, ghost_box, axis);
-
-            mat_vals[2 * axis + 1] = 1.0 / dx[axis];
-            mat_vals[2 * axis + 2] = -1.0 / dx[axis];
-        }
-
-        static const int m = 1;
-        static const int n = P_stencil_sz;
-        ierr = MatSetValues(A, m, &mat_row, n, &mat_cols[0], &mat_vals[0], INSERT_VALUES);
-        IBTK_CHKERRQ(ierr);
+        diag -= 2.0 * D / (dx[d] * dx[d]);
     }
-
-    // Set the entries in the ghost cell region so that ghost cell values are
-    // not modified by the smoother.
     for (unsigned int axis = 0; axis < NDIM; ++axis)
     {
-        for (BoxList<NDIM>::Iterator bl(side_ghost_boxes[axis]); bl; bl++)
-        {
-            for (Box<NDIM>::Iterator b(bl()); b; b++)
-            {
-                const int i = compute_side_index(b(), ghost_box, axis);
-                ierr = MatSetValue(A, i, i, 1.0, INSERT_VALUES);
-                IBTK_CHKERRQ(ierr);
-            }
-        }
+        const int lower = side_dof(axis, SideIndex<NDIM>::Lower);
+        const int upper = side_dof(axis, SideIndex<NDIM>::Upper);
+        A(lower, lower) = diag;
+        A(upper, upper) = diag;
+        A(lower, upper) = D / (dx[axis] * dx[axis]);
+        A(upper, lower) = D / (dx[axis] * dx[axis]);
+        A(lower, P_DOF) = 1.0 / dx[axis];
+        A(upper, P_DOF) = -1.0 / dx[axis];
+        A(P_DOF, lower) = 1.0 / dx[axis];
+        A(P_DOF, upper) = -1.0 / dx[axis];
     }
 
-    for (BoxList<NDIM>::Iterator bl(cell_ghost_boxes); bl; bl++)
+    // The box problem is tiny and is the same for every cell on the level, so
+    // we store its inverse and apply it with a dense matrix-vector product.
+    const Eigen::FullPivLU<BoxMatrix> lu(A);
+    if (!lu.isInvertible())
     {
-        for (Box<NDIM>::Iterator b(bl()); b; b++)
-        {
-            const int i = compute_cell_index(b(), ghost_box);
-            ierr = MatSetValue(A, i, i, 1.0, INSERT_VALUES);
-            IBTK_CHKERRQ(ierr);
-        }
+        TBOX_ERROR("StaggeredStokesBoxRelaxationFACOperator::initializeOperatorState():\n"
+                   << "  the box operator is singular for the provided problem coefficients" << std::endl);
     }
-
-    // Assemble the matrices.
-    ierr = MatAssemblyBegin(A, MAT_FINAL_ASSEMBLY);
-    IBTK_CHKERRQ(ierr);
-    ierr = MatAssemblyEnd(A, MAT_FINAL_ASSEMBLY);
-    IBTK_CHKERRQ(ierr);
+    Eigen::Map<BoxMatrix>(A_inv.data()) = lu.inverse();
     return;
-} // buildBoxOperator
+} // buildBoxOperatorInverse
 
-void
-modifyRhsForBcs(Vec& v,
-                const SideData<NDIM, double>& U_data,
-                const CellData<NDIM, double>& P_data,
-                const PoissonSpecifications& U_problem_coefs,
-                const Box<NDIM>& box,
-                const Box<NDIM>& ghost_box,
-                const double* const dx)
+inline void
+smoothBox(SideData<NDIM, double>& U_error_data,
+          CellData<NDIM, double>& P_error_data,
+          const SideData<NDIM, double>& U_residual_data,
+          const CellData<NDIM, double>& P_residual_data,
+          const std::array<double, BOX_SIZE * BOX_SIZE>& A_inv,
+          const double D,
+          const double* const dx,
+          const hier::Index<NDIM>& i)
 {
-    int ierr;
-
-    const double D = U_problem_coefs.getDConstant();
+    // Set up the right-hand side of the box problem, moving the couplings to
+    // the unknowns outside of the cell to the right-hand side.
+    std::array<double, BOX_SIZE> r;
     for (unsigned int axis = 0; axis < NDIM; ++axis)
     {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
+        hier::Index<NDIM> shift_axis = 0;
+        shift_axis(axis) = 1;
+        for (int side = SideIndex<NDIM>::Lower; side <= SideIndex<NDIM>::Upper; ++side)
         {
-            hier::Index<NDIM> i = b();
-            const int idx = compute_side_index(i, ghost_box, axis);
-
+            const hier::Index<NDIM> j = side == SideIndex<NDIM>::Lower ? i : i + shift_axis;
+            double& r_k = r[side_dof(axis, side)];
+            r_k = U_residual_data(SideIndex<NDIM>(i, axis, side));
             for (unsigned int d = 0; d < NDIM; ++d)
             {
                 hier::Index<NDIM> shift = 0;
                 shift(d) = 1;
-                const hier::Index<NDIM> u_left = i - shift;
-                const hier::Index<NDIM> u_rght = i + shift;
-                if (!side_box.contains(u_left))
+                if (d != axis || side == SideIndex<NDIM>::Lower)
                 {
-                    ierr = VecSetValue(v,
-                                       idx,
-                                       +D * U_data(SideIndex<NDIM>(u_left, axis, SideIndex<NDIM>::Lower)) /
-                                           (dx[d] * dx[d]),
-                                       ADD_VALUES);
-                    IBTK_CHKERRQ(ierr);
+                    r_k += D * U_error_data(SideIndex<NDIM>(j - shift, axis, SideIndex<NDIM>::Lower)) / (dx[d] * dx[d]);
                 }
-                if (!side_box.contains(u_rght))
+                if (d != axis || side == SideIndex<NDIM>::Upper)
                 {
-                    ierr = VecSetValue(v,
-                                       idx,
-                                       +D * U_data(SideIndex<NDIM>(u_rght, axis, SideIndex<NDIM>::Lower)) /
-                                           (dx[d] * dx[d]),
-                                       ADD_VALUES);
-                    IBTK_CHKERRQ(ierr);
+                    r_k += D * U_error_data(SideIndex<NDIM>(j + shift, axis, SideIndex<NDIM>::Lower)) / (dx[d] * dx[d]);
                 }
             }
-
-            hier::Index<NDIM> shift = 0;
-            shift(axis) = 1;
-            const hier::Index<NDIM> p_left = i - shift;
-            const hier::Index<NDIM> p_rght = i;
-            if (!box.contains(p_left))
-            {
-                ierr = VecSetValue(v, idx, +P_data(p_left) / dx[axis], ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
-            }
-            if (!box.contains(p_rght))
-            {
-                ierr = VecSetValue(v, idx, -P_data(p_rght) / dx[axis], ADD_VALUES);
-                IBTK_CHKERRQ(ierr);
-            }
         }
+        r[side_dof(axis, SideIndex<NDIM>::Lower)] += P_error_data(i - shift_axis) / dx[axis];
+        r[side_dof(axis, SideIndex<NDIM>::Upper)] -= P_error_data(i + shift_axis) / dx[axis];
     }
+    r[P_DOF] = P_residual_data(i);
 
-    ierr = VecAssemblyBegin(v);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(v);
-    IBTK_CHKERRQ(ierr);
-    return;
-} // modifyRhsForBcs
-
-inline void
-copyToVec(Vec& v,
-          const SideData<NDIM, double>& U_data,
-          const CellData<NDIM, double>& P_data,
-          const Box<NDIM>& box,
-          const Box<NDIM>& ghost_box)
-{
-    int ierr;
-
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    // Solve the box problem and update the error.
+    for (int k = 0; k < BOX_SIZE; ++k)
     {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
+        double e_k = 0.0;
+        for (int l = 0; l < BOX_SIZE; ++l)
         {
-            const hier::Index<NDIM>& i = b();
-            const SideIndex<NDIM> s_i(i, axis, 0);
-            const int idx = compute_side_index(i, ghost_box, axis);
-            ierr = VecSetValue(v, idx, U_data(s_i), INSERT_VALUES);
-            IBTK_CHKERRQ(ierr);
+            e_k += A_inv[k * BOX_SIZE + l] * r[l];
         }
-    }
-
-    for (Box<NDIM>::Iterator b(box); b; b++)
-    {
-        const hier::Index<NDIM>& i = b();
-        const int idx = compute_cell_index(i, ghost_box);
-        ierr = VecSetValue(v, idx, P_data(i), INSERT_VALUES);
-        IBTK_CHKERRQ(ierr);
-    }
-
-    ierr = VecAssemblyBegin(v);
-    IBTK_CHKERRQ(ierr);
-    ierr = VecAssemblyEnd(v);
-    IBTK_CHKERRQ(ierr);
-    return;
-} // copyToVec
-
-inline void
-copyFromVec(Vec& v,
-            SideData<NDIM, double>& U_data,
-            CellData<NDIM, double>& P_data,
-            const Box<NDIM>& box,
-            const Box<NDIM>& ghost_box)
-{
-    int ierr;
-
-    const double omega = 0.65;
-
-    double U;
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(box, axis);
-        for (Box<NDIM>::Iterator b(side_box); b; b++)
+        if (k == P_DOF)
         {
-            const hier::Index<NDIM>& i = b();
-            const SideIndex<NDIM> s_i(i, axis, SideIndex<NDIM>::Lower);
-            const int idx = compute_side_index(i, ghost_box, axis);
-            ierr = VecGetValues(v, 1, &idx, &U);
-            IBTK_CHKERRQ(ierr);
-            U_data(s_i) = (1.0 - omega) * U_data(s_i) + omega * U;
+            P_error_data(i) = (1.0 - OMEGA) * P_error_data(i) + OMEGA * e_k;
+        }
+        else
+        {
+            const SideIndex<NDIM> s_i(i, k / 2, k % 2);
+            U_error_data(s_i) = (1.0 - OMEGA) * U_error_data(s_i) + OMEGA * e_k;
         }
-    }
-
-    double P;
-    for (Box<NDIM>::Iterator b(box); b; b++)
-    {
-        const hier::Index<NDIM>& i = b();
-        const int idx = compute_cell_index(i, ghost_box);
-        ierr = VecGetValues(v, 1, &idx, &P);
-        IBTK_CHKERRQ(ierr);
-        P_data(i) = (1.0 - omega) * P_data(i) + omega * P;
     }
     return;
-} // copyFromVec
+} // smoothBox
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -457,7 +227,6 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
 {
     if (num_sweeps == 0) return;
 
-    int ierr;
     Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
     const int U_error_idx = error.getComponentDescriptorIndex(0);
     const int P_error_idx = error.getComponentDescriptorIndex(1);
@@ -569,14 +338,23 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
             xeqScheduleGhostFillNoCoarse(error_idxs, level_num);
         }
 
-        // Smooth the error on the patches.
-        Vec& e = d_box_e[level_num];
-        Vec& r = d_box_r[level_num];
-        KSP& ksp = d_box_ksp[level_num];
-        int patch_counter = 0;
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        // Smooth the error on the patches.  The patches are smoothed
+        // independently, and so they are smoothed concurrently when IBAMR is
+        // compiled with OpenMP.
+        const std::array<double, BOX_SIZE * BOX_SIZE>& A_inv = d_box_inv[level_num];
+        const double D = d_U_problem_coefs.getDConstant();
+        std::vector<Pointer<Patch<NDIM> > > local_patches;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            local_patches.push_back(level->getPatch(p()));
+        }
+        const int num_local_patches = static_cast<int>(local_patches.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int patch_counter = 0; patch_counter < num_local_patches; ++patch_counter)
+        {
+            const Pointer<Patch<NDIM> >& patch = local_patches[patch_counter];
             Pointer<SideData<NDIM, double> > U_error_data = error.getComponentPatchData(0, *patch);
             Pointer<SideData<NDIM, double> > U_residual_data = residual.getComponentPatchData(0, *patch);
 #if !defined(NDEBUG)
@@ -599,14 +377,7 @@ StaggeredStokesBoxRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, doub
             const double* const dx = pgeom->getDx();
             for (Box<NDIM>::Iterator b(patch_box); b; b++)
             {
-                const hier::Index<NDIM>& i = b();
-                const Box<NDIM> box(i, i);
-                copyToVec(e, *U_error_data, *P_error_data, box, box);
-                copyToVec(r, *U_residual_data, *P_residual_data, box, box);
-                modifyRhsForBcs(r, *U_error_data, *P_error_data, d_U_problem_coefs, box, box, dx);
-                ierr = KSPSolve(ksp, r, e);
-                IBTK_CHKERRQ(ierr);
-                copyFromVec(e, *U_error_data, *P_error_data, box, box);
+                smoothBox(*U_error_data, *P_error_data, *U_residual_data, *P_residual_data, A_inv, D, dx, b());
             }
         }
     }
@@ -627,11 +398,7 @@ StaggeredStokesBoxRelaxationFACOperator::initializeOperatorStateSpecialized(cons
                                                                             const int finest_reset_ln)
 {
     // Initialize the box relaxation data on each level of the patch hierarchy.
-    d_box_op.resize(d_finest_ln + 1);
-    d_box_e.resize(d_finest_ln + 1);
-    d_box_r.resize(d_finest_ln + 1);
-    d_box_ksp.resize(d_finest_ln + 1);
-    const Box<NDIM> box(hier::Index<NDIM>(0), hier::Index<NDIM>(0));
+    d_box_inv.resize(d_finest_ln + 1);
     Pointer<CartesianGridGeometry<NDIM> > geometry = d_hierarchy->getGridGeometry();
     const double* const dx_coarsest = geometry->getDx();
     std::array<double, NDIM> dx;
@@ -642,27 +409,7 @@ StaggeredStokesBoxRelaxationFACOperator::initializeOperatorStateSpecialized(cons
         {
             dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
         }
-        buildBoxOperator(d_box_op[ln], d_U_problem_coefs, box, box, dx);
-        int ierr;
-        ierr = MatCreateVecs(d_box_op[ln], &d_box_e[ln], &d_box_r[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPCreate(PETSC_COMM_SELF, &d_box_ksp[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetOperators(d_box_ksp[ln], d_box_op[ln], d_box_op[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetReusePreconditioner(d_box_ksp[ln], PETSC_TRUE);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetType(d_box_ksp[ln], KSPPREONLY);
-        IBTK_CHKERRQ(ierr);
-        PC box_pc;
-        ierr = KSPGetPC(d_box_ksp[ln], &box_pc);
-        IBTK_CHKERRQ(ierr);
-        ierr = PCSetType(box_pc, PCLU);
-        IBTK_CHKERRQ(ierr);
-        ierr = PCFactorReorderForNonzeroDiagonal(box_pc, std::numeric_limits<double>::epsilon());
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPSetUp(d_box_ksp[ln]);
-        IBTK_CHKERRQ(ierr);
+        buildBoxOperatorInverse(d_box_inv[ln], d_U_problem_coefs, dx);
     }
 
     // Get overlap information for setting patch boundary conditions.
@@ -716,15 +463,6 @@ StaggeredStokesBoxRelaxationFACOperator::deallocateOperatorStateSpecialized(cons
     if (!d_is_initialized) return;
     for (int ln = coarsest_reset_ln; ln <= std::min(d_finest_ln, finest_reset_ln); ++ln)
     {
-        int ierr;
-        ierr = MatDestroy(&d_box_op[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecDestroy(&d_box_e[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecDestroy(&d_box_r[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = KSPDestroy(&d_box_ksp[ln]);
-        IBTK_CHKERRQ(ierr);
         d_patch_side_bc_box_overlap[ln].resize(0);
         d_patch_cell_bc_box_overlap[ln].resize(0);
     }
@@ -0,0 +1,281 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibamr/StaggeredStokesFFTLevelSolver.h"
+#include "ibamr/StaggeredStokesSolver.h"
+#include "ibamr/ibamr_utilities.h"
+
+#include "ibtk/FFTUtilities.h"
+#include "ibtk/GeneralSolver.h"
+#include "ibtk/LinearSolver.h"
+
+#include "Box.h"
+#include "CartesianGridGeometry.h"
+#include "Index.h"
+#include "IntVector.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "PoissonSpecifications.h"
+#include "SAMRAIVectorReal.h"
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
+#include "tbox/Utilities.h"
+
+#include <array>
+#include <cmath>
+#include <complex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ibamr/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBAMR
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Timers.
+static Timer* t_solve_system;
+static Timer* t_initialize_solver_state;
+static Timer* t_deallocate_solver_state;
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+StaggeredStokesFFTLevelSolver::StaggeredStokesFFTLevelSolver(const std::string& object_name,
+                                                             Pointer<Database> input_db,
+                                                             const std::string& /*default_options_prefix*/)
+{
+    // Setup default options.
+    GeneralSolver::init(object_name, /*homogeneous_bc*/ false);
+    d_initial_guess_nonzero = false;
+    d_max_iterations = 1;
+
+    // Get values from the input database.
+    if (input_db)
+    {
+        if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+    }
+
+    // Setup Timers.
+    IBAMR_DO_ONCE(
+        t_solve_system = TimerManager::getManager()->getTimer("IBAMR::StaggeredStokesFFTLevelSolver::solveSystem()");
+        t_initialize_solver_state =
+            TimerManager::getManager()->getTimer("IBAMR::StaggeredStokesFFTLevelSolver::initializeSolverState()");
+        t_deallocate_solver_state =
+            TimerManager::getManager()->getTimer("IBAMR::StaggeredStokesFFTLevelSolver::deallocateSolverState()"););
+    return;
+} // StaggeredStokesFFTLevelSolver
+
+StaggeredStokesFFTLevelSolver::~StaggeredStokesFFTLevelSolver()
+{
+    if (d_is_initialized) deallocateSolverState();
+    return;
+} // ~StaggeredStokesFFTLevelSolver
+
+bool
+StaggeredStokesFFTLevelSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDIM, double>& b)
+{
+    IBAMR_TIMER_START(t_solve_system);
+
+    // Initialize the solver, when necessary.
+    const bool deallocate_after_solve = !d_is_initialized;
+    if (deallocate_after_solve) initializeSolverState(x, b);
+
+    // Transform the right-hand side.
+    const int U_idx = x.getComponentDescriptorIndex(0);
+    const int P_idx = x.getComponentDescriptorIndex(1);
+    const int F_idx = b.getComponentDescriptorIndex(0);
+    const int G_idx = b.getComponentDescriptorIndex(1);
+    std::vector<double> values;
+    std::array<std::vector<std::complex<double> >, NDIM> U_hat;
+    std::vector<std::complex<double> > P_hat;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        IBTK::FFTUtilities::gatherSideData(values, F_idx, axis, d_level, d_domain_box);
+        U_hat[axis].assign(values.begin(), values.end());
+        IBTK::FFTUtilities::transform(U_hat[axis], d_num_cells, /*inverse*/ false);
+    }
+    IBTK::FFTUtilities::gatherCellData(values, G_idx, 0, d_level, d_domain_box);
+    P_hat.assign(values.begin(), values.end());
+    IBTK::FFTUtilities::transform(P_hat, d_num_cells, /*inverse*/ false);
+
+    // Solve for each mode.  With the symbols G_d = (1 - exp(-i theta_d))/dx_d
+    // of the pressure gradient and D_d = (exp(i theta_d) - 1)/dx_d of the
+    // divergence, the system is
+    //
+    //    a u_d + G_d p = f_d,  -sum_d D_d u_d = g,
+    //
+    // in which a = C + D*lambda and lambda = sum_d D_d G_d is the symbol of
+    // the Laplacian.  Eliminating the velocity yields
+    //
+    //    p = (a g + sum_d D_d f_d)/lambda,  u_d = (f_d - G_d p)/a.
+    //
+    // The constant mode (lambda = 0) of the pressure is set to zero.
+    const double C = d_U_problem_coefs.cIsZero() ? 0.0 : d_U_problem_coefs.getCConstant();
+    const double D = d_U_problem_coefs.getDConstant();
+    for (Box<NDIM>::Iterator it(d_domain_box); it; it++)
+    {
+        const hier::Index<NDIM>& i = it();
+        const int k = d_domain_box.offset(i);
+        std::complex<double> div_symbol[NDIM], grad_symbol[NDIM];
+        double laplace_symbol = 0.0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const double theta = 2.0 * M_PI * static_cast<double>(i(d) - d_domain_box.lower(d)) / d_num_cells(d);
+            const std::complex<double> shift = std::polar(1.0, theta);
+            div_symbol[d] = (shift - 1.0) / d_dx[d];
+            grad_symbol[d] = (1.0 - std::conj(shift)) / d_dx[d];
+            laplace_symbol += (2.0 * std::cos(theta) - 2.0) / (d_dx[d] * d_dx[d]);
+        }
+        const double a = C + D * laplace_symbol;
+        std::complex<double> p_hat = 0.0;
+        if (laplace_symbol != 0.0)
+        {
+            p_hat = a * P_hat[k];
+            for (unsigned int d = 0; d < NDIM; ++d) p_hat += div_symbol[d] * U_hat[d][k];
+            p_hat /= laplace_symbol;
+        }
+        P_hat[k] = p_hat;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            U_hat[d][k] = a == 0.0 ? 0.0 : (U_hat[d][k] - grad_symbol[d] * p_hat) / a;
+        }
+    }
+
+    // Transform the solution back.
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        IBTK::FFTUtilities::transform(U_hat[axis], d_num_cells, /*inverse*/ true);
+        for (unsigned int k = 0; k < values.size(); ++k) values[k] = U_hat[axis][k].real();
+        IBTK::FFTUtilities::scatterSideData(U_idx, axis, d_level, d_domain_box, values);
+    }
+    IBTK::FFTUtilities::transform(P_hat, d_num_cells, /*inverse*/ true);
+    for (unsigned int k = 0; k < values.size(); ++k) values[k] = P_hat[k].real();
+    IBTK::FFTUtilities::scatterCellData(P_idx, 0, d_level, d_domain_box, values);
+    d_current_iterations = 1;
+    d_current_residual_norm = 0.0;
+
+    // Log solver info.
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::solveSystem(): solved the system on a " << d_domain_box.size()
+             << " cell level\n";
+    }
+
+    // Deallocate the solver, when necessary.
+    if (deallocate_after_solve) deallocateSolverState();
+
+    IBAMR_TIMER_STOP(t_solve_system);
+    return true;
+} // solveSystem
+
+void
+StaggeredStokesFFTLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
+                                                     const SAMRAIVectorReal<NDIM, double>& b)
+{
+    IBAMR_TIMER_START(t_initialize_solver_state);
+
+#if !defined(NDEBUG)
+    // Rudimentary error checking.
+    if (x.getNumberOfComponents() != 2 || b.getNumberOfComponents() != 2)
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have a velocity and a pressure component" << std::endl);
+    }
+    if (x.getPatchHierarchy() != b.getPatchHierarchy())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same hierarchy" << std::endl);
+    }
+    if (x.getCoarsestLevelNumber() != b.getCoarsestLevelNumber() ||
+        x.getFinestLevelNumber() != b.getFinestLevelNumber())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same range of levels" << std::endl);
+    }
+#else
+    NULL_USE(b);
+#endif
+    const int level_num = x.getCoarsestLevelNumber();
+    if (level_num != x.getFinestLevelNumber())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  coarsest_ln != finest_ln in StaggeredStokesFFTLevelSolver" << std::endl);
+    }
+    if (!(d_U_problem_coefs.cIsZero() || d_U_problem_coefs.cIsConstant()) || !d_U_problem_coefs.dIsConstant())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  StaggeredStokesFFTLevelSolver requires constant velocity problem coefficients"
+                                 << std::endl);
+    }
+
+    // Deallocate the solver state if the solver is already initialized.
+    if (d_is_initialized) deallocateSolverState();
+
+    // Get the level and check that it uniformly covers a periodic domain.
+    d_level = x.getPatchHierarchy()->getPatchLevel(level_num);
+    d_domain_box = IBTK::FFTUtilities::getPeriodicDomainBox(d_level);
+    if (d_domain_box.empty())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  level " << level_num
+                                 << " must uniformly cover a domain that is periodic in every direction" << std::endl);
+    }
+    d_num_cells = d_domain_box.numberCells();
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_level->getGridGeometry();
+    const double* const dx_coarsest = grid_geom->getDx();
+    const IntVector<NDIM>& ratio = d_level->getRatio();
+    for (unsigned int d = 0; d < NDIM; ++d) d_dx[d] = dx_coarsest[d] / static_cast<double>(ratio(d));
+
+    // Indicate that the solver is initialized.
+    d_is_initialized = true;
+
+    IBAMR_TIMER_STOP(t_initialize_solver_state);
+    return;
+} // initializeSolverState
+
+void
+StaggeredStokesFFTLevelSolver::deallocateSolverState()
+{
+    if (!d_is_initialized) return;
+
+    IBAMR_TIMER_START(t_deallocate_solver_state);
+
+    d_level.setNull();
+
+    // Indicate that the solver is NOT initialized.
+    d_is_initialized = false;
+
+    IBAMR_TIMER_STOP(t_deallocate_solver_state);
+    return;
+} // deallocateSolverState
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
@@ -20,6 +20,7 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/ibtk_utilities.h"
 
+#include "ArrayData.h"
 #include "Box.h"
 #include "BoxArray.h"
 #include "CartesianGridGeometry.h"
@@ -29,7 +30,6 @@
 #include "Patch.h"
 #include "SideData.h"
 #include "SideGeometry.h"
-#include "SideIndex.h"
 #include "Variable.h"
 #include "VariableContext.h"
 #include "tbox/Database.h"
@@ -39,6 +39,7 @@
 #include <cmath>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 
@@ -64,6 +65,53 @@ smooth_kernel(const double r)
 {
     return std::abs(r) < 1.0 ? 0.5 * (std::cos(M_PI * r) + 1.0) : 0.0;
 } // smooth_kernel
+
+// Set F = -kappa * w * U on box wherever U * n is positive (at inflow
+// boundaries) or negative (at outflow boundaries). Here, w is the kernel
+// tabulated along the given axis (starting at box.lower(axis)) and U is either
+// the current velocity or the average of the current and new velocities. The
+// data are accessed one grid line at a time so that the innermost loop is
+// contiguous and can be vectorized.
+void
+set_stabilizing_force(ArrayData<NDIM, double>& F_data,
+                      const ArrayData<NDIM, double>& U_current_data,
+                      const ArrayData<NDIM, double>* const U_new_data,
+                      const Box<NDIM>& box,
+                      const unsigned int axis,
+                      const std::vector<double>& w,
+                      const double kappa,
+                      const double n,
+                      const bool inflow,
+                      const bool outflow,
+                      const bool average)
+{
+    if (box.empty()) return;
+    const int n0 = box.numberCells(0);
+    Box<NDIM> line_box = box;
+    line_box.upper(0) = line_box.lower(0);
+    const double c_current = average ? 0.5 : 1.0;
+    const double c_new = (average && U_new_data) ? 0.5 : 0.0;
+    double* const F_base = F_data.getPointer();
+    const double* const U_current_base = U_current_data.getPointer();
+    const double* const U_new_base = U_new_data ? U_new_data->getPointer() : U_current_base;
+    const Box<NDIM>& U_new_box = U_new_data ? U_new_data->getBox() : U_current_data.getBox();
+    for (Box<NDIM>::Iterator b(line_box); b; b++)
+    {
+        const hier::Index<NDIM>& i = b();
+        double* const F = F_base + IBTK::array_offset(F_data.getBox(), i);
+        const double* const U_current = U_current_base + IBTK::array_offset(U_current_data.getBox(), i);
+        const double* const U_new = U_new_base + IBTK::array_offset(U_new_box, i);
+        const double w_line = axis == 0 ? 0.0 : w[i(axis) - box.lower(axis)];
+        for (int k = 0; k < n0; ++k)
+        {
+            const double w_k = axis == 0 ? w[k] : w_line;
+            const double U = c_current * U_current[k] + c_new * U_new[k];
+            const bool stabilize = (inflow && U * n > 0.0) || (outflow && U * n < 0.0);
+            F[k] = stabilize ? w_k * kappa * (0.0 - U) : F[k];
+        }
+    }
+    return;
+} // set_stabilizing_force
 } // namespace
 
 ////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -141,6 +189,20 @@ StaggeredStokesOpenBoundaryStabilizer::setDataOnPatch(const int data_idx,
 #endif
     F_data->fillAll(0.0);
     if (initial_time) return;
+
+    // Only patches that touch an open boundary intersect the stabilization
+    // regions, so there is nothing else to do on the other patches.
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    bool touches_open_bdry = false;
+    for (unsigned int location_index = 0; location_index < 2 * NDIM; ++location_index)
+    {
+        const unsigned int axis = location_index / 2;
+        const unsigned int side = location_index % 2;
+        touches_open_bdry =
+            touches_open_bdry || (d_open_bdry[location_index] && pgeom->getTouchesRegularBoundary(axis, side));
+    }
+    if (!touches_open_bdry) return;
+
     const int cycle_num = d_fluid_solver->getCurrentCycleNumber();
     const double dt = d_fluid_solver->getCurrentTimeStepSize();
     const double rho = d_fluid_solver->getStokesSpecifications()->getRho();
@@ -153,7 +215,6 @@ StaggeredStokesOpenBoundaryStabilizer::setDataOnPatch(const int data_idx,
     TBOX_ASSERT(U_current_data);
 #endif
     const Box<NDIM>& patch_box = patch->getBox();
-    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
     const double* const x_lower = pgeom->getXLower();
     const double* const x_upper = pgeom->getXUpper();
@@ -176,21 +237,28 @@ StaggeredStokesOpenBoundaryStabilizer::setDataOnPatch(const int data_idx,
             {
                 bdry_box.lower(axis) = domain_box.upper(axis) - offset;
             }
-            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(bdry_box * patch_box, axis)); b; b++)
+            const Box<NDIM> cell_box = bdry_box * patch_box;
+            if (cell_box.empty()) continue;
+            const Box<NDIM> box = SideGeometry<NDIM>::toSideBox(cell_box, axis);
+            const double x_bdry = (is_lower ? x_lower[axis] : x_upper[axis]);
+            std::vector<double> w(box.numberCells(axis));
+            for (int k = 0; k < box.numberCells(axis); ++k)
             {
-                const hier::Index<NDIM>& i = b();
-                const SideIndex<NDIM> i_s(i, axis, SideIndex<NDIM>::Lower);
-                const double U_current = U_current_data ? (*U_current_data)(i_s) : 0.0;
-                const double U_new = U_new_data ? (*U_new_data)(i_s) : 0.0;
-                const double U = (cycle_num > 0) ? 0.5 * (U_new + U_current) : U_current;
-                const double n = is_lower ? -1.0 : +1.0;
-                if ((d_inflow_bdry[location_index] && U * n > 0.0) || (d_outflow_bdry[location_index] && U * n < 0.0))
-                {
-                    const double x = x_lower[axis] + dx[axis] * static_cast<double>(i(axis) - patch_box.lower(axis));
-                    const double x_bdry = (is_lower ? x_lower[axis] : x_upper[axis]);
-                    (*F_data)(i_s) = smooth_kernel((x - x_bdry) / d_width[location_index]) * kappa * (0.0 - U);
-                }
+                const double x =
+                    x_lower[axis] + dx[axis] * static_cast<double>(box.lower(axis) + k - patch_box.lower(axis));
+                w[k] = smooth_kernel((x - x_bdry) / d_width[location_index]);
             }
+            set_stabilizing_force(F_data->getArrayData(axis),
+                                  U_current_data->getArrayData(axis),
+                                  U_new_data ? &U_new_data->getArrayData(axis) : nullptr,
+                                  box,
+                                  axis,
+                                  w,
+                                  kappa,
+                                  is_lower ? -1.0 : +1.0,
+                                  d_inflow_bdry[location_index],
+                                  d_outflow_bdry[location_index],
+                                  cycle_num > 0);
         }
     }
     return;
@@ -223,14 +223,9 @@ StaggeredStokesOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorRe
     // Compute the action of the operator:
     //
     // A*[U;P] := [A_U;A_P] = [(C*I+D*L)*U + Grad P; -Div U]
-    d_hier_math_ops->grad(A_U_idx,
-                          A_U_sc_var,
-                          /*cf_bdry_synch*/ false,
-                          1.0,
-                          P_idx,
-                          P_cc_var,
-                          d_no_fill,
-                          d_new_time);
+    //
+    // The momentum equation residual is computed in a single pass over each
+    // patch.
     d_hier_math_ops->laplace(A_U_idx,
                              A_U_sc_var,
                              d_U_problem_coefs,
@@ -239,8 +234,8 @@ StaggeredStokesOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorRe
                              d_no_fill,
                              d_new_time,
                              1.0,
-                             A_U_idx,
-                             A_U_sc_var);
+                             P_idx,
+                             P_cc_var);
     d_hier_math_ops->div(A_P_idx,
                          A_P_cc_var,
                          -1.0,
@@ -27,6 +27,8 @@
 #include "ibtk/SAMRAIDataCache.h"
 
 #include "BoundaryBox.h"
+#include "Box.h"
+#include "BoxArray.h"
 #include "CellData.h"
 #include "CellVariable.h"
 #include "CoarseFineBoundary.h"
@@ -36,6 +38,7 @@
 #include "PatchGeometry.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "ProcessorMapping.h"
 #include "RefineSchedule.h"
 #include "SAMRAIVectorReal.h"
 #include "SideData.h"
@@ -47,11 +50,15 @@
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
+#include "petscmat.h"
+#include "petscsys.h"
 #include "petscvec.h"
 #include <petsclog.h>
 
 #include <algorithm>
+#include <array>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "ibamr/namespaces.h" // IWYU pragma: keep
@@ -119,15 +126,32 @@ StaggeredStokesPETScLevelSolver::StaggeredStokesPETScLevelSolver(const std::stri
     }
     d_p_nullspace_idx = var_db->registerVariableAndContext(d_p_nullspace_var, d_context, NOGHOST);
 
+    if (input_db && input_db->keyExists("reuse_assembled_matrix"))
+        d_reuse_assembled_matrix = input_db->getBool("reuse_assembled_matrix");
     return;
 } // StaggeredStokesPETScLevelSolver
 
 StaggeredStokesPETScLevelSolver::~StaggeredStokesPETScLevelSolver()
 {
     if (d_is_initialized) deallocateSolverState();
+    if (d_cached_petsc_mat)
+    {
+        int ierr = MatDestroy(&d_cached_petsc_mat);
+        IBTK_CHKERRQ(ierr);
+    }
     return;
 } // ~StaggeredStokesPETScLevelSolver
 
+Pointer<StaggeredStokesSolver>
+StaggeredStokesPETScLevelSolver::allocate_fieldsplit_amg_solver(const std::string& object_name,
+                                                                Pointer<Database> input_db,
+                                                                const std::string& default_options_prefix)
+{
+    auto solver = new StaggeredStokesPETScLevelSolver(object_name, input_db, default_options_prefix);
+    solver->setFieldSplitAMGDefaults(input_db);
+    return solver;
+} // allocate_fieldsplit_amg_solver
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 void
@@ -176,14 +200,54 @@ StaggeredStokesPETScLevelSolver::initializeSolverStateSpecialized(const SAMRAIVe
     IBTK_CHKERRQ(ierr);
     ierr = VecCreateMPI(PETSC_COMM_WORLD, d_num_dofs_per_proc[mpi_rank], PETSC_DETERMINE, &d_petsc_b);
     IBTK_CHKERRQ(ierr);
-    StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(d_petsc_mat,
-                                                                     d_U_problem_coefs,
-                                                                     d_U_bc_coefs,
-                                                                     d_new_time,
-                                                                     d_num_dofs_per_proc,
-                                                                     d_u_dof_index_idx,
-                                                                     d_p_dof_index_idx,
-                                                                     d_level);
+    if (d_reuse_assembled_matrix)
+    {
+        // Reuse the cached matrix when possible.  The cached matrix holds its
+        // own reference, so it is not destroyed along with d_petsc_mat.
+        const bool same_layout = d_cached_petsc_mat && cachedMatrixHasSameLayout();
+        if (!same_layout || !cachedMatrixHasSameValues())
+        {
+            StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(d_cached_petsc_mat,
+                                                                             d_U_problem_coefs,
+                                                                             d_U_bc_coefs,
+                                                                             d_new_time,
+                                                                             d_num_dofs_per_proc,
+                                                                             d_u_dof_index_idx,
+                                                                             d_p_dof_index_idx,
+                                                                             d_level,
+                                                                             /*reuse_nonzero_pattern*/ same_layout);
+        }
+        d_petsc_mat = d_cached_petsc_mat;
+        ierr = PetscObjectReference(reinterpret_cast<PetscObject>(d_petsc_mat));
+        IBTK_CHKERRQ(ierr);
+
+        const BoxArray<NDIM>& boxes = d_level->getBoxes();
+        const int num_boxes = boxes.getNumberOfBoxes();
+        d_cached_boxes.resize(num_boxes);
+        d_cached_box_mapping.resize(num_boxes);
+        for (int i = 0; i < num_boxes; ++i)
+        {
+            d_cached_boxes[i] = boxes[i];
+            d_cached_box_mapping[i] = d_level->getProcessorMapping().getProcessorAssignment(i);
+        }
+        d_cached_num_dofs_per_proc = d_num_dofs_per_proc;
+        d_cached_level_num = d_level_num;
+        d_cached_C = d_U_problem_coefs.getCConstant();
+        d_cached_D = d_U_problem_coefs.getDConstant();
+        d_cached_data_time = d_new_time;
+        d_cached_U_bc_coefs = d_U_bc_coefs;
+    }
+    else
+    {
+        StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(d_petsc_mat,
+                                                                         d_U_problem_coefs,
+                                                                         d_U_bc_coefs,
+                                                                         d_new_time,
+                                                                         d_num_dofs_per_proc,
+                                                                         d_u_dof_index_idx,
+                                                                         d_p_dof_index_idx,
+                                                                         d_level);
+    }
     d_petsc_pc = d_petsc_mat;
 
     // Set pressure nullspace if the level covers the entire domain.
@@ -320,6 +384,69 @@ StaggeredStokesPETScLevelSolver::setupKSPVecs(Vec& petsc_x,
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+StaggeredStokesPETScLevelSolver::setFieldSplitAMGDefaults(Pointer<Database> input_db)
+{
+    if (input_db && input_db->keyExists("pc_type")) return;
+    d_pc_type = "fieldsplit";
+
+    // The defaults are stored in the global PETSc options database, so we
+    // require an options prefix to avoid changing the options of other solvers.
+    if (d_options_prefix.empty()) d_options_prefix = "stokes_fieldsplit_amg_";
+
+    // Options that are already set (e.g., on the command line) take precedence
+    // over the defaults.
+    static const std::array<std::pair<const char*, const char*>, 9> default_options = {
+        { { "pc_fieldsplit_type", "schur" },
+          { "pc_fieldsplit_schur_fact_type", "upper" },
+          { "pc_fieldsplit_schur_precondition", "selfp" },
+          { "fieldsplit_velocity_ksp_type", "preonly" },
+          { "fieldsplit_velocity_pc_type", "hypre" },
+          { "fieldsplit_velocity_pc_hypre_type", "boomeramg" },
+          { "fieldsplit_pressure_ksp_type", "preonly" },
+          { "fieldsplit_pressure_pc_type", "hypre" },
+          { "fieldsplit_pressure_pc_hypre_type", "boomeramg" } }
+    };
+    int ierr;
+    for (const auto& option : default_options)
+    {
+        const std::string option_name = "-" + d_options_prefix + option.first;
+        PetscBool has_option = PETSC_FALSE;
+        ierr = PetscOptionsHasName(nullptr, nullptr, option_name.c_str(), &has_option);
+        IBTK_CHKERRQ(ierr);
+        if (!has_option)
+        {
+            ierr = PetscOptionsSetValue(nullptr, option_name.c_str(), option.second);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+    return;
+} // setFieldSplitAMGDefaults
+
+bool
+StaggeredStokesPETScLevelSolver::cachedMatrixHasSameLayout() const
+{
+    // The box array and the processor mapping are replicated on every
+    // process, so all processes reach the same conclusion.
+    const BoxArray<NDIM>& boxes = d_level->getBoxes();
+    const int num_boxes = boxes.getNumberOfBoxes();
+    if (num_boxes != static_cast<int>(d_cached_boxes.size())) return false;
+    for (int i = 0; i < num_boxes; ++i)
+    {
+        if (!(boxes[i] == d_cached_boxes[i])) return false;
+        if (d_level->getProcessorMapping().getProcessorAssignment(i) != d_cached_box_mapping[i]) return false;
+    }
+    return d_num_dofs_per_proc == d_cached_num_dofs_per_proc;
+} // cachedMatrixHasSameLayout
+
+bool
+StaggeredStokesPETScLevelSolver::cachedMatrixHasSameValues() const
+{
+    return d_level_num == d_cached_level_num && d_U_problem_coefs.getCConstant() == d_cached_C &&
+           d_U_problem_coefs.getDConstant() == d_cached_D && d_new_time == d_cached_data_time &&
+           d_U_bc_coefs == d_cached_U_bc_coefs;
+} // cachedMatrixHasSameValues
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
@@ -15,6 +15,7 @@
 
 #include "ibamr/PETScKrylovStaggeredStokesSolver.h"
 #include "ibamr/StaggeredStokesBlockFactorizationPreconditioner.h"
+#include "ibamr/StaggeredStokesFFTLevelSolver.h"
 #include "ibamr/StaggeredStokesLevelRelaxationFACOperator.h"
 #include "ibamr/StaggeredStokesOperator.h"
 #include "ibamr/StaggeredStokesPETScLevelSolver.h"
@@ -58,6 +59,9 @@ const std::string StaggeredStokesSolverManager::LEVEL_RELAXATION_FAC_PRECONDITIO
     "LEVEL_RELAXATION_FAC_PRECONDITIONER";
 const std::string StaggeredStokesSolverManager::DEFAULT_LEVEL_SOLVER = "DEFAULT_LEVEL_SOLVER";
 const std::string StaggeredStokesSolverManager::PETSC_LEVEL_SOLVER = "PETSC_LEVEL_SOLVER";
+const std::string StaggeredStokesSolverManager::PETSC_FIELDSPLIT_AMG_LEVEL_SOLVER =
+    "PETSC_FIELDSPLIT_AMG_LEVEL_SOLVER";
+const std::string StaggeredStokesSolverManager::FFT_LEVEL_SOLVER = "FFT_LEVEL_SOLVER";
 
 StaggeredStokesSolverManager* StaggeredStokesSolverManager::s_solver_manager_instance = nullptr;
 bool StaggeredStokesSolverManager::s_registered_callback = false;
@@ -178,6 +182,9 @@ StaggeredStokesSolverManager::StaggeredStokesSolverManager()
                                   StaggeredStokesLevelRelaxationFACOperator::allocate_solver);
     registerSolverFactoryFunction(DEFAULT_LEVEL_SOLVER, StaggeredStokesPETScLevelSolver::allocate_solver);
     registerSolverFactoryFunction(PETSC_LEVEL_SOLVER, StaggeredStokesPETScLevelSolver::allocate_solver);
+    registerSolverFactoryFunction(PETSC_FIELDSPLIT_AMG_LEVEL_SOLVER,
+                                  StaggeredStokesPETScLevelSolver::allocate_fieldsplit_amg_solver);
+    registerSolverFactoryFunction(FFT_LEVEL_SOLVER, StaggeredStokesFFTLevelSolver::allocate_solver);
     return;
 } // StaggeredStokesSolverManager
 
@@ -170,6 +170,26 @@ extern "C"
 
 namespace IBAMR
 {
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Return whether the data take the same value in every cell of the box.  This
+// is the case for the smoothed Heaviside function away from the band
+// -m*h < phi < m*h around the interface, where the surface tension force
+// vanishes.
+bool
+is_constant_on_box(const CellData<NDIM, double>& data, const Box<NDIM>& box)
+{
+    const double val = data(CellIndex<NDIM>(box.lower()));
+    for (Box<NDIM>::Iterator b(box); b; b++)
+    {
+        if (data(b()) != val) return false;
+    }
+    return true;
+} // is_constant_on_box
+} // namespace
+
 ////////////////////////////// PUBLIC ///////////////////////////////////////
 
 SurfaceTensionForceFunction::SurfaceTensionForceFunction(const std::string& object_name,
@@ -434,6 +454,13 @@ SurfaceTensionForceFunction::mollifyData(int smooth_C_idx,
             const Box<NDIM>& patch_box = patch->getBox();
 
             Pointer<CellData<NDIM, double> > smooth_C_data = patch->getPatchData(smooth_C_idx);
+
+            // Mollifying does not change data that are constant over the
+            // stencils of the patch cells, i.e., on patches that do not
+            // intersect the interface band.
+            const Box<NDIM> stencil_box = Box<NDIM>::grow(patch_box, IntVector<NDIM>(getStencilSize(d_kernel_fcn) / 2));
+            if (is_constant_on_box(*smooth_C_data, stencil_box)) continue;
+
             CellData<NDIM, double> C_data(patch_box, /*depth*/ 1, smooth_C_data->getGhostCellWidth());
 
             C_data.copy(*smooth_C_data);
@@ -498,6 +525,12 @@ SurfaceTensionForceFunction::setDataOnPatchSide(Pointer<SideData<NDIM, double> >
     Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const dx = pgeom->getDx();
 
+    // The force F = sigma * K * grad(C) vanishes on all patch faces if C is
+    // constant on the patch cells and the adjacent ghost cells, in which case
+    // F is left zero and the normal and curvature are not computed.
+    Pointer<CellData<NDIM, double> > C = patch->getPatchData(d_C_idx);
+    if (is_constant_on_box(*C, Box<NDIM>::grow(patch_box, IntVector<NDIM>(1)))) return;
+
     // First find normal in terms of gradient of phi.
     // N = grad(phi)
     SideData<NDIM, double> N(patch_box,
@@ -561,8 +594,6 @@ SurfaceTensionForceFunction::setDataOnPatchSide(Pointer<SideData<NDIM, double> >
                     dx);
 
     // Compute N = grad(C)
-    Pointer<CellData<NDIM, double> > C = patch->getPatchData(d_C_idx);
-
     SC_NORMAL_FC(N.getPointer(0, 0),
                  N.getPointer(0, 1),
 #if (NDIM == 3)
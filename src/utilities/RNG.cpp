@@ -20,7 +20,9 @@
 
 #include <mpi.h>
 
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
@@ -251,6 +253,48 @@ RNG::genrandn(double* result)
     return;
 } // genrandn
 
+std::array<std::uint32_t, 4>
+RNG::philox(const std::array<std::uint32_t, 2>& key, const std::array<std::uint32_t, 4>& counter)
+{
+    // Multipliers and Weyl sequence constants of Philox4x32 (Salmon et al.,
+    // "Parallel random numbers: as easy as 1, 2, 3", SC'11).
+    static const std::uint64_t PHILOX_M0 = 0xD2511F53;
+    static const std::uint64_t PHILOX_M1 = 0xCD9E8D57;
+    static const std::uint32_t PHILOX_W0 = 0x9E3779B9;
+    static const std::uint32_t PHILOX_W1 = 0xBB67AE85;
+    static const int PHILOX_ROUNDS = 10;
+
+    std::array<std::uint32_t, 4> ctr = counter;
+    std::array<std::uint32_t, 2> k = key;
+    for (int round = 0; round < PHILOX_ROUNDS; ++round)
+    {
+        const std::uint64_t prod0 = PHILOX_M0 * ctr[0];
+        const std::uint64_t prod1 = PHILOX_M1 * ctr[2];
+        ctr = { static_cast<std::uint32_t>(prod1 >> 32) ^ ctr[1] ^ k[0],
+                static_cast<std::uint32_t>(prod1),
+                static_cast<std::uint32_t>(prod0 >> 32) ^ ctr[3] ^ k[1],
+                static_cast<std::uint32_t>(prod0) };
+        k[0] += PHILOX_W0;
+        k[1] += PHILOX_W1;
+    }
+    return ctr;
+} // philox
+
+double
+RNG::genrand(const std::array<std::uint32_t, 2>& key, const std::array<std::uint32_t, 4>& counter)
+{
+    // Use 53 bits of the output to obtain a double in the open (0,1)-interval.
+    const std::array<std::uint32_t, 4> bits = philox(key, counter);
+    const std::uint64_t x = (static_cast<std::uint64_t>(bits[0]) << 21) ^ (bits[1] >> 11);
+    return (static_cast<double>(x & ((std::uint64_t(1) << 53) - 1)) + 0.5) * 1.1102230246251565e-16;
+} // genrand
+
+double
+RNG::genrandn(const std::array<std::uint32_t, 2>& key, const std::array<std::uint32_t, 4>& counter)
+{
+    return InvNormDist(genrand(key, counter));
+} // genrandn
+
 void
 RNG::parallel_seed(int global_seed)
 {
@@ -273,63 +273,83 @@ IrregularWaveBcCoef::getFromInput(Pointer<Database> input_db)
 double
 IrregularWaveBcCoef::getSurfaceElevation(double x, double time) const
 {
-    double eta = 0;
-    for (int i = 0; i < d_num_waves; i++)
-    {
-        const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-        eta += d_amplitude[i] * cos(theta);
-    }
-
-    return eta;
+    updateInletProfile(x, time);
+    return d_profile_eta;
 } // getSurfaceElevation
 
 double
 IrregularWaveBcCoef::getVelocity(double x, double z_plus_d, double time) const
 {
+#if (NDIM == 2)
+    const bool vertical_comp = d_comp_idx == 1;
+#elif (NDIM == 3)
+    const bool vertical_comp = d_comp_idx == 2;
+    if (d_comp_idx == 1) return 0.0;
+#endif
+    if (d_comp_idx != 0 && !vertical_comp) return std::numeric_limits<double>::signaling_NaN();
+
+    updateInletProfile(x, time);
+    auto it = d_velocity_profile.find(z_plus_d);
+    if (it != d_velocity_profile.end()) return it->second;
+
+    const std::vector<double>& z_profile = getVerticalProfile(z_plus_d);
+    double velocity_component = 0.0;
     if (d_comp_idx == 0)
     {
-        double velocity_component = 0.0;
+        const double* const cosh_kz = z_profile.data();
         for (int i = 0; i < d_num_waves; i++)
         {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * cosh(d_wave_number[i] * z_plus_d) * cos(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
+            velocity_component += cosh_kz[i] * d_cos_theta[i];
         }
-        return velocity_component;
     }
-    if (d_comp_idx == 1)
+    else
     {
-#if (NDIM == 2)
-        double velocity_component = 0.0;
+        const double* const sinh_kz = z_profile.data() + d_num_waves;
         for (int i = 0; i < d_num_waves; i++)
         {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * sinh(d_wave_number[i] * z_plus_d) * sin(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
+            velocity_component += sinh_kz[i] * d_sin_theta[i];
         }
-        return velocity_component;
-
-#elif (NDIM == 3)
-        return 0.0;
-#endif
     }
-#if (NDIM == 3)
-    if (d_comp_idx == 2)
+    d_velocity_profile.emplace(z_plus_d, velocity_component);
+    return velocity_component;
+} // getVelocity
+
+void
+IrregularWaveBcCoef::updateInletProfile(double x, double time) const
+{
+    if (x == d_profile_x && time == d_profile_time) return;
+
+    d_cos_theta.resize(d_num_waves);
+    d_sin_theta.resize(d_num_waves);
+    d_profile_eta = 0.0;
+    for (int i = 0; i < d_num_waves; i++)
     {
-        double velocity_component = 0.0;
-        for (int i = 0; i < d_num_waves; i++)
-        {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * sinh(d_wave_number[i] * z_plus_d) * sin(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
-        }
-        return velocity_component;
+        const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
+        d_cos_theta[i] = std::cos(theta);
+        d_sin_theta[i] = std::sin(theta);
+        d_profile_eta += d_amplitude[i] * d_cos_theta[i];
     }
-#endif
+    d_velocity_profile.clear();
+    d_profile_x = x;
+    d_profile_time = time;
+    return;
+} // updateInletProfile
 
-    return std::numeric_limits<double>::signaling_NaN();
-    ;
-} // getVelocity
+const std::vector<double>&
+IrregularWaveBcCoef::getVerticalProfile(double z_plus_d) const
+{
+    auto it = d_vertical_profiles.find(z_plus_d);
+    if (it != d_vertical_profiles.end()) return it->second;
+
+    std::vector<double> z_profile(2 * d_num_waves);
+    for (int i = 0; i < d_num_waves; i++)
+    {
+        const double scale = d_amplitude[i] * d_omega[i] / std::sinh(d_wave_number[i] * d_depth);
+        z_profile[i] = scale * std::cosh(d_wave_number[i] * z_plus_d);
+        z_profile[d_num_waves + i] = scale * std::sinh(d_wave_number[i] * z_plus_d);
+    }
+    return d_vertical_profiles.emplace(z_plus_d, std::move(z_profile)).first->second;
+} // getVerticalProfile
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <utility>
 
 #include "ibamr/app_namespaces.h" // IWYU pragma: keep
 
@@ -100,11 +101,17 @@ IrregularWaveGenerator::IrregularWaveGenerator(const std::string& object_name, P
 double
 IrregularWaveGenerator::getSurfaceElevation(const double x, const double time) const
 {
+    updatePhaseFactors(time);
+    const std::vector<double>& x_profile = getHorizontalProfile(x);
+    const double* const cos_kx = x_profile.data();
+    const double* const sin_kx = x_profile.data() + d_num_waves;
+
+    // cos(k x + phi - omega t) is expanded using the tabulated horizontal profile and the phase factors, so that
+    // the sum below is free of transcendental function calls.
     double eta = 0;
     for (int i = 0; i < d_num_waves; i++)
     {
-        const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-        eta += d_amplitude[i] * cos(theta);
+        eta += d_amplitude[i] * (cos_kx[i] * d_cos_phase[i] - sin_kx[i] * d_sin_phase[i]);
     }
 
     return eta;
@@ -113,49 +120,38 @@ IrregularWaveGenerator::getSurfaceElevation(const double x, const double time) c
 double
 IrregularWaveGenerator::getVelocity(const double x, const double z_plus_d, const double time, const int comp_idx) const
 {
+#if (NDIM == 2)
+    const bool vertical_comp = comp_idx == 1;
+#elif (NDIM == 3)
+    const bool vertical_comp = comp_idx == 2;
+    if (comp_idx == 1) return 0.0;
+#endif
+    if (comp_idx != 0 && !vertical_comp) return std::numeric_limits<double>::signaling_NaN();
+
+    updatePhaseFactors(time);
+    const std::vector<double>& x_profile = getHorizontalProfile(x);
+    const double* const cos_kx = x_profile.data();
+    const double* const sin_kx = x_profile.data() + d_num_waves;
+    const std::vector<double>& z_profile = getVerticalProfile(z_plus_d);
+
+    double velocity_component = 0.0;
     if (comp_idx == 0)
     {
-        double velocity_component = 0.0;
+        const double* const cosh_kz = z_profile.data();
         for (int i = 0; i < d_num_waves; i++)
         {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * cosh(d_wave_number[i] * z_plus_d) * cos(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
+            velocity_component += cosh_kz[i] * (cos_kx[i] * d_cos_phase[i] - sin_kx[i] * d_sin_phase[i]);
         }
-        return velocity_component;
     }
-    if (comp_idx == 1)
+    else
     {
-#if (NDIM == 2)
-        double velocity_component = 0.0;
+        const double* const sinh_kz = z_profile.data() + d_num_waves;
         for (int i = 0; i < d_num_waves; i++)
         {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * sinh(d_wave_number[i] * z_plus_d) * sin(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
+            velocity_component += sinh_kz[i] * (sin_kx[i] * d_cos_phase[i] + cos_kx[i] * d_sin_phase[i]);
         }
-        return velocity_component;
-
-#elif (NDIM == 3)
-        return 0.0;
-#endif
     }
-#if (NDIM == 3)
-    if (comp_idx == 2)
-    {
-        double velocity_component = 0.0;
-        for (int i = 0; i < d_num_waves; i++)
-        {
-            const double theta = d_wave_number[i] * x - d_omega[i] * time + d_phase[i];
-            velocity_component += d_amplitude[i] * d_omega[i] * sinh(d_wave_number[i] * z_plus_d) * sin(theta) /
-                                  sinh(d_wave_number[i] * d_depth);
-        }
-        return velocity_component;
-    }
-#endif
-
-    return std::numeric_limits<double>::signaling_NaN();
-
+    return velocity_component;
 } // getVelocity
 
 void
@@ -194,4 +190,52 @@ IrregularWaveGenerator::getFromInput(Pointer<Database> input_db)
     return;
 } // getFromInput
 
+void
+IrregularWaveGenerator::updatePhaseFactors(const double time) const
+{
+    if (time == d_phase_time) return;
+
+    d_cos_phase.resize(d_num_waves);
+    d_sin_phase.resize(d_num_waves);
+    for (int i = 0; i < d_num_waves; i++)
+    {
+        const double psi = d_phase[i] - d_omega[i] * time;
+        d_cos_phase[i] = std::cos(psi);
+        d_sin_phase[i] = std::sin(psi);
+    }
+    d_phase_time = time;
+    return;
+} // updatePhaseFactors
+
+const std::vector<double>&
+IrregularWaveGenerator::getHorizontalProfile(const double x) const
+{
+    auto it = d_horizontal_profiles.find(x);
+    if (it != d_horizontal_profiles.end()) return it->second;
+
+    std::vector<double> x_profile(2 * d_num_waves);
+    for (int i = 0; i < d_num_waves; i++)
+    {
+        x_profile[i] = std::cos(d_wave_number[i] * x);
+        x_profile[d_num_waves + i] = std::sin(d_wave_number[i] * x);
+    }
+    return d_horizontal_profiles.emplace(x, std::move(x_profile)).first->second;
+} // getHorizontalProfile
+
+const std::vector<double>&
+IrregularWaveGenerator::getVerticalProfile(const double z_plus_d) const
+{
+    auto it = d_vertical_profiles.find(z_plus_d);
+    if (it != d_vertical_profiles.end()) return it->second;
+
+    std::vector<double> z_profile(2 * d_num_waves);
+    for (int i = 0; i < d_num_waves; i++)
+    {
+        const double scale = d_amplitude[i] * d_omega[i] / std::sinh(d_wave_number[i] * d_depth);
+        z_profile[i] = scale * std::cosh(d_wave_number[i] * z_plus_d);
+        z_profile[d_num_waves + i] = scale * std::sinh(d_wave_number[i] * z_plus_d);
+    }
+    return d_vertical_profiles.emplace(z_plus_d, std::move(z_profile)).first->second;
+} // getVerticalProfile
+
 } // namespace IBAMR
@@ -128,6 +128,14 @@ MassConservationFunctor::operator()(const double& alpha)
             Pointer<CellData<NDIM, double> > I_data = patch->getPatchData(d_I_idx);
             Pointer<CellData<NDIM, double> > dI_data = patch->getPatchData(d_dI_idx);
 
+            // The integrand vanishes outside of the absorption region.
+            if (patch_geom->getXUpper()[0] < x_zone_start || patch_x_lower[0] > x_zone_end)
+            {
+                I_data->fillAll(0.0);
+                dI_data->fillAll(0.0);
+                continue;
+            }
+
             for (Box<NDIM>::Iterator it(patch_box); it; it++)
             {
                 SAMRAI::hier::Index<NDIM> i = it();
@@ -226,43 +234,67 @@ MassConservationFunctor::operator()(const double& alpha)
     return std::make_pair(val, dval);
 } // MassConservationFunctor::operator()
 
-} // namespace
-
-/////////////////////////////// PUBLIC ///////////////////////////////////////
-
-namespace WaveDampingFunctions
+/*!
+ * Tabulate the damping weights gamma(xtilde) along the x-axis of \a box, whose
+ * x-positions are x_lower + dx * (i(0) - patch_lower + x_shift), and trim \a box
+ * to the indices that lie in the zone. Returns false if no index lies in the zone.
+ *
+ * The weights depend only upon the x-position, so they are computed once per
+ * column rather than once per cell or side.
+ */
+template <class RampFcn>
+bool
+tabulateZoneWeights(Box<NDIM>& box,
+                    const double x_lower,
+                    const double dx,
+                    const int patch_lower,
+                    const double x_shift,
+                    const double x_zone_start,
+                    const double x_zone_end,
+                    RampFcn ramp,
+                    std::vector<double>& gamma)
 {
+    gamma.clear();
+    int zone_lower = box.upper(0) + 1, zone_upper = box.lower(0) - 1;
+    for (int i0 = box.lower(0); i0 <= box.upper(0); ++i0)
+    {
+        const double x_posn = x_lower + dx * (static_cast<double>(i0 - patch_lower) + x_shift);
+        if (x_posn >= x_zone_start && x_posn <= x_zone_end)
+        {
+            if (gamma.empty()) zone_lower = i0;
+            zone_upper = i0;
+            gamma.push_back(ramp((x_posn - x_zone_start) / (x_zone_end - x_zone_start)));
+        }
+    }
+    if (gamma.empty()) return false;
+    box.lower(0) = zone_lower;
+    box.upper(0) = zone_upper;
+    return true;
+} // tabulateZoneWeights
+
+/*!
+ * Blend the velocity and the level set towards the calm water state within the
+ * damping zone, i.e. u = gamma * u and phi = gamma * phi + (1 - gamma) * phi_target,
+ * with the damping weight gamma given by \a ramp as a function of the normalized
+ * position in the zone. Patches that do not intersect the zone are skipped.
+ */
+template <class RampFcn>
 void
-callRelaxationZoneCallbackFunction(double /*current_time*/,
-                                   double /*new_time*/,
-                                   bool /*skip_synchronize_new_state_data*/,
-                                   int /*num_cycles*/,
-                                   void* ctx)
+applyDampingZone(Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                 const int u_new_idx,
+                 const int phi_new_idx,
+                 const WaveDampingData* ptr_wave_damper,
+                 RampFcn ramp)
 {
-    auto ptr_wave_damper = static_cast<WaveDampingData*>(ctx);
     const double x_zone_start = ptr_wave_damper->d_x_zone_start;
     const double x_zone_end = ptr_wave_damper->d_x_zone_end;
     const double depth = ptr_wave_damper->d_depth;
-    const double alpha = ptr_wave_damper->d_alpha;
     const double sign_gas = ptr_wave_damper->d_sign_gas_phase;
-
-    Pointer<PatchHierarchy<NDIM> > patch_hierarchy = ptr_wave_damper->d_ins_hier_integrator->getPatchHierarchy();
-    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
-    int u_new_idx = var_db->mapVariableAndContextToIndex(ptr_wave_damper->d_ins_hier_integrator->getVelocityVariable(),
-                                                         ptr_wave_damper->d_ins_hier_integrator->getNewContext());
-
-    Pointer<CellVariable<NDIM, double> > phi_cc_var = ptr_wave_damper->d_phi_var;
-    if (!phi_cc_var)
-        TBOX_ERROR(
-            "WaveDampingStrategy::callRelaxationZoneCallbackFunction: Level "
-            "set variable must be cell centered!");
-    int phi_new_idx =
-        var_db->mapVariableAndContextToIndex(phi_cc_var, ptr_wave_damper->d_adv_diff_hier_integrator->getNewContext());
     static const int dir = NDIM == 2 ? 1 : 2;
 
+    std::vector<double> gamma;
     const int coarsest_ln = 0;
     const int finest_ln = patch_hierarchy->getFinestLevelNumber();
-
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
@@ -270,75 +302,102 @@ callRelaxationZoneCallbackFunction(double /*current_time*/,
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-            const double* const patch_dx = patch_geom->getDx();
             const double* const patch_x_lower = patch_geom->getXLower();
+            const double* const patch_x_upper = patch_geom->getXUpper();
+            if (patch_x_upper[0] < x_zone_start || patch_x_lower[0] > x_zone_end) continue;
+
+            const double* const patch_dx = patch_geom->getDx();
             const Box<NDIM>& patch_box = patch->getBox();
             const IntVector<NDIM>& patch_lower = patch_box.lower();
 
+            // Damp the velocity.
             Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_new_idx);
-
             for (int axis = 0; axis < NDIM; ++axis)
             {
-                for (Box<NDIM>::Iterator it(SideGeometry<NDIM>::toSideBox(patch_box, axis)); it; it++)
+                if (axis != 0 && axis != dir) continue;
+
+                Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+                if (!tabulateZoneWeights(side_box,
+                                         patch_x_lower[0],
+                                         patch_dx[0],
+                                         patch_lower(0),
+                                         axis == 0 ? 0.0 : 0.5,
+                                         x_zone_start,
+                                         x_zone_end,
+                                         ramp,
+                                         gamma))
                 {
-                    SAMRAI::hier::Index<NDIM> i = it();
-                    SideIndex<NDIM> i_side(i, axis, SideIndex<NDIM>::Lower);
-                    double x_posn = patch_x_lower[0] + patch_dx[0] * (static_cast<double>(i(0) - patch_lower(0)));
-                    const double shift_x = (axis == 0 ? 0.0 : 0.5);
-                    x_posn += patch_dx[0] * shift_x;
-
-                    if (x_posn >= x_zone_start && x_posn <= x_zone_end)
-                    {
-                        const double xtilde = (x_posn - x_zone_start) / (x_zone_end - x_zone_start);
-                        const double gamma = 1.0 - std::expm1(std::pow(xtilde, alpha)) / std::expm1(1.0);
-                        const double target = 0.0;
-
-                        if (axis == 0 || axis == dir)
-                        {
-                            (*u_data)(i_side, 0) = gamma * (*u_data)(i_side, 0) + (1.0 - gamma) * target;
-                        }
-                    }
+                    continue;
+                }
+                for (Box<NDIM>::Iterator it(side_box); it; it++)
+                {
+                    const SideIndex<NDIM> i_side(it(), axis, SideIndex<NDIM>::Lower);
+                    (*u_data)(i_side, 0) *= gamma[it()(0) - side_box.lower(0)];
                 }
             }
-        }
-    }
-
-    // Modify the level set in the generation zone.
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-            const double* const patch_dx = patch_geom->getDx();
-            const double* const patch_x_lower = patch_geom->getXLower();
-            const Box<NDIM>& patch_box = patch->getBox();
-            const IntVector<NDIM>& patch_lower = patch_box.lower();
 
+            // Modify the level set.
+            Box<NDIM> cell_box = patch_box;
+            if (!tabulateZoneWeights(cell_box,
+                                     patch_x_lower[0],
+                                     patch_dx[0],
+                                     patch_lower(0),
+                                     0.5,
+                                     x_zone_start,
+                                     x_zone_end,
+                                     ramp,
+                                     gamma))
+            {
+                continue;
+            }
             Pointer<CellData<NDIM, double> > phi_data = patch->getPatchData(phi_new_idx);
-            for (Box<NDIM>::Iterator it(patch_box); it; it++)
+            for (Box<NDIM>::Iterator it(cell_box); it; it++)
             {
-                SAMRAI::hier::Index<NDIM> i = it();
+                const CellIndex<NDIM> ci(it());
+                const double dir_posn =
+                    patch_x_lower[dir] + patch_dx[dir] * (static_cast<double>(ci(dir) - patch_lower(dir)) + 0.5);
+                const double target = sign_gas * (dir_posn - depth);
+                const double g = gamma[ci(0) - cell_box.lower(0)];
+                (*phi_data)(ci, 0) = g * (*phi_data)(ci, 0) + (1.0 - g) * target;
+            }
+        }
+    }
+    return;
+} // applyDampingZone
 
-                const auto x_posn = patch_x_lower[0] + patch_dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5);
+} // namespace
 
-                const auto dir_posn =
-                    patch_x_lower[dir] + patch_dx[dir] * (static_cast<double>(i(dir) - patch_lower(dir)) + 0.5);
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+namespace WaveDampingFunctions
+{
+void
+callRelaxationZoneCallbackFunction(double /*current_time*/,
+                                   double /*new_time*/,
+                                   bool /*skip_synchronize_new_state_data*/,
+                                   int /*num_cycles*/,
+                                   void* ctx)
+{
+    auto ptr_wave_damper = static_cast<WaveDampingData*>(ctx);
+    const double alpha = ptr_wave_damper->d_alpha;
 
-                const double dir_surface = sign_gas * (dir_posn - depth);
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy = ptr_wave_damper->d_ins_hier_integrator->getPatchHierarchy();
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    int u_new_idx = var_db->mapVariableAndContextToIndex(ptr_wave_damper->d_ins_hier_integrator->getVelocityVariable(),
+                                                         ptr_wave_damper->d_ins_hier_integrator->getNewContext());
 
-                if (x_posn >= x_zone_start && x_posn <= x_zone_end)
-                {
-                    const double xtilde = (x_posn - x_zone_start) / (x_zone_end - x_zone_start);
-                    const double gamma = 1.0 - std::expm1(std::pow(xtilde, alpha)) / std::expm1(1.0);
-                    const double target = dir_surface;
+    Pointer<CellVariable<NDIM, double> > phi_cc_var = ptr_wave_damper->d_phi_var;
+    if (!phi_cc_var)
+        TBOX_ERROR(
+            "WaveDampingStrategy::callRelaxationZoneCallbackFunction: Level "
+            "set variable must be cell centered!");
+    int phi_new_idx =
+        var_db->mapVariableAndContextToIndex(phi_cc_var, ptr_wave_damper->d_adv_diff_hier_integrator->getNewContext());
 
-                    (*phi_data)(i, 0) = gamma * (*phi_data)(i, 0) + (1.0 - gamma) * target;
-                }
-            }
-        }
-    }
+    applyDampingZone(
+        patch_hierarchy, u_new_idx, phi_new_idx, ptr_wave_damper, [alpha](const double xtilde) {
+            return 1.0 - std::expm1(std::pow(xtilde, alpha)) / std::expm1(1.0);
+        });
 
     return;
 } // callRelaxationZoneCallbackFunction
@@ -353,10 +412,6 @@ callConservedWaveAbsorbingCallbackFunction(double current_time,
     // Reference: Hu Zhe, et al., "Numerical Wave Tank Based on A Conserved
     // Wave-Absorbing Method"
     auto ptr_wave_damper = static_cast<WaveDampingData*>(ctx);
-    const double x_zone_start = ptr_wave_damper->d_x_zone_start;
-    const double x_zone_end = ptr_wave_damper->d_x_zone_end;
-    const double depth = ptr_wave_damper->d_depth;
-    const double sign_gas = ptr_wave_damper->d_sign_gas_phase;
 
     // Initialize the required variables
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
@@ -451,81 +506,11 @@ callConservedWaveAbsorbingCallbackFunction(double current_time,
     plog << "alpha relaxation dynamic = " << alpha << std::endl;
 
     // Carry out the damping
-    static const int dir = NDIM == 2 ? 1 : 2;
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-            const double* const patch_dx = patch_geom->getDx();
-            const double* const patch_x_lower = patch_geom->getXLower();
-            const Box<NDIM>& patch_box = patch->getBox();
-            const IntVector<NDIM>& patch_lower = patch_box.lower();
-
-            Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_new_idx);
-
-            for (int axis = 0; axis < NDIM; ++axis)
-            {
-                for (Box<NDIM>::Iterator it(SideGeometry<NDIM>::toSideBox(patch_box, axis)); it; it++)
-                {
-                    SAMRAI::hier::Index<NDIM> i = it();
-                    SideIndex<NDIM> i_side(i, axis, SideIndex<NDIM>::Lower);
-                    double x_posn = patch_x_lower[0] + patch_dx[0] * (static_cast<double>(i(0) - patch_lower(0)));
-                    const double shift_x = (axis == 0 ? 0.0 : 0.5);
-                    x_posn += patch_dx[0] * shift_x;
-                    if (x_posn >= x_zone_start && x_posn <= x_zone_end)
-                    {
-                        double xtilde = (x_posn - x_zone_start) / (x_zone_end - x_zone_start);
-                        double gamma = 1.0 - exp(-5.0 * std::pow(1.0 - xtilde, alpha));
-                        const double target = 0.0;
-
-                        if (axis == 0 || axis == dir)
-                        {
-                            (*u_data)(i_side, 0) = gamma * (*u_data)(i_side, 0) + (1.0 - gamma) * target;
-                        }
-                    }
-                }
-            }
-        }
-    }
-
-    // Modify the level set in the generation zone.
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-            const double* const patch_dx = patch_geom->getDx();
-            const double* const patch_x_lower = patch_geom->getXLower();
-            const Box<NDIM>& patch_box = patch->getBox();
-            const IntVector<NDIM>& patch_lower = patch_box.lower();
-
-            Pointer<CellData<NDIM, double> > phi_data = patch->getPatchData(phi_new_idx);
-            for (Box<NDIM>::Iterator it(patch_box); it; it++)
-            {
-                SAMRAI::hier::Index<NDIM> i = it();
-
-                const auto x_posn = patch_x_lower[0] + patch_dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5);
-
-                const auto dir_posn =
-                    patch_x_lower[dir] + patch_dx[dir] * (static_cast<double>(i(dir) - patch_lower(dir)) + 0.5);
-                const double dir_surface = sign_gas * (dir_posn - depth);
-
-                if (x_posn >= x_zone_start && x_posn <= x_zone_end)
-                {
-                    double xtilde = (x_posn - x_zone_start) / (x_zone_end - x_zone_start);
-                    double gamma = 1.0 - exp(-5.0 * std::pow(1.0 - xtilde, alpha));
-                    double target = dir_surface;
-
-                    (*phi_data)(i, 0) = gamma * (*phi_data)(i, 0) + (1.0 - gamma) * target;
-                }
-            }
-        }
-    }
+    applyDampingZone(patch_hierarchy,
+                     u_new_idx,
+                     phi_new_idx,
+                     ptr_wave_damper,
+                     [alpha](const double xtilde) { return 1.0 - exp(-5.0 * std::pow(1.0 - xtilde, alpha)); });
 
     // Deallocate patch data and remove indices
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
@@ -0,0 +1,116 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#include <ibtk/IBTKInit.h>
+#include <ibtk/LEInteractor.h>
+#include <ibtk/ibtk_enums.h>
+#include <ibtk/kernel_functions.h>
+
+#include <tbox/PIO.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <ibtk/app_namespaces.h>
+
+// Check that KernelFunction<kernel>::weights() agrees with
+// KernelFunction<kernel>::value() and that the weights form a partition of
+// unity. The cost of evaluating the weights is also measured: since timings are
+// not reproducible they are only written to the log file and not to the output
+// file.
+template <KernelFunctionType kernel>
+void
+test_kernel(std::ofstream& out, const int n_points)
+{
+    using Kernel = KernelFunction<kernel>;
+    constexpr int support = Kernel::support;
+    const double r_lower = (support % 2 == 0) ? 0.5 * support - 1.0 : 0.5 * (support - 1) - 0.5;
+
+    std::vector<double> r(n_points);
+    for (int i = 0; i < n_points; ++i)
+    {
+        r[i] = r_lower + static_cast<double>(i) / static_cast<double>(n_points);
+    }
+
+    double max_value_err = 0.0;
+    double max_sum_err = 0.0;
+    for (int i = 0; i < n_points; ++i)
+    {
+        double w[support];
+        Kernel::weights(r[i], w);
+        double sum = 0.0;
+        for (int k = 0; k < support; ++k)
+        {
+            max_value_err = std::max(max_value_err, std::abs(w[k] - Kernel::value(r[i] - k)));
+            sum += w[k];
+        }
+        max_sum_err = std::max(max_sum_err, std::abs(sum - 1.0));
+    }
+
+    const std::string name = enum_to_string<KernelFunctionType>(kernel);
+    out << name << " support: " << support << "\n";
+    out << name << " stencil size: " << LEInteractor::getStencilSize(kernel) << "\n";
+    out << name << " weights match values: " << (max_value_err < 1.0e-12 ? "yes" : "no") << "\n";
+    out << name << " weights sum to one: " << (max_sum_err < 1.0e-12 ? "yes" : "no") << "\n";
+
+    // Time the evaluation of full rows of weights.
+    std::vector<double> w(support * n_points);
+    const auto weights_start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n_points; ++i)
+    {
+        Kernel::weights(r[i], &w[support * i]);
+    }
+    const auto weights_end = std::chrono::steady_clock::now();
+    double checksum = 0.0;
+    for (const double w_k : w) checksum += w_k;
+
+    // Time the evaluation of the same weights one value at a time.
+    const auto values_start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n_points; ++i)
+    {
+        for (int k = 0; k < support; ++k)
+        {
+            w[support * i + k] = Kernel::value(r[i] - k);
+        }
+    }
+    const auto values_end = std::chrono::steady_clock::now();
+    for (const double w_k : w) checksum += w_k;
+
+    const double weights_ns = std::chrono::duration<double, std::nano>(weights_end - weights_start).count();
+    const double values_ns = std::chrono::duration<double, std::nano>(values_end - values_start).count();
+    plog << name << ": weights() " << weights_ns / n_points << " ns/point, value() " << values_ns / n_points
+         << " ns/point (checksum " << checksum << ")\n";
+}
+
+int
+main(int argc, char* argv[])
+{
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    std::ofstream out("output");
+
+    const int n_points = 1 << 20;
+    test_kernel<PIECEWISE_LINEAR_KERNEL>(out, n_points);
+    test_kernel<PIECEWISE_CUBIC_KERNEL>(out, n_points);
+    test_kernel<IB_3_KERNEL>(out, n_points);
+    test_kernel<IB_4_KERNEL>(out, n_points);
+    test_kernel<IB_5_KERNEL>(out, n_points);
+    test_kernel<BSPLINE_3_KERNEL>(out, n_points);
+    test_kernel<BSPLINE_4_KERNEL>(out, n_points);
+    test_kernel<BSPLINE_5_KERNEL>(out, n_points);
+    test_kernel<BSPLINE_6_KERNEL>(out, n_points);
+}
@@ -30,6 +30,7 @@
 #include <ibtk/CCLaplaceOperator.h>
 #include <ibtk/IBTKInit.h>
 #include <ibtk/IBTK_MPI.h>
+#include <ibtk/NormOps.h>
 #include <ibtk/muParserCartGridFunction.h>
 
 // Set up application namespace declarations
@@ -185,12 +186,21 @@ main(int argc, char* argv[])
         const double l2_norm = e_vec.L2Norm();
         const double l1_norm = e_vec.L1Norm();
 
+        // The norms computed in a single pass must agree with the ones
+        // computed separately.
+        const NormOps::Norms e_norms = NormOps::norms(&e_vec);
+        const double tol = 1.0e-10;
+        const bool norms_agree = std::abs(e_norms.max - max_norm) <= tol * max_norm &&
+                                 std::abs(e_norms.L2 - l2_norm) <= tol * l2_norm &&
+                                 std::abs(e_norms.L1 - l1_norm) <= tol * l1_norm;
+
         if (IBTK_MPI::getRank() == 0)
         {
             std::ofstream out("output");
             out << "|e|_oo = " << max_norm << "\n";
             out << "|e|_2  = " << l2_norm << "\n";
             out << "|e|_1  = " << l1_norm << "\n";
+            if (!norms_agree) out << "NormOps::norms() does not agree with SAMRAIVectorReal norms\n";
         }
 
         // Finally, we clean up the output by setting error values on patches
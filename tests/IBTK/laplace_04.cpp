@@ -0,0 +1,246 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCLaplaceOperator.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/SCLaplaceOperator.h>
+#include <ibtk/muParserCartGridFunction.h>
+#include <ibtk/muParserRobinBcCoefs.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Test that the cell-centered and side-centered Laplace operators compute the
+// same result when the ghost cell exchange is overlapped with the computation
+// at interior indices (as enabled by setOverlapGhostCellFill() on a single
+// patch level with constant coefficients) as when all ghost cells are filled
+// first (the default).
+
+namespace
+{
+// Apply op_overlap and op_reference to u and print the largest difference
+// between the results relative to the largest result.
+void
+compare_apply(LaplaceOperator& op_overlap,
+              LaplaceOperator& op_reference,
+              SAMRAIVectorReal<NDIM, double>& u_vec,
+              SAMRAIVectorReal<NDIM, double>& f_overlap_vec,
+              SAMRAIVectorReal<NDIM, double>& f_reference_vec,
+              const std::string& label,
+              std::ostream& out)
+{
+    op_overlap.apply(u_vec, f_overlap_vec);
+    op_reference.apply(u_vec, f_reference_vec);
+    const double f_max_norm = f_reference_vec.maxNorm();
+    f_overlap_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&f_overlap_vec, false),
+                           Pointer<SAMRAIVectorReal<NDIM, double> >(&f_reference_vec, false));
+    const double diff_max_norm = f_overlap_vec.maxNorm();
+    out << label << ": relative difference below 1e-12: " << (diff_max_norm <= 1.0e-12 * f_max_norm ? "yes" : "no")
+        << "\n";
+    return;
+} // compare_apply
+} // namespace
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "laplace_04.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application. These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > u_cc_var = new CellVariable<NDIM, double>("u_cc");
+        Pointer<CellVariable<NDIM, double> > f_overlap_cc_var = new CellVariable<NDIM, double>("f_overlap_cc");
+        Pointer<CellVariable<NDIM, double> > f_reference_cc_var = new CellVariable<NDIM, double>("f_reference_cc");
+        const int u_cc_idx = var_db->registerVariableAndContext(u_cc_var, ctx, IntVector<NDIM>(1));
+        const int f_overlap_cc_idx = var_db->registerVariableAndContext(f_overlap_cc_var, ctx, IntVector<NDIM>(1));
+        const int f_reference_cc_idx =
+            var_db->registerVariableAndContext(f_reference_cc_var, ctx, IntVector<NDIM>(1));
+
+        Pointer<SideVariable<NDIM, double> > u_sc_var = new SideVariable<NDIM, double>("u_sc");
+        Pointer<SideVariable<NDIM, double> > f_overlap_sc_var = new SideVariable<NDIM, double>("f_overlap_sc");
+        Pointer<SideVariable<NDIM, double> > f_reference_sc_var = new SideVariable<NDIM, double>("f_reference_sc");
+        const int u_sc_idx = var_db->registerVariableAndContext(u_sc_var, ctx, IntVector<NDIM>(1));
+        const int f_overlap_sc_idx = var_db->registerVariableAndContext(f_overlap_sc_var, ctx, IntVector<NDIM>(1));
+        const int f_reference_sc_idx =
+            var_db->registerVariableAndContext(f_reference_sc_var, ctx, IntVector<NDIM>(1));
+
+        // The overlapped computation is only used on a hierarchy consisting
+        // of level zero.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        TBOX_ASSERT(patch_hierarchy->getFinestLevelNumber() == 0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        for (const int idx :
+             { u_cc_idx, f_overlap_cc_idx, f_reference_cc_idx, u_sc_idx, f_overlap_sc_idx, f_reference_sc_idx })
+        {
+            level->allocatePatchData(idx, 0.0);
+        }
+
+        // Make sure that the test covers both patches in the interior of the
+        // domain and patches that touch the physical boundary.
+        int num_patches = 0, num_bdry_patches = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            ++num_patches;
+            if (pgeom->intersectsPhysicalBoundary()) ++num_bdry_patches;
+        }
+        num_patches = IBTK_MPI::sumReduction(num_patches);
+        num_bdry_patches = IBTK_MPI::sumReduction(num_bdry_patches);
+
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int cv_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        const int cv_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+
+        SAMRAIVectorReal<NDIM, double> u_cc_vec("u_cc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> f_overlap_cc_vec("f_overlap_cc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> f_reference_cc_vec("f_reference_cc", patch_hierarchy, 0, 0);
+        u_cc_vec.addComponent(u_cc_var, u_cc_idx, cv_cc_idx);
+        f_overlap_cc_vec.addComponent(f_overlap_cc_var, f_overlap_cc_idx, cv_cc_idx);
+        f_reference_cc_vec.addComponent(f_reference_cc_var, f_reference_cc_idx, cv_cc_idx);
+
+        SAMRAIVectorReal<NDIM, double> u_sc_vec("u_sc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> f_overlap_sc_vec("f_overlap_sc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> f_reference_sc_vec("f_reference_sc", patch_hierarchy, 0, 0);
+        u_sc_vec.addComponent(u_sc_var, u_sc_idx, cv_sc_idx);
+        f_overlap_sc_vec.addComponent(f_overlap_sc_var, f_overlap_sc_idx, cv_sc_idx);
+        f_reference_sc_vec.addComponent(f_reference_sc_var, f_reference_sc_idx, cv_sc_idx);
+
+        muParserCartGridFunction u_fcn("u", app_initializer->getComponentDatabase("u"), grid_geometry);
+        u_fcn.setDataOnPatchHierarchy(u_cc_idx, u_cc_var, patch_hierarchy, 0.0);
+        u_fcn.setDataOnPatchHierarchy(u_sc_idx, u_sc_var, patch_hierarchy, 0.0);
+
+        PoissonSpecifications poisson_spec("poisson_spec");
+        poisson_spec.setCConstant(input_db->getDouble("C_COEFFICIENT"));
+        poisson_spec.setDConstant(input_db->getDouble("D_COEFFICIENT"));
+        muParserRobinBcCoefs bc_coef("u_bc_coef", app_initializer->getComponentDatabase("UBcCoefs"), grid_geometry);
+        const std::vector<RobinBcCoefStrategy<NDIM>*> sc_bc_coefs(NDIM, &bc_coef);
+
+        std::ostringstream out;
+        out << "number of patches: " << num_patches << "\n";
+        out << "number of patches touching the physical boundary: " << num_bdry_patches << "\n";
+
+        for (const bool homogeneous_bc : { false, true })
+        {
+            const std::string bc_label = homogeneous_bc ? " (homogeneous bcs)" : "";
+
+            CCLaplaceOperator cc_op_overlap("cc_op_overlap", homogeneous_bc);
+            CCLaplaceOperator cc_op_reference("cc_op_reference", homogeneous_bc);
+            cc_op_overlap.setOverlapGhostCellFill(true);
+            for (CCLaplaceOperator* op : { &cc_op_overlap, &cc_op_reference })
+            {
+                op->setPoissonSpecifications(poisson_spec);
+                op->setPhysicalBcCoef(&bc_coef);
+                op->initializeOperatorState(u_cc_vec, f_overlap_cc_vec);
+            }
+
+            SCLaplaceOperator sc_op_overlap("sc_op_overlap", homogeneous_bc);
+            SCLaplaceOperator sc_op_reference("sc_op_reference", homogeneous_bc);
+            sc_op_overlap.setOverlapGhostCellFill(true);
+            for (SCLaplaceOperator* op : { &sc_op_overlap, &sc_op_reference })
+            {
+                op->setPoissonSpecifications(poisson_spec);
+                op->setPhysicalBcCoefs(sc_bc_coefs);
+                op->initializeOperatorState(u_sc_vec, f_overlap_sc_vec);
+            }
+
+            // Apply each operator twice so that the reuse of the communication
+            // schedule is also tested.
+            for (int apply_num = 0; apply_num < 2; ++apply_num)
+            {
+                const std::string label = " apply " + std::to_string(apply_num) + bc_label;
+                compare_apply(cc_op_overlap,
+                              cc_op_reference,
+                              u_cc_vec,
+                              f_overlap_cc_vec,
+                              f_reference_cc_vec,
+                              "cell-centered" + label,
+                              out);
+                compare_apply(sc_op_overlap,
+                              sc_op_reference,
+                              u_sc_vec,
+                              f_overlap_sc_vec,
+                              f_reference_sc_vec,
+                              "side-centered" + label,
+                              out);
+                u_cc_vec.scale(-2.0, Pointer<SAMRAIVectorReal<NDIM, double> >(&u_cc_vec, false));
+                u_sc_vec.scale(-2.0, Pointer<SAMRAIVectorReal<NDIM, double> >(&u_sc_vec, false));
+            }
+        }
+
+        if (IBTK_MPI::getRank() == 0)
+        {
+            std::ofstream output("output");
+            output << out.str();
+        }
+    }
+} // main
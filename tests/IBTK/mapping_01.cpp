@@ -50,10 +50,12 @@ test(LibMeshInit& init)
         break;
     case TRI3:
     case TRI6:
+    case QUAD8:
         MeshTools::Generation::build_square(mesh, 3, 3, 0.0, 0.5, 0.0, 2.0, elem_type);
         break;
     case TET4:
     case TET10:
+    case HEX20:
         MeshTools::Generation::build_cube(mesh, 3, 3, 3, 0.0, 0.5, 0.0, 0.25, 0.0, 8.0, elem_type);
         break;
     default:
@@ -117,12 +119,14 @@ main(int argc, char** argv)
     test<2, SECOND, LAGRANGE, TRI6>(init);
     test<2, FIRST, LAGRANGE, QUAD4>(init);
     test<2, SECOND, LAGRANGE, QUAD9>(init);
+    test<2, SECOND, LAGRANGE, QUAD8>(init);
 
     // 3d
     test<3, FIRST, LAGRANGE, TET4>(init);
     test<3, SECOND, LAGRANGE, TET10>(init);
     test<3, FIRST, LAGRANGE, HEX8>(init);
     test<3, SECOND, LAGRANGE, HEX27>(init);
+    test<3, SECOND, LAGRANGE, HEX20>(init);
 
     std::ofstream output("output");
 }
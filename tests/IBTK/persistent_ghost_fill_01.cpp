@@ -0,0 +1,224 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyGhostCellInterpolation.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+
+#include <ArrayData.h>
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SAMRAI_config.h>
+#include <SideData.h>
+#include <SideGeometry.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <ibtk/app_namespaces.h>
+
+// Check that HierarchyGhostCellInterpolation fills the ghost cells of a single
+// periodic patch level in the same way with persistent schedules (i.e., with a
+// PersistentGhostFillSchedule) as with the standard SAMRAI RefineSchedule.
+// Ghost values are first set to a sentinel value so that ghost cells that are
+// not filled at all are also detected.
+
+namespace
+{
+static const double SENTINEL = -1.0e10;
+
+// A value that differs at every index, data axis, and depth.
+double
+index_value(const hier::Index<NDIM>& i, const int axis, const int depth)
+{
+    double value = 1.0 + axis + 10.0 * depth;
+    double scale = 100.0;
+    for (int d = 0; d < NDIM; ++d)
+    {
+        value += scale * i(d);
+        scale *= 100.0;
+    }
+    return value;
+} // index_value
+
+void
+set_values(ArrayData<NDIM, double>& data, const Box<NDIM>& interior_box, const int axis)
+{
+    data.fillAll(SENTINEL);
+    for (Box<NDIM>::Iterator b(interior_box); b; b++)
+    {
+        for (int depth = 0; depth < data.getDepth(); ++depth)
+        {
+            data(b(), depth) = index_value(b(), axis, depth);
+        }
+    }
+    return;
+} // set_values
+
+void
+compare_values(const ArrayData<NDIM, double>& ref_data,
+               const ArrayData<NDIM, double>& data,
+               double& max_diff,
+               int& num_ref_unfilled,
+               int& num_unfilled)
+{
+    const std::size_t size = static_cast<std::size_t>(ref_data.getBox().size()) * ref_data.getDepth();
+    const double* const ref_vals = ref_data.getPointer();
+    const double* const vals = data.getPointer();
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        max_diff = std::max(max_diff, std::abs(vals[i] - ref_vals[i]));
+        if (ref_vals[i] == SENTINEL) ++num_ref_unfilled;
+        if (vals[i] == SENTINEL) ++num_unfilled;
+    }
+    return;
+} // compare_values
+
+void
+set_values(Pointer<PatchLevel<NDIM> > level, const int cc_idx, const int sc_idx)
+{
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<CellData<NDIM, double> > cc_data = patch->getPatchData(cc_idx);
+        set_values(cc_data->getArrayData(), patch_box, 0);
+        Pointer<SideData<NDIM, double> > sc_data = patch->getPatchData(sc_idx);
+        for (int axis = 0; axis < NDIM; ++axis)
+        {
+            set_values(sc_data->getArrayData(axis), SideGeometry<NDIM>::toSideBox(patch_box, axis), axis);
+        }
+    }
+    return;
+} // set_values
+
+void
+print_comparison(Pointer<PatchLevel<NDIM> > level,
+                 const int cc_ref_idx,
+                 const int cc_idx,
+                 const int sc_ref_idx,
+                 const int sc_idx,
+                 const std::string& label)
+{
+    double cc_max_diff = 0.0, sc_max_diff = 0.0;
+    int num_ref_unfilled = 0, cc_num_unfilled = 0, sc_num_unfilled = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > cc_ref_data = patch->getPatchData(cc_ref_idx);
+        Pointer<CellData<NDIM, double> > cc_data = patch->getPatchData(cc_idx);
+        compare_values(
+            cc_ref_data->getArrayData(), cc_data->getArrayData(), cc_max_diff, num_ref_unfilled, cc_num_unfilled);
+        Pointer<SideData<NDIM, double> > sc_ref_data = patch->getPatchData(sc_ref_idx);
+        Pointer<SideData<NDIM, double> > sc_data = patch->getPatchData(sc_idx);
+        for (int axis = 0; axis < NDIM; ++axis)
+        {
+            compare_values(sc_ref_data->getArrayData(axis),
+                           sc_data->getArrayData(axis),
+                           sc_max_diff,
+                           num_ref_unfilled,
+                           sc_num_unfilled);
+        }
+    }
+    cc_max_diff = IBTK_MPI::maxReduction(cc_max_diff);
+    sc_max_diff = IBTK_MPI::maxReduction(sc_max_diff);
+    num_ref_unfilled = IBTK_MPI::sumReduction(num_ref_unfilled);
+    cc_num_unfilled = IBTK_MPI::sumReduction(cc_num_unfilled);
+    sc_num_unfilled = IBTK_MPI::sumReduction(sc_num_unfilled);
+    plog << label << ":\n";
+    plog << "  unfilled values with standard schedules: " << num_ref_unfilled << "\n";
+    plog << "  cell-centered max difference: " << cc_max_diff << "\n";
+    plog << "  cell-centered unfilled values: " << cc_num_unfilled << "\n";
+    plog << "  side-centered max difference: " << sc_max_diff << "\n";
+    plog << "  side-centered unfilled values: " << sc_num_unfilled << "\n";
+    return;
+} // print_comparison
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "persistent_ghost_fill_01.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ref_ctx = var_db->getContext("standard");
+        Pointer<VariableContext> ctx = var_db->getContext("persistent");
+        const IntVector<NDIM> gcw(input_db->getIntegerWithDefault("ghost_width", 2));
+        Pointer<CellVariable<NDIM, double> > cc_var = new CellVariable<NDIM, double>("cc", 2);
+        Pointer<SideVariable<NDIM, double> > sc_var = new SideVariable<NDIM, double>("sc");
+        const int cc_ref_idx = var_db->registerVariableAndContext(cc_var, ref_ctx, gcw);
+        const int cc_idx = var_db->registerVariableAndContext(cc_var, ctx, gcw);
+        const int sc_ref_idx = var_db->registerVariableAndContext(sc_var, ref_ctx, gcw);
+        const int sc_idx = var_db->registerVariableAndContext(sc_var, ctx, gcw);
+
+        // Set up a grid consisting of a single periodic patch level.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        for (const int idx : { cc_ref_idx, cc_idx, sc_ref_idx, sc_idx }) level->allocatePatchData(idx, 0.0);
+        plog << "number of patches: " << level->getNumberOfPatches() << "\n";
+
+        using ITC = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
+        std::vector<ITC> ref_comps = { ITC(cc_ref_idx, "NONE", false, "NONE", "NONE", false, nullptr),
+                                       ITC(sc_ref_idx, "NONE", false, "NONE", "NONE", false, nullptr) };
+        std::vector<ITC> comps = { ITC(cc_idx, "NONE", false, "NONE", "NONE", false, nullptr),
+                                   ITC(sc_idx, "NONE", false, "NONE", "NONE", false, nullptr) };
+        HierarchyGhostCellInterpolation ref_fill_op;
+        ref_fill_op.initializeOperatorState(ref_comps, patch_hierarchy);
+        HierarchyGhostCellInterpolation fill_op;
+        fill_op.setUsePersistentSchedules(true);
+        fill_op.initializeOperatorState(comps, patch_hierarchy);
+
+        // Fill twice: the second fill reuses the buffers and persistent
+        // requests set up by the first one.
+        for (int fill_num = 0; fill_num < 2; ++fill_num)
+        {
+            set_values(level, cc_ref_idx, sc_ref_idx);
+            set_values(level, cc_idx, sc_idx);
+            ref_fill_op.fillData(0.0);
+            fill_op.fillData(0.0);
+            print_comparison(
+                level, cc_ref_idx, cc_idx, sc_ref_idx, sc_idx, fill_num == 0 ? "first fill" : "second fill");
+        }
+    }
+} // main
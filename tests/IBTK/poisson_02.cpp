@@ -0,0 +1,204 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCPoissonSolverManager.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <cstdlib>
+#include <string>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Check that storing the search direction of the Chebyshev smoother of
+// CCPoissonPointRelaxationFACOperator in single precision does not change the
+// accuracy of the solution of a Poisson problem and only changes the number of
+// Krylov iterations marginally.
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "cc_poisson.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > u_double_cc_var = new CellVariable<NDIM, double>("u_double_cc");
+        Pointer<CellVariable<NDIM, double> > u_float_cc_var = new CellVariable<NDIM, double>("u_float_cc");
+        Pointer<CellVariable<NDIM, double> > f_cc_var = new CellVariable<NDIM, double>("f_cc");
+        Pointer<CellVariable<NDIM, double> > e_cc_var = new CellVariable<NDIM, double>("e_cc");
+        Pointer<CellVariable<NDIM, double> > r_cc_var = new CellVariable<NDIM, double>("r_cc");
+
+        const int u_double_cc_idx = var_db->registerVariableAndContext(u_double_cc_var, ctx, IntVector<NDIM>(1));
+        const int u_float_cc_idx = var_db->registerVariableAndContext(u_float_cc_var, ctx, IntVector<NDIM>(1));
+        const int f_cc_idx = var_db->registerVariableAndContext(f_cc_var, ctx, IntVector<NDIM>(1));
+        const int e_cc_idx = var_db->registerVariableAndContext(e_cc_var, ctx, IntVector<NDIM>(1));
+        const int r_cc_idx = var_db->registerVariableAndContext(r_cc_var, ctx, IntVector<NDIM>(1));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+
+        // Allocate data on each level of the patch hierarchy.
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_double_cc_idx, 0.0);
+            level->allocatePatchData(u_float_cc_idx, 0.0);
+            level->allocatePatchData(f_cc_idx, 0.0);
+            level->allocatePatchData(e_cc_idx, 0.0);
+            level->allocatePatchData(r_cc_idx, 0.0);
+        }
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+
+        SAMRAIVectorReal<NDIM, double> u_double_vec("u_double", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> u_float_vec("u_float", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> f_vec("f", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> e_vec("e", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> r_vec("r", patch_hierarchy, 0, finest_ln);
+
+        u_double_vec.addComponent(u_double_cc_var, u_double_cc_idx, h_cc_idx);
+        u_float_vec.addComponent(u_float_cc_var, u_float_cc_idx, h_cc_idx);
+        f_vec.addComponent(f_cc_var, f_cc_idx, h_cc_idx);
+        e_vec.addComponent(e_cc_var, e_cc_idx, h_cc_idx);
+        r_vec.addComponent(r_cc_var, r_cc_idx, h_cc_idx);
+
+        u_double_vec.setToScalar(0.0);
+        u_float_vec.setToScalar(0.0);
+        f_vec.setToScalar(0.0);
+        e_vec.setToScalar(0.0);
+        r_vec.setToScalar(1.0);
+
+        // Setup exact solutions.
+        muParserCartGridFunction u_fcn("u", app_initializer->getComponentDatabase("u"), grid_geometry);
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+
+        u_fcn.setDataOnPatchHierarchy(e_cc_idx, e_cc_var, patch_hierarchy, 0.0);
+        f_fcn.setDataOnPatchHierarchy(f_cc_idx, f_cc_var, patch_hierarchy, 0.0);
+
+        // Ensure that the right-hand-side vector has no components in the
+        // nullspace of the operator.
+        f_vec.addScalar(Pointer<SAMRAIVectorReal<NDIM, double> >(&f_vec, false),
+                        -f_vec.dot(Pointer<SAMRAIVectorReal<NDIM, double> >(&r_vec, false)) /
+                            r_vec.dot(Pointer<SAMRAIVectorReal<NDIM, double> >(&r_vec, false)));
+
+        // Setup the Poisson solvers. The two preconditioners only differ in the
+        // precision of the data of the Chebyshev smoother.
+        PoissonSpecifications poisson_spec("poisson_spec");
+        poisson_spec.setCZero();
+        poisson_spec.setDConstant(-1.0);
+        RobinBcCoefStrategy<NDIM>* bc_coef = NULL;
+
+        const string solver_type = input_db->getString("solver_type");
+        const string precond_type = input_db->getString("precond_type");
+        const auto solve = [&](const std::string& name,
+                               const std::string& precond_db_name,
+                               SAMRAIVectorReal<NDIM, double>& u_vec,
+                               int& num_iterations) {
+            Pointer<PoissonSolver> poisson_solver =
+                CCPoissonSolverManager::getManager()->allocateSolver(solver_type,
+                                                                     name + "_solver",
+                                                                     input_db->getDatabase("solver_db"),
+                                                                     "",
+                                                                     precond_type,
+                                                                     name + "_precond",
+                                                                     input_db->getDatabase(precond_db_name),
+                                                                     "");
+            poisson_solver->setPoissonSpecifications(poisson_spec);
+            poisson_solver->setPhysicalBcCoef(bc_coef);
+            poisson_solver->initializeSolverState(u_vec, f_vec);
+            const bool converged = poisson_solver->solveSystem(u_vec, f_vec);
+            num_iterations = poisson_solver->getNumIterations();
+            poisson_solver->deallocateSolverState();
+            return converged;
+        };
+
+        // Solve -L*u = f with both preconditioners.
+        int num_double_iterations = 0, num_float_iterations = 0;
+        const bool double_converged = solve("double", "precond_db", u_double_vec, num_double_iterations);
+        const bool float_converged = solve("float", "single_precision_precond_db", u_float_vec, num_float_iterations);
+        plog << "converged with double-precision smoother data: " << (double_converged ? "yes" : "no") << "\n";
+        plog << "converged with single-precision smoother data: " << (float_converged ? "yes" : "no") << "\n";
+        plog << "iteration counts differ by at most two: "
+             << (std::abs(num_double_iterations - num_float_iterations) <= 2 ? "yes" : "no") << "\n";
+
+        // The difference between the solutions must be much smaller than the
+        // discretization error.
+        e_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&e_vec, false),
+                       Pointer<SAMRAIVectorReal<NDIM, double> >(&u_double_vec, false));
+        const double e_max_norm = e_vec.maxNorm();
+        r_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&u_float_vec, false),
+                       Pointer<SAMRAIVectorReal<NDIM, double> >(&u_double_vec, false));
+        const double diff_max_norm = r_vec.maxNorm();
+        plog << "solutions agree to within 1e-3 |e|_oo: " << (diff_max_norm <= 1.0e-3 * e_max_norm ? "yes" : "no")
+             << "\n";
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
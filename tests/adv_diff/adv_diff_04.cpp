@@ -0,0 +1,182 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <HierarchyCellDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/AdvDiffReactionIntegrator.h>
+#include <ibamr/AdvDiffReactionStrategy.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Integrate the stiff linear reaction chain
+//
+//    dy_0/dt = -k_0 y_0,
+//    dy_1/dt =  k_0 y_0 - k_1 y_1,
+//
+// with k_0 >> k_1 in every cell of a patch hierarchy with
+// AdvDiffReactionIntegrator and compare the result to the exact solution. The
+// numbers of accepted and rejected substeps are also reported.
+
+namespace
+{
+class LinearReactionChain : public AdvDiffReactionStrategy
+{
+public:
+    LinearReactionChain(const double k0, const double k1) : d_k0(k0), d_k1(k1)
+    {
+    }
+
+    void computeReactionRates(double* f, const double* y, const int num_species, const int num_cells) const override
+    {
+        TBOX_ASSERT(num_species == 2);
+        for (int c = 0; c < num_cells; ++c)
+        {
+            f[c] = -d_k0 * y[c];
+            f[num_cells + c] = d_k0 * y[c] - d_k1 * y[num_cells + c];
+        }
+        return;
+    }
+
+    void computeReactionJacobian(double* J,
+                                 const double* /*y*/,
+                                 const double* /*f*/,
+                                 const int num_species,
+                                 const int num_cells) const override
+    {
+        TBOX_ASSERT(num_species == 2);
+        for (int c = 0; c < num_cells; ++c)
+        {
+            J[c] = -d_k0;
+            J[num_cells + c] = 0.0;
+            J[2 * num_cells + c] = d_k0;
+            J[3 * num_cells + c] = -d_k1;
+        }
+        return;
+    }
+
+private:
+    const double d_k0, d_k1;
+};
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "adv_diff.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<CellVariable<NDIM, double> > Q_var = new CellVariable<NDIM, double>("Q", 2);
+        Pointer<CellVariable<NDIM, double> > Q_exact_var = new CellVariable<NDIM, double>("Q_exact", 2);
+        const int Q_idx = var_db->registerVariableAndContext(Q_var, ctx, IntVector<NDIM>(0));
+        const int Q_exact_idx = var_db->registerVariableAndContext(Q_exact_var, ctx, IntVector<NDIM>(0));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(Q_idx, 0.0);
+            level->allocatePatchData(Q_exact_idx, 0.0);
+        }
+
+        // Set the initial values.
+        muParserCartGridFunction Q_init("Q_init", app_initializer->getComponentDatabase("Q_init"), grid_geometry);
+        Q_init.setDataOnPatchHierarchy(Q_idx, Q_var, patch_hierarchy, 0.0);
+
+        // Integrate the reaction terms over several time intervals.
+        Pointer<LinearReactionChain> reaction_chain =
+            new LinearReactionChain(input_db->getDouble("K0"), input_db->getDouble("K1"));
+        AdvDiffReactionIntegrator reaction_integrator("AdvDiffReactionIntegrator",
+                                                      app_initializer->getComponentDatabase("AdvDiffReactionIntegrator"),
+                                                      reaction_chain);
+        const double dt = input_db->getDouble("DT");
+        const int num_intervals = input_db->getInteger("NUM_INTERVALS");
+        for (int k = 0; k < num_intervals; ++k)
+        {
+            reaction_integrator.integrate(Q_idx, patch_hierarchy, dt);
+            plog << "interval " << k << ":\n";
+            plog << "  accepted substeps: "
+                 << IBTK_MPI::sumReduction(reaction_integrator.getNumberOfAcceptedSubsteps()) << "\n";
+            plog << "  rejected substeps: "
+                 << IBTK_MPI::sumReduction(reaction_integrator.getNumberOfRejectedSubsteps()) << "\n";
+        }
+
+        // Compare to the exact solution.
+        muParserCartGridFunction Q_exact("Q_exact", app_initializer->getComponentDatabase("Q_exact"), grid_geometry);
+        Q_exact.setDataOnPatchHierarchy(Q_exact_idx, Q_exact_var, patch_hierarchy, num_intervals * dt);
+        HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(patch_hierarchy, 0, finest_ln);
+        const double Q_exact_max_norm = hier_cc_data_ops.maxNorm(Q_exact_idx);
+        hier_cc_data_ops.subtract(Q_idx, Q_exact_idx, Q_idx);
+        const double rel_error = hier_cc_data_ops.maxNorm(Q_idx) / Q_exact_max_norm;
+        plog << "relative error below 1e-5: " << (rel_error < 1.0e-5 ? "yes" : "no") << "\n";
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -0,0 +1,185 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellData.h>
+#include <CellIterator.h>
+#include <HierarchyCellDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/AdvDiffSemiImplicitHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Advect and diffuse a quantity with more components than spatial dimensions
+// together with a scalar quantity. The components of the multi-depth quantity
+// are initially multiples of the scalar quantity, and they must remain so. The
+// visualization data writer is registered so that the per-component plot
+// quantities of the multi-depth quantity are set up.
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "adv_diff.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<AdvDiffHierarchyIntegrator> time_integrator = new AdvDiffSemiImplicitHierarchyIntegrator(
+            "AdvDiffSemiImplicitHierarchyIntegrator",
+            app_initializer->getComponentDatabase("AdvDiffSemiImplicitHierarchyIntegrator"));
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Set up the advection velocity.
+        Pointer<FaceVariable<NDIM, double> > u_adv_var = new FaceVariable<NDIM, double>("u_adv");
+        Pointer<CartGridFunction> u_fcn = new muParserCartGridFunction(
+            "u_fcn", app_initializer->getComponentDatabase("AdvectionVelocity"), grid_geometry);
+        time_integrator->registerAdvectionVelocity(u_adv_var);
+        time_integrator->setAdvectionVelocityFunction(u_adv_var, u_fcn);
+
+        // Set up the transported quantities. The components of Q are scaled
+        // by powers of two so that the scaling is exact in floating point.
+        const double kappa = input_db->getDouble("KAPPA");
+        const int Q_depth = input_db->getInteger("Q_DEPTH");
+        Pointer<CellVariable<NDIM, double> > q_var = new CellVariable<NDIM, double>("q");
+        Pointer<CartGridFunction> q_init = new muParserCartGridFunction(
+            "q_init", app_initializer->getComponentDatabase("q_init"), grid_geometry);
+        time_integrator->registerTransportedQuantity(q_var);
+        time_integrator->setDiffusionCoefficient(q_var, kappa);
+        time_integrator->setInitialConditions(q_var, q_init);
+        time_integrator->setAdvectionVelocity(q_var, u_adv_var);
+
+        Pointer<CellVariable<NDIM, double> > Q_var = new CellVariable<NDIM, double>("Q", Q_depth);
+        Pointer<CartGridFunction> Q_init = new muParserCartGridFunction(
+            "Q_init", app_initializer->getComponentDatabase("Q_init"), grid_geometry);
+        time_integrator->registerTransportedQuantity(Q_var);
+        time_integrator->setDiffusionCoefficient(Q_var, kappa);
+        time_integrator->setInitialConditions(Q_var, Q_init);
+        time_integrator->setAdvectionVelocity(Q_var, u_adv_var);
+
+        // Register the visualization data writer so that plot quantities are
+        // set up for both transported quantities.
+        Pointer<VisItDataWriter<NDIM> > visit_data_writer = app_initializer->getVisItDataWriter();
+        if (visit_data_writer) time_integrator->registerVisItDataWriter(visit_data_writer);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        app_initializer.setNull();
+
+        // Main time step loop.
+        double loop_time = time_integrator->getIntegratorTime();
+        const double loop_time_end = time_integrator->getEndTime();
+        while (!MathUtilities<double>::equalEps(loop_time, loop_time_end) && time_integrator->stepsRemaining())
+        {
+            const double dt = time_integrator->getMaximumTimeStepSize();
+            time_integrator->advanceHierarchy(dt);
+            loop_time += dt;
+        }
+
+        // Compare each component of Q to the corresponding multiple of q.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        const Pointer<VariableContext> ctx = time_integrator->getCurrentContext();
+        const int q_idx = var_db->mapVariableAndContextToIndex(q_var, ctx);
+        const int Q_idx = var_db->mapVariableAndContextToIndex(Q_var, ctx);
+        const int coarsest_ln = 0;
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        std::vector<double> max_diff(Q_depth, 0.0);
+        double q_max = 0.0;
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > q_data = patch->getPatchData(q_idx);
+                Pointer<CellData<NDIM, double> > Q_data = patch->getPatchData(Q_idx);
+                for (CellIterator<NDIM> ci(patch->getBox()); ci; ci++)
+                {
+                    const CellIndex<NDIM>& i = ci();
+                    q_max = std::max(q_max, std::abs((*q_data)(i)));
+                    for (int d = 0; d < Q_depth; ++d)
+                    {
+                        const double scale = static_cast<double>(1 << d);
+                        max_diff[d] = std::max(max_diff[d], std::abs((*Q_data)(i, d) - scale * (*q_data)(i)));
+                    }
+                }
+            }
+        }
+        q_max = IBTK_MPI::maxReduction(q_max);
+        for (int d = 0; d < Q_depth; ++d)
+        {
+            const double scale = static_cast<double>(1 << d);
+            const double rel_diff = IBTK_MPI::maxReduction(max_diff[d]) / (scale * q_max);
+            plog << "component " << d << " matches the scalar quantity: " << (rel_diff < 1.0e-8 ? "yes" : "no")
+                 << "\n";
+        }
+
+        // Compare q to the exact solution.
+        const int q_exact_idx = var_db->registerClonedPatchDataIndex(q_var, q_idx);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            patch_hierarchy->getPatchLevel(ln)->allocatePatchData(q_exact_idx, loop_time);
+        }
+        muParserCartGridFunction q_exact("q_exact", input_db->getDatabase("q_exact"), grid_geometry);
+        q_exact.setDataOnPatchHierarchy(q_exact_idx, q_var, patch_hierarchy, loop_time);
+        HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(patch_hierarchy, coarsest_ln, finest_ln);
+        const double q_exact_max_norm = hier_cc_data_ops.maxNorm(q_exact_idx);
+        hier_cc_data_ops.subtract(q_exact_idx, q_exact_idx, q_idx);
+        const double rel_error = hier_cc_data_ops.maxNorm(q_exact_idx) / q_exact_max_norm;
+        plog << "relative error in the scalar quantity below 1e-2: " << (rel_error < 1.0e-2 ? "yes" : "no") << "\n";
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -53,6 +53,11 @@
 // interpolate multilinear solutions exactly). If this value is FALSE (the
 // default) then we interpolate a trigonometric field and print the values to
 // output.
+//
+// If the input file contains an LEInteractor database then it is used to
+// configure LEInteractor. In particular, the accuracy of interpolation with
+// single precision kernel weights is checked with use_exact = TRUE and
+// LEInteractor { use_single_precision_weights = TRUE }.
 
 int
 main(int argc, char** argv)
@@ -177,6 +182,13 @@ main(int argc, char** argv)
             for (double& v : X_data) v = distribution(std_seq);
 
             // interpolate:
+            bool single_precision = false;
+            if (input_db->keyExists("LEInteractor"))
+            {
+                Pointer<Database> le_interactor_db = input_db->getDatabase("LEInteractor");
+                LEInteractor::setFromDatabase(le_interactor_db);
+                single_precision = le_interactor_db->getBoolWithDefault("use_single_precision_weights", false);
+            }
             const std::string interp_fcn = input_db->getString("IB_DELTA_FUNCTION");
             LEInteractor::interpolate(Q_data, Q_depth, X_data, X_depth, q_data, patch, interp_box, interp_fcn);
 
@@ -206,8 +218,9 @@ main(int argc, char** argv)
                     {
                         // the ultra-wide kernels have a lot of trouble with
                         // roundoff that is evident at different optimization
-                        // settings
-                        const double tol = interp_fcn == "BSPLINE_6" ? 1e-10 : 1e-12;
+                        // settings. Single precision weights are only
+                        // accurate to about seven digits.
+                        const double tol = single_precision ? 1e-5 : (interp_fcn == "BSPLINE_6" ? 1e-10 : 1e-12);
                         const double error = std::abs(Q_data[point_n * NDIM + d] - exact);
                         if (error > tol)
                         {
@@ -0,0 +1,384 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LEInteractor.h>
+
+#include <ArrayData.h>
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <NodeData.h>
+#include <NodeVariable.h>
+#include <SAMRAI_config.h>
+#include <SideData.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+#include <tbox/MemoryDatabase.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ibtk/app_namespaces.h>
+
+// Regression and throughput test for interpolation. Random cell-, node-, and
+// side-centered values (including ghost values) are interpolated with each of
+// the requested kernels to randomly placed markers by the reference path
+// (double precision weights computed on every call, i.e., the default Fortran
+// implementation for most kernels) and by each of the optimized paths:
+//
+// - cached: reusing kernel weights stored in an LEInteractor::WeightCache,
+// - single_precision: kernel weights stored in single precision.
+//
+// The optimized results must match the reference results to a relative
+// tolerance. The markers interpolated per second, per process, and per thread
+// by each path are also measured: since timings are not reproducible they are
+// only written to the log file and not to the output file.
+
+namespace
+{
+enum class InterpPath
+{
+    REFERENCE,
+    CACHED,
+    SINGLE_PRECISION
+};
+
+std::string
+path_name(const InterpPath path)
+{
+    switch (path)
+    {
+    case InterpPath::REFERENCE:
+        return "reference";
+    case InterpPath::CACHED:
+        return "cached";
+    case InterpPath::SINGLE_PRECISION:
+        return "single_precision";
+    }
+    return "";
+}
+
+void
+configure_interactor(const InterpPath path)
+{
+    Pointer<Database> db = new MemoryDatabase("LEInteractor");
+    db->putBool("use_single_precision_weights", path == InterpPath::SINGLE_PRECISION);
+    LEInteractor::setFromDatabase(db);
+    LEInteractor::setWeightCache(nullptr);
+}
+
+// Place markers_per_cell markers per cell (on average) uniformly at random in
+// each local patch.
+std::vector<std::vector<double> >
+make_markers(Pointer<PatchHierarchy<NDIM> > hierarchy, const double markers_per_cell, std::mt19937& rng)
+{
+    std::vector<std::vector<double> > markers;
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+            const double* const x_lower = patch_geom->getXLower();
+            const double* const x_upper = patch_geom->getXUpper();
+            const int num_markers = static_cast<int>(std::round(markers_per_cell * patch->getBox().size()));
+            std::vector<double> X(NDIM * num_markers);
+            for (int k = 0; k < num_markers; ++k)
+            {
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    std::uniform_real_distribution<double> x_distribution(x_lower[d], x_upper[d]);
+                    X[NDIM * k + d] = x_distribution(rng);
+                }
+            }
+            markers.push_back(X);
+        }
+    }
+    return markers;
+}
+
+void
+fill_random(ArrayData<NDIM, double>& data, std::mt19937& rng)
+{
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    const std::size_t size = static_cast<std::size_t>(data.getBox().size()) * data.getDepth();
+    double* const vals = data.getPointer();
+    for (std::size_t i = 0; i < size; ++i) vals[i] = distribution(rng);
+}
+
+void
+fill_random(Pointer<CellData<NDIM, double> > data, std::mt19937& rng)
+{
+    fill_random(data->getArrayData(), rng);
+}
+
+void
+fill_random(Pointer<NodeData<NDIM, double> > data, std::mt19937& rng)
+{
+    fill_random(data->getArrayData(), rng);
+}
+
+void
+fill_random(Pointer<SideData<NDIM, double> > data, std::mt19937& rng)
+{
+    for (int axis = 0; axis < NDIM; ++axis) fill_random(data->getArrayData(axis), rng);
+}
+
+template <class DataType>
+void
+interpolate_markers(std::vector<std::vector<double> >& Q,
+                    Pointer<PatchHierarchy<NDIM> > hierarchy,
+                    const int q_idx,
+                    const std::vector<std::vector<double> >& markers,
+                    const std::string& kernel_fcn,
+                    std::vector<LEInteractor::WeightCache>* const weight_caches)
+{
+    unsigned int patch_num = 0;
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_num)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<DataType> q_data = patch->getPatchData(q_idx);
+            // The markers on different patches have the same local indices, so
+            // each patch gets its own cache.
+            if (weight_caches) LEInteractor::setWeightCache(&(*weight_caches)[patch_num]);
+            std::vector<double>& patch_Q = Q[patch_num];
+            patch_Q.assign(markers[patch_num].size(), 0.0);
+            LEInteractor::interpolate(
+                patch_Q, NDIM, markers[patch_num], NDIM, q_data, patch, patch->getBox(), kernel_fcn);
+        }
+    }
+    LEInteractor::setWeightCache(nullptr);
+}
+
+// Compute the maximum difference between the interpolated values relative to
+// the maximum reference value.
+double
+relative_difference(const std::vector<std::vector<double> >& ref_Q, const std::vector<std::vector<double> >& Q)
+{
+    double max_diff = 0.0;
+    double max_ref = 0.0;
+    for (unsigned int patch_num = 0; patch_num < ref_Q.size(); ++patch_num)
+    {
+        for (unsigned int i = 0; i < ref_Q[patch_num].size(); ++i)
+        {
+            max_diff = std::max(max_diff, std::abs(Q[patch_num][i] - ref_Q[patch_num][i]));
+            max_ref = std::max(max_ref, std::abs(ref_Q[patch_num][i]));
+        }
+    }
+    max_diff = IBTK_MPI::maxReduction(max_diff);
+    max_ref = IBTK_MPI::maxReduction(max_ref);
+    return max_ref > 0.0 ? max_diff / max_ref : max_diff;
+}
+
+template <class DataType>
+void
+test_kernel(std::ofstream& out,
+            Pointer<PatchHierarchy<NDIM> > hierarchy,
+            const int q_idx,
+            const std::string& centering,
+            const std::string& kernel_fcn,
+            const std::vector<std::vector<double> >& markers,
+            const double markers_per_cell,
+            const int num_repetitions,
+            const double tolerance,
+            const double single_precision_tolerance)
+{
+    std::size_t num_local_markers = 0;
+    for (const std::vector<double>& X : markers) num_local_markers += X.size() / NDIM;
+    const double num_markers = IBTK_MPI::sumReduction(static_cast<double>(num_local_markers));
+    const int num_processes = IBTK_MPI::getNodes();
+    int num_threads = 1;
+#ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+#endif
+
+    std::vector<std::vector<double> > ref_Q(markers.size()), Q(markers.size());
+    for (const InterpPath path : { InterpPath::REFERENCE, InterpPath::CACHED, InterpPath::SINGLE_PRECISION })
+    {
+        configure_interactor(path);
+        std::vector<LEInteractor::WeightCache> weight_caches(markers.size());
+        std::vector<LEInteractor::WeightCache>* const caches = path == InterpPath::CACHED ? &weight_caches : nullptr;
+        std::vector<std::vector<double> >& path_Q = path == InterpPath::REFERENCE ? ref_Q : Q;
+
+        // The first (untimed) pass also fills the weight caches so that the
+        // timed passes measure the reuse of the cached weights.
+        interpolate_markers<DataType>(path_Q, hierarchy, q_idx, markers, kernel_fcn, caches);
+        IBTK_MPI::barrier();
+        const auto start = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < num_repetitions; ++rep)
+        {
+            interpolate_markers<DataType>(path_Q, hierarchy, q_idx, markers, kernel_fcn, caches);
+        }
+        const auto end = std::chrono::steady_clock::now();
+        const double seconds = IBTK_MPI::maxReduction(std::chrono::duration<double>(end - start).count());
+        const double markers_per_second = seconds > 0.0 ? num_markers * num_repetitions / seconds : 0.0;
+
+        std::ostringstream name_stream;
+        name_stream << kernel_fcn << " " << centering << " " << markers_per_cell << " markers/cell " << path_name(path);
+        const std::string name = name_stream.str();
+        plog << name << ": " << markers_per_second / num_processes << " markers/s per process, "
+             << markers_per_second / (num_processes * num_threads) << " markers/s per thread\n";
+        if (path == InterpPath::REFERENCE) continue;
+
+        const double diff = relative_difference(ref_Q, Q);
+        const double tol = path == InterpPath::SINGLE_PRECISION ? single_precision_tolerance : tolerance;
+        out << name << ": ";
+        if (diff <= tol)
+            out << "OK\n";
+        else
+            out << "relative difference " << diff << " exceeds " << tol << "\n";
+    }
+    configure_interactor(InterpPath::REFERENCE);
+}
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "interpolate_02.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        const tbox::Array<std::string> kernels = input_db->getStringArray("kernels");
+        const tbox::Array<double> markers_per_cell = input_db->getDoubleArray("markers_per_cell");
+        const int num_repetitions = input_db->getIntegerWithDefault("num_repetitions", 1);
+        const double tolerance = input_db->getDoubleWithDefault("tolerance", 1.0e-12);
+        const double single_precision_tolerance = input_db->getDoubleWithDefault("single_precision_tolerance", 1.0e-5);
+
+        int gcw = 0;
+        for (int k = 0; k < kernels.size(); ++k) gcw = std::max(gcw, LEInteractor::getMinimumGhostWidth(kernels[k]));
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<CellVariable<NDIM, double> > cc_var = new CellVariable<NDIM, double>("cc", NDIM);
+        Pointer<NodeVariable<NDIM, double> > nc_var = new NodeVariable<NDIM, double>("nc", NDIM);
+        Pointer<SideVariable<NDIM, double> > sc_var = new SideVariable<NDIM, double>("sc");
+        const int cc_idx = var_db->registerVariableAndContext(cc_var, ctx, gcw);
+        const int nc_idx = var_db->registerVariableAndContext(nc_var, ctx, gcw);
+        const int sc_idx = var_db->registerVariableAndContext(sc_var, ctx, gcw);
+
+        // set up grid
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        const int tag_buffer = std::numeric_limits<int>::max();
+        int level_number = 0;
+        while ((gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+
+        // Fill the data, including ghost values, with random values: the
+        // results of the different paths only need to agree with each other.
+        std::mt19937 rng(42u + IBTK_MPI::getRank());
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(cc_idx, 0.0);
+            level->allocatePatchData(nc_idx, 0.0);
+            level->allocatePatchData(sc_idx, 0.0);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                fill_random(Pointer<CellData<NDIM, double> >(patch->getPatchData(cc_idx)), rng);
+                fill_random(Pointer<NodeData<NDIM, double> >(patch->getPatchData(nc_idx)), rng);
+                fill_random(Pointer<SideData<NDIM, double> >(patch->getPatchData(sc_idx)), rng);
+            }
+        }
+
+        std::ofstream out;
+        if (IBTK_MPI::getRank() == 0) out.open("output");
+
+        for (int m = 0; m < markers_per_cell.size(); ++m)
+        {
+            const std::vector<std::vector<double> > markers =
+                make_markers(patch_hierarchy, markers_per_cell[m], rng);
+            for (int k = 0; k < kernels.size(); ++k)
+            {
+                test_kernel<CellData<NDIM, double> >(out,
+                                                     patch_hierarchy,
+                                                     cc_idx,
+                                                     "CELL",
+                                                     kernels[k],
+                                                     markers,
+                                                     markers_per_cell[m],
+                                                     num_repetitions,
+                                                     tolerance,
+                                                     single_precision_tolerance);
+                test_kernel<NodeData<NDIM, double> >(out,
+                                                     patch_hierarchy,
+                                                     nc_idx,
+                                                     "NODE",
+                                                     kernels[k],
+                                                     markers,
+                                                     markers_per_cell[m],
+                                                     num_repetitions,
+                                                     tolerance,
+                                                     single_precision_tolerance);
+                test_kernel<SideData<NDIM, double> >(out,
+                                                     patch_hierarchy,
+                                                     sc_idx,
+                                                     "SIDE",
+                                                     kernels[k],
+                                                     markers,
+                                                     markers_per_cell[m],
+                                                     num_repetitions,
+                                                     tolerance,
+                                                     single_precision_tolerance);
+            }
+        }
+    }
+} // main
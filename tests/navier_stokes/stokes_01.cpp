@@ -0,0 +1,209 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <HierarchyCellDataOpsReal.h>
+#include <HierarchySideDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/StaggeredStokesBoxRelaxationFACOperator.h>
+#include <ibamr/StaggeredStokesFACPreconditioner.h>
+#include <ibamr/StaggeredStokesOperator.h>
+#include <ibamr/StaggeredStokesPhysicalBoundaryHelper.h>
+#include <ibamr/StaggeredStokesSolverManager.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/KrylovLinearSolver.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Check that a Krylov method preconditioned by multigrid with the box
+// relaxation (Vanka-type) smoother of StaggeredStokesBoxRelaxationFACOperator
+// solves a small periodic staggered-grid Stokes problem. The right-hand side
+// is the action of the discrete Stokes operator on known velocity and pressure
+// fields, so the solver must recover those fields up to the solver tolerance
+// (and, for the pressure, up to a constant).
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "stokes.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<SideVariable<NDIM, double> > u_sc_var = new SideVariable<NDIM, double>("u_sc");
+        Pointer<SideVariable<NDIM, double> > u_exact_sc_var = new SideVariable<NDIM, double>("u_exact_sc");
+        Pointer<SideVariable<NDIM, double> > f_sc_var = new SideVariable<NDIM, double>("f_sc");
+        Pointer<CellVariable<NDIM, double> > p_cc_var = new CellVariable<NDIM, double>("p_cc");
+        Pointer<CellVariable<NDIM, double> > p_exact_cc_var = new CellVariable<NDIM, double>("p_exact_cc");
+        Pointer<CellVariable<NDIM, double> > g_cc_var = new CellVariable<NDIM, double>("g_cc");
+
+        const IntVector<NDIM> gcw(1);
+        const int u_sc_idx = var_db->registerVariableAndContext(u_sc_var, ctx, gcw);
+        const int u_exact_sc_idx = var_db->registerVariableAndContext(u_exact_sc_var, ctx, gcw);
+        const int f_sc_idx = var_db->registerVariableAndContext(f_sc_var, ctx, gcw);
+        const int p_cc_idx = var_db->registerVariableAndContext(p_cc_var, ctx, gcw);
+        const int p_exact_cc_idx = var_db->registerVariableAndContext(p_exact_cc_var, ctx, gcw);
+        const int g_cc_idx = var_db->registerVariableAndContext(g_cc_var, ctx, gcw);
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+
+        // Allocate data on each level of the patch hierarchy.
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (const int idx : { u_sc_idx, u_exact_sc_idx, f_sc_idx, p_cc_idx, p_exact_cc_idx, g_cc_idx })
+            {
+                level->allocatePatchData(idx, 0.0);
+            }
+        }
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int wgt_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+        const int wgt_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+
+        SAMRAIVectorReal<NDIM, double> x_vec("x", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> x_exact_vec("x_exact", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> b_vec("b", patch_hierarchy, 0, finest_ln);
+        x_vec.addComponent(u_sc_var, u_sc_idx, wgt_sc_idx);
+        x_vec.addComponent(p_cc_var, p_cc_idx, wgt_cc_idx);
+        x_exact_vec.addComponent(u_exact_sc_var, u_exact_sc_idx, wgt_sc_idx);
+        x_exact_vec.addComponent(p_exact_cc_var, p_exact_cc_idx, wgt_cc_idx);
+        b_vec.addComponent(f_sc_var, f_sc_idx, wgt_sc_idx);
+        b_vec.addComponent(g_cc_var, g_cc_idx, wgt_cc_idx);
+
+        // Setup the exact solution.
+        muParserCartGridFunction u_fcn("u", app_initializer->getComponentDatabase("u"), grid_geometry);
+        muParserCartGridFunction p_fcn("p", app_initializer->getComponentDatabase("p"), grid_geometry);
+        u_fcn.setDataOnPatchHierarchy(u_exact_sc_idx, u_exact_sc_var, patch_hierarchy, 0.0);
+        p_fcn.setDataOnPatchHierarchy(p_exact_cc_idx, p_exact_cc_var, patch_hierarchy, 0.0);
+
+        // The problem is periodic, so there are no physical boundaries.
+        PoissonSpecifications U_problem_coefs("U_problem_coefs");
+        U_problem_coefs.setCConstant(input_db->getDouble("C_COEFFICIENT"));
+        U_problem_coefs.setDConstant(input_db->getDouble("D_COEFFICIENT"));
+        const std::vector<RobinBcCoefStrategy<NDIM>*> U_bc_coefs(NDIM, nullptr);
+        Pointer<StaggeredStokesPhysicalBoundaryHelper> bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
+        bc_helper->cacheBcCoefData(U_bc_coefs, 0.0, patch_hierarchy);
+
+        // Compute the right-hand side from the exact solution.
+        StaggeredStokesOperator stokes_op("stokes_op", false);
+        stokes_op.setVelocityPoissonSpecifications(U_problem_coefs);
+        stokes_op.setPhysicalBcCoefs(U_bc_coefs, nullptr);
+        stokes_op.setPhysicalBoundaryHelper(bc_helper);
+        stokes_op.initializeOperatorState(x_exact_vec, b_vec);
+        stokes_op.apply(x_exact_vec, b_vec);
+
+        // Setup the Stokes solver, preconditioned by multigrid with box
+        // relaxation.
+        Pointer<StaggeredStokesSolver> stokes_solver = StaggeredStokesSolverManager::getManager()->allocateSolver(
+            input_db->getString("solver_type"), "stokes_solver", input_db->getDatabase("solver_db"), "stokes_");
+        Pointer<Database> precond_db = input_db->getDatabase("precond_db");
+        Pointer<StaggeredStokesFACPreconditionerStrategy> fac_op =
+            new StaggeredStokesBoxRelaxationFACOperator("stokes_fac_op", precond_db, "stokes_pc_");
+        Pointer<StaggeredStokesFACPreconditioner> stokes_precond =
+            new StaggeredStokesFACPreconditioner("stokes_pc", fac_op, precond_db, "stokes_pc_");
+        auto p_stokes_krylov_solver = dynamic_cast<KrylovLinearSolver*>(stokes_solver.getPointer());
+        TBOX_ASSERT(p_stokes_krylov_solver);
+        p_stokes_krylov_solver->setPreconditioner(stokes_precond);
+        stokes_solver->setVelocityPoissonSpecifications(U_problem_coefs);
+        stokes_solver->setPhysicalBcCoefs(U_bc_coefs, nullptr);
+        stokes_solver->setPhysicalBoundaryHelper(bc_helper);
+        stokes_solver->setComponentsHaveNullspace(false, true);
+        p_stokes_krylov_solver->setInitialGuessNonzero(false);
+        stokes_solver->initializeSolverState(x_vec, b_vec);
+
+        // Solve the Stokes system.
+        x_vec.setToScalar(0.0);
+        const bool converged = stokes_solver->solveSystem(x_vec, b_vec);
+        plog << "converged: " << (converged ? "yes" : "no") << "\n";
+
+        // Compute the errors. The pressure is only determined up to a
+        // constant.
+        HierarchySideDataOpsReal<NDIM, double> hier_sc_data_ops(patch_hierarchy, 0, finest_ln);
+        HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(patch_hierarchy, 0, finest_ln);
+        hier_sc_data_ops.subtract(u_sc_idx, u_sc_idx, u_exact_sc_idx);
+        hier_cc_data_ops.subtract(p_cc_idx, p_cc_idx, p_exact_cc_idx);
+        const double p_mean_error =
+            hier_cc_data_ops.integral(p_cc_idx, wgt_cc_idx) / hier_cc_data_ops.sumControlVolumes(p_cc_idx, wgt_cc_idx);
+        hier_cc_data_ops.addScalar(p_cc_idx, p_cc_idx, -p_mean_error);
+        const double u_rel_error =
+            hier_sc_data_ops.maxNorm(u_sc_idx, wgt_sc_idx) / hier_sc_data_ops.maxNorm(u_exact_sc_idx, wgt_sc_idx);
+        const double p_rel_error =
+            hier_cc_data_ops.maxNorm(p_cc_idx, wgt_cc_idx) / hier_cc_data_ops.maxNorm(p_exact_cc_idx, wgt_cc_idx);
+        plog << "relative velocity error below 1e-6: " << (u_rel_error <= 1.0e-6 ? "yes" : "no") << "\n";
+        plog << "relative pressure error below 1e-6: " << (p_rel_error <= 1.0e-6 ? "yes" : "no") << "\n";
+
+        stokes_solver->deallocateSolverState();
+        stokes_op.deallocateOperatorState();
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
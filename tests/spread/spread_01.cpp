@@ -60,6 +60,11 @@
 // This file is the main driver for force spreading tests (i.e.,
 // IBFEmethod::spreadForce). At the moment it simply prints out the force
 // values.
+//
+// If compare_single_precision = TRUE is specified in the input file then the
+// force is spread a second time after configuring LEInteractor with the
+// LEInteractor database (e.g., with use_single_precision_weights = TRUE) and
+// only the agreement of the two sets of values is printed.
 
 // Coordinate mapping function.
 void
@@ -415,6 +420,57 @@ main(int argc, char** argv)
         }
         const double cutoff = input_db->getDoubleWithDefault("output_cutoff_value", 0.0);
         std::ostringstream out;
+        if (input_db->getBoolWithDefault("compare_single_precision", false))
+        {
+            const Pointer<VariableContext> f_single_ctx = var_db->getContext("f_single");
+            const int f_single_idx = var_db->registerVariableAndContext(f_var, f_single_ctx, n_ghosts);
+            for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+                level->allocatePatchData(f_single_idx);
+                for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+                {
+                    Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                    Pointer<SideData<NDIM, double> > f_data = patch->getPatchData(f_single_idx);
+                    f_data->fillAll(0.0);
+                }
+            }
+            LEInteractor::setFromDatabase(input_db->getDatabase("LEInteractor"));
+            ib_method_ops->spreadForce(f_single_idx, bdry_op, {}, data_time);
+
+            double max_value = 0.0, max_difference = 0.0;
+            const int ln = patch_hierarchy->getFinestLevelNumber();
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<SideData<NDIM, double> > f_data = patch->getPatchData(f_ghost_idx);
+                Pointer<SideData<NDIM, double> > f_single_data = patch->getPatchData(f_single_idx);
+                for (int axis = 0; axis < NDIM; ++axis)
+                {
+                    for (SideIterator<NDIM> i(patch->getBox(), axis); i; i++)
+                    {
+                        for (int d = 0; d < f_data->getDepth(); ++d)
+                        {
+                            const double value = (*f_data)(i(), d);
+                            max_value = std::max(max_value, std::abs(value));
+                            max_difference = std::max(max_difference, std::abs(value - (*f_single_data)(i(), d)));
+                        }
+                    }
+                }
+            }
+            max_value = IBTK_MPI::maxReduction(max_value);
+            max_difference = IBTK_MPI::maxReduction(max_difference);
+            const double tol = input_db->getDoubleWithDefault("single_precision_tolerance", 1e-6);
+            if (IBTK_MPI::getRank() == 0)
+            {
+                if (max_difference <= tol * max_value)
+                    out << "OK\n";
+                else
+                    out << "relative difference = " << max_difference / max_value << '\n';
+            }
+        }
+        else
         {
             const int ln = patch_hierarchy->getFinestLevelNumber();
             Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
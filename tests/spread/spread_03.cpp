@@ -0,0 +1,418 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LEInteractor.h>
+
+#include <ArrayData.h>
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <NodeData.h>
+#include <NodeVariable.h>
+#include <SAMRAI_config.h>
+#include <SideData.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+#include <tbox/MemoryDatabase.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ibtk/app_namespaces.h>
+
+// Regression and throughput test for spreading. Random values at randomly
+// placed markers are spread with each of the requested kernels to cell-, node-,
+// and side-centered data by the reference path (uncolored spreading with
+// double precision weights computed on every call, i.e., the default Fortran
+// implementation for most kernels) and by each of the optimized paths:
+//
+// - colored: colored spreading with all available OpenMP threads,
+// - cached: reusing kernel weights stored in an LEInteractor::WeightCache,
+// - single_precision: kernel weights stored in single precision.
+//
+// The optimized results must match the reference results to a relative
+// tolerance. The markers spread per second, per process, and per thread by
+// each path are also measured: since timings are not reproducible they are
+// only written to the log file and not to the output file.
+
+namespace
+{
+struct Markers
+{
+    std::vector<double> X, F;
+};
+
+enum class SpreadPath
+{
+    REFERENCE,
+    COLORED,
+    CACHED,
+    SINGLE_PRECISION
+};
+
+std::string
+path_name(const SpreadPath path)
+{
+    switch (path)
+    {
+    case SpreadPath::REFERENCE:
+        return "reference";
+    case SpreadPath::COLORED:
+        return "colored";
+    case SpreadPath::CACHED:
+        return "cached";
+    case SpreadPath::SINGLE_PRECISION:
+        return "single_precision";
+    }
+    return "";
+}
+
+void
+configure_interactor(const SpreadPath path)
+{
+    Pointer<Database> db = new MemoryDatabase("LEInteractor");
+    db->putBool("use_colored_spreading", path == SpreadPath::COLORED);
+    db->putBool("use_single_precision_weights", path == SpreadPath::SINGLE_PRECISION);
+    LEInteractor::setFromDatabase(db);
+    LEInteractor::setWeightCache(nullptr);
+}
+
+// Place markers_per_cell markers per cell (on average) uniformly at random in
+// each local patch and assign them random values.
+std::vector<Markers>
+make_markers(Pointer<PatchHierarchy<NDIM> > hierarchy, const double markers_per_cell, std::mt19937& rng)
+{
+    std::uniform_real_distribution<double> value_distribution(-1.0, 1.0);
+    std::vector<Markers> markers;
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+            const double* const x_lower = patch_geom->getXLower();
+            const double* const x_upper = patch_geom->getXUpper();
+            const int num_markers = static_cast<int>(std::round(markers_per_cell * patch->getBox().size()));
+            Markers patch_markers;
+            patch_markers.X.resize(NDIM * num_markers);
+            patch_markers.F.resize(NDIM * num_markers);
+            for (int k = 0; k < num_markers; ++k)
+            {
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    std::uniform_real_distribution<double> x_distribution(x_lower[d], x_upper[d]);
+                    patch_markers.X[NDIM * k + d] = x_distribution(rng);
+                    patch_markers.F[NDIM * k + d] = value_distribution(rng);
+                }
+            }
+            markers.push_back(patch_markers);
+        }
+    }
+    return markers;
+}
+
+template <class DataType>
+void
+spread_markers(Pointer<PatchHierarchy<NDIM> > hierarchy,
+               const int q_idx,
+               const std::vector<Markers>& markers,
+               const std::string& kernel_fcn,
+               std::vector<LEInteractor::WeightCache>* const weight_caches)
+{
+    unsigned int patch_num = 0;
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_num)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<DataType> q_data = patch->getPatchData(q_idx);
+            q_data->fillAll(0.0);
+            // The markers on different patches have the same local indices, so
+            // each patch gets its own cache.
+            if (weight_caches) LEInteractor::setWeightCache(&(*weight_caches)[patch_num]);
+            const Markers& patch_markers = markers[patch_num];
+            LEInteractor::spread(
+                q_data, patch_markers.F, NDIM, patch_markers.X, NDIM, patch, patch->getBox(), kernel_fcn);
+        }
+    }
+    LEInteractor::setWeightCache(nullptr);
+}
+
+void
+accumulate_difference(const ArrayData<NDIM, double>& ref_data,
+                      const ArrayData<NDIM, double>& data,
+                      double& max_diff,
+                      double& max_ref)
+{
+    const std::size_t size = static_cast<std::size_t>(ref_data.getBox().size()) * ref_data.getDepth();
+    const double* const ref_vals = ref_data.getPointer();
+    const double* const vals = data.getPointer();
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        max_diff = std::max(max_diff, std::abs(vals[i] - ref_vals[i]));
+        max_ref = std::max(max_ref, std::abs(ref_vals[i]));
+    }
+}
+
+void
+accumulate_difference(Pointer<CellData<NDIM, double> > ref_data,
+                      Pointer<CellData<NDIM, double> > data,
+                      double& max_diff,
+                      double& max_ref)
+{
+    accumulate_difference(ref_data->getArrayData(), data->getArrayData(), max_diff, max_ref);
+}
+
+void
+accumulate_difference(Pointer<NodeData<NDIM, double> > ref_data,
+                      Pointer<NodeData<NDIM, double> > data,
+                      double& max_diff,
+                      double& max_ref)
+{
+    accumulate_difference(ref_data->getArrayData(), data->getArrayData(), max_diff, max_ref);
+}
+
+void
+accumulate_difference(Pointer<SideData<NDIM, double> > ref_data,
+                      Pointer<SideData<NDIM, double> > data,
+                      double& max_diff,
+                      double& max_ref)
+{
+    for (int axis = 0; axis < NDIM; ++axis)
+    {
+        accumulate_difference(ref_data->getArrayData(axis), data->getArrayData(axis), max_diff, max_ref);
+    }
+}
+
+// Compute the maximum difference between the values (including ghost values)
+// stored in two patch data indices relative to the maximum reference value.
+template <class DataType>
+double
+relative_difference(Pointer<PatchHierarchy<NDIM> > hierarchy, const int ref_idx, const int idx)
+{
+    double max_diff = 0.0;
+    double max_ref = 0.0;
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<DataType> ref_data = patch->getPatchData(ref_idx);
+            Pointer<DataType> data = patch->getPatchData(idx);
+            accumulate_difference(ref_data, data, max_diff, max_ref);
+        }
+    }
+    max_diff = IBTK_MPI::maxReduction(max_diff);
+    max_ref = IBTK_MPI::maxReduction(max_ref);
+    return max_ref > 0.0 ? max_diff / max_ref : max_diff;
+}
+
+template <class DataType>
+void
+test_kernel(std::ofstream& out,
+            Pointer<PatchHierarchy<NDIM> > hierarchy,
+            const int ref_idx,
+            const int idx,
+            const std::string& centering,
+            const std::string& kernel_fcn,
+            const std::vector<Markers>& markers,
+            const double markers_per_cell,
+            const int num_repetitions,
+            const double tolerance,
+            const double single_precision_tolerance)
+{
+    std::size_t num_local_markers = 0;
+    for (const Markers& patch_markers : markers) num_local_markers += patch_markers.X.size() / NDIM;
+    const double num_markers = IBTK_MPI::sumReduction(static_cast<double>(num_local_markers));
+    const int num_processes = IBTK_MPI::getNodes();
+    int num_threads = 1;
+#ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+#endif
+
+    for (const SpreadPath path :
+         { SpreadPath::REFERENCE, SpreadPath::COLORED, SpreadPath::CACHED, SpreadPath::SINGLE_PRECISION })
+    {
+        configure_interactor(path);
+        std::vector<LEInteractor::WeightCache> weight_caches(markers.size());
+        std::vector<LEInteractor::WeightCache>* const caches = path == SpreadPath::CACHED ? &weight_caches : nullptr;
+        const int q_idx = path == SpreadPath::REFERENCE ? ref_idx : idx;
+
+        // The first (untimed) pass also fills the weight caches so that the
+        // timed passes measure the reuse of the cached weights.
+        spread_markers<DataType>(hierarchy, q_idx, markers, kernel_fcn, caches);
+        IBTK_MPI::barrier();
+        const auto start = std::chrono::steady_clock::now();
+        for (int rep = 0; rep < num_repetitions; ++rep)
+        {
+            spread_markers<DataType>(hierarchy, q_idx, markers, kernel_fcn, caches);
+        }
+        const auto end = std::chrono::steady_clock::now();
+        const double seconds = IBTK_MPI::maxReduction(std::chrono::duration<double>(end - start).count());
+        const double markers_per_second = seconds > 0.0 ? num_markers * num_repetitions / seconds : 0.0;
+
+        std::ostringstream name_stream;
+        name_stream << kernel_fcn << " " << centering << " " << markers_per_cell << " markers/cell " << path_name(path);
+        const std::string name = name_stream.str();
+        plog << name << ": " << markers_per_second / num_processes << " markers/s per process, "
+             << markers_per_second / (num_processes * num_threads) << " markers/s per thread\n";
+        if (path == SpreadPath::REFERENCE) continue;
+
+        const double diff = relative_difference<DataType>(hierarchy, ref_idx, idx);
+        const double tol = path == SpreadPath::SINGLE_PRECISION ? single_precision_tolerance : tolerance;
+        out << name << ": ";
+        if (diff <= tol)
+            out << "OK\n";
+        else
+            out << "relative difference " << diff << " exceeds " << tol << "\n";
+    }
+    configure_interactor(SpreadPath::REFERENCE);
+}
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "spread_03.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        const tbox::Array<std::string> kernels = input_db->getStringArray("kernels");
+        const tbox::Array<double> markers_per_cell = input_db->getDoubleArray("markers_per_cell");
+        const int num_repetitions = input_db->getIntegerWithDefault("num_repetitions", 1);
+        const double tolerance = input_db->getDoubleWithDefault("tolerance", 1.0e-12);
+        const double single_precision_tolerance = input_db->getDoubleWithDefault("single_precision_tolerance", 1.0e-5);
+
+        int gcw = 0;
+        for (int k = 0; k < kernels.size(); ++k) gcw = std::max(gcw, LEInteractor::getMinimumGhostWidth(kernels[k]));
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ref_ctx = var_db->getContext("reference");
+        Pointer<VariableContext> ctx = var_db->getContext("optimized");
+        Pointer<CellVariable<NDIM, double> > cc_var = new CellVariable<NDIM, double>("cc", NDIM);
+        Pointer<NodeVariable<NDIM, double> > nc_var = new NodeVariable<NDIM, double>("nc", NDIM);
+        Pointer<SideVariable<NDIM, double> > sc_var = new SideVariable<NDIM, double>("sc");
+        const int cc_ref_idx = var_db->registerVariableAndContext(cc_var, ref_ctx, gcw);
+        const int cc_idx = var_db->registerVariableAndContext(cc_var, ctx, gcw);
+        const int nc_ref_idx = var_db->registerVariableAndContext(nc_var, ref_ctx, gcw);
+        const int nc_idx = var_db->registerVariableAndContext(nc_var, ctx, gcw);
+        const int sc_ref_idx = var_db->registerVariableAndContext(sc_var, ref_ctx, gcw);
+        const int sc_idx = var_db->registerVariableAndContext(sc_var, ctx, gcw);
+
+        // set up grid
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        const int tag_buffer = std::numeric_limits<int>::max();
+        int level_number = 0;
+        while ((gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (const int idx : { cc_ref_idx, cc_idx, nc_ref_idx, nc_idx, sc_ref_idx, sc_idx })
+            {
+                level->allocatePatchData(idx, 0.0);
+            }
+        }
+
+        std::ofstream out;
+        if (IBTK_MPI::getRank() == 0) out.open("output");
+
+        std::mt19937 rng(42u + IBTK_MPI::getRank());
+        for (int m = 0; m < markers_per_cell.size(); ++m)
+        {
+            const std::vector<Markers> markers = make_markers(patch_hierarchy, markers_per_cell[m], rng);
+            for (int k = 0; k < kernels.size(); ++k)
+            {
+                test_kernel<CellData<NDIM, double> >(out,
+                                                     patch_hierarchy,
+                                                     cc_ref_idx,
+                                                     cc_idx,
+                                                     "CELL",
+                                                     kernels[k],
+                                                     markers,
+                                                     markers_per_cell[m],
+                                                     num_repetitions,
+                                                     tolerance,
+                                                     single_precision_tolerance);
+                test_kernel<NodeData<NDIM, double> >(out,
+                                                     patch_hierarchy,
+                                                     nc_ref_idx,
+                                                     nc_idx,
+                                                     "NODE",
+                                                     kernels[k],
+                                                     markers,
+                                                     markers_per_cell[m],
+                                                     num_repetitions,
+                                                     tolerance,
+                                                     single_precision_tolerance);
+                test_kernel<SideData<NDIM, double> >(out,
+                                                     patch_hierarchy,
+                                                     sc_ref_idx,
+                                                     sc_idx,
+                                                     "SIDE",
+                                                     kernels[k],
+                                                     markers,
+                                                     markers_per_cell[m],
+                                                     num_repetitions,
+                                                     tolerance,
+                                                     single_precision_tolerance);
+            }
+        }
+    }
+} // main